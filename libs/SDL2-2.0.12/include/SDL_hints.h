@@ -153,6 +153,24 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer uses to draw.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Draw on the thread that flushes the renderer
+ *    "N"        - Bin the batched commands into 64x64 pixel tiles and draw the tiles on N threads
+ *    "auto"     - Use one thread per CPU core
+ *
+ *  Clears, points, filled rectangles and unscaled copies are drawn in tiles. Lines,
+ *  scaled and rotated copies are drawn on the flushing thread between the tiled
+ *  batches. The result is identical to drawing on a single thread. Render targets
+ *  that are paletted, RLE encoded or less than 16 bits per pixel always use one thread.
+ *
+ *  The hint is checked each time the command queue is flushed. By default the
+ *  software renderer uses one thread.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  *  \brief  A variable controlling whether the screensaver is enabled. 
  *
@@ -1166,7 +1184,8 @@ extern "C" {
  *  that you will either never use the underlying graphics API directly, or
  *  if you do, you will call SDL_RenderFlush() before you do so any current
  *  batch goes to the GPU before your work begins. Not following this contract
- *  will result in undefined behavior.
+ *  will result in undefined behavior. Renderers created with
+ *  SDL_CreateSoftwareRenderer() only batch when this hint is set to "1".
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
@@ -1192,6 +1211,48 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING   "SDL_EVENT_LOGGING"
 
+/**
+ *  \brief  A variable controlling whether the event queue passes events through a lock-free ring buffer.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - All events go through the mutex protected queue (default)
+ *    "1"     - Events are passed through a bounded ring buffer without taking the queue lock
+ *
+ *  The ring is lock-free for one thread pushing events and one thread calling
+ *  SDL_PollEvent()/SDL_WaitEvent(), which is the common case of a main loop
+ *  that polls while the platform or a sensor thread pushes input. Concurrent
+ *  pushers, SYSWM events and a full ring fall back to the locked queue, as do
+ *  SDL_PeepEvents() with a type range, SDL_FlushEvents() and SDL_FilterEvents(),
+ *  so the order of events is preserved either way.
+ *
+ *  This hint can be toggled on and off at runtime.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE   "SDL_EVENT_QUEUE_LOCKFREE"
+
+/**
+ *  \brief  A variable controlling whether consecutive mouse motion and key repeat events are merged in the event queue.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Every event is queued (default)
+ *    "1"     - Consecutive events are merged before they reach the queue
+ *
+ *  A mouse motion event that follows a queued mouse motion event from the same
+ *  mouse, window and button state replaces its position and timestamp and adds
+ *  its xrel/yrel to the queued one. A key repeat that follows a queued repeat of
+ *  the same key is dropped and counted in the repeat field of the queued event,
+ *  which saturates at 255. The first key down event of a press is never merged.
+ *
+ *  Events are only merged with the newest event in the queue, so the order of
+ *  events is preserved and event watchers still see every event. Mouse motion
+ *  and key repeats don't use the lock-free ring of SDL_HINT_EVENT_QUEUE_LOCKFREE
+ *  while this is enabled.
+ *
+ *  This hint can be toggled on and off at runtime.
+ */
+#define SDL_HINT_EVENT_COALESCING   "SDL_EVENT_COALESCING"
+
 
 
 /**
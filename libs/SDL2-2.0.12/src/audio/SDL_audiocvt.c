@@ -36,10 +36,29 @@
 
 #define DEBUG_AUDIOSTREAM 0
 
+#ifdef __SSE__
+#define HAVE_SSE_INTRINSICS 1
+#endif
+
 #ifdef __SSE3__
 #define HAVE_SSE3_INTRINSICS 1
 #endif
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/* AVX code is compiled for the AVX target even if the rest isn't, it's only called if SDL_HasAVX(). */
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#if defined(__AVX__)
+#define HAVE_AVX_INTRINSICS 1
+#define SDL_TARGETING(x)
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_AVX_INTRINSICS 1
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#endif
+#endif
+
 #if HAVE_SSE3_INTRINSICS
 /* Convert from stereo to mono. Average left and right. */
 static void SDLCALL
@@ -480,15 +499,329 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
-/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
+/* The filter is evaluated on a fixed window of input frames around the source frame of every output frame:
+   RESAMPLER_WINDOW_LEFT frames before it (left wing), the frame itself and RESAMPLER_WINDOW_RIGHT frames after it (right wing).
+   Taps that the wings don't reach have zero coefficients. */
+#define RESAMPLER_WINDOW_LEFT RESAMPLER_ZERO_CROSSINGS
+#define RESAMPLER_WINDOW_RIGHT (RESAMPLER_ZERO_CROSSINGS + 1)
+#define RESAMPLER_WINDOW_FRAMES (RESAMPLER_WINDOW_LEFT + 1 + RESAMPLER_WINDOW_RIGHT)
+#define RESAMPLER_MAX_CHANNELS 8
+#define RESAMPLER_MAX_BANK_PHASES 1024
+
+/* Output frame i of a resample starts at input position i * inrate / outrate. With g = gcd(inrate, outrate) the
+   fractional part repeats every (outrate / g) output frames, so coefficients of all those phases are computed once
+   (polyphase filter bank). 44100 <-> 48000 has 160 or 147 phases. Rate pairs with more than RESAMPLER_MAX_BANK_PHASES
+   phases compute coefficients for every output frame instead (still once for all channels). */
+typedef struct SDL_ResamplerBank
+{
+    int phases;  /* outrate / g */
+    int step;  /* inrate / g, phase increment per output frame */
+    float *coefficients;  /* RESAMPLER_WINDOW_FRAMES per phase, NULL if there are too many phases */
+} SDL_ResamplerBank;
+
+static void
+ResamplerPhaseCoefficients(const int phase, const int phases, float *coefficients)
+{
+    const double interpolation1 = ((double) phase) / ((double) phases);
+    const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+    const double interpolation2 = 1.0 - interpolation1;
+    const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+    int j;
+
+    SDL_memset(coefficients, '\0', RESAMPLER_WINDOW_FRAMES * sizeof (float));
+
+    /* left wing goes back from the source frame, right wing forward from the next one. */
+    for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int k = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        coefficients[RESAMPLER_WINDOW_LEFT - j] = (float) (ResamplerFilter[k] + (interpolation1 * ResamplerFilterDifference[k]));
+    }
+
+    for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int k = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        coefficients[RESAMPLER_WINDOW_LEFT + 1 + j] = (float) (ResamplerFilter[k] + (interpolation2 * ResamplerFilterDifference[k]));
+    }
+}
+
+static int
+ResamplerGCD(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* SDL_PrepareResampleFilter() has to succeed before this is called. */
+static int
+SDL_InitResamplerBank(SDL_ResamplerBank *bank, const int inrate, const int outrate, const int maxphases)
+{
+    const int gcd = ResamplerGCD(inrate, outrate);
+    int phase;
+
+    bank->phases = outrate / gcd;
+    bank->step = inrate / gcd;
+    bank->coefficients = NULL;
+
+    if (bank->phases > SDL_min(maxphases, RESAMPLER_MAX_BANK_PHASES)) {
+        return 0;  /* coefficients will be computed per output frame. */
+    }
+
+    bank->coefficients = (float *) SDL_malloc(bank->phases * RESAMPLER_WINDOW_FRAMES * sizeof (float));
+    if (!bank->coefficients) {
+        return SDL_OutOfMemory();
+    }
+
+    for (phase = 0; phase < bank->phases; phase++) {
+        ResamplerPhaseCoefficients(phase, bank->phases, bank->coefficients + (phase * RESAMPLER_WINDOW_FRAMES));
+    }
+    return 0;
+}
+
+static void
+SDL_FreeResamplerBank(SDL_ResamplerBank *bank)
+{
+    SDL_free(bank->coefficients);
+    bank->coefficients = NULL;
+}
+
+/* Computes all channels of one output frame from RESAMPLER_WINDOW_FRAMES interleaved input frames.
+   Every kernel sums the taps in the same order, so they all produce identical bits (as long as the compiler
+   doesn't contract multiplies and adds into FMA): tap t goes to partial sum (t % 4), partial sums start with
+   the product of their first tap and the result is (sum0 + sum1) + (sum2 + sum3). */
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const float *window, const float *coefficients, float *dst);
+
+static void
+ResampleChannels_Scalar(const int firstchan, const int chans, const float *window, const float *coefficients, float *dst)
+{
+    int chan, i;
+    for (chan = firstchan; chan < chans; chan++) {
+        float sums[4];
+        for (i = 0; i < 4; i++) {
+            sums[i] = window[(i * chans) + chan] * coefficients[i];
+        }
+        for (i = 4; i < RESAMPLER_WINDOW_FRAMES; i++) {
+            sums[i & 3] += window[(i * chans) + chan] * coefficients[i];
+        }
+        dst[chan] = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    }
+}
+
+static void
+SDL_ResampleFrame_Scalar(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    ResampleChannels_Scalar(0, chans, window, coefficients, dst);
+}
+
+#if HAVE_SSE_INTRINSICS
+static void
+SDL_ResampleFrame_Mono_SSE(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    __m128 sums = _mm_mul_ps(_mm_loadu_ps(window), _mm_loadu_ps(coefficients));
+    __m128 pairs;
+    sums = _mm_add_ps(sums, _mm_mul_ps(_mm_loadu_ps(window + 4), _mm_loadu_ps(coefficients + 4)));
+    sums = _mm_add_ps(sums, _mm_mul_ps(_mm_loadu_ps(window + 8), _mm_loadu_ps(coefficients + 8)));
+    pairs = _mm_add_ps(sums, _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(2, 3, 0, 1)));  /* sum0+sum1 in lane 0, sum2+sum3 in lane 2 */
+    _mm_store_ss(dst, _mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+static void
+SDL_ResampleFrame_Stereo_SSE(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    /* taps 4q,4q+1 (LRLR) go to (even), taps 4q+2,4q+3 go to (odd). */
+    __m128 even = _mm_setzero_ps();
+    __m128 odd = _mm_setzero_ps();
+    int q;
+    for (q = 0; q < RESAMPLER_WINDOW_FRAMES / 4; q++) {
+        const __m128 c = _mm_loadu_ps(coefficients + (q * 4));
+        const __m128 e = _mm_mul_ps(_mm_loadu_ps(window + (q * 8)), _mm_unpacklo_ps(c, c));
+        const __m128 o = _mm_mul_ps(_mm_loadu_ps(window + (q * 8) + 4), _mm_unpackhi_ps(c, c));
+        even = q ? _mm_add_ps(even, e) : e;
+        odd = q ? _mm_add_ps(odd, o) : o;
+    }
+    even = _mm_add_ps(even, _mm_movehl_ps(even, even));
+    odd = _mm_add_ps(odd, _mm_movehl_ps(odd, odd));
+    _mm_storel_pi((__m64 *) dst, _mm_add_ps(even, odd));
+}
+
+static void
+SDL_ResampleFrame_SSE(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    int chan, i;
+    for (chan = 0; chan + 4 <= chans; chan += 4) {
+        __m128 sums[4];
+        for (i = 0; i < 4; i++) {
+            sums[i] = _mm_mul_ps(_mm_loadu_ps(window + (i * chans) + chan), _mm_set1_ps(coefficients[i]));
+        }
+        for (i = 4; i < RESAMPLER_WINDOW_FRAMES; i++) {
+            sums[i & 3] = _mm_add_ps(sums[i & 3], _mm_mul_ps(_mm_loadu_ps(window + (i * chans) + chan), _mm_set1_ps(coefficients[i])));
+        }
+        _mm_storeu_ps(dst + chan, _mm_add_ps(_mm_add_ps(sums[0], sums[1]), _mm_add_ps(sums[2], sums[3])));
+    }
+    ResampleChannels_Scalar(chan, chans, window, coefficients, dst);
+}
+#endif
+
+#if HAVE_AVX_INTRINSICS
+static void SDL_TARGETING("avx")
+SDL_ResampleFrame_Stereo_AVX(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    /* one register holds taps 4q..4q+3, lanes of the low half are the even partial sums of the SSE version. */
+    __m256 sums = _mm256_setzero_ps();
+    __m128 even, odd;
+    int q;
+    for (q = 0; q < RESAMPLER_WINDOW_FRAMES / 4; q++) {
+        const __m128 c = _mm_loadu_ps(coefficients + (q * 4));
+        const __m256 cc = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(c, c)), _mm_unpackhi_ps(c, c), 1);
+        const __m256 p = _mm256_mul_ps(_mm256_loadu_ps(window + (q * 8)), cc);
+        sums = q ? _mm256_add_ps(sums, p) : p;
+    }
+    even = _mm256_castps256_ps128(sums);
+    odd = _mm256_extractf128_ps(sums, 1);
+    even = _mm_add_ps(even, _mm_movehl_ps(even, even));
+    odd = _mm_add_ps(odd, _mm_movehl_ps(odd, odd));
+    _mm_storel_pi((__m64 *) dst, _mm_add_ps(even, odd));
+}
+
+static void SDL_TARGETING("avx")
+SDL_ResampleFrame_AVX(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    int chan, i;
+    for (chan = 0; chan + 8 <= chans; chan += 8) {
+        __m256 sums[4];
+        for (i = 0; i < 4; i++) {
+            sums[i] = _mm256_mul_ps(_mm256_loadu_ps(window + (i * chans) + chan), _mm256_set1_ps(coefficients[i]));
+        }
+        for (i = 4; i < RESAMPLER_WINDOW_FRAMES; i++) {
+            sums[i & 3] = _mm256_add_ps(sums[i & 3], _mm256_mul_ps(_mm256_loadu_ps(window + (i * chans) + chan), _mm256_set1_ps(coefficients[i])));
+        }
+        _mm256_storeu_ps(dst + chan, _mm256_add_ps(_mm256_add_ps(sums[0], sums[1]), _mm256_add_ps(sums[2], sums[3])));
+    }
+    for (; chan + 4 <= chans; chan += 4) {
+        __m128 sums[4];
+        for (i = 0; i < 4; i++) {
+            sums[i] = _mm_mul_ps(_mm_loadu_ps(window + (i * chans) + chan), _mm_set1_ps(coefficients[i]));
+        }
+        for (i = 4; i < RESAMPLER_WINDOW_FRAMES; i++) {
+            sums[i & 3] = _mm_add_ps(sums[i & 3], _mm_mul_ps(_mm_loadu_ps(window + (i * chans) + chan), _mm_set1_ps(coefficients[i])));
+        }
+        _mm_storeu_ps(dst + chan, _mm_add_ps(_mm_add_ps(sums[0], sums[1]), _mm_add_ps(sums[2], sums[3])));
+    }
+    ResampleChannels_Scalar(chan, chans, window, coefficients, dst);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_ResampleFrame_Mono_NEON(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    float32x4_t sums = vmulq_f32(vld1q_f32(window), vld1q_f32(coefficients));
+    float32x4_t pairs;
+    sums = vaddq_f32(sums, vmulq_f32(vld1q_f32(window + 4), vld1q_f32(coefficients + 4)));
+    sums = vaddq_f32(sums, vmulq_f32(vld1q_f32(window + 8), vld1q_f32(coefficients + 8)));
+    pairs = vaddq_f32(sums, vrev64q_f32(sums));  /* sum0+sum1 in lane 0, sum2+sum3 in lane 2 */
+    dst[0] = vgetq_lane_f32(pairs, 0) + vgetq_lane_f32(pairs, 2);
+}
+
+static void
+SDL_ResampleFrame_Stereo_NEON(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    float32x4_t even = vdupq_n_f32(0.0f);
+    float32x4_t odd = vdupq_n_f32(0.0f);
+    int q;
+    for (q = 0; q < RESAMPLER_WINDOW_FRAMES / 4; q++) {
+        const float32x4_t c = vld1q_f32(coefficients + (q * 4));
+        const float32x4x2_t cc = vzipq_f32(c, c);
+        const float32x4_t e = vmulq_f32(vld1q_f32(window + (q * 8)), cc.val[0]);
+        const float32x4_t o = vmulq_f32(vld1q_f32(window + (q * 8) + 4), cc.val[1]);
+        even = q ? vaddq_f32(even, e) : e;
+        odd = q ? vaddq_f32(odd, o) : o;
+    }
+    vst1_f32(dst, vadd_f32(vadd_f32(vget_low_f32(even), vget_high_f32(even)), vadd_f32(vget_low_f32(odd), vget_high_f32(odd))));
+}
+
+static void
+SDL_ResampleFrame_NEON(const int chans, const float *window, const float *coefficients, float *dst)
+{
+    int chan, i;
+    for (chan = 0; chan + 4 <= chans; chan += 4) {
+        float32x4_t sums[4];
+        for (i = 0; i < 4; i++) {
+            sums[i] = vmulq_n_f32(vld1q_f32(window + (i * chans) + chan), coefficients[i]);
+        }
+        for (i = 4; i < RESAMPLER_WINDOW_FRAMES; i++) {
+            sums[i & 3] = vaddq_f32(sums[i & 3], vmulq_n_f32(vld1q_f32(window + (i * chans) + chan), coefficients[i]));
+        }
+        vst1q_f32(dst + chan, vaddq_f32(vaddq_f32(sums[0], sums[1]), vaddq_f32(sums[2], sums[3])));
+    }
+    ResampleChannels_Scalar(chan, chans, window, coefficients, dst);
+}
+#endif
+
+static SDL_ResampleFrameFunc
+ChooseResampleFrameFunc(const int chans)
+{
+#if HAVE_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        if (chans == 2) {
+            return SDL_ResampleFrame_Stereo_AVX;
+        } else if (chans >= 8) {
+            return SDL_ResampleFrame_AVX;
+        }
+    }
+#endif
+#if HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        switch (chans) {
+            case 1: return SDL_ResampleFrame_Mono_SSE;
+            case 2: return SDL_ResampleFrame_Stereo_SSE;
+            default: return SDL_ResampleFrame_SSE;
+        }
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        switch (chans) {
+            case 1: return SDL_ResampleFrame_Mono_NEON;
+            case 2: return SDL_ResampleFrame_Stereo_NEON;
+            default: return SDL_ResampleFrame_NEON;
+        }
+    }
+#endif
+    return SDL_ResampleFrame_Scalar;
+}
+
+/* copies window of frame (srcindex) that reaches into the paddings. */
+static void
+GatherResampleWindow(const int chans, const int srcindex, const int paddinglen,
+                     const float *lpadding, const float *rpadding,
+                     const float *inbuf, const int inframes, float *window)
+{
+    int i;
+    for (i = 0; i < RESAMPLER_WINDOW_FRAMES; i++) {
+        const int srcframe = srcindex - RESAMPLER_WINDOW_LEFT + i;
+        const float *src;
+        if (srcframe < 0) {
+            src = lpadding + ((paddinglen + srcframe) * chans);
+        } else if (srcframe >= inframes) {
+            src = rpadding + ((srcframe - inframes) * chans);
+        } else {
+            src = inbuf + (srcframe * chans);
+        }
+        SDL_memcpy(window + (i * chans), src, chans * sizeof (float));
+    }
+}
+
+/* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes.
+   The output restarts at phase zero (first output frame is aligned with the first input frame) on every call. */
 static int
 SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                        const SDL_ResamplerBank *bank,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
 {
-    const double finrate = (double) inrate;
-    const double outtimeincr = 1.0 / ((float) outrate);
     const double  ratio = ((float) outrate) / ((float) inrate);
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof (float);
@@ -496,43 +829,60 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    const SDL_ResampleFrameFunc resample = ChooseResampleFrameFunc(chans);
+    float window[RESAMPLER_WINDOW_FRAMES * RESAMPLER_MAX_CHANNELS];
+    float framecoefficients[RESAMPLER_WINDOW_FRAMES];
+    const float *coefficients;
     float *dst = outbuf;
-    double outtime = 0.0;
-    int i, j, chan;
-
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const double intime = ((double) srcindex) / finrate;
-        const double innexttime = ((double) (srcindex + 1)) / finrate;
-        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const double interpolation2 = 1.0 - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
-
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            /* !!! FIXME: do both wings in one loop */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
+    int srcindex = 0;
+    int phase = 0;
+    int i = 0;
+
+    SDL_assert(chans <= RESAMPLER_MAX_CHANNELS);
+    SDL_assert(paddinglen >= RESAMPLER_WINDOW_RIGHT);
+
+    #define RESAMPLER_COEFFICIENTS() \
+        if (bank->coefficients) { \
+            coefficients = bank->coefficients + (phase * RESAMPLER_WINDOW_FRAMES); \
+        } else { \
+            ResamplerPhaseCoefficients(phase, bank->phases, framecoefficients); \
+            coefficients = framecoefficients; \
+        }
 
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * ResamplerFilterDifference[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
-            *(dst++) = outsample;
+    #define RESAMPLER_NEXT_FRAME() \
+        dst += chans; \
+        phase += bank->step; \
+        if (phase >= bank->phases) { \
+            srcindex += phase / bank->phases; \
+            phase %= bank->phases; \
         }
 
-        outtime += outtimeincr;
+    /* pre loop, window starts in the left padding. */
+    for (; (i < outframes) && (srcindex < RESAMPLER_WINDOW_LEFT); i++) {
+        RESAMPLER_COEFFICIENTS();
+        GatherResampleWindow(chans, srcindex, paddinglen, lpadding, rpadding, inbuf, inframes, window);
+        resample(chans, window, coefficients, dst);
+        RESAMPLER_NEXT_FRAME();
+    }
+
+    /* the whole window is in the input buffer. */
+    for (; (i < outframes) && ((srcindex + RESAMPLER_WINDOW_RIGHT) < inframes); i++) {
+        RESAMPLER_COEFFICIENTS();
+        resample(chans, inbuf + ((srcindex - RESAMPLER_WINDOW_LEFT) * chans), coefficients, dst);
+        RESAMPLER_NEXT_FRAME();
     }
 
+    /* post loop, window ends in the right padding. */
+    for (; i < outframes; i++) {
+        RESAMPLER_COEFFICIENTS();
+        GatherResampleWindow(chans, srcindex, paddinglen, lpadding, rpadding, inbuf, inframes, window);
+        resample(chans, window, coefficients, dst);
+        RESAMPLER_NEXT_FRAME();
+    }
+
+    #undef RESAMPLER_COEFFICIENTS
+    #undef RESAMPLER_NEXT_FRAME
+
     return outframes * chans * sizeof (float);
 }
 
@@ -721,6 +1071,7 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     const int requestedpadding = ResamplerPadding(inrate, outrate);
     int paddingsamples;
     float *padding;
+    SDL_ResamplerBank bank;
 
     if (requestedpadding < SDL_MAX_SINT32 / chans) {
         paddingsamples = requestedpadding * chans;
@@ -736,8 +1087,15 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    /* don't compute more phases than there are frames to resample. */
+    if (SDL_InitResamplerBank(&bank, inrate, outrate, srclen / (chans * (int) sizeof (float))) < 0) {
+        SDL_free(padding);
+        return;
+    }
+
+    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, &bank, padding, padding, src, srclen, dst, dstlen);
 
+    SDL_FreeResamplerBank(&bank);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt);  /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -1115,6 +1473,7 @@ struct _SDL_AudioStream
     int resampler_padding_samples;
     float *resampler_padding;
     void *resampler_state;
+    SDL_ResamplerBank resampler_bank;
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
@@ -1244,7 +1603,7 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(chans, inrate, outrate, &stream->resampler_bank, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -1262,6 +1621,7 @@ SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
 static void
 SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
+    SDL_FreeResamplerBank(&stream->resampler_bank);
     SDL_free(stream->resampler_state);
 }
 
@@ -1353,6 +1713,13 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
                 return NULL;
             }
 
+            if (SDL_InitResamplerBank(&retval->resampler_bank, src_rate, dst_rate, RESAMPLER_MAX_BANK_PHASES) < 0) {
+                SDL_free(retval->resampler_state);
+                retval->resampler_state = NULL;
+                SDL_FreeAudioStream(retval);
+                return NULL;
+            }
+
             retval->resampler_func = SDL_ResampleAudioStream;
             retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
             retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
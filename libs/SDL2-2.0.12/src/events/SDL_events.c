@@ -27,6 +27,7 @@
 #include "SDL_thread.h"
 #include "SDL_events_c.h"
 #include "../timer/SDL_timer_c.h"
+#include "../SDL_hints_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
 #endif
@@ -91,6 +92,38 @@ static struct
     SDL_SysWMEntry *wmmsg_free;
 } SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
 
+/* Lock-free single producer, single consumer ring in front of the locked queue,
+   enabled by SDL_HINT_EVENT_QUEUE_LOCKFREE.
+
+   The producer only adds to the ring while the locked list is empty, so every
+   event in the ring is older than every event in the list and the consumer can
+   drain the ring first. Anything that has to look at the whole queue takes the
+   queue lock and moves the ring to the front of the list first. The spinlocks
+   are only ever try-locked on the fast paths: a second concurrent producer or
+   consumer just takes the locked path instead of waiting. */
+#define SDL_EVENT_RING_SIZE 1024    /* must be a power of 2 */
+#define SDL_EVENT_RING_MASK (SDL_EVENT_RING_SIZE-1)
+
+static struct
+{
+    /* Consumer side */
+    SDL_SpinLock consumer_lock;
+    SDL_atomic_t head;
+    unsigned cached_tail;
+
+    char cache_pad1[SDL_CACHELINE_SIZE-sizeof(SDL_SpinLock)-sizeof(SDL_atomic_t)-sizeof(unsigned)];
+
+    /* Producer side */
+    SDL_SpinLock producer_lock;
+    SDL_atomic_t tail;
+    unsigned cached_head;
+
+    char cache_pad2[SDL_CACHELINE_SIZE-sizeof(SDL_SpinLock)-sizeof(SDL_atomic_t)-sizeof(unsigned)];
+
+    /* NULL while the ring is disabled, changes only with both spinlocks held */
+    SDL_Event *entries;
+} SDL_EventRing;
+
 
 /* 0 (default) means no logging, 1 means logging, 2 means logging with mouse and finger motion */
 static int SDL_DoEventLogging = 0;
@@ -101,6 +134,22 @@ SDL_EventLoggingChanged(void *userdata, const char *name, const char *oldValue,
     SDL_DoEventLogging = (hint && *hint) ? SDL_max(SDL_min(SDL_atoi(hint), 2), 0) : 0;
 }
 
+/* 0 (default) means every event is queued, 1 means consecutive motion and key repeats are merged */
+static int SDL_DoEventCoalescing = 0;
+
+static void SDLCALL
+SDL_EventCoalescingChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_DoEventCoalescing = SDL_GetStringBoolean(hint, SDL_FALSE) ? 1 : 0;
+}
+
+static SDL_bool
+SDL_IsCoalescableEvent(const SDL_Event *event)
+{
+    return (event->type == SDL_MOUSEMOTION ||
+            (event->type == SDL_KEYDOWN && event->key.repeat)) ? SDL_TRUE : SDL_FALSE;
+}
+
 static void
 SDL_LogEvent(const SDL_Event *event)
 {
@@ -362,7 +411,18 @@ SDL_StopEventLoop(void)
                 SDL_EventQ.max_events_seen);
     }
 
-    /* Clean out EventQ */
+    /* Clean out the ring and EventQ */
+    SDL_AtomicLock(&SDL_EventRing.consumer_lock);
+    SDL_AtomicLock(&SDL_EventRing.producer_lock);
+    SDL_free(SDL_EventRing.entries);
+    SDL_EventRing.entries = NULL;
+    SDL_AtomicSet(&SDL_EventRing.head, 0);
+    SDL_AtomicSet(&SDL_EventRing.tail, 0);
+    SDL_EventRing.cached_head = 0;
+    SDL_EventRing.cached_tail = 0;
+    SDL_AtomicUnlock(&SDL_EventRing.producer_lock);
+    SDL_AtomicUnlock(&SDL_EventRing.consumer_lock);
+
     for (entry = SDL_EventQ.head; entry; ) {
         SDL_EventEntry *next = entry->next;
         SDL_free(entry);
@@ -538,6 +598,217 @@ SDL_CutEvent(SDL_EventEntry *entry)
     SDL_AtomicAdd(&SDL_EventQ.count, -1);
 }
 
+/* Try to add an event to the ring without taking the queue lock */
+static SDL_bool
+SDL_RingPushEvent(const SDL_Event *event)
+{
+    SDL_bool pushed = SDL_FALSE;
+    unsigned tail;
+
+    if (event->type == SDL_SYSWMEVENT) {
+        return SDL_FALSE;   /* the message has to be copied into an entry */
+    }
+    if (SDL_DoEventCoalescing && SDL_IsCoalescableEvent(event)) {
+        return SDL_FALSE;   /* published ring entries can't be merged into */
+    }
+    if (!SDL_AtomicTryLock(&SDL_EventRing.producer_lock)) {
+        return SDL_FALSE;
+    }
+
+    /* Events in the locked list would be overtaken by this one */
+    if (SDL_EventRing.entries && SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+        tail = (unsigned) SDL_AtomicGet(&SDL_EventRing.tail);
+        if ((tail - SDL_EventRing.cached_head) >= SDL_EVENT_RING_SIZE) {
+            SDL_EventRing.cached_head = (unsigned) SDL_AtomicGet(&SDL_EventRing.head);
+        }
+        if ((tail - SDL_EventRing.cached_head) < SDL_EVENT_RING_SIZE) {
+            if (SDL_DoEventLogging) {
+                SDL_LogEvent(event);
+            }
+            SDL_EventRing.entries[tail & SDL_EVENT_RING_MASK] = *event;
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSet(&SDL_EventRing.tail, (int) (tail + 1));
+            pushed = SDL_TRUE;
+        }
+    }
+
+    SDL_AtomicUnlock(&SDL_EventRing.producer_lock);
+    return pushed;
+}
+
+/* Try to take up to numevents events from the ring without taking the queue lock,
+   returns the number of events taken or -1 if another thread is consuming */
+static int
+SDL_RingPopEvents(SDL_Event *events, int numevents)
+{
+    int used = 0;
+    unsigned head;
+
+    if (!SDL_AtomicTryLock(&SDL_EventRing.consumer_lock)) {
+        return -1;
+    }
+
+    if (SDL_EventRing.entries) {
+        head = (unsigned) SDL_AtomicGet(&SDL_EventRing.head);
+        if (head == SDL_EventRing.cached_tail) {
+            SDL_EventRing.cached_tail = (unsigned) SDL_AtomicGet(&SDL_EventRing.tail);
+            SDL_MemoryBarrierAcquire();
+        }
+        while (used < numevents && head != SDL_EventRing.cached_tail) {
+            events[used++] = SDL_EventRing.entries[head & SDL_EVENT_RING_MASK];
+            ++head;
+        }
+        if (used > 0) {
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSet(&SDL_EventRing.head, (int) head);
+        }
+    }
+
+    SDL_AtomicUnlock(&SDL_EventRing.consumer_lock);
+    return used;
+}
+
+/* Move the events in the ring to the front of the locked list -- called with the
+   queue locked. The ring spinlocks stay held on return, so that nothing can be
+   added to the ring until the caller is done with the list. */
+static void
+SDL_LockAndMergeRing(void)
+{
+    SDL_EventEntry *entry;
+    unsigned head, tail;
+    int count = 0;
+
+    SDL_AtomicLock(&SDL_EventRing.consumer_lock);
+    SDL_AtomicLock(&SDL_EventRing.producer_lock);
+
+    if (!SDL_EventRing.entries) {
+        return;
+    }
+
+    head = (unsigned) SDL_AtomicGet(&SDL_EventRing.head);
+    tail = (unsigned) SDL_AtomicGet(&SDL_EventRing.tail);
+    SDL_MemoryBarrierAcquire();
+
+    /* Prepend from the newest to the oldest event */
+    while (tail != head) {
+        --tail;
+        if (SDL_EventQ.free == NULL) {
+            entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+            if (!entry) {
+                continue;
+            }
+        } else {
+            entry = SDL_EventQ.free;
+            SDL_EventQ.free = entry->next;
+        }
+
+        entry->event = SDL_EventRing.entries[tail & SDL_EVENT_RING_MASK];
+        entry->prev = NULL;
+        entry->next = SDL_EventQ.head;
+        if (SDL_EventQ.head) {
+            SDL_EventQ.head->prev = entry;
+        } else {
+            SDL_EventQ.tail = entry;
+        }
+        SDL_EventQ.head = entry;
+        ++count;
+    }
+
+    SDL_AtomicSet(&SDL_EventRing.head, (int) head);
+    SDL_AtomicSet(&SDL_EventRing.tail, (int) head);
+    SDL_EventRing.cached_head = head;
+    SDL_EventRing.cached_tail = head;
+
+    if (count > 0) {
+        count = SDL_AtomicAdd(&SDL_EventQ.count, count) + count;
+        if (count > SDL_EventQ.max_events_seen) {
+            SDL_EventQ.max_events_seen = count;
+        }
+    }
+}
+
+static void
+SDL_UnlockRing(void)
+{
+    SDL_AtomicUnlock(&SDL_EventRing.producer_lock);
+    SDL_AtomicUnlock(&SDL_EventRing.consumer_lock);
+}
+
+/* Merge an event into the newest queued event if they are consecutive motion
+   or key repeats -- called with the queue locked */
+static SDL_bool
+SDL_CoalesceEvent(const SDL_Event *event)
+{
+    SDL_Event *last;
+    SDL_bool merged = SDL_FALSE;
+
+    SDL_LockAndMergeRing();
+
+    if (SDL_EventQ.tail) {
+        last = &SDL_EventQ.tail->event;
+        if (event->type == SDL_MOUSEMOTION && last->type == SDL_MOUSEMOTION &&
+            last->motion.windowID == event->motion.windowID &&
+            last->motion.which == event->motion.which &&
+            last->motion.state == event->motion.state) {
+            last->motion.timestamp = event->motion.timestamp;
+            last->motion.x = event->motion.x;
+            last->motion.y = event->motion.y;
+            last->motion.xrel += event->motion.xrel;
+            last->motion.yrel += event->motion.yrel;
+            merged = SDL_TRUE;
+        } else if (event->type == SDL_KEYDOWN && last->type == SDL_KEYDOWN &&
+                   event->key.repeat && last->key.repeat &&
+                   last->key.windowID == event->key.windowID &&
+                   last->key.keysym.scancode == event->key.keysym.scancode &&
+                   last->key.keysym.sym == event->key.keysym.sym &&
+                   last->key.keysym.mod == event->key.keysym.mod) {
+            last->key.timestamp = event->key.timestamp;
+            if (last->key.repeat < 255) {
+                ++last->key.repeat;
+            }
+            merged = SDL_TRUE;
+        }
+    }
+
+    SDL_UnlockRing();
+
+    if (merged && SDL_DoEventLogging) {
+        SDL_LogEvent(event);
+    }
+    return merged;
+}
+
+static void SDLCALL
+SDL_EventQueueLockFreeChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_Event *entries = NULL;
+
+    if (SDL_GetStringBoolean(hint, SDL_FALSE)) {
+        entries = (SDL_Event *)SDL_malloc(SDL_EVENT_RING_SIZE * sizeof(*entries));
+        if (!entries) {
+            SDL_OutOfMemory();
+            return;
+        }
+    }
+
+    if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+        SDL_LockAndMergeRing();
+        if (entries && SDL_EventRing.entries) {
+            /* Already enabled */
+            SDL_free(entries);
+        } else {
+            SDL_free(SDL_EventRing.entries);
+            SDL_EventRing.entries = entries;
+        }
+        SDL_UnlockRing();
+        if (SDL_EventQ.lock) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+        }
+    } else {
+        SDL_free(entries);
+    }
+}
+
 /* Lock the event queue, take a peep at it, and unlock it */
 int
 SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
@@ -553,12 +824,39 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
-    /* Lock the event queue */
     used = 0;
+
+    /* Try the lock-free ring first. Adding falls back to the locked list at the
+       first event that doesn't fit, getting only for the whole range of types. */
+    i = 0;
+    if (action == SDL_ADDEVENT) {
+        while (i < numevents && SDL_RingPushEvent(&events[i])) {
+            ++i;
+        }
+        used = i;
+        if (i == numevents) {
+            return (used);
+        }
+    } else if (action == SDL_GETEVENT && events && numevents > 0 &&
+               minType <= SDL_FIRSTEVENT && maxType >= SDL_LASTEVENT) {
+        used = SDL_RingPopEvents(events, numevents);
+        if (used < 0) {
+            used = 0;
+        } else if (used == numevents || SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+            return (used);
+        }
+    }
+
+    /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+            for (; i < numevents; ++i) {
+                if (SDL_DoEventCoalescing && SDL_IsCoalescableEvent(&events[i]) &&
+                    SDL_CoalesceEvent(&events[i])) {
+                    ++used;
+                } else {
+                    used += SDL_AddEvent(&events[i]);
+                }
             }
         } else {
             SDL_EventEntry *entry, *next;
@@ -577,6 +875,7 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                 SDL_EventQ.wmmsg_used = NULL;
             }
 
+            SDL_LockAndMergeRing();
             for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
                 next = entry->next;
                 type = entry->event.type;
@@ -607,6 +906,7 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                     ++used;
                 }
             }
+            SDL_UnlockRing();
         }
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
@@ -659,6 +959,7 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
+        SDL_LockAndMergeRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -666,6 +967,7 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
                 SDL_CutEvent(entry);
             }
         }
+        SDL_UnlockRing();
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
         }
@@ -893,12 +1195,14 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_LockAndMergeRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
                 SDL_CutEvent(entry);
             }
         }
+        SDL_UnlockRing();
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
         }
@@ -1014,6 +1318,9 @@ SDL_EventsInit(void)
         return -1;
     }
 
+    SDL_AddHintCallback(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_EventQueueLockFreeChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
+
     SDL_QuitInit();
 
     return 0;
@@ -1023,6 +1330,8 @@ void
 SDL_EventsQuit(void)
 {
     SDL_QuitQuit();
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCING, SDL_EventCoalescingChanged, NULL);
+    SDL_DelHintCallback(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_EventQueueLockFreeChanged, NULL);
     SDL_StopEventLoop();
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 }
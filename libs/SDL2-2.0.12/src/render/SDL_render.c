@@ -924,6 +924,9 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         /* new textures start at zero, so we start at 1 so first render doesn't flush by accident. */
         renderer->render_command_generation = 1;
 
+        /* The app owns the surface and may touch it between draws, so only batch on request. */
+        renderer->batching = SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE);
+
         SDL_RenderSetViewport(renderer, NULL);
     }
     return renderer;
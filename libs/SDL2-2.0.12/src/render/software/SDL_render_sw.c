@@ -26,6 +26,11 @@
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_thread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -44,10 +49,57 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* Tiled execution of the command queue, see SDL_HINT_RENDER_SOFTWARE_THREADS */
+#define SW_TILE_SIZE    64
+#define SW_MAX_THREADS  256
+
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect clip;          /* the clip rect the serial path would have used */
+    SDL_Rect bounds;        /* the pixels the command can touch, inside clip */
+    SDL_Surface *src;       /* copies only: the texture and its blit state when queued */
+    SDL_BlitInfo info;
+    SDL_BlitFunc blit;
+} SW_TileCommand;
+
+struct SW_TilePool;
+
+typedef struct
+{
+    SDL_atomic_t next;      /* next unclaimed tile in this worker's range */
+    int end;
+    int index;
+    struct SW_TilePool *pool;
+    SDL_Surface *surface;   /* header for the render target with a private clip rect */
+    SDL_Thread *thread;
+    char cache_pad[SDL_CACHELINE_SIZE];
+} SW_TileWorker;
+
+typedef struct SW_TilePool
+{
+    int num_workers;        /* including the thread running the command queue */
+    SW_TileWorker *workers;
+    SDL_sem *work;
+    SDL_sem *done;
+    SDL_bool quit;
+
+    SW_TileCommand *commands;
+    int num_commands;
+    int max_commands;
+    int *tile_offsets;      /* the commands of tile i are tile_commands[tile_offsets[i]..tile_offsets[i+1]] */
+    int max_tiles;
+    int *tile_commands;
+    int max_tile_commands;
+    int tiles_x;
+    void *vertices;
+} SW_TilePool;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TilePool *pool;
 } SW_RenderData;
 
 
@@ -585,163 +637,753 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+static void
+GetDrawClipRect(const SW_DrawStateCache *drawstate, SDL_Rect *clip_rect)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
+
+    if (cliprect != NULL) {
+        clip_rect->x = cliprect->x + viewport->x;
+        clip_rect->y = cliprect->y + viewport->y;
+        clip_rect->w = cliprect->w;
+        clip_rect->h = cliprect->h;
+        SDL_IntersectRect(viewport, clip_rect, clip_rect);
+    } else {
+        *clip_rect = *viewport;
+    }
+}
+
 static void
 SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     if (drawstate->surface_cliprect_dirty) {
-        const SDL_Rect *viewport = drawstate->viewport;
-        const SDL_Rect *cliprect = drawstate->cliprect;
-        SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
-
-        if (cliprect != NULL) {
-            SDL_Rect clip_rect;
-            clip_rect.x = cliprect->x + viewport->x;
-            clip_rect.y = cliprect->y + viewport->y;
-            clip_rect.w = cliprect->w;
-            clip_rect.h = cliprect->h;
-            SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
-        } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
-        }
+        SDL_Rect clip_rect;
+        GetDrawClipRect(drawstate, &clip_rect);
+        SDL_SetClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
-static int
-SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+static void
+SW_RunCommand(SDL_Renderer * renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, SW_DrawStateCache *drawstate)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    switch (cmd->command) {
+        case SDL_RENDERCMD_SETDRAWCOLOR: {
+            break;  /* Not used in this backend. */
+        }
 
-    if (!surface) {
-        return -1;
+        case SDL_RENDERCMD_SETVIEWPORT: {
+            drawstate->viewport = &cmd->data.viewport.rect;
+            drawstate->surface_cliprect_dirty = SDL_TRUE;
+            break;
+        }
+
+        case SDL_RENDERCMD_SETCLIPRECT: {
+            drawstate->cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;                
+            drawstate->surface_cliprect_dirty = SDL_TRUE;
+            break;
+        }
+
+        case SDL_RENDERCMD_CLEAR: {
+            const Uint8 r = cmd->data.color.r;
+            const Uint8 g = cmd->data.color.g;
+            const Uint8 b = cmd->data.color.b;
+            const Uint8 a = cmd->data.color.a;
+            /* By definition the clear ignores the clip rect */
+            SDL_SetClipRect(surface, NULL);
+            SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
+            drawstate->surface_cliprect_dirty = SDL_TRUE;
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            SetDrawState(surface, drawstate);
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            SetDrawState(surface, drawstate);
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            SetDrawState(surface, drawstate);
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_Rect *srcrect = verts;
+            SDL_Rect *dstrect = verts + 1;
+            SDL_Texture *texture = cmd->data.draw.texture;
+            SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+
+            SetDrawState(surface, drawstate);
+
+            PrepTextureForCopy(cmd);
+
+            if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
+                SDL_BlitSurface(src, srcrect, surface, dstrect);
+            } else {
+                /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+                 * to avoid potentially frequent RLE encoding/decoding.
+                 */
+                SDL_SetSurfaceRLE(surface, 0);
+                SDL_BlitScaled(src, srcrect, surface, dstrect);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            SetDrawState(surface, drawstate);
+            PrepTextureForCopy(cmd);
+            SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
+                            &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
+            break;
+        }
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
     }
+}
 
-    drawstate.viewport = NULL;
-    drawstate.cliprect = NULL;
-    drawstate.surface_cliprect_dirty = SDL_TRUE;
+static int SDLCALL SW_TileWorkerThread(void *data);
 
-    while (cmd) {
-        switch (cmd->command) {
-            case SDL_RENDERCMD_SETDRAWCOLOR: {
-                break;  /* Not used in this backend. */
+static void
+SW_DestroyTilePool(SW_TilePool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    pool->quit = SDL_TRUE;
+    for (i = 1; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_SemPost(pool->work);
+        }
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+        SDL_FreeSurface(pool->workers[i].surface);
+    }
+    if (pool->work) {
+        SDL_DestroySemaphore(pool->work);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    SDL_free(pool->workers);
+    SDL_free(pool->commands);
+    SDL_free(pool->tile_offsets);
+    SDL_free(pool->tile_commands);
+    SDL_free(pool);
+}
+
+static SW_TilePool *
+SW_CreateTilePool(int num_workers)
+{
+    SW_TilePool *pool;
+    int i;
+
+    pool = (SW_TilePool *) SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->workers = (SW_TileWorker *) SDL_calloc(num_workers, sizeof(*pool->workers));
+    if (!pool->workers) {
+        SW_DestroyTilePool(pool);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    pool->num_workers = num_workers;
+    pool->work = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->work || !pool->done) {
+        SW_DestroyTilePool(pool);
+        return NULL;
+    }
+
+    /* The thread running the command queue is worker 0 */
+    for (i = 0; i < num_workers; ++i) {
+        SW_TileWorker *worker = &pool->workers[i];
+        worker->index = i;
+        worker->pool = pool;
+        if (i > 0) {
+            worker->thread = SDL_CreateThread(SW_TileWorkerThread, "SDLRenderSW", worker);
+            if (!worker->thread) {
+                SW_DestroyTilePool(pool);
+                return NULL;
             }
+        }
+    }
+    return pool;
+}
+
+/* Returns SDL_TRUE if the command queue should be run through the tile pool */
+static SDL_bool
+SW_PrepareTilePool(SW_RenderData *data, SDL_Surface *surface)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SW_TilePool *pool;
+    int num_workers = 1;
+    int num_tiles;
+    int i;
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "auto") == 0) {
+            num_workers = SDL_GetCPUCount();
+        } else {
+            num_workers = SDL_atoi(hint);
+        }
+    }
+    num_workers = SDL_min(num_workers, SW_MAX_THREADS);
+
+    if (num_workers <= 1) {
+        SW_DestroyTilePool(data->pool);
+        data->pool = NULL;
+        return SDL_FALSE;
+    }
 
-            case SDL_RENDERCMD_SETVIEWPORT: {
-                drawstate.viewport = &cmd->data.viewport.rect;
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+    /* Tiles write straight into the pixels, so they need a plain packed target */
+    if (!surface->pixels || surface->format->BytesPerPixel < 2 ||
+        surface->format->palette || SDL_MUSTLOCK(surface)) {
+        return SDL_FALSE;
+    }
+
+    if (data->pool && data->pool->num_workers != num_workers) {
+        SW_DestroyTilePool(data->pool);
+        data->pool = NULL;
+    }
+    if (!data->pool) {
+        data->pool = SW_CreateTilePool(num_workers);
+        if (!data->pool) {
+            return SDL_FALSE;
+        }
+    }
+    pool = data->pool;
+
+    /* Each worker draws through its own surface header, so it can clip to its tile */
+    for (i = 0; i < num_workers; ++i) {
+        SW_TileWorker *worker = &pool->workers[i];
+        SDL_Surface *header = worker->surface;
+        if (!header || header->pixels != surface->pixels ||
+            header->w != surface->w || header->h != surface->h ||
+            header->pitch != surface->pitch ||
+            header->format->format != surface->format->format) {
+            SDL_FreeSurface(header);
+            worker->surface = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels,
+                                  surface->w, surface->h, surface->format->BitsPerPixel,
+                                  surface->pitch, surface->format->format);
+            if (!worker->surface) {
+                return SDL_FALSE;
             }
+        }
+    }
 
-            case SDL_RENDERCMD_SETCLIPRECT: {
-                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;                
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+    pool->tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    num_tiles = pool->tiles_x * ((surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE);
+    if (num_tiles + 1 > pool->max_tiles) {
+        int *tile_offsets = (int *) SDL_realloc(pool->tile_offsets, (num_tiles + 1) * sizeof(int));
+        if (!tile_offsets) {
+            return SDL_FALSE;
+        }
+        pool->tile_offsets = tile_offsets;
+        pool->max_tiles = num_tiles + 1;
+    }
+    pool->num_commands = 0;
+    return SDL_TRUE;
+}
+
+static void
+SW_BlitTile(SDL_Surface *dst, const SW_TileCommand *tilecmd, void *vertices)
+{
+    const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + tilecmd->cmd->data.draw.first);
+    const SDL_Rect *srcrect = verts;
+    const SDL_Rect *clip = &dst->clip_rect;
+    SDL_Surface *src = tilecmd->src;
+    SDL_BlitInfo info = tilecmd->info;
+    int srcx, srcy, dstx, dsty, w, h;
+    int maxw, maxh, dx, dy;
+
+    /* Clip the same way SDL_UpperBlit does, without writing the result back to the vertices */
+    dstx = verts[1].x;
+    dsty = verts[1].y;
+
+    srcx = srcrect->x;
+    w = srcrect->w;
+    if (srcx < 0) {
+        w += srcx;
+        dstx -= srcx;
+        srcx = 0;
+    }
+    maxw = src->w - srcx;
+    if (maxw < w)
+        w = maxw;
+
+    srcy = srcrect->y;
+    h = srcrect->h;
+    if (srcy < 0) {
+        h += srcy;
+        dsty -= srcy;
+        srcy = 0;
+    }
+    maxh = src->h - srcy;
+    if (maxh < h)
+        h = maxh;
+
+    dx = clip->x - dstx;
+    if (dx > 0) {
+        w -= dx;
+        dstx += dx;
+        srcx += dx;
+    }
+    dx = dstx + w - clip->x - clip->w;
+    if (dx > 0)
+        w -= dx;
+
+    dy = clip->y - dsty;
+    if (dy > 0) {
+        h -= dy;
+        dsty += dy;
+        srcy += dy;
+    }
+    dy = dsty + h - clip->y - clip->h;
+    if (dy > 0)
+        h -= dy;
+
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    /* Set up the blit the same way SDL_SoftBlit does, on a private copy of the blit info */
+    info.src = (Uint8 *) src->pixels +
+        (Uint16) srcy * src->pitch +
+        (Uint16) srcx * info.src_fmt->BytesPerPixel;
+    info.src_w = w;
+    info.src_h = h;
+    info.src_pitch = src->pitch;
+    info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+    info.dst = (Uint8 *) dst->pixels +
+        (Uint16) dsty * dst->pitch +
+        (Uint16) dstx * info.dst_fmt->BytesPerPixel;
+    info.dst_w = w;
+    info.dst_h = h;
+    info.dst_pitch = dst->pitch;
+    info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+    tilecmd->blit(&info);
+}
+
+static void
+SW_RenderTileCommand(SDL_Surface *surface, const SW_TileCommand *tilecmd, const SDL_Rect *tile, void *vertices)
+{
+    const SDL_RenderCommand *cmd = tilecmd->cmd;
+
+    if (!SDL_IntersectRect(&tilecmd->clip, tile, &surface->clip_rect)) {
+        return;
+    }
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            const Uint8 r = cmd->data.color.r;
+            const Uint8 g = cmd->data.color.g;
+            const Uint8 b = cmd->data.color.b;
+            const Uint8 a = cmd->data.color.a;
+            SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_CLEAR: {
-                const Uint8 r = cmd->data.color.r;
-                const Uint8 g = cmd->data.color.g;
-                const Uint8 b = cmd->data.color.b;
-                const Uint8 a = cmd->data.color.a;
-                /* By definition the clear ignores the clip rect */
-                SDL_SetClipRect(surface, NULL);
-                SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_DRAW_POINTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
-                }
-                break;
+        case SDL_RENDERCMD_COPY: {
+            SW_BlitTile(surface, tilecmd, vertices);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+static void
+SW_RenderTile(SW_TilePool *pool, SDL_Surface *surface, int tile)
+{
+    SDL_Rect rect;
+    int i;
+
+    rect.x = (tile % pool->tiles_x) * SW_TILE_SIZE;
+    rect.y = (tile / pool->tiles_x) * SW_TILE_SIZE;
+    rect.w = SDL_min(SW_TILE_SIZE, surface->w - rect.x);
+    rect.h = SDL_min(SW_TILE_SIZE, surface->h - rect.y);
+
+    for (i = pool->tile_offsets[tile]; i < pool->tile_offsets[tile + 1]; ++i) {
+        SW_RenderTileCommand(surface, &pool->commands[pool->tile_commands[i]], &rect, pool->vertices);
+    }
+}
+
+static void
+SW_RunTiles(SW_TilePool *pool, SW_TileWorker *worker)
+{
+    int i;
+
+    /* Drain our own range first, then steal from the others */
+    for (i = 0; i < pool->num_workers; ++i) {
+        SW_TileWorker *victim = &pool->workers[(worker->index + i) % pool->num_workers];
+        int tile;
+
+        while ((tile = SDL_AtomicAdd(&victim->next, 1)) < victim->end) {
+            SW_RenderTile(pool, worker->surface, tile);
+        }
+    }
+}
+
+static int SDLCALL
+SW_TileWorkerThread(void *data)
+{
+    SW_TileWorker *worker = (SW_TileWorker *) data;
+    SW_TilePool *pool = worker->pool;
+
+    for ( ; ; ) {
+        SDL_SemWait(pool->work);
+        if (pool->quit) {
+            break;
+        }
+        SW_RunTiles(pool, worker);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+/* Rasterize the queued commands: every tile is drawn by exactly one worker,
+   in submission order, so the result doesn't depend on the scheduling. */
+static void
+SW_FlushTileCommands(SW_RenderData *data, SDL_Surface *surface, void *vertices)
+{
+    SW_TilePool *pool = data->pool;
+    const int tiles_x = pool->tiles_x;
+    const int num_tiles = tiles_x * ((surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE);
+    int *tile_offsets = pool->tile_offsets;
+    int total = 0;
+    int i, tx, ty;
+
+    if (pool->num_commands == 0) {
+        return;
+    }
+
+    /* Count the commands touching each tile... */
+    SDL_memset(tile_offsets, 0, (num_tiles + 1) * sizeof(int));
+    for (i = 0; i < pool->num_commands; ++i) {
+        const SDL_Rect *bounds = &pool->commands[i].bounds;
+        for (ty = bounds->y / SW_TILE_SIZE; ty <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++ty) {
+            for (tx = bounds->x / SW_TILE_SIZE; tx <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++tx) {
+                ++tile_offsets[ty * tiles_x + tx];
             }
+        }
+    }
+    for (i = 0; i < num_tiles; ++i) {
+        total += tile_offsets[i];
+        tile_offsets[i] = total;
+    }
+    tile_offsets[num_tiles] = total;
+
+    if (total > pool->max_tile_commands) {
+        int *tile_commands = (int *) SDL_realloc(pool->tile_commands, total * sizeof(int));
+        if (!tile_commands) {
+            /* Draw everything on this thread, it's still correct, just slower */
+            SDL_Rect full;
+            full.x = full.y = 0;
+            full.w = surface->w;
+            full.h = surface->h;
+            for (i = 0; i < pool->num_commands; ++i) {
+                SW_RenderTileCommand(pool->workers[0].surface, &pool->commands[i], &full, vertices);
+            }
+            pool->num_commands = 0;
+            return;
+        }
+        pool->tile_commands = tile_commands;
+        pool->max_tile_commands = total;
+    }
 
-            case SDL_RENDERCMD_DRAW_LINES: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
-                }
-                break;
+    /* ...and fill each tile's list back to front, which keeps the submission
+       order and leaves the offsets pointing at the first entry. */
+    for (i = pool->num_commands - 1; i >= 0; --i) {
+        const SDL_Rect *bounds = &pool->commands[i].bounds;
+        for (ty = bounds->y / SW_TILE_SIZE; ty <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++ty) {
+            for (tx = bounds->x / SW_TILE_SIZE; tx <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++tx) {
+                pool->tile_commands[--tile_offsets[ty * tiles_x + tx]] = i;
             }
+        }
+    }
 
-            case SDL_RENDERCMD_FILL_RECTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
-                }
-                break;
+    /* Hand each worker a contiguous band of tiles, idle workers steal from the others */
+    for (i = 0; i < pool->num_workers; ++i) {
+        SW_TileWorker *worker = &pool->workers[i];
+        SDL_AtomicSet(&worker->next, (int) (((Sint64) num_tiles * i) / pool->num_workers));
+        worker->end = (int) (((Sint64) num_tiles * (i + 1)) / pool->num_workers);
+    }
+    pool->vertices = vertices;
+
+    for (i = 1; i < pool->num_workers; ++i) {
+        SDL_SemPost(pool->work);
+    }
+    SW_RunTiles(pool, &pool->workers[0]);
+    for (i = 1; i < pool->num_workers; ++i) {
+        SDL_SemWait(pool->done);
+    }
+
+    pool->num_commands = 0;
+}
+
+static SDL_bool
+SW_TextureInTileBatch(const SW_TilePool *pool, const SDL_Surface *src)
+{
+    int i;
+
+    for (i = pool->num_commands - 1; i >= 0; --i) {
+        if (pool->commands[i].src == src) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* Returns SDL_FALSE if the command has to run on its own, after the queued ones */
+static SDL_bool
+SW_QueueTileCommand(SW_RenderData *data, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, const SW_DrawStateCache *drawstate)
+{
+    SW_TilePool *pool = data->pool;
+    SW_TileCommand *tilecmd;
+    SDL_Surface *src = NULL;
+    SDL_Rect full, clip, bounds;
+
+    full.x = full.y = 0;
+    full.w = surface->w;
+    full.h = surface->h;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            /* By definition the clear ignores the clip rect */
+            clip = full;
+            bounds = full;
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            GetDrawClipRect(drawstate, &clip);
+            SDL_IntersectRect(&clip, &full, &clip);
+            if (!SDL_EnclosePoints(verts, count, &clip, &bounds)) {
+                return SDL_TRUE;  /* nothing to draw */
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
-                SDL_Texture *texture = cmd->data.draw.texture;
-                SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            int i;
+            GetDrawClipRect(drawstate, &clip);
+            SDL_IntersectRect(&clip, &full, &clip);
+            bounds.x = bounds.y = bounds.w = bounds.h = 0;
+            for (i = 0; i < count; ++i) {
+                SDL_UnionRect(&bounds, &verts[i], &bounds);
+            }
+            break;
+        }
 
-                SetDrawState(surface, &drawstate);
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_Rect *srcrect = verts;
+            const SDL_Rect *dstrect = verts + 1;
+            src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
 
-                PrepTextureForCopy(cmd);
+            /* Scaled blits pick their source pixels relative to the clipped rect */
+            if (srcrect->w != dstrect->w || srcrect->h != dstrect->h) {
+                return SDL_FALSE;
+            }
+            if (src->format->palette || src->locked) {
+                return SDL_FALSE;
+            }
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+            PrepTextureForCopy(cmd);
+
+            /* Switch back to a fast blit if we were previously stretching */
+            if (src->map->info.flags & SDL_COPY_NEAREST) {
+                src->map->info.flags &= ~SDL_COPY_NEAREST;
+                SDL_InvalidateMap(src->map);
+            }
+            if (src->map->dst != surface) {
+                /* Remapping may RLE encode or decode the texture and move the pixels queued copies read */
+                if (((src->flags & SDL_RLEACCEL) || (src->map->info.flags & SDL_COPY_RLE_DESIRED)) &&
+                    SW_TextureInTileBatch(pool, src)) {
+                    SW_FlushTileCommands(data, surface, vertices);
+                }
+                if (SDL_MapSurface(src, surface) < 0) {
+                    return SDL_FALSE;
                 }
-                break;
             }
-
-            case SDL_RENDERCMD_COPY_EX: {
-                const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                SetDrawState(surface, &drawstate);
-                PrepTextureForCopy(cmd);
-                SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                                &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
-                break;
+            /* RLE blits walk the encoded runs and can't start at a tile edge */
+            if (src->flags & SDL_RLEACCEL) {
+                return SDL_FALSE;
             }
 
-            case SDL_RENDERCMD_NO_OP:
-                break;
+            GetDrawClipRect(drawstate, &clip);
+            SDL_IntersectRect(&clip, &full, &clip);
+            bounds.x = dstrect->x;
+            bounds.y = dstrect->y;
+            bounds.w = srcrect->w;
+            bounds.h = srcrect->h;
+            break;
+        }
+
+        default:
+            return SDL_FALSE;
+    }
+
+    if (!SDL_IntersectRect(&bounds, &clip, &bounds)) {
+        return SDL_TRUE;  /* nothing to draw */
+    }
+
+    if (pool->num_commands == pool->max_commands) {
+        const int max_commands = pool->max_commands ? (pool->max_commands * 2) : 64;
+        SW_TileCommand *commands = (SW_TileCommand *) SDL_realloc(pool->commands, max_commands * sizeof(*commands));
+        if (!commands) {
+            return SDL_FALSE;
+        }
+        pool->commands = commands;
+        pool->max_commands = max_commands;
+    }
+
+    tilecmd = &pool->commands[pool->num_commands++];
+    tilecmd->cmd = cmd;
+    tilecmd->clip = clip;
+    tilecmd->bounds = bounds;
+    tilecmd->src = src;
+    if (src) {
+        /* Later copies of the same texture may change its blit state before the tiles run */
+        tilecmd->info = src->map->info;
+        tilecmd->blit = (SDL_BlitFunc) src->map->data;
+    }
+    return SDL_TRUE;
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_DrawStateCache drawstate;
+    SDL_bool tiled;
+
+    if (!surface) {
+        return -1;
+    }
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
+
+    tiled = SW_PrepareTilePool(data, surface);
+
+    while (cmd) {
+        if (!tiled) {
+            SW_RunCommand(renderer, surface, cmd, vertices, &drawstate);
+        } else if (!SW_QueueTileCommand(data, surface, cmd, vertices, &drawstate)) {
+            switch (cmd->command) {
+                case SDL_RENDERCMD_NO_OP:
+                case SDL_RENDERCMD_SETVIEWPORT:
+                case SDL_RENDERCMD_SETCLIPRECT:
+                case SDL_RENDERCMD_SETDRAWCOLOR:
+                    break;
+                default:
+                    /* Lines, scaled and rotated copies draw over everything queued so far */
+                    SW_FlushTileCommands(data, surface, vertices);
+                    break;
+            }
+            SW_RunCommand(renderer, surface, cmd, vertices, &drawstate);
         }
 
         cmd = cmd->next;
     }
 
+    if (tiled) {
+        SW_FlushTileCommands(data, surface, vertices);
+    }
+
     return 0;
 }
 
@@ -799,6 +1441,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_DestroyTilePool(data->pool);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -52,6 +52,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_SSE41               0x00000040
+#define SDL_CPU_AVX2                0x00000080
 
 typedef struct
 {
@@ -25,6 +25,19 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 
+/* SSE4.1 and AVX2 code is compiled for its target even if the rest isn't, it's only called if the CPU has it. */
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#if defined(__AVX2__)
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING(x)
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#endif
+#endif
+
 /* Functions to perform alpha blended blitting */
 
 /* N->1 blending with per-surface alpha */
@@ -391,6 +404,327 @@ BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo * info)
 
 #endif /* __MMX__ */
 
+#if HAVE_SSE41_INTRINSICS
+/* The SSE4.1 and AVX2 blitters below give the same result as their MMX
+   versions, bit for bit, so the output doesn't depend on the CPU. */
+
+/* Shuffle that spreads the alpha byte of pixels 0,1 (lo) or 2,3 (hi) of each
+   128 bit lane over the four 16 bit channel lanes of that pixel */
+static __m128i SDL_TARGETING("sse4.1")
+AlphaShuffleSSE41(Uint32 ashift, int hi)
+{
+    const char a0 = (char) ((hi ? 8 : 0) + ashift / 8);
+    const char a1 = (char) (a0 + 4);
+    const char z = (char) 0x80;
+    return _mm_setr_epi8(a0, z, a0, z, a0, z, a0, z, a1, z, a1, z, a1, z, a1, z);
+}
+
+/* Blend 4 pixels like BlitRGBtoRGBPixelAlphaMMX: color = s*a/256 + d*(255-a)/256,
+   alpha = a*255/256 + dA*(255-a)/256, a == 0 keeps dst, a == 255 copies src */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendPixelAlphaSSE41(const __m128i s, const __m128i d, const __m128i amask,
+                     const __m128i shuflo, const __m128i shufhi, const __m128i alphalane)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ff = _mm_set1_epi16(0xff);
+    const __m128i a = _mm_and_si128(s, amask);
+    const __m128i alo = _mm_shuffle_epi8(s, shuflo);
+    const __m128i ahi = _mm_shuffle_epi8(s, shufhi);
+    __m128i lo, hi, res;
+
+    lo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_or_si128(alo, alphalane)), 8),
+                       _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_xor_si128(alo, ff)), 8));
+    hi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_or_si128(ahi, alphalane)), 8),
+                       _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_xor_si128(ahi, ff)), 8));
+    res = _mm_packus_epi16(lo, hi);
+    res = _mm_blendv_epi8(res, s, _mm_cmpeq_epi32(a, amask));
+    return _mm_blendv_epi8(res, d, _mm_cmpeq_epi32(a, zero));
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, any byte aligned layout */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    Uint32 ashift = sf->Ashift;
+    const __m128i amask = _mm_set1_epi32((int) sf->Amask);
+    const __m128i shuflo = AlphaShuffleSSE41(ashift, 0);
+    const __m128i shufhi = AlphaShuffleSSE41(ashift, 1);
+    const __m128i alphalane = _mm_slli_epi64(_mm_set1_epi64x(0xff), ashift * 2);   /* 0F000 or 0000F per pixel */
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            _mm_storeu_si128((__m128i *) dstp, BlendPixelAlphaSSE41(s, d, amask, shuflo, shufhi, alphalane));
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; --n) {
+            const __m128i s = _mm_cvtsi32_si128((int) *srcp);
+            const __m128i d = _mm_cvtsi32_si128((int) *dstp);
+            *dstp = (Uint32) _mm_cvtsi128_si32(BlendPixelAlphaSSE41(s, d, amask, shuflo, shufhi, alphalane));
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* Blend 4 pixels like BlitRGBtoRGBSurfaceAlpha128MMX */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendSurfaceAlpha128SSE41(const __m128i s, const __m128i d, const __m128i dsta)
+{
+    const __m128i hmask = _mm_set1_epi32(0x00fefefe);
+    const __m128i lmask = _mm_set1_epi32(0x00010101);
+    const __m128i avg = _mm_srli_epi32(_mm_add_epi32(_mm_and_si128(s, hmask), _mm_and_si128(d, hmask)), 1);
+    return _mm_or_si128(_mm_add_epi32(avg, _mm_and_si128(_mm_and_si128(s, d), lmask)), dsta);
+}
+
+/* Blend 4 pixels like BlitRGBtoRGBSurfaceAlphaMMX: d + (s-d)*alpha/256 in the
+   color channels, wrapping like the 8 bit add of the MMX version */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendSurfaceAlphaSSE41(const __m128i s, const __m128i d, const __m128i alpha, const __m128i dsta)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dlo = _mm_unpacklo_epi8(d, zero);
+    const __m128i dhi = _mm_unpackhi_epi8(d, zero);
+    __m128i lo, hi;
+
+    lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(s, zero), dlo), alpha), 8);
+    hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(s, zero), dhi), alpha), 8);
+    return _mm_or_si128(_mm_packus_epi16(_mm_add_epi8(lo, dlo), _mm_add_epi8(hi, dhi)), dsta);
+}
+
+/* 16 bit alpha multipliers for the color channels of a pixel pair, 0 for the other channel */
+static __m128i SDL_TARGETING("sse4.1")
+SurfaceAlphaMultSSE41(const SDL_PixelFormat * df, unsigned alpha)
+{
+    const Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+    Uint64 amult = 0;
+    int i;
+    for (i = 0; i < 4; ++i) {
+        if (chanmask & (0xff << (i * 8))) {
+            amult |= (Uint64) alpha << (i * 16);
+        }
+    }
+    return _mm_set1_epi64x((Sint64) amult);
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBSurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    SDL_PixelFormat *df = info->dst_fmt;
+    unsigned alpha = info->a;
+    const SDL_bool half = (alpha == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF);
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i dsta = _mm_set1_epi32((int) df->Amask);
+    const __m128i mult = SurfaceAlphaMultSSE41(df, alpha);
+    __m128i s, d;
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4) {
+            s = _mm_loadu_si128((const __m128i *) srcp);
+            d = _mm_loadu_si128((const __m128i *) dstp);
+            d = half ? BlendSurfaceAlpha128SSE41(s, d, dsta) : BlendSurfaceAlphaSSE41(s, d, mult, dsta);
+            _mm_storeu_si128((__m128i *) dstp, d);
+            srcp += 4;
+            dstp += 4;
+        }
+        for (; n > 0; --n) {
+            s = _mm_cvtsi32_si128((int) *srcp);
+            d = _mm_cvtsi32_si128((int) *dstp);
+            d = half ? BlendSurfaceAlpha128SSE41(s, d, dsta) : BlendSurfaceAlphaSSE41(s, d, mult, dsta);
+            *dstp = (Uint32) _mm_cvtsi128_si32(d);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+/* The AVX2 versions work on 8 pixels at once, the same way per 128 bit lane,
+   and leave the rest of each row to the SSE4.1 code. */
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha, any byte aligned layout */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    Uint32 ashift = sf->Ashift;
+    const __m128i amask128 = _mm_set1_epi32((int) sf->Amask);
+    const __m128i shuflo128 = AlphaShuffleSSE41(ashift, 0);
+    const __m128i shufhi128 = AlphaShuffleSSE41(ashift, 1);
+    const __m128i alphalane128 = _mm_slli_epi64(_mm_set1_epi64x(0xff), ashift * 2);
+    const __m256i amask = _mm256_broadcastsi128_si256(amask128);
+    const __m256i shuflo = _mm256_broadcastsi128_si256(shuflo128);
+    const __m256i shufhi = _mm256_broadcastsi128_si256(shufhi128);
+    const __m256i alphalane = _mm256_broadcastsi128_si256(alphalane128);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ff = _mm256_set1_epi16(0xff);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            const __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            const __m256i a = _mm256_and_si256(s, amask);
+            const __m256i alo = _mm256_shuffle_epi8(s, shuflo);
+            const __m256i ahi = _mm256_shuffle_epi8(s, shufhi);
+            __m256i lo, hi, res;
+
+            lo = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_or_si256(alo, alphalane)), 8),
+                                  _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), _mm256_xor_si256(alo, ff)), 8));
+            hi = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_or_si256(ahi, alphalane)), 8),
+                                  _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), _mm256_xor_si256(ahi, ff)), 8));
+            res = _mm256_packus_epi16(lo, hi);
+            res = _mm256_blendv_epi8(res, s, _mm256_cmpeq_epi32(a, amask));
+            res = _mm256_blendv_epi8(res, d, _mm256_cmpeq_epi32(a, zero));
+            _mm256_storeu_si256((__m256i *) dstp, res);
+            srcp += 8;
+            dstp += 8;
+        }
+        if (n >= 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            _mm_storeu_si128((__m128i *) dstp, BlendPixelAlphaSSE41(s, d, amask128, shuflo128, shufhi128, alphalane128));
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        for (; n > 0; --n) {
+            const __m128i s = _mm_cvtsi32_si128((int) *srcp);
+            const __m128i d = _mm_cvtsi32_si128((int) *dstp);
+            *dstp = (Uint32) _mm_cvtsi128_si32(BlendPixelAlphaSSE41(s, d, amask128, shuflo128, shufhi128, alphalane128));
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    SDL_PixelFormat *df = info->dst_fmt;
+    unsigned alpha = info->a;
+    const SDL_bool half = (alpha == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF);
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i dsta128 = _mm_set1_epi32((int) df->Amask);
+    const __m128i mult128 = SurfaceAlphaMultSSE41(df, alpha);
+    const __m256i dsta = _mm256_broadcastsi128_si256(dsta128);
+    const __m256i mult = _mm256_broadcastsi128_si256(mult128);
+    const __m256i hmask = _mm256_set1_epi32(0x00fefefe);
+    const __m256i lmask = _mm256_set1_epi32(0x00010101);
+    const __m256i zero = _mm256_setzero_si256();
+    __m128i s128, d128;
+
+    while (height--) {
+        int n = width;
+        for (; n >= 8; n -= 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            if (half) {
+                const __m256i avg = _mm256_srli_epi32(_mm256_add_epi32(_mm256_and_si256(s, hmask), _mm256_and_si256(d, hmask)), 1);
+                d = _mm256_or_si256(_mm256_add_epi32(avg, _mm256_and_si256(_mm256_and_si256(s, d), lmask)), dsta);
+            } else {
+                const __m256i dlo = _mm256_unpacklo_epi8(d, zero);
+                const __m256i dhi = _mm256_unpackhi_epi8(d, zero);
+                const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero), dlo), mult), 8);
+                const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero), dhi), mult), 8);
+                d = _mm256_or_si256(_mm256_packus_epi16(_mm256_add_epi8(lo, dlo), _mm256_add_epi8(hi, dhi)), dsta);
+            }
+            _mm256_storeu_si256((__m256i *) dstp, d);
+            srcp += 8;
+            dstp += 8;
+        }
+        if (n >= 4) {
+            s128 = _mm_loadu_si128((const __m128i *) srcp);
+            d128 = _mm_loadu_si128((const __m128i *) dstp);
+            d128 = half ? BlendSurfaceAlpha128SSE41(s128, d128, dsta128) : BlendSurfaceAlphaSSE41(s128, d128, mult128, dsta128);
+            _mm_storeu_si128((__m128i *) dstp, d128);
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        for (; n > 0; --n) {
+            s128 = _mm_cvtsi32_si128((int) *srcp);
+            d128 = _mm_cvtsi32_si128((int) *dstp);
+            d128 = half ? BlendSurfaceAlpha128SSE41(s128, d128, dsta128) : BlendSurfaceAlphaSSE41(s128, d128, mult128, dsta128);
+            *dstp = (Uint32) _mm_cvtsi128_si32(d128);
+            ++srcp;
+            ++dstp;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if defined(__MMX__) || defined(__3dNOW__) || HAVE_SSE41_INTRINSICS
+/* CPU features for choosing a blitter, SDL_BLIT_CPU_FEATURES overrides them
+   for testing like it does for the automatically generated blitters */
+static int
+SDL_GetBlitAFeatures(void)
+{
+    static int features = 0x7fffffff;
+
+    if (features == 0x7fffffff) {
+        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+
+        features = SDL_CPU_ANY;
+        if (override) {
+            SDL_sscanf(override, "%u", &features);
+        } else {
+            if (SDL_HasMMX()) {
+                features |= SDL_CPU_MMX;
+            }
+            if (SDL_Has3DNow()) {
+                features |= SDL_CPU_3DNOW;
+            }
+            if (SDL_HasSSE41()) {
+                features |= SDL_CPU_SSE41;
+            }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+        }
+    }
+    return features;
+}
+#endif
+
 #if SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
 
@@ -1381,21 +1715,29 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
-#if defined(__MMX__) || defined(__3dNOW__)
+#if defined(__MMX__) || defined(__3dNOW__) || HAVE_SSE41_INTRINSICS
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+#if HAVE_AVX2_INTRINSICS
+                    if (SDL_GetBlitAFeatures() & SDL_CPU_AVX2)
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (SDL_GetBlitAFeatures() & SDL_CPU_SSE41)
+                        return BlitRGBtoRGBPixelAlphaSSE41;
+#endif
 #ifdef __3dNOW__
-                    if (SDL_Has3DNow())
+                    if (SDL_GetBlitAFeatures() & SDL_CPU_3DNOW)
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
 #endif
 #ifdef __MMX__
-                    if (SDL_HasMMX())
+                    if (SDL_GetBlitAFeatures() & SDL_CPU_MMX)
                         return BlitRGBtoRGBPixelAlphaMMX;
 #endif
                 }
-#endif /* __MMX__ || __3dNOW__ */
+#endif /* __MMX__ || __3dNOW__ || HAVE_SSE41_INTRINSICS */
                 if (sf->Amask == 0xff000000) {
 #if SDL_ARM_NEON_BLITTERS
                     if (SDL_HasNEON())
@@ -1452,11 +1794,23 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
-#ifdef __MMX__
+#if defined(__MMX__) || HAVE_SSE41_INTRINSICS
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
-                        && sf->Bshift % 8 == 0 && SDL_HasMMX())
-                        return BlitRGBtoRGBSurfaceAlphaMMX;
+                        && sf->Bshift % 8 == 0) {
+#if HAVE_AVX2_INTRINSICS
+                        if (SDL_GetBlitAFeatures() & SDL_CPU_AVX2)
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                        if (SDL_GetBlitAFeatures() & SDL_CPU_SSE41)
+                            return BlitRGBtoRGBSurfaceAlphaSSE41;
+#endif
+#ifdef __MMX__
+                        if (SDL_GetBlitAFeatures() & SDL_CPU_MMX)
+                            return BlitRGBtoRGBSurfaceAlphaMMX;
+#endif
+                    }
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
                         return BlitRGBtoRGBSurfaceAlpha;
@@ -0,0 +1,133 @@
+/*
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures throughput of SDL_AudioStream for common rate conversions.
+   Usage: testaudiostreambench [seconds of audio per case] [frames per SDL_AudioStreamPut] */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int inrate;
+    int outrate;
+} BenchCase;
+
+static const BenchCase cases[] = {
+    { AUDIO_F32SYS, 2, 44100, 48000 },
+    { AUDIO_F32SYS, 2, 48000, 44100 },
+    { AUDIO_F32SYS, 1, 44100, 48000 },
+    { AUDIO_F32SYS, 6, 48000, 44100 },
+    { AUDIO_F32SYS, 8, 44100, 48000 },
+    { AUDIO_F32SYS, 2, 22050, 48000 },
+    { AUDIO_F32SYS, 2, 44100, 44101 },
+    { AUDIO_S16SYS, 2, 44100, 48000 },
+};
+
+static int
+run_case(const BenchCase *bench, const int seconds, const int chunkframes)
+{
+    const int framesize = (SDL_AUDIO_BITSIZE(bench->format) / 8) * bench->channels;
+    const int totalframes = bench->inrate * seconds;
+    const int outlen = (int) (((Sint64) chunkframes * bench->outrate / bench->inrate) + 64) * framesize * 2;
+    SDL_AudioStream *stream;
+    Uint8 *in, *out;
+    Uint64 start, ticks;
+    Sint64 produced = 0;
+    double elapsed;
+    int frames, i, got;
+
+    stream = SDL_NewAudioStream(bench->format, bench->channels, bench->inrate, bench->format, bench->channels, bench->outrate);
+    in = (Uint8 *) SDL_malloc(chunkframes * framesize);
+    out = (Uint8 *) SDL_malloc(outlen);
+    if (!stream || !in || !out) {
+        SDL_Log("Couldn't create stream: %s", SDL_GetError());
+        SDL_FreeAudioStream(stream);
+        SDL_free(in);
+        SDL_free(out);
+        return -1;
+    }
+
+    /* white noise, float samples in [-1, 1] or full range Sint16 */
+    srand(1234);
+    for (i = 0; i < chunkframes * bench->channels; i++) {
+        if (SDL_AUDIO_ISFLOAT(bench->format)) {
+            ((float *) in)[i] = ((float) rand() / (float) RAND_MAX) * 2.0f - 1.0f;
+        } else {
+            ((Sint16 *) in)[i] = (Sint16) ((rand() & 0xFFFF) - 0x8000);
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (frames = 0; frames < totalframes; frames += chunkframes) {
+        const int len = SDL_min(chunkframes, totalframes - frames) * framesize;
+        if (SDL_AudioStreamPut(stream, in, len) < 0) {
+            SDL_Log("SDL_AudioStreamPut failed: %s", SDL_GetError());
+            break;
+        }
+        while ((got = SDL_AudioStreamGet(stream, out, outlen)) > 0) {
+            produced += got;
+        }
+    }
+    SDL_AudioStreamFlush(stream);
+    while ((got = SDL_AudioStreamGet(stream, out, outlen)) > 0) {
+        produced += got;
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    elapsed = (double) ticks / (double) SDL_GetPerformanceFrequency();
+
+    SDL_Log("%-4s %d ch %6d -> %6d Hz: %8.2f Mframes/s, %7.1fx realtime (%d -> %d frames)",
+            SDL_AUDIO_ISFLOAT(bench->format) ? "f32" : "s16", (int) bench->channels, bench->inrate, bench->outrate,
+            (totalframes / elapsed) / 1000000.0, seconds / elapsed, totalframes, (int) (produced / framesize));
+
+    SDL_FreeAudioStream(stream);
+    SDL_free(in);
+    SDL_free(out);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    const int seconds = (argc > 1) ? SDL_atoi(argv[1]) : 60;
+    const int chunkframes = (argc > 2) ? SDL_atoi(argv[2]) : 1024;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (seconds <= 0 || chunkframes <= 0) {
+        SDL_Log("USAGE: %s [seconds of audio per case] [frames per SDL_AudioStreamPut]", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("SDL_Init() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Resampling %d seconds of audio per case, %d frames per put", seconds, chunkframes);
+    for (i = 0; i < SDL_arraysize(cases); i++) {
+        if (run_case(&cases[i], seconds, chunkframes) < 0) {
+            SDL_Quit();
+            return 1;
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
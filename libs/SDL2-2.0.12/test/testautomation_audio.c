@@ -969,6 +969,183 @@ int audio_openCloseAudioDeviceConnected()
 
 
 
+/* Reference resampler for audio_resampleBitAccuracy: a plain copy of the filter of SDL_audiocvt.c,
+   with the same coefficient rounding and the same order of additions (tap t goes to partial sum t % 4). */
+#define REF_ZERO_CROSSINGS 5
+#define REF_SAMPLES_PER_ZERO_CROSSING 512
+#define REF_FILTER_SIZE ((REF_SAMPLES_PER_ZERO_CROSSING * REF_ZERO_CROSSINGS) + 1)
+#define REF_WINDOW_FRAMES (2 * (REF_ZERO_CROSSINGS + 1))
+
+static double
+_refBessel(const double x)
+{
+    const double xdiv2 = x / 2.0;
+    double i0 = 1.0f;
+    double f = 1.0f;
+    int i = 1;
+
+    while (SDL_TRUE) {
+        const double diff = SDL_pow(xdiv2, i * 2) / SDL_pow(f, 2);
+        if (diff < 1.0e-21f) {
+            break;
+        }
+        i0 += diff;
+        i++;
+        f *= (double) i;
+    }
+
+    return i0;
+}
+
+static void
+_refKaiserAndSinc(float *table, float *diffs)
+{
+    const int tablelen = REF_FILTER_SIZE;
+    const int lenm1 = tablelen - 1;
+    const int lenm1div2 = lenm1 / 2;
+    const double beta = 0.1102 * (80.0 - 8.7);
+    int i;
+
+    table[0] = 1.0f;
+    for (i = 1; i < tablelen; i++) {
+        const double kaiser = _refBessel(beta * SDL_sqrt(1.0 - SDL_pow(((i - lenm1) / 2.0) / lenm1div2, 2.0))) / _refBessel(beta);
+        table[tablelen - i] = (float) kaiser;
+    }
+
+    for (i = 1; i < tablelen; i++) {
+        const float x = (((float) i) / ((float) REF_SAMPLES_PER_ZERO_CROSSING)) * ((float) M_PI);
+        table[i] *= SDL_sinf(x) / x;
+        diffs[i - 1] = table[i] - table[i - 1];
+    }
+    diffs[lenm1] = 0.0f;
+}
+
+/* resamples with silence on both sides, output frame i starts at input frame i * inrate / outrate. */
+static int
+_refResample(const float *table, const float *diffs, const int chans, const int inrate, const int outrate,
+             const float *in, const int inframes, float *out)
+{
+    const int outframes = (int) (inframes * (double) (((float) outrate) / ((float) inrate)));
+    int i, j, t, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const Sint64 position = ((Sint64) i) * inrate;
+        const int srcindex = (int) (position / outrate);
+        const double interpolation1 = ((double) (position % outrate)) / ((double) outrate);
+        const double interpolation2 = 1.0 - interpolation1;
+        const int filterindex1 = (int) (interpolation1 * REF_SAMPLES_PER_ZERO_CROSSING);
+        const int filterindex2 = (int) (interpolation2 * REF_SAMPLES_PER_ZERO_CROSSING);
+        float coefficients[REF_WINDOW_FRAMES];
+
+        SDL_memset(coefficients, '\0', sizeof (coefficients));
+        for (j = 0; filterindex1 + (j * REF_SAMPLES_PER_ZERO_CROSSING) < REF_FILTER_SIZE; j++) {
+            const int k = filterindex1 + (j * REF_SAMPLES_PER_ZERO_CROSSING);
+            coefficients[REF_ZERO_CROSSINGS - j] = (float) (table[k] + (interpolation1 * diffs[k]));
+        }
+        for (j = 0; filterindex2 + (j * REF_SAMPLES_PER_ZERO_CROSSING) < REF_FILTER_SIZE; j++) {
+            const int k = filterindex2 + (j * REF_SAMPLES_PER_ZERO_CROSSING);
+            coefficients[REF_ZERO_CROSSINGS + 1 + j] = (float) (table[k] + (interpolation2 * diffs[k]));
+        }
+
+        for (chan = 0; chan < chans; chan++) {
+            float sums[4];
+            for (t = 0; t < REF_WINDOW_FRAMES; t++) {
+                const int srcframe = srcindex - REF_ZERO_CROSSINGS + t;
+                const float sample = ((srcframe < 0) || (srcframe >= inframes)) ? 0.0f : in[(srcframe * chans) + chan];
+                if (t < 4) {
+                    sums[t] = sample * coefficients[t];
+                } else {
+                    sums[t & 3] += sample * coefficients[t];
+                }
+            }
+            out[(i * chans) + chan] = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+        }
+    }
+    return outframes;
+}
+
+/**
+ * \brief Checks that resampling by SDL_ConvertAudio is bit exact to the reference resampler
+ * for several rate pairs and channel counts (and so for every SIMD kernel that the CPU selects).
+ *
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_resampleBitAccuracy()
+{
+    const struct { int inrate, outrate, chans; } cases[] = {
+        { 44100, 48000, 2 }, { 48000, 44100, 2 }, { 44100, 48000, 1 }, { 22050, 48000, 6 },
+        { 96000, 44100, 8 }, { 8000, 44100, 4 }, { 44100, 44101, 2 }, { 48000, 11025, 1 }
+    };
+    const int inframes = 1031;
+    float *table = (float *) SDL_malloc(REF_FILTER_SIZE * sizeof (float));
+    float *diffs = (float *) SDL_malloc(REF_FILTER_SIZE * sizeof (float));
+    Uint32 seed = 0x12345678;
+    int c, i;
+
+    SDLTest_AssertCheck(table != NULL && diffs != NULL, "Check filter tables are not NULL");
+    if (table == NULL || diffs == NULL) {
+        SDL_free(table);
+        SDL_free(diffs);
+        return TEST_ABORTED;
+    }
+    _refKaiserAndSinc(table, diffs);
+
+    for (c = 0; c < SDL_arraysize(cases); c++) {
+        const int chans = cases[c].chans;
+        const int framelen = chans * (int) sizeof (float);
+        SDL_AudioCVT cvt;
+        float *expected;
+        int outframes, result, mismatches = 0;
+
+        result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, cases[c].inrate, AUDIO_F32SYS, chans, cases[c].outrate);
+        SDLTest_AssertPass("Call to SDL_BuildAudioCVT(F32, %i, %i, F32, %i, %i)", chans, cases[c].inrate, chans, cases[c].outrate);
+        SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1; got: %i", result);
+        if (result != 1) {
+            continue;
+        }
+
+        cvt.len = inframes * framelen;
+        cvt.buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+        expected = (float *) SDL_malloc(cvt.len * cvt.len_mult);
+        SDLTest_AssertCheck(cvt.buf != NULL && expected != NULL, "Check data buffers are not NULL");
+        if (cvt.buf == NULL || expected == NULL) {
+            SDL_free(cvt.buf);
+            SDL_free(expected);
+            continue;
+        }
+
+        /* white noise in [-1, 1] from a fixed seed, the end is exercised by a loud sample */
+        for (i = 0; i < inframes * chans; i++) {
+            seed = (seed * 1664525u) + 1013904223u;
+            ((float *) cvt.buf)[i] = ((float) (seed >> 8) / 8388608.0f) - 1.0f;
+        }
+        ((float *) cvt.buf)[(inframes * chans) - 1] = 1.0f;
+
+        outframes = _refResample(table, diffs, chans, cases[c].inrate, cases[c].outrate, (const float *) cvt.buf, inframes, expected);
+
+        result = SDL_ConvertAudio(&cvt);
+        SDLTest_AssertPass("Call to SDL_ConvertAudio()");
+        SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+        SDLTest_AssertCheck(cvt.len_cvt == outframes * framelen, "Verify converted length; expected: %i; got: %i", outframes * framelen, cvt.len_cvt);
+        if (cvt.len_cvt == outframes * framelen) {
+            for (i = 0; i < outframes * chans; i++) {
+                if (SDL_memcmp(&((float *) cvt.buf)[i], &expected[i], sizeof (float)) != 0) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify resampled samples are bit exact (%i -> %i Hz, %i channels); mismatches: %i", cases[c].inrate, cases[c].outrate, chans, mismatches);
+
+        SDL_free(cvt.buf);
+        SDL_free(expected);
+    }
+
+    SDL_free(table);
+    SDL_free(diffs);
+    return TEST_COMPLETED;
+}
+
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1022,11 +1199,14 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_resampleBitAccuracy, "audio_resampleBitAccuracy", "Checks that resampled audio is bit exact to the reference resampler.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, NULL
 };
 
 /* Audio test suite (global) */
@@ -174,6 +174,227 @@ events_addDelEventWatchWithUserdata(void *arg)
    return TEST_COMPLETED;
 }
 
+/* Number of events pushed by the lock-free queue tests, more than fit into the ring */
+#define EVENTS_LOCKFREE_COUNT 100000
+
+static int SDLCALL
+_events_lockFreeProducer(void *data)
+{
+   SDL_Event event;
+   int i;
+
+   SDL_zero(event);
+   event.type = SDL_USEREVENT;
+   for (i = 0; i < EVENTS_LOCKFREE_COUNT; ++i) {
+      event.user.code = i;
+      /* Back off while the queue is at its limit */
+      while (SDL_PushEvent(&event) < 0) {
+         SDL_Delay(0);
+      }
+   }
+   return 0;
+}
+
+/**
+ * @brief Pushes more events than fit into the lock-free ring and checks that
+ *        they come out in order through the fast and the locked paths.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PeepEvents
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PollEvent
+ */
+int
+events_lockFreeQueueOrder(void *arg)
+{
+   SDL_Event event;
+   int i, result, expected, inorder;
+
+   SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "1");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, \"1\")");
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   SDL_zero(event);
+   event.type = SDL_USEREVENT;
+   for (i = 0; i < 3000; ++i) {
+      event.user.code = i;
+      SDL_PushEvent(&event);
+   }
+   SDLTest_AssertPass("Call to SDL_PushEvent() 3000 times");
+
+   /* A ranged peek looks at the ring and the list at once */
+   result = SDL_PeepEvents(&event, 1, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+   SDLTest_AssertCheck(result == 1 && event.user.code == 0, "Check ranged SDL_PeepEvents, expected: code 0, got: %d events, code %d", result, event.user.code);
+   result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_USEREVENT, SDL_USEREVENT);
+   SDLTest_AssertCheck(result == 3000, "Check number of queued events, expected: 3000, got: %d", result);
+
+   /* Drain everything else in order */
+   result = SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+   SDLTest_AssertCheck(result == 1 && event.user.code == 0, "Check ranged SDL_PeepEvents, expected: code 0, got: %d events, code %d", result, event.user.code);
+   expected = 1;
+   inorder = 1;
+   while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1) {
+      if (event.type != SDL_USEREVENT) {
+         continue;
+      }
+      if (event.user.code != expected) {
+         inorder = 0;
+      }
+      ++expected;
+   }
+   SDLTest_AssertCheck(inorder && expected == 3000, "Check events came out in order, expected: 3000, got: %d (%s)", expected, inorder ? "in order" : "out of order");
+
+   /* The queue is empty now, so the next events go through the ring again */
+   event.type = SDL_USEREVENT;
+   event.user.code = 42;
+   SDL_PushEvent(&event);
+   result = SDL_PollEvent(&event);
+   SDLTest_AssertCheck(result == 1 && event.user.code == 42, "Check SDL_PollEvent, expected: code 42, got: %d events, code %d", result, event.user.code);
+
+   SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "0");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, \"0\")");
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Pushes events from a second thread while polling on this one and
+ *        checks that none are lost or reordered.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PollEvent
+ */
+int
+events_lockFreeQueueStress(void *arg)
+{
+   SDL_Thread *thread;
+   SDL_Event event;
+   int expected = 0, inorder = 1, pass;
+
+   for (pass = 0; pass < 2; ++pass) {
+      SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, pass == 0 ? "1" : "0");
+      SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+      expected = 0;
+      inorder = 1;
+
+      thread = SDL_CreateThread(_events_lockFreeProducer, "EventProducer", NULL);
+      SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread, got: %s", thread ? "thread" : SDL_GetError());
+      if (!thread) {
+         return TEST_ABORTED;
+      }
+
+      /* The second pass toggles the ring on and off while events are in flight */
+      while (expected < EVENTS_LOCKFREE_COUNT) {
+         if (!SDL_PollEvent(&event)) {
+            continue;
+         }
+         if (event.type != SDL_USEREVENT) {
+            continue;
+         }
+         if (event.user.code != expected) {
+            inorder = 0;
+            break;
+         }
+         ++expected;
+         if (pass == 1 && (expected % 10000) == 0) {
+            SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, (expected % 20000) ? "1" : "0");
+         }
+      }
+      SDL_WaitThread(thread, NULL);
+
+      SDLTest_AssertCheck(inorder && expected == EVENTS_LOCKFREE_COUNT, "Check events from producer thread (pass %d), expected: %d in order, got: %d (%s)", pass, EVENTS_LOCKFREE_COUNT, expected, inorder ? "in order" : "out of order");
+   }
+
+   SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "0");
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that consecutive mouse motion and key repeats are merged
+ *        with SDL_HINT_EVENT_COALESCING and that other events are not.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PeepEvents
+ */
+int
+events_coalesceMotionAndRepeats(void *arg)
+{
+   SDL_Event event, events[8];
+   int i, pass, result;
+
+   for (pass = 0; pass < 2; ++pass) {
+      /* The ring of SDL_HINT_EVENT_QUEUE_LOCKFREE must not change the result */
+      SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, pass ? "1" : "0");
+      SDL_SetHint(SDL_HINT_EVENT_COALESCING, "1");
+      SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCING, \"1\")");
+      SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+      /* 100 motion events, a button change, 2 more motion events */
+      SDL_zero(event);
+      event.type = SDL_MOUSEMOTION;
+      for (i = 0; i < 100; ++i) {
+         event.motion.x = i;
+         event.motion.y = 2 * i;
+         event.motion.xrel = 1;
+         event.motion.yrel = -2;
+         SDL_PushEvent(&event);
+      }
+      event.motion.state = SDL_BUTTON_LMASK;
+      for (i = 0; i < 2; ++i) {
+         SDL_PushEvent(&event);
+      }
+
+      /* A key press, 50 repeats, a different key repeating */
+      SDL_zero(event);
+      event.type = SDL_KEYDOWN;
+      event.key.state = SDL_PRESSED;
+      event.key.keysym.scancode = SDL_SCANCODE_W;
+      event.key.keysym.sym = SDLK_w;
+      SDL_PushEvent(&event);
+      event.key.repeat = 1;
+      for (i = 0; i < 50; ++i) {
+         SDL_PushEvent(&event);
+      }
+      event.key.keysym.scancode = SDL_SCANCODE_S;
+      event.key.keysym.sym = SDLK_s;
+      SDL_PushEvent(&event);
+      SDLTest_AssertPass("Call to SDL_PushEvent() 155 times");
+
+      result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+      SDLTest_AssertCheck(result == 5, "Check number of queued events (pass %d), expected: 5, got: %d", pass, result);
+      if (result != 5) {
+         continue;
+      }
+      SDLTest_AssertCheck(events[0].type == SDL_MOUSEMOTION && events[0].motion.x == 99 && events[0].motion.y == 198 &&
+                          events[0].motion.xrel == 100 && events[0].motion.yrel == -200,
+                          "Check merged motion, expected: (99,198) rel (100,-200), got: (%d,%d) rel (%d,%d)",
+                          events[0].motion.x, events[0].motion.y, events[0].motion.xrel, events[0].motion.yrel);
+      SDLTest_AssertCheck(events[1].type == SDL_MOUSEMOTION && events[1].motion.state == SDL_BUTTON_LMASK && events[1].motion.xrel == 2,
+                          "Check motion with other button state, expected: xrel 2, got: %d", events[1].motion.xrel);
+      SDLTest_AssertCheck(events[2].type == SDL_KEYDOWN && events[2].key.repeat == 0,
+                          "Check key press is not merged, expected: repeat 0, got: %d", (int) events[2].key.repeat);
+      SDLTest_AssertCheck(events[3].type == SDL_KEYDOWN && events[3].key.keysym.sym == SDLK_w && events[3].key.repeat == 50,
+                          "Check merged key repeats, expected: repeat 50, got: %d", (int) events[3].key.repeat);
+      SDLTest_AssertCheck(events[4].type == SDL_KEYDOWN && events[4].key.keysym.sym == SDLK_s && events[4].key.repeat == 1,
+                          "Check repeat of other key, expected: repeat 1, got: %d", (int) events[4].key.repeat);
+   }
+
+   /* Without the hint every event is queued */
+   SDL_SetHint(SDL_HINT_EVENT_COALESCING, "0");
+   SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, "0");
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDL_zero(event);
+   event.type = SDL_MOUSEMOTION;
+   for (i = 0; i < 3; ++i) {
+      SDL_PushEvent(&event);
+   }
+   result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_MOUSEMOTION, SDL_MOUSEMOTION);
+   SDLTest_AssertCheck(result == 3, "Check motion without coalescing, expected: 3 events, got: %d", result);
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   return TEST_COMPLETED;
+}
+
 
 /* ================= Test References ================== */
 
@@ -187,9 +408,18 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_lockFreeQueueOrder, "events_lockFreeQueueOrder", "Checks event order across the lock-free ring and the locked queue", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference eventsTest5 =
+        { (SDLTest_TestCaseFp)events_lockFreeQueueStress, "events_lockFreeQueueStress", "Pushes events from a second thread while polling", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference eventsTest6 =
+        { (SDLTest_TestCaseFp)events_coalesceMotionAndRepeats, "events_coalesceMotionAndRepeats", "Checks merging of mouse motion and key repeats", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, &eventsTest6, NULL
 };
 
 /* Events test suite (global) */
@@ -36,6 +36,7 @@ static SDL_Texture *_loadTestFace(void);
 static int _hasBlendModes(void);
 static int _hasDrawColor(void);
 static int _isSupported(int code);
+static int _drawSoftwareScene(SDL_Surface *target, SDL_Surface *face);
 
 /**
  * Create software renderer for tests
@@ -570,6 +571,65 @@ render_testBlitAlpha (void *arg)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests that the tiled software renderer draws the same as the single threaded one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ */
+int
+render_testSoftwareThreads (void *arg)
+{
+   const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 };
+   SDL_Surface *face;
+   SDL_Surface *serial;
+   SDL_Surface *tiled;
+   int i, ret;
+
+   face = SDLTest_ImageFace();
+   SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+   if (face == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* Batch the commands so the tiles see more than one command at a time */
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+
+   for (i = 0; i < SDL_arraysize(formats); i++) {
+      /* Odd sizes, so the right and bottom tiles are partial */
+      serial = SDL_CreateRGBSurfaceWithFormat(0, 333, 217, 0, formats[i]);
+      tiled = SDL_CreateRGBSurfaceWithFormat(0, 333, 217, 0, formats[i]);
+      SDLTest_AssertCheck(serial != NULL && tiled != NULL, "Verify SDL_CreateRGBSurfaceWithFormat() results");
+      if (serial == NULL || tiled == NULL) {
+         SDL_FreeSurface(serial);
+         SDL_FreeSurface(tiled);
+         continue;
+      }
+
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "1");
+      ret = _drawSoftwareScene(serial, face);
+      SDLTest_AssertCheck(ret == 0, "Validate result from single threaded scene, expected: 0, got: %i", ret);
+
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "4");
+      ret = _drawSoftwareScene(tiled, face);
+      SDLTest_AssertCheck(ret == 0, "Validate result from tiled scene, expected: 0, got: %i", ret);
+
+      ret = SDLTest_CompareSurfaces(tiled, serial, 0);
+      SDLTest_AssertCheck(ret == 0, "Validate tiled output of %s, expected: 0 differing pixels, got: %i",
+                          SDL_GetPixelFormatName(formats[i]), ret);
+
+      SDL_FreeSurface(serial);
+      SDL_FreeSurface(tiled);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, NULL);
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, NULL);
+   SDL_FreeSurface(face);
+
+   return TEST_COMPLETED;
+}
+
 /* Helper functions */
 
 /**
@@ -766,6 +826,139 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Returns a pseudo random number in [min, max). Helper function.
+ */
+static int
+_randomRange(SDLTest_RandomContext *rnd, int min, int max)
+{
+   return min + (int)(SDLTest_Random(rnd) % (unsigned int)(max - min));
+}
+
+/**
+ * @brief Draws the same pseudo random scene of every command type to a surface. Helper function.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateSoftwareRenderer
+ */
+static int
+_drawSoftwareScene(SDL_Surface *target, SDL_Surface *face)
+{
+   const SDL_BlendMode blendModes[] = { SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD };
+   SDLTest_RandomContext rnd;
+   SDL_Renderer *swrenderer;
+   SDL_Surface *opaque;
+   SDL_Texture *textures[2];
+   SDL_Point points[16];
+   SDL_Rect rects[4];
+   SDL_Rect srcrect, dstrect;
+   const int w = target->w;
+   const int h = target->h;
+   int i, j, fail = 0;
+
+   swrenderer = SDL_CreateSoftwareRenderer(target);
+   if (swrenderer == NULL) {
+      return -1;
+   }
+
+   /* One texture with per pixel alpha, one static opaque one the renderer may RLE encode */
+   textures[0] = SDL_CreateTextureFromSurface(swrenderer, face);
+   opaque = SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_RGB888, 0);
+   textures[1] = opaque ? SDL_CreateTextureFromSurface(swrenderer, opaque) : NULL;
+   SDL_FreeSurface(opaque);
+   if (textures[0] == NULL || textures[1] == NULL) {
+      SDL_DestroyRenderer(swrenderer);
+      return -1;
+   }
+
+   SDLTest_RandomInit(&rnd, 0x5eed, 0x1234);
+   for (i = 0; i < 600; i++) {
+      SDL_Texture *texture = textures[SDLTest_Random(&rnd) % 2];
+      fail |= SDL_SetRenderDrawColor(swrenderer, _randomRange(&rnd, 0, 256), _randomRange(&rnd, 0, 256),
+                                     _randomRange(&rnd, 0, 256), _randomRange(&rnd, 0, 256));
+      fail |= SDL_SetRenderDrawBlendMode(swrenderer, blendModes[SDLTest_Random(&rnd) % SDL_arraysize(blendModes)]);
+      fail |= SDL_SetTextureColorMod(texture, _randomRange(&rnd, 128, 256), 255, _randomRange(&rnd, 128, 256));
+      fail |= SDL_SetTextureAlphaMod(texture, (SDLTest_Random(&rnd) % 2) ? 255 : _randomRange(&rnd, 0, 256));
+      fail |= SDL_SetTextureBlendMode(texture, blendModes[SDLTest_Random(&rnd) % SDL_arraysize(blendModes)]);
+
+      srcrect.x = _randomRange(&rnd, -8, face->w);
+      srcrect.y = _randomRange(&rnd, -8, face->h);
+      srcrect.w = _randomRange(&rnd, 1, face->w + 8);
+      srcrect.h = _randomRange(&rnd, 1, face->h + 8);
+      dstrect.x = _randomRange(&rnd, -64, w);
+      dstrect.y = _randomRange(&rnd, -64, h);
+      dstrect.w = srcrect.w;
+      dstrect.h = srcrect.h;
+
+      switch (SDLTest_Random(&rnd) % 12) {
+         case 0:
+            if (SDLTest_Random(&rnd) % 8 == 0) {
+               fail |= SDL_RenderClear(swrenderer);
+            }
+            break;
+         case 1:
+            rects[0].x = _randomRange(&rnd, -16, w);
+            rects[0].y = _randomRange(&rnd, -16, h);
+            rects[0].w = _randomRange(&rnd, 1, w);
+            rects[0].h = _randomRange(&rnd, 1, h);
+            fail |= SDL_RenderSetViewport(swrenderer, (SDLTest_Random(&rnd) % 3) ? &rects[0] : NULL);
+            break;
+         case 2:
+            rects[0].x = _randomRange(&rnd, -16, w);
+            rects[0].y = _randomRange(&rnd, -16, h);
+            rects[0].w = _randomRange(&rnd, 1, w);
+            rects[0].h = _randomRange(&rnd, 1, h);
+            fail |= SDL_RenderSetClipRect(swrenderer, (SDLTest_Random(&rnd) % 2) ? &rects[0] : NULL);
+            break;
+         case 3:
+         case 4:
+            for (j = 0; j < SDL_arraysize(rects); j++) {
+               rects[j].x = _randomRange(&rnd, -32, w);
+               rects[j].y = _randomRange(&rnd, -32, h);
+               rects[j].w = _randomRange(&rnd, -4, 96);
+               rects[j].h = _randomRange(&rnd, -4, 96);
+            }
+            fail |= SDL_RenderFillRects(swrenderer, rects, SDL_arraysize(rects));
+            break;
+         case 5:
+            for (j = 0; j < SDL_arraysize(points); j++) {
+               points[j].x = _randomRange(&rnd, -8, w + 8);
+               points[j].y = _randomRange(&rnd, -8, h + 8);
+            }
+            fail |= SDL_RenderDrawPoints(swrenderer, points, SDL_arraysize(points));
+            break;
+         case 6:
+            for (j = 0; j < 4; j++) {
+               points[j].x = _randomRange(&rnd, -32, w + 32);
+               points[j].y = _randomRange(&rnd, -32, h + 32);
+            }
+            fail |= SDL_RenderDrawLines(swrenderer, points, 4);
+            break;
+         case 7:
+         case 8:
+         case 9:
+            fail |= SDL_RenderCopy(swrenderer, texture, &srcrect, &dstrect);
+            break;
+         case 10:
+            dstrect.w = _randomRange(&rnd, 1, 2 * face->w);
+            dstrect.h = _randomRange(&rnd, 1, 2 * face->h);
+            fail |= SDL_RenderCopy(swrenderer, texture, &srcrect, &dstrect);
+            break;
+         case 11:
+            fail |= SDL_RenderCopyEx(swrenderer, texture, &srcrect, &dstrect, _randomRange(&rnd, 0, 360), NULL,
+                                     (SDL_RendererFlip) (SDLTest_Random(&rnd) % 4));
+            break;
+      }
+   }
+   fail |= SDL_RenderFlush(swrenderer);
+
+   SDL_DestroyTexture(textures[0]);
+   SDL_DestroyTexture(textures[1]);
+   SDL_DestroyRenderer(swrenderer);
+
+   return fail;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1085,9 +1278,12 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests the tiled software renderer against the single threaded one", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, NULL
 };
 
 /* Render test suite (global) */
@@ -589,6 +589,156 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/* Blend of one pixel as done by the x86 32 bit pixel alpha blitters (MMX, SSE4.1, AVX2) */
+static Uint32
+_blendPixelAlphaReference(Uint32 s, Uint32 d, int ashift)
+{
+   Uint32 a = (s >> ashift) & 0xff;
+   Uint32 result = 0;
+   int i;
+
+   if (a == 0) {
+      return d;
+   } else if (a == 0xff) {
+      return s;
+   }
+   for (i = 0; i < 32; i += 8) {
+      Uint32 sc = (s >> i) & 0xff;
+      Uint32 dc = (d >> i) & 0xff;
+      Uint32 ms = (i == ashift) ? 0xff : a;
+      result |= (((sc * ms) >> 8) + ((dc * (0xff - a)) >> 8)) << i;
+   }
+   return result;
+}
+
+/* Blend of one pixel as done by the x86 32 bit surface alpha blitters (MMX, SSE4.1, AVX2) */
+static Uint32
+_blendSurfaceAlphaReference(Uint32 s, Uint32 d, Uint32 a, const SDL_PixelFormat *df)
+{
+   const Uint32 chanmask = df->Rmask | df->Gmask | df->Bmask;
+   Uint32 result = 0;
+   int i;
+
+   if (a == 128 && chanmask == 0x00ffffff) {
+      return ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1) + (s & d & 0x00010101)) | df->Amask;
+   }
+   for (i = 0; i < 32; i += 8) {
+      Uint32 sc = (s >> i) & 0xff;
+      Uint32 dc = (d >> i) & 0xff;
+      if (chanmask & (0xffu << i)) {
+         dc = (dc + (((((sc - dc) & 0xffff) * a) & 0xffff) >> 8)) & 0xff;
+      }
+      result |= dc << i;
+   }
+   return result | df->Amask;
+}
+
+/* Fill a surface with random pixels, with some fully transparent and opaque ones */
+static void
+_fillRandomPixels(SDL_Surface *surface)
+{
+   int x, y;
+   const Uint32 amask = surface->format->Amask;
+
+   for (y = 0; y < surface->h; y++) {
+      Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+      for (x = 0; x < surface->w; x++) {
+         Uint32 pixel = (Uint32)SDLTest_RandomUint32();
+         switch (SDLTest_RandomIntegerInRange(0, 7)) {
+         case 0: pixel &= ~amask; break;
+         case 1: pixel |= amask; break;
+         default: break;
+         }
+         row[x] = pixel;
+      }
+   }
+}
+
+/**
+ * @brief Compares 32 bit pixel alpha and surface alpha blits against the
+ *        arithmetic of the x86 SIMD blitters, pixel by pixel.
+ *
+ * Rows of 1 to 37 pixels cover the 8 and 4 pixel loops and the single pixel tails.
+ */
+int
+surface_testBlitAlphaSIMD(void *arg)
+{
+   const Uint32 pixelFormats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888 };
+   const Uint32 surfaceFormats[][2] = {
+      { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888 },
+      { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888 },
+      { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ABGR8888 },
+      { SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_RGBA8888 },
+   };
+   const Uint8 alphas[] = { 1, 77, 127, 128, 129, 200, 254 };
+   SDL_Surface *src, *dst, *expected;
+   SDL_Rect dstrect;
+   const char *features = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+   int i, w, x, y, ret, mismatches;
+
+#if !(defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64))
+   SDLTest_Log("The reference is the arithmetic of the x86 blitters, skipping");
+   return TEST_SKIPPED;
+#else
+   /* SDL_BLIT_CPU_FEATURES can select the MMX (1), SSE4.1 (64) or AVX2 (128) blitters */
+   if (!SDL_HasMMX() || (features && !(SDL_atoi(features) & (0x01 | 0x40 | 0x80)))) {
+      SDLTest_Log("The reference is the arithmetic of the x86 blitters, skipping");
+      return TEST_SKIPPED;
+   }
+   SDLTest_Log("CPU has SSE4.1: %s, AVX2: %s", SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no");
+
+   for (i = 0; i < (int) (SDL_arraysize(pixelFormats) + SDL_arraysize(surfaceFormats) * SDL_arraysize(alphas)); i++) {
+      const int pixelalpha = (i < (int) SDL_arraysize(pixelFormats));
+      const Uint32 srcformat = pixelalpha ? pixelFormats[i] : surfaceFormats[(i - SDL_arraysize(pixelFormats)) / SDL_arraysize(alphas)][0];
+      const Uint32 dstformat = pixelalpha ? pixelFormats[i] : surfaceFormats[(i - SDL_arraysize(pixelFormats)) / SDL_arraysize(alphas)][1];
+      const Uint8 alpha = pixelalpha ? 255 : alphas[(i - SDL_arraysize(pixelFormats)) % SDL_arraysize(alphas)];
+
+      mismatches = 0;
+      for (w = 1; w <= 37; w++) {
+         src = SDL_CreateRGBSurfaceWithFormat(0, w, 5, 32, srcformat);
+         dst = SDL_CreateRGBSurfaceWithFormat(0, w + 7, 5, 32, dstformat);
+         SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+         if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            return TEST_ABORTED;
+         }
+         _fillRandomPixels(src);
+         _fillRandomPixels(dst);
+         expected = SDL_ConvertSurface(dst, dst->format, 0);
+
+         /* Offset the destination so the rows don't start aligned */
+         dstrect.x = 3;
+         dstrect.y = 0;
+         for (y = 0; y < src->h; y++) {
+            const Uint32 *s = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+            Uint32 *e = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch) + dstrect.x;
+            for (x = 0; x < w; x++) {
+               e[x] = pixelalpha ? _blendPixelAlphaReference(s[x], e[x], src->format->Ashift)
+                                 : _blendSurfaceAlphaReference(s[x], e[x], alpha, dst->format);
+            }
+         }
+
+         SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+         SDL_SetSurfaceAlphaMod(src, alpha);
+         ret = SDL_BlitSurface(src, NULL, dst, &dstrect);
+         if (ret != 0 || SDLTest_CompareSurfaces(dst, expected, 0) != 0) {
+            mismatches++;
+         }
+
+         SDL_FreeSurface(expected);
+         SDL_FreeSurface(src);
+         SDL_FreeSurface(dst);
+      }
+      SDLTest_AssertCheck(mismatches == 0, "Verify %s blit %s -> %s (alpha %d) matches for all widths, got: %d mismatching widths",
+                          pixelalpha ? "pixel alpha" : "surface alpha", SDL_GetPixelFormatName(srcformat), SDL_GetPixelFormatName(dstformat),
+                          (int) alpha, mismatches);
+   }
+
+   return TEST_COMPLETED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -631,11 +781,14 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testBlitAlphaSIMD, "surface_testBlitAlphaSIMD", "Tests 32 bit alpha blits pixel by pixel against the SIMD blitter arithmetic.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, NULL
 };
 
 /* Surface test suite (global) */
@@ -0,0 +1,122 @@
+/*
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures throughput of 32 bit pixel alpha and surface alpha blits.
+   Usage: testblitalphabench [width] [height] [seconds per case]
+   SDL_BLIT_CPU_FEATURES=1 (MMX), 64 (SSE4.1) or 128 (AVX2) selects a blitter to compare. */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    Uint32 srcformat;
+    Uint32 dstformat;
+    Uint8 alpha;
+} BenchCase;
+
+static const BenchCase cases[] = {
+    { "pixel alpha", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, 255 },
+    { "pixel alpha", SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, 255 },
+    { "surface alpha", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, 200 },
+    { "surface alpha", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, 128 },
+};
+
+static void
+fill_random(SDL_Surface *surface)
+{
+    Uint32 *pixels = (Uint32 *) surface->pixels;
+    int i;
+
+    /* pitch is a multiple of 4 for 32 bit surfaces */
+    for (i = 0; i < (surface->pitch / 4) * surface->h; i++) {
+        pixels[i] = ((Uint32) rand() << 16) ^ (Uint32) rand();
+    }
+}
+
+static int
+run_case(const BenchCase *bench, const int w, const int h, const double seconds)
+{
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    SDL_Surface *src, *dst;
+    Uint64 start, ticks;
+    Sint64 pixels = 0;
+    double elapsed;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, bench->srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, bench->dstformat);
+    if (!src || !dst) {
+        SDL_Log("Couldn't create surfaces: %s", SDL_GetError());
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return -1;
+    }
+    fill_random(src);
+    fill_random(dst);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, bench->alpha);
+
+    start = SDL_GetPerformanceCounter();
+    do {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        pixels += (Sint64) w * h;
+        ticks = SDL_GetPerformanceCounter() - start;
+    } while (ticks < (Uint64) (seconds * freq));
+
+    elapsed = (double) ticks / freq;
+    SDL_Log("%-13s %s -> %s alpha mod %3d: %8.1f Mpixels/s", bench->name,
+            SDL_GetPixelFormatName(bench->srcformat), SDL_GetPixelFormatName(bench->dstformat),
+            (int) bench->alpha, (pixels / elapsed) / 1e6);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int w = 1920, h = 1080, i;
+    double seconds = 1.0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        w = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        h = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+    if (argc > 3) {
+        seconds = SDL_atof(argv[3]);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%dx%d, SSE4.1: %s, AVX2: %s", w, h, SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no");
+    for (i = 0; i < SDL_arraysize(cases); i++) {
+        if (run_case(&cases[i], w, h, seconds) < 0) {
+            SDL_Quit();
+            return 1;
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
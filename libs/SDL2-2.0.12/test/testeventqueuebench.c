@@ -0,0 +1,134 @@
+/*
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures throughput and latency of the event queue with and without
+   SDL_HINT_EVENT_QUEUE_LOCKFREE, with a thread pushing mouse motion events
+   and the main thread polling them, under the dummy video driver.
+   Usage: testeventqueuebench [events per case] */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static int totalevents = 1000000;
+static SDL_atomic_t pushed;
+
+static int SDLCALL
+producer(void *data)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_MOUSEMOTION;
+    for (i = 0; i < totalevents; ++i) {
+        /* Keep the queue short so the latency isn't just the queue length */
+        while (i - SDL_AtomicGet(&pushed) > 256) {
+            SDL_Delay(0);
+        }
+        event.motion.x = i;
+        event.motion.which = (Uint32) SDL_GetPerformanceCounter();
+        while (SDL_PushEvent(&event) < 0) {
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static int
+compare_latency(const void *a, const void *b)
+{
+    const Uint32 la = *(const Uint32 *) a;
+    const Uint32 lb = *(const Uint32 *) b;
+    return (la < lb) ? -1 : (la > lb);
+}
+
+static int
+run_case(const char *lockfree)
+{
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    Uint32 *latencies;
+    SDL_Thread *thread;
+    SDL_Event event;
+    Uint64 start, ticks;
+    double elapsed, mean = 0.0;
+    int received = 0, i;
+
+    latencies = (Uint32 *) SDL_malloc(totalevents * sizeof(*latencies));
+    if (!latencies) {
+        SDL_Log("Out of memory");
+        return -1;
+    }
+
+    SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, lockfree);
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    SDL_AtomicSet(&pushed, 0);
+
+    start = SDL_GetPerformanceCounter();
+    thread = SDL_CreateThread(producer, "EventProducer", NULL);
+    if (!thread) {
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        SDL_free(latencies);
+        return -1;
+    }
+    while (received < totalevents) {
+        if (!SDL_PollEvent(&event) || event.type != SDL_MOUSEMOTION) {
+            continue;
+        }
+        latencies[received++] = (Uint32) SDL_GetPerformanceCounter() - event.motion.which;
+        SDL_AtomicSet(&pushed, received);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDL_WaitThread(thread, NULL);
+
+    elapsed = (double) ticks / freq;
+    for (i = 0; i < totalevents; ++i) {
+        mean += latencies[i];
+    }
+    mean /= totalevents;
+    SDL_qsort(latencies, totalevents, sizeof(*latencies), compare_latency);
+
+    SDL_Log("lockfree=%s: %7.2f Mevents/s, latency mean %6.2f us, p50 %6.2f us, p99 %6.2f us",
+            lockfree, (totalevents / elapsed) / 1e6,
+            mean * 1e6 / freq,
+            latencies[totalevents / 2] * 1e6 / freq,
+            latencies[(int) (totalevents * 0.99)] * 1e6 / freq);
+
+    SDL_free(latencies);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        totalevents = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (run_case("0") < 0 || run_case("1") < 0) {
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,159 @@
+/*
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the frame rate of the software renderer drawing to an offscreen
+   surface with an increasing number of threads.
+   Usage: testrendertiledbench [width] [height] [sprites per frame] [max threads] */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SPRITE_SIZE 64
+#define NUM_FRAMES  60
+
+static SDL_Texture *
+create_sprite(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    Uint32 *pixels;
+    int x, y;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE, SPRITE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    /* A soft disc, so most of the copy is real blending */
+    pixels = (Uint32 *) surface->pixels;
+    for (y = 0; y < SPRITE_SIZE; y++) {
+        for (x = 0; x < SPRITE_SIZE; x++) {
+            const int dx = x - SPRITE_SIZE / 2;
+            const int dy = y - SPRITE_SIZE / 2;
+            const int alpha = SDL_max(0, 255 - (dx * dx + dy * dy) * 255 / (SPRITE_SIZE * SPRITE_SIZE / 4));
+            pixels[y * (surface->pitch / 4) + x] = ((Uint32) alpha << 24) | ((Uint32) (x * 4) << 16) | ((Uint32) (y * 4) << 8) | 0x80;
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+static int
+run_case(const int threads, const int w, const int h, const int sprites, double *fps)
+{
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    SDL_Surface *target;
+    SDL_Renderer *renderer;
+    SDL_Texture *sprite;
+    SDL_Rect rect;
+    Uint64 start;
+    char value[16];
+    int frame, i;
+
+    SDL_snprintf(value, sizeof(value), "%d", threads);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, value);
+
+    target = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    renderer = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+    sprite = renderer ? create_sprite(renderer) : NULL;
+    if (!sprite) {
+        SDL_Log("Couldn't create the renderer: %s", SDL_GetError());
+        if (renderer) {
+            SDL_DestroyRenderer(renderer);
+        }
+        SDL_FreeSurface(target);
+        return -1;
+    }
+    SDL_SetTextureBlendMode(sprite, SDL_BLENDMODE_BLEND);
+
+    srand(1);
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < NUM_FRAMES; frame++) {
+        SDL_SetRenderDrawColor(renderer, 0x20, 0x20, 0x40, 0xFF);
+        SDL_RenderClear(renderer);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        for (i = 0; i < sprites / 8; i++) {
+            rect.x = rand() % w - 64;
+            rect.y = rand() % h - 64;
+            rect.w = 32 + rand() % 256;
+            rect.h = 32 + rand() % 256;
+            SDL_SetRenderDrawColor(renderer, rand() & 0xFF, rand() & 0xFF, rand() & 0xFF, 0x80);
+            SDL_RenderFillRect(renderer, &rect);
+        }
+
+        rect.w = rect.h = SPRITE_SIZE;
+        for (i = 0; i < sprites; i++) {
+            rect.x = rand() % w - SPRITE_SIZE / 2;
+            rect.y = rand() % h - SPRITE_SIZE / 2;
+            SDL_SetTextureAlphaMod(sprite, (i & 1) ? 0xFF : 0xA0);
+            SDL_RenderCopy(renderer, sprite, NULL, &rect);
+        }
+        SDL_RenderPresent(renderer);
+    }
+    *fps = NUM_FRAMES / ((double) (SDL_GetPerformanceCounter() - start) / freq);
+
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int w = 1920, h = 1080, sprites = 4000, max_threads;
+    double serial_fps = 0.0, fps;
+    int threads;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    max_threads = SDL_GetCPUCount();
+    if (argc > 1) {
+        w = SDL_max(SDL_atoi(argv[1]), 1);
+    }
+    if (argc > 2) {
+        h = SDL_max(SDL_atoi(argv[2]), 1);
+    }
+    if (argc > 3) {
+        sprites = SDL_max(SDL_atoi(argv[3]), 0);
+    }
+    if (argc > 4) {
+        max_threads = SDL_max(SDL_atoi(argv[4]), 1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* Let the whole frame reach the renderer as one batch */
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+
+    SDL_Log("%dx%d, %d sprites per frame, %d CPUs", w, h, sprites, SDL_GetCPUCount());
+    for (threads = 1; threads <= max_threads; threads *= 2) {
+        if (run_case(threads, w, h, sprites, &fps) < 0) {
+            SDL_Quit();
+            return 1;
+        }
+        if (threads == 1) {
+            serial_fps = fps;
+        }
+        SDL_Log("%3d threads: %7.1f frames/s (%.2fx)", threads, fps, fps / serial_fps);
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -98,6 +98,31 @@ os.system(
 "./"+subscriptsDir+"generateTrapImplementation.py >"+
 outputDir+"TrapImplementation.h")
 
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateRecordCalls.py >"+
+outputDir+"RecordCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateRecordImplementation.py >"+
+outputDir+"RecordImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfileCalls.py >"+
+outputDir+"ProfileCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfileImplementation.py >"+
+outputDir+"ProfileImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateFunctionNames.py >"+
+outputDir+"FunctionNames.h")
+
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glHeader+" "+glextHeader+" |"+
 "./"+subscriptsDir+"extractConstants.py |"+
@@ -0,0 +1,23 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printProfileCall(data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    print "if(this->m_ptr_"+params[1]+"){this->m_next_"+params[1]+" = this->m_ptr_"+params[1]+";this->m_ptr_"+params[1]+" = (FunctionTable::"+pfn+")&ProfileTableDecorator::m_"+params[1]+"_profile;}"
+
+for x in data0:
+    printProfileCall(x)
+
@@ -0,0 +1,32 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printProfileImplementation(id,data):
+    params = data.split(",")
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    types = params[2::2]
+    names = ["a"+str(i) for i in range(len(types))]
+    args  = ",".join([t+" "+n for t,n in zip(types,names)])
+    pfn   = ("memberpfn"+params[1]+"proc").upper()
+    print "FunctionTable::"+pfn+" m_next_"+params[1]+" = nullptr;"
+    print params[0]+" m_"+params[1]+"_profile("+args+")const{return this->m_profile("+",".join([str(id),"m_next_"+params[1]]+names)+");}"
+
+for id,x in enumerate(data0):
+    printProfileImplementation(id,x)
+
@@ -0,0 +1,69 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def isRecordable(data):
+    params = data.split(",")
+    if params[0] != "void" and params[0] != "GLvoid":
+        return False
+    #these functions return values through pointers, they have to be called immediately
+    if re.match("gl(Get|Gen|Create)",params[1]):
+        return False
+    if re.match("glReadn?Pixels",params[1]):
+        return False
+    return True
+
+#pointed data of these functions are copied into command list, callers can pass temporaries
+def payload(data):
+    params = data.split(",")
+    name   = re.sub("(ARB|EXT|NV)$","",params[1])
+    names  = params[3::2]
+    m = re.match("gl(Program)?Uniform([1-4])(f|d|i|ui|i64|ui64)v$",name)
+    if m and "count" in names and "value" in names:
+        return names.index("value"),names.index("count"),m.group(2)+"*sizeof(*a"+str(names.index("value"))+")"
+    m = re.match("gl(Program)?UniformMatrix([2-4])(x([2-4]))?(f|d)v$",name)
+    if m and "count" in names and "value" in names:
+        columns = m.group(2)
+        rows    = m.group(4) if m.group(4) else columns
+        return names.index("value"),names.index("count"),columns+"*"+rows+"*sizeof(*a"+str(names.index("value"))+")"
+    m = re.match("gl(Named)?Buffer(Sub)?Data$",name)
+    if m and "size" in names and "data" in names:
+        return names.index("data"),names.index("size"),"1"
+    return None
+
+def printRecordImplementation(data):
+    params = data.split(",")
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    types = params[2::2]
+    names = ["a"+str(i) for i in range(len(types))]
+    args  = ",".join([t+" "+n for t,n in zip(types,names)])
+    if isRecordable(data):
+      pfn = ("memberpfn"+params[1]+"proc").upper()
+      values = list(names)
+      copy = payload(data)
+      if copy:
+        pointer,count,elementSize = copy
+        values[pointer] = "this->m_copy("+names[pointer]+","+names[count]+","+elementSize+")"
+      print params[0]+" m_"+params[1]+"_record("+args+")const{this->template m_record<FunctionTable::"+pfn+",&FunctionTable::m_ptr_"+params[1]+">("+",".join(values)+");}"
+    else:
+      print params[0]+" m_"+params[1]+"_record("+",".join(types)+")const{this->m_printUnrecordableFunctionErrorAndExit(\""+params[1]+"\");return ("+params[0]+")0;}"
+
+
+for x in data0:
+    printRecordImplementation(x)
+
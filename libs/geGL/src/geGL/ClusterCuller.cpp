@@ -0,0 +1,559 @@
+#include<geGL/ClusterCuller.h>
+#include<geGL/Buffer.h>
+#include<geGL/Texture.h>
+#include<geGL/Shader.h>
+#include<geGL/Program.h>
+#include<geGL/OpenGLContext.h>
+#include<algorithm>
+#include<cassert>
+#include<cmath>
+#include<limits>
+#include<stdexcept>
+#include<string>
+#include<unordered_map>
+
+using namespace ge::gl;
+
+namespace{
+  GLuint const workGroupSize = 64;
+
+  /**
+   * @brief indices of counters in count buffer, drawCount has to be the first one
+   */
+  enum Counter{
+    DRAW_COUNT        = 0,
+    FRUSTUM_CULLED    = 1,
+    BACKFACE_CULLED   = 2,
+    OCCLUSION_CULLED  = 3,
+    NOF_COUNTERS      = 4,
+  };
+
+  std::string const cullSource = R".(
+  #version 450
+  layout(local_size_x=64)in;
+
+  struct Cluster{
+    vec4 sphere    ;
+    vec4 cone      ;
+    uint firstIndex;
+    uint nofIndices;
+    int  baseVertex;
+    uint padding   ;
+  };
+
+  layout(std430,binding=0)readonly  buffer Clusters{Cluster clusters[];};
+  layout(std430,binding=1)writeonly buffer Commands{uint    commands[];};
+  layout(std430,binding=2)          buffer Counters{uint    counters[];};
+
+  layout(binding=0)uniform sampler2D hiZ;
+
+  uniform vec4 planes[6]           ;
+  uniform mat4 modelViewProjection ;
+  uniform vec3 cameraPosition      ;
+  uniform uint firstCluster   = 0u ;
+  uniform uint nofClusters    = 0u ;
+  uniform uint tests          = 0u ;
+  uniform int  hiZLevels      = 0  ;
+
+  bool isOutsideFrustum(vec3 center,float radius){
+    for(int i=0;i<6;++i)
+      if(dot(planes[i].xyz,center)+planes[i].w < -radius)return true;
+    return false;
+  }
+
+  bool isBackfacing(vec3 center,float radius,vec4 cone){
+    if(cone.w >= 1.)return false;
+    vec3 view = center - cameraPosition;
+    return dot(view,cone.xyz) >= cone.w*length(view) + radius;
+  }
+
+  bool isOccluded(vec3 center,float radius){
+    vec3 ndcMin = vec3(+1e30);
+    vec3 ndcMax = vec3(-1e30);
+    for(int i=0;i<8;++i){
+      vec3 corner = center + radius*vec3((i&1)!=0?1.:-1.,(i&2)!=0?1.:-1.,(i&4)!=0?1.:-1.);
+      vec4 clip   = modelViewProjection*vec4(corner,1.);
+      if(clip.w <= 0.)return false;
+      vec3 ndc = clip.xyz/clip.w;
+      ndcMin = min(ndcMin,ndc);
+      ndcMax = max(ndcMax,ndc);
+    }
+    ivec2 size     = textureSize(hiZ,0);
+    vec2  pixelMin = clamp(ndcMin.xy*.5+.5,vec2(0.),vec2(1.))*vec2(size);
+    vec2  pixelMax = clamp(ndcMax.xy*.5+.5,vec2(0.),vec2(1.))*vec2(size);
+    vec2  extent   = pixelMax - pixelMin;
+    int   level    = clamp(int(ceil(log2(max(max(extent.x,extent.y),1.)))),0,hiZLevels-1);
+    ivec2 last     = textureSize(hiZ,level)-1;
+    ivec2 a        = min(ivec2(pixelMin)>>level,last);
+    ivec2 b        = min(ivec2(pixelMax)>>level,last);
+    float farthest = max(
+        max(texelFetch(hiZ,a          ,level).r,texelFetch(hiZ,ivec2(b.x,a.y),level).r),
+        max(texelFetch(hiZ,ivec2(a.x,b.y),level).r,texelFetch(hiZ,b          ,level).r));
+    float nearest  = ndcMin.z*.5+.5;
+    return nearest > farthest;
+  }
+
+  void main(){
+    if(gl_GlobalInvocationID.x >= nofClusters)return;
+    uint    id      = firstCluster + gl_GlobalInvocationID.x;
+    Cluster cluster = clusters[id];
+    vec3    center  = cluster.sphere.xyz;
+    float   radius  = cluster.sphere.w;
+
+    if((tests&1u)!=0u && isOutsideFrustum(center,radius)){
+      atomicAdd(counters[1],1u);
+      return;
+    }
+    if((tests&2u)!=0u && isBackfacing(center,radius,cluster.cone)){
+      atomicAdd(counters[2],1u);
+      return;
+    }
+    if((tests&4u)!=0u && hiZLevels > 0 && isOccluded(center,radius)){
+      atomicAdd(counters[3],1u);
+      return;
+    }
+
+    uint command = atomicAdd(counters[0],1u);
+    commands[command*5u+0u] = cluster.nofIndices;
+    commands[command*5u+1u] = 1u;
+    commands[command*5u+2u] = cluster.firstIndex;
+    commands[command*5u+3u] = uint(cluster.baseVertex);
+    commands[command*5u+4u] = id;
+  }
+  ).";
+
+  std::string const hiZSource = R".(
+  #version 450
+  layout(local_size_x=8,local_size_y=8)in;
+
+  layout(binding=0)uniform sampler2D depth;
+  layout(binding=0,r32f)readonly  uniform image2D src;
+  layout(binding=1,r32f)writeonly uniform image2D dst;
+
+  uniform int level = 0;
+
+  void main(){
+    ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 size  = imageSize(dst);
+    if(any(greaterThanEqual(coord,size)))return;
+    if(level == 0){
+      imageStore(dst,coord,vec4(texelFetch(depth,coord,0).r));
+      return;
+    }
+    ivec2 srcSize = imageSize(src);
+    ivec2 begin   = coord*2;
+    ivec2 end     = min(begin+1,srcSize-1);
+    if(coord.x == size.x-1)end.x = srcSize.x-1;
+    if(coord.y == size.y-1)end.y = srcSize.y-1;
+    float farthest = 0.;
+    for(int y=begin.y;y<=end.y;++y)
+      for(int x=begin.x;x<=end.x;++x)
+        farthest = max(farthest,imageLoad(src,ivec2(x,y)).r);
+    imageStore(dst,coord,vec4(farthest));
+  }
+  ).";
+}
+
+class ge::gl::ClusterCullerImpl{
+  public:
+    ClusterCullerImpl(FunctionTablePointer const&t,GLuint m):gl(t),table(t),maxClusters(m){
+      if(maxClusters == 0)
+        throw std::invalid_argument("ClusterCuller - maximal number of clusters has to be positive");
+      clusters = std::make_shared<Buffer>(table,GLsizeiptr(sizeof(ClusterCuller::Cluster))*maxClusters,nullptr,GL_DYNAMIC_STORAGE_BIT);
+      commands = std::make_shared<Buffer>(table,GLsizeiptr(sizeof(GLuint))*5*maxClusters,nullptr,GL_DYNAMIC_STORAGE_BIT);
+      counts   = std::make_shared<Buffer>(table,GLsizeiptr(sizeof(GLuint))*NOF_COUNTERS,nullptr,GL_DYNAMIC_STORAGE_BIT);
+      cullProgram = std::make_shared<Program>(table,Program::ShaderPointers{std::make_shared<Shader>(table,GL_COMPUTE_SHADER,Shader::Sources{cullSource})});
+      hiZProgram  = std::make_shared<Program>(table,Program::ShaderPointers{std::make_shared<Shader>(table,GL_COMPUTE_SHADER,Shader::Sources{hiZSource })});
+    }
+    Context                 gl                                 ;
+    FunctionTablePointer    table                              ;
+    GLuint                  maxClusters    = 0                 ;
+    GLuint                  nofClusters    = 0                 ;
+    GLuint                  lastNofClusters= 0                 ;///<number of clusters of the last cull()
+    GLint                   hiZLevels      = 0                 ;
+    GLuint                  tests          = ClusterCuller::ALL;
+    std::shared_ptr<Buffer> clusters                           ;
+    std::shared_ptr<Buffer> commands                           ;
+    std::shared_ptr<Buffer> counts                             ;
+    std::shared_ptr<Texture>hiZ                                ;
+    std::shared_ptr<Program>cullProgram                        ;
+    std::shared_ptr<Program>hiZProgram                         ;
+};
+
+/**
+ * @brief creates culler, it compiles compute shaders
+ *
+ * @param maxClusters capacity of cluster and command buffer
+ */
+ClusterCuller::ClusterCuller(GLuint maxClusters):ClusterCuller(nullptr,maxClusters){}
+
+/**
+ * @brief creates culler, it compiles compute shaders
+ *
+ * @param table opengl function table
+ * @param maxClusters capacity of cluster and command buffer
+ */
+ClusterCuller::ClusterCuller(
+    FunctionTablePointer const&table      ,
+    GLuint                     maxClusters){
+  impl = new ClusterCullerImpl(table,maxClusters);
+}
+
+/**
+ * @brief destructor, it releases buffers, Hi-Z and programs
+ */
+ClusterCuller::~ClusterCuller(){
+  delete impl;
+}
+
+/**
+ * @brief splits triangle list into clusters of consecutive triangles.
+ * Cluster is closed when it would exceed maxTriangles or maxVertices unique vertices,
+ * so indices do not have to be reordered. Bounding sphere is centered in the bounding box
+ * of cluster, cone axis is average of triangle normals (counter clockwise triangles are front facing).
+ *
+ * @param indices triangle list, indices are relative to positions
+ * @param nofIndices number of indices
+ * @param positions x,y,z of the first vertex
+ * @param stride distance between positions in bytes
+ * @param nofVertices number of vertices
+ * @param firstIndex position of indices in element buffer
+ * @param baseVertex base vertex of draw
+ * @param maxTriangles maximal number of triangles per cluster
+ * @param maxVertices maximal number of unique vertices per cluster
+ *
+ * @return clusters
+ */
+std::vector<ClusterCuller::Cluster>ClusterCuller::buildClusters(
+    GLuint const*indices     ,
+    GLuint       nofIndices  ,
+    float  const*positions   ,
+    GLsizei      stride      ,
+    GLuint       nofVertices ,
+    GLuint       firstIndex  ,
+    GLint        baseVertex  ,
+    GLuint       maxTriangles,
+    GLuint       maxVertices ){
+  if(nofIndices%3 != 0)
+    throw std::invalid_argument("ClusterCuller::buildClusters - number of indices has to be multiple of 3");
+  if(maxTriangles == 0 || maxVertices < 3)
+    throw std::invalid_argument("ClusterCuller::buildClusters - cluster has to contain at least one triangle");
+  if(stride < GLsizei(sizeof(float)*3))
+    throw std::invalid_argument("ClusterCuller::buildClusters - stride is smaller than position");
+  for(GLuint i=0;i<nofIndices;++i)
+    if(indices[i] >= nofVertices)
+      throw std::invalid_argument("ClusterCuller::buildClusters - index "+std::to_string(indices[i])+" is out of range of vertices");
+
+  auto const position = [&](GLuint index){
+    return reinterpret_cast<float const*>(reinterpret_cast<char const*>(positions)+size_t(stride)*index);
+  };
+
+  std::vector<Cluster>result;
+  GLuint const nofTriangles = nofIndices/3;
+  GLuint triangle = 0;
+  std::unordered_map<GLuint,GLuint>vertices;
+  while(triangle < nofTriangles){
+    vertices.clear();
+    GLuint const first = triangle;
+    while(triangle < nofTriangles && triangle-first < maxTriangles){
+      GLuint nofNew = 0;
+      for(GLuint k=0;k<3;++k)
+        if(vertices.count(indices[triangle*3+k]) == 0)nofNew++;
+      if(vertices.size()+nofNew > maxVertices)break;
+      for(GLuint k=0;k<3;++k)
+        vertices[indices[triangle*3+k]] = 0;
+      triangle++;
+    }
+
+    Cluster cluster;
+    cluster.firstIndex = firstIndex + first*3;
+    cluster.nofIndices = (triangle-first)*3;
+    cluster.baseVertex = baseVertex;
+
+    float boxMin[3],boxMax[3];
+    for(int c=0;c<3;++c){
+      boxMin[c] = +std::numeric_limits<float>::max();
+      boxMax[c] = -std::numeric_limits<float>::max();
+    }
+    for(auto const&vertex:vertices){
+      auto const p = position(vertex.first);
+      for(int c=0;c<3;++c){
+        boxMin[c] = std::min(boxMin[c],p[c]);
+        boxMax[c] = std::max(boxMax[c],p[c]);
+      }
+    }
+    for(int c=0;c<3;++c)
+      cluster.center[c] = (boxMin[c]+boxMax[c])*.5f;
+    float radius2 = 0.f;
+    for(auto const&vertex:vertices){
+      auto const p = position(vertex.first);
+      float d2 = 0.f;
+      for(int c=0;c<3;++c)
+        d2 += (p[c]-cluster.center[c])*(p[c]-cluster.center[c]);
+      radius2 = std::max(radius2,d2);
+    }
+    cluster.radius = std::sqrt(radius2);
+
+    std::vector<float>normals;
+    float axis[3] = {0.f,0.f,0.f};
+    for(GLuint t=first;t<triangle;++t){
+      auto const a = position(indices[t*3+0]);
+      auto const b = position(indices[t*3+1]);
+      auto const c = position(indices[t*3+2]);
+      float const e0[3] = {b[0]-a[0],b[1]-a[1],b[2]-a[2]};
+      float const e1[3] = {c[0]-a[0],c[1]-a[1],c[2]-a[2]};
+      float n[3] = {
+        e0[1]*e1[2]-e0[2]*e1[1],
+        e0[2]*e1[0]-e0[0]*e1[2],
+        e0[0]*e1[1]-e0[1]*e1[0]};
+      float const length = std::sqrt(n[0]*n[0]+n[1]*n[1]+n[2]*n[2]);
+      if(length == 0.f)continue;
+      for(int k=0;k<3;++k){
+        n[k] /= length;
+        axis[k] += n[k];
+        normals.push_back(n[k]);
+      }
+    }
+    float const axisLength = std::sqrt(axis[0]*axis[0]+axis[1]*axis[1]+axis[2]*axis[2]);
+    if(axisLength > 0.f && !normals.empty()){
+      float minDot = 1.f;
+      for(int k=0;k<3;++k)
+        cluster.coneAxis[k] = axis[k]/axisLength;
+      for(size_t n=0;n<normals.size();n+=3)
+        minDot = std::min(minDot,
+            normals[n+0]*cluster.coneAxis[0]+
+            normals[n+1]*cluster.coneAxis[1]+
+            normals[n+2]*cluster.coneAxis[2]);
+      cluster.coneCutoff = minDot <= 0.f ? 1.f : std::sqrt(1.f-minDot*minDot);
+    }
+    result.push_back(cluster);
+  }
+  return result;
+}
+
+/**
+ * @brief uploads clusters into cluster buffer
+ *
+ * @param clusters clusters
+ */
+void ClusterCuller::setClusters(std::vector<Cluster>const&clusters){
+  assert(this != nullptr);
+  if(clusters.size() > impl->maxClusters)
+    throw std::runtime_error("ClusterCuller::setClusters - number of clusters exceeds maxClusters ("+std::to_string(impl->maxClusters)+")");
+  if(!clusters.empty())
+    impl->clusters->setData(clusters.data(),GLsizeiptr(clusters.size()*sizeof(Cluster)));
+  impl->nofClusters = GLuint(clusters.size());
+}
+
+/**
+ * @brief selects tests that cull() performs
+ *
+ * @param tests combination of FRUSTUM, BACKFACE and OCCLUSION
+ */
+void ClusterCuller::setTests(GLuint tests){
+  assert(this != nullptr);
+  impl->tests = tests;
+}
+
+/**
+ * @brief builds hierarchical depth buffer from depth texture, every texel of level contains
+ * the farthest depth of texels it covers in previous level.
+ * It is usually called with depth of previous frame, occlusion test of the following cull()
+ * uses it. Hi-Z is reallocated if resolution of depth changes.
+ *
+ * @param depth depth texture (GL_TEXTURE_2D), it is read through texture unit 0
+ */
+void ClusterCuller::buildHiZ(Texture const&depth){
+  assert(this != nullptr);
+  auto const width  = depth.getWidth (0);
+  auto const height = depth.getHeight(0);
+  if(width == 0 || height == 0)
+    throw std::invalid_argument("ClusterCuller::buildHiZ - depth texture is empty");
+  if(!impl->hiZ || impl->hiZ->getWidth(0) != width || impl->hiZ->getHeight(0) != height){
+    impl->hiZLevels = 1;
+    while((std::max(width,height)>>impl->hiZLevels) != 0)impl->hiZLevels++;
+    impl->hiZ = std::make_shared<Texture>(impl->table,GL_TEXTURE_2D,GL_R32F,impl->hiZLevels,GLsizei(width),GLsizei(height));
+  }
+  depth.bind(0);
+  for(GLint level=0;level<impl->hiZLevels;++level){
+    if(level > 0)
+      impl->hiZ->bindImage(0,level-1,GL_R32F,GL_READ_ONLY );
+    impl->hiZ->bindImage(1,level,GL_R32F,GL_WRITE_ONLY);
+    auto const w = std::max(width >>level,1u);
+    auto const h = std::max(height>>level,1u);
+    impl->hiZProgram
+      ->set1i   ("level",level)
+      ->dispatch((w+7)/8,(h+7)/8);
+    impl->gl.glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+  }
+}
+
+/**
+ * @brief culls all clusters
+ *
+ * @param modelViewProjection column major matrix, it transforms cluster space into clip space
+ * @param cameraPosition x,y,z of camera in cluster space
+ */
+void ClusterCuller::cull(float const*modelViewProjection,float const*cameraPosition){
+  assert(this != nullptr);
+  cull(modelViewProjection,cameraPosition,0,impl->nofClusters);
+}
+
+/**
+ * @brief culls range of clusters, visible clusters are written into command buffer.
+ * Frustum planes are extracted from modelViewProjection (Gribb-Hartmann).
+ *
+ * @param modelViewProjection column major matrix, it transforms cluster space into clip space
+ * @param cameraPosition x,y,z of camera in cluster space
+ * @param firstCluster first cluster
+ * @param nofClusters number of clusters
+ */
+void ClusterCuller::cull(float const*modelViewProjection,float const*cameraPosition,GLuint firstCluster,GLuint nofClusters){
+  assert(this != nullptr);
+  if(firstCluster > impl->nofClusters || nofClusters > impl->nofClusters - firstCluster)
+    throw std::invalid_argument("ClusterCuller::cull - clusters "+std::to_string(firstCluster)+"+"+std::to_string(nofClusters)+" are out of range");
+
+  auto const m = [&](int row,int column){return modelViewProjection[column*4+row];};
+  float planes[6*4];
+  for(int i=0;i<3;++i)
+    for(int side=0;side<2;++side){
+      float*plane = planes+(i*2+side)*4;
+      float const sign = side == 0 ? 1.f : -1.f;
+      for(int c=0;c<4;++c)
+        plane[c] = m(3,c) + sign*m(i,c);
+      float const length = std::sqrt(plane[0]*plane[0]+plane[1]*plane[1]+plane[2]*plane[2]);
+      if(length > 0.f)
+        for(int c=0;c<4;++c)plane[c] /= length;
+    }
+
+  GLuint const zeros[NOF_COUNTERS] = {};
+  impl->counts->setData(zeros,sizeof(zeros));
+  impl->lastNofClusters = nofClusters;
+  if(nofClusters == 0)return;
+
+  impl->clusters->bindBase(GL_SHADER_STORAGE_BUFFER,0);
+  impl->commands->bindBase(GL_SHADER_STORAGE_BUFFER,1);
+  impl->counts  ->bindBase(GL_SHADER_STORAGE_BUFFER,2);
+  GLint hiZLevels = 0;
+  if(impl->hiZ && (impl->tests & OCCLUSION) != 0){
+    impl->hiZ->bind(0);
+    hiZLevels = impl->hiZLevels;
+  }
+  impl->cullProgram
+    ->set4fv      ("planes"             ,planes,6           )
+    ->setMatrix4fv("modelViewProjection",modelViewProjection)
+    ->set3fv      ("cameraPosition"     ,cameraPosition     )
+    ->set1ui      ("firstCluster"       ,firstCluster       )
+    ->set1ui      ("nofClusters"        ,nofClusters        )
+    ->set1ui      ("tests"              ,impl->tests        )
+    ->set1i       ("hiZLevels"          ,hiZLevels          )
+    ->dispatch    ((nofClusters+workGroupSize-1)/workGroupSize);
+  impl->gl.glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+/**
+ * @brief draws visible clusters of the last cull() by glMultiDrawElementsIndirectCount
+ *
+ * @param mode primitive type
+ */
+void ClusterCuller::draw(GLenum mode)const{
+  assert(this != nullptr);
+  if(impl->lastNofClusters == 0)return;
+  impl->commands->bind(GL_DRAW_INDIRECT_BUFFER);
+  impl->counts  ->bind(GL_PARAMETER_BUFFER   );
+  impl->gl.glMultiDrawElementsIndirectCount(
+      mode                        ,
+      GL_UNSIGNED_INT             ,
+      nullptr                     ,
+      0                           ,
+      GLsizei(impl->lastNofClusters),
+      0                           );
+}
+
+/**
+ * @brief reads counters of the last cull(), it waits for gpu
+ *
+ * @return statistics
+ */
+ClusterCuller::Statistics ClusterCuller::getStatistics()const{
+  assert(this != nullptr);
+  GLuint counters[NOF_COUNTERS] = {};
+  impl->counts->getData(counters,sizeof(counters));
+  Statistics result;
+  result.nofClusters        = impl->lastNofClusters   ;
+  result.nofVisible         = counters[DRAW_COUNT      ];
+  result.nofFrustumCulled   = counters[FRUSTUM_CULLED  ];
+  result.nofBackfaceCulled  = counters[BACKFACE_CULLED ];
+  result.nofOcclusionCulled = counters[OCCLUSION_CULLED];
+  return result;
+}
+
+/**
+ * @brief gets tests that cull() performs
+ *
+ * @return combination of FRUSTUM, BACKFACE and OCCLUSION
+ */
+GLuint ClusterCuller::getTests()const{
+  assert(this != nullptr);
+  return impl->tests;
+}
+
+/**
+ * @brief gets number of clusters in cluster buffer
+ *
+ * @return number of clusters
+ */
+GLuint ClusterCuller::getNofClusters()const{
+  assert(this != nullptr);
+  return impl->nofClusters;
+}
+
+/**
+ * @brief gets capacity of cluster buffer
+ *
+ * @return maximal number of clusters
+ */
+GLuint ClusterCuller::getMaxClusters()const{
+  assert(this != nullptr);
+  return impl->maxClusters;
+}
+
+/**
+ * @brief gets buffer with clusters (std430 array of Cluster)
+ *
+ * @return cluster buffer
+ */
+std::shared_ptr<Buffer>const&ClusterCuller::getClusterBuffer()const{
+  assert(this != nullptr);
+  return impl->clusters;
+}
+
+/**
+ * @brief gets compacted buffer with commands of visible clusters
+ *
+ * @return command buffer
+ */
+std::shared_ptr<Buffer>const&ClusterCuller::getCommandBuffer()const{
+  assert(this != nullptr);
+  return impl->commands;
+}
+
+/**
+ * @brief gets buffer with counters, the first one is number of commands (GL_PARAMETER_BUFFER)
+ *
+ * @return count buffer
+ */
+std::shared_ptr<Buffer>const&ClusterCuller::getCountBuffer()const{
+  assert(this != nullptr);
+  return impl->counts;
+}
+
+/**
+ * @brief gets hierarchical depth buffer
+ *
+ * @return Hi-Z texture, it is nullptr before buildHiZ()
+ */
+std::shared_ptr<Texture>const&ClusterCuller::getHiZ()const{
+  assert(this != nullptr);
+  return impl->hiZ;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<memory>
+#include<vector>
+
+/**
+ * @brief GPU driven culling of mesh clusters (meshlets).
+ * Mesh is split into clusters of contiguous triangles, every cluster has bounding sphere
+ * and normal cone. Compute shader tests every cluster against view frustum, normal cone
+ * (cluster is back-facing) and optionally against hierarchical depth buffer (Hi-Z) and writes
+ * DrawElementsIndirectCommand of every visible cluster into compacted command buffer.
+ * draw() consumes it by glMultiDrawElementsIndirectCount, number of draws never leaves gpu.
+ * Vertex array with vertices and GL_UNSIGNED_INT indices of clusters has to be bound by user.
+ * baseInstance of command is index of cluster, it is visible as gl_BaseInstance.
+ */
+class GEGL_EXPORT ge::gl::ClusterCuller{
+  public:
+    /**
+     * @brief layout of one cluster in shader storage buffer (std430)
+     */
+    struct Cluster{
+      float  center[3]  = {0.f,0.f,0.f};///<center of bounding sphere
+      float  radius     = 0.f          ;///<radius of bounding sphere
+      float  coneAxis[3]= {0.f,0.f,1.f};///<average normal of triangles
+      float  coneCutoff = 1.f          ;///<sine of maximal angle between axis and normals, 1 disables back-face test
+      GLuint firstIndex = 0            ;///<first index in element buffer
+      GLuint nofIndices = 0            ;///<number of indices
+      GLint  baseVertex = 0            ;///<value added to indices
+      GLuint padding    = 0            ;
+    };
+    /**
+     * @brief tests that cull() performs
+     */
+    enum Test : GLuint{
+      FRUSTUM   = 1u,
+      BACKFACE  = 2u,
+      OCCLUSION = 4u,///<it needs buildHiZ()
+      ALL       = FRUSTUM | BACKFACE | OCCLUSION,
+    };
+    /**
+     * @brief result of the last cull()
+     */
+    struct Statistics{
+      GLuint nofClusters        = 0;
+      GLuint nofVisible         = 0;
+      GLuint nofFrustumCulled   = 0;
+      GLuint nofBackfaceCulled  = 0;
+      GLuint nofOcclusionCulled = 0;
+    };
+    ClusterCuller(
+        GLuint maxClusters = 1u<<16);
+    ClusterCuller(
+        FunctionTablePointer const&table              ,
+        GLuint                     maxClusters = 1u<<16);
+    ~ClusterCuller();
+    static std::vector<Cluster>buildClusters(
+        GLuint const*indices             ,
+        GLuint       nofIndices          ,
+        float  const*positions           ,
+        GLsizei      stride              ,
+        GLuint       nofVertices         ,
+        GLuint       firstIndex   = 0    ,
+        GLint        baseVertex   = 0    ,
+        GLuint       maxTriangles = 64   ,
+        GLuint       maxVertices  = 64   );
+    void   setClusters   (std::vector<Cluster>const&clusters);
+    void   setTests      (GLuint tests);
+    void   buildHiZ      (Texture const&depth);
+    void   cull          (float const*modelViewProjection,float const*cameraPosition);
+    void   cull          (float const*modelViewProjection,float const*cameraPosition,GLuint firstCluster,GLuint nofClusters);
+    void   draw          (GLenum mode = GL_TRIANGLES)const;
+    Statistics getStatistics()const;
+    GLuint getTests      ()const;
+    GLuint getNofClusters()const;
+    GLuint getMaxClusters()const;
+    std::shared_ptr<Buffer >const&getClusterBuffer()const;
+    std::shared_ptr<Buffer >const&getCommandBuffer()const;
+    std::shared_ptr<Buffer >const&getCountBuffer  ()const;
+    std::shared_ptr<Texture>const&getHiZ          ()const;
+    ClusterCuller(ClusterCuller const&) = delete;
+  private:
+    ClusterCullerImpl*impl = nullptr;
+};
@@ -0,0 +1,187 @@
+#include<geGL/CommandList.h>
+#include<geGL/RecordTableDecorator.h>
+#include<geGL/OpenGLContext.h>
+#include<algorithm>
+#include<cassert>
+#include<cstring>
+#include<vector>
+
+using namespace ge::gl;
+
+constexpr size_t CommandList::alignment;
+
+namespace{
+  /**
+   * @brief header of command, arguments follow it
+   */
+  struct Header{
+    CommandList::Replay replay;///<nullptr for data stored by CommandList::store
+    uint32_t            size  ;///<size of arguments including padding
+  };
+  size_t const headerSize = (sizeof(Header) + CommandList::alignment - 1) / CommandList::alignment * CommandList::alignment;
+
+  size_t align(size_t size){
+    return (size + CommandList::alignment - 1) / CommandList::alignment * CommandList::alignment;
+  }
+}
+
+class ge::gl::CommandListImpl{
+  public:
+    struct Chunk{
+      std::unique_ptr<uint64_t[]>data    ;
+      size_t                     capacity;
+      size_t                     used    ;
+      uint8_t*begin()const{return reinterpret_cast<uint8_t*>(data.get());}
+    };
+    CommandListImpl(size_t chunkSize):chunkSize(chunkSize){}
+    uint8_t*allocate(size_t size){
+      while(current < chunks.size()){
+        auto&chunk = chunks[current];
+        if(chunk.used + size <= chunk.capacity){
+          auto const result = chunk.begin() + chunk.used;
+          chunk.used += size;
+          return result;
+        }
+        current++;
+      }
+      auto const capacity = align(std::max(size,chunkSize));
+      chunks.push_back({std::unique_ptr<uint64_t[]>(new uint64_t[capacity/sizeof(uint64_t)]),capacity,size});
+      current = chunks.size()-1;
+      return chunks.back().begin();
+    }
+    size_t            chunkSize        ;
+    std::vector<Chunk>chunks           ;
+    size_t            current      = 0 ;///<chunk that is being filled
+    size_t            nofCommands  = 0 ;
+};
+
+/**
+ * @brief creates empty command list
+ *
+ * @param chunkSize size of memory chunks in bytes
+ */
+CommandList::CommandList(size_t chunkSize){
+  assert(chunkSize >= headerSize);
+  impl = new CommandListImpl(align(chunkSize));
+}
+
+/**
+ * @brief destructor
+ */
+CommandList::~CommandList(){
+  delete impl;
+}
+
+/**
+ * @brief allocates command, it is used by RecordTableDecorator
+ *
+ * @param replay function that executes command
+ * @param size size of arguments in bytes
+ *
+ * @return memory for arguments aligned to CommandList::alignment
+ */
+void*CommandList::allocateCommand(Replay replay,size_t size){
+  assert(this!=nullptr);
+  auto const argumentsSize = align(size);
+  auto const data = impl->allocate(headerSize + argumentsSize);
+  auto const header = reinterpret_cast<Header*>(data);
+  header->replay = replay;
+  header->size   = static_cast<uint32_t>(argumentsSize);
+  if(replay)impl->nofCommands++;
+  return data + headerSize;
+}
+
+/**
+ * @brief copies data into command list.
+ * Data live until clear() or destruction of command list,
+ * so they can be passed as pointer arguments of recorded commands.
+ *
+ * @param data data
+ * @param size size of data in bytes
+ *
+ * @return pointer to copy of data
+ */
+void const*CommandList::store(void const*data,size_t size){
+  assert(this!=nullptr);
+  auto const result = allocateCommand(nullptr,size);
+  std::memcpy(result,data,size);
+  return result;
+}
+
+/**
+ * @brief executes all commands in recorded order
+ *
+ * @param table function table that executes commands, nullptr means default function table
+ */
+void CommandList::replay(FunctionTablePointer const&table)const{
+  assert(this!=nullptr);
+  auto const&gl = table?table:getDefaultFunctionTable();
+  for(size_t i=0;i<impl->chunks.size() && i<=impl->current;++i){
+    auto const&chunk = impl->chunks[i];
+    auto       data  = chunk.begin();
+    auto const end   = data + chunk.used;
+    while(data < end){
+      auto const header = reinterpret_cast<Header const*>(data);
+      if(header->replay)header->replay(*gl,data + headerSize);
+      data += headerSize + header->size;
+    }
+  }
+}
+
+/**
+ * @brief removes all commands, memory chunks are kept for next recording
+ */
+void CommandList::clear(){
+  assert(this!=nullptr);
+  for(auto&chunk:impl->chunks)
+    chunk.used = 0;
+  impl->current     = 0;
+  impl->nofCommands = 0;
+}
+
+/**
+ * @brief gets number of recorded commands
+ *
+ * @return number of commands
+ */
+size_t CommandList::getNofCommands()const{
+  assert(this!=nullptr);
+  return impl->nofCommands;
+}
+
+/**
+ * @brief gets size of recorded commands and stored data
+ *
+ * @return size in bytes
+ */
+size_t CommandList::getSize()const{
+  assert(this!=nullptr);
+  size_t result = 0;
+  for(auto const&chunk:impl->chunks)
+    result += chunk.used;
+  return result;
+}
+
+/**
+ * @brief gets size of allocated memory chunks
+ *
+ * @return size in bytes
+ */
+size_t CommandList::getCapacity()const{
+  assert(this!=nullptr);
+  size_t result = 0;
+  for(auto const&chunk:impl->chunks)
+    result += chunk.capacity;
+  return result;
+}
+
+/**
+ * @brief Function creates function table that records commands into its commandList
+ *
+ * @return recording function table
+ */
+std::shared_ptr<RecordTableDecorator<FunctionTable>>ge::gl::createRecordTable(){
+  auto table = std::make_shared<RecordTableDecorator<FunctionTable>>();
+  table->construct();
+  return table;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<memory>
+
+/**
+ * @brief Arena allocated list of recorded OpenGL commands.
+ * Commands are stored as replay function followed by packed arguments
+ * in large chunks of memory, chunks are reused after clear().
+ * CommandList is filled by RecordTableDecorator (it can be used by thread without OpenGL context)
+ * and it is replayed by thread that owns OpenGL context.
+ */
+class GEGL_EXPORT ge::gl::CommandList{
+  public:
+    /**
+     * @brief function that executes one command
+     *
+     * @param table function table that receives the command
+     * @param data packed arguments of the command
+     */
+    using Replay = void(*)(FunctionTable const&table,void const*data);
+    static constexpr size_t alignment = 8;///<alignment of arguments of commands
+    CommandList(size_t chunkSize = 64*1024);
+    ~CommandList();
+    void*      allocateCommand(Replay replay,size_t size);
+    void const*store          (void const*data,size_t size);
+    void       replay         (FunctionTablePointer const&table = nullptr)const;
+    void       clear          ();
+    size_t     getNofCommands ()const;
+    size_t     getSize        ()const;
+    size_t     getCapacity    ()const;
+    CommandList(CommandList const&) = delete;
+  private:
+    CommandListImpl*impl = nullptr;
+};
@@ -0,0 +1,245 @@
+#include<geGL/DrawBatch.h>
+#include<geGL/Buffer.h>
+#include<geGL/StreamBuffer.h>
+#include<geGL/OpenGLContext.h>
+#include<cassert>
+#include<cstring>
+#include<stdexcept>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+
+class ge::gl::DrawBatchImpl{
+  public:
+    using Parameters = DrawBatch::Parameters;
+    DrawBatchImpl(FunctionTablePointer const&table,Parameters const&p):gl(table),parameters(p){
+      if(p.vertexSize <= 0 || p.maxVertices == 0 || p.maxIndices == 0)
+        throw std::invalid_argument("DrawBatch - size of vertex and capacities of arenas have to be positive");
+      if(p.maxCommands == 0 || p.framesInFlight == 0)
+        throw std::invalid_argument("DrawBatch - number of commands and number of frames in flight have to be positive");
+      vertices = std::make_shared<Buffer>(table,p.vertexSize*GLsizeiptr(p.maxVertices),nullptr,GL_DYNAMIC_STORAGE_BIT);
+      indices  = std::make_shared<Buffer>(table,GLsizeiptr(sizeof(GLuint))*p.maxIndices,nullptr,GL_DYNAMIC_STORAGE_BIT);
+      commands = std::make_shared<StreamBuffer>(table,GLsizeiptr(sizeof(DrawBatch::Command))*p.maxCommands*p.framesInFlight,GLsizeiptr(sizeof(GLuint)));
+      queue.reserve(p.maxCommands);
+    }
+    Context                        gl                 ;
+    Parameters                     parameters         ;
+    std::shared_ptr<Buffer>        vertices           ;
+    std::shared_ptr<Buffer>        indices            ;
+    std::shared_ptr<StreamBuffer>  commands           ;
+    std::vector<DrawBatch::Mesh>   meshes             ;
+    std::vector<DrawBatch::Command>queue              ;///<commands of next submit
+    GLuint                         nofVertices = 0    ;
+    GLuint                         nofIndices  = 0    ;
+};
+
+/**
+ * @brief creates draw batch with empty arenas
+ *
+ * @param parameters vertex size and capacities
+ */
+DrawBatch::DrawBatch(Parameters const&parameters):DrawBatch(nullptr,parameters){}
+
+/**
+ * @brief creates draw batch with empty arenas
+ *
+ * @param table opengl function table
+ * @param parameters vertex size and capacities
+ */
+DrawBatch::DrawBatch(
+    FunctionTablePointer const&table     ,
+    Parameters           const&parameters){
+  impl = new DrawBatchImpl(table,parameters);
+}
+
+/**
+ * @brief destructor, it releases arenas and command buffer
+ */
+DrawBatch::~DrawBatch(){
+  delete impl;
+}
+
+/**
+ * @brief copies mesh into arenas
+ *
+ * @param vertices nofVertices vertices of size Parameters::vertexSize
+ * @param nofVertices number of vertices
+ * @param indices indices relative to first vertex of mesh
+ * @param nofIndices number of indices
+ *
+ * @return id of mesh that can be passed to draw()
+ */
+DrawBatch::MeshId DrawBatch::addMesh(void const*vertices,GLuint nofVertices,GLuint const*indices,GLuint nofIndices){
+  assert(this != nullptr);
+  auto const&p = impl->parameters;
+  if(nofVertices == 0 || nofIndices == 0)
+    throw std::invalid_argument("DrawBatch::addMesh - mesh has to contain vertices and indices");
+  for(GLuint i=0;i<nofIndices;++i)
+    if(indices[i] >= nofVertices)
+      throw std::invalid_argument("DrawBatch::addMesh - index "+std::to_string(indices[i])+" is out of range of mesh vertices");
+  if(nofVertices > p.maxVertices - impl->nofVertices)
+    throw std::runtime_error("DrawBatch::addMesh - vertex arena is full ("+std::to_string(p.maxVertices)+" vertices)");
+  if(nofIndices > p.maxIndices - impl->nofIndices)
+    throw std::runtime_error("DrawBatch::addMesh - index arena is full ("+std::to_string(p.maxIndices)+" indices)");
+
+  Mesh mesh;
+  mesh.firstVertex = impl->nofVertices;
+  mesh.nofVertices = nofVertices;
+  mesh.firstIndex  = impl->nofIndices;
+  mesh.nofIndices  = nofIndices;
+  impl->vertices->setData(vertices,p.vertexSize*GLsizeiptr(nofVertices),p.vertexSize*GLintptr(mesh.firstVertex));
+  impl->indices ->setData(indices,GLsizeiptr(sizeof(GLuint))*nofIndices,GLintptr(sizeof(GLuint))*mesh.firstIndex);
+  impl->nofVertices += nofVertices;
+  impl->nofIndices  += nofIndices ;
+  impl->meshes.push_back(mesh);
+  return impl->meshes.size()-1;
+}
+
+/**
+ * @brief appends draw of mesh into next submit
+ *
+ * @param mesh id of mesh
+ * @param instanceCount number of instances
+ * @param baseInstance first instance, it is visible as gl_BaseInstance and offsets instanced attributes
+ */
+void DrawBatch::draw(MeshId mesh,GLuint instanceCount,GLuint baseInstance){
+  assert(this != nullptr);
+  auto const&m = getMesh(mesh);
+  if(impl->queue.size() >= impl->parameters.maxCommands)
+    throw std::runtime_error("DrawBatch::draw - number of draws exceeds maxCommands ("+std::to_string(impl->parameters.maxCommands)+")");
+  Command command;
+  command.count         = m.nofIndices ;
+  command.instanceCount = instanceCount;
+  command.firstIndex    = m.firstIndex ;
+  command.baseVertex    = GLint(m.firstVertex);
+  command.baseInstance  = baseInstance ;
+  impl->queue.push_back(command);
+}
+
+/**
+ * @brief draws all appended draws using one glMultiDrawElementsIndirect.
+ * Commands are written into command buffer that is bound to GL_DRAW_INDIRECT_BUFFER,
+ * the region is fenced so it is not overwritten while gpu reads it.
+ * Appended draws are cleared.
+ *
+ * @param mode primitive type
+ */
+void DrawBatch::submit(GLenum mode){
+  assert(this != nullptr);
+  if(impl->queue.empty())return;
+  auto const size       = GLsizeiptr(impl->queue.size()*sizeof(Command));
+  auto const allocation = impl->commands->allocate(size);
+  std::memcpy(allocation.data,impl->queue.data(),size_t(size));
+  impl->commands->getBuffer()->bind(GL_DRAW_INDIRECT_BUFFER);
+  impl->gl.glMultiDrawElementsIndirect(
+      mode                                                 ,
+      GL_UNSIGNED_INT                                      ,
+      reinterpret_cast<GLvoid const*>(allocation.offset)   ,
+      GLsizei(impl->queue.size())                          ,
+      0                                                    );
+  impl->commands->fence();
+  impl->queue.clear();
+}
+
+/**
+ * @brief drops appended draws without drawing them
+ */
+void DrawBatch::clear(){
+  assert(this != nullptr);
+  impl->queue.clear();
+}
+
+/**
+ * @brief gets part of arenas that is occupied by mesh
+ *
+ * @param mesh id of mesh
+ *
+ * @return mesh
+ */
+DrawBatch::Mesh const&DrawBatch::getMesh(MeshId mesh)const{
+  assert(this != nullptr);
+  if(mesh >= impl->meshes.size())
+    throw std::invalid_argument("DrawBatch - mesh "+std::to_string(mesh)+" does not exist");
+  return impl->meshes[mesh];
+}
+
+/**
+ * @brief gets parameters of batch
+ *
+ * @return parameters
+ */
+DrawBatch::Parameters const&DrawBatch::getParameters()const{
+  assert(this != nullptr);
+  return impl->parameters;
+}
+
+/**
+ * @brief gets number of meshes in arenas
+ *
+ * @return number of meshes
+ */
+size_t DrawBatch::getNofMeshes()const{
+  assert(this != nullptr);
+  return impl->meshes.size();
+}
+
+/**
+ * @brief gets number of draws that wait for submit
+ *
+ * @return number of commands
+ */
+size_t DrawBatch::getNofCommands()const{
+  assert(this != nullptr);
+  return impl->queue.size();
+}
+
+/**
+ * @brief gets number of used vertices of vertex arena
+ *
+ * @return number of vertices
+ */
+GLuint DrawBatch::getNofVertices()const{
+  assert(this != nullptr);
+  return impl->nofVertices;
+}
+
+/**
+ * @brief gets number of used indices of index arena
+ *
+ * @return number of indices
+ */
+GLuint DrawBatch::getNofIndices()const{
+  assert(this != nullptr);
+  return impl->nofIndices;
+}
+
+/**
+ * @brief gets vertex arena, it should be attached to vertex array
+ *
+ * @return vertex buffer
+ */
+std::shared_ptr<Buffer>const&DrawBatch::getVertexBuffer()const{
+  assert(this != nullptr);
+  return impl->vertices;
+}
+
+/**
+ * @brief gets index arena (GL_UNSIGNED_INT), it should be attached to vertex array as element buffer
+ *
+ * @return index buffer
+ */
+std::shared_ptr<Buffer>const&DrawBatch::getIndexBuffer()const{
+  assert(this != nullptr);
+  return impl->indices;
+}
+
+/**
+ * @brief gets buffer with indirect commands
+ *
+ * @return command buffer
+ */
+std::shared_ptr<Buffer>const&DrawBatch::getCommandBuffer()const{
+  assert(this != nullptr);
+  return impl->commands->getBuffer();
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<memory>
+
+/**
+ * @brief Batch of indexed meshes drawn by one glMultiDrawElementsIndirect.
+ * Vertices and indices of all meshes are suballocated from two shared arenas
+ * (one vertex buffer, one GL_UNSIGNED_INT index buffer), indices of mesh are relative
+ * to its first vertex. Every draw() appends DrawElementsIndirectCommand,
+ * submit() streams commands into indirect buffer (StreamBuffer) and issues one call.
+ * Vertex array that reads from getVertexBuffer()/getIndexBuffer() has to be bound by user.
+ * Per object data can be fetched by gl_BaseInstance or gl_DrawID.
+ */
+class GEGL_EXPORT ge::gl::DrawBatch{
+  public:
+    struct Parameters{
+      GLsizeiptr vertexSize      = 32     ;///<size of one vertex in bytes
+      GLuint     maxVertices     = 1u<<20 ;///<capacity of vertex arena
+      GLuint     maxIndices      = 1u<<22 ;///<capacity of index arena
+      GLuint     maxCommands     = 1u<<14 ;///<maximal number of draws per submit
+      GLuint     framesInFlight  = 3      ;///<number of submits that can use command buffer at once
+    };
+    /**
+     * @brief part of arenas that is occupied by mesh
+     */
+    struct Mesh{
+      GLuint firstIndex  = 0;
+      GLuint nofIndices  = 0;
+      GLuint firstVertex = 0;
+      GLuint nofVertices = 0;
+    };
+    /**
+     * @brief layout of GL_DRAW_INDIRECT_BUFFER command
+     */
+    struct Command{
+      GLuint count         = 0;
+      GLuint instanceCount = 0;
+      GLuint firstIndex    = 0;
+      GLint  baseVertex    = 0;
+      GLuint baseInstance  = 0;
+    };
+    using MeshId = size_t;
+    DrawBatch(
+        Parameters const&parameters);
+    DrawBatch(
+        FunctionTablePointer const&table     ,
+        Parameters           const&parameters);
+    ~DrawBatch();
+    MeshId addMesh         (void const*vertices,GLuint nofVertices,GLuint const*indices,GLuint nofIndices);
+    void   draw            (MeshId mesh,GLuint instanceCount = 1,GLuint baseInstance = 0);
+    void   submit          (GLenum mode = GL_TRIANGLES);
+    void   clear           ();
+    Mesh       const&getMesh         (MeshId mesh)const;
+    Parameters const&getParameters   ()const;
+    size_t           getNofMeshes    ()const;
+    size_t           getNofCommands  ()const;
+    GLuint           getNofVertices  ()const;
+    GLuint           getNofIndices   ()const;
+    std::shared_ptr<Buffer>const&getVertexBuffer ()const;
+    std::shared_ptr<Buffer>const&getIndexBuffer  ()const;
+    std::shared_ptr<Buffer>const&getCommandBuffer()const;
+    DrawBatch(DrawBatch const&) = delete;
+  private:
+    DrawBatchImpl*impl = nullptr;
+};
@@ -26,5 +26,22 @@ namespace ge{
     class ProgramPipeline;
     class Sampler;
     class Renderbuffer;
+    class UniformBlock;
+    class UniformBlockImpl;
+    class StreamBuffer;
+    class StreamBufferImpl;
+    class ProgramCache;
+    class ProgramCacheImpl;
+    class ProgramBatch;
+    class ProgramBatchImpl;
+    class CommandList;
+    class CommandListImpl;
+    class Profiler;
+    class VirtualTexture;
+    class VirtualTextureImpl;
+    class DrawBatch;
+    class DrawBatchImpl;
+    class ClusterCuller;
+    class ClusterCullerImpl;
   }
 }
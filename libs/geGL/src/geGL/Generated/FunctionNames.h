@@ -0,0 +1,2926 @@
+"glMultiDrawArraysIndirectBindlessCountNV",
+"glTextureParameterfv",
+"glGetListParameterivSGIX",
+"glProgramUniform1i64ARB",
+"glVertexArrayElementBuffer",
+"glHintPGI",
+"glStencilMaskSeparate",
+"glGetFramebufferAttachmentParameterivEXT",
+"glTextureStorage3DMultisample",
+"glGetIntegerIndexedvEXT",
+"glCopyTexImage1D",
+"glVertexAttrib4usv",
+"glTexRenderbufferNV",
+"glVertexAttrib3hvNV",
+"glProgramUniform4ui64ARB",
+"glInstrumentsBufferSGIX",
+"glIndexi",
+"glMultiTexCoord2sARB",
+"glProgramEnvParameter4fARB",
+"glCompressedTexSubImage3D",
+"glEvalCoord2d",
+"glEvalCoord2f",
+"glIndexd",
+"glSecondaryColor3hvNV",
+"glIndexf",
+"glFrustumxOES",
+"glTextureStorage3DEXT",
+"glDrawCommandsStatesNV",
+"glUniform4uiEXT",
+"glProgramUniform3ui64ARB",
+"glIndexs",
+"glVertexArrayBindVertexBufferEXT",
+"glConvolutionParameteriEXT",
+"glColor4ubVertex2fSUN",
+"glProgramUniform1ivEXT",
+"glGetnMapfv",
+"glTransformFeedbackBufferRange",
+"glPathGlyphsNV",
+"glSecondaryColor3fv",
+"glGetCombinerInputParameterivNV",
+"glEndPerfMonitorAMD",
+"glPointParameterfvARB",
+"glVertex2xOES",
+"glDrawElementsInstancedBaseInstance",
+"glMultTransposeMatrixdARB",
+"glVertexAttribL4dEXT",
+"glVertex4iv",
+"glCoverStrokePathInstancedNV",
+"glDeformSGIX",
+"glUniform2ui64NV",
+"glCopyPathNV",
+"glVertexAttribP4ui",
+"glVertexAttribL2d",
+"glGetMultisamplefv",
+"glCompressedMultiTexSubImage3DEXT",
+"glVDPAURegisterOutputSurfaceNV",
+"glMinSampleShading",
+"glProgramUniform4fEXT",
+"glCoverStrokePathNV",
+"glTextureImage2DMultisampleNV",
+"glVertex3bOES",
+"glImportMemoryWin32HandleEXT",
+"glTessellationFactorAMD",
+"glDebugMessageControl",
+"glIsObjectBufferATI",
+"glPopAttrib",
+"glProgramUniform4iEXT",
+"glVertexAttrib4ubNV",
+"glColorMaterial",
+"glVertexAttrib2svARB",
+"glMinSampleShadingARB",
+"glColor3b",
+"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+"glColor3f",
+"glVDPAUGetSurfaceivNV",
+"glColor3d",
+"glGetnMapiv",
+"glColor3i",
+"glGetInternalformatSampleivNV",
+"glVertexAttrib4ubv",
+"glColor3s",
+"glVertexAttribs4hvNV",
+"glVertexAttrib4NubvARB",
+"glMultiTexCoord3hvNV",
+"glMatrixPushEXT",
+"glProgramUniform2fEXT",
+"glGetVertexArrayIndexediv",
+"glBlitFramebuffer",
+"glMultiTexCoordP2ui",
+"glColorPointerListIBM",
+"glVertexAttribL4d",
+"glGetFragmentMaterialfvSGIX",
+"glVertex2iv",
+"glGetTexEnvxvOES",
+"glUniformMatrix3dv",
+"glGetVertexAttribLdvEXT",
+"glTexCoordP3uiv",
+"glDeformationMap3dSGIX",
+"glResumeTransformFeedback",
+"glInsertEventMarkerEXT",
+"glTessellationModeAMD",
+"glDrawCommandsAddressNV",
+"glFogi",
+"glGetTexParameterxvOES",
+"glVertexPointer",
+"glGetPerfMonitorCounterDataAMD",
+"glFogf",
+"glMultiTexCoord1d",
+"glMultiTexCoord1f",
+"glGetMultiTexParameterivEXT",
+"glProgramUniformMatrix3x4fvEXT",
+"glVertexAttribI2i",
+"glMultiTexCoord1i",
+"glDeleteSemaphoresEXT",
+"glLoadProgramNV",
+"glWriteMaskEXT",
+"glGetGraphicsResetStatus",
+"glVertexAttrib1fv",
+"glMultiTexCoord1s",
+"glImageTransformParameterfvHP",
+"glFramebufferTexture2D",
+"glGetFragmentLightfvSGIX",
+"glListParameterfSGIX",
+"glTexCoord3sv",
+"glNamedFramebufferRenderbufferEXT",
+"glFragmentLightModelfSGIX",
+"glIndexPointerEXT",
+"glBlendEquationSeparateATI",
+"glVertexArrayAttribIFormat",
+"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+"glReplacementCodeubvSUN",
+"glGenFramebuffers",
+"glPixelMapx",
+"glTexSubImage3DEXT",
+"glGetAttachedShaders",
+"glGetPixelTexGenParameterfvSGIS",
+"glReplacementCodeuiNormal3fVertex3fSUN",
+"glGetDebugMessageLogAMD",
+"glVertexStream4sATI",
+"glVertexAttribs4dvNV",
+"glGetnMapdvARB",
+"glOrthofOES",
+"glViewportArrayv",
+"glDrawElementArrayATI",
+"glBufferStorageMemEXT",
+"glGetPathColorGenfvNV",
+"glWindowPos3iMESA",
+"glMultiTexCoord2s",
+"glVertex3dv",
+"glVertexAttribI3uivEXT",
+"glUniform3ui64ARB",
+"glVertexAttrib2fvNV",
+"glGetNamedBufferSubDataEXT",
+"glConvolutionFilter2D",
+"glMemoryBarrierByRegion",
+"glVertexArrayBindingDivisor",
+"glMatrixRotatedEXT",
+"glTexCoord2sv",
+"glIsProgramNV",
+"glUniform2dv",
+"glGetPixelMapuiv",
+"glDepthBoundsEXT",
+"glVertexAttrib4hvNV",
+"glMultiTexParameteriEXT",
+"glGetPointerv",
+"glPathCommandsNV",
+"glGetListParameterfvSGIX",
+"glGetUniformuiv",
+"glDebugMessageInsertAMD",
+"glFrustum",
+"glVertexAttribL1ui64vNV",
+"glClearColorxOES",
+"glProgramUniformMatrix3fv",
+"glSampleMaskIndexedNV",
+"glCompileShaderIncludeARB",
+"glGetArrayObjectfvATI",
+"glVertexStream4svATI",
+"glMultiTexCoord4iARB",
+"glVariantfvEXT",
+"glMatrixLoadfEXT",
+"glLoadIdentityDeformationMapSGIX",
+"glGetRenderbufferParameteriv",
+"glProgramUniform3fEXT",
+"glNamedRenderbufferStorage",
+"glBindFragDataLocation",
+"glPolygonOffsetClamp",
+"glFogCoordPointerListIBM",
+"glFenceSync",
+"glGetVertexAttribIivEXT",
+"glFramebufferDrawBuffersEXT",
+"glVertexAttribs4fvNV",
+"glPauseTransformFeedbackNV",
+"glGetQueryObjecti64vEXT",
+"glVDPAUSurfaceAccessNV",
+"glValidateProgramPipeline",
+"glTexPageCommitmentARB",
+"glWindowPos3dvARB",
+"glStencilStrokePathInstancedNV",
+"glFogfv",
+"glGenQueriesARB",
+"glProgramUniform2i64NV",
+"glVertexP4ui",
+"glVertexStream1ivATI",
+"glProgramEnvParameterI4iNV",
+"glGenVertexArraysAPPLE",
+"glDrawTransformFeedbackInstanced",
+"glStencilThenCoverStrokePathNV",
+"glDeleteVertexArraysAPPLE",
+"glGetNamedBufferParameterui64vNV",
+"glQueryMatrixxOES",
+"glSecondaryColor3usv",
+"glTranslatexOES",
+"glDrawTransformFeedback",
+"glTexCoord2fColor4fNormal3fVertex3fvSUN",
+"glVDPAURegisterVideoSurfaceNV",
+"glGetTexParameterIuiv",
+"glBindBufferBaseNV",
+"glIndexPointer",
+"glGenQueryResourceTagNV",
+"glVertexAttrib4Nbv",
+"glListParameteriSGIX",
+"glBlendColorxOES",
+"glUniformui64vNV",
+"glIsSync",
+"glGetTextureParameterivEXT",
+"glFogCoordhvNV",
+"glFramebufferTextureLayerEXT",
+"glGetObjectPtrLabel",
+"glTextureParameteri",
+"glMultiTexCoord1fARB",
+"glUniformMatrix2x3dv",
+"glFramebufferDrawBufferEXT",
+"glCopyColorSubTable",
+"glGetNamedFramebufferParameterfvAMD",
+"glVertexAttribL3d",
+"glFragmentMaterialfvSGIX",
+"glMatrixLoadTranspose3x3fNV",
+"glDeleteNamesAMD",
+"glDrawRangeElementsEXT",
+"glOrtho",
+"glProgramUniform1dvEXT",
+"glColor4xOES",
+"glTexImage4DSGIS",
+"glProgramUniform1ui",
+"glDeleteBuffersARB",
+"glUnmapBufferARB",
+"glCopyTexImage2D",
+"glMaterialxOES",
+"glProgramUniformMatrix2x4fvEXT",
+"glTestObjectAPPLE",
+"glRenderbufferStorageEXT",
+"glVertexAttribL1ui64ARB",
+"glEndFragmentShaderATI",
+"glPathParameterivNV",
+"glUniform4uiv",
+"glFrameZoomSGIX",
+"glSecondaryColor3fEXT",
+"glLGPUInterlockNVX",
+"glVertexAttribL1dv",
+"glNormalStream3svATI",
+"glPathStencilFuncNV",
+"glSetInvariantEXT",
+"glGetTexBumpParameterivATI",
+"glBlendEquationSeparateEXT",
+"glEndOcclusionQueryNV",
+"glScissorArrayv",
+"glCallList",
+"glMapTexture2DINTEL",
+"glGetVkProcAddrNV",
+"glPixelTransferxOES",
+"glDeleteRenderbuffersEXT",
+"glTexCoord4fColor4fNormal3fVertex4fSUN",
+"glProgramUniformMatrix4dvEXT",
+"glGetnColorTable",
+"glFramebufferTextureLayerARB",
+"glVertexAttribL2dvEXT",
+"glGetCombinerStageParameterfvNV",
+"glMultiTexCoord1xvOES",
+"glMapBuffer",
+"glSecondaryColor3d",
+"glSecondaryColor3f",
+"glVertexAttribLFormat",
+"glElementPointerAPPLE",
+"glVertexStream1fATI",
+"glCoverageModulationNV",
+"glSecondaryColor3i",
+"glDeleteSync",
+"glGetProgramParameterfvNV",
+"glMaxShaderCompilerThreadsARB",
+"glUniformMatrix4x2dv",
+"glVertexArrayVertexAttribLOffsetEXT",
+"glSecondaryColor3s",
+"glIsImageHandleResidentNV",
+"glUniform3iv",
+"glVertexAttribL3i64vNV",
+"glPolygonMode",
+"glFramebufferSamplePositionsfvAMD",
+"glConvolutionFilter1DEXT",
+"glVertexAttrib1dvARB",
+"glTextureSubImage2DEXT",
+"glIsVertexArrayAPPLE",
+"glUseProgram",
+"glLineStipple",
+"glMultiTexCoord4fvARB",
+"glVideoCaptureNV",
+"glVertexArrayVertexAttribLFormatEXT",
+"glUniform3fvARB",
+"glProgramUniformMatrix3x2fvEXT",
+"glCopyTextureSubImage3DEXT",
+"glMultiTexCoord2bvOES",
+"glDeleteObjectARB",
+"glTextureLightEXT",
+"glRasterPos3i",
+"glMultiTexCoord3dARB",
+"glNamedFramebufferTextureEXT",
+"glTextureParameteriEXT",
+"glEvalCoord2xvOES",
+"glBindVideoCaptureStreamBufferNV",
+"glTexImage2DMultisampleCoverageNV",
+"glGetAttribLocationARB",
+"glDeleteShader",
+"glVertexAttrib1fARB",
+"glTexCoord2fColor4ubVertex3fSUN",
+"glTexCoord4fVertex4fSUN",
+"glGetMapdv",
+"glMapParameterfvNV",
+"glTextureParameterIuiv",
+"glTransformFeedbackAttribsNV",
+"glFragmentLightfvSGIX",
+"glWindowPos3sARB",
+"glGetConvolutionParameterfv",
+"glCopyTexSubImage3D",
+"glVertexAttribI3i",
+"glCreateShaderObjectARB",
+"glVertexAttribFormat",
+"glGetProgramivARB",
+"glVertexAttribI4usv",
+"glTexParameterf",
+"glVertexAttribBinding",
+"glGetHistogramParameteriv",
+"glTexParameteri",
+"glGetShaderSource",
+"glVertexAttrib4s",
+"glVertexAttrib4dvNV",
+"glVertexAttrib1dvNV",
+"glPopName",
+"glTextureBufferEXT",
+"glGetMultiTexImageEXT",
+"glGetPointerIndexedvEXT",
+"glIsNameAMD",
+"glColor4ub",
+"glBufferParameteriAPPLE",
+"glColor4ui",
+"glGetInternalformativ",
+"glColor4us",
+"glVertexAttribP1uiv",
+"glLinkProgram",
+"glTexCoord3s",
+"glTexCoord2dv",
+"glGetObjectLabel",
+"glVertexPointerEXT",
+"glDebugMessageCallbackARB",
+"glGetString",
+"glGetPathParameterfvNV",
+"glLightxvOES",
+"glEndQuery",
+"glSecondaryColor3uiv",
+"glPrioritizeTexturesxOES",
+"glEdgeFlagPointer",
+"glFramebufferParameteri",
+"glTexCoord3hNV",
+"glMultiModeDrawElementsIBM",
+"glCopyPixels",
+"glVertexAttribI2ui",
+"glClampColorARB",
+"glColorPointervINTEL",
+"glDeleteTextures",
+"glGetMinmaxParameterfvEXT",
+"glWindowPos3sMESA",
+"glVertexAttrib4f",
+"glNamedFramebufferParameteri",
+"glTexCoord2fVertex3fvSUN",
+"glReplacementCodeusSUN",
+"glGetNamedFramebufferParameteriv",
+"glVertexStream1fvATI",
+"glCreateVertexArrays",
+"glBeginConditionalRender",
+"glGetUnsignedBytevEXT",
+"glConvolutionFilter1D",
+"glMultiTexCoord3fARB",
+"glGetQueryObjectuivARB",
+"glScalexOES",
+"glSamplerParameteri",
+"glSamplerParameterf",
+"glShaderOp1EXT",
+"glBeginVideoCaptureNV",
+"glGetnHistogram",
+"glUniform1d",
+"glRenderMode",
+"glClearColorIiEXT",
+"glSignalSemaphoreEXT",
+"glGetCompressedTexImage",
+"glCompressedTextureImage1DEXT",
+"glGetActiveUniformBlockiv",
+"glUniform1i",
+"glMultiDrawArraysIndirectCount",
+"glGetTexEnvfv",
+"glColorTableParameterivSGI",
+"glCullFace",
+"glDeleteFencesAPPLE",
+"glProgramUniform4i",
+"glUniformHandleui64ARB",
+"glProgramUniform4f",
+"glViewportIndexedf",
+"glProgramUniform4d",
+"glTexCoord1xOES",
+"glVertexStream3ivATI",
+"glPointAlongPathNV",
+"glEndQueryARB",
+"glVDPAUMapSurfacesNV",
+"glVertex3i",
+"glVertexAttrib4uivARB",
+"glTextureStorageMem3DEXT",
+"glAttachShader",
+"glColor4hNV",
+"glGetFenceivNV",
+"glTexCoord2fColor4ubVertex3fvSUN",
+"glGetColorTable",
+"glFogCoordPointer",
+"glTexStorageSparseAMD",
+"glUnmapNamedBuffer",
+"glTexCoord4bvOES",
+"glVertexAttrib3fARB",
+"glRasterPos2xOES",
+"glCreateMemoryObjectsEXT",
+"glColor4ubVertex2fvSUN",
+"glSecondaryColor3dv",
+"glVertexAttribI4sv",
+"glDrawTransformFeedbackStreamInstanced",
+"glMultiTexCoord4ivARB",
+"glSpriteParameterfSGIX",
+"glSecondaryColor3sv",
+"glBindVideoCaptureStreamTextureNV",
+"glTexParameterIuiv",
+"glFlushPixelDataRangeNV",
+"glWindowPos3fv",
+"glVertexAttribLFormatNV",
+"glLightModelfv",
+"glGetColorTableSGI",
+"glGetCompressedTexImageARB",
+"glConvolutionParameteri",
+"glVertexWeighthNV",
+"glColorMaskIndexedEXT",
+"glColorMaski",
+"glColorFragmentOp1ATI",
+"glVertexAttribI4ubvEXT",
+"glVertexAttrib1dNV",
+"glUnmapObjectBufferATI",
+"glNamedProgramLocalParameterI4uiEXT",
+"glProgramUniform1iEXT",
+"glDeleteQueriesARB",
+"glWindowPos3svARB",
+"glVertex4s",
+"glImportMemoryWin32NameEXT",
+"glStringMarkerGREMEDY",
+"glIsTransformFeedback",
+"glProgramUniformMatrix2x3dvEXT",
+"glGetObjectLabelEXT",
+"glUniformHandleui64vNV",
+"glRotated",
+"glIsProgramPipeline",
+"glRotatef",
+"glVertex4i",
+"glGetActiveSubroutineUniformName",
+"glVertexAttrib4sNV",
+"glProgramLocalParameter4dvARB",
+"glReplacementCodeubSUN",
+"glMultiDrawElementsIndirectBindlessNV",
+"glImportSemaphoreWin32HandleEXT",
+"glUniformMatrix3fv",
+"glGetnMapfvARB",
+"glGetnUniformfv",
+"glVertexAttribL2dv",
+"glVertexWeightPointerEXT",
+"glTangent3sEXT",
+"glSecondaryColorPointer",
+"glAlphaFunc",
+"glGetNamedStringARB",
+"glTexCoord4d",
+"glBufferPageCommitmentARB",
+"glProgramLocalParameters4fvEXT",
+"glStencilFunc",
+"glSemaphoreParameterui64vEXT",
+"glGetVertexAttribdvNV",
+"glTexCoord3dv",
+"glGetQueryBufferObjectiv",
+"glTexGenxOES",
+"glMultiTexCoord1fvARB",
+"glLightEnviSGIX",
+"glGetProgramPipelineiv",
+"glVertexStream2ivATI",
+"glGetColorTableEXT",
+"glGetShaderInfoLog",
+"glGetOcclusionQueryuivNV",
+"glInvalidateNamedFramebufferSubData",
+"glVertexAttribL1i64NV",
+"glVDPAUInitNV",
+"glVertexAttrib1hvNV",
+"glVertexAttribI4i",
+"glRasterPos2iv",
+"glGetIntegerui64i_vNV",
+"glUniformHandleui64NV",
+"glWindowPos3ivMESA",
+"glBlendEquationSeparate",
+"glDrawElementsInstancedARB",
+"glGetSubroutineIndex",
+"glVertexAttrib2sv",
+"glSamplePatternSGIS",
+"glEGLImageTargetRenderbufferStorageOES",
+"glPushAttrib",
+"glVertex3hNV",
+"glRasterPos3xvOES",
+"glPathParameterfNV",
+"glGetUniformi64vNV",
+"glLightiv",
+"glMaterialxvOES",
+"glNamedProgramLocalParameter4fEXT",
+"glVertexAttribL1dEXT",
+"glGetnUniformdvARB",
+"glSecondaryColor3bEXT",
+"glBeginPerfQueryINTEL",
+"glProgramUniform1uivEXT",
+"glImageTransformParameterivHP",
+"glDeleteBuffers",
+"glBindProgramPipeline",
+"glScissor",
+"glProgramUniform4fv",
+"glGetBooleanv",
+"glMaterialfv",
+"glWindowPos4fvMESA",
+"glVertexAttribIPointerEXT",
+"glProgramBufferParametersfvNV",
+"glAlphaFuncxOES",
+"glMultiDrawArraysIndirectAMD",
+"glNormalStream3ivATI",
+"glTextureImage3DMultisampleNV",
+"glProgramUniform4uivEXT",
+"glReplacementCodeusvSUN",
+"glPollInstrumentsSGIX",
+"glGetTextureLevelParameteriv",
+"glVertexAttribI2uiv",
+"glMapControlPointsNV",
+"glColor4dv",
+"glInvalidateBufferSubData",
+"glMultiTexCoord1hNV",
+"glPointParameterfv",
+"glUniformMatrix2fvARB",
+"glUniform2fv",
+"glVertexPointerListIBM",
+"glGetMultiTexGenfvEXT",
+"glGetMinmaxEXT",
+"glIsFenceNV",
+"glMatrixFrustumEXT",
+"glDispatchComputeIndirect",
+"glQueryResourceNV",
+"glMultiTexCoord4bOES",
+"glProgramEnvParameter4dARB",
+"glProgramUniform1uiEXT",
+"glBindBufferRange",
+"glNormal3iv",
+"glVertexAttribL3dv",
+"glGetUniformdv",
+"glGetMultiTexLevelParameterfvEXT",
+"glFinalCombinerInputNV",
+"glCullParameterdvEXT",
+"glMultiTexCoord4s",
+"glMapVertexAttrib1fAPPLE",
+"glConvolutionParameterfEXT",
+"glTexCoord1iv",
+"glProgramUniform3fvEXT",
+"glColor3uiv",
+"glRenderGpuMaskNV",
+"glListBase",
+"glTexCoord2bOES",
+"glBindMaterialParameterEXT",
+"glGlobalAlphaFactorubSUN",
+"glVertexAttribL1ui64NV",
+"glPointParameterfSGIS",
+"glGetImageTransformParameterivHP",
+"glColorSubTableEXT",
+"glPixelTexGenParameterfvSGIS",
+"glClientWaitSync",
+"glQueryObjectParameteruiAMD",
+"glVertexAttribs1fvNV",
+"glVertexAttrib4NusvARB",
+"glVariantPointerEXT",
+"glTextureBuffer",
+"glVertexAttribI1uiEXT",
+"glInvalidateTexImage",
+"glProgramEnvParametersI4ivNV",
+"glPathGlyphIndexArrayNV",
+"glCopyImageSubData",
+"glGetUniformSubroutineuiv",
+"glBindVertexBuffer",
+"glMultiTexCoord1iARB",
+"glDebugMessageInsert",
+"glBeginVertexShaderEXT",
+"glIsVariantEnabledEXT",
+"glPassThroughxOES",
+"glIsSampler",
+"glConservativeRasterParameterfNV",
+"glMultiTexGenivEXT",
+"glNamedFramebufferTexture2DEXT",
+"glCopyTexSubImage1D",
+"glTexCoord1i",
+"glCheckFramebufferStatus",
+"glDrawElementArrayAPPLE",
+"glTexCoord1d",
+"glTexCoord1f",
+"glFragmentLightivSGIX",
+"glBindImageTexture",
+"glTransformFeedbackVaryings",
+"glMulticastBufferSubDataNV",
+"glDrawRangeElements",
+"glTexCoord1s",
+"glBindBufferBase",
+"glColor3bv",
+"glSyncTextureINTEL",
+"glCreateSamplers",
+"glCombinerParameterfNV",
+"glGetArrayObjectivATI",
+"glMultiDrawArrays",
+"glSampleMapATI",
+"glProgramUniform2i64ARB",
+"glBinormal3ivEXT",
+"glMultiDrawArraysIndirectCountARB",
+"glTextureStorageMem1DEXT",
+"glWindowPos2ivMESA",
+"glTexCoordP4ui",
+"glMultiTexSubImage1DEXT",
+"glProgramUniformMatrix2x3fvEXT",
+"glBufferDataARB",
+"glVertexAttribIFormat",
+"glCreateFramebuffers",
+"glNormalStream3dvATI",
+"glClearAccum",
+"glUniform3i64vNV",
+"glNormal3fVertex3fSUN",
+"glUniform2uivEXT",
+"glBeginQuery",
+"glStencilThenCoverStrokePathInstancedNV",
+"glBindBuffer",
+"glMap2d",
+"glMap2f",
+"glMakeImageHandleResidentNV",
+"glUniformMatrix2x4fv",
+"glGetMultiTexParameterfvEXT",
+"glDepthRangeIndexed",
+"glIsEnabled",
+"glMatrixScalefEXT",
+"glGetError",
+"glGetTexEnviv",
+"glBindTextureUnitParameterEXT",
+"glGetnUniformfvARB",
+"glReplacementCodeuiNormal3fVertex3fvSUN",
+"glDeletePerfQueryINTEL",
+"glActiveVaryingNV",
+"glGetActiveUniformARB",
+"glVertexAttribI3ivEXT",
+"glEvalCoord1d",
+"glNamedCopyBufferSubDataEXT",
+"glEvalCoord1f",
+"glPixelMapfv",
+"glVertexAttribI1ivEXT",
+"glCreateSyncFromCLeventARB",
+"glGetPixelMapusv",
+"glGetnColorTableARB",
+"glAccum",
+"glRasterPos3sv",
+"glTexCoord2iv",
+"glBlendFunciARB",
+"glProgramUniform3i64vARB",
+"glGetFramebufferAttachmentParameteriv",
+"glProgramUniform4ui",
+"glStencilMask",
+"glResetHistogramEXT",
+"glLightxOES",
+"glNamedBufferData",
+"glVertexStream3sATI",
+"glVertexAttrib3fvARB",
+"glClearNamedBufferSubData",
+"glProgramUniformHandleui64ARB",
+"glUniform3iARB",
+"glCreateProgramObjectARB",
+"glMultiTexCoord1dvARB",
+"glGetObjectParameterfvARB",
+"glRectsv",
+"glMultiTexImage2DEXT",
+"glProgramUniform1i64NV",
+"glGetObjectBufferivATI",
+"glUniform4i64ARB",
+"glReplacementCodeuiColor4ubVertex3fvSUN",
+"glBlendFuncSeparateINGR",
+"glGetVideoCaptureStreamfvNV",
+"glVertexAttrib2fARB",
+"glGetTexGeniv",
+"glPixelStorei",
+"glGetCompressedTextureSubImage",
+"glCopyImageSubDataNV",
+"glActiveShaderProgram",
+"glVertexStream1iATI",
+"glPatchParameterfv",
+"glIsFramebufferEXT",
+"glTextureStorage2D",
+"glProgramUniform1ui64ARB",
+"glTexBufferRange",
+"glGetPixelTexGenParameterivSGIS",
+"glTextureSubImage3DEXT",
+"glClipControl",
+"glGetProgramResourceiv",
+"glMultiTexCoordP2uiv",
+"glVertexAttribI3ui",
+"glSampleMaskSGIS",
+"glVertexAttrib4NivARB",
+"glGlobalAlphaFactorfSUN",
+"glBlendEquationSeparateIndexedAMD",
+"glGetPerfCounterInfoINTEL",
+"glDeleteProgramsNV",
+"glPixelZoomxOES",
+"glGetCombinerOutputParameterivNV",
+"glRasterPos2xvOES",
+"glGetTexImage",
+"glVertexArrayVertexBuffers",
+"glUniform1ui64NV",
+"glProgramParameteri",
+"glNormal3xOES",
+"glGetMapfv",
+"glVertexStream2dvATI",
+"glPathStencilDepthOffsetNV",
+"glIsStateNV",
+"glGetIntegerui64vNV",
+"glGetImageTransformParameterfvHP",
+"glRasterPos2fv",
+"glVertex3xOES",
+"glIsMemoryObjectEXT",
+"glWeightPointerARB",
+"glFinishFenceNV",
+"glDepthRangexOES",
+"glEnableVertexArrayAttribEXT",
+"glProgramUniform2uivEXT",
+"glGetDoubleIndexedvEXT",
+"glWindowPos2fMESA",
+"glSecondaryColor3b",
+"glCopyConvolutionFilter1DEXT",
+"glWindowPos2sv",
+"glBindFramebufferEXT",
+"glCreateShader",
+"glGenPathsNV",
+"glGenRenderbuffers",
+"glCopyTexSubImage2D",
+"glVertexAttrib4ubvARB",
+"glDrawTextureNV",
+"glVertexAttribs1svNV",
+"glClearNamedBufferSubDataEXT",
+"glBlendFuncSeparate",
+"glPointParameterfARB",
+"glTexCoord2fv",
+"glGetVariantFloatvEXT",
+"glVertexP2ui",
+"glWindowPos2dMESA",
+"glTexCoord4fv",
+"glBindFragDataLocationEXT",
+"glCompressedTexSubImage1DARB",
+"glGetTextureImageEXT",
+"glFogCoordd",
+"glPointSize",
+"glBindTextureUnit",
+"glProgramEnvParameterI4uiNV",
+"glGetProgramPipelineInfoLog",
+"glProgramUniform4i64vARB",
+"glVertexAttrib4Nuiv",
+"glGetUniformfvARB",
+"glWaitSync",
+"glUniform3i",
+"glBlendEquationSeparatei",
+"glVertexAttrib2hvNV",
+"glTextureParameterivEXT",
+"glUniform3d",
+"glUniform3f",
+"glActiveProgramEXT",
+"glProgramUniform3uiv",
+"glUniform3ui64vARB",
+"glProgramUniform1ui64vARB",
+"glTextureParameterfEXT",
+"glSetFragmentShaderConstantATI",
+"glColorSubTable",
+"glReplacementCodeuiSUN",
+"glStateCaptureNV",
+"glBindAttribLocation",
+"glWeightusvARB",
+"glGetFragDataIndex",
+"glMultiTexCoord2xOES",
+"glColor3sv",
+"glTexCoord2fVertex3fSUN",
+"glGetMemoryObjectParameterivEXT",
+"glPolygonOffsetEXT",
+"glWeightPathsNV",
+"glCombinerStageParameterfvNV",
+"glPointParameterfEXT",
+"glCopyTexImage1DEXT",
+"glVertex4sv",
+"glMatrixMultfEXT",
+"glCompressedTextureSubImage3DEXT",
+"glGetTexLevelParameterxvOES",
+"glVertexAttribL3dvEXT",
+"glMultiTexCoordP4ui",
+"glGetTextureLevelParameterivEXT",
+"glAlphaFragmentOp2ATI",
+"glDeleteFramebuffers",
+"glDrawArrays",
+"glGetTransformFeedbackiv",
+"glGetnTexImageARB",
+"glClear",
+"glVertexArrayParameteriAPPLE",
+"glMultiTexCoord2dvARB",
+"glGetVideoCaptureStreamdvNV",
+"glFragmentLightModelivSGIX",
+"glVertexAttribP2ui",
+"glMultiTexCoordPointerEXT",
+"glProgramUniform3iEXT",
+"glTranslatef",
+"glVertexAttrib4Nub",
+"glTranslated",
+"glSamplerParameterIiv",
+"glTexCoord4hNV",
+"glDrawElementsIndirect",
+"glDeletePerfMonitorsAMD",
+"glIsRenderbufferEXT",
+"glDrawCommandsNV",
+"glUniform3ivARB",
+"glBufferSubData",
+"glSecondaryColor3bv",
+"glMatrixMultTransposedEXT",
+"glRequestResidentProgramsNV",
+"glAlphaFragmentOp1ATI",
+"glGetQueryObjecti64v",
+"glMatrixMult3x3fNV",
+"glColorTableParameteriv",
+"glPathSubCommandsNV",
+"glGetFinalCombinerInputParameterivNV",
+"glIsRenderbuffer",
+"glVertex3iv",
+"glTexGenfv",
+"glFrustumfOES",
+"glBindVertexBuffers",
+"glMateriali",
+"glMultiTexCoord2svARB",
+"glDisableVertexAttribArray",
+"glWindowPos3ivARB",
+"glTexCoordFormatNV",
+"glBlitNamedFramebuffer",
+"glMatrixLoadTransposefEXT",
+"glMultiTexGenfEXT",
+"glShaderStorageBlockBinding",
+"glMaterialf",
+"glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+"glCheckNamedFramebufferStatusEXT",
+"glVertexArrayVertexAttribFormatEXT",
+"glVertex2hNV",
+"glDeleteVertexShaderEXT",
+"glTexImage3DEXT",
+"glSignalVkFenceNV",
+"glProgramLocalParameterI4ivNV",
+"glGlobalAlphaFactoriSUN",
+"glTextureStorage1D",
+"glBinormal3sEXT",
+"glGetProgramInterfaceiv",
+"glMatrixIndexPointerARB",
+"glTexCoordPointerEXT",
+"glMultiTexGeniEXT",
+"glVertexAttrib2fNV",
+"glNamedProgramStringEXT",
+"glMapNamedBuffer",
+"glGetMinmaxParameteriv",
+"glGetnUniformdv",
+"glEndConditionalRenderNVX",
+"glBinormal3fEXT",
+"glNormalStream3iATI",
+"glProgramBufferParametersIivNV",
+"glMapGrid1xOES",
+"glGetVertexAttribPointervARB",
+"glFlushMappedNamedBufferRangeEXT",
+"glGetVertexAttribIiv",
+"glVertexP4uiv",
+"glUniformui64NV",
+"glColor4fv",
+"glTexParameterxvOES",
+"glPatchParameteri",
+"glMap1d",
+"glGetTexFilterFuncSGIS",
+"glVertexStream3dATI",
+"glVertexArrayVertexBindingDivisorEXT",
+"glMultiTexCoord3svARB",
+"glBindProgramNV",
+"glGetConvolutionParameteriv",
+"glGetProgramLocalParameterfvARB",
+"glGenFragmentShadersATI",
+"glTexBumpParameterivATI",
+"glGetNamedFramebufferAttachmentParameteriv",
+"glGetnSeparableFilter",
+"glNormal3xvOES",
+"glPassTexCoordATI",
+"glFramebufferTextureFaceARB",
+"glProgramUniform1dv",
+"glTextureStorage2DEXT",
+"glVertexArrayFogCoordOffsetEXT",
+"glDeleteNamedStringARB",
+"glMulticastGetQueryObjecti64vNV",
+"glGenOcclusionQueriesNV",
+"glLighti",
+"glTexImage1D",
+"glLightf",
+"glClientAttribDefaultEXT",
+"glVertexAttrib4bvARB",
+"glVertexAttribIFormatNV",
+"glStencilFuncSeparate",
+"glGetVertexAttribfvARB",
+"glVertexAttrib2dNV",
+"glProgramUniform2iEXT",
+"glClientActiveVertexStreamATI",
+"glRasterPos3xOES",
+"glGetMapParameterivNV",
+"glSampleCoverage",
+"glClearDepthxOES",
+"glUniformBufferEXT",
+"glTexCoord2fNormal3fVertex3fvSUN",
+"glMulticastGetQueryObjectuivNV",
+"glGetFirstPerfQueryIdINTEL",
+"glUnmapNamedBufferEXT",
+"glGetTransformFeedbacki_v",
+"glUniform4fvARB",
+"glRenderbufferStorageMultisampleCoverageNV",
+"glGetFloati_vEXT",
+"glBindAttribLocationARB",
+"glBufferAddressRangeNV",
+"glGenProgramsARB",
+"glMultiTexEnvivEXT",
+"glSecondaryColor3uiEXT",
+"glCompressedTextureImage2DEXT",
+"glUniform2i",
+"glCopyTexImage2DEXT",
+"glUniform2d",
+"glVertexAttribL1d",
+"glFramebufferTextureFaceEXT",
+"glFramebufferTextureLayer",
+"glMultiTexCoord4bvOES",
+"glGetVertexArrayPointeri_vEXT",
+"glNamedProgramLocalParameter4dEXT",
+"glBinormal3bEXT",
+"glConvolutionFilter2DEXT",
+"glProgramUniform2fv",
+"glColor3fVertex3fSUN",
+"glNormal3fVertex3fvSUN",
+"glCopyMultiTexSubImage3DEXT",
+"glProgramLocalParameterI4iNV",
+"glProgramUniformMatrix2x4dv",
+"glPathMemoryGlyphIndexArrayNV",
+"glDrawArraysEXT",
+"glBlendEquationEXT",
+"glStencilOp",
+"glCopyTextureSubImage2DEXT",
+"glTexEnvf",
+"glVertexAttrib2dvNV",
+"glGenPerfMonitorsAMD",
+"glGetInteger64i_v",
+"glGetHistogramParameterfv",
+"glVertexFormatNV",
+"glBlendFuncIndexedAMD",
+"glTexEnvi",
+"glMultiTexCoord1iv",
+"glIsEnabledi",
+"glVertexAttribL2ui64vNV",
+"glVertexAttribL4i64NV",
+"glMatrixTranslatedEXT",
+"glMakeTextureHandleResidentARB",
+"glMatrixMultdEXT",
+"glBinormal3dvEXT",
+"glImportSyncEXT",
+"glGetMapiv",
+"glImportSemaphoreFdEXT",
+"glMultiTexCoord4sv",
+"glPNTrianglesiATI",
+"glBindVertexArrayAPPLE",
+"glObjectPtrLabel",
+"glGetDebugMessageLog",
+"glTrackMatrixNV",
+"glProgramPathFragmentInputGenNV",
+"glTangent3ivEXT",
+"glGetUniformfv",
+"glSecondaryColor3ubv",
+"glMakeTextureHandleNonResidentNV",
+"glVertexAttribs4ubvNV",
+"glClipPlanexOES",
+"glMultiTexCoord3iv",
+"glGetnPolygonStippleARB",
+"glUniform2i64vNV",
+"glLightModelf",
+"glDeleteMemoryObjectsEXT",
+"glMultiTexSubImage2DEXT",
+"glReplacementCodeuiColor3fVertex3fSUN",
+"glTangent3dvEXT",
+"glLightModeli",
+"glVertexWeighthvNV",
+"glWindowPos3iv",
+"glMultiTexCoordP1uiv",
+"glTransformPathNV",
+"glProgramNamedParameter4dNV",
+"glMultiDrawElementsIndirect",
+"glProgramUniform1dEXT",
+"glCallLists",
+"glNormal3hvNV",
+"glGetCombinerOutputParameterfvNV",
+"glVertexAttrib4sARB",
+"glTexCoord3i",
+"glVertexAttribI3uiv",
+"glPushDebugGroup",
+"glTexCoord3f",
+"glTexCoord3d",
+"glTexCoord2xOES",
+"glGetStageIndexNV",
+"glProgramUniform4i64vNV",
+"glGetNamedBufferPointervEXT",
+"glTextureBarrierNV",
+"glColor4ubVertex3fvSUN",
+"glGetCommandHeaderNV",
+"glGetPerfMonitorCounterInfoAMD",
+"glVertexAttrib1svARB",
+"glCombinerParameteriNV",
+"glMatrixMultTransposefEXT",
+"glDetailTexFuncSGIS",
+"glAreTexturesResident",
+"glProgramUniform2d",
+"glGetConvolutionParameterfvEXT",
+"glIndexPointerListIBM",
+"glVertexAttribI4iEXT",
+"glProgramUniform2f",
+"glRasterPos4sv",
+"glColor4s",
+"glMulticastGetQueryObjectivNV",
+"glColorFragmentOp3ATI",
+"glResizeBuffersMESA",
+"glGetMinmaxParameterfv",
+"glClientActiveTextureARB",
+"glBindVertexArray",
+"glColor4b",
+"glColor4f",
+"glColor4d",
+"glColor4i",
+"glEdgeFlagFormatNV",
+"glNamedBufferSubData",
+"glDrawElementsInstanced",
+"glGetMultiTexParameterIivEXT",
+"glVertex2dv",
+"glDisableVertexArrayAttribEXT",
+"glObjectUnpurgeableAPPLE",
+"glVertexAttribs2dvNV",
+"glReplacementCodeuiTexCoord2fVertex3fSUN",
+"glGetMapParameterfvNV",
+"glProgramUniform4ivEXT",
+"glProgramUniform3ui64vNV",
+"glRectfv",
+"glTexFilterFuncSGIS",
+"glSpriteParameterfvSGIX",
+"glCopyMultiTexImage1DEXT",
+"glGetVertexAttribIuivEXT",
+"glUniformMatrix2x4dv",
+"glGetProgramResourceLocationIndex",
+"glColor3hNV",
+"glViewport",
+"glProgramNamedParameter4fNV",
+"glGetInvariantBooleanvEXT",
+"glTexStorage2DMultisample",
+"glPixelStorex",
+"glVertexAttribL1dvEXT",
+"glGetActiveSubroutineUniformiv",
+"glVertexAttribPointerARB",
+"glCompressedTexSubImage2DARB",
+"glTexStorageMem1DEXT",
+"glVertex2hvNV",
+"glTexBuffer",
+"glArrayElement",
+"glValidateProgram",
+"glPixelStoref",
+"glWindowPos3dARB",
+"glEvalCoord1dv",
+"glVertexAttribs2fvNV",
+"glRecti",
+"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+"glTexCoord1bOES",
+"glProgramUniform2i64vARB",
+"glWindowPos2dARB",
+"glGetProgramParameterdvNV",
+"glRectf",
+"glRectd",
+"glMap1xOES",
+"glVertexAttrib3fvNV",
+"glReferencePlaneSGIX",
+"glMulticastBlitFramebufferNV",
+"glGetCombinerInputParameterfvNV",
+"glGetTextureSamplerHandleARB",
+"glBindTexture",
+"glRects",
+"glGetActiveAttribARB",
+"glHistogramEXT",
+"glGetTextureSamplerHandleNV",
+"glDetachShader",
+"glFinishTextureSUNX",
+"glUniformMatrix3x4dv",
+"glVertexAttrib4fARB",
+"glGetPathColorGenivNV",
+"glGetProgramResourceLocation",
+"glVertexArrayAttribLFormat",
+"glGetTexLevelParameterfv",
+"glVertexArrayVertexAttribOffsetEXT",
+"glIndexFormatNV",
+"glMultiTexCoord3i",
+"glReplacementCodeuiVertex3fvSUN",
+"glViewportIndexedfv",
+"glBindBuffersBase",
+"glTexBumpParameterfvATI",
+"glMatrixIndexuivARB",
+"glVertexAttrib1hNV",
+"glWindowPos3svMESA",
+"glStencilOpSeparateATI",
+"glDrawElementsBaseVertex",
+"glBlendEquationSeparateiARB",
+"glVertexAttrib1fNV",
+"glMapVertexAttrib2fAPPLE",
+"glCompressedTextureSubImage1DEXT",
+"glClearBufferSubData",
+"glTexStorage1D",
+"glVertexAttribI3iEXT",
+"glMakeTextureHandleNonResidentARB",
+"glMultiDrawElementArrayAPPLE",
+"glVertexStream4dATI",
+"glProgramUniformMatrix2dvEXT",
+"glVertexAttribs2hvNV",
+"glGetUniformiv",
+"glClipPlanefOES",
+"glRenderbufferStorage",
+"glUniform4ui",
+"glBindFramebuffer",
+"glValidateProgramARB",
+"glTexGenf",
+"glTexGend",
+"glTexGeni",
+"glDeleteFramebuffersEXT",
+"glResetMinmaxEXT",
+"glVertexAttrib1fvNV",
+"glIsQueryARB",
+"glEnableVariantClientStateEXT",
+"glScissorIndexed",
+"glGetInvariantIntegervEXT",
+"glProgramLocalParameterI4uiNV",
+"glConvolutionParameterxvOES",
+"glGenFramebuffersEXT",
+"glVertexArrayColorOffsetEXT",
+"glMultiTexCoord3ivARB",
+"glVertexWeightfEXT",
+"glRasterPos4dv",
+"glIsTextureHandleResidentARB",
+"glRasterPos2dv",
+"glWindowPos4ivMESA",
+"glGetVariantPointervEXT",
+"glMapNamedBufferRangeEXT",
+"glGetnUniformui64vARB",
+"glCreateShaderProgramv",
+"glGetQueryObjectiv",
+"glMaxShaderCompilerThreadsKHR",
+"glPNTrianglesfATI",
+"glGlobalAlphaFactorusSUN",
+"glVertexAttrib3dvNV",
+"glMultiTexCoord3sARB",
+"glGenerateMipmap",
+"glCompressedTextureSubImage2D",
+"glNamedRenderbufferStorageMultisampleEXT",
+"glPolygonOffsetClampEXT",
+"glTextureRangeAPPLE",
+"glBlendEquationIndexedAMD",
+"glTexCoord2d",
+"glPointParameteri",
+"glTexCoord2f",
+"glGetUnsignedBytei_vEXT",
+"glColor4iv",
+"glMapNamedBufferRange",
+"glUnmapBuffer",
+"glSampleMaskEXT",
+"glTexCoord2i",
+"glTexCoord1xvOES",
+"glVertexAttrib1sARB",
+"glGetVertexArrayiv",
+"glProgramParameter4dvNV",
+"glTexCoord2s",
+"glTextureParameterIuivEXT",
+"glGetColorTableParameterfvSGI",
+"glTexCoord4dv",
+"glVertexAttrib1svNV",
+"glNamedFramebufferTextureFaceEXT",
+"glProgramUniform2ui64vNV",
+"glStencilFillPathNV",
+"glNormal3dv",
+"glReleaseShaderCompiler",
+"glTexStorageMem3DEXT",
+"glTexCoord3bvOES",
+"glIsVertexAttribEnabledAPPLE",
+"glTexCoord1dv",
+"glReadPixels",
+"glVertexAttribI3iv",
+"glSetFenceAPPLE",
+"glWeightsvARB",
+"glShadeModel",
+"glTextureStorageMem3DMultisampleEXT",
+"glMapGrid1d",
+"glGetHistogramParameterivEXT",
+"glConservativeRasterParameteriNV",
+"glClearNamedBufferData",
+"glClearDepthf",
+"glCreatePerfQueryINTEL",
+"glFogCoordfEXT",
+"glVertexAttrib2dARB",
+"glMultiTexCoord4dARB",
+"glReadnPixelsARB",
+"glMultiTexBufferEXT",
+"glWindowPos4dvMESA",
+"glInvalidateNamedFramebufferData",
+"glSecondaryColorPointerListIBM",
+"glRectiv",
+"glColorP4ui",
+"glUseProgramStages",
+"glRasterPos3dv",
+"glPathTexGenNV",
+"glVertexBlendEnviATI",
+"glUniform3i64ARB",
+"glLoadMatrixf",
+"glProgramUniform2dEXT",
+"glVertexAttribI4iv",
+"glNamedFramebufferDrawBuffer",
+"glColor4ubv",
+"glColor3hvNV",
+"glGetMapAttribParameterfvNV",
+"glGetBufferSubData",
+"glGetVertexAttribLdv",
+"glGetnUniformuiv",
+"glGetUniformui64vNV",
+"glNamedRenderbufferStorageEXT",
+"glVertexAttrib3dNV",
+"glTextureStorage1DEXT",
+"glPixelTexGenParameteriSGIS",
+"glColorTableEXT",
+"glGenBuffers",
+"glMultiTexCoord3xvOES",
+"glExecuteProgramNV",
+"glVariantArrayObjectATI",
+"glColor3xvOES",
+"glGetnConvolutionFilterARB",
+"glNormalFormatNV",
+"glGetInvariantFloatvEXT",
+"glClearNamedFramebufferiv",
+"glTexImage3D",
+"glGenSamplers",
+"glIsFramebuffer",
+"glProgramUniform3dvEXT",
+"glGetVertexAttribfvNV",
+"glDrawRangeElementArrayAPPLE",
+"glUniform3i64NV",
+"glMatrixPopEXT",
+"glVertexStream1sATI",
+"glGetnPixelMapuivARB",
+"glMultiTexEnviEXT",
+"glVertexAttribI2iEXT",
+"glProgramParameter4fvNV",
+"glWaitSemaphoreEXT",
+"glNamedFramebufferSampleLocationsfvNV",
+"glTexCoordP4uiv",
+"glRectxvOES",
+"glGetVariantIntegervEXT",
+"glDeleteLists",
+"glTexGendv",
+"glVertexP2uiv",
+"glGetPerfMonitorGroupsAMD",
+"glMultTransposeMatrixfARB",
+"glVertexAttribI2ivEXT",
+"glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+"glDeleteStatesNV",
+"glGetBufferParameteri64v",
+"glProgramUniform4dv",
+"glEdgeFlagPointerEXT",
+"glVideoCaptureStreamParameterivNV",
+"glVertexStream4iATI",
+"glVDPAUFiniNV",
+"glMakeBufferNonResidentNV",
+"glUniform1ui64ARB",
+"glStencilStrokePathNV",
+"glVariantuivEXT",
+"glCopyTexSubImage3DEXT",
+"glSpriteParameteriSGIX",
+"glMultiTexCoord1sARB",
+"glConvolutionParameterfv",
+"glMakeTextureHandleResidentNV",
+"glMultMatrixxOES",
+"glTextureNormalEXT",
+"glGetQueryivARB",
+"glCompressedMultiTexImage3DEXT",
+"glGetInstrumentsSGIX",
+"glProgramUniformMatrix4x3fvEXT",
+"glPointParameterf",
+"glProgramUniform3dEXT",
+"glMultiTexCoord2hNV",
+"glGetConvolutionFilterEXT",
+"glVertexAttrib2hNV",
+"glCurrentPaletteMatrixARB",
+"glFogxvOES",
+"glCreateRenderbuffers",
+"glVertexAttrib4Nusv",
+"glCombinerInputNV",
+"glDepthFunc",
+"glWindowPos4fMESA",
+"glEnableClientStateIndexedEXT",
+"glTexCoord4iv",
+"glProgramUniform4i64ARB",
+"glBlendFunci",
+"glResolveDepthValuesNV",
+"glTextureColorMaskSGIS",
+"glCreateShaderProgramEXT",
+"glBufferStorage",
+"glMakeNamedBufferNonResidentNV",
+"glRenderbufferStorageMultisampleEXT",
+"glGetFloati_v",
+"glUniform2ui64ARB",
+"glVertex3fv",
+"glGetUniformLocation",
+"glVertexStream1svATI",
+"glVertexStream3fATI",
+"glNamedFramebufferDrawBuffers",
+"glUniform2ui64vNV",
+"glTexCoordPointervINTEL",
+"glUniform4fv",
+"glNormalPointerEXT",
+"glVertexAttrib4hNV",
+"glNormal3f",
+"glVertexStream2iATI",
+"glVertexAttribP4uiv",
+"glCompressedTextureSubImage3D",
+"glAsyncMarkerSGIX",
+"glTextureStorageSparseAMD",
+"glGetConvolutionParameterivEXT",
+"glEndPerfQueryINTEL",
+"glFragmentLightModeliSGIX",
+"glPrioritizeTexturesEXT",
+"glEndConditionalRender",
+"glEnableClientState",
+"glResetHistogram",
+"glGetOcclusionQueryivNV",
+"glUniform1uiEXT",
+"glMultiTexCoord2sv",
+"glTexSubImage2DEXT",
+"glProgramUniform2uiv",
+"glMultiTexCoord2iARB",
+"glGetQueryObjectuiv",
+"glGenerateMultiTexMipmapEXT",
+"glVertexAttrib4iv",
+"glWindowPos3dvMESA",
+"glLabelObjectEXT",
+"glProgramUniform1uiv",
+"glFramebufferTexture",
+"glMultiTexEnvfEXT",
+"glGetTexGendv",
+"glVertex4xOES",
+"glVertexAttribI2uivEXT",
+"glNamedProgramLocalParameter4fvEXT",
+"glColor3usv",
+"glGetPixelTransformParameterfvEXT",
+"glIndexxvOES",
+"glDepthMask",
+"glProgramUniformMatrix2x4fv",
+"glAreProgramsResidentNV",
+"glColorTable",
+"glBeginQueryIndexed",
+"glVertexStream1dvATI",
+"glGetMultiTexEnvfvEXT",
+"glDeleteFencesNV",
+"glVertexAttribs1dvNV",
+"glBufferStorageExternalEXT",
+"glVertexStream2sATI",
+"glGetnSeparableFilterARB",
+"glProgramUniform2dv",
+"glActiveStencilFaceEXT",
+"glProgramUniform4dEXT",
+"glPointSizexOES",
+"glRasterPos2sv",
+"glBindParameterEXT",
+"glTexCoord1sv",
+"glBlendParameteriNV",
+"glNamedProgramLocalParameter4dvEXT",
+"glProgramUniformHandleui64NV",
+"glGetTextureParameterfvEXT",
+"glGetPathMetricsNV",
+"glVertex2i",
+"glNewList",
+"glMatrixLoad3x3fNV",
+"glMultiTexCoord2fARB",
+"glWeightdvARB",
+"glIsTransformFeedbackNV",
+"glVertexAttribDivisorARB",
+"glSecondaryColorP3uiv",
+"glGetnCompressedTexImageARB",
+"glGetIntegerv",
+"glMatrixLoaddEXT",
+"glGetPathLengthNV",
+"glProgramUniformMatrix3dv",
+"glUniform4i64NV",
+"glGetHistogramEXT",
+"glVertexAttrib4NuivARB",
+"glMapGrid2xOES",
+"glTexImage2D",
+"glWindowPos2fvARB",
+"glEnableIndexedEXT",
+"glTexCoord1bvOES",
+"glDrawPixels",
+"glMultMatrixd",
+"glMultMatrixf",
+"glReplacementCodePointerSUN",
+"glLoadTransposeMatrixdARB",
+"glVertexAttrib4Nubv",
+"glVertexArrayVertexAttribIOffsetEXT",
+"glCompileShaderARB",
+"glWindowPos3dMESA",
+"glNormalStream3fvATI",
+"glColor4usv",
+"glMapGrid1f",
+"glPolygonStipple",
+"glUniform4ui64ARB",
+"glTextureRenderbufferEXT",
+"glGetSubroutineUniformLocation",
+"glGetFramebufferParameteriv",
+"glPixelMapusv",
+"glGetSamplerParameteriv",
+"glVertexStream2fvATI",
+"glProgramStringARB",
+"glProgramUniformMatrix3dvEXT",
+"glSeparableFilter2D",
+"glVertexAttribI1uiv",
+"glLGPUCopyImageSubDataNVX",
+"glTexStorage2D",
+"glColor3fv",
+"glGetMultiTexGendvEXT",
+"glVertexAttribL4dvEXT",
+"glGetActiveUniform",
+"glUniform2ui64vARB",
+"glMakeNamedBufferResidentNV",
+"glPathGlyphIndexRangeNV",
+"glColorPointer",
+"glProgramEnvParameterI4ivNV",
+"glMulticastGetQueryObjectui64vNV",
+"glMultiTexParameterfEXT",
+"glNamedFramebufferTextureLayer",
+"glGetVertexArrayIntegervEXT",
+"glVertexAttrib3dARB",
+"glVDPAUIsSurfaceNV",
+"glMultiTexImage1DEXT",
+"glIsAsyncMarkerSGIX",
+"glGetDoublei_vEXT",
+"glUniform2i64NV",
+"glIsCommandListNV",
+"glUniform3uiEXT",
+"glTexParameterIuivEXT",
+"glProgramUniformMatrix4fv",
+"glVertex2fv",
+"glVertexAttribL3dEXT",
+"glFramebufferRenderbuffer",
+"glGetUniformLocationARB",
+"glPathParameterfvNV",
+"glVertexAttrib3sNV",
+"glGetDoublei_v",
+"glVertexAttrib1sv",
+"glBindSampler",
+"glLineWidth",
+"glVertexArrayRangeAPPLE",
+"glBindBufferOffsetEXT",
+"glWeightfvARB",
+"glGetIntegeri_v",
+"glGetTransformFeedbackVarying",
+"glProgramLocalParameter4fvARB",
+"glGetTransformFeedbackVaryingNV",
+"glWindowPos2iv",
+"glVertexStream1dATI",
+"glColorFragmentOp2ATI",
+"glFogiv",
+"glGetTextureHandleNV",
+"glLightModeliv",
+"glDepthRangef",
+"glGetFragmentMaterialivSGIX",
+"glVideoCaptureStreamParameterfvNV",
+"glDeleteProgramsARB",
+"glWindowPos3fvARB",
+"glFeedbackBufferxOES",
+"glGetTexBumpParameterfvATI",
+"glEnablei",
+"glGetActiveSubroutineName",
+"glDrawBuffersARB",
+"glBindProgramARB",
+"glEvalCoord1fv",
+"glProgramUniform3ui64vARB",
+"glProgramUniformMatrix2dv",
+"glMultiTexCoord2hvNV",
+"glGetFloatIndexedvEXT",
+"glSampleCoverageARB",
+"glProgramUniform2ui64vARB",
+"glPixelDataRangeNV",
+"glVertexStream3svATI",
+"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+"glTexCoord3hvNV",
+"glSampleMaski",
+"glIndexFuncEXT",
+"glPointParameteriNV",
+"glUniformMatrix3x2fv",
+"glGetFramebufferParameterivEXT",
+"glUniform2i64ARB",
+"glNamedBufferStorageEXT",
+"glNamedFramebufferTexture3DEXT",
+"glVertexAttrib2dv",
+"glGetVertexArrayPointervEXT",
+"glGetVertexAttribArrayObjectivATI",
+"glProgramUniformMatrix3fvEXT",
+"glEnableVertexArrayEXT",
+"glColorTableParameterfvSGI",
+"glEdgeFlag",
+"glFogCoordf",
+"glVertex3d",
+"glVertex3f",
+"glSpriteParameterivSGIX",
+"glPathGlyphRangeNV",
+"glPrimitiveBoundingBoxARB",
+"glVertexAttribL3ui64vNV",
+"glVertex3s",
+"glTexCoordP2ui",
+"glProgramUniform2fvEXT",
+"glDeletePathsNV",
+"glPrimitiveRestartIndexNV",
+"glTexCoord2fColor3fVertex3fvSUN",
+"glTexCoordPointerListIBM",
+"glRectxOES",
+"glCopyNamedBufferSubData",
+"glGenProgramsNV",
+"glFragmentLightfSGIX",
+"glTexStorage3D",
+"glTextureParameteriv",
+"glNamedBufferDataEXT",
+"glImportSemaphoreWin32NameEXT",
+"glMultiTexCoord3fvARB",
+"glUniformMatrix3x4fv",
+"glSubpixelPrecisionBiasNV",
+"glNormalPointer",
+"glNamedFramebufferTexture",
+"glVertexAttrib4NsvARB",
+"glPassThrough",
+"glSecondaryColorP3ui",
+"glInvalidateTexSubImage",
+"glIsImageHandleResidentARB",
+"glTangent3fvEXT",
+"glProgramUniformMatrix4x3fv",
+"glBegin",
+"glEvalCoord2dv",
+"glColor3ubv",
+"glFogCoordfvEXT",
+"glVertexP3ui",
+"glLightfv",
+"glVertexAttribL3i64NV",
+"glStencilClearTagEXT",
+"glGetActiveUniformName",
+"glTangentPointerEXT",
+"glUniform4ui64vNV",
+"glDebugMessageEnableAMD",
+"glProgramUniform2ui",
+"glCopyTexSubImage2DEXT",
+"glGenRenderbuffersEXT",
+"glNamedProgramLocalParameterI4ivEXT",
+"glMultiTexCoord2f",
+"glMapGrid2d",
+"glGetMultiTexParameterIuivEXT",
+"glBlendEquationiARB",
+"glTexParameteriv",
+"glUniform4ivARB",
+"glMatrixOrthoEXT",
+"glVertexArrayVertexBuffer",
+"glProgramLocalParametersI4ivNV",
+"glProgramUniform4ui64vNV",
+"glGetNamedStringivARB",
+"glVertexAttribL1i64vNV",
+"glTransformFeedbackBufferBase",
+"glIndexsv",
+"glPointParameterivNV",
+"glGetDetailTexFuncSGIS",
+"glReplacementCodeuiColor3fVertex3fvSUN",
+"glProgramLocalParameter4fARB",
+"glBitmap",
+"glNamedFramebufferTextureLayerEXT",
+"glMultiTexGenfvEXT",
+"glGetNamedBufferSubData",
+"glStencilFuncSeparateATI",
+"glProgramUniform2iv",
+"glGetQueryiv",
+"glTexCoord4f",
+"glMapGrid2f",
+"glListParameterivSGIX",
+"glCreateQueries",
+"glGetSamplerParameterfv",
+"glTexCoord4i",
+"glObjectLabel",
+"glProgramUniform3i64NV",
+"glGetTextureHandleARB",
+"glTexCoord4s",
+"glUniform4iARB",
+"glGetUniformIndices",
+"glMultiTexImage3DEXT",
+"glCoverageModulationTableNV",
+"glPointParameteriv",
+"glMultiTexCoord4svARB",
+"glNormal3fv",
+"glProgramUniformMatrix3x4dvEXT",
+"glTexCoord1fv",
+"glProgramUniformMatrix4x3dvEXT",
+"glGetActiveVaryingNV",
+"glUniform1i64vARB",
+"glMultiTexCoord1dv",
+"glTexCoord3fv",
+"glMatrixTranslatefEXT",
+"glProgramUniform1ui64vNV",
+"glTextureMaterialEXT",
+"glMultiTexCoordP3uiv",
+"glVertexAttribP3ui",
+"glInterpolatePathsNV",
+"glTextureBufferRange",
+"glVertexAttribL2dEXT",
+"glGetPixelTransformParameterivEXT",
+"glTexCoord4xvOES",
+"glGetVariantBooleanvEXT",
+"glDepthRange",
+"glGetVertexAttribdvARB",
+"glGetColorTableParameterfv",
+"glDrawArraysInstancedEXT",
+"glDisableClientStateIndexedEXT",
+"glDrawBuffer",
+"glMultiDrawArraysIndirectBindlessNV",
+"glGetnPixelMapusv",
+"glRasterPos3fv",
+"glClearBufferuiv",
+"glGetInternalformati64v",
+"glShaderSourceARB",
+"glShaderOp3EXT",
+"glWindowPos2dvMESA",
+"glClearIndex",
+"glProvokingVertexEXT",
+"glVariantubvEXT",
+"glFlush",
+"glFramebufferTexture2DEXT",
+"glGetColorTableParameterivEXT",
+"glPresentFrameDualFillNV",
+"glGenVertexShadersEXT",
+"glSpecializeShaderARB",
+"glProgramUniformHandleui64vARB",
+"glDepthRangefOES",
+"glDeleteVertexArrays",
+"glDrawElementsInstancedBaseVertexBaseInstance",
+"glGetTexLevelParameteriv",
+"glDrawVkImageNV",
+"glWindowPos3iARB",
+"glPrioritizeTextures",
+"glWindowPos3fvMESA",
+"glProgramUniformMatrix3x2dvEXT",
+"glVertex4xvOES",
+"glTexStorage3DMultisample",
+"glWindowPos2sARB",
+"glStencilOpValueAMD",
+"glProgramVertexLimitNV",
+"glGetTexParameterPointervAPPLE",
+"glProgramUniform3uivEXT",
+"glClampColor",
+"glClearStencil",
+"glTexCoordP1uiv",
+"glVertexAttribs3svNV",
+"glMultiTexCoord3fv",
+"glVertexBlendEnvfATI",
+"glIsFenceAPPLE",
+"glGetBufferParameterui64vNV",
+"glVertexAttribI4bvEXT",
+"glUniform2fARB",
+"glStopInstrumentsSGIX",
+"glVertexAttrib3fNV",
+"glMapVertexAttrib2dAPPLE",
+"glVertex2f",
+"glCopyTextureImage2DEXT",
+"glVertex2d",
+"glSecondaryColor3bvEXT",
+"glMultiTexCoord4fARB",
+"glPolygonOffset",
+"glTangent3bvEXT",
+"glHistogram",
+"glGetProgramiv",
+"glMatrixIndexubvARB",
+"glVertex2s",
+"glGetVertexAttribLui64vNV",
+"glGetProgramStringARB",
+"glFlushMappedBufferRange",
+"glVertexAttribI3uiEXT",
+"glLineWidthxOES",
+"glProgramUniformMatrix2fvEXT",
+"glGetTextureParameterIuivEXT",
+"glGetMultiTexEnvivEXT",
+"glPixelTexGenParameterivSGIS",
+"glGenQueries",
+"glGetPixelMapfv",
+"glBlendColorEXT",
+"glResetMinmax",
+"glGetnUniformivARB",
+"glVertexBlendARB",
+"glVertexAttrib4d",
+"glGetVaryingLocationNV",
+"glGetMapAttribParameterivNV",
+"glTexSubImage3D",
+"glDeleteSamplers",
+"glGetLightxOES",
+"glGetVertexAttribArrayObjectfvATI",
+"glVertexArrayNormalOffsetEXT",
+"glGetBufferParameterivARB",
+"glGetTextureParameterfv",
+"glDrawMeshArraysSUN",
+"glVertexAttrib4dNV",
+"glGetMultisamplefvNV",
+"glMapObjectBufferATI",
+"glGetPathCommandsNV",
+"glVertexArrayTexCoordOffsetEXT",
+"glGetHistogram",
+"glMatrixMode",
+"glColorFormatNV",
+"glProgramUniformui64NV",
+"glProgramUniformMatrix4x2fvEXT",
+"glLoadMatrixxOES",
+"glGetColorTableParameterfvEXT",
+"glRasterPos4i",
+"glVertexAttribL2i64NV",
+"glBindTextures",
+"glMatrixRotatefEXT",
+"glGetClipPlanexOES",
+"glSecondaryColor3uivEXT",
+"glGetPerfQueryInfoINTEL",
+"glGetDoublev",
+"glBindBufferRangeEXT",
+"glCompressedTexImage2D",
+"glMapBufferARB",
+"glGetPathSpacingNV",
+"glUniform4dv",
+"glGlobalAlphaFactordSUN",
+"glProgramUniform3dv",
+"glGetShaderSourceARB",
+"glVertexAttrib3dvARB",
+"glInvalidateBufferData",
+"glMatrixLoad3x2fNV",
+"glCompressedTextureSubImage1D",
+"glTexCoord3xvOES",
+"glGenTexturesEXT",
+"glTangent3iEXT",
+"glClearTexImage",
+"glBinormal3bvEXT",
+"glUniform3fv",
+"glGetnPixelMapusvARB",
+"glMemoryObjectParameterivEXT",
+"glGenSemaphoresEXT",
+"glMultiTexCoordP1ui",
+"glClearNamedBufferDataEXT",
+"glUniformMatrix4dv",
+"glWindowPos3fMESA",
+"glDeleteRenderbuffers",
+"glGetTextureLevelParameterfvEXT",
+"glGetHistogramParameterxvOES",
+"glMultiDrawElements",
+"glMakeImageHandleNonResidentNV",
+"glTexSubImage1DEXT",
+"glNormalStream3dATI",
+"glVertexAttribL4i64vNV",
+"glDrawBuffers",
+"glCopyTextureSubImage1DEXT",
+"glWindowRectanglesEXT",
+"glNamedFramebufferReadBuffer",
+"glUniform2i64vARB",
+"glVertexAttribI1uivEXT",
+"glGetTexGenfv",
+"glBeginQueryARB",
+"glUniform1iARB",
+"glVertex4bvOES",
+"glInvalidateSubFramebuffer",
+"glUniform1fvARB",
+"glTestFenceNV",
+"glBindTransformFeedback",
+"glMultiTexCoord2iv",
+"glCopyMultiTexSubImage1DEXT",
+"glVariantbvEXT",
+"glTexCoord1hNV",
+"glGenFencesNV",
+"glRasterPos3iv",
+"glVertexAttribL2ui64NV",
+"glMultiTexCoord1hvNV",
+"glGetnConvolutionFilter",
+"glNormal3bv",
+"glWeightbvARB",
+"glTexCoord4sv",
+"glUniform2uiv",
+"glBeginConditionalRenderNVX",
+"glFinish",
+"glColorTableParameterfv",
+"glFragmentCoverageColorNV",
+"glProgramUniform3ivEXT",
+"glVertexArrayVertexOffsetEXT",
+"glViewportPositionWScaleNV",
+"glGetProgramLocalParameterIuivNV",
+"glReplacementCodeuiTexCoord2fVertex3fvSUN",
+"glUniform1uiv",
+"glUniformMatrix2dv",
+"glIndexdv",
+"glSecondaryColor3ivEXT",
+"glTexCoord3iv",
+"glVertexStream4fvATI",
+"glDeformationMap3fSGIX",
+"glClearDepth",
+"glGenAsyncMarkersSGIX",
+"glDisableIndexedEXT",
+"glVertexWeightfvEXT",
+"glGetProgramLocalParameterIivNV",
+"glCompressedTexImage3DARB",
+"glProgramParameter4fNV",
+"glConvolutionParameterxOES",
+"glInsertComponentEXT",
+"glCreateTextures",
+"glSecondaryColor3iv",
+"glCreateBuffers",
+"glMultiTexCoord2xvOES",
+"glTexGenxvOES",
+"glMultTransposeMatrixf",
+"glBeginTransformFeedbackEXT",
+"glTexCoord2fColor3fVertex3fSUN",
+"glNormal3sv",
+"glFreeObjectBufferATI",
+"glBlendBarrierNV",
+"glUniform4i64vNV",
+"glGetnUniformuivARB",
+"glAlphaFragmentOp3ATI",
+"glProgramEnvParameters4fvEXT",
+"glBlendFuncSeparateEXT",
+"glConvolutionParameterivEXT",
+"glPixelTexGenSGIX",
+"glDeleteProgram",
+"glUniformMatrix4x3dv",
+"glGetVideoCaptureStreamivNV",
+"glProgramUniform4uiEXT",
+"glMakeImageHandleNonResidentARB",
+"glSecondaryColor3dEXT",
+"glDeleteQueries",
+"glNormalP3uiv",
+"glRasterPos2d",
+"glInitNames",
+"glBinormal3fvEXT",
+"glColor3dv",
+"glVertexArrayVertexAttribDivisorEXT",
+"glArrayElementEXT",
+"glProgramParameter4dNV",
+"glIndexxOES",
+"glUniform3uivEXT",
+"glPopGroupMarkerEXT",
+"glClearNamedFramebufferuiv",
+"glSetLocalConstantEXT",
+"glProgramUniform1ui64NV",
+"glColor4hvNV",
+"glGetVertexAttribfv",
+"glDispatchCompute",
+"glGetActiveAttrib",
+"glFragmentColorMaterialSGIX",
+"glTexSubImage2D",
+"glGetnMinmaxARB",
+"glLogicOp",
+"glProgramUniformMatrix3x4fv",
+"glWindowPos4iMESA",
+"glPixelTransferf",
+"glGetTextureParameterIuiv",
+"glMultiTexCoord1xOES",
+"glProgramUniformMatrix4dv",
+"glGetnUniformiv",
+"glFramebufferTexture1DEXT",
+"glVertexPointervINTEL",
+"glTextureParameterIiv",
+"glGetSeparableFilterEXT",
+"glMultiTexCoord3iARB",
+"glRasterPos4xvOES",
+"glDrawTransformFeedbackStream",
+"glVertex3hvNV",
+"glVertexArrayMultiTexCoordOffsetEXT",
+"glProvokingVertex",
+"glAccumxOES",
+"glShaderBinary",
+"glGetMultiTexGenivEXT",
+"glPointParameterxvOES",
+"glCreateStatesNV",
+"glClearDepthdNV",
+"glClearColorIuiEXT",
+"glBindMultiTextureEXT",
+"glTexGeniv",
+"glDrawElements",
+"glProgramUniform4iv",
+"glDisableVertexArrayEXT",
+"glProgramUniform3ui64NV",
+"glClientActiveTexture",
+"glMultiTexParameterIivEXT",
+"glUniform1i64ARB",
+"glUniform1iv",
+"glMulticastBarrierNV",
+"glVertexAttribArrayObjectATI",
+"glUniform2iARB",
+"glDrawArraysInstanced",
+"glVertexAttrib2sNV",
+"glTexBufferEXT",
+"glVertexStream2fATI",
+"glDebugMessageCallbackAMD",
+"glSamplerParameteriv",
+"glVertexAttrib4uiv",
+"glEndQueryIndexed",
+"glNormalStream3sATI",
+"glProgramParameteriARB",
+"glTexEnvxOES",
+"glProgramUniform1iv",
+"glDisableVertexAttribAPPLE",
+"glBindRenderbuffer",
+"glMultiTexSubImage3DEXT",
+"glIsProgram",
+"glMultiDrawElementsIndirectAMD",
+"glGetProgramInfoLog",
+"glGetLocalConstantBooleanvEXT",
+"glPixelTransformParameteriEXT",
+"glTexCoord4bOES",
+"glVertexAttrib4fv",
+"glProgramUniformMatrix2x3dv",
+"glProgramEnvParametersI4uivNV",
+"glTexCoord3xOES",
+"glLoadTransposeMatrixfARB",
+"glImageTransformParameteriHP",
+"glMultiTexCoord4xOES",
+"glVertexAttribs3fvNV",
+"glVertexAttrib2fv",
+"glUniform3ui64NV",
+"glCombinerParameterfvNV",
+"glFragmentMaterialiSGIX",
+"glGetBooleani_v",
+"glGetProgramResourceIndex",
+"glBeginConditionalRenderNV",
+"glDisableClientState",
+"glPathFogGenNV",
+"glStencilThenCoverFillPathNV",
+"glVertexArrayIndexOffsetEXT",
+"glProgramBufferParametersIuivNV",
+"glPixelTransformParameterivEXT",
+"glDisableClientStateiEXT",
+"glTexBufferARB",
+"glGetLocalConstantIntegervEXT",
+"glColor4uiv",
+"glProgramUniform3i",
+"glMultiDrawElementsIndirectBindlessCountNV",
+"glGetBufferPointervARB",
+"glMultiTexParameterIuivEXT",
+"glEvalMesh2",
+"glEvalMesh1",
+"glProgramUniform3f",
+"glStencilThenCoverFillPathInstancedNV",
+"glProgramUniform3d",
+"glMapVertexAttrib1dAPPLE",
+"glEvalCoord2fv",
+"glGetUniformivARB",
+"glLoadTransposeMatrixd",
+"glLoadTransposeMatrixf",
+"glGetPointervEXT",
+"glSignalVkSemaphoreNV",
+"glEndConditionalRenderNV",
+"glTexCoord2fNormal3fVertex3fSUN",
+"glUniform3i64vARB",
+"glProgramUniform2uiEXT",
+"glVertexAttribI1ui",
+"glProgramNamedParameter4dvNV",
+"glCompileCommandListNV",
+"glGetRenderbufferParameterivEXT",
+"glGetnPolygonStipple",
+"glIsBufferResidentNV",
+"glSecondaryColor3ubvEXT",
+"glGetNamedRenderbufferParameterivEXT",
+"glNamedFramebufferSampleLocationsfvARB",
+"glMultiTexGendvEXT",
+"glVertexArrayRangeNV",
+"glIsTextureHandleResidentNV",
+"glGetProgramEnvParameterdvARB",
+"glIsNamedStringARB",
+"glSecondaryColorFormatNV",
+"glVertexAttrib4ubvNV",
+"glTagSampleBufferSGIX",
+"glVDPAUUnregisterSurfaceNV",
+"glGetPerfQueryIdByNameINTEL",
+"glGetInteger64v",
+"glClipPlane",
+"glColor4ubVertex3fSUN",
+"glIndexub",
+"glGetProgramEnvParameterfvARB",
+"glVertexAttrib4usvARB",
+"glNamedFramebufferRenderbuffer",
+"glProgramUniformMatrix3x4dv",
+"glTestFenceAPPLE",
+"glVertexAttrib4Niv",
+"glVertexAttribL2i64vNV",
+"glColorP4uiv",
+"glUniformMatrix2x3fv",
+"glCallCommandListNV",
+"glClearBufferiv",
+"glNamedStringARB",
+"glMatrixMult3x2fNV",
+"glGetNamedProgramStringEXT",
+"glGetnHistogramARB",
+"glGetTextureLevelParameterfv",
+"glMultiTexCoord1fv",
+"glBitmapxOES",
+"glGetSamplerParameterIuiv",
+"glTexCoordP3ui",
+"glTextureSubImage1D",
+"glVertexAttribLPointerEXT",
+"glFogCoordPointerEXT",
+"glWindowPos3s",
+"glVertexAttribs2svNV",
+"glTextureImage3DEXT",
+"glWindowPos3i",
+"glWindowPos3d",
+"glWindowPos3f",
+"glIsEnabledIndexedEXT",
+"glGetNamedProgramivEXT",
+"glVertex3xvOES",
+"glColor3us",
+"glBeginPerfMonitorAMD",
+"glProgramUniformMatrix4x3dv",
+"glGetNamedProgramLocalParameterIuivEXT",
+"glReadnPixels",
+"glMultiTexCoord4f",
+"glColor3ub",
+"glMultiTexCoord4d",
+"glVertexAttribL3ui64NV",
+"glColor3ui",
+"glProgramUniform4fvEXT",
+"glVertexAttrib2sARB",
+"glMultiTexCoord4i",
+"glCheckFramebufferStatusEXT",
+"glGetnMapivARB",
+"glMultiTexCoord1ivARB",
+"glDisableVertexAttribArrayARB",
+"glGetPolygonStipple",
+"glVertexAttribI4ui",
+"glGetPathDashArrayNV",
+"glMultiTexRenderbufferEXT",
+"glCopyTextureSubImage1D",
+"glDeleteOcclusionQueriesNV",
+"glVertex4hvNV",
+"glGetnTexImage",
+"glProgramLocalParameter4dARB",
+"glBlendEquation",
+"glUnlockArraysEXT",
+"glGetQueryObjectui64vEXT",
+"glVertexAttribI4uivEXT",
+"glUniform1i64vNV",
+"glMultiTexCoord3dv",
+"glColor4sv",
+"glVertexStream4ivATI",
+"glPopClientAttrib",
+"glClearBufferData",
+"glGetProgramivNV",
+"glBeginTransformFeedback",
+"glFinishObjectAPPLE",
+"glGetMinmaxParameterivEXT",
+"glColor3iv",
+"glVertexAttrib3sv",
+"glCompressedTexImage1D",
+"glDeleteTransformFeedbacks",
+"glGetVideoi64vNV",
+"glDrawRangeElementsBaseVertex",
+"glUniform4i64vARB",
+"glTextureStorage3DMultisampleEXT",
+"glGetTexParameterfv",
+"glProgramUniformui64vNV",
+"glCompressedMultiTexImage1DEXT",
+"glProgramUniform2ivEXT",
+"glPushGroupMarkerEXT",
+"glVertexAttrib1dv",
+"glMatrixLoadIdentityEXT",
+"glMultTransposeMatrixxOES",
+"glGetPixelMapxv",
+"glFramebufferSampleLocationsfvARB",
+"glGetLightiv",
+"glBlendFuncSeparatei",
+"glAcquireKeyedMutexWin32EXT",
+"glGetBooleanIndexedvEXT",
+"glGetProgramSubroutineParameteruivNV",
+"glUniform2ui",
+"glApplyFramebufferAttachmentCMAAINTEL",
+"glWindowPos2fv",
+"glWaitVkSemaphoreNV",
+"glDisablei",
+"glSelectPerfMonitorCountersAMD",
+"glGetVertexAttribLi64vNV",
+"glBlendFuncSeparateiARB",
+"glWeightuivARB",
+"glWindowPos2iARB",
+"glGetProgramLocalParameterdvARB",
+"glGetUniformui64vARB",
+"glSecondaryColor3us",
+"glGetSynciv",
+"glMakeImageHandleResidentARB",
+"glGetProgramNamedParameterfvNV",
+"glTextureStorage3D",
+"glVertexAttrib4svNV",
+"glProgramUniform2i",
+"glListDrawCommandsStatesClientNV",
+"glProgramLocalParametersI4uivNV",
+"glBeginTransformFeedbackNV",
+"glGetProgramBinary",
+"glBinormal3iEXT",
+"glEvalPoint1",
+"glEvalPoint2",
+"glPauseTransformFeedback",
+"glWindowPos2sMESA",
+"glGlobalAlphaFactorbSUN",
+"glCreateTransformFeedbacks",
+"glTexturePageCommitmentEXT",
+"glTransformFeedbackVaryingsNV",
+"glTexSubImage1D",
+"glConvolutionParameterfvEXT",
+"glBlitFramebufferEXT",
+"glUniformMatrix4fvARB",
+"glProgramEnvParameter4dvARB",
+"glTextureStorageMem2DEXT",
+"glVertexAttribP3uiv",
+"glFogCoordFormatNV",
+"glGetMultiTexLevelParameterivEXT",
+"glIsOcclusionQueryNV",
+"glCompressedTexImage2DARB",
+"glGetProgramEnvParameterIuivNV",
+"glVertexAttrib4sv",
+"glVertexAttrib4fvARB",
+"glLoadName",
+"glBindVertexShaderEXT",
+"glGetNamedProgramLocalParameterIivEXT",
+"glProgramUniform3uiEXT",
+"glProgramUniformMatrix4x2dvEXT",
+"glTexCoord1hvNV",
+"glLoadMatrixd",
+"glTexParameterfv",
+"glVariantdvEXT",
+"glCullParameterfvEXT",
+"glUniform3dv",
+"glProgramUniform3fv",
+"glIsBufferARB",
+"glMultiTexCoord1bOES",
+"glFogCoordhNV",
+"glFramebufferSampleLocationsfvNV",
+"glGenSymbolsEXT",
+"glGetConvolutionFilter",
+"glProgramUniform1fvEXT",
+"glGetNextPerfQueryIdINTEL",
+"glCompressedTexImage1DARB",
+"glBindSamplers",
+"glGetProgramEnvParameterIivNV",
+"glGetQueryObjectui64v",
+"glVertexAttribL4ui64vNV",
+"glGetVideoivNV",
+"glGetTextureImage",
+"glProgramUniform1fv",
+"glUniformMatrix4fv",
+"glColorMask",
+"glBeginFragmentShaderATI",
+"glMultiDrawArraysEXT",
+"glGenNamesAMD",
+"glPathParameteriNV",
+"glCreateCommandListsNV",
+"glDeleteProgramPipelines",
+"glCopyColorSubTableEXT",
+"glVariantsvEXT",
+"glGenProgramPipelines",
+"glVertexArrayEdgeFlagOffsetEXT",
+"glWindowPos2s",
+"glSecondaryColor3iEXT",
+"glWindowPos2i",
+"glWindowPos2f",
+"glWindowPos2d",
+"glUniform4uivEXT",
+"glOrthoxOES",
+"glUniformSubroutinesuiv",
+"glRectdv",
+"glProgramUniform1i64vNV",
+"glVertexAttribI4uiEXT",
+"glSecondaryColor3ubEXT",
+"glCompressedMultiTexSubImage1DEXT",
+"glMultiTexGendEXT",
+"glColorP3uiv",
+"glFogCoordfv",
+"glCompileShader",
+"glTexCoord2hNV",
+"glUniform1uivEXT",
+"glMatrixLoadTransposedEXT",
+"glIndexfv",
+"glGetCompressedTextureImage",
+"glGetUniformuivEXT",
+"glGetnPixelMapfvARB",
+"glFramebufferTextureEXT",
+"glMultiDrawElementsIndirectCount",
+"glVertexAttribIPointer",
+"glMultiTexCoordP3ui",
+"glEvaluateDepthValuesARB",
+"glGetNamedBufferParameteriv",
+"glGetNamedProgramLocalParameterfvEXT",
+"glColor4fNormal3fVertex3fvSUN",
+"glSeparableFilter2DEXT",
+"glTexParameterxOES",
+"glClearAccumxOES",
+"glInvalidateFramebuffer",
+"glWeightubvARB",
+"glVertexAttrib1d",
+"glVertexAttrib1f",
+"glVertex4fv",
+"glClearNamedFramebufferfi",
+"glGetQueryBufferObjectuiv",
+"glClearNamedFramebufferfv",
+"glEndVertexShaderEXT",
+"glVertexAttrib1s",
+"glMultiTexCoord4dvARB",
+"glMultiTexCoord1sv",
+"glUniform1ui64vNV",
+"glGetClipPlanefOES",
+"glRasterPos2s",
+"glWeightivARB",
+"glMultiTexCoord4hvNV",
+"glNormal3hNV",
+"glGetSeparableFilter",
+"glGetPathTexGenivNV",
+"glColor4bv",
+"glRasterPos2f",
+"glNamedBufferPageCommitmentARB",
+"glLoadIdentity",
+"glRasterPos2i",
+"glRasterPos4iv",
+"glMultiTexCoord2fvARB",
+"glUniformMatrix4x3fv",
+"glClearBufferfv",
+"glMultiTexCoord4hNV",
+"glTextureBarrier",
+"glReplacementCodeuivSUN",
+"glDeleteAsyncMarkersSGIX",
+"glTexCoord2bvOES",
+"glEvalCoord2xOES",
+"glGetSharpenTexFuncSGIS",
+"glProgramUniformHandleui64vNV",
+"glIglooInterfaceSGIX",
+"glWindowPos2dvARB",
+"glClearBufferfi",
+"glDrawArraysIndirect",
+"glGenVertexArrays",
+"glGetTransformFeedbacki64_v",
+"glEnableVertexArrayAttrib",
+"glProgramUniformMatrix3x2dv",
+"glVertexStream4fATI",
+"glVertexBindingDivisor",
+"glGetSamplerParameterIiv",
+"glGetCoverageModulationTableNV",
+"glDepthRangedNV",
+"glVertexAttrib3f",
+"glMultiDrawRangeElementArrayAPPLE",
+"glVertexAttribFormatNV",
+"glGetQueryBufferObjecti64v",
+"glGetVertexAttribdv",
+"glGetUniformi64vARB",
+"glAreTexturesResidentEXT",
+"glGetHandleARB",
+"glVideoCaptureStreamParameterdvNV",
+"glMapParameterivNV",
+"glIsVertexArray",
+"glSecondaryColor3sEXT",
+"glGetTexParameterIivEXT",
+"glFrameTerminatorGREMEDY",
+"glBlendBarrierKHR",
+"glVertexAttrib4NubARB",
+"glPrimitiveRestartNV",
+"glVertexAttribL1ui64vARB",
+"glVertexAttribI4ivEXT",
+"glVertexAttribs4svNV",
+"glUniform1ui",
+"glVertexAttrib2fvARB",
+"glVertexAttribI4svEXT",
+"glTextureImage3DMultisampleCoverageNV",
+"glMemoryBarrier",
+"glGetVariantArrayObjectfvATI",
+"glTexCoord4fColor4fNormal3fVertex4fvSUN",
+"glIsProgramARB",
+"glBindImageTextureEXT",
+"glGetFragDataLocation",
+"glMultiTexCoord1svARB",
+"glGetMapxvOES",
+"glTextureStorage2DMultisampleEXT",
+"glGetMaterialfv",
+"glVertexAttrib4NbvARB",
+"glPixelMapuiv",
+"glColorPointerEXT",
+"glEnableClientStateiEXT",
+"glClearTexSubImage",
+"glEvalCoord1xvOES",
+"glDetachObjectARB",
+"glGetTextureParameterIiv",
+"glVariantusvEXT",
+"glCompressedTextureImage3DEXT",
+"glMultiTexCoord1dARB",
+"glGetVertexArrayIntegeri_vEXT",
+"glVertexAttribI4ubv",
+"glPixelTexGenParameterfSGIS",
+"glProgramUniformMatrix4x2dv",
+"glUniform3fARB",
+"glIsShader",
+"glConvolutionParameteriv",
+"glCopyMultiTexSubImage2DEXT",
+"glEnableVertexAttribArrayARB",
+"glMulticastCopyBufferSubDataNV",
+"glEnable",
+"glGetActiveUniformsiv",
+"glGetVertexAttribivARB",
+"glTexCoord4hvNV",
+"glUseProgramObjectARB",
+"glGetAttribLocation",
+"glVertexAttrib4dv",
+"glGetTextureParameteriv",
+"glNamedBufferStorageMemEXT",
+"glPathSubCoordsNV",
+"glMatrixIndexusvARB",
+"glGetVideouivNV",
+"glGetVideoCaptureivNV",
+"glProgramUniform3ui",
+"glVertexAttrib3svARB",
+"glGetNamedBufferParameterivEXT",
+"glMatrixScaledEXT",
+"glProgramUniformMatrix2x3fv",
+"glGetFragmentLightivSGIX",
+"glGetStringi",
+"glWindowPos2svARB",
+"glVertexAttrib2svNV",
+"glWindowPos2ivARB",
+"glGetVertexAttribPointervNV",
+"glPushMatrix",
+"glEdgeFlagPointerListIBM",
+"glGenerateMipmapEXT",
+"glWindowPos3sv",
+"glPathCoordsNV",
+"glProgramUniform1i",
+"glProgramUniform1d",
+"glProgramUniform1f",
+"glProgramParameteriEXT",
+"glCompressedMultiTexImage2DEXT",
+"glProgramUniform3iv",
+"glIndexiv",
+"glMultiTexCoord4xvOES",
+"glEGLImageTargetTexture2DOES",
+"glPixelZoom",
+"glVertex3bvOES",
+"glFramebufferReadBufferEXT",
+"glExtractComponentEXT",
+"glCombinerParameterivNV",
+"glMinmax",
+"glColorP3ui",
+"glPointParameterfvSGIS",
+"glBlendEquationi",
+"glGetFogFuncSGIS",
+"glVertexAttrib4fvNV",
+"glGetnMinmax",
+"glFragmentLightiSGIX",
+"glMultiTexCoord1bvOES",
+"glSecondaryColorPointerEXT",
+"glMultiTexCoordP4uiv",
+"glGetBufferSubDataARB",
+"glSecondaryColor3hNV",
+"glGetPathParameterivNV",
+"glFlushRasterSGIX",
+"glElementPointerATI",
+"glGetAttachedObjectsARB",
+"glUniform4iv",
+"glFogxOES",
+"glSharpenTexFuncSGIS",
+"glClearDepthfOES",
+"glDeleteCommandListsNV",
+"glSpecializeShader",
+"glVertex4hNV",
+"glSecondaryColor3dvEXT",
+"glGenTextures",
+"glTextureStorage2DMultisample",
+"glUniform3ui64vNV",
+"glBlendFuncSeparateIndexedAMD",
+"glMakeBufferResidentNV",
+"glShaderOp2EXT",
+"glGetVertexAttribivNV",
+"glTexParameterIivEXT",
+"glGetPerfQueryDataINTEL",
+"glVertexAttrib4dvARB",
+"glTextureSubImage1DEXT",
+"glGetActiveUniformBlockName",
+"glVertexAttrib2dvARB",
+"glVertexAttribPointer",
+"glDepthBoundsdNV",
+"glDeleteTexturesEXT",
+"glDrawBuffersATI",
+"glLightModelxvOES",
+"glApplyTextureEXT",
+"glGetImageHandleNV",
+"glGetMinmax",
+"glGetFixedvOES",
+"glSamplePatternEXT",
+"glUniform1f",
+"glColor4fNormal3fVertex3fSUN",
+"glFogCoorddvEXT",
+"glCopyTextureImage1DEXT",
+"glFlushMappedBufferRangeAPPLE",
+"glVertex3sv",
+"glFlushStaticDataIBM",
+"glProgramUniform4ui64NV",
+"glRasterPos4xOES",
+"glVertexAttribP1ui",
+"glProgramUniform4dvEXT",
+"glEndTransformFeedbackEXT",
+"glBinormal3dEXT",
+"glGetTextureSubImage",
+"glGetNamedRenderbufferParameteriv",
+"glBindBuffersRange",
+"glFinishAsyncSGIX",
+"glBindFragDataLocationIndexed",
+"glMultiTexCoord2dv",
+"glUniform2iv",
+"glProgramUniform2i64vNV",
+"glFlushVertexArrayRangeAPPLE",
+"glTextureParameterf",
+"glMultiTexCoord3dvARB",
+"glFeedbackBuffer",
+"glDebugMessageInsertARB",
+"glMultiTexCoord2i",
+"glTextureSubImage3D",
+"glFramebufferTexture1D",
+"glGetShaderiv",
+"glMultiTexCoord2d",
+"glArrayObjectATI",
+"glGetPointeri_vEXT",
+"glGetPerfMonitorCountersAMD",
+"glNamedBufferStorage",
+"glTexEnvxvOES",
+"glProgramUniform2ui64NV",
+"glMultiTexCoord3bOES",
+"glUniform1dv",
+"glPixelTransferi",
+"glSecondaryColor3usvEXT",
+"glProgramEnvParameterI4uivNV",
+"glVertex2sv",
+"glWindowPos4dMESA",
+"glDebugMessageControlARB",
+"glIsTextureEXT",
+"glFragmentMaterialivSGIX",
+"glLinkProgramARB",
+"glFinishFenceAPPLE",
+"glVertexArrayVertexAttribBindingEXT",
+"glTexStorageMem3DMultisampleEXT",
+"glUniform1ui64vARB",
+"glMultiTexCoord4fv",
+"glMulticastFramebufferSampleLocationsfvNV",
+"glRasterPos3d",
+"glPollAsyncSGIX",
+"glRasterPos3f",
+"glCompressedTexImage3D",
+"glVariantivEXT",
+"glUnmapTexture2DINTEL",
+"glMulticastWaitSyncNV",
+"glGetVertexAttribiv",
+"glGetPathCoordsNV",
+"glColor4xvOES",
+"glVertexAttrib3fv",
+"glRasterPos3s",
+"glVertex4bOES",
+"glTransformFeedbackVaryingsEXT",
+"glCombinerOutputNV",
+"glWindowPos4sMESA",
+"glVertexAttrib4svARB",
+"glIsList",
+"glGetInfoLogARB",
+"glUniformMatrix2fv",
+"glVertexAttribs3dvNV",
+"glGlobalAlphaFactorsSUN",
+"glGetTrackMatrixivNV",
+"glTextureParameterfvEXT",
+"glIsNamedBufferResidentNV",
+"glProgramUniform4ui64vARB",
+"glTbufferMask3DFX",
+"glCoverFillPathNV",
+"glVertexAttrib1fvARB",
+"glGenerateTextureMipmap",
+"glNamedProgramLocalParameterI4uivEXT",
+"glMultiDrawElementsBaseVertex",
+"glProgramSubroutineParametersuivNV",
+"glProgramUniformMatrix2x4dvEXT",
+"glRotatexOES",
+"glMemoryBarrierEXT",
+"glVertexAttrib3svNV",
+"glVertexStream3iATI",
+"glCompressedTexSubImage1D",
+"glSetFenceNV",
+"glAttachObjectARB",
+"glCopyConvolutionFilter1D",
+"glTexStorageMem2DMultisampleEXT",
+"glProgramParameters4fvNV",
+"glNamedFramebufferParameteriEXT",
+"glVertexAttrib4Nsv",
+"glVertexAttribI4usvEXT",
+"glTextureBufferRangeEXT",
+"glVertexP3uiv",
+"glIsPathNV",
+"glGetnUniformi64vARB",
+"glFramebufferTextureMultiviewOVR",
+"glCompressedMultiTexSubImage2DEXT",
+"glGetnMapdv",
+"glDebugMessageCallback",
+"glTangent3svEXT",
+"glVertexAttribParameteriAMD",
+"glBufferSubDataARB",
+"glGetVertexAttribLui64vARB",
+"glVertexAttribL4ui64NV",
+"glReplacementCodeuiColor4ubVertex3fSUN",
+"glImageTransformParameterfHP",
+"glMap1f",
+"glRasterPos4fv",
+"glVertex2bvOES",
+"glGetMapControlPointsNV",
+"glNamedProgramLocalParametersI4ivEXT",
+"glBindBufferRangeNV",
+"glVertexStream3dvATI",
+"glNormalPointerListIBM",
+"glFogFuncSGIS",
+"glMultiModeDrawArraysIBM",
+"glGetNamedFramebufferAttachmentParameterivEXT",
+"glGetFloatv",
+"glVertexArrayVertexAttribIFormatEXT",
+"glHint",
+"glVertexStream2svATI",
+"glMultiDrawArraysIndirect",
+"glMultiTexEnvfvEXT",
+"glVertexAttribP2uiv",
+"glProgramUniform1i64vARB",
+"glFramebufferTextureARB",
+"glPushClientAttribDefaultEXT",
+"glScalef",
+"glScaled",
+"glGetConvolutionParameterxvOES",
+"glGetProgramResourceName",
+"glCopyColorTable",
+"glDepthRangeArrayv",
+"glCoverFillPathInstancedNV",
+"glMultiTexParameterivEXT",
+"glGetActiveAtomicCounterBufferiv",
+"glStencilOpSeparate",
+"glVertexAttrib4fNV",
+"glGetColorTableParameterivSGI",
+"glVertexArrayAttribBinding",
+"glIsSemaphoreEXT",
+"glProgramParameters4dvNV",
+"glVertexAttribL4dv",
+"glGetTexParameteriv",
+"glGetUniformOffsetEXT",
+"glGetVertexAttribPointerv",
+"glResumeTransformFeedbackNV",
+"glProgramUniform3i64vNV",
+"glTangent3fEXT",
+"glGetPathMetricRangeNV",
+"glWindowPos2iMESA",
+"glVertex2xvOES",
+"glGetnCompressedTexImage",
+"glWindowPos2dv",
+"glReplacementCodeuiVertex3fSUN",
+"glGetTransformFeedbackVaryingEXT",
+"glWindowPos3fARB",
+"glMapNamedBufferEXT",
+"glDisable",
+"glIsPointInFillPathNV",
+"glVertexAttribI2uiEXT",
+"glProgramUniform4uiv",
+"glQueryCounter",
+"glFramebufferRenderbufferEXT",
+"glBinormal3svEXT",
+"glBindBufferOffsetNV",
+"glCopyTextureSubImage2D",
+"glGetProgramResourcefvNV",
+"glBinormalPointerEXT",
+"glGetLightfv",
+"glMulticastCopyImageSubDataNV",
+"glVertex2bOES",
+"glUniform2ivARB",
+"glMultiTexCoord3s",
+"glGetHistogramParameterfvEXT",
+"glGetProgramStringNV",
+"glGetTexGenxvOES",
+"glTextureSubImage2D",
+"glObjectPurgeableAPPLE",
+"glColorTableSGI",
+"glCopyConvolutionFilter2DEXT",
+"glMultiTexCoord3f",
+"glMultiTexCoord3d",
+"glFogCoorddv",
+"glGetBufferPointerv",
+"glProgramUniform1fEXT",
+"glWindowPos2fvMESA",
+"glAlphaToCoverageDitherControlNV",
+"glPolygonOffsetxOES",
+"glVertexAttrib4dARB",
+"glUniformHandleui64vARB",
+"glFragmentLightModelfvSGIX",
+"glSwizzleEXT",
+"glBindFragmentShaderATI",
+"glVertexAttribs3hvNV",
+"glGenBuffersARB",
+"glTextureStorageMem2DMultisampleEXT",
+"glListParameterfvSGIX",
+"glNamedRenderbufferStorageMultisample",
+"glVertexAttribI1iEXT",
+"glMultiTexCoord2ivARB",
+"glLightModelxOES",
+"glColor3xOES",
+"glReadBuffer",
+"glStencilFillPathInstancedNV",
+"glVDPAUUnmapSurfacesNV",
+"glProgramUniform4i64NV",
+"glVertexStream4dvATI",
+"glIsQuery",
+"glProgramUniformMatrix4fvEXT",
+"glVertexAttrib3hNV",
+"glFlushMappedNamedBufferRange",
+"glPushName",
+"glGetClipPlane",
+"glVertex4dv",
+"glVertexAttrib3d",
+"glBlendColor",
+"glBindTransformFeedbackNV",
+"glSamplerParameterIuiv",
+"glIndexubv",
+"glNamedBufferPageCommitmentEXT",
+"glCheckNamedFramebufferStatus",
+"glGetObjectBufferfvATI",
+"glRasterPos4d",
+"glRasterPos4f",
+"glGetPerfMonitorCounterStringAMD",
+"glVertexAttrib3s",
+"glDrawElementsInstancedEXT",
+"glNamedProgramLocalParameterI4iEXT",
+"glRasterPos4s",
+"glGetProgramStageiv",
+"glGetMaterialxOES",
+"glPopMatrix",
+"glGetVideoui64vNV",
+"glTangent3bEXT",
+"glGetGraphicsResetStatusARB",
+"glUniform4i",
+"glActiveTexture",
+"glEnableVertexAttribArray",
+"glTexCoord4fVertex4fvSUN",
+"glUniform4d",
+"glUniform4f",
+"glRenderbufferStorageMultisample",
+"glCreateProgramPipelines",
+"glVertexAttribLPointer",
+"glUniform2uiEXT",
+"glMultiTexCoord3sv",
+"glDrawElementsInstancedBaseVertex",
+"glPixelTransformParameterfvEXT",
+"glDrawTransformFeedbackNV",
+"glTextureImage2DMultisampleCoverageNV",
+"glNamedRenderbufferStorageMultisampleCoverageEXT",
+"glIsTexture",
+"glMultiTexCoord4iv",
+"glTexEnvfv",
+"glPopDebugGroup",
+"glUniformBlockBinding",
+"glWindowPos2svMESA",
+"glGenerateTextureMipmapEXT",
+"glBindLightParameterEXT",
+"glTexCoord3bOES",
+"glTexCoordPointer",
+"glProgramUniformMatrix3x2fv",
+"glUniform2fvARB",
+"glProgramLocalParameterI4uivNV",
+"glFlushVertexArrayRangeNV",
+"glSecondaryColor3svEXT",
+"glGetBufferParameteriv",
+"glGetQueryIndexediv",
+"glFramebufferTexture3DEXT",
+"glLoadTransposeMatrixxOES",
+"glDeleteTransformFeedbacksNV",
+"glGetCompressedTextureImageEXT",
+"glIndexMaterialEXT",
+"glFogCoorddEXT",
+"glTexCoord2hvNV",
+"glGetFramebufferParameterfvAMD",
+"glTexEnviv",
+"glEndTransformFeedbackNV",
+"glGlobalAlphaFactoruiSUN",
+"glSelectBuffer",
+"glNamedBufferSubDataEXT",
+"glDisableVertexArrayAttrib",
+"glBlendFunc",
+"glCreateProgram",
+"glVertexStream2dATI",
+"glUniform4ui64vARB",
+"glGetSemaphoreParameterui64vEXT",
+"glPrimitiveRestartIndex",
+"glNormalStream3fATI",
+"glProgramUniformMatrix2fv",
+"glVertexAttribs1hvNV",
+"glWindowPos4svMESA",
+"glDeleteFragmentShaderATI",
+"glBindImageTextures",
+"glMap2xOES",
+"glEnd",
+"glMultiTexCoord2dARB",
+"glUniform1i64NV",
+"glPathStringNV",
+"glGetNamedFramebufferParameterivEXT",
+"glGetProgramNamedParameterdvNV",
+"glPathDashArrayNV",
+"glUniform3uiv",
+"glColor3fVertex3fvSUN",
+"glMultTransposeMatrixd",
+"glClearColor",
+"glGetImageHandleARB",
+"glTangent3dEXT",
+"glGetQueryObjectivARB",
+"glGetLocalConstantFloatvEXT",
+"glUseShaderProgramEXT",
+"glBindRenderbufferEXT",
+"glInterleavedArrays",
+"glGetPerfMonitorGroupStringAMD",
+"glUniform3ui",
+"glGetNamedProgramLocalParameterdvEXT",
+"glDeleteQueryResourceTagNV",
+"glVertexAttribI4uiv",
+"glVertexAttrib4bv",
+"glMultiTexCoord3xOES",
+"glSecondaryColor3ub",
+"glFragmentMaterialfSGIX",
+"glGetVariantArrayObjectivATI",
+"glSecondaryColor3ui",
+"glVertexAttrib1dARB",
+"glGetNamedBufferPointerv",
+"glLockArraysEXT",
+"glVertexAttribPointerNV",
+"glConvolutionParameterf",
+"glBindBufferBaseEXT",
+"glTexCoord2xvOES",
+"glGetQueryBufferObjectui64v",
+"glSetMultisamplefvAMD",
+"glPathColorGenNV",
+"glVertexAttrib3sARB",
+"glVertexAttrib4ivARB",
+"glGenTransformFeedbacks",
+"glGetVertexAttribIuiv",
+"glPixelTransformParameterfEXT",
+"glGetTexParameterIuivEXT",
+"glGetObjectParameterivARB",
+"glVertexArraySecondaryColorOffsetEXT",
+"glWindowPos2fARB",
+"glCompressedTexSubImage2D",
+"glCompressedTexSubImage3DARB",
+"glProgramBinary",
+"glPresentFrameKeyedNV",
+"glVertexAttribI4bv",
+"glPathCoverDepthFuncNV",
+"glTransformFeedbackStreamAttribsNV",
+"glSecondaryColor3usEXT",
+"glCopyColorTableSGI",
+"glProgramEnvParameter4fvARB",
+"glMultiTexCoord4sARB",
+"glGetVertexArrayIndexed64iv",
+"glMatrixMultTranspose3x3fNV",
+"glTexParameterIiv",
+"glVertexArrayAttribFormat",
+"glEndTransformFeedback",
+"glDrawCommandsStatesAddressNV",
+"glUniform4ui64NV",
+"glMaterialiv",
+"glTexImage2DMultisample",
+"glBindTextureEXT",
+"glIsBuffer",
+"glVertexAttribI1iv",
+"glGetFinalCombinerInputParameterfvNV",
+"glMultiTexCoord3bvOES",
+"glVertexAttribDivisor",
+"glCopyBufferSubData",
+"glBindTexGenParameterEXT",
+"glNormalStream3bATI",
+"glTexStorageMem2DEXT",
+"glTextureImage2DEXT",
+"glGetColorTableParameteriv",
+"glActiveTextureARB",
+"glTexCoord4xOES",
+"glNamedBufferStorageExternalEXT",
+"glSecondaryColor3fvEXT",
+"glUniformMatrix4x2fv",
+"glStartInstrumentsSGIX",
+"glProgramNamedParameter4fvNV",
+"glEndVideoCaptureNV",
+"glGenLists",
+"glUniform1fARB",
+"glNamedFramebufferTexture1DEXT",
+"glMapBufferRange",
+"glMultiDrawElementsIndirectCountARB",
+"glProgramUniformMatrix4x2fv",
+"glGetTextureParameterIivEXT",
+"glMultiTexCoord3hNV",
+"glNamedProgramLocalParametersI4uivEXT",
+"glEndList",
+"glTexCoord2fColor4fNormal3fVertex3fSUN",
+"glGenTransformFeedbacksNV",
+"glEdgeFlagv",
+"glVertexAttribI2iv",
+"glCopyMultiTexImage2DEXT",
+"glUniformMatrix3x2dv",
+"glTexImage3DMultisampleCoverageNV",
+"glGetShaderPrecisionFormat",
+"glTexSubImage4DSGIS",
+"glRasterSamplesEXT",
+"glTextureView",
+"glEvalMapsNV",
+"glGetFragDataLocationEXT",
+"glGetCompressedMultiTexImageEXT",
+"glIndexMask",
+"glPushClientAttrib",
+"glShaderSource",
+"glDispatchComputeGroupSizeARB",
+"glLGPUNamedBufferSubDataNVX",
+"glGetnPixelMapfv",
+"glTexCoordP2uiv",
+"glUniform2f",
+"glGetNamedBufferParameteri64v",
+"glCommandListSegmentsNV",
+"glTextureParameterIivEXT",
+"glMultiTexParameterfvEXT",
+"glProgramUniform2ui64ARB",
+"glVertex4d",
+"glNewObjectBufferATI",
+"glViewportSwizzleNV",
+"glBufferData",
+"glTextureImage1DEXT",
+"glGetTexParameterIiv",
+"glCopyTexSubImage1DEXT",
+"glVertex4f",
+"glUniformMatrix3fvARB",
+"glTexCoordP1ui",
+"glPointParameterfvEXT",
+"glUniform4fARB",
+"glImportMemoryFdEXT",
+"glCopyTextureSubImage3D",
+"glMultiTexCoord2fv",
+"glNamedFramebufferSamplePositionsfvAMD",
+"glNormalP3ui",
+"glDrawRangeElementArrayATI",
+"glVertexAttribI1i",
+"glDrawArraysInstancedARB",
+"glEnableVertexAttribAPPLE",
+"glGetDebugMessageLogARB",
+"glGetPathTexGenfvNV",
+"glNamedProgramLocalParameters4fvEXT",
+"glQueryResourceTagNV",
+"glVertexStream3fvATI",
+"glFramebufferTexture3D",
+"glCompressedTextureSubImage2DEXT",
+"glWindowPos3dv",
+"glCopyConvolutionFilter2D",
+"glReadInstrumentsSGIX",
+"glProgramUniform2dvEXT",
+"glSamplerParameterfv",
+"glBindBufferARB",
+"glVertexAttrib1sNV",
+"glGetMaterialiv",
+"glUniform1fv",
+"glBeginOcclusionQueryNV",
+"glGenFencesAPPLE",
+"glScissorIndexedv",
+"glDisableVariantClientStateEXT",
+"glMinmaxEXT",
+"glNormalPointervINTEL",
+"glNormal3s",
+"glGetnPixelMapuiv",
+"glNormalStream3bvATI",
+"glGetObjectParameterivAPPLE",
+"glNormal3i",
+"glUniform1ivARB",
+"glNormal3d",
+"glUpdateObjectBufferATI",
+"glNormal3b",
+"glGetUniformBufferSizeEXT",
+"glMultiTexCoord4dv",
+"glProgramUniform3i64ARB",
+"glVertexAttrib2d",
+"glVertexAttrib2f",
+"glMultiDrawElementsEXT",
+"glVertexAttrib3dv",
+"glMultiTexCoord2bOES",
+"glVertexAttrib2s",
+"glTexImage3DMultisample",
+"glGetUniformBlockIndex",
+"glReleaseKeyedMutexWin32EXT",
+"glFrontFace",
+"glEvalCoord1xOES",
+"glDrawArraysInstancedBaseInstance",
+"glIsPointInStrokePathNV",
@@ -0,0 +1,2926 @@
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV){this->m_next_glMultiDrawArraysIndirectBindlessCountNV = this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV;this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_profile;}
+if(this->m_ptr_glTextureParameterfv){this->m_next_glTextureParameterfv = this->m_ptr_glTextureParameterfv;this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&ProfileTableDecorator::m_glTextureParameterfv_profile;}
+if(this->m_ptr_glGetListParameterivSGIX){this->m_next_glGetListParameterivSGIX = this->m_ptr_glGetListParameterivSGIX;this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&ProfileTableDecorator::m_glGetListParameterivSGIX_profile;}
+if(this->m_ptr_glProgramUniform1i64ARB){this->m_next_glProgramUniform1i64ARB = this->m_ptr_glProgramUniform1i64ARB;this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&ProfileTableDecorator::m_glProgramUniform1i64ARB_profile;}
+if(this->m_ptr_glVertexArrayElementBuffer){this->m_next_glVertexArrayElementBuffer = this->m_ptr_glVertexArrayElementBuffer;this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&ProfileTableDecorator::m_glVertexArrayElementBuffer_profile;}
+if(this->m_ptr_glHintPGI){this->m_next_glHintPGI = this->m_ptr_glHintPGI;this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&ProfileTableDecorator::m_glHintPGI_profile;}
+if(this->m_ptr_glStencilMaskSeparate){this->m_next_glStencilMaskSeparate = this->m_ptr_glStencilMaskSeparate;this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&ProfileTableDecorator::m_glStencilMaskSeparate_profile;}
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT){this->m_next_glGetFramebufferAttachmentParameterivEXT = this->m_ptr_glGetFramebufferAttachmentParameterivEXT;this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_profile;}
+if(this->m_ptr_glTextureStorage3DMultisample){this->m_next_glTextureStorage3DMultisample = this->m_ptr_glTextureStorage3DMultisample;this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTextureStorage3DMultisample_profile;}
+if(this->m_ptr_glGetIntegerIndexedvEXT){this->m_next_glGetIntegerIndexedvEXT = this->m_ptr_glGetIntegerIndexedvEXT;this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&ProfileTableDecorator::m_glGetIntegerIndexedvEXT_profile;}
+if(this->m_ptr_glCopyTexImage1D){this->m_next_glCopyTexImage1D = this->m_ptr_glCopyTexImage1D;this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&ProfileTableDecorator::m_glCopyTexImage1D_profile;}
+if(this->m_ptr_glVertexAttrib4usv){this->m_next_glVertexAttrib4usv = this->m_ptr_glVertexAttrib4usv;this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&ProfileTableDecorator::m_glVertexAttrib4usv_profile;}
+if(this->m_ptr_glTexRenderbufferNV){this->m_next_glTexRenderbufferNV = this->m_ptr_glTexRenderbufferNV;this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&ProfileTableDecorator::m_glTexRenderbufferNV_profile;}
+if(this->m_ptr_glVertexAttrib3hvNV){this->m_next_glVertexAttrib3hvNV = this->m_ptr_glVertexAttrib3hvNV;this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&ProfileTableDecorator::m_glVertexAttrib3hvNV_profile;}
+if(this->m_ptr_glProgramUniform4ui64ARB){this->m_next_glProgramUniform4ui64ARB = this->m_ptr_glProgramUniform4ui64ARB;this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&ProfileTableDecorator::m_glProgramUniform4ui64ARB_profile;}
+if(this->m_ptr_glInstrumentsBufferSGIX){this->m_next_glInstrumentsBufferSGIX = this->m_ptr_glInstrumentsBufferSGIX;this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&ProfileTableDecorator::m_glInstrumentsBufferSGIX_profile;}
+if(this->m_ptr_glIndexi){this->m_next_glIndexi = this->m_ptr_glIndexi;this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&ProfileTableDecorator::m_glIndexi_profile;}
+if(this->m_ptr_glMultiTexCoord2sARB){this->m_next_glMultiTexCoord2sARB = this->m_ptr_glMultiTexCoord2sARB;this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2sARB_profile;}
+if(this->m_ptr_glProgramEnvParameter4fARB){this->m_next_glProgramEnvParameter4fARB = this->m_ptr_glProgramEnvParameter4fARB;this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&ProfileTableDecorator::m_glProgramEnvParameter4fARB_profile;}
+if(this->m_ptr_glCompressedTexSubImage3D){this->m_next_glCompressedTexSubImage3D = this->m_ptr_glCompressedTexSubImage3D;this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&ProfileTableDecorator::m_glCompressedTexSubImage3D_profile;}
+if(this->m_ptr_glEvalCoord2d){this->m_next_glEvalCoord2d = this->m_ptr_glEvalCoord2d;this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&ProfileTableDecorator::m_glEvalCoord2d_profile;}
+if(this->m_ptr_glEvalCoord2f){this->m_next_glEvalCoord2f = this->m_ptr_glEvalCoord2f;this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&ProfileTableDecorator::m_glEvalCoord2f_profile;}
+if(this->m_ptr_glIndexd){this->m_next_glIndexd = this->m_ptr_glIndexd;this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&ProfileTableDecorator::m_glIndexd_profile;}
+if(this->m_ptr_glSecondaryColor3hvNV){this->m_next_glSecondaryColor3hvNV = this->m_ptr_glSecondaryColor3hvNV;this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&ProfileTableDecorator::m_glSecondaryColor3hvNV_profile;}
+if(this->m_ptr_glIndexf){this->m_next_glIndexf = this->m_ptr_glIndexf;this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&ProfileTableDecorator::m_glIndexf_profile;}
+if(this->m_ptr_glFrustumxOES){this->m_next_glFrustumxOES = this->m_ptr_glFrustumxOES;this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&ProfileTableDecorator::m_glFrustumxOES_profile;}
+if(this->m_ptr_glTextureStorage3DEXT){this->m_next_glTextureStorage3DEXT = this->m_ptr_glTextureStorage3DEXT;this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&ProfileTableDecorator::m_glTextureStorage3DEXT_profile;}
+if(this->m_ptr_glDrawCommandsStatesNV){this->m_next_glDrawCommandsStatesNV = this->m_ptr_glDrawCommandsStatesNV;this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&ProfileTableDecorator::m_glDrawCommandsStatesNV_profile;}
+if(this->m_ptr_glUniform4uiEXT){this->m_next_glUniform4uiEXT = this->m_ptr_glUniform4uiEXT;this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&ProfileTableDecorator::m_glUniform4uiEXT_profile;}
+if(this->m_ptr_glProgramUniform3ui64ARB){this->m_next_glProgramUniform3ui64ARB = this->m_ptr_glProgramUniform3ui64ARB;this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&ProfileTableDecorator::m_glProgramUniform3ui64ARB_profile;}
+if(this->m_ptr_glIndexs){this->m_next_glIndexs = this->m_ptr_glIndexs;this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&ProfileTableDecorator::m_glIndexs_profile;}
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT){this->m_next_glVertexArrayBindVertexBufferEXT = this->m_ptr_glVertexArrayBindVertexBufferEXT;this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&ProfileTableDecorator::m_glVertexArrayBindVertexBufferEXT_profile;}
+if(this->m_ptr_glConvolutionParameteriEXT){this->m_next_glConvolutionParameteriEXT = this->m_ptr_glConvolutionParameteriEXT;this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&ProfileTableDecorator::m_glConvolutionParameteriEXT_profile;}
+if(this->m_ptr_glColor4ubVertex2fSUN){this->m_next_glColor4ubVertex2fSUN = this->m_ptr_glColor4ubVertex2fSUN;this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&ProfileTableDecorator::m_glColor4ubVertex2fSUN_profile;}
+if(this->m_ptr_glProgramUniform1ivEXT){this->m_next_glProgramUniform1ivEXT = this->m_ptr_glProgramUniform1ivEXT;this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&ProfileTableDecorator::m_glProgramUniform1ivEXT_profile;}
+if(this->m_ptr_glGetnMapfv){this->m_next_glGetnMapfv = this->m_ptr_glGetnMapfv;this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&ProfileTableDecorator::m_glGetnMapfv_profile;}
+if(this->m_ptr_glTransformFeedbackBufferRange){this->m_next_glTransformFeedbackBufferRange = this->m_ptr_glTransformFeedbackBufferRange;this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&ProfileTableDecorator::m_glTransformFeedbackBufferRange_profile;}
+if(this->m_ptr_glPathGlyphsNV){this->m_next_glPathGlyphsNV = this->m_ptr_glPathGlyphsNV;this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&ProfileTableDecorator::m_glPathGlyphsNV_profile;}
+if(this->m_ptr_glSecondaryColor3fv){this->m_next_glSecondaryColor3fv = this->m_ptr_glSecondaryColor3fv;this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&ProfileTableDecorator::m_glSecondaryColor3fv_profile;}
+if(this->m_ptr_glGetCombinerInputParameterivNV){this->m_next_glGetCombinerInputParameterivNV = this->m_ptr_glGetCombinerInputParameterivNV;this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetCombinerInputParameterivNV_profile;}
+if(this->m_ptr_glEndPerfMonitorAMD){this->m_next_glEndPerfMonitorAMD = this->m_ptr_glEndPerfMonitorAMD;this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&ProfileTableDecorator::m_glEndPerfMonitorAMD_profile;}
+if(this->m_ptr_glPointParameterfvARB){this->m_next_glPointParameterfvARB = this->m_ptr_glPointParameterfvARB;this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&ProfileTableDecorator::m_glPointParameterfvARB_profile;}
+if(this->m_ptr_glVertex2xOES){this->m_next_glVertex2xOES = this->m_ptr_glVertex2xOES;this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&ProfileTableDecorator::m_glVertex2xOES_profile;}
+if(this->m_ptr_glDrawElementsInstancedBaseInstance){this->m_next_glDrawElementsInstancedBaseInstance = this->m_ptr_glDrawElementsInstancedBaseInstance;this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&ProfileTableDecorator::m_glDrawElementsInstancedBaseInstance_profile;}
+if(this->m_ptr_glMultTransposeMatrixdARB){this->m_next_glMultTransposeMatrixdARB = this->m_ptr_glMultTransposeMatrixdARB;this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&ProfileTableDecorator::m_glMultTransposeMatrixdARB_profile;}
+if(this->m_ptr_glVertexAttribL4dEXT){this->m_next_glVertexAttribL4dEXT = this->m_ptr_glVertexAttribL4dEXT;this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&ProfileTableDecorator::m_glVertexAttribL4dEXT_profile;}
+if(this->m_ptr_glVertex4iv){this->m_next_glVertex4iv = this->m_ptr_glVertex4iv;this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&ProfileTableDecorator::m_glVertex4iv_profile;}
+if(this->m_ptr_glCoverStrokePathInstancedNV){this->m_next_glCoverStrokePathInstancedNV = this->m_ptr_glCoverStrokePathInstancedNV;this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glCoverStrokePathInstancedNV_profile;}
+if(this->m_ptr_glDeformSGIX){this->m_next_glDeformSGIX = this->m_ptr_glDeformSGIX;this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&ProfileTableDecorator::m_glDeformSGIX_profile;}
+if(this->m_ptr_glUniform2ui64NV){this->m_next_glUniform2ui64NV = this->m_ptr_glUniform2ui64NV;this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&ProfileTableDecorator::m_glUniform2ui64NV_profile;}
+if(this->m_ptr_glCopyPathNV){this->m_next_glCopyPathNV = this->m_ptr_glCopyPathNV;this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&ProfileTableDecorator::m_glCopyPathNV_profile;}
+if(this->m_ptr_glVertexAttribP4ui){this->m_next_glVertexAttribP4ui = this->m_ptr_glVertexAttribP4ui;this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&ProfileTableDecorator::m_glVertexAttribP4ui_profile;}
+if(this->m_ptr_glVertexAttribL2d){this->m_next_glVertexAttribL2d = this->m_ptr_glVertexAttribL2d;this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&ProfileTableDecorator::m_glVertexAttribL2d_profile;}
+if(this->m_ptr_glGetMultisamplefv){this->m_next_glGetMultisamplefv = this->m_ptr_glGetMultisamplefv;this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&ProfileTableDecorator::m_glGetMultisamplefv_profile;}
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT){this->m_next_glCompressedMultiTexSubImage3DEXT = this->m_ptr_glCompressedMultiTexSubImage3DEXT;this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexSubImage3DEXT_profile;}
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV){this->m_next_glVDPAURegisterOutputSurfaceNV = this->m_ptr_glVDPAURegisterOutputSurfaceNV;this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&ProfileTableDecorator::m_glVDPAURegisterOutputSurfaceNV_profile;}
+if(this->m_ptr_glMinSampleShading){this->m_next_glMinSampleShading = this->m_ptr_glMinSampleShading;this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&ProfileTableDecorator::m_glMinSampleShading_profile;}
+if(this->m_ptr_glProgramUniform4fEXT){this->m_next_glProgramUniform4fEXT = this->m_ptr_glProgramUniform4fEXT;this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&ProfileTableDecorator::m_glProgramUniform4fEXT_profile;}
+if(this->m_ptr_glCoverStrokePathNV){this->m_next_glCoverStrokePathNV = this->m_ptr_glCoverStrokePathNV;this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&ProfileTableDecorator::m_glCoverStrokePathNV_profile;}
+if(this->m_ptr_glTextureImage2DMultisampleNV){this->m_next_glTextureImage2DMultisampleNV = this->m_ptr_glTextureImage2DMultisampleNV;this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&ProfileTableDecorator::m_glTextureImage2DMultisampleNV_profile;}
+if(this->m_ptr_glVertex3bOES){this->m_next_glVertex3bOES = this->m_ptr_glVertex3bOES;this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&ProfileTableDecorator::m_glVertex3bOES_profile;}
+if(this->m_ptr_glImportMemoryWin32HandleEXT){this->m_next_glImportMemoryWin32HandleEXT = this->m_ptr_glImportMemoryWin32HandleEXT;this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&ProfileTableDecorator::m_glImportMemoryWin32HandleEXT_profile;}
+if(this->m_ptr_glTessellationFactorAMD){this->m_next_glTessellationFactorAMD = this->m_ptr_glTessellationFactorAMD;this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&ProfileTableDecorator::m_glTessellationFactorAMD_profile;}
+if(this->m_ptr_glDebugMessageControl){this->m_next_glDebugMessageControl = this->m_ptr_glDebugMessageControl;this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&ProfileTableDecorator::m_glDebugMessageControl_profile;}
+if(this->m_ptr_glIsObjectBufferATI){this->m_next_glIsObjectBufferATI = this->m_ptr_glIsObjectBufferATI;this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glIsObjectBufferATI_profile;}
+if(this->m_ptr_glPopAttrib){this->m_next_glPopAttrib = this->m_ptr_glPopAttrib;this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&ProfileTableDecorator::m_glPopAttrib_profile;}
+if(this->m_ptr_glProgramUniform4iEXT){this->m_next_glProgramUniform4iEXT = this->m_ptr_glProgramUniform4iEXT;this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&ProfileTableDecorator::m_glProgramUniform4iEXT_profile;}
+if(this->m_ptr_glVertexAttrib4ubNV){this->m_next_glVertexAttrib4ubNV = this->m_ptr_glVertexAttrib4ubNV;this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&ProfileTableDecorator::m_glVertexAttrib4ubNV_profile;}
+if(this->m_ptr_glColorMaterial){this->m_next_glColorMaterial = this->m_ptr_glColorMaterial;this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&ProfileTableDecorator::m_glColorMaterial_profile;}
+if(this->m_ptr_glVertexAttrib2svARB){this->m_next_glVertexAttrib2svARB = this->m_ptr_glVertexAttrib2svARB;this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&ProfileTableDecorator::m_glVertexAttrib2svARB_profile;}
+if(this->m_ptr_glMinSampleShadingARB){this->m_next_glMinSampleShadingARB = this->m_ptr_glMinSampleShadingARB;this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&ProfileTableDecorator::m_glMinSampleShadingARB_profile;}
+if(this->m_ptr_glColor3b){this->m_next_glColor3b = this->m_ptr_glColor3b;this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&ProfileTableDecorator::m_glColor3b_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN){this->m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glColor3f){this->m_next_glColor3f = this->m_ptr_glColor3f;this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&ProfileTableDecorator::m_glColor3f_profile;}
+if(this->m_ptr_glVDPAUGetSurfaceivNV){this->m_next_glVDPAUGetSurfaceivNV = this->m_ptr_glVDPAUGetSurfaceivNV;this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&ProfileTableDecorator::m_glVDPAUGetSurfaceivNV_profile;}
+if(this->m_ptr_glColor3d){this->m_next_glColor3d = this->m_ptr_glColor3d;this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&ProfileTableDecorator::m_glColor3d_profile;}
+if(this->m_ptr_glGetnMapiv){this->m_next_glGetnMapiv = this->m_ptr_glGetnMapiv;this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&ProfileTableDecorator::m_glGetnMapiv_profile;}
+if(this->m_ptr_glColor3i){this->m_next_glColor3i = this->m_ptr_glColor3i;this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&ProfileTableDecorator::m_glColor3i_profile;}
+if(this->m_ptr_glGetInternalformatSampleivNV){this->m_next_glGetInternalformatSampleivNV = this->m_ptr_glGetInternalformatSampleivNV;this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&ProfileTableDecorator::m_glGetInternalformatSampleivNV_profile;}
+if(this->m_ptr_glVertexAttrib4ubv){this->m_next_glVertexAttrib4ubv = this->m_ptr_glVertexAttrib4ubv;this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&ProfileTableDecorator::m_glVertexAttrib4ubv_profile;}
+if(this->m_ptr_glColor3s){this->m_next_glColor3s = this->m_ptr_glColor3s;this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&ProfileTableDecorator::m_glColor3s_profile;}
+if(this->m_ptr_glVertexAttribs4hvNV){this->m_next_glVertexAttribs4hvNV = this->m_ptr_glVertexAttribs4hvNV;this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&ProfileTableDecorator::m_glVertexAttribs4hvNV_profile;}
+if(this->m_ptr_glVertexAttrib4NubvARB){this->m_next_glVertexAttrib4NubvARB = this->m_ptr_glVertexAttrib4NubvARB;this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NubvARB_profile;}
+if(this->m_ptr_glMultiTexCoord3hvNV){this->m_next_glMultiTexCoord3hvNV = this->m_ptr_glMultiTexCoord3hvNV;this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&ProfileTableDecorator::m_glMultiTexCoord3hvNV_profile;}
+if(this->m_ptr_glMatrixPushEXT){this->m_next_glMatrixPushEXT = this->m_ptr_glMatrixPushEXT;this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&ProfileTableDecorator::m_glMatrixPushEXT_profile;}
+if(this->m_ptr_glProgramUniform2fEXT){this->m_next_glProgramUniform2fEXT = this->m_ptr_glProgramUniform2fEXT;this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&ProfileTableDecorator::m_glProgramUniform2fEXT_profile;}
+if(this->m_ptr_glGetVertexArrayIndexediv){this->m_next_glGetVertexArrayIndexediv = this->m_ptr_glGetVertexArrayIndexediv;this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&ProfileTableDecorator::m_glGetVertexArrayIndexediv_profile;}
+if(this->m_ptr_glBlitFramebuffer){this->m_next_glBlitFramebuffer = this->m_ptr_glBlitFramebuffer;this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&ProfileTableDecorator::m_glBlitFramebuffer_profile;}
+if(this->m_ptr_glMultiTexCoordP2ui){this->m_next_glMultiTexCoordP2ui = this->m_ptr_glMultiTexCoordP2ui;this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&ProfileTableDecorator::m_glMultiTexCoordP2ui_profile;}
+if(this->m_ptr_glColorPointerListIBM){this->m_next_glColorPointerListIBM = this->m_ptr_glColorPointerListIBM;this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glColorPointerListIBM_profile;}
+if(this->m_ptr_glVertexAttribL4d){this->m_next_glVertexAttribL4d = this->m_ptr_glVertexAttribL4d;this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&ProfileTableDecorator::m_glVertexAttribL4d_profile;}
+if(this->m_ptr_glGetFragmentMaterialfvSGIX){this->m_next_glGetFragmentMaterialfvSGIX = this->m_ptr_glGetFragmentMaterialfvSGIX;this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&ProfileTableDecorator::m_glGetFragmentMaterialfvSGIX_profile;}
+if(this->m_ptr_glVertex2iv){this->m_next_glVertex2iv = this->m_ptr_glVertex2iv;this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&ProfileTableDecorator::m_glVertex2iv_profile;}
+if(this->m_ptr_glGetTexEnvxvOES){this->m_next_glGetTexEnvxvOES = this->m_ptr_glGetTexEnvxvOES;this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&ProfileTableDecorator::m_glGetTexEnvxvOES_profile;}
+if(this->m_ptr_glUniformMatrix3dv){this->m_next_glUniformMatrix3dv = this->m_ptr_glUniformMatrix3dv;this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&ProfileTableDecorator::m_glUniformMatrix3dv_profile;}
+if(this->m_ptr_glGetVertexAttribLdvEXT){this->m_next_glGetVertexAttribLdvEXT = this->m_ptr_glGetVertexAttribLdvEXT;this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&ProfileTableDecorator::m_glGetVertexAttribLdvEXT_profile;}
+if(this->m_ptr_glTexCoordP3uiv){this->m_next_glTexCoordP3uiv = this->m_ptr_glTexCoordP3uiv;this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&ProfileTableDecorator::m_glTexCoordP3uiv_profile;}
+if(this->m_ptr_glDeformationMap3dSGIX){this->m_next_glDeformationMap3dSGIX = this->m_ptr_glDeformationMap3dSGIX;this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&ProfileTableDecorator::m_glDeformationMap3dSGIX_profile;}
+if(this->m_ptr_glResumeTransformFeedback){this->m_next_glResumeTransformFeedback = this->m_ptr_glResumeTransformFeedback;this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glResumeTransformFeedback_profile;}
+if(this->m_ptr_glInsertEventMarkerEXT){this->m_next_glInsertEventMarkerEXT = this->m_ptr_glInsertEventMarkerEXT;this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&ProfileTableDecorator::m_glInsertEventMarkerEXT_profile;}
+if(this->m_ptr_glTessellationModeAMD){this->m_next_glTessellationModeAMD = this->m_ptr_glTessellationModeAMD;this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&ProfileTableDecorator::m_glTessellationModeAMD_profile;}
+if(this->m_ptr_glDrawCommandsAddressNV){this->m_next_glDrawCommandsAddressNV = this->m_ptr_glDrawCommandsAddressNV;this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&ProfileTableDecorator::m_glDrawCommandsAddressNV_profile;}
+if(this->m_ptr_glFogi){this->m_next_glFogi = this->m_ptr_glFogi;this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&ProfileTableDecorator::m_glFogi_profile;}
+if(this->m_ptr_glGetTexParameterxvOES){this->m_next_glGetTexParameterxvOES = this->m_ptr_glGetTexParameterxvOES;this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&ProfileTableDecorator::m_glGetTexParameterxvOES_profile;}
+if(this->m_ptr_glVertexPointer){this->m_next_glVertexPointer = this->m_ptr_glVertexPointer;this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&ProfileTableDecorator::m_glVertexPointer_profile;}
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD){this->m_next_glGetPerfMonitorCounterDataAMD = this->m_ptr_glGetPerfMonitorCounterDataAMD;this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorCounterDataAMD_profile;}
+if(this->m_ptr_glFogf){this->m_next_glFogf = this->m_ptr_glFogf;this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&ProfileTableDecorator::m_glFogf_profile;}
+if(this->m_ptr_glMultiTexCoord1d){this->m_next_glMultiTexCoord1d = this->m_ptr_glMultiTexCoord1d;this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&ProfileTableDecorator::m_glMultiTexCoord1d_profile;}
+if(this->m_ptr_glMultiTexCoord1f){this->m_next_glMultiTexCoord1f = this->m_ptr_glMultiTexCoord1f;this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&ProfileTableDecorator::m_glMultiTexCoord1f_profile;}
+if(this->m_ptr_glGetMultiTexParameterivEXT){this->m_next_glGetMultiTexParameterivEXT = this->m_ptr_glGetMultiTexParameterivEXT;this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexParameterivEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT){this->m_next_glProgramUniformMatrix3x4fvEXT = this->m_ptr_glProgramUniformMatrix3x4fvEXT;this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x4fvEXT_profile;}
+if(this->m_ptr_glVertexAttribI2i){this->m_next_glVertexAttribI2i = this->m_ptr_glVertexAttribI2i;this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&ProfileTableDecorator::m_glVertexAttribI2i_profile;}
+if(this->m_ptr_glMultiTexCoord1i){this->m_next_glMultiTexCoord1i = this->m_ptr_glMultiTexCoord1i;this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&ProfileTableDecorator::m_glMultiTexCoord1i_profile;}
+if(this->m_ptr_glDeleteSemaphoresEXT){this->m_next_glDeleteSemaphoresEXT = this->m_ptr_glDeleteSemaphoresEXT;this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&ProfileTableDecorator::m_glDeleteSemaphoresEXT_profile;}
+if(this->m_ptr_glLoadProgramNV){this->m_next_glLoadProgramNV = this->m_ptr_glLoadProgramNV;this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&ProfileTableDecorator::m_glLoadProgramNV_profile;}
+if(this->m_ptr_glWriteMaskEXT){this->m_next_glWriteMaskEXT = this->m_ptr_glWriteMaskEXT;this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&ProfileTableDecorator::m_glWriteMaskEXT_profile;}
+if(this->m_ptr_glGetGraphicsResetStatus){this->m_next_glGetGraphicsResetStatus = this->m_ptr_glGetGraphicsResetStatus;this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&ProfileTableDecorator::m_glGetGraphicsResetStatus_profile;}
+if(this->m_ptr_glVertexAttrib1fv){this->m_next_glVertexAttrib1fv = this->m_ptr_glVertexAttrib1fv;this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&ProfileTableDecorator::m_glVertexAttrib1fv_profile;}
+if(this->m_ptr_glMultiTexCoord1s){this->m_next_glMultiTexCoord1s = this->m_ptr_glMultiTexCoord1s;this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&ProfileTableDecorator::m_glMultiTexCoord1s_profile;}
+if(this->m_ptr_glImageTransformParameterfvHP){this->m_next_glImageTransformParameterfvHP = this->m_ptr_glImageTransformParameterfvHP;this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&ProfileTableDecorator::m_glImageTransformParameterfvHP_profile;}
+if(this->m_ptr_glFramebufferTexture2D){this->m_next_glFramebufferTexture2D = this->m_ptr_glFramebufferTexture2D;this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&ProfileTableDecorator::m_glFramebufferTexture2D_profile;}
+if(this->m_ptr_glGetFragmentLightfvSGIX){this->m_next_glGetFragmentLightfvSGIX = this->m_ptr_glGetFragmentLightfvSGIX;this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&ProfileTableDecorator::m_glGetFragmentLightfvSGIX_profile;}
+if(this->m_ptr_glListParameterfSGIX){this->m_next_glListParameterfSGIX = this->m_ptr_glListParameterfSGIX;this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&ProfileTableDecorator::m_glListParameterfSGIX_profile;}
+if(this->m_ptr_glTexCoord3sv){this->m_next_glTexCoord3sv = this->m_ptr_glTexCoord3sv;this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&ProfileTableDecorator::m_glTexCoord3sv_profile;}
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT){this->m_next_glNamedFramebufferRenderbufferEXT = this->m_ptr_glNamedFramebufferRenderbufferEXT;this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glNamedFramebufferRenderbufferEXT_profile;}
+if(this->m_ptr_glFragmentLightModelfSGIX){this->m_next_glFragmentLightModelfSGIX = this->m_ptr_glFragmentLightModelfSGIX;this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&ProfileTableDecorator::m_glFragmentLightModelfSGIX_profile;}
+if(this->m_ptr_glIndexPointerEXT){this->m_next_glIndexPointerEXT = this->m_ptr_glIndexPointerEXT;this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&ProfileTableDecorator::m_glIndexPointerEXT_profile;}
+if(this->m_ptr_glBlendEquationSeparateATI){this->m_next_glBlendEquationSeparateATI = this->m_ptr_glBlendEquationSeparateATI;this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&ProfileTableDecorator::m_glBlendEquationSeparateATI_profile;}
+if(this->m_ptr_glVertexArrayAttribIFormat){this->m_next_glVertexArrayAttribIFormat = this->m_ptr_glVertexArrayAttribIFormat;this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&ProfileTableDecorator::m_glVertexArrayAttribIFormat_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN){this->m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glReplacementCodeubvSUN){this->m_next_glReplacementCodeubvSUN = this->m_ptr_glReplacementCodeubvSUN;this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeubvSUN_profile;}
+if(this->m_ptr_glGenFramebuffers){this->m_next_glGenFramebuffers = this->m_ptr_glGenFramebuffers;this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&ProfileTableDecorator::m_glGenFramebuffers_profile;}
+if(this->m_ptr_glPixelMapx){this->m_next_glPixelMapx = this->m_ptr_glPixelMapx;this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&ProfileTableDecorator::m_glPixelMapx_profile;}
+if(this->m_ptr_glTexSubImage3DEXT){this->m_next_glTexSubImage3DEXT = this->m_ptr_glTexSubImage3DEXT;this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glTexSubImage3DEXT_profile;}
+if(this->m_ptr_glGetAttachedShaders){this->m_next_glGetAttachedShaders = this->m_ptr_glGetAttachedShaders;this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&ProfileTableDecorator::m_glGetAttachedShaders_profile;}
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS){this->m_next_glGetPixelTexGenParameterfvSGIS = this->m_ptr_glGetPixelTexGenParameterfvSGIS;this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&ProfileTableDecorator::m_glGetPixelTexGenParameterfvSGIS_profile;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN){this->m_next_glReplacementCodeuiNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glGetDebugMessageLogAMD){this->m_next_glGetDebugMessageLogAMD = this->m_ptr_glGetDebugMessageLogAMD;this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&ProfileTableDecorator::m_glGetDebugMessageLogAMD_profile;}
+if(this->m_ptr_glVertexStream4sATI){this->m_next_glVertexStream4sATI = this->m_ptr_glVertexStream4sATI;this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&ProfileTableDecorator::m_glVertexStream4sATI_profile;}
+if(this->m_ptr_glVertexAttribs4dvNV){this->m_next_glVertexAttribs4dvNV = this->m_ptr_glVertexAttribs4dvNV;this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&ProfileTableDecorator::m_glVertexAttribs4dvNV_profile;}
+if(this->m_ptr_glGetnMapdvARB){this->m_next_glGetnMapdvARB = this->m_ptr_glGetnMapdvARB;this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&ProfileTableDecorator::m_glGetnMapdvARB_profile;}
+if(this->m_ptr_glOrthofOES){this->m_next_glOrthofOES = this->m_ptr_glOrthofOES;this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&ProfileTableDecorator::m_glOrthofOES_profile;}
+if(this->m_ptr_glViewportArrayv){this->m_next_glViewportArrayv = this->m_ptr_glViewportArrayv;this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&ProfileTableDecorator::m_glViewportArrayv_profile;}
+if(this->m_ptr_glDrawElementArrayATI){this->m_next_glDrawElementArrayATI = this->m_ptr_glDrawElementArrayATI;this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&ProfileTableDecorator::m_glDrawElementArrayATI_profile;}
+if(this->m_ptr_glBufferStorageMemEXT){this->m_next_glBufferStorageMemEXT = this->m_ptr_glBufferStorageMemEXT;this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&ProfileTableDecorator::m_glBufferStorageMemEXT_profile;}
+if(this->m_ptr_glGetPathColorGenfvNV){this->m_next_glGetPathColorGenfvNV = this->m_ptr_glGetPathColorGenfvNV;this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&ProfileTableDecorator::m_glGetPathColorGenfvNV_profile;}
+if(this->m_ptr_glWindowPos3iMESA){this->m_next_glWindowPos3iMESA = this->m_ptr_glWindowPos3iMESA;this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&ProfileTableDecorator::m_glWindowPos3iMESA_profile;}
+if(this->m_ptr_glMultiTexCoord2s){this->m_next_glMultiTexCoord2s = this->m_ptr_glMultiTexCoord2s;this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&ProfileTableDecorator::m_glMultiTexCoord2s_profile;}
+if(this->m_ptr_glVertex3dv){this->m_next_glVertex3dv = this->m_ptr_glVertex3dv;this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&ProfileTableDecorator::m_glVertex3dv_profile;}
+if(this->m_ptr_glVertexAttribI3uivEXT){this->m_next_glVertexAttribI3uivEXT = this->m_ptr_glVertexAttribI3uivEXT;this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI3uivEXT_profile;}
+if(this->m_ptr_glUniform3ui64ARB){this->m_next_glUniform3ui64ARB = this->m_ptr_glUniform3ui64ARB;this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&ProfileTableDecorator::m_glUniform3ui64ARB_profile;}
+if(this->m_ptr_glVertexAttrib2fvNV){this->m_next_glVertexAttrib2fvNV = this->m_ptr_glVertexAttrib2fvNV;this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&ProfileTableDecorator::m_glVertexAttrib2fvNV_profile;}
+if(this->m_ptr_glGetNamedBufferSubDataEXT){this->m_next_glGetNamedBufferSubDataEXT = this->m_ptr_glGetNamedBufferSubDataEXT;this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&ProfileTableDecorator::m_glGetNamedBufferSubDataEXT_profile;}
+if(this->m_ptr_glConvolutionFilter2D){this->m_next_glConvolutionFilter2D = this->m_ptr_glConvolutionFilter2D;this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&ProfileTableDecorator::m_glConvolutionFilter2D_profile;}
+if(this->m_ptr_glMemoryBarrierByRegion){this->m_next_glMemoryBarrierByRegion = this->m_ptr_glMemoryBarrierByRegion;this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&ProfileTableDecorator::m_glMemoryBarrierByRegion_profile;}
+if(this->m_ptr_glVertexArrayBindingDivisor){this->m_next_glVertexArrayBindingDivisor = this->m_ptr_glVertexArrayBindingDivisor;this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&ProfileTableDecorator::m_glVertexArrayBindingDivisor_profile;}
+if(this->m_ptr_glMatrixRotatedEXT){this->m_next_glMatrixRotatedEXT = this->m_ptr_glMatrixRotatedEXT;this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&ProfileTableDecorator::m_glMatrixRotatedEXT_profile;}
+if(this->m_ptr_glTexCoord2sv){this->m_next_glTexCoord2sv = this->m_ptr_glTexCoord2sv;this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&ProfileTableDecorator::m_glTexCoord2sv_profile;}
+if(this->m_ptr_glIsProgramNV){this->m_next_glIsProgramNV = this->m_ptr_glIsProgramNV;this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&ProfileTableDecorator::m_glIsProgramNV_profile;}
+if(this->m_ptr_glUniform2dv){this->m_next_glUniform2dv = this->m_ptr_glUniform2dv;this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&ProfileTableDecorator::m_glUniform2dv_profile;}
+if(this->m_ptr_glGetPixelMapuiv){this->m_next_glGetPixelMapuiv = this->m_ptr_glGetPixelMapuiv;this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&ProfileTableDecorator::m_glGetPixelMapuiv_profile;}
+if(this->m_ptr_glDepthBoundsEXT){this->m_next_glDepthBoundsEXT = this->m_ptr_glDepthBoundsEXT;this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&ProfileTableDecorator::m_glDepthBoundsEXT_profile;}
+if(this->m_ptr_glVertexAttrib4hvNV){this->m_next_glVertexAttrib4hvNV = this->m_ptr_glVertexAttrib4hvNV;this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&ProfileTableDecorator::m_glVertexAttrib4hvNV_profile;}
+if(this->m_ptr_glMultiTexParameteriEXT){this->m_next_glMultiTexParameteriEXT = this->m_ptr_glMultiTexParameteriEXT;this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&ProfileTableDecorator::m_glMultiTexParameteriEXT_profile;}
+if(this->m_ptr_glGetPointerv){this->m_next_glGetPointerv = this->m_ptr_glGetPointerv;this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&ProfileTableDecorator::m_glGetPointerv_profile;}
+if(this->m_ptr_glPathCommandsNV){this->m_next_glPathCommandsNV = this->m_ptr_glPathCommandsNV;this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&ProfileTableDecorator::m_glPathCommandsNV_profile;}
+if(this->m_ptr_glGetListParameterfvSGIX){this->m_next_glGetListParameterfvSGIX = this->m_ptr_glGetListParameterfvSGIX;this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&ProfileTableDecorator::m_glGetListParameterfvSGIX_profile;}
+if(this->m_ptr_glGetUniformuiv){this->m_next_glGetUniformuiv = this->m_ptr_glGetUniformuiv;this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&ProfileTableDecorator::m_glGetUniformuiv_profile;}
+if(this->m_ptr_glDebugMessageInsertAMD){this->m_next_glDebugMessageInsertAMD = this->m_ptr_glDebugMessageInsertAMD;this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&ProfileTableDecorator::m_glDebugMessageInsertAMD_profile;}
+if(this->m_ptr_glFrustum){this->m_next_glFrustum = this->m_ptr_glFrustum;this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&ProfileTableDecorator::m_glFrustum_profile;}
+if(this->m_ptr_glVertexAttribL1ui64vNV){this->m_next_glVertexAttribL1ui64vNV = this->m_ptr_glVertexAttribL1ui64vNV;this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL1ui64vNV_profile;}
+if(this->m_ptr_glClearColorxOES){this->m_next_glClearColorxOES = this->m_ptr_glClearColorxOES;this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&ProfileTableDecorator::m_glClearColorxOES_profile;}
+if(this->m_ptr_glProgramUniformMatrix3fv){this->m_next_glProgramUniformMatrix3fv = this->m_ptr_glProgramUniformMatrix3fv;this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3fv_profile;}
+if(this->m_ptr_glSampleMaskIndexedNV){this->m_next_glSampleMaskIndexedNV = this->m_ptr_glSampleMaskIndexedNV;this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&ProfileTableDecorator::m_glSampleMaskIndexedNV_profile;}
+if(this->m_ptr_glCompileShaderIncludeARB){this->m_next_glCompileShaderIncludeARB = this->m_ptr_glCompileShaderIncludeARB;this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&ProfileTableDecorator::m_glCompileShaderIncludeARB_profile;}
+if(this->m_ptr_glGetArrayObjectfvATI){this->m_next_glGetArrayObjectfvATI = this->m_ptr_glGetArrayObjectfvATI;this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&ProfileTableDecorator::m_glGetArrayObjectfvATI_profile;}
+if(this->m_ptr_glVertexStream4svATI){this->m_next_glVertexStream4svATI = this->m_ptr_glVertexStream4svATI;this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&ProfileTableDecorator::m_glVertexStream4svATI_profile;}
+if(this->m_ptr_glMultiTexCoord4iARB){this->m_next_glMultiTexCoord4iARB = this->m_ptr_glMultiTexCoord4iARB;this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4iARB_profile;}
+if(this->m_ptr_glVariantfvEXT){this->m_next_glVariantfvEXT = this->m_ptr_glVariantfvEXT;this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&ProfileTableDecorator::m_glVariantfvEXT_profile;}
+if(this->m_ptr_glMatrixLoadfEXT){this->m_next_glMatrixLoadfEXT = this->m_ptr_glMatrixLoadfEXT;this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&ProfileTableDecorator::m_glMatrixLoadfEXT_profile;}
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX){this->m_next_glLoadIdentityDeformationMapSGIX = this->m_ptr_glLoadIdentityDeformationMapSGIX;this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&ProfileTableDecorator::m_glLoadIdentityDeformationMapSGIX_profile;}
+if(this->m_ptr_glGetRenderbufferParameteriv){this->m_next_glGetRenderbufferParameteriv = this->m_ptr_glGetRenderbufferParameteriv;this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetRenderbufferParameteriv_profile;}
+if(this->m_ptr_glProgramUniform3fEXT){this->m_next_glProgramUniform3fEXT = this->m_ptr_glProgramUniform3fEXT;this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&ProfileTableDecorator::m_glProgramUniform3fEXT_profile;}
+if(this->m_ptr_glNamedRenderbufferStorage){this->m_next_glNamedRenderbufferStorage = this->m_ptr_glNamedRenderbufferStorage;this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&ProfileTableDecorator::m_glNamedRenderbufferStorage_profile;}
+if(this->m_ptr_glBindFragDataLocation){this->m_next_glBindFragDataLocation = this->m_ptr_glBindFragDataLocation;this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&ProfileTableDecorator::m_glBindFragDataLocation_profile;}
+if(this->m_ptr_glPolygonOffsetClamp){this->m_next_glPolygonOffsetClamp = this->m_ptr_glPolygonOffsetClamp;this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&ProfileTableDecorator::m_glPolygonOffsetClamp_profile;}
+if(this->m_ptr_glFogCoordPointerListIBM){this->m_next_glFogCoordPointerListIBM = this->m_ptr_glFogCoordPointerListIBM;this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glFogCoordPointerListIBM_profile;}
+if(this->m_ptr_glFenceSync){this->m_next_glFenceSync = this->m_ptr_glFenceSync;this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&ProfileTableDecorator::m_glFenceSync_profile;}
+if(this->m_ptr_glGetVertexAttribIivEXT){this->m_next_glGetVertexAttribIivEXT = this->m_ptr_glGetVertexAttribIivEXT;this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&ProfileTableDecorator::m_glGetVertexAttribIivEXT_profile;}
+if(this->m_ptr_glFramebufferDrawBuffersEXT){this->m_next_glFramebufferDrawBuffersEXT = this->m_ptr_glFramebufferDrawBuffersEXT;this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&ProfileTableDecorator::m_glFramebufferDrawBuffersEXT_profile;}
+if(this->m_ptr_glVertexAttribs4fvNV){this->m_next_glVertexAttribs4fvNV = this->m_ptr_glVertexAttribs4fvNV;this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&ProfileTableDecorator::m_glVertexAttribs4fvNV_profile;}
+if(this->m_ptr_glPauseTransformFeedbackNV){this->m_next_glPauseTransformFeedbackNV = this->m_ptr_glPauseTransformFeedbackNV;this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glPauseTransformFeedbackNV_profile;}
+if(this->m_ptr_glGetQueryObjecti64vEXT){this->m_next_glGetQueryObjecti64vEXT = this->m_ptr_glGetQueryObjecti64vEXT;this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&ProfileTableDecorator::m_glGetQueryObjecti64vEXT_profile;}
+if(this->m_ptr_glVDPAUSurfaceAccessNV){this->m_next_glVDPAUSurfaceAccessNV = this->m_ptr_glVDPAUSurfaceAccessNV;this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&ProfileTableDecorator::m_glVDPAUSurfaceAccessNV_profile;}
+if(this->m_ptr_glValidateProgramPipeline){this->m_next_glValidateProgramPipeline = this->m_ptr_glValidateProgramPipeline;this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&ProfileTableDecorator::m_glValidateProgramPipeline_profile;}
+if(this->m_ptr_glTexPageCommitmentARB){this->m_next_glTexPageCommitmentARB = this->m_ptr_glTexPageCommitmentARB;this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&ProfileTableDecorator::m_glTexPageCommitmentARB_profile;}
+if(this->m_ptr_glWindowPos3dvARB){this->m_next_glWindowPos3dvARB = this->m_ptr_glWindowPos3dvARB;this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&ProfileTableDecorator::m_glWindowPos3dvARB_profile;}
+if(this->m_ptr_glStencilStrokePathInstancedNV){this->m_next_glStencilStrokePathInstancedNV = this->m_ptr_glStencilStrokePathInstancedNV;this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glStencilStrokePathInstancedNV_profile;}
+if(this->m_ptr_glFogfv){this->m_next_glFogfv = this->m_ptr_glFogfv;this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&ProfileTableDecorator::m_glFogfv_profile;}
+if(this->m_ptr_glGenQueriesARB){this->m_next_glGenQueriesARB = this->m_ptr_glGenQueriesARB;this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&ProfileTableDecorator::m_glGenQueriesARB_profile;}
+if(this->m_ptr_glProgramUniform2i64NV){this->m_next_glProgramUniform2i64NV = this->m_ptr_glProgramUniform2i64NV;this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&ProfileTableDecorator::m_glProgramUniform2i64NV_profile;}
+if(this->m_ptr_glVertexP4ui){this->m_next_glVertexP4ui = this->m_ptr_glVertexP4ui;this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&ProfileTableDecorator::m_glVertexP4ui_profile;}
+if(this->m_ptr_glVertexStream1ivATI){this->m_next_glVertexStream1ivATI = this->m_ptr_glVertexStream1ivATI;this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&ProfileTableDecorator::m_glVertexStream1ivATI_profile;}
+if(this->m_ptr_glProgramEnvParameterI4iNV){this->m_next_glProgramEnvParameterI4iNV = this->m_ptr_glProgramEnvParameterI4iNV;this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&ProfileTableDecorator::m_glProgramEnvParameterI4iNV_profile;}
+if(this->m_ptr_glGenVertexArraysAPPLE){this->m_next_glGenVertexArraysAPPLE = this->m_ptr_glGenVertexArraysAPPLE;this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&ProfileTableDecorator::m_glGenVertexArraysAPPLE_profile;}
+if(this->m_ptr_glDrawTransformFeedbackInstanced){this->m_next_glDrawTransformFeedbackInstanced = this->m_ptr_glDrawTransformFeedbackInstanced;this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&ProfileTableDecorator::m_glDrawTransformFeedbackInstanced_profile;}
+if(this->m_ptr_glStencilThenCoverStrokePathNV){this->m_next_glStencilThenCoverStrokePathNV = this->m_ptr_glStencilThenCoverStrokePathNV;this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&ProfileTableDecorator::m_glStencilThenCoverStrokePathNV_profile;}
+if(this->m_ptr_glDeleteVertexArraysAPPLE){this->m_next_glDeleteVertexArraysAPPLE = this->m_ptr_glDeleteVertexArraysAPPLE;this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&ProfileTableDecorator::m_glDeleteVertexArraysAPPLE_profile;}
+if(this->m_ptr_glGetNamedBufferParameterui64vNV){this->m_next_glGetNamedBufferParameterui64vNV = this->m_ptr_glGetNamedBufferParameterui64vNV;this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&ProfileTableDecorator::m_glGetNamedBufferParameterui64vNV_profile;}
+if(this->m_ptr_glQueryMatrixxOES){this->m_next_glQueryMatrixxOES = this->m_ptr_glQueryMatrixxOES;this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&ProfileTableDecorator::m_glQueryMatrixxOES_profile;}
+if(this->m_ptr_glSecondaryColor3usv){this->m_next_glSecondaryColor3usv = this->m_ptr_glSecondaryColor3usv;this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&ProfileTableDecorator::m_glSecondaryColor3usv_profile;}
+if(this->m_ptr_glTranslatexOES){this->m_next_glTranslatexOES = this->m_ptr_glTranslatexOES;this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&ProfileTableDecorator::m_glTranslatexOES_profile;}
+if(this->m_ptr_glDrawTransformFeedback){this->m_next_glDrawTransformFeedback = this->m_ptr_glDrawTransformFeedback;this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glDrawTransformFeedback_profile;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_next_glTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV){this->m_next_glVDPAURegisterVideoSurfaceNV = this->m_ptr_glVDPAURegisterVideoSurfaceNV;this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&ProfileTableDecorator::m_glVDPAURegisterVideoSurfaceNV_profile;}
+if(this->m_ptr_glGetTexParameterIuiv){this->m_next_glGetTexParameterIuiv = this->m_ptr_glGetTexParameterIuiv;this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&ProfileTableDecorator::m_glGetTexParameterIuiv_profile;}
+if(this->m_ptr_glBindBufferBaseNV){this->m_next_glBindBufferBaseNV = this->m_ptr_glBindBufferBaseNV;this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&ProfileTableDecorator::m_glBindBufferBaseNV_profile;}
+if(this->m_ptr_glIndexPointer){this->m_next_glIndexPointer = this->m_ptr_glIndexPointer;this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&ProfileTableDecorator::m_glIndexPointer_profile;}
+if(this->m_ptr_glGenQueryResourceTagNV){this->m_next_glGenQueryResourceTagNV = this->m_ptr_glGenQueryResourceTagNV;this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&ProfileTableDecorator::m_glGenQueryResourceTagNV_profile;}
+if(this->m_ptr_glVertexAttrib4Nbv){this->m_next_glVertexAttrib4Nbv = this->m_ptr_glVertexAttrib4Nbv;this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&ProfileTableDecorator::m_glVertexAttrib4Nbv_profile;}
+if(this->m_ptr_glListParameteriSGIX){this->m_next_glListParameteriSGIX = this->m_ptr_glListParameteriSGIX;this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&ProfileTableDecorator::m_glListParameteriSGIX_profile;}
+if(this->m_ptr_glBlendColorxOES){this->m_next_glBlendColorxOES = this->m_ptr_glBlendColorxOES;this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&ProfileTableDecorator::m_glBlendColorxOES_profile;}
+if(this->m_ptr_glUniformui64vNV){this->m_next_glUniformui64vNV = this->m_ptr_glUniformui64vNV;this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&ProfileTableDecorator::m_glUniformui64vNV_profile;}
+if(this->m_ptr_glIsSync){this->m_next_glIsSync = this->m_ptr_glIsSync;this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&ProfileTableDecorator::m_glIsSync_profile;}
+if(this->m_ptr_glGetTextureParameterivEXT){this->m_next_glGetTextureParameterivEXT = this->m_ptr_glGetTextureParameterivEXT;this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetTextureParameterivEXT_profile;}
+if(this->m_ptr_glFogCoordhvNV){this->m_next_glFogCoordhvNV = this->m_ptr_glFogCoordhvNV;this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&ProfileTableDecorator::m_glFogCoordhvNV_profile;}
+if(this->m_ptr_glFramebufferTextureLayerEXT){this->m_next_glFramebufferTextureLayerEXT = this->m_ptr_glFramebufferTextureLayerEXT;this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfileTableDecorator::m_glFramebufferTextureLayerEXT_profile;}
+if(this->m_ptr_glGetObjectPtrLabel){this->m_next_glGetObjectPtrLabel = this->m_ptr_glGetObjectPtrLabel;this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&ProfileTableDecorator::m_glGetObjectPtrLabel_profile;}
+if(this->m_ptr_glTextureParameteri){this->m_next_glTextureParameteri = this->m_ptr_glTextureParameteri;this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&ProfileTableDecorator::m_glTextureParameteri_profile;}
+if(this->m_ptr_glMultiTexCoord1fARB){this->m_next_glMultiTexCoord1fARB = this->m_ptr_glMultiTexCoord1fARB;this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1fARB_profile;}
+if(this->m_ptr_glUniformMatrix2x3dv){this->m_next_glUniformMatrix2x3dv = this->m_ptr_glUniformMatrix2x3dv;this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&ProfileTableDecorator::m_glUniformMatrix2x3dv_profile;}
+if(this->m_ptr_glFramebufferDrawBufferEXT){this->m_next_glFramebufferDrawBufferEXT = this->m_ptr_glFramebufferDrawBufferEXT;this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&ProfileTableDecorator::m_glFramebufferDrawBufferEXT_profile;}
+if(this->m_ptr_glCopyColorSubTable){this->m_next_glCopyColorSubTable = this->m_ptr_glCopyColorSubTable;this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&ProfileTableDecorator::m_glCopyColorSubTable_profile;}
+if(this->m_ptr_glGetNamedFramebufferParameterfvAMD){this->m_next_glGetNamedFramebufferParameterfvAMD = this->m_ptr_glGetNamedFramebufferParameterfvAMD;this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&ProfileTableDecorator::m_glGetNamedFramebufferParameterfvAMD_profile;}
+if(this->m_ptr_glVertexAttribL3d){this->m_next_glVertexAttribL3d = this->m_ptr_glVertexAttribL3d;this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&ProfileTableDecorator::m_glVertexAttribL3d_profile;}
+if(this->m_ptr_glFragmentMaterialfvSGIX){this->m_next_glFragmentMaterialfvSGIX = this->m_ptr_glFragmentMaterialfvSGIX;this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&ProfileTableDecorator::m_glFragmentMaterialfvSGIX_profile;}
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV){this->m_next_glMatrixLoadTranspose3x3fNV = this->m_ptr_glMatrixLoadTranspose3x3fNV;this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&ProfileTableDecorator::m_glMatrixLoadTranspose3x3fNV_profile;}
+if(this->m_ptr_glDeleteNamesAMD){this->m_next_glDeleteNamesAMD = this->m_ptr_glDeleteNamesAMD;this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&ProfileTableDecorator::m_glDeleteNamesAMD_profile;}
+if(this->m_ptr_glDrawRangeElementsEXT){this->m_next_glDrawRangeElementsEXT = this->m_ptr_glDrawRangeElementsEXT;this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&ProfileTableDecorator::m_glDrawRangeElementsEXT_profile;}
+if(this->m_ptr_glOrtho){this->m_next_glOrtho = this->m_ptr_glOrtho;this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&ProfileTableDecorator::m_glOrtho_profile;}
+if(this->m_ptr_glProgramUniform1dvEXT){this->m_next_glProgramUniform1dvEXT = this->m_ptr_glProgramUniform1dvEXT;this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&ProfileTableDecorator::m_glProgramUniform1dvEXT_profile;}
+if(this->m_ptr_glColor4xOES){this->m_next_glColor4xOES = this->m_ptr_glColor4xOES;this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&ProfileTableDecorator::m_glColor4xOES_profile;}
+if(this->m_ptr_glTexImage4DSGIS){this->m_next_glTexImage4DSGIS = this->m_ptr_glTexImage4DSGIS;this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&ProfileTableDecorator::m_glTexImage4DSGIS_profile;}
+if(this->m_ptr_glProgramUniform1ui){this->m_next_glProgramUniform1ui = this->m_ptr_glProgramUniform1ui;this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&ProfileTableDecorator::m_glProgramUniform1ui_profile;}
+if(this->m_ptr_glDeleteBuffersARB){this->m_next_glDeleteBuffersARB = this->m_ptr_glDeleteBuffersARB;this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&ProfileTableDecorator::m_glDeleteBuffersARB_profile;}
+if(this->m_ptr_glUnmapBufferARB){this->m_next_glUnmapBufferARB = this->m_ptr_glUnmapBufferARB;this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&ProfileTableDecorator::m_glUnmapBufferARB_profile;}
+if(this->m_ptr_glCopyTexImage2D){this->m_next_glCopyTexImage2D = this->m_ptr_glCopyTexImage2D;this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&ProfileTableDecorator::m_glCopyTexImage2D_profile;}
+if(this->m_ptr_glMaterialxOES){this->m_next_glMaterialxOES = this->m_ptr_glMaterialxOES;this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&ProfileTableDecorator::m_glMaterialxOES_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT){this->m_next_glProgramUniformMatrix2x4fvEXT = this->m_ptr_glProgramUniformMatrix2x4fvEXT;this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x4fvEXT_profile;}
+if(this->m_ptr_glTestObjectAPPLE){this->m_next_glTestObjectAPPLE = this->m_ptr_glTestObjectAPPLE;this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&ProfileTableDecorator::m_glTestObjectAPPLE_profile;}
+if(this->m_ptr_glRenderbufferStorageEXT){this->m_next_glRenderbufferStorageEXT = this->m_ptr_glRenderbufferStorageEXT;this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&ProfileTableDecorator::m_glRenderbufferStorageEXT_profile;}
+if(this->m_ptr_glVertexAttribL1ui64ARB){this->m_next_glVertexAttribL1ui64ARB = this->m_ptr_glVertexAttribL1ui64ARB;this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&ProfileTableDecorator::m_glVertexAttribL1ui64ARB_profile;}
+if(this->m_ptr_glEndFragmentShaderATI){this->m_next_glEndFragmentShaderATI = this->m_ptr_glEndFragmentShaderATI;this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&ProfileTableDecorator::m_glEndFragmentShaderATI_profile;}
+if(this->m_ptr_glPathParameterivNV){this->m_next_glPathParameterivNV = this->m_ptr_glPathParameterivNV;this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&ProfileTableDecorator::m_glPathParameterivNV_profile;}
+if(this->m_ptr_glUniform4uiv){this->m_next_glUniform4uiv = this->m_ptr_glUniform4uiv;this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&ProfileTableDecorator::m_glUniform4uiv_profile;}
+if(this->m_ptr_glFrameZoomSGIX){this->m_next_glFrameZoomSGIX = this->m_ptr_glFrameZoomSGIX;this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&ProfileTableDecorator::m_glFrameZoomSGIX_profile;}
+if(this->m_ptr_glSecondaryColor3fEXT){this->m_next_glSecondaryColor3fEXT = this->m_ptr_glSecondaryColor3fEXT;this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3fEXT_profile;}
+if(this->m_ptr_glLGPUInterlockNVX){this->m_next_glLGPUInterlockNVX = this->m_ptr_glLGPUInterlockNVX;this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&ProfileTableDecorator::m_glLGPUInterlockNVX_profile;}
+if(this->m_ptr_glVertexAttribL1dv){this->m_next_glVertexAttribL1dv = this->m_ptr_glVertexAttribL1dv;this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&ProfileTableDecorator::m_glVertexAttribL1dv_profile;}
+if(this->m_ptr_glNormalStream3svATI){this->m_next_glNormalStream3svATI = this->m_ptr_glNormalStream3svATI;this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&ProfileTableDecorator::m_glNormalStream3svATI_profile;}
+if(this->m_ptr_glPathStencilFuncNV){this->m_next_glPathStencilFuncNV = this->m_ptr_glPathStencilFuncNV;this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&ProfileTableDecorator::m_glPathStencilFuncNV_profile;}
+if(this->m_ptr_glSetInvariantEXT){this->m_next_glSetInvariantEXT = this->m_ptr_glSetInvariantEXT;this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&ProfileTableDecorator::m_glSetInvariantEXT_profile;}
+if(this->m_ptr_glGetTexBumpParameterivATI){this->m_next_glGetTexBumpParameterivATI = this->m_ptr_glGetTexBumpParameterivATI;this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&ProfileTableDecorator::m_glGetTexBumpParameterivATI_profile;}
+if(this->m_ptr_glBlendEquationSeparateEXT){this->m_next_glBlendEquationSeparateEXT = this->m_ptr_glBlendEquationSeparateEXT;this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&ProfileTableDecorator::m_glBlendEquationSeparateEXT_profile;}
+if(this->m_ptr_glEndOcclusionQueryNV){this->m_next_glEndOcclusionQueryNV = this->m_ptr_glEndOcclusionQueryNV;this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&ProfileTableDecorator::m_glEndOcclusionQueryNV_profile;}
+if(this->m_ptr_glScissorArrayv){this->m_next_glScissorArrayv = this->m_ptr_glScissorArrayv;this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&ProfileTableDecorator::m_glScissorArrayv_profile;}
+if(this->m_ptr_glCallList){this->m_next_glCallList = this->m_ptr_glCallList;this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&ProfileTableDecorator::m_glCallList_profile;}
+if(this->m_ptr_glMapTexture2DINTEL){this->m_next_glMapTexture2DINTEL = this->m_ptr_glMapTexture2DINTEL;this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&ProfileTableDecorator::m_glMapTexture2DINTEL_profile;}
+if(this->m_ptr_glGetVkProcAddrNV){this->m_next_glGetVkProcAddrNV = this->m_ptr_glGetVkProcAddrNV;this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&ProfileTableDecorator::m_glGetVkProcAddrNV_profile;}
+if(this->m_ptr_glPixelTransferxOES){this->m_next_glPixelTransferxOES = this->m_ptr_glPixelTransferxOES;this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&ProfileTableDecorator::m_glPixelTransferxOES_profile;}
+if(this->m_ptr_glDeleteRenderbuffersEXT){this->m_next_glDeleteRenderbuffersEXT = this->m_ptr_glDeleteRenderbuffersEXT;this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&ProfileTableDecorator::m_glDeleteRenderbuffersEXT_profile;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN){this->m_next_glTexCoord4fColor4fNormal3fVertex4fSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&ProfileTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_profile;}
+if(this->m_ptr_glProgramUniformMatrix4dvEXT){this->m_next_glProgramUniformMatrix4dvEXT = this->m_ptr_glProgramUniformMatrix4dvEXT;this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4dvEXT_profile;}
+if(this->m_ptr_glGetnColorTable){this->m_next_glGetnColorTable = this->m_ptr_glGetnColorTable;this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&ProfileTableDecorator::m_glGetnColorTable_profile;}
+if(this->m_ptr_glFramebufferTextureLayerARB){this->m_next_glFramebufferTextureLayerARB = this->m_ptr_glFramebufferTextureLayerARB;this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&ProfileTableDecorator::m_glFramebufferTextureLayerARB_profile;}
+if(this->m_ptr_glVertexAttribL2dvEXT){this->m_next_glVertexAttribL2dvEXT = this->m_ptr_glVertexAttribL2dvEXT;this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&ProfileTableDecorator::m_glVertexAttribL2dvEXT_profile;}
+if(this->m_ptr_glGetCombinerStageParameterfvNV){this->m_next_glGetCombinerStageParameterfvNV = this->m_ptr_glGetCombinerStageParameterfvNV;this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetCombinerStageParameterfvNV_profile;}
+if(this->m_ptr_glMultiTexCoord1xvOES){this->m_next_glMultiTexCoord1xvOES = this->m_ptr_glMultiTexCoord1xvOES;this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord1xvOES_profile;}
+if(this->m_ptr_glMapBuffer){this->m_next_glMapBuffer = this->m_ptr_glMapBuffer;this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&ProfileTableDecorator::m_glMapBuffer_profile;}
+if(this->m_ptr_glSecondaryColor3d){this->m_next_glSecondaryColor3d = this->m_ptr_glSecondaryColor3d;this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&ProfileTableDecorator::m_glSecondaryColor3d_profile;}
+if(this->m_ptr_glSecondaryColor3f){this->m_next_glSecondaryColor3f = this->m_ptr_glSecondaryColor3f;this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&ProfileTableDecorator::m_glSecondaryColor3f_profile;}
+if(this->m_ptr_glVertexAttribLFormat){this->m_next_glVertexAttribLFormat = this->m_ptr_glVertexAttribLFormat;this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&ProfileTableDecorator::m_glVertexAttribLFormat_profile;}
+if(this->m_ptr_glElementPointerAPPLE){this->m_next_glElementPointerAPPLE = this->m_ptr_glElementPointerAPPLE;this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&ProfileTableDecorator::m_glElementPointerAPPLE_profile;}
+if(this->m_ptr_glVertexStream1fATI){this->m_next_glVertexStream1fATI = this->m_ptr_glVertexStream1fATI;this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&ProfileTableDecorator::m_glVertexStream1fATI_profile;}
+if(this->m_ptr_glCoverageModulationNV){this->m_next_glCoverageModulationNV = this->m_ptr_glCoverageModulationNV;this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&ProfileTableDecorator::m_glCoverageModulationNV_profile;}
+if(this->m_ptr_glSecondaryColor3i){this->m_next_glSecondaryColor3i = this->m_ptr_glSecondaryColor3i;this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&ProfileTableDecorator::m_glSecondaryColor3i_profile;}
+if(this->m_ptr_glDeleteSync){this->m_next_glDeleteSync = this->m_ptr_glDeleteSync;this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&ProfileTableDecorator::m_glDeleteSync_profile;}
+if(this->m_ptr_glGetProgramParameterfvNV){this->m_next_glGetProgramParameterfvNV = this->m_ptr_glGetProgramParameterfvNV;this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetProgramParameterfvNV_profile;}
+if(this->m_ptr_glMaxShaderCompilerThreadsARB){this->m_next_glMaxShaderCompilerThreadsARB = this->m_ptr_glMaxShaderCompilerThreadsARB;this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&ProfileTableDecorator::m_glMaxShaderCompilerThreadsARB_profile;}
+if(this->m_ptr_glUniformMatrix4x2dv){this->m_next_glUniformMatrix4x2dv = this->m_ptr_glUniformMatrix4x2dv;this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&ProfileTableDecorator::m_glUniformMatrix4x2dv_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT){this->m_next_glVertexArrayVertexAttribLOffsetEXT = this->m_ptr_glVertexArrayVertexAttribLOffsetEXT;this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_profile;}
+if(this->m_ptr_glSecondaryColor3s){this->m_next_glSecondaryColor3s = this->m_ptr_glSecondaryColor3s;this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&ProfileTableDecorator::m_glSecondaryColor3s_profile;}
+if(this->m_ptr_glIsImageHandleResidentNV){this->m_next_glIsImageHandleResidentNV = this->m_ptr_glIsImageHandleResidentNV;this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&ProfileTableDecorator::m_glIsImageHandleResidentNV_profile;}
+if(this->m_ptr_glUniform3iv){this->m_next_glUniform3iv = this->m_ptr_glUniform3iv;this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&ProfileTableDecorator::m_glUniform3iv_profile;}
+if(this->m_ptr_glVertexAttribL3i64vNV){this->m_next_glVertexAttribL3i64vNV = this->m_ptr_glVertexAttribL3i64vNV;this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL3i64vNV_profile;}
+if(this->m_ptr_glPolygonMode){this->m_next_glPolygonMode = this->m_ptr_glPolygonMode;this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&ProfileTableDecorator::m_glPolygonMode_profile;}
+if(this->m_ptr_glFramebufferSamplePositionsfvAMD){this->m_next_glFramebufferSamplePositionsfvAMD = this->m_ptr_glFramebufferSamplePositionsfvAMD;this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ProfileTableDecorator::m_glFramebufferSamplePositionsfvAMD_profile;}
+if(this->m_ptr_glConvolutionFilter1DEXT){this->m_next_glConvolutionFilter1DEXT = this->m_ptr_glConvolutionFilter1DEXT;this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&ProfileTableDecorator::m_glConvolutionFilter1DEXT_profile;}
+if(this->m_ptr_glVertexAttrib1dvARB){this->m_next_glVertexAttrib1dvARB = this->m_ptr_glVertexAttrib1dvARB;this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&ProfileTableDecorator::m_glVertexAttrib1dvARB_profile;}
+if(this->m_ptr_glTextureSubImage2DEXT){this->m_next_glTextureSubImage2DEXT = this->m_ptr_glTextureSubImage2DEXT;this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glTextureSubImage2DEXT_profile;}
+if(this->m_ptr_glIsVertexArrayAPPLE){this->m_next_glIsVertexArrayAPPLE = this->m_ptr_glIsVertexArrayAPPLE;this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&ProfileTableDecorator::m_glIsVertexArrayAPPLE_profile;}
+if(this->m_ptr_glUseProgram){this->m_next_glUseProgram = this->m_ptr_glUseProgram;this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&ProfileTableDecorator::m_glUseProgram_profile;}
+if(this->m_ptr_glLineStipple){this->m_next_glLineStipple = this->m_ptr_glLineStipple;this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&ProfileTableDecorator::m_glLineStipple_profile;}
+if(this->m_ptr_glMultiTexCoord4fvARB){this->m_next_glMultiTexCoord4fvARB = this->m_ptr_glMultiTexCoord4fvARB;this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4fvARB_profile;}
+if(this->m_ptr_glVideoCaptureNV){this->m_next_glVideoCaptureNV = this->m_ptr_glVideoCaptureNV;this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&ProfileTableDecorator::m_glVideoCaptureNV_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT){this->m_next_glVertexArrayVertexAttribLFormatEXT = this->m_ptr_glVertexArrayVertexAttribLFormatEXT;this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_profile;}
+if(this->m_ptr_glUniform3fvARB){this->m_next_glUniform3fvARB = this->m_ptr_glUniform3fvARB;this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&ProfileTableDecorator::m_glUniform3fvARB_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT){this->m_next_glProgramUniformMatrix3x2fvEXT = this->m_ptr_glProgramUniformMatrix3x2fvEXT;this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x2fvEXT_profile;}
+if(this->m_ptr_glCopyTextureSubImage3DEXT){this->m_next_glCopyTextureSubImage3DEXT = this->m_ptr_glCopyTextureSubImage3DEXT;this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCopyTextureSubImage3DEXT_profile;}
+if(this->m_ptr_glMultiTexCoord2bvOES){this->m_next_glMultiTexCoord2bvOES = this->m_ptr_glMultiTexCoord2bvOES;this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord2bvOES_profile;}
+if(this->m_ptr_glDeleteObjectARB){this->m_next_glDeleteObjectARB = this->m_ptr_glDeleteObjectARB;this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&ProfileTableDecorator::m_glDeleteObjectARB_profile;}
+if(this->m_ptr_glTextureLightEXT){this->m_next_glTextureLightEXT = this->m_ptr_glTextureLightEXT;this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&ProfileTableDecorator::m_glTextureLightEXT_profile;}
+if(this->m_ptr_glRasterPos3i){this->m_next_glRasterPos3i = this->m_ptr_glRasterPos3i;this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&ProfileTableDecorator::m_glRasterPos3i_profile;}
+if(this->m_ptr_glMultiTexCoord3dARB){this->m_next_glMultiTexCoord3dARB = this->m_ptr_glMultiTexCoord3dARB;this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3dARB_profile;}
+if(this->m_ptr_glNamedFramebufferTextureEXT){this->m_next_glNamedFramebufferTextureEXT = this->m_ptr_glNamedFramebufferTextureEXT;this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTextureEXT_profile;}
+if(this->m_ptr_glTextureParameteriEXT){this->m_next_glTextureParameteriEXT = this->m_ptr_glTextureParameteriEXT;this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&ProfileTableDecorator::m_glTextureParameteriEXT_profile;}
+if(this->m_ptr_glEvalCoord2xvOES){this->m_next_glEvalCoord2xvOES = this->m_ptr_glEvalCoord2xvOES;this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&ProfileTableDecorator::m_glEvalCoord2xvOES_profile;}
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV){this->m_next_glBindVideoCaptureStreamBufferNV = this->m_ptr_glBindVideoCaptureStreamBufferNV;this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&ProfileTableDecorator::m_glBindVideoCaptureStreamBufferNV_profile;}
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV){this->m_next_glTexImage2DMultisampleCoverageNV = this->m_ptr_glTexImage2DMultisampleCoverageNV;this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfileTableDecorator::m_glTexImage2DMultisampleCoverageNV_profile;}
+if(this->m_ptr_glGetAttribLocationARB){this->m_next_glGetAttribLocationARB = this->m_ptr_glGetAttribLocationARB;this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&ProfileTableDecorator::m_glGetAttribLocationARB_profile;}
+if(this->m_ptr_glDeleteShader){this->m_next_glDeleteShader = this->m_ptr_glDeleteShader;this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&ProfileTableDecorator::m_glDeleteShader_profile;}
+if(this->m_ptr_glVertexAttrib1fARB){this->m_next_glVertexAttrib1fARB = this->m_ptr_glVertexAttrib1fARB;this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&ProfileTableDecorator::m_glVertexAttrib1fARB_profile;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN){this->m_next_glTexCoord2fColor4ubVertex3fSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_profile;}
+if(this->m_ptr_glTexCoord4fVertex4fSUN){this->m_next_glTexCoord4fVertex4fSUN = this->m_ptr_glTexCoord4fVertex4fSUN;this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&ProfileTableDecorator::m_glTexCoord4fVertex4fSUN_profile;}
+if(this->m_ptr_glGetMapdv){this->m_next_glGetMapdv = this->m_ptr_glGetMapdv;this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&ProfileTableDecorator::m_glGetMapdv_profile;}
+if(this->m_ptr_glMapParameterfvNV){this->m_next_glMapParameterfvNV = this->m_ptr_glMapParameterfvNV;this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&ProfileTableDecorator::m_glMapParameterfvNV_profile;}
+if(this->m_ptr_glTextureParameterIuiv){this->m_next_glTextureParameterIuiv = this->m_ptr_glTextureParameterIuiv;this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&ProfileTableDecorator::m_glTextureParameterIuiv_profile;}
+if(this->m_ptr_glTransformFeedbackAttribsNV){this->m_next_glTransformFeedbackAttribsNV = this->m_ptr_glTransformFeedbackAttribsNV;this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&ProfileTableDecorator::m_glTransformFeedbackAttribsNV_profile;}
+if(this->m_ptr_glFragmentLightfvSGIX){this->m_next_glFragmentLightfvSGIX = this->m_ptr_glFragmentLightfvSGIX;this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&ProfileTableDecorator::m_glFragmentLightfvSGIX_profile;}
+if(this->m_ptr_glWindowPos3sARB){this->m_next_glWindowPos3sARB = this->m_ptr_glWindowPos3sARB;this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&ProfileTableDecorator::m_glWindowPos3sARB_profile;}
+if(this->m_ptr_glGetConvolutionParameterfv){this->m_next_glGetConvolutionParameterfv = this->m_ptr_glGetConvolutionParameterfv;this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&ProfileTableDecorator::m_glGetConvolutionParameterfv_profile;}
+if(this->m_ptr_glCopyTexSubImage3D){this->m_next_glCopyTexSubImage3D = this->m_ptr_glCopyTexSubImage3D;this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&ProfileTableDecorator::m_glCopyTexSubImage3D_profile;}
+if(this->m_ptr_glVertexAttribI3i){this->m_next_glVertexAttribI3i = this->m_ptr_glVertexAttribI3i;this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&ProfileTableDecorator::m_glVertexAttribI3i_profile;}
+if(this->m_ptr_glCreateShaderObjectARB){this->m_next_glCreateShaderObjectARB = this->m_ptr_glCreateShaderObjectARB;this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&ProfileTableDecorator::m_glCreateShaderObjectARB_profile;}
+if(this->m_ptr_glVertexAttribFormat){this->m_next_glVertexAttribFormat = this->m_ptr_glVertexAttribFormat;this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&ProfileTableDecorator::m_glVertexAttribFormat_profile;}
+if(this->m_ptr_glGetProgramivARB){this->m_next_glGetProgramivARB = this->m_ptr_glGetProgramivARB;this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&ProfileTableDecorator::m_glGetProgramivARB_profile;}
+if(this->m_ptr_glVertexAttribI4usv){this->m_next_glVertexAttribI4usv = this->m_ptr_glVertexAttribI4usv;this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&ProfileTableDecorator::m_glVertexAttribI4usv_profile;}
+if(this->m_ptr_glTexParameterf){this->m_next_glTexParameterf = this->m_ptr_glTexParameterf;this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&ProfileTableDecorator::m_glTexParameterf_profile;}
+if(this->m_ptr_glVertexAttribBinding){this->m_next_glVertexAttribBinding = this->m_ptr_glVertexAttribBinding;this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&ProfileTableDecorator::m_glVertexAttribBinding_profile;}
+if(this->m_ptr_glGetHistogramParameteriv){this->m_next_glGetHistogramParameteriv = this->m_ptr_glGetHistogramParameteriv;this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&ProfileTableDecorator::m_glGetHistogramParameteriv_profile;}
+if(this->m_ptr_glTexParameteri){this->m_next_glTexParameteri = this->m_ptr_glTexParameteri;this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&ProfileTableDecorator::m_glTexParameteri_profile;}
+if(this->m_ptr_glGetShaderSource){this->m_next_glGetShaderSource = this->m_ptr_glGetShaderSource;this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&ProfileTableDecorator::m_glGetShaderSource_profile;}
+if(this->m_ptr_glVertexAttrib4s){this->m_next_glVertexAttrib4s = this->m_ptr_glVertexAttrib4s;this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&ProfileTableDecorator::m_glVertexAttrib4s_profile;}
+if(this->m_ptr_glVertexAttrib4dvNV){this->m_next_glVertexAttrib4dvNV = this->m_ptr_glVertexAttrib4dvNV;this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&ProfileTableDecorator::m_glVertexAttrib4dvNV_profile;}
+if(this->m_ptr_glVertexAttrib1dvNV){this->m_next_glVertexAttrib1dvNV = this->m_ptr_glVertexAttrib1dvNV;this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&ProfileTableDecorator::m_glVertexAttrib1dvNV_profile;}
+if(this->m_ptr_glPopName){this->m_next_glPopName = this->m_ptr_glPopName;this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&ProfileTableDecorator::m_glPopName_profile;}
+if(this->m_ptr_glTextureBufferEXT){this->m_next_glTextureBufferEXT = this->m_ptr_glTextureBufferEXT;this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&ProfileTableDecorator::m_glTextureBufferEXT_profile;}
+if(this->m_ptr_glGetMultiTexImageEXT){this->m_next_glGetMultiTexImageEXT = this->m_ptr_glGetMultiTexImageEXT;this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&ProfileTableDecorator::m_glGetMultiTexImageEXT_profile;}
+if(this->m_ptr_glGetPointerIndexedvEXT){this->m_next_glGetPointerIndexedvEXT = this->m_ptr_glGetPointerIndexedvEXT;this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&ProfileTableDecorator::m_glGetPointerIndexedvEXT_profile;}
+if(this->m_ptr_glIsNameAMD){this->m_next_glIsNameAMD = this->m_ptr_glIsNameAMD;this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&ProfileTableDecorator::m_glIsNameAMD_profile;}
+if(this->m_ptr_glColor4ub){this->m_next_glColor4ub = this->m_ptr_glColor4ub;this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&ProfileTableDecorator::m_glColor4ub_profile;}
+if(this->m_ptr_glBufferParameteriAPPLE){this->m_next_glBufferParameteriAPPLE = this->m_ptr_glBufferParameteriAPPLE;this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&ProfileTableDecorator::m_glBufferParameteriAPPLE_profile;}
+if(this->m_ptr_glColor4ui){this->m_next_glColor4ui = this->m_ptr_glColor4ui;this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&ProfileTableDecorator::m_glColor4ui_profile;}
+if(this->m_ptr_glGetInternalformativ){this->m_next_glGetInternalformativ = this->m_ptr_glGetInternalformativ;this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&ProfileTableDecorator::m_glGetInternalformativ_profile;}
+if(this->m_ptr_glColor4us){this->m_next_glColor4us = this->m_ptr_glColor4us;this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&ProfileTableDecorator::m_glColor4us_profile;}
+if(this->m_ptr_glVertexAttribP1uiv){this->m_next_glVertexAttribP1uiv = this->m_ptr_glVertexAttribP1uiv;this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&ProfileTableDecorator::m_glVertexAttribP1uiv_profile;}
+if(this->m_ptr_glLinkProgram){this->m_next_glLinkProgram = this->m_ptr_glLinkProgram;this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&ProfileTableDecorator::m_glLinkProgram_profile;}
+if(this->m_ptr_glTexCoord3s){this->m_next_glTexCoord3s = this->m_ptr_glTexCoord3s;this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&ProfileTableDecorator::m_glTexCoord3s_profile;}
+if(this->m_ptr_glTexCoord2dv){this->m_next_glTexCoord2dv = this->m_ptr_glTexCoord2dv;this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&ProfileTableDecorator::m_glTexCoord2dv_profile;}
+if(this->m_ptr_glGetObjectLabel){this->m_next_glGetObjectLabel = this->m_ptr_glGetObjectLabel;this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&ProfileTableDecorator::m_glGetObjectLabel_profile;}
+if(this->m_ptr_glVertexPointerEXT){this->m_next_glVertexPointerEXT = this->m_ptr_glVertexPointerEXT;this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&ProfileTableDecorator::m_glVertexPointerEXT_profile;}
+if(this->m_ptr_glDebugMessageCallbackARB){this->m_next_glDebugMessageCallbackARB = this->m_ptr_glDebugMessageCallbackARB;this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&ProfileTableDecorator::m_glDebugMessageCallbackARB_profile;}
+if(this->m_ptr_glGetString){this->m_next_glGetString = this->m_ptr_glGetString;this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&ProfileTableDecorator::m_glGetString_profile;}
+if(this->m_ptr_glGetPathParameterfvNV){this->m_next_glGetPathParameterfvNV = this->m_ptr_glGetPathParameterfvNV;this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetPathParameterfvNV_profile;}
+if(this->m_ptr_glLightxvOES){this->m_next_glLightxvOES = this->m_ptr_glLightxvOES;this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&ProfileTableDecorator::m_glLightxvOES_profile;}
+if(this->m_ptr_glEndQuery){this->m_next_glEndQuery = this->m_ptr_glEndQuery;this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&ProfileTableDecorator::m_glEndQuery_profile;}
+if(this->m_ptr_glSecondaryColor3uiv){this->m_next_glSecondaryColor3uiv = this->m_ptr_glSecondaryColor3uiv;this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&ProfileTableDecorator::m_glSecondaryColor3uiv_profile;}
+if(this->m_ptr_glPrioritizeTexturesxOES){this->m_next_glPrioritizeTexturesxOES = this->m_ptr_glPrioritizeTexturesxOES;this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&ProfileTableDecorator::m_glPrioritizeTexturesxOES_profile;}
+if(this->m_ptr_glEdgeFlagPointer){this->m_next_glEdgeFlagPointer = this->m_ptr_glEdgeFlagPointer;this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&ProfileTableDecorator::m_glEdgeFlagPointer_profile;}
+if(this->m_ptr_glFramebufferParameteri){this->m_next_glFramebufferParameteri = this->m_ptr_glFramebufferParameteri;this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&ProfileTableDecorator::m_glFramebufferParameteri_profile;}
+if(this->m_ptr_glTexCoord3hNV){this->m_next_glTexCoord3hNV = this->m_ptr_glTexCoord3hNV;this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&ProfileTableDecorator::m_glTexCoord3hNV_profile;}
+if(this->m_ptr_glMultiModeDrawElementsIBM){this->m_next_glMultiModeDrawElementsIBM = this->m_ptr_glMultiModeDrawElementsIBM;this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&ProfileTableDecorator::m_glMultiModeDrawElementsIBM_profile;}
+if(this->m_ptr_glCopyPixels){this->m_next_glCopyPixels = this->m_ptr_glCopyPixels;this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&ProfileTableDecorator::m_glCopyPixels_profile;}
+if(this->m_ptr_glVertexAttribI2ui){this->m_next_glVertexAttribI2ui = this->m_ptr_glVertexAttribI2ui;this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&ProfileTableDecorator::m_glVertexAttribI2ui_profile;}
+if(this->m_ptr_glClampColorARB){this->m_next_glClampColorARB = this->m_ptr_glClampColorARB;this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&ProfileTableDecorator::m_glClampColorARB_profile;}
+if(this->m_ptr_glColorPointervINTEL){this->m_next_glColorPointervINTEL = this->m_ptr_glColorPointervINTEL;this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&ProfileTableDecorator::m_glColorPointervINTEL_profile;}
+if(this->m_ptr_glDeleteTextures){this->m_next_glDeleteTextures = this->m_ptr_glDeleteTextures;this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&ProfileTableDecorator::m_glDeleteTextures_profile;}
+if(this->m_ptr_glGetMinmaxParameterfvEXT){this->m_next_glGetMinmaxParameterfvEXT = this->m_ptr_glGetMinmaxParameterfvEXT;this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetMinmaxParameterfvEXT_profile;}
+if(this->m_ptr_glWindowPos3sMESA){this->m_next_glWindowPos3sMESA = this->m_ptr_glWindowPos3sMESA;this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&ProfileTableDecorator::m_glWindowPos3sMESA_profile;}
+if(this->m_ptr_glVertexAttrib4f){this->m_next_glVertexAttrib4f = this->m_ptr_glVertexAttrib4f;this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&ProfileTableDecorator::m_glVertexAttrib4f_profile;}
+if(this->m_ptr_glNamedFramebufferParameteri){this->m_next_glNamedFramebufferParameteri = this->m_ptr_glNamedFramebufferParameteri;this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&ProfileTableDecorator::m_glNamedFramebufferParameteri_profile;}
+if(this->m_ptr_glTexCoord2fVertex3fvSUN){this->m_next_glTexCoord2fVertex3fvSUN = this->m_ptr_glTexCoord2fVertex3fvSUN;this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glTexCoord2fVertex3fvSUN_profile;}
+if(this->m_ptr_glReplacementCodeusSUN){this->m_next_glReplacementCodeusSUN = this->m_ptr_glReplacementCodeusSUN;this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&ProfileTableDecorator::m_glReplacementCodeusSUN_profile;}
+if(this->m_ptr_glGetNamedFramebufferParameteriv){this->m_next_glGetNamedFramebufferParameteriv = this->m_ptr_glGetNamedFramebufferParameteriv;this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetNamedFramebufferParameteriv_profile;}
+if(this->m_ptr_glVertexStream1fvATI){this->m_next_glVertexStream1fvATI = this->m_ptr_glVertexStream1fvATI;this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&ProfileTableDecorator::m_glVertexStream1fvATI_profile;}
+if(this->m_ptr_glCreateVertexArrays){this->m_next_glCreateVertexArrays = this->m_ptr_glCreateVertexArrays;this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&ProfileTableDecorator::m_glCreateVertexArrays_profile;}
+if(this->m_ptr_glBeginConditionalRender){this->m_next_glBeginConditionalRender = this->m_ptr_glBeginConditionalRender;this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&ProfileTableDecorator::m_glBeginConditionalRender_profile;}
+if(this->m_ptr_glGetUnsignedBytevEXT){this->m_next_glGetUnsignedBytevEXT = this->m_ptr_glGetUnsignedBytevEXT;this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&ProfileTableDecorator::m_glGetUnsignedBytevEXT_profile;}
+if(this->m_ptr_glConvolutionFilter1D){this->m_next_glConvolutionFilter1D = this->m_ptr_glConvolutionFilter1D;this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&ProfileTableDecorator::m_glConvolutionFilter1D_profile;}
+if(this->m_ptr_glMultiTexCoord3fARB){this->m_next_glMultiTexCoord3fARB = this->m_ptr_glMultiTexCoord3fARB;this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3fARB_profile;}
+if(this->m_ptr_glGetQueryObjectuivARB){this->m_next_glGetQueryObjectuivARB = this->m_ptr_glGetQueryObjectuivARB;this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&ProfileTableDecorator::m_glGetQueryObjectuivARB_profile;}
+if(this->m_ptr_glScalexOES){this->m_next_glScalexOES = this->m_ptr_glScalexOES;this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&ProfileTableDecorator::m_glScalexOES_profile;}
+if(this->m_ptr_glSamplerParameteri){this->m_next_glSamplerParameteri = this->m_ptr_glSamplerParameteri;this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&ProfileTableDecorator::m_glSamplerParameteri_profile;}
+if(this->m_ptr_glSamplerParameterf){this->m_next_glSamplerParameterf = this->m_ptr_glSamplerParameterf;this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&ProfileTableDecorator::m_glSamplerParameterf_profile;}
+if(this->m_ptr_glShaderOp1EXT){this->m_next_glShaderOp1EXT = this->m_ptr_glShaderOp1EXT;this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&ProfileTableDecorator::m_glShaderOp1EXT_profile;}
+if(this->m_ptr_glBeginVideoCaptureNV){this->m_next_glBeginVideoCaptureNV = this->m_ptr_glBeginVideoCaptureNV;this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&ProfileTableDecorator::m_glBeginVideoCaptureNV_profile;}
+if(this->m_ptr_glGetnHistogram){this->m_next_glGetnHistogram = this->m_ptr_glGetnHistogram;this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&ProfileTableDecorator::m_glGetnHistogram_profile;}
+if(this->m_ptr_glUniform1d){this->m_next_glUniform1d = this->m_ptr_glUniform1d;this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&ProfileTableDecorator::m_glUniform1d_profile;}
+if(this->m_ptr_glRenderMode){this->m_next_glRenderMode = this->m_ptr_glRenderMode;this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&ProfileTableDecorator::m_glRenderMode_profile;}
+if(this->m_ptr_glClearColorIiEXT){this->m_next_glClearColorIiEXT = this->m_ptr_glClearColorIiEXT;this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&ProfileTableDecorator::m_glClearColorIiEXT_profile;}
+if(this->m_ptr_glSignalSemaphoreEXT){this->m_next_glSignalSemaphoreEXT = this->m_ptr_glSignalSemaphoreEXT;this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&ProfileTableDecorator::m_glSignalSemaphoreEXT_profile;}
+if(this->m_ptr_glGetCompressedTexImage){this->m_next_glGetCompressedTexImage = this->m_ptr_glGetCompressedTexImage;this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&ProfileTableDecorator::m_glGetCompressedTexImage_profile;}
+if(this->m_ptr_glCompressedTextureImage1DEXT){this->m_next_glCompressedTextureImage1DEXT = this->m_ptr_glCompressedTextureImage1DEXT;this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureImage1DEXT_profile;}
+if(this->m_ptr_glGetActiveUniformBlockiv){this->m_next_glGetActiveUniformBlockiv = this->m_ptr_glGetActiveUniformBlockiv;this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&ProfileTableDecorator::m_glGetActiveUniformBlockiv_profile;}
+if(this->m_ptr_glUniform1i){this->m_next_glUniform1i = this->m_ptr_glUniform1i;this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&ProfileTableDecorator::m_glUniform1i_profile;}
+if(this->m_ptr_glMultiDrawArraysIndirectCount){this->m_next_glMultiDrawArraysIndirectCount = this->m_ptr_glMultiDrawArraysIndirectCount;this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirectCount_profile;}
+if(this->m_ptr_glGetTexEnvfv){this->m_next_glGetTexEnvfv = this->m_ptr_glGetTexEnvfv;this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&ProfileTableDecorator::m_glGetTexEnvfv_profile;}
+if(this->m_ptr_glColorTableParameterivSGI){this->m_next_glColorTableParameterivSGI = this->m_ptr_glColorTableParameterivSGI;this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&ProfileTableDecorator::m_glColorTableParameterivSGI_profile;}
+if(this->m_ptr_glCullFace){this->m_next_glCullFace = this->m_ptr_glCullFace;this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&ProfileTableDecorator::m_glCullFace_profile;}
+if(this->m_ptr_glDeleteFencesAPPLE){this->m_next_glDeleteFencesAPPLE = this->m_ptr_glDeleteFencesAPPLE;this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&ProfileTableDecorator::m_glDeleteFencesAPPLE_profile;}
+if(this->m_ptr_glProgramUniform4i){this->m_next_glProgramUniform4i = this->m_ptr_glProgramUniform4i;this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&ProfileTableDecorator::m_glProgramUniform4i_profile;}
+if(this->m_ptr_glUniformHandleui64ARB){this->m_next_glUniformHandleui64ARB = this->m_ptr_glUniformHandleui64ARB;this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&ProfileTableDecorator::m_glUniformHandleui64ARB_profile;}
+if(this->m_ptr_glProgramUniform4f){this->m_next_glProgramUniform4f = this->m_ptr_glProgramUniform4f;this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&ProfileTableDecorator::m_glProgramUniform4f_profile;}
+if(this->m_ptr_glViewportIndexedf){this->m_next_glViewportIndexedf = this->m_ptr_glViewportIndexedf;this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&ProfileTableDecorator::m_glViewportIndexedf_profile;}
+if(this->m_ptr_glProgramUniform4d){this->m_next_glProgramUniform4d = this->m_ptr_glProgramUniform4d;this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&ProfileTableDecorator::m_glProgramUniform4d_profile;}
+if(this->m_ptr_glTexCoord1xOES){this->m_next_glTexCoord1xOES = this->m_ptr_glTexCoord1xOES;this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&ProfileTableDecorator::m_glTexCoord1xOES_profile;}
+if(this->m_ptr_glVertexStream3ivATI){this->m_next_glVertexStream3ivATI = this->m_ptr_glVertexStream3ivATI;this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&ProfileTableDecorator::m_glVertexStream3ivATI_profile;}
+if(this->m_ptr_glPointAlongPathNV){this->m_next_glPointAlongPathNV = this->m_ptr_glPointAlongPathNV;this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&ProfileTableDecorator::m_glPointAlongPathNV_profile;}
+if(this->m_ptr_glEndQueryARB){this->m_next_glEndQueryARB = this->m_ptr_glEndQueryARB;this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&ProfileTableDecorator::m_glEndQueryARB_profile;}
+if(this->m_ptr_glVDPAUMapSurfacesNV){this->m_next_glVDPAUMapSurfacesNV = this->m_ptr_glVDPAUMapSurfacesNV;this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&ProfileTableDecorator::m_glVDPAUMapSurfacesNV_profile;}
+if(this->m_ptr_glVertex3i){this->m_next_glVertex3i = this->m_ptr_glVertex3i;this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&ProfileTableDecorator::m_glVertex3i_profile;}
+if(this->m_ptr_glVertexAttrib4uivARB){this->m_next_glVertexAttrib4uivARB = this->m_ptr_glVertexAttrib4uivARB;this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4uivARB_profile;}
+if(this->m_ptr_glTextureStorageMem3DEXT){this->m_next_glTextureStorageMem3DEXT = this->m_ptr_glTextureStorageMem3DEXT;this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&ProfileTableDecorator::m_glTextureStorageMem3DEXT_profile;}
+if(this->m_ptr_glAttachShader){this->m_next_glAttachShader = this->m_ptr_glAttachShader;this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&ProfileTableDecorator::m_glAttachShader_profile;}
+if(this->m_ptr_glColor4hNV){this->m_next_glColor4hNV = this->m_ptr_glColor4hNV;this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&ProfileTableDecorator::m_glColor4hNV_profile;}
+if(this->m_ptr_glGetFenceivNV){this->m_next_glGetFenceivNV = this->m_ptr_glGetFenceivNV;this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&ProfileTableDecorator::m_glGetFenceivNV_profile;}
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN){this->m_next_glTexCoord2fColor4ubVertex3fvSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN;this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_profile;}
+if(this->m_ptr_glGetColorTable){this->m_next_glGetColorTable = this->m_ptr_glGetColorTable;this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&ProfileTableDecorator::m_glGetColorTable_profile;}
+if(this->m_ptr_glFogCoordPointer){this->m_next_glFogCoordPointer = this->m_ptr_glFogCoordPointer;this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&ProfileTableDecorator::m_glFogCoordPointer_profile;}
+if(this->m_ptr_glTexStorageSparseAMD){this->m_next_glTexStorageSparseAMD = this->m_ptr_glTexStorageSparseAMD;this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&ProfileTableDecorator::m_glTexStorageSparseAMD_profile;}
+if(this->m_ptr_glUnmapNamedBuffer){this->m_next_glUnmapNamedBuffer = this->m_ptr_glUnmapNamedBuffer;this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&ProfileTableDecorator::m_glUnmapNamedBuffer_profile;}
+if(this->m_ptr_glTexCoord4bvOES){this->m_next_glTexCoord4bvOES = this->m_ptr_glTexCoord4bvOES;this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&ProfileTableDecorator::m_glTexCoord4bvOES_profile;}
+if(this->m_ptr_glVertexAttrib3fARB){this->m_next_glVertexAttrib3fARB = this->m_ptr_glVertexAttrib3fARB;this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&ProfileTableDecorator::m_glVertexAttrib3fARB_profile;}
+if(this->m_ptr_glRasterPos2xOES){this->m_next_glRasterPos2xOES = this->m_ptr_glRasterPos2xOES;this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&ProfileTableDecorator::m_glRasterPos2xOES_profile;}
+if(this->m_ptr_glCreateMemoryObjectsEXT){this->m_next_glCreateMemoryObjectsEXT = this->m_ptr_glCreateMemoryObjectsEXT;this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&ProfileTableDecorator::m_glCreateMemoryObjectsEXT_profile;}
+if(this->m_ptr_glColor4ubVertex2fvSUN){this->m_next_glColor4ubVertex2fvSUN = this->m_ptr_glColor4ubVertex2fvSUN;this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&ProfileTableDecorator::m_glColor4ubVertex2fvSUN_profile;}
+if(this->m_ptr_glSecondaryColor3dv){this->m_next_glSecondaryColor3dv = this->m_ptr_glSecondaryColor3dv;this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&ProfileTableDecorator::m_glSecondaryColor3dv_profile;}
+if(this->m_ptr_glVertexAttribI4sv){this->m_next_glVertexAttribI4sv = this->m_ptr_glVertexAttribI4sv;this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&ProfileTableDecorator::m_glVertexAttribI4sv_profile;}
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced){this->m_next_glDrawTransformFeedbackStreamInstanced = this->m_ptr_glDrawTransformFeedbackStreamInstanced;this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&ProfileTableDecorator::m_glDrawTransformFeedbackStreamInstanced_profile;}
+if(this->m_ptr_glMultiTexCoord4ivARB){this->m_next_glMultiTexCoord4ivARB = this->m_ptr_glMultiTexCoord4ivARB;this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4ivARB_profile;}
+if(this->m_ptr_glSpriteParameterfSGIX){this->m_next_glSpriteParameterfSGIX = this->m_ptr_glSpriteParameterfSGIX;this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&ProfileTableDecorator::m_glSpriteParameterfSGIX_profile;}
+if(this->m_ptr_glSecondaryColor3sv){this->m_next_glSecondaryColor3sv = this->m_ptr_glSecondaryColor3sv;this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&ProfileTableDecorator::m_glSecondaryColor3sv_profile;}
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV){this->m_next_glBindVideoCaptureStreamTextureNV = this->m_ptr_glBindVideoCaptureStreamTextureNV;this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&ProfileTableDecorator::m_glBindVideoCaptureStreamTextureNV_profile;}
+if(this->m_ptr_glTexParameterIuiv){this->m_next_glTexParameterIuiv = this->m_ptr_glTexParameterIuiv;this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&ProfileTableDecorator::m_glTexParameterIuiv_profile;}
+if(this->m_ptr_glFlushPixelDataRangeNV){this->m_next_glFlushPixelDataRangeNV = this->m_ptr_glFlushPixelDataRangeNV;this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&ProfileTableDecorator::m_glFlushPixelDataRangeNV_profile;}
+if(this->m_ptr_glWindowPos3fv){this->m_next_glWindowPos3fv = this->m_ptr_glWindowPos3fv;this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&ProfileTableDecorator::m_glWindowPos3fv_profile;}
+if(this->m_ptr_glVertexAttribLFormatNV){this->m_next_glVertexAttribLFormatNV = this->m_ptr_glVertexAttribLFormatNV;this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&ProfileTableDecorator::m_glVertexAttribLFormatNV_profile;}
+if(this->m_ptr_glLightModelfv){this->m_next_glLightModelfv = this->m_ptr_glLightModelfv;this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&ProfileTableDecorator::m_glLightModelfv_profile;}
+if(this->m_ptr_glGetColorTableSGI){this->m_next_glGetColorTableSGI = this->m_ptr_glGetColorTableSGI;this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&ProfileTableDecorator::m_glGetColorTableSGI_profile;}
+if(this->m_ptr_glGetCompressedTexImageARB){this->m_next_glGetCompressedTexImageARB = this->m_ptr_glGetCompressedTexImageARB;this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&ProfileTableDecorator::m_glGetCompressedTexImageARB_profile;}
+if(this->m_ptr_glConvolutionParameteri){this->m_next_glConvolutionParameteri = this->m_ptr_glConvolutionParameteri;this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&ProfileTableDecorator::m_glConvolutionParameteri_profile;}
+if(this->m_ptr_glVertexWeighthNV){this->m_next_glVertexWeighthNV = this->m_ptr_glVertexWeighthNV;this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&ProfileTableDecorator::m_glVertexWeighthNV_profile;}
+if(this->m_ptr_glColorMaskIndexedEXT){this->m_next_glColorMaskIndexedEXT = this->m_ptr_glColorMaskIndexedEXT;this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&ProfileTableDecorator::m_glColorMaskIndexedEXT_profile;}
+if(this->m_ptr_glColorMaski){this->m_next_glColorMaski = this->m_ptr_glColorMaski;this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&ProfileTableDecorator::m_glColorMaski_profile;}
+if(this->m_ptr_glColorFragmentOp1ATI){this->m_next_glColorFragmentOp1ATI = this->m_ptr_glColorFragmentOp1ATI;this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&ProfileTableDecorator::m_glColorFragmentOp1ATI_profile;}
+if(this->m_ptr_glVertexAttribI4ubvEXT){this->m_next_glVertexAttribI4ubvEXT = this->m_ptr_glVertexAttribI4ubvEXT;this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4ubvEXT_profile;}
+if(this->m_ptr_glVertexAttrib1dNV){this->m_next_glVertexAttrib1dNV = this->m_ptr_glVertexAttrib1dNV;this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&ProfileTableDecorator::m_glVertexAttrib1dNV_profile;}
+if(this->m_ptr_glUnmapObjectBufferATI){this->m_next_glUnmapObjectBufferATI = this->m_ptr_glUnmapObjectBufferATI;this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glUnmapObjectBufferATI_profile;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT){this->m_next_glNamedProgramLocalParameterI4uiEXT = this->m_ptr_glNamedProgramLocalParameterI4uiEXT;this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_profile;}
+if(this->m_ptr_glProgramUniform1iEXT){this->m_next_glProgramUniform1iEXT = this->m_ptr_glProgramUniform1iEXT;this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&ProfileTableDecorator::m_glProgramUniform1iEXT_profile;}
+if(this->m_ptr_glDeleteQueriesARB){this->m_next_glDeleteQueriesARB = this->m_ptr_glDeleteQueriesARB;this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&ProfileTableDecorator::m_glDeleteQueriesARB_profile;}
+if(this->m_ptr_glWindowPos3svARB){this->m_next_glWindowPos3svARB = this->m_ptr_glWindowPos3svARB;this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&ProfileTableDecorator::m_glWindowPos3svARB_profile;}
+if(this->m_ptr_glVertex4s){this->m_next_glVertex4s = this->m_ptr_glVertex4s;this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&ProfileTableDecorator::m_glVertex4s_profile;}
+if(this->m_ptr_glImportMemoryWin32NameEXT){this->m_next_glImportMemoryWin32NameEXT = this->m_ptr_glImportMemoryWin32NameEXT;this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&ProfileTableDecorator::m_glImportMemoryWin32NameEXT_profile;}
+if(this->m_ptr_glStringMarkerGREMEDY){this->m_next_glStringMarkerGREMEDY = this->m_ptr_glStringMarkerGREMEDY;this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&ProfileTableDecorator::m_glStringMarkerGREMEDY_profile;}
+if(this->m_ptr_glIsTransformFeedback){this->m_next_glIsTransformFeedback = this->m_ptr_glIsTransformFeedback;this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glIsTransformFeedback_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT){this->m_next_glProgramUniformMatrix2x3dvEXT = this->m_ptr_glProgramUniformMatrix2x3dvEXT;this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x3dvEXT_profile;}
+if(this->m_ptr_glGetObjectLabelEXT){this->m_next_glGetObjectLabelEXT = this->m_ptr_glGetObjectLabelEXT;this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&ProfileTableDecorator::m_glGetObjectLabelEXT_profile;}
+if(this->m_ptr_glUniformHandleui64vNV){this->m_next_glUniformHandleui64vNV = this->m_ptr_glUniformHandleui64vNV;this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&ProfileTableDecorator::m_glUniformHandleui64vNV_profile;}
+if(this->m_ptr_glRotated){this->m_next_glRotated = this->m_ptr_glRotated;this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&ProfileTableDecorator::m_glRotated_profile;}
+if(this->m_ptr_glIsProgramPipeline){this->m_next_glIsProgramPipeline = this->m_ptr_glIsProgramPipeline;this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&ProfileTableDecorator::m_glIsProgramPipeline_profile;}
+if(this->m_ptr_glRotatef){this->m_next_glRotatef = this->m_ptr_glRotatef;this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&ProfileTableDecorator::m_glRotatef_profile;}
+if(this->m_ptr_glVertex4i){this->m_next_glVertex4i = this->m_ptr_glVertex4i;this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&ProfileTableDecorator::m_glVertex4i_profile;}
+if(this->m_ptr_glGetActiveSubroutineUniformName){this->m_next_glGetActiveSubroutineUniformName = this->m_ptr_glGetActiveSubroutineUniformName;this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&ProfileTableDecorator::m_glGetActiveSubroutineUniformName_profile;}
+if(this->m_ptr_glVertexAttrib4sNV){this->m_next_glVertexAttrib4sNV = this->m_ptr_glVertexAttrib4sNV;this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&ProfileTableDecorator::m_glVertexAttrib4sNV_profile;}
+if(this->m_ptr_glProgramLocalParameter4dvARB){this->m_next_glProgramLocalParameter4dvARB = this->m_ptr_glProgramLocalParameter4dvARB;this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&ProfileTableDecorator::m_glProgramLocalParameter4dvARB_profile;}
+if(this->m_ptr_glReplacementCodeubSUN){this->m_next_glReplacementCodeubSUN = this->m_ptr_glReplacementCodeubSUN;this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&ProfileTableDecorator::m_glReplacementCodeubSUN_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV){this->m_next_glMultiDrawElementsIndirectBindlessNV = this->m_ptr_glMultiDrawElementsIndirectBindlessNV;this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_profile;}
+if(this->m_ptr_glImportSemaphoreWin32HandleEXT){this->m_next_glImportSemaphoreWin32HandleEXT = this->m_ptr_glImportSemaphoreWin32HandleEXT;this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&ProfileTableDecorator::m_glImportSemaphoreWin32HandleEXT_profile;}
+if(this->m_ptr_glUniformMatrix3fv){this->m_next_glUniformMatrix3fv = this->m_ptr_glUniformMatrix3fv;this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&ProfileTableDecorator::m_glUniformMatrix3fv_profile;}
+if(this->m_ptr_glGetnMapfvARB){this->m_next_glGetnMapfvARB = this->m_ptr_glGetnMapfvARB;this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&ProfileTableDecorator::m_glGetnMapfvARB_profile;}
+if(this->m_ptr_glGetnUniformfv){this->m_next_glGetnUniformfv = this->m_ptr_glGetnUniformfv;this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&ProfileTableDecorator::m_glGetnUniformfv_profile;}
+if(this->m_ptr_glVertexAttribL2dv){this->m_next_glVertexAttribL2dv = this->m_ptr_glVertexAttribL2dv;this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&ProfileTableDecorator::m_glVertexAttribL2dv_profile;}
+if(this->m_ptr_glVertexWeightPointerEXT){this->m_next_glVertexWeightPointerEXT = this->m_ptr_glVertexWeightPointerEXT;this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&ProfileTableDecorator::m_glVertexWeightPointerEXT_profile;}
+if(this->m_ptr_glTangent3sEXT){this->m_next_glTangent3sEXT = this->m_ptr_glTangent3sEXT;this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&ProfileTableDecorator::m_glTangent3sEXT_profile;}
+if(this->m_ptr_glSecondaryColorPointer){this->m_next_glSecondaryColorPointer = this->m_ptr_glSecondaryColorPointer;this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&ProfileTableDecorator::m_glSecondaryColorPointer_profile;}
+if(this->m_ptr_glAlphaFunc){this->m_next_glAlphaFunc = this->m_ptr_glAlphaFunc;this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&ProfileTableDecorator::m_glAlphaFunc_profile;}
+if(this->m_ptr_glGetNamedStringARB){this->m_next_glGetNamedStringARB = this->m_ptr_glGetNamedStringARB;this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&ProfileTableDecorator::m_glGetNamedStringARB_profile;}
+if(this->m_ptr_glTexCoord4d){this->m_next_glTexCoord4d = this->m_ptr_glTexCoord4d;this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&ProfileTableDecorator::m_glTexCoord4d_profile;}
+if(this->m_ptr_glBufferPageCommitmentARB){this->m_next_glBufferPageCommitmentARB = this->m_ptr_glBufferPageCommitmentARB;this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&ProfileTableDecorator::m_glBufferPageCommitmentARB_profile;}
+if(this->m_ptr_glProgramLocalParameters4fvEXT){this->m_next_glProgramLocalParameters4fvEXT = this->m_ptr_glProgramLocalParameters4fvEXT;this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfileTableDecorator::m_glProgramLocalParameters4fvEXT_profile;}
+if(this->m_ptr_glStencilFunc){this->m_next_glStencilFunc = this->m_ptr_glStencilFunc;this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&ProfileTableDecorator::m_glStencilFunc_profile;}
+if(this->m_ptr_glSemaphoreParameterui64vEXT){this->m_next_glSemaphoreParameterui64vEXT = this->m_ptr_glSemaphoreParameterui64vEXT;this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&ProfileTableDecorator::m_glSemaphoreParameterui64vEXT_profile;}
+if(this->m_ptr_glGetVertexAttribdvNV){this->m_next_glGetVertexAttribdvNV = this->m_ptr_glGetVertexAttribdvNV;this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&ProfileTableDecorator::m_glGetVertexAttribdvNV_profile;}
+if(this->m_ptr_glTexCoord3dv){this->m_next_glTexCoord3dv = this->m_ptr_glTexCoord3dv;this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&ProfileTableDecorator::m_glTexCoord3dv_profile;}
+if(this->m_ptr_glGetQueryBufferObjectiv){this->m_next_glGetQueryBufferObjectiv = this->m_ptr_glGetQueryBufferObjectiv;this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&ProfileTableDecorator::m_glGetQueryBufferObjectiv_profile;}
+if(this->m_ptr_glTexGenxOES){this->m_next_glTexGenxOES = this->m_ptr_glTexGenxOES;this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&ProfileTableDecorator::m_glTexGenxOES_profile;}
+if(this->m_ptr_glMultiTexCoord1fvARB){this->m_next_glMultiTexCoord1fvARB = this->m_ptr_glMultiTexCoord1fvARB;this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1fvARB_profile;}
+if(this->m_ptr_glLightEnviSGIX){this->m_next_glLightEnviSGIX = this->m_ptr_glLightEnviSGIX;this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&ProfileTableDecorator::m_glLightEnviSGIX_profile;}
+if(this->m_ptr_glGetProgramPipelineiv){this->m_next_glGetProgramPipelineiv = this->m_ptr_glGetProgramPipelineiv;this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&ProfileTableDecorator::m_glGetProgramPipelineiv_profile;}
+if(this->m_ptr_glVertexStream2ivATI){this->m_next_glVertexStream2ivATI = this->m_ptr_glVertexStream2ivATI;this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&ProfileTableDecorator::m_glVertexStream2ivATI_profile;}
+if(this->m_ptr_glGetColorTableEXT){this->m_next_glGetColorTableEXT = this->m_ptr_glGetColorTableEXT;this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&ProfileTableDecorator::m_glGetColorTableEXT_profile;}
+if(this->m_ptr_glGetShaderInfoLog){this->m_next_glGetShaderInfoLog = this->m_ptr_glGetShaderInfoLog;this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&ProfileTableDecorator::m_glGetShaderInfoLog_profile;}
+if(this->m_ptr_glGetOcclusionQueryuivNV){this->m_next_glGetOcclusionQueryuivNV = this->m_ptr_glGetOcclusionQueryuivNV;this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&ProfileTableDecorator::m_glGetOcclusionQueryuivNV_profile;}
+if(this->m_ptr_glInvalidateNamedFramebufferSubData){this->m_next_glInvalidateNamedFramebufferSubData = this->m_ptr_glInvalidateNamedFramebufferSubData;this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glInvalidateNamedFramebufferSubData_profile;}
+if(this->m_ptr_glVertexAttribL1i64NV){this->m_next_glVertexAttribL1i64NV = this->m_ptr_glVertexAttribL1i64NV;this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&ProfileTableDecorator::m_glVertexAttribL1i64NV_profile;}
+if(this->m_ptr_glVDPAUInitNV){this->m_next_glVDPAUInitNV = this->m_ptr_glVDPAUInitNV;this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&ProfileTableDecorator::m_glVDPAUInitNV_profile;}
+if(this->m_ptr_glVertexAttrib1hvNV){this->m_next_glVertexAttrib1hvNV = this->m_ptr_glVertexAttrib1hvNV;this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&ProfileTableDecorator::m_glVertexAttrib1hvNV_profile;}
+if(this->m_ptr_glVertexAttribI4i){this->m_next_glVertexAttribI4i = this->m_ptr_glVertexAttribI4i;this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&ProfileTableDecorator::m_glVertexAttribI4i_profile;}
+if(this->m_ptr_glRasterPos2iv){this->m_next_glRasterPos2iv = this->m_ptr_glRasterPos2iv;this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&ProfileTableDecorator::m_glRasterPos2iv_profile;}
+if(this->m_ptr_glGetIntegerui64i_vNV){this->m_next_glGetIntegerui64i_vNV = this->m_ptr_glGetIntegerui64i_vNV;this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&ProfileTableDecorator::m_glGetIntegerui64i_vNV_profile;}
+if(this->m_ptr_glUniformHandleui64NV){this->m_next_glUniformHandleui64NV = this->m_ptr_glUniformHandleui64NV;this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&ProfileTableDecorator::m_glUniformHandleui64NV_profile;}
+if(this->m_ptr_glWindowPos3ivMESA){this->m_next_glWindowPos3ivMESA = this->m_ptr_glWindowPos3ivMESA;this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&ProfileTableDecorator::m_glWindowPos3ivMESA_profile;}
+if(this->m_ptr_glBlendEquationSeparate){this->m_next_glBlendEquationSeparate = this->m_ptr_glBlendEquationSeparate;this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&ProfileTableDecorator::m_glBlendEquationSeparate_profile;}
+if(this->m_ptr_glDrawElementsInstancedARB){this->m_next_glDrawElementsInstancedARB = this->m_ptr_glDrawElementsInstancedARB;this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&ProfileTableDecorator::m_glDrawElementsInstancedARB_profile;}
+if(this->m_ptr_glGetSubroutineIndex){this->m_next_glGetSubroutineIndex = this->m_ptr_glGetSubroutineIndex;this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&ProfileTableDecorator::m_glGetSubroutineIndex_profile;}
+if(this->m_ptr_glVertexAttrib2sv){this->m_next_glVertexAttrib2sv = this->m_ptr_glVertexAttrib2sv;this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&ProfileTableDecorator::m_glVertexAttrib2sv_profile;}
+if(this->m_ptr_glSamplePatternSGIS){this->m_next_glSamplePatternSGIS = this->m_ptr_glSamplePatternSGIS;this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&ProfileTableDecorator::m_glSamplePatternSGIS_profile;}
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES){this->m_next_glEGLImageTargetRenderbufferStorageOES = this->m_ptr_glEGLImageTargetRenderbufferStorageOES;this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&ProfileTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_profile;}
+if(this->m_ptr_glPushAttrib){this->m_next_glPushAttrib = this->m_ptr_glPushAttrib;this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&ProfileTableDecorator::m_glPushAttrib_profile;}
+if(this->m_ptr_glVertex3hNV){this->m_next_glVertex3hNV = this->m_ptr_glVertex3hNV;this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&ProfileTableDecorator::m_glVertex3hNV_profile;}
+if(this->m_ptr_glRasterPos3xvOES){this->m_next_glRasterPos3xvOES = this->m_ptr_glRasterPos3xvOES;this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&ProfileTableDecorator::m_glRasterPos3xvOES_profile;}
+if(this->m_ptr_glPathParameterfNV){this->m_next_glPathParameterfNV = this->m_ptr_glPathParameterfNV;this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&ProfileTableDecorator::m_glPathParameterfNV_profile;}
+if(this->m_ptr_glGetUniformi64vNV){this->m_next_glGetUniformi64vNV = this->m_ptr_glGetUniformi64vNV;this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&ProfileTableDecorator::m_glGetUniformi64vNV_profile;}
+if(this->m_ptr_glLightiv){this->m_next_glLightiv = this->m_ptr_glLightiv;this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&ProfileTableDecorator::m_glLightiv_profile;}
+if(this->m_ptr_glMaterialxvOES){this->m_next_glMaterialxvOES = this->m_ptr_glMaterialxvOES;this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&ProfileTableDecorator::m_glMaterialxvOES_profile;}
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT){this->m_next_glNamedProgramLocalParameter4fEXT = this->m_ptr_glNamedProgramLocalParameter4fEXT;this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameter4fEXT_profile;}
+if(this->m_ptr_glVertexAttribL1dEXT){this->m_next_glVertexAttribL1dEXT = this->m_ptr_glVertexAttribL1dEXT;this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&ProfileTableDecorator::m_glVertexAttribL1dEXT_profile;}
+if(this->m_ptr_glGetnUniformdvARB){this->m_next_glGetnUniformdvARB = this->m_ptr_glGetnUniformdvARB;this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&ProfileTableDecorator::m_glGetnUniformdvARB_profile;}
+if(this->m_ptr_glSecondaryColor3bEXT){this->m_next_glSecondaryColor3bEXT = this->m_ptr_glSecondaryColor3bEXT;this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3bEXT_profile;}
+if(this->m_ptr_glBeginPerfQueryINTEL){this->m_next_glBeginPerfQueryINTEL = this->m_ptr_glBeginPerfQueryINTEL;this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&ProfileTableDecorator::m_glBeginPerfQueryINTEL_profile;}
+if(this->m_ptr_glProgramUniform1uivEXT){this->m_next_glProgramUniform1uivEXT = this->m_ptr_glProgramUniform1uivEXT;this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&ProfileTableDecorator::m_glProgramUniform1uivEXT_profile;}
+if(this->m_ptr_glImageTransformParameterivHP){this->m_next_glImageTransformParameterivHP = this->m_ptr_glImageTransformParameterivHP;this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&ProfileTableDecorator::m_glImageTransformParameterivHP_profile;}
+if(this->m_ptr_glDeleteBuffers){this->m_next_glDeleteBuffers = this->m_ptr_glDeleteBuffers;this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&ProfileTableDecorator::m_glDeleteBuffers_profile;}
+if(this->m_ptr_glBindProgramPipeline){this->m_next_glBindProgramPipeline = this->m_ptr_glBindProgramPipeline;this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&ProfileTableDecorator::m_glBindProgramPipeline_profile;}
+if(this->m_ptr_glScissor){this->m_next_glScissor = this->m_ptr_glScissor;this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&ProfileTableDecorator::m_glScissor_profile;}
+if(this->m_ptr_glProgramUniform4fv){this->m_next_glProgramUniform4fv = this->m_ptr_glProgramUniform4fv;this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&ProfileTableDecorator::m_glProgramUniform4fv_profile;}
+if(this->m_ptr_glGetBooleanv){this->m_next_glGetBooleanv = this->m_ptr_glGetBooleanv;this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&ProfileTableDecorator::m_glGetBooleanv_profile;}
+if(this->m_ptr_glMaterialfv){this->m_next_glMaterialfv = this->m_ptr_glMaterialfv;this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&ProfileTableDecorator::m_glMaterialfv_profile;}
+if(this->m_ptr_glWindowPos4fvMESA){this->m_next_glWindowPos4fvMESA = this->m_ptr_glWindowPos4fvMESA;this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&ProfileTableDecorator::m_glWindowPos4fvMESA_profile;}
+if(this->m_ptr_glVertexAttribIPointerEXT){this->m_next_glVertexAttribIPointerEXT = this->m_ptr_glVertexAttribIPointerEXT;this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&ProfileTableDecorator::m_glVertexAttribIPointerEXT_profile;}
+if(this->m_ptr_glProgramBufferParametersfvNV){this->m_next_glProgramBufferParametersfvNV = this->m_ptr_glProgramBufferParametersfvNV;this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&ProfileTableDecorator::m_glProgramBufferParametersfvNV_profile;}
+if(this->m_ptr_glAlphaFuncxOES){this->m_next_glAlphaFuncxOES = this->m_ptr_glAlphaFuncxOES;this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&ProfileTableDecorator::m_glAlphaFuncxOES_profile;}
+if(this->m_ptr_glMultiDrawArraysIndirectAMD){this->m_next_glMultiDrawArraysIndirectAMD = this->m_ptr_glMultiDrawArraysIndirectAMD;this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirectAMD_profile;}
+if(this->m_ptr_glNormalStream3ivATI){this->m_next_glNormalStream3ivATI = this->m_ptr_glNormalStream3ivATI;this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&ProfileTableDecorator::m_glNormalStream3ivATI_profile;}
+if(this->m_ptr_glTextureImage3DMultisampleNV){this->m_next_glTextureImage3DMultisampleNV = this->m_ptr_glTextureImage3DMultisampleNV;this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&ProfileTableDecorator::m_glTextureImage3DMultisampleNV_profile;}
+if(this->m_ptr_glProgramUniform4uivEXT){this->m_next_glProgramUniform4uivEXT = this->m_ptr_glProgramUniform4uivEXT;this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&ProfileTableDecorator::m_glProgramUniform4uivEXT_profile;}
+if(this->m_ptr_glReplacementCodeusvSUN){this->m_next_glReplacementCodeusvSUN = this->m_ptr_glReplacementCodeusvSUN;this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeusvSUN_profile;}
+if(this->m_ptr_glPollInstrumentsSGIX){this->m_next_glPollInstrumentsSGIX = this->m_ptr_glPollInstrumentsSGIX;this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&ProfileTableDecorator::m_glPollInstrumentsSGIX_profile;}
+if(this->m_ptr_glGetTextureLevelParameteriv){this->m_next_glGetTextureLevelParameteriv = this->m_ptr_glGetTextureLevelParameteriv;this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&ProfileTableDecorator::m_glGetTextureLevelParameteriv_profile;}
+if(this->m_ptr_glVertexAttribI2uiv){this->m_next_glVertexAttribI2uiv = this->m_ptr_glVertexAttribI2uiv;this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&ProfileTableDecorator::m_glVertexAttribI2uiv_profile;}
+if(this->m_ptr_glMapControlPointsNV){this->m_next_glMapControlPointsNV = this->m_ptr_glMapControlPointsNV;this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&ProfileTableDecorator::m_glMapControlPointsNV_profile;}
+if(this->m_ptr_glColor4dv){this->m_next_glColor4dv = this->m_ptr_glColor4dv;this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&ProfileTableDecorator::m_glColor4dv_profile;}
+if(this->m_ptr_glInvalidateBufferSubData){this->m_next_glInvalidateBufferSubData = this->m_ptr_glInvalidateBufferSubData;this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glInvalidateBufferSubData_profile;}
+if(this->m_ptr_glMultiTexCoord1hNV){this->m_next_glMultiTexCoord1hNV = this->m_ptr_glMultiTexCoord1hNV;this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&ProfileTableDecorator::m_glMultiTexCoord1hNV_profile;}
+if(this->m_ptr_glPointParameterfv){this->m_next_glPointParameterfv = this->m_ptr_glPointParameterfv;this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&ProfileTableDecorator::m_glPointParameterfv_profile;}
+if(this->m_ptr_glUniformMatrix2fvARB){this->m_next_glUniformMatrix2fvARB = this->m_ptr_glUniformMatrix2fvARB;this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&ProfileTableDecorator::m_glUniformMatrix2fvARB_profile;}
+if(this->m_ptr_glUniform2fv){this->m_next_glUniform2fv = this->m_ptr_glUniform2fv;this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&ProfileTableDecorator::m_glUniform2fv_profile;}
+if(this->m_ptr_glVertexPointerListIBM){this->m_next_glVertexPointerListIBM = this->m_ptr_glVertexPointerListIBM;this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glVertexPointerListIBM_profile;}
+if(this->m_ptr_glGetMultiTexGenfvEXT){this->m_next_glGetMultiTexGenfvEXT = this->m_ptr_glGetMultiTexGenfvEXT;this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexGenfvEXT_profile;}
+if(this->m_ptr_glGetMinmaxEXT){this->m_next_glGetMinmaxEXT = this->m_ptr_glGetMinmaxEXT;this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&ProfileTableDecorator::m_glGetMinmaxEXT_profile;}
+if(this->m_ptr_glIsFenceNV){this->m_next_glIsFenceNV = this->m_ptr_glIsFenceNV;this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&ProfileTableDecorator::m_glIsFenceNV_profile;}
+if(this->m_ptr_glMatrixFrustumEXT){this->m_next_glMatrixFrustumEXT = this->m_ptr_glMatrixFrustumEXT;this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&ProfileTableDecorator::m_glMatrixFrustumEXT_profile;}
+if(this->m_ptr_glDispatchComputeIndirect){this->m_next_glDispatchComputeIndirect = this->m_ptr_glDispatchComputeIndirect;this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&ProfileTableDecorator::m_glDispatchComputeIndirect_profile;}
+if(this->m_ptr_glQueryResourceNV){this->m_next_glQueryResourceNV = this->m_ptr_glQueryResourceNV;this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&ProfileTableDecorator::m_glQueryResourceNV_profile;}
+if(this->m_ptr_glMultiTexCoord4bOES){this->m_next_glMultiTexCoord4bOES = this->m_ptr_glMultiTexCoord4bOES;this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&ProfileTableDecorator::m_glMultiTexCoord4bOES_profile;}
+if(this->m_ptr_glProgramEnvParameter4dARB){this->m_next_glProgramEnvParameter4dARB = this->m_ptr_glProgramEnvParameter4dARB;this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&ProfileTableDecorator::m_glProgramEnvParameter4dARB_profile;}
+if(this->m_ptr_glProgramUniform1uiEXT){this->m_next_glProgramUniform1uiEXT = this->m_ptr_glProgramUniform1uiEXT;this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&ProfileTableDecorator::m_glProgramUniform1uiEXT_profile;}
+if(this->m_ptr_glBindBufferRange){this->m_next_glBindBufferRange = this->m_ptr_glBindBufferRange;this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&ProfileTableDecorator::m_glBindBufferRange_profile;}
+if(this->m_ptr_glNormal3iv){this->m_next_glNormal3iv = this->m_ptr_glNormal3iv;this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&ProfileTableDecorator::m_glNormal3iv_profile;}
+if(this->m_ptr_glVertexAttribL3dv){this->m_next_glVertexAttribL3dv = this->m_ptr_glVertexAttribL3dv;this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&ProfileTableDecorator::m_glVertexAttribL3dv_profile;}
+if(this->m_ptr_glGetUniformdv){this->m_next_glGetUniformdv = this->m_ptr_glGetUniformdv;this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&ProfileTableDecorator::m_glGetUniformdv_profile;}
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT){this->m_next_glGetMultiTexLevelParameterfvEXT = this->m_ptr_glGetMultiTexLevelParameterfvEXT;this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexLevelParameterfvEXT_profile;}
+if(this->m_ptr_glFinalCombinerInputNV){this->m_next_glFinalCombinerInputNV = this->m_ptr_glFinalCombinerInputNV;this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&ProfileTableDecorator::m_glFinalCombinerInputNV_profile;}
+if(this->m_ptr_glCullParameterdvEXT){this->m_next_glCullParameterdvEXT = this->m_ptr_glCullParameterdvEXT;this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&ProfileTableDecorator::m_glCullParameterdvEXT_profile;}
+if(this->m_ptr_glMultiTexCoord4s){this->m_next_glMultiTexCoord4s = this->m_ptr_glMultiTexCoord4s;this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&ProfileTableDecorator::m_glMultiTexCoord4s_profile;}
+if(this->m_ptr_glMapVertexAttrib1fAPPLE){this->m_next_glMapVertexAttrib1fAPPLE = this->m_ptr_glMapVertexAttrib1fAPPLE;this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&ProfileTableDecorator::m_glMapVertexAttrib1fAPPLE_profile;}
+if(this->m_ptr_glConvolutionParameterfEXT){this->m_next_glConvolutionParameterfEXT = this->m_ptr_glConvolutionParameterfEXT;this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&ProfileTableDecorator::m_glConvolutionParameterfEXT_profile;}
+if(this->m_ptr_glTexCoord1iv){this->m_next_glTexCoord1iv = this->m_ptr_glTexCoord1iv;this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&ProfileTableDecorator::m_glTexCoord1iv_profile;}
+if(this->m_ptr_glProgramUniform3fvEXT){this->m_next_glProgramUniform3fvEXT = this->m_ptr_glProgramUniform3fvEXT;this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&ProfileTableDecorator::m_glProgramUniform3fvEXT_profile;}
+if(this->m_ptr_glColor3uiv){this->m_next_glColor3uiv = this->m_ptr_glColor3uiv;this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&ProfileTableDecorator::m_glColor3uiv_profile;}
+if(this->m_ptr_glRenderGpuMaskNV){this->m_next_glRenderGpuMaskNV = this->m_ptr_glRenderGpuMaskNV;this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&ProfileTableDecorator::m_glRenderGpuMaskNV_profile;}
+if(this->m_ptr_glListBase){this->m_next_glListBase = this->m_ptr_glListBase;this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&ProfileTableDecorator::m_glListBase_profile;}
+if(this->m_ptr_glTexCoord2bOES){this->m_next_glTexCoord2bOES = this->m_ptr_glTexCoord2bOES;this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&ProfileTableDecorator::m_glTexCoord2bOES_profile;}
+if(this->m_ptr_glBindMaterialParameterEXT){this->m_next_glBindMaterialParameterEXT = this->m_ptr_glBindMaterialParameterEXT;this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&ProfileTableDecorator::m_glBindMaterialParameterEXT_profile;}
+if(this->m_ptr_glGlobalAlphaFactorubSUN){this->m_next_glGlobalAlphaFactorubSUN = this->m_ptr_glGlobalAlphaFactorubSUN;this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactorubSUN_profile;}
+if(this->m_ptr_glVertexAttribL1ui64NV){this->m_next_glVertexAttribL1ui64NV = this->m_ptr_glVertexAttribL1ui64NV;this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&ProfileTableDecorator::m_glVertexAttribL1ui64NV_profile;}
+if(this->m_ptr_glPointParameterfSGIS){this->m_next_glPointParameterfSGIS = this->m_ptr_glPointParameterfSGIS;this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&ProfileTableDecorator::m_glPointParameterfSGIS_profile;}
+if(this->m_ptr_glGetImageTransformParameterivHP){this->m_next_glGetImageTransformParameterivHP = this->m_ptr_glGetImageTransformParameterivHP;this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&ProfileTableDecorator::m_glGetImageTransformParameterivHP_profile;}
+if(this->m_ptr_glColorSubTableEXT){this->m_next_glColorSubTableEXT = this->m_ptr_glColorSubTableEXT;this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&ProfileTableDecorator::m_glColorSubTableEXT_profile;}
+if(this->m_ptr_glPixelTexGenParameterfvSGIS){this->m_next_glPixelTexGenParameterfvSGIS = this->m_ptr_glPixelTexGenParameterfvSGIS;this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&ProfileTableDecorator::m_glPixelTexGenParameterfvSGIS_profile;}
+if(this->m_ptr_glClientWaitSync){this->m_next_glClientWaitSync = this->m_ptr_glClientWaitSync;this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&ProfileTableDecorator::m_glClientWaitSync_profile;}
+if(this->m_ptr_glQueryObjectParameteruiAMD){this->m_next_glQueryObjectParameteruiAMD = this->m_ptr_glQueryObjectParameteruiAMD;this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&ProfileTableDecorator::m_glQueryObjectParameteruiAMD_profile;}
+if(this->m_ptr_glVertexAttribs1fvNV){this->m_next_glVertexAttribs1fvNV = this->m_ptr_glVertexAttribs1fvNV;this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&ProfileTableDecorator::m_glVertexAttribs1fvNV_profile;}
+if(this->m_ptr_glVertexAttrib4NusvARB){this->m_next_glVertexAttrib4NusvARB = this->m_ptr_glVertexAttrib4NusvARB;this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NusvARB_profile;}
+if(this->m_ptr_glVariantPointerEXT){this->m_next_glVariantPointerEXT = this->m_ptr_glVariantPointerEXT;this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&ProfileTableDecorator::m_glVariantPointerEXT_profile;}
+if(this->m_ptr_glTextureBuffer){this->m_next_glTextureBuffer = this->m_ptr_glTextureBuffer;this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&ProfileTableDecorator::m_glTextureBuffer_profile;}
+if(this->m_ptr_glVertexAttribI1uiEXT){this->m_next_glVertexAttribI1uiEXT = this->m_ptr_glVertexAttribI1uiEXT;this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&ProfileTableDecorator::m_glVertexAttribI1uiEXT_profile;}
+if(this->m_ptr_glInvalidateTexImage){this->m_next_glInvalidateTexImage = this->m_ptr_glInvalidateTexImage;this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&ProfileTableDecorator::m_glInvalidateTexImage_profile;}
+if(this->m_ptr_glProgramEnvParametersI4ivNV){this->m_next_glProgramEnvParametersI4ivNV = this->m_ptr_glProgramEnvParametersI4ivNV;this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&ProfileTableDecorator::m_glProgramEnvParametersI4ivNV_profile;}
+if(this->m_ptr_glPathGlyphIndexArrayNV){this->m_next_glPathGlyphIndexArrayNV = this->m_ptr_glPathGlyphIndexArrayNV;this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&ProfileTableDecorator::m_glPathGlyphIndexArrayNV_profile;}
+if(this->m_ptr_glCopyImageSubData){this->m_next_glCopyImageSubData = this->m_ptr_glCopyImageSubData;this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&ProfileTableDecorator::m_glCopyImageSubData_profile;}
+if(this->m_ptr_glGetUniformSubroutineuiv){this->m_next_glGetUniformSubroutineuiv = this->m_ptr_glGetUniformSubroutineuiv;this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&ProfileTableDecorator::m_glGetUniformSubroutineuiv_profile;}
+if(this->m_ptr_glBindVertexBuffer){this->m_next_glBindVertexBuffer = this->m_ptr_glBindVertexBuffer;this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&ProfileTableDecorator::m_glBindVertexBuffer_profile;}
+if(this->m_ptr_glMultiTexCoord1iARB){this->m_next_glMultiTexCoord1iARB = this->m_ptr_glMultiTexCoord1iARB;this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1iARB_profile;}
+if(this->m_ptr_glDebugMessageInsert){this->m_next_glDebugMessageInsert = this->m_ptr_glDebugMessageInsert;this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&ProfileTableDecorator::m_glDebugMessageInsert_profile;}
+if(this->m_ptr_glBeginVertexShaderEXT){this->m_next_glBeginVertexShaderEXT = this->m_ptr_glBeginVertexShaderEXT;this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&ProfileTableDecorator::m_glBeginVertexShaderEXT_profile;}
+if(this->m_ptr_glIsVariantEnabledEXT){this->m_next_glIsVariantEnabledEXT = this->m_ptr_glIsVariantEnabledEXT;this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&ProfileTableDecorator::m_glIsVariantEnabledEXT_profile;}
+if(this->m_ptr_glPassThroughxOES){this->m_next_glPassThroughxOES = this->m_ptr_glPassThroughxOES;this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&ProfileTableDecorator::m_glPassThroughxOES_profile;}
+if(this->m_ptr_glIsSampler){this->m_next_glIsSampler = this->m_ptr_glIsSampler;this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&ProfileTableDecorator::m_glIsSampler_profile;}
+if(this->m_ptr_glConservativeRasterParameterfNV){this->m_next_glConservativeRasterParameterfNV = this->m_ptr_glConservativeRasterParameterfNV;this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&ProfileTableDecorator::m_glConservativeRasterParameterfNV_profile;}
+if(this->m_ptr_glMultiTexGenivEXT){this->m_next_glMultiTexGenivEXT = this->m_ptr_glMultiTexGenivEXT;this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&ProfileTableDecorator::m_glMultiTexGenivEXT_profile;}
+if(this->m_ptr_glNamedFramebufferTexture2DEXT){this->m_next_glNamedFramebufferTexture2DEXT = this->m_ptr_glNamedFramebufferTexture2DEXT;this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTexture2DEXT_profile;}
+if(this->m_ptr_glCopyTexSubImage1D){this->m_next_glCopyTexSubImage1D = this->m_ptr_glCopyTexSubImage1D;this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&ProfileTableDecorator::m_glCopyTexSubImage1D_profile;}
+if(this->m_ptr_glTexCoord1i){this->m_next_glTexCoord1i = this->m_ptr_glTexCoord1i;this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&ProfileTableDecorator::m_glTexCoord1i_profile;}
+if(this->m_ptr_glCheckFramebufferStatus){this->m_next_glCheckFramebufferStatus = this->m_ptr_glCheckFramebufferStatus;this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&ProfileTableDecorator::m_glCheckFramebufferStatus_profile;}
+if(this->m_ptr_glDrawElementArrayAPPLE){this->m_next_glDrawElementArrayAPPLE = this->m_ptr_glDrawElementArrayAPPLE;this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&ProfileTableDecorator::m_glDrawElementArrayAPPLE_profile;}
+if(this->m_ptr_glTexCoord1d){this->m_next_glTexCoord1d = this->m_ptr_glTexCoord1d;this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&ProfileTableDecorator::m_glTexCoord1d_profile;}
+if(this->m_ptr_glTexCoord1f){this->m_next_glTexCoord1f = this->m_ptr_glTexCoord1f;this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&ProfileTableDecorator::m_glTexCoord1f_profile;}
+if(this->m_ptr_glFragmentLightivSGIX){this->m_next_glFragmentLightivSGIX = this->m_ptr_glFragmentLightivSGIX;this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&ProfileTableDecorator::m_glFragmentLightivSGIX_profile;}
+if(this->m_ptr_glBindImageTexture){this->m_next_glBindImageTexture = this->m_ptr_glBindImageTexture;this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&ProfileTableDecorator::m_glBindImageTexture_profile;}
+if(this->m_ptr_glTransformFeedbackVaryings){this->m_next_glTransformFeedbackVaryings = this->m_ptr_glTransformFeedbackVaryings;this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&ProfileTableDecorator::m_glTransformFeedbackVaryings_profile;}
+if(this->m_ptr_glMulticastBufferSubDataNV){this->m_next_glMulticastBufferSubDataNV = this->m_ptr_glMulticastBufferSubDataNV;this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&ProfileTableDecorator::m_glMulticastBufferSubDataNV_profile;}
+if(this->m_ptr_glDrawRangeElements){this->m_next_glDrawRangeElements = this->m_ptr_glDrawRangeElements;this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&ProfileTableDecorator::m_glDrawRangeElements_profile;}
+if(this->m_ptr_glTexCoord1s){this->m_next_glTexCoord1s = this->m_ptr_glTexCoord1s;this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&ProfileTableDecorator::m_glTexCoord1s_profile;}
+if(this->m_ptr_glBindBufferBase){this->m_next_glBindBufferBase = this->m_ptr_glBindBufferBase;this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&ProfileTableDecorator::m_glBindBufferBase_profile;}
+if(this->m_ptr_glColor3bv){this->m_next_glColor3bv = this->m_ptr_glColor3bv;this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&ProfileTableDecorator::m_glColor3bv_profile;}
+if(this->m_ptr_glSyncTextureINTEL){this->m_next_glSyncTextureINTEL = this->m_ptr_glSyncTextureINTEL;this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&ProfileTableDecorator::m_glSyncTextureINTEL_profile;}
+if(this->m_ptr_glCreateSamplers){this->m_next_glCreateSamplers = this->m_ptr_glCreateSamplers;this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&ProfileTableDecorator::m_glCreateSamplers_profile;}
+if(this->m_ptr_glCombinerParameterfNV){this->m_next_glCombinerParameterfNV = this->m_ptr_glCombinerParameterfNV;this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&ProfileTableDecorator::m_glCombinerParameterfNV_profile;}
+if(this->m_ptr_glGetArrayObjectivATI){this->m_next_glGetArrayObjectivATI = this->m_ptr_glGetArrayObjectivATI;this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&ProfileTableDecorator::m_glGetArrayObjectivATI_profile;}
+if(this->m_ptr_glMultiDrawArrays){this->m_next_glMultiDrawArrays = this->m_ptr_glMultiDrawArrays;this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&ProfileTableDecorator::m_glMultiDrawArrays_profile;}
+if(this->m_ptr_glSampleMapATI){this->m_next_glSampleMapATI = this->m_ptr_glSampleMapATI;this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&ProfileTableDecorator::m_glSampleMapATI_profile;}
+if(this->m_ptr_glProgramUniform2i64ARB){this->m_next_glProgramUniform2i64ARB = this->m_ptr_glProgramUniform2i64ARB;this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&ProfileTableDecorator::m_glProgramUniform2i64ARB_profile;}
+if(this->m_ptr_glBinormal3ivEXT){this->m_next_glBinormal3ivEXT = this->m_ptr_glBinormal3ivEXT;this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&ProfileTableDecorator::m_glBinormal3ivEXT_profile;}
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB){this->m_next_glMultiDrawArraysIndirectCountARB = this->m_ptr_glMultiDrawArraysIndirectCountARB;this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirectCountARB_profile;}
+if(this->m_ptr_glTextureStorageMem1DEXT){this->m_next_glTextureStorageMem1DEXT = this->m_ptr_glTextureStorageMem1DEXT;this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&ProfileTableDecorator::m_glTextureStorageMem1DEXT_profile;}
+if(this->m_ptr_glWindowPos2ivMESA){this->m_next_glWindowPos2ivMESA = this->m_ptr_glWindowPos2ivMESA;this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&ProfileTableDecorator::m_glWindowPos2ivMESA_profile;}
+if(this->m_ptr_glTexCoordP4ui){this->m_next_glTexCoordP4ui = this->m_ptr_glTexCoordP4ui;this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&ProfileTableDecorator::m_glTexCoordP4ui_profile;}
+if(this->m_ptr_glMultiTexSubImage1DEXT){this->m_next_glMultiTexSubImage1DEXT = this->m_ptr_glMultiTexSubImage1DEXT;this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glMultiTexSubImage1DEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT){this->m_next_glProgramUniformMatrix2x3fvEXT = this->m_ptr_glProgramUniformMatrix2x3fvEXT;this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x3fvEXT_profile;}
+if(this->m_ptr_glBufferDataARB){this->m_next_glBufferDataARB = this->m_ptr_glBufferDataARB;this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&ProfileTableDecorator::m_glBufferDataARB_profile;}
+if(this->m_ptr_glVertexAttribIFormat){this->m_next_glVertexAttribIFormat = this->m_ptr_glVertexAttribIFormat;this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&ProfileTableDecorator::m_glVertexAttribIFormat_profile;}
+if(this->m_ptr_glCreateFramebuffers){this->m_next_glCreateFramebuffers = this->m_ptr_glCreateFramebuffers;this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&ProfileTableDecorator::m_glCreateFramebuffers_profile;}
+if(this->m_ptr_glNormalStream3dvATI){this->m_next_glNormalStream3dvATI = this->m_ptr_glNormalStream3dvATI;this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&ProfileTableDecorator::m_glNormalStream3dvATI_profile;}
+if(this->m_ptr_glClearAccum){this->m_next_glClearAccum = this->m_ptr_glClearAccum;this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&ProfileTableDecorator::m_glClearAccum_profile;}
+if(this->m_ptr_glUniform3i64vNV){this->m_next_glUniform3i64vNV = this->m_ptr_glUniform3i64vNV;this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&ProfileTableDecorator::m_glUniform3i64vNV_profile;}
+if(this->m_ptr_glNormal3fVertex3fSUN){this->m_next_glNormal3fVertex3fSUN = this->m_ptr_glNormal3fVertex3fSUN;this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glUniform2uivEXT){this->m_next_glUniform2uivEXT = this->m_ptr_glUniform2uivEXT;this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&ProfileTableDecorator::m_glUniform2uivEXT_profile;}
+if(this->m_ptr_glBeginQuery){this->m_next_glBeginQuery = this->m_ptr_glBeginQuery;this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&ProfileTableDecorator::m_glBeginQuery_profile;}
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV){this->m_next_glStencilThenCoverStrokePathInstancedNV = this->m_ptr_glStencilThenCoverStrokePathInstancedNV;this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_profile;}
+if(this->m_ptr_glBindBuffer){this->m_next_glBindBuffer = this->m_ptr_glBindBuffer;this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&ProfileTableDecorator::m_glBindBuffer_profile;}
+if(this->m_ptr_glMap2d){this->m_next_glMap2d = this->m_ptr_glMap2d;this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&ProfileTableDecorator::m_glMap2d_profile;}
+if(this->m_ptr_glMap2f){this->m_next_glMap2f = this->m_ptr_glMap2f;this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&ProfileTableDecorator::m_glMap2f_profile;}
+if(this->m_ptr_glMakeImageHandleResidentNV){this->m_next_glMakeImageHandleResidentNV = this->m_ptr_glMakeImageHandleResidentNV;this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&ProfileTableDecorator::m_glMakeImageHandleResidentNV_profile;}
+if(this->m_ptr_glUniformMatrix2x4fv){this->m_next_glUniformMatrix2x4fv = this->m_ptr_glUniformMatrix2x4fv;this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&ProfileTableDecorator::m_glUniformMatrix2x4fv_profile;}
+if(this->m_ptr_glGetMultiTexParameterfvEXT){this->m_next_glGetMultiTexParameterfvEXT = this->m_ptr_glGetMultiTexParameterfvEXT;this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexParameterfvEXT_profile;}
+if(this->m_ptr_glDepthRangeIndexed){this->m_next_glDepthRangeIndexed = this->m_ptr_glDepthRangeIndexed;this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&ProfileTableDecorator::m_glDepthRangeIndexed_profile;}
+if(this->m_ptr_glIsEnabled){this->m_next_glIsEnabled = this->m_ptr_glIsEnabled;this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&ProfileTableDecorator::m_glIsEnabled_profile;}
+if(this->m_ptr_glMatrixScalefEXT){this->m_next_glMatrixScalefEXT = this->m_ptr_glMatrixScalefEXT;this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&ProfileTableDecorator::m_glMatrixScalefEXT_profile;}
+if(this->m_ptr_glGetError){this->m_next_glGetError = this->m_ptr_glGetError;this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&ProfileTableDecorator::m_glGetError_profile;}
+if(this->m_ptr_glGetTexEnviv){this->m_next_glGetTexEnviv = this->m_ptr_glGetTexEnviv;this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&ProfileTableDecorator::m_glGetTexEnviv_profile;}
+if(this->m_ptr_glBindTextureUnitParameterEXT){this->m_next_glBindTextureUnitParameterEXT = this->m_ptr_glBindTextureUnitParameterEXT;this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&ProfileTableDecorator::m_glBindTextureUnitParameterEXT_profile;}
+if(this->m_ptr_glGetnUniformfvARB){this->m_next_glGetnUniformfvARB = this->m_ptr_glGetnUniformfvARB;this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&ProfileTableDecorator::m_glGetnUniformfvARB_profile;}
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN){this->m_next_glReplacementCodeuiNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glDeletePerfQueryINTEL){this->m_next_glDeletePerfQueryINTEL = this->m_ptr_glDeletePerfQueryINTEL;this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&ProfileTableDecorator::m_glDeletePerfQueryINTEL_profile;}
+if(this->m_ptr_glActiveVaryingNV){this->m_next_glActiveVaryingNV = this->m_ptr_glActiveVaryingNV;this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&ProfileTableDecorator::m_glActiveVaryingNV_profile;}
+if(this->m_ptr_glGetActiveUniformARB){this->m_next_glGetActiveUniformARB = this->m_ptr_glGetActiveUniformARB;this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&ProfileTableDecorator::m_glGetActiveUniformARB_profile;}
+if(this->m_ptr_glVertexAttribI3ivEXT){this->m_next_glVertexAttribI3ivEXT = this->m_ptr_glVertexAttribI3ivEXT;this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI3ivEXT_profile;}
+if(this->m_ptr_glEvalCoord1d){this->m_next_glEvalCoord1d = this->m_ptr_glEvalCoord1d;this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&ProfileTableDecorator::m_glEvalCoord1d_profile;}
+if(this->m_ptr_glNamedCopyBufferSubDataEXT){this->m_next_glNamedCopyBufferSubDataEXT = this->m_ptr_glNamedCopyBufferSubDataEXT;this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&ProfileTableDecorator::m_glNamedCopyBufferSubDataEXT_profile;}
+if(this->m_ptr_glEvalCoord1f){this->m_next_glEvalCoord1f = this->m_ptr_glEvalCoord1f;this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&ProfileTableDecorator::m_glEvalCoord1f_profile;}
+if(this->m_ptr_glPixelMapfv){this->m_next_glPixelMapfv = this->m_ptr_glPixelMapfv;this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&ProfileTableDecorator::m_glPixelMapfv_profile;}
+if(this->m_ptr_glVertexAttribI1ivEXT){this->m_next_glVertexAttribI1ivEXT = this->m_ptr_glVertexAttribI1ivEXT;this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI1ivEXT_profile;}
+if(this->m_ptr_glCreateSyncFromCLeventARB){this->m_next_glCreateSyncFromCLeventARB = this->m_ptr_glCreateSyncFromCLeventARB;this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&ProfileTableDecorator::m_glCreateSyncFromCLeventARB_profile;}
+if(this->m_ptr_glGetPixelMapusv){this->m_next_glGetPixelMapusv = this->m_ptr_glGetPixelMapusv;this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&ProfileTableDecorator::m_glGetPixelMapusv_profile;}
+if(this->m_ptr_glGetnColorTableARB){this->m_next_glGetnColorTableARB = this->m_ptr_glGetnColorTableARB;this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&ProfileTableDecorator::m_glGetnColorTableARB_profile;}
+if(this->m_ptr_glAccum){this->m_next_glAccum = this->m_ptr_glAccum;this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&ProfileTableDecorator::m_glAccum_profile;}
+if(this->m_ptr_glRasterPos3sv){this->m_next_glRasterPos3sv = this->m_ptr_glRasterPos3sv;this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&ProfileTableDecorator::m_glRasterPos3sv_profile;}
+if(this->m_ptr_glTexCoord2iv){this->m_next_glTexCoord2iv = this->m_ptr_glTexCoord2iv;this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&ProfileTableDecorator::m_glTexCoord2iv_profile;}
+if(this->m_ptr_glBlendFunciARB){this->m_next_glBlendFunciARB = this->m_ptr_glBlendFunciARB;this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&ProfileTableDecorator::m_glBlendFunciARB_profile;}
+if(this->m_ptr_glProgramUniform3i64vARB){this->m_next_glProgramUniform3i64vARB = this->m_ptr_glProgramUniform3i64vARB;this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&ProfileTableDecorator::m_glProgramUniform3i64vARB_profile;}
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv){this->m_next_glGetFramebufferAttachmentParameteriv = this->m_ptr_glGetFramebufferAttachmentParameteriv;this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfileTableDecorator::m_glGetFramebufferAttachmentParameteriv_profile;}
+if(this->m_ptr_glProgramUniform4ui){this->m_next_glProgramUniform4ui = this->m_ptr_glProgramUniform4ui;this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&ProfileTableDecorator::m_glProgramUniform4ui_profile;}
+if(this->m_ptr_glStencilMask){this->m_next_glStencilMask = this->m_ptr_glStencilMask;this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&ProfileTableDecorator::m_glStencilMask_profile;}
+if(this->m_ptr_glResetHistogramEXT){this->m_next_glResetHistogramEXT = this->m_ptr_glResetHistogramEXT;this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&ProfileTableDecorator::m_glResetHistogramEXT_profile;}
+if(this->m_ptr_glLightxOES){this->m_next_glLightxOES = this->m_ptr_glLightxOES;this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&ProfileTableDecorator::m_glLightxOES_profile;}
+if(this->m_ptr_glNamedBufferData){this->m_next_glNamedBufferData = this->m_ptr_glNamedBufferData;this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&ProfileTableDecorator::m_glNamedBufferData_profile;}
+if(this->m_ptr_glVertexStream3sATI){this->m_next_glVertexStream3sATI = this->m_ptr_glVertexStream3sATI;this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&ProfileTableDecorator::m_glVertexStream3sATI_profile;}
+if(this->m_ptr_glVertexAttrib3fvARB){this->m_next_glVertexAttrib3fvARB = this->m_ptr_glVertexAttrib3fvARB;this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&ProfileTableDecorator::m_glVertexAttrib3fvARB_profile;}
+if(this->m_ptr_glClearNamedBufferSubData){this->m_next_glClearNamedBufferSubData = this->m_ptr_glClearNamedBufferSubData;this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glClearNamedBufferSubData_profile;}
+if(this->m_ptr_glProgramUniformHandleui64ARB){this->m_next_glProgramUniformHandleui64ARB = this->m_ptr_glProgramUniformHandleui64ARB;this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&ProfileTableDecorator::m_glProgramUniformHandleui64ARB_profile;}
+if(this->m_ptr_glUniform3iARB){this->m_next_glUniform3iARB = this->m_ptr_glUniform3iARB;this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&ProfileTableDecorator::m_glUniform3iARB_profile;}
+if(this->m_ptr_glCreateProgramObjectARB){this->m_next_glCreateProgramObjectARB = this->m_ptr_glCreateProgramObjectARB;this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&ProfileTableDecorator::m_glCreateProgramObjectARB_profile;}
+if(this->m_ptr_glMultiTexCoord1dvARB){this->m_next_glMultiTexCoord1dvARB = this->m_ptr_glMultiTexCoord1dvARB;this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1dvARB_profile;}
+if(this->m_ptr_glGetObjectParameterfvARB){this->m_next_glGetObjectParameterfvARB = this->m_ptr_glGetObjectParameterfvARB;this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&ProfileTableDecorator::m_glGetObjectParameterfvARB_profile;}
+if(this->m_ptr_glRectsv){this->m_next_glRectsv = this->m_ptr_glRectsv;this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&ProfileTableDecorator::m_glRectsv_profile;}
+if(this->m_ptr_glMultiTexImage2DEXT){this->m_next_glMultiTexImage2DEXT = this->m_ptr_glMultiTexImage2DEXT;this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&ProfileTableDecorator::m_glMultiTexImage2DEXT_profile;}
+if(this->m_ptr_glProgramUniform1i64NV){this->m_next_glProgramUniform1i64NV = this->m_ptr_glProgramUniform1i64NV;this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&ProfileTableDecorator::m_glProgramUniform1i64NV_profile;}
+if(this->m_ptr_glGetObjectBufferivATI){this->m_next_glGetObjectBufferivATI = this->m_ptr_glGetObjectBufferivATI;this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&ProfileTableDecorator::m_glGetObjectBufferivATI_profile;}
+if(this->m_ptr_glUniform4i64ARB){this->m_next_glUniform4i64ARB = this->m_ptr_glUniform4i64ARB;this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&ProfileTableDecorator::m_glUniform4i64ARB_profile;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN){this->m_next_glReplacementCodeuiColor4ubVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_profile;}
+if(this->m_ptr_glBlendFuncSeparateINGR){this->m_next_glBlendFuncSeparateINGR = this->m_ptr_glBlendFuncSeparateINGR;this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&ProfileTableDecorator::m_glBlendFuncSeparateINGR_profile;}
+if(this->m_ptr_glGetVideoCaptureStreamfvNV){this->m_next_glGetVideoCaptureStreamfvNV = this->m_ptr_glGetVideoCaptureStreamfvNV;this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&ProfileTableDecorator::m_glGetVideoCaptureStreamfvNV_profile;}
+if(this->m_ptr_glVertexAttrib2fARB){this->m_next_glVertexAttrib2fARB = this->m_ptr_glVertexAttrib2fARB;this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&ProfileTableDecorator::m_glVertexAttrib2fARB_profile;}
+if(this->m_ptr_glGetTexGeniv){this->m_next_glGetTexGeniv = this->m_ptr_glGetTexGeniv;this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&ProfileTableDecorator::m_glGetTexGeniv_profile;}
+if(this->m_ptr_glPixelStorei){this->m_next_glPixelStorei = this->m_ptr_glPixelStorei;this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&ProfileTableDecorator::m_glPixelStorei_profile;}
+if(this->m_ptr_glGetCompressedTextureSubImage){this->m_next_glGetCompressedTextureSubImage = this->m_ptr_glGetCompressedTextureSubImage;this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&ProfileTableDecorator::m_glGetCompressedTextureSubImage_profile;}
+if(this->m_ptr_glCopyImageSubDataNV){this->m_next_glCopyImageSubDataNV = this->m_ptr_glCopyImageSubDataNV;this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&ProfileTableDecorator::m_glCopyImageSubDataNV_profile;}
+if(this->m_ptr_glActiveShaderProgram){this->m_next_glActiveShaderProgram = this->m_ptr_glActiveShaderProgram;this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&ProfileTableDecorator::m_glActiveShaderProgram_profile;}
+if(this->m_ptr_glVertexStream1iATI){this->m_next_glVertexStream1iATI = this->m_ptr_glVertexStream1iATI;this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&ProfileTableDecorator::m_glVertexStream1iATI_profile;}
+if(this->m_ptr_glPatchParameterfv){this->m_next_glPatchParameterfv = this->m_ptr_glPatchParameterfv;this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&ProfileTableDecorator::m_glPatchParameterfv_profile;}
+if(this->m_ptr_glIsFramebufferEXT){this->m_next_glIsFramebufferEXT = this->m_ptr_glIsFramebufferEXT;this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&ProfileTableDecorator::m_glIsFramebufferEXT_profile;}
+if(this->m_ptr_glTextureStorage2D){this->m_next_glTextureStorage2D = this->m_ptr_glTextureStorage2D;this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&ProfileTableDecorator::m_glTextureStorage2D_profile;}
+if(this->m_ptr_glProgramUniform1ui64ARB){this->m_next_glProgramUniform1ui64ARB = this->m_ptr_glProgramUniform1ui64ARB;this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&ProfileTableDecorator::m_glProgramUniform1ui64ARB_profile;}
+if(this->m_ptr_glTexBufferRange){this->m_next_glTexBufferRange = this->m_ptr_glTexBufferRange;this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&ProfileTableDecorator::m_glTexBufferRange_profile;}
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS){this->m_next_glGetPixelTexGenParameterivSGIS = this->m_ptr_glGetPixelTexGenParameterivSGIS;this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&ProfileTableDecorator::m_glGetPixelTexGenParameterivSGIS_profile;}
+if(this->m_ptr_glTextureSubImage3DEXT){this->m_next_glTextureSubImage3DEXT = this->m_ptr_glTextureSubImage3DEXT;this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glTextureSubImage3DEXT_profile;}
+if(this->m_ptr_glClipControl){this->m_next_glClipControl = this->m_ptr_glClipControl;this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&ProfileTableDecorator::m_glClipControl_profile;}
+if(this->m_ptr_glGetProgramResourceiv){this->m_next_glGetProgramResourceiv = this->m_ptr_glGetProgramResourceiv;this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&ProfileTableDecorator::m_glGetProgramResourceiv_profile;}
+if(this->m_ptr_glMultiTexCoordP2uiv){this->m_next_glMultiTexCoordP2uiv = this->m_ptr_glMultiTexCoordP2uiv;this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&ProfileTableDecorator::m_glMultiTexCoordP2uiv_profile;}
+if(this->m_ptr_glVertexAttribI3ui){this->m_next_glVertexAttribI3ui = this->m_ptr_glVertexAttribI3ui;this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&ProfileTableDecorator::m_glVertexAttribI3ui_profile;}
+if(this->m_ptr_glSampleMaskSGIS){this->m_next_glSampleMaskSGIS = this->m_ptr_glSampleMaskSGIS;this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&ProfileTableDecorator::m_glSampleMaskSGIS_profile;}
+if(this->m_ptr_glVertexAttrib4NivARB){this->m_next_glVertexAttrib4NivARB = this->m_ptr_glVertexAttrib4NivARB;this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NivARB_profile;}
+if(this->m_ptr_glGlobalAlphaFactorfSUN){this->m_next_glGlobalAlphaFactorfSUN = this->m_ptr_glGlobalAlphaFactorfSUN;this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactorfSUN_profile;}
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD){this->m_next_glBlendEquationSeparateIndexedAMD = this->m_ptr_glBlendEquationSeparateIndexedAMD;this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&ProfileTableDecorator::m_glBlendEquationSeparateIndexedAMD_profile;}
+if(this->m_ptr_glGetPerfCounterInfoINTEL){this->m_next_glGetPerfCounterInfoINTEL = this->m_ptr_glGetPerfCounterInfoINTEL;this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&ProfileTableDecorator::m_glGetPerfCounterInfoINTEL_profile;}
+if(this->m_ptr_glDeleteProgramsNV){this->m_next_glDeleteProgramsNV = this->m_ptr_glDeleteProgramsNV;this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&ProfileTableDecorator::m_glDeleteProgramsNV_profile;}
+if(this->m_ptr_glPixelZoomxOES){this->m_next_glPixelZoomxOES = this->m_ptr_glPixelZoomxOES;this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&ProfileTableDecorator::m_glPixelZoomxOES_profile;}
+if(this->m_ptr_glGetCombinerOutputParameterivNV){this->m_next_glGetCombinerOutputParameterivNV = this->m_ptr_glGetCombinerOutputParameterivNV;this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetCombinerOutputParameterivNV_profile;}
+if(this->m_ptr_glRasterPos2xvOES){this->m_next_glRasterPos2xvOES = this->m_ptr_glRasterPos2xvOES;this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&ProfileTableDecorator::m_glRasterPos2xvOES_profile;}
+if(this->m_ptr_glGetTexImage){this->m_next_glGetTexImage = this->m_ptr_glGetTexImage;this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&ProfileTableDecorator::m_glGetTexImage_profile;}
+if(this->m_ptr_glVertexArrayVertexBuffers){this->m_next_glVertexArrayVertexBuffers = this->m_ptr_glVertexArrayVertexBuffers;this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&ProfileTableDecorator::m_glVertexArrayVertexBuffers_profile;}
+if(this->m_ptr_glUniform1ui64NV){this->m_next_glUniform1ui64NV = this->m_ptr_glUniform1ui64NV;this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&ProfileTableDecorator::m_glUniform1ui64NV_profile;}
+if(this->m_ptr_glProgramParameteri){this->m_next_glProgramParameteri = this->m_ptr_glProgramParameteri;this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&ProfileTableDecorator::m_glProgramParameteri_profile;}
+if(this->m_ptr_glNormal3xOES){this->m_next_glNormal3xOES = this->m_ptr_glNormal3xOES;this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&ProfileTableDecorator::m_glNormal3xOES_profile;}
+if(this->m_ptr_glGetMapfv){this->m_next_glGetMapfv = this->m_ptr_glGetMapfv;this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&ProfileTableDecorator::m_glGetMapfv_profile;}
+if(this->m_ptr_glVertexStream2dvATI){this->m_next_glVertexStream2dvATI = this->m_ptr_glVertexStream2dvATI;this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&ProfileTableDecorator::m_glVertexStream2dvATI_profile;}
+if(this->m_ptr_glPathStencilDepthOffsetNV){this->m_next_glPathStencilDepthOffsetNV = this->m_ptr_glPathStencilDepthOffsetNV;this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&ProfileTableDecorator::m_glPathStencilDepthOffsetNV_profile;}
+if(this->m_ptr_glIsStateNV){this->m_next_glIsStateNV = this->m_ptr_glIsStateNV;this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&ProfileTableDecorator::m_glIsStateNV_profile;}
+if(this->m_ptr_glGetIntegerui64vNV){this->m_next_glGetIntegerui64vNV = this->m_ptr_glGetIntegerui64vNV;this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&ProfileTableDecorator::m_glGetIntegerui64vNV_profile;}
+if(this->m_ptr_glGetImageTransformParameterfvHP){this->m_next_glGetImageTransformParameterfvHP = this->m_ptr_glGetImageTransformParameterfvHP;this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&ProfileTableDecorator::m_glGetImageTransformParameterfvHP_profile;}
+if(this->m_ptr_glRasterPos2fv){this->m_next_glRasterPos2fv = this->m_ptr_glRasterPos2fv;this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&ProfileTableDecorator::m_glRasterPos2fv_profile;}
+if(this->m_ptr_glVertex3xOES){this->m_next_glVertex3xOES = this->m_ptr_glVertex3xOES;this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&ProfileTableDecorator::m_glVertex3xOES_profile;}
+if(this->m_ptr_glIsMemoryObjectEXT){this->m_next_glIsMemoryObjectEXT = this->m_ptr_glIsMemoryObjectEXT;this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&ProfileTableDecorator::m_glIsMemoryObjectEXT_profile;}
+if(this->m_ptr_glWeightPointerARB){this->m_next_glWeightPointerARB = this->m_ptr_glWeightPointerARB;this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&ProfileTableDecorator::m_glWeightPointerARB_profile;}
+if(this->m_ptr_glFinishFenceNV){this->m_next_glFinishFenceNV = this->m_ptr_glFinishFenceNV;this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&ProfileTableDecorator::m_glFinishFenceNV_profile;}
+if(this->m_ptr_glDepthRangexOES){this->m_next_glDepthRangexOES = this->m_ptr_glDepthRangexOES;this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&ProfileTableDecorator::m_glDepthRangexOES_profile;}
+if(this->m_ptr_glEnableVertexArrayAttribEXT){this->m_next_glEnableVertexArrayAttribEXT = this->m_ptr_glEnableVertexArrayAttribEXT;this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&ProfileTableDecorator::m_glEnableVertexArrayAttribEXT_profile;}
+if(this->m_ptr_glProgramUniform2uivEXT){this->m_next_glProgramUniform2uivEXT = this->m_ptr_glProgramUniform2uivEXT;this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&ProfileTableDecorator::m_glProgramUniform2uivEXT_profile;}
+if(this->m_ptr_glGetDoubleIndexedvEXT){this->m_next_glGetDoubleIndexedvEXT = this->m_ptr_glGetDoubleIndexedvEXT;this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&ProfileTableDecorator::m_glGetDoubleIndexedvEXT_profile;}
+if(this->m_ptr_glWindowPos2fMESA){this->m_next_glWindowPos2fMESA = this->m_ptr_glWindowPos2fMESA;this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&ProfileTableDecorator::m_glWindowPos2fMESA_profile;}
+if(this->m_ptr_glSecondaryColor3b){this->m_next_glSecondaryColor3b = this->m_ptr_glSecondaryColor3b;this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&ProfileTableDecorator::m_glSecondaryColor3b_profile;}
+if(this->m_ptr_glCopyConvolutionFilter1DEXT){this->m_next_glCopyConvolutionFilter1DEXT = this->m_ptr_glCopyConvolutionFilter1DEXT;this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&ProfileTableDecorator::m_glCopyConvolutionFilter1DEXT_profile;}
+if(this->m_ptr_glWindowPos2sv){this->m_next_glWindowPos2sv = this->m_ptr_glWindowPos2sv;this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&ProfileTableDecorator::m_glWindowPos2sv_profile;}
+if(this->m_ptr_glBindFramebufferEXT){this->m_next_glBindFramebufferEXT = this->m_ptr_glBindFramebufferEXT;this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&ProfileTableDecorator::m_glBindFramebufferEXT_profile;}
+if(this->m_ptr_glCreateShader){this->m_next_glCreateShader = this->m_ptr_glCreateShader;this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&ProfileTableDecorator::m_glCreateShader_profile;}
+if(this->m_ptr_glGenPathsNV){this->m_next_glGenPathsNV = this->m_ptr_glGenPathsNV;this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&ProfileTableDecorator::m_glGenPathsNV_profile;}
+if(this->m_ptr_glGenRenderbuffers){this->m_next_glGenRenderbuffers = this->m_ptr_glGenRenderbuffers;this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&ProfileTableDecorator::m_glGenRenderbuffers_profile;}
+if(this->m_ptr_glCopyTexSubImage2D){this->m_next_glCopyTexSubImage2D = this->m_ptr_glCopyTexSubImage2D;this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&ProfileTableDecorator::m_glCopyTexSubImage2D_profile;}
+if(this->m_ptr_glVertexAttrib4ubvARB){this->m_next_glVertexAttrib4ubvARB = this->m_ptr_glVertexAttrib4ubvARB;this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4ubvARB_profile;}
+if(this->m_ptr_glDrawTextureNV){this->m_next_glDrawTextureNV = this->m_ptr_glDrawTextureNV;this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&ProfileTableDecorator::m_glDrawTextureNV_profile;}
+if(this->m_ptr_glVertexAttribs1svNV){this->m_next_glVertexAttribs1svNV = this->m_ptr_glVertexAttribs1svNV;this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&ProfileTableDecorator::m_glVertexAttribs1svNV_profile;}
+if(this->m_ptr_glClearNamedBufferSubDataEXT){this->m_next_glClearNamedBufferSubDataEXT = this->m_ptr_glClearNamedBufferSubDataEXT;this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&ProfileTableDecorator::m_glClearNamedBufferSubDataEXT_profile;}
+if(this->m_ptr_glBlendFuncSeparate){this->m_next_glBlendFuncSeparate = this->m_ptr_glBlendFuncSeparate;this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&ProfileTableDecorator::m_glBlendFuncSeparate_profile;}
+if(this->m_ptr_glPointParameterfARB){this->m_next_glPointParameterfARB = this->m_ptr_glPointParameterfARB;this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&ProfileTableDecorator::m_glPointParameterfARB_profile;}
+if(this->m_ptr_glTexCoord2fv){this->m_next_glTexCoord2fv = this->m_ptr_glTexCoord2fv;this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&ProfileTableDecorator::m_glTexCoord2fv_profile;}
+if(this->m_ptr_glGetVariantFloatvEXT){this->m_next_glGetVariantFloatvEXT = this->m_ptr_glGetVariantFloatvEXT;this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&ProfileTableDecorator::m_glGetVariantFloatvEXT_profile;}
+if(this->m_ptr_glVertexP2ui){this->m_next_glVertexP2ui = this->m_ptr_glVertexP2ui;this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&ProfileTableDecorator::m_glVertexP2ui_profile;}
+if(this->m_ptr_glWindowPos2dMESA){this->m_next_glWindowPos2dMESA = this->m_ptr_glWindowPos2dMESA;this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&ProfileTableDecorator::m_glWindowPos2dMESA_profile;}
+if(this->m_ptr_glTexCoord4fv){this->m_next_glTexCoord4fv = this->m_ptr_glTexCoord4fv;this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&ProfileTableDecorator::m_glTexCoord4fv_profile;}
+if(this->m_ptr_glBindFragDataLocationEXT){this->m_next_glBindFragDataLocationEXT = this->m_ptr_glBindFragDataLocationEXT;this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&ProfileTableDecorator::m_glBindFragDataLocationEXT_profile;}
+if(this->m_ptr_glCompressedTexSubImage1DARB){this->m_next_glCompressedTexSubImage1DARB = this->m_ptr_glCompressedTexSubImage1DARB;this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&ProfileTableDecorator::m_glCompressedTexSubImage1DARB_profile;}
+if(this->m_ptr_glGetTextureImageEXT){this->m_next_glGetTextureImageEXT = this->m_ptr_glGetTextureImageEXT;this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&ProfileTableDecorator::m_glGetTextureImageEXT_profile;}
+if(this->m_ptr_glFogCoordd){this->m_next_glFogCoordd = this->m_ptr_glFogCoordd;this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&ProfileTableDecorator::m_glFogCoordd_profile;}
+if(this->m_ptr_glPointSize){this->m_next_glPointSize = this->m_ptr_glPointSize;this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&ProfileTableDecorator::m_glPointSize_profile;}
+if(this->m_ptr_glBindTextureUnit){this->m_next_glBindTextureUnit = this->m_ptr_glBindTextureUnit;this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&ProfileTableDecorator::m_glBindTextureUnit_profile;}
+if(this->m_ptr_glProgramEnvParameterI4uiNV){this->m_next_glProgramEnvParameterI4uiNV = this->m_ptr_glProgramEnvParameterI4uiNV;this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&ProfileTableDecorator::m_glProgramEnvParameterI4uiNV_profile;}
+if(this->m_ptr_glGetProgramPipelineInfoLog){this->m_next_glGetProgramPipelineInfoLog = this->m_ptr_glGetProgramPipelineInfoLog;this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&ProfileTableDecorator::m_glGetProgramPipelineInfoLog_profile;}
+if(this->m_ptr_glProgramUniform4i64vARB){this->m_next_glProgramUniform4i64vARB = this->m_ptr_glProgramUniform4i64vARB;this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&ProfileTableDecorator::m_glProgramUniform4i64vARB_profile;}
+if(this->m_ptr_glVertexAttrib4Nuiv){this->m_next_glVertexAttrib4Nuiv = this->m_ptr_glVertexAttrib4Nuiv;this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&ProfileTableDecorator::m_glVertexAttrib4Nuiv_profile;}
+if(this->m_ptr_glGetUniformfvARB){this->m_next_glGetUniformfvARB = this->m_ptr_glGetUniformfvARB;this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&ProfileTableDecorator::m_glGetUniformfvARB_profile;}
+if(this->m_ptr_glWaitSync){this->m_next_glWaitSync = this->m_ptr_glWaitSync;this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&ProfileTableDecorator::m_glWaitSync_profile;}
+if(this->m_ptr_glUniform3i){this->m_next_glUniform3i = this->m_ptr_glUniform3i;this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&ProfileTableDecorator::m_glUniform3i_profile;}
+if(this->m_ptr_glBlendEquationSeparatei){this->m_next_glBlendEquationSeparatei = this->m_ptr_glBlendEquationSeparatei;this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&ProfileTableDecorator::m_glBlendEquationSeparatei_profile;}
+if(this->m_ptr_glVertexAttrib2hvNV){this->m_next_glVertexAttrib2hvNV = this->m_ptr_glVertexAttrib2hvNV;this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&ProfileTableDecorator::m_glVertexAttrib2hvNV_profile;}
+if(this->m_ptr_glTextureParameterivEXT){this->m_next_glTextureParameterivEXT = this->m_ptr_glTextureParameterivEXT;this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glTextureParameterivEXT_profile;}
+if(this->m_ptr_glUniform3d){this->m_next_glUniform3d = this->m_ptr_glUniform3d;this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&ProfileTableDecorator::m_glUniform3d_profile;}
+if(this->m_ptr_glUniform3f){this->m_next_glUniform3f = this->m_ptr_glUniform3f;this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&ProfileTableDecorator::m_glUniform3f_profile;}
+if(this->m_ptr_glActiveProgramEXT){this->m_next_glActiveProgramEXT = this->m_ptr_glActiveProgramEXT;this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&ProfileTableDecorator::m_glActiveProgramEXT_profile;}
+if(this->m_ptr_glProgramUniform3uiv){this->m_next_glProgramUniform3uiv = this->m_ptr_glProgramUniform3uiv;this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&ProfileTableDecorator::m_glProgramUniform3uiv_profile;}
+if(this->m_ptr_glUniform3ui64vARB){this->m_next_glUniform3ui64vARB = this->m_ptr_glUniform3ui64vARB;this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&ProfileTableDecorator::m_glUniform3ui64vARB_profile;}
+if(this->m_ptr_glProgramUniform1ui64vARB){this->m_next_glProgramUniform1ui64vARB = this->m_ptr_glProgramUniform1ui64vARB;this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&ProfileTableDecorator::m_glProgramUniform1ui64vARB_profile;}
+if(this->m_ptr_glTextureParameterfEXT){this->m_next_glTextureParameterfEXT = this->m_ptr_glTextureParameterfEXT;this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&ProfileTableDecorator::m_glTextureParameterfEXT_profile;}
+if(this->m_ptr_glSetFragmentShaderConstantATI){this->m_next_glSetFragmentShaderConstantATI = this->m_ptr_glSetFragmentShaderConstantATI;this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&ProfileTableDecorator::m_glSetFragmentShaderConstantATI_profile;}
+if(this->m_ptr_glColorSubTable){this->m_next_glColorSubTable = this->m_ptr_glColorSubTable;this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&ProfileTableDecorator::m_glColorSubTable_profile;}
+if(this->m_ptr_glReplacementCodeuiSUN){this->m_next_glReplacementCodeuiSUN = this->m_ptr_glReplacementCodeuiSUN;this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiSUN_profile;}
+if(this->m_ptr_glStateCaptureNV){this->m_next_glStateCaptureNV = this->m_ptr_glStateCaptureNV;this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&ProfileTableDecorator::m_glStateCaptureNV_profile;}
+if(this->m_ptr_glBindAttribLocation){this->m_next_glBindAttribLocation = this->m_ptr_glBindAttribLocation;this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&ProfileTableDecorator::m_glBindAttribLocation_profile;}
+if(this->m_ptr_glWeightusvARB){this->m_next_glWeightusvARB = this->m_ptr_glWeightusvARB;this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&ProfileTableDecorator::m_glWeightusvARB_profile;}
+if(this->m_ptr_glGetFragDataIndex){this->m_next_glGetFragDataIndex = this->m_ptr_glGetFragDataIndex;this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&ProfileTableDecorator::m_glGetFragDataIndex_profile;}
+if(this->m_ptr_glMultiTexCoord2xOES){this->m_next_glMultiTexCoord2xOES = this->m_ptr_glMultiTexCoord2xOES;this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&ProfileTableDecorator::m_glMultiTexCoord2xOES_profile;}
+if(this->m_ptr_glColor3sv){this->m_next_glColor3sv = this->m_ptr_glColor3sv;this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&ProfileTableDecorator::m_glColor3sv_profile;}
+if(this->m_ptr_glTexCoord2fVertex3fSUN){this->m_next_glTexCoord2fVertex3fSUN = this->m_ptr_glTexCoord2fVertex3fSUN;this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glTexCoord2fVertex3fSUN_profile;}
+if(this->m_ptr_glGetMemoryObjectParameterivEXT){this->m_next_glGetMemoryObjectParameterivEXT = this->m_ptr_glGetMemoryObjectParameterivEXT;this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetMemoryObjectParameterivEXT_profile;}
+if(this->m_ptr_glPolygonOffsetEXT){this->m_next_glPolygonOffsetEXT = this->m_ptr_glPolygonOffsetEXT;this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&ProfileTableDecorator::m_glPolygonOffsetEXT_profile;}
+if(this->m_ptr_glWeightPathsNV){this->m_next_glWeightPathsNV = this->m_ptr_glWeightPathsNV;this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&ProfileTableDecorator::m_glWeightPathsNV_profile;}
+if(this->m_ptr_glCombinerStageParameterfvNV){this->m_next_glCombinerStageParameterfvNV = this->m_ptr_glCombinerStageParameterfvNV;this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&ProfileTableDecorator::m_glCombinerStageParameterfvNV_profile;}
+if(this->m_ptr_glPointParameterfEXT){this->m_next_glPointParameterfEXT = this->m_ptr_glPointParameterfEXT;this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&ProfileTableDecorator::m_glPointParameterfEXT_profile;}
+if(this->m_ptr_glCopyTexImage1DEXT){this->m_next_glCopyTexImage1DEXT = this->m_ptr_glCopyTexImage1DEXT;this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyTexImage1DEXT_profile;}
+if(this->m_ptr_glVertex4sv){this->m_next_glVertex4sv = this->m_ptr_glVertex4sv;this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&ProfileTableDecorator::m_glVertex4sv_profile;}
+if(this->m_ptr_glMatrixMultfEXT){this->m_next_glMatrixMultfEXT = this->m_ptr_glMatrixMultfEXT;this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&ProfileTableDecorator::m_glMatrixMultfEXT_profile;}
+if(this->m_ptr_glCompressedTextureSubImage3DEXT){this->m_next_glCompressedTextureSubImage3DEXT = this->m_ptr_glCompressedTextureSubImage3DEXT;this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage3DEXT_profile;}
+if(this->m_ptr_glGetTexLevelParameterxvOES){this->m_next_glGetTexLevelParameterxvOES = this->m_ptr_glGetTexLevelParameterxvOES;this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&ProfileTableDecorator::m_glGetTexLevelParameterxvOES_profile;}
+if(this->m_ptr_glVertexAttribL3dvEXT){this->m_next_glVertexAttribL3dvEXT = this->m_ptr_glVertexAttribL3dvEXT;this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&ProfileTableDecorator::m_glVertexAttribL3dvEXT_profile;}
+if(this->m_ptr_glMultiTexCoordP4ui){this->m_next_glMultiTexCoordP4ui = this->m_ptr_glMultiTexCoordP4ui;this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&ProfileTableDecorator::m_glMultiTexCoordP4ui_profile;}
+if(this->m_ptr_glGetTextureLevelParameterivEXT){this->m_next_glGetTextureLevelParameterivEXT = this->m_ptr_glGetTextureLevelParameterivEXT;this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetTextureLevelParameterivEXT_profile;}
+if(this->m_ptr_glAlphaFragmentOp2ATI){this->m_next_glAlphaFragmentOp2ATI = this->m_ptr_glAlphaFragmentOp2ATI;this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&ProfileTableDecorator::m_glAlphaFragmentOp2ATI_profile;}
+if(this->m_ptr_glDeleteFramebuffers){this->m_next_glDeleteFramebuffers = this->m_ptr_glDeleteFramebuffers;this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&ProfileTableDecorator::m_glDeleteFramebuffers_profile;}
+if(this->m_ptr_glDrawArrays){this->m_next_glDrawArrays = this->m_ptr_glDrawArrays;this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&ProfileTableDecorator::m_glDrawArrays_profile;}
+if(this->m_ptr_glGetTransformFeedbackiv){this->m_next_glGetTransformFeedbackiv = this->m_ptr_glGetTransformFeedbackiv;this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&ProfileTableDecorator::m_glGetTransformFeedbackiv_profile;}
+if(this->m_ptr_glGetnTexImageARB){this->m_next_glGetnTexImageARB = this->m_ptr_glGetnTexImageARB;this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&ProfileTableDecorator::m_glGetnTexImageARB_profile;}
+if(this->m_ptr_glClear){this->m_next_glClear = this->m_ptr_glClear;this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&ProfileTableDecorator::m_glClear_profile;}
+if(this->m_ptr_glVertexArrayParameteriAPPLE){this->m_next_glVertexArrayParameteriAPPLE = this->m_ptr_glVertexArrayParameteriAPPLE;this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&ProfileTableDecorator::m_glVertexArrayParameteriAPPLE_profile;}
+if(this->m_ptr_glMultiTexCoord2dvARB){this->m_next_glMultiTexCoord2dvARB = this->m_ptr_glMultiTexCoord2dvARB;this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2dvARB_profile;}
+if(this->m_ptr_glGetVideoCaptureStreamdvNV){this->m_next_glGetVideoCaptureStreamdvNV = this->m_ptr_glGetVideoCaptureStreamdvNV;this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&ProfileTableDecorator::m_glGetVideoCaptureStreamdvNV_profile;}
+if(this->m_ptr_glFragmentLightModelivSGIX){this->m_next_glFragmentLightModelivSGIX = this->m_ptr_glFragmentLightModelivSGIX;this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&ProfileTableDecorator::m_glFragmentLightModelivSGIX_profile;}
+if(this->m_ptr_glVertexAttribP2ui){this->m_next_glVertexAttribP2ui = this->m_ptr_glVertexAttribP2ui;this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&ProfileTableDecorator::m_glVertexAttribP2ui_profile;}
+if(this->m_ptr_glMultiTexCoordPointerEXT){this->m_next_glMultiTexCoordPointerEXT = this->m_ptr_glMultiTexCoordPointerEXT;this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&ProfileTableDecorator::m_glMultiTexCoordPointerEXT_profile;}
+if(this->m_ptr_glProgramUniform3iEXT){this->m_next_glProgramUniform3iEXT = this->m_ptr_glProgramUniform3iEXT;this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&ProfileTableDecorator::m_glProgramUniform3iEXT_profile;}
+if(this->m_ptr_glTranslatef){this->m_next_glTranslatef = this->m_ptr_glTranslatef;this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&ProfileTableDecorator::m_glTranslatef_profile;}
+if(this->m_ptr_glVertexAttrib4Nub){this->m_next_glVertexAttrib4Nub = this->m_ptr_glVertexAttrib4Nub;this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&ProfileTableDecorator::m_glVertexAttrib4Nub_profile;}
+if(this->m_ptr_glTranslated){this->m_next_glTranslated = this->m_ptr_glTranslated;this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&ProfileTableDecorator::m_glTranslated_profile;}
+if(this->m_ptr_glSamplerParameterIiv){this->m_next_glSamplerParameterIiv = this->m_ptr_glSamplerParameterIiv;this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&ProfileTableDecorator::m_glSamplerParameterIiv_profile;}
+if(this->m_ptr_glTexCoord4hNV){this->m_next_glTexCoord4hNV = this->m_ptr_glTexCoord4hNV;this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&ProfileTableDecorator::m_glTexCoord4hNV_profile;}
+if(this->m_ptr_glDrawElementsIndirect){this->m_next_glDrawElementsIndirect = this->m_ptr_glDrawElementsIndirect;this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&ProfileTableDecorator::m_glDrawElementsIndirect_profile;}
+if(this->m_ptr_glDeletePerfMonitorsAMD){this->m_next_glDeletePerfMonitorsAMD = this->m_ptr_glDeletePerfMonitorsAMD;this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&ProfileTableDecorator::m_glDeletePerfMonitorsAMD_profile;}
+if(this->m_ptr_glIsRenderbufferEXT){this->m_next_glIsRenderbufferEXT = this->m_ptr_glIsRenderbufferEXT;this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glIsRenderbufferEXT_profile;}
+if(this->m_ptr_glDrawCommandsNV){this->m_next_glDrawCommandsNV = this->m_ptr_glDrawCommandsNV;this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&ProfileTableDecorator::m_glDrawCommandsNV_profile;}
+if(this->m_ptr_glUniform3ivARB){this->m_next_glUniform3ivARB = this->m_ptr_glUniform3ivARB;this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&ProfileTableDecorator::m_glUniform3ivARB_profile;}
+if(this->m_ptr_glBufferSubData){this->m_next_glBufferSubData = this->m_ptr_glBufferSubData;this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glBufferSubData_profile;}
+if(this->m_ptr_glSecondaryColor3bv){this->m_next_glSecondaryColor3bv = this->m_ptr_glSecondaryColor3bv;this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&ProfileTableDecorator::m_glSecondaryColor3bv_profile;}
+if(this->m_ptr_glMatrixMultTransposedEXT){this->m_next_glMatrixMultTransposedEXT = this->m_ptr_glMatrixMultTransposedEXT;this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&ProfileTableDecorator::m_glMatrixMultTransposedEXT_profile;}
+if(this->m_ptr_glRequestResidentProgramsNV){this->m_next_glRequestResidentProgramsNV = this->m_ptr_glRequestResidentProgramsNV;this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&ProfileTableDecorator::m_glRequestResidentProgramsNV_profile;}
+if(this->m_ptr_glAlphaFragmentOp1ATI){this->m_next_glAlphaFragmentOp1ATI = this->m_ptr_glAlphaFragmentOp1ATI;this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&ProfileTableDecorator::m_glAlphaFragmentOp1ATI_profile;}
+if(this->m_ptr_glGetQueryObjecti64v){this->m_next_glGetQueryObjecti64v = this->m_ptr_glGetQueryObjecti64v;this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&ProfileTableDecorator::m_glGetQueryObjecti64v_profile;}
+if(this->m_ptr_glMatrixMult3x3fNV){this->m_next_glMatrixMult3x3fNV = this->m_ptr_glMatrixMult3x3fNV;this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&ProfileTableDecorator::m_glMatrixMult3x3fNV_profile;}
+if(this->m_ptr_glColorTableParameteriv){this->m_next_glColorTableParameteriv = this->m_ptr_glColorTableParameteriv;this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&ProfileTableDecorator::m_glColorTableParameteriv_profile;}
+if(this->m_ptr_glPathSubCommandsNV){this->m_next_glPathSubCommandsNV = this->m_ptr_glPathSubCommandsNV;this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&ProfileTableDecorator::m_glPathSubCommandsNV_profile;}
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV){this->m_next_glGetFinalCombinerInputParameterivNV = this->m_ptr_glGetFinalCombinerInputParameterivNV;this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetFinalCombinerInputParameterivNV_profile;}
+if(this->m_ptr_glIsRenderbuffer){this->m_next_glIsRenderbuffer = this->m_ptr_glIsRenderbuffer;this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&ProfileTableDecorator::m_glIsRenderbuffer_profile;}
+if(this->m_ptr_glVertex3iv){this->m_next_glVertex3iv = this->m_ptr_glVertex3iv;this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&ProfileTableDecorator::m_glVertex3iv_profile;}
+if(this->m_ptr_glTexGenfv){this->m_next_glTexGenfv = this->m_ptr_glTexGenfv;this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&ProfileTableDecorator::m_glTexGenfv_profile;}
+if(this->m_ptr_glFrustumfOES){this->m_next_glFrustumfOES = this->m_ptr_glFrustumfOES;this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&ProfileTableDecorator::m_glFrustumfOES_profile;}
+if(this->m_ptr_glBindVertexBuffers){this->m_next_glBindVertexBuffers = this->m_ptr_glBindVertexBuffers;this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&ProfileTableDecorator::m_glBindVertexBuffers_profile;}
+if(this->m_ptr_glMateriali){this->m_next_glMateriali = this->m_ptr_glMateriali;this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&ProfileTableDecorator::m_glMateriali_profile;}
+if(this->m_ptr_glMultiTexCoord2svARB){this->m_next_glMultiTexCoord2svARB = this->m_ptr_glMultiTexCoord2svARB;this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2svARB_profile;}
+if(this->m_ptr_glDisableVertexAttribArray){this->m_next_glDisableVertexAttribArray = this->m_ptr_glDisableVertexAttribArray;this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&ProfileTableDecorator::m_glDisableVertexAttribArray_profile;}
+if(this->m_ptr_glWindowPos3ivARB){this->m_next_glWindowPos3ivARB = this->m_ptr_glWindowPos3ivARB;this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&ProfileTableDecorator::m_glWindowPos3ivARB_profile;}
+if(this->m_ptr_glTexCoordFormatNV){this->m_next_glTexCoordFormatNV = this->m_ptr_glTexCoordFormatNV;this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&ProfileTableDecorator::m_glTexCoordFormatNV_profile;}
+if(this->m_ptr_glBlitNamedFramebuffer){this->m_next_glBlitNamedFramebuffer = this->m_ptr_glBlitNamedFramebuffer;this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&ProfileTableDecorator::m_glBlitNamedFramebuffer_profile;}
+if(this->m_ptr_glMatrixLoadTransposefEXT){this->m_next_glMatrixLoadTransposefEXT = this->m_ptr_glMatrixLoadTransposefEXT;this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&ProfileTableDecorator::m_glMatrixLoadTransposefEXT_profile;}
+if(this->m_ptr_glMultiTexGenfEXT){this->m_next_glMultiTexGenfEXT = this->m_ptr_glMultiTexGenfEXT;this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&ProfileTableDecorator::m_glMultiTexGenfEXT_profile;}
+if(this->m_ptr_glShaderStorageBlockBinding){this->m_next_glShaderStorageBlockBinding = this->m_ptr_glShaderStorageBlockBinding;this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&ProfileTableDecorator::m_glShaderStorageBlockBinding_profile;}
+if(this->m_ptr_glMaterialf){this->m_next_glMaterialf = this->m_ptr_glMaterialf;this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&ProfileTableDecorator::m_glMaterialf_profile;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN){this->m_next_glReplacementCodeuiColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT){this->m_next_glCheckNamedFramebufferStatusEXT = this->m_ptr_glCheckNamedFramebufferStatusEXT;this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&ProfileTableDecorator::m_glCheckNamedFramebufferStatusEXT_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT){this->m_next_glVertexArrayVertexAttribFormatEXT = this->m_ptr_glVertexArrayVertexAttribFormatEXT;this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribFormatEXT_profile;}
+if(this->m_ptr_glVertex2hNV){this->m_next_glVertex2hNV = this->m_ptr_glVertex2hNV;this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&ProfileTableDecorator::m_glVertex2hNV_profile;}
+if(this->m_ptr_glDeleteVertexShaderEXT){this->m_next_glDeleteVertexShaderEXT = this->m_ptr_glDeleteVertexShaderEXT;this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&ProfileTableDecorator::m_glDeleteVertexShaderEXT_profile;}
+if(this->m_ptr_glTexImage3DEXT){this->m_next_glTexImage3DEXT = this->m_ptr_glTexImage3DEXT;this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&ProfileTableDecorator::m_glTexImage3DEXT_profile;}
+if(this->m_ptr_glSignalVkFenceNV){this->m_next_glSignalVkFenceNV = this->m_ptr_glSignalVkFenceNV;this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&ProfileTableDecorator::m_glSignalVkFenceNV_profile;}
+if(this->m_ptr_glProgramLocalParameterI4ivNV){this->m_next_glProgramLocalParameterI4ivNV = this->m_ptr_glProgramLocalParameterI4ivNV;this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&ProfileTableDecorator::m_glProgramLocalParameterI4ivNV_profile;}
+if(this->m_ptr_glGlobalAlphaFactoriSUN){this->m_next_glGlobalAlphaFactoriSUN = this->m_ptr_glGlobalAlphaFactoriSUN;this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactoriSUN_profile;}
+if(this->m_ptr_glTextureStorage1D){this->m_next_glTextureStorage1D = this->m_ptr_glTextureStorage1D;this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&ProfileTableDecorator::m_glTextureStorage1D_profile;}
+if(this->m_ptr_glBinormal3sEXT){this->m_next_glBinormal3sEXT = this->m_ptr_glBinormal3sEXT;this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&ProfileTableDecorator::m_glBinormal3sEXT_profile;}
+if(this->m_ptr_glGetProgramInterfaceiv){this->m_next_glGetProgramInterfaceiv = this->m_ptr_glGetProgramInterfaceiv;this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&ProfileTableDecorator::m_glGetProgramInterfaceiv_profile;}
+if(this->m_ptr_glMatrixIndexPointerARB){this->m_next_glMatrixIndexPointerARB = this->m_ptr_glMatrixIndexPointerARB;this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&ProfileTableDecorator::m_glMatrixIndexPointerARB_profile;}
+if(this->m_ptr_glTexCoordPointerEXT){this->m_next_glTexCoordPointerEXT = this->m_ptr_glTexCoordPointerEXT;this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&ProfileTableDecorator::m_glTexCoordPointerEXT_profile;}
+if(this->m_ptr_glMultiTexGeniEXT){this->m_next_glMultiTexGeniEXT = this->m_ptr_glMultiTexGeniEXT;this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&ProfileTableDecorator::m_glMultiTexGeniEXT_profile;}
+if(this->m_ptr_glVertexAttrib2fNV){this->m_next_glVertexAttrib2fNV = this->m_ptr_glVertexAttrib2fNV;this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&ProfileTableDecorator::m_glVertexAttrib2fNV_profile;}
+if(this->m_ptr_glNamedProgramStringEXT){this->m_next_glNamedProgramStringEXT = this->m_ptr_glNamedProgramStringEXT;this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&ProfileTableDecorator::m_glNamedProgramStringEXT_profile;}
+if(this->m_ptr_glMapNamedBuffer){this->m_next_glMapNamedBuffer = this->m_ptr_glMapNamedBuffer;this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&ProfileTableDecorator::m_glMapNamedBuffer_profile;}
+if(this->m_ptr_glGetMinmaxParameteriv){this->m_next_glGetMinmaxParameteriv = this->m_ptr_glGetMinmaxParameteriv;this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&ProfileTableDecorator::m_glGetMinmaxParameteriv_profile;}
+if(this->m_ptr_glGetnUniformdv){this->m_next_glGetnUniformdv = this->m_ptr_glGetnUniformdv;this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&ProfileTableDecorator::m_glGetnUniformdv_profile;}
+if(this->m_ptr_glEndConditionalRenderNVX){this->m_next_glEndConditionalRenderNVX = this->m_ptr_glEndConditionalRenderNVX;this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&ProfileTableDecorator::m_glEndConditionalRenderNVX_profile;}
+if(this->m_ptr_glBinormal3fEXT){this->m_next_glBinormal3fEXT = this->m_ptr_glBinormal3fEXT;this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&ProfileTableDecorator::m_glBinormal3fEXT_profile;}
+if(this->m_ptr_glNormalStream3iATI){this->m_next_glNormalStream3iATI = this->m_ptr_glNormalStream3iATI;this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&ProfileTableDecorator::m_glNormalStream3iATI_profile;}
+if(this->m_ptr_glProgramBufferParametersIivNV){this->m_next_glProgramBufferParametersIivNV = this->m_ptr_glProgramBufferParametersIivNV;this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&ProfileTableDecorator::m_glProgramBufferParametersIivNV_profile;}
+if(this->m_ptr_glMapGrid1xOES){this->m_next_glMapGrid1xOES = this->m_ptr_glMapGrid1xOES;this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&ProfileTableDecorator::m_glMapGrid1xOES_profile;}
+if(this->m_ptr_glGetVertexAttribPointervARB){this->m_next_glGetVertexAttribPointervARB = this->m_ptr_glGetVertexAttribPointervARB;this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&ProfileTableDecorator::m_glGetVertexAttribPointervARB_profile;}
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT){this->m_next_glFlushMappedNamedBufferRangeEXT = this->m_ptr_glFlushMappedNamedBufferRangeEXT;this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&ProfileTableDecorator::m_glFlushMappedNamedBufferRangeEXT_profile;}
+if(this->m_ptr_glGetVertexAttribIiv){this->m_next_glGetVertexAttribIiv = this->m_ptr_glGetVertexAttribIiv;this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&ProfileTableDecorator::m_glGetVertexAttribIiv_profile;}
+if(this->m_ptr_glVertexP4uiv){this->m_next_glVertexP4uiv = this->m_ptr_glVertexP4uiv;this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&ProfileTableDecorator::m_glVertexP4uiv_profile;}
+if(this->m_ptr_glUniformui64NV){this->m_next_glUniformui64NV = this->m_ptr_glUniformui64NV;this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&ProfileTableDecorator::m_glUniformui64NV_profile;}
+if(this->m_ptr_glColor4fv){this->m_next_glColor4fv = this->m_ptr_glColor4fv;this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&ProfileTableDecorator::m_glColor4fv_profile;}
+if(this->m_ptr_glTexParameterxvOES){this->m_next_glTexParameterxvOES = this->m_ptr_glTexParameterxvOES;this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&ProfileTableDecorator::m_glTexParameterxvOES_profile;}
+if(this->m_ptr_glPatchParameteri){this->m_next_glPatchParameteri = this->m_ptr_glPatchParameteri;this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&ProfileTableDecorator::m_glPatchParameteri_profile;}
+if(this->m_ptr_glMap1d){this->m_next_glMap1d = this->m_ptr_glMap1d;this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&ProfileTableDecorator::m_glMap1d_profile;}
+if(this->m_ptr_glGetTexFilterFuncSGIS){this->m_next_glGetTexFilterFuncSGIS = this->m_ptr_glGetTexFilterFuncSGIS;this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&ProfileTableDecorator::m_glGetTexFilterFuncSGIS_profile;}
+if(this->m_ptr_glVertexStream3dATI){this->m_next_glVertexStream3dATI = this->m_ptr_glVertexStream3dATI;this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&ProfileTableDecorator::m_glVertexStream3dATI_profile;}
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT){this->m_next_glVertexArrayVertexBindingDivisorEXT = this->m_ptr_glVertexArrayVertexBindingDivisorEXT;this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3svARB){this->m_next_glMultiTexCoord3svARB = this->m_ptr_glMultiTexCoord3svARB;this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3svARB_profile;}
+if(this->m_ptr_glBindProgramNV){this->m_next_glBindProgramNV = this->m_ptr_glBindProgramNV;this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&ProfileTableDecorator::m_glBindProgramNV_profile;}
+if(this->m_ptr_glGetConvolutionParameteriv){this->m_next_glGetConvolutionParameteriv = this->m_ptr_glGetConvolutionParameteriv;this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&ProfileTableDecorator::m_glGetConvolutionParameteriv_profile;}
+if(this->m_ptr_glGetProgramLocalParameterfvARB){this->m_next_glGetProgramLocalParameterfvARB = this->m_ptr_glGetProgramLocalParameterfvARB;this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&ProfileTableDecorator::m_glGetProgramLocalParameterfvARB_profile;}
+if(this->m_ptr_glGenFragmentShadersATI){this->m_next_glGenFragmentShadersATI = this->m_ptr_glGenFragmentShadersATI;this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&ProfileTableDecorator::m_glGenFragmentShadersATI_profile;}
+if(this->m_ptr_glTexBumpParameterivATI){this->m_next_glTexBumpParameterivATI = this->m_ptr_glTexBumpParameterivATI;this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&ProfileTableDecorator::m_glTexBumpParameterivATI_profile;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv){this->m_next_glGetNamedFramebufferAttachmentParameteriv = this->m_ptr_glGetNamedFramebufferAttachmentParameteriv;this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfileTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_profile;}
+if(this->m_ptr_glGetnSeparableFilter){this->m_next_glGetnSeparableFilter = this->m_ptr_glGetnSeparableFilter;this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&ProfileTableDecorator::m_glGetnSeparableFilter_profile;}
+if(this->m_ptr_glNormal3xvOES){this->m_next_glNormal3xvOES = this->m_ptr_glNormal3xvOES;this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&ProfileTableDecorator::m_glNormal3xvOES_profile;}
+if(this->m_ptr_glPassTexCoordATI){this->m_next_glPassTexCoordATI = this->m_ptr_glPassTexCoordATI;this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&ProfileTableDecorator::m_glPassTexCoordATI_profile;}
+if(this->m_ptr_glFramebufferTextureFaceARB){this->m_next_glFramebufferTextureFaceARB = this->m_ptr_glFramebufferTextureFaceARB;this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&ProfileTableDecorator::m_glFramebufferTextureFaceARB_profile;}
+if(this->m_ptr_glProgramUniform1dv){this->m_next_glProgramUniform1dv = this->m_ptr_glProgramUniform1dv;this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&ProfileTableDecorator::m_glProgramUniform1dv_profile;}
+if(this->m_ptr_glTextureStorage2DEXT){this->m_next_glTextureStorage2DEXT = this->m_ptr_glTextureStorage2DEXT;this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&ProfileTableDecorator::m_glTextureStorage2DEXT_profile;}
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT){this->m_next_glVertexArrayFogCoordOffsetEXT = this->m_ptr_glVertexArrayFogCoordOffsetEXT;this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayFogCoordOffsetEXT_profile;}
+if(this->m_ptr_glDeleteNamedStringARB){this->m_next_glDeleteNamedStringARB = this->m_ptr_glDeleteNamedStringARB;this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&ProfileTableDecorator::m_glDeleteNamedStringARB_profile;}
+if(this->m_ptr_glMulticastGetQueryObjecti64vNV){this->m_next_glMulticastGetQueryObjecti64vNV = this->m_ptr_glMulticastGetQueryObjecti64vNV;this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&ProfileTableDecorator::m_glMulticastGetQueryObjecti64vNV_profile;}
+if(this->m_ptr_glGenOcclusionQueriesNV){this->m_next_glGenOcclusionQueriesNV = this->m_ptr_glGenOcclusionQueriesNV;this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&ProfileTableDecorator::m_glGenOcclusionQueriesNV_profile;}
+if(this->m_ptr_glLighti){this->m_next_glLighti = this->m_ptr_glLighti;this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&ProfileTableDecorator::m_glLighti_profile;}
+if(this->m_ptr_glTexImage1D){this->m_next_glTexImage1D = this->m_ptr_glTexImage1D;this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&ProfileTableDecorator::m_glTexImage1D_profile;}
+if(this->m_ptr_glLightf){this->m_next_glLightf = this->m_ptr_glLightf;this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&ProfileTableDecorator::m_glLightf_profile;}
+if(this->m_ptr_glClientAttribDefaultEXT){this->m_next_glClientAttribDefaultEXT = this->m_ptr_glClientAttribDefaultEXT;this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&ProfileTableDecorator::m_glClientAttribDefaultEXT_profile;}
+if(this->m_ptr_glVertexAttrib4bvARB){this->m_next_glVertexAttrib4bvARB = this->m_ptr_glVertexAttrib4bvARB;this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4bvARB_profile;}
+if(this->m_ptr_glVertexAttribIFormatNV){this->m_next_glVertexAttribIFormatNV = this->m_ptr_glVertexAttribIFormatNV;this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&ProfileTableDecorator::m_glVertexAttribIFormatNV_profile;}
+if(this->m_ptr_glStencilFuncSeparate){this->m_next_glStencilFuncSeparate = this->m_ptr_glStencilFuncSeparate;this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&ProfileTableDecorator::m_glStencilFuncSeparate_profile;}
+if(this->m_ptr_glGetVertexAttribfvARB){this->m_next_glGetVertexAttribfvARB = this->m_ptr_glGetVertexAttribfvARB;this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&ProfileTableDecorator::m_glGetVertexAttribfvARB_profile;}
+if(this->m_ptr_glVertexAttrib2dNV){this->m_next_glVertexAttrib2dNV = this->m_ptr_glVertexAttrib2dNV;this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&ProfileTableDecorator::m_glVertexAttrib2dNV_profile;}
+if(this->m_ptr_glProgramUniform2iEXT){this->m_next_glProgramUniform2iEXT = this->m_ptr_glProgramUniform2iEXT;this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&ProfileTableDecorator::m_glProgramUniform2iEXT_profile;}
+if(this->m_ptr_glClientActiveVertexStreamATI){this->m_next_glClientActiveVertexStreamATI = this->m_ptr_glClientActiveVertexStreamATI;this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&ProfileTableDecorator::m_glClientActiveVertexStreamATI_profile;}
+if(this->m_ptr_glRasterPos3xOES){this->m_next_glRasterPos3xOES = this->m_ptr_glRasterPos3xOES;this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&ProfileTableDecorator::m_glRasterPos3xOES_profile;}
+if(this->m_ptr_glGetMapParameterivNV){this->m_next_glGetMapParameterivNV = this->m_ptr_glGetMapParameterivNV;this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetMapParameterivNV_profile;}
+if(this->m_ptr_glSampleCoverage){this->m_next_glSampleCoverage = this->m_ptr_glSampleCoverage;this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&ProfileTableDecorator::m_glSampleCoverage_profile;}
+if(this->m_ptr_glClearDepthxOES){this->m_next_glClearDepthxOES = this->m_ptr_glClearDepthxOES;this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&ProfileTableDecorator::m_glClearDepthxOES_profile;}
+if(this->m_ptr_glUniformBufferEXT){this->m_next_glUniformBufferEXT = this->m_ptr_glUniformBufferEXT;this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&ProfileTableDecorator::m_glUniformBufferEXT_profile;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN){this->m_next_glTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glMulticastGetQueryObjectuivNV){this->m_next_glMulticastGetQueryObjectuivNV = this->m_ptr_glMulticastGetQueryObjectuivNV;this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&ProfileTableDecorator::m_glMulticastGetQueryObjectuivNV_profile;}
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL){this->m_next_glGetFirstPerfQueryIdINTEL = this->m_ptr_glGetFirstPerfQueryIdINTEL;this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&ProfileTableDecorator::m_glGetFirstPerfQueryIdINTEL_profile;}
+if(this->m_ptr_glUnmapNamedBufferEXT){this->m_next_glUnmapNamedBufferEXT = this->m_ptr_glUnmapNamedBufferEXT;this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&ProfileTableDecorator::m_glUnmapNamedBufferEXT_profile;}
+if(this->m_ptr_glGetTransformFeedbacki_v){this->m_next_glGetTransformFeedbacki_v = this->m_ptr_glGetTransformFeedbacki_v;this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&ProfileTableDecorator::m_glGetTransformFeedbacki_v_profile;}
+if(this->m_ptr_glUniform4fvARB){this->m_next_glUniform4fvARB = this->m_ptr_glUniform4fvARB;this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&ProfileTableDecorator::m_glUniform4fvARB_profile;}
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV){this->m_next_glRenderbufferStorageMultisampleCoverageNV = this->m_ptr_glRenderbufferStorageMultisampleCoverageNV;this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&ProfileTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_profile;}
+if(this->m_ptr_glGetFloati_vEXT){this->m_next_glGetFloati_vEXT = this->m_ptr_glGetFloati_vEXT;this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&ProfileTableDecorator::m_glGetFloati_vEXT_profile;}
+if(this->m_ptr_glBindAttribLocationARB){this->m_next_glBindAttribLocationARB = this->m_ptr_glBindAttribLocationARB;this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&ProfileTableDecorator::m_glBindAttribLocationARB_profile;}
+if(this->m_ptr_glBufferAddressRangeNV){this->m_next_glBufferAddressRangeNV = this->m_ptr_glBufferAddressRangeNV;this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&ProfileTableDecorator::m_glBufferAddressRangeNV_profile;}
+if(this->m_ptr_glGenProgramsARB){this->m_next_glGenProgramsARB = this->m_ptr_glGenProgramsARB;this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&ProfileTableDecorator::m_glGenProgramsARB_profile;}
+if(this->m_ptr_glMultiTexEnvivEXT){this->m_next_glMultiTexEnvivEXT = this->m_ptr_glMultiTexEnvivEXT;this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&ProfileTableDecorator::m_glMultiTexEnvivEXT_profile;}
+if(this->m_ptr_glSecondaryColor3uiEXT){this->m_next_glSecondaryColor3uiEXT = this->m_ptr_glSecondaryColor3uiEXT;this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3uiEXT_profile;}
+if(this->m_ptr_glCompressedTextureImage2DEXT){this->m_next_glCompressedTextureImage2DEXT = this->m_ptr_glCompressedTextureImage2DEXT;this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureImage2DEXT_profile;}
+if(this->m_ptr_glUniform2i){this->m_next_glUniform2i = this->m_ptr_glUniform2i;this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&ProfileTableDecorator::m_glUniform2i_profile;}
+if(this->m_ptr_glCopyTexImage2DEXT){this->m_next_glCopyTexImage2DEXT = this->m_ptr_glCopyTexImage2DEXT;this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyTexImage2DEXT_profile;}
+if(this->m_ptr_glUniform2d){this->m_next_glUniform2d = this->m_ptr_glUniform2d;this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&ProfileTableDecorator::m_glUniform2d_profile;}
+if(this->m_ptr_glVertexAttribL1d){this->m_next_glVertexAttribL1d = this->m_ptr_glVertexAttribL1d;this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&ProfileTableDecorator::m_glVertexAttribL1d_profile;}
+if(this->m_ptr_glFramebufferTextureFaceEXT){this->m_next_glFramebufferTextureFaceEXT = this->m_ptr_glFramebufferTextureFaceEXT;this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfileTableDecorator::m_glFramebufferTextureFaceEXT_profile;}
+if(this->m_ptr_glFramebufferTextureLayer){this->m_next_glFramebufferTextureLayer = this->m_ptr_glFramebufferTextureLayer;this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&ProfileTableDecorator::m_glFramebufferTextureLayer_profile;}
+if(this->m_ptr_glMultiTexCoord4bvOES){this->m_next_glMultiTexCoord4bvOES = this->m_ptr_glMultiTexCoord4bvOES;this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord4bvOES_profile;}
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT){this->m_next_glGetVertexArrayPointeri_vEXT = this->m_ptr_glGetVertexArrayPointeri_vEXT;this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&ProfileTableDecorator::m_glGetVertexArrayPointeri_vEXT_profile;}
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT){this->m_next_glNamedProgramLocalParameter4dEXT = this->m_ptr_glNamedProgramLocalParameter4dEXT;this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameter4dEXT_profile;}
+if(this->m_ptr_glBinormal3bEXT){this->m_next_glBinormal3bEXT = this->m_ptr_glBinormal3bEXT;this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&ProfileTableDecorator::m_glBinormal3bEXT_profile;}
+if(this->m_ptr_glConvolutionFilter2DEXT){this->m_next_glConvolutionFilter2DEXT = this->m_ptr_glConvolutionFilter2DEXT;this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&ProfileTableDecorator::m_glConvolutionFilter2DEXT_profile;}
+if(this->m_ptr_glProgramUniform2fv){this->m_next_glProgramUniform2fv = this->m_ptr_glProgramUniform2fv;this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&ProfileTableDecorator::m_glProgramUniform2fv_profile;}
+if(this->m_ptr_glColor3fVertex3fSUN){this->m_next_glColor3fVertex3fSUN = this->m_ptr_glColor3fVertex3fSUN;this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glColor3fVertex3fSUN_profile;}
+if(this->m_ptr_glNormal3fVertex3fvSUN){this->m_next_glNormal3fVertex3fvSUN = this->m_ptr_glNormal3fVertex3fvSUN;this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT){this->m_next_glCopyMultiTexSubImage3DEXT = this->m_ptr_glCopyMultiTexSubImage3DEXT;this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCopyMultiTexSubImage3DEXT_profile;}
+if(this->m_ptr_glProgramLocalParameterI4iNV){this->m_next_glProgramLocalParameterI4iNV = this->m_ptr_glProgramLocalParameterI4iNV;this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&ProfileTableDecorator::m_glProgramLocalParameterI4iNV_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x4dv){this->m_next_glProgramUniformMatrix2x4dv = this->m_ptr_glProgramUniformMatrix2x4dv;this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x4dv_profile;}
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV){this->m_next_glPathMemoryGlyphIndexArrayNV = this->m_ptr_glPathMemoryGlyphIndexArrayNV;this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&ProfileTableDecorator::m_glPathMemoryGlyphIndexArrayNV_profile;}
+if(this->m_ptr_glDrawArraysEXT){this->m_next_glDrawArraysEXT = this->m_ptr_glDrawArraysEXT;this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&ProfileTableDecorator::m_glDrawArraysEXT_profile;}
+if(this->m_ptr_glBlendEquationEXT){this->m_next_glBlendEquationEXT = this->m_ptr_glBlendEquationEXT;this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&ProfileTableDecorator::m_glBlendEquationEXT_profile;}
+if(this->m_ptr_glStencilOp){this->m_next_glStencilOp = this->m_ptr_glStencilOp;this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&ProfileTableDecorator::m_glStencilOp_profile;}
+if(this->m_ptr_glCopyTextureSubImage2DEXT){this->m_next_glCopyTextureSubImage2DEXT = this->m_ptr_glCopyTextureSubImage2DEXT;this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyTextureSubImage2DEXT_profile;}
+if(this->m_ptr_glTexEnvf){this->m_next_glTexEnvf = this->m_ptr_glTexEnvf;this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&ProfileTableDecorator::m_glTexEnvf_profile;}
+if(this->m_ptr_glVertexAttrib2dvNV){this->m_next_glVertexAttrib2dvNV = this->m_ptr_glVertexAttrib2dvNV;this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&ProfileTableDecorator::m_glVertexAttrib2dvNV_profile;}
+if(this->m_ptr_glGenPerfMonitorsAMD){this->m_next_glGenPerfMonitorsAMD = this->m_ptr_glGenPerfMonitorsAMD;this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&ProfileTableDecorator::m_glGenPerfMonitorsAMD_profile;}
+if(this->m_ptr_glGetInteger64i_v){this->m_next_glGetInteger64i_v = this->m_ptr_glGetInteger64i_v;this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&ProfileTableDecorator::m_glGetInteger64i_v_profile;}
+if(this->m_ptr_glGetHistogramParameterfv){this->m_next_glGetHistogramParameterfv = this->m_ptr_glGetHistogramParameterfv;this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&ProfileTableDecorator::m_glGetHistogramParameterfv_profile;}
+if(this->m_ptr_glVertexFormatNV){this->m_next_glVertexFormatNV = this->m_ptr_glVertexFormatNV;this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&ProfileTableDecorator::m_glVertexFormatNV_profile;}
+if(this->m_ptr_glBlendFuncIndexedAMD){this->m_next_glBlendFuncIndexedAMD = this->m_ptr_glBlendFuncIndexedAMD;this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&ProfileTableDecorator::m_glBlendFuncIndexedAMD_profile;}
+if(this->m_ptr_glTexEnvi){this->m_next_glTexEnvi = this->m_ptr_glTexEnvi;this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&ProfileTableDecorator::m_glTexEnvi_profile;}
+if(this->m_ptr_glMultiTexCoord1iv){this->m_next_glMultiTexCoord1iv = this->m_ptr_glMultiTexCoord1iv;this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&ProfileTableDecorator::m_glMultiTexCoord1iv_profile;}
+if(this->m_ptr_glIsEnabledi){this->m_next_glIsEnabledi = this->m_ptr_glIsEnabledi;this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&ProfileTableDecorator::m_glIsEnabledi_profile;}
+if(this->m_ptr_glVertexAttribL2ui64vNV){this->m_next_glVertexAttribL2ui64vNV = this->m_ptr_glVertexAttribL2ui64vNV;this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL2ui64vNV_profile;}
+if(this->m_ptr_glVertexAttribL4i64NV){this->m_next_glVertexAttribL4i64NV = this->m_ptr_glVertexAttribL4i64NV;this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&ProfileTableDecorator::m_glVertexAttribL4i64NV_profile;}
+if(this->m_ptr_glMatrixTranslatedEXT){this->m_next_glMatrixTranslatedEXT = this->m_ptr_glMatrixTranslatedEXT;this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&ProfileTableDecorator::m_glMatrixTranslatedEXT_profile;}
+if(this->m_ptr_glMakeTextureHandleResidentARB){this->m_next_glMakeTextureHandleResidentARB = this->m_ptr_glMakeTextureHandleResidentARB;this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&ProfileTableDecorator::m_glMakeTextureHandleResidentARB_profile;}
+if(this->m_ptr_glMatrixMultdEXT){this->m_next_glMatrixMultdEXT = this->m_ptr_glMatrixMultdEXT;this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&ProfileTableDecorator::m_glMatrixMultdEXT_profile;}
+if(this->m_ptr_glBinormal3dvEXT){this->m_next_glBinormal3dvEXT = this->m_ptr_glBinormal3dvEXT;this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&ProfileTableDecorator::m_glBinormal3dvEXT_profile;}
+if(this->m_ptr_glImportSyncEXT){this->m_next_glImportSyncEXT = this->m_ptr_glImportSyncEXT;this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&ProfileTableDecorator::m_glImportSyncEXT_profile;}
+if(this->m_ptr_glGetMapiv){this->m_next_glGetMapiv = this->m_ptr_glGetMapiv;this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&ProfileTableDecorator::m_glGetMapiv_profile;}
+if(this->m_ptr_glImportSemaphoreFdEXT){this->m_next_glImportSemaphoreFdEXT = this->m_ptr_glImportSemaphoreFdEXT;this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&ProfileTableDecorator::m_glImportSemaphoreFdEXT_profile;}
+if(this->m_ptr_glMultiTexCoord4sv){this->m_next_glMultiTexCoord4sv = this->m_ptr_glMultiTexCoord4sv;this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&ProfileTableDecorator::m_glMultiTexCoord4sv_profile;}
+if(this->m_ptr_glPNTrianglesiATI){this->m_next_glPNTrianglesiATI = this->m_ptr_glPNTrianglesiATI;this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&ProfileTableDecorator::m_glPNTrianglesiATI_profile;}
+if(this->m_ptr_glBindVertexArrayAPPLE){this->m_next_glBindVertexArrayAPPLE = this->m_ptr_glBindVertexArrayAPPLE;this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&ProfileTableDecorator::m_glBindVertexArrayAPPLE_profile;}
+if(this->m_ptr_glObjectPtrLabel){this->m_next_glObjectPtrLabel = this->m_ptr_glObjectPtrLabel;this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&ProfileTableDecorator::m_glObjectPtrLabel_profile;}
+if(this->m_ptr_glGetDebugMessageLog){this->m_next_glGetDebugMessageLog = this->m_ptr_glGetDebugMessageLog;this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&ProfileTableDecorator::m_glGetDebugMessageLog_profile;}
+if(this->m_ptr_glTrackMatrixNV){this->m_next_glTrackMatrixNV = this->m_ptr_glTrackMatrixNV;this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&ProfileTableDecorator::m_glTrackMatrixNV_profile;}
+if(this->m_ptr_glProgramPathFragmentInputGenNV){this->m_next_glProgramPathFragmentInputGenNV = this->m_ptr_glProgramPathFragmentInputGenNV;this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&ProfileTableDecorator::m_glProgramPathFragmentInputGenNV_profile;}
+if(this->m_ptr_glTangent3ivEXT){this->m_next_glTangent3ivEXT = this->m_ptr_glTangent3ivEXT;this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&ProfileTableDecorator::m_glTangent3ivEXT_profile;}
+if(this->m_ptr_glGetUniformfv){this->m_next_glGetUniformfv = this->m_ptr_glGetUniformfv;this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&ProfileTableDecorator::m_glGetUniformfv_profile;}
+if(this->m_ptr_glSecondaryColor3ubv){this->m_next_glSecondaryColor3ubv = this->m_ptr_glSecondaryColor3ubv;this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&ProfileTableDecorator::m_glSecondaryColor3ubv_profile;}
+if(this->m_ptr_glMakeTextureHandleNonResidentNV){this->m_next_glMakeTextureHandleNonResidentNV = this->m_ptr_glMakeTextureHandleNonResidentNV;this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeTextureHandleNonResidentNV_profile;}
+if(this->m_ptr_glVertexAttribs4ubvNV){this->m_next_glVertexAttribs4ubvNV = this->m_ptr_glVertexAttribs4ubvNV;this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&ProfileTableDecorator::m_glVertexAttribs4ubvNV_profile;}
+if(this->m_ptr_glClipPlanexOES){this->m_next_glClipPlanexOES = this->m_ptr_glClipPlanexOES;this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&ProfileTableDecorator::m_glClipPlanexOES_profile;}
+if(this->m_ptr_glMultiTexCoord3iv){this->m_next_glMultiTexCoord3iv = this->m_ptr_glMultiTexCoord3iv;this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&ProfileTableDecorator::m_glMultiTexCoord3iv_profile;}
+if(this->m_ptr_glGetnPolygonStippleARB){this->m_next_glGetnPolygonStippleARB = this->m_ptr_glGetnPolygonStippleARB;this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&ProfileTableDecorator::m_glGetnPolygonStippleARB_profile;}
+if(this->m_ptr_glUniform2i64vNV){this->m_next_glUniform2i64vNV = this->m_ptr_glUniform2i64vNV;this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&ProfileTableDecorator::m_glUniform2i64vNV_profile;}
+if(this->m_ptr_glLightModelf){this->m_next_glLightModelf = this->m_ptr_glLightModelf;this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&ProfileTableDecorator::m_glLightModelf_profile;}
+if(this->m_ptr_glDeleteMemoryObjectsEXT){this->m_next_glDeleteMemoryObjectsEXT = this->m_ptr_glDeleteMemoryObjectsEXT;this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&ProfileTableDecorator::m_glDeleteMemoryObjectsEXT_profile;}
+if(this->m_ptr_glMultiTexSubImage2DEXT){this->m_next_glMultiTexSubImage2DEXT = this->m_ptr_glMultiTexSubImage2DEXT;this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glMultiTexSubImage2DEXT_profile;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN){this->m_next_glReplacementCodeuiColor3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_profile;}
+if(this->m_ptr_glTangent3dvEXT){this->m_next_glTangent3dvEXT = this->m_ptr_glTangent3dvEXT;this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&ProfileTableDecorator::m_glTangent3dvEXT_profile;}
+if(this->m_ptr_glLightModeli){this->m_next_glLightModeli = this->m_ptr_glLightModeli;this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&ProfileTableDecorator::m_glLightModeli_profile;}
+if(this->m_ptr_glVertexWeighthvNV){this->m_next_glVertexWeighthvNV = this->m_ptr_glVertexWeighthvNV;this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&ProfileTableDecorator::m_glVertexWeighthvNV_profile;}
+if(this->m_ptr_glWindowPos3iv){this->m_next_glWindowPos3iv = this->m_ptr_glWindowPos3iv;this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&ProfileTableDecorator::m_glWindowPos3iv_profile;}
+if(this->m_ptr_glMultiTexCoordP1uiv){this->m_next_glMultiTexCoordP1uiv = this->m_ptr_glMultiTexCoordP1uiv;this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&ProfileTableDecorator::m_glMultiTexCoordP1uiv_profile;}
+if(this->m_ptr_glTransformPathNV){this->m_next_glTransformPathNV = this->m_ptr_glTransformPathNV;this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&ProfileTableDecorator::m_glTransformPathNV_profile;}
+if(this->m_ptr_glProgramNamedParameter4dNV){this->m_next_glProgramNamedParameter4dNV = this->m_ptr_glProgramNamedParameter4dNV;this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&ProfileTableDecorator::m_glProgramNamedParameter4dNV_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirect){this->m_next_glMultiDrawElementsIndirect = this->m_ptr_glMultiDrawElementsIndirect;this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirect_profile;}
+if(this->m_ptr_glProgramUniform1dEXT){this->m_next_glProgramUniform1dEXT = this->m_ptr_glProgramUniform1dEXT;this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&ProfileTableDecorator::m_glProgramUniform1dEXT_profile;}
+if(this->m_ptr_glCallLists){this->m_next_glCallLists = this->m_ptr_glCallLists;this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&ProfileTableDecorator::m_glCallLists_profile;}
+if(this->m_ptr_glNormal3hvNV){this->m_next_glNormal3hvNV = this->m_ptr_glNormal3hvNV;this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&ProfileTableDecorator::m_glNormal3hvNV_profile;}
+if(this->m_ptr_glGetCombinerOutputParameterfvNV){this->m_next_glGetCombinerOutputParameterfvNV = this->m_ptr_glGetCombinerOutputParameterfvNV;this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetCombinerOutputParameterfvNV_profile;}
+if(this->m_ptr_glVertexAttrib4sARB){this->m_next_glVertexAttrib4sARB = this->m_ptr_glVertexAttrib4sARB;this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&ProfileTableDecorator::m_glVertexAttrib4sARB_profile;}
+if(this->m_ptr_glTexCoord3i){this->m_next_glTexCoord3i = this->m_ptr_glTexCoord3i;this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&ProfileTableDecorator::m_glTexCoord3i_profile;}
+if(this->m_ptr_glVertexAttribI3uiv){this->m_next_glVertexAttribI3uiv = this->m_ptr_glVertexAttribI3uiv;this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&ProfileTableDecorator::m_glVertexAttribI3uiv_profile;}
+if(this->m_ptr_glPushDebugGroup){this->m_next_glPushDebugGroup = this->m_ptr_glPushDebugGroup;this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&ProfileTableDecorator::m_glPushDebugGroup_profile;}
+if(this->m_ptr_glTexCoord3f){this->m_next_glTexCoord3f = this->m_ptr_glTexCoord3f;this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&ProfileTableDecorator::m_glTexCoord3f_profile;}
+if(this->m_ptr_glTexCoord3d){this->m_next_glTexCoord3d = this->m_ptr_glTexCoord3d;this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&ProfileTableDecorator::m_glTexCoord3d_profile;}
+if(this->m_ptr_glTexCoord2xOES){this->m_next_glTexCoord2xOES = this->m_ptr_glTexCoord2xOES;this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&ProfileTableDecorator::m_glTexCoord2xOES_profile;}
+if(this->m_ptr_glGetStageIndexNV){this->m_next_glGetStageIndexNV = this->m_ptr_glGetStageIndexNV;this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&ProfileTableDecorator::m_glGetStageIndexNV_profile;}
+if(this->m_ptr_glProgramUniform4i64vNV){this->m_next_glProgramUniform4i64vNV = this->m_ptr_glProgramUniform4i64vNV;this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&ProfileTableDecorator::m_glProgramUniform4i64vNV_profile;}
+if(this->m_ptr_glGetNamedBufferPointervEXT){this->m_next_glGetNamedBufferPointervEXT = this->m_ptr_glGetNamedBufferPointervEXT;this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&ProfileTableDecorator::m_glGetNamedBufferPointervEXT_profile;}
+if(this->m_ptr_glTextureBarrierNV){this->m_next_glTextureBarrierNV = this->m_ptr_glTextureBarrierNV;this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&ProfileTableDecorator::m_glTextureBarrierNV_profile;}
+if(this->m_ptr_glColor4ubVertex3fvSUN){this->m_next_glColor4ubVertex3fvSUN = this->m_ptr_glColor4ubVertex3fvSUN;this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glColor4ubVertex3fvSUN_profile;}
+if(this->m_ptr_glGetCommandHeaderNV){this->m_next_glGetCommandHeaderNV = this->m_ptr_glGetCommandHeaderNV;this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&ProfileTableDecorator::m_glGetCommandHeaderNV_profile;}
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD){this->m_next_glGetPerfMonitorCounterInfoAMD = this->m_ptr_glGetPerfMonitorCounterInfoAMD;this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorCounterInfoAMD_profile;}
+if(this->m_ptr_glVertexAttrib1svARB){this->m_next_glVertexAttrib1svARB = this->m_ptr_glVertexAttrib1svARB;this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&ProfileTableDecorator::m_glVertexAttrib1svARB_profile;}
+if(this->m_ptr_glCombinerParameteriNV){this->m_next_glCombinerParameteriNV = this->m_ptr_glCombinerParameteriNV;this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&ProfileTableDecorator::m_glCombinerParameteriNV_profile;}
+if(this->m_ptr_glMatrixMultTransposefEXT){this->m_next_glMatrixMultTransposefEXT = this->m_ptr_glMatrixMultTransposefEXT;this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&ProfileTableDecorator::m_glMatrixMultTransposefEXT_profile;}
+if(this->m_ptr_glDetailTexFuncSGIS){this->m_next_glDetailTexFuncSGIS = this->m_ptr_glDetailTexFuncSGIS;this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&ProfileTableDecorator::m_glDetailTexFuncSGIS_profile;}
+if(this->m_ptr_glAreTexturesResident){this->m_next_glAreTexturesResident = this->m_ptr_glAreTexturesResident;this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&ProfileTableDecorator::m_glAreTexturesResident_profile;}
+if(this->m_ptr_glProgramUniform2d){this->m_next_glProgramUniform2d = this->m_ptr_glProgramUniform2d;this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&ProfileTableDecorator::m_glProgramUniform2d_profile;}
+if(this->m_ptr_glGetConvolutionParameterfvEXT){this->m_next_glGetConvolutionParameterfvEXT = this->m_ptr_glGetConvolutionParameterfvEXT;this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetConvolutionParameterfvEXT_profile;}
+if(this->m_ptr_glIndexPointerListIBM){this->m_next_glIndexPointerListIBM = this->m_ptr_glIndexPointerListIBM;this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glIndexPointerListIBM_profile;}
+if(this->m_ptr_glVertexAttribI4iEXT){this->m_next_glVertexAttribI4iEXT = this->m_ptr_glVertexAttribI4iEXT;this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4iEXT_profile;}
+if(this->m_ptr_glProgramUniform2f){this->m_next_glProgramUniform2f = this->m_ptr_glProgramUniform2f;this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&ProfileTableDecorator::m_glProgramUniform2f_profile;}
+if(this->m_ptr_glRasterPos4sv){this->m_next_glRasterPos4sv = this->m_ptr_glRasterPos4sv;this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&ProfileTableDecorator::m_glRasterPos4sv_profile;}
+if(this->m_ptr_glColor4s){this->m_next_glColor4s = this->m_ptr_glColor4s;this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&ProfileTableDecorator::m_glColor4s_profile;}
+if(this->m_ptr_glMulticastGetQueryObjectivNV){this->m_next_glMulticastGetQueryObjectivNV = this->m_ptr_glMulticastGetQueryObjectivNV;this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&ProfileTableDecorator::m_glMulticastGetQueryObjectivNV_profile;}
+if(this->m_ptr_glColorFragmentOp3ATI){this->m_next_glColorFragmentOp3ATI = this->m_ptr_glColorFragmentOp3ATI;this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&ProfileTableDecorator::m_glColorFragmentOp3ATI_profile;}
+if(this->m_ptr_glResizeBuffersMESA){this->m_next_glResizeBuffersMESA = this->m_ptr_glResizeBuffersMESA;this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&ProfileTableDecorator::m_glResizeBuffersMESA_profile;}
+if(this->m_ptr_glGetMinmaxParameterfv){this->m_next_glGetMinmaxParameterfv = this->m_ptr_glGetMinmaxParameterfv;this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&ProfileTableDecorator::m_glGetMinmaxParameterfv_profile;}
+if(this->m_ptr_glClientActiveTextureARB){this->m_next_glClientActiveTextureARB = this->m_ptr_glClientActiveTextureARB;this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&ProfileTableDecorator::m_glClientActiveTextureARB_profile;}
+if(this->m_ptr_glBindVertexArray){this->m_next_glBindVertexArray = this->m_ptr_glBindVertexArray;this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&ProfileTableDecorator::m_glBindVertexArray_profile;}
+if(this->m_ptr_glColor4b){this->m_next_glColor4b = this->m_ptr_glColor4b;this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&ProfileTableDecorator::m_glColor4b_profile;}
+if(this->m_ptr_glColor4f){this->m_next_glColor4f = this->m_ptr_glColor4f;this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&ProfileTableDecorator::m_glColor4f_profile;}
+if(this->m_ptr_glColor4d){this->m_next_glColor4d = this->m_ptr_glColor4d;this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&ProfileTableDecorator::m_glColor4d_profile;}
+if(this->m_ptr_glColor4i){this->m_next_glColor4i = this->m_ptr_glColor4i;this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&ProfileTableDecorator::m_glColor4i_profile;}
+if(this->m_ptr_glEdgeFlagFormatNV){this->m_next_glEdgeFlagFormatNV = this->m_ptr_glEdgeFlagFormatNV;this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&ProfileTableDecorator::m_glEdgeFlagFormatNV_profile;}
+if(this->m_ptr_glNamedBufferSubData){this->m_next_glNamedBufferSubData = this->m_ptr_glNamedBufferSubData;this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glNamedBufferSubData_profile;}
+if(this->m_ptr_glDrawElementsInstanced){this->m_next_glDrawElementsInstanced = this->m_ptr_glDrawElementsInstanced;this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&ProfileTableDecorator::m_glDrawElementsInstanced_profile;}
+if(this->m_ptr_glGetMultiTexParameterIivEXT){this->m_next_glGetMultiTexParameterIivEXT = this->m_ptr_glGetMultiTexParameterIivEXT;this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexParameterIivEXT_profile;}
+if(this->m_ptr_glVertex2dv){this->m_next_glVertex2dv = this->m_ptr_glVertex2dv;this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&ProfileTableDecorator::m_glVertex2dv_profile;}
+if(this->m_ptr_glDisableVertexArrayAttribEXT){this->m_next_glDisableVertexArrayAttribEXT = this->m_ptr_glDisableVertexArrayAttribEXT;this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&ProfileTableDecorator::m_glDisableVertexArrayAttribEXT_profile;}
+if(this->m_ptr_glObjectUnpurgeableAPPLE){this->m_next_glObjectUnpurgeableAPPLE = this->m_ptr_glObjectUnpurgeableAPPLE;this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&ProfileTableDecorator::m_glObjectUnpurgeableAPPLE_profile;}
+if(this->m_ptr_glVertexAttribs2dvNV){this->m_next_glVertexAttribs2dvNV = this->m_ptr_glVertexAttribs2dvNV;this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&ProfileTableDecorator::m_glVertexAttribs2dvNV_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN){this->m_next_glReplacementCodeuiTexCoord2fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_profile;}
+if(this->m_ptr_glGetMapParameterfvNV){this->m_next_glGetMapParameterfvNV = this->m_ptr_glGetMapParameterfvNV;this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetMapParameterfvNV_profile;}
+if(this->m_ptr_glProgramUniform4ivEXT){this->m_next_glProgramUniform4ivEXT = this->m_ptr_glProgramUniform4ivEXT;this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&ProfileTableDecorator::m_glProgramUniform4ivEXT_profile;}
+if(this->m_ptr_glProgramUniform3ui64vNV){this->m_next_glProgramUniform3ui64vNV = this->m_ptr_glProgramUniform3ui64vNV;this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&ProfileTableDecorator::m_glProgramUniform3ui64vNV_profile;}
+if(this->m_ptr_glRectfv){this->m_next_glRectfv = this->m_ptr_glRectfv;this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&ProfileTableDecorator::m_glRectfv_profile;}
+if(this->m_ptr_glTexFilterFuncSGIS){this->m_next_glTexFilterFuncSGIS = this->m_ptr_glTexFilterFuncSGIS;this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&ProfileTableDecorator::m_glTexFilterFuncSGIS_profile;}
+if(this->m_ptr_glSpriteParameterfvSGIX){this->m_next_glSpriteParameterfvSGIX = this->m_ptr_glSpriteParameterfvSGIX;this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&ProfileTableDecorator::m_glSpriteParameterfvSGIX_profile;}
+if(this->m_ptr_glCopyMultiTexImage1DEXT){this->m_next_glCopyMultiTexImage1DEXT = this->m_ptr_glCopyMultiTexImage1DEXT;this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyMultiTexImage1DEXT_profile;}
+if(this->m_ptr_glGetVertexAttribIuivEXT){this->m_next_glGetVertexAttribIuivEXT = this->m_ptr_glGetVertexAttribIuivEXT;this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&ProfileTableDecorator::m_glGetVertexAttribIuivEXT_profile;}
+if(this->m_ptr_glUniformMatrix2x4dv){this->m_next_glUniformMatrix2x4dv = this->m_ptr_glUniformMatrix2x4dv;this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&ProfileTableDecorator::m_glUniformMatrix2x4dv_profile;}
+if(this->m_ptr_glGetProgramResourceLocationIndex){this->m_next_glGetProgramResourceLocationIndex = this->m_ptr_glGetProgramResourceLocationIndex;this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&ProfileTableDecorator::m_glGetProgramResourceLocationIndex_profile;}
+if(this->m_ptr_glColor3hNV){this->m_next_glColor3hNV = this->m_ptr_glColor3hNV;this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&ProfileTableDecorator::m_glColor3hNV_profile;}
+if(this->m_ptr_glViewport){this->m_next_glViewport = this->m_ptr_glViewport;this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&ProfileTableDecorator::m_glViewport_profile;}
+if(this->m_ptr_glProgramNamedParameter4fNV){this->m_next_glProgramNamedParameter4fNV = this->m_ptr_glProgramNamedParameter4fNV;this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&ProfileTableDecorator::m_glProgramNamedParameter4fNV_profile;}
+if(this->m_ptr_glGetInvariantBooleanvEXT){this->m_next_glGetInvariantBooleanvEXT = this->m_ptr_glGetInvariantBooleanvEXT;this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&ProfileTableDecorator::m_glGetInvariantBooleanvEXT_profile;}
+if(this->m_ptr_glTexStorage2DMultisample){this->m_next_glTexStorage2DMultisample = this->m_ptr_glTexStorage2DMultisample;this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTexStorage2DMultisample_profile;}
+if(this->m_ptr_glPixelStorex){this->m_next_glPixelStorex = this->m_ptr_glPixelStorex;this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&ProfileTableDecorator::m_glPixelStorex_profile;}
+if(this->m_ptr_glVertexAttribL1dvEXT){this->m_next_glVertexAttribL1dvEXT = this->m_ptr_glVertexAttribL1dvEXT;this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&ProfileTableDecorator::m_glVertexAttribL1dvEXT_profile;}
+if(this->m_ptr_glGetActiveSubroutineUniformiv){this->m_next_glGetActiveSubroutineUniformiv = this->m_ptr_glGetActiveSubroutineUniformiv;this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&ProfileTableDecorator::m_glGetActiveSubroutineUniformiv_profile;}
+if(this->m_ptr_glVertexAttribPointerARB){this->m_next_glVertexAttribPointerARB = this->m_ptr_glVertexAttribPointerARB;this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&ProfileTableDecorator::m_glVertexAttribPointerARB_profile;}
+if(this->m_ptr_glCompressedTexSubImage2DARB){this->m_next_glCompressedTexSubImage2DARB = this->m_ptr_glCompressedTexSubImage2DARB;this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&ProfileTableDecorator::m_glCompressedTexSubImage2DARB_profile;}
+if(this->m_ptr_glTexStorageMem1DEXT){this->m_next_glTexStorageMem1DEXT = this->m_ptr_glTexStorageMem1DEXT;this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&ProfileTableDecorator::m_glTexStorageMem1DEXT_profile;}
+if(this->m_ptr_glVertex2hvNV){this->m_next_glVertex2hvNV = this->m_ptr_glVertex2hvNV;this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&ProfileTableDecorator::m_glVertex2hvNV_profile;}
+if(this->m_ptr_glTexBuffer){this->m_next_glTexBuffer = this->m_ptr_glTexBuffer;this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&ProfileTableDecorator::m_glTexBuffer_profile;}
+if(this->m_ptr_glArrayElement){this->m_next_glArrayElement = this->m_ptr_glArrayElement;this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&ProfileTableDecorator::m_glArrayElement_profile;}
+if(this->m_ptr_glValidateProgram){this->m_next_glValidateProgram = this->m_ptr_glValidateProgram;this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&ProfileTableDecorator::m_glValidateProgram_profile;}
+if(this->m_ptr_glPixelStoref){this->m_next_glPixelStoref = this->m_ptr_glPixelStoref;this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&ProfileTableDecorator::m_glPixelStoref_profile;}
+if(this->m_ptr_glWindowPos3dARB){this->m_next_glWindowPos3dARB = this->m_ptr_glWindowPos3dARB;this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&ProfileTableDecorator::m_glWindowPos3dARB_profile;}
+if(this->m_ptr_glEvalCoord1dv){this->m_next_glEvalCoord1dv = this->m_ptr_glEvalCoord1dv;this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&ProfileTableDecorator::m_glEvalCoord1dv_profile;}
+if(this->m_ptr_glVertexAttribs2fvNV){this->m_next_glVertexAttribs2fvNV = this->m_ptr_glVertexAttribs2fvNV;this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&ProfileTableDecorator::m_glVertexAttribs2fvNV_profile;}
+if(this->m_ptr_glRecti){this->m_next_glRecti = this->m_ptr_glRecti;this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&ProfileTableDecorator::m_glRecti_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN){this->m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glTexCoord1bOES){this->m_next_glTexCoord1bOES = this->m_ptr_glTexCoord1bOES;this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&ProfileTableDecorator::m_glTexCoord1bOES_profile;}
+if(this->m_ptr_glProgramUniform2i64vARB){this->m_next_glProgramUniform2i64vARB = this->m_ptr_glProgramUniform2i64vARB;this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&ProfileTableDecorator::m_glProgramUniform2i64vARB_profile;}
+if(this->m_ptr_glWindowPos2dARB){this->m_next_glWindowPos2dARB = this->m_ptr_glWindowPos2dARB;this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&ProfileTableDecorator::m_glWindowPos2dARB_profile;}
+if(this->m_ptr_glGetProgramParameterdvNV){this->m_next_glGetProgramParameterdvNV = this->m_ptr_glGetProgramParameterdvNV;this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&ProfileTableDecorator::m_glGetProgramParameterdvNV_profile;}
+if(this->m_ptr_glRectf){this->m_next_glRectf = this->m_ptr_glRectf;this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&ProfileTableDecorator::m_glRectf_profile;}
+if(this->m_ptr_glRectd){this->m_next_glRectd = this->m_ptr_glRectd;this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&ProfileTableDecorator::m_glRectd_profile;}
+if(this->m_ptr_glMap1xOES){this->m_next_glMap1xOES = this->m_ptr_glMap1xOES;this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&ProfileTableDecorator::m_glMap1xOES_profile;}
+if(this->m_ptr_glVertexAttrib3fvNV){this->m_next_glVertexAttrib3fvNV = this->m_ptr_glVertexAttrib3fvNV;this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&ProfileTableDecorator::m_glVertexAttrib3fvNV_profile;}
+if(this->m_ptr_glReferencePlaneSGIX){this->m_next_glReferencePlaneSGIX = this->m_ptr_glReferencePlaneSGIX;this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&ProfileTableDecorator::m_glReferencePlaneSGIX_profile;}
+if(this->m_ptr_glMulticastBlitFramebufferNV){this->m_next_glMulticastBlitFramebufferNV = this->m_ptr_glMulticastBlitFramebufferNV;this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&ProfileTableDecorator::m_glMulticastBlitFramebufferNV_profile;}
+if(this->m_ptr_glGetCombinerInputParameterfvNV){this->m_next_glGetCombinerInputParameterfvNV = this->m_ptr_glGetCombinerInputParameterfvNV;this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetCombinerInputParameterfvNV_profile;}
+if(this->m_ptr_glGetTextureSamplerHandleARB){this->m_next_glGetTextureSamplerHandleARB = this->m_ptr_glGetTextureSamplerHandleARB;this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&ProfileTableDecorator::m_glGetTextureSamplerHandleARB_profile;}
+if(this->m_ptr_glBindTexture){this->m_next_glBindTexture = this->m_ptr_glBindTexture;this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&ProfileTableDecorator::m_glBindTexture_profile;}
+if(this->m_ptr_glRects){this->m_next_glRects = this->m_ptr_glRects;this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&ProfileTableDecorator::m_glRects_profile;}
+if(this->m_ptr_glGetActiveAttribARB){this->m_next_glGetActiveAttribARB = this->m_ptr_glGetActiveAttribARB;this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&ProfileTableDecorator::m_glGetActiveAttribARB_profile;}
+if(this->m_ptr_glHistogramEXT){this->m_next_glHistogramEXT = this->m_ptr_glHistogramEXT;this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&ProfileTableDecorator::m_glHistogramEXT_profile;}
+if(this->m_ptr_glGetTextureSamplerHandleNV){this->m_next_glGetTextureSamplerHandleNV = this->m_ptr_glGetTextureSamplerHandleNV;this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&ProfileTableDecorator::m_glGetTextureSamplerHandleNV_profile;}
+if(this->m_ptr_glDetachShader){this->m_next_glDetachShader = this->m_ptr_glDetachShader;this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&ProfileTableDecorator::m_glDetachShader_profile;}
+if(this->m_ptr_glFinishTextureSUNX){this->m_next_glFinishTextureSUNX = this->m_ptr_glFinishTextureSUNX;this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&ProfileTableDecorator::m_glFinishTextureSUNX_profile;}
+if(this->m_ptr_glUniformMatrix3x4dv){this->m_next_glUniformMatrix3x4dv = this->m_ptr_glUniformMatrix3x4dv;this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&ProfileTableDecorator::m_glUniformMatrix3x4dv_profile;}
+if(this->m_ptr_glVertexAttrib4fARB){this->m_next_glVertexAttrib4fARB = this->m_ptr_glVertexAttrib4fARB;this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&ProfileTableDecorator::m_glVertexAttrib4fARB_profile;}
+if(this->m_ptr_glGetPathColorGenivNV){this->m_next_glGetPathColorGenivNV = this->m_ptr_glGetPathColorGenivNV;this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&ProfileTableDecorator::m_glGetPathColorGenivNV_profile;}
+if(this->m_ptr_glGetProgramResourceLocation){this->m_next_glGetProgramResourceLocation = this->m_ptr_glGetProgramResourceLocation;this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&ProfileTableDecorator::m_glGetProgramResourceLocation_profile;}
+if(this->m_ptr_glVertexArrayAttribLFormat){this->m_next_glVertexArrayAttribLFormat = this->m_ptr_glVertexArrayAttribLFormat;this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&ProfileTableDecorator::m_glVertexArrayAttribLFormat_profile;}
+if(this->m_ptr_glGetTexLevelParameterfv){this->m_next_glGetTexLevelParameterfv = this->m_ptr_glGetTexLevelParameterfv;this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&ProfileTableDecorator::m_glGetTexLevelParameterfv_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT){this->m_next_glVertexArrayVertexAttribOffsetEXT = this->m_ptr_glVertexArrayVertexAttribOffsetEXT;this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_profile;}
+if(this->m_ptr_glIndexFormatNV){this->m_next_glIndexFormatNV = this->m_ptr_glIndexFormatNV;this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&ProfileTableDecorator::m_glIndexFormatNV_profile;}
+if(this->m_ptr_glMultiTexCoord3i){this->m_next_glMultiTexCoord3i = this->m_ptr_glMultiTexCoord3i;this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&ProfileTableDecorator::m_glMultiTexCoord3i_profile;}
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN){this->m_next_glReplacementCodeuiVertex3fvSUN = this->m_ptr_glReplacementCodeuiVertex3fvSUN;this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiVertex3fvSUN_profile;}
+if(this->m_ptr_glViewportIndexedfv){this->m_next_glViewportIndexedfv = this->m_ptr_glViewportIndexedfv;this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&ProfileTableDecorator::m_glViewportIndexedfv_profile;}
+if(this->m_ptr_glBindBuffersBase){this->m_next_glBindBuffersBase = this->m_ptr_glBindBuffersBase;this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&ProfileTableDecorator::m_glBindBuffersBase_profile;}
+if(this->m_ptr_glTexBumpParameterfvATI){this->m_next_glTexBumpParameterfvATI = this->m_ptr_glTexBumpParameterfvATI;this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&ProfileTableDecorator::m_glTexBumpParameterfvATI_profile;}
+if(this->m_ptr_glMatrixIndexuivARB){this->m_next_glMatrixIndexuivARB = this->m_ptr_glMatrixIndexuivARB;this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&ProfileTableDecorator::m_glMatrixIndexuivARB_profile;}
+if(this->m_ptr_glVertexAttrib1hNV){this->m_next_glVertexAttrib1hNV = this->m_ptr_glVertexAttrib1hNV;this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&ProfileTableDecorator::m_glVertexAttrib1hNV_profile;}
+if(this->m_ptr_glWindowPos3svMESA){this->m_next_glWindowPos3svMESA = this->m_ptr_glWindowPos3svMESA;this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&ProfileTableDecorator::m_glWindowPos3svMESA_profile;}
+if(this->m_ptr_glStencilOpSeparateATI){this->m_next_glStencilOpSeparateATI = this->m_ptr_glStencilOpSeparateATI;this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&ProfileTableDecorator::m_glStencilOpSeparateATI_profile;}
+if(this->m_ptr_glDrawElementsBaseVertex){this->m_next_glDrawElementsBaseVertex = this->m_ptr_glDrawElementsBaseVertex;this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&ProfileTableDecorator::m_glDrawElementsBaseVertex_profile;}
+if(this->m_ptr_glBlendEquationSeparateiARB){this->m_next_glBlendEquationSeparateiARB = this->m_ptr_glBlendEquationSeparateiARB;this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&ProfileTableDecorator::m_glBlendEquationSeparateiARB_profile;}
+if(this->m_ptr_glVertexAttrib1fNV){this->m_next_glVertexAttrib1fNV = this->m_ptr_glVertexAttrib1fNV;this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&ProfileTableDecorator::m_glVertexAttrib1fNV_profile;}
+if(this->m_ptr_glMapVertexAttrib2fAPPLE){this->m_next_glMapVertexAttrib2fAPPLE = this->m_ptr_glMapVertexAttrib2fAPPLE;this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&ProfileTableDecorator::m_glMapVertexAttrib2fAPPLE_profile;}
+if(this->m_ptr_glCompressedTextureSubImage1DEXT){this->m_next_glCompressedTextureSubImage1DEXT = this->m_ptr_glCompressedTextureSubImage1DEXT;this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage1DEXT_profile;}
+if(this->m_ptr_glClearBufferSubData){this->m_next_glClearBufferSubData = this->m_ptr_glClearBufferSubData;this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glClearBufferSubData_profile;}
+if(this->m_ptr_glTexStorage1D){this->m_next_glTexStorage1D = this->m_ptr_glTexStorage1D;this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&ProfileTableDecorator::m_glTexStorage1D_profile;}
+if(this->m_ptr_glVertexAttribI3iEXT){this->m_next_glVertexAttribI3iEXT = this->m_ptr_glVertexAttribI3iEXT;this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&ProfileTableDecorator::m_glVertexAttribI3iEXT_profile;}
+if(this->m_ptr_glMakeTextureHandleNonResidentARB){this->m_next_glMakeTextureHandleNonResidentARB = this->m_ptr_glMakeTextureHandleNonResidentARB;this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&ProfileTableDecorator::m_glMakeTextureHandleNonResidentARB_profile;}
+if(this->m_ptr_glMultiDrawElementArrayAPPLE){this->m_next_glMultiDrawElementArrayAPPLE = this->m_ptr_glMultiDrawElementArrayAPPLE;this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&ProfileTableDecorator::m_glMultiDrawElementArrayAPPLE_profile;}
+if(this->m_ptr_glVertexStream4dATI){this->m_next_glVertexStream4dATI = this->m_ptr_glVertexStream4dATI;this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&ProfileTableDecorator::m_glVertexStream4dATI_profile;}
+if(this->m_ptr_glProgramUniformMatrix2dvEXT){this->m_next_glProgramUniformMatrix2dvEXT = this->m_ptr_glProgramUniformMatrix2dvEXT;this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2dvEXT_profile;}
+if(this->m_ptr_glVertexAttribs2hvNV){this->m_next_glVertexAttribs2hvNV = this->m_ptr_glVertexAttribs2hvNV;this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&ProfileTableDecorator::m_glVertexAttribs2hvNV_profile;}
+if(this->m_ptr_glGetUniformiv){this->m_next_glGetUniformiv = this->m_ptr_glGetUniformiv;this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&ProfileTableDecorator::m_glGetUniformiv_profile;}
+if(this->m_ptr_glClipPlanefOES){this->m_next_glClipPlanefOES = this->m_ptr_glClipPlanefOES;this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&ProfileTableDecorator::m_glClipPlanefOES_profile;}
+if(this->m_ptr_glRenderbufferStorage){this->m_next_glRenderbufferStorage = this->m_ptr_glRenderbufferStorage;this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&ProfileTableDecorator::m_glRenderbufferStorage_profile;}
+if(this->m_ptr_glUniform4ui){this->m_next_glUniform4ui = this->m_ptr_glUniform4ui;this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&ProfileTableDecorator::m_glUniform4ui_profile;}
+if(this->m_ptr_glBindFramebuffer){this->m_next_glBindFramebuffer = this->m_ptr_glBindFramebuffer;this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&ProfileTableDecorator::m_glBindFramebuffer_profile;}
+if(this->m_ptr_glValidateProgramARB){this->m_next_glValidateProgramARB = this->m_ptr_glValidateProgramARB;this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&ProfileTableDecorator::m_glValidateProgramARB_profile;}
+if(this->m_ptr_glTexGenf){this->m_next_glTexGenf = this->m_ptr_glTexGenf;this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&ProfileTableDecorator::m_glTexGenf_profile;}
+if(this->m_ptr_glTexGend){this->m_next_glTexGend = this->m_ptr_glTexGend;this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&ProfileTableDecorator::m_glTexGend_profile;}
+if(this->m_ptr_glTexGeni){this->m_next_glTexGeni = this->m_ptr_glTexGeni;this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&ProfileTableDecorator::m_glTexGeni_profile;}
+if(this->m_ptr_glDeleteFramebuffersEXT){this->m_next_glDeleteFramebuffersEXT = this->m_ptr_glDeleteFramebuffersEXT;this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&ProfileTableDecorator::m_glDeleteFramebuffersEXT_profile;}
+if(this->m_ptr_glResetMinmaxEXT){this->m_next_glResetMinmaxEXT = this->m_ptr_glResetMinmaxEXT;this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&ProfileTableDecorator::m_glResetMinmaxEXT_profile;}
+if(this->m_ptr_glVertexAttrib1fvNV){this->m_next_glVertexAttrib1fvNV = this->m_ptr_glVertexAttrib1fvNV;this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&ProfileTableDecorator::m_glVertexAttrib1fvNV_profile;}
+if(this->m_ptr_glIsQueryARB){this->m_next_glIsQueryARB = this->m_ptr_glIsQueryARB;this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&ProfileTableDecorator::m_glIsQueryARB_profile;}
+if(this->m_ptr_glEnableVariantClientStateEXT){this->m_next_glEnableVariantClientStateEXT = this->m_ptr_glEnableVariantClientStateEXT;this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&ProfileTableDecorator::m_glEnableVariantClientStateEXT_profile;}
+if(this->m_ptr_glScissorIndexed){this->m_next_glScissorIndexed = this->m_ptr_glScissorIndexed;this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&ProfileTableDecorator::m_glScissorIndexed_profile;}
+if(this->m_ptr_glGetInvariantIntegervEXT){this->m_next_glGetInvariantIntegervEXT = this->m_ptr_glGetInvariantIntegervEXT;this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&ProfileTableDecorator::m_glGetInvariantIntegervEXT_profile;}
+if(this->m_ptr_glProgramLocalParameterI4uiNV){this->m_next_glProgramLocalParameterI4uiNV = this->m_ptr_glProgramLocalParameterI4uiNV;this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&ProfileTableDecorator::m_glProgramLocalParameterI4uiNV_profile;}
+if(this->m_ptr_glConvolutionParameterxvOES){this->m_next_glConvolutionParameterxvOES = this->m_ptr_glConvolutionParameterxvOES;this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&ProfileTableDecorator::m_glConvolutionParameterxvOES_profile;}
+if(this->m_ptr_glGenFramebuffersEXT){this->m_next_glGenFramebuffersEXT = this->m_ptr_glGenFramebuffersEXT;this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&ProfileTableDecorator::m_glGenFramebuffersEXT_profile;}
+if(this->m_ptr_glVertexArrayColorOffsetEXT){this->m_next_glVertexArrayColorOffsetEXT = this->m_ptr_glVertexArrayColorOffsetEXT;this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayColorOffsetEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3ivARB){this->m_next_glMultiTexCoord3ivARB = this->m_ptr_glMultiTexCoord3ivARB;this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3ivARB_profile;}
+if(this->m_ptr_glVertexWeightfEXT){this->m_next_glVertexWeightfEXT = this->m_ptr_glVertexWeightfEXT;this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&ProfileTableDecorator::m_glVertexWeightfEXT_profile;}
+if(this->m_ptr_glRasterPos4dv){this->m_next_glRasterPos4dv = this->m_ptr_glRasterPos4dv;this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&ProfileTableDecorator::m_glRasterPos4dv_profile;}
+if(this->m_ptr_glIsTextureHandleResidentARB){this->m_next_glIsTextureHandleResidentARB = this->m_ptr_glIsTextureHandleResidentARB;this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&ProfileTableDecorator::m_glIsTextureHandleResidentARB_profile;}
+if(this->m_ptr_glRasterPos2dv){this->m_next_glRasterPos2dv = this->m_ptr_glRasterPos2dv;this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&ProfileTableDecorator::m_glRasterPos2dv_profile;}
+if(this->m_ptr_glWindowPos4ivMESA){this->m_next_glWindowPos4ivMESA = this->m_ptr_glWindowPos4ivMESA;this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&ProfileTableDecorator::m_glWindowPos4ivMESA_profile;}
+if(this->m_ptr_glGetVariantPointervEXT){this->m_next_glGetVariantPointervEXT = this->m_ptr_glGetVariantPointervEXT;this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&ProfileTableDecorator::m_glGetVariantPointervEXT_profile;}
+if(this->m_ptr_glMapNamedBufferRangeEXT){this->m_next_glMapNamedBufferRangeEXT = this->m_ptr_glMapNamedBufferRangeEXT;this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&ProfileTableDecorator::m_glMapNamedBufferRangeEXT_profile;}
+if(this->m_ptr_glGetnUniformui64vARB){this->m_next_glGetnUniformui64vARB = this->m_ptr_glGetnUniformui64vARB;this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&ProfileTableDecorator::m_glGetnUniformui64vARB_profile;}
+if(this->m_ptr_glCreateShaderProgramv){this->m_next_glCreateShaderProgramv = this->m_ptr_glCreateShaderProgramv;this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&ProfileTableDecorator::m_glCreateShaderProgramv_profile;}
+if(this->m_ptr_glGetQueryObjectiv){this->m_next_glGetQueryObjectiv = this->m_ptr_glGetQueryObjectiv;this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&ProfileTableDecorator::m_glGetQueryObjectiv_profile;}
+if(this->m_ptr_glMaxShaderCompilerThreadsKHR){this->m_next_glMaxShaderCompilerThreadsKHR = this->m_ptr_glMaxShaderCompilerThreadsKHR;this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&ProfileTableDecorator::m_glMaxShaderCompilerThreadsKHR_profile;}
+if(this->m_ptr_glPNTrianglesfATI){this->m_next_glPNTrianglesfATI = this->m_ptr_glPNTrianglesfATI;this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&ProfileTableDecorator::m_glPNTrianglesfATI_profile;}
+if(this->m_ptr_glGlobalAlphaFactorusSUN){this->m_next_glGlobalAlphaFactorusSUN = this->m_ptr_glGlobalAlphaFactorusSUN;this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactorusSUN_profile;}
+if(this->m_ptr_glVertexAttrib3dvNV){this->m_next_glVertexAttrib3dvNV = this->m_ptr_glVertexAttrib3dvNV;this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&ProfileTableDecorator::m_glVertexAttrib3dvNV_profile;}
+if(this->m_ptr_glMultiTexCoord3sARB){this->m_next_glMultiTexCoord3sARB = this->m_ptr_glMultiTexCoord3sARB;this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3sARB_profile;}
+if(this->m_ptr_glGenerateMipmap){this->m_next_glGenerateMipmap = this->m_ptr_glGenerateMipmap;this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&ProfileTableDecorator::m_glGenerateMipmap_profile;}
+if(this->m_ptr_glCompressedTextureSubImage2D){this->m_next_glCompressedTextureSubImage2D = this->m_ptr_glCompressedTextureSubImage2D;this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage2D_profile;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT){this->m_next_glNamedRenderbufferStorageMultisampleEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_profile;}
+if(this->m_ptr_glPolygonOffsetClampEXT){this->m_next_glPolygonOffsetClampEXT = this->m_ptr_glPolygonOffsetClampEXT;this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&ProfileTableDecorator::m_glPolygonOffsetClampEXT_profile;}
+if(this->m_ptr_glTextureRangeAPPLE){this->m_next_glTextureRangeAPPLE = this->m_ptr_glTextureRangeAPPLE;this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&ProfileTableDecorator::m_glTextureRangeAPPLE_profile;}
+if(this->m_ptr_glBlendEquationIndexedAMD){this->m_next_glBlendEquationIndexedAMD = this->m_ptr_glBlendEquationIndexedAMD;this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&ProfileTableDecorator::m_glBlendEquationIndexedAMD_profile;}
+if(this->m_ptr_glTexCoord2d){this->m_next_glTexCoord2d = this->m_ptr_glTexCoord2d;this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&ProfileTableDecorator::m_glTexCoord2d_profile;}
+if(this->m_ptr_glPointParameteri){this->m_next_glPointParameteri = this->m_ptr_glPointParameteri;this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&ProfileTableDecorator::m_glPointParameteri_profile;}
+if(this->m_ptr_glTexCoord2f){this->m_next_glTexCoord2f = this->m_ptr_glTexCoord2f;this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&ProfileTableDecorator::m_glTexCoord2f_profile;}
+if(this->m_ptr_glGetUnsignedBytei_vEXT){this->m_next_glGetUnsignedBytei_vEXT = this->m_ptr_glGetUnsignedBytei_vEXT;this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&ProfileTableDecorator::m_glGetUnsignedBytei_vEXT_profile;}
+if(this->m_ptr_glColor4iv){this->m_next_glColor4iv = this->m_ptr_glColor4iv;this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&ProfileTableDecorator::m_glColor4iv_profile;}
+if(this->m_ptr_glMapNamedBufferRange){this->m_next_glMapNamedBufferRange = this->m_ptr_glMapNamedBufferRange;this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&ProfileTableDecorator::m_glMapNamedBufferRange_profile;}
+if(this->m_ptr_glUnmapBuffer){this->m_next_glUnmapBuffer = this->m_ptr_glUnmapBuffer;this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&ProfileTableDecorator::m_glUnmapBuffer_profile;}
+if(this->m_ptr_glSampleMaskEXT){this->m_next_glSampleMaskEXT = this->m_ptr_glSampleMaskEXT;this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&ProfileTableDecorator::m_glSampleMaskEXT_profile;}
+if(this->m_ptr_glTexCoord2i){this->m_next_glTexCoord2i = this->m_ptr_glTexCoord2i;this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&ProfileTableDecorator::m_glTexCoord2i_profile;}
+if(this->m_ptr_glTexCoord1xvOES){this->m_next_glTexCoord1xvOES = this->m_ptr_glTexCoord1xvOES;this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&ProfileTableDecorator::m_glTexCoord1xvOES_profile;}
+if(this->m_ptr_glVertexAttrib1sARB){this->m_next_glVertexAttrib1sARB = this->m_ptr_glVertexAttrib1sARB;this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&ProfileTableDecorator::m_glVertexAttrib1sARB_profile;}
+if(this->m_ptr_glGetVertexArrayiv){this->m_next_glGetVertexArrayiv = this->m_ptr_glGetVertexArrayiv;this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&ProfileTableDecorator::m_glGetVertexArrayiv_profile;}
+if(this->m_ptr_glProgramParameter4dvNV){this->m_next_glProgramParameter4dvNV = this->m_ptr_glProgramParameter4dvNV;this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&ProfileTableDecorator::m_glProgramParameter4dvNV_profile;}
+if(this->m_ptr_glTexCoord2s){this->m_next_glTexCoord2s = this->m_ptr_glTexCoord2s;this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&ProfileTableDecorator::m_glTexCoord2s_profile;}
+if(this->m_ptr_glTextureParameterIuivEXT){this->m_next_glTextureParameterIuivEXT = this->m_ptr_glTextureParameterIuivEXT;this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glTextureParameterIuivEXT_profile;}
+if(this->m_ptr_glGetColorTableParameterfvSGI){this->m_next_glGetColorTableParameterfvSGI = this->m_ptr_glGetColorTableParameterfvSGI;this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&ProfileTableDecorator::m_glGetColorTableParameterfvSGI_profile;}
+if(this->m_ptr_glTexCoord4dv){this->m_next_glTexCoord4dv = this->m_ptr_glTexCoord4dv;this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&ProfileTableDecorator::m_glTexCoord4dv_profile;}
+if(this->m_ptr_glVertexAttrib1svNV){this->m_next_glVertexAttrib1svNV = this->m_ptr_glVertexAttrib1svNV;this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&ProfileTableDecorator::m_glVertexAttrib1svNV_profile;}
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT){this->m_next_glNamedFramebufferTextureFaceEXT = this->m_ptr_glNamedFramebufferTextureFaceEXT;this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTextureFaceEXT_profile;}
+if(this->m_ptr_glProgramUniform2ui64vNV){this->m_next_glProgramUniform2ui64vNV = this->m_ptr_glProgramUniform2ui64vNV;this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&ProfileTableDecorator::m_glProgramUniform2ui64vNV_profile;}
+if(this->m_ptr_glStencilFillPathNV){this->m_next_glStencilFillPathNV = this->m_ptr_glStencilFillPathNV;this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&ProfileTableDecorator::m_glStencilFillPathNV_profile;}
+if(this->m_ptr_glNormal3dv){this->m_next_glNormal3dv = this->m_ptr_glNormal3dv;this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&ProfileTableDecorator::m_glNormal3dv_profile;}
+if(this->m_ptr_glReleaseShaderCompiler){this->m_next_glReleaseShaderCompiler = this->m_ptr_glReleaseShaderCompiler;this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&ProfileTableDecorator::m_glReleaseShaderCompiler_profile;}
+if(this->m_ptr_glTexStorageMem3DEXT){this->m_next_glTexStorageMem3DEXT = this->m_ptr_glTexStorageMem3DEXT;this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&ProfileTableDecorator::m_glTexStorageMem3DEXT_profile;}
+if(this->m_ptr_glTexCoord3bvOES){this->m_next_glTexCoord3bvOES = this->m_ptr_glTexCoord3bvOES;this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&ProfileTableDecorator::m_glTexCoord3bvOES_profile;}
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE){this->m_next_glIsVertexAttribEnabledAPPLE = this->m_ptr_glIsVertexAttribEnabledAPPLE;this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&ProfileTableDecorator::m_glIsVertexAttribEnabledAPPLE_profile;}
+if(this->m_ptr_glTexCoord1dv){this->m_next_glTexCoord1dv = this->m_ptr_glTexCoord1dv;this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&ProfileTableDecorator::m_glTexCoord1dv_profile;}
+if(this->m_ptr_glReadPixels){this->m_next_glReadPixels = this->m_ptr_glReadPixels;this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&ProfileTableDecorator::m_glReadPixels_profile;}
+if(this->m_ptr_glVertexAttribI3iv){this->m_next_glVertexAttribI3iv = this->m_ptr_glVertexAttribI3iv;this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&ProfileTableDecorator::m_glVertexAttribI3iv_profile;}
+if(this->m_ptr_glSetFenceAPPLE){this->m_next_glSetFenceAPPLE = this->m_ptr_glSetFenceAPPLE;this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&ProfileTableDecorator::m_glSetFenceAPPLE_profile;}
+if(this->m_ptr_glWeightsvARB){this->m_next_glWeightsvARB = this->m_ptr_glWeightsvARB;this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&ProfileTableDecorator::m_glWeightsvARB_profile;}
+if(this->m_ptr_glShadeModel){this->m_next_glShadeModel = this->m_ptr_glShadeModel;this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&ProfileTableDecorator::m_glShadeModel_profile;}
+if(this->m_ptr_glTextureStorageMem3DMultisampleEXT){this->m_next_glTextureStorageMem3DMultisampleEXT = this->m_ptr_glTextureStorageMem3DMultisampleEXT;this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTextureStorageMem3DMultisampleEXT_profile;}
+if(this->m_ptr_glMapGrid1d){this->m_next_glMapGrid1d = this->m_ptr_glMapGrid1d;this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&ProfileTableDecorator::m_glMapGrid1d_profile;}
+if(this->m_ptr_glGetHistogramParameterivEXT){this->m_next_glGetHistogramParameterivEXT = this->m_ptr_glGetHistogramParameterivEXT;this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetHistogramParameterivEXT_profile;}
+if(this->m_ptr_glConservativeRasterParameteriNV){this->m_next_glConservativeRasterParameteriNV = this->m_ptr_glConservativeRasterParameteriNV;this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&ProfileTableDecorator::m_glConservativeRasterParameteriNV_profile;}
+if(this->m_ptr_glClearNamedBufferData){this->m_next_glClearNamedBufferData = this->m_ptr_glClearNamedBufferData;this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&ProfileTableDecorator::m_glClearNamedBufferData_profile;}
+if(this->m_ptr_glClearDepthf){this->m_next_glClearDepthf = this->m_ptr_glClearDepthf;this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&ProfileTableDecorator::m_glClearDepthf_profile;}
+if(this->m_ptr_glCreatePerfQueryINTEL){this->m_next_glCreatePerfQueryINTEL = this->m_ptr_glCreatePerfQueryINTEL;this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&ProfileTableDecorator::m_glCreatePerfQueryINTEL_profile;}
+if(this->m_ptr_glFogCoordfEXT){this->m_next_glFogCoordfEXT = this->m_ptr_glFogCoordfEXT;this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&ProfileTableDecorator::m_glFogCoordfEXT_profile;}
+if(this->m_ptr_glVertexAttrib2dARB){this->m_next_glVertexAttrib2dARB = this->m_ptr_glVertexAttrib2dARB;this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&ProfileTableDecorator::m_glVertexAttrib2dARB_profile;}
+if(this->m_ptr_glMultiTexCoord4dARB){this->m_next_glMultiTexCoord4dARB = this->m_ptr_glMultiTexCoord4dARB;this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4dARB_profile;}
+if(this->m_ptr_glReadnPixelsARB){this->m_next_glReadnPixelsARB = this->m_ptr_glReadnPixelsARB;this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&ProfileTableDecorator::m_glReadnPixelsARB_profile;}
+if(this->m_ptr_glMultiTexBufferEXT){this->m_next_glMultiTexBufferEXT = this->m_ptr_glMultiTexBufferEXT;this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&ProfileTableDecorator::m_glMultiTexBufferEXT_profile;}
+if(this->m_ptr_glWindowPos4dvMESA){this->m_next_glWindowPos4dvMESA = this->m_ptr_glWindowPos4dvMESA;this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&ProfileTableDecorator::m_glWindowPos4dvMESA_profile;}
+if(this->m_ptr_glInvalidateNamedFramebufferData){this->m_next_glInvalidateNamedFramebufferData = this->m_ptr_glInvalidateNamedFramebufferData;this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&ProfileTableDecorator::m_glInvalidateNamedFramebufferData_profile;}
+if(this->m_ptr_glSecondaryColorPointerListIBM){this->m_next_glSecondaryColorPointerListIBM = this->m_ptr_glSecondaryColorPointerListIBM;this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glSecondaryColorPointerListIBM_profile;}
+if(this->m_ptr_glRectiv){this->m_next_glRectiv = this->m_ptr_glRectiv;this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&ProfileTableDecorator::m_glRectiv_profile;}
+if(this->m_ptr_glColorP4ui){this->m_next_glColorP4ui = this->m_ptr_glColorP4ui;this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&ProfileTableDecorator::m_glColorP4ui_profile;}
+if(this->m_ptr_glUseProgramStages){this->m_next_glUseProgramStages = this->m_ptr_glUseProgramStages;this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&ProfileTableDecorator::m_glUseProgramStages_profile;}
+if(this->m_ptr_glRasterPos3dv){this->m_next_glRasterPos3dv = this->m_ptr_glRasterPos3dv;this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&ProfileTableDecorator::m_glRasterPos3dv_profile;}
+if(this->m_ptr_glPathTexGenNV){this->m_next_glPathTexGenNV = this->m_ptr_glPathTexGenNV;this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&ProfileTableDecorator::m_glPathTexGenNV_profile;}
+if(this->m_ptr_glVertexBlendEnviATI){this->m_next_glVertexBlendEnviATI = this->m_ptr_glVertexBlendEnviATI;this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&ProfileTableDecorator::m_glVertexBlendEnviATI_profile;}
+if(this->m_ptr_glUniform3i64ARB){this->m_next_glUniform3i64ARB = this->m_ptr_glUniform3i64ARB;this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&ProfileTableDecorator::m_glUniform3i64ARB_profile;}
+if(this->m_ptr_glLoadMatrixf){this->m_next_glLoadMatrixf = this->m_ptr_glLoadMatrixf;this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&ProfileTableDecorator::m_glLoadMatrixf_profile;}
+if(this->m_ptr_glProgramUniform2dEXT){this->m_next_glProgramUniform2dEXT = this->m_ptr_glProgramUniform2dEXT;this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&ProfileTableDecorator::m_glProgramUniform2dEXT_profile;}
+if(this->m_ptr_glVertexAttribI4iv){this->m_next_glVertexAttribI4iv = this->m_ptr_glVertexAttribI4iv;this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&ProfileTableDecorator::m_glVertexAttribI4iv_profile;}
+if(this->m_ptr_glNamedFramebufferDrawBuffer){this->m_next_glNamedFramebufferDrawBuffer = this->m_ptr_glNamedFramebufferDrawBuffer;this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&ProfileTableDecorator::m_glNamedFramebufferDrawBuffer_profile;}
+if(this->m_ptr_glColor4ubv){this->m_next_glColor4ubv = this->m_ptr_glColor4ubv;this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&ProfileTableDecorator::m_glColor4ubv_profile;}
+if(this->m_ptr_glColor3hvNV){this->m_next_glColor3hvNV = this->m_ptr_glColor3hvNV;this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&ProfileTableDecorator::m_glColor3hvNV_profile;}
+if(this->m_ptr_glGetMapAttribParameterfvNV){this->m_next_glGetMapAttribParameterfvNV = this->m_ptr_glGetMapAttribParameterfvNV;this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetMapAttribParameterfvNV_profile;}
+if(this->m_ptr_glGetBufferSubData){this->m_next_glGetBufferSubData = this->m_ptr_glGetBufferSubData;this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glGetBufferSubData_profile;}
+if(this->m_ptr_glGetVertexAttribLdv){this->m_next_glGetVertexAttribLdv = this->m_ptr_glGetVertexAttribLdv;this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&ProfileTableDecorator::m_glGetVertexAttribLdv_profile;}
+if(this->m_ptr_glGetnUniformuiv){this->m_next_glGetnUniformuiv = this->m_ptr_glGetnUniformuiv;this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&ProfileTableDecorator::m_glGetnUniformuiv_profile;}
+if(this->m_ptr_glGetUniformui64vNV){this->m_next_glGetUniformui64vNV = this->m_ptr_glGetUniformui64vNV;this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&ProfileTableDecorator::m_glGetUniformui64vNV_profile;}
+if(this->m_ptr_glNamedRenderbufferStorageEXT){this->m_next_glNamedRenderbufferStorageEXT = this->m_ptr_glNamedRenderbufferStorageEXT;this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&ProfileTableDecorator::m_glNamedRenderbufferStorageEXT_profile;}
+if(this->m_ptr_glVertexAttrib3dNV){this->m_next_glVertexAttrib3dNV = this->m_ptr_glVertexAttrib3dNV;this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&ProfileTableDecorator::m_glVertexAttrib3dNV_profile;}
+if(this->m_ptr_glTextureStorage1DEXT){this->m_next_glTextureStorage1DEXT = this->m_ptr_glTextureStorage1DEXT;this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&ProfileTableDecorator::m_glTextureStorage1DEXT_profile;}
+if(this->m_ptr_glPixelTexGenParameteriSGIS){this->m_next_glPixelTexGenParameteriSGIS = this->m_ptr_glPixelTexGenParameteriSGIS;this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&ProfileTableDecorator::m_glPixelTexGenParameteriSGIS_profile;}
+if(this->m_ptr_glColorTableEXT){this->m_next_glColorTableEXT = this->m_ptr_glColorTableEXT;this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&ProfileTableDecorator::m_glColorTableEXT_profile;}
+if(this->m_ptr_glGenBuffers){this->m_next_glGenBuffers = this->m_ptr_glGenBuffers;this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&ProfileTableDecorator::m_glGenBuffers_profile;}
+if(this->m_ptr_glMultiTexCoord3xvOES){this->m_next_glMultiTexCoord3xvOES = this->m_ptr_glMultiTexCoord3xvOES;this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord3xvOES_profile;}
+if(this->m_ptr_glExecuteProgramNV){this->m_next_glExecuteProgramNV = this->m_ptr_glExecuteProgramNV;this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&ProfileTableDecorator::m_glExecuteProgramNV_profile;}
+if(this->m_ptr_glVariantArrayObjectATI){this->m_next_glVariantArrayObjectATI = this->m_ptr_glVariantArrayObjectATI;this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&ProfileTableDecorator::m_glVariantArrayObjectATI_profile;}
+if(this->m_ptr_glColor3xvOES){this->m_next_glColor3xvOES = this->m_ptr_glColor3xvOES;this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&ProfileTableDecorator::m_glColor3xvOES_profile;}
+if(this->m_ptr_glGetnConvolutionFilterARB){this->m_next_glGetnConvolutionFilterARB = this->m_ptr_glGetnConvolutionFilterARB;this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&ProfileTableDecorator::m_glGetnConvolutionFilterARB_profile;}
+if(this->m_ptr_glNormalFormatNV){this->m_next_glNormalFormatNV = this->m_ptr_glNormalFormatNV;this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&ProfileTableDecorator::m_glNormalFormatNV_profile;}
+if(this->m_ptr_glGetInvariantFloatvEXT){this->m_next_glGetInvariantFloatvEXT = this->m_ptr_glGetInvariantFloatvEXT;this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&ProfileTableDecorator::m_glGetInvariantFloatvEXT_profile;}
+if(this->m_ptr_glClearNamedFramebufferiv){this->m_next_glClearNamedFramebufferiv = this->m_ptr_glClearNamedFramebufferiv;this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&ProfileTableDecorator::m_glClearNamedFramebufferiv_profile;}
+if(this->m_ptr_glTexImage3D){this->m_next_glTexImage3D = this->m_ptr_glTexImage3D;this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&ProfileTableDecorator::m_glTexImage3D_profile;}
+if(this->m_ptr_glGenSamplers){this->m_next_glGenSamplers = this->m_ptr_glGenSamplers;this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&ProfileTableDecorator::m_glGenSamplers_profile;}
+if(this->m_ptr_glIsFramebuffer){this->m_next_glIsFramebuffer = this->m_ptr_glIsFramebuffer;this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&ProfileTableDecorator::m_glIsFramebuffer_profile;}
+if(this->m_ptr_glProgramUniform3dvEXT){this->m_next_glProgramUniform3dvEXT = this->m_ptr_glProgramUniform3dvEXT;this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&ProfileTableDecorator::m_glProgramUniform3dvEXT_profile;}
+if(this->m_ptr_glGetVertexAttribfvNV){this->m_next_glGetVertexAttribfvNV = this->m_ptr_glGetVertexAttribfvNV;this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&ProfileTableDecorator::m_glGetVertexAttribfvNV_profile;}
+if(this->m_ptr_glDrawRangeElementArrayAPPLE){this->m_next_glDrawRangeElementArrayAPPLE = this->m_ptr_glDrawRangeElementArrayAPPLE;this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfileTableDecorator::m_glDrawRangeElementArrayAPPLE_profile;}
+if(this->m_ptr_glUniform3i64NV){this->m_next_glUniform3i64NV = this->m_ptr_glUniform3i64NV;this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&ProfileTableDecorator::m_glUniform3i64NV_profile;}
+if(this->m_ptr_glMatrixPopEXT){this->m_next_glMatrixPopEXT = this->m_ptr_glMatrixPopEXT;this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&ProfileTableDecorator::m_glMatrixPopEXT_profile;}
+if(this->m_ptr_glVertexStream1sATI){this->m_next_glVertexStream1sATI = this->m_ptr_glVertexStream1sATI;this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&ProfileTableDecorator::m_glVertexStream1sATI_profile;}
+if(this->m_ptr_glGetnPixelMapuivARB){this->m_next_glGetnPixelMapuivARB = this->m_ptr_glGetnPixelMapuivARB;this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&ProfileTableDecorator::m_glGetnPixelMapuivARB_profile;}
+if(this->m_ptr_glMultiTexEnviEXT){this->m_next_glMultiTexEnviEXT = this->m_ptr_glMultiTexEnviEXT;this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&ProfileTableDecorator::m_glMultiTexEnviEXT_profile;}
+if(this->m_ptr_glVertexAttribI2iEXT){this->m_next_glVertexAttribI2iEXT = this->m_ptr_glVertexAttribI2iEXT;this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&ProfileTableDecorator::m_glVertexAttribI2iEXT_profile;}
+if(this->m_ptr_glProgramParameter4fvNV){this->m_next_glProgramParameter4fvNV = this->m_ptr_glProgramParameter4fvNV;this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&ProfileTableDecorator::m_glProgramParameter4fvNV_profile;}
+if(this->m_ptr_glWaitSemaphoreEXT){this->m_next_glWaitSemaphoreEXT = this->m_ptr_glWaitSemaphoreEXT;this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&ProfileTableDecorator::m_glWaitSemaphoreEXT_profile;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV){this->m_next_glNamedFramebufferSampleLocationsfvNV = this->m_ptr_glNamedFramebufferSampleLocationsfvNV;this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfileTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_profile;}
+if(this->m_ptr_glTexCoordP4uiv){this->m_next_glTexCoordP4uiv = this->m_ptr_glTexCoordP4uiv;this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&ProfileTableDecorator::m_glTexCoordP4uiv_profile;}
+if(this->m_ptr_glRectxvOES){this->m_next_glRectxvOES = this->m_ptr_glRectxvOES;this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&ProfileTableDecorator::m_glRectxvOES_profile;}
+if(this->m_ptr_glGetVariantIntegervEXT){this->m_next_glGetVariantIntegervEXT = this->m_ptr_glGetVariantIntegervEXT;this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&ProfileTableDecorator::m_glGetVariantIntegervEXT_profile;}
+if(this->m_ptr_glDeleteLists){this->m_next_glDeleteLists = this->m_ptr_glDeleteLists;this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&ProfileTableDecorator::m_glDeleteLists_profile;}
+if(this->m_ptr_glTexGendv){this->m_next_glTexGendv = this->m_ptr_glTexGendv;this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&ProfileTableDecorator::m_glTexGendv_profile;}
+if(this->m_ptr_glVertexP2uiv){this->m_next_glVertexP2uiv = this->m_ptr_glVertexP2uiv;this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&ProfileTableDecorator::m_glVertexP2uiv_profile;}
+if(this->m_ptr_glGetPerfMonitorGroupsAMD){this->m_next_glGetPerfMonitorGroupsAMD = this->m_ptr_glGetPerfMonitorGroupsAMD;this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorGroupsAMD_profile;}
+if(this->m_ptr_glMultTransposeMatrixfARB){this->m_next_glMultTransposeMatrixfARB = this->m_ptr_glMultTransposeMatrixfARB;this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&ProfileTableDecorator::m_glMultTransposeMatrixfARB_profile;}
+if(this->m_ptr_glVertexAttribI2ivEXT){this->m_next_glVertexAttribI2ivEXT = this->m_ptr_glVertexAttribI2ivEXT;this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI2ivEXT_profile;}
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN){this->m_next_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glDeleteStatesNV){this->m_next_glDeleteStatesNV = this->m_ptr_glDeleteStatesNV;this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&ProfileTableDecorator::m_glDeleteStatesNV_profile;}
+if(this->m_ptr_glGetBufferParameteri64v){this->m_next_glGetBufferParameteri64v = this->m_ptr_glGetBufferParameteri64v;this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&ProfileTableDecorator::m_glGetBufferParameteri64v_profile;}
+if(this->m_ptr_glProgramUniform4dv){this->m_next_glProgramUniform4dv = this->m_ptr_glProgramUniform4dv;this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&ProfileTableDecorator::m_glProgramUniform4dv_profile;}
+if(this->m_ptr_glEdgeFlagPointerEXT){this->m_next_glEdgeFlagPointerEXT = this->m_ptr_glEdgeFlagPointerEXT;this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&ProfileTableDecorator::m_glEdgeFlagPointerEXT_profile;}
+if(this->m_ptr_glVideoCaptureStreamParameterivNV){this->m_next_glVideoCaptureStreamParameterivNV = this->m_ptr_glVideoCaptureStreamParameterivNV;this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&ProfileTableDecorator::m_glVideoCaptureStreamParameterivNV_profile;}
+if(this->m_ptr_glVertexStream4iATI){this->m_next_glVertexStream4iATI = this->m_ptr_glVertexStream4iATI;this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&ProfileTableDecorator::m_glVertexStream4iATI_profile;}
+if(this->m_ptr_glVDPAUFiniNV){this->m_next_glVDPAUFiniNV = this->m_ptr_glVDPAUFiniNV;this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&ProfileTableDecorator::m_glVDPAUFiniNV_profile;}
+if(this->m_ptr_glMakeBufferNonResidentNV){this->m_next_glMakeBufferNonResidentNV = this->m_ptr_glMakeBufferNonResidentNV;this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeBufferNonResidentNV_profile;}
+if(this->m_ptr_glUniform1ui64ARB){this->m_next_glUniform1ui64ARB = this->m_ptr_glUniform1ui64ARB;this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&ProfileTableDecorator::m_glUniform1ui64ARB_profile;}
+if(this->m_ptr_glStencilStrokePathNV){this->m_next_glStencilStrokePathNV = this->m_ptr_glStencilStrokePathNV;this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&ProfileTableDecorator::m_glStencilStrokePathNV_profile;}
+if(this->m_ptr_glVariantuivEXT){this->m_next_glVariantuivEXT = this->m_ptr_glVariantuivEXT;this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&ProfileTableDecorator::m_glVariantuivEXT_profile;}
+if(this->m_ptr_glCopyTexSubImage3DEXT){this->m_next_glCopyTexSubImage3DEXT = this->m_ptr_glCopyTexSubImage3DEXT;this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCopyTexSubImage3DEXT_profile;}
+if(this->m_ptr_glSpriteParameteriSGIX){this->m_next_glSpriteParameteriSGIX = this->m_ptr_glSpriteParameteriSGIX;this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&ProfileTableDecorator::m_glSpriteParameteriSGIX_profile;}
+if(this->m_ptr_glMultiTexCoord1sARB){this->m_next_glMultiTexCoord1sARB = this->m_ptr_glMultiTexCoord1sARB;this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1sARB_profile;}
+if(this->m_ptr_glConvolutionParameterfv){this->m_next_glConvolutionParameterfv = this->m_ptr_glConvolutionParameterfv;this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&ProfileTableDecorator::m_glConvolutionParameterfv_profile;}
+if(this->m_ptr_glMakeTextureHandleResidentNV){this->m_next_glMakeTextureHandleResidentNV = this->m_ptr_glMakeTextureHandleResidentNV;this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&ProfileTableDecorator::m_glMakeTextureHandleResidentNV_profile;}
+if(this->m_ptr_glMultMatrixxOES){this->m_next_glMultMatrixxOES = this->m_ptr_glMultMatrixxOES;this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&ProfileTableDecorator::m_glMultMatrixxOES_profile;}
+if(this->m_ptr_glTextureNormalEXT){this->m_next_glTextureNormalEXT = this->m_ptr_glTextureNormalEXT;this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&ProfileTableDecorator::m_glTextureNormalEXT_profile;}
+if(this->m_ptr_glGetQueryivARB){this->m_next_glGetQueryivARB = this->m_ptr_glGetQueryivARB;this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&ProfileTableDecorator::m_glGetQueryivARB_profile;}
+if(this->m_ptr_glCompressedMultiTexImage3DEXT){this->m_next_glCompressedMultiTexImage3DEXT = this->m_ptr_glCompressedMultiTexImage3DEXT;this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexImage3DEXT_profile;}
+if(this->m_ptr_glGetInstrumentsSGIX){this->m_next_glGetInstrumentsSGIX = this->m_ptr_glGetInstrumentsSGIX;this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&ProfileTableDecorator::m_glGetInstrumentsSGIX_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT){this->m_next_glProgramUniformMatrix4x3fvEXT = this->m_ptr_glProgramUniformMatrix4x3fvEXT;this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x3fvEXT_profile;}
+if(this->m_ptr_glPointParameterf){this->m_next_glPointParameterf = this->m_ptr_glPointParameterf;this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&ProfileTableDecorator::m_glPointParameterf_profile;}
+if(this->m_ptr_glProgramUniform3dEXT){this->m_next_glProgramUniform3dEXT = this->m_ptr_glProgramUniform3dEXT;this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&ProfileTableDecorator::m_glProgramUniform3dEXT_profile;}
+if(this->m_ptr_glMultiTexCoord2hNV){this->m_next_glMultiTexCoord2hNV = this->m_ptr_glMultiTexCoord2hNV;this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&ProfileTableDecorator::m_glMultiTexCoord2hNV_profile;}
+if(this->m_ptr_glGetConvolutionFilterEXT){this->m_next_glGetConvolutionFilterEXT = this->m_ptr_glGetConvolutionFilterEXT;this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&ProfileTableDecorator::m_glGetConvolutionFilterEXT_profile;}
+if(this->m_ptr_glVertexAttrib2hNV){this->m_next_glVertexAttrib2hNV = this->m_ptr_glVertexAttrib2hNV;this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&ProfileTableDecorator::m_glVertexAttrib2hNV_profile;}
+if(this->m_ptr_glCurrentPaletteMatrixARB){this->m_next_glCurrentPaletteMatrixARB = this->m_ptr_glCurrentPaletteMatrixARB;this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&ProfileTableDecorator::m_glCurrentPaletteMatrixARB_profile;}
+if(this->m_ptr_glFogxvOES){this->m_next_glFogxvOES = this->m_ptr_glFogxvOES;this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&ProfileTableDecorator::m_glFogxvOES_profile;}
+if(this->m_ptr_glCreateRenderbuffers){this->m_next_glCreateRenderbuffers = this->m_ptr_glCreateRenderbuffers;this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&ProfileTableDecorator::m_glCreateRenderbuffers_profile;}
+if(this->m_ptr_glVertexAttrib4Nusv){this->m_next_glVertexAttrib4Nusv = this->m_ptr_glVertexAttrib4Nusv;this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&ProfileTableDecorator::m_glVertexAttrib4Nusv_profile;}
+if(this->m_ptr_glCombinerInputNV){this->m_next_glCombinerInputNV = this->m_ptr_glCombinerInputNV;this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&ProfileTableDecorator::m_glCombinerInputNV_profile;}
+if(this->m_ptr_glDepthFunc){this->m_next_glDepthFunc = this->m_ptr_glDepthFunc;this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&ProfileTableDecorator::m_glDepthFunc_profile;}
+if(this->m_ptr_glWindowPos4fMESA){this->m_next_glWindowPos4fMESA = this->m_ptr_glWindowPos4fMESA;this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&ProfileTableDecorator::m_glWindowPos4fMESA_profile;}
+if(this->m_ptr_glEnableClientStateIndexedEXT){this->m_next_glEnableClientStateIndexedEXT = this->m_ptr_glEnableClientStateIndexedEXT;this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&ProfileTableDecorator::m_glEnableClientStateIndexedEXT_profile;}
+if(this->m_ptr_glTexCoord4iv){this->m_next_glTexCoord4iv = this->m_ptr_glTexCoord4iv;this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&ProfileTableDecorator::m_glTexCoord4iv_profile;}
+if(this->m_ptr_glProgramUniform4i64ARB){this->m_next_glProgramUniform4i64ARB = this->m_ptr_glProgramUniform4i64ARB;this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&ProfileTableDecorator::m_glProgramUniform4i64ARB_profile;}
+if(this->m_ptr_glBlendFunci){this->m_next_glBlendFunci = this->m_ptr_glBlendFunci;this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&ProfileTableDecorator::m_glBlendFunci_profile;}
+if(this->m_ptr_glResolveDepthValuesNV){this->m_next_glResolveDepthValuesNV = this->m_ptr_glResolveDepthValuesNV;this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&ProfileTableDecorator::m_glResolveDepthValuesNV_profile;}
+if(this->m_ptr_glTextureColorMaskSGIS){this->m_next_glTextureColorMaskSGIS = this->m_ptr_glTextureColorMaskSGIS;this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&ProfileTableDecorator::m_glTextureColorMaskSGIS_profile;}
+if(this->m_ptr_glCreateShaderProgramEXT){this->m_next_glCreateShaderProgramEXT = this->m_ptr_glCreateShaderProgramEXT;this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&ProfileTableDecorator::m_glCreateShaderProgramEXT_profile;}
+if(this->m_ptr_glBufferStorage){this->m_next_glBufferStorage = this->m_ptr_glBufferStorage;this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&ProfileTableDecorator::m_glBufferStorage_profile;}
+if(this->m_ptr_glMakeNamedBufferNonResidentNV){this->m_next_glMakeNamedBufferNonResidentNV = this->m_ptr_glMakeNamedBufferNonResidentNV;this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeNamedBufferNonResidentNV_profile;}
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT){this->m_next_glRenderbufferStorageMultisampleEXT = this->m_ptr_glRenderbufferStorageMultisampleEXT;this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glRenderbufferStorageMultisampleEXT_profile;}
+if(this->m_ptr_glGetFloati_v){this->m_next_glGetFloati_v = this->m_ptr_glGetFloati_v;this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&ProfileTableDecorator::m_glGetFloati_v_profile;}
+if(this->m_ptr_glUniform2ui64ARB){this->m_next_glUniform2ui64ARB = this->m_ptr_glUniform2ui64ARB;this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&ProfileTableDecorator::m_glUniform2ui64ARB_profile;}
+if(this->m_ptr_glVertex3fv){this->m_next_glVertex3fv = this->m_ptr_glVertex3fv;this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&ProfileTableDecorator::m_glVertex3fv_profile;}
+if(this->m_ptr_glGetUniformLocation){this->m_next_glGetUniformLocation = this->m_ptr_glGetUniformLocation;this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&ProfileTableDecorator::m_glGetUniformLocation_profile;}
+if(this->m_ptr_glVertexStream1svATI){this->m_next_glVertexStream1svATI = this->m_ptr_glVertexStream1svATI;this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&ProfileTableDecorator::m_glVertexStream1svATI_profile;}
+if(this->m_ptr_glVertexStream3fATI){this->m_next_glVertexStream3fATI = this->m_ptr_glVertexStream3fATI;this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&ProfileTableDecorator::m_glVertexStream3fATI_profile;}
+if(this->m_ptr_glNamedFramebufferDrawBuffers){this->m_next_glNamedFramebufferDrawBuffers = this->m_ptr_glNamedFramebufferDrawBuffers;this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&ProfileTableDecorator::m_glNamedFramebufferDrawBuffers_profile;}
+if(this->m_ptr_glUniform2ui64vNV){this->m_next_glUniform2ui64vNV = this->m_ptr_glUniform2ui64vNV;this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&ProfileTableDecorator::m_glUniform2ui64vNV_profile;}
+if(this->m_ptr_glTexCoordPointervINTEL){this->m_next_glTexCoordPointervINTEL = this->m_ptr_glTexCoordPointervINTEL;this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&ProfileTableDecorator::m_glTexCoordPointervINTEL_profile;}
+if(this->m_ptr_glUniform4fv){this->m_next_glUniform4fv = this->m_ptr_glUniform4fv;this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&ProfileTableDecorator::m_glUniform4fv_profile;}
+if(this->m_ptr_glNormalPointerEXT){this->m_next_glNormalPointerEXT = this->m_ptr_glNormalPointerEXT;this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&ProfileTableDecorator::m_glNormalPointerEXT_profile;}
+if(this->m_ptr_glVertexAttrib4hNV){this->m_next_glVertexAttrib4hNV = this->m_ptr_glVertexAttrib4hNV;this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&ProfileTableDecorator::m_glVertexAttrib4hNV_profile;}
+if(this->m_ptr_glNormal3f){this->m_next_glNormal3f = this->m_ptr_glNormal3f;this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&ProfileTableDecorator::m_glNormal3f_profile;}
+if(this->m_ptr_glVertexStream2iATI){this->m_next_glVertexStream2iATI = this->m_ptr_glVertexStream2iATI;this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&ProfileTableDecorator::m_glVertexStream2iATI_profile;}
+if(this->m_ptr_glVertexAttribP4uiv){this->m_next_glVertexAttribP4uiv = this->m_ptr_glVertexAttribP4uiv;this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&ProfileTableDecorator::m_glVertexAttribP4uiv_profile;}
+if(this->m_ptr_glCompressedTextureSubImage3D){this->m_next_glCompressedTextureSubImage3D = this->m_ptr_glCompressedTextureSubImage3D;this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage3D_profile;}
+if(this->m_ptr_glAsyncMarkerSGIX){this->m_next_glAsyncMarkerSGIX = this->m_ptr_glAsyncMarkerSGIX;this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&ProfileTableDecorator::m_glAsyncMarkerSGIX_profile;}
+if(this->m_ptr_glTextureStorageSparseAMD){this->m_next_glTextureStorageSparseAMD = this->m_ptr_glTextureStorageSparseAMD;this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&ProfileTableDecorator::m_glTextureStorageSparseAMD_profile;}
+if(this->m_ptr_glGetConvolutionParameterivEXT){this->m_next_glGetConvolutionParameterivEXT = this->m_ptr_glGetConvolutionParameterivEXT;this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetConvolutionParameterivEXT_profile;}
+if(this->m_ptr_glEndPerfQueryINTEL){this->m_next_glEndPerfQueryINTEL = this->m_ptr_glEndPerfQueryINTEL;this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&ProfileTableDecorator::m_glEndPerfQueryINTEL_profile;}
+if(this->m_ptr_glFragmentLightModeliSGIX){this->m_next_glFragmentLightModeliSGIX = this->m_ptr_glFragmentLightModeliSGIX;this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&ProfileTableDecorator::m_glFragmentLightModeliSGIX_profile;}
+if(this->m_ptr_glPrioritizeTexturesEXT){this->m_next_glPrioritizeTexturesEXT = this->m_ptr_glPrioritizeTexturesEXT;this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&ProfileTableDecorator::m_glPrioritizeTexturesEXT_profile;}
+if(this->m_ptr_glEndConditionalRender){this->m_next_glEndConditionalRender = this->m_ptr_glEndConditionalRender;this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&ProfileTableDecorator::m_glEndConditionalRender_profile;}
+if(this->m_ptr_glEnableClientState){this->m_next_glEnableClientState = this->m_ptr_glEnableClientState;this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&ProfileTableDecorator::m_glEnableClientState_profile;}
+if(this->m_ptr_glResetHistogram){this->m_next_glResetHistogram = this->m_ptr_glResetHistogram;this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&ProfileTableDecorator::m_glResetHistogram_profile;}
+if(this->m_ptr_glGetOcclusionQueryivNV){this->m_next_glGetOcclusionQueryivNV = this->m_ptr_glGetOcclusionQueryivNV;this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&ProfileTableDecorator::m_glGetOcclusionQueryivNV_profile;}
+if(this->m_ptr_glUniform1uiEXT){this->m_next_glUniform1uiEXT = this->m_ptr_glUniform1uiEXT;this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&ProfileTableDecorator::m_glUniform1uiEXT_profile;}
+if(this->m_ptr_glMultiTexCoord2sv){this->m_next_glMultiTexCoord2sv = this->m_ptr_glMultiTexCoord2sv;this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&ProfileTableDecorator::m_glMultiTexCoord2sv_profile;}
+if(this->m_ptr_glTexSubImage2DEXT){this->m_next_glTexSubImage2DEXT = this->m_ptr_glTexSubImage2DEXT;this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glTexSubImage2DEXT_profile;}
+if(this->m_ptr_glProgramUniform2uiv){this->m_next_glProgramUniform2uiv = this->m_ptr_glProgramUniform2uiv;this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&ProfileTableDecorator::m_glProgramUniform2uiv_profile;}
+if(this->m_ptr_glMultiTexCoord2iARB){this->m_next_glMultiTexCoord2iARB = this->m_ptr_glMultiTexCoord2iARB;this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2iARB_profile;}
+if(this->m_ptr_glGetQueryObjectuiv){this->m_next_glGetQueryObjectuiv = this->m_ptr_glGetQueryObjectuiv;this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&ProfileTableDecorator::m_glGetQueryObjectuiv_profile;}
+if(this->m_ptr_glGenerateMultiTexMipmapEXT){this->m_next_glGenerateMultiTexMipmapEXT = this->m_ptr_glGenerateMultiTexMipmapEXT;this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&ProfileTableDecorator::m_glGenerateMultiTexMipmapEXT_profile;}
+if(this->m_ptr_glVertexAttrib4iv){this->m_next_glVertexAttrib4iv = this->m_ptr_glVertexAttrib4iv;this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&ProfileTableDecorator::m_glVertexAttrib4iv_profile;}
+if(this->m_ptr_glWindowPos3dvMESA){this->m_next_glWindowPos3dvMESA = this->m_ptr_glWindowPos3dvMESA;this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&ProfileTableDecorator::m_glWindowPos3dvMESA_profile;}
+if(this->m_ptr_glLabelObjectEXT){this->m_next_glLabelObjectEXT = this->m_ptr_glLabelObjectEXT;this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&ProfileTableDecorator::m_glLabelObjectEXT_profile;}
+if(this->m_ptr_glProgramUniform1uiv){this->m_next_glProgramUniform1uiv = this->m_ptr_glProgramUniform1uiv;this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&ProfileTableDecorator::m_glProgramUniform1uiv_profile;}
+if(this->m_ptr_glFramebufferTexture){this->m_next_glFramebufferTexture = this->m_ptr_glFramebufferTexture;this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&ProfileTableDecorator::m_glFramebufferTexture_profile;}
+if(this->m_ptr_glMultiTexEnvfEXT){this->m_next_glMultiTexEnvfEXT = this->m_ptr_glMultiTexEnvfEXT;this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&ProfileTableDecorator::m_glMultiTexEnvfEXT_profile;}
+if(this->m_ptr_glGetTexGendv){this->m_next_glGetTexGendv = this->m_ptr_glGetTexGendv;this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&ProfileTableDecorator::m_glGetTexGendv_profile;}
+if(this->m_ptr_glVertex4xOES){this->m_next_glVertex4xOES = this->m_ptr_glVertex4xOES;this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&ProfileTableDecorator::m_glVertex4xOES_profile;}
+if(this->m_ptr_glVertexAttribI2uivEXT){this->m_next_glVertexAttribI2uivEXT = this->m_ptr_glVertexAttribI2uivEXT;this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI2uivEXT_profile;}
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT){this->m_next_glNamedProgramLocalParameter4fvEXT = this->m_ptr_glNamedProgramLocalParameter4fvEXT;this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameter4fvEXT_profile;}
+if(this->m_ptr_glColor3usv){this->m_next_glColor3usv = this->m_ptr_glColor3usv;this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&ProfileTableDecorator::m_glColor3usv_profile;}
+if(this->m_ptr_glGetPixelTransformParameterfvEXT){this->m_next_glGetPixelTransformParameterfvEXT = this->m_ptr_glGetPixelTransformParameterfvEXT;this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetPixelTransformParameterfvEXT_profile;}
+if(this->m_ptr_glIndexxvOES){this->m_next_glIndexxvOES = this->m_ptr_glIndexxvOES;this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&ProfileTableDecorator::m_glIndexxvOES_profile;}
+if(this->m_ptr_glDepthMask){this->m_next_glDepthMask = this->m_ptr_glDepthMask;this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&ProfileTableDecorator::m_glDepthMask_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x4fv){this->m_next_glProgramUniformMatrix2x4fv = this->m_ptr_glProgramUniformMatrix2x4fv;this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x4fv_profile;}
+if(this->m_ptr_glAreProgramsResidentNV){this->m_next_glAreProgramsResidentNV = this->m_ptr_glAreProgramsResidentNV;this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&ProfileTableDecorator::m_glAreProgramsResidentNV_profile;}
+if(this->m_ptr_glColorTable){this->m_next_glColorTable = this->m_ptr_glColorTable;this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&ProfileTableDecorator::m_glColorTable_profile;}
+if(this->m_ptr_glBeginQueryIndexed){this->m_next_glBeginQueryIndexed = this->m_ptr_glBeginQueryIndexed;this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&ProfileTableDecorator::m_glBeginQueryIndexed_profile;}
+if(this->m_ptr_glVertexStream1dvATI){this->m_next_glVertexStream1dvATI = this->m_ptr_glVertexStream1dvATI;this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&ProfileTableDecorator::m_glVertexStream1dvATI_profile;}
+if(this->m_ptr_glGetMultiTexEnvfvEXT){this->m_next_glGetMultiTexEnvfvEXT = this->m_ptr_glGetMultiTexEnvfvEXT;this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexEnvfvEXT_profile;}
+if(this->m_ptr_glDeleteFencesNV){this->m_next_glDeleteFencesNV = this->m_ptr_glDeleteFencesNV;this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&ProfileTableDecorator::m_glDeleteFencesNV_profile;}
+if(this->m_ptr_glVertexAttribs1dvNV){this->m_next_glVertexAttribs1dvNV = this->m_ptr_glVertexAttribs1dvNV;this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&ProfileTableDecorator::m_glVertexAttribs1dvNV_profile;}
+if(this->m_ptr_glBufferStorageExternalEXT){this->m_next_glBufferStorageExternalEXT = this->m_ptr_glBufferStorageExternalEXT;this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&ProfileTableDecorator::m_glBufferStorageExternalEXT_profile;}
+if(this->m_ptr_glVertexStream2sATI){this->m_next_glVertexStream2sATI = this->m_ptr_glVertexStream2sATI;this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&ProfileTableDecorator::m_glVertexStream2sATI_profile;}
+if(this->m_ptr_glGetnSeparableFilterARB){this->m_next_glGetnSeparableFilterARB = this->m_ptr_glGetnSeparableFilterARB;this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&ProfileTableDecorator::m_glGetnSeparableFilterARB_profile;}
+if(this->m_ptr_glProgramUniform2dv){this->m_next_glProgramUniform2dv = this->m_ptr_glProgramUniform2dv;this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&ProfileTableDecorator::m_glProgramUniform2dv_profile;}
+if(this->m_ptr_glActiveStencilFaceEXT){this->m_next_glActiveStencilFaceEXT = this->m_ptr_glActiveStencilFaceEXT;this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&ProfileTableDecorator::m_glActiveStencilFaceEXT_profile;}
+if(this->m_ptr_glProgramUniform4dEXT){this->m_next_glProgramUniform4dEXT = this->m_ptr_glProgramUniform4dEXT;this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&ProfileTableDecorator::m_glProgramUniform4dEXT_profile;}
+if(this->m_ptr_glPointSizexOES){this->m_next_glPointSizexOES = this->m_ptr_glPointSizexOES;this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&ProfileTableDecorator::m_glPointSizexOES_profile;}
+if(this->m_ptr_glRasterPos2sv){this->m_next_glRasterPos2sv = this->m_ptr_glRasterPos2sv;this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&ProfileTableDecorator::m_glRasterPos2sv_profile;}
+if(this->m_ptr_glBindParameterEXT){this->m_next_glBindParameterEXT = this->m_ptr_glBindParameterEXT;this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&ProfileTableDecorator::m_glBindParameterEXT_profile;}
+if(this->m_ptr_glTexCoord1sv){this->m_next_glTexCoord1sv = this->m_ptr_glTexCoord1sv;this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&ProfileTableDecorator::m_glTexCoord1sv_profile;}
+if(this->m_ptr_glBlendParameteriNV){this->m_next_glBlendParameteriNV = this->m_ptr_glBlendParameteriNV;this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&ProfileTableDecorator::m_glBlendParameteriNV_profile;}
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT){this->m_next_glNamedProgramLocalParameter4dvEXT = this->m_ptr_glNamedProgramLocalParameter4dvEXT;this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameter4dvEXT_profile;}
+if(this->m_ptr_glProgramUniformHandleui64NV){this->m_next_glProgramUniformHandleui64NV = this->m_ptr_glProgramUniformHandleui64NV;this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&ProfileTableDecorator::m_glProgramUniformHandleui64NV_profile;}
+if(this->m_ptr_glGetTextureParameterfvEXT){this->m_next_glGetTextureParameterfvEXT = this->m_ptr_glGetTextureParameterfvEXT;this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetTextureParameterfvEXT_profile;}
+if(this->m_ptr_glGetPathMetricsNV){this->m_next_glGetPathMetricsNV = this->m_ptr_glGetPathMetricsNV;this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&ProfileTableDecorator::m_glGetPathMetricsNV_profile;}
+if(this->m_ptr_glVertex2i){this->m_next_glVertex2i = this->m_ptr_glVertex2i;this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&ProfileTableDecorator::m_glVertex2i_profile;}
+if(this->m_ptr_glNewList){this->m_next_glNewList = this->m_ptr_glNewList;this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&ProfileTableDecorator::m_glNewList_profile;}
+if(this->m_ptr_glMatrixLoad3x3fNV){this->m_next_glMatrixLoad3x3fNV = this->m_ptr_glMatrixLoad3x3fNV;this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&ProfileTableDecorator::m_glMatrixLoad3x3fNV_profile;}
+if(this->m_ptr_glMultiTexCoord2fARB){this->m_next_glMultiTexCoord2fARB = this->m_ptr_glMultiTexCoord2fARB;this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2fARB_profile;}
+if(this->m_ptr_glWeightdvARB){this->m_next_glWeightdvARB = this->m_ptr_glWeightdvARB;this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&ProfileTableDecorator::m_glWeightdvARB_profile;}
+if(this->m_ptr_glIsTransformFeedbackNV){this->m_next_glIsTransformFeedbackNV = this->m_ptr_glIsTransformFeedbackNV;this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glIsTransformFeedbackNV_profile;}
+if(this->m_ptr_glVertexAttribDivisorARB){this->m_next_glVertexAttribDivisorARB = this->m_ptr_glVertexAttribDivisorARB;this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&ProfileTableDecorator::m_glVertexAttribDivisorARB_profile;}
+if(this->m_ptr_glSecondaryColorP3uiv){this->m_next_glSecondaryColorP3uiv = this->m_ptr_glSecondaryColorP3uiv;this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&ProfileTableDecorator::m_glSecondaryColorP3uiv_profile;}
+if(this->m_ptr_glGetnCompressedTexImageARB){this->m_next_glGetnCompressedTexImageARB = this->m_ptr_glGetnCompressedTexImageARB;this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&ProfileTableDecorator::m_glGetnCompressedTexImageARB_profile;}
+if(this->m_ptr_glGetIntegerv){this->m_next_glGetIntegerv = this->m_ptr_glGetIntegerv;this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&ProfileTableDecorator::m_glGetIntegerv_profile;}
+if(this->m_ptr_glMatrixLoaddEXT){this->m_next_glMatrixLoaddEXT = this->m_ptr_glMatrixLoaddEXT;this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&ProfileTableDecorator::m_glMatrixLoaddEXT_profile;}
+if(this->m_ptr_glGetPathLengthNV){this->m_next_glGetPathLengthNV = this->m_ptr_glGetPathLengthNV;this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&ProfileTableDecorator::m_glGetPathLengthNV_profile;}
+if(this->m_ptr_glProgramUniformMatrix3dv){this->m_next_glProgramUniformMatrix3dv = this->m_ptr_glProgramUniformMatrix3dv;this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3dv_profile;}
+if(this->m_ptr_glUniform4i64NV){this->m_next_glUniform4i64NV = this->m_ptr_glUniform4i64NV;this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&ProfileTableDecorator::m_glUniform4i64NV_profile;}
+if(this->m_ptr_glGetHistogramEXT){this->m_next_glGetHistogramEXT = this->m_ptr_glGetHistogramEXT;this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&ProfileTableDecorator::m_glGetHistogramEXT_profile;}
+if(this->m_ptr_glVertexAttrib4NuivARB){this->m_next_glVertexAttrib4NuivARB = this->m_ptr_glVertexAttrib4NuivARB;this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NuivARB_profile;}
+if(this->m_ptr_glMapGrid2xOES){this->m_next_glMapGrid2xOES = this->m_ptr_glMapGrid2xOES;this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&ProfileTableDecorator::m_glMapGrid2xOES_profile;}
+if(this->m_ptr_glTexImage2D){this->m_next_glTexImage2D = this->m_ptr_glTexImage2D;this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&ProfileTableDecorator::m_glTexImage2D_profile;}
+if(this->m_ptr_glWindowPos2fvARB){this->m_next_glWindowPos2fvARB = this->m_ptr_glWindowPos2fvARB;this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&ProfileTableDecorator::m_glWindowPos2fvARB_profile;}
+if(this->m_ptr_glEnableIndexedEXT){this->m_next_glEnableIndexedEXT = this->m_ptr_glEnableIndexedEXT;this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&ProfileTableDecorator::m_glEnableIndexedEXT_profile;}
+if(this->m_ptr_glTexCoord1bvOES){this->m_next_glTexCoord1bvOES = this->m_ptr_glTexCoord1bvOES;this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&ProfileTableDecorator::m_glTexCoord1bvOES_profile;}
+if(this->m_ptr_glDrawPixels){this->m_next_glDrawPixels = this->m_ptr_glDrawPixels;this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&ProfileTableDecorator::m_glDrawPixels_profile;}
+if(this->m_ptr_glMultMatrixd){this->m_next_glMultMatrixd = this->m_ptr_glMultMatrixd;this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&ProfileTableDecorator::m_glMultMatrixd_profile;}
+if(this->m_ptr_glMultMatrixf){this->m_next_glMultMatrixf = this->m_ptr_glMultMatrixf;this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&ProfileTableDecorator::m_glMultMatrixf_profile;}
+if(this->m_ptr_glReplacementCodePointerSUN){this->m_next_glReplacementCodePointerSUN = this->m_ptr_glReplacementCodePointerSUN;this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&ProfileTableDecorator::m_glReplacementCodePointerSUN_profile;}
+if(this->m_ptr_glLoadTransposeMatrixdARB){this->m_next_glLoadTransposeMatrixdARB = this->m_ptr_glLoadTransposeMatrixdARB;this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&ProfileTableDecorator::m_glLoadTransposeMatrixdARB_profile;}
+if(this->m_ptr_glVertexAttrib4Nubv){this->m_next_glVertexAttrib4Nubv = this->m_ptr_glVertexAttrib4Nubv;this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&ProfileTableDecorator::m_glVertexAttrib4Nubv_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT){this->m_next_glVertexArrayVertexAttribIOffsetEXT = this->m_ptr_glVertexArrayVertexAttribIOffsetEXT;this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_profile;}
+if(this->m_ptr_glCompileShaderARB){this->m_next_glCompileShaderARB = this->m_ptr_glCompileShaderARB;this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&ProfileTableDecorator::m_glCompileShaderARB_profile;}
+if(this->m_ptr_glWindowPos3dMESA){this->m_next_glWindowPos3dMESA = this->m_ptr_glWindowPos3dMESA;this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&ProfileTableDecorator::m_glWindowPos3dMESA_profile;}
+if(this->m_ptr_glNormalStream3fvATI){this->m_next_glNormalStream3fvATI = this->m_ptr_glNormalStream3fvATI;this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&ProfileTableDecorator::m_glNormalStream3fvATI_profile;}
+if(this->m_ptr_glColor4usv){this->m_next_glColor4usv = this->m_ptr_glColor4usv;this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&ProfileTableDecorator::m_glColor4usv_profile;}
+if(this->m_ptr_glMapGrid1f){this->m_next_glMapGrid1f = this->m_ptr_glMapGrid1f;this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&ProfileTableDecorator::m_glMapGrid1f_profile;}
+if(this->m_ptr_glPolygonStipple){this->m_next_glPolygonStipple = this->m_ptr_glPolygonStipple;this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&ProfileTableDecorator::m_glPolygonStipple_profile;}
+if(this->m_ptr_glUniform4ui64ARB){this->m_next_glUniform4ui64ARB = this->m_ptr_glUniform4ui64ARB;this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&ProfileTableDecorator::m_glUniform4ui64ARB_profile;}
+if(this->m_ptr_glTextureRenderbufferEXT){this->m_next_glTextureRenderbufferEXT = this->m_ptr_glTextureRenderbufferEXT;this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glTextureRenderbufferEXT_profile;}
+if(this->m_ptr_glGetSubroutineUniformLocation){this->m_next_glGetSubroutineUniformLocation = this->m_ptr_glGetSubroutineUniformLocation;this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&ProfileTableDecorator::m_glGetSubroutineUniformLocation_profile;}
+if(this->m_ptr_glGetFramebufferParameteriv){this->m_next_glGetFramebufferParameteriv = this->m_ptr_glGetFramebufferParameteriv;this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetFramebufferParameteriv_profile;}
+if(this->m_ptr_glPixelMapusv){this->m_next_glPixelMapusv = this->m_ptr_glPixelMapusv;this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&ProfileTableDecorator::m_glPixelMapusv_profile;}
+if(this->m_ptr_glGetSamplerParameteriv){this->m_next_glGetSamplerParameteriv = this->m_ptr_glGetSamplerParameteriv;this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetSamplerParameteriv_profile;}
+if(this->m_ptr_glVertexStream2fvATI){this->m_next_glVertexStream2fvATI = this->m_ptr_glVertexStream2fvATI;this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&ProfileTableDecorator::m_glVertexStream2fvATI_profile;}
+if(this->m_ptr_glProgramStringARB){this->m_next_glProgramStringARB = this->m_ptr_glProgramStringARB;this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&ProfileTableDecorator::m_glProgramStringARB_profile;}
+if(this->m_ptr_glProgramUniformMatrix3dvEXT){this->m_next_glProgramUniformMatrix3dvEXT = this->m_ptr_glProgramUniformMatrix3dvEXT;this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3dvEXT_profile;}
+if(this->m_ptr_glSeparableFilter2D){this->m_next_glSeparableFilter2D = this->m_ptr_glSeparableFilter2D;this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&ProfileTableDecorator::m_glSeparableFilter2D_profile;}
+if(this->m_ptr_glVertexAttribI1uiv){this->m_next_glVertexAttribI1uiv = this->m_ptr_glVertexAttribI1uiv;this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&ProfileTableDecorator::m_glVertexAttribI1uiv_profile;}
+if(this->m_ptr_glLGPUCopyImageSubDataNVX){this->m_next_glLGPUCopyImageSubDataNVX = this->m_ptr_glLGPUCopyImageSubDataNVX;this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&ProfileTableDecorator::m_glLGPUCopyImageSubDataNVX_profile;}
+if(this->m_ptr_glTexStorage2D){this->m_next_glTexStorage2D = this->m_ptr_glTexStorage2D;this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&ProfileTableDecorator::m_glTexStorage2D_profile;}
+if(this->m_ptr_glColor3fv){this->m_next_glColor3fv = this->m_ptr_glColor3fv;this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&ProfileTableDecorator::m_glColor3fv_profile;}
+if(this->m_ptr_glGetMultiTexGendvEXT){this->m_next_glGetMultiTexGendvEXT = this->m_ptr_glGetMultiTexGendvEXT;this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexGendvEXT_profile;}
+if(this->m_ptr_glVertexAttribL4dvEXT){this->m_next_glVertexAttribL4dvEXT = this->m_ptr_glVertexAttribL4dvEXT;this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&ProfileTableDecorator::m_glVertexAttribL4dvEXT_profile;}
+if(this->m_ptr_glGetActiveUniform){this->m_next_glGetActiveUniform = this->m_ptr_glGetActiveUniform;this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&ProfileTableDecorator::m_glGetActiveUniform_profile;}
+if(this->m_ptr_glUniform2ui64vARB){this->m_next_glUniform2ui64vARB = this->m_ptr_glUniform2ui64vARB;this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&ProfileTableDecorator::m_glUniform2ui64vARB_profile;}
+if(this->m_ptr_glMakeNamedBufferResidentNV){this->m_next_glMakeNamedBufferResidentNV = this->m_ptr_glMakeNamedBufferResidentNV;this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeNamedBufferResidentNV_profile;}
+if(this->m_ptr_glPathGlyphIndexRangeNV){this->m_next_glPathGlyphIndexRangeNV = this->m_ptr_glPathGlyphIndexRangeNV;this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&ProfileTableDecorator::m_glPathGlyphIndexRangeNV_profile;}
+if(this->m_ptr_glColorPointer){this->m_next_glColorPointer = this->m_ptr_glColorPointer;this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&ProfileTableDecorator::m_glColorPointer_profile;}
+if(this->m_ptr_glProgramEnvParameterI4ivNV){this->m_next_glProgramEnvParameterI4ivNV = this->m_ptr_glProgramEnvParameterI4ivNV;this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&ProfileTableDecorator::m_glProgramEnvParameterI4ivNV_profile;}
+if(this->m_ptr_glMulticastGetQueryObjectui64vNV){this->m_next_glMulticastGetQueryObjectui64vNV = this->m_ptr_glMulticastGetQueryObjectui64vNV;this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&ProfileTableDecorator::m_glMulticastGetQueryObjectui64vNV_profile;}
+if(this->m_ptr_glMultiTexParameterfEXT){this->m_next_glMultiTexParameterfEXT = this->m_ptr_glMultiTexParameterfEXT;this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&ProfileTableDecorator::m_glMultiTexParameterfEXT_profile;}
+if(this->m_ptr_glNamedFramebufferTextureLayer){this->m_next_glNamedFramebufferTextureLayer = this->m_ptr_glNamedFramebufferTextureLayer;this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&ProfileTableDecorator::m_glNamedFramebufferTextureLayer_profile;}
+if(this->m_ptr_glGetVertexArrayIntegervEXT){this->m_next_glGetVertexArrayIntegervEXT = this->m_ptr_glGetVertexArrayIntegervEXT;this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&ProfileTableDecorator::m_glGetVertexArrayIntegervEXT_profile;}
+if(this->m_ptr_glVertexAttrib3dARB){this->m_next_glVertexAttrib3dARB = this->m_ptr_glVertexAttrib3dARB;this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&ProfileTableDecorator::m_glVertexAttrib3dARB_profile;}
+if(this->m_ptr_glVDPAUIsSurfaceNV){this->m_next_glVDPAUIsSurfaceNV = this->m_ptr_glVDPAUIsSurfaceNV;this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&ProfileTableDecorator::m_glVDPAUIsSurfaceNV_profile;}
+if(this->m_ptr_glMultiTexImage1DEXT){this->m_next_glMultiTexImage1DEXT = this->m_ptr_glMultiTexImage1DEXT;this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&ProfileTableDecorator::m_glMultiTexImage1DEXT_profile;}
+if(this->m_ptr_glIsAsyncMarkerSGIX){this->m_next_glIsAsyncMarkerSGIX = this->m_ptr_glIsAsyncMarkerSGIX;this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&ProfileTableDecorator::m_glIsAsyncMarkerSGIX_profile;}
+if(this->m_ptr_glGetDoublei_vEXT){this->m_next_glGetDoublei_vEXT = this->m_ptr_glGetDoublei_vEXT;this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&ProfileTableDecorator::m_glGetDoublei_vEXT_profile;}
+if(this->m_ptr_glUniform2i64NV){this->m_next_glUniform2i64NV = this->m_ptr_glUniform2i64NV;this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&ProfileTableDecorator::m_glUniform2i64NV_profile;}
+if(this->m_ptr_glIsCommandListNV){this->m_next_glIsCommandListNV = this->m_ptr_glIsCommandListNV;this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&ProfileTableDecorator::m_glIsCommandListNV_profile;}
+if(this->m_ptr_glUniform3uiEXT){this->m_next_glUniform3uiEXT = this->m_ptr_glUniform3uiEXT;this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&ProfileTableDecorator::m_glUniform3uiEXT_profile;}
+if(this->m_ptr_glTexParameterIuivEXT){this->m_next_glTexParameterIuivEXT = this->m_ptr_glTexParameterIuivEXT;this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glTexParameterIuivEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix4fv){this->m_next_glProgramUniformMatrix4fv = this->m_ptr_glProgramUniformMatrix4fv;this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4fv_profile;}
+if(this->m_ptr_glVertex2fv){this->m_next_glVertex2fv = this->m_ptr_glVertex2fv;this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&ProfileTableDecorator::m_glVertex2fv_profile;}
+if(this->m_ptr_glVertexAttribL3dEXT){this->m_next_glVertexAttribL3dEXT = this->m_ptr_glVertexAttribL3dEXT;this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&ProfileTableDecorator::m_glVertexAttribL3dEXT_profile;}
+if(this->m_ptr_glFramebufferRenderbuffer){this->m_next_glFramebufferRenderbuffer = this->m_ptr_glFramebufferRenderbuffer;this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&ProfileTableDecorator::m_glFramebufferRenderbuffer_profile;}
+if(this->m_ptr_glGetUniformLocationARB){this->m_next_glGetUniformLocationARB = this->m_ptr_glGetUniformLocationARB;this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&ProfileTableDecorator::m_glGetUniformLocationARB_profile;}
+if(this->m_ptr_glPathParameterfvNV){this->m_next_glPathParameterfvNV = this->m_ptr_glPathParameterfvNV;this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&ProfileTableDecorator::m_glPathParameterfvNV_profile;}
+if(this->m_ptr_glVertexAttrib3sNV){this->m_next_glVertexAttrib3sNV = this->m_ptr_glVertexAttrib3sNV;this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&ProfileTableDecorator::m_glVertexAttrib3sNV_profile;}
+if(this->m_ptr_glGetDoublei_v){this->m_next_glGetDoublei_v = this->m_ptr_glGetDoublei_v;this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&ProfileTableDecorator::m_glGetDoublei_v_profile;}
+if(this->m_ptr_glVertexAttrib1sv){this->m_next_glVertexAttrib1sv = this->m_ptr_glVertexAttrib1sv;this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&ProfileTableDecorator::m_glVertexAttrib1sv_profile;}
+if(this->m_ptr_glBindSampler){this->m_next_glBindSampler = this->m_ptr_glBindSampler;this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&ProfileTableDecorator::m_glBindSampler_profile;}
+if(this->m_ptr_glLineWidth){this->m_next_glLineWidth = this->m_ptr_glLineWidth;this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&ProfileTableDecorator::m_glLineWidth_profile;}
+if(this->m_ptr_glVertexArrayRangeAPPLE){this->m_next_glVertexArrayRangeAPPLE = this->m_ptr_glVertexArrayRangeAPPLE;this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&ProfileTableDecorator::m_glVertexArrayRangeAPPLE_profile;}
+if(this->m_ptr_glBindBufferOffsetEXT){this->m_next_glBindBufferOffsetEXT = this->m_ptr_glBindBufferOffsetEXT;this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&ProfileTableDecorator::m_glBindBufferOffsetEXT_profile;}
+if(this->m_ptr_glWeightfvARB){this->m_next_glWeightfvARB = this->m_ptr_glWeightfvARB;this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&ProfileTableDecorator::m_glWeightfvARB_profile;}
+if(this->m_ptr_glGetIntegeri_v){this->m_next_glGetIntegeri_v = this->m_ptr_glGetIntegeri_v;this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&ProfileTableDecorator::m_glGetIntegeri_v_profile;}
+if(this->m_ptr_glGetTransformFeedbackVarying){this->m_next_glGetTransformFeedbackVarying = this->m_ptr_glGetTransformFeedbackVarying;this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&ProfileTableDecorator::m_glGetTransformFeedbackVarying_profile;}
+if(this->m_ptr_glProgramLocalParameter4fvARB){this->m_next_glProgramLocalParameter4fvARB = this->m_ptr_glProgramLocalParameter4fvARB;this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&ProfileTableDecorator::m_glProgramLocalParameter4fvARB_profile;}
+if(this->m_ptr_glGetTransformFeedbackVaryingNV){this->m_next_glGetTransformFeedbackVaryingNV = this->m_ptr_glGetTransformFeedbackVaryingNV;this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&ProfileTableDecorator::m_glGetTransformFeedbackVaryingNV_profile;}
+if(this->m_ptr_glWindowPos2iv){this->m_next_glWindowPos2iv = this->m_ptr_glWindowPos2iv;this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&ProfileTableDecorator::m_glWindowPos2iv_profile;}
+if(this->m_ptr_glVertexStream1dATI){this->m_next_glVertexStream1dATI = this->m_ptr_glVertexStream1dATI;this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&ProfileTableDecorator::m_glVertexStream1dATI_profile;}
+if(this->m_ptr_glColorFragmentOp2ATI){this->m_next_glColorFragmentOp2ATI = this->m_ptr_glColorFragmentOp2ATI;this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&ProfileTableDecorator::m_glColorFragmentOp2ATI_profile;}
+if(this->m_ptr_glFogiv){this->m_next_glFogiv = this->m_ptr_glFogiv;this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&ProfileTableDecorator::m_glFogiv_profile;}
+if(this->m_ptr_glGetTextureHandleNV){this->m_next_glGetTextureHandleNV = this->m_ptr_glGetTextureHandleNV;this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&ProfileTableDecorator::m_glGetTextureHandleNV_profile;}
+if(this->m_ptr_glLightModeliv){this->m_next_glLightModeliv = this->m_ptr_glLightModeliv;this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&ProfileTableDecorator::m_glLightModeliv_profile;}
+if(this->m_ptr_glDepthRangef){this->m_next_glDepthRangef = this->m_ptr_glDepthRangef;this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&ProfileTableDecorator::m_glDepthRangef_profile;}
+if(this->m_ptr_glGetFragmentMaterialivSGIX){this->m_next_glGetFragmentMaterialivSGIX = this->m_ptr_glGetFragmentMaterialivSGIX;this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&ProfileTableDecorator::m_glGetFragmentMaterialivSGIX_profile;}
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV){this->m_next_glVideoCaptureStreamParameterfvNV = this->m_ptr_glVideoCaptureStreamParameterfvNV;this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&ProfileTableDecorator::m_glVideoCaptureStreamParameterfvNV_profile;}
+if(this->m_ptr_glDeleteProgramsARB){this->m_next_glDeleteProgramsARB = this->m_ptr_glDeleteProgramsARB;this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&ProfileTableDecorator::m_glDeleteProgramsARB_profile;}
+if(this->m_ptr_glWindowPos3fvARB){this->m_next_glWindowPos3fvARB = this->m_ptr_glWindowPos3fvARB;this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&ProfileTableDecorator::m_glWindowPos3fvARB_profile;}
+if(this->m_ptr_glFeedbackBufferxOES){this->m_next_glFeedbackBufferxOES = this->m_ptr_glFeedbackBufferxOES;this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&ProfileTableDecorator::m_glFeedbackBufferxOES_profile;}
+if(this->m_ptr_glGetTexBumpParameterfvATI){this->m_next_glGetTexBumpParameterfvATI = this->m_ptr_glGetTexBumpParameterfvATI;this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&ProfileTableDecorator::m_glGetTexBumpParameterfvATI_profile;}
+if(this->m_ptr_glEnablei){this->m_next_glEnablei = this->m_ptr_glEnablei;this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&ProfileTableDecorator::m_glEnablei_profile;}
+if(this->m_ptr_glGetActiveSubroutineName){this->m_next_glGetActiveSubroutineName = this->m_ptr_glGetActiveSubroutineName;this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&ProfileTableDecorator::m_glGetActiveSubroutineName_profile;}
+if(this->m_ptr_glDrawBuffersARB){this->m_next_glDrawBuffersARB = this->m_ptr_glDrawBuffersARB;this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&ProfileTableDecorator::m_glDrawBuffersARB_profile;}
+if(this->m_ptr_glBindProgramARB){this->m_next_glBindProgramARB = this->m_ptr_glBindProgramARB;this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&ProfileTableDecorator::m_glBindProgramARB_profile;}
+if(this->m_ptr_glEvalCoord1fv){this->m_next_glEvalCoord1fv = this->m_ptr_glEvalCoord1fv;this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&ProfileTableDecorator::m_glEvalCoord1fv_profile;}
+if(this->m_ptr_glProgramUniform3ui64vARB){this->m_next_glProgramUniform3ui64vARB = this->m_ptr_glProgramUniform3ui64vARB;this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&ProfileTableDecorator::m_glProgramUniform3ui64vARB_profile;}
+if(this->m_ptr_glProgramUniformMatrix2dv){this->m_next_glProgramUniformMatrix2dv = this->m_ptr_glProgramUniformMatrix2dv;this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2dv_profile;}
+if(this->m_ptr_glMultiTexCoord2hvNV){this->m_next_glMultiTexCoord2hvNV = this->m_ptr_glMultiTexCoord2hvNV;this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&ProfileTableDecorator::m_glMultiTexCoord2hvNV_profile;}
+if(this->m_ptr_glGetFloatIndexedvEXT){this->m_next_glGetFloatIndexedvEXT = this->m_ptr_glGetFloatIndexedvEXT;this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&ProfileTableDecorator::m_glGetFloatIndexedvEXT_profile;}
+if(this->m_ptr_glSampleCoverageARB){this->m_next_glSampleCoverageARB = this->m_ptr_glSampleCoverageARB;this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&ProfileTableDecorator::m_glSampleCoverageARB_profile;}
+if(this->m_ptr_glProgramUniform2ui64vARB){this->m_next_glProgramUniform2ui64vARB = this->m_ptr_glProgramUniform2ui64vARB;this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&ProfileTableDecorator::m_glProgramUniform2ui64vARB_profile;}
+if(this->m_ptr_glPixelDataRangeNV){this->m_next_glPixelDataRangeNV = this->m_ptr_glPixelDataRangeNV;this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&ProfileTableDecorator::m_glPixelDataRangeNV_profile;}
+if(this->m_ptr_glVertexStream3svATI){this->m_next_glVertexStream3svATI = this->m_ptr_glVertexStream3svATI;this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&ProfileTableDecorator::m_glVertexStream3svATI_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN){this->m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glTexCoord3hvNV){this->m_next_glTexCoord3hvNV = this->m_ptr_glTexCoord3hvNV;this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&ProfileTableDecorator::m_glTexCoord3hvNV_profile;}
+if(this->m_ptr_glSampleMaski){this->m_next_glSampleMaski = this->m_ptr_glSampleMaski;this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&ProfileTableDecorator::m_glSampleMaski_profile;}
+if(this->m_ptr_glIndexFuncEXT){this->m_next_glIndexFuncEXT = this->m_ptr_glIndexFuncEXT;this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&ProfileTableDecorator::m_glIndexFuncEXT_profile;}
+if(this->m_ptr_glPointParameteriNV){this->m_next_glPointParameteriNV = this->m_ptr_glPointParameteriNV;this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&ProfileTableDecorator::m_glPointParameteriNV_profile;}
+if(this->m_ptr_glUniformMatrix3x2fv){this->m_next_glUniformMatrix3x2fv = this->m_ptr_glUniformMatrix3x2fv;this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&ProfileTableDecorator::m_glUniformMatrix3x2fv_profile;}
+if(this->m_ptr_glGetFramebufferParameterivEXT){this->m_next_glGetFramebufferParameterivEXT = this->m_ptr_glGetFramebufferParameterivEXT;this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetFramebufferParameterivEXT_profile;}
+if(this->m_ptr_glUniform2i64ARB){this->m_next_glUniform2i64ARB = this->m_ptr_glUniform2i64ARB;this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&ProfileTableDecorator::m_glUniform2i64ARB_profile;}
+if(this->m_ptr_glNamedBufferStorageEXT){this->m_next_glNamedBufferStorageEXT = this->m_ptr_glNamedBufferStorageEXT;this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&ProfileTableDecorator::m_glNamedBufferStorageEXT_profile;}
+if(this->m_ptr_glNamedFramebufferTexture3DEXT){this->m_next_glNamedFramebufferTexture3DEXT = this->m_ptr_glNamedFramebufferTexture3DEXT;this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTexture3DEXT_profile;}
+if(this->m_ptr_glVertexAttrib2dv){this->m_next_glVertexAttrib2dv = this->m_ptr_glVertexAttrib2dv;this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&ProfileTableDecorator::m_glVertexAttrib2dv_profile;}
+if(this->m_ptr_glGetVertexArrayPointervEXT){this->m_next_glGetVertexArrayPointervEXT = this->m_ptr_glGetVertexArrayPointervEXT;this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&ProfileTableDecorator::m_glGetVertexArrayPointervEXT_profile;}
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI){this->m_next_glGetVertexAttribArrayObjectivATI = this->m_ptr_glGetVertexAttribArrayObjectivATI;this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&ProfileTableDecorator::m_glGetVertexAttribArrayObjectivATI_profile;}
+if(this->m_ptr_glProgramUniformMatrix3fvEXT){this->m_next_glProgramUniformMatrix3fvEXT = this->m_ptr_glProgramUniformMatrix3fvEXT;this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3fvEXT_profile;}
+if(this->m_ptr_glEnableVertexArrayEXT){this->m_next_glEnableVertexArrayEXT = this->m_ptr_glEnableVertexArrayEXT;this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&ProfileTableDecorator::m_glEnableVertexArrayEXT_profile;}
+if(this->m_ptr_glColorTableParameterfvSGI){this->m_next_glColorTableParameterfvSGI = this->m_ptr_glColorTableParameterfvSGI;this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&ProfileTableDecorator::m_glColorTableParameterfvSGI_profile;}
+if(this->m_ptr_glEdgeFlag){this->m_next_glEdgeFlag = this->m_ptr_glEdgeFlag;this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&ProfileTableDecorator::m_glEdgeFlag_profile;}
+if(this->m_ptr_glFogCoordf){this->m_next_glFogCoordf = this->m_ptr_glFogCoordf;this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&ProfileTableDecorator::m_glFogCoordf_profile;}
+if(this->m_ptr_glVertex3d){this->m_next_glVertex3d = this->m_ptr_glVertex3d;this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&ProfileTableDecorator::m_glVertex3d_profile;}
+if(this->m_ptr_glVertex3f){this->m_next_glVertex3f = this->m_ptr_glVertex3f;this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&ProfileTableDecorator::m_glVertex3f_profile;}
+if(this->m_ptr_glSpriteParameterivSGIX){this->m_next_glSpriteParameterivSGIX = this->m_ptr_glSpriteParameterivSGIX;this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&ProfileTableDecorator::m_glSpriteParameterivSGIX_profile;}
+if(this->m_ptr_glPathGlyphRangeNV){this->m_next_glPathGlyphRangeNV = this->m_ptr_glPathGlyphRangeNV;this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&ProfileTableDecorator::m_glPathGlyphRangeNV_profile;}
+if(this->m_ptr_glPrimitiveBoundingBoxARB){this->m_next_glPrimitiveBoundingBoxARB = this->m_ptr_glPrimitiveBoundingBoxARB;this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&ProfileTableDecorator::m_glPrimitiveBoundingBoxARB_profile;}
+if(this->m_ptr_glVertexAttribL3ui64vNV){this->m_next_glVertexAttribL3ui64vNV = this->m_ptr_glVertexAttribL3ui64vNV;this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL3ui64vNV_profile;}
+if(this->m_ptr_glVertex3s){this->m_next_glVertex3s = this->m_ptr_glVertex3s;this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&ProfileTableDecorator::m_glVertex3s_profile;}
+if(this->m_ptr_glTexCoordP2ui){this->m_next_glTexCoordP2ui = this->m_ptr_glTexCoordP2ui;this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&ProfileTableDecorator::m_glTexCoordP2ui_profile;}
+if(this->m_ptr_glProgramUniform2fvEXT){this->m_next_glProgramUniform2fvEXT = this->m_ptr_glProgramUniform2fvEXT;this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&ProfileTableDecorator::m_glProgramUniform2fvEXT_profile;}
+if(this->m_ptr_glDeletePathsNV){this->m_next_glDeletePathsNV = this->m_ptr_glDeletePathsNV;this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&ProfileTableDecorator::m_glDeletePathsNV_profile;}
+if(this->m_ptr_glPrimitiveRestartIndexNV){this->m_next_glPrimitiveRestartIndexNV = this->m_ptr_glPrimitiveRestartIndexNV;this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&ProfileTableDecorator::m_glPrimitiveRestartIndexNV_profile;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN){this->m_next_glTexCoord2fColor3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor3fVertex3fvSUN;this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_profile;}
+if(this->m_ptr_glTexCoordPointerListIBM){this->m_next_glTexCoordPointerListIBM = this->m_ptr_glTexCoordPointerListIBM;this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glTexCoordPointerListIBM_profile;}
+if(this->m_ptr_glRectxOES){this->m_next_glRectxOES = this->m_ptr_glRectxOES;this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&ProfileTableDecorator::m_glRectxOES_profile;}
+if(this->m_ptr_glCopyNamedBufferSubData){this->m_next_glCopyNamedBufferSubData = this->m_ptr_glCopyNamedBufferSubData;this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glCopyNamedBufferSubData_profile;}
+if(this->m_ptr_glGenProgramsNV){this->m_next_glGenProgramsNV = this->m_ptr_glGenProgramsNV;this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&ProfileTableDecorator::m_glGenProgramsNV_profile;}
+if(this->m_ptr_glFragmentLightfSGIX){this->m_next_glFragmentLightfSGIX = this->m_ptr_glFragmentLightfSGIX;this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&ProfileTableDecorator::m_glFragmentLightfSGIX_profile;}
+if(this->m_ptr_glTexStorage3D){this->m_next_glTexStorage3D = this->m_ptr_glTexStorage3D;this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&ProfileTableDecorator::m_glTexStorage3D_profile;}
+if(this->m_ptr_glTextureParameteriv){this->m_next_glTextureParameteriv = this->m_ptr_glTextureParameteriv;this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&ProfileTableDecorator::m_glTextureParameteriv_profile;}
+if(this->m_ptr_glNamedBufferDataEXT){this->m_next_glNamedBufferDataEXT = this->m_ptr_glNamedBufferDataEXT;this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&ProfileTableDecorator::m_glNamedBufferDataEXT_profile;}
+if(this->m_ptr_glImportSemaphoreWin32NameEXT){this->m_next_glImportSemaphoreWin32NameEXT = this->m_ptr_glImportSemaphoreWin32NameEXT;this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&ProfileTableDecorator::m_glImportSemaphoreWin32NameEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3fvARB){this->m_next_glMultiTexCoord3fvARB = this->m_ptr_glMultiTexCoord3fvARB;this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3fvARB_profile;}
+if(this->m_ptr_glUniformMatrix3x4fv){this->m_next_glUniformMatrix3x4fv = this->m_ptr_glUniformMatrix3x4fv;this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&ProfileTableDecorator::m_glUniformMatrix3x4fv_profile;}
+if(this->m_ptr_glSubpixelPrecisionBiasNV){this->m_next_glSubpixelPrecisionBiasNV = this->m_ptr_glSubpixelPrecisionBiasNV;this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&ProfileTableDecorator::m_glSubpixelPrecisionBiasNV_profile;}
+if(this->m_ptr_glNormalPointer){this->m_next_glNormalPointer = this->m_ptr_glNormalPointer;this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&ProfileTableDecorator::m_glNormalPointer_profile;}
+if(this->m_ptr_glNamedFramebufferTexture){this->m_next_glNamedFramebufferTexture = this->m_ptr_glNamedFramebufferTexture;this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&ProfileTableDecorator::m_glNamedFramebufferTexture_profile;}
+if(this->m_ptr_glVertexAttrib4NsvARB){this->m_next_glVertexAttrib4NsvARB = this->m_ptr_glVertexAttrib4NsvARB;this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NsvARB_profile;}
+if(this->m_ptr_glPassThrough){this->m_next_glPassThrough = this->m_ptr_glPassThrough;this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&ProfileTableDecorator::m_glPassThrough_profile;}
+if(this->m_ptr_glSecondaryColorP3ui){this->m_next_glSecondaryColorP3ui = this->m_ptr_glSecondaryColorP3ui;this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&ProfileTableDecorator::m_glSecondaryColorP3ui_profile;}
+if(this->m_ptr_glInvalidateTexSubImage){this->m_next_glInvalidateTexSubImage = this->m_ptr_glInvalidateTexSubImage;this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&ProfileTableDecorator::m_glInvalidateTexSubImage_profile;}
+if(this->m_ptr_glIsImageHandleResidentARB){this->m_next_glIsImageHandleResidentARB = this->m_ptr_glIsImageHandleResidentARB;this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&ProfileTableDecorator::m_glIsImageHandleResidentARB_profile;}
+if(this->m_ptr_glTangent3fvEXT){this->m_next_glTangent3fvEXT = this->m_ptr_glTangent3fvEXT;this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&ProfileTableDecorator::m_glTangent3fvEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x3fv){this->m_next_glProgramUniformMatrix4x3fv = this->m_ptr_glProgramUniformMatrix4x3fv;this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x3fv_profile;}
+if(this->m_ptr_glBegin){this->m_next_glBegin = this->m_ptr_glBegin;this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&ProfileTableDecorator::m_glBegin_profile;}
+if(this->m_ptr_glEvalCoord2dv){this->m_next_glEvalCoord2dv = this->m_ptr_glEvalCoord2dv;this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&ProfileTableDecorator::m_glEvalCoord2dv_profile;}
+if(this->m_ptr_glColor3ubv){this->m_next_glColor3ubv = this->m_ptr_glColor3ubv;this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&ProfileTableDecorator::m_glColor3ubv_profile;}
+if(this->m_ptr_glFogCoordfvEXT){this->m_next_glFogCoordfvEXT = this->m_ptr_glFogCoordfvEXT;this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&ProfileTableDecorator::m_glFogCoordfvEXT_profile;}
+if(this->m_ptr_glVertexP3ui){this->m_next_glVertexP3ui = this->m_ptr_glVertexP3ui;this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&ProfileTableDecorator::m_glVertexP3ui_profile;}
+if(this->m_ptr_glLightfv){this->m_next_glLightfv = this->m_ptr_glLightfv;this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&ProfileTableDecorator::m_glLightfv_profile;}
+if(this->m_ptr_glVertexAttribL3i64NV){this->m_next_glVertexAttribL3i64NV = this->m_ptr_glVertexAttribL3i64NV;this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&ProfileTableDecorator::m_glVertexAttribL3i64NV_profile;}
+if(this->m_ptr_glStencilClearTagEXT){this->m_next_glStencilClearTagEXT = this->m_ptr_glStencilClearTagEXT;this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&ProfileTableDecorator::m_glStencilClearTagEXT_profile;}
+if(this->m_ptr_glGetActiveUniformName){this->m_next_glGetActiveUniformName = this->m_ptr_glGetActiveUniformName;this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&ProfileTableDecorator::m_glGetActiveUniformName_profile;}
+if(this->m_ptr_glTangentPointerEXT){this->m_next_glTangentPointerEXT = this->m_ptr_glTangentPointerEXT;this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&ProfileTableDecorator::m_glTangentPointerEXT_profile;}
+if(this->m_ptr_glUniform4ui64vNV){this->m_next_glUniform4ui64vNV = this->m_ptr_glUniform4ui64vNV;this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&ProfileTableDecorator::m_glUniform4ui64vNV_profile;}
+if(this->m_ptr_glDebugMessageEnableAMD){this->m_next_glDebugMessageEnableAMD = this->m_ptr_glDebugMessageEnableAMD;this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&ProfileTableDecorator::m_glDebugMessageEnableAMD_profile;}
+if(this->m_ptr_glProgramUniform2ui){this->m_next_glProgramUniform2ui = this->m_ptr_glProgramUniform2ui;this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&ProfileTableDecorator::m_glProgramUniform2ui_profile;}
+if(this->m_ptr_glCopyTexSubImage2DEXT){this->m_next_glCopyTexSubImage2DEXT = this->m_ptr_glCopyTexSubImage2DEXT;this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyTexSubImage2DEXT_profile;}
+if(this->m_ptr_glGenRenderbuffersEXT){this->m_next_glGenRenderbuffersEXT = this->m_ptr_glGenRenderbuffersEXT;this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&ProfileTableDecorator::m_glGenRenderbuffersEXT_profile;}
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT){this->m_next_glNamedProgramLocalParameterI4ivEXT = this->m_ptr_glNamedProgramLocalParameterI4ivEXT;this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_profile;}
+if(this->m_ptr_glMultiTexCoord2f){this->m_next_glMultiTexCoord2f = this->m_ptr_glMultiTexCoord2f;this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&ProfileTableDecorator::m_glMultiTexCoord2f_profile;}
+if(this->m_ptr_glMapGrid2d){this->m_next_glMapGrid2d = this->m_ptr_glMapGrid2d;this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&ProfileTableDecorator::m_glMapGrid2d_profile;}
+if(this->m_ptr_glGetMultiTexParameterIuivEXT){this->m_next_glGetMultiTexParameterIuivEXT = this->m_ptr_glGetMultiTexParameterIuivEXT;this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexParameterIuivEXT_profile;}
+if(this->m_ptr_glBlendEquationiARB){this->m_next_glBlendEquationiARB = this->m_ptr_glBlendEquationiARB;this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&ProfileTableDecorator::m_glBlendEquationiARB_profile;}
+if(this->m_ptr_glTexParameteriv){this->m_next_glTexParameteriv = this->m_ptr_glTexParameteriv;this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&ProfileTableDecorator::m_glTexParameteriv_profile;}
+if(this->m_ptr_glUniform4ivARB){this->m_next_glUniform4ivARB = this->m_ptr_glUniform4ivARB;this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&ProfileTableDecorator::m_glUniform4ivARB_profile;}
+if(this->m_ptr_glMatrixOrthoEXT){this->m_next_glMatrixOrthoEXT = this->m_ptr_glMatrixOrthoEXT;this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&ProfileTableDecorator::m_glMatrixOrthoEXT_profile;}
+if(this->m_ptr_glVertexArrayVertexBuffer){this->m_next_glVertexArrayVertexBuffer = this->m_ptr_glVertexArrayVertexBuffer;this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&ProfileTableDecorator::m_glVertexArrayVertexBuffer_profile;}
+if(this->m_ptr_glProgramLocalParametersI4ivNV){this->m_next_glProgramLocalParametersI4ivNV = this->m_ptr_glProgramLocalParametersI4ivNV;this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&ProfileTableDecorator::m_glProgramLocalParametersI4ivNV_profile;}
+if(this->m_ptr_glProgramUniform4ui64vNV){this->m_next_glProgramUniform4ui64vNV = this->m_ptr_glProgramUniform4ui64vNV;this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&ProfileTableDecorator::m_glProgramUniform4ui64vNV_profile;}
+if(this->m_ptr_glGetNamedStringivARB){this->m_next_glGetNamedStringivARB = this->m_ptr_glGetNamedStringivARB;this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&ProfileTableDecorator::m_glGetNamedStringivARB_profile;}
+if(this->m_ptr_glVertexAttribL1i64vNV){this->m_next_glVertexAttribL1i64vNV = this->m_ptr_glVertexAttribL1i64vNV;this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL1i64vNV_profile;}
+if(this->m_ptr_glTransformFeedbackBufferBase){this->m_next_glTransformFeedbackBufferBase = this->m_ptr_glTransformFeedbackBufferBase;this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&ProfileTableDecorator::m_glTransformFeedbackBufferBase_profile;}
+if(this->m_ptr_glIndexsv){this->m_next_glIndexsv = this->m_ptr_glIndexsv;this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&ProfileTableDecorator::m_glIndexsv_profile;}
+if(this->m_ptr_glPointParameterivNV){this->m_next_glPointParameterivNV = this->m_ptr_glPointParameterivNV;this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&ProfileTableDecorator::m_glPointParameterivNV_profile;}
+if(this->m_ptr_glGetDetailTexFuncSGIS){this->m_next_glGetDetailTexFuncSGIS = this->m_ptr_glGetDetailTexFuncSGIS;this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&ProfileTableDecorator::m_glGetDetailTexFuncSGIS_profile;}
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN){this->m_next_glReplacementCodeuiColor3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN;this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_profile;}
+if(this->m_ptr_glProgramLocalParameter4fARB){this->m_next_glProgramLocalParameter4fARB = this->m_ptr_glProgramLocalParameter4fARB;this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&ProfileTableDecorator::m_glProgramLocalParameter4fARB_profile;}
+if(this->m_ptr_glBitmap){this->m_next_glBitmap = this->m_ptr_glBitmap;this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&ProfileTableDecorator::m_glBitmap_profile;}
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT){this->m_next_glNamedFramebufferTextureLayerEXT = this->m_ptr_glNamedFramebufferTextureLayerEXT;this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTextureLayerEXT_profile;}
+if(this->m_ptr_glMultiTexGenfvEXT){this->m_next_glMultiTexGenfvEXT = this->m_ptr_glMultiTexGenfvEXT;this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&ProfileTableDecorator::m_glMultiTexGenfvEXT_profile;}
+if(this->m_ptr_glGetNamedBufferSubData){this->m_next_glGetNamedBufferSubData = this->m_ptr_glGetNamedBufferSubData;this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glGetNamedBufferSubData_profile;}
+if(this->m_ptr_glStencilFuncSeparateATI){this->m_next_glStencilFuncSeparateATI = this->m_ptr_glStencilFuncSeparateATI;this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&ProfileTableDecorator::m_glStencilFuncSeparateATI_profile;}
+if(this->m_ptr_glProgramUniform2iv){this->m_next_glProgramUniform2iv = this->m_ptr_glProgramUniform2iv;this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&ProfileTableDecorator::m_glProgramUniform2iv_profile;}
+if(this->m_ptr_glGetQueryiv){this->m_next_glGetQueryiv = this->m_ptr_glGetQueryiv;this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&ProfileTableDecorator::m_glGetQueryiv_profile;}
+if(this->m_ptr_glTexCoord4f){this->m_next_glTexCoord4f = this->m_ptr_glTexCoord4f;this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&ProfileTableDecorator::m_glTexCoord4f_profile;}
+if(this->m_ptr_glMapGrid2f){this->m_next_glMapGrid2f = this->m_ptr_glMapGrid2f;this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&ProfileTableDecorator::m_glMapGrid2f_profile;}
+if(this->m_ptr_glListParameterivSGIX){this->m_next_glListParameterivSGIX = this->m_ptr_glListParameterivSGIX;this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&ProfileTableDecorator::m_glListParameterivSGIX_profile;}
+if(this->m_ptr_glCreateQueries){this->m_next_glCreateQueries = this->m_ptr_glCreateQueries;this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&ProfileTableDecorator::m_glCreateQueries_profile;}
+if(this->m_ptr_glGetSamplerParameterfv){this->m_next_glGetSamplerParameterfv = this->m_ptr_glGetSamplerParameterfv;this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&ProfileTableDecorator::m_glGetSamplerParameterfv_profile;}
+if(this->m_ptr_glTexCoord4i){this->m_next_glTexCoord4i = this->m_ptr_glTexCoord4i;this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&ProfileTableDecorator::m_glTexCoord4i_profile;}
+if(this->m_ptr_glObjectLabel){this->m_next_glObjectLabel = this->m_ptr_glObjectLabel;this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&ProfileTableDecorator::m_glObjectLabel_profile;}
+if(this->m_ptr_glProgramUniform3i64NV){this->m_next_glProgramUniform3i64NV = this->m_ptr_glProgramUniform3i64NV;this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&ProfileTableDecorator::m_glProgramUniform3i64NV_profile;}
+if(this->m_ptr_glGetTextureHandleARB){this->m_next_glGetTextureHandleARB = this->m_ptr_glGetTextureHandleARB;this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&ProfileTableDecorator::m_glGetTextureHandleARB_profile;}
+if(this->m_ptr_glTexCoord4s){this->m_next_glTexCoord4s = this->m_ptr_glTexCoord4s;this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&ProfileTableDecorator::m_glTexCoord4s_profile;}
+if(this->m_ptr_glUniform4iARB){this->m_next_glUniform4iARB = this->m_ptr_glUniform4iARB;this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&ProfileTableDecorator::m_glUniform4iARB_profile;}
+if(this->m_ptr_glGetUniformIndices){this->m_next_glGetUniformIndices = this->m_ptr_glGetUniformIndices;this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&ProfileTableDecorator::m_glGetUniformIndices_profile;}
+if(this->m_ptr_glMultiTexImage3DEXT){this->m_next_glMultiTexImage3DEXT = this->m_ptr_glMultiTexImage3DEXT;this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&ProfileTableDecorator::m_glMultiTexImage3DEXT_profile;}
+if(this->m_ptr_glCoverageModulationTableNV){this->m_next_glCoverageModulationTableNV = this->m_ptr_glCoverageModulationTableNV;this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&ProfileTableDecorator::m_glCoverageModulationTableNV_profile;}
+if(this->m_ptr_glPointParameteriv){this->m_next_glPointParameteriv = this->m_ptr_glPointParameteriv;this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&ProfileTableDecorator::m_glPointParameteriv_profile;}
+if(this->m_ptr_glMultiTexCoord4svARB){this->m_next_glMultiTexCoord4svARB = this->m_ptr_glMultiTexCoord4svARB;this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4svARB_profile;}
+if(this->m_ptr_glNormal3fv){this->m_next_glNormal3fv = this->m_ptr_glNormal3fv;this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&ProfileTableDecorator::m_glNormal3fv_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT){this->m_next_glProgramUniformMatrix3x4dvEXT = this->m_ptr_glProgramUniformMatrix3x4dvEXT;this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x4dvEXT_profile;}
+if(this->m_ptr_glTexCoord1fv){this->m_next_glTexCoord1fv = this->m_ptr_glTexCoord1fv;this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&ProfileTableDecorator::m_glTexCoord1fv_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT){this->m_next_glProgramUniformMatrix4x3dvEXT = this->m_ptr_glProgramUniformMatrix4x3dvEXT;this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x3dvEXT_profile;}
+if(this->m_ptr_glGetActiveVaryingNV){this->m_next_glGetActiveVaryingNV = this->m_ptr_glGetActiveVaryingNV;this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&ProfileTableDecorator::m_glGetActiveVaryingNV_profile;}
+if(this->m_ptr_glUniform1i64vARB){this->m_next_glUniform1i64vARB = this->m_ptr_glUniform1i64vARB;this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&ProfileTableDecorator::m_glUniform1i64vARB_profile;}
+if(this->m_ptr_glMultiTexCoord1dv){this->m_next_glMultiTexCoord1dv = this->m_ptr_glMultiTexCoord1dv;this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&ProfileTableDecorator::m_glMultiTexCoord1dv_profile;}
+if(this->m_ptr_glTexCoord3fv){this->m_next_glTexCoord3fv = this->m_ptr_glTexCoord3fv;this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&ProfileTableDecorator::m_glTexCoord3fv_profile;}
+if(this->m_ptr_glMatrixTranslatefEXT){this->m_next_glMatrixTranslatefEXT = this->m_ptr_glMatrixTranslatefEXT;this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&ProfileTableDecorator::m_glMatrixTranslatefEXT_profile;}
+if(this->m_ptr_glProgramUniform1ui64vNV){this->m_next_glProgramUniform1ui64vNV = this->m_ptr_glProgramUniform1ui64vNV;this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&ProfileTableDecorator::m_glProgramUniform1ui64vNV_profile;}
+if(this->m_ptr_glTextureMaterialEXT){this->m_next_glTextureMaterialEXT = this->m_ptr_glTextureMaterialEXT;this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&ProfileTableDecorator::m_glTextureMaterialEXT_profile;}
+if(this->m_ptr_glMultiTexCoordP3uiv){this->m_next_glMultiTexCoordP3uiv = this->m_ptr_glMultiTexCoordP3uiv;this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&ProfileTableDecorator::m_glMultiTexCoordP3uiv_profile;}
+if(this->m_ptr_glVertexAttribP3ui){this->m_next_glVertexAttribP3ui = this->m_ptr_glVertexAttribP3ui;this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&ProfileTableDecorator::m_glVertexAttribP3ui_profile;}
+if(this->m_ptr_glInterpolatePathsNV){this->m_next_glInterpolatePathsNV = this->m_ptr_glInterpolatePathsNV;this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&ProfileTableDecorator::m_glInterpolatePathsNV_profile;}
+if(this->m_ptr_glTextureBufferRange){this->m_next_glTextureBufferRange = this->m_ptr_glTextureBufferRange;this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&ProfileTableDecorator::m_glTextureBufferRange_profile;}
+if(this->m_ptr_glVertexAttribL2dEXT){this->m_next_glVertexAttribL2dEXT = this->m_ptr_glVertexAttribL2dEXT;this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&ProfileTableDecorator::m_glVertexAttribL2dEXT_profile;}
+if(this->m_ptr_glGetPixelTransformParameterivEXT){this->m_next_glGetPixelTransformParameterivEXT = this->m_ptr_glGetPixelTransformParameterivEXT;this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetPixelTransformParameterivEXT_profile;}
+if(this->m_ptr_glTexCoord4xvOES){this->m_next_glTexCoord4xvOES = this->m_ptr_glTexCoord4xvOES;this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&ProfileTableDecorator::m_glTexCoord4xvOES_profile;}
+if(this->m_ptr_glGetVariantBooleanvEXT){this->m_next_glGetVariantBooleanvEXT = this->m_ptr_glGetVariantBooleanvEXT;this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&ProfileTableDecorator::m_glGetVariantBooleanvEXT_profile;}
+if(this->m_ptr_glDepthRange){this->m_next_glDepthRange = this->m_ptr_glDepthRange;this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&ProfileTableDecorator::m_glDepthRange_profile;}
+if(this->m_ptr_glGetVertexAttribdvARB){this->m_next_glGetVertexAttribdvARB = this->m_ptr_glGetVertexAttribdvARB;this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&ProfileTableDecorator::m_glGetVertexAttribdvARB_profile;}
+if(this->m_ptr_glGetColorTableParameterfv){this->m_next_glGetColorTableParameterfv = this->m_ptr_glGetColorTableParameterfv;this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&ProfileTableDecorator::m_glGetColorTableParameterfv_profile;}
+if(this->m_ptr_glDrawArraysInstancedEXT){this->m_next_glDrawArraysInstancedEXT = this->m_ptr_glDrawArraysInstancedEXT;this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&ProfileTableDecorator::m_glDrawArraysInstancedEXT_profile;}
+if(this->m_ptr_glDisableClientStateIndexedEXT){this->m_next_glDisableClientStateIndexedEXT = this->m_ptr_glDisableClientStateIndexedEXT;this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&ProfileTableDecorator::m_glDisableClientStateIndexedEXT_profile;}
+if(this->m_ptr_glDrawBuffer){this->m_next_glDrawBuffer = this->m_ptr_glDrawBuffer;this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&ProfileTableDecorator::m_glDrawBuffer_profile;}
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV){this->m_next_glMultiDrawArraysIndirectBindlessNV = this->m_ptr_glMultiDrawArraysIndirectBindlessNV;this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_profile;}
+if(this->m_ptr_glGetnPixelMapusv){this->m_next_glGetnPixelMapusv = this->m_ptr_glGetnPixelMapusv;this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&ProfileTableDecorator::m_glGetnPixelMapusv_profile;}
+if(this->m_ptr_glRasterPos3fv){this->m_next_glRasterPos3fv = this->m_ptr_glRasterPos3fv;this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&ProfileTableDecorator::m_glRasterPos3fv_profile;}
+if(this->m_ptr_glClearBufferuiv){this->m_next_glClearBufferuiv = this->m_ptr_glClearBufferuiv;this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&ProfileTableDecorator::m_glClearBufferuiv_profile;}
+if(this->m_ptr_glGetInternalformati64v){this->m_next_glGetInternalformati64v = this->m_ptr_glGetInternalformati64v;this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&ProfileTableDecorator::m_glGetInternalformati64v_profile;}
+if(this->m_ptr_glShaderSourceARB){this->m_next_glShaderSourceARB = this->m_ptr_glShaderSourceARB;this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&ProfileTableDecorator::m_glShaderSourceARB_profile;}
+if(this->m_ptr_glShaderOp3EXT){this->m_next_glShaderOp3EXT = this->m_ptr_glShaderOp3EXT;this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&ProfileTableDecorator::m_glShaderOp3EXT_profile;}
+if(this->m_ptr_glWindowPos2dvMESA){this->m_next_glWindowPos2dvMESA = this->m_ptr_glWindowPos2dvMESA;this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&ProfileTableDecorator::m_glWindowPos2dvMESA_profile;}
+if(this->m_ptr_glClearIndex){this->m_next_glClearIndex = this->m_ptr_glClearIndex;this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&ProfileTableDecorator::m_glClearIndex_profile;}
+if(this->m_ptr_glProvokingVertexEXT){this->m_next_glProvokingVertexEXT = this->m_ptr_glProvokingVertexEXT;this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&ProfileTableDecorator::m_glProvokingVertexEXT_profile;}
+if(this->m_ptr_glVariantubvEXT){this->m_next_glVariantubvEXT = this->m_ptr_glVariantubvEXT;this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&ProfileTableDecorator::m_glVariantubvEXT_profile;}
+if(this->m_ptr_glFlush){this->m_next_glFlush = this->m_ptr_glFlush;this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&ProfileTableDecorator::m_glFlush_profile;}
+if(this->m_ptr_glFramebufferTexture2DEXT){this->m_next_glFramebufferTexture2DEXT = this->m_ptr_glFramebufferTexture2DEXT;this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&ProfileTableDecorator::m_glFramebufferTexture2DEXT_profile;}
+if(this->m_ptr_glGetColorTableParameterivEXT){this->m_next_glGetColorTableParameterivEXT = this->m_ptr_glGetColorTableParameterivEXT;this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetColorTableParameterivEXT_profile;}
+if(this->m_ptr_glPresentFrameDualFillNV){this->m_next_glPresentFrameDualFillNV = this->m_ptr_glPresentFrameDualFillNV;this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&ProfileTableDecorator::m_glPresentFrameDualFillNV_profile;}
+if(this->m_ptr_glGenVertexShadersEXT){this->m_next_glGenVertexShadersEXT = this->m_ptr_glGenVertexShadersEXT;this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&ProfileTableDecorator::m_glGenVertexShadersEXT_profile;}
+if(this->m_ptr_glSpecializeShaderARB){this->m_next_glSpecializeShaderARB = this->m_ptr_glSpecializeShaderARB;this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&ProfileTableDecorator::m_glSpecializeShaderARB_profile;}
+if(this->m_ptr_glProgramUniformHandleui64vARB){this->m_next_glProgramUniformHandleui64vARB = this->m_ptr_glProgramUniformHandleui64vARB;this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&ProfileTableDecorator::m_glProgramUniformHandleui64vARB_profile;}
+if(this->m_ptr_glDepthRangefOES){this->m_next_glDepthRangefOES = this->m_ptr_glDepthRangefOES;this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&ProfileTableDecorator::m_glDepthRangefOES_profile;}
+if(this->m_ptr_glDeleteVertexArrays){this->m_next_glDeleteVertexArrays = this->m_ptr_glDeleteVertexArrays;this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&ProfileTableDecorator::m_glDeleteVertexArrays_profile;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance){this->m_next_glDrawElementsInstancedBaseVertexBaseInstance = this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance;this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&ProfileTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_profile;}
+if(this->m_ptr_glGetTexLevelParameteriv){this->m_next_glGetTexLevelParameteriv = this->m_ptr_glGetTexLevelParameteriv;this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&ProfileTableDecorator::m_glGetTexLevelParameteriv_profile;}
+if(this->m_ptr_glDrawVkImageNV){this->m_next_glDrawVkImageNV = this->m_ptr_glDrawVkImageNV;this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&ProfileTableDecorator::m_glDrawVkImageNV_profile;}
+if(this->m_ptr_glWindowPos3iARB){this->m_next_glWindowPos3iARB = this->m_ptr_glWindowPos3iARB;this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&ProfileTableDecorator::m_glWindowPos3iARB_profile;}
+if(this->m_ptr_glPrioritizeTextures){this->m_next_glPrioritizeTextures = this->m_ptr_glPrioritizeTextures;this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&ProfileTableDecorator::m_glPrioritizeTextures_profile;}
+if(this->m_ptr_glWindowPos3fvMESA){this->m_next_glWindowPos3fvMESA = this->m_ptr_glWindowPos3fvMESA;this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&ProfileTableDecorator::m_glWindowPos3fvMESA_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT){this->m_next_glProgramUniformMatrix3x2dvEXT = this->m_ptr_glProgramUniformMatrix3x2dvEXT;this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x2dvEXT_profile;}
+if(this->m_ptr_glVertex4xvOES){this->m_next_glVertex4xvOES = this->m_ptr_glVertex4xvOES;this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&ProfileTableDecorator::m_glVertex4xvOES_profile;}
+if(this->m_ptr_glTexStorage3DMultisample){this->m_next_glTexStorage3DMultisample = this->m_ptr_glTexStorage3DMultisample;this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTexStorage3DMultisample_profile;}
+if(this->m_ptr_glWindowPos2sARB){this->m_next_glWindowPos2sARB = this->m_ptr_glWindowPos2sARB;this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&ProfileTableDecorator::m_glWindowPos2sARB_profile;}
+if(this->m_ptr_glStencilOpValueAMD){this->m_next_glStencilOpValueAMD = this->m_ptr_glStencilOpValueAMD;this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&ProfileTableDecorator::m_glStencilOpValueAMD_profile;}
+if(this->m_ptr_glProgramVertexLimitNV){this->m_next_glProgramVertexLimitNV = this->m_ptr_glProgramVertexLimitNV;this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&ProfileTableDecorator::m_glProgramVertexLimitNV_profile;}
+if(this->m_ptr_glGetTexParameterPointervAPPLE){this->m_next_glGetTexParameterPointervAPPLE = this->m_ptr_glGetTexParameterPointervAPPLE;this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&ProfileTableDecorator::m_glGetTexParameterPointervAPPLE_profile;}
+if(this->m_ptr_glProgramUniform3uivEXT){this->m_next_glProgramUniform3uivEXT = this->m_ptr_glProgramUniform3uivEXT;this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&ProfileTableDecorator::m_glProgramUniform3uivEXT_profile;}
+if(this->m_ptr_glClampColor){this->m_next_glClampColor = this->m_ptr_glClampColor;this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&ProfileTableDecorator::m_glClampColor_profile;}
+if(this->m_ptr_glClearStencil){this->m_next_glClearStencil = this->m_ptr_glClearStencil;this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&ProfileTableDecorator::m_glClearStencil_profile;}
+if(this->m_ptr_glTexCoordP1uiv){this->m_next_glTexCoordP1uiv = this->m_ptr_glTexCoordP1uiv;this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&ProfileTableDecorator::m_glTexCoordP1uiv_profile;}
+if(this->m_ptr_glVertexAttribs3svNV){this->m_next_glVertexAttribs3svNV = this->m_ptr_glVertexAttribs3svNV;this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&ProfileTableDecorator::m_glVertexAttribs3svNV_profile;}
+if(this->m_ptr_glMultiTexCoord3fv){this->m_next_glMultiTexCoord3fv = this->m_ptr_glMultiTexCoord3fv;this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&ProfileTableDecorator::m_glMultiTexCoord3fv_profile;}
+if(this->m_ptr_glVertexBlendEnvfATI){this->m_next_glVertexBlendEnvfATI = this->m_ptr_glVertexBlendEnvfATI;this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&ProfileTableDecorator::m_glVertexBlendEnvfATI_profile;}
+if(this->m_ptr_glIsFenceAPPLE){this->m_next_glIsFenceAPPLE = this->m_ptr_glIsFenceAPPLE;this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&ProfileTableDecorator::m_glIsFenceAPPLE_profile;}
+if(this->m_ptr_glGetBufferParameterui64vNV){this->m_next_glGetBufferParameterui64vNV = this->m_ptr_glGetBufferParameterui64vNV;this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&ProfileTableDecorator::m_glGetBufferParameterui64vNV_profile;}
+if(this->m_ptr_glVertexAttribI4bvEXT){this->m_next_glVertexAttribI4bvEXT = this->m_ptr_glVertexAttribI4bvEXT;this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4bvEXT_profile;}
+if(this->m_ptr_glUniform2fARB){this->m_next_glUniform2fARB = this->m_ptr_glUniform2fARB;this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&ProfileTableDecorator::m_glUniform2fARB_profile;}
+if(this->m_ptr_glStopInstrumentsSGIX){this->m_next_glStopInstrumentsSGIX = this->m_ptr_glStopInstrumentsSGIX;this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&ProfileTableDecorator::m_glStopInstrumentsSGIX_profile;}
+if(this->m_ptr_glVertexAttrib3fNV){this->m_next_glVertexAttrib3fNV = this->m_ptr_glVertexAttrib3fNV;this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&ProfileTableDecorator::m_glVertexAttrib3fNV_profile;}
+if(this->m_ptr_glMapVertexAttrib2dAPPLE){this->m_next_glMapVertexAttrib2dAPPLE = this->m_ptr_glMapVertexAttrib2dAPPLE;this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&ProfileTableDecorator::m_glMapVertexAttrib2dAPPLE_profile;}
+if(this->m_ptr_glVertex2f){this->m_next_glVertex2f = this->m_ptr_glVertex2f;this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&ProfileTableDecorator::m_glVertex2f_profile;}
+if(this->m_ptr_glCopyTextureImage2DEXT){this->m_next_glCopyTextureImage2DEXT = this->m_ptr_glCopyTextureImage2DEXT;this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyTextureImage2DEXT_profile;}
+if(this->m_ptr_glVertex2d){this->m_next_glVertex2d = this->m_ptr_glVertex2d;this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&ProfileTableDecorator::m_glVertex2d_profile;}
+if(this->m_ptr_glSecondaryColor3bvEXT){this->m_next_glSecondaryColor3bvEXT = this->m_ptr_glSecondaryColor3bvEXT;this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3bvEXT_profile;}
+if(this->m_ptr_glMultiTexCoord4fARB){this->m_next_glMultiTexCoord4fARB = this->m_ptr_glMultiTexCoord4fARB;this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4fARB_profile;}
+if(this->m_ptr_glPolygonOffset){this->m_next_glPolygonOffset = this->m_ptr_glPolygonOffset;this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&ProfileTableDecorator::m_glPolygonOffset_profile;}
+if(this->m_ptr_glTangent3bvEXT){this->m_next_glTangent3bvEXT = this->m_ptr_glTangent3bvEXT;this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&ProfileTableDecorator::m_glTangent3bvEXT_profile;}
+if(this->m_ptr_glHistogram){this->m_next_glHistogram = this->m_ptr_glHistogram;this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&ProfileTableDecorator::m_glHistogram_profile;}
+if(this->m_ptr_glGetProgramiv){this->m_next_glGetProgramiv = this->m_ptr_glGetProgramiv;this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&ProfileTableDecorator::m_glGetProgramiv_profile;}
+if(this->m_ptr_glMatrixIndexubvARB){this->m_next_glMatrixIndexubvARB = this->m_ptr_glMatrixIndexubvARB;this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&ProfileTableDecorator::m_glMatrixIndexubvARB_profile;}
+if(this->m_ptr_glVertex2s){this->m_next_glVertex2s = this->m_ptr_glVertex2s;this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&ProfileTableDecorator::m_glVertex2s_profile;}
+if(this->m_ptr_glGetVertexAttribLui64vNV){this->m_next_glGetVertexAttribLui64vNV = this->m_ptr_glGetVertexAttribLui64vNV;this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&ProfileTableDecorator::m_glGetVertexAttribLui64vNV_profile;}
+if(this->m_ptr_glGetProgramStringARB){this->m_next_glGetProgramStringARB = this->m_ptr_glGetProgramStringARB;this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&ProfileTableDecorator::m_glGetProgramStringARB_profile;}
+if(this->m_ptr_glFlushMappedBufferRange){this->m_next_glFlushMappedBufferRange = this->m_ptr_glFlushMappedBufferRange;this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&ProfileTableDecorator::m_glFlushMappedBufferRange_profile;}
+if(this->m_ptr_glVertexAttribI3uiEXT){this->m_next_glVertexAttribI3uiEXT = this->m_ptr_glVertexAttribI3uiEXT;this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&ProfileTableDecorator::m_glVertexAttribI3uiEXT_profile;}
+if(this->m_ptr_glLineWidthxOES){this->m_next_glLineWidthxOES = this->m_ptr_glLineWidthxOES;this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&ProfileTableDecorator::m_glLineWidthxOES_profile;}
+if(this->m_ptr_glProgramUniformMatrix2fvEXT){this->m_next_glProgramUniformMatrix2fvEXT = this->m_ptr_glProgramUniformMatrix2fvEXT;this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2fvEXT_profile;}
+if(this->m_ptr_glGetTextureParameterIuivEXT){this->m_next_glGetTextureParameterIuivEXT = this->m_ptr_glGetTextureParameterIuivEXT;this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glGetTextureParameterIuivEXT_profile;}
+if(this->m_ptr_glGetMultiTexEnvivEXT){this->m_next_glGetMultiTexEnvivEXT = this->m_ptr_glGetMultiTexEnvivEXT;this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexEnvivEXT_profile;}
+if(this->m_ptr_glPixelTexGenParameterivSGIS){this->m_next_glPixelTexGenParameterivSGIS = this->m_ptr_glPixelTexGenParameterivSGIS;this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&ProfileTableDecorator::m_glPixelTexGenParameterivSGIS_profile;}
+if(this->m_ptr_glGenQueries){this->m_next_glGenQueries = this->m_ptr_glGenQueries;this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&ProfileTableDecorator::m_glGenQueries_profile;}
+if(this->m_ptr_glGetPixelMapfv){this->m_next_glGetPixelMapfv = this->m_ptr_glGetPixelMapfv;this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&ProfileTableDecorator::m_glGetPixelMapfv_profile;}
+if(this->m_ptr_glBlendColorEXT){this->m_next_glBlendColorEXT = this->m_ptr_glBlendColorEXT;this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&ProfileTableDecorator::m_glBlendColorEXT_profile;}
+if(this->m_ptr_glResetMinmax){this->m_next_glResetMinmax = this->m_ptr_glResetMinmax;this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&ProfileTableDecorator::m_glResetMinmax_profile;}
+if(this->m_ptr_glGetnUniformivARB){this->m_next_glGetnUniformivARB = this->m_ptr_glGetnUniformivARB;this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&ProfileTableDecorator::m_glGetnUniformivARB_profile;}
+if(this->m_ptr_glVertexBlendARB){this->m_next_glVertexBlendARB = this->m_ptr_glVertexBlendARB;this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&ProfileTableDecorator::m_glVertexBlendARB_profile;}
+if(this->m_ptr_glVertexAttrib4d){this->m_next_glVertexAttrib4d = this->m_ptr_glVertexAttrib4d;this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&ProfileTableDecorator::m_glVertexAttrib4d_profile;}
+if(this->m_ptr_glGetVaryingLocationNV){this->m_next_glGetVaryingLocationNV = this->m_ptr_glGetVaryingLocationNV;this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&ProfileTableDecorator::m_glGetVaryingLocationNV_profile;}
+if(this->m_ptr_glGetMapAttribParameterivNV){this->m_next_glGetMapAttribParameterivNV = this->m_ptr_glGetMapAttribParameterivNV;this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetMapAttribParameterivNV_profile;}
+if(this->m_ptr_glTexSubImage3D){this->m_next_glTexSubImage3D = this->m_ptr_glTexSubImage3D;this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&ProfileTableDecorator::m_glTexSubImage3D_profile;}
+if(this->m_ptr_glDeleteSamplers){this->m_next_glDeleteSamplers = this->m_ptr_glDeleteSamplers;this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&ProfileTableDecorator::m_glDeleteSamplers_profile;}
+if(this->m_ptr_glGetLightxOES){this->m_next_glGetLightxOES = this->m_ptr_glGetLightxOES;this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&ProfileTableDecorator::m_glGetLightxOES_profile;}
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI){this->m_next_glGetVertexAttribArrayObjectfvATI = this->m_ptr_glGetVertexAttribArrayObjectfvATI;this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&ProfileTableDecorator::m_glGetVertexAttribArrayObjectfvATI_profile;}
+if(this->m_ptr_glVertexArrayNormalOffsetEXT){this->m_next_glVertexArrayNormalOffsetEXT = this->m_ptr_glVertexArrayNormalOffsetEXT;this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayNormalOffsetEXT_profile;}
+if(this->m_ptr_glGetBufferParameterivARB){this->m_next_glGetBufferParameterivARB = this->m_ptr_glGetBufferParameterivARB;this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&ProfileTableDecorator::m_glGetBufferParameterivARB_profile;}
+if(this->m_ptr_glGetTextureParameterfv){this->m_next_glGetTextureParameterfv = this->m_ptr_glGetTextureParameterfv;this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&ProfileTableDecorator::m_glGetTextureParameterfv_profile;}
+if(this->m_ptr_glDrawMeshArraysSUN){this->m_next_glDrawMeshArraysSUN = this->m_ptr_glDrawMeshArraysSUN;this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&ProfileTableDecorator::m_glDrawMeshArraysSUN_profile;}
+if(this->m_ptr_glVertexAttrib4dNV){this->m_next_glVertexAttrib4dNV = this->m_ptr_glVertexAttrib4dNV;this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&ProfileTableDecorator::m_glVertexAttrib4dNV_profile;}
+if(this->m_ptr_glGetMultisamplefvNV){this->m_next_glGetMultisamplefvNV = this->m_ptr_glGetMultisamplefvNV;this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&ProfileTableDecorator::m_glGetMultisamplefvNV_profile;}
+if(this->m_ptr_glMapObjectBufferATI){this->m_next_glMapObjectBufferATI = this->m_ptr_glMapObjectBufferATI;this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glMapObjectBufferATI_profile;}
+if(this->m_ptr_glGetPathCommandsNV){this->m_next_glGetPathCommandsNV = this->m_ptr_glGetPathCommandsNV;this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&ProfileTableDecorator::m_glGetPathCommandsNV_profile;}
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT){this->m_next_glVertexArrayTexCoordOffsetEXT = this->m_ptr_glVertexArrayTexCoordOffsetEXT;this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayTexCoordOffsetEXT_profile;}
+if(this->m_ptr_glGetHistogram){this->m_next_glGetHistogram = this->m_ptr_glGetHistogram;this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&ProfileTableDecorator::m_glGetHistogram_profile;}
+if(this->m_ptr_glMatrixMode){this->m_next_glMatrixMode = this->m_ptr_glMatrixMode;this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&ProfileTableDecorator::m_glMatrixMode_profile;}
+if(this->m_ptr_glColorFormatNV){this->m_next_glColorFormatNV = this->m_ptr_glColorFormatNV;this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&ProfileTableDecorator::m_glColorFormatNV_profile;}
+if(this->m_ptr_glProgramUniformui64NV){this->m_next_glProgramUniformui64NV = this->m_ptr_glProgramUniformui64NV;this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&ProfileTableDecorator::m_glProgramUniformui64NV_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT){this->m_next_glProgramUniformMatrix4x2fvEXT = this->m_ptr_glProgramUniformMatrix4x2fvEXT;this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x2fvEXT_profile;}
+if(this->m_ptr_glLoadMatrixxOES){this->m_next_glLoadMatrixxOES = this->m_ptr_glLoadMatrixxOES;this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&ProfileTableDecorator::m_glLoadMatrixxOES_profile;}
+if(this->m_ptr_glGetColorTableParameterfvEXT){this->m_next_glGetColorTableParameterfvEXT = this->m_ptr_glGetColorTableParameterfvEXT;this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetColorTableParameterfvEXT_profile;}
+if(this->m_ptr_glRasterPos4i){this->m_next_glRasterPos4i = this->m_ptr_glRasterPos4i;this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&ProfileTableDecorator::m_glRasterPos4i_profile;}
+if(this->m_ptr_glVertexAttribL2i64NV){this->m_next_glVertexAttribL2i64NV = this->m_ptr_glVertexAttribL2i64NV;this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&ProfileTableDecorator::m_glVertexAttribL2i64NV_profile;}
+if(this->m_ptr_glBindTextures){this->m_next_glBindTextures = this->m_ptr_glBindTextures;this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&ProfileTableDecorator::m_glBindTextures_profile;}
+if(this->m_ptr_glMatrixRotatefEXT){this->m_next_glMatrixRotatefEXT = this->m_ptr_glMatrixRotatefEXT;this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&ProfileTableDecorator::m_glMatrixRotatefEXT_profile;}
+if(this->m_ptr_glGetClipPlanexOES){this->m_next_glGetClipPlanexOES = this->m_ptr_glGetClipPlanexOES;this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&ProfileTableDecorator::m_glGetClipPlanexOES_profile;}
+if(this->m_ptr_glSecondaryColor3uivEXT){this->m_next_glSecondaryColor3uivEXT = this->m_ptr_glSecondaryColor3uivEXT;this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3uivEXT_profile;}
+if(this->m_ptr_glGetPerfQueryInfoINTEL){this->m_next_glGetPerfQueryInfoINTEL = this->m_ptr_glGetPerfQueryInfoINTEL;this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&ProfileTableDecorator::m_glGetPerfQueryInfoINTEL_profile;}
+if(this->m_ptr_glGetDoublev){this->m_next_glGetDoublev = this->m_ptr_glGetDoublev;this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&ProfileTableDecorator::m_glGetDoublev_profile;}
+if(this->m_ptr_glBindBufferRangeEXT){this->m_next_glBindBufferRangeEXT = this->m_ptr_glBindBufferRangeEXT;this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&ProfileTableDecorator::m_glBindBufferRangeEXT_profile;}
+if(this->m_ptr_glCompressedTexImage2D){this->m_next_glCompressedTexImage2D = this->m_ptr_glCompressedTexImage2D;this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&ProfileTableDecorator::m_glCompressedTexImage2D_profile;}
+if(this->m_ptr_glMapBufferARB){this->m_next_glMapBufferARB = this->m_ptr_glMapBufferARB;this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&ProfileTableDecorator::m_glMapBufferARB_profile;}
+if(this->m_ptr_glGetPathSpacingNV){this->m_next_glGetPathSpacingNV = this->m_ptr_glGetPathSpacingNV;this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&ProfileTableDecorator::m_glGetPathSpacingNV_profile;}
+if(this->m_ptr_glUniform4dv){this->m_next_glUniform4dv = this->m_ptr_glUniform4dv;this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&ProfileTableDecorator::m_glUniform4dv_profile;}
+if(this->m_ptr_glGlobalAlphaFactordSUN){this->m_next_glGlobalAlphaFactordSUN = this->m_ptr_glGlobalAlphaFactordSUN;this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactordSUN_profile;}
+if(this->m_ptr_glProgramUniform3dv){this->m_next_glProgramUniform3dv = this->m_ptr_glProgramUniform3dv;this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&ProfileTableDecorator::m_glProgramUniform3dv_profile;}
+if(this->m_ptr_glGetShaderSourceARB){this->m_next_glGetShaderSourceARB = this->m_ptr_glGetShaderSourceARB;this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&ProfileTableDecorator::m_glGetShaderSourceARB_profile;}
+if(this->m_ptr_glVertexAttrib3dvARB){this->m_next_glVertexAttrib3dvARB = this->m_ptr_glVertexAttrib3dvARB;this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&ProfileTableDecorator::m_glVertexAttrib3dvARB_profile;}
+if(this->m_ptr_glInvalidateBufferData){this->m_next_glInvalidateBufferData = this->m_ptr_glInvalidateBufferData;this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&ProfileTableDecorator::m_glInvalidateBufferData_profile;}
+if(this->m_ptr_glMatrixLoad3x2fNV){this->m_next_glMatrixLoad3x2fNV = this->m_ptr_glMatrixLoad3x2fNV;this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&ProfileTableDecorator::m_glMatrixLoad3x2fNV_profile;}
+if(this->m_ptr_glCompressedTextureSubImage1D){this->m_next_glCompressedTextureSubImage1D = this->m_ptr_glCompressedTextureSubImage1D;this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage1D_profile;}
+if(this->m_ptr_glTexCoord3xvOES){this->m_next_glTexCoord3xvOES = this->m_ptr_glTexCoord3xvOES;this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&ProfileTableDecorator::m_glTexCoord3xvOES_profile;}
+if(this->m_ptr_glGenTexturesEXT){this->m_next_glGenTexturesEXT = this->m_ptr_glGenTexturesEXT;this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&ProfileTableDecorator::m_glGenTexturesEXT_profile;}
+if(this->m_ptr_glTangent3iEXT){this->m_next_glTangent3iEXT = this->m_ptr_glTangent3iEXT;this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&ProfileTableDecorator::m_glTangent3iEXT_profile;}
+if(this->m_ptr_glClearTexImage){this->m_next_glClearTexImage = this->m_ptr_glClearTexImage;this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&ProfileTableDecorator::m_glClearTexImage_profile;}
+if(this->m_ptr_glBinormal3bvEXT){this->m_next_glBinormal3bvEXT = this->m_ptr_glBinormal3bvEXT;this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&ProfileTableDecorator::m_glBinormal3bvEXT_profile;}
+if(this->m_ptr_glUniform3fv){this->m_next_glUniform3fv = this->m_ptr_glUniform3fv;this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&ProfileTableDecorator::m_glUniform3fv_profile;}
+if(this->m_ptr_glGetnPixelMapusvARB){this->m_next_glGetnPixelMapusvARB = this->m_ptr_glGetnPixelMapusvARB;this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&ProfileTableDecorator::m_glGetnPixelMapusvARB_profile;}
+if(this->m_ptr_glMemoryObjectParameterivEXT){this->m_next_glMemoryObjectParameterivEXT = this->m_ptr_glMemoryObjectParameterivEXT;this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glMemoryObjectParameterivEXT_profile;}
+if(this->m_ptr_glGenSemaphoresEXT){this->m_next_glGenSemaphoresEXT = this->m_ptr_glGenSemaphoresEXT;this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&ProfileTableDecorator::m_glGenSemaphoresEXT_profile;}
+if(this->m_ptr_glMultiTexCoordP1ui){this->m_next_glMultiTexCoordP1ui = this->m_ptr_glMultiTexCoordP1ui;this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&ProfileTableDecorator::m_glMultiTexCoordP1ui_profile;}
+if(this->m_ptr_glClearNamedBufferDataEXT){this->m_next_glClearNamedBufferDataEXT = this->m_ptr_glClearNamedBufferDataEXT;this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&ProfileTableDecorator::m_glClearNamedBufferDataEXT_profile;}
+if(this->m_ptr_glUniformMatrix4dv){this->m_next_glUniformMatrix4dv = this->m_ptr_glUniformMatrix4dv;this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&ProfileTableDecorator::m_glUniformMatrix4dv_profile;}
+if(this->m_ptr_glWindowPos3fMESA){this->m_next_glWindowPos3fMESA = this->m_ptr_glWindowPos3fMESA;this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&ProfileTableDecorator::m_glWindowPos3fMESA_profile;}
+if(this->m_ptr_glDeleteRenderbuffers){this->m_next_glDeleteRenderbuffers = this->m_ptr_glDeleteRenderbuffers;this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&ProfileTableDecorator::m_glDeleteRenderbuffers_profile;}
+if(this->m_ptr_glGetTextureLevelParameterfvEXT){this->m_next_glGetTextureLevelParameterfvEXT = this->m_ptr_glGetTextureLevelParameterfvEXT;this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetTextureLevelParameterfvEXT_profile;}
+if(this->m_ptr_glGetHistogramParameterxvOES){this->m_next_glGetHistogramParameterxvOES = this->m_ptr_glGetHistogramParameterxvOES;this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&ProfileTableDecorator::m_glGetHistogramParameterxvOES_profile;}
+if(this->m_ptr_glMultiDrawElements){this->m_next_glMultiDrawElements = this->m_ptr_glMultiDrawElements;this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&ProfileTableDecorator::m_glMultiDrawElements_profile;}
+if(this->m_ptr_glMakeImageHandleNonResidentNV){this->m_next_glMakeImageHandleNonResidentNV = this->m_ptr_glMakeImageHandleNonResidentNV;this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeImageHandleNonResidentNV_profile;}
+if(this->m_ptr_glTexSubImage1DEXT){this->m_next_glTexSubImage1DEXT = this->m_ptr_glTexSubImage1DEXT;this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glTexSubImage1DEXT_profile;}
+if(this->m_ptr_glNormalStream3dATI){this->m_next_glNormalStream3dATI = this->m_ptr_glNormalStream3dATI;this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&ProfileTableDecorator::m_glNormalStream3dATI_profile;}
+if(this->m_ptr_glVertexAttribL4i64vNV){this->m_next_glVertexAttribL4i64vNV = this->m_ptr_glVertexAttribL4i64vNV;this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL4i64vNV_profile;}
+if(this->m_ptr_glDrawBuffers){this->m_next_glDrawBuffers = this->m_ptr_glDrawBuffers;this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&ProfileTableDecorator::m_glDrawBuffers_profile;}
+if(this->m_ptr_glCopyTextureSubImage1DEXT){this->m_next_glCopyTextureSubImage1DEXT = this->m_ptr_glCopyTextureSubImage1DEXT;this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyTextureSubImage1DEXT_profile;}
+if(this->m_ptr_glWindowRectanglesEXT){this->m_next_glWindowRectanglesEXT = this->m_ptr_glWindowRectanglesEXT;this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&ProfileTableDecorator::m_glWindowRectanglesEXT_profile;}
+if(this->m_ptr_glNamedFramebufferReadBuffer){this->m_next_glNamedFramebufferReadBuffer = this->m_ptr_glNamedFramebufferReadBuffer;this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&ProfileTableDecorator::m_glNamedFramebufferReadBuffer_profile;}
+if(this->m_ptr_glUniform2i64vARB){this->m_next_glUniform2i64vARB = this->m_ptr_glUniform2i64vARB;this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&ProfileTableDecorator::m_glUniform2i64vARB_profile;}
+if(this->m_ptr_glVertexAttribI1uivEXT){this->m_next_glVertexAttribI1uivEXT = this->m_ptr_glVertexAttribI1uivEXT;this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI1uivEXT_profile;}
+if(this->m_ptr_glGetTexGenfv){this->m_next_glGetTexGenfv = this->m_ptr_glGetTexGenfv;this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&ProfileTableDecorator::m_glGetTexGenfv_profile;}
+if(this->m_ptr_glBeginQueryARB){this->m_next_glBeginQueryARB = this->m_ptr_glBeginQueryARB;this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&ProfileTableDecorator::m_glBeginQueryARB_profile;}
+if(this->m_ptr_glUniform1iARB){this->m_next_glUniform1iARB = this->m_ptr_glUniform1iARB;this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&ProfileTableDecorator::m_glUniform1iARB_profile;}
+if(this->m_ptr_glVertex4bvOES){this->m_next_glVertex4bvOES = this->m_ptr_glVertex4bvOES;this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&ProfileTableDecorator::m_glVertex4bvOES_profile;}
+if(this->m_ptr_glInvalidateSubFramebuffer){this->m_next_glInvalidateSubFramebuffer = this->m_ptr_glInvalidateSubFramebuffer;this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&ProfileTableDecorator::m_glInvalidateSubFramebuffer_profile;}
+if(this->m_ptr_glUniform1fvARB){this->m_next_glUniform1fvARB = this->m_ptr_glUniform1fvARB;this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&ProfileTableDecorator::m_glUniform1fvARB_profile;}
+if(this->m_ptr_glTestFenceNV){this->m_next_glTestFenceNV = this->m_ptr_glTestFenceNV;this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&ProfileTableDecorator::m_glTestFenceNV_profile;}
+if(this->m_ptr_glBindTransformFeedback){this->m_next_glBindTransformFeedback = this->m_ptr_glBindTransformFeedback;this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glBindTransformFeedback_profile;}
+if(this->m_ptr_glMultiTexCoord2iv){this->m_next_glMultiTexCoord2iv = this->m_ptr_glMultiTexCoord2iv;this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&ProfileTableDecorator::m_glMultiTexCoord2iv_profile;}
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT){this->m_next_glCopyMultiTexSubImage1DEXT = this->m_ptr_glCopyMultiTexSubImage1DEXT;this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyMultiTexSubImage1DEXT_profile;}
+if(this->m_ptr_glVariantbvEXT){this->m_next_glVariantbvEXT = this->m_ptr_glVariantbvEXT;this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&ProfileTableDecorator::m_glVariantbvEXT_profile;}
+if(this->m_ptr_glTexCoord1hNV){this->m_next_glTexCoord1hNV = this->m_ptr_glTexCoord1hNV;this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&ProfileTableDecorator::m_glTexCoord1hNV_profile;}
+if(this->m_ptr_glGenFencesNV){this->m_next_glGenFencesNV = this->m_ptr_glGenFencesNV;this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&ProfileTableDecorator::m_glGenFencesNV_profile;}
+if(this->m_ptr_glRasterPos3iv){this->m_next_glRasterPos3iv = this->m_ptr_glRasterPos3iv;this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&ProfileTableDecorator::m_glRasterPos3iv_profile;}
+if(this->m_ptr_glVertexAttribL2ui64NV){this->m_next_glVertexAttribL2ui64NV = this->m_ptr_glVertexAttribL2ui64NV;this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&ProfileTableDecorator::m_glVertexAttribL2ui64NV_profile;}
+if(this->m_ptr_glMultiTexCoord1hvNV){this->m_next_glMultiTexCoord1hvNV = this->m_ptr_glMultiTexCoord1hvNV;this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&ProfileTableDecorator::m_glMultiTexCoord1hvNV_profile;}
+if(this->m_ptr_glGetnConvolutionFilter){this->m_next_glGetnConvolutionFilter = this->m_ptr_glGetnConvolutionFilter;this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&ProfileTableDecorator::m_glGetnConvolutionFilter_profile;}
+if(this->m_ptr_glNormal3bv){this->m_next_glNormal3bv = this->m_ptr_glNormal3bv;this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&ProfileTableDecorator::m_glNormal3bv_profile;}
+if(this->m_ptr_glWeightbvARB){this->m_next_glWeightbvARB = this->m_ptr_glWeightbvARB;this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&ProfileTableDecorator::m_glWeightbvARB_profile;}
+if(this->m_ptr_glTexCoord4sv){this->m_next_glTexCoord4sv = this->m_ptr_glTexCoord4sv;this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&ProfileTableDecorator::m_glTexCoord4sv_profile;}
+if(this->m_ptr_glUniform2uiv){this->m_next_glUniform2uiv = this->m_ptr_glUniform2uiv;this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&ProfileTableDecorator::m_glUniform2uiv_profile;}
+if(this->m_ptr_glBeginConditionalRenderNVX){this->m_next_glBeginConditionalRenderNVX = this->m_ptr_glBeginConditionalRenderNVX;this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&ProfileTableDecorator::m_glBeginConditionalRenderNVX_profile;}
+if(this->m_ptr_glFinish){this->m_next_glFinish = this->m_ptr_glFinish;this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&ProfileTableDecorator::m_glFinish_profile;}
+if(this->m_ptr_glColorTableParameterfv){this->m_next_glColorTableParameterfv = this->m_ptr_glColorTableParameterfv;this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&ProfileTableDecorator::m_glColorTableParameterfv_profile;}
+if(this->m_ptr_glFragmentCoverageColorNV){this->m_next_glFragmentCoverageColorNV = this->m_ptr_glFragmentCoverageColorNV;this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&ProfileTableDecorator::m_glFragmentCoverageColorNV_profile;}
+if(this->m_ptr_glProgramUniform3ivEXT){this->m_next_glProgramUniform3ivEXT = this->m_ptr_glProgramUniform3ivEXT;this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&ProfileTableDecorator::m_glProgramUniform3ivEXT_profile;}
+if(this->m_ptr_glVertexArrayVertexOffsetEXT){this->m_next_glVertexArrayVertexOffsetEXT = this->m_ptr_glVertexArrayVertexOffsetEXT;this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexOffsetEXT_profile;}
+if(this->m_ptr_glViewportPositionWScaleNV){this->m_next_glViewportPositionWScaleNV = this->m_ptr_glViewportPositionWScaleNV;this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&ProfileTableDecorator::m_glViewportPositionWScaleNV_profile;}
+if(this->m_ptr_glGetProgramLocalParameterIuivNV){this->m_next_glGetProgramLocalParameterIuivNV = this->m_ptr_glGetProgramLocalParameterIuivNV;this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&ProfileTableDecorator::m_glGetProgramLocalParameterIuivNV_profile;}
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN){this->m_next_glReplacementCodeuiTexCoord2fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN;this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profile;}
+if(this->m_ptr_glUniform1uiv){this->m_next_glUniform1uiv = this->m_ptr_glUniform1uiv;this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&ProfileTableDecorator::m_glUniform1uiv_profile;}
+if(this->m_ptr_glUniformMatrix2dv){this->m_next_glUniformMatrix2dv = this->m_ptr_glUniformMatrix2dv;this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&ProfileTableDecorator::m_glUniformMatrix2dv_profile;}
+if(this->m_ptr_glIndexdv){this->m_next_glIndexdv = this->m_ptr_glIndexdv;this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&ProfileTableDecorator::m_glIndexdv_profile;}
+if(this->m_ptr_glSecondaryColor3ivEXT){this->m_next_glSecondaryColor3ivEXT = this->m_ptr_glSecondaryColor3ivEXT;this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3ivEXT_profile;}
+if(this->m_ptr_glTexCoord3iv){this->m_next_glTexCoord3iv = this->m_ptr_glTexCoord3iv;this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&ProfileTableDecorator::m_glTexCoord3iv_profile;}
+if(this->m_ptr_glVertexStream4fvATI){this->m_next_glVertexStream4fvATI = this->m_ptr_glVertexStream4fvATI;this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&ProfileTableDecorator::m_glVertexStream4fvATI_profile;}
+if(this->m_ptr_glDeformationMap3fSGIX){this->m_next_glDeformationMap3fSGIX = this->m_ptr_glDeformationMap3fSGIX;this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&ProfileTableDecorator::m_glDeformationMap3fSGIX_profile;}
+if(this->m_ptr_glClearDepth){this->m_next_glClearDepth = this->m_ptr_glClearDepth;this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&ProfileTableDecorator::m_glClearDepth_profile;}
+if(this->m_ptr_glGenAsyncMarkersSGIX){this->m_next_glGenAsyncMarkersSGIX = this->m_ptr_glGenAsyncMarkersSGIX;this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&ProfileTableDecorator::m_glGenAsyncMarkersSGIX_profile;}
+if(this->m_ptr_glDisableIndexedEXT){this->m_next_glDisableIndexedEXT = this->m_ptr_glDisableIndexedEXT;this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&ProfileTableDecorator::m_glDisableIndexedEXT_profile;}
+if(this->m_ptr_glVertexWeightfvEXT){this->m_next_glVertexWeightfvEXT = this->m_ptr_glVertexWeightfvEXT;this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&ProfileTableDecorator::m_glVertexWeightfvEXT_profile;}
+if(this->m_ptr_glGetProgramLocalParameterIivNV){this->m_next_glGetProgramLocalParameterIivNV = this->m_ptr_glGetProgramLocalParameterIivNV;this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&ProfileTableDecorator::m_glGetProgramLocalParameterIivNV_profile;}
+if(this->m_ptr_glCompressedTexImage3DARB){this->m_next_glCompressedTexImage3DARB = this->m_ptr_glCompressedTexImage3DARB;this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&ProfileTableDecorator::m_glCompressedTexImage3DARB_profile;}
+if(this->m_ptr_glProgramParameter4fNV){this->m_next_glProgramParameter4fNV = this->m_ptr_glProgramParameter4fNV;this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&ProfileTableDecorator::m_glProgramParameter4fNV_profile;}
+if(this->m_ptr_glConvolutionParameterxOES){this->m_next_glConvolutionParameterxOES = this->m_ptr_glConvolutionParameterxOES;this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&ProfileTableDecorator::m_glConvolutionParameterxOES_profile;}
+if(this->m_ptr_glInsertComponentEXT){this->m_next_glInsertComponentEXT = this->m_ptr_glInsertComponentEXT;this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&ProfileTableDecorator::m_glInsertComponentEXT_profile;}
+if(this->m_ptr_glCreateTextures){this->m_next_glCreateTextures = this->m_ptr_glCreateTextures;this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&ProfileTableDecorator::m_glCreateTextures_profile;}
+if(this->m_ptr_glSecondaryColor3iv){this->m_next_glSecondaryColor3iv = this->m_ptr_glSecondaryColor3iv;this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&ProfileTableDecorator::m_glSecondaryColor3iv_profile;}
+if(this->m_ptr_glCreateBuffers){this->m_next_glCreateBuffers = this->m_ptr_glCreateBuffers;this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&ProfileTableDecorator::m_glCreateBuffers_profile;}
+if(this->m_ptr_glMultiTexCoord2xvOES){this->m_next_glMultiTexCoord2xvOES = this->m_ptr_glMultiTexCoord2xvOES;this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord2xvOES_profile;}
+if(this->m_ptr_glTexGenxvOES){this->m_next_glTexGenxvOES = this->m_ptr_glTexGenxvOES;this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&ProfileTableDecorator::m_glTexGenxvOES_profile;}
+if(this->m_ptr_glMultTransposeMatrixf){this->m_next_glMultTransposeMatrixf = this->m_ptr_glMultTransposeMatrixf;this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&ProfileTableDecorator::m_glMultTransposeMatrixf_profile;}
+if(this->m_ptr_glBeginTransformFeedbackEXT){this->m_next_glBeginTransformFeedbackEXT = this->m_ptr_glBeginTransformFeedbackEXT;this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&ProfileTableDecorator::m_glBeginTransformFeedbackEXT_profile;}
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN){this->m_next_glTexCoord2fColor3fVertex3fSUN = this->m_ptr_glTexCoord2fColor3fVertex3fSUN;this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_profile;}
+if(this->m_ptr_glNormal3sv){this->m_next_glNormal3sv = this->m_ptr_glNormal3sv;this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&ProfileTableDecorator::m_glNormal3sv_profile;}
+if(this->m_ptr_glFreeObjectBufferATI){this->m_next_glFreeObjectBufferATI = this->m_ptr_glFreeObjectBufferATI;this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glFreeObjectBufferATI_profile;}
+if(this->m_ptr_glBlendBarrierNV){this->m_next_glBlendBarrierNV = this->m_ptr_glBlendBarrierNV;this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&ProfileTableDecorator::m_glBlendBarrierNV_profile;}
+if(this->m_ptr_glUniform4i64vNV){this->m_next_glUniform4i64vNV = this->m_ptr_glUniform4i64vNV;this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&ProfileTableDecorator::m_glUniform4i64vNV_profile;}
+if(this->m_ptr_glGetnUniformuivARB){this->m_next_glGetnUniformuivARB = this->m_ptr_glGetnUniformuivARB;this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&ProfileTableDecorator::m_glGetnUniformuivARB_profile;}
+if(this->m_ptr_glAlphaFragmentOp3ATI){this->m_next_glAlphaFragmentOp3ATI = this->m_ptr_glAlphaFragmentOp3ATI;this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&ProfileTableDecorator::m_glAlphaFragmentOp3ATI_profile;}
+if(this->m_ptr_glProgramEnvParameters4fvEXT){this->m_next_glProgramEnvParameters4fvEXT = this->m_ptr_glProgramEnvParameters4fvEXT;this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&ProfileTableDecorator::m_glProgramEnvParameters4fvEXT_profile;}
+if(this->m_ptr_glBlendFuncSeparateEXT){this->m_next_glBlendFuncSeparateEXT = this->m_ptr_glBlendFuncSeparateEXT;this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&ProfileTableDecorator::m_glBlendFuncSeparateEXT_profile;}
+if(this->m_ptr_glConvolutionParameterivEXT){this->m_next_glConvolutionParameterivEXT = this->m_ptr_glConvolutionParameterivEXT;this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glConvolutionParameterivEXT_profile;}
+if(this->m_ptr_glPixelTexGenSGIX){this->m_next_glPixelTexGenSGIX = this->m_ptr_glPixelTexGenSGIX;this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&ProfileTableDecorator::m_glPixelTexGenSGIX_profile;}
+if(this->m_ptr_glDeleteProgram){this->m_next_glDeleteProgram = this->m_ptr_glDeleteProgram;this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&ProfileTableDecorator::m_glDeleteProgram_profile;}
+if(this->m_ptr_glUniformMatrix4x3dv){this->m_next_glUniformMatrix4x3dv = this->m_ptr_glUniformMatrix4x3dv;this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&ProfileTableDecorator::m_glUniformMatrix4x3dv_profile;}
+if(this->m_ptr_glGetVideoCaptureStreamivNV){this->m_next_glGetVideoCaptureStreamivNV = this->m_ptr_glGetVideoCaptureStreamivNV;this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&ProfileTableDecorator::m_glGetVideoCaptureStreamivNV_profile;}
+if(this->m_ptr_glProgramUniform4uiEXT){this->m_next_glProgramUniform4uiEXT = this->m_ptr_glProgramUniform4uiEXT;this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&ProfileTableDecorator::m_glProgramUniform4uiEXT_profile;}
+if(this->m_ptr_glMakeImageHandleNonResidentARB){this->m_next_glMakeImageHandleNonResidentARB = this->m_ptr_glMakeImageHandleNonResidentARB;this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&ProfileTableDecorator::m_glMakeImageHandleNonResidentARB_profile;}
+if(this->m_ptr_glSecondaryColor3dEXT){this->m_next_glSecondaryColor3dEXT = this->m_ptr_glSecondaryColor3dEXT;this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3dEXT_profile;}
+if(this->m_ptr_glDeleteQueries){this->m_next_glDeleteQueries = this->m_ptr_glDeleteQueries;this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&ProfileTableDecorator::m_glDeleteQueries_profile;}
+if(this->m_ptr_glNormalP3uiv){this->m_next_glNormalP3uiv = this->m_ptr_glNormalP3uiv;this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&ProfileTableDecorator::m_glNormalP3uiv_profile;}
+if(this->m_ptr_glRasterPos2d){this->m_next_glRasterPos2d = this->m_ptr_glRasterPos2d;this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&ProfileTableDecorator::m_glRasterPos2d_profile;}
+if(this->m_ptr_glInitNames){this->m_next_glInitNames = this->m_ptr_glInitNames;this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&ProfileTableDecorator::m_glInitNames_profile;}
+if(this->m_ptr_glBinormal3fvEXT){this->m_next_glBinormal3fvEXT = this->m_ptr_glBinormal3fvEXT;this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&ProfileTableDecorator::m_glBinormal3fvEXT_profile;}
+if(this->m_ptr_glColor3dv){this->m_next_glColor3dv = this->m_ptr_glColor3dv;this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&ProfileTableDecorator::m_glColor3dv_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT){this->m_next_glVertexArrayVertexAttribDivisorEXT = this->m_ptr_glVertexArrayVertexAttribDivisorEXT;this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_profile;}
+if(this->m_ptr_glArrayElementEXT){this->m_next_glArrayElementEXT = this->m_ptr_glArrayElementEXT;this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&ProfileTableDecorator::m_glArrayElementEXT_profile;}
+if(this->m_ptr_glProgramParameter4dNV){this->m_next_glProgramParameter4dNV = this->m_ptr_glProgramParameter4dNV;this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&ProfileTableDecorator::m_glProgramParameter4dNV_profile;}
+if(this->m_ptr_glIndexxOES){this->m_next_glIndexxOES = this->m_ptr_glIndexxOES;this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&ProfileTableDecorator::m_glIndexxOES_profile;}
+if(this->m_ptr_glUniform3uivEXT){this->m_next_glUniform3uivEXT = this->m_ptr_glUniform3uivEXT;this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&ProfileTableDecorator::m_glUniform3uivEXT_profile;}
+if(this->m_ptr_glPopGroupMarkerEXT){this->m_next_glPopGroupMarkerEXT = this->m_ptr_glPopGroupMarkerEXT;this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&ProfileTableDecorator::m_glPopGroupMarkerEXT_profile;}
+if(this->m_ptr_glClearNamedFramebufferuiv){this->m_next_glClearNamedFramebufferuiv = this->m_ptr_glClearNamedFramebufferuiv;this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&ProfileTableDecorator::m_glClearNamedFramebufferuiv_profile;}
+if(this->m_ptr_glSetLocalConstantEXT){this->m_next_glSetLocalConstantEXT = this->m_ptr_glSetLocalConstantEXT;this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&ProfileTableDecorator::m_glSetLocalConstantEXT_profile;}
+if(this->m_ptr_glProgramUniform1ui64NV){this->m_next_glProgramUniform1ui64NV = this->m_ptr_glProgramUniform1ui64NV;this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&ProfileTableDecorator::m_glProgramUniform1ui64NV_profile;}
+if(this->m_ptr_glColor4hvNV){this->m_next_glColor4hvNV = this->m_ptr_glColor4hvNV;this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&ProfileTableDecorator::m_glColor4hvNV_profile;}
+if(this->m_ptr_glGetVertexAttribfv){this->m_next_glGetVertexAttribfv = this->m_ptr_glGetVertexAttribfv;this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&ProfileTableDecorator::m_glGetVertexAttribfv_profile;}
+if(this->m_ptr_glDispatchCompute){this->m_next_glDispatchCompute = this->m_ptr_glDispatchCompute;this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&ProfileTableDecorator::m_glDispatchCompute_profile;}
+if(this->m_ptr_glGetActiveAttrib){this->m_next_glGetActiveAttrib = this->m_ptr_glGetActiveAttrib;this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&ProfileTableDecorator::m_glGetActiveAttrib_profile;}
+if(this->m_ptr_glFragmentColorMaterialSGIX){this->m_next_glFragmentColorMaterialSGIX = this->m_ptr_glFragmentColorMaterialSGIX;this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&ProfileTableDecorator::m_glFragmentColorMaterialSGIX_profile;}
+if(this->m_ptr_glTexSubImage2D){this->m_next_glTexSubImage2D = this->m_ptr_glTexSubImage2D;this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&ProfileTableDecorator::m_glTexSubImage2D_profile;}
+if(this->m_ptr_glGetnMinmaxARB){this->m_next_glGetnMinmaxARB = this->m_ptr_glGetnMinmaxARB;this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&ProfileTableDecorator::m_glGetnMinmaxARB_profile;}
+if(this->m_ptr_glLogicOp){this->m_next_glLogicOp = this->m_ptr_glLogicOp;this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&ProfileTableDecorator::m_glLogicOp_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x4fv){this->m_next_glProgramUniformMatrix3x4fv = this->m_ptr_glProgramUniformMatrix3x4fv;this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x4fv_profile;}
+if(this->m_ptr_glWindowPos4iMESA){this->m_next_glWindowPos4iMESA = this->m_ptr_glWindowPos4iMESA;this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&ProfileTableDecorator::m_glWindowPos4iMESA_profile;}
+if(this->m_ptr_glPixelTransferf){this->m_next_glPixelTransferf = this->m_ptr_glPixelTransferf;this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&ProfileTableDecorator::m_glPixelTransferf_profile;}
+if(this->m_ptr_glGetTextureParameterIuiv){this->m_next_glGetTextureParameterIuiv = this->m_ptr_glGetTextureParameterIuiv;this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&ProfileTableDecorator::m_glGetTextureParameterIuiv_profile;}
+if(this->m_ptr_glMultiTexCoord1xOES){this->m_next_glMultiTexCoord1xOES = this->m_ptr_glMultiTexCoord1xOES;this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&ProfileTableDecorator::m_glMultiTexCoord1xOES_profile;}
+if(this->m_ptr_glProgramUniformMatrix4dv){this->m_next_glProgramUniformMatrix4dv = this->m_ptr_glProgramUniformMatrix4dv;this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4dv_profile;}
+if(this->m_ptr_glGetnUniformiv){this->m_next_glGetnUniformiv = this->m_ptr_glGetnUniformiv;this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&ProfileTableDecorator::m_glGetnUniformiv_profile;}
+if(this->m_ptr_glFramebufferTexture1DEXT){this->m_next_glFramebufferTexture1DEXT = this->m_ptr_glFramebufferTexture1DEXT;this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&ProfileTableDecorator::m_glFramebufferTexture1DEXT_profile;}
+if(this->m_ptr_glVertexPointervINTEL){this->m_next_glVertexPointervINTEL = this->m_ptr_glVertexPointervINTEL;this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&ProfileTableDecorator::m_glVertexPointervINTEL_profile;}
+if(this->m_ptr_glTextureParameterIiv){this->m_next_glTextureParameterIiv = this->m_ptr_glTextureParameterIiv;this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&ProfileTableDecorator::m_glTextureParameterIiv_profile;}
+if(this->m_ptr_glGetSeparableFilterEXT){this->m_next_glGetSeparableFilterEXT = this->m_ptr_glGetSeparableFilterEXT;this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&ProfileTableDecorator::m_glGetSeparableFilterEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3iARB){this->m_next_glMultiTexCoord3iARB = this->m_ptr_glMultiTexCoord3iARB;this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3iARB_profile;}
+if(this->m_ptr_glRasterPos4xvOES){this->m_next_glRasterPos4xvOES = this->m_ptr_glRasterPos4xvOES;this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&ProfileTableDecorator::m_glRasterPos4xvOES_profile;}
+if(this->m_ptr_glDrawTransformFeedbackStream){this->m_next_glDrawTransformFeedbackStream = this->m_ptr_glDrawTransformFeedbackStream;this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&ProfileTableDecorator::m_glDrawTransformFeedbackStream_profile;}
+if(this->m_ptr_glVertex3hvNV){this->m_next_glVertex3hvNV = this->m_ptr_glVertex3hvNV;this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&ProfileTableDecorator::m_glVertex3hvNV_profile;}
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT){this->m_next_glVertexArrayMultiTexCoordOffsetEXT = this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT;this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_profile;}
+if(this->m_ptr_glProvokingVertex){this->m_next_glProvokingVertex = this->m_ptr_glProvokingVertex;this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&ProfileTableDecorator::m_glProvokingVertex_profile;}
+if(this->m_ptr_glAccumxOES){this->m_next_glAccumxOES = this->m_ptr_glAccumxOES;this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&ProfileTableDecorator::m_glAccumxOES_profile;}
+if(this->m_ptr_glShaderBinary){this->m_next_glShaderBinary = this->m_ptr_glShaderBinary;this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&ProfileTableDecorator::m_glShaderBinary_profile;}
+if(this->m_ptr_glGetMultiTexGenivEXT){this->m_next_glGetMultiTexGenivEXT = this->m_ptr_glGetMultiTexGenivEXT;this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexGenivEXT_profile;}
+if(this->m_ptr_glPointParameterxvOES){this->m_next_glPointParameterxvOES = this->m_ptr_glPointParameterxvOES;this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&ProfileTableDecorator::m_glPointParameterxvOES_profile;}
+if(this->m_ptr_glCreateStatesNV){this->m_next_glCreateStatesNV = this->m_ptr_glCreateStatesNV;this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&ProfileTableDecorator::m_glCreateStatesNV_profile;}
+if(this->m_ptr_glClearDepthdNV){this->m_next_glClearDepthdNV = this->m_ptr_glClearDepthdNV;this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&ProfileTableDecorator::m_glClearDepthdNV_profile;}
+if(this->m_ptr_glClearColorIuiEXT){this->m_next_glClearColorIuiEXT = this->m_ptr_glClearColorIuiEXT;this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&ProfileTableDecorator::m_glClearColorIuiEXT_profile;}
+if(this->m_ptr_glBindMultiTextureEXT){this->m_next_glBindMultiTextureEXT = this->m_ptr_glBindMultiTextureEXT;this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&ProfileTableDecorator::m_glBindMultiTextureEXT_profile;}
+if(this->m_ptr_glTexGeniv){this->m_next_glTexGeniv = this->m_ptr_glTexGeniv;this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&ProfileTableDecorator::m_glTexGeniv_profile;}
+if(this->m_ptr_glDrawElements){this->m_next_glDrawElements = this->m_ptr_glDrawElements;this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&ProfileTableDecorator::m_glDrawElements_profile;}
+if(this->m_ptr_glProgramUniform4iv){this->m_next_glProgramUniform4iv = this->m_ptr_glProgramUniform4iv;this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&ProfileTableDecorator::m_glProgramUniform4iv_profile;}
+if(this->m_ptr_glDisableVertexArrayEXT){this->m_next_glDisableVertexArrayEXT = this->m_ptr_glDisableVertexArrayEXT;this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&ProfileTableDecorator::m_glDisableVertexArrayEXT_profile;}
+if(this->m_ptr_glProgramUniform3ui64NV){this->m_next_glProgramUniform3ui64NV = this->m_ptr_glProgramUniform3ui64NV;this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&ProfileTableDecorator::m_glProgramUniform3ui64NV_profile;}
+if(this->m_ptr_glClientActiveTexture){this->m_next_glClientActiveTexture = this->m_ptr_glClientActiveTexture;this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&ProfileTableDecorator::m_glClientActiveTexture_profile;}
+if(this->m_ptr_glMultiTexParameterIivEXT){this->m_next_glMultiTexParameterIivEXT = this->m_ptr_glMultiTexParameterIivEXT;this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glMultiTexParameterIivEXT_profile;}
+if(this->m_ptr_glUniform1i64ARB){this->m_next_glUniform1i64ARB = this->m_ptr_glUniform1i64ARB;this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&ProfileTableDecorator::m_glUniform1i64ARB_profile;}
+if(this->m_ptr_glUniform1iv){this->m_next_glUniform1iv = this->m_ptr_glUniform1iv;this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&ProfileTableDecorator::m_glUniform1iv_profile;}
+if(this->m_ptr_glMulticastBarrierNV){this->m_next_glMulticastBarrierNV = this->m_ptr_glMulticastBarrierNV;this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&ProfileTableDecorator::m_glMulticastBarrierNV_profile;}
+if(this->m_ptr_glVertexAttribArrayObjectATI){this->m_next_glVertexAttribArrayObjectATI = this->m_ptr_glVertexAttribArrayObjectATI;this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&ProfileTableDecorator::m_glVertexAttribArrayObjectATI_profile;}
+if(this->m_ptr_glUniform2iARB){this->m_next_glUniform2iARB = this->m_ptr_glUniform2iARB;this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&ProfileTableDecorator::m_glUniform2iARB_profile;}
+if(this->m_ptr_glDrawArraysInstanced){this->m_next_glDrawArraysInstanced = this->m_ptr_glDrawArraysInstanced;this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&ProfileTableDecorator::m_glDrawArraysInstanced_profile;}
+if(this->m_ptr_glVertexAttrib2sNV){this->m_next_glVertexAttrib2sNV = this->m_ptr_glVertexAttrib2sNV;this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&ProfileTableDecorator::m_glVertexAttrib2sNV_profile;}
+if(this->m_ptr_glTexBufferEXT){this->m_next_glTexBufferEXT = this->m_ptr_glTexBufferEXT;this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&ProfileTableDecorator::m_glTexBufferEXT_profile;}
+if(this->m_ptr_glVertexStream2fATI){this->m_next_glVertexStream2fATI = this->m_ptr_glVertexStream2fATI;this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&ProfileTableDecorator::m_glVertexStream2fATI_profile;}
+if(this->m_ptr_glDebugMessageCallbackAMD){this->m_next_glDebugMessageCallbackAMD = this->m_ptr_glDebugMessageCallbackAMD;this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&ProfileTableDecorator::m_glDebugMessageCallbackAMD_profile;}
+if(this->m_ptr_glSamplerParameteriv){this->m_next_glSamplerParameteriv = this->m_ptr_glSamplerParameteriv;this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&ProfileTableDecorator::m_glSamplerParameteriv_profile;}
+if(this->m_ptr_glVertexAttrib4uiv){this->m_next_glVertexAttrib4uiv = this->m_ptr_glVertexAttrib4uiv;this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&ProfileTableDecorator::m_glVertexAttrib4uiv_profile;}
+if(this->m_ptr_glEndQueryIndexed){this->m_next_glEndQueryIndexed = this->m_ptr_glEndQueryIndexed;this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&ProfileTableDecorator::m_glEndQueryIndexed_profile;}
+if(this->m_ptr_glNormalStream3sATI){this->m_next_glNormalStream3sATI = this->m_ptr_glNormalStream3sATI;this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&ProfileTableDecorator::m_glNormalStream3sATI_profile;}
+if(this->m_ptr_glProgramParameteriARB){this->m_next_glProgramParameteriARB = this->m_ptr_glProgramParameteriARB;this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&ProfileTableDecorator::m_glProgramParameteriARB_profile;}
+if(this->m_ptr_glTexEnvxOES){this->m_next_glTexEnvxOES = this->m_ptr_glTexEnvxOES;this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&ProfileTableDecorator::m_glTexEnvxOES_profile;}
+if(this->m_ptr_glProgramUniform1iv){this->m_next_glProgramUniform1iv = this->m_ptr_glProgramUniform1iv;this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&ProfileTableDecorator::m_glProgramUniform1iv_profile;}
+if(this->m_ptr_glDisableVertexAttribAPPLE){this->m_next_glDisableVertexAttribAPPLE = this->m_ptr_glDisableVertexAttribAPPLE;this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&ProfileTableDecorator::m_glDisableVertexAttribAPPLE_profile;}
+if(this->m_ptr_glBindRenderbuffer){this->m_next_glBindRenderbuffer = this->m_ptr_glBindRenderbuffer;this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&ProfileTableDecorator::m_glBindRenderbuffer_profile;}
+if(this->m_ptr_glMultiTexSubImage3DEXT){this->m_next_glMultiTexSubImage3DEXT = this->m_ptr_glMultiTexSubImage3DEXT;this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&ProfileTableDecorator::m_glMultiTexSubImage3DEXT_profile;}
+if(this->m_ptr_glIsProgram){this->m_next_glIsProgram = this->m_ptr_glIsProgram;this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&ProfileTableDecorator::m_glIsProgram_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirectAMD){this->m_next_glMultiDrawElementsIndirectAMD = this->m_ptr_glMultiDrawElementsIndirectAMD;this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirectAMD_profile;}
+if(this->m_ptr_glGetProgramInfoLog){this->m_next_glGetProgramInfoLog = this->m_ptr_glGetProgramInfoLog;this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&ProfileTableDecorator::m_glGetProgramInfoLog_profile;}
+if(this->m_ptr_glGetLocalConstantBooleanvEXT){this->m_next_glGetLocalConstantBooleanvEXT = this->m_ptr_glGetLocalConstantBooleanvEXT;this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&ProfileTableDecorator::m_glGetLocalConstantBooleanvEXT_profile;}
+if(this->m_ptr_glPixelTransformParameteriEXT){this->m_next_glPixelTransformParameteriEXT = this->m_ptr_glPixelTransformParameteriEXT;this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&ProfileTableDecorator::m_glPixelTransformParameteriEXT_profile;}
+if(this->m_ptr_glTexCoord4bOES){this->m_next_glTexCoord4bOES = this->m_ptr_glTexCoord4bOES;this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&ProfileTableDecorator::m_glTexCoord4bOES_profile;}
+if(this->m_ptr_glVertexAttrib4fv){this->m_next_glVertexAttrib4fv = this->m_ptr_glVertexAttrib4fv;this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&ProfileTableDecorator::m_glVertexAttrib4fv_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x3dv){this->m_next_glProgramUniformMatrix2x3dv = this->m_ptr_glProgramUniformMatrix2x3dv;this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x3dv_profile;}
+if(this->m_ptr_glProgramEnvParametersI4uivNV){this->m_next_glProgramEnvParametersI4uivNV = this->m_ptr_glProgramEnvParametersI4uivNV;this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&ProfileTableDecorator::m_glProgramEnvParametersI4uivNV_profile;}
+if(this->m_ptr_glTexCoord3xOES){this->m_next_glTexCoord3xOES = this->m_ptr_glTexCoord3xOES;this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&ProfileTableDecorator::m_glTexCoord3xOES_profile;}
+if(this->m_ptr_glLoadTransposeMatrixfARB){this->m_next_glLoadTransposeMatrixfARB = this->m_ptr_glLoadTransposeMatrixfARB;this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&ProfileTableDecorator::m_glLoadTransposeMatrixfARB_profile;}
+if(this->m_ptr_glImageTransformParameteriHP){this->m_next_glImageTransformParameteriHP = this->m_ptr_glImageTransformParameteriHP;this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&ProfileTableDecorator::m_glImageTransformParameteriHP_profile;}
+if(this->m_ptr_glMultiTexCoord4xOES){this->m_next_glMultiTexCoord4xOES = this->m_ptr_glMultiTexCoord4xOES;this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&ProfileTableDecorator::m_glMultiTexCoord4xOES_profile;}
+if(this->m_ptr_glVertexAttribs3fvNV){this->m_next_glVertexAttribs3fvNV = this->m_ptr_glVertexAttribs3fvNV;this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&ProfileTableDecorator::m_glVertexAttribs3fvNV_profile;}
+if(this->m_ptr_glVertexAttrib2fv){this->m_next_glVertexAttrib2fv = this->m_ptr_glVertexAttrib2fv;this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&ProfileTableDecorator::m_glVertexAttrib2fv_profile;}
+if(this->m_ptr_glUniform3ui64NV){this->m_next_glUniform3ui64NV = this->m_ptr_glUniform3ui64NV;this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&ProfileTableDecorator::m_glUniform3ui64NV_profile;}
+if(this->m_ptr_glCombinerParameterfvNV){this->m_next_glCombinerParameterfvNV = this->m_ptr_glCombinerParameterfvNV;this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&ProfileTableDecorator::m_glCombinerParameterfvNV_profile;}
+if(this->m_ptr_glFragmentMaterialiSGIX){this->m_next_glFragmentMaterialiSGIX = this->m_ptr_glFragmentMaterialiSGIX;this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&ProfileTableDecorator::m_glFragmentMaterialiSGIX_profile;}
+if(this->m_ptr_glGetBooleani_v){this->m_next_glGetBooleani_v = this->m_ptr_glGetBooleani_v;this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&ProfileTableDecorator::m_glGetBooleani_v_profile;}
+if(this->m_ptr_glGetProgramResourceIndex){this->m_next_glGetProgramResourceIndex = this->m_ptr_glGetProgramResourceIndex;this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&ProfileTableDecorator::m_glGetProgramResourceIndex_profile;}
+if(this->m_ptr_glBeginConditionalRenderNV){this->m_next_glBeginConditionalRenderNV = this->m_ptr_glBeginConditionalRenderNV;this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&ProfileTableDecorator::m_glBeginConditionalRenderNV_profile;}
+if(this->m_ptr_glDisableClientState){this->m_next_glDisableClientState = this->m_ptr_glDisableClientState;this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&ProfileTableDecorator::m_glDisableClientState_profile;}
+if(this->m_ptr_glPathFogGenNV){this->m_next_glPathFogGenNV = this->m_ptr_glPathFogGenNV;this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&ProfileTableDecorator::m_glPathFogGenNV_profile;}
+if(this->m_ptr_glStencilThenCoverFillPathNV){this->m_next_glStencilThenCoverFillPathNV = this->m_ptr_glStencilThenCoverFillPathNV;this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&ProfileTableDecorator::m_glStencilThenCoverFillPathNV_profile;}
+if(this->m_ptr_glVertexArrayIndexOffsetEXT){this->m_next_glVertexArrayIndexOffsetEXT = this->m_ptr_glVertexArrayIndexOffsetEXT;this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayIndexOffsetEXT_profile;}
+if(this->m_ptr_glProgramBufferParametersIuivNV){this->m_next_glProgramBufferParametersIuivNV = this->m_ptr_glProgramBufferParametersIuivNV;this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&ProfileTableDecorator::m_glProgramBufferParametersIuivNV_profile;}
+if(this->m_ptr_glPixelTransformParameterivEXT){this->m_next_glPixelTransformParameterivEXT = this->m_ptr_glPixelTransformParameterivEXT;this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glPixelTransformParameterivEXT_profile;}
+if(this->m_ptr_glDisableClientStateiEXT){this->m_next_glDisableClientStateiEXT = this->m_ptr_glDisableClientStateiEXT;this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&ProfileTableDecorator::m_glDisableClientStateiEXT_profile;}
+if(this->m_ptr_glTexBufferARB){this->m_next_glTexBufferARB = this->m_ptr_glTexBufferARB;this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&ProfileTableDecorator::m_glTexBufferARB_profile;}
+if(this->m_ptr_glGetLocalConstantIntegervEXT){this->m_next_glGetLocalConstantIntegervEXT = this->m_ptr_glGetLocalConstantIntegervEXT;this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&ProfileTableDecorator::m_glGetLocalConstantIntegervEXT_profile;}
+if(this->m_ptr_glColor4uiv){this->m_next_glColor4uiv = this->m_ptr_glColor4uiv;this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&ProfileTableDecorator::m_glColor4uiv_profile;}
+if(this->m_ptr_glProgramUniform3i){this->m_next_glProgramUniform3i = this->m_ptr_glProgramUniform3i;this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&ProfileTableDecorator::m_glProgramUniform3i_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV){this->m_next_glMultiDrawElementsIndirectBindlessCountNV = this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV;this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_profile;}
+if(this->m_ptr_glGetBufferPointervARB){this->m_next_glGetBufferPointervARB = this->m_ptr_glGetBufferPointervARB;this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&ProfileTableDecorator::m_glGetBufferPointervARB_profile;}
+if(this->m_ptr_glMultiTexParameterIuivEXT){this->m_next_glMultiTexParameterIuivEXT = this->m_ptr_glMultiTexParameterIuivEXT;this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glMultiTexParameterIuivEXT_profile;}
+if(this->m_ptr_glEvalMesh2){this->m_next_glEvalMesh2 = this->m_ptr_glEvalMesh2;this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&ProfileTableDecorator::m_glEvalMesh2_profile;}
+if(this->m_ptr_glEvalMesh1){this->m_next_glEvalMesh1 = this->m_ptr_glEvalMesh1;this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&ProfileTableDecorator::m_glEvalMesh1_profile;}
+if(this->m_ptr_glProgramUniform3f){this->m_next_glProgramUniform3f = this->m_ptr_glProgramUniform3f;this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&ProfileTableDecorator::m_glProgramUniform3f_profile;}
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV){this->m_next_glStencilThenCoverFillPathInstancedNV = this->m_ptr_glStencilThenCoverFillPathInstancedNV;this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glStencilThenCoverFillPathInstancedNV_profile;}
+if(this->m_ptr_glProgramUniform3d){this->m_next_glProgramUniform3d = this->m_ptr_glProgramUniform3d;this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&ProfileTableDecorator::m_glProgramUniform3d_profile;}
+if(this->m_ptr_glMapVertexAttrib1dAPPLE){this->m_next_glMapVertexAttrib1dAPPLE = this->m_ptr_glMapVertexAttrib1dAPPLE;this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&ProfileTableDecorator::m_glMapVertexAttrib1dAPPLE_profile;}
+if(this->m_ptr_glEvalCoord2fv){this->m_next_glEvalCoord2fv = this->m_ptr_glEvalCoord2fv;this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&ProfileTableDecorator::m_glEvalCoord2fv_profile;}
+if(this->m_ptr_glGetUniformivARB){this->m_next_glGetUniformivARB = this->m_ptr_glGetUniformivARB;this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&ProfileTableDecorator::m_glGetUniformivARB_profile;}
+if(this->m_ptr_glLoadTransposeMatrixd){this->m_next_glLoadTransposeMatrixd = this->m_ptr_glLoadTransposeMatrixd;this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&ProfileTableDecorator::m_glLoadTransposeMatrixd_profile;}
+if(this->m_ptr_glLoadTransposeMatrixf){this->m_next_glLoadTransposeMatrixf = this->m_ptr_glLoadTransposeMatrixf;this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&ProfileTableDecorator::m_glLoadTransposeMatrixf_profile;}
+if(this->m_ptr_glGetPointervEXT){this->m_next_glGetPointervEXT = this->m_ptr_glGetPointervEXT;this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&ProfileTableDecorator::m_glGetPointervEXT_profile;}
+if(this->m_ptr_glSignalVkSemaphoreNV){this->m_next_glSignalVkSemaphoreNV = this->m_ptr_glSignalVkSemaphoreNV;this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&ProfileTableDecorator::m_glSignalVkSemaphoreNV_profile;}
+if(this->m_ptr_glEndConditionalRenderNV){this->m_next_glEndConditionalRenderNV = this->m_ptr_glEndConditionalRenderNV;this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&ProfileTableDecorator::m_glEndConditionalRenderNV_profile;}
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN){this->m_next_glTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glUniform3i64vARB){this->m_next_glUniform3i64vARB = this->m_ptr_glUniform3i64vARB;this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&ProfileTableDecorator::m_glUniform3i64vARB_profile;}
+if(this->m_ptr_glProgramUniform2uiEXT){this->m_next_glProgramUniform2uiEXT = this->m_ptr_glProgramUniform2uiEXT;this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&ProfileTableDecorator::m_glProgramUniform2uiEXT_profile;}
+if(this->m_ptr_glVertexAttribI1ui){this->m_next_glVertexAttribI1ui = this->m_ptr_glVertexAttribI1ui;this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&ProfileTableDecorator::m_glVertexAttribI1ui_profile;}
+if(this->m_ptr_glProgramNamedParameter4dvNV){this->m_next_glProgramNamedParameter4dvNV = this->m_ptr_glProgramNamedParameter4dvNV;this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&ProfileTableDecorator::m_glProgramNamedParameter4dvNV_profile;}
+if(this->m_ptr_glCompileCommandListNV){this->m_next_glCompileCommandListNV = this->m_ptr_glCompileCommandListNV;this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&ProfileTableDecorator::m_glCompileCommandListNV_profile;}
+if(this->m_ptr_glGetRenderbufferParameterivEXT){this->m_next_glGetRenderbufferParameterivEXT = this->m_ptr_glGetRenderbufferParameterivEXT;this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetRenderbufferParameterivEXT_profile;}
+if(this->m_ptr_glGetnPolygonStipple){this->m_next_glGetnPolygonStipple = this->m_ptr_glGetnPolygonStipple;this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&ProfileTableDecorator::m_glGetnPolygonStipple_profile;}
+if(this->m_ptr_glIsBufferResidentNV){this->m_next_glIsBufferResidentNV = this->m_ptr_glIsBufferResidentNV;this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&ProfileTableDecorator::m_glIsBufferResidentNV_profile;}
+if(this->m_ptr_glSecondaryColor3ubvEXT){this->m_next_glSecondaryColor3ubvEXT = this->m_ptr_glSecondaryColor3ubvEXT;this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3ubvEXT_profile;}
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT){this->m_next_glGetNamedRenderbufferParameterivEXT = this->m_ptr_glGetNamedRenderbufferParameterivEXT;this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetNamedRenderbufferParameterivEXT_profile;}
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB){this->m_next_glNamedFramebufferSampleLocationsfvARB = this->m_ptr_glNamedFramebufferSampleLocationsfvARB;this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfileTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_profile;}
+if(this->m_ptr_glMultiTexGendvEXT){this->m_next_glMultiTexGendvEXT = this->m_ptr_glMultiTexGendvEXT;this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&ProfileTableDecorator::m_glMultiTexGendvEXT_profile;}
+if(this->m_ptr_glVertexArrayRangeNV){this->m_next_glVertexArrayRangeNV = this->m_ptr_glVertexArrayRangeNV;this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&ProfileTableDecorator::m_glVertexArrayRangeNV_profile;}
+if(this->m_ptr_glIsTextureHandleResidentNV){this->m_next_glIsTextureHandleResidentNV = this->m_ptr_glIsTextureHandleResidentNV;this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&ProfileTableDecorator::m_glIsTextureHandleResidentNV_profile;}
+if(this->m_ptr_glGetProgramEnvParameterdvARB){this->m_next_glGetProgramEnvParameterdvARB = this->m_ptr_glGetProgramEnvParameterdvARB;this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&ProfileTableDecorator::m_glGetProgramEnvParameterdvARB_profile;}
+if(this->m_ptr_glIsNamedStringARB){this->m_next_glIsNamedStringARB = this->m_ptr_glIsNamedStringARB;this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&ProfileTableDecorator::m_glIsNamedStringARB_profile;}
+if(this->m_ptr_glSecondaryColorFormatNV){this->m_next_glSecondaryColorFormatNV = this->m_ptr_glSecondaryColorFormatNV;this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&ProfileTableDecorator::m_glSecondaryColorFormatNV_profile;}
+if(this->m_ptr_glVertexAttrib4ubvNV){this->m_next_glVertexAttrib4ubvNV = this->m_ptr_glVertexAttrib4ubvNV;this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&ProfileTableDecorator::m_glVertexAttrib4ubvNV_profile;}
+if(this->m_ptr_glTagSampleBufferSGIX){this->m_next_glTagSampleBufferSGIX = this->m_ptr_glTagSampleBufferSGIX;this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&ProfileTableDecorator::m_glTagSampleBufferSGIX_profile;}
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV){this->m_next_glVDPAUUnregisterSurfaceNV = this->m_ptr_glVDPAUUnregisterSurfaceNV;this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&ProfileTableDecorator::m_glVDPAUUnregisterSurfaceNV_profile;}
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL){this->m_next_glGetPerfQueryIdByNameINTEL = this->m_ptr_glGetPerfQueryIdByNameINTEL;this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&ProfileTableDecorator::m_glGetPerfQueryIdByNameINTEL_profile;}
+if(this->m_ptr_glGetInteger64v){this->m_next_glGetInteger64v = this->m_ptr_glGetInteger64v;this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&ProfileTableDecorator::m_glGetInteger64v_profile;}
+if(this->m_ptr_glClipPlane){this->m_next_glClipPlane = this->m_ptr_glClipPlane;this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&ProfileTableDecorator::m_glClipPlane_profile;}
+if(this->m_ptr_glColor4ubVertex3fSUN){this->m_next_glColor4ubVertex3fSUN = this->m_ptr_glColor4ubVertex3fSUN;this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&ProfileTableDecorator::m_glColor4ubVertex3fSUN_profile;}
+if(this->m_ptr_glIndexub){this->m_next_glIndexub = this->m_ptr_glIndexub;this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&ProfileTableDecorator::m_glIndexub_profile;}
+if(this->m_ptr_glGetProgramEnvParameterfvARB){this->m_next_glGetProgramEnvParameterfvARB = this->m_ptr_glGetProgramEnvParameterfvARB;this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&ProfileTableDecorator::m_glGetProgramEnvParameterfvARB_profile;}
+if(this->m_ptr_glVertexAttrib4usvARB){this->m_next_glVertexAttrib4usvARB = this->m_ptr_glVertexAttrib4usvARB;this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4usvARB_profile;}
+if(this->m_ptr_glNamedFramebufferRenderbuffer){this->m_next_glNamedFramebufferRenderbuffer = this->m_ptr_glNamedFramebufferRenderbuffer;this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&ProfileTableDecorator::m_glNamedFramebufferRenderbuffer_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x4dv){this->m_next_glProgramUniformMatrix3x4dv = this->m_ptr_glProgramUniformMatrix3x4dv;this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x4dv_profile;}
+if(this->m_ptr_glTestFenceAPPLE){this->m_next_glTestFenceAPPLE = this->m_ptr_glTestFenceAPPLE;this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&ProfileTableDecorator::m_glTestFenceAPPLE_profile;}
+if(this->m_ptr_glVertexAttrib4Niv){this->m_next_glVertexAttrib4Niv = this->m_ptr_glVertexAttrib4Niv;this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&ProfileTableDecorator::m_glVertexAttrib4Niv_profile;}
+if(this->m_ptr_glVertexAttribL2i64vNV){this->m_next_glVertexAttribL2i64vNV = this->m_ptr_glVertexAttribL2i64vNV;this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL2i64vNV_profile;}
+if(this->m_ptr_glColorP4uiv){this->m_next_glColorP4uiv = this->m_ptr_glColorP4uiv;this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&ProfileTableDecorator::m_glColorP4uiv_profile;}
+if(this->m_ptr_glUniformMatrix2x3fv){this->m_next_glUniformMatrix2x3fv = this->m_ptr_glUniformMatrix2x3fv;this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&ProfileTableDecorator::m_glUniformMatrix2x3fv_profile;}
+if(this->m_ptr_glCallCommandListNV){this->m_next_glCallCommandListNV = this->m_ptr_glCallCommandListNV;this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&ProfileTableDecorator::m_glCallCommandListNV_profile;}
+if(this->m_ptr_glClearBufferiv){this->m_next_glClearBufferiv = this->m_ptr_glClearBufferiv;this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&ProfileTableDecorator::m_glClearBufferiv_profile;}
+if(this->m_ptr_glNamedStringARB){this->m_next_glNamedStringARB = this->m_ptr_glNamedStringARB;this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&ProfileTableDecorator::m_glNamedStringARB_profile;}
+if(this->m_ptr_glMatrixMult3x2fNV){this->m_next_glMatrixMult3x2fNV = this->m_ptr_glMatrixMult3x2fNV;this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&ProfileTableDecorator::m_glMatrixMult3x2fNV_profile;}
+if(this->m_ptr_glGetNamedProgramStringEXT){this->m_next_glGetNamedProgramStringEXT = this->m_ptr_glGetNamedProgramStringEXT;this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramStringEXT_profile;}
+if(this->m_ptr_glGetnHistogramARB){this->m_next_glGetnHistogramARB = this->m_ptr_glGetnHistogramARB;this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&ProfileTableDecorator::m_glGetnHistogramARB_profile;}
+if(this->m_ptr_glGetTextureLevelParameterfv){this->m_next_glGetTextureLevelParameterfv = this->m_ptr_glGetTextureLevelParameterfv;this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&ProfileTableDecorator::m_glGetTextureLevelParameterfv_profile;}
+if(this->m_ptr_glMultiTexCoord1fv){this->m_next_glMultiTexCoord1fv = this->m_ptr_glMultiTexCoord1fv;this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&ProfileTableDecorator::m_glMultiTexCoord1fv_profile;}
+if(this->m_ptr_glBitmapxOES){this->m_next_glBitmapxOES = this->m_ptr_glBitmapxOES;this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&ProfileTableDecorator::m_glBitmapxOES_profile;}
+if(this->m_ptr_glGetSamplerParameterIuiv){this->m_next_glGetSamplerParameterIuiv = this->m_ptr_glGetSamplerParameterIuiv;this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&ProfileTableDecorator::m_glGetSamplerParameterIuiv_profile;}
+if(this->m_ptr_glTexCoordP3ui){this->m_next_glTexCoordP3ui = this->m_ptr_glTexCoordP3ui;this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&ProfileTableDecorator::m_glTexCoordP3ui_profile;}
+if(this->m_ptr_glTextureSubImage1D){this->m_next_glTextureSubImage1D = this->m_ptr_glTextureSubImage1D;this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&ProfileTableDecorator::m_glTextureSubImage1D_profile;}
+if(this->m_ptr_glVertexAttribLPointerEXT){this->m_next_glVertexAttribLPointerEXT = this->m_ptr_glVertexAttribLPointerEXT;this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&ProfileTableDecorator::m_glVertexAttribLPointerEXT_profile;}
+if(this->m_ptr_glFogCoordPointerEXT){this->m_next_glFogCoordPointerEXT = this->m_ptr_glFogCoordPointerEXT;this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&ProfileTableDecorator::m_glFogCoordPointerEXT_profile;}
+if(this->m_ptr_glWindowPos3s){this->m_next_glWindowPos3s = this->m_ptr_glWindowPos3s;this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&ProfileTableDecorator::m_glWindowPos3s_profile;}
+if(this->m_ptr_glVertexAttribs2svNV){this->m_next_glVertexAttribs2svNV = this->m_ptr_glVertexAttribs2svNV;this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&ProfileTableDecorator::m_glVertexAttribs2svNV_profile;}
+if(this->m_ptr_glTextureImage3DEXT){this->m_next_glTextureImage3DEXT = this->m_ptr_glTextureImage3DEXT;this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&ProfileTableDecorator::m_glTextureImage3DEXT_profile;}
+if(this->m_ptr_glWindowPos3i){this->m_next_glWindowPos3i = this->m_ptr_glWindowPos3i;this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&ProfileTableDecorator::m_glWindowPos3i_profile;}
+if(this->m_ptr_glWindowPos3d){this->m_next_glWindowPos3d = this->m_ptr_glWindowPos3d;this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&ProfileTableDecorator::m_glWindowPos3d_profile;}
+if(this->m_ptr_glWindowPos3f){this->m_next_glWindowPos3f = this->m_ptr_glWindowPos3f;this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&ProfileTableDecorator::m_glWindowPos3f_profile;}
+if(this->m_ptr_glIsEnabledIndexedEXT){this->m_next_glIsEnabledIndexedEXT = this->m_ptr_glIsEnabledIndexedEXT;this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&ProfileTableDecorator::m_glIsEnabledIndexedEXT_profile;}
+if(this->m_ptr_glGetNamedProgramivEXT){this->m_next_glGetNamedProgramivEXT = this->m_ptr_glGetNamedProgramivEXT;this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramivEXT_profile;}
+if(this->m_ptr_glVertex3xvOES){this->m_next_glVertex3xvOES = this->m_ptr_glVertex3xvOES;this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&ProfileTableDecorator::m_glVertex3xvOES_profile;}
+if(this->m_ptr_glColor3us){this->m_next_glColor3us = this->m_ptr_glColor3us;this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&ProfileTableDecorator::m_glColor3us_profile;}
+if(this->m_ptr_glBeginPerfMonitorAMD){this->m_next_glBeginPerfMonitorAMD = this->m_ptr_glBeginPerfMonitorAMD;this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&ProfileTableDecorator::m_glBeginPerfMonitorAMD_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x3dv){this->m_next_glProgramUniformMatrix4x3dv = this->m_ptr_glProgramUniformMatrix4x3dv;this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x3dv_profile;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT){this->m_next_glGetNamedProgramLocalParameterIuivEXT = this->m_ptr_glGetNamedProgramLocalParameterIuivEXT;this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_profile;}
+if(this->m_ptr_glReadnPixels){this->m_next_glReadnPixels = this->m_ptr_glReadnPixels;this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&ProfileTableDecorator::m_glReadnPixels_profile;}
+if(this->m_ptr_glMultiTexCoord4f){this->m_next_glMultiTexCoord4f = this->m_ptr_glMultiTexCoord4f;this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&ProfileTableDecorator::m_glMultiTexCoord4f_profile;}
+if(this->m_ptr_glColor3ub){this->m_next_glColor3ub = this->m_ptr_glColor3ub;this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&ProfileTableDecorator::m_glColor3ub_profile;}
+if(this->m_ptr_glMultiTexCoord4d){this->m_next_glMultiTexCoord4d = this->m_ptr_glMultiTexCoord4d;this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&ProfileTableDecorator::m_glMultiTexCoord4d_profile;}
+if(this->m_ptr_glVertexAttribL3ui64NV){this->m_next_glVertexAttribL3ui64NV = this->m_ptr_glVertexAttribL3ui64NV;this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&ProfileTableDecorator::m_glVertexAttribL3ui64NV_profile;}
+if(this->m_ptr_glColor3ui){this->m_next_glColor3ui = this->m_ptr_glColor3ui;this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&ProfileTableDecorator::m_glColor3ui_profile;}
+if(this->m_ptr_glProgramUniform4fvEXT){this->m_next_glProgramUniform4fvEXT = this->m_ptr_glProgramUniform4fvEXT;this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&ProfileTableDecorator::m_glProgramUniform4fvEXT_profile;}
+if(this->m_ptr_glVertexAttrib2sARB){this->m_next_glVertexAttrib2sARB = this->m_ptr_glVertexAttrib2sARB;this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&ProfileTableDecorator::m_glVertexAttrib2sARB_profile;}
+if(this->m_ptr_glMultiTexCoord4i){this->m_next_glMultiTexCoord4i = this->m_ptr_glMultiTexCoord4i;this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&ProfileTableDecorator::m_glMultiTexCoord4i_profile;}
+if(this->m_ptr_glCheckFramebufferStatusEXT){this->m_next_glCheckFramebufferStatusEXT = this->m_ptr_glCheckFramebufferStatusEXT;this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&ProfileTableDecorator::m_glCheckFramebufferStatusEXT_profile;}
+if(this->m_ptr_glGetnMapivARB){this->m_next_glGetnMapivARB = this->m_ptr_glGetnMapivARB;this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&ProfileTableDecorator::m_glGetnMapivARB_profile;}
+if(this->m_ptr_glMultiTexCoord1ivARB){this->m_next_glMultiTexCoord1ivARB = this->m_ptr_glMultiTexCoord1ivARB;this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1ivARB_profile;}
+if(this->m_ptr_glDisableVertexAttribArrayARB){this->m_next_glDisableVertexAttribArrayARB = this->m_ptr_glDisableVertexAttribArrayARB;this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&ProfileTableDecorator::m_glDisableVertexAttribArrayARB_profile;}
+if(this->m_ptr_glGetPolygonStipple){this->m_next_glGetPolygonStipple = this->m_ptr_glGetPolygonStipple;this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&ProfileTableDecorator::m_glGetPolygonStipple_profile;}
+if(this->m_ptr_glVertexAttribI4ui){this->m_next_glVertexAttribI4ui = this->m_ptr_glVertexAttribI4ui;this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&ProfileTableDecorator::m_glVertexAttribI4ui_profile;}
+if(this->m_ptr_glGetPathDashArrayNV){this->m_next_glGetPathDashArrayNV = this->m_ptr_glGetPathDashArrayNV;this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&ProfileTableDecorator::m_glGetPathDashArrayNV_profile;}
+if(this->m_ptr_glMultiTexRenderbufferEXT){this->m_next_glMultiTexRenderbufferEXT = this->m_ptr_glMultiTexRenderbufferEXT;this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glMultiTexRenderbufferEXT_profile;}
+if(this->m_ptr_glCopyTextureSubImage1D){this->m_next_glCopyTextureSubImage1D = this->m_ptr_glCopyTextureSubImage1D;this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&ProfileTableDecorator::m_glCopyTextureSubImage1D_profile;}
+if(this->m_ptr_glDeleteOcclusionQueriesNV){this->m_next_glDeleteOcclusionQueriesNV = this->m_ptr_glDeleteOcclusionQueriesNV;this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&ProfileTableDecorator::m_glDeleteOcclusionQueriesNV_profile;}
+if(this->m_ptr_glVertex4hvNV){this->m_next_glVertex4hvNV = this->m_ptr_glVertex4hvNV;this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&ProfileTableDecorator::m_glVertex4hvNV_profile;}
+if(this->m_ptr_glGetnTexImage){this->m_next_glGetnTexImage = this->m_ptr_glGetnTexImage;this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&ProfileTableDecorator::m_glGetnTexImage_profile;}
+if(this->m_ptr_glProgramLocalParameter4dARB){this->m_next_glProgramLocalParameter4dARB = this->m_ptr_glProgramLocalParameter4dARB;this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&ProfileTableDecorator::m_glProgramLocalParameter4dARB_profile;}
+if(this->m_ptr_glBlendEquation){this->m_next_glBlendEquation = this->m_ptr_glBlendEquation;this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&ProfileTableDecorator::m_glBlendEquation_profile;}
+if(this->m_ptr_glUnlockArraysEXT){this->m_next_glUnlockArraysEXT = this->m_ptr_glUnlockArraysEXT;this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&ProfileTableDecorator::m_glUnlockArraysEXT_profile;}
+if(this->m_ptr_glGetQueryObjectui64vEXT){this->m_next_glGetQueryObjectui64vEXT = this->m_ptr_glGetQueryObjectui64vEXT;this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&ProfileTableDecorator::m_glGetQueryObjectui64vEXT_profile;}
+if(this->m_ptr_glVertexAttribI4uivEXT){this->m_next_glVertexAttribI4uivEXT = this->m_ptr_glVertexAttribI4uivEXT;this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4uivEXT_profile;}
+if(this->m_ptr_glUniform1i64vNV){this->m_next_glUniform1i64vNV = this->m_ptr_glUniform1i64vNV;this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&ProfileTableDecorator::m_glUniform1i64vNV_profile;}
+if(this->m_ptr_glMultiTexCoord3dv){this->m_next_glMultiTexCoord3dv = this->m_ptr_glMultiTexCoord3dv;this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&ProfileTableDecorator::m_glMultiTexCoord3dv_profile;}
+if(this->m_ptr_glColor4sv){this->m_next_glColor4sv = this->m_ptr_glColor4sv;this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&ProfileTableDecorator::m_glColor4sv_profile;}
+if(this->m_ptr_glVertexStream4ivATI){this->m_next_glVertexStream4ivATI = this->m_ptr_glVertexStream4ivATI;this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&ProfileTableDecorator::m_glVertexStream4ivATI_profile;}
+if(this->m_ptr_glPopClientAttrib){this->m_next_glPopClientAttrib = this->m_ptr_glPopClientAttrib;this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&ProfileTableDecorator::m_glPopClientAttrib_profile;}
+if(this->m_ptr_glClearBufferData){this->m_next_glClearBufferData = this->m_ptr_glClearBufferData;this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&ProfileTableDecorator::m_glClearBufferData_profile;}
+if(this->m_ptr_glGetProgramivNV){this->m_next_glGetProgramivNV = this->m_ptr_glGetProgramivNV;this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&ProfileTableDecorator::m_glGetProgramivNV_profile;}
+if(this->m_ptr_glBeginTransformFeedback){this->m_next_glBeginTransformFeedback = this->m_ptr_glBeginTransformFeedback;this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glBeginTransformFeedback_profile;}
+if(this->m_ptr_glFinishObjectAPPLE){this->m_next_glFinishObjectAPPLE = this->m_ptr_glFinishObjectAPPLE;this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&ProfileTableDecorator::m_glFinishObjectAPPLE_profile;}
+if(this->m_ptr_glGetMinmaxParameterivEXT){this->m_next_glGetMinmaxParameterivEXT = this->m_ptr_glGetMinmaxParameterivEXT;this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetMinmaxParameterivEXT_profile;}
+if(this->m_ptr_glColor3iv){this->m_next_glColor3iv = this->m_ptr_glColor3iv;this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&ProfileTableDecorator::m_glColor3iv_profile;}
+if(this->m_ptr_glVertexAttrib3sv){this->m_next_glVertexAttrib3sv = this->m_ptr_glVertexAttrib3sv;this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&ProfileTableDecorator::m_glVertexAttrib3sv_profile;}
+if(this->m_ptr_glCompressedTexImage1D){this->m_next_glCompressedTexImage1D = this->m_ptr_glCompressedTexImage1D;this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&ProfileTableDecorator::m_glCompressedTexImage1D_profile;}
+if(this->m_ptr_glDeleteTransformFeedbacks){this->m_next_glDeleteTransformFeedbacks = this->m_ptr_glDeleteTransformFeedbacks;this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&ProfileTableDecorator::m_glDeleteTransformFeedbacks_profile;}
+if(this->m_ptr_glGetVideoi64vNV){this->m_next_glGetVideoi64vNV = this->m_ptr_glGetVideoi64vNV;this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&ProfileTableDecorator::m_glGetVideoi64vNV_profile;}
+if(this->m_ptr_glDrawRangeElementsBaseVertex){this->m_next_glDrawRangeElementsBaseVertex = this->m_ptr_glDrawRangeElementsBaseVertex;this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&ProfileTableDecorator::m_glDrawRangeElementsBaseVertex_profile;}
+if(this->m_ptr_glUniform4i64vARB){this->m_next_glUniform4i64vARB = this->m_ptr_glUniform4i64vARB;this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&ProfileTableDecorator::m_glUniform4i64vARB_profile;}
+if(this->m_ptr_glTextureStorage3DMultisampleEXT){this->m_next_glTextureStorage3DMultisampleEXT = this->m_ptr_glTextureStorage3DMultisampleEXT;this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTextureStorage3DMultisampleEXT_profile;}
+if(this->m_ptr_glGetTexParameterfv){this->m_next_glGetTexParameterfv = this->m_ptr_glGetTexParameterfv;this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&ProfileTableDecorator::m_glGetTexParameterfv_profile;}
+if(this->m_ptr_glProgramUniformui64vNV){this->m_next_glProgramUniformui64vNV = this->m_ptr_glProgramUniformui64vNV;this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&ProfileTableDecorator::m_glProgramUniformui64vNV_profile;}
+if(this->m_ptr_glCompressedMultiTexImage1DEXT){this->m_next_glCompressedMultiTexImage1DEXT = this->m_ptr_glCompressedMultiTexImage1DEXT;this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexImage1DEXT_profile;}
+if(this->m_ptr_glProgramUniform2ivEXT){this->m_next_glProgramUniform2ivEXT = this->m_ptr_glProgramUniform2ivEXT;this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&ProfileTableDecorator::m_glProgramUniform2ivEXT_profile;}
+if(this->m_ptr_glPushGroupMarkerEXT){this->m_next_glPushGroupMarkerEXT = this->m_ptr_glPushGroupMarkerEXT;this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&ProfileTableDecorator::m_glPushGroupMarkerEXT_profile;}
+if(this->m_ptr_glVertexAttrib1dv){this->m_next_glVertexAttrib1dv = this->m_ptr_glVertexAttrib1dv;this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&ProfileTableDecorator::m_glVertexAttrib1dv_profile;}
+if(this->m_ptr_glMatrixLoadIdentityEXT){this->m_next_glMatrixLoadIdentityEXT = this->m_ptr_glMatrixLoadIdentityEXT;this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&ProfileTableDecorator::m_glMatrixLoadIdentityEXT_profile;}
+if(this->m_ptr_glMultTransposeMatrixxOES){this->m_next_glMultTransposeMatrixxOES = this->m_ptr_glMultTransposeMatrixxOES;this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&ProfileTableDecorator::m_glMultTransposeMatrixxOES_profile;}
+if(this->m_ptr_glGetPixelMapxv){this->m_next_glGetPixelMapxv = this->m_ptr_glGetPixelMapxv;this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&ProfileTableDecorator::m_glGetPixelMapxv_profile;}
+if(this->m_ptr_glFramebufferSampleLocationsfvARB){this->m_next_glFramebufferSampleLocationsfvARB = this->m_ptr_glFramebufferSampleLocationsfvARB;this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfileTableDecorator::m_glFramebufferSampleLocationsfvARB_profile;}
+if(this->m_ptr_glGetLightiv){this->m_next_glGetLightiv = this->m_ptr_glGetLightiv;this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&ProfileTableDecorator::m_glGetLightiv_profile;}
+if(this->m_ptr_glBlendFuncSeparatei){this->m_next_glBlendFuncSeparatei = this->m_ptr_glBlendFuncSeparatei;this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&ProfileTableDecorator::m_glBlendFuncSeparatei_profile;}
+if(this->m_ptr_glAcquireKeyedMutexWin32EXT){this->m_next_glAcquireKeyedMutexWin32EXT = this->m_ptr_glAcquireKeyedMutexWin32EXT;this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&ProfileTableDecorator::m_glAcquireKeyedMutexWin32EXT_profile;}
+if(this->m_ptr_glGetBooleanIndexedvEXT){this->m_next_glGetBooleanIndexedvEXT = this->m_ptr_glGetBooleanIndexedvEXT;this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&ProfileTableDecorator::m_glGetBooleanIndexedvEXT_profile;}
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV){this->m_next_glGetProgramSubroutineParameteruivNV = this->m_ptr_glGetProgramSubroutineParameteruivNV;this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&ProfileTableDecorator::m_glGetProgramSubroutineParameteruivNV_profile;}
+if(this->m_ptr_glUniform2ui){this->m_next_glUniform2ui = this->m_ptr_glUniform2ui;this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&ProfileTableDecorator::m_glUniform2ui_profile;}
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL){this->m_next_glApplyFramebufferAttachmentCMAAINTEL = this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL;this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&ProfileTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_profile;}
+if(this->m_ptr_glWindowPos2fv){this->m_next_glWindowPos2fv = this->m_ptr_glWindowPos2fv;this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&ProfileTableDecorator::m_glWindowPos2fv_profile;}
+if(this->m_ptr_glWaitVkSemaphoreNV){this->m_next_glWaitVkSemaphoreNV = this->m_ptr_glWaitVkSemaphoreNV;this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&ProfileTableDecorator::m_glWaitVkSemaphoreNV_profile;}
+if(this->m_ptr_glDisablei){this->m_next_glDisablei = this->m_ptr_glDisablei;this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&ProfileTableDecorator::m_glDisablei_profile;}
+if(this->m_ptr_glSelectPerfMonitorCountersAMD){this->m_next_glSelectPerfMonitorCountersAMD = this->m_ptr_glSelectPerfMonitorCountersAMD;this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&ProfileTableDecorator::m_glSelectPerfMonitorCountersAMD_profile;}
+if(this->m_ptr_glGetVertexAttribLi64vNV){this->m_next_glGetVertexAttribLi64vNV = this->m_ptr_glGetVertexAttribLi64vNV;this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&ProfileTableDecorator::m_glGetVertexAttribLi64vNV_profile;}
+if(this->m_ptr_glBlendFuncSeparateiARB){this->m_next_glBlendFuncSeparateiARB = this->m_ptr_glBlendFuncSeparateiARB;this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&ProfileTableDecorator::m_glBlendFuncSeparateiARB_profile;}
+if(this->m_ptr_glWeightuivARB){this->m_next_glWeightuivARB = this->m_ptr_glWeightuivARB;this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&ProfileTableDecorator::m_glWeightuivARB_profile;}
+if(this->m_ptr_glWindowPos2iARB){this->m_next_glWindowPos2iARB = this->m_ptr_glWindowPos2iARB;this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&ProfileTableDecorator::m_glWindowPos2iARB_profile;}
+if(this->m_ptr_glGetProgramLocalParameterdvARB){this->m_next_glGetProgramLocalParameterdvARB = this->m_ptr_glGetProgramLocalParameterdvARB;this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&ProfileTableDecorator::m_glGetProgramLocalParameterdvARB_profile;}
+if(this->m_ptr_glGetUniformui64vARB){this->m_next_glGetUniformui64vARB = this->m_ptr_glGetUniformui64vARB;this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&ProfileTableDecorator::m_glGetUniformui64vARB_profile;}
+if(this->m_ptr_glSecondaryColor3us){this->m_next_glSecondaryColor3us = this->m_ptr_glSecondaryColor3us;this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&ProfileTableDecorator::m_glSecondaryColor3us_profile;}
+if(this->m_ptr_glGetSynciv){this->m_next_glGetSynciv = this->m_ptr_glGetSynciv;this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&ProfileTableDecorator::m_glGetSynciv_profile;}
+if(this->m_ptr_glMakeImageHandleResidentARB){this->m_next_glMakeImageHandleResidentARB = this->m_ptr_glMakeImageHandleResidentARB;this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&ProfileTableDecorator::m_glMakeImageHandleResidentARB_profile;}
+if(this->m_ptr_glGetProgramNamedParameterfvNV){this->m_next_glGetProgramNamedParameterfvNV = this->m_ptr_glGetProgramNamedParameterfvNV;this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetProgramNamedParameterfvNV_profile;}
+if(this->m_ptr_glTextureStorage3D){this->m_next_glTextureStorage3D = this->m_ptr_glTextureStorage3D;this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&ProfileTableDecorator::m_glTextureStorage3D_profile;}
+if(this->m_ptr_glVertexAttrib4svNV){this->m_next_glVertexAttrib4svNV = this->m_ptr_glVertexAttrib4svNV;this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&ProfileTableDecorator::m_glVertexAttrib4svNV_profile;}
+if(this->m_ptr_glProgramUniform2i){this->m_next_glProgramUniform2i = this->m_ptr_glProgramUniform2i;this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&ProfileTableDecorator::m_glProgramUniform2i_profile;}
+if(this->m_ptr_glListDrawCommandsStatesClientNV){this->m_next_glListDrawCommandsStatesClientNV = this->m_ptr_glListDrawCommandsStatesClientNV;this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&ProfileTableDecorator::m_glListDrawCommandsStatesClientNV_profile;}
+if(this->m_ptr_glProgramLocalParametersI4uivNV){this->m_next_glProgramLocalParametersI4uivNV = this->m_ptr_glProgramLocalParametersI4uivNV;this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&ProfileTableDecorator::m_glProgramLocalParametersI4uivNV_profile;}
+if(this->m_ptr_glBeginTransformFeedbackNV){this->m_next_glBeginTransformFeedbackNV = this->m_ptr_glBeginTransformFeedbackNV;this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glBeginTransformFeedbackNV_profile;}
+if(this->m_ptr_glGetProgramBinary){this->m_next_glGetProgramBinary = this->m_ptr_glGetProgramBinary;this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&ProfileTableDecorator::m_glGetProgramBinary_profile;}
+if(this->m_ptr_glBinormal3iEXT){this->m_next_glBinormal3iEXT = this->m_ptr_glBinormal3iEXT;this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&ProfileTableDecorator::m_glBinormal3iEXT_profile;}
+if(this->m_ptr_glEvalPoint1){this->m_next_glEvalPoint1 = this->m_ptr_glEvalPoint1;this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&ProfileTableDecorator::m_glEvalPoint1_profile;}
+if(this->m_ptr_glEvalPoint2){this->m_next_glEvalPoint2 = this->m_ptr_glEvalPoint2;this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&ProfileTableDecorator::m_glEvalPoint2_profile;}
+if(this->m_ptr_glPauseTransformFeedback){this->m_next_glPauseTransformFeedback = this->m_ptr_glPauseTransformFeedback;this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glPauseTransformFeedback_profile;}
+if(this->m_ptr_glWindowPos2sMESA){this->m_next_glWindowPos2sMESA = this->m_ptr_glWindowPos2sMESA;this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&ProfileTableDecorator::m_glWindowPos2sMESA_profile;}
+if(this->m_ptr_glGlobalAlphaFactorbSUN){this->m_next_glGlobalAlphaFactorbSUN = this->m_ptr_glGlobalAlphaFactorbSUN;this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactorbSUN_profile;}
+if(this->m_ptr_glCreateTransformFeedbacks){this->m_next_glCreateTransformFeedbacks = this->m_ptr_glCreateTransformFeedbacks;this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&ProfileTableDecorator::m_glCreateTransformFeedbacks_profile;}
+if(this->m_ptr_glTexturePageCommitmentEXT){this->m_next_glTexturePageCommitmentEXT = this->m_ptr_glTexturePageCommitmentEXT;this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&ProfileTableDecorator::m_glTexturePageCommitmentEXT_profile;}
+if(this->m_ptr_glTransformFeedbackVaryingsNV){this->m_next_glTransformFeedbackVaryingsNV = this->m_ptr_glTransformFeedbackVaryingsNV;this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&ProfileTableDecorator::m_glTransformFeedbackVaryingsNV_profile;}
+if(this->m_ptr_glTexSubImage1D){this->m_next_glTexSubImage1D = this->m_ptr_glTexSubImage1D;this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&ProfileTableDecorator::m_glTexSubImage1D_profile;}
+if(this->m_ptr_glConvolutionParameterfvEXT){this->m_next_glConvolutionParameterfvEXT = this->m_ptr_glConvolutionParameterfvEXT;this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glConvolutionParameterfvEXT_profile;}
+if(this->m_ptr_glBlitFramebufferEXT){this->m_next_glBlitFramebufferEXT = this->m_ptr_glBlitFramebufferEXT;this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&ProfileTableDecorator::m_glBlitFramebufferEXT_profile;}
+if(this->m_ptr_glUniformMatrix4fvARB){this->m_next_glUniformMatrix4fvARB = this->m_ptr_glUniformMatrix4fvARB;this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&ProfileTableDecorator::m_glUniformMatrix4fvARB_profile;}
+if(this->m_ptr_glProgramEnvParameter4dvARB){this->m_next_glProgramEnvParameter4dvARB = this->m_ptr_glProgramEnvParameter4dvARB;this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&ProfileTableDecorator::m_glProgramEnvParameter4dvARB_profile;}
+if(this->m_ptr_glTextureStorageMem2DEXT){this->m_next_glTextureStorageMem2DEXT = this->m_ptr_glTextureStorageMem2DEXT;this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&ProfileTableDecorator::m_glTextureStorageMem2DEXT_profile;}
+if(this->m_ptr_glVertexAttribP3uiv){this->m_next_glVertexAttribP3uiv = this->m_ptr_glVertexAttribP3uiv;this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&ProfileTableDecorator::m_glVertexAttribP3uiv_profile;}
+if(this->m_ptr_glFogCoordFormatNV){this->m_next_glFogCoordFormatNV = this->m_ptr_glFogCoordFormatNV;this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&ProfileTableDecorator::m_glFogCoordFormatNV_profile;}
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT){this->m_next_glGetMultiTexLevelParameterivEXT = this->m_ptr_glGetMultiTexLevelParameterivEXT;this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetMultiTexLevelParameterivEXT_profile;}
+if(this->m_ptr_glIsOcclusionQueryNV){this->m_next_glIsOcclusionQueryNV = this->m_ptr_glIsOcclusionQueryNV;this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&ProfileTableDecorator::m_glIsOcclusionQueryNV_profile;}
+if(this->m_ptr_glCompressedTexImage2DARB){this->m_next_glCompressedTexImage2DARB = this->m_ptr_glCompressedTexImage2DARB;this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&ProfileTableDecorator::m_glCompressedTexImage2DARB_profile;}
+if(this->m_ptr_glGetProgramEnvParameterIuivNV){this->m_next_glGetProgramEnvParameterIuivNV = this->m_ptr_glGetProgramEnvParameterIuivNV;this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&ProfileTableDecorator::m_glGetProgramEnvParameterIuivNV_profile;}
+if(this->m_ptr_glVertexAttrib4sv){this->m_next_glVertexAttrib4sv = this->m_ptr_glVertexAttrib4sv;this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&ProfileTableDecorator::m_glVertexAttrib4sv_profile;}
+if(this->m_ptr_glVertexAttrib4fvARB){this->m_next_glVertexAttrib4fvARB = this->m_ptr_glVertexAttrib4fvARB;this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4fvARB_profile;}
+if(this->m_ptr_glLoadName){this->m_next_glLoadName = this->m_ptr_glLoadName;this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&ProfileTableDecorator::m_glLoadName_profile;}
+if(this->m_ptr_glBindVertexShaderEXT){this->m_next_glBindVertexShaderEXT = this->m_ptr_glBindVertexShaderEXT;this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&ProfileTableDecorator::m_glBindVertexShaderEXT_profile;}
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT){this->m_next_glGetNamedProgramLocalParameterIivEXT = this->m_ptr_glGetNamedProgramLocalParameterIivEXT;this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_profile;}
+if(this->m_ptr_glProgramUniform3uiEXT){this->m_next_glProgramUniform3uiEXT = this->m_ptr_glProgramUniform3uiEXT;this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&ProfileTableDecorator::m_glProgramUniform3uiEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT){this->m_next_glProgramUniformMatrix4x2dvEXT = this->m_ptr_glProgramUniformMatrix4x2dvEXT;this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x2dvEXT_profile;}
+if(this->m_ptr_glTexCoord1hvNV){this->m_next_glTexCoord1hvNV = this->m_ptr_glTexCoord1hvNV;this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&ProfileTableDecorator::m_glTexCoord1hvNV_profile;}
+if(this->m_ptr_glLoadMatrixd){this->m_next_glLoadMatrixd = this->m_ptr_glLoadMatrixd;this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&ProfileTableDecorator::m_glLoadMatrixd_profile;}
+if(this->m_ptr_glTexParameterfv){this->m_next_glTexParameterfv = this->m_ptr_glTexParameterfv;this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&ProfileTableDecorator::m_glTexParameterfv_profile;}
+if(this->m_ptr_glVariantdvEXT){this->m_next_glVariantdvEXT = this->m_ptr_glVariantdvEXT;this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&ProfileTableDecorator::m_glVariantdvEXT_profile;}
+if(this->m_ptr_glCullParameterfvEXT){this->m_next_glCullParameterfvEXT = this->m_ptr_glCullParameterfvEXT;this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glCullParameterfvEXT_profile;}
+if(this->m_ptr_glUniform3dv){this->m_next_glUniform3dv = this->m_ptr_glUniform3dv;this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&ProfileTableDecorator::m_glUniform3dv_profile;}
+if(this->m_ptr_glProgramUniform3fv){this->m_next_glProgramUniform3fv = this->m_ptr_glProgramUniform3fv;this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&ProfileTableDecorator::m_glProgramUniform3fv_profile;}
+if(this->m_ptr_glIsBufferARB){this->m_next_glIsBufferARB = this->m_ptr_glIsBufferARB;this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&ProfileTableDecorator::m_glIsBufferARB_profile;}
+if(this->m_ptr_glMultiTexCoord1bOES){this->m_next_glMultiTexCoord1bOES = this->m_ptr_glMultiTexCoord1bOES;this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&ProfileTableDecorator::m_glMultiTexCoord1bOES_profile;}
+if(this->m_ptr_glFogCoordhNV){this->m_next_glFogCoordhNV = this->m_ptr_glFogCoordhNV;this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&ProfileTableDecorator::m_glFogCoordhNV_profile;}
+if(this->m_ptr_glFramebufferSampleLocationsfvNV){this->m_next_glFramebufferSampleLocationsfvNV = this->m_ptr_glFramebufferSampleLocationsfvNV;this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfileTableDecorator::m_glFramebufferSampleLocationsfvNV_profile;}
+if(this->m_ptr_glGenSymbolsEXT){this->m_next_glGenSymbolsEXT = this->m_ptr_glGenSymbolsEXT;this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&ProfileTableDecorator::m_glGenSymbolsEXT_profile;}
+if(this->m_ptr_glGetConvolutionFilter){this->m_next_glGetConvolutionFilter = this->m_ptr_glGetConvolutionFilter;this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&ProfileTableDecorator::m_glGetConvolutionFilter_profile;}
+if(this->m_ptr_glProgramUniform1fvEXT){this->m_next_glProgramUniform1fvEXT = this->m_ptr_glProgramUniform1fvEXT;this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&ProfileTableDecorator::m_glProgramUniform1fvEXT_profile;}
+if(this->m_ptr_glGetNextPerfQueryIdINTEL){this->m_next_glGetNextPerfQueryIdINTEL = this->m_ptr_glGetNextPerfQueryIdINTEL;this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&ProfileTableDecorator::m_glGetNextPerfQueryIdINTEL_profile;}
+if(this->m_ptr_glCompressedTexImage1DARB){this->m_next_glCompressedTexImage1DARB = this->m_ptr_glCompressedTexImage1DARB;this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&ProfileTableDecorator::m_glCompressedTexImage1DARB_profile;}
+if(this->m_ptr_glBindSamplers){this->m_next_glBindSamplers = this->m_ptr_glBindSamplers;this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&ProfileTableDecorator::m_glBindSamplers_profile;}
+if(this->m_ptr_glGetProgramEnvParameterIivNV){this->m_next_glGetProgramEnvParameterIivNV = this->m_ptr_glGetProgramEnvParameterIivNV;this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&ProfileTableDecorator::m_glGetProgramEnvParameterIivNV_profile;}
+if(this->m_ptr_glGetQueryObjectui64v){this->m_next_glGetQueryObjectui64v = this->m_ptr_glGetQueryObjectui64v;this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&ProfileTableDecorator::m_glGetQueryObjectui64v_profile;}
+if(this->m_ptr_glVertexAttribL4ui64vNV){this->m_next_glVertexAttribL4ui64vNV = this->m_ptr_glVertexAttribL4ui64vNV;this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&ProfileTableDecorator::m_glVertexAttribL4ui64vNV_profile;}
+if(this->m_ptr_glGetVideoivNV){this->m_next_glGetVideoivNV = this->m_ptr_glGetVideoivNV;this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&ProfileTableDecorator::m_glGetVideoivNV_profile;}
+if(this->m_ptr_glGetTextureImage){this->m_next_glGetTextureImage = this->m_ptr_glGetTextureImage;this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&ProfileTableDecorator::m_glGetTextureImage_profile;}
+if(this->m_ptr_glProgramUniform1fv){this->m_next_glProgramUniform1fv = this->m_ptr_glProgramUniform1fv;this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&ProfileTableDecorator::m_glProgramUniform1fv_profile;}
+if(this->m_ptr_glUniformMatrix4fv){this->m_next_glUniformMatrix4fv = this->m_ptr_glUniformMatrix4fv;this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&ProfileTableDecorator::m_glUniformMatrix4fv_profile;}
+if(this->m_ptr_glColorMask){this->m_next_glColorMask = this->m_ptr_glColorMask;this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&ProfileTableDecorator::m_glColorMask_profile;}
+if(this->m_ptr_glBeginFragmentShaderATI){this->m_next_glBeginFragmentShaderATI = this->m_ptr_glBeginFragmentShaderATI;this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&ProfileTableDecorator::m_glBeginFragmentShaderATI_profile;}
+if(this->m_ptr_glMultiDrawArraysEXT){this->m_next_glMultiDrawArraysEXT = this->m_ptr_glMultiDrawArraysEXT;this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&ProfileTableDecorator::m_glMultiDrawArraysEXT_profile;}
+if(this->m_ptr_glGenNamesAMD){this->m_next_glGenNamesAMD = this->m_ptr_glGenNamesAMD;this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&ProfileTableDecorator::m_glGenNamesAMD_profile;}
+if(this->m_ptr_glPathParameteriNV){this->m_next_glPathParameteriNV = this->m_ptr_glPathParameteriNV;this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&ProfileTableDecorator::m_glPathParameteriNV_profile;}
+if(this->m_ptr_glCreateCommandListsNV){this->m_next_glCreateCommandListsNV = this->m_ptr_glCreateCommandListsNV;this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&ProfileTableDecorator::m_glCreateCommandListsNV_profile;}
+if(this->m_ptr_glDeleteProgramPipelines){this->m_next_glDeleteProgramPipelines = this->m_ptr_glDeleteProgramPipelines;this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&ProfileTableDecorator::m_glDeleteProgramPipelines_profile;}
+if(this->m_ptr_glCopyColorSubTableEXT){this->m_next_glCopyColorSubTableEXT = this->m_ptr_glCopyColorSubTableEXT;this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&ProfileTableDecorator::m_glCopyColorSubTableEXT_profile;}
+if(this->m_ptr_glVariantsvEXT){this->m_next_glVariantsvEXT = this->m_ptr_glVariantsvEXT;this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&ProfileTableDecorator::m_glVariantsvEXT_profile;}
+if(this->m_ptr_glGenProgramPipelines){this->m_next_glGenProgramPipelines = this->m_ptr_glGenProgramPipelines;this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&ProfileTableDecorator::m_glGenProgramPipelines_profile;}
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT){this->m_next_glVertexArrayEdgeFlagOffsetEXT = this->m_ptr_glVertexArrayEdgeFlagOffsetEXT;this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_profile;}
+if(this->m_ptr_glWindowPos2s){this->m_next_glWindowPos2s = this->m_ptr_glWindowPos2s;this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&ProfileTableDecorator::m_glWindowPos2s_profile;}
+if(this->m_ptr_glSecondaryColor3iEXT){this->m_next_glSecondaryColor3iEXT = this->m_ptr_glSecondaryColor3iEXT;this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3iEXT_profile;}
+if(this->m_ptr_glWindowPos2i){this->m_next_glWindowPos2i = this->m_ptr_glWindowPos2i;this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&ProfileTableDecorator::m_glWindowPos2i_profile;}
+if(this->m_ptr_glWindowPos2f){this->m_next_glWindowPos2f = this->m_ptr_glWindowPos2f;this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&ProfileTableDecorator::m_glWindowPos2f_profile;}
+if(this->m_ptr_glWindowPos2d){this->m_next_glWindowPos2d = this->m_ptr_glWindowPos2d;this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&ProfileTableDecorator::m_glWindowPos2d_profile;}
+if(this->m_ptr_glUniform4uivEXT){this->m_next_glUniform4uivEXT = this->m_ptr_glUniform4uivEXT;this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&ProfileTableDecorator::m_glUniform4uivEXT_profile;}
+if(this->m_ptr_glOrthoxOES){this->m_next_glOrthoxOES = this->m_ptr_glOrthoxOES;this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&ProfileTableDecorator::m_glOrthoxOES_profile;}
+if(this->m_ptr_glUniformSubroutinesuiv){this->m_next_glUniformSubroutinesuiv = this->m_ptr_glUniformSubroutinesuiv;this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&ProfileTableDecorator::m_glUniformSubroutinesuiv_profile;}
+if(this->m_ptr_glRectdv){this->m_next_glRectdv = this->m_ptr_glRectdv;this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&ProfileTableDecorator::m_glRectdv_profile;}
+if(this->m_ptr_glProgramUniform1i64vNV){this->m_next_glProgramUniform1i64vNV = this->m_ptr_glProgramUniform1i64vNV;this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&ProfileTableDecorator::m_glProgramUniform1i64vNV_profile;}
+if(this->m_ptr_glVertexAttribI4uiEXT){this->m_next_glVertexAttribI4uiEXT = this->m_ptr_glVertexAttribI4uiEXT;this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4uiEXT_profile;}
+if(this->m_ptr_glSecondaryColor3ubEXT){this->m_next_glSecondaryColor3ubEXT = this->m_ptr_glSecondaryColor3ubEXT;this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3ubEXT_profile;}
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT){this->m_next_glCompressedMultiTexSubImage1DEXT = this->m_ptr_glCompressedMultiTexSubImage1DEXT;this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexSubImage1DEXT_profile;}
+if(this->m_ptr_glMultiTexGendEXT){this->m_next_glMultiTexGendEXT = this->m_ptr_glMultiTexGendEXT;this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&ProfileTableDecorator::m_glMultiTexGendEXT_profile;}
+if(this->m_ptr_glColorP3uiv){this->m_next_glColorP3uiv = this->m_ptr_glColorP3uiv;this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&ProfileTableDecorator::m_glColorP3uiv_profile;}
+if(this->m_ptr_glFogCoordfv){this->m_next_glFogCoordfv = this->m_ptr_glFogCoordfv;this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&ProfileTableDecorator::m_glFogCoordfv_profile;}
+if(this->m_ptr_glCompileShader){this->m_next_glCompileShader = this->m_ptr_glCompileShader;this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&ProfileTableDecorator::m_glCompileShader_profile;}
+if(this->m_ptr_glTexCoord2hNV){this->m_next_glTexCoord2hNV = this->m_ptr_glTexCoord2hNV;this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&ProfileTableDecorator::m_glTexCoord2hNV_profile;}
+if(this->m_ptr_glUniform1uivEXT){this->m_next_glUniform1uivEXT = this->m_ptr_glUniform1uivEXT;this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&ProfileTableDecorator::m_glUniform1uivEXT_profile;}
+if(this->m_ptr_glMatrixLoadTransposedEXT){this->m_next_glMatrixLoadTransposedEXT = this->m_ptr_glMatrixLoadTransposedEXT;this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&ProfileTableDecorator::m_glMatrixLoadTransposedEXT_profile;}
+if(this->m_ptr_glIndexfv){this->m_next_glIndexfv = this->m_ptr_glIndexfv;this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&ProfileTableDecorator::m_glIndexfv_profile;}
+if(this->m_ptr_glGetCompressedTextureImage){this->m_next_glGetCompressedTextureImage = this->m_ptr_glGetCompressedTextureImage;this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&ProfileTableDecorator::m_glGetCompressedTextureImage_profile;}
+if(this->m_ptr_glGetUniformuivEXT){this->m_next_glGetUniformuivEXT = this->m_ptr_glGetUniformuivEXT;this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&ProfileTableDecorator::m_glGetUniformuivEXT_profile;}
+if(this->m_ptr_glGetnPixelMapfvARB){this->m_next_glGetnPixelMapfvARB = this->m_ptr_glGetnPixelMapfvARB;this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&ProfileTableDecorator::m_glGetnPixelMapfvARB_profile;}
+if(this->m_ptr_glFramebufferTextureEXT){this->m_next_glFramebufferTextureEXT = this->m_ptr_glFramebufferTextureEXT;this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&ProfileTableDecorator::m_glFramebufferTextureEXT_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirectCount){this->m_next_glMultiDrawElementsIndirectCount = this->m_ptr_glMultiDrawElementsIndirectCount;this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirectCount_profile;}
+if(this->m_ptr_glVertexAttribIPointer){this->m_next_glVertexAttribIPointer = this->m_ptr_glVertexAttribIPointer;this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&ProfileTableDecorator::m_glVertexAttribIPointer_profile;}
+if(this->m_ptr_glMultiTexCoordP3ui){this->m_next_glMultiTexCoordP3ui = this->m_ptr_glMultiTexCoordP3ui;this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&ProfileTableDecorator::m_glMultiTexCoordP3ui_profile;}
+if(this->m_ptr_glEvaluateDepthValuesARB){this->m_next_glEvaluateDepthValuesARB = this->m_ptr_glEvaluateDepthValuesARB;this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&ProfileTableDecorator::m_glEvaluateDepthValuesARB_profile;}
+if(this->m_ptr_glGetNamedBufferParameteriv){this->m_next_glGetNamedBufferParameteriv = this->m_ptr_glGetNamedBufferParameteriv;this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetNamedBufferParameteriv_profile;}
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT){this->m_next_glGetNamedProgramLocalParameterfvEXT = this->m_ptr_glGetNamedProgramLocalParameterfvEXT;this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_profile;}
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN){this->m_next_glColor4fNormal3fVertex3fvSUN = this->m_ptr_glColor4fNormal3fVertex3fvSUN;this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glColor4fNormal3fVertex3fvSUN_profile;}
+if(this->m_ptr_glSeparableFilter2DEXT){this->m_next_glSeparableFilter2DEXT = this->m_ptr_glSeparableFilter2DEXT;this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&ProfileTableDecorator::m_glSeparableFilter2DEXT_profile;}
+if(this->m_ptr_glTexParameterxOES){this->m_next_glTexParameterxOES = this->m_ptr_glTexParameterxOES;this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&ProfileTableDecorator::m_glTexParameterxOES_profile;}
+if(this->m_ptr_glClearAccumxOES){this->m_next_glClearAccumxOES = this->m_ptr_glClearAccumxOES;this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&ProfileTableDecorator::m_glClearAccumxOES_profile;}
+if(this->m_ptr_glInvalidateFramebuffer){this->m_next_glInvalidateFramebuffer = this->m_ptr_glInvalidateFramebuffer;this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&ProfileTableDecorator::m_glInvalidateFramebuffer_profile;}
+if(this->m_ptr_glWeightubvARB){this->m_next_glWeightubvARB = this->m_ptr_glWeightubvARB;this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&ProfileTableDecorator::m_glWeightubvARB_profile;}
+if(this->m_ptr_glVertexAttrib1d){this->m_next_glVertexAttrib1d = this->m_ptr_glVertexAttrib1d;this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&ProfileTableDecorator::m_glVertexAttrib1d_profile;}
+if(this->m_ptr_glVertexAttrib1f){this->m_next_glVertexAttrib1f = this->m_ptr_glVertexAttrib1f;this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&ProfileTableDecorator::m_glVertexAttrib1f_profile;}
+if(this->m_ptr_glVertex4fv){this->m_next_glVertex4fv = this->m_ptr_glVertex4fv;this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&ProfileTableDecorator::m_glVertex4fv_profile;}
+if(this->m_ptr_glClearNamedFramebufferfi){this->m_next_glClearNamedFramebufferfi = this->m_ptr_glClearNamedFramebufferfi;this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&ProfileTableDecorator::m_glClearNamedFramebufferfi_profile;}
+if(this->m_ptr_glGetQueryBufferObjectuiv){this->m_next_glGetQueryBufferObjectuiv = this->m_ptr_glGetQueryBufferObjectuiv;this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&ProfileTableDecorator::m_glGetQueryBufferObjectuiv_profile;}
+if(this->m_ptr_glClearNamedFramebufferfv){this->m_next_glClearNamedFramebufferfv = this->m_ptr_glClearNamedFramebufferfv;this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&ProfileTableDecorator::m_glClearNamedFramebufferfv_profile;}
+if(this->m_ptr_glEndVertexShaderEXT){this->m_next_glEndVertexShaderEXT = this->m_ptr_glEndVertexShaderEXT;this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&ProfileTableDecorator::m_glEndVertexShaderEXT_profile;}
+if(this->m_ptr_glVertexAttrib1s){this->m_next_glVertexAttrib1s = this->m_ptr_glVertexAttrib1s;this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&ProfileTableDecorator::m_glVertexAttrib1s_profile;}
+if(this->m_ptr_glMultiTexCoord4dvARB){this->m_next_glMultiTexCoord4dvARB = this->m_ptr_glMultiTexCoord4dvARB;this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4dvARB_profile;}
+if(this->m_ptr_glMultiTexCoord1sv){this->m_next_glMultiTexCoord1sv = this->m_ptr_glMultiTexCoord1sv;this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&ProfileTableDecorator::m_glMultiTexCoord1sv_profile;}
+if(this->m_ptr_glUniform1ui64vNV){this->m_next_glUniform1ui64vNV = this->m_ptr_glUniform1ui64vNV;this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&ProfileTableDecorator::m_glUniform1ui64vNV_profile;}
+if(this->m_ptr_glGetClipPlanefOES){this->m_next_glGetClipPlanefOES = this->m_ptr_glGetClipPlanefOES;this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&ProfileTableDecorator::m_glGetClipPlanefOES_profile;}
+if(this->m_ptr_glRasterPos2s){this->m_next_glRasterPos2s = this->m_ptr_glRasterPos2s;this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&ProfileTableDecorator::m_glRasterPos2s_profile;}
+if(this->m_ptr_glWeightivARB){this->m_next_glWeightivARB = this->m_ptr_glWeightivARB;this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&ProfileTableDecorator::m_glWeightivARB_profile;}
+if(this->m_ptr_glMultiTexCoord4hvNV){this->m_next_glMultiTexCoord4hvNV = this->m_ptr_glMultiTexCoord4hvNV;this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&ProfileTableDecorator::m_glMultiTexCoord4hvNV_profile;}
+if(this->m_ptr_glNormal3hNV){this->m_next_glNormal3hNV = this->m_ptr_glNormal3hNV;this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&ProfileTableDecorator::m_glNormal3hNV_profile;}
+if(this->m_ptr_glGetSeparableFilter){this->m_next_glGetSeparableFilter = this->m_ptr_glGetSeparableFilter;this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&ProfileTableDecorator::m_glGetSeparableFilter_profile;}
+if(this->m_ptr_glGetPathTexGenivNV){this->m_next_glGetPathTexGenivNV = this->m_ptr_glGetPathTexGenivNV;this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&ProfileTableDecorator::m_glGetPathTexGenivNV_profile;}
+if(this->m_ptr_glColor4bv){this->m_next_glColor4bv = this->m_ptr_glColor4bv;this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&ProfileTableDecorator::m_glColor4bv_profile;}
+if(this->m_ptr_glRasterPos2f){this->m_next_glRasterPos2f = this->m_ptr_glRasterPos2f;this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&ProfileTableDecorator::m_glRasterPos2f_profile;}
+if(this->m_ptr_glNamedBufferPageCommitmentARB){this->m_next_glNamedBufferPageCommitmentARB = this->m_ptr_glNamedBufferPageCommitmentARB;this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&ProfileTableDecorator::m_glNamedBufferPageCommitmentARB_profile;}
+if(this->m_ptr_glLoadIdentity){this->m_next_glLoadIdentity = this->m_ptr_glLoadIdentity;this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&ProfileTableDecorator::m_glLoadIdentity_profile;}
+if(this->m_ptr_glRasterPos2i){this->m_next_glRasterPos2i = this->m_ptr_glRasterPos2i;this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&ProfileTableDecorator::m_glRasterPos2i_profile;}
+if(this->m_ptr_glRasterPos4iv){this->m_next_glRasterPos4iv = this->m_ptr_glRasterPos4iv;this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&ProfileTableDecorator::m_glRasterPos4iv_profile;}
+if(this->m_ptr_glMultiTexCoord2fvARB){this->m_next_glMultiTexCoord2fvARB = this->m_ptr_glMultiTexCoord2fvARB;this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2fvARB_profile;}
+if(this->m_ptr_glUniformMatrix4x3fv){this->m_next_glUniformMatrix4x3fv = this->m_ptr_glUniformMatrix4x3fv;this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&ProfileTableDecorator::m_glUniformMatrix4x3fv_profile;}
+if(this->m_ptr_glClearBufferfv){this->m_next_glClearBufferfv = this->m_ptr_glClearBufferfv;this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&ProfileTableDecorator::m_glClearBufferfv_profile;}
+if(this->m_ptr_glMultiTexCoord4hNV){this->m_next_glMultiTexCoord4hNV = this->m_ptr_glMultiTexCoord4hNV;this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&ProfileTableDecorator::m_glMultiTexCoord4hNV_profile;}
+if(this->m_ptr_glTextureBarrier){this->m_next_glTextureBarrier = this->m_ptr_glTextureBarrier;this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&ProfileTableDecorator::m_glTextureBarrier_profile;}
+if(this->m_ptr_glReplacementCodeuivSUN){this->m_next_glReplacementCodeuivSUN = this->m_ptr_glReplacementCodeuivSUN;this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuivSUN_profile;}
+if(this->m_ptr_glDeleteAsyncMarkersSGIX){this->m_next_glDeleteAsyncMarkersSGIX = this->m_ptr_glDeleteAsyncMarkersSGIX;this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&ProfileTableDecorator::m_glDeleteAsyncMarkersSGIX_profile;}
+if(this->m_ptr_glTexCoord2bvOES){this->m_next_glTexCoord2bvOES = this->m_ptr_glTexCoord2bvOES;this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&ProfileTableDecorator::m_glTexCoord2bvOES_profile;}
+if(this->m_ptr_glEvalCoord2xOES){this->m_next_glEvalCoord2xOES = this->m_ptr_glEvalCoord2xOES;this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&ProfileTableDecorator::m_glEvalCoord2xOES_profile;}
+if(this->m_ptr_glGetSharpenTexFuncSGIS){this->m_next_glGetSharpenTexFuncSGIS = this->m_ptr_glGetSharpenTexFuncSGIS;this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&ProfileTableDecorator::m_glGetSharpenTexFuncSGIS_profile;}
+if(this->m_ptr_glProgramUniformHandleui64vNV){this->m_next_glProgramUniformHandleui64vNV = this->m_ptr_glProgramUniformHandleui64vNV;this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&ProfileTableDecorator::m_glProgramUniformHandleui64vNV_profile;}
+if(this->m_ptr_glIglooInterfaceSGIX){this->m_next_glIglooInterfaceSGIX = this->m_ptr_glIglooInterfaceSGIX;this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&ProfileTableDecorator::m_glIglooInterfaceSGIX_profile;}
+if(this->m_ptr_glWindowPos2dvARB){this->m_next_glWindowPos2dvARB = this->m_ptr_glWindowPos2dvARB;this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&ProfileTableDecorator::m_glWindowPos2dvARB_profile;}
+if(this->m_ptr_glClearBufferfi){this->m_next_glClearBufferfi = this->m_ptr_glClearBufferfi;this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&ProfileTableDecorator::m_glClearBufferfi_profile;}
+if(this->m_ptr_glDrawArraysIndirect){this->m_next_glDrawArraysIndirect = this->m_ptr_glDrawArraysIndirect;this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&ProfileTableDecorator::m_glDrawArraysIndirect_profile;}
+if(this->m_ptr_glGenVertexArrays){this->m_next_glGenVertexArrays = this->m_ptr_glGenVertexArrays;this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&ProfileTableDecorator::m_glGenVertexArrays_profile;}
+if(this->m_ptr_glGetTransformFeedbacki64_v){this->m_next_glGetTransformFeedbacki64_v = this->m_ptr_glGetTransformFeedbacki64_v;this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&ProfileTableDecorator::m_glGetTransformFeedbacki64_v_profile;}
+if(this->m_ptr_glEnableVertexArrayAttrib){this->m_next_glEnableVertexArrayAttrib = this->m_ptr_glEnableVertexArrayAttrib;this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&ProfileTableDecorator::m_glEnableVertexArrayAttrib_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x2dv){this->m_next_glProgramUniformMatrix3x2dv = this->m_ptr_glProgramUniformMatrix3x2dv;this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x2dv_profile;}
+if(this->m_ptr_glVertexStream4fATI){this->m_next_glVertexStream4fATI = this->m_ptr_glVertexStream4fATI;this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&ProfileTableDecorator::m_glVertexStream4fATI_profile;}
+if(this->m_ptr_glVertexBindingDivisor){this->m_next_glVertexBindingDivisor = this->m_ptr_glVertexBindingDivisor;this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&ProfileTableDecorator::m_glVertexBindingDivisor_profile;}
+if(this->m_ptr_glGetSamplerParameterIiv){this->m_next_glGetSamplerParameterIiv = this->m_ptr_glGetSamplerParameterIiv;this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&ProfileTableDecorator::m_glGetSamplerParameterIiv_profile;}
+if(this->m_ptr_glGetCoverageModulationTableNV){this->m_next_glGetCoverageModulationTableNV = this->m_ptr_glGetCoverageModulationTableNV;this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&ProfileTableDecorator::m_glGetCoverageModulationTableNV_profile;}
+if(this->m_ptr_glDepthRangedNV){this->m_next_glDepthRangedNV = this->m_ptr_glDepthRangedNV;this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&ProfileTableDecorator::m_glDepthRangedNV_profile;}
+if(this->m_ptr_glVertexAttrib3f){this->m_next_glVertexAttrib3f = this->m_ptr_glVertexAttrib3f;this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&ProfileTableDecorator::m_glVertexAttrib3f_profile;}
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE){this->m_next_glMultiDrawRangeElementArrayAPPLE = this->m_ptr_glMultiDrawRangeElementArrayAPPLE;this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfileTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_profile;}
+if(this->m_ptr_glVertexAttribFormatNV){this->m_next_glVertexAttribFormatNV = this->m_ptr_glVertexAttribFormatNV;this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&ProfileTableDecorator::m_glVertexAttribFormatNV_profile;}
+if(this->m_ptr_glGetQueryBufferObjecti64v){this->m_next_glGetQueryBufferObjecti64v = this->m_ptr_glGetQueryBufferObjecti64v;this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&ProfileTableDecorator::m_glGetQueryBufferObjecti64v_profile;}
+if(this->m_ptr_glGetVertexAttribdv){this->m_next_glGetVertexAttribdv = this->m_ptr_glGetVertexAttribdv;this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&ProfileTableDecorator::m_glGetVertexAttribdv_profile;}
+if(this->m_ptr_glGetUniformi64vARB){this->m_next_glGetUniformi64vARB = this->m_ptr_glGetUniformi64vARB;this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&ProfileTableDecorator::m_glGetUniformi64vARB_profile;}
+if(this->m_ptr_glAreTexturesResidentEXT){this->m_next_glAreTexturesResidentEXT = this->m_ptr_glAreTexturesResidentEXT;this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&ProfileTableDecorator::m_glAreTexturesResidentEXT_profile;}
+if(this->m_ptr_glGetHandleARB){this->m_next_glGetHandleARB = this->m_ptr_glGetHandleARB;this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&ProfileTableDecorator::m_glGetHandleARB_profile;}
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV){this->m_next_glVideoCaptureStreamParameterdvNV = this->m_ptr_glVideoCaptureStreamParameterdvNV;this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&ProfileTableDecorator::m_glVideoCaptureStreamParameterdvNV_profile;}
+if(this->m_ptr_glMapParameterivNV){this->m_next_glMapParameterivNV = this->m_ptr_glMapParameterivNV;this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&ProfileTableDecorator::m_glMapParameterivNV_profile;}
+if(this->m_ptr_glIsVertexArray){this->m_next_glIsVertexArray = this->m_ptr_glIsVertexArray;this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&ProfileTableDecorator::m_glIsVertexArray_profile;}
+if(this->m_ptr_glSecondaryColor3sEXT){this->m_next_glSecondaryColor3sEXT = this->m_ptr_glSecondaryColor3sEXT;this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3sEXT_profile;}
+if(this->m_ptr_glGetTexParameterIivEXT){this->m_next_glGetTexParameterIivEXT = this->m_ptr_glGetTexParameterIivEXT;this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glGetTexParameterIivEXT_profile;}
+if(this->m_ptr_glFrameTerminatorGREMEDY){this->m_next_glFrameTerminatorGREMEDY = this->m_ptr_glFrameTerminatorGREMEDY;this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&ProfileTableDecorator::m_glFrameTerminatorGREMEDY_profile;}
+if(this->m_ptr_glBlendBarrierKHR){this->m_next_glBlendBarrierKHR = this->m_ptr_glBlendBarrierKHR;this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&ProfileTableDecorator::m_glBlendBarrierKHR_profile;}
+if(this->m_ptr_glVertexAttrib4NubARB){this->m_next_glVertexAttrib4NubARB = this->m_ptr_glVertexAttrib4NubARB;this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NubARB_profile;}
+if(this->m_ptr_glPrimitiveRestartNV){this->m_next_glPrimitiveRestartNV = this->m_ptr_glPrimitiveRestartNV;this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&ProfileTableDecorator::m_glPrimitiveRestartNV_profile;}
+if(this->m_ptr_glVertexAttribL1ui64vARB){this->m_next_glVertexAttribL1ui64vARB = this->m_ptr_glVertexAttribL1ui64vARB;this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&ProfileTableDecorator::m_glVertexAttribL1ui64vARB_profile;}
+if(this->m_ptr_glVertexAttribI4ivEXT){this->m_next_glVertexAttribI4ivEXT = this->m_ptr_glVertexAttribI4ivEXT;this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4ivEXT_profile;}
+if(this->m_ptr_glVertexAttribs4svNV){this->m_next_glVertexAttribs4svNV = this->m_ptr_glVertexAttribs4svNV;this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&ProfileTableDecorator::m_glVertexAttribs4svNV_profile;}
+if(this->m_ptr_glUniform1ui){this->m_next_glUniform1ui = this->m_ptr_glUniform1ui;this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&ProfileTableDecorator::m_glUniform1ui_profile;}
+if(this->m_ptr_glVertexAttrib2fvARB){this->m_next_glVertexAttrib2fvARB = this->m_ptr_glVertexAttrib2fvARB;this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&ProfileTableDecorator::m_glVertexAttrib2fvARB_profile;}
+if(this->m_ptr_glVertexAttribI4svEXT){this->m_next_glVertexAttribI4svEXT = this->m_ptr_glVertexAttribI4svEXT;this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4svEXT_profile;}
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV){this->m_next_glTextureImage3DMultisampleCoverageNV = this->m_ptr_glTextureImage3DMultisampleCoverageNV;this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfileTableDecorator::m_glTextureImage3DMultisampleCoverageNV_profile;}
+if(this->m_ptr_glMemoryBarrier){this->m_next_glMemoryBarrier = this->m_ptr_glMemoryBarrier;this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&ProfileTableDecorator::m_glMemoryBarrier_profile;}
+if(this->m_ptr_glGetVariantArrayObjectfvATI){this->m_next_glGetVariantArrayObjectfvATI = this->m_ptr_glGetVariantArrayObjectfvATI;this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&ProfileTableDecorator::m_glGetVariantArrayObjectfvATI_profile;}
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN){this->m_next_glTexCoord4fColor4fNormal3fVertex4fvSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN;this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&ProfileTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profile;}
+if(this->m_ptr_glIsProgramARB){this->m_next_glIsProgramARB = this->m_ptr_glIsProgramARB;this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&ProfileTableDecorator::m_glIsProgramARB_profile;}
+if(this->m_ptr_glBindImageTextureEXT){this->m_next_glBindImageTextureEXT = this->m_ptr_glBindImageTextureEXT;this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&ProfileTableDecorator::m_glBindImageTextureEXT_profile;}
+if(this->m_ptr_glGetFragDataLocation){this->m_next_glGetFragDataLocation = this->m_ptr_glGetFragDataLocation;this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&ProfileTableDecorator::m_glGetFragDataLocation_profile;}
+if(this->m_ptr_glMultiTexCoord1svARB){this->m_next_glMultiTexCoord1svARB = this->m_ptr_glMultiTexCoord1svARB;this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1svARB_profile;}
+if(this->m_ptr_glGetMapxvOES){this->m_next_glGetMapxvOES = this->m_ptr_glGetMapxvOES;this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&ProfileTableDecorator::m_glGetMapxvOES_profile;}
+if(this->m_ptr_glTextureStorage2DMultisampleEXT){this->m_next_glTextureStorage2DMultisampleEXT = this->m_ptr_glTextureStorage2DMultisampleEXT;this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTextureStorage2DMultisampleEXT_profile;}
+if(this->m_ptr_glGetMaterialfv){this->m_next_glGetMaterialfv = this->m_ptr_glGetMaterialfv;this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&ProfileTableDecorator::m_glGetMaterialfv_profile;}
+if(this->m_ptr_glVertexAttrib4NbvARB){this->m_next_glVertexAttrib4NbvARB = this->m_ptr_glVertexAttrib4NbvARB;this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4NbvARB_profile;}
+if(this->m_ptr_glPixelMapuiv){this->m_next_glPixelMapuiv = this->m_ptr_glPixelMapuiv;this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&ProfileTableDecorator::m_glPixelMapuiv_profile;}
+if(this->m_ptr_glColorPointerEXT){this->m_next_glColorPointerEXT = this->m_ptr_glColorPointerEXT;this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&ProfileTableDecorator::m_glColorPointerEXT_profile;}
+if(this->m_ptr_glEnableClientStateiEXT){this->m_next_glEnableClientStateiEXT = this->m_ptr_glEnableClientStateiEXT;this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&ProfileTableDecorator::m_glEnableClientStateiEXT_profile;}
+if(this->m_ptr_glClearTexSubImage){this->m_next_glClearTexSubImage = this->m_ptr_glClearTexSubImage;this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&ProfileTableDecorator::m_glClearTexSubImage_profile;}
+if(this->m_ptr_glEvalCoord1xvOES){this->m_next_glEvalCoord1xvOES = this->m_ptr_glEvalCoord1xvOES;this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&ProfileTableDecorator::m_glEvalCoord1xvOES_profile;}
+if(this->m_ptr_glDetachObjectARB){this->m_next_glDetachObjectARB = this->m_ptr_glDetachObjectARB;this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&ProfileTableDecorator::m_glDetachObjectARB_profile;}
+if(this->m_ptr_glGetTextureParameterIiv){this->m_next_glGetTextureParameterIiv = this->m_ptr_glGetTextureParameterIiv;this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&ProfileTableDecorator::m_glGetTextureParameterIiv_profile;}
+if(this->m_ptr_glVariantusvEXT){this->m_next_glVariantusvEXT = this->m_ptr_glVariantusvEXT;this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&ProfileTableDecorator::m_glVariantusvEXT_profile;}
+if(this->m_ptr_glCompressedTextureImage3DEXT){this->m_next_glCompressedTextureImage3DEXT = this->m_ptr_glCompressedTextureImage3DEXT;this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureImage3DEXT_profile;}
+if(this->m_ptr_glMultiTexCoord1dARB){this->m_next_glMultiTexCoord1dARB = this->m_ptr_glMultiTexCoord1dARB;this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&ProfileTableDecorator::m_glMultiTexCoord1dARB_profile;}
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT){this->m_next_glGetVertexArrayIntegeri_vEXT = this->m_ptr_glGetVertexArrayIntegeri_vEXT;this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&ProfileTableDecorator::m_glGetVertexArrayIntegeri_vEXT_profile;}
+if(this->m_ptr_glVertexAttribI4ubv){this->m_next_glVertexAttribI4ubv = this->m_ptr_glVertexAttribI4ubv;this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&ProfileTableDecorator::m_glVertexAttribI4ubv_profile;}
+if(this->m_ptr_glPixelTexGenParameterfSGIS){this->m_next_glPixelTexGenParameterfSGIS = this->m_ptr_glPixelTexGenParameterfSGIS;this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&ProfileTableDecorator::m_glPixelTexGenParameterfSGIS_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x2dv){this->m_next_glProgramUniformMatrix4x2dv = this->m_ptr_glProgramUniformMatrix4x2dv;this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x2dv_profile;}
+if(this->m_ptr_glUniform3fARB){this->m_next_glUniform3fARB = this->m_ptr_glUniform3fARB;this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&ProfileTableDecorator::m_glUniform3fARB_profile;}
+if(this->m_ptr_glIsShader){this->m_next_glIsShader = this->m_ptr_glIsShader;this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&ProfileTableDecorator::m_glIsShader_profile;}
+if(this->m_ptr_glConvolutionParameteriv){this->m_next_glConvolutionParameteriv = this->m_ptr_glConvolutionParameteriv;this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&ProfileTableDecorator::m_glConvolutionParameteriv_profile;}
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT){this->m_next_glCopyMultiTexSubImage2DEXT = this->m_ptr_glCopyMultiTexSubImage2DEXT;this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyMultiTexSubImage2DEXT_profile;}
+if(this->m_ptr_glEnableVertexAttribArrayARB){this->m_next_glEnableVertexAttribArrayARB = this->m_ptr_glEnableVertexAttribArrayARB;this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&ProfileTableDecorator::m_glEnableVertexAttribArrayARB_profile;}
+if(this->m_ptr_glMulticastCopyBufferSubDataNV){this->m_next_glMulticastCopyBufferSubDataNV = this->m_ptr_glMulticastCopyBufferSubDataNV;this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&ProfileTableDecorator::m_glMulticastCopyBufferSubDataNV_profile;}
+if(this->m_ptr_glEnable){this->m_next_glEnable = this->m_ptr_glEnable;this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&ProfileTableDecorator::m_glEnable_profile;}
+if(this->m_ptr_glGetActiveUniformsiv){this->m_next_glGetActiveUniformsiv = this->m_ptr_glGetActiveUniformsiv;this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&ProfileTableDecorator::m_glGetActiveUniformsiv_profile;}
+if(this->m_ptr_glGetVertexAttribivARB){this->m_next_glGetVertexAttribivARB = this->m_ptr_glGetVertexAttribivARB;this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&ProfileTableDecorator::m_glGetVertexAttribivARB_profile;}
+if(this->m_ptr_glTexCoord4hvNV){this->m_next_glTexCoord4hvNV = this->m_ptr_glTexCoord4hvNV;this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&ProfileTableDecorator::m_glTexCoord4hvNV_profile;}
+if(this->m_ptr_glUseProgramObjectARB){this->m_next_glUseProgramObjectARB = this->m_ptr_glUseProgramObjectARB;this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&ProfileTableDecorator::m_glUseProgramObjectARB_profile;}
+if(this->m_ptr_glGetAttribLocation){this->m_next_glGetAttribLocation = this->m_ptr_glGetAttribLocation;this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&ProfileTableDecorator::m_glGetAttribLocation_profile;}
+if(this->m_ptr_glVertexAttrib4dv){this->m_next_glVertexAttrib4dv = this->m_ptr_glVertexAttrib4dv;this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&ProfileTableDecorator::m_glVertexAttrib4dv_profile;}
+if(this->m_ptr_glGetTextureParameteriv){this->m_next_glGetTextureParameteriv = this->m_ptr_glGetTextureParameteriv;this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&ProfileTableDecorator::m_glGetTextureParameteriv_profile;}
+if(this->m_ptr_glNamedBufferStorageMemEXT){this->m_next_glNamedBufferStorageMemEXT = this->m_ptr_glNamedBufferStorageMemEXT;this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&ProfileTableDecorator::m_glNamedBufferStorageMemEXT_profile;}
+if(this->m_ptr_glPathSubCoordsNV){this->m_next_glPathSubCoordsNV = this->m_ptr_glPathSubCoordsNV;this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&ProfileTableDecorator::m_glPathSubCoordsNV_profile;}
+if(this->m_ptr_glMatrixIndexusvARB){this->m_next_glMatrixIndexusvARB = this->m_ptr_glMatrixIndexusvARB;this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&ProfileTableDecorator::m_glMatrixIndexusvARB_profile;}
+if(this->m_ptr_glGetVideouivNV){this->m_next_glGetVideouivNV = this->m_ptr_glGetVideouivNV;this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&ProfileTableDecorator::m_glGetVideouivNV_profile;}
+if(this->m_ptr_glGetVideoCaptureivNV){this->m_next_glGetVideoCaptureivNV = this->m_ptr_glGetVideoCaptureivNV;this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&ProfileTableDecorator::m_glGetVideoCaptureivNV_profile;}
+if(this->m_ptr_glProgramUniform3ui){this->m_next_glProgramUniform3ui = this->m_ptr_glProgramUniform3ui;this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&ProfileTableDecorator::m_glProgramUniform3ui_profile;}
+if(this->m_ptr_glVertexAttrib3svARB){this->m_next_glVertexAttrib3svARB = this->m_ptr_glVertexAttrib3svARB;this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&ProfileTableDecorator::m_glVertexAttrib3svARB_profile;}
+if(this->m_ptr_glGetNamedBufferParameterivEXT){this->m_next_glGetNamedBufferParameterivEXT = this->m_ptr_glGetNamedBufferParameterivEXT;this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetNamedBufferParameterivEXT_profile;}
+if(this->m_ptr_glMatrixScaledEXT){this->m_next_glMatrixScaledEXT = this->m_ptr_glMatrixScaledEXT;this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&ProfileTableDecorator::m_glMatrixScaledEXT_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x3fv){this->m_next_glProgramUniformMatrix2x3fv = this->m_ptr_glProgramUniformMatrix2x3fv;this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x3fv_profile;}
+if(this->m_ptr_glGetFragmentLightivSGIX){this->m_next_glGetFragmentLightivSGIX = this->m_ptr_glGetFragmentLightivSGIX;this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&ProfileTableDecorator::m_glGetFragmentLightivSGIX_profile;}
+if(this->m_ptr_glGetStringi){this->m_next_glGetStringi = this->m_ptr_glGetStringi;this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&ProfileTableDecorator::m_glGetStringi_profile;}
+if(this->m_ptr_glWindowPos2svARB){this->m_next_glWindowPos2svARB = this->m_ptr_glWindowPos2svARB;this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&ProfileTableDecorator::m_glWindowPos2svARB_profile;}
+if(this->m_ptr_glVertexAttrib2svNV){this->m_next_glVertexAttrib2svNV = this->m_ptr_glVertexAttrib2svNV;this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&ProfileTableDecorator::m_glVertexAttrib2svNV_profile;}
+if(this->m_ptr_glWindowPos2ivARB){this->m_next_glWindowPos2ivARB = this->m_ptr_glWindowPos2ivARB;this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&ProfileTableDecorator::m_glWindowPos2ivARB_profile;}
+if(this->m_ptr_glGetVertexAttribPointervNV){this->m_next_glGetVertexAttribPointervNV = this->m_ptr_glGetVertexAttribPointervNV;this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&ProfileTableDecorator::m_glGetVertexAttribPointervNV_profile;}
+if(this->m_ptr_glPushMatrix){this->m_next_glPushMatrix = this->m_ptr_glPushMatrix;this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&ProfileTableDecorator::m_glPushMatrix_profile;}
+if(this->m_ptr_glEdgeFlagPointerListIBM){this->m_next_glEdgeFlagPointerListIBM = this->m_ptr_glEdgeFlagPointerListIBM;this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glEdgeFlagPointerListIBM_profile;}
+if(this->m_ptr_glGenerateMipmapEXT){this->m_next_glGenerateMipmapEXT = this->m_ptr_glGenerateMipmapEXT;this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&ProfileTableDecorator::m_glGenerateMipmapEXT_profile;}
+if(this->m_ptr_glWindowPos3sv){this->m_next_glWindowPos3sv = this->m_ptr_glWindowPos3sv;this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&ProfileTableDecorator::m_glWindowPos3sv_profile;}
+if(this->m_ptr_glPathCoordsNV){this->m_next_glPathCoordsNV = this->m_ptr_glPathCoordsNV;this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&ProfileTableDecorator::m_glPathCoordsNV_profile;}
+if(this->m_ptr_glProgramUniform1i){this->m_next_glProgramUniform1i = this->m_ptr_glProgramUniform1i;this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&ProfileTableDecorator::m_glProgramUniform1i_profile;}
+if(this->m_ptr_glProgramUniform1d){this->m_next_glProgramUniform1d = this->m_ptr_glProgramUniform1d;this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&ProfileTableDecorator::m_glProgramUniform1d_profile;}
+if(this->m_ptr_glProgramUniform1f){this->m_next_glProgramUniform1f = this->m_ptr_glProgramUniform1f;this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&ProfileTableDecorator::m_glProgramUniform1f_profile;}
+if(this->m_ptr_glProgramParameteriEXT){this->m_next_glProgramParameteriEXT = this->m_ptr_glProgramParameteriEXT;this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&ProfileTableDecorator::m_glProgramParameteriEXT_profile;}
+if(this->m_ptr_glCompressedMultiTexImage2DEXT){this->m_next_glCompressedMultiTexImage2DEXT = this->m_ptr_glCompressedMultiTexImage2DEXT;this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexImage2DEXT_profile;}
+if(this->m_ptr_glProgramUniform3iv){this->m_next_glProgramUniform3iv = this->m_ptr_glProgramUniform3iv;this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&ProfileTableDecorator::m_glProgramUniform3iv_profile;}
+if(this->m_ptr_glIndexiv){this->m_next_glIndexiv = this->m_ptr_glIndexiv;this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&ProfileTableDecorator::m_glIndexiv_profile;}
+if(this->m_ptr_glMultiTexCoord4xvOES){this->m_next_glMultiTexCoord4xvOES = this->m_ptr_glMultiTexCoord4xvOES;this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord4xvOES_profile;}
+if(this->m_ptr_glEGLImageTargetTexture2DOES){this->m_next_glEGLImageTargetTexture2DOES = this->m_ptr_glEGLImageTargetTexture2DOES;this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&ProfileTableDecorator::m_glEGLImageTargetTexture2DOES_profile;}
+if(this->m_ptr_glPixelZoom){this->m_next_glPixelZoom = this->m_ptr_glPixelZoom;this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&ProfileTableDecorator::m_glPixelZoom_profile;}
+if(this->m_ptr_glVertex3bvOES){this->m_next_glVertex3bvOES = this->m_ptr_glVertex3bvOES;this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&ProfileTableDecorator::m_glVertex3bvOES_profile;}
+if(this->m_ptr_glFramebufferReadBufferEXT){this->m_next_glFramebufferReadBufferEXT = this->m_ptr_glFramebufferReadBufferEXT;this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&ProfileTableDecorator::m_glFramebufferReadBufferEXT_profile;}
+if(this->m_ptr_glExtractComponentEXT){this->m_next_glExtractComponentEXT = this->m_ptr_glExtractComponentEXT;this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&ProfileTableDecorator::m_glExtractComponentEXT_profile;}
+if(this->m_ptr_glCombinerParameterivNV){this->m_next_glCombinerParameterivNV = this->m_ptr_glCombinerParameterivNV;this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&ProfileTableDecorator::m_glCombinerParameterivNV_profile;}
+if(this->m_ptr_glMinmax){this->m_next_glMinmax = this->m_ptr_glMinmax;this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&ProfileTableDecorator::m_glMinmax_profile;}
+if(this->m_ptr_glColorP3ui){this->m_next_glColorP3ui = this->m_ptr_glColorP3ui;this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&ProfileTableDecorator::m_glColorP3ui_profile;}
+if(this->m_ptr_glPointParameterfvSGIS){this->m_next_glPointParameterfvSGIS = this->m_ptr_glPointParameterfvSGIS;this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&ProfileTableDecorator::m_glPointParameterfvSGIS_profile;}
+if(this->m_ptr_glBlendEquationi){this->m_next_glBlendEquationi = this->m_ptr_glBlendEquationi;this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&ProfileTableDecorator::m_glBlendEquationi_profile;}
+if(this->m_ptr_glGetFogFuncSGIS){this->m_next_glGetFogFuncSGIS = this->m_ptr_glGetFogFuncSGIS;this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&ProfileTableDecorator::m_glGetFogFuncSGIS_profile;}
+if(this->m_ptr_glVertexAttrib4fvNV){this->m_next_glVertexAttrib4fvNV = this->m_ptr_glVertexAttrib4fvNV;this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&ProfileTableDecorator::m_glVertexAttrib4fvNV_profile;}
+if(this->m_ptr_glGetnMinmax){this->m_next_glGetnMinmax = this->m_ptr_glGetnMinmax;this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&ProfileTableDecorator::m_glGetnMinmax_profile;}
+if(this->m_ptr_glFragmentLightiSGIX){this->m_next_glFragmentLightiSGIX = this->m_ptr_glFragmentLightiSGIX;this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&ProfileTableDecorator::m_glFragmentLightiSGIX_profile;}
+if(this->m_ptr_glMultiTexCoord1bvOES){this->m_next_glMultiTexCoord1bvOES = this->m_ptr_glMultiTexCoord1bvOES;this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord1bvOES_profile;}
+if(this->m_ptr_glSecondaryColorPointerEXT){this->m_next_glSecondaryColorPointerEXT = this->m_ptr_glSecondaryColorPointerEXT;this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&ProfileTableDecorator::m_glSecondaryColorPointerEXT_profile;}
+if(this->m_ptr_glMultiTexCoordP4uiv){this->m_next_glMultiTexCoordP4uiv = this->m_ptr_glMultiTexCoordP4uiv;this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&ProfileTableDecorator::m_glMultiTexCoordP4uiv_profile;}
+if(this->m_ptr_glGetBufferSubDataARB){this->m_next_glGetBufferSubDataARB = this->m_ptr_glGetBufferSubDataARB;this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&ProfileTableDecorator::m_glGetBufferSubDataARB_profile;}
+if(this->m_ptr_glSecondaryColor3hNV){this->m_next_glSecondaryColor3hNV = this->m_ptr_glSecondaryColor3hNV;this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&ProfileTableDecorator::m_glSecondaryColor3hNV_profile;}
+if(this->m_ptr_glGetPathParameterivNV){this->m_next_glGetPathParameterivNV = this->m_ptr_glGetPathParameterivNV;this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&ProfileTableDecorator::m_glGetPathParameterivNV_profile;}
+if(this->m_ptr_glFlushRasterSGIX){this->m_next_glFlushRasterSGIX = this->m_ptr_glFlushRasterSGIX;this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&ProfileTableDecorator::m_glFlushRasterSGIX_profile;}
+if(this->m_ptr_glElementPointerATI){this->m_next_glElementPointerATI = this->m_ptr_glElementPointerATI;this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&ProfileTableDecorator::m_glElementPointerATI_profile;}
+if(this->m_ptr_glGetAttachedObjectsARB){this->m_next_glGetAttachedObjectsARB = this->m_ptr_glGetAttachedObjectsARB;this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&ProfileTableDecorator::m_glGetAttachedObjectsARB_profile;}
+if(this->m_ptr_glUniform4iv){this->m_next_glUniform4iv = this->m_ptr_glUniform4iv;this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&ProfileTableDecorator::m_glUniform4iv_profile;}
+if(this->m_ptr_glFogxOES){this->m_next_glFogxOES = this->m_ptr_glFogxOES;this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&ProfileTableDecorator::m_glFogxOES_profile;}
+if(this->m_ptr_glSharpenTexFuncSGIS){this->m_next_glSharpenTexFuncSGIS = this->m_ptr_glSharpenTexFuncSGIS;this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&ProfileTableDecorator::m_glSharpenTexFuncSGIS_profile;}
+if(this->m_ptr_glClearDepthfOES){this->m_next_glClearDepthfOES = this->m_ptr_glClearDepthfOES;this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&ProfileTableDecorator::m_glClearDepthfOES_profile;}
+if(this->m_ptr_glDeleteCommandListsNV){this->m_next_glDeleteCommandListsNV = this->m_ptr_glDeleteCommandListsNV;this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&ProfileTableDecorator::m_glDeleteCommandListsNV_profile;}
+if(this->m_ptr_glSpecializeShader){this->m_next_glSpecializeShader = this->m_ptr_glSpecializeShader;this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&ProfileTableDecorator::m_glSpecializeShader_profile;}
+if(this->m_ptr_glVertex4hNV){this->m_next_glVertex4hNV = this->m_ptr_glVertex4hNV;this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&ProfileTableDecorator::m_glVertex4hNV_profile;}
+if(this->m_ptr_glSecondaryColor3dvEXT){this->m_next_glSecondaryColor3dvEXT = this->m_ptr_glSecondaryColor3dvEXT;this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3dvEXT_profile;}
+if(this->m_ptr_glGenTextures){this->m_next_glGenTextures = this->m_ptr_glGenTextures;this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&ProfileTableDecorator::m_glGenTextures_profile;}
+if(this->m_ptr_glTextureStorage2DMultisample){this->m_next_glTextureStorage2DMultisample = this->m_ptr_glTextureStorage2DMultisample;this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTextureStorage2DMultisample_profile;}
+if(this->m_ptr_glUniform3ui64vNV){this->m_next_glUniform3ui64vNV = this->m_ptr_glUniform3ui64vNV;this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&ProfileTableDecorator::m_glUniform3ui64vNV_profile;}
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD){this->m_next_glBlendFuncSeparateIndexedAMD = this->m_ptr_glBlendFuncSeparateIndexedAMD;this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&ProfileTableDecorator::m_glBlendFuncSeparateIndexedAMD_profile;}
+if(this->m_ptr_glMakeBufferResidentNV){this->m_next_glMakeBufferResidentNV = this->m_ptr_glMakeBufferResidentNV;this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&ProfileTableDecorator::m_glMakeBufferResidentNV_profile;}
+if(this->m_ptr_glShaderOp2EXT){this->m_next_glShaderOp2EXT = this->m_ptr_glShaderOp2EXT;this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&ProfileTableDecorator::m_glShaderOp2EXT_profile;}
+if(this->m_ptr_glGetVertexAttribivNV){this->m_next_glGetVertexAttribivNV = this->m_ptr_glGetVertexAttribivNV;this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&ProfileTableDecorator::m_glGetVertexAttribivNV_profile;}
+if(this->m_ptr_glTexParameterIivEXT){this->m_next_glTexParameterIivEXT = this->m_ptr_glTexParameterIivEXT;this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glTexParameterIivEXT_profile;}
+if(this->m_ptr_glGetPerfQueryDataINTEL){this->m_next_glGetPerfQueryDataINTEL = this->m_ptr_glGetPerfQueryDataINTEL;this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&ProfileTableDecorator::m_glGetPerfQueryDataINTEL_profile;}
+if(this->m_ptr_glVertexAttrib4dvARB){this->m_next_glVertexAttrib4dvARB = this->m_ptr_glVertexAttrib4dvARB;this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4dvARB_profile;}
+if(this->m_ptr_glTextureSubImage1DEXT){this->m_next_glTextureSubImage1DEXT = this->m_ptr_glTextureSubImage1DEXT;this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glTextureSubImage1DEXT_profile;}
+if(this->m_ptr_glGetActiveUniformBlockName){this->m_next_glGetActiveUniformBlockName = this->m_ptr_glGetActiveUniformBlockName;this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&ProfileTableDecorator::m_glGetActiveUniformBlockName_profile;}
+if(this->m_ptr_glVertexAttrib2dvARB){this->m_next_glVertexAttrib2dvARB = this->m_ptr_glVertexAttrib2dvARB;this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&ProfileTableDecorator::m_glVertexAttrib2dvARB_profile;}
+if(this->m_ptr_glVertexAttribPointer){this->m_next_glVertexAttribPointer = this->m_ptr_glVertexAttribPointer;this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&ProfileTableDecorator::m_glVertexAttribPointer_profile;}
+if(this->m_ptr_glDepthBoundsdNV){this->m_next_glDepthBoundsdNV = this->m_ptr_glDepthBoundsdNV;this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&ProfileTableDecorator::m_glDepthBoundsdNV_profile;}
+if(this->m_ptr_glDeleteTexturesEXT){this->m_next_glDeleteTexturesEXT = this->m_ptr_glDeleteTexturesEXT;this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&ProfileTableDecorator::m_glDeleteTexturesEXT_profile;}
+if(this->m_ptr_glDrawBuffersATI){this->m_next_glDrawBuffersATI = this->m_ptr_glDrawBuffersATI;this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&ProfileTableDecorator::m_glDrawBuffersATI_profile;}
+if(this->m_ptr_glLightModelxvOES){this->m_next_glLightModelxvOES = this->m_ptr_glLightModelxvOES;this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&ProfileTableDecorator::m_glLightModelxvOES_profile;}
+if(this->m_ptr_glApplyTextureEXT){this->m_next_glApplyTextureEXT = this->m_ptr_glApplyTextureEXT;this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&ProfileTableDecorator::m_glApplyTextureEXT_profile;}
+if(this->m_ptr_glGetImageHandleNV){this->m_next_glGetImageHandleNV = this->m_ptr_glGetImageHandleNV;this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&ProfileTableDecorator::m_glGetImageHandleNV_profile;}
+if(this->m_ptr_glGetMinmax){this->m_next_glGetMinmax = this->m_ptr_glGetMinmax;this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&ProfileTableDecorator::m_glGetMinmax_profile;}
+if(this->m_ptr_glGetFixedvOES){this->m_next_glGetFixedvOES = this->m_ptr_glGetFixedvOES;this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&ProfileTableDecorator::m_glGetFixedvOES_profile;}
+if(this->m_ptr_glSamplePatternEXT){this->m_next_glSamplePatternEXT = this->m_ptr_glSamplePatternEXT;this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&ProfileTableDecorator::m_glSamplePatternEXT_profile;}
+if(this->m_ptr_glUniform1f){this->m_next_glUniform1f = this->m_ptr_glUniform1f;this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&ProfileTableDecorator::m_glUniform1f_profile;}
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN){this->m_next_glColor4fNormal3fVertex3fSUN = this->m_ptr_glColor4fNormal3fVertex3fSUN;this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glColor4fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glFogCoorddvEXT){this->m_next_glFogCoorddvEXT = this->m_ptr_glFogCoorddvEXT;this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&ProfileTableDecorator::m_glFogCoorddvEXT_profile;}
+if(this->m_ptr_glCopyTextureImage1DEXT){this->m_next_glCopyTextureImage1DEXT = this->m_ptr_glCopyTextureImage1DEXT;this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyTextureImage1DEXT_profile;}
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE){this->m_next_glFlushMappedBufferRangeAPPLE = this->m_ptr_glFlushMappedBufferRangeAPPLE;this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&ProfileTableDecorator::m_glFlushMappedBufferRangeAPPLE_profile;}
+if(this->m_ptr_glVertex3sv){this->m_next_glVertex3sv = this->m_ptr_glVertex3sv;this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&ProfileTableDecorator::m_glVertex3sv_profile;}
+if(this->m_ptr_glFlushStaticDataIBM){this->m_next_glFlushStaticDataIBM = this->m_ptr_glFlushStaticDataIBM;this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&ProfileTableDecorator::m_glFlushStaticDataIBM_profile;}
+if(this->m_ptr_glProgramUniform4ui64NV){this->m_next_glProgramUniform4ui64NV = this->m_ptr_glProgramUniform4ui64NV;this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&ProfileTableDecorator::m_glProgramUniform4ui64NV_profile;}
+if(this->m_ptr_glRasterPos4xOES){this->m_next_glRasterPos4xOES = this->m_ptr_glRasterPos4xOES;this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&ProfileTableDecorator::m_glRasterPos4xOES_profile;}
+if(this->m_ptr_glVertexAttribP1ui){this->m_next_glVertexAttribP1ui = this->m_ptr_glVertexAttribP1ui;this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&ProfileTableDecorator::m_glVertexAttribP1ui_profile;}
+if(this->m_ptr_glProgramUniform4dvEXT){this->m_next_glProgramUniform4dvEXT = this->m_ptr_glProgramUniform4dvEXT;this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&ProfileTableDecorator::m_glProgramUniform4dvEXT_profile;}
+if(this->m_ptr_glEndTransformFeedbackEXT){this->m_next_glEndTransformFeedbackEXT = this->m_ptr_glEndTransformFeedbackEXT;this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&ProfileTableDecorator::m_glEndTransformFeedbackEXT_profile;}
+if(this->m_ptr_glBinormal3dEXT){this->m_next_glBinormal3dEXT = this->m_ptr_glBinormal3dEXT;this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&ProfileTableDecorator::m_glBinormal3dEXT_profile;}
+if(this->m_ptr_glGetTextureSubImage){this->m_next_glGetTextureSubImage = this->m_ptr_glGetTextureSubImage;this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&ProfileTableDecorator::m_glGetTextureSubImage_profile;}
+if(this->m_ptr_glGetNamedRenderbufferParameteriv){this->m_next_glGetNamedRenderbufferParameteriv = this->m_ptr_glGetNamedRenderbufferParameteriv;this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetNamedRenderbufferParameteriv_profile;}
+if(this->m_ptr_glBindBuffersRange){this->m_next_glBindBuffersRange = this->m_ptr_glBindBuffersRange;this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&ProfileTableDecorator::m_glBindBuffersRange_profile;}
+if(this->m_ptr_glFinishAsyncSGIX){this->m_next_glFinishAsyncSGIX = this->m_ptr_glFinishAsyncSGIX;this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&ProfileTableDecorator::m_glFinishAsyncSGIX_profile;}
+if(this->m_ptr_glBindFragDataLocationIndexed){this->m_next_glBindFragDataLocationIndexed = this->m_ptr_glBindFragDataLocationIndexed;this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&ProfileTableDecorator::m_glBindFragDataLocationIndexed_profile;}
+if(this->m_ptr_glMultiTexCoord2dv){this->m_next_glMultiTexCoord2dv = this->m_ptr_glMultiTexCoord2dv;this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&ProfileTableDecorator::m_glMultiTexCoord2dv_profile;}
+if(this->m_ptr_glUniform2iv){this->m_next_glUniform2iv = this->m_ptr_glUniform2iv;this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&ProfileTableDecorator::m_glUniform2iv_profile;}
+if(this->m_ptr_glProgramUniform2i64vNV){this->m_next_glProgramUniform2i64vNV = this->m_ptr_glProgramUniform2i64vNV;this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&ProfileTableDecorator::m_glProgramUniform2i64vNV_profile;}
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE){this->m_next_glFlushVertexArrayRangeAPPLE = this->m_ptr_glFlushVertexArrayRangeAPPLE;this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&ProfileTableDecorator::m_glFlushVertexArrayRangeAPPLE_profile;}
+if(this->m_ptr_glTextureParameterf){this->m_next_glTextureParameterf = this->m_ptr_glTextureParameterf;this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&ProfileTableDecorator::m_glTextureParameterf_profile;}
+if(this->m_ptr_glMultiTexCoord3dvARB){this->m_next_glMultiTexCoord3dvARB = this->m_ptr_glMultiTexCoord3dvARB;this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord3dvARB_profile;}
+if(this->m_ptr_glFeedbackBuffer){this->m_next_glFeedbackBuffer = this->m_ptr_glFeedbackBuffer;this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&ProfileTableDecorator::m_glFeedbackBuffer_profile;}
+if(this->m_ptr_glDebugMessageInsertARB){this->m_next_glDebugMessageInsertARB = this->m_ptr_glDebugMessageInsertARB;this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&ProfileTableDecorator::m_glDebugMessageInsertARB_profile;}
+if(this->m_ptr_glMultiTexCoord2i){this->m_next_glMultiTexCoord2i = this->m_ptr_glMultiTexCoord2i;this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&ProfileTableDecorator::m_glMultiTexCoord2i_profile;}
+if(this->m_ptr_glTextureSubImage3D){this->m_next_glTextureSubImage3D = this->m_ptr_glTextureSubImage3D;this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&ProfileTableDecorator::m_glTextureSubImage3D_profile;}
+if(this->m_ptr_glFramebufferTexture1D){this->m_next_glFramebufferTexture1D = this->m_ptr_glFramebufferTexture1D;this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&ProfileTableDecorator::m_glFramebufferTexture1D_profile;}
+if(this->m_ptr_glGetShaderiv){this->m_next_glGetShaderiv = this->m_ptr_glGetShaderiv;this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&ProfileTableDecorator::m_glGetShaderiv_profile;}
+if(this->m_ptr_glMultiTexCoord2d){this->m_next_glMultiTexCoord2d = this->m_ptr_glMultiTexCoord2d;this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&ProfileTableDecorator::m_glMultiTexCoord2d_profile;}
+if(this->m_ptr_glArrayObjectATI){this->m_next_glArrayObjectATI = this->m_ptr_glArrayObjectATI;this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&ProfileTableDecorator::m_glArrayObjectATI_profile;}
+if(this->m_ptr_glGetPointeri_vEXT){this->m_next_glGetPointeri_vEXT = this->m_ptr_glGetPointeri_vEXT;this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&ProfileTableDecorator::m_glGetPointeri_vEXT_profile;}
+if(this->m_ptr_glGetPerfMonitorCountersAMD){this->m_next_glGetPerfMonitorCountersAMD = this->m_ptr_glGetPerfMonitorCountersAMD;this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorCountersAMD_profile;}
+if(this->m_ptr_glNamedBufferStorage){this->m_next_glNamedBufferStorage = this->m_ptr_glNamedBufferStorage;this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&ProfileTableDecorator::m_glNamedBufferStorage_profile;}
+if(this->m_ptr_glTexEnvxvOES){this->m_next_glTexEnvxvOES = this->m_ptr_glTexEnvxvOES;this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&ProfileTableDecorator::m_glTexEnvxvOES_profile;}
+if(this->m_ptr_glProgramUniform2ui64NV){this->m_next_glProgramUniform2ui64NV = this->m_ptr_glProgramUniform2ui64NV;this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&ProfileTableDecorator::m_glProgramUniform2ui64NV_profile;}
+if(this->m_ptr_glMultiTexCoord3bOES){this->m_next_glMultiTexCoord3bOES = this->m_ptr_glMultiTexCoord3bOES;this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&ProfileTableDecorator::m_glMultiTexCoord3bOES_profile;}
+if(this->m_ptr_glUniform1dv){this->m_next_glUniform1dv = this->m_ptr_glUniform1dv;this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&ProfileTableDecorator::m_glUniform1dv_profile;}
+if(this->m_ptr_glPixelTransferi){this->m_next_glPixelTransferi = this->m_ptr_glPixelTransferi;this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&ProfileTableDecorator::m_glPixelTransferi_profile;}
+if(this->m_ptr_glSecondaryColor3usvEXT){this->m_next_glSecondaryColor3usvEXT = this->m_ptr_glSecondaryColor3usvEXT;this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3usvEXT_profile;}
+if(this->m_ptr_glProgramEnvParameterI4uivNV){this->m_next_glProgramEnvParameterI4uivNV = this->m_ptr_glProgramEnvParameterI4uivNV;this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&ProfileTableDecorator::m_glProgramEnvParameterI4uivNV_profile;}
+if(this->m_ptr_glVertex2sv){this->m_next_glVertex2sv = this->m_ptr_glVertex2sv;this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&ProfileTableDecorator::m_glVertex2sv_profile;}
+if(this->m_ptr_glWindowPos4dMESA){this->m_next_glWindowPos4dMESA = this->m_ptr_glWindowPos4dMESA;this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&ProfileTableDecorator::m_glWindowPos4dMESA_profile;}
+if(this->m_ptr_glDebugMessageControlARB){this->m_next_glDebugMessageControlARB = this->m_ptr_glDebugMessageControlARB;this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&ProfileTableDecorator::m_glDebugMessageControlARB_profile;}
+if(this->m_ptr_glIsTextureEXT){this->m_next_glIsTextureEXT = this->m_ptr_glIsTextureEXT;this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&ProfileTableDecorator::m_glIsTextureEXT_profile;}
+if(this->m_ptr_glFragmentMaterialivSGIX){this->m_next_glFragmentMaterialivSGIX = this->m_ptr_glFragmentMaterialivSGIX;this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&ProfileTableDecorator::m_glFragmentMaterialivSGIX_profile;}
+if(this->m_ptr_glLinkProgramARB){this->m_next_glLinkProgramARB = this->m_ptr_glLinkProgramARB;this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&ProfileTableDecorator::m_glLinkProgramARB_profile;}
+if(this->m_ptr_glFinishFenceAPPLE){this->m_next_glFinishFenceAPPLE = this->m_ptr_glFinishFenceAPPLE;this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&ProfileTableDecorator::m_glFinishFenceAPPLE_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT){this->m_next_glVertexArrayVertexAttribBindingEXT = this->m_ptr_glVertexArrayVertexAttribBindingEXT;this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribBindingEXT_profile;}
+if(this->m_ptr_glTexStorageMem3DMultisampleEXT){this->m_next_glTexStorageMem3DMultisampleEXT = this->m_ptr_glTexStorageMem3DMultisampleEXT;this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTexStorageMem3DMultisampleEXT_profile;}
+if(this->m_ptr_glUniform1ui64vARB){this->m_next_glUniform1ui64vARB = this->m_ptr_glUniform1ui64vARB;this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&ProfileTableDecorator::m_glUniform1ui64vARB_profile;}
+if(this->m_ptr_glMultiTexCoord4fv){this->m_next_glMultiTexCoord4fv = this->m_ptr_glMultiTexCoord4fv;this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&ProfileTableDecorator::m_glMultiTexCoord4fv_profile;}
+if(this->m_ptr_glMulticastFramebufferSampleLocationsfvNV){this->m_next_glMulticastFramebufferSampleLocationsfvNV = this->m_ptr_glMulticastFramebufferSampleLocationsfvNV;this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfileTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_profile;}
+if(this->m_ptr_glRasterPos3d){this->m_next_glRasterPos3d = this->m_ptr_glRasterPos3d;this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&ProfileTableDecorator::m_glRasterPos3d_profile;}
+if(this->m_ptr_glPollAsyncSGIX){this->m_next_glPollAsyncSGIX = this->m_ptr_glPollAsyncSGIX;this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&ProfileTableDecorator::m_glPollAsyncSGIX_profile;}
+if(this->m_ptr_glRasterPos3f){this->m_next_glRasterPos3f = this->m_ptr_glRasterPos3f;this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&ProfileTableDecorator::m_glRasterPos3f_profile;}
+if(this->m_ptr_glCompressedTexImage3D){this->m_next_glCompressedTexImage3D = this->m_ptr_glCompressedTexImage3D;this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&ProfileTableDecorator::m_glCompressedTexImage3D_profile;}
+if(this->m_ptr_glVariantivEXT){this->m_next_glVariantivEXT = this->m_ptr_glVariantivEXT;this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&ProfileTableDecorator::m_glVariantivEXT_profile;}
+if(this->m_ptr_glUnmapTexture2DINTEL){this->m_next_glUnmapTexture2DINTEL = this->m_ptr_glUnmapTexture2DINTEL;this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&ProfileTableDecorator::m_glUnmapTexture2DINTEL_profile;}
+if(this->m_ptr_glMulticastWaitSyncNV){this->m_next_glMulticastWaitSyncNV = this->m_ptr_glMulticastWaitSyncNV;this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&ProfileTableDecorator::m_glMulticastWaitSyncNV_profile;}
+if(this->m_ptr_glGetVertexAttribiv){this->m_next_glGetVertexAttribiv = this->m_ptr_glGetVertexAttribiv;this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&ProfileTableDecorator::m_glGetVertexAttribiv_profile;}
+if(this->m_ptr_glGetPathCoordsNV){this->m_next_glGetPathCoordsNV = this->m_ptr_glGetPathCoordsNV;this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&ProfileTableDecorator::m_glGetPathCoordsNV_profile;}
+if(this->m_ptr_glColor4xvOES){this->m_next_glColor4xvOES = this->m_ptr_glColor4xvOES;this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&ProfileTableDecorator::m_glColor4xvOES_profile;}
+if(this->m_ptr_glVertexAttrib3fv){this->m_next_glVertexAttrib3fv = this->m_ptr_glVertexAttrib3fv;this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&ProfileTableDecorator::m_glVertexAttrib3fv_profile;}
+if(this->m_ptr_glRasterPos3s){this->m_next_glRasterPos3s = this->m_ptr_glRasterPos3s;this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&ProfileTableDecorator::m_glRasterPos3s_profile;}
+if(this->m_ptr_glVertex4bOES){this->m_next_glVertex4bOES = this->m_ptr_glVertex4bOES;this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&ProfileTableDecorator::m_glVertex4bOES_profile;}
+if(this->m_ptr_glTransformFeedbackVaryingsEXT){this->m_next_glTransformFeedbackVaryingsEXT = this->m_ptr_glTransformFeedbackVaryingsEXT;this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&ProfileTableDecorator::m_glTransformFeedbackVaryingsEXT_profile;}
+if(this->m_ptr_glCombinerOutputNV){this->m_next_glCombinerOutputNV = this->m_ptr_glCombinerOutputNV;this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&ProfileTableDecorator::m_glCombinerOutputNV_profile;}
+if(this->m_ptr_glWindowPos4sMESA){this->m_next_glWindowPos4sMESA = this->m_ptr_glWindowPos4sMESA;this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&ProfileTableDecorator::m_glWindowPos4sMESA_profile;}
+if(this->m_ptr_glVertexAttrib4svARB){this->m_next_glVertexAttrib4svARB = this->m_ptr_glVertexAttrib4svARB;this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4svARB_profile;}
+if(this->m_ptr_glIsList){this->m_next_glIsList = this->m_ptr_glIsList;this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&ProfileTableDecorator::m_glIsList_profile;}
+if(this->m_ptr_glGetInfoLogARB){this->m_next_glGetInfoLogARB = this->m_ptr_glGetInfoLogARB;this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&ProfileTableDecorator::m_glGetInfoLogARB_profile;}
+if(this->m_ptr_glUniformMatrix2fv){this->m_next_glUniformMatrix2fv = this->m_ptr_glUniformMatrix2fv;this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&ProfileTableDecorator::m_glUniformMatrix2fv_profile;}
+if(this->m_ptr_glVertexAttribs3dvNV){this->m_next_glVertexAttribs3dvNV = this->m_ptr_glVertexAttribs3dvNV;this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&ProfileTableDecorator::m_glVertexAttribs3dvNV_profile;}
+if(this->m_ptr_glGlobalAlphaFactorsSUN){this->m_next_glGlobalAlphaFactorsSUN = this->m_ptr_glGlobalAlphaFactorsSUN;this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactorsSUN_profile;}
+if(this->m_ptr_glGetTrackMatrixivNV){this->m_next_glGetTrackMatrixivNV = this->m_ptr_glGetTrackMatrixivNV;this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&ProfileTableDecorator::m_glGetTrackMatrixivNV_profile;}
+if(this->m_ptr_glTextureParameterfvEXT){this->m_next_glTextureParameterfvEXT = this->m_ptr_glTextureParameterfvEXT;this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glTextureParameterfvEXT_profile;}
+if(this->m_ptr_glIsNamedBufferResidentNV){this->m_next_glIsNamedBufferResidentNV = this->m_ptr_glIsNamedBufferResidentNV;this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&ProfileTableDecorator::m_glIsNamedBufferResidentNV_profile;}
+if(this->m_ptr_glProgramUniform4ui64vARB){this->m_next_glProgramUniform4ui64vARB = this->m_ptr_glProgramUniform4ui64vARB;this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&ProfileTableDecorator::m_glProgramUniform4ui64vARB_profile;}
+if(this->m_ptr_glTbufferMask3DFX){this->m_next_glTbufferMask3DFX = this->m_ptr_glTbufferMask3DFX;this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&ProfileTableDecorator::m_glTbufferMask3DFX_profile;}
+if(this->m_ptr_glCoverFillPathNV){this->m_next_glCoverFillPathNV = this->m_ptr_glCoverFillPathNV;this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&ProfileTableDecorator::m_glCoverFillPathNV_profile;}
+if(this->m_ptr_glVertexAttrib1fvARB){this->m_next_glVertexAttrib1fvARB = this->m_ptr_glVertexAttrib1fvARB;this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&ProfileTableDecorator::m_glVertexAttrib1fvARB_profile;}
+if(this->m_ptr_glGenerateTextureMipmap){this->m_next_glGenerateTextureMipmap = this->m_ptr_glGenerateTextureMipmap;this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&ProfileTableDecorator::m_glGenerateTextureMipmap_profile;}
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT){this->m_next_glNamedProgramLocalParameterI4uivEXT = this->m_ptr_glNamedProgramLocalParameterI4uivEXT;this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_profile;}
+if(this->m_ptr_glMultiDrawElementsBaseVertex){this->m_next_glMultiDrawElementsBaseVertex = this->m_ptr_glMultiDrawElementsBaseVertex;this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&ProfileTableDecorator::m_glMultiDrawElementsBaseVertex_profile;}
+if(this->m_ptr_glProgramSubroutineParametersuivNV){this->m_next_glProgramSubroutineParametersuivNV = this->m_ptr_glProgramSubroutineParametersuivNV;this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&ProfileTableDecorator::m_glProgramSubroutineParametersuivNV_profile;}
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT){this->m_next_glProgramUniformMatrix2x4dvEXT = this->m_ptr_glProgramUniformMatrix2x4dvEXT;this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2x4dvEXT_profile;}
+if(this->m_ptr_glRotatexOES){this->m_next_glRotatexOES = this->m_ptr_glRotatexOES;this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&ProfileTableDecorator::m_glRotatexOES_profile;}
+if(this->m_ptr_glMemoryBarrierEXT){this->m_next_glMemoryBarrierEXT = this->m_ptr_glMemoryBarrierEXT;this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&ProfileTableDecorator::m_glMemoryBarrierEXT_profile;}
+if(this->m_ptr_glVertexAttrib3svNV){this->m_next_glVertexAttrib3svNV = this->m_ptr_glVertexAttrib3svNV;this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&ProfileTableDecorator::m_glVertexAttrib3svNV_profile;}
+if(this->m_ptr_glVertexStream3iATI){this->m_next_glVertexStream3iATI = this->m_ptr_glVertexStream3iATI;this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&ProfileTableDecorator::m_glVertexStream3iATI_profile;}
+if(this->m_ptr_glCompressedTexSubImage1D){this->m_next_glCompressedTexSubImage1D = this->m_ptr_glCompressedTexSubImage1D;this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&ProfileTableDecorator::m_glCompressedTexSubImage1D_profile;}
+if(this->m_ptr_glSetFenceNV){this->m_next_glSetFenceNV = this->m_ptr_glSetFenceNV;this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&ProfileTableDecorator::m_glSetFenceNV_profile;}
+if(this->m_ptr_glAttachObjectARB){this->m_next_glAttachObjectARB = this->m_ptr_glAttachObjectARB;this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&ProfileTableDecorator::m_glAttachObjectARB_profile;}
+if(this->m_ptr_glCopyConvolutionFilter1D){this->m_next_glCopyConvolutionFilter1D = this->m_ptr_glCopyConvolutionFilter1D;this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&ProfileTableDecorator::m_glCopyConvolutionFilter1D_profile;}
+if(this->m_ptr_glTexStorageMem2DMultisampleEXT){this->m_next_glTexStorageMem2DMultisampleEXT = this->m_ptr_glTexStorageMem2DMultisampleEXT;this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTexStorageMem2DMultisampleEXT_profile;}
+if(this->m_ptr_glProgramParameters4fvNV){this->m_next_glProgramParameters4fvNV = this->m_ptr_glProgramParameters4fvNV;this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&ProfileTableDecorator::m_glProgramParameters4fvNV_profile;}
+if(this->m_ptr_glNamedFramebufferParameteriEXT){this->m_next_glNamedFramebufferParameteriEXT = this->m_ptr_glNamedFramebufferParameteriEXT;this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferParameteriEXT_profile;}
+if(this->m_ptr_glVertexAttrib4Nsv){this->m_next_glVertexAttrib4Nsv = this->m_ptr_glVertexAttrib4Nsv;this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&ProfileTableDecorator::m_glVertexAttrib4Nsv_profile;}
+if(this->m_ptr_glVertexAttribI4usvEXT){this->m_next_glVertexAttribI4usvEXT = this->m_ptr_glVertexAttribI4usvEXT;this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&ProfileTableDecorator::m_glVertexAttribI4usvEXT_profile;}
+if(this->m_ptr_glTextureBufferRangeEXT){this->m_next_glTextureBufferRangeEXT = this->m_ptr_glTextureBufferRangeEXT;this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&ProfileTableDecorator::m_glTextureBufferRangeEXT_profile;}
+if(this->m_ptr_glVertexP3uiv){this->m_next_glVertexP3uiv = this->m_ptr_glVertexP3uiv;this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&ProfileTableDecorator::m_glVertexP3uiv_profile;}
+if(this->m_ptr_glIsPathNV){this->m_next_glIsPathNV = this->m_ptr_glIsPathNV;this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&ProfileTableDecorator::m_glIsPathNV_profile;}
+if(this->m_ptr_glGetnUniformi64vARB){this->m_next_glGetnUniformi64vARB = this->m_ptr_glGetnUniformi64vARB;this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&ProfileTableDecorator::m_glGetnUniformi64vARB_profile;}
+if(this->m_ptr_glFramebufferTextureMultiviewOVR){this->m_next_glFramebufferTextureMultiviewOVR = this->m_ptr_glFramebufferTextureMultiviewOVR;this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&ProfileTableDecorator::m_glFramebufferTextureMultiviewOVR_profile;}
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT){this->m_next_glCompressedMultiTexSubImage2DEXT = this->m_ptr_glCompressedMultiTexSubImage2DEXT;this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCompressedMultiTexSubImage2DEXT_profile;}
+if(this->m_ptr_glGetnMapdv){this->m_next_glGetnMapdv = this->m_ptr_glGetnMapdv;this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&ProfileTableDecorator::m_glGetnMapdv_profile;}
+if(this->m_ptr_glDebugMessageCallback){this->m_next_glDebugMessageCallback = this->m_ptr_glDebugMessageCallback;this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&ProfileTableDecorator::m_glDebugMessageCallback_profile;}
+if(this->m_ptr_glTangent3svEXT){this->m_next_glTangent3svEXT = this->m_ptr_glTangent3svEXT;this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&ProfileTableDecorator::m_glTangent3svEXT_profile;}
+if(this->m_ptr_glVertexAttribParameteriAMD){this->m_next_glVertexAttribParameteriAMD = this->m_ptr_glVertexAttribParameteriAMD;this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&ProfileTableDecorator::m_glVertexAttribParameteriAMD_profile;}
+if(this->m_ptr_glBufferSubDataARB){this->m_next_glBufferSubDataARB = this->m_ptr_glBufferSubDataARB;this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&ProfileTableDecorator::m_glBufferSubDataARB_profile;}
+if(this->m_ptr_glGetVertexAttribLui64vARB){this->m_next_glGetVertexAttribLui64vARB = this->m_ptr_glGetVertexAttribLui64vARB;this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&ProfileTableDecorator::m_glGetVertexAttribLui64vARB_profile;}
+if(this->m_ptr_glVertexAttribL4ui64NV){this->m_next_glVertexAttribL4ui64NV = this->m_ptr_glVertexAttribL4ui64NV;this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&ProfileTableDecorator::m_glVertexAttribL4ui64NV_profile;}
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN){this->m_next_glReplacementCodeuiColor4ubVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN;this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_profile;}
+if(this->m_ptr_glImageTransformParameterfHP){this->m_next_glImageTransformParameterfHP = this->m_ptr_glImageTransformParameterfHP;this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&ProfileTableDecorator::m_glImageTransformParameterfHP_profile;}
+if(this->m_ptr_glMap1f){this->m_next_glMap1f = this->m_ptr_glMap1f;this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&ProfileTableDecorator::m_glMap1f_profile;}
+if(this->m_ptr_glRasterPos4fv){this->m_next_glRasterPos4fv = this->m_ptr_glRasterPos4fv;this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&ProfileTableDecorator::m_glRasterPos4fv_profile;}
+if(this->m_ptr_glVertex2bvOES){this->m_next_glVertex2bvOES = this->m_ptr_glVertex2bvOES;this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&ProfileTableDecorator::m_glVertex2bvOES_profile;}
+if(this->m_ptr_glGetMapControlPointsNV){this->m_next_glGetMapControlPointsNV = this->m_ptr_glGetMapControlPointsNV;this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&ProfileTableDecorator::m_glGetMapControlPointsNV_profile;}
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT){this->m_next_glNamedProgramLocalParametersI4ivEXT = this->m_ptr_glNamedProgramLocalParametersI4ivEXT;this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_profile;}
+if(this->m_ptr_glBindBufferRangeNV){this->m_next_glBindBufferRangeNV = this->m_ptr_glBindBufferRangeNV;this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&ProfileTableDecorator::m_glBindBufferRangeNV_profile;}
+if(this->m_ptr_glVertexStream3dvATI){this->m_next_glVertexStream3dvATI = this->m_ptr_glVertexStream3dvATI;this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&ProfileTableDecorator::m_glVertexStream3dvATI_profile;}
+if(this->m_ptr_glNormalPointerListIBM){this->m_next_glNormalPointerListIBM = this->m_ptr_glNormalPointerListIBM;this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&ProfileTableDecorator::m_glNormalPointerListIBM_profile;}
+if(this->m_ptr_glFogFuncSGIS){this->m_next_glFogFuncSGIS = this->m_ptr_glFogFuncSGIS;this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&ProfileTableDecorator::m_glFogFuncSGIS_profile;}
+if(this->m_ptr_glMultiModeDrawArraysIBM){this->m_next_glMultiModeDrawArraysIBM = this->m_ptr_glMultiModeDrawArraysIBM;this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&ProfileTableDecorator::m_glMultiModeDrawArraysIBM_profile;}
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT){this->m_next_glGetNamedFramebufferAttachmentParameterivEXT = this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT;this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_profile;}
+if(this->m_ptr_glGetFloatv){this->m_next_glGetFloatv = this->m_ptr_glGetFloatv;this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&ProfileTableDecorator::m_glGetFloatv_profile;}
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT){this->m_next_glVertexArrayVertexAttribIFormatEXT = this->m_ptr_glVertexArrayVertexAttribIFormatEXT;this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&ProfileTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_profile;}
+if(this->m_ptr_glHint){this->m_next_glHint = this->m_ptr_glHint;this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&ProfileTableDecorator::m_glHint_profile;}
+if(this->m_ptr_glVertexStream2svATI){this->m_next_glVertexStream2svATI = this->m_ptr_glVertexStream2svATI;this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&ProfileTableDecorator::m_glVertexStream2svATI_profile;}
+if(this->m_ptr_glMultiDrawArraysIndirect){this->m_next_glMultiDrawArraysIndirect = this->m_ptr_glMultiDrawArraysIndirect;this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&ProfileTableDecorator::m_glMultiDrawArraysIndirect_profile;}
+if(this->m_ptr_glMultiTexEnvfvEXT){this->m_next_glMultiTexEnvfvEXT = this->m_ptr_glMultiTexEnvfvEXT;this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&ProfileTableDecorator::m_glMultiTexEnvfvEXT_profile;}
+if(this->m_ptr_glVertexAttribP2uiv){this->m_next_glVertexAttribP2uiv = this->m_ptr_glVertexAttribP2uiv;this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&ProfileTableDecorator::m_glVertexAttribP2uiv_profile;}
+if(this->m_ptr_glProgramUniform1i64vARB){this->m_next_glProgramUniform1i64vARB = this->m_ptr_glProgramUniform1i64vARB;this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&ProfileTableDecorator::m_glProgramUniform1i64vARB_profile;}
+if(this->m_ptr_glFramebufferTextureARB){this->m_next_glFramebufferTextureARB = this->m_ptr_glFramebufferTextureARB;this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&ProfileTableDecorator::m_glFramebufferTextureARB_profile;}
+if(this->m_ptr_glPushClientAttribDefaultEXT){this->m_next_glPushClientAttribDefaultEXT = this->m_ptr_glPushClientAttribDefaultEXT;this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&ProfileTableDecorator::m_glPushClientAttribDefaultEXT_profile;}
+if(this->m_ptr_glScalef){this->m_next_glScalef = this->m_ptr_glScalef;this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&ProfileTableDecorator::m_glScalef_profile;}
+if(this->m_ptr_glScaled){this->m_next_glScaled = this->m_ptr_glScaled;this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&ProfileTableDecorator::m_glScaled_profile;}
+if(this->m_ptr_glGetConvolutionParameterxvOES){this->m_next_glGetConvolutionParameterxvOES = this->m_ptr_glGetConvolutionParameterxvOES;this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&ProfileTableDecorator::m_glGetConvolutionParameterxvOES_profile;}
+if(this->m_ptr_glGetProgramResourceName){this->m_next_glGetProgramResourceName = this->m_ptr_glGetProgramResourceName;this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&ProfileTableDecorator::m_glGetProgramResourceName_profile;}
+if(this->m_ptr_glCopyColorTable){this->m_next_glCopyColorTable = this->m_ptr_glCopyColorTable;this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&ProfileTableDecorator::m_glCopyColorTable_profile;}
+if(this->m_ptr_glDepthRangeArrayv){this->m_next_glDepthRangeArrayv = this->m_ptr_glDepthRangeArrayv;this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&ProfileTableDecorator::m_glDepthRangeArrayv_profile;}
+if(this->m_ptr_glCoverFillPathInstancedNV){this->m_next_glCoverFillPathInstancedNV = this->m_ptr_glCoverFillPathInstancedNV;this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glCoverFillPathInstancedNV_profile;}
+if(this->m_ptr_glMultiTexParameterivEXT){this->m_next_glMultiTexParameterivEXT = this->m_ptr_glMultiTexParameterivEXT;this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glMultiTexParameterivEXT_profile;}
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv){this->m_next_glGetActiveAtomicCounterBufferiv = this->m_ptr_glGetActiveAtomicCounterBufferiv;this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&ProfileTableDecorator::m_glGetActiveAtomicCounterBufferiv_profile;}
+if(this->m_ptr_glStencilOpSeparate){this->m_next_glStencilOpSeparate = this->m_ptr_glStencilOpSeparate;this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&ProfileTableDecorator::m_glStencilOpSeparate_profile;}
+if(this->m_ptr_glVertexAttrib4fNV){this->m_next_glVertexAttrib4fNV = this->m_ptr_glVertexAttrib4fNV;this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&ProfileTableDecorator::m_glVertexAttrib4fNV_profile;}
+if(this->m_ptr_glGetColorTableParameterivSGI){this->m_next_glGetColorTableParameterivSGI = this->m_ptr_glGetColorTableParameterivSGI;this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&ProfileTableDecorator::m_glGetColorTableParameterivSGI_profile;}
+if(this->m_ptr_glVertexArrayAttribBinding){this->m_next_glVertexArrayAttribBinding = this->m_ptr_glVertexArrayAttribBinding;this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&ProfileTableDecorator::m_glVertexArrayAttribBinding_profile;}
+if(this->m_ptr_glIsSemaphoreEXT){this->m_next_glIsSemaphoreEXT = this->m_ptr_glIsSemaphoreEXT;this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&ProfileTableDecorator::m_glIsSemaphoreEXT_profile;}
+if(this->m_ptr_glProgramParameters4dvNV){this->m_next_glProgramParameters4dvNV = this->m_ptr_glProgramParameters4dvNV;this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&ProfileTableDecorator::m_glProgramParameters4dvNV_profile;}
+if(this->m_ptr_glVertexAttribL4dv){this->m_next_glVertexAttribL4dv = this->m_ptr_glVertexAttribL4dv;this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&ProfileTableDecorator::m_glVertexAttribL4dv_profile;}
+if(this->m_ptr_glGetTexParameteriv){this->m_next_glGetTexParameteriv = this->m_ptr_glGetTexParameteriv;this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&ProfileTableDecorator::m_glGetTexParameteriv_profile;}
+if(this->m_ptr_glGetUniformOffsetEXT){this->m_next_glGetUniformOffsetEXT = this->m_ptr_glGetUniformOffsetEXT;this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&ProfileTableDecorator::m_glGetUniformOffsetEXT_profile;}
+if(this->m_ptr_glGetVertexAttribPointerv){this->m_next_glGetVertexAttribPointerv = this->m_ptr_glGetVertexAttribPointerv;this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&ProfileTableDecorator::m_glGetVertexAttribPointerv_profile;}
+if(this->m_ptr_glResumeTransformFeedbackNV){this->m_next_glResumeTransformFeedbackNV = this->m_ptr_glResumeTransformFeedbackNV;this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glResumeTransformFeedbackNV_profile;}
+if(this->m_ptr_glProgramUniform3i64vNV){this->m_next_glProgramUniform3i64vNV = this->m_ptr_glProgramUniform3i64vNV;this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&ProfileTableDecorator::m_glProgramUniform3i64vNV_profile;}
+if(this->m_ptr_glTangent3fEXT){this->m_next_glTangent3fEXT = this->m_ptr_glTangent3fEXT;this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&ProfileTableDecorator::m_glTangent3fEXT_profile;}
+if(this->m_ptr_glGetPathMetricRangeNV){this->m_next_glGetPathMetricRangeNV = this->m_ptr_glGetPathMetricRangeNV;this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&ProfileTableDecorator::m_glGetPathMetricRangeNV_profile;}
+if(this->m_ptr_glWindowPos2iMESA){this->m_next_glWindowPos2iMESA = this->m_ptr_glWindowPos2iMESA;this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&ProfileTableDecorator::m_glWindowPos2iMESA_profile;}
+if(this->m_ptr_glVertex2xvOES){this->m_next_glVertex2xvOES = this->m_ptr_glVertex2xvOES;this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&ProfileTableDecorator::m_glVertex2xvOES_profile;}
+if(this->m_ptr_glGetnCompressedTexImage){this->m_next_glGetnCompressedTexImage = this->m_ptr_glGetnCompressedTexImage;this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&ProfileTableDecorator::m_glGetnCompressedTexImage_profile;}
+if(this->m_ptr_glWindowPos2dv){this->m_next_glWindowPos2dv = this->m_ptr_glWindowPos2dv;this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&ProfileTableDecorator::m_glWindowPos2dv_profile;}
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN){this->m_next_glReplacementCodeuiVertex3fSUN = this->m_ptr_glReplacementCodeuiVertex3fSUN;this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&ProfileTableDecorator::m_glReplacementCodeuiVertex3fSUN_profile;}
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT){this->m_next_glGetTransformFeedbackVaryingEXT = this->m_ptr_glGetTransformFeedbackVaryingEXT;this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&ProfileTableDecorator::m_glGetTransformFeedbackVaryingEXT_profile;}
+if(this->m_ptr_glWindowPos3fARB){this->m_next_glWindowPos3fARB = this->m_ptr_glWindowPos3fARB;this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&ProfileTableDecorator::m_glWindowPos3fARB_profile;}
+if(this->m_ptr_glMapNamedBufferEXT){this->m_next_glMapNamedBufferEXT = this->m_ptr_glMapNamedBufferEXT;this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&ProfileTableDecorator::m_glMapNamedBufferEXT_profile;}
+if(this->m_ptr_glDisable){this->m_next_glDisable = this->m_ptr_glDisable;this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&ProfileTableDecorator::m_glDisable_profile;}
+if(this->m_ptr_glIsPointInFillPathNV){this->m_next_glIsPointInFillPathNV = this->m_ptr_glIsPointInFillPathNV;this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&ProfileTableDecorator::m_glIsPointInFillPathNV_profile;}
+if(this->m_ptr_glVertexAttribI2uiEXT){this->m_next_glVertexAttribI2uiEXT = this->m_ptr_glVertexAttribI2uiEXT;this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&ProfileTableDecorator::m_glVertexAttribI2uiEXT_profile;}
+if(this->m_ptr_glProgramUniform4uiv){this->m_next_glProgramUniform4uiv = this->m_ptr_glProgramUniform4uiv;this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&ProfileTableDecorator::m_glProgramUniform4uiv_profile;}
+if(this->m_ptr_glQueryCounter){this->m_next_glQueryCounter = this->m_ptr_glQueryCounter;this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&ProfileTableDecorator::m_glQueryCounter_profile;}
+if(this->m_ptr_glFramebufferRenderbufferEXT){this->m_next_glFramebufferRenderbufferEXT = this->m_ptr_glFramebufferRenderbufferEXT;this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glFramebufferRenderbufferEXT_profile;}
+if(this->m_ptr_glBinormal3svEXT){this->m_next_glBinormal3svEXT = this->m_ptr_glBinormal3svEXT;this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&ProfileTableDecorator::m_glBinormal3svEXT_profile;}
+if(this->m_ptr_glBindBufferOffsetNV){this->m_next_glBindBufferOffsetNV = this->m_ptr_glBindBufferOffsetNV;this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&ProfileTableDecorator::m_glBindBufferOffsetNV_profile;}
+if(this->m_ptr_glCopyTextureSubImage2D){this->m_next_glCopyTextureSubImage2D = this->m_ptr_glCopyTextureSubImage2D;this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&ProfileTableDecorator::m_glCopyTextureSubImage2D_profile;}
+if(this->m_ptr_glGetProgramResourcefvNV){this->m_next_glGetProgramResourcefvNV = this->m_ptr_glGetProgramResourcefvNV;this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&ProfileTableDecorator::m_glGetProgramResourcefvNV_profile;}
+if(this->m_ptr_glBinormalPointerEXT){this->m_next_glBinormalPointerEXT = this->m_ptr_glBinormalPointerEXT;this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&ProfileTableDecorator::m_glBinormalPointerEXT_profile;}
+if(this->m_ptr_glGetLightfv){this->m_next_glGetLightfv = this->m_ptr_glGetLightfv;this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&ProfileTableDecorator::m_glGetLightfv_profile;}
+if(this->m_ptr_glMulticastCopyImageSubDataNV){this->m_next_glMulticastCopyImageSubDataNV = this->m_ptr_glMulticastCopyImageSubDataNV;this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&ProfileTableDecorator::m_glMulticastCopyImageSubDataNV_profile;}
+if(this->m_ptr_glVertex2bOES){this->m_next_glVertex2bOES = this->m_ptr_glVertex2bOES;this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&ProfileTableDecorator::m_glVertex2bOES_profile;}
+if(this->m_ptr_glUniform2ivARB){this->m_next_glUniform2ivARB = this->m_ptr_glUniform2ivARB;this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&ProfileTableDecorator::m_glUniform2ivARB_profile;}
+if(this->m_ptr_glMultiTexCoord3s){this->m_next_glMultiTexCoord3s = this->m_ptr_glMultiTexCoord3s;this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&ProfileTableDecorator::m_glMultiTexCoord3s_profile;}
+if(this->m_ptr_glGetHistogramParameterfvEXT){this->m_next_glGetHistogramParameterfvEXT = this->m_ptr_glGetHistogramParameterfvEXT;this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glGetHistogramParameterfvEXT_profile;}
+if(this->m_ptr_glGetProgramStringNV){this->m_next_glGetProgramStringNV = this->m_ptr_glGetProgramStringNV;this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&ProfileTableDecorator::m_glGetProgramStringNV_profile;}
+if(this->m_ptr_glGetTexGenxvOES){this->m_next_glGetTexGenxvOES = this->m_ptr_glGetTexGenxvOES;this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&ProfileTableDecorator::m_glGetTexGenxvOES_profile;}
+if(this->m_ptr_glTextureSubImage2D){this->m_next_glTextureSubImage2D = this->m_ptr_glTextureSubImage2D;this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&ProfileTableDecorator::m_glTextureSubImage2D_profile;}
+if(this->m_ptr_glObjectPurgeableAPPLE){this->m_next_glObjectPurgeableAPPLE = this->m_ptr_glObjectPurgeableAPPLE;this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&ProfileTableDecorator::m_glObjectPurgeableAPPLE_profile;}
+if(this->m_ptr_glColorTableSGI){this->m_next_glColorTableSGI = this->m_ptr_glColorTableSGI;this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&ProfileTableDecorator::m_glColorTableSGI_profile;}
+if(this->m_ptr_glCopyConvolutionFilter2DEXT){this->m_next_glCopyConvolutionFilter2DEXT = this->m_ptr_glCopyConvolutionFilter2DEXT;this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&ProfileTableDecorator::m_glCopyConvolutionFilter2DEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3f){this->m_next_glMultiTexCoord3f = this->m_ptr_glMultiTexCoord3f;this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&ProfileTableDecorator::m_glMultiTexCoord3f_profile;}
+if(this->m_ptr_glMultiTexCoord3d){this->m_next_glMultiTexCoord3d = this->m_ptr_glMultiTexCoord3d;this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&ProfileTableDecorator::m_glMultiTexCoord3d_profile;}
+if(this->m_ptr_glFogCoorddv){this->m_next_glFogCoorddv = this->m_ptr_glFogCoorddv;this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&ProfileTableDecorator::m_glFogCoorddv_profile;}
+if(this->m_ptr_glGetBufferPointerv){this->m_next_glGetBufferPointerv = this->m_ptr_glGetBufferPointerv;this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&ProfileTableDecorator::m_glGetBufferPointerv_profile;}
+if(this->m_ptr_glProgramUniform1fEXT){this->m_next_glProgramUniform1fEXT = this->m_ptr_glProgramUniform1fEXT;this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&ProfileTableDecorator::m_glProgramUniform1fEXT_profile;}
+if(this->m_ptr_glWindowPos2fvMESA){this->m_next_glWindowPos2fvMESA = this->m_ptr_glWindowPos2fvMESA;this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&ProfileTableDecorator::m_glWindowPos2fvMESA_profile;}
+if(this->m_ptr_glAlphaToCoverageDitherControlNV){this->m_next_glAlphaToCoverageDitherControlNV = this->m_ptr_glAlphaToCoverageDitherControlNV;this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&ProfileTableDecorator::m_glAlphaToCoverageDitherControlNV_profile;}
+if(this->m_ptr_glPolygonOffsetxOES){this->m_next_glPolygonOffsetxOES = this->m_ptr_glPolygonOffsetxOES;this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&ProfileTableDecorator::m_glPolygonOffsetxOES_profile;}
+if(this->m_ptr_glVertexAttrib4dARB){this->m_next_glVertexAttrib4dARB = this->m_ptr_glVertexAttrib4dARB;this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&ProfileTableDecorator::m_glVertexAttrib4dARB_profile;}
+if(this->m_ptr_glUniformHandleui64vARB){this->m_next_glUniformHandleui64vARB = this->m_ptr_glUniformHandleui64vARB;this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&ProfileTableDecorator::m_glUniformHandleui64vARB_profile;}
+if(this->m_ptr_glFragmentLightModelfvSGIX){this->m_next_glFragmentLightModelfvSGIX = this->m_ptr_glFragmentLightModelfvSGIX;this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&ProfileTableDecorator::m_glFragmentLightModelfvSGIX_profile;}
+if(this->m_ptr_glSwizzleEXT){this->m_next_glSwizzleEXT = this->m_ptr_glSwizzleEXT;this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&ProfileTableDecorator::m_glSwizzleEXT_profile;}
+if(this->m_ptr_glBindFragmentShaderATI){this->m_next_glBindFragmentShaderATI = this->m_ptr_glBindFragmentShaderATI;this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&ProfileTableDecorator::m_glBindFragmentShaderATI_profile;}
+if(this->m_ptr_glVertexAttribs3hvNV){this->m_next_glVertexAttribs3hvNV = this->m_ptr_glVertexAttribs3hvNV;this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&ProfileTableDecorator::m_glVertexAttribs3hvNV_profile;}
+if(this->m_ptr_glGenBuffersARB){this->m_next_glGenBuffersARB = this->m_ptr_glGenBuffersARB;this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&ProfileTableDecorator::m_glGenBuffersARB_profile;}
+if(this->m_ptr_glTextureStorageMem2DMultisampleEXT){this->m_next_glTextureStorageMem2DMultisampleEXT = this->m_ptr_glTextureStorageMem2DMultisampleEXT;this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&ProfileTableDecorator::m_glTextureStorageMem2DMultisampleEXT_profile;}
+if(this->m_ptr_glListParameterfvSGIX){this->m_next_glListParameterfvSGIX = this->m_ptr_glListParameterfvSGIX;this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&ProfileTableDecorator::m_glListParameterfvSGIX_profile;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisample){this->m_next_glNamedRenderbufferStorageMultisample = this->m_ptr_glNamedRenderbufferStorageMultisample;this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfileTableDecorator::m_glNamedRenderbufferStorageMultisample_profile;}
+if(this->m_ptr_glVertexAttribI1iEXT){this->m_next_glVertexAttribI1iEXT = this->m_ptr_glVertexAttribI1iEXT;this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&ProfileTableDecorator::m_glVertexAttribI1iEXT_profile;}
+if(this->m_ptr_glMultiTexCoord2ivARB){this->m_next_glMultiTexCoord2ivARB = this->m_ptr_glMultiTexCoord2ivARB;this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2ivARB_profile;}
+if(this->m_ptr_glLightModelxOES){this->m_next_glLightModelxOES = this->m_ptr_glLightModelxOES;this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&ProfileTableDecorator::m_glLightModelxOES_profile;}
+if(this->m_ptr_glColor3xOES){this->m_next_glColor3xOES = this->m_ptr_glColor3xOES;this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&ProfileTableDecorator::m_glColor3xOES_profile;}
+if(this->m_ptr_glReadBuffer){this->m_next_glReadBuffer = this->m_ptr_glReadBuffer;this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&ProfileTableDecorator::m_glReadBuffer_profile;}
+if(this->m_ptr_glStencilFillPathInstancedNV){this->m_next_glStencilFillPathInstancedNV = this->m_ptr_glStencilFillPathInstancedNV;this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&ProfileTableDecorator::m_glStencilFillPathInstancedNV_profile;}
+if(this->m_ptr_glVDPAUUnmapSurfacesNV){this->m_next_glVDPAUUnmapSurfacesNV = this->m_ptr_glVDPAUUnmapSurfacesNV;this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&ProfileTableDecorator::m_glVDPAUUnmapSurfacesNV_profile;}
+if(this->m_ptr_glProgramUniform4i64NV){this->m_next_glProgramUniform4i64NV = this->m_ptr_glProgramUniform4i64NV;this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&ProfileTableDecorator::m_glProgramUniform4i64NV_profile;}
+if(this->m_ptr_glVertexStream4dvATI){this->m_next_glVertexStream4dvATI = this->m_ptr_glVertexStream4dvATI;this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&ProfileTableDecorator::m_glVertexStream4dvATI_profile;}
+if(this->m_ptr_glIsQuery){this->m_next_glIsQuery = this->m_ptr_glIsQuery;this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&ProfileTableDecorator::m_glIsQuery_profile;}
+if(this->m_ptr_glProgramUniformMatrix4fvEXT){this->m_next_glProgramUniformMatrix4fvEXT = this->m_ptr_glProgramUniformMatrix4fvEXT;this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4fvEXT_profile;}
+if(this->m_ptr_glVertexAttrib3hNV){this->m_next_glVertexAttrib3hNV = this->m_ptr_glVertexAttrib3hNV;this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&ProfileTableDecorator::m_glVertexAttrib3hNV_profile;}
+if(this->m_ptr_glFlushMappedNamedBufferRange){this->m_next_glFlushMappedNamedBufferRange = this->m_ptr_glFlushMappedNamedBufferRange;this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&ProfileTableDecorator::m_glFlushMappedNamedBufferRange_profile;}
+if(this->m_ptr_glPushName){this->m_next_glPushName = this->m_ptr_glPushName;this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&ProfileTableDecorator::m_glPushName_profile;}
+if(this->m_ptr_glGetClipPlane){this->m_next_glGetClipPlane = this->m_ptr_glGetClipPlane;this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&ProfileTableDecorator::m_glGetClipPlane_profile;}
+if(this->m_ptr_glVertex4dv){this->m_next_glVertex4dv = this->m_ptr_glVertex4dv;this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&ProfileTableDecorator::m_glVertex4dv_profile;}
+if(this->m_ptr_glVertexAttrib3d){this->m_next_glVertexAttrib3d = this->m_ptr_glVertexAttrib3d;this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&ProfileTableDecorator::m_glVertexAttrib3d_profile;}
+if(this->m_ptr_glBlendColor){this->m_next_glBlendColor = this->m_ptr_glBlendColor;this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&ProfileTableDecorator::m_glBlendColor_profile;}
+if(this->m_ptr_glBindTransformFeedbackNV){this->m_next_glBindTransformFeedbackNV = this->m_ptr_glBindTransformFeedbackNV;this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glBindTransformFeedbackNV_profile;}
+if(this->m_ptr_glSamplerParameterIuiv){this->m_next_glSamplerParameterIuiv = this->m_ptr_glSamplerParameterIuiv;this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&ProfileTableDecorator::m_glSamplerParameterIuiv_profile;}
+if(this->m_ptr_glIndexubv){this->m_next_glIndexubv = this->m_ptr_glIndexubv;this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&ProfileTableDecorator::m_glIndexubv_profile;}
+if(this->m_ptr_glNamedBufferPageCommitmentEXT){this->m_next_glNamedBufferPageCommitmentEXT = this->m_ptr_glNamedBufferPageCommitmentEXT;this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&ProfileTableDecorator::m_glNamedBufferPageCommitmentEXT_profile;}
+if(this->m_ptr_glCheckNamedFramebufferStatus){this->m_next_glCheckNamedFramebufferStatus = this->m_ptr_glCheckNamedFramebufferStatus;this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&ProfileTableDecorator::m_glCheckNamedFramebufferStatus_profile;}
+if(this->m_ptr_glGetObjectBufferfvATI){this->m_next_glGetObjectBufferfvATI = this->m_ptr_glGetObjectBufferfvATI;this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&ProfileTableDecorator::m_glGetObjectBufferfvATI_profile;}
+if(this->m_ptr_glRasterPos4d){this->m_next_glRasterPos4d = this->m_ptr_glRasterPos4d;this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&ProfileTableDecorator::m_glRasterPos4d_profile;}
+if(this->m_ptr_glRasterPos4f){this->m_next_glRasterPos4f = this->m_ptr_glRasterPos4f;this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&ProfileTableDecorator::m_glRasterPos4f_profile;}
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD){this->m_next_glGetPerfMonitorCounterStringAMD = this->m_ptr_glGetPerfMonitorCounterStringAMD;this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorCounterStringAMD_profile;}
+if(this->m_ptr_glVertexAttrib3s){this->m_next_glVertexAttrib3s = this->m_ptr_glVertexAttrib3s;this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&ProfileTableDecorator::m_glVertexAttrib3s_profile;}
+if(this->m_ptr_glDrawElementsInstancedEXT){this->m_next_glDrawElementsInstancedEXT = this->m_ptr_glDrawElementsInstancedEXT;this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&ProfileTableDecorator::m_glDrawElementsInstancedEXT_profile;}
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT){this->m_next_glNamedProgramLocalParameterI4iEXT = this->m_ptr_glNamedProgramLocalParameterI4iEXT;this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameterI4iEXT_profile;}
+if(this->m_ptr_glRasterPos4s){this->m_next_glRasterPos4s = this->m_ptr_glRasterPos4s;this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&ProfileTableDecorator::m_glRasterPos4s_profile;}
+if(this->m_ptr_glGetProgramStageiv){this->m_next_glGetProgramStageiv = this->m_ptr_glGetProgramStageiv;this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&ProfileTableDecorator::m_glGetProgramStageiv_profile;}
+if(this->m_ptr_glGetMaterialxOES){this->m_next_glGetMaterialxOES = this->m_ptr_glGetMaterialxOES;this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&ProfileTableDecorator::m_glGetMaterialxOES_profile;}
+if(this->m_ptr_glPopMatrix){this->m_next_glPopMatrix = this->m_ptr_glPopMatrix;this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&ProfileTableDecorator::m_glPopMatrix_profile;}
+if(this->m_ptr_glGetVideoui64vNV){this->m_next_glGetVideoui64vNV = this->m_ptr_glGetVideoui64vNV;this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&ProfileTableDecorator::m_glGetVideoui64vNV_profile;}
+if(this->m_ptr_glTangent3bEXT){this->m_next_glTangent3bEXT = this->m_ptr_glTangent3bEXT;this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&ProfileTableDecorator::m_glTangent3bEXT_profile;}
+if(this->m_ptr_glGetGraphicsResetStatusARB){this->m_next_glGetGraphicsResetStatusARB = this->m_ptr_glGetGraphicsResetStatusARB;this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&ProfileTableDecorator::m_glGetGraphicsResetStatusARB_profile;}
+if(this->m_ptr_glUniform4i){this->m_next_glUniform4i = this->m_ptr_glUniform4i;this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&ProfileTableDecorator::m_glUniform4i_profile;}
+if(this->m_ptr_glActiveTexture){this->m_next_glActiveTexture = this->m_ptr_glActiveTexture;this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&ProfileTableDecorator::m_glActiveTexture_profile;}
+if(this->m_ptr_glEnableVertexAttribArray){this->m_next_glEnableVertexAttribArray = this->m_ptr_glEnableVertexAttribArray;this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&ProfileTableDecorator::m_glEnableVertexAttribArray_profile;}
+if(this->m_ptr_glTexCoord4fVertex4fvSUN){this->m_next_glTexCoord4fVertex4fvSUN = this->m_ptr_glTexCoord4fVertex4fvSUN;this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&ProfileTableDecorator::m_glTexCoord4fVertex4fvSUN_profile;}
+if(this->m_ptr_glUniform4d){this->m_next_glUniform4d = this->m_ptr_glUniform4d;this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&ProfileTableDecorator::m_glUniform4d_profile;}
+if(this->m_ptr_glUniform4f){this->m_next_glUniform4f = this->m_ptr_glUniform4f;this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&ProfileTableDecorator::m_glUniform4f_profile;}
+if(this->m_ptr_glRenderbufferStorageMultisample){this->m_next_glRenderbufferStorageMultisample = this->m_ptr_glRenderbufferStorageMultisample;this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfileTableDecorator::m_glRenderbufferStorageMultisample_profile;}
+if(this->m_ptr_glCreateProgramPipelines){this->m_next_glCreateProgramPipelines = this->m_ptr_glCreateProgramPipelines;this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&ProfileTableDecorator::m_glCreateProgramPipelines_profile;}
+if(this->m_ptr_glVertexAttribLPointer){this->m_next_glVertexAttribLPointer = this->m_ptr_glVertexAttribLPointer;this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&ProfileTableDecorator::m_glVertexAttribLPointer_profile;}
+if(this->m_ptr_glUniform2uiEXT){this->m_next_glUniform2uiEXT = this->m_ptr_glUniform2uiEXT;this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&ProfileTableDecorator::m_glUniform2uiEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3sv){this->m_next_glMultiTexCoord3sv = this->m_ptr_glMultiTexCoord3sv;this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&ProfileTableDecorator::m_glMultiTexCoord3sv_profile;}
+if(this->m_ptr_glDrawElementsInstancedBaseVertex){this->m_next_glDrawElementsInstancedBaseVertex = this->m_ptr_glDrawElementsInstancedBaseVertex;this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&ProfileTableDecorator::m_glDrawElementsInstancedBaseVertex_profile;}
+if(this->m_ptr_glPixelTransformParameterfvEXT){this->m_next_glPixelTransformParameterfvEXT = this->m_ptr_glPixelTransformParameterfvEXT;this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glPixelTransformParameterfvEXT_profile;}
+if(this->m_ptr_glDrawTransformFeedbackNV){this->m_next_glDrawTransformFeedbackNV = this->m_ptr_glDrawTransformFeedbackNV;this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glDrawTransformFeedbackNV_profile;}
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV){this->m_next_glTextureImage2DMultisampleCoverageNV = this->m_ptr_glTextureImage2DMultisampleCoverageNV;this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfileTableDecorator::m_glTextureImage2DMultisampleCoverageNV_profile;}
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT){this->m_next_glNamedRenderbufferStorageMultisampleCoverageEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT;this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&ProfileTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_profile;}
+if(this->m_ptr_glIsTexture){this->m_next_glIsTexture = this->m_ptr_glIsTexture;this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&ProfileTableDecorator::m_glIsTexture_profile;}
+if(this->m_ptr_glMultiTexCoord4iv){this->m_next_glMultiTexCoord4iv = this->m_ptr_glMultiTexCoord4iv;this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&ProfileTableDecorator::m_glMultiTexCoord4iv_profile;}
+if(this->m_ptr_glTexEnvfv){this->m_next_glTexEnvfv = this->m_ptr_glTexEnvfv;this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&ProfileTableDecorator::m_glTexEnvfv_profile;}
+if(this->m_ptr_glPopDebugGroup){this->m_next_glPopDebugGroup = this->m_ptr_glPopDebugGroup;this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&ProfileTableDecorator::m_glPopDebugGroup_profile;}
+if(this->m_ptr_glUniformBlockBinding){this->m_next_glUniformBlockBinding = this->m_ptr_glUniformBlockBinding;this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&ProfileTableDecorator::m_glUniformBlockBinding_profile;}
+if(this->m_ptr_glWindowPos2svMESA){this->m_next_glWindowPos2svMESA = this->m_ptr_glWindowPos2svMESA;this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&ProfileTableDecorator::m_glWindowPos2svMESA_profile;}
+if(this->m_ptr_glGenerateTextureMipmapEXT){this->m_next_glGenerateTextureMipmapEXT = this->m_ptr_glGenerateTextureMipmapEXT;this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&ProfileTableDecorator::m_glGenerateTextureMipmapEXT_profile;}
+if(this->m_ptr_glBindLightParameterEXT){this->m_next_glBindLightParameterEXT = this->m_ptr_glBindLightParameterEXT;this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&ProfileTableDecorator::m_glBindLightParameterEXT_profile;}
+if(this->m_ptr_glTexCoord3bOES){this->m_next_glTexCoord3bOES = this->m_ptr_glTexCoord3bOES;this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&ProfileTableDecorator::m_glTexCoord3bOES_profile;}
+if(this->m_ptr_glTexCoordPointer){this->m_next_glTexCoordPointer = this->m_ptr_glTexCoordPointer;this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&ProfileTableDecorator::m_glTexCoordPointer_profile;}
+if(this->m_ptr_glProgramUniformMatrix3x2fv){this->m_next_glProgramUniformMatrix3x2fv = this->m_ptr_glProgramUniformMatrix3x2fv;this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix3x2fv_profile;}
+if(this->m_ptr_glUniform2fvARB){this->m_next_glUniform2fvARB = this->m_ptr_glUniform2fvARB;this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&ProfileTableDecorator::m_glUniform2fvARB_profile;}
+if(this->m_ptr_glProgramLocalParameterI4uivNV){this->m_next_glProgramLocalParameterI4uivNV = this->m_ptr_glProgramLocalParameterI4uivNV;this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&ProfileTableDecorator::m_glProgramLocalParameterI4uivNV_profile;}
+if(this->m_ptr_glFlushVertexArrayRangeNV){this->m_next_glFlushVertexArrayRangeNV = this->m_ptr_glFlushVertexArrayRangeNV;this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&ProfileTableDecorator::m_glFlushVertexArrayRangeNV_profile;}
+if(this->m_ptr_glSecondaryColor3svEXT){this->m_next_glSecondaryColor3svEXT = this->m_ptr_glSecondaryColor3svEXT;this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3svEXT_profile;}
+if(this->m_ptr_glGetBufferParameteriv){this->m_next_glGetBufferParameteriv = this->m_ptr_glGetBufferParameteriv;this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&ProfileTableDecorator::m_glGetBufferParameteriv_profile;}
+if(this->m_ptr_glGetQueryIndexediv){this->m_next_glGetQueryIndexediv = this->m_ptr_glGetQueryIndexediv;this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&ProfileTableDecorator::m_glGetQueryIndexediv_profile;}
+if(this->m_ptr_glFramebufferTexture3DEXT){this->m_next_glFramebufferTexture3DEXT = this->m_ptr_glFramebufferTexture3DEXT;this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&ProfileTableDecorator::m_glFramebufferTexture3DEXT_profile;}
+if(this->m_ptr_glLoadTransposeMatrixxOES){this->m_next_glLoadTransposeMatrixxOES = this->m_ptr_glLoadTransposeMatrixxOES;this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&ProfileTableDecorator::m_glLoadTransposeMatrixxOES_profile;}
+if(this->m_ptr_glDeleteTransformFeedbacksNV){this->m_next_glDeleteTransformFeedbacksNV = this->m_ptr_glDeleteTransformFeedbacksNV;this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&ProfileTableDecorator::m_glDeleteTransformFeedbacksNV_profile;}
+if(this->m_ptr_glGetCompressedTextureImageEXT){this->m_next_glGetCompressedTextureImageEXT = this->m_ptr_glGetCompressedTextureImageEXT;this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&ProfileTableDecorator::m_glGetCompressedTextureImageEXT_profile;}
+if(this->m_ptr_glIndexMaterialEXT){this->m_next_glIndexMaterialEXT = this->m_ptr_glIndexMaterialEXT;this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&ProfileTableDecorator::m_glIndexMaterialEXT_profile;}
+if(this->m_ptr_glFogCoorddEXT){this->m_next_glFogCoorddEXT = this->m_ptr_glFogCoorddEXT;this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&ProfileTableDecorator::m_glFogCoorddEXT_profile;}
+if(this->m_ptr_glTexCoord2hvNV){this->m_next_glTexCoord2hvNV = this->m_ptr_glTexCoord2hvNV;this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&ProfileTableDecorator::m_glTexCoord2hvNV_profile;}
+if(this->m_ptr_glGetFramebufferParameterfvAMD){this->m_next_glGetFramebufferParameterfvAMD = this->m_ptr_glGetFramebufferParameterfvAMD;this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&ProfileTableDecorator::m_glGetFramebufferParameterfvAMD_profile;}
+if(this->m_ptr_glTexEnviv){this->m_next_glTexEnviv = this->m_ptr_glTexEnviv;this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&ProfileTableDecorator::m_glTexEnviv_profile;}
+if(this->m_ptr_glEndTransformFeedbackNV){this->m_next_glEndTransformFeedbackNV = this->m_ptr_glEndTransformFeedbackNV;this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&ProfileTableDecorator::m_glEndTransformFeedbackNV_profile;}
+if(this->m_ptr_glGlobalAlphaFactoruiSUN){this->m_next_glGlobalAlphaFactoruiSUN = this->m_ptr_glGlobalAlphaFactoruiSUN;this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&ProfileTableDecorator::m_glGlobalAlphaFactoruiSUN_profile;}
+if(this->m_ptr_glSelectBuffer){this->m_next_glSelectBuffer = this->m_ptr_glSelectBuffer;this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&ProfileTableDecorator::m_glSelectBuffer_profile;}
+if(this->m_ptr_glNamedBufferSubDataEXT){this->m_next_glNamedBufferSubDataEXT = this->m_ptr_glNamedBufferSubDataEXT;this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&ProfileTableDecorator::m_glNamedBufferSubDataEXT_profile;}
+if(this->m_ptr_glDisableVertexArrayAttrib){this->m_next_glDisableVertexArrayAttrib = this->m_ptr_glDisableVertexArrayAttrib;this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&ProfileTableDecorator::m_glDisableVertexArrayAttrib_profile;}
+if(this->m_ptr_glBlendFunc){this->m_next_glBlendFunc = this->m_ptr_glBlendFunc;this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&ProfileTableDecorator::m_glBlendFunc_profile;}
+if(this->m_ptr_glCreateProgram){this->m_next_glCreateProgram = this->m_ptr_glCreateProgram;this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&ProfileTableDecorator::m_glCreateProgram_profile;}
+if(this->m_ptr_glVertexStream2dATI){this->m_next_glVertexStream2dATI = this->m_ptr_glVertexStream2dATI;this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&ProfileTableDecorator::m_glVertexStream2dATI_profile;}
+if(this->m_ptr_glUniform4ui64vARB){this->m_next_glUniform4ui64vARB = this->m_ptr_glUniform4ui64vARB;this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&ProfileTableDecorator::m_glUniform4ui64vARB_profile;}
+if(this->m_ptr_glGetSemaphoreParameterui64vEXT){this->m_next_glGetSemaphoreParameterui64vEXT = this->m_ptr_glGetSemaphoreParameterui64vEXT;this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&ProfileTableDecorator::m_glGetSemaphoreParameterui64vEXT_profile;}
+if(this->m_ptr_glPrimitiveRestartIndex){this->m_next_glPrimitiveRestartIndex = this->m_ptr_glPrimitiveRestartIndex;this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&ProfileTableDecorator::m_glPrimitiveRestartIndex_profile;}
+if(this->m_ptr_glNormalStream3fATI){this->m_next_glNormalStream3fATI = this->m_ptr_glNormalStream3fATI;this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&ProfileTableDecorator::m_glNormalStream3fATI_profile;}
+if(this->m_ptr_glProgramUniformMatrix2fv){this->m_next_glProgramUniformMatrix2fv = this->m_ptr_glProgramUniformMatrix2fv;this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix2fv_profile;}
+if(this->m_ptr_glVertexAttribs1hvNV){this->m_next_glVertexAttribs1hvNV = this->m_ptr_glVertexAttribs1hvNV;this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&ProfileTableDecorator::m_glVertexAttribs1hvNV_profile;}
+if(this->m_ptr_glWindowPos4svMESA){this->m_next_glWindowPos4svMESA = this->m_ptr_glWindowPos4svMESA;this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&ProfileTableDecorator::m_glWindowPos4svMESA_profile;}
+if(this->m_ptr_glDeleteFragmentShaderATI){this->m_next_glDeleteFragmentShaderATI = this->m_ptr_glDeleteFragmentShaderATI;this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&ProfileTableDecorator::m_glDeleteFragmentShaderATI_profile;}
+if(this->m_ptr_glBindImageTextures){this->m_next_glBindImageTextures = this->m_ptr_glBindImageTextures;this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&ProfileTableDecorator::m_glBindImageTextures_profile;}
+if(this->m_ptr_glMap2xOES){this->m_next_glMap2xOES = this->m_ptr_glMap2xOES;this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&ProfileTableDecorator::m_glMap2xOES_profile;}
+if(this->m_ptr_glEnd){this->m_next_glEnd = this->m_ptr_glEnd;this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&ProfileTableDecorator::m_glEnd_profile;}
+if(this->m_ptr_glMultiTexCoord2dARB){this->m_next_glMultiTexCoord2dARB = this->m_ptr_glMultiTexCoord2dARB;this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&ProfileTableDecorator::m_glMultiTexCoord2dARB_profile;}
+if(this->m_ptr_glUniform1i64NV){this->m_next_glUniform1i64NV = this->m_ptr_glUniform1i64NV;this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&ProfileTableDecorator::m_glUniform1i64NV_profile;}
+if(this->m_ptr_glPathStringNV){this->m_next_glPathStringNV = this->m_ptr_glPathStringNV;this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&ProfileTableDecorator::m_glPathStringNV_profile;}
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT){this->m_next_glGetNamedFramebufferParameterivEXT = this->m_ptr_glGetNamedFramebufferParameterivEXT;this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&ProfileTableDecorator::m_glGetNamedFramebufferParameterivEXT_profile;}
+if(this->m_ptr_glGetProgramNamedParameterdvNV){this->m_next_glGetProgramNamedParameterdvNV = this->m_ptr_glGetProgramNamedParameterdvNV;this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&ProfileTableDecorator::m_glGetProgramNamedParameterdvNV_profile;}
+if(this->m_ptr_glPathDashArrayNV){this->m_next_glPathDashArrayNV = this->m_ptr_glPathDashArrayNV;this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&ProfileTableDecorator::m_glPathDashArrayNV_profile;}
+if(this->m_ptr_glUniform3uiv){this->m_next_glUniform3uiv = this->m_ptr_glUniform3uiv;this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&ProfileTableDecorator::m_glUniform3uiv_profile;}
+if(this->m_ptr_glColor3fVertex3fvSUN){this->m_next_glColor3fVertex3fvSUN = this->m_ptr_glColor3fVertex3fvSUN;this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&ProfileTableDecorator::m_glColor3fVertex3fvSUN_profile;}
+if(this->m_ptr_glMultTransposeMatrixd){this->m_next_glMultTransposeMatrixd = this->m_ptr_glMultTransposeMatrixd;this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&ProfileTableDecorator::m_glMultTransposeMatrixd_profile;}
+if(this->m_ptr_glClearColor){this->m_next_glClearColor = this->m_ptr_glClearColor;this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&ProfileTableDecorator::m_glClearColor_profile;}
+if(this->m_ptr_glGetImageHandleARB){this->m_next_glGetImageHandleARB = this->m_ptr_glGetImageHandleARB;this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&ProfileTableDecorator::m_glGetImageHandleARB_profile;}
+if(this->m_ptr_glTangent3dEXT){this->m_next_glTangent3dEXT = this->m_ptr_glTangent3dEXT;this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&ProfileTableDecorator::m_glTangent3dEXT_profile;}
+if(this->m_ptr_glGetQueryObjectivARB){this->m_next_glGetQueryObjectivARB = this->m_ptr_glGetQueryObjectivARB;this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&ProfileTableDecorator::m_glGetQueryObjectivARB_profile;}
+if(this->m_ptr_glGetLocalConstantFloatvEXT){this->m_next_glGetLocalConstantFloatvEXT = this->m_ptr_glGetLocalConstantFloatvEXT;this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&ProfileTableDecorator::m_glGetLocalConstantFloatvEXT_profile;}
+if(this->m_ptr_glUseShaderProgramEXT){this->m_next_glUseShaderProgramEXT = this->m_ptr_glUseShaderProgramEXT;this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&ProfileTableDecorator::m_glUseShaderProgramEXT_profile;}
+if(this->m_ptr_glBindRenderbufferEXT){this->m_next_glBindRenderbufferEXT = this->m_ptr_glBindRenderbufferEXT;this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&ProfileTableDecorator::m_glBindRenderbufferEXT_profile;}
+if(this->m_ptr_glInterleavedArrays){this->m_next_glInterleavedArrays = this->m_ptr_glInterleavedArrays;this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&ProfileTableDecorator::m_glInterleavedArrays_profile;}
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD){this->m_next_glGetPerfMonitorGroupStringAMD = this->m_ptr_glGetPerfMonitorGroupStringAMD;this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&ProfileTableDecorator::m_glGetPerfMonitorGroupStringAMD_profile;}
+if(this->m_ptr_glUniform3ui){this->m_next_glUniform3ui = this->m_ptr_glUniform3ui;this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&ProfileTableDecorator::m_glUniform3ui_profile;}
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT){this->m_next_glGetNamedProgramLocalParameterdvEXT = this->m_ptr_glGetNamedProgramLocalParameterdvEXT;this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&ProfileTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_profile;}
+if(this->m_ptr_glDeleteQueryResourceTagNV){this->m_next_glDeleteQueryResourceTagNV = this->m_ptr_glDeleteQueryResourceTagNV;this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&ProfileTableDecorator::m_glDeleteQueryResourceTagNV_profile;}
+if(this->m_ptr_glVertexAttribI4uiv){this->m_next_glVertexAttribI4uiv = this->m_ptr_glVertexAttribI4uiv;this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&ProfileTableDecorator::m_glVertexAttribI4uiv_profile;}
+if(this->m_ptr_glVertexAttrib4bv){this->m_next_glVertexAttrib4bv = this->m_ptr_glVertexAttrib4bv;this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&ProfileTableDecorator::m_glVertexAttrib4bv_profile;}
+if(this->m_ptr_glMultiTexCoord3xOES){this->m_next_glMultiTexCoord3xOES = this->m_ptr_glMultiTexCoord3xOES;this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&ProfileTableDecorator::m_glMultiTexCoord3xOES_profile;}
+if(this->m_ptr_glSecondaryColor3ub){this->m_next_glSecondaryColor3ub = this->m_ptr_glSecondaryColor3ub;this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&ProfileTableDecorator::m_glSecondaryColor3ub_profile;}
+if(this->m_ptr_glFragmentMaterialfSGIX){this->m_next_glFragmentMaterialfSGIX = this->m_ptr_glFragmentMaterialfSGIX;this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&ProfileTableDecorator::m_glFragmentMaterialfSGIX_profile;}
+if(this->m_ptr_glGetVariantArrayObjectivATI){this->m_next_glGetVariantArrayObjectivATI = this->m_ptr_glGetVariantArrayObjectivATI;this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&ProfileTableDecorator::m_glGetVariantArrayObjectivATI_profile;}
+if(this->m_ptr_glSecondaryColor3ui){this->m_next_glSecondaryColor3ui = this->m_ptr_glSecondaryColor3ui;this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&ProfileTableDecorator::m_glSecondaryColor3ui_profile;}
+if(this->m_ptr_glVertexAttrib1dARB){this->m_next_glVertexAttrib1dARB = this->m_ptr_glVertexAttrib1dARB;this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&ProfileTableDecorator::m_glVertexAttrib1dARB_profile;}
+if(this->m_ptr_glGetNamedBufferPointerv){this->m_next_glGetNamedBufferPointerv = this->m_ptr_glGetNamedBufferPointerv;this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&ProfileTableDecorator::m_glGetNamedBufferPointerv_profile;}
+if(this->m_ptr_glLockArraysEXT){this->m_next_glLockArraysEXT = this->m_ptr_glLockArraysEXT;this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&ProfileTableDecorator::m_glLockArraysEXT_profile;}
+if(this->m_ptr_glVertexAttribPointerNV){this->m_next_glVertexAttribPointerNV = this->m_ptr_glVertexAttribPointerNV;this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&ProfileTableDecorator::m_glVertexAttribPointerNV_profile;}
+if(this->m_ptr_glConvolutionParameterf){this->m_next_glConvolutionParameterf = this->m_ptr_glConvolutionParameterf;this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&ProfileTableDecorator::m_glConvolutionParameterf_profile;}
+if(this->m_ptr_glBindBufferBaseEXT){this->m_next_glBindBufferBaseEXT = this->m_ptr_glBindBufferBaseEXT;this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&ProfileTableDecorator::m_glBindBufferBaseEXT_profile;}
+if(this->m_ptr_glTexCoord2xvOES){this->m_next_glTexCoord2xvOES = this->m_ptr_glTexCoord2xvOES;this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&ProfileTableDecorator::m_glTexCoord2xvOES_profile;}
+if(this->m_ptr_glGetQueryBufferObjectui64v){this->m_next_glGetQueryBufferObjectui64v = this->m_ptr_glGetQueryBufferObjectui64v;this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&ProfileTableDecorator::m_glGetQueryBufferObjectui64v_profile;}
+if(this->m_ptr_glSetMultisamplefvAMD){this->m_next_glSetMultisamplefvAMD = this->m_ptr_glSetMultisamplefvAMD;this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&ProfileTableDecorator::m_glSetMultisamplefvAMD_profile;}
+if(this->m_ptr_glPathColorGenNV){this->m_next_glPathColorGenNV = this->m_ptr_glPathColorGenNV;this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&ProfileTableDecorator::m_glPathColorGenNV_profile;}
+if(this->m_ptr_glVertexAttrib3sARB){this->m_next_glVertexAttrib3sARB = this->m_ptr_glVertexAttrib3sARB;this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&ProfileTableDecorator::m_glVertexAttrib3sARB_profile;}
+if(this->m_ptr_glVertexAttrib4ivARB){this->m_next_glVertexAttrib4ivARB = this->m_ptr_glVertexAttrib4ivARB;this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&ProfileTableDecorator::m_glVertexAttrib4ivARB_profile;}
+if(this->m_ptr_glGenTransformFeedbacks){this->m_next_glGenTransformFeedbacks = this->m_ptr_glGenTransformFeedbacks;this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&ProfileTableDecorator::m_glGenTransformFeedbacks_profile;}
+if(this->m_ptr_glGetVertexAttribIuiv){this->m_next_glGetVertexAttribIuiv = this->m_ptr_glGetVertexAttribIuiv;this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&ProfileTableDecorator::m_glGetVertexAttribIuiv_profile;}
+if(this->m_ptr_glPixelTransformParameterfEXT){this->m_next_glPixelTransformParameterfEXT = this->m_ptr_glPixelTransformParameterfEXT;this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&ProfileTableDecorator::m_glPixelTransformParameterfEXT_profile;}
+if(this->m_ptr_glGetTexParameterIuivEXT){this->m_next_glGetTexParameterIuivEXT = this->m_ptr_glGetTexParameterIuivEXT;this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&ProfileTableDecorator::m_glGetTexParameterIuivEXT_profile;}
+if(this->m_ptr_glGetObjectParameterivARB){this->m_next_glGetObjectParameterivARB = this->m_ptr_glGetObjectParameterivARB;this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&ProfileTableDecorator::m_glGetObjectParameterivARB_profile;}
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT){this->m_next_glVertexArraySecondaryColorOffsetEXT = this->m_ptr_glVertexArraySecondaryColorOffsetEXT;this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&ProfileTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_profile;}
+if(this->m_ptr_glWindowPos2fARB){this->m_next_glWindowPos2fARB = this->m_ptr_glWindowPos2fARB;this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&ProfileTableDecorator::m_glWindowPos2fARB_profile;}
+if(this->m_ptr_glCompressedTexSubImage2D){this->m_next_glCompressedTexSubImage2D = this->m_ptr_glCompressedTexSubImage2D;this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&ProfileTableDecorator::m_glCompressedTexSubImage2D_profile;}
+if(this->m_ptr_glCompressedTexSubImage3DARB){this->m_next_glCompressedTexSubImage3DARB = this->m_ptr_glCompressedTexSubImage3DARB;this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&ProfileTableDecorator::m_glCompressedTexSubImage3DARB_profile;}
+if(this->m_ptr_glProgramBinary){this->m_next_glProgramBinary = this->m_ptr_glProgramBinary;this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&ProfileTableDecorator::m_glProgramBinary_profile;}
+if(this->m_ptr_glPresentFrameKeyedNV){this->m_next_glPresentFrameKeyedNV = this->m_ptr_glPresentFrameKeyedNV;this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&ProfileTableDecorator::m_glPresentFrameKeyedNV_profile;}
+if(this->m_ptr_glVertexAttribI4bv){this->m_next_glVertexAttribI4bv = this->m_ptr_glVertexAttribI4bv;this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&ProfileTableDecorator::m_glVertexAttribI4bv_profile;}
+if(this->m_ptr_glPathCoverDepthFuncNV){this->m_next_glPathCoverDepthFuncNV = this->m_ptr_glPathCoverDepthFuncNV;this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&ProfileTableDecorator::m_glPathCoverDepthFuncNV_profile;}
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV){this->m_next_glTransformFeedbackStreamAttribsNV = this->m_ptr_glTransformFeedbackStreamAttribsNV;this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&ProfileTableDecorator::m_glTransformFeedbackStreamAttribsNV_profile;}
+if(this->m_ptr_glSecondaryColor3usEXT){this->m_next_glSecondaryColor3usEXT = this->m_ptr_glSecondaryColor3usEXT;this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3usEXT_profile;}
+if(this->m_ptr_glCopyColorTableSGI){this->m_next_glCopyColorTableSGI = this->m_ptr_glCopyColorTableSGI;this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&ProfileTableDecorator::m_glCopyColorTableSGI_profile;}
+if(this->m_ptr_glProgramEnvParameter4fvARB){this->m_next_glProgramEnvParameter4fvARB = this->m_ptr_glProgramEnvParameter4fvARB;this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&ProfileTableDecorator::m_glProgramEnvParameter4fvARB_profile;}
+if(this->m_ptr_glMultiTexCoord4sARB){this->m_next_glMultiTexCoord4sARB = this->m_ptr_glMultiTexCoord4sARB;this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&ProfileTableDecorator::m_glMultiTexCoord4sARB_profile;}
+if(this->m_ptr_glGetVertexArrayIndexed64iv){this->m_next_glGetVertexArrayIndexed64iv = this->m_ptr_glGetVertexArrayIndexed64iv;this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&ProfileTableDecorator::m_glGetVertexArrayIndexed64iv_profile;}
+if(this->m_ptr_glMatrixMultTranspose3x3fNV){this->m_next_glMatrixMultTranspose3x3fNV = this->m_ptr_glMatrixMultTranspose3x3fNV;this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&ProfileTableDecorator::m_glMatrixMultTranspose3x3fNV_profile;}
+if(this->m_ptr_glTexParameterIiv){this->m_next_glTexParameterIiv = this->m_ptr_glTexParameterIiv;this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&ProfileTableDecorator::m_glTexParameterIiv_profile;}
+if(this->m_ptr_glVertexArrayAttribFormat){this->m_next_glVertexArrayAttribFormat = this->m_ptr_glVertexArrayAttribFormat;this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&ProfileTableDecorator::m_glVertexArrayAttribFormat_profile;}
+if(this->m_ptr_glEndTransformFeedback){this->m_next_glEndTransformFeedback = this->m_ptr_glEndTransformFeedback;this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&ProfileTableDecorator::m_glEndTransformFeedback_profile;}
+if(this->m_ptr_glDrawCommandsStatesAddressNV){this->m_next_glDrawCommandsStatesAddressNV = this->m_ptr_glDrawCommandsStatesAddressNV;this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&ProfileTableDecorator::m_glDrawCommandsStatesAddressNV_profile;}
+if(this->m_ptr_glUniform4ui64NV){this->m_next_glUniform4ui64NV = this->m_ptr_glUniform4ui64NV;this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&ProfileTableDecorator::m_glUniform4ui64NV_profile;}
+if(this->m_ptr_glMaterialiv){this->m_next_glMaterialiv = this->m_ptr_glMaterialiv;this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&ProfileTableDecorator::m_glMaterialiv_profile;}
+if(this->m_ptr_glTexImage2DMultisample){this->m_next_glTexImage2DMultisample = this->m_ptr_glTexImage2DMultisample;this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTexImage2DMultisample_profile;}
+if(this->m_ptr_glBindTextureEXT){this->m_next_glBindTextureEXT = this->m_ptr_glBindTextureEXT;this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&ProfileTableDecorator::m_glBindTextureEXT_profile;}
+if(this->m_ptr_glIsBuffer){this->m_next_glIsBuffer = this->m_ptr_glIsBuffer;this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&ProfileTableDecorator::m_glIsBuffer_profile;}
+if(this->m_ptr_glVertexAttribI1iv){this->m_next_glVertexAttribI1iv = this->m_ptr_glVertexAttribI1iv;this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&ProfileTableDecorator::m_glVertexAttribI1iv_profile;}
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV){this->m_next_glGetFinalCombinerInputParameterfvNV = this->m_ptr_glGetFinalCombinerInputParameterfvNV;this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&ProfileTableDecorator::m_glGetFinalCombinerInputParameterfvNV_profile;}
+if(this->m_ptr_glMultiTexCoord3bvOES){this->m_next_glMultiTexCoord3bvOES = this->m_ptr_glMultiTexCoord3bvOES;this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&ProfileTableDecorator::m_glMultiTexCoord3bvOES_profile;}
+if(this->m_ptr_glVertexAttribDivisor){this->m_next_glVertexAttribDivisor = this->m_ptr_glVertexAttribDivisor;this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&ProfileTableDecorator::m_glVertexAttribDivisor_profile;}
+if(this->m_ptr_glCopyBufferSubData){this->m_next_glCopyBufferSubData = this->m_ptr_glCopyBufferSubData;this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&ProfileTableDecorator::m_glCopyBufferSubData_profile;}
+if(this->m_ptr_glBindTexGenParameterEXT){this->m_next_glBindTexGenParameterEXT = this->m_ptr_glBindTexGenParameterEXT;this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&ProfileTableDecorator::m_glBindTexGenParameterEXT_profile;}
+if(this->m_ptr_glNormalStream3bATI){this->m_next_glNormalStream3bATI = this->m_ptr_glNormalStream3bATI;this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&ProfileTableDecorator::m_glNormalStream3bATI_profile;}
+if(this->m_ptr_glTexStorageMem2DEXT){this->m_next_glTexStorageMem2DEXT = this->m_ptr_glTexStorageMem2DEXT;this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&ProfileTableDecorator::m_glTexStorageMem2DEXT_profile;}
+if(this->m_ptr_glTextureImage2DEXT){this->m_next_glTextureImage2DEXT = this->m_ptr_glTextureImage2DEXT;this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&ProfileTableDecorator::m_glTextureImage2DEXT_profile;}
+if(this->m_ptr_glGetColorTableParameteriv){this->m_next_glGetColorTableParameteriv = this->m_ptr_glGetColorTableParameteriv;this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&ProfileTableDecorator::m_glGetColorTableParameteriv_profile;}
+if(this->m_ptr_glActiveTextureARB){this->m_next_glActiveTextureARB = this->m_ptr_glActiveTextureARB;this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&ProfileTableDecorator::m_glActiveTextureARB_profile;}
+if(this->m_ptr_glTexCoord4xOES){this->m_next_glTexCoord4xOES = this->m_ptr_glTexCoord4xOES;this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&ProfileTableDecorator::m_glTexCoord4xOES_profile;}
+if(this->m_ptr_glNamedBufferStorageExternalEXT){this->m_next_glNamedBufferStorageExternalEXT = this->m_ptr_glNamedBufferStorageExternalEXT;this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&ProfileTableDecorator::m_glNamedBufferStorageExternalEXT_profile;}
+if(this->m_ptr_glSecondaryColor3fvEXT){this->m_next_glSecondaryColor3fvEXT = this->m_ptr_glSecondaryColor3fvEXT;this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&ProfileTableDecorator::m_glSecondaryColor3fvEXT_profile;}
+if(this->m_ptr_glUniformMatrix4x2fv){this->m_next_glUniformMatrix4x2fv = this->m_ptr_glUniformMatrix4x2fv;this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&ProfileTableDecorator::m_glUniformMatrix4x2fv_profile;}
+if(this->m_ptr_glStartInstrumentsSGIX){this->m_next_glStartInstrumentsSGIX = this->m_ptr_glStartInstrumentsSGIX;this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&ProfileTableDecorator::m_glStartInstrumentsSGIX_profile;}
+if(this->m_ptr_glProgramNamedParameter4fvNV){this->m_next_glProgramNamedParameter4fvNV = this->m_ptr_glProgramNamedParameter4fvNV;this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&ProfileTableDecorator::m_glProgramNamedParameter4fvNV_profile;}
+if(this->m_ptr_glEndVideoCaptureNV){this->m_next_glEndVideoCaptureNV = this->m_ptr_glEndVideoCaptureNV;this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&ProfileTableDecorator::m_glEndVideoCaptureNV_profile;}
+if(this->m_ptr_glGenLists){this->m_next_glGenLists = this->m_ptr_glGenLists;this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&ProfileTableDecorator::m_glGenLists_profile;}
+if(this->m_ptr_glUniform1fARB){this->m_next_glUniform1fARB = this->m_ptr_glUniform1fARB;this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&ProfileTableDecorator::m_glUniform1fARB_profile;}
+if(this->m_ptr_glNamedFramebufferTexture1DEXT){this->m_next_glNamedFramebufferTexture1DEXT = this->m_ptr_glNamedFramebufferTexture1DEXT;this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&ProfileTableDecorator::m_glNamedFramebufferTexture1DEXT_profile;}
+if(this->m_ptr_glMapBufferRange){this->m_next_glMapBufferRange = this->m_ptr_glMapBufferRange;this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&ProfileTableDecorator::m_glMapBufferRange_profile;}
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB){this->m_next_glMultiDrawElementsIndirectCountARB = this->m_ptr_glMultiDrawElementsIndirectCountARB;this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&ProfileTableDecorator::m_glMultiDrawElementsIndirectCountARB_profile;}
+if(this->m_ptr_glProgramUniformMatrix4x2fv){this->m_next_glProgramUniformMatrix4x2fv = this->m_ptr_glProgramUniformMatrix4x2fv;this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&ProfileTableDecorator::m_glProgramUniformMatrix4x2fv_profile;}
+if(this->m_ptr_glGetTextureParameterIivEXT){this->m_next_glGetTextureParameterIivEXT = this->m_ptr_glGetTextureParameterIivEXT;this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glGetTextureParameterIivEXT_profile;}
+if(this->m_ptr_glMultiTexCoord3hNV){this->m_next_glMultiTexCoord3hNV = this->m_ptr_glMultiTexCoord3hNV;this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&ProfileTableDecorator::m_glMultiTexCoord3hNV_profile;}
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT){this->m_next_glNamedProgramLocalParametersI4uivEXT = this->m_ptr_glNamedProgramLocalParametersI4uivEXT;this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_profile;}
+if(this->m_ptr_glEndList){this->m_next_glEndList = this->m_ptr_glEndList;this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&ProfileTableDecorator::m_glEndList_profile;}
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN){this->m_next_glTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN;this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfileTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_profile;}
+if(this->m_ptr_glGenTransformFeedbacksNV){this->m_next_glGenTransformFeedbacksNV = this->m_ptr_glGenTransformFeedbacksNV;this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&ProfileTableDecorator::m_glGenTransformFeedbacksNV_profile;}
+if(this->m_ptr_glEdgeFlagv){this->m_next_glEdgeFlagv = this->m_ptr_glEdgeFlagv;this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&ProfileTableDecorator::m_glEdgeFlagv_profile;}
+if(this->m_ptr_glVertexAttribI2iv){this->m_next_glVertexAttribI2iv = this->m_ptr_glVertexAttribI2iv;this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&ProfileTableDecorator::m_glVertexAttribI2iv_profile;}
+if(this->m_ptr_glCopyMultiTexImage2DEXT){this->m_next_glCopyMultiTexImage2DEXT = this->m_ptr_glCopyMultiTexImage2DEXT;this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCopyMultiTexImage2DEXT_profile;}
+if(this->m_ptr_glUniformMatrix3x2dv){this->m_next_glUniformMatrix3x2dv = this->m_ptr_glUniformMatrix3x2dv;this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&ProfileTableDecorator::m_glUniformMatrix3x2dv_profile;}
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV){this->m_next_glTexImage3DMultisampleCoverageNV = this->m_ptr_glTexImage3DMultisampleCoverageNV;this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfileTableDecorator::m_glTexImage3DMultisampleCoverageNV_profile;}
+if(this->m_ptr_glGetShaderPrecisionFormat){this->m_next_glGetShaderPrecisionFormat = this->m_ptr_glGetShaderPrecisionFormat;this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&ProfileTableDecorator::m_glGetShaderPrecisionFormat_profile;}
+if(this->m_ptr_glTexSubImage4DSGIS){this->m_next_glTexSubImage4DSGIS = this->m_ptr_glTexSubImage4DSGIS;this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&ProfileTableDecorator::m_glTexSubImage4DSGIS_profile;}
+if(this->m_ptr_glRasterSamplesEXT){this->m_next_glRasterSamplesEXT = this->m_ptr_glRasterSamplesEXT;this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&ProfileTableDecorator::m_glRasterSamplesEXT_profile;}
+if(this->m_ptr_glTextureView){this->m_next_glTextureView = this->m_ptr_glTextureView;this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&ProfileTableDecorator::m_glTextureView_profile;}
+if(this->m_ptr_glEvalMapsNV){this->m_next_glEvalMapsNV = this->m_ptr_glEvalMapsNV;this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&ProfileTableDecorator::m_glEvalMapsNV_profile;}
+if(this->m_ptr_glGetFragDataLocationEXT){this->m_next_glGetFragDataLocationEXT = this->m_ptr_glGetFragDataLocationEXT;this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&ProfileTableDecorator::m_glGetFragDataLocationEXT_profile;}
+if(this->m_ptr_glGetCompressedMultiTexImageEXT){this->m_next_glGetCompressedMultiTexImageEXT = this->m_ptr_glGetCompressedMultiTexImageEXT;this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&ProfileTableDecorator::m_glGetCompressedMultiTexImageEXT_profile;}
+if(this->m_ptr_glIndexMask){this->m_next_glIndexMask = this->m_ptr_glIndexMask;this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&ProfileTableDecorator::m_glIndexMask_profile;}
+if(this->m_ptr_glPushClientAttrib){this->m_next_glPushClientAttrib = this->m_ptr_glPushClientAttrib;this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&ProfileTableDecorator::m_glPushClientAttrib_profile;}
+if(this->m_ptr_glShaderSource){this->m_next_glShaderSource = this->m_ptr_glShaderSource;this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&ProfileTableDecorator::m_glShaderSource_profile;}
+if(this->m_ptr_glDispatchComputeGroupSizeARB){this->m_next_glDispatchComputeGroupSizeARB = this->m_ptr_glDispatchComputeGroupSizeARB;this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&ProfileTableDecorator::m_glDispatchComputeGroupSizeARB_profile;}
+if(this->m_ptr_glLGPUNamedBufferSubDataNVX){this->m_next_glLGPUNamedBufferSubDataNVX = this->m_ptr_glLGPUNamedBufferSubDataNVX;this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&ProfileTableDecorator::m_glLGPUNamedBufferSubDataNVX_profile;}
+if(this->m_ptr_glGetnPixelMapfv){this->m_next_glGetnPixelMapfv = this->m_ptr_glGetnPixelMapfv;this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&ProfileTableDecorator::m_glGetnPixelMapfv_profile;}
+if(this->m_ptr_glTexCoordP2uiv){this->m_next_glTexCoordP2uiv = this->m_ptr_glTexCoordP2uiv;this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&ProfileTableDecorator::m_glTexCoordP2uiv_profile;}
+if(this->m_ptr_glUniform2f){this->m_next_glUniform2f = this->m_ptr_glUniform2f;this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&ProfileTableDecorator::m_glUniform2f_profile;}
+if(this->m_ptr_glGetNamedBufferParameteri64v){this->m_next_glGetNamedBufferParameteri64v = this->m_ptr_glGetNamedBufferParameteri64v;this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&ProfileTableDecorator::m_glGetNamedBufferParameteri64v_profile;}
+if(this->m_ptr_glCommandListSegmentsNV){this->m_next_glCommandListSegmentsNV = this->m_ptr_glCommandListSegmentsNV;this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&ProfileTableDecorator::m_glCommandListSegmentsNV_profile;}
+if(this->m_ptr_glTextureParameterIivEXT){this->m_next_glTextureParameterIivEXT = this->m_ptr_glTextureParameterIivEXT;this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&ProfileTableDecorator::m_glTextureParameterIivEXT_profile;}
+if(this->m_ptr_glMultiTexParameterfvEXT){this->m_next_glMultiTexParameterfvEXT = this->m_ptr_glMultiTexParameterfvEXT;this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glMultiTexParameterfvEXT_profile;}
+if(this->m_ptr_glProgramUniform2ui64ARB){this->m_next_glProgramUniform2ui64ARB = this->m_ptr_glProgramUniform2ui64ARB;this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&ProfileTableDecorator::m_glProgramUniform2ui64ARB_profile;}
+if(this->m_ptr_glVertex4d){this->m_next_glVertex4d = this->m_ptr_glVertex4d;this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&ProfileTableDecorator::m_glVertex4d_profile;}
+if(this->m_ptr_glNewObjectBufferATI){this->m_next_glNewObjectBufferATI = this->m_ptr_glNewObjectBufferATI;this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glNewObjectBufferATI_profile;}
+if(this->m_ptr_glViewportSwizzleNV){this->m_next_glViewportSwizzleNV = this->m_ptr_glViewportSwizzleNV;this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&ProfileTableDecorator::m_glViewportSwizzleNV_profile;}
+if(this->m_ptr_glBufferData){this->m_next_glBufferData = this->m_ptr_glBufferData;this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&ProfileTableDecorator::m_glBufferData_profile;}
+if(this->m_ptr_glTextureImage1DEXT){this->m_next_glTextureImage1DEXT = this->m_ptr_glTextureImage1DEXT;this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&ProfileTableDecorator::m_glTextureImage1DEXT_profile;}
+if(this->m_ptr_glGetTexParameterIiv){this->m_next_glGetTexParameterIiv = this->m_ptr_glGetTexParameterIiv;this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&ProfileTableDecorator::m_glGetTexParameterIiv_profile;}
+if(this->m_ptr_glCopyTexSubImage1DEXT){this->m_next_glCopyTexSubImage1DEXT = this->m_ptr_glCopyTexSubImage1DEXT;this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&ProfileTableDecorator::m_glCopyTexSubImage1DEXT_profile;}
+if(this->m_ptr_glVertex4f){this->m_next_glVertex4f = this->m_ptr_glVertex4f;this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&ProfileTableDecorator::m_glVertex4f_profile;}
+if(this->m_ptr_glUniformMatrix3fvARB){this->m_next_glUniformMatrix3fvARB = this->m_ptr_glUniformMatrix3fvARB;this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&ProfileTableDecorator::m_glUniformMatrix3fvARB_profile;}
+if(this->m_ptr_glTexCoordP1ui){this->m_next_glTexCoordP1ui = this->m_ptr_glTexCoordP1ui;this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&ProfileTableDecorator::m_glTexCoordP1ui_profile;}
+if(this->m_ptr_glPointParameterfvEXT){this->m_next_glPointParameterfvEXT = this->m_ptr_glPointParameterfvEXT;this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&ProfileTableDecorator::m_glPointParameterfvEXT_profile;}
+if(this->m_ptr_glUniform4fARB){this->m_next_glUniform4fARB = this->m_ptr_glUniform4fARB;this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&ProfileTableDecorator::m_glUniform4fARB_profile;}
+if(this->m_ptr_glImportMemoryFdEXT){this->m_next_glImportMemoryFdEXT = this->m_ptr_glImportMemoryFdEXT;this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&ProfileTableDecorator::m_glImportMemoryFdEXT_profile;}
+if(this->m_ptr_glCopyTextureSubImage3D){this->m_next_glCopyTextureSubImage3D = this->m_ptr_glCopyTextureSubImage3D;this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&ProfileTableDecorator::m_glCopyTextureSubImage3D_profile;}
+if(this->m_ptr_glMultiTexCoord2fv){this->m_next_glMultiTexCoord2fv = this->m_ptr_glMultiTexCoord2fv;this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&ProfileTableDecorator::m_glMultiTexCoord2fv_profile;}
+if(this->m_ptr_glNamedFramebufferSamplePositionsfvAMD){this->m_next_glNamedFramebufferSamplePositionsfvAMD = this->m_ptr_glNamedFramebufferSamplePositionsfvAMD;this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ProfileTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_profile;}
+if(this->m_ptr_glNormalP3ui){this->m_next_glNormalP3ui = this->m_ptr_glNormalP3ui;this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&ProfileTableDecorator::m_glNormalP3ui_profile;}
+if(this->m_ptr_glDrawRangeElementArrayATI){this->m_next_glDrawRangeElementArrayATI = this->m_ptr_glDrawRangeElementArrayATI;this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&ProfileTableDecorator::m_glDrawRangeElementArrayATI_profile;}
+if(this->m_ptr_glVertexAttribI1i){this->m_next_glVertexAttribI1i = this->m_ptr_glVertexAttribI1i;this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&ProfileTableDecorator::m_glVertexAttribI1i_profile;}
+if(this->m_ptr_glDrawArraysInstancedARB){this->m_next_glDrawArraysInstancedARB = this->m_ptr_glDrawArraysInstancedARB;this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&ProfileTableDecorator::m_glDrawArraysInstancedARB_profile;}
+if(this->m_ptr_glEnableVertexAttribAPPLE){this->m_next_glEnableVertexAttribAPPLE = this->m_ptr_glEnableVertexAttribAPPLE;this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&ProfileTableDecorator::m_glEnableVertexAttribAPPLE_profile;}
+if(this->m_ptr_glGetDebugMessageLogARB){this->m_next_glGetDebugMessageLogARB = this->m_ptr_glGetDebugMessageLogARB;this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&ProfileTableDecorator::m_glGetDebugMessageLogARB_profile;}
+if(this->m_ptr_glGetPathTexGenfvNV){this->m_next_glGetPathTexGenfvNV = this->m_ptr_glGetPathTexGenfvNV;this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&ProfileTableDecorator::m_glGetPathTexGenfvNV_profile;}
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT){this->m_next_glNamedProgramLocalParameters4fvEXT = this->m_ptr_glNamedProgramLocalParameters4fvEXT;this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfileTableDecorator::m_glNamedProgramLocalParameters4fvEXT_profile;}
+if(this->m_ptr_glQueryResourceTagNV){this->m_next_glQueryResourceTagNV = this->m_ptr_glQueryResourceTagNV;this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&ProfileTableDecorator::m_glQueryResourceTagNV_profile;}
+if(this->m_ptr_glVertexStream3fvATI){this->m_next_glVertexStream3fvATI = this->m_ptr_glVertexStream3fvATI;this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&ProfileTableDecorator::m_glVertexStream3fvATI_profile;}
+if(this->m_ptr_glFramebufferTexture3D){this->m_next_glFramebufferTexture3D = this->m_ptr_glFramebufferTexture3D;this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&ProfileTableDecorator::m_glFramebufferTexture3D_profile;}
+if(this->m_ptr_glCompressedTextureSubImage2DEXT){this->m_next_glCompressedTextureSubImage2DEXT = this->m_ptr_glCompressedTextureSubImage2DEXT;this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&ProfileTableDecorator::m_glCompressedTextureSubImage2DEXT_profile;}
+if(this->m_ptr_glWindowPos3dv){this->m_next_glWindowPos3dv = this->m_ptr_glWindowPos3dv;this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&ProfileTableDecorator::m_glWindowPos3dv_profile;}
+if(this->m_ptr_glCopyConvolutionFilter2D){this->m_next_glCopyConvolutionFilter2D = this->m_ptr_glCopyConvolutionFilter2D;this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&ProfileTableDecorator::m_glCopyConvolutionFilter2D_profile;}
+if(this->m_ptr_glReadInstrumentsSGIX){this->m_next_glReadInstrumentsSGIX = this->m_ptr_glReadInstrumentsSGIX;this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&ProfileTableDecorator::m_glReadInstrumentsSGIX_profile;}
+if(this->m_ptr_glProgramUniform2dvEXT){this->m_next_glProgramUniform2dvEXT = this->m_ptr_glProgramUniform2dvEXT;this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&ProfileTableDecorator::m_glProgramUniform2dvEXT_profile;}
+if(this->m_ptr_glSamplerParameterfv){this->m_next_glSamplerParameterfv = this->m_ptr_glSamplerParameterfv;this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&ProfileTableDecorator::m_glSamplerParameterfv_profile;}
+if(this->m_ptr_glBindBufferARB){this->m_next_glBindBufferARB = this->m_ptr_glBindBufferARB;this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&ProfileTableDecorator::m_glBindBufferARB_profile;}
+if(this->m_ptr_glVertexAttrib1sNV){this->m_next_glVertexAttrib1sNV = this->m_ptr_glVertexAttrib1sNV;this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&ProfileTableDecorator::m_glVertexAttrib1sNV_profile;}
+if(this->m_ptr_glGetMaterialiv){this->m_next_glGetMaterialiv = this->m_ptr_glGetMaterialiv;this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&ProfileTableDecorator::m_glGetMaterialiv_profile;}
+if(this->m_ptr_glUniform1fv){this->m_next_glUniform1fv = this->m_ptr_glUniform1fv;this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&ProfileTableDecorator::m_glUniform1fv_profile;}
+if(this->m_ptr_glBeginOcclusionQueryNV){this->m_next_glBeginOcclusionQueryNV = this->m_ptr_glBeginOcclusionQueryNV;this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&ProfileTableDecorator::m_glBeginOcclusionQueryNV_profile;}
+if(this->m_ptr_glGenFencesAPPLE){this->m_next_glGenFencesAPPLE = this->m_ptr_glGenFencesAPPLE;this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&ProfileTableDecorator::m_glGenFencesAPPLE_profile;}
+if(this->m_ptr_glScissorIndexedv){this->m_next_glScissorIndexedv = this->m_ptr_glScissorIndexedv;this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&ProfileTableDecorator::m_glScissorIndexedv_profile;}
+if(this->m_ptr_glDisableVariantClientStateEXT){this->m_next_glDisableVariantClientStateEXT = this->m_ptr_glDisableVariantClientStateEXT;this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&ProfileTableDecorator::m_glDisableVariantClientStateEXT_profile;}
+if(this->m_ptr_glMinmaxEXT){this->m_next_glMinmaxEXT = this->m_ptr_glMinmaxEXT;this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&ProfileTableDecorator::m_glMinmaxEXT_profile;}
+if(this->m_ptr_glNormalPointervINTEL){this->m_next_glNormalPointervINTEL = this->m_ptr_glNormalPointervINTEL;this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&ProfileTableDecorator::m_glNormalPointervINTEL_profile;}
+if(this->m_ptr_glNormal3s){this->m_next_glNormal3s = this->m_ptr_glNormal3s;this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&ProfileTableDecorator::m_glNormal3s_profile;}
+if(this->m_ptr_glGetnPixelMapuiv){this->m_next_glGetnPixelMapuiv = this->m_ptr_glGetnPixelMapuiv;this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&ProfileTableDecorator::m_glGetnPixelMapuiv_profile;}
+if(this->m_ptr_glNormalStream3bvATI){this->m_next_glNormalStream3bvATI = this->m_ptr_glNormalStream3bvATI;this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&ProfileTableDecorator::m_glNormalStream3bvATI_profile;}
+if(this->m_ptr_glGetObjectParameterivAPPLE){this->m_next_glGetObjectParameterivAPPLE = this->m_ptr_glGetObjectParameterivAPPLE;this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&ProfileTableDecorator::m_glGetObjectParameterivAPPLE_profile;}
+if(this->m_ptr_glNormal3i){this->m_next_glNormal3i = this->m_ptr_glNormal3i;this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&ProfileTableDecorator::m_glNormal3i_profile;}
+if(this->m_ptr_glUniform1ivARB){this->m_next_glUniform1ivARB = this->m_ptr_glUniform1ivARB;this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&ProfileTableDecorator::m_glUniform1ivARB_profile;}
+if(this->m_ptr_glNormal3d){this->m_next_glNormal3d = this->m_ptr_glNormal3d;this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&ProfileTableDecorator::m_glNormal3d_profile;}
+if(this->m_ptr_glUpdateObjectBufferATI){this->m_next_glUpdateObjectBufferATI = this->m_ptr_glUpdateObjectBufferATI;this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&ProfileTableDecorator::m_glUpdateObjectBufferATI_profile;}
+if(this->m_ptr_glNormal3b){this->m_next_glNormal3b = this->m_ptr_glNormal3b;this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&ProfileTableDecorator::m_glNormal3b_profile;}
+if(this->m_ptr_glGetUniformBufferSizeEXT){this->m_next_glGetUniformBufferSizeEXT = this->m_ptr_glGetUniformBufferSizeEXT;this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&ProfileTableDecorator::m_glGetUniformBufferSizeEXT_profile;}
+if(this->m_ptr_glMultiTexCoord4dv){this->m_next_glMultiTexCoord4dv = this->m_ptr_glMultiTexCoord4dv;this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&ProfileTableDecorator::m_glMultiTexCoord4dv_profile;}
+if(this->m_ptr_glProgramUniform3i64ARB){this->m_next_glProgramUniform3i64ARB = this->m_ptr_glProgramUniform3i64ARB;this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&ProfileTableDecorator::m_glProgramUniform3i64ARB_profile;}
+if(this->m_ptr_glVertexAttrib2d){this->m_next_glVertexAttrib2d = this->m_ptr_glVertexAttrib2d;this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&ProfileTableDecorator::m_glVertexAttrib2d_profile;}
+if(this->m_ptr_glVertexAttrib2f){this->m_next_glVertexAttrib2f = this->m_ptr_glVertexAttrib2f;this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&ProfileTableDecorator::m_glVertexAttrib2f_profile;}
+if(this->m_ptr_glMultiDrawElementsEXT){this->m_next_glMultiDrawElementsEXT = this->m_ptr_glMultiDrawElementsEXT;this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&ProfileTableDecorator::m_glMultiDrawElementsEXT_profile;}
+if(this->m_ptr_glVertexAttrib3dv){this->m_next_glVertexAttrib3dv = this->m_ptr_glVertexAttrib3dv;this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&ProfileTableDecorator::m_glVertexAttrib3dv_profile;}
+if(this->m_ptr_glMultiTexCoord2bOES){this->m_next_glMultiTexCoord2bOES = this->m_ptr_glMultiTexCoord2bOES;this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&ProfileTableDecorator::m_glMultiTexCoord2bOES_profile;}
+if(this->m_ptr_glVertexAttrib2s){this->m_next_glVertexAttrib2s = this->m_ptr_glVertexAttrib2s;this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&ProfileTableDecorator::m_glVertexAttrib2s_profile;}
+if(this->m_ptr_glTexImage3DMultisample){this->m_next_glTexImage3DMultisample = this->m_ptr_glTexImage3DMultisample;this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&ProfileTableDecorator::m_glTexImage3DMultisample_profile;}
+if(this->m_ptr_glGetUniformBlockIndex){this->m_next_glGetUniformBlockIndex = this->m_ptr_glGetUniformBlockIndex;this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&ProfileTableDecorator::m_glGetUniformBlockIndex_profile;}
+if(this->m_ptr_glReleaseKeyedMutexWin32EXT){this->m_next_glReleaseKeyedMutexWin32EXT = this->m_ptr_glReleaseKeyedMutexWin32EXT;this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&ProfileTableDecorator::m_glReleaseKeyedMutexWin32EXT_profile;}
+if(this->m_ptr_glFrontFace){this->m_next_glFrontFace = this->m_ptr_glFrontFace;this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&ProfileTableDecorator::m_glFrontFace_profile;}
+if(this->m_ptr_glEvalCoord1xOES){this->m_next_glEvalCoord1xOES = this->m_ptr_glEvalCoord1xOES;this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&ProfileTableDecorator::m_glEvalCoord1xOES_profile;}
+if(this->m_ptr_glDrawArraysInstancedBaseInstance){this->m_next_glDrawArraysInstancedBaseInstance = this->m_ptr_glDrawArraysInstancedBaseInstance;this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&ProfileTableDecorator::m_glDrawArraysInstancedBaseInstance_profile;}
+if(this->m_ptr_glIsPointInStrokePathNV){this->m_next_glIsPointInStrokePathNV = this->m_ptr_glIsPointInStrokePathNV;this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&ProfileTableDecorator::m_glIsPointInStrokePathNV_profile;}
@@ -0,0 +1,5852 @@
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC m_next_glMultiDrawArraysIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessCountNV_profile(GLenum a0,const void* a1,GLsizei a2,GLsizei a3,GLsizei a4,GLint a5)const{return this->m_profile(0,m_next_glMultiDrawArraysIndirectBindlessCountNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC m_next_glTextureParameterfv = nullptr;
+void m_glTextureParameterfv_profile(GLuint a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1,m_next_glTextureParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC m_next_glGetListParameterivSGIX = nullptr;
+void m_glGetListParameterivSGIX_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2,m_next_glGetListParameterivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC m_next_glProgramUniform1i64ARB = nullptr;
+void m_glProgramUniform1i64ARB_profile(GLuint a0,GLint a1,GLint64 a2)const{return this->m_profile(3,m_next_glProgramUniform1i64ARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC m_next_glVertexArrayElementBuffer = nullptr;
+void m_glVertexArrayElementBuffer_profile(GLuint a0,GLuint a1)const{return this->m_profile(4,m_next_glVertexArrayElementBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLHINTPGIPROC m_next_glHintPGI = nullptr;
+void m_glHintPGI_profile(GLenum a0,GLint a1)const{return this->m_profile(5,m_next_glHintPGI,a0,a1);}
+FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC m_next_glStencilMaskSeparate = nullptr;
+void m_glStencilMaskSeparate_profile(GLenum a0,GLuint a1)const{return this->m_profile(6,m_next_glStencilMaskSeparate,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_next_glGetFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetFramebufferAttachmentParameterivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(7,m_next_glGetFramebufferAttachmentParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC m_next_glTextureStorage3DMultisample = nullptr;
+void m_glTextureStorage3DMultisample_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(8,m_next_glTextureStorage3DMultisample,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC m_next_glGetIntegerIndexedvEXT = nullptr;
+void m_glGetIntegerIndexedvEXT_profile(GLenum a0,GLuint a1,GLint* a2)const{return this->m_profile(9,m_next_glGetIntegerIndexedvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC m_next_glCopyTexImage1D = nullptr;
+void m_glCopyTexImage1D_profile(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLint a6)const{return this->m_profile(10,m_next_glCopyTexImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC m_next_glVertexAttrib4usv = nullptr;
+void m_glVertexAttrib4usv_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(11,m_next_glVertexAttrib4usv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC m_next_glTexRenderbufferNV = nullptr;
+void m_glTexRenderbufferNV_profile(GLenum a0,GLuint a1)const{return this->m_profile(12,m_next_glTexRenderbufferNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC m_next_glVertexAttrib3hvNV = nullptr;
+void m_glVertexAttrib3hvNV_profile(GLuint a0,const GLhalfNV* a1)const{return this->m_profile(13,m_next_glVertexAttrib3hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC m_next_glProgramUniform4ui64ARB = nullptr;
+void m_glProgramUniform4ui64ARB_profile(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3,GLuint64 a4,GLuint64 a5)const{return this->m_profile(14,m_next_glProgramUniform4ui64ARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC m_next_glInstrumentsBufferSGIX = nullptr;
+void m_glInstrumentsBufferSGIX_profile(GLsizei a0,GLint* a1)const{return this->m_profile(15,m_next_glInstrumentsBufferSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLINDEXIPROC m_next_glIndexi = nullptr;
+void m_glIndexi_profile(GLint a0)const{return this->m_profile(16,m_next_glIndexi,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC m_next_glMultiTexCoord2sARB = nullptr;
+void m_glMultiTexCoord2sARB_profile(GLenum a0,GLshort a1,GLshort a2)const{return this->m_profile(17,m_next_glMultiTexCoord2sARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC m_next_glProgramEnvParameter4fARB = nullptr;
+void m_glProgramEnvParameter4fARB_profile(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(18,m_next_glProgramEnvParameter4fARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC m_next_glCompressedTexSubImage3D = nullptr;
+void m_glCompressedTexSubImage3D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const GLvoid* a10)const{return this->m_profile(19,m_next_glCompressedTexSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLEVALCOORD2DPROC m_next_glEvalCoord2d = nullptr;
+void m_glEvalCoord2d_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(20,m_next_glEvalCoord2d,a0,a1);}
+FunctionTable::MEMBERPFNGLEVALCOORD2FPROC m_next_glEvalCoord2f = nullptr;
+void m_glEvalCoord2f_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(21,m_next_glEvalCoord2f,a0,a1);}
+FunctionTable::MEMBERPFNGLINDEXDPROC m_next_glIndexd = nullptr;
+void m_glIndexd_profile(GLdouble a0)const{return this->m_profile(22,m_next_glIndexd,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC m_next_glSecondaryColor3hvNV = nullptr;
+void m_glSecondaryColor3hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(23,m_next_glSecondaryColor3hvNV,a0);}
+FunctionTable::MEMBERPFNGLINDEXFPROC m_next_glIndexf = nullptr;
+void m_glIndexf_profile(GLfloat a0)const{return this->m_profile(24,m_next_glIndexf,a0);}
+FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC m_next_glFrustumxOES = nullptr;
+void m_glFrustumxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5)const{return this->m_profile(25,m_next_glFrustumxOES,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC m_next_glTextureStorage3DEXT = nullptr;
+void m_glTextureStorage3DEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6)const{return this->m_profile(26,m_next_glTextureStorage3DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC m_next_glDrawCommandsStatesNV = nullptr;
+void m_glDrawCommandsStatesNV_profile(GLuint a0,const GLintptr* a1,const GLsizei* a2,const GLuint* a3,const GLuint* a4,GLuint a5)const{return this->m_profile(27,m_next_glDrawCommandsStatesNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC m_next_glUniform4uiEXT = nullptr;
+void m_glUniform4uiEXT_profile(GLint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(28,m_next_glUniform4uiEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC m_next_glProgramUniform3ui64ARB = nullptr;
+void m_glProgramUniform3ui64ARB_profile(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3,GLuint64 a4)const{return this->m_profile(29,m_next_glProgramUniform3ui64ARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLINDEXSPROC m_next_glIndexs = nullptr;
+void m_glIndexs_profile(GLshort a0)const{return this->m_profile(30,m_next_glIndexs,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC m_next_glVertexArrayBindVertexBufferEXT = nullptr;
+void m_glVertexArrayBindVertexBufferEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizei a4)const{return this->m_profile(31,m_next_glVertexArrayBindVertexBufferEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC m_next_glConvolutionParameteriEXT = nullptr;
+void m_glConvolutionParameteriEXT_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(32,m_next_glConvolutionParameteriEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC m_next_glColor4ubVertex2fSUN = nullptr;
+void m_glColor4ubVertex2fSUN_profile(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3,GLfloat a4,GLfloat a5)const{return this->m_profile(33,m_next_glColor4ubVertex2fSUN,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC m_next_glProgramUniform1ivEXT = nullptr;
+void m_glProgramUniform1ivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(34,m_next_glProgramUniform1ivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNMAPFVPROC m_next_glGetnMapfv = nullptr;
+void m_glGetnMapfv_profile(GLenum a0,GLenum a1,GLsizei a2,GLfloat* a3)const{return this->m_profile(35,m_next_glGetnMapfv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC m_next_glTransformFeedbackBufferRange = nullptr;
+void m_glTransformFeedbackBufferRange_profile(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(36,m_next_glTransformFeedbackBufferRange,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC m_next_glPathGlyphsNV = nullptr;
+void m_glPathGlyphsNV_profile(GLuint a0,GLenum a1,const void* a2,GLbitfield a3,GLsizei a4,GLenum a5,const void* a6,GLenum a7,GLuint a8,GLfloat a9)const{return this->m_profile(37,m_next_glPathGlyphsNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC m_next_glSecondaryColor3fv = nullptr;
+void m_glSecondaryColor3fv_profile(const GLfloat* a0)const{return this->m_profile(38,m_next_glSecondaryColor3fv,a0);}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC m_next_glGetCombinerInputParameterivNV = nullptr;
+void m_glGetCombinerInputParameterivNV_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLint* a4)const{return this->m_profile(39,m_next_glGetCombinerInputParameterivNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC m_next_glEndPerfMonitorAMD = nullptr;
+void m_glEndPerfMonitorAMD_profile(GLuint a0)const{return this->m_profile(40,m_next_glEndPerfMonitorAMD,a0);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC m_next_glPointParameterfvARB = nullptr;
+void m_glPointParameterfvARB_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(41,m_next_glPointParameterfvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX2XOESPROC m_next_glVertex2xOES = nullptr;
+void m_glVertex2xOES_profile(GLfixed a0)const{return this->m_profile(42,m_next_glVertex2xOES,a0);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC m_next_glDrawElementsInstancedBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseInstance_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLuint a5)const{return this->m_profile(43,m_next_glDrawElementsInstancedBaseInstance,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC m_next_glMultTransposeMatrixdARB = nullptr;
+void m_glMultTransposeMatrixdARB_profile(const GLdouble* a0)const{return this->m_profile(44,m_next_glMultTransposeMatrixdARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC m_next_glVertexAttribL4dEXT = nullptr;
+void m_glVertexAttribL4dEXT_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(45,m_next_glVertexAttribL4dEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEX4IVPROC m_next_glVertex4iv = nullptr;
+void m_glVertex4iv_profile(const GLint* a0)const{return this->m_profile(46,m_next_glVertex4iv,a0);}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC m_next_glCoverStrokePathInstancedNV = nullptr;
+void m_glCoverStrokePathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLenum a5,const GLfloat* a6)const{return this->m_profile(47,m_next_glCoverStrokePathInstancedNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLDEFORMSGIXPROC m_next_glDeformSGIX = nullptr;
+void m_glDeformSGIX_profile(GLbitfield a0)const{return this->m_profile(48,m_next_glDeformSGIX,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC m_next_glUniform2ui64NV = nullptr;
+void m_glUniform2ui64NV_profile(GLint a0,GLuint64EXT a1,GLuint64EXT a2)const{return this->m_profile(49,m_next_glUniform2ui64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYPATHNVPROC m_next_glCopyPathNV = nullptr;
+void m_glCopyPathNV_profile(GLuint a0,GLuint a1)const{return this->m_profile(50,m_next_glCopyPathNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC m_next_glVertexAttribP4ui = nullptr;
+void m_glVertexAttribP4ui_profile(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{return this->m_profile(51,m_next_glVertexAttribP4ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC m_next_glVertexAttribL2d = nullptr;
+void m_glVertexAttribL2d_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(52,m_next_glVertexAttribL2d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC m_next_glGetMultisamplefv = nullptr;
+void m_glGetMultisamplefv_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(53,m_next_glGetMultisamplefv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC m_next_glCompressedMultiTexSubImage3DEXT = nullptr;
+void m_glCompressedMultiTexSubImage3DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLsizei a10,const void* a11)const{return this->m_profile(54,m_next_glCompressedMultiTexSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC m_next_glVDPAURegisterOutputSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_profile(const void* a0,GLenum a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(55,m_next_glVDPAURegisterOutputSurfaceNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC m_next_glMinSampleShading = nullptr;
+void m_glMinSampleShading_profile(GLfloat a0)const{return this->m_profile(56,m_next_glMinSampleShading,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC m_next_glProgramUniform4fEXT = nullptr;
+void m_glProgramUniform4fEXT_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(57,m_next_glProgramUniform4fEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC m_next_glCoverStrokePathNV = nullptr;
+void m_glCoverStrokePathNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(58,m_next_glCoverStrokePathNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC m_next_glTextureImage2DMultisampleNV = nullptr;
+void m_glTextureImage2DMultisampleNV_profile(GLuint a0,GLenum a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(59,m_next_glTextureImage2DMultisampleNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEX3BOESPROC m_next_glVertex3bOES = nullptr;
+void m_glVertex3bOES_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(60,m_next_glVertex3bOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC m_next_glImportMemoryWin32HandleEXT = nullptr;
+void m_glImportMemoryWin32HandleEXT_profile(GLuint a0,GLuint64 a1,GLenum a2,void* a3)const{return this->m_profile(61,m_next_glImportMemoryWin32HandleEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC m_next_glTessellationFactorAMD = nullptr;
+void m_glTessellationFactorAMD_profile(GLfloat a0)const{return this->m_profile(62,m_next_glTessellationFactorAMD,a0);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC m_next_glDebugMessageControl = nullptr;
+void m_glDebugMessageControl_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,const GLuint* a4,GLboolean a5)const{return this->m_profile(63,m_next_glDebugMessageControl,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC m_next_glIsObjectBufferATI = nullptr;
+GLboolean m_glIsObjectBufferATI_profile(GLuint a0)const{return this->m_profile(64,m_next_glIsObjectBufferATI,a0);}
+FunctionTable::MEMBERPFNGLPOPATTRIBPROC m_next_glPopAttrib = nullptr;
+void m_glPopAttrib_profile()const{return this->m_profile(65,m_next_glPopAttrib);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC m_next_glProgramUniform4iEXT = nullptr;
+void m_glProgramUniform4iEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{return this->m_profile(66,m_next_glProgramUniform4iEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC m_next_glVertexAttrib4ubNV = nullptr;
+void m_glVertexAttrib4ubNV_profile(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{return this->m_profile(67,m_next_glVertexAttrib4ubNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLORMATERIALPROC m_next_glColorMaterial = nullptr;
+void m_glColorMaterial_profile(GLenum a0,GLenum a1)const{return this->m_profile(68,m_next_glColorMaterial,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC m_next_glVertexAttrib2svARB = nullptr;
+void m_glVertexAttrib2svARB_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(69,m_next_glVertexAttrib2svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC m_next_glMinSampleShadingARB = nullptr;
+void m_glMinSampleShadingARB_profile(GLfloat a0)const{return this->m_profile(70,m_next_glMinSampleShadingARB,a0);}
+FunctionTable::MEMBERPFNGLCOLOR3BPROC m_next_glColor3b = nullptr;
+void m_glColor3b_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(71,m_next_glColor3b,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8)const{return this->m_profile(72,m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLCOLOR3FPROC m_next_glColor3f = nullptr;
+void m_glColor3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(73,m_next_glColor3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC m_next_glVDPAUGetSurfaceivNV = nullptr;
+void m_glVDPAUGetSurfaceivNV_profile(GLvdpauSurfaceNV a0,GLenum a1,GLsizei a2,GLsizei* a3,GLint* a4)const{return this->m_profile(74,m_next_glVDPAUGetSurfaceivNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLOR3DPROC m_next_glColor3d = nullptr;
+void m_glColor3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(75,m_next_glColor3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNMAPIVPROC m_next_glGetnMapiv = nullptr;
+void m_glGetnMapiv_profile(GLenum a0,GLenum a1,GLsizei a2,GLint* a3)const{return this->m_profile(76,m_next_glGetnMapiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR3IPROC m_next_glColor3i = nullptr;
+void m_glColor3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(77,m_next_glColor3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC m_next_glGetInternalformatSampleivNV = nullptr;
+void m_glGetInternalformatSampleivNV_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLint* a5)const{return this->m_profile(78,m_next_glGetInternalformatSampleivNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC m_next_glVertexAttrib4ubv = nullptr;
+void m_glVertexAttrib4ubv_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(79,m_next_glVertexAttrib4ubv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR3SPROC m_next_glColor3s = nullptr;
+void m_glColor3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(80,m_next_glColor3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC m_next_glVertexAttribs4hvNV = nullptr;
+void m_glVertexAttribs4hvNV_profile(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{return this->m_profile(81,m_next_glVertexAttribs4hvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC m_next_glVertexAttrib4NubvARB = nullptr;
+void m_glVertexAttrib4NubvARB_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(82,m_next_glVertexAttrib4NubvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC m_next_glMultiTexCoord3hvNV = nullptr;
+void m_glMultiTexCoord3hvNV_profile(GLenum a0,const GLhalfNV* a1)const{return this->m_profile(83,m_next_glMultiTexCoord3hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC m_next_glMatrixPushEXT = nullptr;
+void m_glMatrixPushEXT_profile(GLenum a0)const{return this->m_profile(84,m_next_glMatrixPushEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC m_next_glProgramUniform2fEXT = nullptr;
+void m_glProgramUniform2fEXT_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3)const{return this->m_profile(85,m_next_glProgramUniform2fEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC m_next_glGetVertexArrayIndexediv = nullptr;
+void m_glGetVertexArrayIndexediv_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(86,m_next_glGetVertexArrayIndexediv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC m_next_glBlitFramebuffer = nullptr;
+void m_glBlitFramebuffer_profile(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLbitfield a8,GLenum a9)const{return this->m_profile(87,m_next_glBlitFramebuffer,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC m_next_glMultiTexCoordP2ui = nullptr;
+void m_glMultiTexCoordP2ui_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(88,m_next_glMultiTexCoordP2ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC m_next_glColorPointerListIBM = nullptr;
+void m_glColorPointerListIBM_profile(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{return this->m_profile(89,m_next_glColorPointerListIBM,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC m_next_glVertexAttribL4d = nullptr;
+void m_glVertexAttribL4d_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(90,m_next_glVertexAttribL4d,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC m_next_glGetFragmentMaterialfvSGIX = nullptr;
+void m_glGetFragmentMaterialfvSGIX_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(91,m_next_glGetFragmentMaterialfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX2IVPROC m_next_glVertex2iv = nullptr;
+void m_glVertex2iv_profile(const GLint* a0)const{return this->m_profile(92,m_next_glVertex2iv,a0);}
+FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC m_next_glGetTexEnvxvOES = nullptr;
+void m_glGetTexEnvxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(93,m_next_glGetTexEnvxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC m_next_glUniformMatrix3dv = nullptr;
+void m_glUniformMatrix3dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(94,m_next_glUniformMatrix3dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC m_next_glGetVertexAttribLdvEXT = nullptr;
+void m_glGetVertexAttribLdvEXT_profile(GLuint a0,GLenum a1,GLdouble* a2)const{return this->m_profile(95,m_next_glGetVertexAttribLdvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC m_next_glTexCoordP3uiv = nullptr;
+void m_glTexCoordP3uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(96,m_next_glTexCoordP3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC m_next_glDeformationMap3dSGIX = nullptr;
+void m_glDeformationMap3dSGIX_profile(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,GLdouble a5,GLdouble a6,GLint a7,GLint a8,GLdouble a9,GLdouble a10,GLint a11,GLint a12,const GLdouble* a13)const{return this->m_profile(97,m_next_glDeformationMap3dSGIX,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC m_next_glResumeTransformFeedback = nullptr;
+void m_glResumeTransformFeedback_profile()const{return this->m_profile(98,m_next_glResumeTransformFeedback);}
+FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC m_next_glInsertEventMarkerEXT = nullptr;
+void m_glInsertEventMarkerEXT_profile(GLsizei a0,const GLchar* a1)const{return this->m_profile(99,m_next_glInsertEventMarkerEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC m_next_glTessellationModeAMD = nullptr;
+void m_glTessellationModeAMD_profile(GLenum a0)const{return this->m_profile(100,m_next_glTessellationModeAMD,a0);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC m_next_glDrawCommandsAddressNV = nullptr;
+void m_glDrawCommandsAddressNV_profile(GLenum a0,const GLuint64* a1,const GLsizei* a2,GLuint a3)const{return this->m_profile(101,m_next_glDrawCommandsAddressNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGIPROC m_next_glFogi = nullptr;
+void m_glFogi_profile(GLenum a0,GLint a1)const{return this->m_profile(102,m_next_glFogi,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC m_next_glGetTexParameterxvOES = nullptr;
+void m_glGetTexParameterxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(103,m_next_glGetTexParameterxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC m_next_glVertexPointer = nullptr;
+void m_glVertexPointer_profile(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{return this->m_profile(104,m_next_glVertexPointer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC m_next_glGetPerfMonitorCounterDataAMD = nullptr;
+void m_glGetPerfMonitorCounterDataAMD_profile(GLuint a0,GLenum a1,GLsizei a2,GLuint* a3,GLint* a4)const{return this->m_profile(105,m_next_glGetPerfMonitorCounterDataAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFOGFPROC m_next_glFogf = nullptr;
+void m_glFogf_profile(GLenum a0,GLfloat a1)const{return this->m_profile(106,m_next_glFogf,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC m_next_glMultiTexCoord1d = nullptr;
+void m_glMultiTexCoord1d_profile(GLenum a0,GLdouble a1)const{return this->m_profile(107,m_next_glMultiTexCoord1d,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC m_next_glMultiTexCoord1f = nullptr;
+void m_glMultiTexCoord1f_profile(GLenum a0,GLfloat a1)const{return this->m_profile(108,m_next_glMultiTexCoord1f,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC m_next_glGetMultiTexParameterivEXT = nullptr;
+void m_glGetMultiTexParameterivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(109,m_next_glGetMultiTexParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC m_next_glProgramUniformMatrix3x4fvEXT = nullptr;
+void m_glProgramUniformMatrix3x4fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(110,m_next_glProgramUniformMatrix3x4fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC m_next_glVertexAttribI2i = nullptr;
+void m_glVertexAttribI2i_profile(GLuint a0,GLint a1,GLint a2)const{return this->m_profile(111,m_next_glVertexAttribI2i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC m_next_glMultiTexCoord1i = nullptr;
+void m_glMultiTexCoord1i_profile(GLenum a0,GLint a1)const{return this->m_profile(112,m_next_glMultiTexCoord1i,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC m_next_glDeleteSemaphoresEXT = nullptr;
+void m_glDeleteSemaphoresEXT_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(113,m_next_glDeleteSemaphoresEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC m_next_glLoadProgramNV = nullptr;
+void m_glLoadProgramNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLubyte* a3)const{return this->m_profile(114,m_next_glLoadProgramNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC m_next_glWriteMaskEXT = nullptr;
+void m_glWriteMaskEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{return this->m_profile(115,m_next_glWriteMaskEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC m_next_glGetGraphicsResetStatus = nullptr;
+GLenum m_glGetGraphicsResetStatus_profile()const{return this->m_profile(116,m_next_glGetGraphicsResetStatus);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC m_next_glVertexAttrib1fv = nullptr;
+void m_glVertexAttrib1fv_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(117,m_next_glVertexAttrib1fv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC m_next_glMultiTexCoord1s = nullptr;
+void m_glMultiTexCoord1s_profile(GLenum a0,GLshort a1)const{return this->m_profile(118,m_next_glMultiTexCoord1s,a0,a1);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC m_next_glImageTransformParameterfvHP = nullptr;
+void m_glImageTransformParameterfvHP_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(119,m_next_glImageTransformParameterfvHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC m_next_glFramebufferTexture2D = nullptr;
+void m_glFramebufferTexture2D_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(120,m_next_glFramebufferTexture2D,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC m_next_glGetFragmentLightfvSGIX = nullptr;
+void m_glGetFragmentLightfvSGIX_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(121,m_next_glGetFragmentLightfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC m_next_glListParameterfSGIX = nullptr;
+void m_glListParameterfSGIX_profile(GLuint a0,GLenum a1,GLfloat a2)const{return this->m_profile(122,m_next_glListParameterfSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC m_next_glTexCoord3sv = nullptr;
+void m_glTexCoord3sv_profile(const GLshort* a0)const{return this->m_profile(123,m_next_glTexCoord3sv,a0);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC m_next_glNamedFramebufferRenderbufferEXT = nullptr;
+void m_glNamedFramebufferRenderbufferEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(124,m_next_glNamedFramebufferRenderbufferEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC m_next_glFragmentLightModelfSGIX = nullptr;
+void m_glFragmentLightModelfSGIX_profile(GLenum a0,GLfloat a1)const{return this->m_profile(125,m_next_glFragmentLightModelfSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC m_next_glIndexPointerEXT = nullptr;
+void m_glIndexPointerEXT_profile(GLenum a0,GLsizei a1,GLsizei a2,const void* a3)const{return this->m_profile(126,m_next_glIndexPointerEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC m_next_glBlendEquationSeparateATI = nullptr;
+void m_glBlendEquationSeparateATI_profile(GLenum a0,GLenum a1)const{return this->m_profile(127,m_next_glBlendEquationSeparateATI,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC m_next_glVertexArrayAttribIFormat = nullptr;
+void m_glVertexArrayAttribIFormat_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{return this->m_profile(128,m_next_glVertexArrayAttribIFormat,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11,GLfloat a12)const{return this->m_profile(129,m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC m_next_glReplacementCodeubvSUN = nullptr;
+void m_glReplacementCodeubvSUN_profile(const GLubyte* a0)const{return this->m_profile(130,m_next_glReplacementCodeubvSUN,a0);}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC m_next_glGenFramebuffers = nullptr;
+void m_glGenFramebuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(131,m_next_glGenFramebuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLPIXELMAPXPROC m_next_glPixelMapx = nullptr;
+void m_glPixelMapx_profile(GLenum a0,GLint a1,const GLfixed* a2)const{return this->m_profile(132,m_next_glPixelMapx,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC m_next_glTexSubImage3DEXT = nullptr;
+void m_glTexSubImage3DEXT_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(133,m_next_glTexSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC m_next_glGetAttachedShaders = nullptr;
+void m_glGetAttachedShaders_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLuint* a3)const{return this->m_profile(134,m_next_glGetAttachedShaders,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC m_next_glGetPixelTexGenParameterfvSGIS = nullptr;
+void m_glGetPixelTexGenParameterfvSGIS_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(135,m_next_glGetPixelTexGenParameterfvSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC m_next_glReplacementCodeuiNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{return this->m_profile(136,m_next_glReplacementCodeuiNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC m_next_glGetDebugMessageLogAMD = nullptr;
+GLuint m_glGetDebugMessageLogAMD_profile(GLuint a0,GLsizei a1,GLenum* a2,GLuint* a3,GLuint* a4,GLsizei* a5,GLchar* a6)const{return this->m_profile(137,m_next_glGetDebugMessageLogAMD,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC m_next_glVertexStream4sATI = nullptr;
+void m_glVertexStream4sATI_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(138,m_next_glVertexStream4sATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC m_next_glVertexAttribs4dvNV = nullptr;
+void m_glVertexAttribs4dvNV_profile(GLuint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(139,m_next_glVertexAttribs4dvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC m_next_glGetnMapdvARB = nullptr;
+void m_glGetnMapdvARB_profile(GLenum a0,GLenum a1,GLsizei a2,GLdouble* a3)const{return this->m_profile(140,m_next_glGetnMapdvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLORTHOFOESPROC m_next_glOrthofOES = nullptr;
+void m_glOrthofOES_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(141,m_next_glOrthofOES,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC m_next_glViewportArrayv = nullptr;
+void m_glViewportArrayv_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(142,m_next_glViewportArrayv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC m_next_glDrawElementArrayATI = nullptr;
+void m_glDrawElementArrayATI_profile(GLenum a0,GLsizei a1)const{return this->m_profile(143,m_next_glDrawElementArrayATI,a0,a1);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC m_next_glBufferStorageMemEXT = nullptr;
+void m_glBufferStorageMemEXT_profile(GLenum a0,GLsizeiptr a1,GLuint a2,GLuint64 a3)const{return this->m_profile(144,m_next_glBufferStorageMemEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC m_next_glGetPathColorGenfvNV = nullptr;
+void m_glGetPathColorGenfvNV_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(145,m_next_glGetPathColorGenfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC m_next_glWindowPos3iMESA = nullptr;
+void m_glWindowPos3iMESA_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(146,m_next_glWindowPos3iMESA,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC m_next_glMultiTexCoord2s = nullptr;
+void m_glMultiTexCoord2s_profile(GLenum a0,GLshort a1,GLshort a2)const{return this->m_profile(147,m_next_glMultiTexCoord2s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX3DVPROC m_next_glVertex3dv = nullptr;
+void m_glVertex3dv_profile(const GLdouble* a0)const{return this->m_profile(148,m_next_glVertex3dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC m_next_glVertexAttribI3uivEXT = nullptr;
+void m_glVertexAttribI3uivEXT_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(149,m_next_glVertexAttribI3uivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC m_next_glUniform3ui64ARB = nullptr;
+void m_glUniform3ui64ARB_profile(GLint a0,GLuint64 a1,GLuint64 a2,GLuint64 a3)const{return this->m_profile(150,m_next_glUniform3ui64ARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC m_next_glVertexAttrib2fvNV = nullptr;
+void m_glVertexAttrib2fvNV_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(151,m_next_glVertexAttrib2fvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC m_next_glGetNamedBufferSubDataEXT = nullptr;
+void m_glGetNamedBufferSubDataEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,void* a3)const{return this->m_profile(152,m_next_glGetNamedBufferSubDataEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC m_next_glConvolutionFilter2D = nullptr;
+void m_glConvolutionFilter2D_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6)const{return this->m_profile(153,m_next_glConvolutionFilter2D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC m_next_glMemoryBarrierByRegion = nullptr;
+void m_glMemoryBarrierByRegion_profile(GLbitfield a0)const{return this->m_profile(154,m_next_glMemoryBarrierByRegion,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC m_next_glVertexArrayBindingDivisor = nullptr;
+void m_glVertexArrayBindingDivisor_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(155,m_next_glVertexArrayBindingDivisor,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC m_next_glMatrixRotatedEXT = nullptr;
+void m_glMatrixRotatedEXT_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(156,m_next_glMatrixRotatedEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC m_next_glTexCoord2sv = nullptr;
+void m_glTexCoord2sv_profile(const GLshort* a0)const{return this->m_profile(157,m_next_glTexCoord2sv,a0);}
+FunctionTable::MEMBERPFNGLISPROGRAMNVPROC m_next_glIsProgramNV = nullptr;
+GLboolean m_glIsProgramNV_profile(GLuint a0)const{return this->m_profile(158,m_next_glIsProgramNV,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM2DVPROC m_next_glUniform2dv = nullptr;
+void m_glUniform2dv_profile(GLint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(159,m_next_glUniform2dv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC m_next_glGetPixelMapuiv = nullptr;
+void m_glGetPixelMapuiv_profile(GLenum a0,GLuint* a1)const{return this->m_profile(160,m_next_glGetPixelMapuiv,a0,a1);}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC m_next_glDepthBoundsEXT = nullptr;
+void m_glDepthBoundsEXT_profile(GLclampd a0,GLclampd a1)const{return this->m_profile(161,m_next_glDepthBoundsEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC m_next_glVertexAttrib4hvNV = nullptr;
+void m_glVertexAttrib4hvNV_profile(GLuint a0,const GLhalfNV* a1)const{return this->m_profile(162,m_next_glVertexAttrib4hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC m_next_glMultiTexParameteriEXT = nullptr;
+void m_glMultiTexParameteriEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{return this->m_profile(163,m_next_glMultiTexParameteriEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPOINTERVPROC m_next_glGetPointerv = nullptr;
+void m_glGetPointerv_profile(GLenum a0,GLvoid** a1)const{return this->m_profile(164,m_next_glGetPointerv,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC m_next_glPathCommandsNV = nullptr;
+void m_glPathCommandsNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,GLsizei a3,GLenum a4,const void* a5)const{return this->m_profile(165,m_next_glPathCommandsNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC m_next_glGetListParameterfvSGIX = nullptr;
+void m_glGetListParameterfvSGIX_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(166,m_next_glGetListParameterfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC m_next_glGetUniformuiv = nullptr;
+void m_glGetUniformuiv_profile(GLuint a0,GLint a1,GLuint* a2)const{return this->m_profile(167,m_next_glGetUniformuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC m_next_glDebugMessageInsertAMD = nullptr;
+void m_glDebugMessageInsertAMD_profile(GLenum a0,GLenum a1,GLuint a2,GLsizei a3,const GLchar* a4)const{return this->m_profile(168,m_next_glDebugMessageInsertAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFRUSTUMPROC m_next_glFrustum = nullptr;
+void m_glFrustum_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(169,m_next_glFrustum,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC m_next_glVertexAttribL1ui64vNV = nullptr;
+void m_glVertexAttribL1ui64vNV_profile(GLuint a0,const GLuint64EXT* a1)const{return this->m_profile(170,m_next_glVertexAttribL1ui64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC m_next_glClearColorxOES = nullptr;
+void m_glClearColorxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(171,m_next_glClearColorxOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC m_next_glProgramUniformMatrix3fv = nullptr;
+void m_glProgramUniformMatrix3fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(172,m_next_glProgramUniformMatrix3fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC m_next_glSampleMaskIndexedNV = nullptr;
+void m_glSampleMaskIndexedNV_profile(GLuint a0,GLbitfield a1)const{return this->m_profile(173,m_next_glSampleMaskIndexedNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC m_next_glCompileShaderIncludeARB = nullptr;
+void m_glCompileShaderIncludeARB_profile(GLuint a0,GLsizei a1,const GLchar*const* a2,const GLint* a3)const{return this->m_profile(174,m_next_glCompileShaderIncludeARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC m_next_glGetArrayObjectfvATI = nullptr;
+void m_glGetArrayObjectfvATI_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(175,m_next_glGetArrayObjectfvATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC m_next_glVertexStream4svATI = nullptr;
+void m_glVertexStream4svATI_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(176,m_next_glVertexStream4svATI,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC m_next_glMultiTexCoord4iARB = nullptr;
+void m_glMultiTexCoord4iARB_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(177,m_next_glMultiTexCoord4iARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC m_next_glVariantfvEXT = nullptr;
+void m_glVariantfvEXT_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(178,m_next_glVariantfvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC m_next_glMatrixLoadfEXT = nullptr;
+void m_glMatrixLoadfEXT_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(179,m_next_glMatrixLoadfEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC m_next_glLoadIdentityDeformationMapSGIX = nullptr;
+void m_glLoadIdentityDeformationMapSGIX_profile(GLbitfield a0)const{return this->m_profile(180,m_next_glLoadIdentityDeformationMapSGIX,a0);}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC m_next_glGetRenderbufferParameteriv = nullptr;
+void m_glGetRenderbufferParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(181,m_next_glGetRenderbufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC m_next_glProgramUniform3fEXT = nullptr;
+void m_glProgramUniform3fEXT_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(182,m_next_glProgramUniform3fEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC m_next_glNamedRenderbufferStorage = nullptr;
+void m_glNamedRenderbufferStorage_profile(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3)const{return this->m_profile(183,m_next_glNamedRenderbufferStorage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC m_next_glBindFragDataLocation = nullptr;
+void m_glBindFragDataLocation_profile(GLuint a0,GLuint a1,const GLchar* a2)const{return this->m_profile(184,m_next_glBindFragDataLocation,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC m_next_glPolygonOffsetClamp = nullptr;
+void m_glPolygonOffsetClamp_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(185,m_next_glPolygonOffsetClamp,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC m_next_glFogCoordPointerListIBM = nullptr;
+void m_glFogCoordPointerListIBM_profile(GLenum a0,GLint a1,const void** a2,GLint a3)const{return this->m_profile(186,m_next_glFogCoordPointerListIBM,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFENCESYNCPROC m_next_glFenceSync = nullptr;
+GLsync m_glFenceSync_profile(GLenum a0,GLbitfield a1)const{return this->m_profile(187,m_next_glFenceSync,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC m_next_glGetVertexAttribIivEXT = nullptr;
+void m_glGetVertexAttribIivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(188,m_next_glGetVertexAttribIivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC m_next_glFramebufferDrawBuffersEXT = nullptr;
+void m_glFramebufferDrawBuffersEXT_profile(GLuint a0,GLsizei a1,const GLenum* a2)const{return this->m_profile(189,m_next_glFramebufferDrawBuffersEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC m_next_glVertexAttribs4fvNV = nullptr;
+void m_glVertexAttribs4fvNV_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(190,m_next_glVertexAttribs4fvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC m_next_glPauseTransformFeedbackNV = nullptr;
+void m_glPauseTransformFeedbackNV_profile()const{return this->m_profile(191,m_next_glPauseTransformFeedbackNV);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC m_next_glGetQueryObjecti64vEXT = nullptr;
+void m_glGetQueryObjecti64vEXT_profile(GLuint a0,GLenum a1,GLint64* a2)const{return this->m_profile(192,m_next_glGetQueryObjecti64vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC m_next_glVDPAUSurfaceAccessNV = nullptr;
+void m_glVDPAUSurfaceAccessNV_profile(GLvdpauSurfaceNV a0,GLenum a1)const{return this->m_profile(193,m_next_glVDPAUSurfaceAccessNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC m_next_glValidateProgramPipeline = nullptr;
+void m_glValidateProgramPipeline_profile(GLuint a0)const{return this->m_profile(194,m_next_glValidateProgramPipeline,a0);}
+FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC m_next_glTexPageCommitmentARB = nullptr;
+void m_glTexPageCommitmentARB_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{return this->m_profile(195,m_next_glTexPageCommitmentARB,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC m_next_glWindowPos3dvARB = nullptr;
+void m_glWindowPos3dvARB_profile(const GLdouble* a0)const{return this->m_profile(196,m_next_glWindowPos3dvARB,a0);}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC m_next_glStencilStrokePathInstancedNV = nullptr;
+void m_glStencilStrokePathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLint a4,GLuint a5,GLenum a6,const GLfloat* a7)const{return this->m_profile(197,m_next_glStencilStrokePathInstancedNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLFOGFVPROC m_next_glFogfv = nullptr;
+void m_glFogfv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(198,m_next_glFogfv,a0,a1);}
+FunctionTable::MEMBERPFNGLGENQUERIESARBPROC m_next_glGenQueriesARB = nullptr;
+void m_glGenQueriesARB_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(199,m_next_glGenQueriesARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC m_next_glProgramUniform2i64NV = nullptr;
+void m_glProgramUniform2i64NV_profile(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3)const{return this->m_profile(200,m_next_glProgramUniform2i64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXP4UIPROC m_next_glVertexP4ui = nullptr;
+void m_glVertexP4ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(201,m_next_glVertexP4ui,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC m_next_glVertexStream1ivATI = nullptr;
+void m_glVertexStream1ivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(202,m_next_glVertexStream1ivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC m_next_glProgramEnvParameterI4iNV = nullptr;
+void m_glProgramEnvParameterI4iNV_profile(GLenum a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{return this->m_profile(203,m_next_glProgramEnvParameterI4iNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC m_next_glGenVertexArraysAPPLE = nullptr;
+void m_glGenVertexArraysAPPLE_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(204,m_next_glGenVertexArraysAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC m_next_glDrawTransformFeedbackInstanced = nullptr;
+void m_glDrawTransformFeedbackInstanced_profile(GLenum a0,GLuint a1,GLsizei a2)const{return this->m_profile(205,m_next_glDrawTransformFeedbackInstanced,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC m_next_glStencilThenCoverStrokePathNV = nullptr;
+void m_glStencilThenCoverStrokePathNV_profile(GLuint a0,GLint a1,GLuint a2,GLenum a3)const{return this->m_profile(206,m_next_glStencilThenCoverStrokePathNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC m_next_glDeleteVertexArraysAPPLE = nullptr;
+void m_glDeleteVertexArraysAPPLE_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(207,m_next_glDeleteVertexArraysAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC m_next_glGetNamedBufferParameterui64vNV = nullptr;
+void m_glGetNamedBufferParameterui64vNV_profile(GLuint a0,GLenum a1,GLuint64EXT* a2)const{return this->m_profile(208,m_next_glGetNamedBufferParameterui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC m_next_glQueryMatrixxOES = nullptr;
+GLbitfield m_glQueryMatrixxOES_profile(GLfixed* a0,GLint* a1)const{return this->m_profile(209,m_next_glQueryMatrixxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC m_next_glSecondaryColor3usv = nullptr;
+void m_glSecondaryColor3usv_profile(const GLushort* a0)const{return this->m_profile(210,m_next_glSecondaryColor3usv,a0);}
+FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC m_next_glTranslatexOES = nullptr;
+void m_glTranslatexOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(211,m_next_glTranslatexOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC m_next_glDrawTransformFeedback = nullptr;
+void m_glDrawTransformFeedback_profile(GLenum a0,GLuint a1)const{return this->m_profile(212,m_next_glDrawTransformFeedback,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_next_glTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{return this->m_profile(213,m_next_glTexCoord2fColor4fNormal3fVertex3fvSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC m_next_glVDPAURegisterVideoSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_profile(const void* a0,GLenum a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(214,m_next_glVDPAURegisterVideoSurfaceNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC m_next_glGetTexParameterIuiv = nullptr;
+void m_glGetTexParameterIuiv_profile(GLenum a0,GLenum a1,GLuint* a2)const{return this->m_profile(215,m_next_glGetTexParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC m_next_glBindBufferBaseNV = nullptr;
+void m_glBindBufferBaseNV_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(216,m_next_glBindBufferBaseNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINDEXPOINTERPROC m_next_glIndexPointer = nullptr;
+void m_glIndexPointer_profile(GLenum a0,GLsizei a1,const GLvoid* a2)const{return this->m_profile(217,m_next_glIndexPointer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC m_next_glGenQueryResourceTagNV = nullptr;
+void m_glGenQueryResourceTagNV_profile(GLsizei a0,GLint* a1)const{return this->m_profile(218,m_next_glGenQueryResourceTagNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC m_next_glVertexAttrib4Nbv = nullptr;
+void m_glVertexAttrib4Nbv_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(219,m_next_glVertexAttrib4Nbv,a0,a1);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC m_next_glListParameteriSGIX = nullptr;
+void m_glListParameteriSGIX_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(220,m_next_glListParameteriSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC m_next_glBlendColorxOES = nullptr;
+void m_glBlendColorxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(221,m_next_glBlendColorxOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC m_next_glUniformui64vNV = nullptr;
+void m_glUniformui64vNV_profile(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{return this->m_profile(222,m_next_glUniformui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISSYNCPROC m_next_glIsSync = nullptr;
+GLboolean m_glIsSync_profile(GLsync a0)const{return this->m_profile(223,m_next_glIsSync,a0);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC m_next_glGetTextureParameterivEXT = nullptr;
+void m_glGetTextureParameterivEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(224,m_next_glGetTextureParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC m_next_glFogCoordhvNV = nullptr;
+void m_glFogCoordhvNV_profile(const GLhalfNV* a0)const{return this->m_profile(225,m_next_glFogCoordhvNV,a0);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC m_next_glFramebufferTextureLayerEXT = nullptr;
+void m_glFramebufferTextureLayerEXT_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{return this->m_profile(226,m_next_glFramebufferTextureLayerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC m_next_glGetObjectPtrLabel = nullptr;
+void m_glGetObjectPtrLabel_profile(const void* a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(227,m_next_glGetObjectPtrLabel,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC m_next_glTextureParameteri = nullptr;
+void m_glTextureParameteri_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(228,m_next_glTextureParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC m_next_glMultiTexCoord1fARB = nullptr;
+void m_glMultiTexCoord1fARB_profile(GLenum a0,GLfloat a1)const{return this->m_profile(229,m_next_glMultiTexCoord1fARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC m_next_glUniformMatrix2x3dv = nullptr;
+void m_glUniformMatrix2x3dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(230,m_next_glUniformMatrix2x3dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC m_next_glFramebufferDrawBufferEXT = nullptr;
+void m_glFramebufferDrawBufferEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(231,m_next_glFramebufferDrawBufferEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC m_next_glCopyColorSubTable = nullptr;
+void m_glCopyColorSubTable_profile(GLenum a0,GLsizei a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(232,m_next_glCopyColorSubTable,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC m_next_glGetNamedFramebufferParameterfvAMD = nullptr;
+void m_glGetNamedFramebufferParameterfvAMD_profile(GLuint a0,GLenum a1,GLuint a2,GLuint a3,GLsizei a4,GLfloat* a5)const{return this->m_profile(233,m_next_glGetNamedFramebufferParameterfvAMD,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC m_next_glVertexAttribL3d = nullptr;
+void m_glVertexAttribL3d_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(234,m_next_glVertexAttribL3d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC m_next_glFragmentMaterialfvSGIX = nullptr;
+void m_glFragmentMaterialfvSGIX_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(235,m_next_glFragmentMaterialfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC m_next_glMatrixLoadTranspose3x3fNV = nullptr;
+void m_glMatrixLoadTranspose3x3fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(236,m_next_glMatrixLoadTranspose3x3fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC m_next_glDeleteNamesAMD = nullptr;
+void m_glDeleteNamesAMD_profile(GLenum a0,GLuint a1,const GLuint* a2)const{return this->m_profile(237,m_next_glDeleteNamesAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC m_next_glDrawRangeElementsEXT = nullptr;
+void m_glDrawRangeElementsEXT_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const void* a5)const{return this->m_profile(238,m_next_glDrawRangeElementsEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLORTHOPROC m_next_glOrtho = nullptr;
+void m_glOrtho_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(239,m_next_glOrtho,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC m_next_glProgramUniform1dvEXT = nullptr;
+void m_glProgramUniform1dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(240,m_next_glProgramUniform1dvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR4XOESPROC m_next_glColor4xOES = nullptr;
+void m_glColor4xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(241,m_next_glColor4xOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC m_next_glTexImage4DSGIS = nullptr;
+void m_glTexImage4DSGIS_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(242,m_next_glTexImage4DSGIS,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC m_next_glProgramUniform1ui = nullptr;
+void m_glProgramUniform1ui_profile(GLuint a0,GLint a1,GLuint a2)const{return this->m_profile(243,m_next_glProgramUniform1ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC m_next_glDeleteBuffersARB = nullptr;
+void m_glDeleteBuffersARB_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(244,m_next_glDeleteBuffersARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC m_next_glUnmapBufferARB = nullptr;
+GLboolean m_glUnmapBufferARB_profile(GLenum a0)const{return this->m_profile(245,m_next_glUnmapBufferARB,a0);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC m_next_glCopyTexImage2D = nullptr;
+void m_glCopyTexImage2D_profile(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLint a7)const{return this->m_profile(246,m_next_glCopyTexImage2D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMATERIALXOESPROC m_next_glMaterialxOES = nullptr;
+void m_glMaterialxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(247,m_next_glMaterialxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC m_next_glProgramUniformMatrix2x4fvEXT = nullptr;
+void m_glProgramUniformMatrix2x4fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(248,m_next_glProgramUniformMatrix2x4fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC m_next_glTestObjectAPPLE = nullptr;
+GLboolean m_glTestObjectAPPLE_profile(GLenum a0,GLuint a1)const{return this->m_profile(249,m_next_glTestObjectAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC m_next_glRenderbufferStorageEXT = nullptr;
+void m_glRenderbufferStorageEXT_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3)const{return this->m_profile(250,m_next_glRenderbufferStorageEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC m_next_glVertexAttribL1ui64ARB = nullptr;
+void m_glVertexAttribL1ui64ARB_profile(GLuint a0,GLuint64EXT a1)const{return this->m_profile(251,m_next_glVertexAttribL1ui64ARB,a0,a1);}
+FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC m_next_glEndFragmentShaderATI = nullptr;
+void m_glEndFragmentShaderATI_profile()const{return this->m_profile(252,m_next_glEndFragmentShaderATI);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC m_next_glPathParameterivNV = nullptr;
+void m_glPathParameterivNV_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(253,m_next_glPathParameterivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC m_next_glUniform4uiv = nullptr;
+void m_glUniform4uiv_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(254,m_next_glUniform4uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC m_next_glFrameZoomSGIX = nullptr;
+void m_glFrameZoomSGIX_profile(GLint a0)const{return this->m_profile(255,m_next_glFrameZoomSGIX,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC m_next_glSecondaryColor3fEXT = nullptr;
+void m_glSecondaryColor3fEXT_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(256,m_next_glSecondaryColor3fEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC m_next_glLGPUInterlockNVX = nullptr;
+void m_glLGPUInterlockNVX_profile()const{return this->m_profile(257,m_next_glLGPUInterlockNVX);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC m_next_glVertexAttribL1dv = nullptr;
+void m_glVertexAttribL1dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(258,m_next_glVertexAttribL1dv,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC m_next_glNormalStream3svATI = nullptr;
+void m_glNormalStream3svATI_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(259,m_next_glNormalStream3svATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC m_next_glPathStencilFuncNV = nullptr;
+void m_glPathStencilFuncNV_profile(GLenum a0,GLint a1,GLuint a2)const{return this->m_profile(260,m_next_glPathStencilFuncNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC m_next_glSetInvariantEXT = nullptr;
+void m_glSetInvariantEXT_profile(GLuint a0,GLenum a1,const void* a2)const{return this->m_profile(261,m_next_glSetInvariantEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC m_next_glGetTexBumpParameterivATI = nullptr;
+void m_glGetTexBumpParameterivATI_profile(GLenum a0,GLint* a1)const{return this->m_profile(262,m_next_glGetTexBumpParameterivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC m_next_glBlendEquationSeparateEXT = nullptr;
+void m_glBlendEquationSeparateEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(263,m_next_glBlendEquationSeparateEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC m_next_glEndOcclusionQueryNV = nullptr;
+void m_glEndOcclusionQueryNV_profile()const{return this->m_profile(264,m_next_glEndOcclusionQueryNV);}
+FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC m_next_glScissorArrayv = nullptr;
+void m_glScissorArrayv_profile(GLuint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(265,m_next_glScissorArrayv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCALLLISTPROC m_next_glCallList = nullptr;
+void m_glCallList_profile(GLuint a0)const{return this->m_profile(266,m_next_glCallList,a0);}
+FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC m_next_glMapTexture2DINTEL = nullptr;
+void* m_glMapTexture2DINTEL_profile(GLuint a0,GLint a1,GLbitfield a2,GLint* a3,GLenum* a4)const{return this->m_profile(267,m_next_glMapTexture2DINTEL,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC m_next_glGetVkProcAddrNV = nullptr;
+GLVULKANPROCNV m_glGetVkProcAddrNV_profile(const GLchar* a0)const{return this->m_profile(268,m_next_glGetVkProcAddrNV,a0);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC m_next_glPixelTransferxOES = nullptr;
+void m_glPixelTransferxOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(269,m_next_glPixelTransferxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC m_next_glDeleteRenderbuffersEXT = nullptr;
+void m_glDeleteRenderbuffersEXT_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(270,m_next_glDeleteRenderbuffersEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC m_next_glTexCoord4fColor4fNormal3fVertex4fSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11,GLfloat a12,GLfloat a13,GLfloat a14)const{return this->m_profile(271,m_next_glTexCoord4fColor4fNormal3fVertex4fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC m_next_glProgramUniformMatrix4dvEXT = nullptr;
+void m_glProgramUniformMatrix4dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(272,m_next_glProgramUniformMatrix4dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC m_next_glGetnColorTable = nullptr;
+void m_glGetnColorTable_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4)const{return this->m_profile(273,m_next_glGetnColorTable,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC m_next_glFramebufferTextureLayerARB = nullptr;
+void m_glFramebufferTextureLayerARB_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{return this->m_profile(274,m_next_glFramebufferTextureLayerARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC m_next_glVertexAttribL2dvEXT = nullptr;
+void m_glVertexAttribL2dvEXT_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(275,m_next_glVertexAttribL2dvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC m_next_glGetCombinerStageParameterfvNV = nullptr;
+void m_glGetCombinerStageParameterfvNV_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(276,m_next_glGetCombinerStageParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC m_next_glMultiTexCoord1xvOES = nullptr;
+void m_glMultiTexCoord1xvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(277,m_next_glMultiTexCoord1xvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLMAPBUFFERPROC m_next_glMapBuffer = nullptr;
+void* m_glMapBuffer_profile(GLenum a0,GLenum a1)const{return this->m_profile(278,m_next_glMapBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC m_next_glSecondaryColor3d = nullptr;
+void m_glSecondaryColor3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(279,m_next_glSecondaryColor3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC m_next_glSecondaryColor3f = nullptr;
+void m_glSecondaryColor3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(280,m_next_glSecondaryColor3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC m_next_glVertexAttribLFormat = nullptr;
+void m_glVertexAttribLFormat_profile(GLuint a0,GLint a1,GLenum a2,GLuint a3)const{return this->m_profile(281,m_next_glVertexAttribLFormat,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC m_next_glElementPointerAPPLE = nullptr;
+void m_glElementPointerAPPLE_profile(GLenum a0,const void* a1)const{return this->m_profile(282,m_next_glElementPointerAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC m_next_glVertexStream1fATI = nullptr;
+void m_glVertexStream1fATI_profile(GLenum a0,GLfloat a1)const{return this->m_profile(283,m_next_glVertexStream1fATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC m_next_glCoverageModulationNV = nullptr;
+void m_glCoverageModulationNV_profile(GLenum a0)const{return this->m_profile(284,m_next_glCoverageModulationNV,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC m_next_glSecondaryColor3i = nullptr;
+void m_glSecondaryColor3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(285,m_next_glSecondaryColor3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETESYNCPROC m_next_glDeleteSync = nullptr;
+void m_glDeleteSync_profile(GLsync a0)const{return this->m_profile(286,m_next_glDeleteSync,a0);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC m_next_glGetProgramParameterfvNV = nullptr;
+void m_glGetProgramParameterfvNV_profile(GLenum a0,GLuint a1,GLenum a2,GLfloat* a3)const{return this->m_profile(287,m_next_glGetProgramParameterfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC m_next_glMaxShaderCompilerThreadsARB = nullptr;
+void m_glMaxShaderCompilerThreadsARB_profile(GLuint a0)const{return this->m_profile(288,m_next_glMaxShaderCompilerThreadsARB,a0);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC m_next_glUniformMatrix4x2dv = nullptr;
+void m_glUniformMatrix4x2dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(289,m_next_glUniformMatrix4x2dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC m_next_glVertexArrayVertexAttribLOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribLOffsetEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{return this->m_profile(290,m_next_glVertexArrayVertexAttribLOffsetEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC m_next_glSecondaryColor3s = nullptr;
+void m_glSecondaryColor3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(291,m_next_glSecondaryColor3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC m_next_glIsImageHandleResidentNV = nullptr;
+GLboolean m_glIsImageHandleResidentNV_profile(GLuint64 a0)const{return this->m_profile(292,m_next_glIsImageHandleResidentNV,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM3IVPROC m_next_glUniform3iv = nullptr;
+void m_glUniform3iv_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(293,m_next_glUniform3iv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC m_next_glVertexAttribL3i64vNV = nullptr;
+void m_glVertexAttribL3i64vNV_profile(GLuint a0,const GLint64EXT* a1)const{return this->m_profile(294,m_next_glVertexAttribL3i64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPOLYGONMODEPROC m_next_glPolygonMode = nullptr;
+void m_glPolygonMode_profile(GLenum a0,GLenum a1)const{return this->m_profile(295,m_next_glPolygonMode,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_next_glFramebufferSamplePositionsfvAMD = nullptr;
+void m_glFramebufferSamplePositionsfvAMD_profile(GLenum a0,GLuint a1,GLuint a2,const GLfloat* a3)const{return this->m_profile(296,m_next_glFramebufferSamplePositionsfvAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC m_next_glConvolutionFilter1DEXT = nullptr;
+void m_glConvolutionFilter1DEXT_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{return this->m_profile(297,m_next_glConvolutionFilter1DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC m_next_glVertexAttrib1dvARB = nullptr;
+void m_glVertexAttrib1dvARB_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(298,m_next_glVertexAttrib1dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC m_next_glTextureSubImage2DEXT = nullptr;
+void m_glTextureSubImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLenum a8,const void* a9)const{return this->m_profile(299,m_next_glTextureSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC m_next_glIsVertexArrayAPPLE = nullptr;
+GLboolean m_glIsVertexArrayAPPLE_profile(GLuint a0)const{return this->m_profile(300,m_next_glIsVertexArrayAPPLE,a0);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMPROC m_next_glUseProgram = nullptr;
+void m_glUseProgram_profile(GLuint a0)const{return this->m_profile(301,m_next_glUseProgram,a0);}
+FunctionTable::MEMBERPFNGLLINESTIPPLEPROC m_next_glLineStipple = nullptr;
+void m_glLineStipple_profile(GLint a0,GLushort a1)const{return this->m_profile(302,m_next_glLineStipple,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC m_next_glMultiTexCoord4fvARB = nullptr;
+void m_glMultiTexCoord4fvARB_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(303,m_next_glMultiTexCoord4fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC m_next_glVideoCaptureNV = nullptr;
+GLenum m_glVideoCaptureNV_profile(GLuint a0,GLuint* a1,GLuint64EXT* a2)const{return this->m_profile(304,m_next_glVideoCaptureNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC m_next_glVertexArrayVertexAttribLFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribLFormatEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{return this->m_profile(305,m_next_glVertexArrayVertexAttribLFormatEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC m_next_glUniform3fvARB = nullptr;
+void m_glUniform3fvARB_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(306,m_next_glUniform3fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC m_next_glProgramUniformMatrix3x2fvEXT = nullptr;
+void m_glProgramUniformMatrix3x2fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(307,m_next_glProgramUniformMatrix3x2fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC m_next_glCopyTextureSubImage3DEXT = nullptr;
+void m_glCopyTextureSubImage3DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLsizei a8,GLsizei a9)const{return this->m_profile(308,m_next_glCopyTextureSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC m_next_glMultiTexCoord2bvOES = nullptr;
+void m_glMultiTexCoord2bvOES_profile(GLenum a0,const GLbyte* a1)const{return this->m_profile(309,m_next_glMultiTexCoord2bvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC m_next_glDeleteObjectARB = nullptr;
+void m_glDeleteObjectARB_profile(GLhandleARB a0)const{return this->m_profile(310,m_next_glDeleteObjectARB,a0);}
+FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC m_next_glTextureLightEXT = nullptr;
+void m_glTextureLightEXT_profile(GLenum a0)const{return this->m_profile(311,m_next_glTextureLightEXT,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS3IPROC m_next_glRasterPos3i = nullptr;
+void m_glRasterPos3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(312,m_next_glRasterPos3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC m_next_glMultiTexCoord3dARB = nullptr;
+void m_glMultiTexCoord3dARB_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(313,m_next_glMultiTexCoord3dARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC m_next_glNamedFramebufferTextureEXT = nullptr;
+void m_glNamedFramebufferTextureEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3)const{return this->m_profile(314,m_next_glNamedFramebufferTextureEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC m_next_glTextureParameteriEXT = nullptr;
+void m_glTextureParameteriEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLint a3)const{return this->m_profile(315,m_next_glTextureParameteriEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC m_next_glEvalCoord2xvOES = nullptr;
+void m_glEvalCoord2xvOES_profile(const GLfixed* a0)const{return this->m_profile(316,m_next_glEvalCoord2xvOES,a0);}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC m_next_glBindVideoCaptureStreamBufferNV = nullptr;
+void m_glBindVideoCaptureStreamBufferNV_profile(GLuint a0,GLuint a1,GLenum a2,GLintptrARB a3)const{return this->m_profile(317,m_next_glBindVideoCaptureStreamBufferNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC m_next_glTexImage2DMultisampleCoverageNV = nullptr;
+void m_glTexImage2DMultisampleCoverageNV_profile(GLenum a0,GLsizei a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(318,m_next_glTexImage2DMultisampleCoverageNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC m_next_glGetAttribLocationARB = nullptr;
+GLint m_glGetAttribLocationARB_profile(GLhandleARB a0,const GLcharARB* a1)const{return this->m_profile(319,m_next_glGetAttribLocationARB,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETESHADERPROC m_next_glDeleteShader = nullptr;
+void m_glDeleteShader_profile(GLuint a0)const{return this->m_profile(320,m_next_glDeleteShader,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC m_next_glVertexAttrib1fARB = nullptr;
+void m_glVertexAttrib1fARB_profile(GLuint a0,GLfloat a1)const{return this->m_profile(321,m_next_glVertexAttrib1fARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC m_next_glTexCoord2fColor4ubVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLubyte a2,GLubyte a3,GLubyte a4,GLubyte a5,GLfloat a6,GLfloat a7,GLfloat a8)const{return this->m_profile(322,m_next_glTexCoord2fColor4ubVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC m_next_glTexCoord4fVertex4fSUN = nullptr;
+void m_glTexCoord4fVertex4fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{return this->m_profile(323,m_next_glTexCoord4fVertex4fSUN,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETMAPDVPROC m_next_glGetMapdv = nullptr;
+void m_glGetMapdv_profile(GLenum a0,GLenum a1,GLdouble* a2)const{return this->m_profile(324,m_next_glGetMapdv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC m_next_glMapParameterfvNV = nullptr;
+void m_glMapParameterfvNV_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(325,m_next_glMapParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC m_next_glTextureParameterIuiv = nullptr;
+void m_glTextureParameterIuiv_profile(GLuint a0,GLenum a1,const GLuint* a2)const{return this->m_profile(326,m_next_glTextureParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC m_next_glTransformFeedbackAttribsNV = nullptr;
+void m_glTransformFeedbackAttribsNV_profile(GLsizei a0,const GLint* a1,GLenum a2)const{return this->m_profile(327,m_next_glTransformFeedbackAttribsNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC m_next_glFragmentLightfvSGIX = nullptr;
+void m_glFragmentLightfvSGIX_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(328,m_next_glFragmentLightfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC m_next_glWindowPos3sARB = nullptr;
+void m_glWindowPos3sARB_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(329,m_next_glWindowPos3sARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC m_next_glGetConvolutionParameterfv = nullptr;
+void m_glGetConvolutionParameterfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(330,m_next_glGetConvolutionParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC m_next_glCopyTexSubImage3D = nullptr;
+void m_glCopyTexSubImage3D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{return this->m_profile(331,m_next_glCopyTexSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC m_next_glVertexAttribI3i = nullptr;
+void m_glVertexAttribI3i_profile(GLuint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(332,m_next_glVertexAttribI3i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC m_next_glCreateShaderObjectARB = nullptr;
+GLhandleARB m_glCreateShaderObjectARB_profile(GLenum a0)const{return this->m_profile(333,m_next_glCreateShaderObjectARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC m_next_glVertexAttribFormat = nullptr;
+void m_glVertexAttribFormat_profile(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLuint a4)const{return this->m_profile(334,m_next_glVertexAttribFormat,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC m_next_glGetProgramivARB = nullptr;
+void m_glGetProgramivARB_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(335,m_next_glGetProgramivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC m_next_glVertexAttribI4usv = nullptr;
+void m_glVertexAttribI4usv_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(336,m_next_glVertexAttribI4usv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC m_next_glTexParameterf = nullptr;
+void m_glTexParameterf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(337,m_next_glTexParameterf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC m_next_glVertexAttribBinding = nullptr;
+void m_glVertexAttribBinding_profile(GLuint a0,GLuint a1)const{return this->m_profile(338,m_next_glVertexAttribBinding,a0,a1);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC m_next_glGetHistogramParameteriv = nullptr;
+void m_glGetHistogramParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(339,m_next_glGetHistogramParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC m_next_glTexParameteri = nullptr;
+void m_glTexParameteri_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(340,m_next_glTexParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC m_next_glGetShaderSource = nullptr;
+void m_glGetShaderSource_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(341,m_next_glGetShaderSource,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC m_next_glVertexAttrib4s = nullptr;
+void m_glVertexAttrib4s_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(342,m_next_glVertexAttrib4s,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC m_next_glVertexAttrib4dvNV = nullptr;
+void m_glVertexAttrib4dvNV_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(343,m_next_glVertexAttrib4dvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC m_next_glVertexAttrib1dvNV = nullptr;
+void m_glVertexAttrib1dvNV_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(344,m_next_glVertexAttrib1dvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPOPNAMEPROC m_next_glPopName = nullptr;
+void m_glPopName_profile()const{return this->m_profile(345,m_next_glPopName);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC m_next_glTextureBufferEXT = nullptr;
+void m_glTextureBufferEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(346,m_next_glTextureBufferEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC m_next_glGetMultiTexImageEXT = nullptr;
+void m_glGetMultiTexImageEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLenum a4,void* a5)const{return this->m_profile(347,m_next_glGetMultiTexImageEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC m_next_glGetPointerIndexedvEXT = nullptr;
+void m_glGetPointerIndexedvEXT_profile(GLenum a0,GLuint a1,void** a2)const{return this->m_profile(348,m_next_glGetPointerIndexedvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISNAMEAMDPROC m_next_glIsNameAMD = nullptr;
+GLboolean m_glIsNameAMD_profile(GLenum a0,GLuint a1)const{return this->m_profile(349,m_next_glIsNameAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4UBPROC m_next_glColor4ub = nullptr;
+void m_glColor4ub_profile(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3)const{return this->m_profile(350,m_next_glColor4ub,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC m_next_glBufferParameteriAPPLE = nullptr;
+void m_glBufferParameteriAPPLE_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(351,m_next_glBufferParameteriAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4UIPROC m_next_glColor4ui = nullptr;
+void m_glColor4ui_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(352,m_next_glColor4ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC m_next_glGetInternalformativ = nullptr;
+void m_glGetInternalformativ_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,GLint* a4)const{return this->m_profile(353,m_next_glGetInternalformativ,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLOR4USPROC m_next_glColor4us = nullptr;
+void m_glColor4us_profile(GLushort a0,GLushort a1,GLushort a2,GLushort a3)const{return this->m_profile(354,m_next_glColor4us,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC m_next_glVertexAttribP1uiv = nullptr;
+void m_glVertexAttribP1uiv_profile(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{return this->m_profile(355,m_next_glVertexAttribP1uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLINKPROGRAMPROC m_next_glLinkProgram = nullptr;
+void m_glLinkProgram_profile(GLuint a0)const{return this->m_profile(356,m_next_glLinkProgram,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD3SPROC m_next_glTexCoord3s = nullptr;
+void m_glTexCoord3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(357,m_next_glTexCoord3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC m_next_glTexCoord2dv = nullptr;
+void m_glTexCoord2dv_profile(const GLdouble* a0)const{return this->m_profile(358,m_next_glTexCoord2dv,a0);}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC m_next_glGetObjectLabel = nullptr;
+void m_glGetObjectLabel_profile(GLenum a0,GLuint a1,GLsizei a2,GLsizei* a3,GLchar* a4)const{return this->m_profile(359,m_next_glGetObjectLabel,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC m_next_glVertexPointerEXT = nullptr;
+void m_glVertexPointerEXT_profile(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{return this->m_profile(360,m_next_glVertexPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC m_next_glDebugMessageCallbackARB = nullptr;
+void m_glDebugMessageCallbackARB_profile(GLDEBUGPROCARB a0,const void* a1)const{return this->m_profile(361,m_next_glDebugMessageCallbackARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETSTRINGPROC m_next_glGetString = nullptr;
+const GLubyte* m_glGetString_profile(GLenum a0)const{return this->m_profile(362,m_next_glGetString,a0);}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC m_next_glGetPathParameterfvNV = nullptr;
+void m_glGetPathParameterfvNV_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(363,m_next_glGetPathParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLIGHTXVOESPROC m_next_glLightxvOES = nullptr;
+void m_glLightxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(364,m_next_glLightxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLENDQUERYPROC m_next_glEndQuery = nullptr;
+void m_glEndQuery_profile(GLenum a0)const{return this->m_profile(365,m_next_glEndQuery,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC m_next_glSecondaryColor3uiv = nullptr;
+void m_glSecondaryColor3uiv_profile(const GLuint* a0)const{return this->m_profile(366,m_next_glSecondaryColor3uiv,a0);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC m_next_glPrioritizeTexturesxOES = nullptr;
+void m_glPrioritizeTexturesxOES_profile(GLsizei a0,const GLuint* a1,const GLfixed* a2)const{return this->m_profile(367,m_next_glPrioritizeTexturesxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC m_next_glEdgeFlagPointer = nullptr;
+void m_glEdgeFlagPointer_profile(GLsizei a0,const GLvoid* a1)const{return this->m_profile(368,m_next_glEdgeFlagPointer,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC m_next_glFramebufferParameteri = nullptr;
+void m_glFramebufferParameteri_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(369,m_next_glFramebufferParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC m_next_glTexCoord3hNV = nullptr;
+void m_glTexCoord3hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(370,m_next_glTexCoord3hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC m_next_glMultiModeDrawElementsIBM = nullptr;
+void m_glMultiModeDrawElementsIBM_profile(const GLenum* a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4,GLint a5)const{return this->m_profile(371,m_next_glMultiModeDrawElementsIBM,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOPYPIXELSPROC m_next_glCopyPixels = nullptr;
+void m_glCopyPixels_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3,GLenum a4)const{return this->m_profile(372,m_next_glCopyPixels,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC m_next_glVertexAttribI2ui = nullptr;
+void m_glVertexAttribI2ui_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(373,m_next_glVertexAttribI2ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC m_next_glClampColorARB = nullptr;
+void m_glClampColorARB_profile(GLenum a0,GLenum a1)const{return this->m_profile(374,m_next_glClampColorARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC m_next_glColorPointervINTEL = nullptr;
+void m_glColorPointervINTEL_profile(GLint a0,GLenum a1,const void** a2)const{return this->m_profile(375,m_next_glColorPointervINTEL,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETETEXTURESPROC m_next_glDeleteTextures = nullptr;
+void m_glDeleteTextures_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(376,m_next_glDeleteTextures,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC m_next_glGetMinmaxParameterfvEXT = nullptr;
+void m_glGetMinmaxParameterfvEXT_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(377,m_next_glGetMinmaxParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC m_next_glWindowPos3sMESA = nullptr;
+void m_glWindowPos3sMESA_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(378,m_next_glWindowPos3sMESA,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC m_next_glVertexAttrib4f = nullptr;
+void m_glVertexAttrib4f_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(379,m_next_glVertexAttrib4f,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC m_next_glNamedFramebufferParameteri = nullptr;
+void m_glNamedFramebufferParameteri_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(380,m_next_glNamedFramebufferParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC m_next_glTexCoord2fVertex3fvSUN = nullptr;
+void m_glTexCoord2fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1)const{return this->m_profile(381,m_next_glTexCoord2fVertex3fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC m_next_glReplacementCodeusSUN = nullptr;
+void m_glReplacementCodeusSUN_profile(GLushort a0)const{return this->m_profile(382,m_next_glReplacementCodeusSUN,a0);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC m_next_glGetNamedFramebufferParameteriv = nullptr;
+void m_glGetNamedFramebufferParameteriv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(383,m_next_glGetNamedFramebufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC m_next_glVertexStream1fvATI = nullptr;
+void m_glVertexStream1fvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(384,m_next_glVertexStream1fvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC m_next_glCreateVertexArrays = nullptr;
+void m_glCreateVertexArrays_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(385,m_next_glCreateVertexArrays,a0,a1);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC m_next_glBeginConditionalRender = nullptr;
+void m_glBeginConditionalRender_profile(GLuint a0,GLenum a1)const{return this->m_profile(386,m_next_glBeginConditionalRender,a0,a1);}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC m_next_glGetUnsignedBytevEXT = nullptr;
+void m_glGetUnsignedBytevEXT_profile(GLenum a0,GLubyte* a1)const{return this->m_profile(387,m_next_glGetUnsignedBytevEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC m_next_glConvolutionFilter1D = nullptr;
+void m_glConvolutionFilter1D_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{return this->m_profile(388,m_next_glConvolutionFilter1D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC m_next_glMultiTexCoord3fARB = nullptr;
+void m_glMultiTexCoord3fARB_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(389,m_next_glMultiTexCoord3fARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC m_next_glGetQueryObjectuivARB = nullptr;
+void m_glGetQueryObjectuivARB_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(390,m_next_glGetQueryObjectuivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSCALEXOESPROC m_next_glScalexOES = nullptr;
+void m_glScalexOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(391,m_next_glScalexOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC m_next_glSamplerParameteri = nullptr;
+void m_glSamplerParameteri_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(392,m_next_glSamplerParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC m_next_glSamplerParameterf = nullptr;
+void m_glSamplerParameterf_profile(GLuint a0,GLenum a1,GLfloat a2)const{return this->m_profile(393,m_next_glSamplerParameterf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC m_next_glShaderOp1EXT = nullptr;
+void m_glShaderOp1EXT_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(394,m_next_glShaderOp1EXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC m_next_glBeginVideoCaptureNV = nullptr;
+void m_glBeginVideoCaptureNV_profile(GLuint a0)const{return this->m_profile(395,m_next_glBeginVideoCaptureNV,a0);}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC m_next_glGetnHistogram = nullptr;
+void m_glGetnHistogram_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(396,m_next_glGetnHistogram,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORM1DPROC m_next_glUniform1d = nullptr;
+void m_glUniform1d_profile(GLint a0,GLdouble a1)const{return this->m_profile(397,m_next_glUniform1d,a0,a1);}
+FunctionTable::MEMBERPFNGLRENDERMODEPROC m_next_glRenderMode = nullptr;
+GLint m_glRenderMode_profile(GLenum a0)const{return this->m_profile(398,m_next_glRenderMode,a0);}
+FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC m_next_glClearColorIiEXT = nullptr;
+void m_glClearColorIiEXT_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(399,m_next_glClearColorIiEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC m_next_glSignalSemaphoreEXT = nullptr;
+void m_glSignalSemaphoreEXT_profile(GLuint a0,GLuint a1,const GLuint* a2,GLuint a3,const GLuint* a4,const GLenum* a5)const{return this->m_profile(400,m_next_glSignalSemaphoreEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC m_next_glGetCompressedTexImage = nullptr;
+void m_glGetCompressedTexImage_profile(GLenum a0,GLint a1,GLvoid* a2)const{return this->m_profile(401,m_next_glGetCompressedTexImage,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC m_next_glCompressedTextureImage1DEXT = nullptr;
+void m_glCompressedTextureImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{return this->m_profile(402,m_next_glCompressedTextureImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC m_next_glGetActiveUniformBlockiv = nullptr;
+void m_glGetActiveUniformBlockiv_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(403,m_next_glGetActiveUniformBlockiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM1IPROC m_next_glUniform1i = nullptr;
+void m_glUniform1i_profile(GLint a0,GLint a1)const{return this->m_profile(404,m_next_glUniform1i,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC m_next_glMultiDrawArraysIndirectCount = nullptr;
+void m_glMultiDrawArraysIndirectCount_profile(GLenum a0,const void* a1,GLintptr a2,GLsizei a3,GLsizei a4)const{return this->m_profile(405,m_next_glMultiDrawArraysIndirectCount,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXENVFVPROC m_next_glGetTexEnvfv = nullptr;
+void m_glGetTexEnvfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(406,m_next_glGetTexEnvfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC m_next_glColorTableParameterivSGI = nullptr;
+void m_glColorTableParameterivSGI_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(407,m_next_glColorTableParameterivSGI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCULLFACEPROC m_next_glCullFace = nullptr;
+void m_glCullFace_profile(GLenum a0)const{return this->m_profile(408,m_next_glCullFace,a0);}
+FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC m_next_glDeleteFencesAPPLE = nullptr;
+void m_glDeleteFencesAPPLE_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(409,m_next_glDeleteFencesAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC m_next_glProgramUniform4i = nullptr;
+void m_glProgramUniform4i_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{return this->m_profile(410,m_next_glProgramUniform4i,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC m_next_glUniformHandleui64ARB = nullptr;
+void m_glUniformHandleui64ARB_profile(GLint a0,GLuint64 a1)const{return this->m_profile(411,m_next_glUniformHandleui64ARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC m_next_glProgramUniform4f = nullptr;
+void m_glProgramUniform4f_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(412,m_next_glProgramUniform4f,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC m_next_glViewportIndexedf = nullptr;
+void m_glViewportIndexedf_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(413,m_next_glViewportIndexedf,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC m_next_glProgramUniform4d = nullptr;
+void m_glProgramUniform4d_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(414,m_next_glProgramUniform4d,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC m_next_glTexCoord1xOES = nullptr;
+void m_glTexCoord1xOES_profile(GLfixed a0)const{return this->m_profile(415,m_next_glTexCoord1xOES,a0);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC m_next_glVertexStream3ivATI = nullptr;
+void m_glVertexStream3ivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(416,m_next_glVertexStream3ivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC m_next_glPointAlongPathNV = nullptr;
+GLboolean m_glPointAlongPathNV_profile(GLuint a0,GLsizei a1,GLsizei a2,GLfloat a3,GLfloat* a4,GLfloat* a5,GLfloat* a6,GLfloat* a7)const{return this->m_profile(417,m_next_glPointAlongPathNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLENDQUERYARBPROC m_next_glEndQueryARB = nullptr;
+void m_glEndQueryARB_profile(GLenum a0)const{return this->m_profile(418,m_next_glEndQueryARB,a0);}
+FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC m_next_glVDPAUMapSurfacesNV = nullptr;
+void m_glVDPAUMapSurfacesNV_profile(GLsizei a0,const GLvdpauSurfaceNV* a1)const{return this->m_profile(419,m_next_glVDPAUMapSurfacesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX3IPROC m_next_glVertex3i = nullptr;
+void m_glVertex3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(420,m_next_glVertex3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC m_next_glVertexAttrib4uivARB = nullptr;
+void m_glVertexAttrib4uivARB_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(421,m_next_glVertexAttrib4uivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC m_next_glTextureStorageMem3DEXT = nullptr;
+void m_glTextureStorageMem3DEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLuint a6,GLuint64 a7)const{return this->m_profile(422,m_next_glTextureStorageMem3DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLATTACHSHADERPROC m_next_glAttachShader = nullptr;
+void m_glAttachShader_profile(GLuint a0,GLuint a1)const{return this->m_profile(423,m_next_glAttachShader,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4HNVPROC m_next_glColor4hNV = nullptr;
+void m_glColor4hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{return this->m_profile(424,m_next_glColor4hNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC m_next_glGetFenceivNV = nullptr;
+void m_glGetFenceivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(425,m_next_glGetFenceivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC m_next_glTexCoord2fColor4ubVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fvSUN_profile(const GLfloat* a0,const GLubyte* a1,const GLfloat* a2)const{return this->m_profile(426,m_next_glTexCoord2fColor4ubVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC m_next_glGetColorTable = nullptr;
+void m_glGetColorTable_profile(GLenum a0,GLenum a1,GLenum a2,GLvoid* a3)const{return this->m_profile(427,m_next_glGetColorTable,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC m_next_glFogCoordPointer = nullptr;
+void m_glFogCoordPointer_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(428,m_next_glFogCoordPointer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC m_next_glTexStorageSparseAMD = nullptr;
+void m_glTexStorageSparseAMD_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLsizei a4,GLsizei a5,GLbitfield a6)const{return this->m_profile(429,m_next_glTexStorageSparseAMD,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC m_next_glUnmapNamedBuffer = nullptr;
+GLboolean m_glUnmapNamedBuffer_profile(GLuint a0)const{return this->m_profile(430,m_next_glUnmapNamedBuffer,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC m_next_glTexCoord4bvOES = nullptr;
+void m_glTexCoord4bvOES_profile(const GLbyte* a0)const{return this->m_profile(431,m_next_glTexCoord4bvOES,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC m_next_glVertexAttrib3fARB = nullptr;
+void m_glVertexAttrib3fARB_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(432,m_next_glVertexAttrib3fARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC m_next_glRasterPos2xOES = nullptr;
+void m_glRasterPos2xOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(433,m_next_glRasterPos2xOES,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC m_next_glCreateMemoryObjectsEXT = nullptr;
+void m_glCreateMemoryObjectsEXT_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(434,m_next_glCreateMemoryObjectsEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC m_next_glColor4ubVertex2fvSUN = nullptr;
+void m_glColor4ubVertex2fvSUN_profile(const GLubyte* a0,const GLfloat* a1)const{return this->m_profile(435,m_next_glColor4ubVertex2fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC m_next_glSecondaryColor3dv = nullptr;
+void m_glSecondaryColor3dv_profile(const GLdouble* a0)const{return this->m_profile(436,m_next_glSecondaryColor3dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC m_next_glVertexAttribI4sv = nullptr;
+void m_glVertexAttribI4sv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(437,m_next_glVertexAttribI4sv,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC m_next_glDrawTransformFeedbackStreamInstanced = nullptr;
+void m_glDrawTransformFeedbackStreamInstanced_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3)const{return this->m_profile(438,m_next_glDrawTransformFeedbackStreamInstanced,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC m_next_glMultiTexCoord4ivARB = nullptr;
+void m_glMultiTexCoord4ivARB_profile(GLenum a0,const GLint* a1)const{return this->m_profile(439,m_next_glMultiTexCoord4ivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC m_next_glSpriteParameterfSGIX = nullptr;
+void m_glSpriteParameterfSGIX_profile(GLenum a0,GLfloat a1)const{return this->m_profile(440,m_next_glSpriteParameterfSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC m_next_glSecondaryColor3sv = nullptr;
+void m_glSecondaryColor3sv_profile(const GLshort* a0)const{return this->m_profile(441,m_next_glSecondaryColor3sv,a0);}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC m_next_glBindVideoCaptureStreamTextureNV = nullptr;
+void m_glBindVideoCaptureStreamTextureNV_profile(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLuint a4)const{return this->m_profile(442,m_next_glBindVideoCaptureStreamTextureNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC m_next_glTexParameterIuiv = nullptr;
+void m_glTexParameterIuiv_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(443,m_next_glTexParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC m_next_glFlushPixelDataRangeNV = nullptr;
+void m_glFlushPixelDataRangeNV_profile(GLenum a0)const{return this->m_profile(444,m_next_glFlushPixelDataRangeNV,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC m_next_glWindowPos3fv = nullptr;
+void m_glWindowPos3fv_profile(const GLfloat* a0)const{return this->m_profile(445,m_next_glWindowPos3fv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC m_next_glVertexAttribLFormatNV = nullptr;
+void m_glVertexAttribLFormatNV_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3)const{return this->m_profile(446,m_next_glVertexAttribLFormatNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC m_next_glLightModelfv = nullptr;
+void m_glLightModelfv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(447,m_next_glLightModelfv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC m_next_glGetColorTableSGI = nullptr;
+void m_glGetColorTableSGI_profile(GLenum a0,GLenum a1,GLenum a2,void* a3)const{return this->m_profile(448,m_next_glGetColorTableSGI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC m_next_glGetCompressedTexImageARB = nullptr;
+void m_glGetCompressedTexImageARB_profile(GLenum a0,GLint a1,void* a2)const{return this->m_profile(449,m_next_glGetCompressedTexImageARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC m_next_glConvolutionParameteri = nullptr;
+void m_glConvolutionParameteri_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(450,m_next_glConvolutionParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC m_next_glVertexWeighthNV = nullptr;
+void m_glVertexWeighthNV_profile(GLhalfNV a0)const{return this->m_profile(451,m_next_glVertexWeighthNV,a0);}
+FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC m_next_glColorMaskIndexedEXT = nullptr;
+void m_glColorMaskIndexedEXT_profile(GLuint a0,GLboolean a1,GLboolean a2,GLboolean a3,GLboolean a4)const{return this->m_profile(452,m_next_glColorMaskIndexedEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLORMASKIPROC m_next_glColorMaski = nullptr;
+void m_glColorMaski_profile(GLuint a0,GLboolean a1,GLboolean a2,GLboolean a3,GLboolean a4)const{return this->m_profile(453,m_next_glColorMaski,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC m_next_glColorFragmentOp1ATI = nullptr;
+void m_glColorFragmentOp1ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6)const{return this->m_profile(454,m_next_glColorFragmentOp1ATI,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC m_next_glVertexAttribI4ubvEXT = nullptr;
+void m_glVertexAttribI4ubvEXT_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(455,m_next_glVertexAttribI4ubvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC m_next_glVertexAttrib1dNV = nullptr;
+void m_glVertexAttrib1dNV_profile(GLuint a0,GLdouble a1)const{return this->m_profile(456,m_next_glVertexAttrib1dNV,a0,a1);}
+FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC m_next_glUnmapObjectBufferATI = nullptr;
+void m_glUnmapObjectBufferATI_profile(GLuint a0)const{return this->m_profile(457,m_next_glUnmapObjectBufferATI,a0);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC m_next_glNamedProgramLocalParameterI4uiEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uiEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6)const{return this->m_profile(458,m_next_glNamedProgramLocalParameterI4uiEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC m_next_glProgramUniform1iEXT = nullptr;
+void m_glProgramUniform1iEXT_profile(GLuint a0,GLint a1,GLint a2)const{return this->m_profile(459,m_next_glProgramUniform1iEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC m_next_glDeleteQueriesARB = nullptr;
+void m_glDeleteQueriesARB_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(460,m_next_glDeleteQueriesARB,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC m_next_glWindowPos3svARB = nullptr;
+void m_glWindowPos3svARB_profile(const GLshort* a0)const{return this->m_profile(461,m_next_glWindowPos3svARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEX4SPROC m_next_glVertex4s = nullptr;
+void m_glVertex4s_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(462,m_next_glVertex4s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC m_next_glImportMemoryWin32NameEXT = nullptr;
+void m_glImportMemoryWin32NameEXT_profile(GLuint a0,GLuint64 a1,GLenum a2,const void* a3)const{return this->m_profile(463,m_next_glImportMemoryWin32NameEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC m_next_glStringMarkerGREMEDY = nullptr;
+void m_glStringMarkerGREMEDY_profile(GLsizei a0,const void* a1)const{return this->m_profile(464,m_next_glStringMarkerGREMEDY,a0,a1);}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC m_next_glIsTransformFeedback = nullptr;
+GLboolean m_glIsTransformFeedback_profile(GLuint a0)const{return this->m_profile(465,m_next_glIsTransformFeedback,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC m_next_glProgramUniformMatrix2x3dvEXT = nullptr;
+void m_glProgramUniformMatrix2x3dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(466,m_next_glProgramUniformMatrix2x3dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC m_next_glGetObjectLabelEXT = nullptr;
+void m_glGetObjectLabelEXT_profile(GLenum a0,GLuint a1,GLsizei a2,GLsizei* a3,GLchar* a4)const{return this->m_profile(467,m_next_glGetObjectLabelEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC m_next_glUniformHandleui64vNV = nullptr;
+void m_glUniformHandleui64vNV_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(468,m_next_glUniformHandleui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLROTATEDPROC m_next_glRotated = nullptr;
+void m_glRotated_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(469,m_next_glRotated,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC m_next_glIsProgramPipeline = nullptr;
+GLboolean m_glIsProgramPipeline_profile(GLuint a0)const{return this->m_profile(470,m_next_glIsProgramPipeline,a0);}
+FunctionTable::MEMBERPFNGLROTATEFPROC m_next_glRotatef = nullptr;
+void m_glRotatef_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(471,m_next_glRotatef,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEX4IPROC m_next_glVertex4i = nullptr;
+void m_glVertex4i_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(472,m_next_glVertex4i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC m_next_glGetActiveSubroutineUniformName = nullptr;
+void m_glGetActiveSubroutineUniformName_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,GLsizei* a4,GLchar* a5)const{return this->m_profile(473,m_next_glGetActiveSubroutineUniformName,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC m_next_glVertexAttrib4sNV = nullptr;
+void m_glVertexAttrib4sNV_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(474,m_next_glVertexAttrib4sNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC m_next_glProgramLocalParameter4dvARB = nullptr;
+void m_glProgramLocalParameter4dvARB_profile(GLenum a0,GLuint a1,const GLdouble* a2)const{return this->m_profile(475,m_next_glProgramLocalParameter4dvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC m_next_glReplacementCodeubSUN = nullptr;
+void m_glReplacementCodeubSUN_profile(GLubyte a0)const{return this->m_profile(476,m_next_glReplacementCodeubSUN,a0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC m_next_glMultiDrawElementsIndirectBindlessNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessNV_profile(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4,GLint a5)const{return this->m_profile(477,m_next_glMultiDrawElementsIndirectBindlessNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC m_next_glImportSemaphoreWin32HandleEXT = nullptr;
+void m_glImportSemaphoreWin32HandleEXT_profile(GLuint a0,GLenum a1,void* a2)const{return this->m_profile(478,m_next_glImportSemaphoreWin32HandleEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC m_next_glUniformMatrix3fv = nullptr;
+void m_glUniformMatrix3fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(479,m_next_glUniformMatrix3fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC m_next_glGetnMapfvARB = nullptr;
+void m_glGetnMapfvARB_profile(GLenum a0,GLenum a1,GLsizei a2,GLfloat* a3)const{return this->m_profile(480,m_next_glGetnMapfvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC m_next_glGetnUniformfv = nullptr;
+void m_glGetnUniformfv_profile(GLuint a0,GLint a1,GLsizei a2,GLfloat* a3)const{return this->m_profile(481,m_next_glGetnUniformfv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC m_next_glVertexAttribL2dv = nullptr;
+void m_glVertexAttribL2dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(482,m_next_glVertexAttribL2dv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC m_next_glVertexWeightPointerEXT = nullptr;
+void m_glVertexWeightPointerEXT_profile(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(483,m_next_glVertexWeightPointerEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC m_next_glTangent3sEXT = nullptr;
+void m_glTangent3sEXT_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(484,m_next_glTangent3sEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC m_next_glSecondaryColorPointer = nullptr;
+void m_glSecondaryColorPointer_profile(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(485,m_next_glSecondaryColorPointer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLALPHAFUNCPROC m_next_glAlphaFunc = nullptr;
+void m_glAlphaFunc_profile(GLenum a0,GLclampf a1)const{return this->m_profile(486,m_next_glAlphaFunc,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC m_next_glGetNamedStringARB = nullptr;
+void m_glGetNamedStringARB_profile(GLint a0,const GLchar* a1,GLsizei a2,GLint* a3,GLchar* a4)const{return this->m_profile(487,m_next_glGetNamedStringARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD4DPROC m_next_glTexCoord4d = nullptr;
+void m_glTexCoord4d_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(488,m_next_glTexCoord4d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC m_next_glBufferPageCommitmentARB = nullptr;
+void m_glBufferPageCommitmentARB_profile(GLenum a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{return this->m_profile(489,m_next_glBufferPageCommitmentARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC m_next_glProgramLocalParameters4fvEXT = nullptr;
+void m_glProgramLocalParameters4fvEXT_profile(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(490,m_next_glProgramLocalParameters4fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCPROC m_next_glStencilFunc = nullptr;
+void m_glStencilFunc_profile(GLenum a0,GLint a1,GLuint a2)const{return this->m_profile(491,m_next_glStencilFunc,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC m_next_glSemaphoreParameterui64vEXT = nullptr;
+void m_glSemaphoreParameterui64vEXT_profile(GLuint a0,GLenum a1,const GLuint64* a2)const{return this->m_profile(492,m_next_glSemaphoreParameterui64vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC m_next_glGetVertexAttribdvNV = nullptr;
+void m_glGetVertexAttribdvNV_profile(GLuint a0,GLenum a1,GLdouble* a2)const{return this->m_profile(493,m_next_glGetVertexAttribdvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC m_next_glTexCoord3dv = nullptr;
+void m_glTexCoord3dv_profile(const GLdouble* a0)const{return this->m_profile(494,m_next_glTexCoord3dv,a0);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC m_next_glGetQueryBufferObjectiv = nullptr;
+void m_glGetQueryBufferObjectiv_profile(GLuint a0,GLuint a1,GLenum a2,GLintptr a3)const{return this->m_profile(495,m_next_glGetQueryBufferObjectiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXGENXOESPROC m_next_glTexGenxOES = nullptr;
+void m_glTexGenxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(496,m_next_glTexGenxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC m_next_glMultiTexCoord1fvARB = nullptr;
+void m_glMultiTexCoord1fvARB_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(497,m_next_glMultiTexCoord1fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC m_next_glLightEnviSGIX = nullptr;
+void m_glLightEnviSGIX_profile(GLenum a0,GLint a1)const{return this->m_profile(498,m_next_glLightEnviSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC m_next_glGetProgramPipelineiv = nullptr;
+void m_glGetProgramPipelineiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(499,m_next_glGetProgramPipelineiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC m_next_glVertexStream2ivATI = nullptr;
+void m_glVertexStream2ivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(500,m_next_glVertexStream2ivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC m_next_glGetColorTableEXT = nullptr;
+void m_glGetColorTableEXT_profile(GLenum a0,GLenum a1,GLenum a2,void* a3)const{return this->m_profile(501,m_next_glGetColorTableEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC m_next_glGetShaderInfoLog = nullptr;
+void m_glGetShaderInfoLog_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(502,m_next_glGetShaderInfoLog,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC m_next_glGetOcclusionQueryuivNV = nullptr;
+void m_glGetOcclusionQueryuivNV_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(503,m_next_glGetOcclusionQueryuivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC m_next_glInvalidateNamedFramebufferSubData = nullptr;
+void m_glInvalidateNamedFramebufferSubData_profile(GLuint a0,GLsizei a1,const GLenum* a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6)const{return this->m_profile(504,m_next_glInvalidateNamedFramebufferSubData,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC m_next_glVertexAttribL1i64NV = nullptr;
+void m_glVertexAttribL1i64NV_profile(GLuint a0,GLint64EXT a1)const{return this->m_profile(505,m_next_glVertexAttribL1i64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLVDPAUINITNVPROC m_next_glVDPAUInitNV = nullptr;
+void m_glVDPAUInitNV_profile(const void* a0,const void* a1)const{return this->m_profile(506,m_next_glVDPAUInitNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC m_next_glVertexAttrib1hvNV = nullptr;
+void m_glVertexAttrib1hvNV_profile(GLuint a0,const GLhalfNV* a1)const{return this->m_profile(507,m_next_glVertexAttrib1hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC m_next_glVertexAttribI4i = nullptr;
+void m_glVertexAttribI4i_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(508,m_next_glVertexAttribI4i,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC m_next_glRasterPos2iv = nullptr;
+void m_glRasterPos2iv_profile(const GLint* a0)const{return this->m_profile(509,m_next_glRasterPos2iv,a0);}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC m_next_glGetIntegerui64i_vNV = nullptr;
+void m_glGetIntegerui64i_vNV_profile(GLenum a0,GLuint a1,GLuint64EXT* a2)const{return this->m_profile(510,m_next_glGetIntegerui64i_vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC m_next_glUniformHandleui64NV = nullptr;
+void m_glUniformHandleui64NV_profile(GLint a0,GLuint64 a1)const{return this->m_profile(511,m_next_glUniformHandleui64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC m_next_glWindowPos3ivMESA = nullptr;
+void m_glWindowPos3ivMESA_profile(const GLint* a0)const{return this->m_profile(512,m_next_glWindowPos3ivMESA,a0);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC m_next_glBlendEquationSeparate = nullptr;
+void m_glBlendEquationSeparate_profile(GLenum a0,GLenum a1)const{return this->m_profile(513,m_next_glBlendEquationSeparate,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC m_next_glDrawElementsInstancedARB = nullptr;
+void m_glDrawElementsInstancedARB_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{return this->m_profile(514,m_next_glDrawElementsInstancedARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC m_next_glGetSubroutineIndex = nullptr;
+GLuint m_glGetSubroutineIndex_profile(GLuint a0,GLenum a1,const GLchar* a2)const{return this->m_profile(515,m_next_glGetSubroutineIndex,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC m_next_glVertexAttrib2sv = nullptr;
+void m_glVertexAttrib2sv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(516,m_next_glVertexAttrib2sv,a0,a1);}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC m_next_glSamplePatternSGIS = nullptr;
+void m_glSamplePatternSGIS_profile(GLenum a0)const{return this->m_profile(517,m_next_glSamplePatternSGIS,a0);}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC m_next_glEGLImageTargetRenderbufferStorageOES = nullptr;
+void m_glEGLImageTargetRenderbufferStorageOES_profile(GLenum a0,GLeglImageOES a1)const{return this->m_profile(518,m_next_glEGLImageTargetRenderbufferStorageOES,a0,a1);}
+FunctionTable::MEMBERPFNGLPUSHATTRIBPROC m_next_glPushAttrib = nullptr;
+void m_glPushAttrib_profile(GLbitfield a0)const{return this->m_profile(519,m_next_glPushAttrib,a0);}
+FunctionTable::MEMBERPFNGLVERTEX3HNVPROC m_next_glVertex3hNV = nullptr;
+void m_glVertex3hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(520,m_next_glVertex3hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC m_next_glRasterPos3xvOES = nullptr;
+void m_glRasterPos3xvOES_profile(const GLfixed* a0)const{return this->m_profile(521,m_next_glRasterPos3xvOES,a0);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC m_next_glPathParameterfNV = nullptr;
+void m_glPathParameterfNV_profile(GLuint a0,GLenum a1,GLfloat a2)const{return this->m_profile(522,m_next_glPathParameterfNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC m_next_glGetUniformi64vNV = nullptr;
+void m_glGetUniformi64vNV_profile(GLuint a0,GLint a1,GLint64EXT* a2)const{return this->m_profile(523,m_next_glGetUniformi64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLIGHTIVPROC m_next_glLightiv = nullptr;
+void m_glLightiv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(524,m_next_glLightiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATERIALXVOESPROC m_next_glMaterialxvOES = nullptr;
+void m_glMaterialxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(525,m_next_glMaterialxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC m_next_glNamedProgramLocalParameter4fEXT = nullptr;
+void m_glNamedProgramLocalParameter4fEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{return this->m_profile(526,m_next_glNamedProgramLocalParameter4fEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC m_next_glVertexAttribL1dEXT = nullptr;
+void m_glVertexAttribL1dEXT_profile(GLuint a0,GLdouble a1)const{return this->m_profile(527,m_next_glVertexAttribL1dEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC m_next_glGetnUniformdvARB = nullptr;
+void m_glGetnUniformdvARB_profile(GLuint a0,GLint a1,GLsizei a2,GLdouble* a3)const{return this->m_profile(528,m_next_glGetnUniformdvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC m_next_glSecondaryColor3bEXT = nullptr;
+void m_glSecondaryColor3bEXT_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(529,m_next_glSecondaryColor3bEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC m_next_glBeginPerfQueryINTEL = nullptr;
+void m_glBeginPerfQueryINTEL_profile(GLuint a0)const{return this->m_profile(530,m_next_glBeginPerfQueryINTEL,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC m_next_glProgramUniform1uivEXT = nullptr;
+void m_glProgramUniform1uivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(531,m_next_glProgramUniform1uivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC m_next_glImageTransformParameterivHP = nullptr;
+void m_glImageTransformParameterivHP_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(532,m_next_glImageTransformParameterivHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC m_next_glDeleteBuffers = nullptr;
+void m_glDeleteBuffers_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(533,m_next_glDeleteBuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC m_next_glBindProgramPipeline = nullptr;
+void m_glBindProgramPipeline_profile(GLuint a0)const{return this->m_profile(534,m_next_glBindProgramPipeline,a0);}
+FunctionTable::MEMBERPFNGLSCISSORPROC m_next_glScissor = nullptr;
+void m_glScissor_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(535,m_next_glScissor,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC m_next_glProgramUniform4fv = nullptr;
+void m_glProgramUniform4fv_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(536,m_next_glProgramUniform4fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETBOOLEANVPROC m_next_glGetBooleanv = nullptr;
+void m_glGetBooleanv_profile(GLenum a0,GLboolean* a1)const{return this->m_profile(537,m_next_glGetBooleanv,a0,a1);}
+FunctionTable::MEMBERPFNGLMATERIALFVPROC m_next_glMaterialfv = nullptr;
+void m_glMaterialfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(538,m_next_glMaterialfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC m_next_glWindowPos4fvMESA = nullptr;
+void m_glWindowPos4fvMESA_profile(const GLfloat* a0)const{return this->m_profile(539,m_next_glWindowPos4fvMESA,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC m_next_glVertexAttribIPointerEXT = nullptr;
+void m_glVertexAttribIPointerEXT_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(540,m_next_glVertexAttribIPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC m_next_glProgramBufferParametersfvNV = nullptr;
+void m_glProgramBufferParametersfvNV_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{return this->m_profile(541,m_next_glProgramBufferParametersfvNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC m_next_glAlphaFuncxOES = nullptr;
+void m_glAlphaFuncxOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(542,m_next_glAlphaFuncxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC m_next_glMultiDrawArraysIndirectAMD = nullptr;
+void m_glMultiDrawArraysIndirectAMD_profile(GLenum a0,const void* a1,GLsizei a2,GLsizei a3)const{return this->m_profile(543,m_next_glMultiDrawArraysIndirectAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC m_next_glNormalStream3ivATI = nullptr;
+void m_glNormalStream3ivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(544,m_next_glNormalStream3ivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC m_next_glTextureImage3DMultisampleNV = nullptr;
+void m_glTextureImage3DMultisampleNV_profile(GLuint a0,GLenum a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{return this->m_profile(545,m_next_glTextureImage3DMultisampleNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC m_next_glProgramUniform4uivEXT = nullptr;
+void m_glProgramUniform4uivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(546,m_next_glProgramUniform4uivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC m_next_glReplacementCodeusvSUN = nullptr;
+void m_glReplacementCodeusvSUN_profile(const GLushort* a0)const{return this->m_profile(547,m_next_glReplacementCodeusvSUN,a0);}
+FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC m_next_glPollInstrumentsSGIX = nullptr;
+GLint m_glPollInstrumentsSGIX_profile(GLint* a0)const{return this->m_profile(548,m_next_glPollInstrumentsSGIX,a0);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC m_next_glGetTextureLevelParameteriv = nullptr;
+void m_glGetTextureLevelParameteriv_profile(GLuint a0,GLint a1,GLenum a2,GLint* a3)const{return this->m_profile(549,m_next_glGetTextureLevelParameteriv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC m_next_glVertexAttribI2uiv = nullptr;
+void m_glVertexAttribI2uiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(550,m_next_glVertexAttribI2uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC m_next_glMapControlPointsNV = nullptr;
+void m_glMapControlPointsNV_profile(GLenum a0,GLuint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLint a6,GLboolean a7,const void* a8)const{return this->m_profile(551,m_next_glMapControlPointsNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLCOLOR4DVPROC m_next_glColor4dv = nullptr;
+void m_glColor4dv_profile(const GLdouble* a0)const{return this->m_profile(552,m_next_glColor4dv,a0);}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC m_next_glInvalidateBufferSubData = nullptr;
+void m_glInvalidateBufferSubData_profile(GLuint a0,GLintptr a1,GLsizeiptr a2)const{return this->m_profile(553,m_next_glInvalidateBufferSubData,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC m_next_glMultiTexCoord1hNV = nullptr;
+void m_glMultiTexCoord1hNV_profile(GLenum a0,GLhalfNV a1)const{return this->m_profile(554,m_next_glMultiTexCoord1hNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC m_next_glPointParameterfv = nullptr;
+void m_glPointParameterfv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(555,m_next_glPointParameterfv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC m_next_glUniformMatrix2fvARB = nullptr;
+void m_glUniformMatrix2fvARB_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(556,m_next_glUniformMatrix2fvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM2FVPROC m_next_glUniform2fv = nullptr;
+void m_glUniform2fv_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(557,m_next_glUniform2fv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC m_next_glVertexPointerListIBM = nullptr;
+void m_glVertexPointerListIBM_profile(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{return this->m_profile(558,m_next_glVertexPointerListIBM,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC m_next_glGetMultiTexGenfvEXT = nullptr;
+void m_glGetMultiTexGenfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat* a3)const{return this->m_profile(559,m_next_glGetMultiTexGenfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC m_next_glGetMinmaxEXT = nullptr;
+void m_glGetMinmaxEXT_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,void* a4)const{return this->m_profile(560,m_next_glGetMinmaxEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLISFENCENVPROC m_next_glIsFenceNV = nullptr;
+GLboolean m_glIsFenceNV_profile(GLuint a0)const{return this->m_profile(561,m_next_glIsFenceNV,a0);}
+FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC m_next_glMatrixFrustumEXT = nullptr;
+void m_glMatrixFrustumEXT_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{return this->m_profile(562,m_next_glMatrixFrustumEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC m_next_glDispatchComputeIndirect = nullptr;
+void m_glDispatchComputeIndirect_profile(GLintptr a0)const{return this->m_profile(563,m_next_glDispatchComputeIndirect,a0);}
+FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC m_next_glQueryResourceNV = nullptr;
+GLint m_glQueryResourceNV_profile(GLenum a0,GLint a1,GLuint a2,GLint* a3)const{return this->m_profile(564,m_next_glQueryResourceNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC m_next_glMultiTexCoord4bOES = nullptr;
+void m_glMultiTexCoord4bOES_profile(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3,GLbyte a4)const{return this->m_profile(565,m_next_glMultiTexCoord4bOES,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC m_next_glProgramEnvParameter4dARB = nullptr;
+void m_glProgramEnvParameter4dARB_profile(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(566,m_next_glProgramEnvParameter4dARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC m_next_glProgramUniform1uiEXT = nullptr;
+void m_glProgramUniform1uiEXT_profile(GLuint a0,GLint a1,GLuint a2)const{return this->m_profile(567,m_next_glProgramUniform1uiEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC m_next_glBindBufferRange = nullptr;
+void m_glBindBufferRange_profile(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(568,m_next_glBindBufferRange,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNORMAL3IVPROC m_next_glNormal3iv = nullptr;
+void m_glNormal3iv_profile(const GLint* a0)const{return this->m_profile(569,m_next_glNormal3iv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC m_next_glVertexAttribL3dv = nullptr;
+void m_glVertexAttribL3dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(570,m_next_glVertexAttribL3dv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC m_next_glGetUniformdv = nullptr;
+void m_glGetUniformdv_profile(GLuint a0,GLint a1,GLdouble* a2)const{return this->m_profile(571,m_next_glGetUniformdv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC m_next_glGetMultiTexLevelParameterfvEXT = nullptr;
+void m_glGetMultiTexLevelParameterfvEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLfloat* a4)const{return this->m_profile(572,m_next_glGetMultiTexLevelParameterfvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC m_next_glFinalCombinerInputNV = nullptr;
+void m_glFinalCombinerInputNV_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(573,m_next_glFinalCombinerInputNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC m_next_glCullParameterdvEXT = nullptr;
+void m_glCullParameterdvEXT_profile(GLenum a0,GLdouble* a1)const{return this->m_profile(574,m_next_glCullParameterdvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC m_next_glMultiTexCoord4s = nullptr;
+void m_glMultiTexCoord4s_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(575,m_next_glMultiTexCoord4s,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC m_next_glMapVertexAttrib1fAPPLE = nullptr;
+void m_glMapVertexAttrib1fAPPLE_profile(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLint a4,GLint a5,const GLfloat* a6)const{return this->m_profile(576,m_next_glMapVertexAttrib1fAPPLE,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC m_next_glConvolutionParameterfEXT = nullptr;
+void m_glConvolutionParameterfEXT_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(577,m_next_glConvolutionParameterfEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC m_next_glTexCoord1iv = nullptr;
+void m_glTexCoord1iv_profile(const GLint* a0)const{return this->m_profile(578,m_next_glTexCoord1iv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC m_next_glProgramUniform3fvEXT = nullptr;
+void m_glProgramUniform3fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(579,m_next_glProgramUniform3fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR3UIVPROC m_next_glColor3uiv = nullptr;
+void m_glColor3uiv_profile(const GLuint* a0)const{return this->m_profile(580,m_next_glColor3uiv,a0);}
+FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC m_next_glRenderGpuMaskNV = nullptr;
+void m_glRenderGpuMaskNV_profile(GLbitfield a0)const{return this->m_profile(581,m_next_glRenderGpuMaskNV,a0);}
+FunctionTable::MEMBERPFNGLLISTBASEPROC m_next_glListBase = nullptr;
+void m_glListBase_profile(GLuint a0)const{return this->m_profile(582,m_next_glListBase,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC m_next_glTexCoord2bOES = nullptr;
+void m_glTexCoord2bOES_profile(GLbyte a0,GLbyte a1)const{return this->m_profile(583,m_next_glTexCoord2bOES,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC m_next_glBindMaterialParameterEXT = nullptr;
+GLuint m_glBindMaterialParameterEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(584,m_next_glBindMaterialParameterEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC m_next_glGlobalAlphaFactorubSUN = nullptr;
+void m_glGlobalAlphaFactorubSUN_profile(GLubyte a0)const{return this->m_profile(585,m_next_glGlobalAlphaFactorubSUN,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC m_next_glVertexAttribL1ui64NV = nullptr;
+void m_glVertexAttribL1ui64NV_profile(GLuint a0,GLuint64EXT a1)const{return this->m_profile(586,m_next_glVertexAttribL1ui64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC m_next_glPointParameterfSGIS = nullptr;
+void m_glPointParameterfSGIS_profile(GLenum a0,GLfloat a1)const{return this->m_profile(587,m_next_glPointParameterfSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC m_next_glGetImageTransformParameterivHP = nullptr;
+void m_glGetImageTransformParameterivHP_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(588,m_next_glGetImageTransformParameterivHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC m_next_glColorSubTableEXT = nullptr;
+void m_glColorSubTableEXT_profile(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{return this->m_profile(589,m_next_glColorSubTableEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC m_next_glPixelTexGenParameterfvSGIS = nullptr;
+void m_glPixelTexGenParameterfvSGIS_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(590,m_next_glPixelTexGenParameterfvSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC m_next_glClientWaitSync = nullptr;
+GLenum m_glClientWaitSync_profile(GLsync a0,GLbitfield a1,GLuint64 a2)const{return this->m_profile(591,m_next_glClientWaitSync,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC m_next_glQueryObjectParameteruiAMD = nullptr;
+void m_glQueryObjectParameteruiAMD_profile(GLenum a0,GLuint a1,GLenum a2,GLuint a3)const{return this->m_profile(592,m_next_glQueryObjectParameteruiAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC m_next_glVertexAttribs1fvNV = nullptr;
+void m_glVertexAttribs1fvNV_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(593,m_next_glVertexAttribs1fvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC m_next_glVertexAttrib4NusvARB = nullptr;
+void m_glVertexAttrib4NusvARB_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(594,m_next_glVertexAttrib4NusvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC m_next_glVariantPointerEXT = nullptr;
+void m_glVariantPointerEXT_profile(GLuint a0,GLenum a1,GLuint a2,const void* a3)const{return this->m_profile(595,m_next_glVariantPointerEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC m_next_glTextureBuffer = nullptr;
+void m_glTextureBuffer_profile(GLuint a0,GLenum a1,GLuint a2)const{return this->m_profile(596,m_next_glTextureBuffer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC m_next_glVertexAttribI1uiEXT = nullptr;
+void m_glVertexAttribI1uiEXT_profile(GLuint a0,GLuint a1)const{return this->m_profile(597,m_next_glVertexAttribI1uiEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC m_next_glInvalidateTexImage = nullptr;
+void m_glInvalidateTexImage_profile(GLuint a0,GLint a1)const{return this->m_profile(598,m_next_glInvalidateTexImage,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC m_next_glProgramEnvParametersI4ivNV = nullptr;
+void m_glProgramEnvParametersI4ivNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(599,m_next_glProgramEnvParametersI4ivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC m_next_glPathGlyphIndexArrayNV = nullptr;
+GLenum m_glPathGlyphIndexArrayNV_profile(GLuint a0,GLenum a1,const void* a2,GLbitfield a3,GLuint a4,GLsizei a5,GLuint a6,GLfloat a7)const{return this->m_profile(600,m_next_glPathGlyphIndexArrayNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC m_next_glCopyImageSubData = nullptr;
+void m_glCopyImageSubData_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLuint a6,GLenum a7,GLint a8,GLint a9,GLint a10,GLint a11,GLsizei a12,GLsizei a13,GLsizei a14)const{return this->m_profile(601,m_next_glCopyImageSubData,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC m_next_glGetUniformSubroutineuiv = nullptr;
+void m_glGetUniformSubroutineuiv_profile(GLenum a0,GLint a1,GLuint* a2)const{return this->m_profile(602,m_next_glGetUniformSubroutineuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC m_next_glBindVertexBuffer = nullptr;
+void m_glBindVertexBuffer_profile(GLuint a0,GLuint a1,GLintptr a2,GLsizei a3)const{return this->m_profile(603,m_next_glBindVertexBuffer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC m_next_glMultiTexCoord1iARB = nullptr;
+void m_glMultiTexCoord1iARB_profile(GLenum a0,GLint a1)const{return this->m_profile(604,m_next_glMultiTexCoord1iARB,a0,a1);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC m_next_glDebugMessageInsert = nullptr;
+void m_glDebugMessageInsert_profile(GLenum a0,GLenum a1,GLuint a2,GLenum a3,GLsizei a4,const GLchar* a5)const{return this->m_profile(605,m_next_glDebugMessageInsert,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC m_next_glBeginVertexShaderEXT = nullptr;
+void m_glBeginVertexShaderEXT_profile()const{return this->m_profile(606,m_next_glBeginVertexShaderEXT);}
+FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC m_next_glIsVariantEnabledEXT = nullptr;
+GLboolean m_glIsVariantEnabledEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(607,m_next_glIsVariantEnabledEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC m_next_glPassThroughxOES = nullptr;
+void m_glPassThroughxOES_profile(GLfixed a0)const{return this->m_profile(608,m_next_glPassThroughxOES,a0);}
+FunctionTable::MEMBERPFNGLISSAMPLERPROC m_next_glIsSampler = nullptr;
+GLboolean m_glIsSampler_profile(GLuint a0)const{return this->m_profile(609,m_next_glIsSampler,a0);}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC m_next_glConservativeRasterParameterfNV = nullptr;
+void m_glConservativeRasterParameterfNV_profile(GLenum a0,GLfloat a1)const{return this->m_profile(610,m_next_glConservativeRasterParameterfNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC m_next_glMultiTexGenivEXT = nullptr;
+void m_glMultiTexGenivEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(611,m_next_glMultiTexGenivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC m_next_glNamedFramebufferTexture2DEXT = nullptr;
+void m_glNamedFramebufferTexture2DEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(612,m_next_glNamedFramebufferTexture2DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC m_next_glCopyTexSubImage1D = nullptr;
+void m_glCopyTexSubImage1D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{return this->m_profile(613,m_next_glCopyTexSubImage1D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXCOORD1IPROC m_next_glTexCoord1i = nullptr;
+void m_glTexCoord1i_profile(GLint a0)const{return this->m_profile(614,m_next_glTexCoord1i,a0);}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC m_next_glCheckFramebufferStatus = nullptr;
+GLenum m_glCheckFramebufferStatus_profile(GLenum a0)const{return this->m_profile(615,m_next_glCheckFramebufferStatus,a0);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC m_next_glDrawElementArrayAPPLE = nullptr;
+void m_glDrawElementArrayAPPLE_profile(GLenum a0,GLint a1,GLsizei a2)const{return this->m_profile(616,m_next_glDrawElementArrayAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD1DPROC m_next_glTexCoord1d = nullptr;
+void m_glTexCoord1d_profile(GLdouble a0)const{return this->m_profile(617,m_next_glTexCoord1d,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD1FPROC m_next_glTexCoord1f = nullptr;
+void m_glTexCoord1f_profile(GLfloat a0)const{return this->m_profile(618,m_next_glTexCoord1f,a0);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC m_next_glFragmentLightivSGIX = nullptr;
+void m_glFragmentLightivSGIX_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(619,m_next_glFragmentLightivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC m_next_glBindImageTexture = nullptr;
+void m_glBindImageTexture_profile(GLuint a0,GLuint a1,GLint a2,GLboolean a3,GLint a4,GLenum a5,GLenum a6)const{return this->m_profile(620,m_next_glBindImageTexture,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC m_next_glTransformFeedbackVaryings = nullptr;
+void m_glTransformFeedbackVaryings_profile(GLuint a0,GLsizei a1,const GLchar*const* a2,GLenum a3)const{return this->m_profile(621,m_next_glTransformFeedbackVaryings,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC m_next_glMulticastBufferSubDataNV = nullptr;
+void m_glMulticastBufferSubDataNV_profile(GLbitfield a0,GLuint a1,GLintptr a2,GLsizeiptr a3,const void* a4)const{return this->m_profile(622,m_next_glMulticastBufferSubDataNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC m_next_glDrawRangeElements = nullptr;
+void m_glDrawRangeElements_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const GLvoid* a5)const{return this->m_profile(623,m_next_glDrawRangeElements,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXCOORD1SPROC m_next_glTexCoord1s = nullptr;
+void m_glTexCoord1s_profile(GLshort a0)const{return this->m_profile(624,m_next_glTexCoord1s,a0);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC m_next_glBindBufferBase = nullptr;
+void m_glBindBufferBase_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(625,m_next_glBindBufferBase,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR3BVPROC m_next_glColor3bv = nullptr;
+void m_glColor3bv_profile(const GLbyte* a0)const{return this->m_profile(626,m_next_glColor3bv,a0);}
+FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC m_next_glSyncTextureINTEL = nullptr;
+void m_glSyncTextureINTEL_profile(GLuint a0)const{return this->m_profile(627,m_next_glSyncTextureINTEL,a0);}
+FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC m_next_glCreateSamplers = nullptr;
+void m_glCreateSamplers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(628,m_next_glCreateSamplers,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC m_next_glCombinerParameterfNV = nullptr;
+void m_glCombinerParameterfNV_profile(GLenum a0,GLfloat a1)const{return this->m_profile(629,m_next_glCombinerParameterfNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC m_next_glGetArrayObjectivATI = nullptr;
+void m_glGetArrayObjectivATI_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(630,m_next_glGetArrayObjectivATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC m_next_glMultiDrawArrays = nullptr;
+void m_glMultiDrawArrays_profile(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{return this->m_profile(631,m_next_glMultiDrawArrays,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC m_next_glSampleMapATI = nullptr;
+void m_glSampleMapATI_profile(GLuint a0,GLuint a1,GLenum a2)const{return this->m_profile(632,m_next_glSampleMapATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC m_next_glProgramUniform2i64ARB = nullptr;
+void m_glProgramUniform2i64ARB_profile(GLuint a0,GLint a1,GLint64 a2,GLint64 a3)const{return this->m_profile(633,m_next_glProgramUniform2i64ARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC m_next_glBinormal3ivEXT = nullptr;
+void m_glBinormal3ivEXT_profile(const GLint* a0)const{return this->m_profile(634,m_next_glBinormal3ivEXT,a0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC m_next_glMultiDrawArraysIndirectCountARB = nullptr;
+void m_glMultiDrawArraysIndirectCountARB_profile(GLenum a0,const void* a1,GLintptr a2,GLsizei a3,GLsizei a4)const{return this->m_profile(635,m_next_glMultiDrawArraysIndirectCountARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC m_next_glTextureStorageMem1DEXT = nullptr;
+void m_glTextureStorageMem1DEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLuint a4,GLuint64 a5)const{return this->m_profile(636,m_next_glTextureStorageMem1DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC m_next_glWindowPos2ivMESA = nullptr;
+void m_glWindowPos2ivMESA_profile(const GLint* a0)const{return this->m_profile(637,m_next_glWindowPos2ivMESA,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC m_next_glTexCoordP4ui = nullptr;
+void m_glTexCoordP4ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(638,m_next_glTexCoordP4ui,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC m_next_glMultiTexSubImage1DEXT = nullptr;
+void m_glMultiTexSubImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLenum a6,const void* a7)const{return this->m_profile(639,m_next_glMultiTexSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC m_next_glProgramUniformMatrix2x3fvEXT = nullptr;
+void m_glProgramUniformMatrix2x3fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(640,m_next_glProgramUniformMatrix2x3fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC m_next_glBufferDataARB = nullptr;
+void m_glBufferDataARB_profile(GLenum a0,GLsizeiptrARB a1,const void* a2,GLenum a3)const{return this->m_profile(641,m_next_glBufferDataARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC m_next_glVertexAttribIFormat = nullptr;
+void m_glVertexAttribIFormat_profile(GLuint a0,GLint a1,GLenum a2,GLuint a3)const{return this->m_profile(642,m_next_glVertexAttribIFormat,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC m_next_glCreateFramebuffers = nullptr;
+void m_glCreateFramebuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(643,m_next_glCreateFramebuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC m_next_glNormalStream3dvATI = nullptr;
+void m_glNormalStream3dvATI_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(644,m_next_glNormalStream3dvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARACCUMPROC m_next_glClearAccum = nullptr;
+void m_glClearAccum_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(645,m_next_glClearAccum,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC m_next_glUniform3i64vNV = nullptr;
+void m_glUniform3i64vNV_profile(GLint a0,GLsizei a1,const GLint64EXT* a2)const{return this->m_profile(646,m_next_glUniform3i64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC m_next_glNormal3fVertex3fSUN = nullptr;
+void m_glNormal3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(647,m_next_glNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC m_next_glUniform2uivEXT = nullptr;
+void m_glUniform2uivEXT_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(648,m_next_glUniform2uivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINQUERYPROC m_next_glBeginQuery = nullptr;
+void m_glBeginQuery_profile(GLenum a0,GLuint a1)const{return this->m_profile(649,m_next_glBeginQuery,a0,a1);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC m_next_glStencilThenCoverStrokePathInstancedNV = nullptr;
+void m_glStencilThenCoverStrokePathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLint a4,GLuint a5,GLenum a6,GLenum a7,const GLfloat* a8)const{return this->m_profile(650,m_next_glStencilThenCoverStrokePathInstancedNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLBINDBUFFERPROC m_next_glBindBuffer = nullptr;
+void m_glBindBuffer_profile(GLenum a0,GLuint a1)const{return this->m_profile(651,m_next_glBindBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLMAP2DPROC m_next_glMap2d = nullptr;
+void m_glMap2d_profile(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,GLdouble a5,GLdouble a6,GLint a7,GLint a8,const GLdouble* a9)const{return this->m_profile(652,m_next_glMap2d,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLMAP2FPROC m_next_glMap2f = nullptr;
+void m_glMap2f_profile(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,GLfloat a5,GLfloat a6,GLint a7,GLint a8,const GLfloat* a9)const{return this->m_profile(653,m_next_glMap2f,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC m_next_glMakeImageHandleResidentNV = nullptr;
+void m_glMakeImageHandleResidentNV_profile(GLuint64 a0,GLenum a1)const{return this->m_profile(654,m_next_glMakeImageHandleResidentNV,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC m_next_glUniformMatrix2x4fv = nullptr;
+void m_glUniformMatrix2x4fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(655,m_next_glUniformMatrix2x4fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC m_next_glGetMultiTexParameterfvEXT = nullptr;
+void m_glGetMultiTexParameterfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat* a3)const{return this->m_profile(656,m_next_glGetMultiTexParameterfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC m_next_glDepthRangeIndexed = nullptr;
+void m_glDepthRangeIndexed_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(657,m_next_glDepthRangeIndexed,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISENABLEDPROC m_next_glIsEnabled = nullptr;
+GLboolean m_glIsEnabled_profile(GLenum a0)const{return this->m_profile(658,m_next_glIsEnabled,a0);}
+FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC m_next_glMatrixScalefEXT = nullptr;
+void m_glMatrixScalefEXT_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(659,m_next_glMatrixScalefEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETERRORPROC m_next_glGetError = nullptr;
+GLenum m_glGetError_profile()const{return this->m_profile(660,m_next_glGetError);}
+FunctionTable::MEMBERPFNGLGETTEXENVIVPROC m_next_glGetTexEnviv = nullptr;
+void m_glGetTexEnviv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(661,m_next_glGetTexEnviv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC m_next_glBindTextureUnitParameterEXT = nullptr;
+GLuint m_glBindTextureUnitParameterEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(662,m_next_glBindTextureUnitParameterEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC m_next_glGetnUniformfvARB = nullptr;
+void m_glGetnUniformfvARB_profile(GLuint a0,GLint a1,GLsizei a2,GLfloat* a3)const{return this->m_profile(663,m_next_glGetnUniformfvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC m_next_glReplacementCodeuiNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(664,m_next_glReplacementCodeuiNormal3fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC m_next_glDeletePerfQueryINTEL = nullptr;
+void m_glDeletePerfQueryINTEL_profile(GLuint a0)const{return this->m_profile(665,m_next_glDeletePerfQueryINTEL,a0);}
+FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC m_next_glActiveVaryingNV = nullptr;
+void m_glActiveVaryingNV_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(666,m_next_glActiveVaryingNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC m_next_glGetActiveUniformARB = nullptr;
+void m_glGetActiveUniformARB_profile(GLhandleARB a0,GLuint a1,GLsizei a2,GLsizei* a3,GLint* a4,GLenum* a5,GLcharARB* a6)const{return this->m_profile(667,m_next_glGetActiveUniformARB,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC m_next_glVertexAttribI3ivEXT = nullptr;
+void m_glVertexAttribI3ivEXT_profile(GLuint a0,const GLint* a1)const{return this->m_profile(668,m_next_glVertexAttribI3ivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLEVALCOORD1DPROC m_next_glEvalCoord1d = nullptr;
+void m_glEvalCoord1d_profile(GLdouble a0)const{return this->m_profile(669,m_next_glEvalCoord1d,a0);}
+FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC m_next_glNamedCopyBufferSubDataEXT = nullptr;
+void m_glNamedCopyBufferSubDataEXT_profile(GLuint a0,GLuint a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(670,m_next_glNamedCopyBufferSubDataEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLEVALCOORD1FPROC m_next_glEvalCoord1f = nullptr;
+void m_glEvalCoord1f_profile(GLfloat a0)const{return this->m_profile(671,m_next_glEvalCoord1f,a0);}
+FunctionTable::MEMBERPFNGLPIXELMAPFVPROC m_next_glPixelMapfv = nullptr;
+void m_glPixelMapfv_profile(GLenum a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(672,m_next_glPixelMapfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC m_next_glVertexAttribI1ivEXT = nullptr;
+void m_glVertexAttribI1ivEXT_profile(GLuint a0,const GLint* a1)const{return this->m_profile(673,m_next_glVertexAttribI1ivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC m_next_glCreateSyncFromCLeventARB = nullptr;
+GLsync m_glCreateSyncFromCLeventARB_profile(struct _cl_context* a0,struct _cl_event* a1,GLbitfield a2)const{return this->m_profile(674,m_next_glCreateSyncFromCLeventARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC m_next_glGetPixelMapusv = nullptr;
+void m_glGetPixelMapusv_profile(GLenum a0,GLushort* a1)const{return this->m_profile(675,m_next_glGetPixelMapusv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC m_next_glGetnColorTableARB = nullptr;
+void m_glGetnColorTableARB_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4)const{return this->m_profile(676,m_next_glGetnColorTableARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLACCUMPROC m_next_glAccum = nullptr;
+void m_glAccum_profile(GLenum a0,GLfloat a1)const{return this->m_profile(677,m_next_glAccum,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC m_next_glRasterPos3sv = nullptr;
+void m_glRasterPos3sv_profile(const GLshort* a0)const{return this->m_profile(678,m_next_glRasterPos3sv,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC m_next_glTexCoord2iv = nullptr;
+void m_glTexCoord2iv_profile(const GLint* a0)const{return this->m_profile(679,m_next_glTexCoord2iv,a0);}
+FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC m_next_glBlendFunciARB = nullptr;
+void m_glBlendFunciARB_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(680,m_next_glBlendFunciARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC m_next_glProgramUniform3i64vARB = nullptr;
+void m_glProgramUniform3i64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{return this->m_profile(681,m_next_glProgramUniform3i64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_next_glGetFramebufferAttachmentParameteriv = nullptr;
+void m_glGetFramebufferAttachmentParameteriv_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(682,m_next_glGetFramebufferAttachmentParameteriv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC m_next_glProgramUniform4ui = nullptr;
+void m_glProgramUniform4ui_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(683,m_next_glProgramUniform4ui,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLSTENCILMASKPROC m_next_glStencilMask = nullptr;
+void m_glStencilMask_profile(GLuint a0)const{return this->m_profile(684,m_next_glStencilMask,a0);}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC m_next_glResetHistogramEXT = nullptr;
+void m_glResetHistogramEXT_profile(GLenum a0)const{return this->m_profile(685,m_next_glResetHistogramEXT,a0);}
+FunctionTable::MEMBERPFNGLLIGHTXOESPROC m_next_glLightxOES = nullptr;
+void m_glLightxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(686,m_next_glLightxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC m_next_glNamedBufferData = nullptr;
+void m_glNamedBufferData_profile(GLuint a0,GLsizeiptr a1,const void* a2,GLenum a3)const{return this->m_profile(687,m_next_glNamedBufferData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC m_next_glVertexStream3sATI = nullptr;
+void m_glVertexStream3sATI_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(688,m_next_glVertexStream3sATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC m_next_glVertexAttrib3fvARB = nullptr;
+void m_glVertexAttrib3fvARB_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(689,m_next_glVertexAttrib3fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC m_next_glClearNamedBufferSubData = nullptr;
+void m_glClearNamedBufferSubData_profile(GLuint a0,GLenum a1,GLintptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(690,m_next_glClearNamedBufferSubData,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC m_next_glProgramUniformHandleui64ARB = nullptr;
+void m_glProgramUniformHandleui64ARB_profile(GLuint a0,GLint a1,GLuint64 a2)const{return this->m_profile(691,m_next_glProgramUniformHandleui64ARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC m_next_glUniform3iARB = nullptr;
+void m_glUniform3iARB_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(692,m_next_glUniform3iARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC m_next_glCreateProgramObjectARB = nullptr;
+GLhandleARB m_glCreateProgramObjectARB_profile()const{return this->m_profile(693,m_next_glCreateProgramObjectARB);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC m_next_glMultiTexCoord1dvARB = nullptr;
+void m_glMultiTexCoord1dvARB_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(694,m_next_glMultiTexCoord1dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC m_next_glGetObjectParameterfvARB = nullptr;
+void m_glGetObjectParameterfvARB_profile(GLhandleARB a0,GLenum a1,GLfloat* a2)const{return this->m_profile(695,m_next_glGetObjectParameterfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRECTSVPROC m_next_glRectsv = nullptr;
+void m_glRectsv_profile(const GLshort* a0,const GLshort* a1)const{return this->m_profile(696,m_next_glRectsv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC m_next_glMultiTexImage2DEXT = nullptr;
+void m_glMultiTexImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{return this->m_profile(697,m_next_glMultiTexImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC m_next_glProgramUniform1i64NV = nullptr;
+void m_glProgramUniform1i64NV_profile(GLuint a0,GLint a1,GLint64EXT a2)const{return this->m_profile(698,m_next_glProgramUniform1i64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC m_next_glGetObjectBufferivATI = nullptr;
+void m_glGetObjectBufferivATI_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(699,m_next_glGetObjectBufferivATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC m_next_glUniform4i64ARB = nullptr;
+void m_glUniform4i64ARB_profile(GLint a0,GLint64 a1,GLint64 a2,GLint64 a3,GLint64 a4)const{return this->m_profile(700,m_next_glUniform4i64ARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC m_next_glReplacementCodeuiColor4ubVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_profile(const GLuint* a0,const GLubyte* a1,const GLfloat* a2)const{return this->m_profile(701,m_next_glReplacementCodeuiColor4ubVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC m_next_glBlendFuncSeparateINGR = nullptr;
+void m_glBlendFuncSeparateINGR_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(702,m_next_glBlendFuncSeparateINGR,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC m_next_glGetVideoCaptureStreamfvNV = nullptr;
+void m_glGetVideoCaptureStreamfvNV_profile(GLuint a0,GLuint a1,GLenum a2,GLfloat* a3)const{return this->m_profile(703,m_next_glGetVideoCaptureStreamfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC m_next_glVertexAttrib2fARB = nullptr;
+void m_glVertexAttrib2fARB_profile(GLuint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(704,m_next_glVertexAttrib2fARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXGENIVPROC m_next_glGetTexGeniv = nullptr;
+void m_glGetTexGeniv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(705,m_next_glGetTexGeniv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELSTOREIPROC m_next_glPixelStorei = nullptr;
+void m_glPixelStorei_profile(GLenum a0,GLint a1)const{return this->m_profile(706,m_next_glPixelStorei,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC m_next_glGetCompressedTextureSubImage = nullptr;
+void m_glGetCompressedTextureSubImage_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLsizei a8,void* a9)const{return this->m_profile(707,m_next_glGetCompressedTextureSubImage,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC m_next_glCopyImageSubDataNV = nullptr;
+void m_glCopyImageSubDataNV_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLuint a6,GLenum a7,GLint a8,GLint a9,GLint a10,GLint a11,GLsizei a12,GLsizei a13,GLsizei a14)const{return this->m_profile(708,m_next_glCopyImageSubDataNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC m_next_glActiveShaderProgram = nullptr;
+void m_glActiveShaderProgram_profile(GLuint a0,GLuint a1)const{return this->m_profile(709,m_next_glActiveShaderProgram,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC m_next_glVertexStream1iATI = nullptr;
+void m_glVertexStream1iATI_profile(GLenum a0,GLint a1)const{return this->m_profile(710,m_next_glVertexStream1iATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC m_next_glPatchParameterfv = nullptr;
+void m_glPatchParameterfv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(711,m_next_glPatchParameterfv,a0,a1);}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC m_next_glIsFramebufferEXT = nullptr;
+GLboolean m_glIsFramebufferEXT_profile(GLuint a0)const{return this->m_profile(712,m_next_glIsFramebufferEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC m_next_glTextureStorage2D = nullptr;
+void m_glTextureStorage2D_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(713,m_next_glTextureStorage2D,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC m_next_glProgramUniform1ui64ARB = nullptr;
+void m_glProgramUniform1ui64ARB_profile(GLuint a0,GLint a1,GLuint64 a2)const{return this->m_profile(714,m_next_glProgramUniform1ui64ARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC m_next_glTexBufferRange = nullptr;
+void m_glTexBufferRange_profile(GLenum a0,GLenum a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(715,m_next_glTexBufferRange,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC m_next_glGetPixelTexGenParameterivSGIS = nullptr;
+void m_glGetPixelTexGenParameterivSGIS_profile(GLenum a0,GLint* a1)const{return this->m_profile(716,m_next_glGetPixelTexGenParameterivSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC m_next_glTextureSubImage3DEXT = nullptr;
+void m_glTextureSubImage3DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLenum a10,const void* a11)const{return this->m_profile(717,m_next_glTextureSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLCLIPCONTROLPROC m_next_glClipControl = nullptr;
+void m_glClipControl_profile(GLenum a0,GLenum a1)const{return this->m_profile(718,m_next_glClipControl,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC m_next_glGetProgramResourceiv = nullptr;
+void m_glGetProgramResourceiv_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLenum* a4,GLsizei a5,GLsizei* a6,GLint* a7)const{return this->m_profile(719,m_next_glGetProgramResourceiv,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC m_next_glMultiTexCoordP2uiv = nullptr;
+void m_glMultiTexCoordP2uiv_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(720,m_next_glMultiTexCoordP2uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC m_next_glVertexAttribI3ui = nullptr;
+void m_glVertexAttribI3ui_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(721,m_next_glVertexAttribI3ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC m_next_glSampleMaskSGIS = nullptr;
+void m_glSampleMaskSGIS_profile(GLclampf a0,GLboolean a1)const{return this->m_profile(722,m_next_glSampleMaskSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC m_next_glVertexAttrib4NivARB = nullptr;
+void m_glVertexAttrib4NivARB_profile(GLuint a0,const GLint* a1)const{return this->m_profile(723,m_next_glVertexAttrib4NivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC m_next_glGlobalAlphaFactorfSUN = nullptr;
+void m_glGlobalAlphaFactorfSUN_profile(GLfloat a0)const{return this->m_profile(724,m_next_glGlobalAlphaFactorfSUN,a0);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC m_next_glBlendEquationSeparateIndexedAMD = nullptr;
+void m_glBlendEquationSeparateIndexedAMD_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(725,m_next_glBlendEquationSeparateIndexedAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC m_next_glGetPerfCounterInfoINTEL = nullptr;
+void m_glGetPerfCounterInfoINTEL_profile(GLuint a0,GLuint a1,GLuint a2,GLchar* a3,GLuint a4,GLchar* a5,GLuint* a6,GLuint* a7,GLuint* a8,GLuint* a9,GLuint64* a10)const{return this->m_profile(726,m_next_glGetPerfCounterInfoINTEL,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC m_next_glDeleteProgramsNV = nullptr;
+void m_glDeleteProgramsNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(727,m_next_glDeleteProgramsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC m_next_glPixelZoomxOES = nullptr;
+void m_glPixelZoomxOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(728,m_next_glPixelZoomxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC m_next_glGetCombinerOutputParameterivNV = nullptr;
+void m_glGetCombinerOutputParameterivNV_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(729,m_next_glGetCombinerOutputParameterivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC m_next_glRasterPos2xvOES = nullptr;
+void m_glRasterPos2xvOES_profile(const GLfixed* a0)const{return this->m_profile(730,m_next_glRasterPos2xvOES,a0);}
+FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC m_next_glGetTexImage = nullptr;
+void m_glGetTexImage_profile(GLenum a0,GLint a1,GLenum a2,GLenum a3,GLvoid* a4)const{return this->m_profile(731,m_next_glGetTexImage,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC m_next_glVertexArrayVertexBuffers = nullptr;
+void m_glVertexArrayVertexBuffers_profile(GLuint a0,GLuint a1,GLsizei a2,const GLuint* a3,const GLintptr* a4,const GLsizei* a5)const{return this->m_profile(732,m_next_glVertexArrayVertexBuffers,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC m_next_glUniform1ui64NV = nullptr;
+void m_glUniform1ui64NV_profile(GLint a0,GLuint64EXT a1)const{return this->m_profile(733,m_next_glUniform1ui64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC m_next_glProgramParameteri = nullptr;
+void m_glProgramParameteri_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(734,m_next_glProgramParameteri,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMAL3XOESPROC m_next_glNormal3xOES = nullptr;
+void m_glNormal3xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(735,m_next_glNormal3xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETMAPFVPROC m_next_glGetMapfv = nullptr;
+void m_glGetMapfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(736,m_next_glGetMapfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC m_next_glVertexStream2dvATI = nullptr;
+void m_glVertexStream2dvATI_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(737,m_next_glVertexStream2dvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC m_next_glPathStencilDepthOffsetNV = nullptr;
+void m_glPathStencilDepthOffsetNV_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(738,m_next_glPathStencilDepthOffsetNV,a0,a1);}
+FunctionTable::MEMBERPFNGLISSTATENVPROC m_next_glIsStateNV = nullptr;
+GLboolean m_glIsStateNV_profile(GLuint a0)const{return this->m_profile(739,m_next_glIsStateNV,a0);}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC m_next_glGetIntegerui64vNV = nullptr;
+void m_glGetIntegerui64vNV_profile(GLenum a0,GLuint64EXT* a1)const{return this->m_profile(740,m_next_glGetIntegerui64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC m_next_glGetImageTransformParameterfvHP = nullptr;
+void m_glGetImageTransformParameterfvHP_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(741,m_next_glGetImageTransformParameterfvHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC m_next_glRasterPos2fv = nullptr;
+void m_glRasterPos2fv_profile(const GLfloat* a0)const{return this->m_profile(742,m_next_glRasterPos2fv,a0);}
+FunctionTable::MEMBERPFNGLVERTEX3XOESPROC m_next_glVertex3xOES = nullptr;
+void m_glVertex3xOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(743,m_next_glVertex3xOES,a0,a1);}
+FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC m_next_glIsMemoryObjectEXT = nullptr;
+GLboolean m_glIsMemoryObjectEXT_profile(GLuint a0)const{return this->m_profile(744,m_next_glIsMemoryObjectEXT,a0);}
+FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC m_next_glWeightPointerARB = nullptr;
+void m_glWeightPointerARB_profile(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(745,m_next_glWeightPointerARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFINISHFENCENVPROC m_next_glFinishFenceNV = nullptr;
+void m_glFinishFenceNV_profile(GLuint a0)const{return this->m_profile(746,m_next_glFinishFenceNV,a0);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC m_next_glDepthRangexOES = nullptr;
+void m_glDepthRangexOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(747,m_next_glDepthRangexOES,a0,a1);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC m_next_glEnableVertexArrayAttribEXT = nullptr;
+void m_glEnableVertexArrayAttribEXT_profile(GLuint a0,GLuint a1)const{return this->m_profile(748,m_next_glEnableVertexArrayAttribEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC m_next_glProgramUniform2uivEXT = nullptr;
+void m_glProgramUniform2uivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(749,m_next_glProgramUniform2uivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC m_next_glGetDoubleIndexedvEXT = nullptr;
+void m_glGetDoubleIndexedvEXT_profile(GLenum a0,GLuint a1,GLdouble* a2)const{return this->m_profile(750,m_next_glGetDoubleIndexedvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC m_next_glWindowPos2fMESA = nullptr;
+void m_glWindowPos2fMESA_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(751,m_next_glWindowPos2fMESA,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC m_next_glSecondaryColor3b = nullptr;
+void m_glSecondaryColor3b_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(752,m_next_glSecondaryColor3b,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC m_next_glCopyConvolutionFilter1DEXT = nullptr;
+void m_glCopyConvolutionFilter1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(753,m_next_glCopyConvolutionFilter1DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC m_next_glWindowPos2sv = nullptr;
+void m_glWindowPos2sv_profile(const GLshort* a0)const{return this->m_profile(754,m_next_glWindowPos2sv,a0);}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC m_next_glBindFramebufferEXT = nullptr;
+void m_glBindFramebufferEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(755,m_next_glBindFramebufferEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROC m_next_glCreateShader = nullptr;
+GLuint m_glCreateShader_profile(GLenum a0)const{return this->m_profile(756,m_next_glCreateShader,a0);}
+FunctionTable::MEMBERPFNGLGENPATHSNVPROC m_next_glGenPathsNV = nullptr;
+GLuint m_glGenPathsNV_profile(GLsizei a0)const{return this->m_profile(757,m_next_glGenPathsNV,a0);}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC m_next_glGenRenderbuffers = nullptr;
+void m_glGenRenderbuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(758,m_next_glGenRenderbuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC m_next_glCopyTexSubImage2D = nullptr;
+void m_glCopyTexSubImage2D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{return this->m_profile(759,m_next_glCopyTexSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC m_next_glVertexAttrib4ubvARB = nullptr;
+void m_glVertexAttrib4ubvARB_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(760,m_next_glVertexAttrib4ubvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC m_next_glDrawTextureNV = nullptr;
+void m_glDrawTextureNV_profile(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{return this->m_profile(761,m_next_glDrawTextureNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC m_next_glVertexAttribs1svNV = nullptr;
+void m_glVertexAttribs1svNV_profile(GLuint a0,GLsizei a1,const GLshort* a2)const{return this->m_profile(762,m_next_glVertexAttribs1svNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC m_next_glClearNamedBufferSubDataEXT = nullptr;
+void m_glClearNamedBufferSubDataEXT_profile(GLuint a0,GLenum a1,GLsizeiptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(763,m_next_glClearNamedBufferSubDataEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC m_next_glBlendFuncSeparate = nullptr;
+void m_glBlendFuncSeparate_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(764,m_next_glBlendFuncSeparate,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC m_next_glPointParameterfARB = nullptr;
+void m_glPointParameterfARB_profile(GLenum a0,GLfloat a1)const{return this->m_profile(765,m_next_glPointParameterfARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC m_next_glTexCoord2fv = nullptr;
+void m_glTexCoord2fv_profile(const GLfloat* a0)const{return this->m_profile(766,m_next_glTexCoord2fv,a0);}
+FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC m_next_glGetVariantFloatvEXT = nullptr;
+void m_glGetVariantFloatvEXT_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(767,m_next_glGetVariantFloatvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXP2UIPROC m_next_glVertexP2ui = nullptr;
+void m_glVertexP2ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(768,m_next_glVertexP2ui,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC m_next_glWindowPos2dMESA = nullptr;
+void m_glWindowPos2dMESA_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(769,m_next_glWindowPos2dMESA,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC m_next_glTexCoord4fv = nullptr;
+void m_glTexCoord4fv_profile(const GLfloat* a0)const{return this->m_profile(770,m_next_glTexCoord4fv,a0);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC m_next_glBindFragDataLocationEXT = nullptr;
+void m_glBindFragDataLocationEXT_profile(GLuint a0,GLuint a1,const GLchar* a2)const{return this->m_profile(771,m_next_glBindFragDataLocationEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC m_next_glCompressedTexSubImage1DARB = nullptr;
+void m_glCompressedTexSubImage1DARB_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const void* a6)const{return this->m_profile(772,m_next_glCompressedTexSubImage1DARB,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC m_next_glGetTextureImageEXT = nullptr;
+void m_glGetTextureImageEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLenum a4,void* a5)const{return this->m_profile(773,m_next_glGetTextureImageEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLFOGCOORDDPROC m_next_glFogCoordd = nullptr;
+void m_glFogCoordd_profile(GLdouble a0)const{return this->m_profile(774,m_next_glFogCoordd,a0);}
+FunctionTable::MEMBERPFNGLPOINTSIZEPROC m_next_glPointSize = nullptr;
+void m_glPointSize_profile(GLfloat a0)const{return this->m_profile(775,m_next_glPointSize,a0);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC m_next_glBindTextureUnit = nullptr;
+void m_glBindTextureUnit_profile(GLuint a0,GLuint a1)const{return this->m_profile(776,m_next_glBindTextureUnit,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC m_next_glProgramEnvParameterI4uiNV = nullptr;
+void m_glProgramEnvParameterI4uiNV_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(777,m_next_glProgramEnvParameterI4uiNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC m_next_glGetProgramPipelineInfoLog = nullptr;
+void m_glGetProgramPipelineInfoLog_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(778,m_next_glGetProgramPipelineInfoLog,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC m_next_glProgramUniform4i64vARB = nullptr;
+void m_glProgramUniform4i64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{return this->m_profile(779,m_next_glProgramUniform4i64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC m_next_glVertexAttrib4Nuiv = nullptr;
+void m_glVertexAttrib4Nuiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(780,m_next_glVertexAttrib4Nuiv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC m_next_glGetUniformfvARB = nullptr;
+void m_glGetUniformfvARB_profile(GLhandleARB a0,GLint a1,GLfloat* a2)const{return this->m_profile(781,m_next_glGetUniformfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWAITSYNCPROC m_next_glWaitSync = nullptr;
+void m_glWaitSync_profile(GLsync a0,GLbitfield a1,GLuint64 a2)const{return this->m_profile(782,m_next_glWaitSync,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM3IPROC m_next_glUniform3i = nullptr;
+void m_glUniform3i_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(783,m_next_glUniform3i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC m_next_glBlendEquationSeparatei = nullptr;
+void m_glBlendEquationSeparatei_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(784,m_next_glBlendEquationSeparatei,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC m_next_glVertexAttrib2hvNV = nullptr;
+void m_glVertexAttrib2hvNV_profile(GLuint a0,const GLhalfNV* a1)const{return this->m_profile(785,m_next_glVertexAttrib2hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC m_next_glTextureParameterivEXT = nullptr;
+void m_glTextureParameterivEXT_profile(GLuint a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(786,m_next_glTextureParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM3DPROC m_next_glUniform3d = nullptr;
+void m_glUniform3d_profile(GLint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(787,m_next_glUniform3d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM3FPROC m_next_glUniform3f = nullptr;
+void m_glUniform3f_profile(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(788,m_next_glUniform3f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC m_next_glActiveProgramEXT = nullptr;
+void m_glActiveProgramEXT_profile(GLuint a0)const{return this->m_profile(789,m_next_glActiveProgramEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC m_next_glProgramUniform3uiv = nullptr;
+void m_glProgramUniform3uiv_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(790,m_next_glProgramUniform3uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC m_next_glUniform3ui64vARB = nullptr;
+void m_glUniform3ui64vARB_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(791,m_next_glUniform3ui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC m_next_glProgramUniform1ui64vARB = nullptr;
+void m_glProgramUniform1ui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(792,m_next_glProgramUniform1ui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC m_next_glTextureParameterfEXT = nullptr;
+void m_glTextureParameterfEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLfloat a3)const{return this->m_profile(793,m_next_glTextureParameterfEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC m_next_glSetFragmentShaderConstantATI = nullptr;
+void m_glSetFragmentShaderConstantATI_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(794,m_next_glSetFragmentShaderConstantATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC m_next_glColorSubTable = nullptr;
+void m_glColorSubTable_profile(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{return this->m_profile(795,m_next_glColorSubTable,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC m_next_glReplacementCodeuiSUN = nullptr;
+void m_glReplacementCodeuiSUN_profile(GLuint a0)const{return this->m_profile(796,m_next_glReplacementCodeuiSUN,a0);}
+FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC m_next_glStateCaptureNV = nullptr;
+void m_glStateCaptureNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(797,m_next_glStateCaptureNV,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC m_next_glBindAttribLocation = nullptr;
+void m_glBindAttribLocation_profile(GLuint a0,GLuint a1,const GLchar* a2)const{return this->m_profile(798,m_next_glBindAttribLocation,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC m_next_glWeightusvARB = nullptr;
+void m_glWeightusvARB_profile(GLint a0,const GLushort* a1)const{return this->m_profile(799,m_next_glWeightusvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC m_next_glGetFragDataIndex = nullptr;
+GLint m_glGetFragDataIndex_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(800,m_next_glGetFragDataIndex,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC m_next_glMultiTexCoord2xOES = nullptr;
+void m_glMultiTexCoord2xOES_profile(GLenum a0,GLfixed a1,GLfixed a2)const{return this->m_profile(801,m_next_glMultiTexCoord2xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR3SVPROC m_next_glColor3sv = nullptr;
+void m_glColor3sv_profile(const GLshort* a0)const{return this->m_profile(802,m_next_glColor3sv,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC m_next_glTexCoord2fVertex3fSUN = nullptr;
+void m_glTexCoord2fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(803,m_next_glTexCoord2fVertex3fSUN,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC m_next_glGetMemoryObjectParameterivEXT = nullptr;
+void m_glGetMemoryObjectParameterivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(804,m_next_glGetMemoryObjectParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC m_next_glPolygonOffsetEXT = nullptr;
+void m_glPolygonOffsetEXT_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(805,m_next_glPolygonOffsetEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC m_next_glWeightPathsNV = nullptr;
+void m_glWeightPathsNV_profile(GLuint a0,GLsizei a1,const GLuint* a2,const GLfloat* a3)const{return this->m_profile(806,m_next_glWeightPathsNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC m_next_glCombinerStageParameterfvNV = nullptr;
+void m_glCombinerStageParameterfvNV_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(807,m_next_glCombinerStageParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC m_next_glPointParameterfEXT = nullptr;
+void m_glPointParameterfEXT_profile(GLenum a0,GLfloat a1)const{return this->m_profile(808,m_next_glPointParameterfEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC m_next_glCopyTexImage1DEXT = nullptr;
+void m_glCopyTexImage1DEXT_profile(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLint a6)const{return this->m_profile(809,m_next_glCopyTexImage1DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEX4SVPROC m_next_glVertex4sv = nullptr;
+void m_glVertex4sv_profile(const GLshort* a0)const{return this->m_profile(810,m_next_glVertex4sv,a0);}
+FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC m_next_glMatrixMultfEXT = nullptr;
+void m_glMatrixMultfEXT_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(811,m_next_glMatrixMultfEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC m_next_glCompressedTextureSubImage3DEXT = nullptr;
+void m_glCompressedTextureSubImage3DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLsizei a10,const void* a11)const{return this->m_profile(812,m_next_glCompressedTextureSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC m_next_glGetTexLevelParameterxvOES = nullptr;
+void m_glGetTexLevelParameterxvOES_profile(GLenum a0,GLint a1,GLenum a2,GLfixed* a3)const{return this->m_profile(813,m_next_glGetTexLevelParameterxvOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC m_next_glVertexAttribL3dvEXT = nullptr;
+void m_glVertexAttribL3dvEXT_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(814,m_next_glVertexAttribL3dvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC m_next_glMultiTexCoordP4ui = nullptr;
+void m_glMultiTexCoordP4ui_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(815,m_next_glMultiTexCoordP4ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC m_next_glGetTextureLevelParameterivEXT = nullptr;
+void m_glGetTextureLevelParameterivEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLint* a4)const{return this->m_profile(816,m_next_glGetTextureLevelParameterivEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC m_next_glAlphaFragmentOp2ATI = nullptr;
+void m_glAlphaFragmentOp2ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8)const{return this->m_profile(817,m_next_glAlphaFragmentOp2ATI,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC m_next_glDeleteFramebuffers = nullptr;
+void m_glDeleteFramebuffers_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(818,m_next_glDeleteFramebuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSPROC m_next_glDrawArrays = nullptr;
+void m_glDrawArrays_profile(GLenum a0,GLint a1,GLsizei a2)const{return this->m_profile(819,m_next_glDrawArrays,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC m_next_glGetTransformFeedbackiv = nullptr;
+void m_glGetTransformFeedbackiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(820,m_next_glGetTransformFeedbackiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC m_next_glGetnTexImageARB = nullptr;
+void m_glGetnTexImageARB_profile(GLenum a0,GLint a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(821,m_next_glGetnTexImageARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCLEARPROC m_next_glClear = nullptr;
+void m_glClear_profile(GLbitfield a0)const{return this->m_profile(822,m_next_glClear,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC m_next_glVertexArrayParameteriAPPLE = nullptr;
+void m_glVertexArrayParameteriAPPLE_profile(GLenum a0,GLint a1)const{return this->m_profile(823,m_next_glVertexArrayParameteriAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC m_next_glMultiTexCoord2dvARB = nullptr;
+void m_glMultiTexCoord2dvARB_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(824,m_next_glMultiTexCoord2dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC m_next_glGetVideoCaptureStreamdvNV = nullptr;
+void m_glGetVideoCaptureStreamdvNV_profile(GLuint a0,GLuint a1,GLenum a2,GLdouble* a3)const{return this->m_profile(825,m_next_glGetVideoCaptureStreamdvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC m_next_glFragmentLightModelivSGIX = nullptr;
+void m_glFragmentLightModelivSGIX_profile(GLenum a0,const GLint* a1)const{return this->m_profile(826,m_next_glFragmentLightModelivSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC m_next_glVertexAttribP2ui = nullptr;
+void m_glVertexAttribP2ui_profile(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{return this->m_profile(827,m_next_glVertexAttribP2ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC m_next_glMultiTexCoordPointerEXT = nullptr;
+void m_glMultiTexCoordPointerEXT_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(828,m_next_glMultiTexCoordPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC m_next_glProgramUniform3iEXT = nullptr;
+void m_glProgramUniform3iEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(829,m_next_glProgramUniform3iEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTRANSLATEFPROC m_next_glTranslatef = nullptr;
+void m_glTranslatef_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(830,m_next_glTranslatef,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC m_next_glVertexAttrib4Nub = nullptr;
+void m_glVertexAttrib4Nub_profile(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{return this->m_profile(831,m_next_glVertexAttrib4Nub,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTRANSLATEDPROC m_next_glTranslated = nullptr;
+void m_glTranslated_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(832,m_next_glTranslated,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC m_next_glSamplerParameterIiv = nullptr;
+void m_glSamplerParameterIiv_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(833,m_next_glSamplerParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC m_next_glTexCoord4hNV = nullptr;
+void m_glTexCoord4hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{return this->m_profile(834,m_next_glTexCoord4hNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC m_next_glDrawElementsIndirect = nullptr;
+void m_glDrawElementsIndirect_profile(GLenum a0,GLenum a1,const void* a2)const{return this->m_profile(835,m_next_glDrawElementsIndirect,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC m_next_glDeletePerfMonitorsAMD = nullptr;
+void m_glDeletePerfMonitorsAMD_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(836,m_next_glDeletePerfMonitorsAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC m_next_glIsRenderbufferEXT = nullptr;
+GLboolean m_glIsRenderbufferEXT_profile(GLuint a0)const{return this->m_profile(837,m_next_glIsRenderbufferEXT,a0);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC m_next_glDrawCommandsNV = nullptr;
+void m_glDrawCommandsNV_profile(GLenum a0,GLuint a1,const GLintptr* a2,const GLsizei* a3,GLuint a4)const{return this->m_profile(838,m_next_glDrawCommandsNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC m_next_glUniform3ivARB = nullptr;
+void m_glUniform3ivARB_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(839,m_next_glUniform3ivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC m_next_glBufferSubData = nullptr;
+void m_glBufferSubData_profile(GLenum a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{return this->m_profile(840,m_next_glBufferSubData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC m_next_glSecondaryColor3bv = nullptr;
+void m_glSecondaryColor3bv_profile(const GLbyte* a0)const{return this->m_profile(841,m_next_glSecondaryColor3bv,a0);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC m_next_glMatrixMultTransposedEXT = nullptr;
+void m_glMatrixMultTransposedEXT_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(842,m_next_glMatrixMultTransposedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC m_next_glRequestResidentProgramsNV = nullptr;
+void m_glRequestResidentProgramsNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(843,m_next_glRequestResidentProgramsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC m_next_glAlphaFragmentOp1ATI = nullptr;
+void m_glAlphaFragmentOp1ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(844,m_next_glAlphaFragmentOp1ATI,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC m_next_glGetQueryObjecti64v = nullptr;
+void m_glGetQueryObjecti64v_profile(GLuint a0,GLenum a1,GLint64* a2)const{return this->m_profile(845,m_next_glGetQueryObjecti64v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC m_next_glMatrixMult3x3fNV = nullptr;
+void m_glMatrixMult3x3fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(846,m_next_glMatrixMult3x3fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC m_next_glColorTableParameteriv = nullptr;
+void m_glColorTableParameteriv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(847,m_next_glColorTableParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC m_next_glPathSubCommandsNV = nullptr;
+void m_glPathSubCommandsNV_profile(GLuint a0,GLsizei a1,GLsizei a2,GLsizei a3,const GLubyte* a4,GLsizei a5,GLenum a6,const void* a7)const{return this->m_profile(848,m_next_glPathSubCommandsNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC m_next_glGetFinalCombinerInputParameterivNV = nullptr;
+void m_glGetFinalCombinerInputParameterivNV_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(849,m_next_glGetFinalCombinerInputParameterivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC m_next_glIsRenderbuffer = nullptr;
+GLboolean m_glIsRenderbuffer_profile(GLuint a0)const{return this->m_profile(850,m_next_glIsRenderbuffer,a0);}
+FunctionTable::MEMBERPFNGLVERTEX3IVPROC m_next_glVertex3iv = nullptr;
+void m_glVertex3iv_profile(const GLint* a0)const{return this->m_profile(851,m_next_glVertex3iv,a0);}
+FunctionTable::MEMBERPFNGLTEXGENFVPROC m_next_glTexGenfv = nullptr;
+void m_glTexGenfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(852,m_next_glTexGenfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC m_next_glFrustumfOES = nullptr;
+void m_glFrustumfOES_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(853,m_next_glFrustumfOES,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC m_next_glBindVertexBuffers = nullptr;
+void m_glBindVertexBuffers_profile(GLuint a0,GLsizei a1,const GLuint* a2,const GLintptr* a3,const GLsizei* a4)const{return this->m_profile(854,m_next_glBindVertexBuffers,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATERIALIPROC m_next_glMateriali = nullptr;
+void m_glMateriali_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(855,m_next_glMateriali,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC m_next_glMultiTexCoord2svARB = nullptr;
+void m_glMultiTexCoord2svARB_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(856,m_next_glMultiTexCoord2svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC m_next_glDisableVertexAttribArray = nullptr;
+void m_glDisableVertexAttribArray_profile(GLuint a0)const{return this->m_profile(857,m_next_glDisableVertexAttribArray,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC m_next_glWindowPos3ivARB = nullptr;
+void m_glWindowPos3ivARB_profile(const GLint* a0)const{return this->m_profile(858,m_next_glWindowPos3ivARB,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC m_next_glTexCoordFormatNV = nullptr;
+void m_glTexCoordFormatNV_profile(GLint a0,GLenum a1,GLsizei a2)const{return this->m_profile(859,m_next_glTexCoordFormatNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC m_next_glBlitNamedFramebuffer = nullptr;
+void m_glBlitNamedFramebuffer_profile(GLuint a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLint a8,GLint a9,GLbitfield a10,GLenum a11)const{return this->m_profile(860,m_next_glBlitNamedFramebuffer,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC m_next_glMatrixLoadTransposefEXT = nullptr;
+void m_glMatrixLoadTransposefEXT_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(861,m_next_glMatrixLoadTransposefEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC m_next_glMultiTexGenfEXT = nullptr;
+void m_glMultiTexGenfEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{return this->m_profile(862,m_next_glMultiTexGenfEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC m_next_glShaderStorageBlockBinding = nullptr;
+void m_glShaderStorageBlockBinding_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(863,m_next_glShaderStorageBlockBinding,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATERIALFPROC m_next_glMaterialf = nullptr;
+void m_glMaterialf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(864,m_next_glMaterialf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC m_next_glReplacementCodeuiColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{return this->m_profile(865,m_next_glReplacementCodeuiColor4fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC m_next_glCheckNamedFramebufferStatusEXT = nullptr;
+GLenum m_glCheckNamedFramebufferStatusEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(866,m_next_glCheckNamedFramebufferStatusEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC m_next_glVertexArrayVertexAttribFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribFormatEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLboolean a4,GLuint a5)const{return this->m_profile(867,m_next_glVertexArrayVertexAttribFormatEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEX2HNVPROC m_next_glVertex2hNV = nullptr;
+void m_glVertex2hNV_profile(GLhalfNV a0,GLhalfNV a1)const{return this->m_profile(868,m_next_glVertex2hNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC m_next_glDeleteVertexShaderEXT = nullptr;
+void m_glDeleteVertexShaderEXT_profile(GLuint a0)const{return this->m_profile(869,m_next_glDeleteVertexShaderEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC m_next_glTexImage3DEXT = nullptr;
+void m_glTexImage3DEXT_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{return this->m_profile(870,m_next_glTexImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC m_next_glSignalVkFenceNV = nullptr;
+void m_glSignalVkFenceNV_profile(GLuint64 a0)const{return this->m_profile(871,m_next_glSignalVkFenceNV,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC m_next_glProgramLocalParameterI4ivNV = nullptr;
+void m_glProgramLocalParameterI4ivNV_profile(GLenum a0,GLuint a1,const GLint* a2)const{return this->m_profile(872,m_next_glProgramLocalParameterI4ivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC m_next_glGlobalAlphaFactoriSUN = nullptr;
+void m_glGlobalAlphaFactoriSUN_profile(GLint a0)const{return this->m_profile(873,m_next_glGlobalAlphaFactoriSUN,a0);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC m_next_glTextureStorage1D = nullptr;
+void m_glTextureStorage1D_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3)const{return this->m_profile(874,m_next_glTextureStorage1D,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC m_next_glBinormal3sEXT = nullptr;
+void m_glBinormal3sEXT_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(875,m_next_glBinormal3sEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC m_next_glGetProgramInterfaceiv = nullptr;
+void m_glGetProgramInterfaceiv_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(876,m_next_glGetProgramInterfaceiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC m_next_glMatrixIndexPointerARB = nullptr;
+void m_glMatrixIndexPointerARB_profile(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(877,m_next_glMatrixIndexPointerARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC m_next_glTexCoordPointerEXT = nullptr;
+void m_glTexCoordPointerEXT_profile(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{return this->m_profile(878,m_next_glTexCoordPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC m_next_glMultiTexGeniEXT = nullptr;
+void m_glMultiTexGeniEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{return this->m_profile(879,m_next_glMultiTexGeniEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC m_next_glVertexAttrib2fNV = nullptr;
+void m_glVertexAttrib2fNV_profile(GLuint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(880,m_next_glVertexAttrib2fNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC m_next_glNamedProgramStringEXT = nullptr;
+void m_glNamedProgramStringEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(881,m_next_glNamedProgramStringEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC m_next_glMapNamedBuffer = nullptr;
+void* m_glMapNamedBuffer_profile(GLuint a0,GLenum a1)const{return this->m_profile(882,m_next_glMapNamedBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC m_next_glGetMinmaxParameteriv = nullptr;
+void m_glGetMinmaxParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(883,m_next_glGetMinmaxParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC m_next_glGetnUniformdv = nullptr;
+void m_glGetnUniformdv_profile(GLuint a0,GLint a1,GLsizei a2,GLdouble* a3)const{return this->m_profile(884,m_next_glGetnUniformdv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC m_next_glEndConditionalRenderNVX = nullptr;
+void m_glEndConditionalRenderNVX_profile()const{return this->m_profile(885,m_next_glEndConditionalRenderNVX);}
+FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC m_next_glBinormal3fEXT = nullptr;
+void m_glBinormal3fEXT_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(886,m_next_glBinormal3fEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC m_next_glNormalStream3iATI = nullptr;
+void m_glNormalStream3iATI_profile(GLenum a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(887,m_next_glNormalStream3iATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC m_next_glProgramBufferParametersIivNV = nullptr;
+void m_glProgramBufferParametersIivNV_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLint* a4)const{return this->m_profile(888,m_next_glProgramBufferParametersIivNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC m_next_glMapGrid1xOES = nullptr;
+void m_glMapGrid1xOES_profile(GLint a0,GLfixed a1,GLfixed a2)const{return this->m_profile(889,m_next_glMapGrid1xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC m_next_glGetVertexAttribPointervARB = nullptr;
+void m_glGetVertexAttribPointervARB_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(890,m_next_glGetVertexAttribPointervARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC m_next_glFlushMappedNamedBufferRangeEXT = nullptr;
+void m_glFlushMappedNamedBufferRangeEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2)const{return this->m_profile(891,m_next_glFlushMappedNamedBufferRangeEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC m_next_glGetVertexAttribIiv = nullptr;
+void m_glGetVertexAttribIiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(892,m_next_glGetVertexAttribIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC m_next_glVertexP4uiv = nullptr;
+void m_glVertexP4uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(893,m_next_glVertexP4uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC m_next_glUniformui64NV = nullptr;
+void m_glUniformui64NV_profile(GLint a0,GLuint64EXT a1)const{return this->m_profile(894,m_next_glUniformui64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4FVPROC m_next_glColor4fv = nullptr;
+void m_glColor4fv_profile(const GLfloat* a0)const{return this->m_profile(895,m_next_glColor4fv,a0);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC m_next_glTexParameterxvOES = nullptr;
+void m_glTexParameterxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(896,m_next_glTexParameterxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC m_next_glPatchParameteri = nullptr;
+void m_glPatchParameteri_profile(GLenum a0,GLint a1)const{return this->m_profile(897,m_next_glPatchParameteri,a0,a1);}
+FunctionTable::MEMBERPFNGLMAP1DPROC m_next_glMap1d = nullptr;
+void m_glMap1d_profile(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,const GLdouble* a5)const{return this->m_profile(898,m_next_glMap1d,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC m_next_glGetTexFilterFuncSGIS = nullptr;
+void m_glGetTexFilterFuncSGIS_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(899,m_next_glGetTexFilterFuncSGIS,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC m_next_glVertexStream3dATI = nullptr;
+void m_glVertexStream3dATI_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(900,m_next_glVertexStream3dATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC m_next_glVertexArrayVertexBindingDivisorEXT = nullptr;
+void m_glVertexArrayVertexBindingDivisorEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(901,m_next_glVertexArrayVertexBindingDivisorEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC m_next_glMultiTexCoord3svARB = nullptr;
+void m_glMultiTexCoord3svARB_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(902,m_next_glMultiTexCoord3svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC m_next_glBindProgramNV = nullptr;
+void m_glBindProgramNV_profile(GLenum a0,GLuint a1)const{return this->m_profile(903,m_next_glBindProgramNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC m_next_glGetConvolutionParameteriv = nullptr;
+void m_glGetConvolutionParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(904,m_next_glGetConvolutionParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC m_next_glGetProgramLocalParameterfvARB = nullptr;
+void m_glGetProgramLocalParameterfvARB_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(905,m_next_glGetProgramLocalParameterfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC m_next_glGenFragmentShadersATI = nullptr;
+GLuint m_glGenFragmentShadersATI_profile(GLuint a0)const{return this->m_profile(906,m_next_glGenFragmentShadersATI,a0);}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC m_next_glTexBumpParameterivATI = nullptr;
+void m_glTexBumpParameterivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(907,m_next_glTexBumpParameterivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_next_glGetNamedFramebufferAttachmentParameteriv = nullptr;
+void m_glGetNamedFramebufferAttachmentParameteriv_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(908,m_next_glGetNamedFramebufferAttachmentParameteriv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC m_next_glGetnSeparableFilter = nullptr;
+void m_glGetnSeparableFilter_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4,GLsizei a5,void* a6,void* a7)const{return this->m_profile(909,m_next_glGetnSeparableFilter,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC m_next_glNormal3xvOES = nullptr;
+void m_glNormal3xvOES_profile(const GLfixed* a0)const{return this->m_profile(910,m_next_glNormal3xvOES,a0);}
+FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC m_next_glPassTexCoordATI = nullptr;
+void m_glPassTexCoordATI_profile(GLuint a0,GLuint a1,GLenum a2)const{return this->m_profile(911,m_next_glPassTexCoordATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC m_next_glFramebufferTextureFaceARB = nullptr;
+void m_glFramebufferTextureFaceARB_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{return this->m_profile(912,m_next_glFramebufferTextureFaceARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC m_next_glProgramUniform1dv = nullptr;
+void m_glProgramUniform1dv_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(913,m_next_glProgramUniform1dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC m_next_glTextureStorage2DEXT = nullptr;
+void m_glTextureStorage2DEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{return this->m_profile(914,m_next_glTextureStorage2DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC m_next_glVertexArrayFogCoordOffsetEXT = nullptr;
+void m_glVertexArrayFogCoordOffsetEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{return this->m_profile(915,m_next_glVertexArrayFogCoordOffsetEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC m_next_glDeleteNamedStringARB = nullptr;
+void m_glDeleteNamedStringARB_profile(GLint a0,const GLchar* a1)const{return this->m_profile(916,m_next_glDeleteNamedStringARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC m_next_glMulticastGetQueryObjecti64vNV = nullptr;
+void m_glMulticastGetQueryObjecti64vNV_profile(GLuint a0,GLuint a1,GLenum a2,GLint64* a3)const{return this->m_profile(917,m_next_glMulticastGetQueryObjecti64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC m_next_glGenOcclusionQueriesNV = nullptr;
+void m_glGenOcclusionQueriesNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(918,m_next_glGenOcclusionQueriesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLLIGHTIPROC m_next_glLighti = nullptr;
+void m_glLighti_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(919,m_next_glLighti,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC m_next_glTexImage1D = nullptr;
+void m_glTexImage1D_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLint a4,GLenum a5,GLenum a6,const GLvoid* a7)const{return this->m_profile(920,m_next_glTexImage1D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLLIGHTFPROC m_next_glLightf = nullptr;
+void m_glLightf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(921,m_next_glLightf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC m_next_glClientAttribDefaultEXT = nullptr;
+void m_glClientAttribDefaultEXT_profile(GLbitfield a0)const{return this->m_profile(922,m_next_glClientAttribDefaultEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC m_next_glVertexAttrib4bvARB = nullptr;
+void m_glVertexAttrib4bvARB_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(923,m_next_glVertexAttrib4bvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC m_next_glVertexAttribIFormatNV = nullptr;
+void m_glVertexAttribIFormatNV_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3)const{return this->m_profile(924,m_next_glVertexAttribIFormatNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC m_next_glStencilFuncSeparate = nullptr;
+void m_glStencilFuncSeparate_profile(GLenum a0,GLenum a1,GLint a2,GLuint a3)const{return this->m_profile(925,m_next_glStencilFuncSeparate,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC m_next_glGetVertexAttribfvARB = nullptr;
+void m_glGetVertexAttribfvARB_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(926,m_next_glGetVertexAttribfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC m_next_glVertexAttrib2dNV = nullptr;
+void m_glVertexAttrib2dNV_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(927,m_next_glVertexAttrib2dNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC m_next_glProgramUniform2iEXT = nullptr;
+void m_glProgramUniform2iEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(928,m_next_glProgramUniform2iEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC m_next_glClientActiveVertexStreamATI = nullptr;
+void m_glClientActiveVertexStreamATI_profile(GLenum a0)const{return this->m_profile(929,m_next_glClientActiveVertexStreamATI,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC m_next_glRasterPos3xOES = nullptr;
+void m_glRasterPos3xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(930,m_next_glRasterPos3xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC m_next_glGetMapParameterivNV = nullptr;
+void m_glGetMapParameterivNV_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(931,m_next_glGetMapParameterivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC m_next_glSampleCoverage = nullptr;
+void m_glSampleCoverage_profile(GLclampf a0,GLboolean a1)const{return this->m_profile(932,m_next_glSampleCoverage,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC m_next_glClearDepthxOES = nullptr;
+void m_glClearDepthxOES_profile(GLfixed a0)const{return this->m_profile(933,m_next_glClearDepthxOES,a0);}
+FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC m_next_glUniformBufferEXT = nullptr;
+void m_glUniformBufferEXT_profile(GLuint a0,GLint a1,GLuint a2)const{return this->m_profile(934,m_next_glUniformBufferEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_next_glTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(935,m_next_glTexCoord2fNormal3fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC m_next_glMulticastGetQueryObjectuivNV = nullptr;
+void m_glMulticastGetQueryObjectuivNV_profile(GLuint a0,GLuint a1,GLenum a2,GLuint* a3)const{return this->m_profile(936,m_next_glMulticastGetQueryObjectuivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC m_next_glGetFirstPerfQueryIdINTEL = nullptr;
+void m_glGetFirstPerfQueryIdINTEL_profile(GLuint* a0)const{return this->m_profile(937,m_next_glGetFirstPerfQueryIdINTEL,a0);}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC m_next_glUnmapNamedBufferEXT = nullptr;
+GLboolean m_glUnmapNamedBufferEXT_profile(GLuint a0)const{return this->m_profile(938,m_next_glUnmapNamedBufferEXT,a0);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC m_next_glGetTransformFeedbacki_v = nullptr;
+void m_glGetTransformFeedbacki_v_profile(GLuint a0,GLenum a1,GLuint a2,GLint* a3)const{return this->m_profile(939,m_next_glGetTransformFeedbacki_v,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC m_next_glUniform4fvARB = nullptr;
+void m_glUniform4fvARB_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(940,m_next_glUniform4fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC m_next_glRenderbufferStorageMultisampleCoverageNV = nullptr;
+void m_glRenderbufferStorageMultisampleCoverageNV_profile(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{return this->m_profile(941,m_next_glRenderbufferStorageMultisampleCoverageNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC m_next_glGetFloati_vEXT = nullptr;
+void m_glGetFloati_vEXT_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(942,m_next_glGetFloati_vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC m_next_glBindAttribLocationARB = nullptr;
+void m_glBindAttribLocationARB_profile(GLhandleARB a0,GLuint a1,const GLcharARB* a2)const{return this->m_profile(943,m_next_glBindAttribLocationARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC m_next_glBufferAddressRangeNV = nullptr;
+void m_glBufferAddressRangeNV_profile(GLenum a0,GLuint a1,GLuint64EXT a2,GLsizeiptr a3)const{return this->m_profile(944,m_next_glBufferAddressRangeNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC m_next_glGenProgramsARB = nullptr;
+void m_glGenProgramsARB_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(945,m_next_glGenProgramsARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC m_next_glMultiTexEnvivEXT = nullptr;
+void m_glMultiTexEnvivEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(946,m_next_glMultiTexEnvivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC m_next_glSecondaryColor3uiEXT = nullptr;
+void m_glSecondaryColor3uiEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(947,m_next_glSecondaryColor3uiEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC m_next_glCompressedTextureImage2DEXT = nullptr;
+void m_glCompressedTextureImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{return this->m_profile(948,m_next_glCompressedTextureImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLUNIFORM2IPROC m_next_glUniform2i = nullptr;
+void m_glUniform2i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(949,m_next_glUniform2i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC m_next_glCopyTexImage2DEXT = nullptr;
+void m_glCopyTexImage2DEXT_profile(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLint a7)const{return this->m_profile(950,m_next_glCopyTexImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLUNIFORM2DPROC m_next_glUniform2d = nullptr;
+void m_glUniform2d_profile(GLint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(951,m_next_glUniform2d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC m_next_glVertexAttribL1d = nullptr;
+void m_glVertexAttribL1d_profile(GLuint a0,GLdouble a1)const{return this->m_profile(952,m_next_glVertexAttribL1d,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC m_next_glFramebufferTextureFaceEXT = nullptr;
+void m_glFramebufferTextureFaceEXT_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{return this->m_profile(953,m_next_glFramebufferTextureFaceEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC m_next_glFramebufferTextureLayer = nullptr;
+void m_glFramebufferTextureLayer_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{return this->m_profile(954,m_next_glFramebufferTextureLayer,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC m_next_glMultiTexCoord4bvOES = nullptr;
+void m_glMultiTexCoord4bvOES_profile(GLenum a0,const GLbyte* a1)const{return this->m_profile(955,m_next_glMultiTexCoord4bvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC m_next_glGetVertexArrayPointeri_vEXT = nullptr;
+void m_glGetVertexArrayPointeri_vEXT_profile(GLuint a0,GLuint a1,GLenum a2,void** a3)const{return this->m_profile(956,m_next_glGetVertexArrayPointeri_vEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC m_next_glNamedProgramLocalParameter4dEXT = nullptr;
+void m_glNamedProgramLocalParameter4dEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{return this->m_profile(957,m_next_glNamedProgramLocalParameter4dEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC m_next_glBinormal3bEXT = nullptr;
+void m_glBinormal3bEXT_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(958,m_next_glBinormal3bEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC m_next_glConvolutionFilter2DEXT = nullptr;
+void m_glConvolutionFilter2DEXT_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(959,m_next_glConvolutionFilter2DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC m_next_glProgramUniform2fv = nullptr;
+void m_glProgramUniform2fv_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(960,m_next_glProgramUniform2fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC m_next_glColor3fVertex3fSUN = nullptr;
+void m_glColor3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(961,m_next_glColor3fVertex3fSUN,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC m_next_glNormal3fVertex3fvSUN = nullptr;
+void m_glNormal3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1)const{return this->m_profile(962,m_next_glNormal3fVertex3fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC m_next_glCopyMultiTexSubImage3DEXT = nullptr;
+void m_glCopyMultiTexSubImage3DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLsizei a8,GLsizei a9)const{return this->m_profile(963,m_next_glCopyMultiTexSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC m_next_glProgramLocalParameterI4iNV = nullptr;
+void m_glProgramLocalParameterI4iNV_profile(GLenum a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{return this->m_profile(964,m_next_glProgramLocalParameterI4iNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC m_next_glProgramUniformMatrix2x4dv = nullptr;
+void m_glProgramUniformMatrix2x4dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(965,m_next_glProgramUniformMatrix2x4dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC m_next_glPathMemoryGlyphIndexArrayNV = nullptr;
+GLenum m_glPathMemoryGlyphIndexArrayNV_profile(GLuint a0,GLenum a1,GLsizeiptr a2,const void* a3,GLsizei a4,GLuint a5,GLsizei a6,GLuint a7,GLfloat a8)const{return this->m_profile(966,m_next_glPathMemoryGlyphIndexArrayNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC m_next_glDrawArraysEXT = nullptr;
+void m_glDrawArraysEXT_profile(GLenum a0,GLint a1,GLsizei a2)const{return this->m_profile(967,m_next_glDrawArraysEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC m_next_glBlendEquationEXT = nullptr;
+void m_glBlendEquationEXT_profile(GLenum a0)const{return this->m_profile(968,m_next_glBlendEquationEXT,a0);}
+FunctionTable::MEMBERPFNGLSTENCILOPPROC m_next_glStencilOp = nullptr;
+void m_glStencilOp_profile(GLenum a0,GLenum a1,GLenum a2)const{return this->m_profile(969,m_next_glStencilOp,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC m_next_glCopyTextureSubImage2DEXT = nullptr;
+void m_glCopyTextureSubImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{return this->m_profile(970,m_next_glCopyTextureSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLTEXENVFPROC m_next_glTexEnvf = nullptr;
+void m_glTexEnvf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(971,m_next_glTexEnvf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC m_next_glVertexAttrib2dvNV = nullptr;
+void m_glVertexAttrib2dvNV_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(972,m_next_glVertexAttrib2dvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC m_next_glGenPerfMonitorsAMD = nullptr;
+void m_glGenPerfMonitorsAMD_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(973,m_next_glGenPerfMonitorsAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC m_next_glGetInteger64i_v = nullptr;
+void m_glGetInteger64i_v_profile(GLenum a0,GLuint a1,GLint64* a2)const{return this->m_profile(974,m_next_glGetInteger64i_v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC m_next_glGetHistogramParameterfv = nullptr;
+void m_glGetHistogramParameterfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(975,m_next_glGetHistogramParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC m_next_glVertexFormatNV = nullptr;
+void m_glVertexFormatNV_profile(GLint a0,GLenum a1,GLsizei a2)const{return this->m_profile(976,m_next_glVertexFormatNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC m_next_glBlendFuncIndexedAMD = nullptr;
+void m_glBlendFuncIndexedAMD_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(977,m_next_glBlendFuncIndexedAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXENVIPROC m_next_glTexEnvi = nullptr;
+void m_glTexEnvi_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(978,m_next_glTexEnvi,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC m_next_glMultiTexCoord1iv = nullptr;
+void m_glMultiTexCoord1iv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(979,m_next_glMultiTexCoord1iv,a0,a1);}
+FunctionTable::MEMBERPFNGLISENABLEDIPROC m_next_glIsEnabledi = nullptr;
+GLboolean m_glIsEnabledi_profile(GLenum a0,GLuint a1)const{return this->m_profile(980,m_next_glIsEnabledi,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC m_next_glVertexAttribL2ui64vNV = nullptr;
+void m_glVertexAttribL2ui64vNV_profile(GLuint a0,const GLuint64EXT* a1)const{return this->m_profile(981,m_next_glVertexAttribL2ui64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC m_next_glVertexAttribL4i64NV = nullptr;
+void m_glVertexAttribL4i64NV_profile(GLuint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{return this->m_profile(982,m_next_glVertexAttribL4i64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC m_next_glMatrixTranslatedEXT = nullptr;
+void m_glMatrixTranslatedEXT_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(983,m_next_glMatrixTranslatedEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC m_next_glMakeTextureHandleResidentARB = nullptr;
+void m_glMakeTextureHandleResidentARB_profile(GLuint64 a0)const{return this->m_profile(984,m_next_glMakeTextureHandleResidentARB,a0);}
+FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC m_next_glMatrixMultdEXT = nullptr;
+void m_glMatrixMultdEXT_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(985,m_next_glMatrixMultdEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC m_next_glBinormal3dvEXT = nullptr;
+void m_glBinormal3dvEXT_profile(const GLdouble* a0)const{return this->m_profile(986,m_next_glBinormal3dvEXT,a0);}
+FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC m_next_glImportSyncEXT = nullptr;
+GLsync m_glImportSyncEXT_profile(GLenum a0,GLintptr a1,GLbitfield a2)const{return this->m_profile(987,m_next_glImportSyncEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETMAPIVPROC m_next_glGetMapiv = nullptr;
+void m_glGetMapiv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(988,m_next_glGetMapiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC m_next_glImportSemaphoreFdEXT = nullptr;
+void m_glImportSemaphoreFdEXT_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(989,m_next_glImportSemaphoreFdEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC m_next_glMultiTexCoord4sv = nullptr;
+void m_glMultiTexCoord4sv_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(990,m_next_glMultiTexCoord4sv,a0,a1);}
+FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC m_next_glPNTrianglesiATI = nullptr;
+void m_glPNTrianglesiATI_profile(GLenum a0,GLint a1)const{return this->m_profile(991,m_next_glPNTrianglesiATI,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC m_next_glBindVertexArrayAPPLE = nullptr;
+void m_glBindVertexArrayAPPLE_profile(GLuint a0)const{return this->m_profile(992,m_next_glBindVertexArrayAPPLE,a0);}
+FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC m_next_glObjectPtrLabel = nullptr;
+void m_glObjectPtrLabel_profile(const void* a0,GLsizei a1,const GLchar* a2)const{return this->m_profile(993,m_next_glObjectPtrLabel,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC m_next_glGetDebugMessageLog = nullptr;
+GLuint m_glGetDebugMessageLog_profile(GLuint a0,GLsizei a1,GLenum* a2,GLenum* a3,GLuint* a4,GLenum* a5,GLsizei* a6,GLchar* a7)const{return this->m_profile(994,m_next_glGetDebugMessageLog,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC m_next_glTrackMatrixNV = nullptr;
+void m_glTrackMatrixNV_profile(GLenum a0,GLuint a1,GLenum a2,GLenum a3)const{return this->m_profile(995,m_next_glTrackMatrixNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC m_next_glProgramPathFragmentInputGenNV = nullptr;
+void m_glProgramPathFragmentInputGenNV_profile(GLuint a0,GLint a1,GLenum a2,GLint a3,const GLfloat* a4)const{return this->m_profile(996,m_next_glProgramPathFragmentInputGenNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC m_next_glTangent3ivEXT = nullptr;
+void m_glTangent3ivEXT_profile(const GLint* a0)const{return this->m_profile(997,m_next_glTangent3ivEXT,a0);}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC m_next_glGetUniformfv = nullptr;
+void m_glGetUniformfv_profile(GLuint a0,GLint a1,GLfloat* a2)const{return this->m_profile(998,m_next_glGetUniformfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC m_next_glSecondaryColor3ubv = nullptr;
+void m_glSecondaryColor3ubv_profile(const GLubyte* a0)const{return this->m_profile(999,m_next_glSecondaryColor3ubv,a0);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC m_next_glMakeTextureHandleNonResidentNV = nullptr;
+void m_glMakeTextureHandleNonResidentNV_profile(GLuint64 a0)const{return this->m_profile(1000,m_next_glMakeTextureHandleNonResidentNV,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC m_next_glVertexAttribs4ubvNV = nullptr;
+void m_glVertexAttribs4ubvNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2)const{return this->m_profile(1001,m_next_glVertexAttribs4ubvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC m_next_glClipPlanexOES = nullptr;
+void m_glClipPlanexOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(1002,m_next_glClipPlanexOES,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC m_next_glMultiTexCoord3iv = nullptr;
+void m_glMultiTexCoord3iv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1003,m_next_glMultiTexCoord3iv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC m_next_glGetnPolygonStippleARB = nullptr;
+void m_glGetnPolygonStippleARB_profile(GLsizei a0,GLubyte* a1)const{return this->m_profile(1004,m_next_glGetnPolygonStippleARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC m_next_glUniform2i64vNV = nullptr;
+void m_glUniform2i64vNV_profile(GLint a0,GLsizei a1,const GLint64EXT* a2)const{return this->m_profile(1005,m_next_glUniform2i64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLIGHTMODELFPROC m_next_glLightModelf = nullptr;
+void m_glLightModelf_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1006,m_next_glLightModelf,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC m_next_glDeleteMemoryObjectsEXT = nullptr;
+void m_glDeleteMemoryObjectsEXT_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1007,m_next_glDeleteMemoryObjectsEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC m_next_glMultiTexSubImage2DEXT = nullptr;
+void m_glMultiTexSubImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLenum a8,const void* a9)const{return this->m_profile(1008,m_next_glMultiTexSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC m_next_glReplacementCodeuiColor3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{return this->m_profile(1009,m_next_glReplacementCodeuiColor3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC m_next_glTangent3dvEXT = nullptr;
+void m_glTangent3dvEXT_profile(const GLdouble* a0)const{return this->m_profile(1010,m_next_glTangent3dvEXT,a0);}
+FunctionTable::MEMBERPFNGLLIGHTMODELIPROC m_next_glLightModeli = nullptr;
+void m_glLightModeli_profile(GLenum a0,GLint a1)const{return this->m_profile(1011,m_next_glLightModeli,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC m_next_glVertexWeighthvNV = nullptr;
+void m_glVertexWeighthvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1012,m_next_glVertexWeighthvNV,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC m_next_glWindowPos3iv = nullptr;
+void m_glWindowPos3iv_profile(const GLint* a0)const{return this->m_profile(1013,m_next_glWindowPos3iv,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC m_next_glMultiTexCoordP1uiv = nullptr;
+void m_glMultiTexCoordP1uiv_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(1014,m_next_glMultiTexCoordP1uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC m_next_glTransformPathNV = nullptr;
+void m_glTransformPathNV_profile(GLuint a0,GLuint a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(1015,m_next_glTransformPathNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC m_next_glProgramNamedParameter4dNV = nullptr;
+void m_glProgramNamedParameter4dNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{return this->m_profile(1016,m_next_glProgramNamedParameter4dNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC m_next_glMultiDrawElementsIndirect = nullptr;
+void m_glMultiDrawElementsIndirect_profile(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1017,m_next_glMultiDrawElementsIndirect,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC m_next_glProgramUniform1dEXT = nullptr;
+void m_glProgramUniform1dEXT_profile(GLuint a0,GLint a1,GLdouble a2)const{return this->m_profile(1018,m_next_glProgramUniform1dEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCALLLISTSPROC m_next_glCallLists = nullptr;
+void m_glCallLists_profile(GLsizei a0,GLenum a1,const GLvoid* a2)const{return this->m_profile(1019,m_next_glCallLists,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC m_next_glNormal3hvNV = nullptr;
+void m_glNormal3hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1020,m_next_glNormal3hvNV,a0);}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC m_next_glGetCombinerOutputParameterfvNV = nullptr;
+void m_glGetCombinerOutputParameterfvNV_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat* a3)const{return this->m_profile(1021,m_next_glGetCombinerOutputParameterfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC m_next_glVertexAttrib4sARB = nullptr;
+void m_glVertexAttrib4sARB_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(1022,m_next_glVertexAttrib4sARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD3IPROC m_next_glTexCoord3i = nullptr;
+void m_glTexCoord3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(1023,m_next_glTexCoord3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC m_next_glVertexAttribI3uiv = nullptr;
+void m_glVertexAttribI3uiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1024,m_next_glVertexAttribI3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC m_next_glPushDebugGroup = nullptr;
+void m_glPushDebugGroup_profile(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{return this->m_profile(1025,m_next_glPushDebugGroup,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORD3FPROC m_next_glTexCoord3f = nullptr;
+void m_glTexCoord3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1026,m_next_glTexCoord3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD3DPROC m_next_glTexCoord3d = nullptr;
+void m_glTexCoord3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1027,m_next_glTexCoord3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC m_next_glTexCoord2xOES = nullptr;
+void m_glTexCoord2xOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(1028,m_next_glTexCoord2xOES,a0,a1);}
+FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC m_next_glGetStageIndexNV = nullptr;
+GLushort m_glGetStageIndexNV_profile(GLenum a0)const{return this->m_profile(1029,m_next_glGetStageIndexNV,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC m_next_glProgramUniform4i64vNV = nullptr;
+void m_glProgramUniform4i64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{return this->m_profile(1030,m_next_glProgramUniform4i64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC m_next_glGetNamedBufferPointervEXT = nullptr;
+void m_glGetNamedBufferPointervEXT_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(1031,m_next_glGetNamedBufferPointervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC m_next_glTextureBarrierNV = nullptr;
+void m_glTextureBarrierNV_profile()const{return this->m_profile(1032,m_next_glTextureBarrierNV);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC m_next_glColor4ubVertex3fvSUN = nullptr;
+void m_glColor4ubVertex3fvSUN_profile(const GLubyte* a0,const GLfloat* a1)const{return this->m_profile(1033,m_next_glColor4ubVertex3fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC m_next_glGetCommandHeaderNV = nullptr;
+GLuint m_glGetCommandHeaderNV_profile(GLenum a0,GLuint a1)const{return this->m_profile(1034,m_next_glGetCommandHeaderNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC m_next_glGetPerfMonitorCounterInfoAMD = nullptr;
+void m_glGetPerfMonitorCounterInfoAMD_profile(GLuint a0,GLuint a1,GLenum a2,void* a3)const{return this->m_profile(1035,m_next_glGetPerfMonitorCounterInfoAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC m_next_glVertexAttrib1svARB = nullptr;
+void m_glVertexAttrib1svARB_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(1036,m_next_glVertexAttrib1svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC m_next_glCombinerParameteriNV = nullptr;
+void m_glCombinerParameteriNV_profile(GLenum a0,GLint a1)const{return this->m_profile(1037,m_next_glCombinerParameteriNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC m_next_glMatrixMultTransposefEXT = nullptr;
+void m_glMatrixMultTransposefEXT_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1038,m_next_glMatrixMultTransposefEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC m_next_glDetailTexFuncSGIS = nullptr;
+void m_glDetailTexFuncSGIS_profile(GLenum a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1039,m_next_glDetailTexFuncSGIS,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC m_next_glAreTexturesResident = nullptr;
+GLboolean m_glAreTexturesResident_profile(GLsizei a0,const GLuint* a1,GLboolean* a2)const{return this->m_profile(1040,m_next_glAreTexturesResident,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC m_next_glProgramUniform2d = nullptr;
+void m_glProgramUniform2d_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1041,m_next_glProgramUniform2d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC m_next_glGetConvolutionParameterfvEXT = nullptr;
+void m_glGetConvolutionParameterfvEXT_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1042,m_next_glGetConvolutionParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC m_next_glIndexPointerListIBM = nullptr;
+void m_glIndexPointerListIBM_profile(GLenum a0,GLint a1,const void** a2,GLint a3)const{return this->m_profile(1043,m_next_glIndexPointerListIBM,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC m_next_glVertexAttribI4iEXT = nullptr;
+void m_glVertexAttribI4iEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(1044,m_next_glVertexAttribI4iEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC m_next_glProgramUniform2f = nullptr;
+void m_glProgramUniform2f_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1045,m_next_glProgramUniform2f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC m_next_glRasterPos4sv = nullptr;
+void m_glRasterPos4sv_profile(const GLshort* a0)const{return this->m_profile(1046,m_next_glRasterPos4sv,a0);}
+FunctionTable::MEMBERPFNGLCOLOR4SPROC m_next_glColor4s = nullptr;
+void m_glColor4s_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1047,m_next_glColor4s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC m_next_glMulticastGetQueryObjectivNV = nullptr;
+void m_glMulticastGetQueryObjectivNV_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(1048,m_next_glMulticastGetQueryObjectivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC m_next_glColorFragmentOp3ATI = nullptr;
+void m_glColorFragmentOp3ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9,GLuint a10,GLuint a11,GLuint a12)const{return this->m_profile(1049,m_next_glColorFragmentOp3ATI,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC m_next_glResizeBuffersMESA = nullptr;
+void m_glResizeBuffersMESA_profile()const{return this->m_profile(1050,m_next_glResizeBuffersMESA);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC m_next_glGetMinmaxParameterfv = nullptr;
+void m_glGetMinmaxParameterfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1051,m_next_glGetMinmaxParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC m_next_glClientActiveTextureARB = nullptr;
+void m_glClientActiveTextureARB_profile(GLenum a0)const{return this->m_profile(1052,m_next_glClientActiveTextureARB,a0);}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC m_next_glBindVertexArray = nullptr;
+void m_glBindVertexArray_profile(GLuint a0)const{return this->m_profile(1053,m_next_glBindVertexArray,a0);}
+FunctionTable::MEMBERPFNGLCOLOR4BPROC m_next_glColor4b = nullptr;
+void m_glColor4b_profile(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{return this->m_profile(1054,m_next_glColor4b,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR4FPROC m_next_glColor4f = nullptr;
+void m_glColor4f_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1055,m_next_glColor4f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR4DPROC m_next_glColor4d = nullptr;
+void m_glColor4d_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1056,m_next_glColor4d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR4IPROC m_next_glColor4i = nullptr;
+void m_glColor4i_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1057,m_next_glColor4i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC m_next_glEdgeFlagFormatNV = nullptr;
+void m_glEdgeFlagFormatNV_profile(GLsizei a0)const{return this->m_profile(1058,m_next_glEdgeFlagFormatNV,a0);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC m_next_glNamedBufferSubData = nullptr;
+void m_glNamedBufferSubData_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{return this->m_profile(1059,m_next_glNamedBufferSubData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC m_next_glDrawElementsInstanced = nullptr;
+void m_glDrawElementsInstanced_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{return this->m_profile(1060,m_next_glDrawElementsInstanced,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC m_next_glGetMultiTexParameterIivEXT = nullptr;
+void m_glGetMultiTexParameterIivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(1061,m_next_glGetMultiTexParameterIivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEX2DVPROC m_next_glVertex2dv = nullptr;
+void m_glVertex2dv_profile(const GLdouble* a0)const{return this->m_profile(1062,m_next_glVertex2dv,a0);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC m_next_glDisableVertexArrayAttribEXT = nullptr;
+void m_glDisableVertexArrayAttribEXT_profile(GLuint a0,GLuint a1)const{return this->m_profile(1063,m_next_glDisableVertexArrayAttribEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC m_next_glObjectUnpurgeableAPPLE = nullptr;
+GLenum m_glObjectUnpurgeableAPPLE_profile(GLenum a0,GLuint a1,GLenum a2)const{return this->m_profile(1064,m_next_glObjectUnpurgeableAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC m_next_glVertexAttribs2dvNV = nullptr;
+void m_glVertexAttribs2dvNV_profile(GLuint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(1065,m_next_glVertexAttribs2dvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC m_next_glReplacementCodeuiTexCoord2fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(1066,m_next_glReplacementCodeuiTexCoord2fVertex3fSUN,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC m_next_glGetMapParameterfvNV = nullptr;
+void m_glGetMapParameterfvNV_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1067,m_next_glGetMapParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC m_next_glProgramUniform4ivEXT = nullptr;
+void m_glProgramUniform4ivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1068,m_next_glProgramUniform4ivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC m_next_glProgramUniform3ui64vNV = nullptr;
+void m_glProgramUniform3ui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{return this->m_profile(1069,m_next_glProgramUniform3ui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRECTFVPROC m_next_glRectfv = nullptr;
+void m_glRectfv_profile(const GLfloat* a0,const GLfloat* a1)const{return this->m_profile(1070,m_next_glRectfv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC m_next_glTexFilterFuncSGIS = nullptr;
+void m_glTexFilterFuncSGIS_profile(GLenum a0,GLenum a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(1071,m_next_glTexFilterFuncSGIS,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC m_next_glSpriteParameterfvSGIX = nullptr;
+void m_glSpriteParameterfvSGIX_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1072,m_next_glSpriteParameterfvSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC m_next_glCopyMultiTexImage1DEXT = nullptr;
+void m_glCopyMultiTexImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLint a7)const{return this->m_profile(1073,m_next_glCopyMultiTexImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC m_next_glGetVertexAttribIuivEXT = nullptr;
+void m_glGetVertexAttribIuivEXT_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(1074,m_next_glGetVertexAttribIuivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC m_next_glUniformMatrix2x4dv = nullptr;
+void m_glUniformMatrix2x4dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(1075,m_next_glUniformMatrix2x4dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC m_next_glGetProgramResourceLocationIndex = nullptr;
+GLint m_glGetProgramResourceLocationIndex_profile(GLuint a0,GLenum a1,const GLchar* a2)const{return this->m_profile(1076,m_next_glGetProgramResourceLocationIndex,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR3HNVPROC m_next_glColor3hNV = nullptr;
+void m_glColor3hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(1077,m_next_glColor3hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVIEWPORTPROC m_next_glViewport = nullptr;
+void m_glViewport_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1078,m_next_glViewport,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC m_next_glProgramNamedParameter4fNV = nullptr;
+void m_glProgramNamedParameter4fNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{return this->m_profile(1079,m_next_glProgramNamedParameter4fNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC m_next_glGetInvariantBooleanvEXT = nullptr;
+void m_glGetInvariantBooleanvEXT_profile(GLuint a0,GLenum a1,GLboolean* a2)const{return this->m_profile(1080,m_next_glGetInvariantBooleanvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC m_next_glTexStorage2DMultisample = nullptr;
+void m_glTexStorage2DMultisample_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{return this->m_profile(1081,m_next_glTexStorage2DMultisample,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPIXELSTOREXPROC m_next_glPixelStorex = nullptr;
+void m_glPixelStorex_profile(GLenum a0,GLfixed a1)const{return this->m_profile(1082,m_next_glPixelStorex,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC m_next_glVertexAttribL1dvEXT = nullptr;
+void m_glVertexAttribL1dvEXT_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(1083,m_next_glVertexAttribL1dvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC m_next_glGetActiveSubroutineUniformiv = nullptr;
+void m_glGetActiveSubroutineUniformiv_profile(GLuint a0,GLenum a1,GLuint a2,GLenum a3,GLint* a4)const{return this->m_profile(1084,m_next_glGetActiveSubroutineUniformiv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC m_next_glVertexAttribPointerARB = nullptr;
+void m_glVertexAttribPointerARB_profile(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,const void* a5)const{return this->m_profile(1085,m_next_glVertexAttribPointerARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC m_next_glCompressedTexSubImage2DARB = nullptr;
+void m_glCompressedTexSubImage2DARB_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const void* a8)const{return this->m_profile(1086,m_next_glCompressedTexSubImage2DARB,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC m_next_glTexStorageMem1DEXT = nullptr;
+void m_glTexStorageMem1DEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLuint a4,GLuint64 a5)const{return this->m_profile(1087,m_next_glTexStorageMem1DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC m_next_glVertex2hvNV = nullptr;
+void m_glVertex2hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1088,m_next_glVertex2hvNV,a0);}
+FunctionTable::MEMBERPFNGLTEXBUFFERPROC m_next_glTexBuffer = nullptr;
+void m_glTexBuffer_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(1089,m_next_glTexBuffer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLARRAYELEMENTPROC m_next_glArrayElement = nullptr;
+void m_glArrayElement_profile(GLint a0)const{return this->m_profile(1090,m_next_glArrayElement,a0);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC m_next_glValidateProgram = nullptr;
+void m_glValidateProgram_profile(GLuint a0)const{return this->m_profile(1091,m_next_glValidateProgram,a0);}
+FunctionTable::MEMBERPFNGLPIXELSTOREFPROC m_next_glPixelStoref = nullptr;
+void m_glPixelStoref_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1092,m_next_glPixelStoref,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC m_next_glWindowPos3dARB = nullptr;
+void m_glWindowPos3dARB_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1093,m_next_glWindowPos3dARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC m_next_glEvalCoord1dv = nullptr;
+void m_glEvalCoord1dv_profile(const GLdouble* a0)const{return this->m_profile(1094,m_next_glEvalCoord1dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC m_next_glVertexAttribs2fvNV = nullptr;
+void m_glVertexAttribs2fvNV_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1095,m_next_glVertexAttribs2fvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRECTIPROC m_next_glRecti = nullptr;
+void m_glRecti_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1096,m_next_glRecti,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3,const GLfloat* a4)const{return this->m_profile(1097,m_next_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC m_next_glTexCoord1bOES = nullptr;
+void m_glTexCoord1bOES_profile(GLbyte a0)const{return this->m_profile(1098,m_next_glTexCoord1bOES,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC m_next_glProgramUniform2i64vARB = nullptr;
+void m_glProgramUniform2i64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{return this->m_profile(1099,m_next_glProgramUniform2i64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC m_next_glWindowPos2dARB = nullptr;
+void m_glWindowPos2dARB_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(1100,m_next_glWindowPos2dARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC m_next_glGetProgramParameterdvNV = nullptr;
+void m_glGetProgramParameterdvNV_profile(GLenum a0,GLuint a1,GLenum a2,GLdouble* a3)const{return this->m_profile(1101,m_next_glGetProgramParameterdvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRECTFPROC m_next_glRectf = nullptr;
+void m_glRectf_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1102,m_next_glRectf,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRECTDPROC m_next_glRectd = nullptr;
+void m_glRectd_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1103,m_next_glRectd,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAP1XOESPROC m_next_glMap1xOES = nullptr;
+void m_glMap1xOES_profile(GLenum a0,GLfixed a1,GLfixed a2,GLint a3,GLint a4,GLfixed a5)const{return this->m_profile(1104,m_next_glMap1xOES,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC m_next_glVertexAttrib3fvNV = nullptr;
+void m_glVertexAttrib3fvNV_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(1105,m_next_glVertexAttrib3fvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC m_next_glReferencePlaneSGIX = nullptr;
+void m_glReferencePlaneSGIX_profile(const GLdouble* a0)const{return this->m_profile(1106,m_next_glReferencePlaneSGIX,a0);}
+FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC m_next_glMulticastBlitFramebufferNV = nullptr;
+void m_glMulticastBlitFramebufferNV_profile(GLuint a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLint a8,GLint a9,GLbitfield a10,GLenum a11)const{return this->m_profile(1107,m_next_glMulticastBlitFramebufferNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC m_next_glGetCombinerInputParameterfvNV = nullptr;
+void m_glGetCombinerInputParameterfvNV_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLfloat* a4)const{return this->m_profile(1108,m_next_glGetCombinerInputParameterfvNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC m_next_glGetTextureSamplerHandleARB = nullptr;
+GLuint64 m_glGetTextureSamplerHandleARB_profile(GLuint a0,GLuint a1)const{return this->m_profile(1109,m_next_glGetTextureSamplerHandleARB,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREPROC m_next_glBindTexture = nullptr;
+void m_glBindTexture_profile(GLenum a0,GLuint a1)const{return this->m_profile(1110,m_next_glBindTexture,a0,a1);}
+FunctionTable::MEMBERPFNGLRECTSPROC m_next_glRects = nullptr;
+void m_glRects_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1111,m_next_glRects,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC m_next_glGetActiveAttribARB = nullptr;
+void m_glGetActiveAttribARB_profile(GLhandleARB a0,GLuint a1,GLsizei a2,GLsizei* a3,GLint* a4,GLenum* a5,GLcharARB* a6)const{return this->m_profile(1112,m_next_glGetActiveAttribARB,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC m_next_glHistogramEXT = nullptr;
+void m_glHistogramEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLboolean a3)const{return this->m_profile(1113,m_next_glHistogramEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC m_next_glGetTextureSamplerHandleNV = nullptr;
+GLuint64 m_glGetTextureSamplerHandleNV_profile(GLuint a0,GLuint a1)const{return this->m_profile(1114,m_next_glGetTextureSamplerHandleNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDETACHSHADERPROC m_next_glDetachShader = nullptr;
+void m_glDetachShader_profile(GLuint a0,GLuint a1)const{return this->m_profile(1115,m_next_glDetachShader,a0,a1);}
+FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC m_next_glFinishTextureSUNX = nullptr;
+void m_glFinishTextureSUNX_profile()const{return this->m_profile(1116,m_next_glFinishTextureSUNX);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC m_next_glUniformMatrix3x4dv = nullptr;
+void m_glUniformMatrix3x4dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(1117,m_next_glUniformMatrix3x4dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC m_next_glVertexAttrib4fARB = nullptr;
+void m_glVertexAttrib4fARB_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(1118,m_next_glVertexAttrib4fARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC m_next_glGetPathColorGenivNV = nullptr;
+void m_glGetPathColorGenivNV_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1119,m_next_glGetPathColorGenivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC m_next_glGetProgramResourceLocation = nullptr;
+GLint m_glGetProgramResourceLocation_profile(GLuint a0,GLenum a1,const GLchar* a2)const{return this->m_profile(1120,m_next_glGetProgramResourceLocation,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC m_next_glVertexArrayAttribLFormat = nullptr;
+void m_glVertexArrayAttribLFormat_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{return this->m_profile(1121,m_next_glVertexArrayAttribLFormat,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC m_next_glGetTexLevelParameterfv = nullptr;
+void m_glGetTexLevelParameterfv_profile(GLenum a0,GLint a1,GLenum a2,GLfloat* a3)const{return this->m_profile(1122,m_next_glGetTexLevelParameterfv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC m_next_glVertexArrayVertexAttribOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribOffsetEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLboolean a5,GLsizei a6,GLintptr a7)const{return this->m_profile(1123,m_next_glVertexArrayVertexAttribOffsetEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC m_next_glIndexFormatNV = nullptr;
+void m_glIndexFormatNV_profile(GLenum a0,GLsizei a1)const{return this->m_profile(1124,m_next_glIndexFormatNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC m_next_glMultiTexCoord3i = nullptr;
+void m_glMultiTexCoord3i_profile(GLenum a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1125,m_next_glMultiTexCoord3i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC m_next_glReplacementCodeuiVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1)const{return this->m_profile(1126,m_next_glReplacementCodeuiVertex3fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC m_next_glViewportIndexedfv = nullptr;
+void m_glViewportIndexedfv_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(1127,m_next_glViewportIndexedfv,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC m_next_glBindBuffersBase = nullptr;
+void m_glBindBuffersBase_profile(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(1128,m_next_glBindBuffersBase,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC m_next_glTexBumpParameterfvATI = nullptr;
+void m_glTexBumpParameterfvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1129,m_next_glTexBumpParameterfvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC m_next_glMatrixIndexuivARB = nullptr;
+void m_glMatrixIndexuivARB_profile(GLint a0,const GLuint* a1)const{return this->m_profile(1130,m_next_glMatrixIndexuivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC m_next_glVertexAttrib1hNV = nullptr;
+void m_glVertexAttrib1hNV_profile(GLuint a0,GLhalfNV a1)const{return this->m_profile(1131,m_next_glVertexAttrib1hNV,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC m_next_glWindowPos3svMESA = nullptr;
+void m_glWindowPos3svMESA_profile(const GLshort* a0)const{return this->m_profile(1132,m_next_glWindowPos3svMESA,a0);}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC m_next_glStencilOpSeparateATI = nullptr;
+void m_glStencilOpSeparateATI_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(1133,m_next_glStencilOpSeparateATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC m_next_glDrawElementsBaseVertex = nullptr;
+void m_glDrawElementsBaseVertex_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLint a4)const{return this->m_profile(1134,m_next_glDrawElementsBaseVertex,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC m_next_glBlendEquationSeparateiARB = nullptr;
+void m_glBlendEquationSeparateiARB_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(1135,m_next_glBlendEquationSeparateiARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC m_next_glVertexAttrib1fNV = nullptr;
+void m_glVertexAttrib1fNV_profile(GLuint a0,GLfloat a1)const{return this->m_profile(1136,m_next_glVertexAttrib1fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC m_next_glMapVertexAttrib2fAPPLE = nullptr;
+void m_glMapVertexAttrib2fAPPLE_profile(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLint a4,GLint a5,GLfloat a6,GLfloat a7,GLint a8,GLint a9,const GLfloat* a10)const{return this->m_profile(1137,m_next_glMapVertexAttrib2fAPPLE,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC m_next_glCompressedTextureSubImage1DEXT = nullptr;
+void m_glCompressedTextureSubImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLsizei a6,const void* a7)const{return this->m_profile(1138,m_next_glCompressedTextureSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC m_next_glClearBufferSubData = nullptr;
+void m_glClearBufferSubData_profile(GLenum a0,GLenum a1,GLintptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(1139,m_next_glClearBufferSubData,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC m_next_glTexStorage1D = nullptr;
+void m_glTexStorage1D_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3)const{return this->m_profile(1140,m_next_glTexStorage1D,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC m_next_glVertexAttribI3iEXT = nullptr;
+void m_glVertexAttribI3iEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1141,m_next_glVertexAttribI3iEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC m_next_glMakeTextureHandleNonResidentARB = nullptr;
+void m_glMakeTextureHandleNonResidentARB_profile(GLuint64 a0)const{return this->m_profile(1142,m_next_glMakeTextureHandleNonResidentARB,a0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC m_next_glMultiDrawElementArrayAPPLE = nullptr;
+void m_glMultiDrawElementArrayAPPLE_profile(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{return this->m_profile(1143,m_next_glMultiDrawElementArrayAPPLE,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC m_next_glVertexStream4dATI = nullptr;
+void m_glVertexStream4dATI_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1144,m_next_glVertexStream4dATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC m_next_glProgramUniformMatrix2dvEXT = nullptr;
+void m_glProgramUniformMatrix2dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1145,m_next_glProgramUniformMatrix2dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC m_next_glVertexAttribs2hvNV = nullptr;
+void m_glVertexAttribs2hvNV_profile(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{return this->m_profile(1146,m_next_glVertexAttribs2hvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC m_next_glGetUniformiv = nullptr;
+void m_glGetUniformiv_profile(GLuint a0,GLint a1,GLint* a2)const{return this->m_profile(1147,m_next_glGetUniformiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC m_next_glClipPlanefOES = nullptr;
+void m_glClipPlanefOES_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1148,m_next_glClipPlanefOES,a0,a1);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC m_next_glRenderbufferStorage = nullptr;
+void m_glRenderbufferStorage_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1149,m_next_glRenderbufferStorage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIPROC m_next_glUniform4ui = nullptr;
+void m_glUniform4ui_profile(GLint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(1150,m_next_glUniform4ui,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC m_next_glBindFramebuffer = nullptr;
+void m_glBindFramebuffer_profile(GLenum a0,GLuint a1)const{return this->m_profile(1151,m_next_glBindFramebuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC m_next_glValidateProgramARB = nullptr;
+void m_glValidateProgramARB_profile(GLhandleARB a0)const{return this->m_profile(1152,m_next_glValidateProgramARB,a0);}
+FunctionTable::MEMBERPFNGLTEXGENFPROC m_next_glTexGenf = nullptr;
+void m_glTexGenf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(1153,m_next_glTexGenf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXGENDPROC m_next_glTexGend = nullptr;
+void m_glTexGend_profile(GLenum a0,GLenum a1,GLdouble a2)const{return this->m_profile(1154,m_next_glTexGend,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXGENIPROC m_next_glTexGeni = nullptr;
+void m_glTexGeni_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(1155,m_next_glTexGeni,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC m_next_glDeleteFramebuffersEXT = nullptr;
+void m_glDeleteFramebuffersEXT_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1156,m_next_glDeleteFramebuffersEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC m_next_glResetMinmaxEXT = nullptr;
+void m_glResetMinmaxEXT_profile(GLenum a0)const{return this->m_profile(1157,m_next_glResetMinmaxEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC m_next_glVertexAttrib1fvNV = nullptr;
+void m_glVertexAttrib1fvNV_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(1158,m_next_glVertexAttrib1fvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLISQUERYARBPROC m_next_glIsQueryARB = nullptr;
+GLboolean m_glIsQueryARB_profile(GLuint a0)const{return this->m_profile(1159,m_next_glIsQueryARB,a0);}
+FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC m_next_glEnableVariantClientStateEXT = nullptr;
+void m_glEnableVariantClientStateEXT_profile(GLuint a0)const{return this->m_profile(1160,m_next_glEnableVariantClientStateEXT,a0);}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC m_next_glScissorIndexed = nullptr;
+void m_glScissorIndexed_profile(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1161,m_next_glScissorIndexed,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC m_next_glGetInvariantIntegervEXT = nullptr;
+void m_glGetInvariantIntegervEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1162,m_next_glGetInvariantIntegervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC m_next_glProgramLocalParameterI4uiNV = nullptr;
+void m_glProgramLocalParameterI4uiNV_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(1163,m_next_glProgramLocalParameterI4uiNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC m_next_glConvolutionParameterxvOES = nullptr;
+void m_glConvolutionParameterxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(1164,m_next_glConvolutionParameterxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC m_next_glGenFramebuffersEXT = nullptr;
+void m_glGenFramebuffersEXT_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1165,m_next_glGenFramebuffersEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC m_next_glVertexArrayColorOffsetEXT = nullptr;
+void m_glVertexArrayColorOffsetEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{return this->m_profile(1166,m_next_glVertexArrayColorOffsetEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC m_next_glMultiTexCoord3ivARB = nullptr;
+void m_glMultiTexCoord3ivARB_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1167,m_next_glMultiTexCoord3ivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC m_next_glVertexWeightfEXT = nullptr;
+void m_glVertexWeightfEXT_profile(GLfloat a0)const{return this->m_profile(1168,m_next_glVertexWeightfEXT,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC m_next_glRasterPos4dv = nullptr;
+void m_glRasterPos4dv_profile(const GLdouble* a0)const{return this->m_profile(1169,m_next_glRasterPos4dv,a0);}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC m_next_glIsTextureHandleResidentARB = nullptr;
+GLboolean m_glIsTextureHandleResidentARB_profile(GLuint64 a0)const{return this->m_profile(1170,m_next_glIsTextureHandleResidentARB,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC m_next_glRasterPos2dv = nullptr;
+void m_glRasterPos2dv_profile(const GLdouble* a0)const{return this->m_profile(1171,m_next_glRasterPos2dv,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC m_next_glWindowPos4ivMESA = nullptr;
+void m_glWindowPos4ivMESA_profile(const GLint* a0)const{return this->m_profile(1172,m_next_glWindowPos4ivMESA,a0);}
+FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC m_next_glGetVariantPointervEXT = nullptr;
+void m_glGetVariantPointervEXT_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(1173,m_next_glGetVariantPointervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC m_next_glMapNamedBufferRangeEXT = nullptr;
+void* m_glMapNamedBufferRangeEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,GLbitfield a3)const{return this->m_profile(1174,m_next_glMapNamedBufferRangeEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC m_next_glGetnUniformui64vARB = nullptr;
+void m_glGetnUniformui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,GLuint64* a3)const{return this->m_profile(1175,m_next_glGetnUniformui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC m_next_glCreateShaderProgramv = nullptr;
+GLuint m_glCreateShaderProgramv_profile(GLenum a0,GLsizei a1,const GLchar*const* a2)const{return this->m_profile(1176,m_next_glCreateShaderProgramv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC m_next_glGetQueryObjectiv = nullptr;
+void m_glGetQueryObjectiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1177,m_next_glGetQueryObjectiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC m_next_glMaxShaderCompilerThreadsKHR = nullptr;
+void m_glMaxShaderCompilerThreadsKHR_profile(GLuint a0)const{return this->m_profile(1178,m_next_glMaxShaderCompilerThreadsKHR,a0);}
+FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC m_next_glPNTrianglesfATI = nullptr;
+void m_glPNTrianglesfATI_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1179,m_next_glPNTrianglesfATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC m_next_glGlobalAlphaFactorusSUN = nullptr;
+void m_glGlobalAlphaFactorusSUN_profile(GLushort a0)const{return this->m_profile(1180,m_next_glGlobalAlphaFactorusSUN,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC m_next_glVertexAttrib3dvNV = nullptr;
+void m_glVertexAttrib3dvNV_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(1181,m_next_glVertexAttrib3dvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC m_next_glMultiTexCoord3sARB = nullptr;
+void m_glMultiTexCoord3sARB_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1182,m_next_glMultiTexCoord3sARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC m_next_glGenerateMipmap = nullptr;
+void m_glGenerateMipmap_profile(GLenum a0)const{return this->m_profile(1183,m_next_glGenerateMipmap,a0);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC m_next_glCompressedTextureSubImage2D = nullptr;
+void m_glCompressedTextureSubImage2D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const void* a8)const{return this->m_profile(1184,m_next_glCompressedTextureSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_next_glNamedRenderbufferStorageMultisampleEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1185,m_next_glNamedRenderbufferStorageMultisampleEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC m_next_glPolygonOffsetClampEXT = nullptr;
+void m_glPolygonOffsetClampEXT_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1186,m_next_glPolygonOffsetClampEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC m_next_glTextureRangeAPPLE = nullptr;
+void m_glTextureRangeAPPLE_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(1187,m_next_glTextureRangeAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC m_next_glBlendEquationIndexedAMD = nullptr;
+void m_glBlendEquationIndexedAMD_profile(GLuint a0,GLenum a1)const{return this->m_profile(1188,m_next_glBlendEquationIndexedAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2DPROC m_next_glTexCoord2d = nullptr;
+void m_glTexCoord2d_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(1189,m_next_glTexCoord2d,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC m_next_glPointParameteri = nullptr;
+void m_glPointParameteri_profile(GLenum a0,GLint a1)const{return this->m_profile(1190,m_next_glPointParameteri,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FPROC m_next_glTexCoord2f = nullptr;
+void m_glTexCoord2f_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(1191,m_next_glTexCoord2f,a0,a1);}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC m_next_glGetUnsignedBytei_vEXT = nullptr;
+void m_glGetUnsignedBytei_vEXT_profile(GLenum a0,GLuint a1,GLubyte* a2)const{return this->m_profile(1192,m_next_glGetUnsignedBytei_vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4IVPROC m_next_glColor4iv = nullptr;
+void m_glColor4iv_profile(const GLint* a0)const{return this->m_profile(1193,m_next_glColor4iv,a0);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC m_next_glMapNamedBufferRange = nullptr;
+void* m_glMapNamedBufferRange_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,GLbitfield a3)const{return this->m_profile(1194,m_next_glMapNamedBufferRange,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC m_next_glUnmapBuffer = nullptr;
+GLboolean m_glUnmapBuffer_profile(GLenum a0)const{return this->m_profile(1195,m_next_glUnmapBuffer,a0);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC m_next_glSampleMaskEXT = nullptr;
+void m_glSampleMaskEXT_profile(GLclampf a0,GLboolean a1)const{return this->m_profile(1196,m_next_glSampleMaskEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2IPROC m_next_glTexCoord2i = nullptr;
+void m_glTexCoord2i_profile(GLint a0,GLint a1)const{return this->m_profile(1197,m_next_glTexCoord2i,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC m_next_glTexCoord1xvOES = nullptr;
+void m_glTexCoord1xvOES_profile(const GLfixed* a0)const{return this->m_profile(1198,m_next_glTexCoord1xvOES,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC m_next_glVertexAttrib1sARB = nullptr;
+void m_glVertexAttrib1sARB_profile(GLuint a0,GLshort a1)const{return this->m_profile(1199,m_next_glVertexAttrib1sARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC m_next_glGetVertexArrayiv = nullptr;
+void m_glGetVertexArrayiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1200,m_next_glGetVertexArrayiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC m_next_glProgramParameter4dvNV = nullptr;
+void m_glProgramParameter4dvNV_profile(GLenum a0,GLuint a1,const GLdouble* a2)const{return this->m_profile(1201,m_next_glProgramParameter4dvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2SPROC m_next_glTexCoord2s = nullptr;
+void m_glTexCoord2s_profile(GLshort a0,GLshort a1)const{return this->m_profile(1202,m_next_glTexCoord2s,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC m_next_glTextureParameterIuivEXT = nullptr;
+void m_glTextureParameterIuivEXT_profile(GLuint a0,GLenum a1,GLenum a2,const GLuint* a3)const{return this->m_profile(1203,m_next_glTextureParameterIuivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC m_next_glGetColorTableParameterfvSGI = nullptr;
+void m_glGetColorTableParameterfvSGI_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1204,m_next_glGetColorTableParameterfvSGI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC m_next_glTexCoord4dv = nullptr;
+void m_glTexCoord4dv_profile(const GLdouble* a0)const{return this->m_profile(1205,m_next_glTexCoord4dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC m_next_glVertexAttrib1svNV = nullptr;
+void m_glVertexAttrib1svNV_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(1206,m_next_glVertexAttrib1svNV,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC m_next_glNamedFramebufferTextureFaceEXT = nullptr;
+void m_glNamedFramebufferTextureFaceEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{return this->m_profile(1207,m_next_glNamedFramebufferTextureFaceEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC m_next_glProgramUniform2ui64vNV = nullptr;
+void m_glProgramUniform2ui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{return this->m_profile(1208,m_next_glProgramUniform2ui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC m_next_glStencilFillPathNV = nullptr;
+void m_glStencilFillPathNV_profile(GLuint a0,GLenum a1,GLuint a2)const{return this->m_profile(1209,m_next_glStencilFillPathNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMAL3DVPROC m_next_glNormal3dv = nullptr;
+void m_glNormal3dv_profile(const GLdouble* a0)const{return this->m_profile(1210,m_next_glNormal3dv,a0);}
+FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC m_next_glReleaseShaderCompiler = nullptr;
+void m_glReleaseShaderCompiler_profile()const{return this->m_profile(1211,m_next_glReleaseShaderCompiler);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC m_next_glTexStorageMem3DEXT = nullptr;
+void m_glTexStorageMem3DEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLuint a6,GLuint64 a7)const{return this->m_profile(1212,m_next_glTexStorageMem3DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC m_next_glTexCoord3bvOES = nullptr;
+void m_glTexCoord3bvOES_profile(const GLbyte* a0)const{return this->m_profile(1213,m_next_glTexCoord3bvOES,a0);}
+FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC m_next_glIsVertexAttribEnabledAPPLE = nullptr;
+GLboolean m_glIsVertexAttribEnabledAPPLE_profile(GLuint a0,GLenum a1)const{return this->m_profile(1214,m_next_glIsVertexAttribEnabledAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC m_next_glTexCoord1dv = nullptr;
+void m_glTexCoord1dv_profile(const GLdouble* a0)const{return this->m_profile(1215,m_next_glTexCoord1dv,a0);}
+FunctionTable::MEMBERPFNGLREADPIXELSPROC m_next_glReadPixels = nullptr;
+void m_glReadPixels_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,GLvoid* a6)const{return this->m_profile(1216,m_next_glReadPixels,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC m_next_glVertexAttribI3iv = nullptr;
+void m_glVertexAttribI3iv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(1217,m_next_glVertexAttribI3iv,a0,a1);}
+FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC m_next_glSetFenceAPPLE = nullptr;
+void m_glSetFenceAPPLE_profile(GLuint a0)const{return this->m_profile(1218,m_next_glSetFenceAPPLE,a0);}
+FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC m_next_glWeightsvARB = nullptr;
+void m_glWeightsvARB_profile(GLint a0,const GLshort* a1)const{return this->m_profile(1219,m_next_glWeightsvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSHADEMODELPROC m_next_glShadeModel = nullptr;
+void m_glShadeModel_profile(GLenum a0)const{return this->m_profile(1220,m_next_glShadeModel,a0);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC m_next_glTextureStorageMem3DMultisampleEXT = nullptr;
+void m_glTextureStorageMem3DMultisampleEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6,GLuint a7,GLuint64 a8)const{return this->m_profile(1221,m_next_glTextureStorageMem3DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLMAPGRID1DPROC m_next_glMapGrid1d = nullptr;
+void m_glMapGrid1d_profile(GLint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1222,m_next_glMapGrid1d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC m_next_glGetHistogramParameterivEXT = nullptr;
+void m_glGetHistogramParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1223,m_next_glGetHistogramParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC m_next_glConservativeRasterParameteriNV = nullptr;
+void m_glConservativeRasterParameteriNV_profile(GLenum a0,GLint a1)const{return this->m_profile(1224,m_next_glConservativeRasterParameteriNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC m_next_glClearNamedBufferData = nullptr;
+void m_glClearNamedBufferData_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{return this->m_profile(1225,m_next_glClearNamedBufferData,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC m_next_glClearDepthf = nullptr;
+void m_glClearDepthf_profile(GLfloat a0)const{return this->m_profile(1226,m_next_glClearDepthf,a0);}
+FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC m_next_glCreatePerfQueryINTEL = nullptr;
+void m_glCreatePerfQueryINTEL_profile(GLuint a0,GLuint* a1)const{return this->m_profile(1227,m_next_glCreatePerfQueryINTEL,a0,a1);}
+FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC m_next_glFogCoordfEXT = nullptr;
+void m_glFogCoordfEXT_profile(GLfloat a0)const{return this->m_profile(1228,m_next_glFogCoordfEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC m_next_glVertexAttrib2dARB = nullptr;
+void m_glVertexAttrib2dARB_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1229,m_next_glVertexAttrib2dARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC m_next_glMultiTexCoord4dARB = nullptr;
+void m_glMultiTexCoord4dARB_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1230,m_next_glMultiTexCoord4dARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC m_next_glReadnPixelsARB = nullptr;
+void m_glReadnPixelsARB_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,GLsizei a6,void* a7)const{return this->m_profile(1231,m_next_glReadnPixelsARB,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC m_next_glMultiTexBufferEXT = nullptr;
+void m_glMultiTexBufferEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(1232,m_next_glMultiTexBufferEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC m_next_glWindowPos4dvMESA = nullptr;
+void m_glWindowPos4dvMESA_profile(const GLdouble* a0)const{return this->m_profile(1233,m_next_glWindowPos4dvMESA,a0);}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC m_next_glInvalidateNamedFramebufferData = nullptr;
+void m_glInvalidateNamedFramebufferData_profile(GLuint a0,GLsizei a1,const GLenum* a2)const{return this->m_profile(1234,m_next_glInvalidateNamedFramebufferData,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC m_next_glSecondaryColorPointerListIBM = nullptr;
+void m_glSecondaryColorPointerListIBM_profile(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{return this->m_profile(1235,m_next_glSecondaryColorPointerListIBM,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLRECTIVPROC m_next_glRectiv = nullptr;
+void m_glRectiv_profile(const GLint* a0,const GLint* a1)const{return this->m_profile(1236,m_next_glRectiv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORP4UIPROC m_next_glColorP4ui = nullptr;
+void m_glColorP4ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(1237,m_next_glColorP4ui,a0,a1);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC m_next_glUseProgramStages = nullptr;
+void m_glUseProgramStages_profile(GLuint a0,GLbitfield a1,GLuint a2)const{return this->m_profile(1238,m_next_glUseProgramStages,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC m_next_glRasterPos3dv = nullptr;
+void m_glRasterPos3dv_profile(const GLdouble* a0)const{return this->m_profile(1239,m_next_glRasterPos3dv,a0);}
+FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC m_next_glPathTexGenNV = nullptr;
+void m_glPathTexGenNV_profile(GLenum a0,GLenum a1,GLint a2,const GLfloat* a3)const{return this->m_profile(1240,m_next_glPathTexGenNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC m_next_glVertexBlendEnviATI = nullptr;
+void m_glVertexBlendEnviATI_profile(GLenum a0,GLint a1)const{return this->m_profile(1241,m_next_glVertexBlendEnviATI,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC m_next_glUniform3i64ARB = nullptr;
+void m_glUniform3i64ARB_profile(GLint a0,GLint64 a1,GLint64 a2,GLint64 a3)const{return this->m_profile(1242,m_next_glUniform3i64ARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLOADMATRIXFPROC m_next_glLoadMatrixf = nullptr;
+void m_glLoadMatrixf_profile(const GLfloat* a0)const{return this->m_profile(1243,m_next_glLoadMatrixf,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC m_next_glProgramUniform2dEXT = nullptr;
+void m_glProgramUniform2dEXT_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1244,m_next_glProgramUniform2dEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC m_next_glVertexAttribI4iv = nullptr;
+void m_glVertexAttribI4iv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(1245,m_next_glVertexAttribI4iv,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC m_next_glNamedFramebufferDrawBuffer = nullptr;
+void m_glNamedFramebufferDrawBuffer_profile(GLuint a0,GLenum a1)const{return this->m_profile(1246,m_next_glNamedFramebufferDrawBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVPROC m_next_glColor4ubv = nullptr;
+void m_glColor4ubv_profile(const GLubyte* a0)const{return this->m_profile(1247,m_next_glColor4ubv,a0);}
+FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC m_next_glColor3hvNV = nullptr;
+void m_glColor3hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1248,m_next_glColor3hvNV,a0);}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC m_next_glGetMapAttribParameterfvNV = nullptr;
+void m_glGetMapAttribParameterfvNV_profile(GLenum a0,GLuint a1,GLenum a2,GLfloat* a3)const{return this->m_profile(1249,m_next_glGetMapAttribParameterfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC m_next_glGetBufferSubData = nullptr;
+void m_glGetBufferSubData_profile(GLenum a0,GLintptr a1,GLsizeiptr a2,void* a3)const{return this->m_profile(1250,m_next_glGetBufferSubData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC m_next_glGetVertexAttribLdv = nullptr;
+void m_glGetVertexAttribLdv_profile(GLuint a0,GLenum a1,GLdouble* a2)const{return this->m_profile(1251,m_next_glGetVertexAttribLdv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC m_next_glGetnUniformuiv = nullptr;
+void m_glGetnUniformuiv_profile(GLuint a0,GLint a1,GLsizei a2,GLuint* a3)const{return this->m_profile(1252,m_next_glGetnUniformuiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC m_next_glGetUniformui64vNV = nullptr;
+void m_glGetUniformui64vNV_profile(GLuint a0,GLint a1,GLuint64EXT* a2)const{return this->m_profile(1253,m_next_glGetUniformui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC m_next_glNamedRenderbufferStorageEXT = nullptr;
+void m_glNamedRenderbufferStorageEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1254,m_next_glNamedRenderbufferStorageEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC m_next_glVertexAttrib3dNV = nullptr;
+void m_glVertexAttrib3dNV_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1255,m_next_glVertexAttrib3dNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC m_next_glTextureStorage1DEXT = nullptr;
+void m_glTextureStorage1DEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4)const{return this->m_profile(1256,m_next_glTextureStorage1DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC m_next_glPixelTexGenParameteriSGIS = nullptr;
+void m_glPixelTexGenParameteriSGIS_profile(GLenum a0,GLint a1)const{return this->m_profile(1257,m_next_glPixelTexGenParameteriSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC m_next_glColorTableEXT = nullptr;
+void m_glColorTableEXT_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{return this->m_profile(1258,m_next_glColorTableEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGENBUFFERSPROC m_next_glGenBuffers = nullptr;
+void m_glGenBuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1259,m_next_glGenBuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC m_next_glMultiTexCoord3xvOES = nullptr;
+void m_glMultiTexCoord3xvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(1260,m_next_glMultiTexCoord3xvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC m_next_glExecuteProgramNV = nullptr;
+void m_glExecuteProgramNV_profile(GLenum a0,GLuint a1,const GLfloat* a2)const{return this->m_profile(1261,m_next_glExecuteProgramNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC m_next_glVariantArrayObjectATI = nullptr;
+void m_glVariantArrayObjectATI_profile(GLuint a0,GLenum a1,GLsizei a2,GLuint a3,GLuint a4)const{return this->m_profile(1262,m_next_glVariantArrayObjectATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC m_next_glColor3xvOES = nullptr;
+void m_glColor3xvOES_profile(const GLfixed* a0)const{return this->m_profile(1263,m_next_glColor3xvOES,a0);}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC m_next_glGetnConvolutionFilterARB = nullptr;
+void m_glGetnConvolutionFilterARB_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4)const{return this->m_profile(1264,m_next_glGetnConvolutionFilterARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC m_next_glNormalFormatNV = nullptr;
+void m_glNormalFormatNV_profile(GLenum a0,GLsizei a1)const{return this->m_profile(1265,m_next_glNormalFormatNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC m_next_glGetInvariantFloatvEXT = nullptr;
+void m_glGetInvariantFloatvEXT_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1266,m_next_glGetInvariantFloatvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC m_next_glClearNamedFramebufferiv = nullptr;
+void m_glClearNamedFramebufferiv_profile(GLuint a0,GLenum a1,GLint a2,const GLint* a3)const{return this->m_profile(1267,m_next_glClearNamedFramebufferiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC m_next_glTexImage3D = nullptr;
+void m_glTexImage3D_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const GLvoid* a9)const{return this->m_profile(1268,m_next_glTexImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLGENSAMPLERSPROC m_next_glGenSamplers = nullptr;
+void m_glGenSamplers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1269,m_next_glGenSamplers,a0,a1);}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC m_next_glIsFramebuffer = nullptr;
+GLboolean m_glIsFramebuffer_profile(GLuint a0)const{return this->m_profile(1270,m_next_glIsFramebuffer,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC m_next_glProgramUniform3dvEXT = nullptr;
+void m_glProgramUniform3dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(1271,m_next_glProgramUniform3dvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC m_next_glGetVertexAttribfvNV = nullptr;
+void m_glGetVertexAttribfvNV_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1272,m_next_glGetVertexAttribfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC m_next_glDrawRangeElementArrayAPPLE = nullptr;
+void m_glDrawRangeElementArrayAPPLE_profile(GLenum a0,GLuint a1,GLuint a2,GLint a3,GLsizei a4)const{return this->m_profile(1273,m_next_glDrawRangeElementArrayAPPLE,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC m_next_glUniform3i64NV = nullptr;
+void m_glUniform3i64NV_profile(GLint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3)const{return this->m_profile(1274,m_next_glUniform3i64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC m_next_glMatrixPopEXT = nullptr;
+void m_glMatrixPopEXT_profile(GLenum a0)const{return this->m_profile(1275,m_next_glMatrixPopEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC m_next_glVertexStream1sATI = nullptr;
+void m_glVertexStream1sATI_profile(GLenum a0,GLshort a1)const{return this->m_profile(1276,m_next_glVertexStream1sATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC m_next_glGetnPixelMapuivARB = nullptr;
+void m_glGetnPixelMapuivARB_profile(GLenum a0,GLsizei a1,GLuint* a2)const{return this->m_profile(1277,m_next_glGetnPixelMapuivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC m_next_glMultiTexEnviEXT = nullptr;
+void m_glMultiTexEnviEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{return this->m_profile(1278,m_next_glMultiTexEnviEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC m_next_glVertexAttribI2iEXT = nullptr;
+void m_glVertexAttribI2iEXT_profile(GLuint a0,GLint a1,GLint a2)const{return this->m_profile(1279,m_next_glVertexAttribI2iEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC m_next_glProgramParameter4fvNV = nullptr;
+void m_glProgramParameter4fvNV_profile(GLenum a0,GLuint a1,const GLfloat* a2)const{return this->m_profile(1280,m_next_glProgramParameter4fvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC m_next_glWaitSemaphoreEXT = nullptr;
+void m_glWaitSemaphoreEXT_profile(GLuint a0,GLuint a1,const GLuint* a2,GLuint a3,const GLuint* a4,const GLenum* a5)const{return this->m_profile(1281,m_next_glWaitSemaphoreEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_next_glNamedFramebufferSampleLocationsfvNV = nullptr;
+void m_glNamedFramebufferSampleLocationsfvNV_profile(GLuint a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(1282,m_next_glNamedFramebufferSampleLocationsfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC m_next_glTexCoordP4uiv = nullptr;
+void m_glTexCoordP4uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(1283,m_next_glTexCoordP4uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLRECTXVOESPROC m_next_glRectxvOES = nullptr;
+void m_glRectxvOES_profile(const GLfixed* a0,const GLfixed* a1)const{return this->m_profile(1284,m_next_glRectxvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC m_next_glGetVariantIntegervEXT = nullptr;
+void m_glGetVariantIntegervEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1285,m_next_glGetVariantIntegervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETELISTSPROC m_next_glDeleteLists = nullptr;
+void m_glDeleteLists_profile(GLuint a0,GLsizei a1)const{return this->m_profile(1286,m_next_glDeleteLists,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXGENDVPROC m_next_glTexGendv = nullptr;
+void m_glTexGendv_profile(GLenum a0,GLenum a1,const GLdouble* a2)const{return this->m_profile(1287,m_next_glTexGendv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC m_next_glVertexP2uiv = nullptr;
+void m_glVertexP2uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(1288,m_next_glVertexP2uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC m_next_glGetPerfMonitorGroupsAMD = nullptr;
+void m_glGetPerfMonitorGroupsAMD_profile(GLint* a0,GLsizei a1,GLuint* a2)const{return this->m_profile(1289,m_next_glGetPerfMonitorGroupsAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC m_next_glMultTransposeMatrixfARB = nullptr;
+void m_glMultTransposeMatrixfARB_profile(const GLfloat* a0)const{return this->m_profile(1290,m_next_glMultTransposeMatrixfARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC m_next_glVertexAttribI2ivEXT = nullptr;
+void m_glVertexAttribI2ivEXT_profile(GLuint a0,const GLint* a1)const{return this->m_profile(1291,m_next_glVertexAttribI2ivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC m_next_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{return this->m_profile(1292,m_next_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETESTATESNVPROC m_next_glDeleteStatesNV = nullptr;
+void m_glDeleteStatesNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1293,m_next_glDeleteStatesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC m_next_glGetBufferParameteri64v = nullptr;
+void m_glGetBufferParameteri64v_profile(GLenum a0,GLenum a1,GLint64* a2)const{return this->m_profile(1294,m_next_glGetBufferParameteri64v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC m_next_glProgramUniform4dv = nullptr;
+void m_glProgramUniform4dv_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(1295,m_next_glProgramUniform4dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC m_next_glEdgeFlagPointerEXT = nullptr;
+void m_glEdgeFlagPointerEXT_profile(GLsizei a0,GLsizei a1,const GLboolean* a2)const{return this->m_profile(1296,m_next_glEdgeFlagPointerEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC m_next_glVideoCaptureStreamParameterivNV = nullptr;
+void m_glVideoCaptureStreamParameterivNV_profile(GLuint a0,GLuint a1,GLenum a2,const GLint* a3)const{return this->m_profile(1297,m_next_glVideoCaptureStreamParameterivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC m_next_glVertexStream4iATI = nullptr;
+void m_glVertexStream4iATI_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(1298,m_next_glVertexStream4iATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVDPAUFININVPROC m_next_glVDPAUFiniNV = nullptr;
+void m_glVDPAUFiniNV_profile()const{return this->m_profile(1299,m_next_glVDPAUFiniNV);}
+FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC m_next_glMakeBufferNonResidentNV = nullptr;
+void m_glMakeBufferNonResidentNV_profile(GLenum a0)const{return this->m_profile(1300,m_next_glMakeBufferNonResidentNV,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC m_next_glUniform1ui64ARB = nullptr;
+void m_glUniform1ui64ARB_profile(GLint a0,GLuint64 a1)const{return this->m_profile(1301,m_next_glUniform1ui64ARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC m_next_glStencilStrokePathNV = nullptr;
+void m_glStencilStrokePathNV_profile(GLuint a0,GLint a1,GLuint a2)const{return this->m_profile(1302,m_next_glStencilStrokePathNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC m_next_glVariantuivEXT = nullptr;
+void m_glVariantuivEXT_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1303,m_next_glVariantuivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC m_next_glCopyTexSubImage3DEXT = nullptr;
+void m_glCopyTexSubImage3DEXT_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{return this->m_profile(1304,m_next_glCopyTexSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC m_next_glSpriteParameteriSGIX = nullptr;
+void m_glSpriteParameteriSGIX_profile(GLenum a0,GLint a1)const{return this->m_profile(1305,m_next_glSpriteParameteriSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC m_next_glMultiTexCoord1sARB = nullptr;
+void m_glMultiTexCoord1sARB_profile(GLenum a0,GLshort a1)const{return this->m_profile(1306,m_next_glMultiTexCoord1sARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC m_next_glConvolutionParameterfv = nullptr;
+void m_glConvolutionParameterfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1307,m_next_glConvolutionParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC m_next_glMakeTextureHandleResidentNV = nullptr;
+void m_glMakeTextureHandleResidentNV_profile(GLuint64 a0)const{return this->m_profile(1308,m_next_glMakeTextureHandleResidentNV,a0);}
+FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC m_next_glMultMatrixxOES = nullptr;
+void m_glMultMatrixxOES_profile(const GLfixed* a0)const{return this->m_profile(1309,m_next_glMultMatrixxOES,a0);}
+FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC m_next_glTextureNormalEXT = nullptr;
+void m_glTextureNormalEXT_profile(GLenum a0)const{return this->m_profile(1310,m_next_glTextureNormalEXT,a0);}
+FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC m_next_glGetQueryivARB = nullptr;
+void m_glGetQueryivARB_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1311,m_next_glGetQueryivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC m_next_glCompressedMultiTexImage3DEXT = nullptr;
+void m_glCompressedMultiTexImage3DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLsizei a8,const void* a9)const{return this->m_profile(1312,m_next_glCompressedMultiTexImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC m_next_glGetInstrumentsSGIX = nullptr;
+GLint m_glGetInstrumentsSGIX_profile()const{return this->m_profile(1313,m_next_glGetInstrumentsSGIX);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC m_next_glProgramUniformMatrix4x3fvEXT = nullptr;
+void m_glProgramUniformMatrix4x3fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1314,m_next_glProgramUniformMatrix4x3fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC m_next_glPointParameterf = nullptr;
+void m_glPointParameterf_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1315,m_next_glPointParameterf,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC m_next_glProgramUniform3dEXT = nullptr;
+void m_glProgramUniform3dEXT_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1316,m_next_glProgramUniform3dEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC m_next_glMultiTexCoord2hNV = nullptr;
+void m_glMultiTexCoord2hNV_profile(GLenum a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(1317,m_next_glMultiTexCoord2hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC m_next_glGetConvolutionFilterEXT = nullptr;
+void m_glGetConvolutionFilterEXT_profile(GLenum a0,GLenum a1,GLenum a2,void* a3)const{return this->m_profile(1318,m_next_glGetConvolutionFilterEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC m_next_glVertexAttrib2hNV = nullptr;
+void m_glVertexAttrib2hNV_profile(GLuint a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(1319,m_next_glVertexAttrib2hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC m_next_glCurrentPaletteMatrixARB = nullptr;
+void m_glCurrentPaletteMatrixARB_profile(GLint a0)const{return this->m_profile(1320,m_next_glCurrentPaletteMatrixARB,a0);}
+FunctionTable::MEMBERPFNGLFOGXVOESPROC m_next_glFogxvOES = nullptr;
+void m_glFogxvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(1321,m_next_glFogxvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC m_next_glCreateRenderbuffers = nullptr;
+void m_glCreateRenderbuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1322,m_next_glCreateRenderbuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC m_next_glVertexAttrib4Nusv = nullptr;
+void m_glVertexAttrib4Nusv_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(1323,m_next_glVertexAttrib4Nusv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC m_next_glCombinerInputNV = nullptr;
+void m_glCombinerInputNV_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{return this->m_profile(1324,m_next_glCombinerInputNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLDEPTHFUNCPROC m_next_glDepthFunc = nullptr;
+void m_glDepthFunc_profile(GLenum a0)const{return this->m_profile(1325,m_next_glDepthFunc,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC m_next_glWindowPos4fMESA = nullptr;
+void m_glWindowPos4fMESA_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1326,m_next_glWindowPos4fMESA,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC m_next_glEnableClientStateIndexedEXT = nullptr;
+void m_glEnableClientStateIndexedEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(1327,m_next_glEnableClientStateIndexedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC m_next_glTexCoord4iv = nullptr;
+void m_glTexCoord4iv_profile(const GLint* a0)const{return this->m_profile(1328,m_next_glTexCoord4iv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC m_next_glProgramUniform4i64ARB = nullptr;
+void m_glProgramUniform4i64ARB_profile(GLuint a0,GLint a1,GLint64 a2,GLint64 a3,GLint64 a4,GLint64 a5)const{return this->m_profile(1329,m_next_glProgramUniform4i64ARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBLENDFUNCIPROC m_next_glBlendFunci = nullptr;
+void m_glBlendFunci_profile(GLuint a0,GLenum a1,GLenum a2)const{return this->m_profile(1330,m_next_glBlendFunci,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC m_next_glResolveDepthValuesNV = nullptr;
+void m_glResolveDepthValuesNV_profile()const{return this->m_profile(1331,m_next_glResolveDepthValuesNV);}
+FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC m_next_glTextureColorMaskSGIS = nullptr;
+void m_glTextureColorMaskSGIS_profile(GLboolean a0,GLboolean a1,GLboolean a2,GLboolean a3)const{return this->m_profile(1332,m_next_glTextureColorMaskSGIS,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC m_next_glCreateShaderProgramEXT = nullptr;
+GLuint m_glCreateShaderProgramEXT_profile(GLenum a0,const GLchar* a1)const{return this->m_profile(1333,m_next_glCreateShaderProgramEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC m_next_glBufferStorage = nullptr;
+void m_glBufferStorage_profile(GLenum a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{return this->m_profile(1334,m_next_glBufferStorage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC m_next_glMakeNamedBufferNonResidentNV = nullptr;
+void m_glMakeNamedBufferNonResidentNV_profile(GLuint a0)const{return this->m_profile(1335,m_next_glMakeNamedBufferNonResidentNV,a0);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_next_glRenderbufferStorageMultisampleEXT = nullptr;
+void m_glRenderbufferStorageMultisampleEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1336,m_next_glRenderbufferStorageMultisampleEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETFLOATI_VPROC m_next_glGetFloati_v = nullptr;
+void m_glGetFloati_v_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(1337,m_next_glGetFloati_v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC m_next_glUniform2ui64ARB = nullptr;
+void m_glUniform2ui64ARB_profile(GLint a0,GLuint64 a1,GLuint64 a2)const{return this->m_profile(1338,m_next_glUniform2ui64ARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX3FVPROC m_next_glVertex3fv = nullptr;
+void m_glVertex3fv_profile(const GLfloat* a0)const{return this->m_profile(1339,m_next_glVertex3fv,a0);}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC m_next_glGetUniformLocation = nullptr;
+GLint m_glGetUniformLocation_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(1340,m_next_glGetUniformLocation,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC m_next_glVertexStream1svATI = nullptr;
+void m_glVertexStream1svATI_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(1341,m_next_glVertexStream1svATI,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC m_next_glVertexStream3fATI = nullptr;
+void m_glVertexStream3fATI_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1342,m_next_glVertexStream3fATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC m_next_glNamedFramebufferDrawBuffers = nullptr;
+void m_glNamedFramebufferDrawBuffers_profile(GLuint a0,GLsizei a1,const GLenum* a2)const{return this->m_profile(1343,m_next_glNamedFramebufferDrawBuffers,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC m_next_glUniform2ui64vNV = nullptr;
+void m_glUniform2ui64vNV_profile(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{return this->m_profile(1344,m_next_glUniform2ui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC m_next_glTexCoordPointervINTEL = nullptr;
+void m_glTexCoordPointervINTEL_profile(GLint a0,GLenum a1,const void** a2)const{return this->m_profile(1345,m_next_glTexCoordPointervINTEL,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4FVPROC m_next_glUniform4fv = nullptr;
+void m_glUniform4fv_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1346,m_next_glUniform4fv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC m_next_glNormalPointerEXT = nullptr;
+void m_glNormalPointerEXT_profile(GLenum a0,GLsizei a1,GLsizei a2,const void* a3)const{return this->m_profile(1347,m_next_glNormalPointerEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC m_next_glVertexAttrib4hNV = nullptr;
+void m_glVertexAttrib4hNV_profile(GLuint a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3,GLhalfNV a4)const{return this->m_profile(1348,m_next_glVertexAttrib4hNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNORMAL3FPROC m_next_glNormal3f = nullptr;
+void m_glNormal3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1349,m_next_glNormal3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC m_next_glVertexStream2iATI = nullptr;
+void m_glVertexStream2iATI_profile(GLenum a0,GLint a1,GLint a2)const{return this->m_profile(1350,m_next_glVertexStream2iATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC m_next_glVertexAttribP4uiv = nullptr;
+void m_glVertexAttribP4uiv_profile(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{return this->m_profile(1351,m_next_glVertexAttribP4uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC m_next_glCompressedTextureSubImage3D = nullptr;
+void m_glCompressedTextureSubImage3D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const void* a10)const{return this->m_profile(1352,m_next_glCompressedTextureSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC m_next_glAsyncMarkerSGIX = nullptr;
+void m_glAsyncMarkerSGIX_profile(GLuint a0)const{return this->m_profile(1353,m_next_glAsyncMarkerSGIX,a0);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC m_next_glTextureStorageSparseAMD = nullptr;
+void m_glTextureStorageSparseAMD_profile(GLuint a0,GLenum a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLsizei a6,GLbitfield a7)const{return this->m_profile(1354,m_next_glTextureStorageSparseAMD,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC m_next_glGetConvolutionParameterivEXT = nullptr;
+void m_glGetConvolutionParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1355,m_next_glGetConvolutionParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC m_next_glEndPerfQueryINTEL = nullptr;
+void m_glEndPerfQueryINTEL_profile(GLuint a0)const{return this->m_profile(1356,m_next_glEndPerfQueryINTEL,a0);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC m_next_glFragmentLightModeliSGIX = nullptr;
+void m_glFragmentLightModeliSGIX_profile(GLenum a0,GLint a1)const{return this->m_profile(1357,m_next_glFragmentLightModeliSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC m_next_glPrioritizeTexturesEXT = nullptr;
+void m_glPrioritizeTexturesEXT_profile(GLsizei a0,const GLuint* a1,const GLclampf* a2)const{return this->m_profile(1358,m_next_glPrioritizeTexturesEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC m_next_glEndConditionalRender = nullptr;
+void m_glEndConditionalRender_profile()const{return this->m_profile(1359,m_next_glEndConditionalRender);}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC m_next_glEnableClientState = nullptr;
+void m_glEnableClientState_profile(GLenum a0)const{return this->m_profile(1360,m_next_glEnableClientState,a0);}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC m_next_glResetHistogram = nullptr;
+void m_glResetHistogram_profile(GLenum a0)const{return this->m_profile(1361,m_next_glResetHistogram,a0);}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC m_next_glGetOcclusionQueryivNV = nullptr;
+void m_glGetOcclusionQueryivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1362,m_next_glGetOcclusionQueryivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC m_next_glUniform1uiEXT = nullptr;
+void m_glUniform1uiEXT_profile(GLint a0,GLuint a1)const{return this->m_profile(1363,m_next_glUniform1uiEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC m_next_glMultiTexCoord2sv = nullptr;
+void m_glMultiTexCoord2sv_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(1364,m_next_glMultiTexCoord2sv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC m_next_glTexSubImage2DEXT = nullptr;
+void m_glTexSubImage2DEXT_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const void* a8)const{return this->m_profile(1365,m_next_glTexSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC m_next_glProgramUniform2uiv = nullptr;
+void m_glProgramUniform2uiv_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(1366,m_next_glProgramUniform2uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC m_next_glMultiTexCoord2iARB = nullptr;
+void m_glMultiTexCoord2iARB_profile(GLenum a0,GLint a1,GLint a2)const{return this->m_profile(1367,m_next_glMultiTexCoord2iARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC m_next_glGetQueryObjectuiv = nullptr;
+void m_glGetQueryObjectuiv_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(1368,m_next_glGetQueryObjectuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC m_next_glGenerateMultiTexMipmapEXT = nullptr;
+void m_glGenerateMultiTexMipmapEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(1369,m_next_glGenerateMultiTexMipmapEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC m_next_glVertexAttrib4iv = nullptr;
+void m_glVertexAttrib4iv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(1370,m_next_glVertexAttrib4iv,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC m_next_glWindowPos3dvMESA = nullptr;
+void m_glWindowPos3dvMESA_profile(const GLdouble* a0)const{return this->m_profile(1371,m_next_glWindowPos3dvMESA,a0);}
+FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC m_next_glLabelObjectEXT = nullptr;
+void m_glLabelObjectEXT_profile(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{return this->m_profile(1372,m_next_glLabelObjectEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC m_next_glProgramUniform1uiv = nullptr;
+void m_glProgramUniform1uiv_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(1373,m_next_glProgramUniform1uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC m_next_glFramebufferTexture = nullptr;
+void m_glFramebufferTexture_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{return this->m_profile(1374,m_next_glFramebufferTexture,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC m_next_glMultiTexEnvfEXT = nullptr;
+void m_glMultiTexEnvfEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{return this->m_profile(1375,m_next_glMultiTexEnvfEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETTEXGENDVPROC m_next_glGetTexGendv = nullptr;
+void m_glGetTexGendv_profile(GLenum a0,GLenum a1,GLdouble* a2)const{return this->m_profile(1376,m_next_glGetTexGendv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX4XOESPROC m_next_glVertex4xOES = nullptr;
+void m_glVertex4xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(1377,m_next_glVertex4xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC m_next_glVertexAttribI2uivEXT = nullptr;
+void m_glVertexAttribI2uivEXT_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1378,m_next_glVertexAttribI2uivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC m_next_glNamedProgramLocalParameter4fvEXT = nullptr;
+void m_glNamedProgramLocalParameter4fvEXT_profile(GLuint a0,GLenum a1,GLuint a2,const GLfloat* a3)const{return this->m_profile(1379,m_next_glNamedProgramLocalParameter4fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR3USVPROC m_next_glColor3usv = nullptr;
+void m_glColor3usv_profile(const GLushort* a0)const{return this->m_profile(1380,m_next_glColor3usv,a0);}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC m_next_glGetPixelTransformParameterfvEXT = nullptr;
+void m_glGetPixelTransformParameterfvEXT_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1381,m_next_glGetPixelTransformParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINDEXXVOESPROC m_next_glIndexxvOES = nullptr;
+void m_glIndexxvOES_profile(const GLfixed* a0)const{return this->m_profile(1382,m_next_glIndexxvOES,a0);}
+FunctionTable::MEMBERPFNGLDEPTHMASKPROC m_next_glDepthMask = nullptr;
+void m_glDepthMask_profile(GLboolean a0)const{return this->m_profile(1383,m_next_glDepthMask,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC m_next_glProgramUniformMatrix2x4fv = nullptr;
+void m_glProgramUniformMatrix2x4fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1384,m_next_glProgramUniformMatrix2x4fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC m_next_glAreProgramsResidentNV = nullptr;
+GLboolean m_glAreProgramsResidentNV_profile(GLsizei a0,const GLuint* a1,GLboolean* a2)const{return this->m_profile(1385,m_next_glAreProgramsResidentNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPROC m_next_glColorTable = nullptr;
+void m_glColorTable_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{return this->m_profile(1386,m_next_glColorTable,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC m_next_glBeginQueryIndexed = nullptr;
+void m_glBeginQueryIndexed_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(1387,m_next_glBeginQueryIndexed,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC m_next_glVertexStream1dvATI = nullptr;
+void m_glVertexStream1dvATI_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(1388,m_next_glVertexStream1dvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC m_next_glGetMultiTexEnvfvEXT = nullptr;
+void m_glGetMultiTexEnvfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat* a3)const{return this->m_profile(1389,m_next_glGetMultiTexEnvfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC m_next_glDeleteFencesNV = nullptr;
+void m_glDeleteFencesNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1390,m_next_glDeleteFencesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC m_next_glVertexAttribs1dvNV = nullptr;
+void m_glVertexAttribs1dvNV_profile(GLuint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(1391,m_next_glVertexAttribs1dvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC m_next_glBufferStorageExternalEXT = nullptr;
+void m_glBufferStorageExternalEXT_profile(GLenum a0,GLintptr a1,GLsizeiptr a2,GLeglClientBufferEXT a3,GLbitfield a4)const{return this->m_profile(1392,m_next_glBufferStorageExternalEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC m_next_glVertexStream2sATI = nullptr;
+void m_glVertexStream2sATI_profile(GLenum a0,GLshort a1,GLshort a2)const{return this->m_profile(1393,m_next_glVertexStream2sATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC m_next_glGetnSeparableFilterARB = nullptr;
+void m_glGetnSeparableFilterARB_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4,GLsizei a5,void* a6,void* a7)const{return this->m_profile(1394,m_next_glGetnSeparableFilterARB,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC m_next_glProgramUniform2dv = nullptr;
+void m_glProgramUniform2dv_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(1395,m_next_glProgramUniform2dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC m_next_glActiveStencilFaceEXT = nullptr;
+void m_glActiveStencilFaceEXT_profile(GLenum a0)const{return this->m_profile(1396,m_next_glActiveStencilFaceEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC m_next_glProgramUniform4dEXT = nullptr;
+void m_glProgramUniform4dEXT_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(1397,m_next_glProgramUniform4dEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC m_next_glPointSizexOES = nullptr;
+void m_glPointSizexOES_profile(GLfixed a0)const{return this->m_profile(1398,m_next_glPointSizexOES,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC m_next_glRasterPos2sv = nullptr;
+void m_glRasterPos2sv_profile(const GLshort* a0)const{return this->m_profile(1399,m_next_glRasterPos2sv,a0);}
+FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC m_next_glBindParameterEXT = nullptr;
+GLuint m_glBindParameterEXT_profile(GLenum a0)const{return this->m_profile(1400,m_next_glBindParameterEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC m_next_glTexCoord1sv = nullptr;
+void m_glTexCoord1sv_profile(const GLshort* a0)const{return this->m_profile(1401,m_next_glTexCoord1sv,a0);}
+FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC m_next_glBlendParameteriNV = nullptr;
+void m_glBlendParameteriNV_profile(GLenum a0,GLint a1)const{return this->m_profile(1402,m_next_glBlendParameteriNV,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC m_next_glNamedProgramLocalParameter4dvEXT = nullptr;
+void m_glNamedProgramLocalParameter4dvEXT_profile(GLuint a0,GLenum a1,GLuint a2,const GLdouble* a3)const{return this->m_profile(1403,m_next_glNamedProgramLocalParameter4dvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC m_next_glProgramUniformHandleui64NV = nullptr;
+void m_glProgramUniformHandleui64NV_profile(GLuint a0,GLint a1,GLuint64 a2)const{return this->m_profile(1404,m_next_glProgramUniformHandleui64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC m_next_glGetTextureParameterfvEXT = nullptr;
+void m_glGetTextureParameterfvEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLfloat* a3)const{return this->m_profile(1405,m_next_glGetTextureParameterfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC m_next_glGetPathMetricsNV = nullptr;
+void m_glGetPathMetricsNV_profile(GLbitfield a0,GLsizei a1,GLenum a2,const void* a3,GLuint a4,GLsizei a5,GLfloat* a6)const{return this->m_profile(1406,m_next_glGetPathMetricsNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEX2IPROC m_next_glVertex2i = nullptr;
+void m_glVertex2i_profile(GLint a0,GLint a1)const{return this->m_profile(1407,m_next_glVertex2i,a0,a1);}
+FunctionTable::MEMBERPFNGLNEWLISTPROC m_next_glNewList = nullptr;
+void m_glNewList_profile(GLuint a0,GLenum a1)const{return this->m_profile(1408,m_next_glNewList,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC m_next_glMatrixLoad3x3fNV = nullptr;
+void m_glMatrixLoad3x3fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1409,m_next_glMatrixLoad3x3fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC m_next_glMultiTexCoord2fARB = nullptr;
+void m_glMultiTexCoord2fARB_profile(GLenum a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1410,m_next_glMultiTexCoord2fARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC m_next_glWeightdvARB = nullptr;
+void m_glWeightdvARB_profile(GLint a0,const GLdouble* a1)const{return this->m_profile(1411,m_next_glWeightdvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC m_next_glIsTransformFeedbackNV = nullptr;
+GLboolean m_glIsTransformFeedbackNV_profile(GLuint a0)const{return this->m_profile(1412,m_next_glIsTransformFeedbackNV,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC m_next_glVertexAttribDivisorARB = nullptr;
+void m_glVertexAttribDivisorARB_profile(GLuint a0,GLuint a1)const{return this->m_profile(1413,m_next_glVertexAttribDivisorARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC m_next_glSecondaryColorP3uiv = nullptr;
+void m_glSecondaryColorP3uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(1414,m_next_glSecondaryColorP3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC m_next_glGetnCompressedTexImageARB = nullptr;
+void m_glGetnCompressedTexImageARB_profile(GLenum a0,GLint a1,GLsizei a2,void* a3)const{return this->m_profile(1415,m_next_glGetnCompressedTexImageARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETINTEGERVPROC m_next_glGetIntegerv = nullptr;
+void m_glGetIntegerv_profile(GLenum a0,GLint* a1)const{return this->m_profile(1416,m_next_glGetIntegerv,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC m_next_glMatrixLoaddEXT = nullptr;
+void m_glMatrixLoaddEXT_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(1417,m_next_glMatrixLoaddEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC m_next_glGetPathLengthNV = nullptr;
+GLfloat m_glGetPathLengthNV_profile(GLuint a0,GLsizei a1,GLsizei a2)const{return this->m_profile(1418,m_next_glGetPathLengthNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC m_next_glProgramUniformMatrix3dv = nullptr;
+void m_glProgramUniformMatrix3dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1419,m_next_glProgramUniformMatrix3dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC m_next_glUniform4i64NV = nullptr;
+void m_glUniform4i64NV_profile(GLint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{return this->m_profile(1420,m_next_glUniform4i64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC m_next_glGetHistogramEXT = nullptr;
+void m_glGetHistogramEXT_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,void* a4)const{return this->m_profile(1421,m_next_glGetHistogramEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC m_next_glVertexAttrib4NuivARB = nullptr;
+void m_glVertexAttrib4NuivARB_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1422,m_next_glVertexAttrib4NuivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC m_next_glMapGrid2xOES = nullptr;
+void m_glMapGrid2xOES_profile(GLint a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4)const{return this->m_profile(1423,m_next_glMapGrid2xOES,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC m_next_glTexImage2D = nullptr;
+void m_glTexImage2D_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const GLvoid* a8)const{return this->m_profile(1424,m_next_glTexImage2D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC m_next_glWindowPos2fvARB = nullptr;
+void m_glWindowPos2fvARB_profile(const GLfloat* a0)const{return this->m_profile(1425,m_next_glWindowPos2fvARB,a0);}
+FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC m_next_glEnableIndexedEXT = nullptr;
+void m_glEnableIndexedEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(1426,m_next_glEnableIndexedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC m_next_glTexCoord1bvOES = nullptr;
+void m_glTexCoord1bvOES_profile(const GLbyte* a0)const{return this->m_profile(1427,m_next_glTexCoord1bvOES,a0);}
+FunctionTable::MEMBERPFNGLDRAWPIXELSPROC m_next_glDrawPixels = nullptr;
+void m_glDrawPixels_profile(GLsizei a0,GLsizei a1,GLenum a2,GLenum a3,const GLvoid* a4)const{return this->m_profile(1428,m_next_glDrawPixels,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTMATRIXDPROC m_next_glMultMatrixd = nullptr;
+void m_glMultMatrixd_profile(const GLdouble* a0)const{return this->m_profile(1429,m_next_glMultMatrixd,a0);}
+FunctionTable::MEMBERPFNGLMULTMATRIXFPROC m_next_glMultMatrixf = nullptr;
+void m_glMultMatrixf_profile(const GLfloat* a0)const{return this->m_profile(1430,m_next_glMultMatrixf,a0);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC m_next_glReplacementCodePointerSUN = nullptr;
+void m_glReplacementCodePointerSUN_profile(GLenum a0,GLsizei a1,const void** a2)const{return this->m_profile(1431,m_next_glReplacementCodePointerSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC m_next_glLoadTransposeMatrixdARB = nullptr;
+void m_glLoadTransposeMatrixdARB_profile(const GLdouble* a0)const{return this->m_profile(1432,m_next_glLoadTransposeMatrixdARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC m_next_glVertexAttrib4Nubv = nullptr;
+void m_glVertexAttrib4Nubv_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(1433,m_next_glVertexAttrib4Nubv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC m_next_glVertexArrayVertexAttribIOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribIOffsetEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{return this->m_profile(1434,m_next_glVertexArrayVertexAttribIOffsetEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC m_next_glCompileShaderARB = nullptr;
+void m_glCompileShaderARB_profile(GLhandleARB a0)const{return this->m_profile(1435,m_next_glCompileShaderARB,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC m_next_glWindowPos3dMESA = nullptr;
+void m_glWindowPos3dMESA_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1436,m_next_glWindowPos3dMESA,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC m_next_glNormalStream3fvATI = nullptr;
+void m_glNormalStream3fvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1437,m_next_glNormalStream3fvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4USVPROC m_next_glColor4usv = nullptr;
+void m_glColor4usv_profile(const GLushort* a0)const{return this->m_profile(1438,m_next_glColor4usv,a0);}
+FunctionTable::MEMBERPFNGLMAPGRID1FPROC m_next_glMapGrid1f = nullptr;
+void m_glMapGrid1f_profile(GLint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1439,m_next_glMapGrid1f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC m_next_glPolygonStipple = nullptr;
+void m_glPolygonStipple_profile(const GLubyte* a0)const{return this->m_profile(1440,m_next_glPolygonStipple,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC m_next_glUniform4ui64ARB = nullptr;
+void m_glUniform4ui64ARB_profile(GLint a0,GLuint64 a1,GLuint64 a2,GLuint64 a3,GLuint64 a4)const{return this->m_profile(1441,m_next_glUniform4ui64ARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC m_next_glTextureRenderbufferEXT = nullptr;
+void m_glTextureRenderbufferEXT_profile(GLuint a0,GLenum a1,GLuint a2)const{return this->m_profile(1442,m_next_glTextureRenderbufferEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC m_next_glGetSubroutineUniformLocation = nullptr;
+GLint m_glGetSubroutineUniformLocation_profile(GLuint a0,GLenum a1,const GLchar* a2)const{return this->m_profile(1443,m_next_glGetSubroutineUniformLocation,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC m_next_glGetFramebufferParameteriv = nullptr;
+void m_glGetFramebufferParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1444,m_next_glGetFramebufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC m_next_glPixelMapusv = nullptr;
+void m_glPixelMapusv_profile(GLenum a0,GLsizei a1,const GLushort* a2)const{return this->m_profile(1445,m_next_glPixelMapusv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC m_next_glGetSamplerParameteriv = nullptr;
+void m_glGetSamplerParameteriv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1446,m_next_glGetSamplerParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC m_next_glVertexStream2fvATI = nullptr;
+void m_glVertexStream2fvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1447,m_next_glVertexStream2fvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC m_next_glProgramStringARB = nullptr;
+void m_glProgramStringARB_profile(GLenum a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(1448,m_next_glProgramStringARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC m_next_glProgramUniformMatrix3dvEXT = nullptr;
+void m_glProgramUniformMatrix3dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1449,m_next_glProgramUniformMatrix3dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC m_next_glSeparableFilter2D = nullptr;
+void m_glSeparableFilter2D_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6,const GLvoid* a7)const{return this->m_profile(1450,m_next_glSeparableFilter2D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC m_next_glVertexAttribI1uiv = nullptr;
+void m_glVertexAttribI1uiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1451,m_next_glVertexAttribI1uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC m_next_glLGPUCopyImageSubDataNVX = nullptr;
+void m_glLGPUCopyImageSubDataNVX_profile(GLuint a0,GLbitfield a1,GLuint a2,GLenum a3,GLint a4,GLint a5,GLint a6,GLint a7,GLuint a8,GLenum a9,GLint a10,GLint a11,GLint a12,GLint a13,GLsizei a14,GLsizei a15,GLsizei a16)const{return this->m_profile(1452,m_next_glLGPUCopyImageSubDataNVX,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC m_next_glTexStorage2D = nullptr;
+void m_glTexStorage2D_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1453,m_next_glTexStorage2D,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLOR3FVPROC m_next_glColor3fv = nullptr;
+void m_glColor3fv_profile(const GLfloat* a0)const{return this->m_profile(1454,m_next_glColor3fv,a0);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC m_next_glGetMultiTexGendvEXT = nullptr;
+void m_glGetMultiTexGendvEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLdouble* a3)const{return this->m_profile(1455,m_next_glGetMultiTexGendvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC m_next_glVertexAttribL4dvEXT = nullptr;
+void m_glVertexAttribL4dvEXT_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(1456,m_next_glVertexAttribL4dvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC m_next_glGetActiveUniform = nullptr;
+void m_glGetActiveUniform_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLint* a4,GLenum* a5,GLchar* a6)const{return this->m_profile(1457,m_next_glGetActiveUniform,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC m_next_glUniform2ui64vARB = nullptr;
+void m_glUniform2ui64vARB_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(1458,m_next_glUniform2ui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC m_next_glMakeNamedBufferResidentNV = nullptr;
+void m_glMakeNamedBufferResidentNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(1459,m_next_glMakeNamedBufferResidentNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC m_next_glPathGlyphIndexRangeNV = nullptr;
+GLenum m_glPathGlyphIndexRangeNV_profile(GLenum a0,const void* a1,GLbitfield a2,GLuint a3,GLfloat a4,GLuint* a5)const{return this->m_profile(1460,m_next_glPathGlyphIndexRangeNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERPROC m_next_glColorPointer = nullptr;
+void m_glColorPointer_profile(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{return this->m_profile(1461,m_next_glColorPointer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC m_next_glProgramEnvParameterI4ivNV = nullptr;
+void m_glProgramEnvParameterI4ivNV_profile(GLenum a0,GLuint a1,const GLint* a2)const{return this->m_profile(1462,m_next_glProgramEnvParameterI4ivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC m_next_glMulticastGetQueryObjectui64vNV = nullptr;
+void m_glMulticastGetQueryObjectui64vNV_profile(GLuint a0,GLuint a1,GLenum a2,GLuint64* a3)const{return this->m_profile(1463,m_next_glMulticastGetQueryObjectui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC m_next_glMultiTexParameterfEXT = nullptr;
+void m_glMultiTexParameterfEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{return this->m_profile(1464,m_next_glMultiTexParameterfEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC m_next_glNamedFramebufferTextureLayer = nullptr;
+void m_glNamedFramebufferTextureLayer_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{return this->m_profile(1465,m_next_glNamedFramebufferTextureLayer,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC m_next_glGetVertexArrayIntegervEXT = nullptr;
+void m_glGetVertexArrayIntegervEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1466,m_next_glGetVertexArrayIntegervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC m_next_glVertexAttrib3dARB = nullptr;
+void m_glVertexAttrib3dARB_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1467,m_next_glVertexAttrib3dARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC m_next_glVDPAUIsSurfaceNV = nullptr;
+GLboolean m_glVDPAUIsSurfaceNV_profile(GLvdpauSurfaceNV a0)const{return this->m_profile(1468,m_next_glVDPAUIsSurfaceNV,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC m_next_glMultiTexImage1DEXT = nullptr;
+void m_glMultiTexImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const void* a8)const{return this->m_profile(1469,m_next_glMultiTexImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC m_next_glIsAsyncMarkerSGIX = nullptr;
+GLboolean m_glIsAsyncMarkerSGIX_profile(GLuint a0)const{return this->m_profile(1470,m_next_glIsAsyncMarkerSGIX,a0);}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC m_next_glGetDoublei_vEXT = nullptr;
+void m_glGetDoublei_vEXT_profile(GLenum a0,GLuint a1,GLdouble* a2)const{return this->m_profile(1471,m_next_glGetDoublei_vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC m_next_glUniform2i64NV = nullptr;
+void m_glUniform2i64NV_profile(GLint a0,GLint64EXT a1,GLint64EXT a2)const{return this->m_profile(1472,m_next_glUniform2i64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC m_next_glIsCommandListNV = nullptr;
+GLboolean m_glIsCommandListNV_profile(GLuint a0)const{return this->m_profile(1473,m_next_glIsCommandListNV,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC m_next_glUniform3uiEXT = nullptr;
+void m_glUniform3uiEXT_profile(GLint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(1474,m_next_glUniform3uiEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC m_next_glTexParameterIuivEXT = nullptr;
+void m_glTexParameterIuivEXT_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(1475,m_next_glTexParameterIuivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC m_next_glProgramUniformMatrix4fv = nullptr;
+void m_glProgramUniformMatrix4fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1476,m_next_glProgramUniformMatrix4fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEX2FVPROC m_next_glVertex2fv = nullptr;
+void m_glVertex2fv_profile(const GLfloat* a0)const{return this->m_profile(1477,m_next_glVertex2fv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC m_next_glVertexAttribL3dEXT = nullptr;
+void m_glVertexAttribL3dEXT_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1478,m_next_glVertexAttribL3dEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC m_next_glFramebufferRenderbuffer = nullptr;
+void m_glFramebufferRenderbuffer_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(1479,m_next_glFramebufferRenderbuffer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC m_next_glGetUniformLocationARB = nullptr;
+GLint m_glGetUniformLocationARB_profile(GLhandleARB a0,const GLcharARB* a1)const{return this->m_profile(1480,m_next_glGetUniformLocationARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC m_next_glPathParameterfvNV = nullptr;
+void m_glPathParameterfvNV_profile(GLuint a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1481,m_next_glPathParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC m_next_glVertexAttrib3sNV = nullptr;
+void m_glVertexAttrib3sNV_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1482,m_next_glVertexAttrib3sNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC m_next_glGetDoublei_v = nullptr;
+void m_glGetDoublei_v_profile(GLenum a0,GLuint a1,GLdouble* a2)const{return this->m_profile(1483,m_next_glGetDoublei_v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC m_next_glVertexAttrib1sv = nullptr;
+void m_glVertexAttrib1sv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(1484,m_next_glVertexAttrib1sv,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDSAMPLERPROC m_next_glBindSampler = nullptr;
+void m_glBindSampler_profile(GLuint a0,GLuint a1)const{return this->m_profile(1485,m_next_glBindSampler,a0,a1);}
+FunctionTable::MEMBERPFNGLLINEWIDTHPROC m_next_glLineWidth = nullptr;
+void m_glLineWidth_profile(GLfloat a0)const{return this->m_profile(1486,m_next_glLineWidth,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC m_next_glVertexArrayRangeAPPLE = nullptr;
+void m_glVertexArrayRangeAPPLE_profile(GLsizei a0,void* a1)const{return this->m_profile(1487,m_next_glVertexArrayRangeAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC m_next_glBindBufferOffsetEXT = nullptr;
+void m_glBindBufferOffsetEXT_profile(GLenum a0,GLuint a1,GLuint a2,GLintptr a3)const{return this->m_profile(1488,m_next_glBindBufferOffsetEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC m_next_glWeightfvARB = nullptr;
+void m_glWeightfvARB_profile(GLint a0,const GLfloat* a1)const{return this->m_profile(1489,m_next_glWeightfvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC m_next_glGetIntegeri_v = nullptr;
+void m_glGetIntegeri_v_profile(GLenum a0,GLuint a1,GLint* a2)const{return this->m_profile(1490,m_next_glGetIntegeri_v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC m_next_glGetTransformFeedbackVarying = nullptr;
+void m_glGetTransformFeedbackVarying_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLsizei* a4,GLenum* a5,GLchar* a6)const{return this->m_profile(1491,m_next_glGetTransformFeedbackVarying,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC m_next_glProgramLocalParameter4fvARB = nullptr;
+void m_glProgramLocalParameter4fvARB_profile(GLenum a0,GLuint a1,const GLfloat* a2)const{return this->m_profile(1492,m_next_glProgramLocalParameter4fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC m_next_glGetTransformFeedbackVaryingNV = nullptr;
+void m_glGetTransformFeedbackVaryingNV_profile(GLuint a0,GLuint a1,GLint* a2)const{return this->m_profile(1493,m_next_glGetTransformFeedbackVaryingNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC m_next_glWindowPos2iv = nullptr;
+void m_glWindowPos2iv_profile(const GLint* a0)const{return this->m_profile(1494,m_next_glWindowPos2iv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC m_next_glVertexStream1dATI = nullptr;
+void m_glVertexStream1dATI_profile(GLenum a0,GLdouble a1)const{return this->m_profile(1495,m_next_glVertexStream1dATI,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC m_next_glColorFragmentOp2ATI = nullptr;
+void m_glColorFragmentOp2ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9)const{return this->m_profile(1496,m_next_glColorFragmentOp2ATI,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLFOGIVPROC m_next_glFogiv = nullptr;
+void m_glFogiv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1497,m_next_glFogiv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC m_next_glGetTextureHandleNV = nullptr;
+GLuint64 m_glGetTextureHandleNV_profile(GLuint a0)const{return this->m_profile(1498,m_next_glGetTextureHandleNV,a0);}
+FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC m_next_glLightModeliv = nullptr;
+void m_glLightModeliv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1499,m_next_glLightModeliv,a0,a1);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC m_next_glDepthRangef = nullptr;
+void m_glDepthRangef_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(1500,m_next_glDepthRangef,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC m_next_glGetFragmentMaterialivSGIX = nullptr;
+void m_glGetFragmentMaterialivSGIX_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1501,m_next_glGetFragmentMaterialivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC m_next_glVideoCaptureStreamParameterfvNV = nullptr;
+void m_glVideoCaptureStreamParameterfvNV_profile(GLuint a0,GLuint a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(1502,m_next_glVideoCaptureStreamParameterfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC m_next_glDeleteProgramsARB = nullptr;
+void m_glDeleteProgramsARB_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1503,m_next_glDeleteProgramsARB,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC m_next_glWindowPos3fvARB = nullptr;
+void m_glWindowPos3fvARB_profile(const GLfloat* a0)const{return this->m_profile(1504,m_next_glWindowPos3fvARB,a0);}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC m_next_glFeedbackBufferxOES = nullptr;
+void m_glFeedbackBufferxOES_profile(GLsizei a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(1505,m_next_glFeedbackBufferxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC m_next_glGetTexBumpParameterfvATI = nullptr;
+void m_glGetTexBumpParameterfvATI_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(1506,m_next_glGetTexBumpParameterfvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLENABLEIPROC m_next_glEnablei = nullptr;
+void m_glEnablei_profile(GLenum a0,GLuint a1)const{return this->m_profile(1507,m_next_glEnablei,a0,a1);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC m_next_glGetActiveSubroutineName = nullptr;
+void m_glGetActiveSubroutineName_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,GLsizei* a4,GLchar* a5)const{return this->m_profile(1508,m_next_glGetActiveSubroutineName,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC m_next_glDrawBuffersARB = nullptr;
+void m_glDrawBuffersARB_profile(GLsizei a0,const GLenum* a1)const{return this->m_profile(1509,m_next_glDrawBuffersARB,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC m_next_glBindProgramARB = nullptr;
+void m_glBindProgramARB_profile(GLenum a0,GLuint a1)const{return this->m_profile(1510,m_next_glBindProgramARB,a0,a1);}
+FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC m_next_glEvalCoord1fv = nullptr;
+void m_glEvalCoord1fv_profile(const GLfloat* a0)const{return this->m_profile(1511,m_next_glEvalCoord1fv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC m_next_glProgramUniform3ui64vARB = nullptr;
+void m_glProgramUniform3ui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(1512,m_next_glProgramUniform3ui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC m_next_glProgramUniformMatrix2dv = nullptr;
+void m_glProgramUniformMatrix2dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1513,m_next_glProgramUniformMatrix2dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC m_next_glMultiTexCoord2hvNV = nullptr;
+void m_glMultiTexCoord2hvNV_profile(GLenum a0,const GLhalfNV* a1)const{return this->m_profile(1514,m_next_glMultiTexCoord2hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC m_next_glGetFloatIndexedvEXT = nullptr;
+void m_glGetFloatIndexedvEXT_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(1515,m_next_glGetFloatIndexedvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC m_next_glSampleCoverageARB = nullptr;
+void m_glSampleCoverageARB_profile(GLfloat a0,GLboolean a1)const{return this->m_profile(1516,m_next_glSampleCoverageARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC m_next_glProgramUniform2ui64vARB = nullptr;
+void m_glProgramUniform2ui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(1517,m_next_glProgramUniform2ui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC m_next_glPixelDataRangeNV = nullptr;
+void m_glPixelDataRangeNV_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(1518,m_next_glPixelDataRangeNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC m_next_glVertexStream3svATI = nullptr;
+void m_glVertexStream3svATI_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(1519,m_next_glVertexStream3svATI,a0,a1);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{return this->m_profile(1520,m_next_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC m_next_glTexCoord3hvNV = nullptr;
+void m_glTexCoord3hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1521,m_next_glTexCoord3hvNV,a0);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC m_next_glSampleMaski = nullptr;
+void m_glSampleMaski_profile(GLuint a0,GLbitfield a1)const{return this->m_profile(1522,m_next_glSampleMaski,a0,a1);}
+FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC m_next_glIndexFuncEXT = nullptr;
+void m_glIndexFuncEXT_profile(GLenum a0,GLclampf a1)const{return this->m_profile(1523,m_next_glIndexFuncEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC m_next_glPointParameteriNV = nullptr;
+void m_glPointParameteriNV_profile(GLenum a0,GLint a1)const{return this->m_profile(1524,m_next_glPointParameteriNV,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC m_next_glUniformMatrix3x2fv = nullptr;
+void m_glUniformMatrix3x2fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(1525,m_next_glUniformMatrix3x2fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC m_next_glGetFramebufferParameterivEXT = nullptr;
+void m_glGetFramebufferParameterivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1526,m_next_glGetFramebufferParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC m_next_glUniform2i64ARB = nullptr;
+void m_glUniform2i64ARB_profile(GLint a0,GLint64 a1,GLint64 a2)const{return this->m_profile(1527,m_next_glUniform2i64ARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC m_next_glNamedBufferStorageEXT = nullptr;
+void m_glNamedBufferStorageEXT_profile(GLuint a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{return this->m_profile(1528,m_next_glNamedBufferStorageEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC m_next_glNamedFramebufferTexture3DEXT = nullptr;
+void m_glNamedFramebufferTexture3DEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{return this->m_profile(1529,m_next_glNamedFramebufferTexture3DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC m_next_glVertexAttrib2dv = nullptr;
+void m_glVertexAttrib2dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(1530,m_next_glVertexAttrib2dv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC m_next_glGetVertexArrayPointervEXT = nullptr;
+void m_glGetVertexArrayPointervEXT_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(1531,m_next_glGetVertexArrayPointervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC m_next_glGetVertexAttribArrayObjectivATI = nullptr;
+void m_glGetVertexAttribArrayObjectivATI_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1532,m_next_glGetVertexAttribArrayObjectivATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC m_next_glProgramUniformMatrix3fvEXT = nullptr;
+void m_glProgramUniformMatrix3fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1533,m_next_glProgramUniformMatrix3fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC m_next_glEnableVertexArrayEXT = nullptr;
+void m_glEnableVertexArrayEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(1534,m_next_glEnableVertexArrayEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC m_next_glColorTableParameterfvSGI = nullptr;
+void m_glColorTableParameterfvSGI_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1535,m_next_glColorTableParameterfvSGI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPROC m_next_glEdgeFlag = nullptr;
+void m_glEdgeFlag_profile(GLboolean a0)const{return this->m_profile(1536,m_next_glEdgeFlag,a0);}
+FunctionTable::MEMBERPFNGLFOGCOORDFPROC m_next_glFogCoordf = nullptr;
+void m_glFogCoordf_profile(GLfloat a0)const{return this->m_profile(1537,m_next_glFogCoordf,a0);}
+FunctionTable::MEMBERPFNGLVERTEX3DPROC m_next_glVertex3d = nullptr;
+void m_glVertex3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1538,m_next_glVertex3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX3FPROC m_next_glVertex3f = nullptr;
+void m_glVertex3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1539,m_next_glVertex3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC m_next_glSpriteParameterivSGIX = nullptr;
+void m_glSpriteParameterivSGIX_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1540,m_next_glSpriteParameterivSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC m_next_glPathGlyphRangeNV = nullptr;
+void m_glPathGlyphRangeNV_profile(GLuint a0,GLenum a1,const void* a2,GLbitfield a3,GLuint a4,GLsizei a5,GLenum a6,GLuint a7,GLfloat a8)const{return this->m_profile(1541,m_next_glPathGlyphRangeNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC m_next_glPrimitiveBoundingBoxARB = nullptr;
+void m_glPrimitiveBoundingBoxARB_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{return this->m_profile(1542,m_next_glPrimitiveBoundingBoxARB,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC m_next_glVertexAttribL3ui64vNV = nullptr;
+void m_glVertexAttribL3ui64vNV_profile(GLuint a0,const GLuint64EXT* a1)const{return this->m_profile(1543,m_next_glVertexAttribL3ui64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX3SPROC m_next_glVertex3s = nullptr;
+void m_glVertex3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(1544,m_next_glVertex3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC m_next_glTexCoordP2ui = nullptr;
+void m_glTexCoordP2ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(1545,m_next_glTexCoordP2ui,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC m_next_glProgramUniform2fvEXT = nullptr;
+void m_glProgramUniform2fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(1546,m_next_glProgramUniform2fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC m_next_glDeletePathsNV = nullptr;
+void m_glDeletePathsNV_profile(GLuint a0,GLsizei a1)const{return this->m_profile(1547,m_next_glDeletePathsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC m_next_glPrimitiveRestartIndexNV = nullptr;
+void m_glPrimitiveRestartIndexNV_profile(GLuint a0)const{return this->m_profile(1548,m_next_glPrimitiveRestartIndexNV,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC m_next_glTexCoord2fColor3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(1549,m_next_glTexCoord2fColor3fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC m_next_glTexCoordPointerListIBM = nullptr;
+void m_glTexCoordPointerListIBM_profile(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{return this->m_profile(1550,m_next_glTexCoordPointerListIBM,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLRECTXOESPROC m_next_glRectxOES = nullptr;
+void m_glRectxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(1551,m_next_glRectxOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC m_next_glCopyNamedBufferSubData = nullptr;
+void m_glCopyNamedBufferSubData_profile(GLuint a0,GLuint a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(1552,m_next_glCopyNamedBufferSubData,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC m_next_glGenProgramsNV = nullptr;
+void m_glGenProgramsNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1553,m_next_glGenProgramsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC m_next_glFragmentLightfSGIX = nullptr;
+void m_glFragmentLightfSGIX_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(1554,m_next_glFragmentLightfSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC m_next_glTexStorage3D = nullptr;
+void m_glTexStorage3D_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5)const{return this->m_profile(1555,m_next_glTexStorage3D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC m_next_glTextureParameteriv = nullptr;
+void m_glTextureParameteriv_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(1556,m_next_glTextureParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC m_next_glNamedBufferDataEXT = nullptr;
+void m_glNamedBufferDataEXT_profile(GLuint a0,GLsizeiptr a1,const void* a2,GLenum a3)const{return this->m_profile(1557,m_next_glNamedBufferDataEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC m_next_glImportSemaphoreWin32NameEXT = nullptr;
+void m_glImportSemaphoreWin32NameEXT_profile(GLuint a0,GLenum a1,const void* a2)const{return this->m_profile(1558,m_next_glImportSemaphoreWin32NameEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC m_next_glMultiTexCoord3fvARB = nullptr;
+void m_glMultiTexCoord3fvARB_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1559,m_next_glMultiTexCoord3fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC m_next_glUniformMatrix3x4fv = nullptr;
+void m_glUniformMatrix3x4fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(1560,m_next_glUniformMatrix3x4fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC m_next_glSubpixelPrecisionBiasNV = nullptr;
+void m_glSubpixelPrecisionBiasNV_profile(GLuint a0,GLuint a1)const{return this->m_profile(1561,m_next_glSubpixelPrecisionBiasNV,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERPROC m_next_glNormalPointer = nullptr;
+void m_glNormalPointer_profile(GLenum a0,GLsizei a1,const GLvoid* a2)const{return this->m_profile(1562,m_next_glNormalPointer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC m_next_glNamedFramebufferTexture = nullptr;
+void m_glNamedFramebufferTexture_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3)const{return this->m_profile(1563,m_next_glNamedFramebufferTexture,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC m_next_glVertexAttrib4NsvARB = nullptr;
+void m_glVertexAttrib4NsvARB_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(1564,m_next_glVertexAttrib4NsvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPASSTHROUGHPROC m_next_glPassThrough = nullptr;
+void m_glPassThrough_profile(GLfloat a0)const{return this->m_profile(1565,m_next_glPassThrough,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC m_next_glSecondaryColorP3ui = nullptr;
+void m_glSecondaryColorP3ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(1566,m_next_glSecondaryColorP3ui,a0,a1);}
+FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC m_next_glInvalidateTexSubImage = nullptr;
+void m_glInvalidateTexSubImage_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7)const{return this->m_profile(1567,m_next_glInvalidateTexSubImage,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC m_next_glIsImageHandleResidentARB = nullptr;
+GLboolean m_glIsImageHandleResidentARB_profile(GLuint64 a0)const{return this->m_profile(1568,m_next_glIsImageHandleResidentARB,a0);}
+FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC m_next_glTangent3fvEXT = nullptr;
+void m_glTangent3fvEXT_profile(const GLfloat* a0)const{return this->m_profile(1569,m_next_glTangent3fvEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC m_next_glProgramUniformMatrix4x3fv = nullptr;
+void m_glProgramUniformMatrix4x3fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1570,m_next_glProgramUniformMatrix4x3fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBEGINPROC m_next_glBegin = nullptr;
+void m_glBegin_profile(GLenum a0)const{return this->m_profile(1571,m_next_glBegin,a0);}
+FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC m_next_glEvalCoord2dv = nullptr;
+void m_glEvalCoord2dv_profile(const GLdouble* a0)const{return this->m_profile(1572,m_next_glEvalCoord2dv,a0);}
+FunctionTable::MEMBERPFNGLCOLOR3UBVPROC m_next_glColor3ubv = nullptr;
+void m_glColor3ubv_profile(const GLubyte* a0)const{return this->m_profile(1573,m_next_glColor3ubv,a0);}
+FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC m_next_glFogCoordfvEXT = nullptr;
+void m_glFogCoordfvEXT_profile(const GLfloat* a0)const{return this->m_profile(1574,m_next_glFogCoordfvEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXP3UIPROC m_next_glVertexP3ui = nullptr;
+void m_glVertexP3ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(1575,m_next_glVertexP3ui,a0,a1);}
+FunctionTable::MEMBERPFNGLLIGHTFVPROC m_next_glLightfv = nullptr;
+void m_glLightfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1576,m_next_glLightfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC m_next_glVertexAttribL3i64NV = nullptr;
+void m_glVertexAttribL3i64NV_profile(GLuint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3)const{return this->m_profile(1577,m_next_glVertexAttribL3i64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC m_next_glStencilClearTagEXT = nullptr;
+void m_glStencilClearTagEXT_profile(GLsizei a0,GLuint a1)const{return this->m_profile(1578,m_next_glStencilClearTagEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC m_next_glGetActiveUniformName = nullptr;
+void m_glGetActiveUniformName_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLchar* a4)const{return this->m_profile(1579,m_next_glGetActiveUniformName,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC m_next_glTangentPointerEXT = nullptr;
+void m_glTangentPointerEXT_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(1580,m_next_glTangentPointerEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC m_next_glUniform4ui64vNV = nullptr;
+void m_glUniform4ui64vNV_profile(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{return this->m_profile(1581,m_next_glUniform4ui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC m_next_glDebugMessageEnableAMD = nullptr;
+void m_glDebugMessageEnableAMD_profile(GLenum a0,GLenum a1,GLsizei a2,const GLuint* a3,GLboolean a4)const{return this->m_profile(1582,m_next_glDebugMessageEnableAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC m_next_glProgramUniform2ui = nullptr;
+void m_glProgramUniform2ui_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3)const{return this->m_profile(1583,m_next_glProgramUniform2ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC m_next_glCopyTexSubImage2DEXT = nullptr;
+void m_glCopyTexSubImage2DEXT_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{return this->m_profile(1584,m_next_glCopyTexSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC m_next_glGenRenderbuffersEXT = nullptr;
+void m_glGenRenderbuffersEXT_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1585,m_next_glGenRenderbuffersEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC m_next_glNamedProgramLocalParameterI4ivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4ivEXT_profile(GLuint a0,GLenum a1,GLuint a2,const GLint* a3)const{return this->m_profile(1586,m_next_glNamedProgramLocalParameterI4ivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC m_next_glMultiTexCoord2f = nullptr;
+void m_glMultiTexCoord2f_profile(GLenum a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1587,m_next_glMultiTexCoord2f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAPGRID2DPROC m_next_glMapGrid2d = nullptr;
+void m_glMapGrid2d_profile(GLint a0,GLdouble a1,GLdouble a2,GLint a3,GLdouble a4,GLdouble a5)const{return this->m_profile(1588,m_next_glMapGrid2d,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC m_next_glGetMultiTexParameterIuivEXT = nullptr;
+void m_glGetMultiTexParameterIuivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint* a3)const{return this->m_profile(1589,m_next_glGetMultiTexParameterIuivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC m_next_glBlendEquationiARB = nullptr;
+void m_glBlendEquationiARB_profile(GLuint a0,GLenum a1)const{return this->m_profile(1590,m_next_glBlendEquationiARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC m_next_glTexParameteriv = nullptr;
+void m_glTexParameteriv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(1591,m_next_glTexParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC m_next_glUniform4ivARB = nullptr;
+void m_glUniform4ivARB_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(1592,m_next_glUniform4ivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC m_next_glMatrixOrthoEXT = nullptr;
+void m_glMatrixOrthoEXT_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{return this->m_profile(1593,m_next_glMatrixOrthoEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC m_next_glVertexArrayVertexBuffer = nullptr;
+void m_glVertexArrayVertexBuffer_profile(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizei a4)const{return this->m_profile(1594,m_next_glVertexArrayVertexBuffer,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC m_next_glProgramLocalParametersI4ivNV = nullptr;
+void m_glProgramLocalParametersI4ivNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1595,m_next_glProgramLocalParametersI4ivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC m_next_glProgramUniform4ui64vNV = nullptr;
+void m_glProgramUniform4ui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{return this->m_profile(1596,m_next_glProgramUniform4ui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC m_next_glGetNamedStringivARB = nullptr;
+void m_glGetNamedStringivARB_profile(GLint a0,const GLchar* a1,GLenum a2,GLint* a3)const{return this->m_profile(1597,m_next_glGetNamedStringivARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC m_next_glVertexAttribL1i64vNV = nullptr;
+void m_glVertexAttribL1i64vNV_profile(GLuint a0,const GLint64EXT* a1)const{return this->m_profile(1598,m_next_glVertexAttribL1i64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC m_next_glTransformFeedbackBufferBase = nullptr;
+void m_glTransformFeedbackBufferBase_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(1599,m_next_glTransformFeedbackBufferBase,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINDEXSVPROC m_next_glIndexsv = nullptr;
+void m_glIndexsv_profile(const GLshort* a0)const{return this->m_profile(1600,m_next_glIndexsv,a0);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC m_next_glPointParameterivNV = nullptr;
+void m_glPointParameterivNV_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1601,m_next_glPointParameterivNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC m_next_glGetDetailTexFuncSGIS = nullptr;
+void m_glGetDetailTexFuncSGIS_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(1602,m_next_glGetDetailTexFuncSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC m_next_glReplacementCodeuiColor3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(1603,m_next_glReplacementCodeuiColor3fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC m_next_glProgramLocalParameter4fARB = nullptr;
+void m_glProgramLocalParameter4fARB_profile(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(1604,m_next_glProgramLocalParameter4fARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBITMAPPROC m_next_glBitmap = nullptr;
+void m_glBitmap_profile(GLsizei a0,GLsizei a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,const GLubyte* a6)const{return this->m_profile(1605,m_next_glBitmap,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC m_next_glNamedFramebufferTextureLayerEXT = nullptr;
+void m_glNamedFramebufferTextureLayerEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{return this->m_profile(1606,m_next_glNamedFramebufferTextureLayerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC m_next_glMultiTexGenfvEXT = nullptr;
+void m_glMultiTexGenfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(1607,m_next_glMultiTexGenfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC m_next_glGetNamedBufferSubData = nullptr;
+void m_glGetNamedBufferSubData_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,void* a3)const{return this->m_profile(1608,m_next_glGetNamedBufferSubData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC m_next_glStencilFuncSeparateATI = nullptr;
+void m_glStencilFuncSeparateATI_profile(GLenum a0,GLenum a1,GLint a2,GLuint a3)const{return this->m_profile(1609,m_next_glStencilFuncSeparateATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC m_next_glProgramUniform2iv = nullptr;
+void m_glProgramUniform2iv_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1610,m_next_glProgramUniform2iv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETQUERYIVPROC m_next_glGetQueryiv = nullptr;
+void m_glGetQueryiv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1611,m_next_glGetQueryiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FPROC m_next_glTexCoord4f = nullptr;
+void m_glTexCoord4f_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1612,m_next_glTexCoord4f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAPGRID2FPROC m_next_glMapGrid2f = nullptr;
+void m_glMapGrid2f_profile(GLint a0,GLfloat a1,GLfloat a2,GLint a3,GLfloat a4,GLfloat a5)const{return this->m_profile(1613,m_next_glMapGrid2f,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC m_next_glListParameterivSGIX = nullptr;
+void m_glListParameterivSGIX_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(1614,m_next_glListParameterivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCREATEQUERIESPROC m_next_glCreateQueries = nullptr;
+void m_glCreateQueries_profile(GLenum a0,GLsizei a1,GLuint* a2)const{return this->m_profile(1615,m_next_glCreateQueries,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC m_next_glGetSamplerParameterfv = nullptr;
+void m_glGetSamplerParameterfv_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1616,m_next_glGetSamplerParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4IPROC m_next_glTexCoord4i = nullptr;
+void m_glTexCoord4i_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1617,m_next_glTexCoord4i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLOBJECTLABELPROC m_next_glObjectLabel = nullptr;
+void m_glObjectLabel_profile(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{return this->m_profile(1618,m_next_glObjectLabel,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC m_next_glProgramUniform3i64NV = nullptr;
+void m_glProgramUniform3i64NV_profile(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{return this->m_profile(1619,m_next_glProgramUniform3i64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC m_next_glGetTextureHandleARB = nullptr;
+GLuint64 m_glGetTextureHandleARB_profile(GLuint a0)const{return this->m_profile(1620,m_next_glGetTextureHandleARB,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD4SPROC m_next_glTexCoord4s = nullptr;
+void m_glTexCoord4s_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1621,m_next_glTexCoord4s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC m_next_glUniform4iARB = nullptr;
+void m_glUniform4iARB_profile(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(1622,m_next_glUniform4iARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC m_next_glGetUniformIndices = nullptr;
+void m_glGetUniformIndices_profile(GLuint a0,GLsizei a1,const GLchar*const* a2,GLuint* a3)const{return this->m_profile(1623,m_next_glGetUniformIndices,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC m_next_glMultiTexImage3DEXT = nullptr;
+void m_glMultiTexImage3DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(1624,m_next_glMultiTexImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC m_next_glCoverageModulationTableNV = nullptr;
+void m_glCoverageModulationTableNV_profile(GLsizei a0,const GLfloat* a1)const{return this->m_profile(1625,m_next_glCoverageModulationTableNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC m_next_glPointParameteriv = nullptr;
+void m_glPointParameteriv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1626,m_next_glPointParameteriv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC m_next_glMultiTexCoord4svARB = nullptr;
+void m_glMultiTexCoord4svARB_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(1627,m_next_glMultiTexCoord4svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMAL3FVPROC m_next_glNormal3fv = nullptr;
+void m_glNormal3fv_profile(const GLfloat* a0)const{return this->m_profile(1628,m_next_glNormal3fv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC m_next_glProgramUniformMatrix3x4dvEXT = nullptr;
+void m_glProgramUniformMatrix3x4dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1629,m_next_glProgramUniformMatrix3x4dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC m_next_glTexCoord1fv = nullptr;
+void m_glTexCoord1fv_profile(const GLfloat* a0)const{return this->m_profile(1630,m_next_glTexCoord1fv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC m_next_glProgramUniformMatrix4x3dvEXT = nullptr;
+void m_glProgramUniformMatrix4x3dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1631,m_next_glProgramUniformMatrix4x3dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC m_next_glGetActiveVaryingNV = nullptr;
+void m_glGetActiveVaryingNV_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLsizei* a4,GLenum* a5,GLchar* a6)const{return this->m_profile(1632,m_next_glGetActiveVaryingNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC m_next_glUniform1i64vARB = nullptr;
+void m_glUniform1i64vARB_profile(GLint a0,GLsizei a1,const GLint64* a2)const{return this->m_profile(1633,m_next_glUniform1i64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC m_next_glMultiTexCoord1dv = nullptr;
+void m_glMultiTexCoord1dv_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(1634,m_next_glMultiTexCoord1dv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC m_next_glTexCoord3fv = nullptr;
+void m_glTexCoord3fv_profile(const GLfloat* a0)const{return this->m_profile(1635,m_next_glTexCoord3fv,a0);}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC m_next_glMatrixTranslatefEXT = nullptr;
+void m_glMatrixTranslatefEXT_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1636,m_next_glMatrixTranslatefEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC m_next_glProgramUniform1ui64vNV = nullptr;
+void m_glProgramUniform1ui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{return this->m_profile(1637,m_next_glProgramUniform1ui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC m_next_glTextureMaterialEXT = nullptr;
+void m_glTextureMaterialEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(1638,m_next_glTextureMaterialEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC m_next_glMultiTexCoordP3uiv = nullptr;
+void m_glMultiTexCoordP3uiv_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(1639,m_next_glMultiTexCoordP3uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC m_next_glVertexAttribP3ui = nullptr;
+void m_glVertexAttribP3ui_profile(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{return this->m_profile(1640,m_next_glVertexAttribP3ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC m_next_glInterpolatePathsNV = nullptr;
+void m_glInterpolatePathsNV_profile(GLuint a0,GLuint a1,GLuint a2,GLfloat a3)const{return this->m_profile(1641,m_next_glInterpolatePathsNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC m_next_glTextureBufferRange = nullptr;
+void m_glTextureBufferRange_profile(GLuint a0,GLenum a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(1642,m_next_glTextureBufferRange,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC m_next_glVertexAttribL2dEXT = nullptr;
+void m_glVertexAttribL2dEXT_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1643,m_next_glVertexAttribL2dEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC m_next_glGetPixelTransformParameterivEXT = nullptr;
+void m_glGetPixelTransformParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1644,m_next_glGetPixelTransformParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC m_next_glTexCoord4xvOES = nullptr;
+void m_glTexCoord4xvOES_profile(const GLfixed* a0)const{return this->m_profile(1645,m_next_glTexCoord4xvOES,a0);}
+FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC m_next_glGetVariantBooleanvEXT = nullptr;
+void m_glGetVariantBooleanvEXT_profile(GLuint a0,GLenum a1,GLboolean* a2)const{return this->m_profile(1646,m_next_glGetVariantBooleanvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEPROC m_next_glDepthRange = nullptr;
+void m_glDepthRange_profile(GLclampd a0,GLclampd a1)const{return this->m_profile(1647,m_next_glDepthRange,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC m_next_glGetVertexAttribdvARB = nullptr;
+void m_glGetVertexAttribdvARB_profile(GLuint a0,GLenum a1,GLdouble* a2)const{return this->m_profile(1648,m_next_glGetVertexAttribdvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC m_next_glGetColorTableParameterfv = nullptr;
+void m_glGetColorTableParameterfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1649,m_next_glGetColorTableParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC m_next_glDrawArraysInstancedEXT = nullptr;
+void m_glDrawArraysInstancedEXT_profile(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1650,m_next_glDrawArraysInstancedEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC m_next_glDisableClientStateIndexedEXT = nullptr;
+void m_glDisableClientStateIndexedEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(1651,m_next_glDisableClientStateIndexedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERPROC m_next_glDrawBuffer = nullptr;
+void m_glDrawBuffer_profile(GLenum a0)const{return this->m_profile(1652,m_next_glDrawBuffer,a0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC m_next_glMultiDrawArraysIndirectBindlessNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessNV_profile(GLenum a0,const void* a1,GLsizei a2,GLsizei a3,GLint a4)const{return this->m_profile(1653,m_next_glMultiDrawArraysIndirectBindlessNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC m_next_glGetnPixelMapusv = nullptr;
+void m_glGetnPixelMapusv_profile(GLenum a0,GLsizei a1,GLushort* a2)const{return this->m_profile(1654,m_next_glGetnPixelMapusv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC m_next_glRasterPos3fv = nullptr;
+void m_glRasterPos3fv_profile(const GLfloat* a0)const{return this->m_profile(1655,m_next_glRasterPos3fv,a0);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC m_next_glClearBufferuiv = nullptr;
+void m_glClearBufferuiv_profile(GLenum a0,GLint a1,const GLuint* a2)const{return this->m_profile(1656,m_next_glClearBufferuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC m_next_glGetInternalformati64v = nullptr;
+void m_glGetInternalformati64v_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,GLint64* a4)const{return this->m_profile(1657,m_next_glGetInternalformati64v,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC m_next_glShaderSourceARB = nullptr;
+void m_glShaderSourceARB_profile(GLhandleARB a0,GLsizei a1,const GLcharARB** a2,const GLint* a3)const{return this->m_profile(1658,m_next_glShaderSourceARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC m_next_glShaderOp3EXT = nullptr;
+void m_glShaderOp3EXT_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(1659,m_next_glShaderOp3EXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC m_next_glWindowPos2dvMESA = nullptr;
+void m_glWindowPos2dvMESA_profile(const GLdouble* a0)const{return this->m_profile(1660,m_next_glWindowPos2dvMESA,a0);}
+FunctionTable::MEMBERPFNGLCLEARINDEXPROC m_next_glClearIndex = nullptr;
+void m_glClearIndex_profile(GLfloat a0)const{return this->m_profile(1661,m_next_glClearIndex,a0);}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC m_next_glProvokingVertexEXT = nullptr;
+void m_glProvokingVertexEXT_profile(GLenum a0)const{return this->m_profile(1662,m_next_glProvokingVertexEXT,a0);}
+FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC m_next_glVariantubvEXT = nullptr;
+void m_glVariantubvEXT_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(1663,m_next_glVariantubvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLFLUSHPROC m_next_glFlush = nullptr;
+void m_glFlush_profile()const{return this->m_profile(1664,m_next_glFlush);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC m_next_glFramebufferTexture2DEXT = nullptr;
+void m_glFramebufferTexture2DEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(1665,m_next_glFramebufferTexture2DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC m_next_glGetColorTableParameterivEXT = nullptr;
+void m_glGetColorTableParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1666,m_next_glGetColorTableParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC m_next_glPresentFrameDualFillNV = nullptr;
+void m_glPresentFrameDualFillNV_profile(GLuint a0,GLuint64EXT a1,GLuint a2,GLuint a3,GLenum a4,GLenum a5,GLuint a6,GLenum a7,GLuint a8,GLenum a9,GLuint a10,GLenum a11,GLuint a12)const{return this->m_profile(1667,m_next_glPresentFrameDualFillNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC m_next_glGenVertexShadersEXT = nullptr;
+GLuint m_glGenVertexShadersEXT_profile(GLuint a0)const{return this->m_profile(1668,m_next_glGenVertexShadersEXT,a0);}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC m_next_glSpecializeShaderARB = nullptr;
+void m_glSpecializeShaderARB_profile(GLuint a0,const GLchar* a1,GLuint a2,const GLuint* a3,const GLuint* a4)const{return this->m_profile(1669,m_next_glSpecializeShaderARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC m_next_glProgramUniformHandleui64vARB = nullptr;
+void m_glProgramUniformHandleui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(1670,m_next_glProgramUniformHandleui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC m_next_glDepthRangefOES = nullptr;
+void m_glDepthRangefOES_profile(GLclampf a0,GLclampf a1)const{return this->m_profile(1671,m_next_glDepthRangefOES,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC m_next_glDeleteVertexArrays = nullptr;
+void m_glDeleteVertexArrays_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1672,m_next_glDeleteVertexArrays,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC m_next_glDrawElementsInstancedBaseVertexBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseVertexBaseInstance_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLint a5,GLuint a6)const{return this->m_profile(1673,m_next_glDrawElementsInstancedBaseVertexBaseInstance,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC m_next_glGetTexLevelParameteriv = nullptr;
+void m_glGetTexLevelParameteriv_profile(GLenum a0,GLint a1,GLenum a2,GLint* a3)const{return this->m_profile(1674,m_next_glGetTexLevelParameteriv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC m_next_glDrawVkImageNV = nullptr;
+void m_glDrawVkImageNV_profile(GLuint64 a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{return this->m_profile(1675,m_next_glDrawVkImageNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC m_next_glWindowPos3iARB = nullptr;
+void m_glWindowPos3iARB_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(1676,m_next_glWindowPos3iARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC m_next_glPrioritizeTextures = nullptr;
+void m_glPrioritizeTextures_profile(GLsizei a0,const GLuint* a1,const GLclampf* a2)const{return this->m_profile(1677,m_next_glPrioritizeTextures,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC m_next_glWindowPos3fvMESA = nullptr;
+void m_glWindowPos3fvMESA_profile(const GLfloat* a0)const{return this->m_profile(1678,m_next_glWindowPos3fvMESA,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC m_next_glProgramUniformMatrix3x2dvEXT = nullptr;
+void m_glProgramUniformMatrix3x2dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1679,m_next_glProgramUniformMatrix3x2dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC m_next_glVertex4xvOES = nullptr;
+void m_glVertex4xvOES_profile(const GLfixed* a0)const{return this->m_profile(1680,m_next_glVertex4xvOES,a0);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC m_next_glTexStorage3DMultisample = nullptr;
+void m_glTexStorage3DMultisample_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(1681,m_next_glTexStorage3DMultisample,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC m_next_glWindowPos2sARB = nullptr;
+void m_glWindowPos2sARB_profile(GLshort a0,GLshort a1)const{return this->m_profile(1682,m_next_glWindowPos2sARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC m_next_glStencilOpValueAMD = nullptr;
+void m_glStencilOpValueAMD_profile(GLenum a0,GLuint a1)const{return this->m_profile(1683,m_next_glStencilOpValueAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC m_next_glProgramVertexLimitNV = nullptr;
+void m_glProgramVertexLimitNV_profile(GLenum a0,GLint a1)const{return this->m_profile(1684,m_next_glProgramVertexLimitNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC m_next_glGetTexParameterPointervAPPLE = nullptr;
+void m_glGetTexParameterPointervAPPLE_profile(GLenum a0,GLenum a1,void** a2)const{return this->m_profile(1685,m_next_glGetTexParameterPointervAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC m_next_glProgramUniform3uivEXT = nullptr;
+void m_glProgramUniform3uivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(1686,m_next_glProgramUniform3uivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCLAMPCOLORPROC m_next_glClampColor = nullptr;
+void m_glClampColor_profile(GLenum a0,GLenum a1)const{return this->m_profile(1687,m_next_glClampColor,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARSTENCILPROC m_next_glClearStencil = nullptr;
+void m_glClearStencil_profile(GLint a0)const{return this->m_profile(1688,m_next_glClearStencil,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC m_next_glTexCoordP1uiv = nullptr;
+void m_glTexCoordP1uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(1689,m_next_glTexCoordP1uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC m_next_glVertexAttribs3svNV = nullptr;
+void m_glVertexAttribs3svNV_profile(GLuint a0,GLsizei a1,const GLshort* a2)const{return this->m_profile(1690,m_next_glVertexAttribs3svNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC m_next_glMultiTexCoord3fv = nullptr;
+void m_glMultiTexCoord3fv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1691,m_next_glMultiTexCoord3fv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC m_next_glVertexBlendEnvfATI = nullptr;
+void m_glVertexBlendEnvfATI_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1692,m_next_glVertexBlendEnvfATI,a0,a1);}
+FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC m_next_glIsFenceAPPLE = nullptr;
+GLboolean m_glIsFenceAPPLE_profile(GLuint a0)const{return this->m_profile(1693,m_next_glIsFenceAPPLE,a0);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC m_next_glGetBufferParameterui64vNV = nullptr;
+void m_glGetBufferParameterui64vNV_profile(GLenum a0,GLenum a1,GLuint64EXT* a2)const{return this->m_profile(1694,m_next_glGetBufferParameterui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC m_next_glVertexAttribI4bvEXT = nullptr;
+void m_glVertexAttribI4bvEXT_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(1695,m_next_glVertexAttribI4bvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC m_next_glUniform2fARB = nullptr;
+void m_glUniform2fARB_profile(GLint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1696,m_next_glUniform2fARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC m_next_glStopInstrumentsSGIX = nullptr;
+void m_glStopInstrumentsSGIX_profile(GLint a0)const{return this->m_profile(1697,m_next_glStopInstrumentsSGIX,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC m_next_glVertexAttrib3fNV = nullptr;
+void m_glVertexAttrib3fNV_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1698,m_next_glVertexAttrib3fNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC m_next_glMapVertexAttrib2dAPPLE = nullptr;
+void m_glMapVertexAttrib2dAPPLE_profile(GLuint a0,GLuint a1,GLdouble a2,GLdouble a3,GLint a4,GLint a5,GLdouble a6,GLdouble a7,GLint a8,GLint a9,const GLdouble* a10)const{return this->m_profile(1699,m_next_glMapVertexAttrib2dAPPLE,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLVERTEX2FPROC m_next_glVertex2f = nullptr;
+void m_glVertex2f_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(1700,m_next_glVertex2f,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC m_next_glCopyTextureImage2DEXT = nullptr;
+void m_glCopyTextureImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLint a8)const{return this->m_profile(1701,m_next_glCopyTextureImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLVERTEX2DPROC m_next_glVertex2d = nullptr;
+void m_glVertex2d_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(1702,m_next_glVertex2d,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC m_next_glSecondaryColor3bvEXT = nullptr;
+void m_glSecondaryColor3bvEXT_profile(const GLbyte* a0)const{return this->m_profile(1703,m_next_glSecondaryColor3bvEXT,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC m_next_glMultiTexCoord4fARB = nullptr;
+void m_glMultiTexCoord4fARB_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(1704,m_next_glMultiTexCoord4fARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC m_next_glPolygonOffset = nullptr;
+void m_glPolygonOffset_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(1705,m_next_glPolygonOffset,a0,a1);}
+FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC m_next_glTangent3bvEXT = nullptr;
+void m_glTangent3bvEXT_profile(const GLbyte* a0)const{return this->m_profile(1706,m_next_glTangent3bvEXT,a0);}
+FunctionTable::MEMBERPFNGLHISTOGRAMPROC m_next_glHistogram = nullptr;
+void m_glHistogram_profile(GLenum a0,GLsizei a1,GLenum a2,GLboolean a3)const{return this->m_profile(1707,m_next_glHistogram,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC m_next_glGetProgramiv = nullptr;
+void m_glGetProgramiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1708,m_next_glGetProgramiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC m_next_glMatrixIndexubvARB = nullptr;
+void m_glMatrixIndexubvARB_profile(GLint a0,const GLubyte* a1)const{return this->m_profile(1709,m_next_glMatrixIndexubvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX2SPROC m_next_glVertex2s = nullptr;
+void m_glVertex2s_profile(GLshort a0,GLshort a1)const{return this->m_profile(1710,m_next_glVertex2s,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC m_next_glGetVertexAttribLui64vNV = nullptr;
+void m_glGetVertexAttribLui64vNV_profile(GLuint a0,GLenum a1,GLuint64EXT* a2)const{return this->m_profile(1711,m_next_glGetVertexAttribLui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC m_next_glGetProgramStringARB = nullptr;
+void m_glGetProgramStringARB_profile(GLenum a0,GLenum a1,void* a2)const{return this->m_profile(1712,m_next_glGetProgramStringARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC m_next_glFlushMappedBufferRange = nullptr;
+void m_glFlushMappedBufferRange_profile(GLenum a0,GLintptr a1,GLsizeiptr a2)const{return this->m_profile(1713,m_next_glFlushMappedBufferRange,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC m_next_glVertexAttribI3uiEXT = nullptr;
+void m_glVertexAttribI3uiEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(1714,m_next_glVertexAttribI3uiEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC m_next_glLineWidthxOES = nullptr;
+void m_glLineWidthxOES_profile(GLfixed a0)const{return this->m_profile(1715,m_next_glLineWidthxOES,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC m_next_glProgramUniformMatrix2fvEXT = nullptr;
+void m_glProgramUniformMatrix2fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1716,m_next_glProgramUniformMatrix2fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC m_next_glGetTextureParameterIuivEXT = nullptr;
+void m_glGetTextureParameterIuivEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint* a3)const{return this->m_profile(1717,m_next_glGetTextureParameterIuivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC m_next_glGetMultiTexEnvivEXT = nullptr;
+void m_glGetMultiTexEnvivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(1718,m_next_glGetMultiTexEnvivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC m_next_glPixelTexGenParameterivSGIS = nullptr;
+void m_glPixelTexGenParameterivSGIS_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1719,m_next_glPixelTexGenParameterivSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLGENQUERIESPROC m_next_glGenQueries = nullptr;
+void m_glGenQueries_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1720,m_next_glGenQueries,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC m_next_glGetPixelMapfv = nullptr;
+void m_glGetPixelMapfv_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(1721,m_next_glGetPixelMapfv,a0,a1);}
+FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC m_next_glBlendColorEXT = nullptr;
+void m_glBlendColorEXT_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(1722,m_next_glBlendColorEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRESETMINMAXPROC m_next_glResetMinmax = nullptr;
+void m_glResetMinmax_profile(GLenum a0)const{return this->m_profile(1723,m_next_glResetMinmax,a0);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC m_next_glGetnUniformivARB = nullptr;
+void m_glGetnUniformivARB_profile(GLuint a0,GLint a1,GLsizei a2,GLint* a3)const{return this->m_profile(1724,m_next_glGetnUniformivARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC m_next_glVertexBlendARB = nullptr;
+void m_glVertexBlendARB_profile(GLint a0)const{return this->m_profile(1725,m_next_glVertexBlendARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC m_next_glVertexAttrib4d = nullptr;
+void m_glVertexAttrib4d_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1726,m_next_glVertexAttrib4d,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC m_next_glGetVaryingLocationNV = nullptr;
+GLint m_glGetVaryingLocationNV_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(1727,m_next_glGetVaryingLocationNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC m_next_glGetMapAttribParameterivNV = nullptr;
+void m_glGetMapAttribParameterivNV_profile(GLenum a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(1728,m_next_glGetMapAttribParameterivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC m_next_glTexSubImage3D = nullptr;
+void m_glTexSubImage3D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const GLvoid* a10)const{return this->m_profile(1729,m_next_glTexSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC m_next_glDeleteSamplers = nullptr;
+void m_glDeleteSamplers_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1730,m_next_glDeleteSamplers,a0,a1);}
+FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC m_next_glGetLightxOES = nullptr;
+void m_glGetLightxOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(1731,m_next_glGetLightxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC m_next_glGetVertexAttribArrayObjectfvATI = nullptr;
+void m_glGetVertexAttribArrayObjectfvATI_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1732,m_next_glGetVertexAttribArrayObjectfvATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC m_next_glVertexArrayNormalOffsetEXT = nullptr;
+void m_glVertexArrayNormalOffsetEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{return this->m_profile(1733,m_next_glVertexArrayNormalOffsetEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC m_next_glGetBufferParameterivARB = nullptr;
+void m_glGetBufferParameterivARB_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1734,m_next_glGetBufferParameterivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC m_next_glGetTextureParameterfv = nullptr;
+void m_glGetTextureParameterfv_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1735,m_next_glGetTextureParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC m_next_glDrawMeshArraysSUN = nullptr;
+void m_glDrawMeshArraysSUN_profile(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1736,m_next_glDrawMeshArraysSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC m_next_glVertexAttrib4dNV = nullptr;
+void m_glVertexAttrib4dNV_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1737,m_next_glVertexAttrib4dNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC m_next_glGetMultisamplefvNV = nullptr;
+void m_glGetMultisamplefvNV_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(1738,m_next_glGetMultisamplefvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC m_next_glMapObjectBufferATI = nullptr;
+void* m_glMapObjectBufferATI_profile(GLuint a0)const{return this->m_profile(1739,m_next_glMapObjectBufferATI,a0);}
+FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC m_next_glGetPathCommandsNV = nullptr;
+void m_glGetPathCommandsNV_profile(GLuint a0,GLubyte* a1)const{return this->m_profile(1740,m_next_glGetPathCommandsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC m_next_glVertexArrayTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayTexCoordOffsetEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{return this->m_profile(1741,m_next_glVertexArrayTexCoordOffsetEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC m_next_glGetHistogram = nullptr;
+void m_glGetHistogram_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLvoid* a4)const{return this->m_profile(1742,m_next_glGetHistogram,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATRIXMODEPROC m_next_glMatrixMode = nullptr;
+void m_glMatrixMode_profile(GLenum a0)const{return this->m_profile(1743,m_next_glMatrixMode,a0);}
+FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC m_next_glColorFormatNV = nullptr;
+void m_glColorFormatNV_profile(GLint a0,GLenum a1,GLsizei a2)const{return this->m_profile(1744,m_next_glColorFormatNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC m_next_glProgramUniformui64NV = nullptr;
+void m_glProgramUniformui64NV_profile(GLuint a0,GLint a1,GLuint64EXT a2)const{return this->m_profile(1745,m_next_glProgramUniformui64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC m_next_glProgramUniformMatrix4x2fvEXT = nullptr;
+void m_glProgramUniformMatrix4x2fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1746,m_next_glProgramUniformMatrix4x2fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC m_next_glLoadMatrixxOES = nullptr;
+void m_glLoadMatrixxOES_profile(const GLfixed* a0)const{return this->m_profile(1747,m_next_glLoadMatrixxOES,a0);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC m_next_glGetColorTableParameterfvEXT = nullptr;
+void m_glGetColorTableParameterfvEXT_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1748,m_next_glGetColorTableParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS4IPROC m_next_glRasterPos4i = nullptr;
+void m_glRasterPos4i_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1749,m_next_glRasterPos4i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC m_next_glVertexAttribL2i64NV = nullptr;
+void m_glVertexAttribL2i64NV_profile(GLuint a0,GLint64EXT a1,GLint64EXT a2)const{return this->m_profile(1750,m_next_glVertexAttribL2i64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDTEXTURESPROC m_next_glBindTextures = nullptr;
+void m_glBindTextures_profile(GLuint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(1751,m_next_glBindTextures,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC m_next_glMatrixRotatefEXT = nullptr;
+void m_glMatrixRotatefEXT_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(1752,m_next_glMatrixRotatefEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC m_next_glGetClipPlanexOES = nullptr;
+void m_glGetClipPlanexOES_profile(GLenum a0,GLfixed* a1)const{return this->m_profile(1753,m_next_glGetClipPlanexOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC m_next_glSecondaryColor3uivEXT = nullptr;
+void m_glSecondaryColor3uivEXT_profile(const GLuint* a0)const{return this->m_profile(1754,m_next_glSecondaryColor3uivEXT,a0);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC m_next_glGetPerfQueryInfoINTEL = nullptr;
+void m_glGetPerfQueryInfoINTEL_profile(GLuint a0,GLuint a1,GLchar* a2,GLuint* a3,GLuint* a4,GLuint* a5,GLuint* a6)const{return this->m_profile(1755,m_next_glGetPerfQueryInfoINTEL,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETDOUBLEVPROC m_next_glGetDoublev = nullptr;
+void m_glGetDoublev_profile(GLenum a0,GLdouble* a1)const{return this->m_profile(1756,m_next_glGetDoublev,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC m_next_glBindBufferRangeEXT = nullptr;
+void m_glBindBufferRangeEXT_profile(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(1757,m_next_glBindBufferRangeEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC m_next_glCompressedTexImage2D = nullptr;
+void m_glCompressedTexImage2D_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLsizei a6,const GLvoid* a7)const{return this->m_profile(1758,m_next_glCompressedTexImage2D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC m_next_glMapBufferARB = nullptr;
+void* m_glMapBufferARB_profile(GLenum a0,GLenum a1)const{return this->m_profile(1759,m_next_glMapBufferARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC m_next_glGetPathSpacingNV = nullptr;
+void m_glGetPathSpacingNV_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLuint a4,GLfloat a5,GLfloat a6,GLenum a7,GLfloat* a8)const{return this->m_profile(1760,m_next_glGetPathSpacingNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLUNIFORM4DVPROC m_next_glUniform4dv = nullptr;
+void m_glUniform4dv_profile(GLint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(1761,m_next_glUniform4dv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC m_next_glGlobalAlphaFactordSUN = nullptr;
+void m_glGlobalAlphaFactordSUN_profile(GLdouble a0)const{return this->m_profile(1762,m_next_glGlobalAlphaFactordSUN,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC m_next_glProgramUniform3dv = nullptr;
+void m_glProgramUniform3dv_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(1763,m_next_glProgramUniform3dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC m_next_glGetShaderSourceARB = nullptr;
+void m_glGetShaderSourceARB_profile(GLhandleARB a0,GLsizei a1,GLsizei* a2,GLcharARB* a3)const{return this->m_profile(1764,m_next_glGetShaderSourceARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC m_next_glVertexAttrib3dvARB = nullptr;
+void m_glVertexAttrib3dvARB_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(1765,m_next_glVertexAttrib3dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC m_next_glInvalidateBufferData = nullptr;
+void m_glInvalidateBufferData_profile(GLuint a0)const{return this->m_profile(1766,m_next_glInvalidateBufferData,a0);}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC m_next_glMatrixLoad3x2fNV = nullptr;
+void m_glMatrixLoad3x2fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1767,m_next_glMatrixLoad3x2fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC m_next_glCompressedTextureSubImage1D = nullptr;
+void m_glCompressedTextureSubImage1D_profile(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const void* a6)const{return this->m_profile(1768,m_next_glCompressedTextureSubImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC m_next_glTexCoord3xvOES = nullptr;
+void m_glTexCoord3xvOES_profile(const GLfixed* a0)const{return this->m_profile(1769,m_next_glTexCoord3xvOES,a0);}
+FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC m_next_glGenTexturesEXT = nullptr;
+void m_glGenTexturesEXT_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1770,m_next_glGenTexturesEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC m_next_glTangent3iEXT = nullptr;
+void m_glTangent3iEXT_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(1771,m_next_glTangent3iEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC m_next_glClearTexImage = nullptr;
+void m_glClearTexImage_profile(GLuint a0,GLint a1,GLenum a2,GLenum a3,const void* a4)const{return this->m_profile(1772,m_next_glClearTexImage,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC m_next_glBinormal3bvEXT = nullptr;
+void m_glBinormal3bvEXT_profile(const GLbyte* a0)const{return this->m_profile(1773,m_next_glBinormal3bvEXT,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM3FVPROC m_next_glUniform3fv = nullptr;
+void m_glUniform3fv_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1774,m_next_glUniform3fv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC m_next_glGetnPixelMapusvARB = nullptr;
+void m_glGetnPixelMapusvARB_profile(GLenum a0,GLsizei a1,GLushort* a2)const{return this->m_profile(1775,m_next_glGetnPixelMapusvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC m_next_glMemoryObjectParameterivEXT = nullptr;
+void m_glMemoryObjectParameterivEXT_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(1776,m_next_glMemoryObjectParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC m_next_glGenSemaphoresEXT = nullptr;
+void m_glGenSemaphoresEXT_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1777,m_next_glGenSemaphoresEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC m_next_glMultiTexCoordP1ui = nullptr;
+void m_glMultiTexCoordP1ui_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(1778,m_next_glMultiTexCoordP1ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC m_next_glClearNamedBufferDataEXT = nullptr;
+void m_glClearNamedBufferDataEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{return this->m_profile(1779,m_next_glClearNamedBufferDataEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC m_next_glUniformMatrix4dv = nullptr;
+void m_glUniformMatrix4dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(1780,m_next_glUniformMatrix4dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC m_next_glWindowPos3fMESA = nullptr;
+void m_glWindowPos3fMESA_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1781,m_next_glWindowPos3fMESA,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC m_next_glDeleteRenderbuffers = nullptr;
+void m_glDeleteRenderbuffers_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1782,m_next_glDeleteRenderbuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC m_next_glGetTextureLevelParameterfvEXT = nullptr;
+void m_glGetTextureLevelParameterfvEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLfloat* a4)const{return this->m_profile(1783,m_next_glGetTextureLevelParameterfvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC m_next_glGetHistogramParameterxvOES = nullptr;
+void m_glGetHistogramParameterxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(1784,m_next_glGetHistogramParameterxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC m_next_glMultiDrawElements = nullptr;
+void m_glMultiDrawElements_profile(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4)const{return this->m_profile(1785,m_next_glMultiDrawElements,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC m_next_glMakeImageHandleNonResidentNV = nullptr;
+void m_glMakeImageHandleNonResidentNV_profile(GLuint64 a0)const{return this->m_profile(1786,m_next_glMakeImageHandleNonResidentNV,a0);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC m_next_glTexSubImage1DEXT = nullptr;
+void m_glTexSubImage1DEXT_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(1787,m_next_glTexSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC m_next_glNormalStream3dATI = nullptr;
+void m_glNormalStream3dATI_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(1788,m_next_glNormalStream3dATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC m_next_glVertexAttribL4i64vNV = nullptr;
+void m_glVertexAttribL4i64vNV_profile(GLuint a0,const GLint64EXT* a1)const{return this->m_profile(1789,m_next_glVertexAttribL4i64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC m_next_glDrawBuffers = nullptr;
+void m_glDrawBuffers_profile(GLsizei a0,const GLenum* a1)const{return this->m_profile(1790,m_next_glDrawBuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC m_next_glCopyTextureSubImage1DEXT = nullptr;
+void m_glCopyTextureSubImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6)const{return this->m_profile(1791,m_next_glCopyTextureSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC m_next_glWindowRectanglesEXT = nullptr;
+void m_glWindowRectanglesEXT_profile(GLenum a0,GLsizei a1,const GLint* a2)const{return this->m_profile(1792,m_next_glWindowRectanglesEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC m_next_glNamedFramebufferReadBuffer = nullptr;
+void m_glNamedFramebufferReadBuffer_profile(GLuint a0,GLenum a1)const{return this->m_profile(1793,m_next_glNamedFramebufferReadBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC m_next_glUniform2i64vARB = nullptr;
+void m_glUniform2i64vARB_profile(GLint a0,GLsizei a1,const GLint64* a2)const{return this->m_profile(1794,m_next_glUniform2i64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC m_next_glVertexAttribI1uivEXT = nullptr;
+void m_glVertexAttribI1uivEXT_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1795,m_next_glVertexAttribI1uivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXGENFVPROC m_next_glGetTexGenfv = nullptr;
+void m_glGetTexGenfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1796,m_next_glGetTexGenfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC m_next_glBeginQueryARB = nullptr;
+void m_glBeginQueryARB_profile(GLenum a0,GLuint a1)const{return this->m_profile(1797,m_next_glBeginQueryARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC m_next_glUniform1iARB = nullptr;
+void m_glUniform1iARB_profile(GLint a0,GLint a1)const{return this->m_profile(1798,m_next_glUniform1iARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC m_next_glVertex4bvOES = nullptr;
+void m_glVertex4bvOES_profile(const GLbyte* a0)const{return this->m_profile(1799,m_next_glVertex4bvOES,a0);}
+FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC m_next_glInvalidateSubFramebuffer = nullptr;
+void m_glInvalidateSubFramebuffer_profile(GLenum a0,GLsizei a1,const GLenum* a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6)const{return this->m_profile(1800,m_next_glInvalidateSubFramebuffer,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC m_next_glUniform1fvARB = nullptr;
+void m_glUniform1fvARB_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1801,m_next_glUniform1fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTESTFENCENVPROC m_next_glTestFenceNV = nullptr;
+GLboolean m_glTestFenceNV_profile(GLuint a0)const{return this->m_profile(1802,m_next_glTestFenceNV,a0);}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC m_next_glBindTransformFeedback = nullptr;
+void m_glBindTransformFeedback_profile(GLenum a0,GLuint a1)const{return this->m_profile(1803,m_next_glBindTransformFeedback,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC m_next_glMultiTexCoord2iv = nullptr;
+void m_glMultiTexCoord2iv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(1804,m_next_glMultiTexCoord2iv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC m_next_glCopyMultiTexSubImage1DEXT = nullptr;
+void m_glCopyMultiTexSubImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6)const{return this->m_profile(1805,m_next_glCopyMultiTexSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC m_next_glVariantbvEXT = nullptr;
+void m_glVariantbvEXT_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(1806,m_next_glVariantbvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC m_next_glTexCoord1hNV = nullptr;
+void m_glTexCoord1hNV_profile(GLhalfNV a0)const{return this->m_profile(1807,m_next_glTexCoord1hNV,a0);}
+FunctionTable::MEMBERPFNGLGENFENCESNVPROC m_next_glGenFencesNV = nullptr;
+void m_glGenFencesNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1808,m_next_glGenFencesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC m_next_glRasterPos3iv = nullptr;
+void m_glRasterPos3iv_profile(const GLint* a0)const{return this->m_profile(1809,m_next_glRasterPos3iv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC m_next_glVertexAttribL2ui64NV = nullptr;
+void m_glVertexAttribL2ui64NV_profile(GLuint a0,GLuint64EXT a1,GLuint64EXT a2)const{return this->m_profile(1810,m_next_glVertexAttribL2ui64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC m_next_glMultiTexCoord1hvNV = nullptr;
+void m_glMultiTexCoord1hvNV_profile(GLenum a0,const GLhalfNV* a1)const{return this->m_profile(1811,m_next_glMultiTexCoord1hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC m_next_glGetnConvolutionFilter = nullptr;
+void m_glGetnConvolutionFilter_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,void* a4)const{return this->m_profile(1812,m_next_glGetnConvolutionFilter,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNORMAL3BVPROC m_next_glNormal3bv = nullptr;
+void m_glNormal3bv_profile(const GLbyte* a0)const{return this->m_profile(1813,m_next_glNormal3bv,a0);}
+FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC m_next_glWeightbvARB = nullptr;
+void m_glWeightbvARB_profile(GLint a0,const GLbyte* a1)const{return this->m_profile(1814,m_next_glWeightbvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC m_next_glTexCoord4sv = nullptr;
+void m_glTexCoord4sv_profile(const GLshort* a0)const{return this->m_profile(1815,m_next_glTexCoord4sv,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC m_next_glUniform2uiv = nullptr;
+void m_glUniform2uiv_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(1816,m_next_glUniform2uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC m_next_glBeginConditionalRenderNVX = nullptr;
+void m_glBeginConditionalRenderNVX_profile(GLuint a0)const{return this->m_profile(1817,m_next_glBeginConditionalRenderNVX,a0);}
+FunctionTable::MEMBERPFNGLFINISHPROC m_next_glFinish = nullptr;
+void m_glFinish_profile()const{return this->m_profile(1818,m_next_glFinish);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC m_next_glColorTableParameterfv = nullptr;
+void m_glColorTableParameterfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(1819,m_next_glColorTableParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC m_next_glFragmentCoverageColorNV = nullptr;
+void m_glFragmentCoverageColorNV_profile(GLuint a0)const{return this->m_profile(1820,m_next_glFragmentCoverageColorNV,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC m_next_glProgramUniform3ivEXT = nullptr;
+void m_glProgramUniform3ivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1821,m_next_glProgramUniform3ivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC m_next_glVertexArrayVertexOffsetEXT = nullptr;
+void m_glVertexArrayVertexOffsetEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{return this->m_profile(1822,m_next_glVertexArrayVertexOffsetEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC m_next_glViewportPositionWScaleNV = nullptr;
+void m_glViewportPositionWScaleNV_profile(GLuint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1823,m_next_glViewportPositionWScaleNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC m_next_glGetProgramLocalParameterIuivNV = nullptr;
+void m_glGetProgramLocalParameterIuivNV_profile(GLenum a0,GLuint a1,GLuint* a2)const{return this->m_profile(1824,m_next_glGetProgramLocalParameterIuivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC m_next_glReplacementCodeuiTexCoord2fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profile(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(1825,m_next_glReplacementCodeuiTexCoord2fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC m_next_glUniform1uiv = nullptr;
+void m_glUniform1uiv_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(1826,m_next_glUniform1uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC m_next_glUniformMatrix2dv = nullptr;
+void m_glUniformMatrix2dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(1827,m_next_glUniformMatrix2dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINDEXDVPROC m_next_glIndexdv = nullptr;
+void m_glIndexdv_profile(const GLdouble* a0)const{return this->m_profile(1828,m_next_glIndexdv,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC m_next_glSecondaryColor3ivEXT = nullptr;
+void m_glSecondaryColor3ivEXT_profile(const GLint* a0)const{return this->m_profile(1829,m_next_glSecondaryColor3ivEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC m_next_glTexCoord3iv = nullptr;
+void m_glTexCoord3iv_profile(const GLint* a0)const{return this->m_profile(1830,m_next_glTexCoord3iv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC m_next_glVertexStream4fvATI = nullptr;
+void m_glVertexStream4fvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1831,m_next_glVertexStream4fvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC m_next_glDeformationMap3fSGIX = nullptr;
+void m_glDeformationMap3fSGIX_profile(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,GLfloat a5,GLfloat a6,GLint a7,GLint a8,GLfloat a9,GLfloat a10,GLint a11,GLint a12,const GLfloat* a13)const{return this->m_profile(1832,m_next_glDeformationMap3fSGIX,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHPROC m_next_glClearDepth = nullptr;
+void m_glClearDepth_profile(GLclampd a0)const{return this->m_profile(1833,m_next_glClearDepth,a0);}
+FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC m_next_glGenAsyncMarkersSGIX = nullptr;
+GLuint m_glGenAsyncMarkersSGIX_profile(GLsizei a0)const{return this->m_profile(1834,m_next_glGenAsyncMarkersSGIX,a0);}
+FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC m_next_glDisableIndexedEXT = nullptr;
+void m_glDisableIndexedEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(1835,m_next_glDisableIndexedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC m_next_glVertexWeightfvEXT = nullptr;
+void m_glVertexWeightfvEXT_profile(const GLfloat* a0)const{return this->m_profile(1836,m_next_glVertexWeightfvEXT,a0);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC m_next_glGetProgramLocalParameterIivNV = nullptr;
+void m_glGetProgramLocalParameterIivNV_profile(GLenum a0,GLuint a1,GLint* a2)const{return this->m_profile(1837,m_next_glGetProgramLocalParameterIivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC m_next_glCompressedTexImage3DARB = nullptr;
+void m_glCompressedTexImage3DARB_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{return this->m_profile(1838,m_next_glCompressedTexImage3DARB,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC m_next_glProgramParameter4fNV = nullptr;
+void m_glProgramParameter4fNV_profile(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{return this->m_profile(1839,m_next_glProgramParameter4fNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC m_next_glConvolutionParameterxOES = nullptr;
+void m_glConvolutionParameterxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(1840,m_next_glConvolutionParameterxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC m_next_glInsertComponentEXT = nullptr;
+void m_glInsertComponentEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(1841,m_next_glInsertComponentEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCREATETEXTURESPROC m_next_glCreateTextures = nullptr;
+void m_glCreateTextures_profile(GLenum a0,GLsizei a1,GLuint* a2)const{return this->m_profile(1842,m_next_glCreateTextures,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC m_next_glSecondaryColor3iv = nullptr;
+void m_glSecondaryColor3iv_profile(const GLint* a0)const{return this->m_profile(1843,m_next_glSecondaryColor3iv,a0);}
+FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC m_next_glCreateBuffers = nullptr;
+void m_glCreateBuffers_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1844,m_next_glCreateBuffers,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC m_next_glMultiTexCoord2xvOES = nullptr;
+void m_glMultiTexCoord2xvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(1845,m_next_glMultiTexCoord2xvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXGENXVOESPROC m_next_glTexGenxvOES = nullptr;
+void m_glTexGenxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(1846,m_next_glTexGenxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC m_next_glMultTransposeMatrixf = nullptr;
+void m_glMultTransposeMatrixf_profile(const GLfloat* a0)const{return this->m_profile(1847,m_next_glMultTransposeMatrixf,a0);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC m_next_glBeginTransformFeedbackEXT = nullptr;
+void m_glBeginTransformFeedbackEXT_profile(GLenum a0)const{return this->m_profile(1848,m_next_glBeginTransformFeedbackEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC m_next_glTexCoord2fColor3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{return this->m_profile(1849,m_next_glTexCoord2fColor3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLNORMAL3SVPROC m_next_glNormal3sv = nullptr;
+void m_glNormal3sv_profile(const GLshort* a0)const{return this->m_profile(1850,m_next_glNormal3sv,a0);}
+FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC m_next_glFreeObjectBufferATI = nullptr;
+void m_glFreeObjectBufferATI_profile(GLuint a0)const{return this->m_profile(1851,m_next_glFreeObjectBufferATI,a0);}
+FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC m_next_glBlendBarrierNV = nullptr;
+void m_glBlendBarrierNV_profile()const{return this->m_profile(1852,m_next_glBlendBarrierNV);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC m_next_glUniform4i64vNV = nullptr;
+void m_glUniform4i64vNV_profile(GLint a0,GLsizei a1,const GLint64EXT* a2)const{return this->m_profile(1853,m_next_glUniform4i64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC m_next_glGetnUniformuivARB = nullptr;
+void m_glGetnUniformuivARB_profile(GLuint a0,GLint a1,GLsizei a2,GLuint* a3)const{return this->m_profile(1854,m_next_glGetnUniformuivARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC m_next_glAlphaFragmentOp3ATI = nullptr;
+void m_glAlphaFragmentOp3ATI_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9,GLuint a10,GLuint a11)const{return this->m_profile(1855,m_next_glAlphaFragmentOp3ATI,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC m_next_glProgramEnvParameters4fvEXT = nullptr;
+void m_glProgramEnvParameters4fvEXT_profile(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(1856,m_next_glProgramEnvParameters4fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC m_next_glBlendFuncSeparateEXT = nullptr;
+void m_glBlendFuncSeparateEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(1857,m_next_glBlendFuncSeparateEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC m_next_glConvolutionParameterivEXT = nullptr;
+void m_glConvolutionParameterivEXT_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(1858,m_next_glConvolutionParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC m_next_glPixelTexGenSGIX = nullptr;
+void m_glPixelTexGenSGIX_profile(GLenum a0)const{return this->m_profile(1859,m_next_glPixelTexGenSGIX,a0);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC m_next_glDeleteProgram = nullptr;
+void m_glDeleteProgram_profile(GLuint a0)const{return this->m_profile(1860,m_next_glDeleteProgram,a0);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC m_next_glUniformMatrix4x3dv = nullptr;
+void m_glUniformMatrix4x3dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(1861,m_next_glUniformMatrix4x3dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC m_next_glGetVideoCaptureStreamivNV = nullptr;
+void m_glGetVideoCaptureStreamivNV_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(1862,m_next_glGetVideoCaptureStreamivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC m_next_glProgramUniform4uiEXT = nullptr;
+void m_glProgramUniform4uiEXT_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(1863,m_next_glProgramUniform4uiEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC m_next_glMakeImageHandleNonResidentARB = nullptr;
+void m_glMakeImageHandleNonResidentARB_profile(GLuint64 a0)const{return this->m_profile(1864,m_next_glMakeImageHandleNonResidentARB,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC m_next_glSecondaryColor3dEXT = nullptr;
+void m_glSecondaryColor3dEXT_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(1865,m_next_glSecondaryColor3dEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDELETEQUERIESPROC m_next_glDeleteQueries = nullptr;
+void m_glDeleteQueries_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(1866,m_next_glDeleteQueries,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALP3UIVPROC m_next_glNormalP3uiv = nullptr;
+void m_glNormalP3uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(1867,m_next_glNormalP3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS2DPROC m_next_glRasterPos2d = nullptr;
+void m_glRasterPos2d_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(1868,m_next_glRasterPos2d,a0,a1);}
+FunctionTable::MEMBERPFNGLINITNAMESPROC m_next_glInitNames = nullptr;
+void m_glInitNames_profile()const{return this->m_profile(1869,m_next_glInitNames);}
+FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC m_next_glBinormal3fvEXT = nullptr;
+void m_glBinormal3fvEXT_profile(const GLfloat* a0)const{return this->m_profile(1870,m_next_glBinormal3fvEXT,a0);}
+FunctionTable::MEMBERPFNGLCOLOR3DVPROC m_next_glColor3dv = nullptr;
+void m_glColor3dv_profile(const GLdouble* a0)const{return this->m_profile(1871,m_next_glColor3dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC m_next_glVertexArrayVertexAttribDivisorEXT = nullptr;
+void m_glVertexArrayVertexAttribDivisorEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(1872,m_next_glVertexArrayVertexAttribDivisorEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC m_next_glArrayElementEXT = nullptr;
+void m_glArrayElementEXT_profile(GLint a0)const{return this->m_profile(1873,m_next_glArrayElementEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC m_next_glProgramParameter4dNV = nullptr;
+void m_glProgramParameter4dNV_profile(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(1874,m_next_glProgramParameter4dNV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLINDEXXOESPROC m_next_glIndexxOES = nullptr;
+void m_glIndexxOES_profile(GLfixed a0)const{return this->m_profile(1875,m_next_glIndexxOES,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC m_next_glUniform3uivEXT = nullptr;
+void m_glUniform3uivEXT_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(1876,m_next_glUniform3uivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC m_next_glPopGroupMarkerEXT = nullptr;
+void m_glPopGroupMarkerEXT_profile()const{return this->m_profile(1877,m_next_glPopGroupMarkerEXT);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC m_next_glClearNamedFramebufferuiv = nullptr;
+void m_glClearNamedFramebufferuiv_profile(GLuint a0,GLenum a1,GLint a2,const GLuint* a3)const{return this->m_profile(1878,m_next_glClearNamedFramebufferuiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC m_next_glSetLocalConstantEXT = nullptr;
+void m_glSetLocalConstantEXT_profile(GLuint a0,GLenum a1,const void* a2)const{return this->m_profile(1879,m_next_glSetLocalConstantEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC m_next_glProgramUniform1ui64NV = nullptr;
+void m_glProgramUniform1ui64NV_profile(GLuint a0,GLint a1,GLuint64EXT a2)const{return this->m_profile(1880,m_next_glProgramUniform1ui64NV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC m_next_glColor4hvNV = nullptr;
+void m_glColor4hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1881,m_next_glColor4hvNV,a0);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC m_next_glGetVertexAttribfv = nullptr;
+void m_glGetVertexAttribfv_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(1882,m_next_glGetVertexAttribfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC m_next_glDispatchCompute = nullptr;
+void m_glDispatchCompute_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(1883,m_next_glDispatchCompute,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC m_next_glGetActiveAttrib = nullptr;
+void m_glGetActiveAttrib_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLint* a4,GLenum* a5,GLchar* a6)const{return this->m_profile(1884,m_next_glGetActiveAttrib,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC m_next_glFragmentColorMaterialSGIX = nullptr;
+void m_glFragmentColorMaterialSGIX_profile(GLenum a0,GLenum a1)const{return this->m_profile(1885,m_next_glFragmentColorMaterialSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC m_next_glTexSubImage2D = nullptr;
+void m_glTexSubImage2D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const GLvoid* a8)const{return this->m_profile(1886,m_next_glTexSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC m_next_glGetnMinmaxARB = nullptr;
+void m_glGetnMinmaxARB_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(1887,m_next_glGetnMinmaxARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLLOGICOPPROC m_next_glLogicOp = nullptr;
+void m_glLogicOp_profile(GLenum a0)const{return this->m_profile(1888,m_next_glLogicOp,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC m_next_glProgramUniformMatrix3x4fv = nullptr;
+void m_glProgramUniformMatrix3x4fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(1889,m_next_glProgramUniformMatrix3x4fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC m_next_glWindowPos4iMESA = nullptr;
+void m_glWindowPos4iMESA_profile(GLint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1890,m_next_glWindowPos4iMESA,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC m_next_glPixelTransferf = nullptr;
+void m_glPixelTransferf_profile(GLenum a0,GLfloat a1)const{return this->m_profile(1891,m_next_glPixelTransferf,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC m_next_glGetTextureParameterIuiv = nullptr;
+void m_glGetTextureParameterIuiv_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(1892,m_next_glGetTextureParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC m_next_glMultiTexCoord1xOES = nullptr;
+void m_glMultiTexCoord1xOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(1893,m_next_glMultiTexCoord1xOES,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC m_next_glProgramUniformMatrix4dv = nullptr;
+void m_glProgramUniformMatrix4dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1894,m_next_glProgramUniformMatrix4dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC m_next_glGetnUniformiv = nullptr;
+void m_glGetnUniformiv_profile(GLuint a0,GLint a1,GLsizei a2,GLint* a3)const{return this->m_profile(1895,m_next_glGetnUniformiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC m_next_glFramebufferTexture1DEXT = nullptr;
+void m_glFramebufferTexture1DEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(1896,m_next_glFramebufferTexture1DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC m_next_glVertexPointervINTEL = nullptr;
+void m_glVertexPointervINTEL_profile(GLint a0,GLenum a1,const void** a2)const{return this->m_profile(1897,m_next_glVertexPointervINTEL,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC m_next_glTextureParameterIiv = nullptr;
+void m_glTextureParameterIiv_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(1898,m_next_glTextureParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC m_next_glGetSeparableFilterEXT = nullptr;
+void m_glGetSeparableFilterEXT_profile(GLenum a0,GLenum a1,GLenum a2,void* a3,void* a4,void* a5)const{return this->m_profile(1899,m_next_glGetSeparableFilterEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC m_next_glMultiTexCoord3iARB = nullptr;
+void m_glMultiTexCoord3iARB_profile(GLenum a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(1900,m_next_glMultiTexCoord3iARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC m_next_glRasterPos4xvOES = nullptr;
+void m_glRasterPos4xvOES_profile(const GLfixed* a0)const{return this->m_profile(1901,m_next_glRasterPos4xvOES,a0);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC m_next_glDrawTransformFeedbackStream = nullptr;
+void m_glDrawTransformFeedbackStream_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(1902,m_next_glDrawTransformFeedbackStream,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC m_next_glVertex3hvNV = nullptr;
+void m_glVertex3hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(1903,m_next_glVertex3hvNV,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC m_next_glVertexArrayMultiTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayMultiTexCoordOffsetEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{return this->m_profile(1904,m_next_glVertexArrayMultiTexCoordOffsetEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC m_next_glProvokingVertex = nullptr;
+void m_glProvokingVertex_profile(GLenum a0)const{return this->m_profile(1905,m_next_glProvokingVertex,a0);}
+FunctionTable::MEMBERPFNGLACCUMXOESPROC m_next_glAccumxOES = nullptr;
+void m_glAccumxOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(1906,m_next_glAccumxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSHADERBINARYPROC m_next_glShaderBinary = nullptr;
+void m_glShaderBinary_profile(GLsizei a0,const GLuint* a1,GLenum a2,const void* a3,GLsizei a4)const{return this->m_profile(1907,m_next_glShaderBinary,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC m_next_glGetMultiTexGenivEXT = nullptr;
+void m_glGetMultiTexGenivEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(1908,m_next_glGetMultiTexGenivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC m_next_glPointParameterxvOES = nullptr;
+void m_glPointParameterxvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(1909,m_next_glPointParameterxvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATESTATESNVPROC m_next_glCreateStatesNV = nullptr;
+void m_glCreateStatesNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(1910,m_next_glCreateStatesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC m_next_glClearDepthdNV = nullptr;
+void m_glClearDepthdNV_profile(GLdouble a0)const{return this->m_profile(1911,m_next_glClearDepthdNV,a0);}
+FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC m_next_glClearColorIuiEXT = nullptr;
+void m_glClearColorIuiEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(1912,m_next_glClearColorIuiEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC m_next_glBindMultiTextureEXT = nullptr;
+void m_glBindMultiTextureEXT_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(1913,m_next_glBindMultiTextureEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXGENIVPROC m_next_glTexGeniv = nullptr;
+void m_glTexGeniv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(1914,m_next_glTexGeniv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC m_next_glDrawElements = nullptr;
+void m_glDrawElements_profile(GLenum a0,GLsizei a1,GLenum a2,const GLvoid* a3)const{return this->m_profile(1915,m_next_glDrawElements,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC m_next_glProgramUniform4iv = nullptr;
+void m_glProgramUniform4iv_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1916,m_next_glProgramUniform4iv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC m_next_glDisableVertexArrayEXT = nullptr;
+void m_glDisableVertexArrayEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(1917,m_next_glDisableVertexArrayEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC m_next_glProgramUniform3ui64NV = nullptr;
+void m_glProgramUniform3ui64NV_profile(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{return this->m_profile(1918,m_next_glProgramUniform3ui64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC m_next_glClientActiveTexture = nullptr;
+void m_glClientActiveTexture_profile(GLenum a0)const{return this->m_profile(1919,m_next_glClientActiveTexture,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC m_next_glMultiTexParameterIivEXT = nullptr;
+void m_glMultiTexParameterIivEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(1920,m_next_glMultiTexParameterIivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC m_next_glUniform1i64ARB = nullptr;
+void m_glUniform1i64ARB_profile(GLint a0,GLint64 a1)const{return this->m_profile(1921,m_next_glUniform1i64ARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM1IVPROC m_next_glUniform1iv = nullptr;
+void m_glUniform1iv_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(1922,m_next_glUniform1iv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC m_next_glMulticastBarrierNV = nullptr;
+void m_glMulticastBarrierNV_profile()const{return this->m_profile(1923,m_next_glMulticastBarrierNV);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC m_next_glVertexAttribArrayObjectATI = nullptr;
+void m_glVertexAttribArrayObjectATI_profile(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,GLuint a5,GLuint a6)const{return this->m_profile(1924,m_next_glVertexAttribArrayObjectATI,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC m_next_glUniform2iARB = nullptr;
+void m_glUniform2iARB_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(1925,m_next_glUniform2iARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC m_next_glDrawArraysInstanced = nullptr;
+void m_glDrawArraysInstanced_profile(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(1926,m_next_glDrawArraysInstanced,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC m_next_glVertexAttrib2sNV = nullptr;
+void m_glVertexAttrib2sNV_profile(GLuint a0,GLshort a1,GLshort a2)const{return this->m_profile(1927,m_next_glVertexAttrib2sNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC m_next_glTexBufferEXT = nullptr;
+void m_glTexBufferEXT_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(1928,m_next_glTexBufferEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC m_next_glVertexStream2fATI = nullptr;
+void m_glVertexStream2fATI_profile(GLenum a0,GLfloat a1,GLfloat a2)const{return this->m_profile(1929,m_next_glVertexStream2fATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC m_next_glDebugMessageCallbackAMD = nullptr;
+void m_glDebugMessageCallbackAMD_profile(GLDEBUGPROCAMD a0,void* a1)const{return this->m_profile(1930,m_next_glDebugMessageCallbackAMD,a0,a1);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC m_next_glSamplerParameteriv = nullptr;
+void m_glSamplerParameteriv_profile(GLuint a0,GLenum a1,const GLint* a2)const{return this->m_profile(1931,m_next_glSamplerParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC m_next_glVertexAttrib4uiv = nullptr;
+void m_glVertexAttrib4uiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(1932,m_next_glVertexAttrib4uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC m_next_glEndQueryIndexed = nullptr;
+void m_glEndQueryIndexed_profile(GLenum a0,GLuint a1)const{return this->m_profile(1933,m_next_glEndQueryIndexed,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC m_next_glNormalStream3sATI = nullptr;
+void m_glNormalStream3sATI_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(1934,m_next_glNormalStream3sATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC m_next_glProgramParameteriARB = nullptr;
+void m_glProgramParameteriARB_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(1935,m_next_glProgramParameteriARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXENVXOESPROC m_next_glTexEnvxOES = nullptr;
+void m_glTexEnvxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(1936,m_next_glTexEnvxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC m_next_glProgramUniform1iv = nullptr;
+void m_glProgramUniform1iv_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(1937,m_next_glProgramUniform1iv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC m_next_glDisableVertexAttribAPPLE = nullptr;
+void m_glDisableVertexAttribAPPLE_profile(GLuint a0,GLenum a1)const{return this->m_profile(1938,m_next_glDisableVertexAttribAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC m_next_glBindRenderbuffer = nullptr;
+void m_glBindRenderbuffer_profile(GLenum a0,GLuint a1)const{return this->m_profile(1939,m_next_glBindRenderbuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC m_next_glMultiTexSubImage3DEXT = nullptr;
+void m_glMultiTexSubImage3DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLenum a10,const void* a11)const{return this->m_profile(1940,m_next_glMultiTexSubImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLISPROGRAMPROC m_next_glIsProgram = nullptr;
+GLboolean m_glIsProgram_profile(GLuint a0)const{return this->m_profile(1941,m_next_glIsProgram,a0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC m_next_glMultiDrawElementsIndirectAMD = nullptr;
+void m_glMultiDrawElementsIndirectAMD_profile(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4)const{return this->m_profile(1942,m_next_glMultiDrawElementsIndirectAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC m_next_glGetProgramInfoLog = nullptr;
+void m_glGetProgramInfoLog_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(1943,m_next_glGetProgramInfoLog,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC m_next_glGetLocalConstantBooleanvEXT = nullptr;
+void m_glGetLocalConstantBooleanvEXT_profile(GLuint a0,GLenum a1,GLboolean* a2)const{return this->m_profile(1944,m_next_glGetLocalConstantBooleanvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC m_next_glPixelTransformParameteriEXT = nullptr;
+void m_glPixelTransformParameteriEXT_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(1945,m_next_glPixelTransformParameteriEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC m_next_glTexCoord4bOES = nullptr;
+void m_glTexCoord4bOES_profile(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{return this->m_profile(1946,m_next_glTexCoord4bOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC m_next_glVertexAttrib4fv = nullptr;
+void m_glVertexAttrib4fv_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(1947,m_next_glVertexAttrib4fv,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC m_next_glProgramUniformMatrix2x3dv = nullptr;
+void m_glProgramUniformMatrix2x3dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(1948,m_next_glProgramUniformMatrix2x3dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC m_next_glProgramEnvParametersI4uivNV = nullptr;
+void m_glProgramEnvParametersI4uivNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(1949,m_next_glProgramEnvParametersI4uivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC m_next_glTexCoord3xOES = nullptr;
+void m_glTexCoord3xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(1950,m_next_glTexCoord3xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC m_next_glLoadTransposeMatrixfARB = nullptr;
+void m_glLoadTransposeMatrixfARB_profile(const GLfloat* a0)const{return this->m_profile(1951,m_next_glLoadTransposeMatrixfARB,a0);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC m_next_glImageTransformParameteriHP = nullptr;
+void m_glImageTransformParameteriHP_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(1952,m_next_glImageTransformParameteriHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC m_next_glMultiTexCoord4xOES = nullptr;
+void m_glMultiTexCoord4xOES_profile(GLenum a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4)const{return this->m_profile(1953,m_next_glMultiTexCoord4xOES,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC m_next_glVertexAttribs3fvNV = nullptr;
+void m_glVertexAttribs3fvNV_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(1954,m_next_glVertexAttribs3fvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC m_next_glVertexAttrib2fv = nullptr;
+void m_glVertexAttrib2fv_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(1955,m_next_glVertexAttrib2fv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC m_next_glUniform3ui64NV = nullptr;
+void m_glUniform3ui64NV_profile(GLint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3)const{return this->m_profile(1956,m_next_glUniform3ui64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC m_next_glCombinerParameterfvNV = nullptr;
+void m_glCombinerParameterfvNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(1957,m_next_glCombinerParameterfvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC m_next_glFragmentMaterialiSGIX = nullptr;
+void m_glFragmentMaterialiSGIX_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(1958,m_next_glFragmentMaterialiSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC m_next_glGetBooleani_v = nullptr;
+void m_glGetBooleani_v_profile(GLenum a0,GLuint a1,GLboolean* a2)const{return this->m_profile(1959,m_next_glGetBooleani_v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC m_next_glGetProgramResourceIndex = nullptr;
+GLuint m_glGetProgramResourceIndex_profile(GLuint a0,GLenum a1,const GLchar* a2)const{return this->m_profile(1960,m_next_glGetProgramResourceIndex,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC m_next_glBeginConditionalRenderNV = nullptr;
+void m_glBeginConditionalRenderNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(1961,m_next_glBeginConditionalRenderNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC m_next_glDisableClientState = nullptr;
+void m_glDisableClientState_profile(GLenum a0)const{return this->m_profile(1962,m_next_glDisableClientState,a0);}
+FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC m_next_glPathFogGenNV = nullptr;
+void m_glPathFogGenNV_profile(GLenum a0)const{return this->m_profile(1963,m_next_glPathFogGenNV,a0);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC m_next_glStencilThenCoverFillPathNV = nullptr;
+void m_glStencilThenCoverFillPathNV_profile(GLuint a0,GLenum a1,GLuint a2,GLenum a3)const{return this->m_profile(1964,m_next_glStencilThenCoverFillPathNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC m_next_glVertexArrayIndexOffsetEXT = nullptr;
+void m_glVertexArrayIndexOffsetEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{return this->m_profile(1965,m_next_glVertexArrayIndexOffsetEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC m_next_glProgramBufferParametersIuivNV = nullptr;
+void m_glProgramBufferParametersIuivNV_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLuint* a4)const{return this->m_profile(1966,m_next_glProgramBufferParametersIuivNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC m_next_glPixelTransformParameterivEXT = nullptr;
+void m_glPixelTransformParameterivEXT_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(1967,m_next_glPixelTransformParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC m_next_glDisableClientStateiEXT = nullptr;
+void m_glDisableClientStateiEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(1968,m_next_glDisableClientStateiEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC m_next_glTexBufferARB = nullptr;
+void m_glTexBufferARB_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(1969,m_next_glTexBufferARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC m_next_glGetLocalConstantIntegervEXT = nullptr;
+void m_glGetLocalConstantIntegervEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1970,m_next_glGetLocalConstantIntegervEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4UIVPROC m_next_glColor4uiv = nullptr;
+void m_glColor4uiv_profile(const GLuint* a0)const{return this->m_profile(1971,m_next_glColor4uiv,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC m_next_glProgramUniform3i = nullptr;
+void m_glProgramUniform3i_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(1972,m_next_glProgramUniform3i,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC m_next_glMultiDrawElementsIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessCountNV_profile(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6)const{return this->m_profile(1973,m_next_glMultiDrawElementsIndirectBindlessCountNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC m_next_glGetBufferPointervARB = nullptr;
+void m_glGetBufferPointervARB_profile(GLenum a0,GLenum a1,void** a2)const{return this->m_profile(1974,m_next_glGetBufferPointervARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC m_next_glMultiTexParameterIuivEXT = nullptr;
+void m_glMultiTexParameterIuivEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLuint* a3)const{return this->m_profile(1975,m_next_glMultiTexParameterIuivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLEVALMESH2PROC m_next_glEvalMesh2 = nullptr;
+void m_glEvalMesh2_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(1976,m_next_glEvalMesh2,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLEVALMESH1PROC m_next_glEvalMesh1 = nullptr;
+void m_glEvalMesh1_profile(GLenum a0,GLint a1,GLint a2)const{return this->m_profile(1977,m_next_glEvalMesh1,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC m_next_glProgramUniform3f = nullptr;
+void m_glProgramUniform3f_profile(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(1978,m_next_glProgramUniform3f,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC m_next_glStencilThenCoverFillPathInstancedNV = nullptr;
+void m_glStencilThenCoverFillPathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLuint a5,GLenum a6,GLenum a7,const GLfloat* a8)const{return this->m_profile(1979,m_next_glStencilThenCoverFillPathInstancedNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC m_next_glProgramUniform3d = nullptr;
+void m_glProgramUniform3d_profile(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(1980,m_next_glProgramUniform3d,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC m_next_glMapVertexAttrib1dAPPLE = nullptr;
+void m_glMapVertexAttrib1dAPPLE_profile(GLuint a0,GLuint a1,GLdouble a2,GLdouble a3,GLint a4,GLint a5,const GLdouble* a6)const{return this->m_profile(1981,m_next_glMapVertexAttrib1dAPPLE,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC m_next_glEvalCoord2fv = nullptr;
+void m_glEvalCoord2fv_profile(const GLfloat* a0)const{return this->m_profile(1982,m_next_glEvalCoord2fv,a0);}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC m_next_glGetUniformivARB = nullptr;
+void m_glGetUniformivARB_profile(GLhandleARB a0,GLint a1,GLint* a2)const{return this->m_profile(1983,m_next_glGetUniformivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC m_next_glLoadTransposeMatrixd = nullptr;
+void m_glLoadTransposeMatrixd_profile(const GLdouble* a0)const{return this->m_profile(1984,m_next_glLoadTransposeMatrixd,a0);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC m_next_glLoadTransposeMatrixf = nullptr;
+void m_glLoadTransposeMatrixf_profile(const GLfloat* a0)const{return this->m_profile(1985,m_next_glLoadTransposeMatrixf,a0);}
+FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC m_next_glGetPointervEXT = nullptr;
+void m_glGetPointervEXT_profile(GLenum a0,void** a1)const{return this->m_profile(1986,m_next_glGetPointervEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC m_next_glSignalVkSemaphoreNV = nullptr;
+void m_glSignalVkSemaphoreNV_profile(GLuint64 a0)const{return this->m_profile(1987,m_next_glSignalVkSemaphoreNV,a0);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC m_next_glEndConditionalRenderNV = nullptr;
+void m_glEndConditionalRenderNV_profile()const{return this->m_profile(1988,m_next_glEndConditionalRenderNV);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_next_glTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{return this->m_profile(1989,m_next_glTexCoord2fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC m_next_glUniform3i64vARB = nullptr;
+void m_glUniform3i64vARB_profile(GLint a0,GLsizei a1,const GLint64* a2)const{return this->m_profile(1990,m_next_glUniform3i64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC m_next_glProgramUniform2uiEXT = nullptr;
+void m_glProgramUniform2uiEXT_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3)const{return this->m_profile(1991,m_next_glProgramUniform2uiEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC m_next_glVertexAttribI1ui = nullptr;
+void m_glVertexAttribI1ui_profile(GLuint a0,GLuint a1)const{return this->m_profile(1992,m_next_glVertexAttribI1ui,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC m_next_glProgramNamedParameter4dvNV = nullptr;
+void m_glProgramNamedParameter4dvNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,const GLdouble* a3)const{return this->m_profile(1993,m_next_glProgramNamedParameter4dvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC m_next_glCompileCommandListNV = nullptr;
+void m_glCompileCommandListNV_profile(GLuint a0)const{return this->m_profile(1994,m_next_glCompileCommandListNV,a0);}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC m_next_glGetRenderbufferParameterivEXT = nullptr;
+void m_glGetRenderbufferParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(1995,m_next_glGetRenderbufferParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC m_next_glGetnPolygonStipple = nullptr;
+void m_glGetnPolygonStipple_profile(GLsizei a0,GLubyte* a1)const{return this->m_profile(1996,m_next_glGetnPolygonStipple,a0,a1);}
+FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC m_next_glIsBufferResidentNV = nullptr;
+GLboolean m_glIsBufferResidentNV_profile(GLenum a0)const{return this->m_profile(1997,m_next_glIsBufferResidentNV,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC m_next_glSecondaryColor3ubvEXT = nullptr;
+void m_glSecondaryColor3ubvEXT_profile(const GLubyte* a0)const{return this->m_profile(1998,m_next_glSecondaryColor3ubvEXT,a0);}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC m_next_glGetNamedRenderbufferParameterivEXT = nullptr;
+void m_glGetNamedRenderbufferParameterivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(1999,m_next_glGetNamedRenderbufferParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_next_glNamedFramebufferSampleLocationsfvARB = nullptr;
+void m_glNamedFramebufferSampleLocationsfvARB_profile(GLuint a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2000,m_next_glNamedFramebufferSampleLocationsfvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC m_next_glMultiTexGendvEXT = nullptr;
+void m_glMultiTexGendvEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLdouble* a3)const{return this->m_profile(2001,m_next_glMultiTexGendvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC m_next_glVertexArrayRangeNV = nullptr;
+void m_glVertexArrayRangeNV_profile(GLsizei a0,const void* a1)const{return this->m_profile(2002,m_next_glVertexArrayRangeNV,a0,a1);}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC m_next_glIsTextureHandleResidentNV = nullptr;
+GLboolean m_glIsTextureHandleResidentNV_profile(GLuint64 a0)const{return this->m_profile(2003,m_next_glIsTextureHandleResidentNV,a0);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC m_next_glGetProgramEnvParameterdvARB = nullptr;
+void m_glGetProgramEnvParameterdvARB_profile(GLenum a0,GLuint a1,GLdouble* a2)const{return this->m_profile(2004,m_next_glGetProgramEnvParameterdvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC m_next_glIsNamedStringARB = nullptr;
+GLboolean m_glIsNamedStringARB_profile(GLint a0,const GLchar* a1)const{return this->m_profile(2005,m_next_glIsNamedStringARB,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC m_next_glSecondaryColorFormatNV = nullptr;
+void m_glSecondaryColorFormatNV_profile(GLint a0,GLenum a1,GLsizei a2)const{return this->m_profile(2006,m_next_glSecondaryColorFormatNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC m_next_glVertexAttrib4ubvNV = nullptr;
+void m_glVertexAttrib4ubvNV_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(2007,m_next_glVertexAttrib4ubvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC m_next_glTagSampleBufferSGIX = nullptr;
+void m_glTagSampleBufferSGIX_profile()const{return this->m_profile(2008,m_next_glTagSampleBufferSGIX);}
+FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC m_next_glVDPAUUnregisterSurfaceNV = nullptr;
+void m_glVDPAUUnregisterSurfaceNV_profile(GLvdpauSurfaceNV a0)const{return this->m_profile(2009,m_next_glVDPAUUnregisterSurfaceNV,a0);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC m_next_glGetPerfQueryIdByNameINTEL = nullptr;
+void m_glGetPerfQueryIdByNameINTEL_profile(GLchar* a0,GLuint* a1)const{return this->m_profile(2010,m_next_glGetPerfQueryIdByNameINTEL,a0,a1);}
+FunctionTable::MEMBERPFNGLGETINTEGER64VPROC m_next_glGetInteger64v = nullptr;
+void m_glGetInteger64v_profile(GLenum a0,GLint64* a1)const{return this->m_profile(2011,m_next_glGetInteger64v,a0,a1);}
+FunctionTable::MEMBERPFNGLCLIPPLANEPROC m_next_glClipPlane = nullptr;
+void m_glClipPlane_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2012,m_next_glClipPlane,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC m_next_glColor4ubVertex3fSUN = nullptr;
+void m_glColor4ubVertex3fSUN_profile(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3,GLfloat a4,GLfloat a5,GLfloat a6)const{return this->m_profile(2013,m_next_glColor4ubVertex3fSUN,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLINDEXUBPROC m_next_glIndexub = nullptr;
+void m_glIndexub_profile(GLubyte a0)const{return this->m_profile(2014,m_next_glIndexub,a0);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC m_next_glGetProgramEnvParameterfvARB = nullptr;
+void m_glGetProgramEnvParameterfvARB_profile(GLenum a0,GLuint a1,GLfloat* a2)const{return this->m_profile(2015,m_next_glGetProgramEnvParameterfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC m_next_glVertexAttrib4usvARB = nullptr;
+void m_glVertexAttrib4usvARB_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(2016,m_next_glVertexAttrib4usvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC m_next_glNamedFramebufferRenderbuffer = nullptr;
+void m_glNamedFramebufferRenderbuffer_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(2017,m_next_glNamedFramebufferRenderbuffer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC m_next_glProgramUniformMatrix3x4dv = nullptr;
+void m_glProgramUniformMatrix3x4dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2018,m_next_glProgramUniformMatrix3x4dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC m_next_glTestFenceAPPLE = nullptr;
+GLboolean m_glTestFenceAPPLE_profile(GLuint a0)const{return this->m_profile(2019,m_next_glTestFenceAPPLE,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC m_next_glVertexAttrib4Niv = nullptr;
+void m_glVertexAttrib4Niv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2020,m_next_glVertexAttrib4Niv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC m_next_glVertexAttribL2i64vNV = nullptr;
+void m_glVertexAttribL2i64vNV_profile(GLuint a0,const GLint64EXT* a1)const{return this->m_profile(2021,m_next_glVertexAttribL2i64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLORP4UIVPROC m_next_glColorP4uiv = nullptr;
+void m_glColorP4uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(2022,m_next_glColorP4uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC m_next_glUniformMatrix2x3fv = nullptr;
+void m_glUniformMatrix2x3fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2023,m_next_glUniformMatrix2x3fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC m_next_glCallCommandListNV = nullptr;
+void m_glCallCommandListNV_profile(GLuint a0)const{return this->m_profile(2024,m_next_glCallCommandListNV,a0);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC m_next_glClearBufferiv = nullptr;
+void m_glClearBufferiv_profile(GLenum a0,GLint a1,const GLint* a2)const{return this->m_profile(2025,m_next_glClearBufferiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC m_next_glNamedStringARB = nullptr;
+void m_glNamedStringARB_profile(GLenum a0,GLint a1,const GLchar* a2,GLint a3,const GLchar* a4)const{return this->m_profile(2026,m_next_glNamedStringARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC m_next_glMatrixMult3x2fNV = nullptr;
+void m_glMatrixMult3x2fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2027,m_next_glMatrixMult3x2fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC m_next_glGetNamedProgramStringEXT = nullptr;
+void m_glGetNamedProgramStringEXT_profile(GLuint a0,GLenum a1,GLenum a2,void* a3)const{return this->m_profile(2028,m_next_glGetNamedProgramStringEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC m_next_glGetnHistogramARB = nullptr;
+void m_glGetnHistogramARB_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(2029,m_next_glGetnHistogramARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC m_next_glGetTextureLevelParameterfv = nullptr;
+void m_glGetTextureLevelParameterfv_profile(GLuint a0,GLint a1,GLenum a2,GLfloat* a3)const{return this->m_profile(2030,m_next_glGetTextureLevelParameterfv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC m_next_glMultiTexCoord1fv = nullptr;
+void m_glMultiTexCoord1fv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2031,m_next_glMultiTexCoord1fv,a0,a1);}
+FunctionTable::MEMBERPFNGLBITMAPXOESPROC m_next_glBitmapxOES = nullptr;
+void m_glBitmapxOES_profile(GLsizei a0,GLsizei a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5,const GLubyte* a6)const{return this->m_profile(2032,m_next_glBitmapxOES,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC m_next_glGetSamplerParameterIuiv = nullptr;
+void m_glGetSamplerParameterIuiv_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(2033,m_next_glGetSamplerParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC m_next_glTexCoordP3ui = nullptr;
+void m_glTexCoordP3ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(2034,m_next_glTexCoordP3ui,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC m_next_glTextureSubImage1D = nullptr;
+void m_glTextureSubImage1D_profile(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{return this->m_profile(2035,m_next_glTextureSubImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC m_next_glVertexAttribLPointerEXT = nullptr;
+void m_glVertexAttribLPointerEXT_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(2036,m_next_glVertexAttribLPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC m_next_glFogCoordPointerEXT = nullptr;
+void m_glFogCoordPointerEXT_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(2037,m_next_glFogCoordPointerEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC m_next_glWindowPos3s = nullptr;
+void m_glWindowPos3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(2038,m_next_glWindowPos3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC m_next_glVertexAttribs2svNV = nullptr;
+void m_glVertexAttribs2svNV_profile(GLuint a0,GLsizei a1,const GLshort* a2)const{return this->m_profile(2039,m_next_glVertexAttribs2svNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC m_next_glTextureImage3DEXT = nullptr;
+void m_glTextureImage3DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(2040,m_next_glTextureImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC m_next_glWindowPos3i = nullptr;
+void m_glWindowPos3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(2041,m_next_glWindowPos3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC m_next_glWindowPos3d = nullptr;
+void m_glWindowPos3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2042,m_next_glWindowPos3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC m_next_glWindowPos3f = nullptr;
+void m_glWindowPos3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2043,m_next_glWindowPos3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC m_next_glIsEnabledIndexedEXT = nullptr;
+GLboolean m_glIsEnabledIndexedEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(2044,m_next_glIsEnabledIndexedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC m_next_glGetNamedProgramivEXT = nullptr;
+void m_glGetNamedProgramivEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(2045,m_next_glGetNamedProgramivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC m_next_glVertex3xvOES = nullptr;
+void m_glVertex3xvOES_profile(const GLfixed* a0)const{return this->m_profile(2046,m_next_glVertex3xvOES,a0);}
+FunctionTable::MEMBERPFNGLCOLOR3USPROC m_next_glColor3us = nullptr;
+void m_glColor3us_profile(GLushort a0,GLushort a1,GLushort a2)const{return this->m_profile(2047,m_next_glColor3us,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC m_next_glBeginPerfMonitorAMD = nullptr;
+void m_glBeginPerfMonitorAMD_profile(GLuint a0)const{return this->m_profile(2048,m_next_glBeginPerfMonitorAMD,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC m_next_glProgramUniformMatrix4x3dv = nullptr;
+void m_glProgramUniformMatrix4x3dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2049,m_next_glProgramUniformMatrix4x3dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC m_next_glGetNamedProgramLocalParameterIuivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIuivEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLuint* a3)const{return this->m_profile(2050,m_next_glGetNamedProgramLocalParameterIuivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLREADNPIXELSPROC m_next_glReadnPixels = nullptr;
+void m_glReadnPixels_profile(GLint a0,GLint a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,GLsizei a6,void* a7)const{return this->m_profile(2051,m_next_glReadnPixels,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC m_next_glMultiTexCoord4f = nullptr;
+void m_glMultiTexCoord4f_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(2052,m_next_glMultiTexCoord4f,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCOLOR3UBPROC m_next_glColor3ub = nullptr;
+void m_glColor3ub_profile(GLubyte a0,GLubyte a1,GLubyte a2)const{return this->m_profile(2053,m_next_glColor3ub,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC m_next_glMultiTexCoord4d = nullptr;
+void m_glMultiTexCoord4d_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(2054,m_next_glMultiTexCoord4d,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC m_next_glVertexAttribL3ui64NV = nullptr;
+void m_glVertexAttribL3ui64NV_profile(GLuint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3)const{return this->m_profile(2055,m_next_glVertexAttribL3ui64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR3UIPROC m_next_glColor3ui = nullptr;
+void m_glColor3ui_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2056,m_next_glColor3ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC m_next_glProgramUniform4fvEXT = nullptr;
+void m_glProgramUniform4fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2057,m_next_glProgramUniform4fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC m_next_glVertexAttrib2sARB = nullptr;
+void m_glVertexAttrib2sARB_profile(GLuint a0,GLshort a1,GLshort a2)const{return this->m_profile(2058,m_next_glVertexAttrib2sARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC m_next_glMultiTexCoord4i = nullptr;
+void m_glMultiTexCoord4i_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(2059,m_next_glMultiTexCoord4i,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC m_next_glCheckFramebufferStatusEXT = nullptr;
+GLenum m_glCheckFramebufferStatusEXT_profile(GLenum a0)const{return this->m_profile(2060,m_next_glCheckFramebufferStatusEXT,a0);}
+FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC m_next_glGetnMapivARB = nullptr;
+void m_glGetnMapivARB_profile(GLenum a0,GLenum a1,GLsizei a2,GLint* a3)const{return this->m_profile(2061,m_next_glGetnMapivARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC m_next_glMultiTexCoord1ivARB = nullptr;
+void m_glMultiTexCoord1ivARB_profile(GLenum a0,const GLint* a1)const{return this->m_profile(2062,m_next_glMultiTexCoord1ivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC m_next_glDisableVertexAttribArrayARB = nullptr;
+void m_glDisableVertexAttribArrayARB_profile(GLuint a0)const{return this->m_profile(2063,m_next_glDisableVertexAttribArrayARB,a0);}
+FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC m_next_glGetPolygonStipple = nullptr;
+void m_glGetPolygonStipple_profile(GLubyte* a0)const{return this->m_profile(2064,m_next_glGetPolygonStipple,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC m_next_glVertexAttribI4ui = nullptr;
+void m_glVertexAttribI4ui_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(2065,m_next_glVertexAttribI4ui,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC m_next_glGetPathDashArrayNV = nullptr;
+void m_glGetPathDashArrayNV_profile(GLuint a0,GLfloat* a1)const{return this->m_profile(2066,m_next_glGetPathDashArrayNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC m_next_glMultiTexRenderbufferEXT = nullptr;
+void m_glMultiTexRenderbufferEXT_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(2067,m_next_glMultiTexRenderbufferEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC m_next_glCopyTextureSubImage1D = nullptr;
+void m_glCopyTextureSubImage1D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{return this->m_profile(2068,m_next_glCopyTextureSubImage1D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC m_next_glDeleteOcclusionQueriesNV = nullptr;
+void m_glDeleteOcclusionQueriesNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2069,m_next_glDeleteOcclusionQueriesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC m_next_glVertex4hvNV = nullptr;
+void m_glVertex4hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(2070,m_next_glVertex4hvNV,a0);}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC m_next_glGetnTexImage = nullptr;
+void m_glGetnTexImage_profile(GLenum a0,GLint a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(2071,m_next_glGetnTexImage,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC m_next_glProgramLocalParameter4dARB = nullptr;
+void m_glProgramLocalParameter4dARB_profile(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{return this->m_profile(2072,m_next_glProgramLocalParameter4dARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC m_next_glBlendEquation = nullptr;
+void m_glBlendEquation_profile(GLenum a0)const{return this->m_profile(2073,m_next_glBlendEquation,a0);}
+FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC m_next_glUnlockArraysEXT = nullptr;
+void m_glUnlockArraysEXT_profile()const{return this->m_profile(2074,m_next_glUnlockArraysEXT);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC m_next_glGetQueryObjectui64vEXT = nullptr;
+void m_glGetQueryObjectui64vEXT_profile(GLuint a0,GLenum a1,GLuint64* a2)const{return this->m_profile(2075,m_next_glGetQueryObjectui64vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC m_next_glVertexAttribI4uivEXT = nullptr;
+void m_glVertexAttribI4uivEXT_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(2076,m_next_glVertexAttribI4uivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC m_next_glUniform1i64vNV = nullptr;
+void m_glUniform1i64vNV_profile(GLint a0,GLsizei a1,const GLint64EXT* a2)const{return this->m_profile(2077,m_next_glUniform1i64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC m_next_glMultiTexCoord3dv = nullptr;
+void m_glMultiTexCoord3dv_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2078,m_next_glMultiTexCoord3dv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4SVPROC m_next_glColor4sv = nullptr;
+void m_glColor4sv_profile(const GLshort* a0)const{return this->m_profile(2079,m_next_glColor4sv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC m_next_glVertexStream4ivATI = nullptr;
+void m_glVertexStream4ivATI_profile(GLenum a0,const GLint* a1)const{return this->m_profile(2080,m_next_glVertexStream4ivATI,a0,a1);}
+FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC m_next_glPopClientAttrib = nullptr;
+void m_glPopClientAttrib_profile()const{return this->m_profile(2081,m_next_glPopClientAttrib);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC m_next_glClearBufferData = nullptr;
+void m_glClearBufferData_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{return this->m_profile(2082,m_next_glClearBufferData,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC m_next_glGetProgramivNV = nullptr;
+void m_glGetProgramivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2083,m_next_glGetProgramivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC m_next_glBeginTransformFeedback = nullptr;
+void m_glBeginTransformFeedback_profile(GLenum a0)const{return this->m_profile(2084,m_next_glBeginTransformFeedback,a0);}
+FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC m_next_glFinishObjectAPPLE = nullptr;
+void m_glFinishObjectAPPLE_profile(GLenum a0,GLint a1)const{return this->m_profile(2085,m_next_glFinishObjectAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC m_next_glGetMinmaxParameterivEXT = nullptr;
+void m_glGetMinmaxParameterivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2086,m_next_glGetMinmaxParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR3IVPROC m_next_glColor3iv = nullptr;
+void m_glColor3iv_profile(const GLint* a0)const{return this->m_profile(2087,m_next_glColor3iv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC m_next_glVertexAttrib3sv = nullptr;
+void m_glVertexAttrib3sv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2088,m_next_glVertexAttrib3sv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC m_next_glCompressedTexImage1D = nullptr;
+void m_glCompressedTexImage1D_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLint a4,GLsizei a5,const GLvoid* a6)const{return this->m_profile(2089,m_next_glCompressedTexImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC m_next_glDeleteTransformFeedbacks = nullptr;
+void m_glDeleteTransformFeedbacks_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2090,m_next_glDeleteTransformFeedbacks,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC m_next_glGetVideoi64vNV = nullptr;
+void m_glGetVideoi64vNV_profile(GLuint a0,GLenum a1,GLint64EXT* a2)const{return this->m_profile(2091,m_next_glGetVideoi64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC m_next_glDrawRangeElementsBaseVertex = nullptr;
+void m_glDrawRangeElementsBaseVertex_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const void* a5,GLint a6)const{return this->m_profile(2092,m_next_glDrawRangeElementsBaseVertex,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC m_next_glUniform4i64vARB = nullptr;
+void m_glUniform4i64vARB_profile(GLint a0,GLsizei a1,const GLint64* a2)const{return this->m_profile(2093,m_next_glUniform4i64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC m_next_glTextureStorage3DMultisampleEXT = nullptr;
+void m_glTextureStorage3DMultisampleEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{return this->m_profile(2094,m_next_glTextureStorage3DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC m_next_glGetTexParameterfv = nullptr;
+void m_glGetTexParameterfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2095,m_next_glGetTexParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC m_next_glProgramUniformui64vNV = nullptr;
+void m_glProgramUniformui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{return this->m_profile(2096,m_next_glProgramUniformui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC m_next_glCompressedMultiTexImage1DEXT = nullptr;
+void m_glCompressedMultiTexImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{return this->m_profile(2097,m_next_glCompressedMultiTexImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC m_next_glProgramUniform2ivEXT = nullptr;
+void m_glProgramUniform2ivEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(2098,m_next_glProgramUniform2ivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC m_next_glPushGroupMarkerEXT = nullptr;
+void m_glPushGroupMarkerEXT_profile(GLsizei a0,const GLchar* a1)const{return this->m_profile(2099,m_next_glPushGroupMarkerEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC m_next_glVertexAttrib1dv = nullptr;
+void m_glVertexAttrib1dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2100,m_next_glVertexAttrib1dv,a0,a1);}
+FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC m_next_glMatrixLoadIdentityEXT = nullptr;
+void m_glMatrixLoadIdentityEXT_profile(GLenum a0)const{return this->m_profile(2101,m_next_glMatrixLoadIdentityEXT,a0);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC m_next_glMultTransposeMatrixxOES = nullptr;
+void m_glMultTransposeMatrixxOES_profile(const GLfixed* a0)const{return this->m_profile(2102,m_next_glMultTransposeMatrixxOES,a0);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC m_next_glGetPixelMapxv = nullptr;
+void m_glGetPixelMapxv_profile(GLenum a0,GLint a1,GLfixed* a2)const{return this->m_profile(2103,m_next_glGetPixelMapxv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_next_glFramebufferSampleLocationsfvARB = nullptr;
+void m_glFramebufferSampleLocationsfvARB_profile(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2104,m_next_glFramebufferSampleLocationsfvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETLIGHTIVPROC m_next_glGetLightiv = nullptr;
+void m_glGetLightiv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2105,m_next_glGetLightiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC m_next_glBlendFuncSeparatei = nullptr;
+void m_glBlendFuncSeparatei_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{return this->m_profile(2106,m_next_glBlendFuncSeparatei,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC m_next_glAcquireKeyedMutexWin32EXT = nullptr;
+GLboolean m_glAcquireKeyedMutexWin32EXT_profile(GLuint a0,GLuint64 a1,GLuint a2)const{return this->m_profile(2107,m_next_glAcquireKeyedMutexWin32EXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC m_next_glGetBooleanIndexedvEXT = nullptr;
+void m_glGetBooleanIndexedvEXT_profile(GLenum a0,GLuint a1,GLboolean* a2)const{return this->m_profile(2108,m_next_glGetBooleanIndexedvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC m_next_glGetProgramSubroutineParameteruivNV = nullptr;
+void m_glGetProgramSubroutineParameteruivNV_profile(GLenum a0,GLuint a1,GLuint* a2)const{return this->m_profile(2109,m_next_glGetProgramSubroutineParameteruivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIPROC m_next_glUniform2ui = nullptr;
+void m_glUniform2ui_profile(GLint a0,GLuint a1,GLuint a2)const{return this->m_profile(2110,m_next_glUniform2ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC m_next_glApplyFramebufferAttachmentCMAAINTEL = nullptr;
+void m_glApplyFramebufferAttachmentCMAAINTEL_profile()const{return this->m_profile(2111,m_next_glApplyFramebufferAttachmentCMAAINTEL);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC m_next_glWindowPos2fv = nullptr;
+void m_glWindowPos2fv_profile(const GLfloat* a0)const{return this->m_profile(2112,m_next_glWindowPos2fv,a0);}
+FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC m_next_glWaitVkSemaphoreNV = nullptr;
+void m_glWaitVkSemaphoreNV_profile(GLuint64 a0)const{return this->m_profile(2113,m_next_glWaitVkSemaphoreNV,a0);}
+FunctionTable::MEMBERPFNGLDISABLEIPROC m_next_glDisablei = nullptr;
+void m_glDisablei_profile(GLenum a0,GLuint a1)const{return this->m_profile(2114,m_next_glDisablei,a0,a1);}
+FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC m_next_glSelectPerfMonitorCountersAMD = nullptr;
+void m_glSelectPerfMonitorCountersAMD_profile(GLuint a0,GLboolean a1,GLuint a2,GLint a3,GLuint* a4)const{return this->m_profile(2115,m_next_glSelectPerfMonitorCountersAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC m_next_glGetVertexAttribLi64vNV = nullptr;
+void m_glGetVertexAttribLi64vNV_profile(GLuint a0,GLenum a1,GLint64EXT* a2)const{return this->m_profile(2116,m_next_glGetVertexAttribLi64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC m_next_glBlendFuncSeparateiARB = nullptr;
+void m_glBlendFuncSeparateiARB_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{return this->m_profile(2117,m_next_glBlendFuncSeparateiARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC m_next_glWeightuivARB = nullptr;
+void m_glWeightuivARB_profile(GLint a0,const GLuint* a1)const{return this->m_profile(2118,m_next_glWeightuivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC m_next_glWindowPos2iARB = nullptr;
+void m_glWindowPos2iARB_profile(GLint a0,GLint a1)const{return this->m_profile(2119,m_next_glWindowPos2iARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC m_next_glGetProgramLocalParameterdvARB = nullptr;
+void m_glGetProgramLocalParameterdvARB_profile(GLenum a0,GLuint a1,GLdouble* a2)const{return this->m_profile(2120,m_next_glGetProgramLocalParameterdvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC m_next_glGetUniformui64vARB = nullptr;
+void m_glGetUniformui64vARB_profile(GLuint a0,GLint a1,GLuint64* a2)const{return this->m_profile(2121,m_next_glGetUniformui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC m_next_glSecondaryColor3us = nullptr;
+void m_glSecondaryColor3us_profile(GLushort a0,GLushort a1,GLushort a2)const{return this->m_profile(2122,m_next_glSecondaryColor3us,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSYNCIVPROC m_next_glGetSynciv = nullptr;
+void m_glGetSynciv_profile(GLsync a0,GLenum a1,GLsizei a2,GLsizei* a3,GLint* a4)const{return this->m_profile(2123,m_next_glGetSynciv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC m_next_glMakeImageHandleResidentARB = nullptr;
+void m_glMakeImageHandleResidentARB_profile(GLuint64 a0,GLenum a1)const{return this->m_profile(2124,m_next_glMakeImageHandleResidentARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC m_next_glGetProgramNamedParameterfvNV = nullptr;
+void m_glGetProgramNamedParameterfvNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,GLfloat* a3)const{return this->m_profile(2125,m_next_glGetProgramNamedParameterfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC m_next_glTextureStorage3D = nullptr;
+void m_glTextureStorage3D_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2126,m_next_glTextureStorage3D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC m_next_glVertexAttrib4svNV = nullptr;
+void m_glVertexAttrib4svNV_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2127,m_next_glVertexAttrib4svNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC m_next_glProgramUniform2i = nullptr;
+void m_glProgramUniform2i_profile(GLuint a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(2128,m_next_glProgramUniform2i,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC m_next_glListDrawCommandsStatesClientNV = nullptr;
+void m_glListDrawCommandsStatesClientNV_profile(GLuint a0,GLuint a1,const void** a2,const GLsizei* a3,const GLuint* a4,const GLuint* a5,GLuint a6)const{return this->m_profile(2129,m_next_glListDrawCommandsStatesClientNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC m_next_glProgramLocalParametersI4uivNV = nullptr;
+void m_glProgramLocalParametersI4uivNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(2130,m_next_glProgramLocalParametersI4uivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC m_next_glBeginTransformFeedbackNV = nullptr;
+void m_glBeginTransformFeedbackNV_profile(GLenum a0)const{return this->m_profile(2131,m_next_glBeginTransformFeedbackNV,a0);}
+FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC m_next_glGetProgramBinary = nullptr;
+void m_glGetProgramBinary_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLenum* a3,void* a4)const{return this->m_profile(2132,m_next_glGetProgramBinary,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC m_next_glBinormal3iEXT = nullptr;
+void m_glBinormal3iEXT_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(2133,m_next_glBinormal3iEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLEVALPOINT1PROC m_next_glEvalPoint1 = nullptr;
+void m_glEvalPoint1_profile(GLint a0)const{return this->m_profile(2134,m_next_glEvalPoint1,a0);}
+FunctionTable::MEMBERPFNGLEVALPOINT2PROC m_next_glEvalPoint2 = nullptr;
+void m_glEvalPoint2_profile(GLint a0,GLint a1)const{return this->m_profile(2135,m_next_glEvalPoint2,a0,a1);}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC m_next_glPauseTransformFeedback = nullptr;
+void m_glPauseTransformFeedback_profile()const{return this->m_profile(2136,m_next_glPauseTransformFeedback);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC m_next_glWindowPos2sMESA = nullptr;
+void m_glWindowPos2sMESA_profile(GLshort a0,GLshort a1)const{return this->m_profile(2137,m_next_glWindowPos2sMESA,a0,a1);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC m_next_glGlobalAlphaFactorbSUN = nullptr;
+void m_glGlobalAlphaFactorbSUN_profile(GLbyte a0)const{return this->m_profile(2138,m_next_glGlobalAlphaFactorbSUN,a0);}
+FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC m_next_glCreateTransformFeedbacks = nullptr;
+void m_glCreateTransformFeedbacks_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2139,m_next_glCreateTransformFeedbacks,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC m_next_glTexturePageCommitmentEXT = nullptr;
+void m_glTexturePageCommitmentEXT_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{return this->m_profile(2140,m_next_glTexturePageCommitmentEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC m_next_glTransformFeedbackVaryingsNV = nullptr;
+void m_glTransformFeedbackVaryingsNV_profile(GLuint a0,GLsizei a1,const GLint* a2,GLenum a3)const{return this->m_profile(2141,m_next_glTransformFeedbackVaryingsNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC m_next_glTexSubImage1D = nullptr;
+void m_glTexSubImage1D_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6)const{return this->m_profile(2142,m_next_glTexSubImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC m_next_glConvolutionParameterfvEXT = nullptr;
+void m_glConvolutionParameterfvEXT_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2143,m_next_glConvolutionParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC m_next_glBlitFramebufferEXT = nullptr;
+void m_glBlitFramebufferEXT_profile(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLbitfield a8,GLenum a9)const{return this->m_profile(2144,m_next_glBlitFramebufferEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC m_next_glUniformMatrix4fvARB = nullptr;
+void m_glUniformMatrix4fvARB_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2145,m_next_glUniformMatrix4fvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC m_next_glProgramEnvParameter4dvARB = nullptr;
+void m_glProgramEnvParameter4dvARB_profile(GLenum a0,GLuint a1,const GLdouble* a2)const{return this->m_profile(2146,m_next_glProgramEnvParameter4dvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC m_next_glTextureStorageMem2DEXT = nullptr;
+void m_glTextureStorageMem2DEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLuint a5,GLuint64 a6)const{return this->m_profile(2147,m_next_glTextureStorageMem2DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC m_next_glVertexAttribP3uiv = nullptr;
+void m_glVertexAttribP3uiv_profile(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{return this->m_profile(2148,m_next_glVertexAttribP3uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC m_next_glFogCoordFormatNV = nullptr;
+void m_glFogCoordFormatNV_profile(GLenum a0,GLsizei a1)const{return this->m_profile(2149,m_next_glFogCoordFormatNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC m_next_glGetMultiTexLevelParameterivEXT = nullptr;
+void m_glGetMultiTexLevelParameterivEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLint* a4)const{return this->m_profile(2150,m_next_glGetMultiTexLevelParameterivEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC m_next_glIsOcclusionQueryNV = nullptr;
+GLboolean m_glIsOcclusionQueryNV_profile(GLuint a0)const{return this->m_profile(2151,m_next_glIsOcclusionQueryNV,a0);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC m_next_glCompressedTexImage2DARB = nullptr;
+void m_glCompressedTexImage2DARB_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{return this->m_profile(2152,m_next_glCompressedTexImage2DARB,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC m_next_glGetProgramEnvParameterIuivNV = nullptr;
+void m_glGetProgramEnvParameterIuivNV_profile(GLenum a0,GLuint a1,GLuint* a2)const{return this->m_profile(2153,m_next_glGetProgramEnvParameterIuivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC m_next_glVertexAttrib4sv = nullptr;
+void m_glVertexAttrib4sv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2154,m_next_glVertexAttrib4sv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC m_next_glVertexAttrib4fvARB = nullptr;
+void m_glVertexAttrib4fvARB_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(2155,m_next_glVertexAttrib4fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLLOADNAMEPROC m_next_glLoadName = nullptr;
+void m_glLoadName_profile(GLuint a0)const{return this->m_profile(2156,m_next_glLoadName,a0);}
+FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC m_next_glBindVertexShaderEXT = nullptr;
+void m_glBindVertexShaderEXT_profile(GLuint a0)const{return this->m_profile(2157,m_next_glBindVertexShaderEXT,a0);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC m_next_glGetNamedProgramLocalParameterIivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIivEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLint* a3)const{return this->m_profile(2158,m_next_glGetNamedProgramLocalParameterIivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC m_next_glProgramUniform3uiEXT = nullptr;
+void m_glProgramUniform3uiEXT_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(2159,m_next_glProgramUniform3uiEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC m_next_glProgramUniformMatrix4x2dvEXT = nullptr;
+void m_glProgramUniformMatrix4x2dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2160,m_next_glProgramUniformMatrix4x2dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC m_next_glTexCoord1hvNV = nullptr;
+void m_glTexCoord1hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(2161,m_next_glTexCoord1hvNV,a0);}
+FunctionTable::MEMBERPFNGLLOADMATRIXDPROC m_next_glLoadMatrixd = nullptr;
+void m_glLoadMatrixd_profile(const GLdouble* a0)const{return this->m_profile(2162,m_next_glLoadMatrixd,a0);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC m_next_glTexParameterfv = nullptr;
+void m_glTexParameterfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2163,m_next_glTexParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC m_next_glVariantdvEXT = nullptr;
+void m_glVariantdvEXT_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2164,m_next_glVariantdvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC m_next_glCullParameterfvEXT = nullptr;
+void m_glCullParameterfvEXT_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(2165,m_next_glCullParameterfvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM3DVPROC m_next_glUniform3dv = nullptr;
+void m_glUniform3dv_profile(GLint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(2166,m_next_glUniform3dv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC m_next_glProgramUniform3fv = nullptr;
+void m_glProgramUniform3fv_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2167,m_next_glProgramUniform3fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLISBUFFERARBPROC m_next_glIsBufferARB = nullptr;
+GLboolean m_glIsBufferARB_profile(GLuint a0)const{return this->m_profile(2168,m_next_glIsBufferARB,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC m_next_glMultiTexCoord1bOES = nullptr;
+void m_glMultiTexCoord1bOES_profile(GLenum a0,GLbyte a1)const{return this->m_profile(2169,m_next_glMultiTexCoord1bOES,a0,a1);}
+FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC m_next_glFogCoordhNV = nullptr;
+void m_glFogCoordhNV_profile(GLhalfNV a0)const{return this->m_profile(2170,m_next_glFogCoordhNV,a0);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_next_glFramebufferSampleLocationsfvNV = nullptr;
+void m_glFramebufferSampleLocationsfvNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2171,m_next_glFramebufferSampleLocationsfvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC m_next_glGenSymbolsEXT = nullptr;
+GLuint m_glGenSymbolsEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(2172,m_next_glGenSymbolsEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC m_next_glGetConvolutionFilter = nullptr;
+void m_glGetConvolutionFilter_profile(GLenum a0,GLenum a1,GLenum a2,GLvoid* a3)const{return this->m_profile(2173,m_next_glGetConvolutionFilter,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC m_next_glProgramUniform1fvEXT = nullptr;
+void m_glProgramUniform1fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2174,m_next_glProgramUniform1fvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC m_next_glGetNextPerfQueryIdINTEL = nullptr;
+void m_glGetNextPerfQueryIdINTEL_profile(GLuint a0,GLuint* a1)const{return this->m_profile(2175,m_next_glGetNextPerfQueryIdINTEL,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC m_next_glCompressedTexImage1DARB = nullptr;
+void m_glCompressedTexImage1DARB_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLint a4,GLsizei a5,const void* a6)const{return this->m_profile(2176,m_next_glCompressedTexImage1DARB,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC m_next_glBindSamplers = nullptr;
+void m_glBindSamplers_profile(GLuint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2177,m_next_glBindSamplers,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC m_next_glGetProgramEnvParameterIivNV = nullptr;
+void m_glGetProgramEnvParameterIivNV_profile(GLenum a0,GLuint a1,GLint* a2)const{return this->m_profile(2178,m_next_glGetProgramEnvParameterIivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC m_next_glGetQueryObjectui64v = nullptr;
+void m_glGetQueryObjectui64v_profile(GLuint a0,GLenum a1,GLuint64* a2)const{return this->m_profile(2179,m_next_glGetQueryObjectui64v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC m_next_glVertexAttribL4ui64vNV = nullptr;
+void m_glVertexAttribL4ui64vNV_profile(GLuint a0,const GLuint64EXT* a1)const{return this->m_profile(2180,m_next_glVertexAttribL4ui64vNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC m_next_glGetVideoivNV = nullptr;
+void m_glGetVideoivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2181,m_next_glGetVideoivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC m_next_glGetTextureImage = nullptr;
+void m_glGetTextureImage_profile(GLuint a0,GLint a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(2182,m_next_glGetTextureImage,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC m_next_glProgramUniform1fv = nullptr;
+void m_glProgramUniform1fv_profile(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2183,m_next_glProgramUniform1fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC m_next_glUniformMatrix4fv = nullptr;
+void m_glUniformMatrix4fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2184,m_next_glUniformMatrix4fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLORMASKPROC m_next_glColorMask = nullptr;
+void m_glColorMask_profile(GLboolean a0,GLboolean a1,GLboolean a2,GLboolean a3)const{return this->m_profile(2185,m_next_glColorMask,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC m_next_glBeginFragmentShaderATI = nullptr;
+void m_glBeginFragmentShaderATI_profile()const{return this->m_profile(2186,m_next_glBeginFragmentShaderATI);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC m_next_glMultiDrawArraysEXT = nullptr;
+void m_glMultiDrawArraysEXT_profile(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{return this->m_profile(2187,m_next_glMultiDrawArraysEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGENNAMESAMDPROC m_next_glGenNamesAMD = nullptr;
+void m_glGenNamesAMD_profile(GLenum a0,GLuint a1,GLuint* a2)const{return this->m_profile(2188,m_next_glGenNamesAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC m_next_glPathParameteriNV = nullptr;
+void m_glPathParameteriNV_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(2189,m_next_glPathParameteriNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC m_next_glCreateCommandListsNV = nullptr;
+void m_glCreateCommandListsNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2190,m_next_glCreateCommandListsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC m_next_glDeleteProgramPipelines = nullptr;
+void m_glDeleteProgramPipelines_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2191,m_next_glDeleteProgramPipelines,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC m_next_glCopyColorSubTableEXT = nullptr;
+void m_glCopyColorSubTableEXT_profile(GLenum a0,GLsizei a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(2192,m_next_glCopyColorSubTableEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC m_next_glVariantsvEXT = nullptr;
+void m_glVariantsvEXT_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2193,m_next_glVariantsvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC m_next_glGenProgramPipelines = nullptr;
+void m_glGenProgramPipelines_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2194,m_next_glGenProgramPipelines,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC m_next_glVertexArrayEdgeFlagOffsetEXT = nullptr;
+void m_glVertexArrayEdgeFlagOffsetEXT_profile(GLuint a0,GLuint a1,GLsizei a2,GLintptr a3)const{return this->m_profile(2195,m_next_glVertexArrayEdgeFlagOffsetEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC m_next_glWindowPos2s = nullptr;
+void m_glWindowPos2s_profile(GLshort a0,GLshort a1)const{return this->m_profile(2196,m_next_glWindowPos2s,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC m_next_glSecondaryColor3iEXT = nullptr;
+void m_glSecondaryColor3iEXT_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(2197,m_next_glSecondaryColor3iEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC m_next_glWindowPos2i = nullptr;
+void m_glWindowPos2i_profile(GLint a0,GLint a1)const{return this->m_profile(2198,m_next_glWindowPos2i,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC m_next_glWindowPos2f = nullptr;
+void m_glWindowPos2f_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(2199,m_next_glWindowPos2f,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC m_next_glWindowPos2d = nullptr;
+void m_glWindowPos2d_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(2200,m_next_glWindowPos2d,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC m_next_glUniform4uivEXT = nullptr;
+void m_glUniform4uivEXT_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2201,m_next_glUniform4uivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLORTHOXOESPROC m_next_glOrthoxOES = nullptr;
+void m_glOrthoxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5)const{return this->m_profile(2202,m_next_glOrthoxOES,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC m_next_glUniformSubroutinesuiv = nullptr;
+void m_glUniformSubroutinesuiv_profile(GLenum a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2203,m_next_glUniformSubroutinesuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRECTDVPROC m_next_glRectdv = nullptr;
+void m_glRectdv_profile(const GLdouble* a0,const GLdouble* a1)const{return this->m_profile(2204,m_next_glRectdv,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC m_next_glProgramUniform1i64vNV = nullptr;
+void m_glProgramUniform1i64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{return this->m_profile(2205,m_next_glProgramUniform1i64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC m_next_glVertexAttribI4uiEXT = nullptr;
+void m_glVertexAttribI4uiEXT_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(2206,m_next_glVertexAttribI4uiEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC m_next_glSecondaryColor3ubEXT = nullptr;
+void m_glSecondaryColor3ubEXT_profile(GLubyte a0,GLubyte a1,GLubyte a2)const{return this->m_profile(2207,m_next_glSecondaryColor3ubEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC m_next_glCompressedMultiTexSubImage1DEXT = nullptr;
+void m_glCompressedMultiTexSubImage1DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLsizei a6,const void* a7)const{return this->m_profile(2208,m_next_glCompressedMultiTexSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC m_next_glMultiTexGendEXT = nullptr;
+void m_glMultiTexGendEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLdouble a3)const{return this->m_profile(2209,m_next_glMultiTexGendEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLORP3UIVPROC m_next_glColorP3uiv = nullptr;
+void m_glColorP3uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(2210,m_next_glColorP3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLFOGCOORDFVPROC m_next_glFogCoordfv = nullptr;
+void m_glFogCoordfv_profile(const GLfloat* a0)const{return this->m_profile(2211,m_next_glFogCoordfv,a0);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERPROC m_next_glCompileShader = nullptr;
+void m_glCompileShader_profile(GLuint a0)const{return this->m_profile(2212,m_next_glCompileShader,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC m_next_glTexCoord2hNV = nullptr;
+void m_glTexCoord2hNV_profile(GLhalfNV a0,GLhalfNV a1)const{return this->m_profile(2213,m_next_glTexCoord2hNV,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC m_next_glUniform1uivEXT = nullptr;
+void m_glUniform1uivEXT_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2214,m_next_glUniform1uivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC m_next_glMatrixLoadTransposedEXT = nullptr;
+void m_glMatrixLoadTransposedEXT_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2215,m_next_glMatrixLoadTransposedEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLINDEXFVPROC m_next_glIndexfv = nullptr;
+void m_glIndexfv_profile(const GLfloat* a0)const{return this->m_profile(2216,m_next_glIndexfv,a0);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC m_next_glGetCompressedTextureImage = nullptr;
+void m_glGetCompressedTextureImage_profile(GLuint a0,GLint a1,GLsizei a2,void* a3)const{return this->m_profile(2217,m_next_glGetCompressedTextureImage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC m_next_glGetUniformuivEXT = nullptr;
+void m_glGetUniformuivEXT_profile(GLuint a0,GLint a1,GLuint* a2)const{return this->m_profile(2218,m_next_glGetUniformuivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC m_next_glGetnPixelMapfvARB = nullptr;
+void m_glGetnPixelMapfvARB_profile(GLenum a0,GLsizei a1,GLfloat* a2)const{return this->m_profile(2219,m_next_glGetnPixelMapfvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC m_next_glFramebufferTextureEXT = nullptr;
+void m_glFramebufferTextureEXT_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{return this->m_profile(2220,m_next_glFramebufferTextureEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC m_next_glMultiDrawElementsIndirectCount = nullptr;
+void m_glMultiDrawElementsIndirectCount_profile(GLenum a0,GLenum a1,const void* a2,GLintptr a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2221,m_next_glMultiDrawElementsIndirectCount,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC m_next_glVertexAttribIPointer = nullptr;
+void m_glVertexAttribIPointer_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(2222,m_next_glVertexAttribIPointer,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC m_next_glMultiTexCoordP3ui = nullptr;
+void m_glMultiTexCoordP3ui_profile(GLenum a0,GLenum a1,GLuint a2)const{return this->m_profile(2223,m_next_glMultiTexCoordP3ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC m_next_glEvaluateDepthValuesARB = nullptr;
+void m_glEvaluateDepthValuesARB_profile()const{return this->m_profile(2224,m_next_glEvaluateDepthValuesARB);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC m_next_glGetNamedBufferParameteriv = nullptr;
+void m_glGetNamedBufferParameteriv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2225,m_next_glGetNamedBufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC m_next_glGetNamedProgramLocalParameterfvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterfvEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLfloat* a3)const{return this->m_profile(2226,m_next_glGetNamedProgramLocalParameterfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_next_glColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glColor4fNormal3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{return this->m_profile(2227,m_next_glColor4fNormal3fVertex3fvSUN,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC m_next_glSeparableFilter2DEXT = nullptr;
+void m_glSeparableFilter2DEXT_profile(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6,const void* a7)const{return this->m_profile(2228,m_next_glSeparableFilter2DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC m_next_glTexParameterxOES = nullptr;
+void m_glTexParameterxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(2229,m_next_glTexParameterxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC m_next_glClearAccumxOES = nullptr;
+void m_glClearAccumxOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(2230,m_next_glClearAccumxOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC m_next_glInvalidateFramebuffer = nullptr;
+void m_glInvalidateFramebuffer_profile(GLenum a0,GLsizei a1,const GLenum* a2)const{return this->m_profile(2231,m_next_glInvalidateFramebuffer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC m_next_glWeightubvARB = nullptr;
+void m_glWeightubvARB_profile(GLint a0,const GLubyte* a1)const{return this->m_profile(2232,m_next_glWeightubvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC m_next_glVertexAttrib1d = nullptr;
+void m_glVertexAttrib1d_profile(GLuint a0,GLdouble a1)const{return this->m_profile(2233,m_next_glVertexAttrib1d,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC m_next_glVertexAttrib1f = nullptr;
+void m_glVertexAttrib1f_profile(GLuint a0,GLfloat a1)const{return this->m_profile(2234,m_next_glVertexAttrib1f,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX4FVPROC m_next_glVertex4fv = nullptr;
+void m_glVertex4fv_profile(const GLfloat* a0)const{return this->m_profile(2235,m_next_glVertex4fv,a0);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC m_next_glClearNamedFramebufferfi = nullptr;
+void m_glClearNamedFramebufferfi_profile(GLuint a0,GLenum a1,GLint a2,GLfloat a3,GLint a4)const{return this->m_profile(2236,m_next_glClearNamedFramebufferfi,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC m_next_glGetQueryBufferObjectuiv = nullptr;
+void m_glGetQueryBufferObjectuiv_profile(GLuint a0,GLuint a1,GLenum a2,GLintptr a3)const{return this->m_profile(2237,m_next_glGetQueryBufferObjectuiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC m_next_glClearNamedFramebufferfv = nullptr;
+void m_glClearNamedFramebufferfv_profile(GLuint a0,GLenum a1,GLint a2,const GLfloat* a3)const{return this->m_profile(2238,m_next_glClearNamedFramebufferfv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC m_next_glEndVertexShaderEXT = nullptr;
+void m_glEndVertexShaderEXT_profile()const{return this->m_profile(2239,m_next_glEndVertexShaderEXT);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC m_next_glVertexAttrib1s = nullptr;
+void m_glVertexAttrib1s_profile(GLuint a0,GLshort a1)const{return this->m_profile(2240,m_next_glVertexAttrib1s,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC m_next_glMultiTexCoord4dvARB = nullptr;
+void m_glMultiTexCoord4dvARB_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2241,m_next_glMultiTexCoord4dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC m_next_glMultiTexCoord1sv = nullptr;
+void m_glMultiTexCoord1sv_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(2242,m_next_glMultiTexCoord1sv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC m_next_glUniform1ui64vNV = nullptr;
+void m_glUniform1ui64vNV_profile(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{return this->m_profile(2243,m_next_glUniform1ui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC m_next_glGetClipPlanefOES = nullptr;
+void m_glGetClipPlanefOES_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(2244,m_next_glGetClipPlanefOES,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS2SPROC m_next_glRasterPos2s = nullptr;
+void m_glRasterPos2s_profile(GLshort a0,GLshort a1)const{return this->m_profile(2245,m_next_glRasterPos2s,a0,a1);}
+FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC m_next_glWeightivARB = nullptr;
+void m_glWeightivARB_profile(GLint a0,const GLint* a1)const{return this->m_profile(2246,m_next_glWeightivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC m_next_glMultiTexCoord4hvNV = nullptr;
+void m_glMultiTexCoord4hvNV_profile(GLenum a0,const GLhalfNV* a1)const{return this->m_profile(2247,m_next_glMultiTexCoord4hvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMAL3HNVPROC m_next_glNormal3hNV = nullptr;
+void m_glNormal3hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(2248,m_next_glNormal3hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC m_next_glGetSeparableFilter = nullptr;
+void m_glGetSeparableFilter_profile(GLenum a0,GLenum a1,GLenum a2,GLvoid* a3,GLvoid* a4,GLvoid* a5)const{return this->m_profile(2249,m_next_glGetSeparableFilter,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC m_next_glGetPathTexGenivNV = nullptr;
+void m_glGetPathTexGenivNV_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2250,m_next_glGetPathTexGenivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR4BVPROC m_next_glColor4bv = nullptr;
+void m_glColor4bv_profile(const GLbyte* a0)const{return this->m_profile(2251,m_next_glColor4bv,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS2FPROC m_next_glRasterPos2f = nullptr;
+void m_glRasterPos2f_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(2252,m_next_glRasterPos2f,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC m_next_glNamedBufferPageCommitmentARB = nullptr;
+void m_glNamedBufferPageCommitmentARB_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{return this->m_profile(2253,m_next_glNamedBufferPageCommitmentARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLLOADIDENTITYPROC m_next_glLoadIdentity = nullptr;
+void m_glLoadIdentity_profile()const{return this->m_profile(2254,m_next_glLoadIdentity);}
+FunctionTable::MEMBERPFNGLRASTERPOS2IPROC m_next_glRasterPos2i = nullptr;
+void m_glRasterPos2i_profile(GLint a0,GLint a1)const{return this->m_profile(2255,m_next_glRasterPos2i,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC m_next_glRasterPos4iv = nullptr;
+void m_glRasterPos4iv_profile(const GLint* a0)const{return this->m_profile(2256,m_next_glRasterPos4iv,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC m_next_glMultiTexCoord2fvARB = nullptr;
+void m_glMultiTexCoord2fvARB_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2257,m_next_glMultiTexCoord2fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC m_next_glUniformMatrix4x3fv = nullptr;
+void m_glUniformMatrix4x3fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2258,m_next_glUniformMatrix4x3fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC m_next_glClearBufferfv = nullptr;
+void m_glClearBufferfv_profile(GLenum a0,GLint a1,const GLfloat* a2)const{return this->m_profile(2259,m_next_glClearBufferfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC m_next_glMultiTexCoord4hNV = nullptr;
+void m_glMultiTexCoord4hNV_profile(GLenum a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3,GLhalfNV a4)const{return this->m_profile(2260,m_next_glMultiTexCoord4hNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC m_next_glTextureBarrier = nullptr;
+void m_glTextureBarrier_profile()const{return this->m_profile(2261,m_next_glTextureBarrier);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC m_next_glReplacementCodeuivSUN = nullptr;
+void m_glReplacementCodeuivSUN_profile(const GLuint* a0)const{return this->m_profile(2262,m_next_glReplacementCodeuivSUN,a0);}
+FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC m_next_glDeleteAsyncMarkersSGIX = nullptr;
+void m_glDeleteAsyncMarkersSGIX_profile(GLuint a0,GLsizei a1)const{return this->m_profile(2263,m_next_glDeleteAsyncMarkersSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC m_next_glTexCoord2bvOES = nullptr;
+void m_glTexCoord2bvOES_profile(const GLbyte* a0)const{return this->m_profile(2264,m_next_glTexCoord2bvOES,a0);}
+FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC m_next_glEvalCoord2xOES = nullptr;
+void m_glEvalCoord2xOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(2265,m_next_glEvalCoord2xOES,a0,a1);}
+FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC m_next_glGetSharpenTexFuncSGIS = nullptr;
+void m_glGetSharpenTexFuncSGIS_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(2266,m_next_glGetSharpenTexFuncSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC m_next_glProgramUniformHandleui64vNV = nullptr;
+void m_glProgramUniformHandleui64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(2267,m_next_glProgramUniformHandleui64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC m_next_glIglooInterfaceSGIX = nullptr;
+void m_glIglooInterfaceSGIX_profile(GLenum a0,const void* a1)const{return this->m_profile(2268,m_next_glIglooInterfaceSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC m_next_glWindowPos2dvARB = nullptr;
+void m_glWindowPos2dvARB_profile(const GLdouble* a0)const{return this->m_profile(2269,m_next_glWindowPos2dvARB,a0);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC m_next_glClearBufferfi = nullptr;
+void m_glClearBufferfi_profile(GLenum a0,GLint a1,GLfloat a2,GLint a3)const{return this->m_profile(2270,m_next_glClearBufferfi,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC m_next_glDrawArraysIndirect = nullptr;
+void m_glDrawArraysIndirect_profile(GLenum a0,const void* a1)const{return this->m_profile(2271,m_next_glDrawArraysIndirect,a0,a1);}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC m_next_glGenVertexArrays = nullptr;
+void m_glGenVertexArrays_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2272,m_next_glGenVertexArrays,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC m_next_glGetTransformFeedbacki64_v = nullptr;
+void m_glGetTransformFeedbacki64_v_profile(GLuint a0,GLenum a1,GLuint a2,GLint64* a3)const{return this->m_profile(2273,m_next_glGetTransformFeedbacki64_v,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC m_next_glEnableVertexArrayAttrib = nullptr;
+void m_glEnableVertexArrayAttrib_profile(GLuint a0,GLuint a1)const{return this->m_profile(2274,m_next_glEnableVertexArrayAttrib,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC m_next_glProgramUniformMatrix3x2dv = nullptr;
+void m_glProgramUniformMatrix3x2dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2275,m_next_glProgramUniformMatrix3x2dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC m_next_glVertexStream4fATI = nullptr;
+void m_glVertexStream4fATI_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(2276,m_next_glVertexStream4fATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC m_next_glVertexBindingDivisor = nullptr;
+void m_glVertexBindingDivisor_profile(GLuint a0,GLuint a1)const{return this->m_profile(2277,m_next_glVertexBindingDivisor,a0,a1);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC m_next_glGetSamplerParameterIiv = nullptr;
+void m_glGetSamplerParameterIiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2278,m_next_glGetSamplerParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC m_next_glGetCoverageModulationTableNV = nullptr;
+void m_glGetCoverageModulationTableNV_profile(GLsizei a0,GLfloat* a1)const{return this->m_profile(2279,m_next_glGetCoverageModulationTableNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC m_next_glDepthRangedNV = nullptr;
+void m_glDepthRangedNV_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(2280,m_next_glDepthRangedNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC m_next_glVertexAttrib3f = nullptr;
+void m_glVertexAttrib3f_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2281,m_next_glVertexAttrib3f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC m_next_glMultiDrawRangeElementArrayAPPLE = nullptr;
+void m_glMultiDrawRangeElementArrayAPPLE_profile(GLenum a0,GLuint a1,GLuint a2,const GLint* a3,const GLsizei* a4,GLsizei a5)const{return this->m_profile(2282,m_next_glMultiDrawRangeElementArrayAPPLE,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC m_next_glVertexAttribFormatNV = nullptr;
+void m_glVertexAttribFormatNV_profile(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4)const{return this->m_profile(2283,m_next_glVertexAttribFormatNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC m_next_glGetQueryBufferObjecti64v = nullptr;
+void m_glGetQueryBufferObjecti64v_profile(GLuint a0,GLuint a1,GLenum a2,GLintptr a3)const{return this->m_profile(2284,m_next_glGetQueryBufferObjecti64v,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC m_next_glGetVertexAttribdv = nullptr;
+void m_glGetVertexAttribdv_profile(GLuint a0,GLenum a1,GLdouble* a2)const{return this->m_profile(2285,m_next_glGetVertexAttribdv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC m_next_glGetUniformi64vARB = nullptr;
+void m_glGetUniformi64vARB_profile(GLuint a0,GLint a1,GLint64* a2)const{return this->m_profile(2286,m_next_glGetUniformi64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC m_next_glAreTexturesResidentEXT = nullptr;
+GLboolean m_glAreTexturesResidentEXT_profile(GLsizei a0,const GLuint* a1,GLboolean* a2)const{return this->m_profile(2287,m_next_glAreTexturesResidentEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETHANDLEARBPROC m_next_glGetHandleARB = nullptr;
+GLhandleARB m_glGetHandleARB_profile(GLenum a0)const{return this->m_profile(2288,m_next_glGetHandleARB,a0);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC m_next_glVideoCaptureStreamParameterdvNV = nullptr;
+void m_glVideoCaptureStreamParameterdvNV_profile(GLuint a0,GLuint a1,GLenum a2,const GLdouble* a3)const{return this->m_profile(2289,m_next_glVideoCaptureStreamParameterdvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC m_next_glMapParameterivNV = nullptr;
+void m_glMapParameterivNV_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2290,m_next_glMapParameterivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC m_next_glIsVertexArray = nullptr;
+GLboolean m_glIsVertexArray_profile(GLuint a0)const{return this->m_profile(2291,m_next_glIsVertexArray,a0);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC m_next_glSecondaryColor3sEXT = nullptr;
+void m_glSecondaryColor3sEXT_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(2292,m_next_glSecondaryColor3sEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC m_next_glGetTexParameterIivEXT = nullptr;
+void m_glGetTexParameterIivEXT_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2293,m_next_glGetTexParameterIivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC m_next_glFrameTerminatorGREMEDY = nullptr;
+void m_glFrameTerminatorGREMEDY_profile()const{return this->m_profile(2294,m_next_glFrameTerminatorGREMEDY);}
+FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC m_next_glBlendBarrierKHR = nullptr;
+void m_glBlendBarrierKHR_profile()const{return this->m_profile(2295,m_next_glBlendBarrierKHR);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC m_next_glVertexAttrib4NubARB = nullptr;
+void m_glVertexAttrib4NubARB_profile(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{return this->m_profile(2296,m_next_glVertexAttrib4NubARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC m_next_glPrimitiveRestartNV = nullptr;
+void m_glPrimitiveRestartNV_profile()const{return this->m_profile(2297,m_next_glPrimitiveRestartNV);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC m_next_glVertexAttribL1ui64vARB = nullptr;
+void m_glVertexAttribL1ui64vARB_profile(GLuint a0,const GLuint64EXT* a1)const{return this->m_profile(2298,m_next_glVertexAttribL1ui64vARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC m_next_glVertexAttribI4ivEXT = nullptr;
+void m_glVertexAttribI4ivEXT_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2299,m_next_glVertexAttribI4ivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC m_next_glVertexAttribs4svNV = nullptr;
+void m_glVertexAttribs4svNV_profile(GLuint a0,GLsizei a1,const GLshort* a2)const{return this->m_profile(2300,m_next_glVertexAttribs4svNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIPROC m_next_glUniform1ui = nullptr;
+void m_glUniform1ui_profile(GLint a0,GLuint a1)const{return this->m_profile(2301,m_next_glUniform1ui,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC m_next_glVertexAttrib2fvARB = nullptr;
+void m_glVertexAttrib2fvARB_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(2302,m_next_glVertexAttrib2fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC m_next_glVertexAttribI4svEXT = nullptr;
+void m_glVertexAttribI4svEXT_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2303,m_next_glVertexAttribI4svEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC m_next_glTextureImage3DMultisampleCoverageNV = nullptr;
+void m_glTextureImage3DMultisampleCoverageNV_profile(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{return this->m_profile(2304,m_next_glTextureImage3DMultisampleCoverageNV,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC m_next_glMemoryBarrier = nullptr;
+void m_glMemoryBarrier_profile(GLbitfield a0)const{return this->m_profile(2305,m_next_glMemoryBarrier,a0);}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC m_next_glGetVariantArrayObjectfvATI = nullptr;
+void m_glGetVariantArrayObjectfvATI_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2306,m_next_glGetVariantArrayObjectfvATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC m_next_glTexCoord4fColor4fNormal3fVertex4fvSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profile(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{return this->m_profile(2307,m_next_glTexCoord4fColor4fNormal3fVertex4fvSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLISPROGRAMARBPROC m_next_glIsProgramARB = nullptr;
+GLboolean m_glIsProgramARB_profile(GLuint a0)const{return this->m_profile(2308,m_next_glIsProgramARB,a0);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC m_next_glBindImageTextureEXT = nullptr;
+void m_glBindImageTextureEXT_profile(GLuint a0,GLuint a1,GLint a2,GLboolean a3,GLint a4,GLenum a5,GLint a6)const{return this->m_profile(2309,m_next_glBindImageTextureEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC m_next_glGetFragDataLocation = nullptr;
+GLint m_glGetFragDataLocation_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(2310,m_next_glGetFragDataLocation,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC m_next_glMultiTexCoord1svARB = nullptr;
+void m_glMultiTexCoord1svARB_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(2311,m_next_glMultiTexCoord1svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMAPXVOESPROC m_next_glGetMapxvOES = nullptr;
+void m_glGetMapxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(2312,m_next_glGetMapxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC m_next_glTextureStorage2DMultisampleEXT = nullptr;
+void m_glTextureStorage2DMultisampleEXT_profile(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(2313,m_next_glTextureStorage2DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETMATERIALFVPROC m_next_glGetMaterialfv = nullptr;
+void m_glGetMaterialfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2314,m_next_glGetMaterialfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC m_next_glVertexAttrib4NbvARB = nullptr;
+void m_glVertexAttrib4NbvARB_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(2315,m_next_glVertexAttrib4NbvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC m_next_glPixelMapuiv = nullptr;
+void m_glPixelMapuiv_profile(GLenum a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2316,m_next_glPixelMapuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC m_next_glColorPointerEXT = nullptr;
+void m_glColorPointerEXT_profile(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{return this->m_profile(2317,m_next_glColorPointerEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC m_next_glEnableClientStateiEXT = nullptr;
+void m_glEnableClientStateiEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(2318,m_next_glEnableClientStateiEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC m_next_glClearTexSubImage = nullptr;
+void m_glClearTexSubImage_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(2319,m_next_glClearTexSubImage,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC m_next_glEvalCoord1xvOES = nullptr;
+void m_glEvalCoord1xvOES_profile(const GLfixed* a0)const{return this->m_profile(2320,m_next_glEvalCoord1xvOES,a0);}
+FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC m_next_glDetachObjectARB = nullptr;
+void m_glDetachObjectARB_profile(GLhandleARB a0,GLhandleARB a1)const{return this->m_profile(2321,m_next_glDetachObjectARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC m_next_glGetTextureParameterIiv = nullptr;
+void m_glGetTextureParameterIiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2322,m_next_glGetTextureParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC m_next_glVariantusvEXT = nullptr;
+void m_glVariantusvEXT_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(2323,m_next_glVariantusvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC m_next_glCompressedTextureImage3DEXT = nullptr;
+void m_glCompressedTextureImage3DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLsizei a8,const void* a9)const{return this->m_profile(2324,m_next_glCompressedTextureImage3DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC m_next_glMultiTexCoord1dARB = nullptr;
+void m_glMultiTexCoord1dARB_profile(GLenum a0,GLdouble a1)const{return this->m_profile(2325,m_next_glMultiTexCoord1dARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC m_next_glGetVertexArrayIntegeri_vEXT = nullptr;
+void m_glGetVertexArrayIntegeri_vEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(2326,m_next_glGetVertexArrayIntegeri_vEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC m_next_glVertexAttribI4ubv = nullptr;
+void m_glVertexAttribI4ubv_profile(GLuint a0,const GLubyte* a1)const{return this->m_profile(2327,m_next_glVertexAttribI4ubv,a0,a1);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC m_next_glPixelTexGenParameterfSGIS = nullptr;
+void m_glPixelTexGenParameterfSGIS_profile(GLenum a0,GLfloat a1)const{return this->m_profile(2328,m_next_glPixelTexGenParameterfSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC m_next_glProgramUniformMatrix4x2dv = nullptr;
+void m_glProgramUniformMatrix4x2dv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2329,m_next_glProgramUniformMatrix4x2dv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC m_next_glUniform3fARB = nullptr;
+void m_glUniform3fARB_profile(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2330,m_next_glUniform3fARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLISSHADERPROC m_next_glIsShader = nullptr;
+GLboolean m_glIsShader_profile(GLuint a0)const{return this->m_profile(2331,m_next_glIsShader,a0);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC m_next_glConvolutionParameteriv = nullptr;
+void m_glConvolutionParameteriv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2332,m_next_glConvolutionParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC m_next_glCopyMultiTexSubImage2DEXT = nullptr;
+void m_glCopyMultiTexSubImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{return this->m_profile(2333,m_next_glCopyMultiTexSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC m_next_glEnableVertexAttribArrayARB = nullptr;
+void m_glEnableVertexAttribArrayARB_profile(GLuint a0)const{return this->m_profile(2334,m_next_glEnableVertexAttribArrayARB,a0);}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC m_next_glMulticastCopyBufferSubDataNV = nullptr;
+void m_glMulticastCopyBufferSubDataNV_profile(GLuint a0,GLbitfield a1,GLuint a2,GLuint a3,GLintptr a4,GLintptr a5,GLsizeiptr a6)const{return this->m_profile(2335,m_next_glMulticastCopyBufferSubDataNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLENABLEPROC m_next_glEnable = nullptr;
+void m_glEnable_profile(GLenum a0)const{return this->m_profile(2336,m_next_glEnable,a0);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC m_next_glGetActiveUniformsiv = nullptr;
+void m_glGetActiveUniformsiv_profile(GLuint a0,GLsizei a1,const GLuint* a2,GLenum a3,GLint* a4)const{return this->m_profile(2337,m_next_glGetActiveUniformsiv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC m_next_glGetVertexAttribivARB = nullptr;
+void m_glGetVertexAttribivARB_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2338,m_next_glGetVertexAttribivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC m_next_glTexCoord4hvNV = nullptr;
+void m_glTexCoord4hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(2339,m_next_glTexCoord4hvNV,a0);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC m_next_glUseProgramObjectARB = nullptr;
+void m_glUseProgramObjectARB_profile(GLhandleARB a0)const{return this->m_profile(2340,m_next_glUseProgramObjectARB,a0);}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC m_next_glGetAttribLocation = nullptr;
+GLint m_glGetAttribLocation_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(2341,m_next_glGetAttribLocation,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC m_next_glVertexAttrib4dv = nullptr;
+void m_glVertexAttrib4dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2342,m_next_glVertexAttrib4dv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC m_next_glGetTextureParameteriv = nullptr;
+void m_glGetTextureParameteriv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2343,m_next_glGetTextureParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC m_next_glNamedBufferStorageMemEXT = nullptr;
+void m_glNamedBufferStorageMemEXT_profile(GLuint a0,GLsizeiptr a1,GLuint a2,GLuint64 a3)const{return this->m_profile(2344,m_next_glNamedBufferStorageMemEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC m_next_glPathSubCoordsNV = nullptr;
+void m_glPathSubCoordsNV_profile(GLuint a0,GLsizei a1,GLsizei a2,GLenum a3,const void* a4)const{return this->m_profile(2345,m_next_glPathSubCoordsNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC m_next_glMatrixIndexusvARB = nullptr;
+void m_glMatrixIndexusvARB_profile(GLint a0,const GLushort* a1)const{return this->m_profile(2346,m_next_glMatrixIndexusvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC m_next_glGetVideouivNV = nullptr;
+void m_glGetVideouivNV_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(2347,m_next_glGetVideouivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC m_next_glGetVideoCaptureivNV = nullptr;
+void m_glGetVideoCaptureivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2348,m_next_glGetVideoCaptureivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC m_next_glProgramUniform3ui = nullptr;
+void m_glProgramUniform3ui_profile(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4)const{return this->m_profile(2349,m_next_glProgramUniform3ui,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC m_next_glVertexAttrib3svARB = nullptr;
+void m_glVertexAttrib3svARB_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2350,m_next_glVertexAttrib3svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC m_next_glGetNamedBufferParameterivEXT = nullptr;
+void m_glGetNamedBufferParameterivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2351,m_next_glGetNamedBufferParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC m_next_glMatrixScaledEXT = nullptr;
+void m_glMatrixScaledEXT_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2352,m_next_glMatrixScaledEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC m_next_glProgramUniformMatrix2x3fv = nullptr;
+void m_glProgramUniformMatrix2x3fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(2353,m_next_glProgramUniformMatrix2x3fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC m_next_glGetFragmentLightivSGIX = nullptr;
+void m_glGetFragmentLightivSGIX_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2354,m_next_glGetFragmentLightivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSTRINGIPROC m_next_glGetStringi = nullptr;
+const GLubyte* m_glGetStringi_profile(GLenum a0,GLuint a1)const{return this->m_profile(2355,m_next_glGetStringi,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC m_next_glWindowPos2svARB = nullptr;
+void m_glWindowPos2svARB_profile(const GLshort* a0)const{return this->m_profile(2356,m_next_glWindowPos2svARB,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC m_next_glVertexAttrib2svNV = nullptr;
+void m_glVertexAttrib2svNV_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2357,m_next_glVertexAttrib2svNV,a0,a1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC m_next_glWindowPos2ivARB = nullptr;
+void m_glWindowPos2ivARB_profile(const GLint* a0)const{return this->m_profile(2358,m_next_glWindowPos2ivARB,a0);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC m_next_glGetVertexAttribPointervNV = nullptr;
+void m_glGetVertexAttribPointervNV_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(2359,m_next_glGetVertexAttribPointervNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPUSHMATRIXPROC m_next_glPushMatrix = nullptr;
+void m_glPushMatrix_profile()const{return this->m_profile(2360,m_next_glPushMatrix);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC m_next_glEdgeFlagPointerListIBM = nullptr;
+void m_glEdgeFlagPointerListIBM_profile(GLint a0,const GLboolean** a1,GLint a2)const{return this->m_profile(2361,m_next_glEdgeFlagPointerListIBM,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC m_next_glGenerateMipmapEXT = nullptr;
+void m_glGenerateMipmapEXT_profile(GLenum a0)const{return this->m_profile(2362,m_next_glGenerateMipmapEXT,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC m_next_glWindowPos3sv = nullptr;
+void m_glWindowPos3sv_profile(const GLshort* a0)const{return this->m_profile(2363,m_next_glWindowPos3sv,a0);}
+FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC m_next_glPathCoordsNV = nullptr;
+void m_glPathCoordsNV_profile(GLuint a0,GLsizei a1,GLenum a2,const void* a3)const{return this->m_profile(2364,m_next_glPathCoordsNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC m_next_glProgramUniform1i = nullptr;
+void m_glProgramUniform1i_profile(GLuint a0,GLint a1,GLint a2)const{return this->m_profile(2365,m_next_glProgramUniform1i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC m_next_glProgramUniform1d = nullptr;
+void m_glProgramUniform1d_profile(GLuint a0,GLint a1,GLdouble a2)const{return this->m_profile(2366,m_next_glProgramUniform1d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC m_next_glProgramUniform1f = nullptr;
+void m_glProgramUniform1f_profile(GLuint a0,GLint a1,GLfloat a2)const{return this->m_profile(2367,m_next_glProgramUniform1f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC m_next_glProgramParameteriEXT = nullptr;
+void m_glProgramParameteriEXT_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(2368,m_next_glProgramParameteriEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC m_next_glCompressedMultiTexImage2DEXT = nullptr;
+void m_glCompressedMultiTexImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{return this->m_profile(2369,m_next_glCompressedMultiTexImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC m_next_glProgramUniform3iv = nullptr;
+void m_glProgramUniform3iv_profile(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{return this->m_profile(2370,m_next_glProgramUniform3iv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINDEXIVPROC m_next_glIndexiv = nullptr;
+void m_glIndexiv_profile(const GLint* a0)const{return this->m_profile(2371,m_next_glIndexiv,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC m_next_glMultiTexCoord4xvOES = nullptr;
+void m_glMultiTexCoord4xvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(2372,m_next_glMultiTexCoord4xvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC m_next_glEGLImageTargetTexture2DOES = nullptr;
+void m_glEGLImageTargetTexture2DOES_profile(GLenum a0,GLeglImageOES a1)const{return this->m_profile(2373,m_next_glEGLImageTargetTexture2DOES,a0,a1);}
+FunctionTable::MEMBERPFNGLPIXELZOOMPROC m_next_glPixelZoom = nullptr;
+void m_glPixelZoom_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(2374,m_next_glPixelZoom,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC m_next_glVertex3bvOES = nullptr;
+void m_glVertex3bvOES_profile(const GLbyte* a0)const{return this->m_profile(2375,m_next_glVertex3bvOES,a0);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC m_next_glFramebufferReadBufferEXT = nullptr;
+void m_glFramebufferReadBufferEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(2376,m_next_glFramebufferReadBufferEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC m_next_glExtractComponentEXT = nullptr;
+void m_glExtractComponentEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2377,m_next_glExtractComponentEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC m_next_glCombinerParameterivNV = nullptr;
+void m_glCombinerParameterivNV_profile(GLenum a0,const GLint* a1)const{return this->m_profile(2378,m_next_glCombinerParameterivNV,a0,a1);}
+FunctionTable::MEMBERPFNGLMINMAXPROC m_next_glMinmax = nullptr;
+void m_glMinmax_profile(GLenum a0,GLenum a1,GLboolean a2)const{return this->m_profile(2379,m_next_glMinmax,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORP3UIPROC m_next_glColorP3ui = nullptr;
+void m_glColorP3ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(2380,m_next_glColorP3ui,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC m_next_glPointParameterfvSGIS = nullptr;
+void m_glPointParameterfvSGIS_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2381,m_next_glPointParameterfvSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC m_next_glBlendEquationi = nullptr;
+void m_glBlendEquationi_profile(GLuint a0,GLenum a1)const{return this->m_profile(2382,m_next_glBlendEquationi,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC m_next_glGetFogFuncSGIS = nullptr;
+void m_glGetFogFuncSGIS_profile(GLfloat* a0)const{return this->m_profile(2383,m_next_glGetFogFuncSGIS,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC m_next_glVertexAttrib4fvNV = nullptr;
+void m_glVertexAttrib4fvNV_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(2384,m_next_glVertexAttrib4fvNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNMINMAXPROC m_next_glGetnMinmax = nullptr;
+void m_glGetnMinmax_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLsizei a4,void* a5)const{return this->m_profile(2385,m_next_glGetnMinmax,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC m_next_glFragmentLightiSGIX = nullptr;
+void m_glFragmentLightiSGIX_profile(GLenum a0,GLenum a1,GLint a2)const{return this->m_profile(2386,m_next_glFragmentLightiSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC m_next_glMultiTexCoord1bvOES = nullptr;
+void m_glMultiTexCoord1bvOES_profile(GLenum a0,const GLbyte* a1)const{return this->m_profile(2387,m_next_glMultiTexCoord1bvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC m_next_glSecondaryColorPointerEXT = nullptr;
+void m_glSecondaryColorPointerEXT_profile(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(2388,m_next_glSecondaryColorPointerEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC m_next_glMultiTexCoordP4uiv = nullptr;
+void m_glMultiTexCoordP4uiv_profile(GLenum a0,GLenum a1,const GLuint* a2)const{return this->m_profile(2389,m_next_glMultiTexCoordP4uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC m_next_glGetBufferSubDataARB = nullptr;
+void m_glGetBufferSubDataARB_profile(GLenum a0,GLintptrARB a1,GLsizeiptrARB a2,void* a3)const{return this->m_profile(2390,m_next_glGetBufferSubDataARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC m_next_glSecondaryColor3hNV = nullptr;
+void m_glSecondaryColor3hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{return this->m_profile(2391,m_next_glSecondaryColor3hNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC m_next_glGetPathParameterivNV = nullptr;
+void m_glGetPathParameterivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2392,m_next_glGetPathParameterivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC m_next_glFlushRasterSGIX = nullptr;
+void m_glFlushRasterSGIX_profile()const{return this->m_profile(2393,m_next_glFlushRasterSGIX);}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC m_next_glElementPointerATI = nullptr;
+void m_glElementPointerATI_profile(GLenum a0,const void* a1)const{return this->m_profile(2394,m_next_glElementPointerATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC m_next_glGetAttachedObjectsARB = nullptr;
+void m_glGetAttachedObjectsARB_profile(GLhandleARB a0,GLsizei a1,GLsizei* a2,GLhandleARB* a3)const{return this->m_profile(2395,m_next_glGetAttachedObjectsARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM4IVPROC m_next_glUniform4iv = nullptr;
+void m_glUniform4iv_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(2396,m_next_glUniform4iv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFOGXOESPROC m_next_glFogxOES = nullptr;
+void m_glFogxOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(2397,m_next_glFogxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC m_next_glSharpenTexFuncSGIS = nullptr;
+void m_glSharpenTexFuncSGIS_profile(GLenum a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(2398,m_next_glSharpenTexFuncSGIS,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC m_next_glClearDepthfOES = nullptr;
+void m_glClearDepthfOES_profile(GLclampf a0)const{return this->m_profile(2399,m_next_glClearDepthfOES,a0);}
+FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC m_next_glDeleteCommandListsNV = nullptr;
+void m_glDeleteCommandListsNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2400,m_next_glDeleteCommandListsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC m_next_glSpecializeShader = nullptr;
+void m_glSpecializeShader_profile(GLuint a0,const GLchar* a1,GLuint a2,const GLuint* a3,const GLuint* a4)const{return this->m_profile(2401,m_next_glSpecializeShader,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEX4HNVPROC m_next_glVertex4hNV = nullptr;
+void m_glVertex4hNV_profile(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{return this->m_profile(2402,m_next_glVertex4hNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC m_next_glSecondaryColor3dvEXT = nullptr;
+void m_glSecondaryColor3dvEXT_profile(const GLdouble* a0)const{return this->m_profile(2403,m_next_glSecondaryColor3dvEXT,a0);}
+FunctionTable::MEMBERPFNGLGENTEXTURESPROC m_next_glGenTextures = nullptr;
+void m_glGenTextures_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2404,m_next_glGenTextures,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC m_next_glTextureStorage2DMultisample = nullptr;
+void m_glTextureStorage2DMultisample_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{return this->m_profile(2405,m_next_glTextureStorage2DMultisample,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC m_next_glUniform3ui64vNV = nullptr;
+void m_glUniform3ui64vNV_profile(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{return this->m_profile(2406,m_next_glUniform3ui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC m_next_glBlendFuncSeparateIndexedAMD = nullptr;
+void m_glBlendFuncSeparateIndexedAMD_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{return this->m_profile(2407,m_next_glBlendFuncSeparateIndexedAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC m_next_glMakeBufferResidentNV = nullptr;
+void m_glMakeBufferResidentNV_profile(GLenum a0,GLenum a1)const{return this->m_profile(2408,m_next_glMakeBufferResidentNV,a0,a1);}
+FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC m_next_glShaderOp2EXT = nullptr;
+void m_glShaderOp2EXT_profile(GLenum a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(2409,m_next_glShaderOp2EXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC m_next_glGetVertexAttribivNV = nullptr;
+void m_glGetVertexAttribivNV_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2410,m_next_glGetVertexAttribivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC m_next_glTexParameterIivEXT = nullptr;
+void m_glTexParameterIivEXT_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2411,m_next_glTexParameterIivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC m_next_glGetPerfQueryDataINTEL = nullptr;
+void m_glGetPerfQueryDataINTEL_profile(GLuint a0,GLuint a1,GLsizei a2,void* a3,GLuint* a4)const{return this->m_profile(2412,m_next_glGetPerfQueryDataINTEL,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC m_next_glVertexAttrib4dvARB = nullptr;
+void m_glVertexAttrib4dvARB_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2413,m_next_glVertexAttrib4dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC m_next_glTextureSubImage1DEXT = nullptr;
+void m_glTextureSubImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLenum a6,const void* a7)const{return this->m_profile(2414,m_next_glTextureSubImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC m_next_glGetActiveUniformBlockName = nullptr;
+void m_glGetActiveUniformBlockName_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLchar* a4)const{return this->m_profile(2415,m_next_glGetActiveUniformBlockName,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC m_next_glVertexAttrib2dvARB = nullptr;
+void m_glVertexAttrib2dvARB_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2416,m_next_glVertexAttrib2dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC m_next_glVertexAttribPointer = nullptr;
+void m_glVertexAttribPointer_profile(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,const void* a5)const{return this->m_profile(2417,m_next_glVertexAttribPointer,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC m_next_glDepthBoundsdNV = nullptr;
+void m_glDepthBoundsdNV_profile(GLdouble a0,GLdouble a1)const{return this->m_profile(2418,m_next_glDepthBoundsdNV,a0,a1);}
+FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC m_next_glDeleteTexturesEXT = nullptr;
+void m_glDeleteTexturesEXT_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2419,m_next_glDeleteTexturesEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC m_next_glDrawBuffersATI = nullptr;
+void m_glDrawBuffersATI_profile(GLsizei a0,const GLenum* a1)const{return this->m_profile(2420,m_next_glDrawBuffersATI,a0,a1);}
+FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC m_next_glLightModelxvOES = nullptr;
+void m_glLightModelxvOES_profile(GLenum a0,const GLfixed* a1)const{return this->m_profile(2421,m_next_glLightModelxvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC m_next_glApplyTextureEXT = nullptr;
+void m_glApplyTextureEXT_profile(GLenum a0)const{return this->m_profile(2422,m_next_glApplyTextureEXT,a0);}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC m_next_glGetImageHandleNV = nullptr;
+GLuint64 m_glGetImageHandleNV_profile(GLuint a0,GLint a1,GLboolean a2,GLint a3,GLenum a4)const{return this->m_profile(2423,m_next_glGetImageHandleNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETMINMAXPROC m_next_glGetMinmax = nullptr;
+void m_glGetMinmax_profile(GLenum a0,GLboolean a1,GLenum a2,GLenum a3,GLvoid* a4)const{return this->m_profile(2424,m_next_glGetMinmax,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC m_next_glGetFixedvOES = nullptr;
+void m_glGetFixedvOES_profile(GLenum a0,GLfixed* a1)const{return this->m_profile(2425,m_next_glGetFixedvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC m_next_glSamplePatternEXT = nullptr;
+void m_glSamplePatternEXT_profile(GLenum a0)const{return this->m_profile(2426,m_next_glSamplePatternEXT,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM1FPROC m_next_glUniform1f = nullptr;
+void m_glUniform1f_profile(GLint a0,GLfloat a1)const{return this->m_profile(2427,m_next_glUniform1f,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC m_next_glColor4fNormal3fVertex3fSUN = nullptr;
+void m_glColor4fNormal3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9)const{return this->m_profile(2428,m_next_glColor4fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC m_next_glFogCoorddvEXT = nullptr;
+void m_glFogCoorddvEXT_profile(const GLdouble* a0)const{return this->m_profile(2429,m_next_glFogCoorddvEXT,a0);}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC m_next_glCopyTextureImage1DEXT = nullptr;
+void m_glCopyTextureImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLint a7)const{return this->m_profile(2430,m_next_glCopyTextureImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC m_next_glFlushMappedBufferRangeAPPLE = nullptr;
+void m_glFlushMappedBufferRangeAPPLE_profile(GLenum a0,GLintptr a1,GLsizeiptr a2)const{return this->m_profile(2431,m_next_glFlushMappedBufferRangeAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX3SVPROC m_next_glVertex3sv = nullptr;
+void m_glVertex3sv_profile(const GLshort* a0)const{return this->m_profile(2432,m_next_glVertex3sv,a0);}
+FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC m_next_glFlushStaticDataIBM = nullptr;
+void m_glFlushStaticDataIBM_profile(GLenum a0)const{return this->m_profile(2433,m_next_glFlushStaticDataIBM,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC m_next_glProgramUniform4ui64NV = nullptr;
+void m_glProgramUniform4ui64NV_profile(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4,GLuint64EXT a5)const{return this->m_profile(2434,m_next_glProgramUniform4ui64NV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC m_next_glRasterPos4xOES = nullptr;
+void m_glRasterPos4xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(2435,m_next_glRasterPos4xOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC m_next_glVertexAttribP1ui = nullptr;
+void m_glVertexAttribP1ui_profile(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{return this->m_profile(2436,m_next_glVertexAttribP1ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC m_next_glProgramUniform4dvEXT = nullptr;
+void m_glProgramUniform4dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(2437,m_next_glProgramUniform4dvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC m_next_glEndTransformFeedbackEXT = nullptr;
+void m_glEndTransformFeedbackEXT_profile()const{return this->m_profile(2438,m_next_glEndTransformFeedbackEXT);}
+FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC m_next_glBinormal3dEXT = nullptr;
+void m_glBinormal3dEXT_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2439,m_next_glBinormal3dEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC m_next_glGetTextureSubImage = nullptr;
+void m_glGetTextureSubImage_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,GLsizei a10,void* a11)const{return this->m_profile(2440,m_next_glGetTextureSubImage,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC m_next_glGetNamedRenderbufferParameteriv = nullptr;
+void m_glGetNamedRenderbufferParameteriv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2441,m_next_glGetNamedRenderbufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC m_next_glBindBuffersRange = nullptr;
+void m_glBindBuffersRange_profile(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3,const GLintptr* a4,const GLsizeiptr* a5)const{return this->m_profile(2442,m_next_glBindBuffersRange,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC m_next_glFinishAsyncSGIX = nullptr;
+GLint m_glFinishAsyncSGIX_profile(GLuint* a0)const{return this->m_profile(2443,m_next_glFinishAsyncSGIX,a0);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC m_next_glBindFragDataLocationIndexed = nullptr;
+void m_glBindFragDataLocationIndexed_profile(GLuint a0,GLuint a1,GLuint a2,const GLchar* a3)const{return this->m_profile(2444,m_next_glBindFragDataLocationIndexed,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC m_next_glMultiTexCoord2dv = nullptr;
+void m_glMultiTexCoord2dv_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2445,m_next_glMultiTexCoord2dv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2IVPROC m_next_glUniform2iv = nullptr;
+void m_glUniform2iv_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(2446,m_next_glUniform2iv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC m_next_glProgramUniform2i64vNV = nullptr;
+void m_glProgramUniform2i64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{return this->m_profile(2447,m_next_glProgramUniform2i64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC m_next_glFlushVertexArrayRangeAPPLE = nullptr;
+void m_glFlushVertexArrayRangeAPPLE_profile(GLsizei a0,void* a1)const{return this->m_profile(2448,m_next_glFlushVertexArrayRangeAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC m_next_glTextureParameterf = nullptr;
+void m_glTextureParameterf_profile(GLuint a0,GLenum a1,GLfloat a2)const{return this->m_profile(2449,m_next_glTextureParameterf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC m_next_glMultiTexCoord3dvARB = nullptr;
+void m_glMultiTexCoord3dvARB_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2450,m_next_glMultiTexCoord3dvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC m_next_glFeedbackBuffer = nullptr;
+void m_glFeedbackBuffer_profile(GLsizei a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2451,m_next_glFeedbackBuffer,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC m_next_glDebugMessageInsertARB = nullptr;
+void m_glDebugMessageInsertARB_profile(GLenum a0,GLenum a1,GLuint a2,GLenum a3,GLsizei a4,const GLchar* a5)const{return this->m_profile(2452,m_next_glDebugMessageInsertARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC m_next_glMultiTexCoord2i = nullptr;
+void m_glMultiTexCoord2i_profile(GLenum a0,GLint a1,GLint a2)const{return this->m_profile(2453,m_next_glMultiTexCoord2i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC m_next_glTextureSubImage3D = nullptr;
+void m_glTextureSubImage3D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{return this->m_profile(2454,m_next_glTextureSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC m_next_glFramebufferTexture1D = nullptr;
+void m_glFramebufferTexture1D_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(2455,m_next_glFramebufferTexture1D,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETSHADERIVPROC m_next_glGetShaderiv = nullptr;
+void m_glGetShaderiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2456,m_next_glGetShaderiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC m_next_glMultiTexCoord2d = nullptr;
+void m_glMultiTexCoord2d_profile(GLenum a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2457,m_next_glMultiTexCoord2d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC m_next_glArrayObjectATI = nullptr;
+void m_glArrayObjectATI_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLuint a4,GLuint a5)const{return this->m_profile(2458,m_next_glArrayObjectATI,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC m_next_glGetPointeri_vEXT = nullptr;
+void m_glGetPointeri_vEXT_profile(GLenum a0,GLuint a1,void** a2)const{return this->m_profile(2459,m_next_glGetPointeri_vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC m_next_glGetPerfMonitorCountersAMD = nullptr;
+void m_glGetPerfMonitorCountersAMD_profile(GLuint a0,GLint* a1,GLint* a2,GLsizei a3,GLuint* a4)const{return this->m_profile(2460,m_next_glGetPerfMonitorCountersAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC m_next_glNamedBufferStorage = nullptr;
+void m_glNamedBufferStorage_profile(GLuint a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{return this->m_profile(2461,m_next_glNamedBufferStorage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXENVXVOESPROC m_next_glTexEnvxvOES = nullptr;
+void m_glTexEnvxvOES_profile(GLenum a0,GLenum a1,const GLfixed* a2)const{return this->m_profile(2462,m_next_glTexEnvxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC m_next_glProgramUniform2ui64NV = nullptr;
+void m_glProgramUniform2ui64NV_profile(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3)const{return this->m_profile(2463,m_next_glProgramUniform2ui64NV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC m_next_glMultiTexCoord3bOES = nullptr;
+void m_glMultiTexCoord3bOES_profile(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3)const{return this->m_profile(2464,m_next_glMultiTexCoord3bOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM1DVPROC m_next_glUniform1dv = nullptr;
+void m_glUniform1dv_profile(GLint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(2465,m_next_glUniform1dv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC m_next_glPixelTransferi = nullptr;
+void m_glPixelTransferi_profile(GLenum a0,GLint a1)const{return this->m_profile(2466,m_next_glPixelTransferi,a0,a1);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC m_next_glSecondaryColor3usvEXT = nullptr;
+void m_glSecondaryColor3usvEXT_profile(const GLushort* a0)const{return this->m_profile(2467,m_next_glSecondaryColor3usvEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC m_next_glProgramEnvParameterI4uivNV = nullptr;
+void m_glProgramEnvParameterI4uivNV_profile(GLenum a0,GLuint a1,const GLuint* a2)const{return this->m_profile(2468,m_next_glProgramEnvParameterI4uivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX2SVPROC m_next_glVertex2sv = nullptr;
+void m_glVertex2sv_profile(const GLshort* a0)const{return this->m_profile(2469,m_next_glVertex2sv,a0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC m_next_glWindowPos4dMESA = nullptr;
+void m_glWindowPos4dMESA_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2470,m_next_glWindowPos4dMESA,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC m_next_glDebugMessageControlARB = nullptr;
+void m_glDebugMessageControlARB_profile(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,const GLuint* a4,GLboolean a5)const{return this->m_profile(2471,m_next_glDebugMessageControlARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC m_next_glIsTextureEXT = nullptr;
+GLboolean m_glIsTextureEXT_profile(GLuint a0)const{return this->m_profile(2472,m_next_glIsTextureEXT,a0);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC m_next_glFragmentMaterialivSGIX = nullptr;
+void m_glFragmentMaterialivSGIX_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2473,m_next_glFragmentMaterialivSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC m_next_glLinkProgramARB = nullptr;
+void m_glLinkProgramARB_profile(GLhandleARB a0)const{return this->m_profile(2474,m_next_glLinkProgramARB,a0);}
+FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC m_next_glFinishFenceAPPLE = nullptr;
+void m_glFinishFenceAPPLE_profile(GLuint a0)const{return this->m_profile(2475,m_next_glFinishFenceAPPLE,a0);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC m_next_glVertexArrayVertexAttribBindingEXT = nullptr;
+void m_glVertexArrayVertexAttribBindingEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2476,m_next_glVertexArrayVertexAttribBindingEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC m_next_glTexStorageMem3DMultisampleEXT = nullptr;
+void m_glTexStorageMem3DMultisampleEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6,GLuint a7,GLuint64 a8)const{return this->m_profile(2477,m_next_glTexStorageMem3DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC m_next_glUniform1ui64vARB = nullptr;
+void m_glUniform1ui64vARB_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(2478,m_next_glUniform1ui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC m_next_glMultiTexCoord4fv = nullptr;
+void m_glMultiTexCoord4fv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2479,m_next_glMultiTexCoord4fv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_next_glMulticastFramebufferSampleLocationsfvNV = nullptr;
+void m_glMulticastFramebufferSampleLocationsfvNV_profile(GLuint a0,GLuint a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{return this->m_profile(2480,m_next_glMulticastFramebufferSampleLocationsfvNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLRASTERPOS3DPROC m_next_glRasterPos3d = nullptr;
+void m_glRasterPos3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2481,m_next_glRasterPos3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC m_next_glPollAsyncSGIX = nullptr;
+GLint m_glPollAsyncSGIX_profile(GLuint* a0)const{return this->m_profile(2482,m_next_glPollAsyncSGIX,a0);}
+FunctionTable::MEMBERPFNGLRASTERPOS3FPROC m_next_glRasterPos3f = nullptr;
+void m_glRasterPos3f_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2483,m_next_glRasterPos3f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC m_next_glCompressedTexImage3D = nullptr;
+void m_glCompressedTexImage3D_profile(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const GLvoid* a8)const{return this->m_profile(2484,m_next_glCompressedTexImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC m_next_glVariantivEXT = nullptr;
+void m_glVariantivEXT_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2485,m_next_glVariantivEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC m_next_glUnmapTexture2DINTEL = nullptr;
+void m_glUnmapTexture2DINTEL_profile(GLuint a0,GLint a1)const{return this->m_profile(2486,m_next_glUnmapTexture2DINTEL,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC m_next_glMulticastWaitSyncNV = nullptr;
+void m_glMulticastWaitSyncNV_profile(GLuint a0,GLbitfield a1)const{return this->m_profile(2487,m_next_glMulticastWaitSyncNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC m_next_glGetVertexAttribiv = nullptr;
+void m_glGetVertexAttribiv_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2488,m_next_glGetVertexAttribiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC m_next_glGetPathCoordsNV = nullptr;
+void m_glGetPathCoordsNV_profile(GLuint a0,GLfloat* a1)const{return this->m_profile(2489,m_next_glGetPathCoordsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC m_next_glColor4xvOES = nullptr;
+void m_glColor4xvOES_profile(const GLfixed* a0)const{return this->m_profile(2490,m_next_glColor4xvOES,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC m_next_glVertexAttrib3fv = nullptr;
+void m_glVertexAttrib3fv_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(2491,m_next_glVertexAttrib3fv,a0,a1);}
+FunctionTable::MEMBERPFNGLRASTERPOS3SPROC m_next_glRasterPos3s = nullptr;
+void m_glRasterPos3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(2492,m_next_glRasterPos3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEX4BOESPROC m_next_glVertex4bOES = nullptr;
+void m_glVertex4bOES_profile(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{return this->m_profile(2493,m_next_glVertex4bOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC m_next_glTransformFeedbackVaryingsEXT = nullptr;
+void m_glTransformFeedbackVaryingsEXT_profile(GLuint a0,GLsizei a1,const GLchar*const* a2,GLenum a3)const{return this->m_profile(2494,m_next_glTransformFeedbackVaryingsEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC m_next_glCombinerOutputNV = nullptr;
+void m_glCombinerOutputNV_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5,GLenum a6,GLboolean a7,GLboolean a8,GLboolean a9)const{return this->m_profile(2495,m_next_glCombinerOutputNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC m_next_glWindowPos4sMESA = nullptr;
+void m_glWindowPos4sMESA_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(2496,m_next_glWindowPos4sMESA,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC m_next_glVertexAttrib4svARB = nullptr;
+void m_glVertexAttrib4svARB_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2497,m_next_glVertexAttrib4svARB,a0,a1);}
+FunctionTable::MEMBERPFNGLISLISTPROC m_next_glIsList = nullptr;
+GLboolean m_glIsList_profile(GLuint a0)const{return this->m_profile(2498,m_next_glIsList,a0);}
+FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC m_next_glGetInfoLogARB = nullptr;
+void m_glGetInfoLogARB_profile(GLhandleARB a0,GLsizei a1,GLsizei* a2,GLcharARB* a3)const{return this->m_profile(2499,m_next_glGetInfoLogARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC m_next_glUniformMatrix2fv = nullptr;
+void m_glUniformMatrix2fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2500,m_next_glUniformMatrix2fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC m_next_glVertexAttribs3dvNV = nullptr;
+void m_glVertexAttribs3dvNV_profile(GLuint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(2501,m_next_glVertexAttribs3dvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC m_next_glGlobalAlphaFactorsSUN = nullptr;
+void m_glGlobalAlphaFactorsSUN_profile(GLshort a0)const{return this->m_profile(2502,m_next_glGlobalAlphaFactorsSUN,a0);}
+FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC m_next_glGetTrackMatrixivNV = nullptr;
+void m_glGetTrackMatrixivNV_profile(GLenum a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(2503,m_next_glGetTrackMatrixivNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC m_next_glTextureParameterfvEXT = nullptr;
+void m_glTextureParameterfvEXT_profile(GLuint a0,GLenum a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(2504,m_next_glTextureParameterfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC m_next_glIsNamedBufferResidentNV = nullptr;
+GLboolean m_glIsNamedBufferResidentNV_profile(GLuint a0)const{return this->m_profile(2505,m_next_glIsNamedBufferResidentNV,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC m_next_glProgramUniform4ui64vARB = nullptr;
+void m_glProgramUniform4ui64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{return this->m_profile(2506,m_next_glProgramUniform4ui64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC m_next_glTbufferMask3DFX = nullptr;
+void m_glTbufferMask3DFX_profile(GLuint a0)const{return this->m_profile(2507,m_next_glTbufferMask3DFX,a0);}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC m_next_glCoverFillPathNV = nullptr;
+void m_glCoverFillPathNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(2508,m_next_glCoverFillPathNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC m_next_glVertexAttrib1fvARB = nullptr;
+void m_glVertexAttrib1fvARB_profile(GLuint a0,const GLfloat* a1)const{return this->m_profile(2509,m_next_glVertexAttrib1fvARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC m_next_glGenerateTextureMipmap = nullptr;
+void m_glGenerateTextureMipmap_profile(GLuint a0)const{return this->m_profile(2510,m_next_glGenerateTextureMipmap,a0);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC m_next_glNamedProgramLocalParameterI4uivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uivEXT_profile(GLuint a0,GLenum a1,GLuint a2,const GLuint* a3)const{return this->m_profile(2511,m_next_glNamedProgramLocalParameterI4uivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC m_next_glMultiDrawElementsBaseVertex = nullptr;
+void m_glMultiDrawElementsBaseVertex_profile(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4,const GLint* a5)const{return this->m_profile(2512,m_next_glMultiDrawElementsBaseVertex,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC m_next_glProgramSubroutineParametersuivNV = nullptr;
+void m_glProgramSubroutineParametersuivNV_profile(GLenum a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2513,m_next_glProgramSubroutineParametersuivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC m_next_glProgramUniformMatrix2x4dvEXT = nullptr;
+void m_glProgramUniformMatrix2x4dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{return this->m_profile(2514,m_next_glProgramUniformMatrix2x4dvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLROTATEXOESPROC m_next_glRotatexOES = nullptr;
+void m_glRotatexOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(2515,m_next_glRotatexOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC m_next_glMemoryBarrierEXT = nullptr;
+void m_glMemoryBarrierEXT_profile(GLbitfield a0)const{return this->m_profile(2516,m_next_glMemoryBarrierEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC m_next_glVertexAttrib3svNV = nullptr;
+void m_glVertexAttrib3svNV_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2517,m_next_glVertexAttrib3svNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC m_next_glVertexStream3iATI = nullptr;
+void m_glVertexStream3iATI_profile(GLenum a0,GLint a1,GLint a2,GLint a3)const{return this->m_profile(2518,m_next_glVertexStream3iATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC m_next_glCompressedTexSubImage1D = nullptr;
+void m_glCompressedTexSubImage1D_profile(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const GLvoid* a6)const{return this->m_profile(2519,m_next_glCompressedTexSubImage1D,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLSETFENCENVPROC m_next_glSetFenceNV = nullptr;
+void m_glSetFenceNV_profile(GLuint a0,GLenum a1)const{return this->m_profile(2520,m_next_glSetFenceNV,a0,a1);}
+FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC m_next_glAttachObjectARB = nullptr;
+void m_glAttachObjectARB_profile(GLhandleARB a0,GLhandleARB a1)const{return this->m_profile(2521,m_next_glAttachObjectARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC m_next_glCopyConvolutionFilter1D = nullptr;
+void m_glCopyConvolutionFilter1D_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(2522,m_next_glCopyConvolutionFilter1D,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC m_next_glTexStorageMem2DMultisampleEXT = nullptr;
+void m_glTexStorageMem2DMultisampleEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5,GLuint a6,GLuint64 a7)const{return this->m_profile(2523,m_next_glTexStorageMem2DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC m_next_glProgramParameters4fvNV = nullptr;
+void m_glProgramParameters4fvNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{return this->m_profile(2524,m_next_glProgramParameters4fvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC m_next_glNamedFramebufferParameteriEXT = nullptr;
+void m_glNamedFramebufferParameteriEXT_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(2525,m_next_glNamedFramebufferParameteriEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC m_next_glVertexAttrib4Nsv = nullptr;
+void m_glVertexAttrib4Nsv_profile(GLuint a0,const GLshort* a1)const{return this->m_profile(2526,m_next_glVertexAttrib4Nsv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC m_next_glVertexAttribI4usvEXT = nullptr;
+void m_glVertexAttribI4usvEXT_profile(GLuint a0,const GLushort* a1)const{return this->m_profile(2527,m_next_glVertexAttribI4usvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC m_next_glTextureBufferRangeEXT = nullptr;
+void m_glTextureBufferRangeEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLintptr a4,GLsizeiptr a5)const{return this->m_profile(2528,m_next_glTextureBufferRangeEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC m_next_glVertexP3uiv = nullptr;
+void m_glVertexP3uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(2529,m_next_glVertexP3uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLISPATHNVPROC m_next_glIsPathNV = nullptr;
+GLboolean m_glIsPathNV_profile(GLuint a0)const{return this->m_profile(2530,m_next_glIsPathNV,a0);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC m_next_glGetnUniformi64vARB = nullptr;
+void m_glGetnUniformi64vARB_profile(GLuint a0,GLint a1,GLsizei a2,GLint64* a3)const{return this->m_profile(2531,m_next_glGetnUniformi64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC m_next_glFramebufferTextureMultiviewOVR = nullptr;
+void m_glFramebufferTextureMultiviewOVR_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4,GLsizei a5)const{return this->m_profile(2532,m_next_glFramebufferTextureMultiviewOVR,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC m_next_glCompressedMultiTexSubImage2DEXT = nullptr;
+void m_glCompressedMultiTexSubImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLsizei a8,const void* a9)const{return this->m_profile(2533,m_next_glCompressedMultiTexSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLGETNMAPDVPROC m_next_glGetnMapdv = nullptr;
+void m_glGetnMapdv_profile(GLenum a0,GLenum a1,GLsizei a2,GLdouble* a3)const{return this->m_profile(2534,m_next_glGetnMapdv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC m_next_glDebugMessageCallback = nullptr;
+void m_glDebugMessageCallback_profile(GLDEBUGPROC a0,const void* a1)const{return this->m_profile(2535,m_next_glDebugMessageCallback,a0,a1);}
+FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC m_next_glTangent3svEXT = nullptr;
+void m_glTangent3svEXT_profile(const GLshort* a0)const{return this->m_profile(2536,m_next_glTangent3svEXT,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC m_next_glVertexAttribParameteriAMD = nullptr;
+void m_glVertexAttribParameteriAMD_profile(GLuint a0,GLenum a1,GLint a2)const{return this->m_profile(2537,m_next_glVertexAttribParameteriAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC m_next_glBufferSubDataARB = nullptr;
+void m_glBufferSubDataARB_profile(GLenum a0,GLintptrARB a1,GLsizeiptrARB a2,const void* a3)const{return this->m_profile(2538,m_next_glBufferSubDataARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC m_next_glGetVertexAttribLui64vARB = nullptr;
+void m_glGetVertexAttribLui64vARB_profile(GLuint a0,GLenum a1,GLuint64EXT* a2)const{return this->m_profile(2539,m_next_glGetVertexAttribLui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC m_next_glVertexAttribL4ui64NV = nullptr;
+void m_glVertexAttribL4ui64NV_profile(GLuint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{return this->m_profile(2540,m_next_glVertexAttribL4ui64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC m_next_glReplacementCodeuiColor4ubVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fSUN_profile(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4,GLfloat a5,GLfloat a6,GLfloat a7)const{return this->m_profile(2541,m_next_glReplacementCodeuiColor4ubVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC m_next_glImageTransformParameterfHP = nullptr;
+void m_glImageTransformParameterfHP_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(2542,m_next_glImageTransformParameterfHP,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAP1FPROC m_next_glMap1f = nullptr;
+void m_glMap1f_profile(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,const GLfloat* a5)const{return this->m_profile(2543,m_next_glMap1f,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC m_next_glRasterPos4fv = nullptr;
+void m_glRasterPos4fv_profile(const GLfloat* a0)const{return this->m_profile(2544,m_next_glRasterPos4fv,a0);}
+FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC m_next_glVertex2bvOES = nullptr;
+void m_glVertex2bvOES_profile(const GLbyte* a0)const{return this->m_profile(2545,m_next_glVertex2bvOES,a0);}
+FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC m_next_glGetMapControlPointsNV = nullptr;
+void m_glGetMapControlPointsNV_profile(GLenum a0,GLuint a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5,void* a6)const{return this->m_profile(2546,m_next_glGetMapControlPointsNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC m_next_glNamedProgramLocalParametersI4ivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4ivEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLint* a4)const{return this->m_profile(2547,m_next_glNamedProgramLocalParametersI4ivEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC m_next_glBindBufferRangeNV = nullptr;
+void m_glBindBufferRangeNV_profile(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(2548,m_next_glBindBufferRangeNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC m_next_glVertexStream3dvATI = nullptr;
+void m_glVertexStream3dvATI_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2549,m_next_glVertexStream3dvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC m_next_glNormalPointerListIBM = nullptr;
+void m_glNormalPointerListIBM_profile(GLenum a0,GLint a1,const void** a2,GLint a3)const{return this->m_profile(2550,m_next_glNormalPointerListIBM,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC m_next_glFogFuncSGIS = nullptr;
+void m_glFogFuncSGIS_profile(GLsizei a0,const GLfloat* a1)const{return this->m_profile(2551,m_next_glFogFuncSGIS,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC m_next_glMultiModeDrawArraysIBM = nullptr;
+void m_glMultiModeDrawArraysIBM_profile(const GLenum* a0,const GLint* a1,const GLsizei* a2,GLsizei a3,GLint a4)const{return this->m_profile(2552,m_next_glMultiModeDrawArraysIBM,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_next_glGetNamedFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetNamedFramebufferAttachmentParameterivEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(2553,m_next_glGetNamedFramebufferAttachmentParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETFLOATVPROC m_next_glGetFloatv = nullptr;
+void m_glGetFloatv_profile(GLenum a0,GLfloat* a1)const{return this->m_profile(2554,m_next_glGetFloatv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC m_next_glVertexArrayVertexAttribIFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribIFormatEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{return this->m_profile(2555,m_next_glVertexArrayVertexAttribIFormatEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLHINTPROC m_next_glHint = nullptr;
+void m_glHint_profile(GLenum a0,GLenum a1)const{return this->m_profile(2556,m_next_glHint,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC m_next_glVertexStream2svATI = nullptr;
+void m_glVertexStream2svATI_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(2557,m_next_glVertexStream2svATI,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC m_next_glMultiDrawArraysIndirect = nullptr;
+void m_glMultiDrawArraysIndirect_profile(GLenum a0,const void* a1,GLsizei a2,GLsizei a3)const{return this->m_profile(2558,m_next_glMultiDrawArraysIndirect,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC m_next_glMultiTexEnvfvEXT = nullptr;
+void m_glMultiTexEnvfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(2559,m_next_glMultiTexEnvfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC m_next_glVertexAttribP2uiv = nullptr;
+void m_glVertexAttribP2uiv_profile(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{return this->m_profile(2560,m_next_glVertexAttribP2uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC m_next_glProgramUniform1i64vARB = nullptr;
+void m_glProgramUniform1i64vARB_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{return this->m_profile(2561,m_next_glProgramUniform1i64vARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC m_next_glFramebufferTextureARB = nullptr;
+void m_glFramebufferTextureARB_profile(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{return this->m_profile(2562,m_next_glFramebufferTextureARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC m_next_glPushClientAttribDefaultEXT = nullptr;
+void m_glPushClientAttribDefaultEXT_profile(GLbitfield a0)const{return this->m_profile(2563,m_next_glPushClientAttribDefaultEXT,a0);}
+FunctionTable::MEMBERPFNGLSCALEFPROC m_next_glScalef = nullptr;
+void m_glScalef_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2564,m_next_glScalef,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSCALEDPROC m_next_glScaled = nullptr;
+void m_glScaled_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2565,m_next_glScaled,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC m_next_glGetConvolutionParameterxvOES = nullptr;
+void m_glGetConvolutionParameterxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(2566,m_next_glGetConvolutionParameterxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC m_next_glGetProgramResourceName = nullptr;
+void m_glGetProgramResourceName_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,GLsizei* a4,GLchar* a5)const{return this->m_profile(2567,m_next_glGetProgramResourceName,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC m_next_glCopyColorTable = nullptr;
+void m_glCopyColorTable_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(2568,m_next_glCopyColorTable,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC m_next_glDepthRangeArrayv = nullptr;
+void m_glDepthRangeArrayv_profile(GLuint a0,GLsizei a1,const GLdouble* a2)const{return this->m_profile(2569,m_next_glDepthRangeArrayv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC m_next_glCoverFillPathInstancedNV = nullptr;
+void m_glCoverFillPathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLenum a5,const GLfloat* a6)const{return this->m_profile(2570,m_next_glCoverFillPathInstancedNV,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC m_next_glMultiTexParameterivEXT = nullptr;
+void m_glMultiTexParameterivEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(2571,m_next_glMultiTexParameterivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC m_next_glGetActiveAtomicCounterBufferiv = nullptr;
+void m_glGetActiveAtomicCounterBufferiv_profile(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(2572,m_next_glGetActiveAtomicCounterBufferiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC m_next_glStencilOpSeparate = nullptr;
+void m_glStencilOpSeparate_profile(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{return this->m_profile(2573,m_next_glStencilOpSeparate,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC m_next_glVertexAttrib4fNV = nullptr;
+void m_glVertexAttrib4fNV_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(2574,m_next_glVertexAttrib4fNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC m_next_glGetColorTableParameterivSGI = nullptr;
+void m_glGetColorTableParameterivSGI_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2575,m_next_glGetColorTableParameterivSGI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC m_next_glVertexArrayAttribBinding = nullptr;
+void m_glVertexArrayAttribBinding_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2576,m_next_glVertexArrayAttribBinding,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC m_next_glIsSemaphoreEXT = nullptr;
+GLboolean m_glIsSemaphoreEXT_profile(GLuint a0)const{return this->m_profile(2577,m_next_glIsSemaphoreEXT,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC m_next_glProgramParameters4dvNV = nullptr;
+void m_glProgramParameters4dvNV_profile(GLenum a0,GLuint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(2578,m_next_glProgramParameters4dvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC m_next_glVertexAttribL4dv = nullptr;
+void m_glVertexAttribL4dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2579,m_next_glVertexAttribL4dv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC m_next_glGetTexParameteriv = nullptr;
+void m_glGetTexParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2580,m_next_glGetTexParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC m_next_glGetUniformOffsetEXT = nullptr;
+GLintptr m_glGetUniformOffsetEXT_profile(GLuint a0,GLint a1)const{return this->m_profile(2581,m_next_glGetUniformOffsetEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC m_next_glGetVertexAttribPointerv = nullptr;
+void m_glGetVertexAttribPointerv_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(2582,m_next_glGetVertexAttribPointerv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC m_next_glResumeTransformFeedbackNV = nullptr;
+void m_glResumeTransformFeedbackNV_profile()const{return this->m_profile(2583,m_next_glResumeTransformFeedbackNV);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC m_next_glProgramUniform3i64vNV = nullptr;
+void m_glProgramUniform3i64vNV_profile(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{return this->m_profile(2584,m_next_glProgramUniform3i64vNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC m_next_glTangent3fEXT = nullptr;
+void m_glTangent3fEXT_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2585,m_next_glTangent3fEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC m_next_glGetPathMetricRangeNV = nullptr;
+void m_glGetPathMetricRangeNV_profile(GLbitfield a0,GLuint a1,GLsizei a2,GLsizei a3,GLfloat* a4)const{return this->m_profile(2586,m_next_glGetPathMetricRangeNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC m_next_glWindowPos2iMESA = nullptr;
+void m_glWindowPos2iMESA_profile(GLint a0,GLint a1)const{return this->m_profile(2587,m_next_glWindowPos2iMESA,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC m_next_glVertex2xvOES = nullptr;
+void m_glVertex2xvOES_profile(const GLfixed* a0)const{return this->m_profile(2588,m_next_glVertex2xvOES,a0);}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC m_next_glGetnCompressedTexImage = nullptr;
+void m_glGetnCompressedTexImage_profile(GLenum a0,GLint a1,GLsizei a2,void* a3)const{return this->m_profile(2589,m_next_glGetnCompressedTexImage,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC m_next_glWindowPos2dv = nullptr;
+void m_glWindowPos2dv_profile(const GLdouble* a0)const{return this->m_profile(2590,m_next_glWindowPos2dv,a0);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC m_next_glReplacementCodeuiVertex3fSUN = nullptr;
+void m_glReplacementCodeuiVertex3fSUN_profile(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2591,m_next_glReplacementCodeuiVertex3fSUN,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC m_next_glGetTransformFeedbackVaryingEXT = nullptr;
+void m_glGetTransformFeedbackVaryingEXT_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLsizei* a4,GLenum* a5,GLchar* a6)const{return this->m_profile(2592,m_next_glGetTransformFeedbackVaryingEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC m_next_glWindowPos3fARB = nullptr;
+void m_glWindowPos3fARB_profile(GLfloat a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2593,m_next_glWindowPos3fARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC m_next_glMapNamedBufferEXT = nullptr;
+void* m_glMapNamedBufferEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(2594,m_next_glMapNamedBufferEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLDISABLEPROC m_next_glDisable = nullptr;
+void m_glDisable_profile(GLenum a0)const{return this->m_profile(2595,m_next_glDisable,a0);}
+FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC m_next_glIsPointInFillPathNV = nullptr;
+GLboolean m_glIsPointInFillPathNV_profile(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2596,m_next_glIsPointInFillPathNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC m_next_glVertexAttribI2uiEXT = nullptr;
+void m_glVertexAttribI2uiEXT_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2597,m_next_glVertexAttribI2uiEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC m_next_glProgramUniform4uiv = nullptr;
+void m_glProgramUniform4uiv_profile(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{return this->m_profile(2598,m_next_glProgramUniform4uiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC m_next_glQueryCounter = nullptr;
+void m_glQueryCounter_profile(GLuint a0,GLenum a1)const{return this->m_profile(2599,m_next_glQueryCounter,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC m_next_glFramebufferRenderbufferEXT = nullptr;
+void m_glFramebufferRenderbufferEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{return this->m_profile(2600,m_next_glFramebufferRenderbufferEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC m_next_glBinormal3svEXT = nullptr;
+void m_glBinormal3svEXT_profile(const GLshort* a0)const{return this->m_profile(2601,m_next_glBinormal3svEXT,a0);}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC m_next_glBindBufferOffsetNV = nullptr;
+void m_glBindBufferOffsetNV_profile(GLenum a0,GLuint a1,GLuint a2,GLintptr a3)const{return this->m_profile(2602,m_next_glBindBufferOffsetNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC m_next_glCopyTextureSubImage2D = nullptr;
+void m_glCopyTextureSubImage2D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{return this->m_profile(2603,m_next_glCopyTextureSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC m_next_glGetProgramResourcefvNV = nullptr;
+void m_glGetProgramResourcefvNV_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLenum* a4,GLsizei a5,GLsizei* a6,GLfloat* a7)const{return this->m_profile(2604,m_next_glGetProgramResourcefvNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC m_next_glBinormalPointerEXT = nullptr;
+void m_glBinormalPointerEXT_profile(GLenum a0,GLsizei a1,const void* a2)const{return this->m_profile(2605,m_next_glBinormalPointerEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETLIGHTFVPROC m_next_glGetLightfv = nullptr;
+void m_glGetLightfv_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2606,m_next_glGetLightfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC m_next_glMulticastCopyImageSubDataNV = nullptr;
+void m_glMulticastCopyImageSubDataNV_profile(GLuint a0,GLbitfield a1,GLuint a2,GLenum a3,GLint a4,GLint a5,GLint a6,GLint a7,GLuint a8,GLenum a9,GLint a10,GLint a11,GLint a12,GLint a13,GLsizei a14,GLsizei a15,GLsizei a16)const{return this->m_profile(2607,m_next_glMulticastCopyImageSubDataNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}
+FunctionTable::MEMBERPFNGLVERTEX2BOESPROC m_next_glVertex2bOES = nullptr;
+void m_glVertex2bOES_profile(GLbyte a0,GLbyte a1)const{return this->m_profile(2608,m_next_glVertex2bOES,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC m_next_glUniform2ivARB = nullptr;
+void m_glUniform2ivARB_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(2609,m_next_glUniform2ivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC m_next_glMultiTexCoord3s = nullptr;
+void m_glMultiTexCoord3s_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(2610,m_next_glMultiTexCoord3s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC m_next_glGetHistogramParameterfvEXT = nullptr;
+void m_glGetHistogramParameterfvEXT_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2611,m_next_glGetHistogramParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC m_next_glGetProgramStringNV = nullptr;
+void m_glGetProgramStringNV_profile(GLuint a0,GLenum a1,GLubyte* a2)const{return this->m_profile(2612,m_next_glGetProgramStringNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC m_next_glGetTexGenxvOES = nullptr;
+void m_glGetTexGenxvOES_profile(GLenum a0,GLenum a1,GLfixed* a2)const{return this->m_profile(2613,m_next_glGetTexGenxvOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC m_next_glTextureSubImage2D = nullptr;
+void m_glTextureSubImage2D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const void* a8)const{return this->m_profile(2614,m_next_glTextureSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC m_next_glObjectPurgeableAPPLE = nullptr;
+GLenum m_glObjectPurgeableAPPLE_profile(GLenum a0,GLuint a1,GLenum a2)const{return this->m_profile(2615,m_next_glObjectPurgeableAPPLE,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC m_next_glColorTableSGI = nullptr;
+void m_glColorTableSGI_profile(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{return this->m_profile(2616,m_next_glColorTableSGI,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC m_next_glCopyConvolutionFilter2DEXT = nullptr;
+void m_glCopyConvolutionFilter2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2617,m_next_glCopyConvolutionFilter2DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC m_next_glMultiTexCoord3f = nullptr;
+void m_glMultiTexCoord3f_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2618,m_next_glMultiTexCoord3f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC m_next_glMultiTexCoord3d = nullptr;
+void m_glMultiTexCoord3d_profile(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2619,m_next_glMultiTexCoord3d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFOGCOORDDVPROC m_next_glFogCoorddv = nullptr;
+void m_glFogCoorddv_profile(const GLdouble* a0)const{return this->m_profile(2620,m_next_glFogCoorddv,a0);}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC m_next_glGetBufferPointerv = nullptr;
+void m_glGetBufferPointerv_profile(GLenum a0,GLenum a1,void** a2)const{return this->m_profile(2621,m_next_glGetBufferPointerv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC m_next_glProgramUniform1fEXT = nullptr;
+void m_glProgramUniform1fEXT_profile(GLuint a0,GLint a1,GLfloat a2)const{return this->m_profile(2622,m_next_glProgramUniform1fEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC m_next_glWindowPos2fvMESA = nullptr;
+void m_glWindowPos2fvMESA_profile(const GLfloat* a0)const{return this->m_profile(2623,m_next_glWindowPos2fvMESA,a0);}
+FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC m_next_glAlphaToCoverageDitherControlNV = nullptr;
+void m_glAlphaToCoverageDitherControlNV_profile(GLenum a0)const{return this->m_profile(2624,m_next_glAlphaToCoverageDitherControlNV,a0);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC m_next_glPolygonOffsetxOES = nullptr;
+void m_glPolygonOffsetxOES_profile(GLfixed a0,GLfixed a1)const{return this->m_profile(2625,m_next_glPolygonOffsetxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC m_next_glVertexAttrib4dARB = nullptr;
+void m_glVertexAttrib4dARB_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(2626,m_next_glVertexAttrib4dARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC m_next_glUniformHandleui64vARB = nullptr;
+void m_glUniformHandleui64vARB_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(2627,m_next_glUniformHandleui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC m_next_glFragmentLightModelfvSGIX = nullptr;
+void m_glFragmentLightModelfvSGIX_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2628,m_next_glFragmentLightModelfvSGIX,a0,a1);}
+FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC m_next_glSwizzleEXT = nullptr;
+void m_glSwizzleEXT_profile(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{return this->m_profile(2629,m_next_glSwizzleEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC m_next_glBindFragmentShaderATI = nullptr;
+void m_glBindFragmentShaderATI_profile(GLuint a0)const{return this->m_profile(2630,m_next_glBindFragmentShaderATI,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC m_next_glVertexAttribs3hvNV = nullptr;
+void m_glVertexAttribs3hvNV_profile(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{return this->m_profile(2631,m_next_glVertexAttribs3hvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC m_next_glGenBuffersARB = nullptr;
+void m_glGenBuffersARB_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2632,m_next_glGenBuffersARB,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC m_next_glTextureStorageMem2DMultisampleEXT = nullptr;
+void m_glTextureStorageMem2DMultisampleEXT_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5,GLuint a6,GLuint64 a7)const{return this->m_profile(2633,m_next_glTextureStorageMem2DMultisampleEXT,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC m_next_glListParameterfvSGIX = nullptr;
+void m_glListParameterfvSGIX_profile(GLuint a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2634,m_next_glListParameterfvSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC m_next_glNamedRenderbufferStorageMultisample = nullptr;
+void m_glNamedRenderbufferStorageMultisample_profile(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(2635,m_next_glNamedRenderbufferStorageMultisample,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC m_next_glVertexAttribI1iEXT = nullptr;
+void m_glVertexAttribI1iEXT_profile(GLuint a0,GLint a1)const{return this->m_profile(2636,m_next_glVertexAttribI1iEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC m_next_glMultiTexCoord2ivARB = nullptr;
+void m_glMultiTexCoord2ivARB_profile(GLenum a0,const GLint* a1)const{return this->m_profile(2637,m_next_glMultiTexCoord2ivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC m_next_glLightModelxOES = nullptr;
+void m_glLightModelxOES_profile(GLenum a0,GLfixed a1)const{return this->m_profile(2638,m_next_glLightModelxOES,a0,a1);}
+FunctionTable::MEMBERPFNGLCOLOR3XOESPROC m_next_glColor3xOES = nullptr;
+void m_glColor3xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2)const{return this->m_profile(2639,m_next_glColor3xOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLREADBUFFERPROC m_next_glReadBuffer = nullptr;
+void m_glReadBuffer_profile(GLenum a0)const{return this->m_profile(2640,m_next_glReadBuffer,a0);}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC m_next_glStencilFillPathInstancedNV = nullptr;
+void m_glStencilFillPathInstancedNV_profile(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLuint a5,GLenum a6,const GLfloat* a7)const{return this->m_profile(2641,m_next_glStencilFillPathInstancedNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC m_next_glVDPAUUnmapSurfacesNV = nullptr;
+void m_glVDPAUUnmapSurfacesNV_profile(GLsizei a0,const GLvdpauSurfaceNV* a1)const{return this->m_profile(2642,m_next_glVDPAUUnmapSurfacesNV,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC m_next_glProgramUniform4i64NV = nullptr;
+void m_glProgramUniform4i64NV_profile(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4,GLint64EXT a5)const{return this->m_profile(2643,m_next_glProgramUniform4i64NV,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC m_next_glVertexStream4dvATI = nullptr;
+void m_glVertexStream4dvATI_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2644,m_next_glVertexStream4dvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLISQUERYPROC m_next_glIsQuery = nullptr;
+GLboolean m_glIsQuery_profile(GLuint a0)const{return this->m_profile(2645,m_next_glIsQuery,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC m_next_glProgramUniformMatrix4fvEXT = nullptr;
+void m_glProgramUniformMatrix4fvEXT_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(2646,m_next_glProgramUniformMatrix4fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC m_next_glVertexAttrib3hNV = nullptr;
+void m_glVertexAttrib3hNV_profile(GLuint a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{return this->m_profile(2647,m_next_glVertexAttrib3hNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC m_next_glFlushMappedNamedBufferRange = nullptr;
+void m_glFlushMappedNamedBufferRange_profile(GLuint a0,GLintptr a1,GLsizeiptr a2)const{return this->m_profile(2648,m_next_glFlushMappedNamedBufferRange,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPUSHNAMEPROC m_next_glPushName = nullptr;
+void m_glPushName_profile(GLuint a0)const{return this->m_profile(2649,m_next_glPushName,a0);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC m_next_glGetClipPlane = nullptr;
+void m_glGetClipPlane_profile(GLenum a0,GLdouble* a1)const{return this->m_profile(2650,m_next_glGetClipPlane,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEX4DVPROC m_next_glVertex4dv = nullptr;
+void m_glVertex4dv_profile(const GLdouble* a0)const{return this->m_profile(2651,m_next_glVertex4dv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC m_next_glVertexAttrib3d = nullptr;
+void m_glVertexAttrib3d_profile(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2652,m_next_glVertexAttrib3d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBLENDCOLORPROC m_next_glBlendColor = nullptr;
+void m_glBlendColor_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2653,m_next_glBlendColor,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC m_next_glBindTransformFeedbackNV = nullptr;
+void m_glBindTransformFeedbackNV_profile(GLenum a0,GLuint a1)const{return this->m_profile(2654,m_next_glBindTransformFeedbackNV,a0,a1);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC m_next_glSamplerParameterIuiv = nullptr;
+void m_glSamplerParameterIuiv_profile(GLuint a0,GLenum a1,const GLuint* a2)const{return this->m_profile(2655,m_next_glSamplerParameterIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLINDEXUBVPROC m_next_glIndexubv = nullptr;
+void m_glIndexubv_profile(const GLubyte* a0)const{return this->m_profile(2656,m_next_glIndexubv,a0);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC m_next_glNamedBufferPageCommitmentEXT = nullptr;
+void m_glNamedBufferPageCommitmentEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{return this->m_profile(2657,m_next_glNamedBufferPageCommitmentEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC m_next_glCheckNamedFramebufferStatus = nullptr;
+GLenum m_glCheckNamedFramebufferStatus_profile(GLuint a0,GLenum a1)const{return this->m_profile(2658,m_next_glCheckNamedFramebufferStatus,a0,a1);}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC m_next_glGetObjectBufferfvATI = nullptr;
+void m_glGetObjectBufferfvATI_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2659,m_next_glGetObjectBufferfvATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLRASTERPOS4DPROC m_next_glRasterPos4d = nullptr;
+void m_glRasterPos4d_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2660,m_next_glRasterPos4d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLRASTERPOS4FPROC m_next_glRasterPos4f = nullptr;
+void m_glRasterPos4f_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2661,m_next_glRasterPos4f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC m_next_glGetPerfMonitorCounterStringAMD = nullptr;
+void m_glGetPerfMonitorCounterStringAMD_profile(GLuint a0,GLuint a1,GLsizei a2,GLsizei* a3,GLchar* a4)const{return this->m_profile(2662,m_next_glGetPerfMonitorCounterStringAMD,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC m_next_glVertexAttrib3s = nullptr;
+void m_glVertexAttrib3s_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(2663,m_next_glVertexAttrib3s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC m_next_glDrawElementsInstancedEXT = nullptr;
+void m_glDrawElementsInstancedEXT_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{return this->m_profile(2664,m_next_glDrawElementsInstancedEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC m_next_glNamedProgramLocalParameterI4iEXT = nullptr;
+void m_glNamedProgramLocalParameterI4iEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4,GLint a5,GLint a6)const{return this->m_profile(2665,m_next_glNamedProgramLocalParameterI4iEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLRASTERPOS4SPROC m_next_glRasterPos4s = nullptr;
+void m_glRasterPos4s_profile(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(2666,m_next_glRasterPos4s,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC m_next_glGetProgramStageiv = nullptr;
+void m_glGetProgramStageiv_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(2667,m_next_glGetProgramStageiv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC m_next_glGetMaterialxOES = nullptr;
+void m_glGetMaterialxOES_profile(GLenum a0,GLenum a1,GLfixed a2)const{return this->m_profile(2668,m_next_glGetMaterialxOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOPMATRIXPROC m_next_glPopMatrix = nullptr;
+void m_glPopMatrix_profile()const{return this->m_profile(2669,m_next_glPopMatrix);}
+FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC m_next_glGetVideoui64vNV = nullptr;
+void m_glGetVideoui64vNV_profile(GLuint a0,GLenum a1,GLuint64EXT* a2)const{return this->m_profile(2670,m_next_glGetVideoui64vNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC m_next_glTangent3bEXT = nullptr;
+void m_glTangent3bEXT_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(2671,m_next_glTangent3bEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC m_next_glGetGraphicsResetStatusARB = nullptr;
+GLenum m_glGetGraphicsResetStatusARB_profile()const{return this->m_profile(2672,m_next_glGetGraphicsResetStatusARB);}
+FunctionTable::MEMBERPFNGLUNIFORM4IPROC m_next_glUniform4i = nullptr;
+void m_glUniform4i_profile(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{return this->m_profile(2673,m_next_glUniform4i,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC m_next_glActiveTexture = nullptr;
+void m_glActiveTexture_profile(GLenum a0)const{return this->m_profile(2674,m_next_glActiveTexture,a0);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC m_next_glEnableVertexAttribArray = nullptr;
+void m_glEnableVertexAttribArray_profile(GLuint a0)const{return this->m_profile(2675,m_next_glEnableVertexAttribArray,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC m_next_glTexCoord4fVertex4fvSUN = nullptr;
+void m_glTexCoord4fVertex4fvSUN_profile(const GLfloat* a0,const GLfloat* a1)const{return this->m_profile(2676,m_next_glTexCoord4fVertex4fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM4DPROC m_next_glUniform4d = nullptr;
+void m_glUniform4d_profile(GLint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{return this->m_profile(2677,m_next_glUniform4d,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM4FPROC m_next_glUniform4f = nullptr;
+void m_glUniform4f_profile(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(2678,m_next_glUniform4f,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC m_next_glRenderbufferStorageMultisample = nullptr;
+void m_glRenderbufferStorageMultisample_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{return this->m_profile(2679,m_next_glRenderbufferStorageMultisample,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC m_next_glCreateProgramPipelines = nullptr;
+void m_glCreateProgramPipelines_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2680,m_next_glCreateProgramPipelines,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC m_next_glVertexAttribLPointer = nullptr;
+void m_glVertexAttribLPointer_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(2681,m_next_glVertexAttribLPointer,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC m_next_glUniform2uiEXT = nullptr;
+void m_glUniform2uiEXT_profile(GLint a0,GLuint a1,GLuint a2)const{return this->m_profile(2682,m_next_glUniform2uiEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC m_next_glMultiTexCoord3sv = nullptr;
+void m_glMultiTexCoord3sv_profile(GLenum a0,const GLshort* a1)const{return this->m_profile(2683,m_next_glMultiTexCoord3sv,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC m_next_glDrawElementsInstancedBaseVertex = nullptr;
+void m_glDrawElementsInstancedBaseVertex_profile(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLint a5)const{return this->m_profile(2684,m_next_glDrawElementsInstancedBaseVertex,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC m_next_glPixelTransformParameterfvEXT = nullptr;
+void m_glPixelTransformParameterfvEXT_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2685,m_next_glPixelTransformParameterfvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC m_next_glDrawTransformFeedbackNV = nullptr;
+void m_glDrawTransformFeedbackNV_profile(GLenum a0,GLuint a1)const{return this->m_profile(2686,m_next_glDrawTransformFeedbackNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC m_next_glTextureImage2DMultisampleCoverageNV = nullptr;
+void m_glTextureImage2DMultisampleCoverageNV_profile(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3,GLint a4,GLsizei a5,GLsizei a6,GLboolean a7)const{return this->m_profile(2687,m_next_glTextureImage2DMultisampleCoverageNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC m_next_glNamedRenderbufferStorageMultisampleCoverageEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_profile(GLuint a0,GLsizei a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2688,m_next_glNamedRenderbufferStorageMultisampleCoverageEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLISTEXTUREPROC m_next_glIsTexture = nullptr;
+GLboolean m_glIsTexture_profile(GLuint a0)const{return this->m_profile(2689,m_next_glIsTexture,a0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC m_next_glMultiTexCoord4iv = nullptr;
+void m_glMultiTexCoord4iv_profile(GLenum a0,const GLint* a1)const{return this->m_profile(2690,m_next_glMultiTexCoord4iv,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXENVFVPROC m_next_glTexEnvfv = nullptr;
+void m_glTexEnvfv_profile(GLenum a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2691,m_next_glTexEnvfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC m_next_glPopDebugGroup = nullptr;
+void m_glPopDebugGroup_profile()const{return this->m_profile(2692,m_next_glPopDebugGroup);}
+FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC m_next_glUniformBlockBinding = nullptr;
+void m_glUniformBlockBinding_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2693,m_next_glUniformBlockBinding,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC m_next_glWindowPos2svMESA = nullptr;
+void m_glWindowPos2svMESA_profile(const GLshort* a0)const{return this->m_profile(2694,m_next_glWindowPos2svMESA,a0);}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC m_next_glGenerateTextureMipmapEXT = nullptr;
+void m_glGenerateTextureMipmapEXT_profile(GLuint a0,GLenum a1)const{return this->m_profile(2695,m_next_glGenerateTextureMipmapEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC m_next_glBindLightParameterEXT = nullptr;
+GLuint m_glBindLightParameterEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(2696,m_next_glBindLightParameterEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC m_next_glTexCoord3bOES = nullptr;
+void m_glTexCoord3bOES_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(2697,m_next_glTexCoord3bOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC m_next_glTexCoordPointer = nullptr;
+void m_glTexCoordPointer_profile(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{return this->m_profile(2698,m_next_glTexCoordPointer,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC m_next_glProgramUniformMatrix3x2fv = nullptr;
+void m_glProgramUniformMatrix3x2fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(2699,m_next_glProgramUniformMatrix3x2fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC m_next_glUniform2fvARB = nullptr;
+void m_glUniform2fvARB_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(2700,m_next_glUniform2fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC m_next_glProgramLocalParameterI4uivNV = nullptr;
+void m_glProgramLocalParameterI4uivNV_profile(GLenum a0,GLuint a1,const GLuint* a2)const{return this->m_profile(2701,m_next_glProgramLocalParameterI4uivNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC m_next_glFlushVertexArrayRangeNV = nullptr;
+void m_glFlushVertexArrayRangeNV_profile()const{return this->m_profile(2702,m_next_glFlushVertexArrayRangeNV);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC m_next_glSecondaryColor3svEXT = nullptr;
+void m_glSecondaryColor3svEXT_profile(const GLshort* a0)const{return this->m_profile(2703,m_next_glSecondaryColor3svEXT,a0);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC m_next_glGetBufferParameteriv = nullptr;
+void m_glGetBufferParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2704,m_next_glGetBufferParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC m_next_glGetQueryIndexediv = nullptr;
+void m_glGetQueryIndexediv_profile(GLenum a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(2705,m_next_glGetQueryIndexediv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC m_next_glFramebufferTexture3DEXT = nullptr;
+void m_glFramebufferTexture3DEXT_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{return this->m_profile(2706,m_next_glFramebufferTexture3DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC m_next_glLoadTransposeMatrixxOES = nullptr;
+void m_glLoadTransposeMatrixxOES_profile(const GLfixed* a0)const{return this->m_profile(2707,m_next_glLoadTransposeMatrixxOES,a0);}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC m_next_glDeleteTransformFeedbacksNV = nullptr;
+void m_glDeleteTransformFeedbacksNV_profile(GLsizei a0,const GLuint* a1)const{return this->m_profile(2708,m_next_glDeleteTransformFeedbacksNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC m_next_glGetCompressedTextureImageEXT = nullptr;
+void m_glGetCompressedTextureImageEXT_profile(GLuint a0,GLenum a1,GLint a2,void* a3)const{return this->m_profile(2709,m_next_glGetCompressedTextureImageEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC m_next_glIndexMaterialEXT = nullptr;
+void m_glIndexMaterialEXT_profile(GLenum a0,GLenum a1)const{return this->m_profile(2710,m_next_glIndexMaterialEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC m_next_glFogCoorddEXT = nullptr;
+void m_glFogCoorddEXT_profile(GLdouble a0)const{return this->m_profile(2711,m_next_glFogCoorddEXT,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC m_next_glTexCoord2hvNV = nullptr;
+void m_glTexCoord2hvNV_profile(const GLhalfNV* a0)const{return this->m_profile(2712,m_next_glTexCoord2hvNV,a0);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC m_next_glGetFramebufferParameterfvAMD = nullptr;
+void m_glGetFramebufferParameterfvAMD_profile(GLenum a0,GLenum a1,GLuint a2,GLuint a3,GLsizei a4,GLfloat* a5)const{return this->m_profile(2713,m_next_glGetFramebufferParameterfvAMD,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLTEXENVIVPROC m_next_glTexEnviv = nullptr;
+void m_glTexEnviv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2714,m_next_glTexEnviv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC m_next_glEndTransformFeedbackNV = nullptr;
+void m_glEndTransformFeedbackNV_profile()const{return this->m_profile(2715,m_next_glEndTransformFeedbackNV);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC m_next_glGlobalAlphaFactoruiSUN = nullptr;
+void m_glGlobalAlphaFactoruiSUN_profile(GLuint a0)const{return this->m_profile(2716,m_next_glGlobalAlphaFactoruiSUN,a0);}
+FunctionTable::MEMBERPFNGLSELECTBUFFERPROC m_next_glSelectBuffer = nullptr;
+void m_glSelectBuffer_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2717,m_next_glSelectBuffer,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC m_next_glNamedBufferSubDataEXT = nullptr;
+void m_glNamedBufferSubDataEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{return this->m_profile(2718,m_next_glNamedBufferSubDataEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC m_next_glDisableVertexArrayAttrib = nullptr;
+void m_glDisableVertexArrayAttrib_profile(GLuint a0,GLuint a1)const{return this->m_profile(2719,m_next_glDisableVertexArrayAttrib,a0,a1);}
+FunctionTable::MEMBERPFNGLBLENDFUNCPROC m_next_glBlendFunc = nullptr;
+void m_glBlendFunc_profile(GLenum a0,GLenum a1)const{return this->m_profile(2720,m_next_glBlendFunc,a0,a1);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC m_next_glCreateProgram = nullptr;
+GLuint m_glCreateProgram_profile()const{return this->m_profile(2721,m_next_glCreateProgram);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC m_next_glVertexStream2dATI = nullptr;
+void m_glVertexStream2dATI_profile(GLenum a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2722,m_next_glVertexStream2dATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC m_next_glUniform4ui64vARB = nullptr;
+void m_glUniform4ui64vARB_profile(GLint a0,GLsizei a1,const GLuint64* a2)const{return this->m_profile(2723,m_next_glUniform4ui64vARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC m_next_glGetSemaphoreParameterui64vEXT = nullptr;
+void m_glGetSemaphoreParameterui64vEXT_profile(GLuint a0,GLenum a1,GLuint64* a2)const{return this->m_profile(2724,m_next_glGetSemaphoreParameterui64vEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC m_next_glPrimitiveRestartIndex = nullptr;
+void m_glPrimitiveRestartIndex_profile(GLuint a0)const{return this->m_profile(2725,m_next_glPrimitiveRestartIndex,a0);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC m_next_glNormalStream3fATI = nullptr;
+void m_glNormalStream3fATI_profile(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2726,m_next_glNormalStream3fATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC m_next_glProgramUniformMatrix2fv = nullptr;
+void m_glProgramUniformMatrix2fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(2727,m_next_glProgramUniformMatrix2fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC m_next_glVertexAttribs1hvNV = nullptr;
+void m_glVertexAttribs1hvNV_profile(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{return this->m_profile(2728,m_next_glVertexAttribs1hvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC m_next_glWindowPos4svMESA = nullptr;
+void m_glWindowPos4svMESA_profile(const GLshort* a0)const{return this->m_profile(2729,m_next_glWindowPos4svMESA,a0);}
+FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC m_next_glDeleteFragmentShaderATI = nullptr;
+void m_glDeleteFragmentShaderATI_profile(GLuint a0)const{return this->m_profile(2730,m_next_glDeleteFragmentShaderATI,a0);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC m_next_glBindImageTextures = nullptr;
+void m_glBindImageTextures_profile(GLuint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2731,m_next_glBindImageTextures,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMAP2XOESPROC m_next_glMap2xOES = nullptr;
+void m_glMap2xOES_profile(GLenum a0,GLfixed a1,GLfixed a2,GLint a3,GLint a4,GLfixed a5,GLfixed a6,GLint a7,GLint a8,GLfixed a9)const{return this->m_profile(2732,m_next_glMap2xOES,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLENDPROC m_next_glEnd = nullptr;
+void m_glEnd_profile()const{return this->m_profile(2733,m_next_glEnd);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC m_next_glMultiTexCoord2dARB = nullptr;
+void m_glMultiTexCoord2dARB_profile(GLenum a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2734,m_next_glMultiTexCoord2dARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC m_next_glUniform1i64NV = nullptr;
+void m_glUniform1i64NV_profile(GLint a0,GLint64EXT a1)const{return this->m_profile(2735,m_next_glUniform1i64NV,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC m_next_glPathStringNV = nullptr;
+void m_glPathStringNV_profile(GLuint a0,GLenum a1,GLsizei a2,const void* a3)const{return this->m_profile(2736,m_next_glPathStringNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC m_next_glGetNamedFramebufferParameterivEXT = nullptr;
+void m_glGetNamedFramebufferParameterivEXT_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2737,m_next_glGetNamedFramebufferParameterivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC m_next_glGetProgramNamedParameterdvNV = nullptr;
+void m_glGetProgramNamedParameterdvNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,GLdouble* a3)const{return this->m_profile(2738,m_next_glGetProgramNamedParameterdvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC m_next_glPathDashArrayNV = nullptr;
+void m_glPathDashArrayNV_profile(GLuint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(2739,m_next_glPathDashArrayNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC m_next_glUniform3uiv = nullptr;
+void m_glUniform3uiv_profile(GLint a0,GLsizei a1,const GLuint* a2)const{return this->m_profile(2740,m_next_glUniform3uiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC m_next_glColor3fVertex3fvSUN = nullptr;
+void m_glColor3fVertex3fvSUN_profile(const GLfloat* a0,const GLfloat* a1)const{return this->m_profile(2741,m_next_glColor3fVertex3fvSUN,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC m_next_glMultTransposeMatrixd = nullptr;
+void m_glMultTransposeMatrixd_profile(const GLdouble* a0)const{return this->m_profile(2742,m_next_glMultTransposeMatrixd,a0);}
+FunctionTable::MEMBERPFNGLCLEARCOLORPROC m_next_glClearColor = nullptr;
+void m_glClearColor_profile(GLclampf a0,GLclampf a1,GLclampf a2,GLclampf a3)const{return this->m_profile(2743,m_next_glClearColor,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC m_next_glGetImageHandleARB = nullptr;
+GLuint64 m_glGetImageHandleARB_profile(GLuint a0,GLint a1,GLboolean a2,GLint a3,GLenum a4)const{return this->m_profile(2744,m_next_glGetImageHandleARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC m_next_glTangent3dEXT = nullptr;
+void m_glTangent3dEXT_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2745,m_next_glTangent3dEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC m_next_glGetQueryObjectivARB = nullptr;
+void m_glGetQueryObjectivARB_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2746,m_next_glGetQueryObjectivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC m_next_glGetLocalConstantFloatvEXT = nullptr;
+void m_glGetLocalConstantFloatvEXT_profile(GLuint a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2747,m_next_glGetLocalConstantFloatvEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC m_next_glUseShaderProgramEXT = nullptr;
+void m_glUseShaderProgramEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(2748,m_next_glUseShaderProgramEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC m_next_glBindRenderbufferEXT = nullptr;
+void m_glBindRenderbufferEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(2749,m_next_glBindRenderbufferEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC m_next_glInterleavedArrays = nullptr;
+void m_glInterleavedArrays_profile(GLenum a0,GLsizei a1,const GLvoid* a2)const{return this->m_profile(2750,m_next_glInterleavedArrays,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC m_next_glGetPerfMonitorGroupStringAMD = nullptr;
+void m_glGetPerfMonitorGroupStringAMD_profile(GLuint a0,GLsizei a1,GLsizei* a2,GLchar* a3)const{return this->m_profile(2751,m_next_glGetPerfMonitorGroupStringAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIPROC m_next_glUniform3ui = nullptr;
+void m_glUniform3ui_profile(GLint a0,GLuint a1,GLuint a2,GLuint a3)const{return this->m_profile(2752,m_next_glUniform3ui,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC m_next_glGetNamedProgramLocalParameterdvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterdvEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLdouble* a3)const{return this->m_profile(2753,m_next_glGetNamedProgramLocalParameterdvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC m_next_glDeleteQueryResourceTagNV = nullptr;
+void m_glDeleteQueryResourceTagNV_profile(GLsizei a0,const GLint* a1)const{return this->m_profile(2754,m_next_glDeleteQueryResourceTagNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC m_next_glVertexAttribI4uiv = nullptr;
+void m_glVertexAttribI4uiv_profile(GLuint a0,const GLuint* a1)const{return this->m_profile(2755,m_next_glVertexAttribI4uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC m_next_glVertexAttrib4bv = nullptr;
+void m_glVertexAttrib4bv_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(2756,m_next_glVertexAttrib4bv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC m_next_glMultiTexCoord3xOES = nullptr;
+void m_glMultiTexCoord3xOES_profile(GLenum a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(2757,m_next_glMultiTexCoord3xOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC m_next_glSecondaryColor3ub = nullptr;
+void m_glSecondaryColor3ub_profile(GLubyte a0,GLubyte a1,GLubyte a2)const{return this->m_profile(2758,m_next_glSecondaryColor3ub,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC m_next_glFragmentMaterialfSGIX = nullptr;
+void m_glFragmentMaterialfSGIX_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(2759,m_next_glFragmentMaterialfSGIX,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC m_next_glGetVariantArrayObjectivATI = nullptr;
+void m_glGetVariantArrayObjectivATI_profile(GLuint a0,GLenum a1,GLint* a2)const{return this->m_profile(2760,m_next_glGetVariantArrayObjectivATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC m_next_glSecondaryColor3ui = nullptr;
+void m_glSecondaryColor3ui_profile(GLuint a0,GLuint a1,GLuint a2)const{return this->m_profile(2761,m_next_glSecondaryColor3ui,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC m_next_glVertexAttrib1dARB = nullptr;
+void m_glVertexAttrib1dARB_profile(GLuint a0,GLdouble a1)const{return this->m_profile(2762,m_next_glVertexAttrib1dARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC m_next_glGetNamedBufferPointerv = nullptr;
+void m_glGetNamedBufferPointerv_profile(GLuint a0,GLenum a1,void** a2)const{return this->m_profile(2763,m_next_glGetNamedBufferPointerv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC m_next_glLockArraysEXT = nullptr;
+void m_glLockArraysEXT_profile(GLint a0,GLsizei a1)const{return this->m_profile(2764,m_next_glLockArraysEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC m_next_glVertexAttribPointerNV = nullptr;
+void m_glVertexAttribPointerNV_profile(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{return this->m_profile(2765,m_next_glVertexAttribPointerNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC m_next_glConvolutionParameterf = nullptr;
+void m_glConvolutionParameterf_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(2766,m_next_glConvolutionParameterf,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC m_next_glBindBufferBaseEXT = nullptr;
+void m_glBindBufferBaseEXT_profile(GLenum a0,GLuint a1,GLuint a2)const{return this->m_profile(2767,m_next_glBindBufferBaseEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC m_next_glTexCoord2xvOES = nullptr;
+void m_glTexCoord2xvOES_profile(const GLfixed* a0)const{return this->m_profile(2768,m_next_glTexCoord2xvOES,a0);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC m_next_glGetQueryBufferObjectui64v = nullptr;
+void m_glGetQueryBufferObjectui64v_profile(GLuint a0,GLuint a1,GLenum a2,GLintptr a3)const{return this->m_profile(2769,m_next_glGetQueryBufferObjectui64v,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC m_next_glSetMultisamplefvAMD = nullptr;
+void m_glSetMultisamplefvAMD_profile(GLenum a0,GLuint a1,const GLfloat* a2)const{return this->m_profile(2770,m_next_glSetMultisamplefvAMD,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC m_next_glPathColorGenNV = nullptr;
+void m_glPathColorGenNV_profile(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(2771,m_next_glPathColorGenNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC m_next_glVertexAttrib3sARB = nullptr;
+void m_glVertexAttrib3sARB_profile(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{return this->m_profile(2772,m_next_glVertexAttrib3sARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC m_next_glVertexAttrib4ivARB = nullptr;
+void m_glVertexAttrib4ivARB_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2773,m_next_glVertexAttrib4ivARB,a0,a1);}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC m_next_glGenTransformFeedbacks = nullptr;
+void m_glGenTransformFeedbacks_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2774,m_next_glGenTransformFeedbacks,a0,a1);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC m_next_glGetVertexAttribIuiv = nullptr;
+void m_glGetVertexAttribIuiv_profile(GLuint a0,GLenum a1,GLuint* a2)const{return this->m_profile(2775,m_next_glGetVertexAttribIuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC m_next_glPixelTransformParameterfEXT = nullptr;
+void m_glPixelTransformParameterfEXT_profile(GLenum a0,GLenum a1,GLfloat a2)const{return this->m_profile(2776,m_next_glPixelTransformParameterfEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC m_next_glGetTexParameterIuivEXT = nullptr;
+void m_glGetTexParameterIuivEXT_profile(GLenum a0,GLenum a1,GLuint* a2)const{return this->m_profile(2777,m_next_glGetTexParameterIuivEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC m_next_glGetObjectParameterivARB = nullptr;
+void m_glGetObjectParameterivARB_profile(GLhandleARB a0,GLenum a1,GLint* a2)const{return this->m_profile(2778,m_next_glGetObjectParameterivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC m_next_glVertexArraySecondaryColorOffsetEXT = nullptr;
+void m_glVertexArraySecondaryColorOffsetEXT_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{return this->m_profile(2779,m_next_glVertexArraySecondaryColorOffsetEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC m_next_glWindowPos2fARB = nullptr;
+void m_glWindowPos2fARB_profile(GLfloat a0,GLfloat a1)const{return this->m_profile(2780,m_next_glWindowPos2fARB,a0,a1);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC m_next_glCompressedTexSubImage2D = nullptr;
+void m_glCompressedTexSubImage2D_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const GLvoid* a8)const{return this->m_profile(2781,m_next_glCompressedTexSubImage2D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC m_next_glCompressedTexSubImage3DARB = nullptr;
+void m_glCompressedTexSubImage3DARB_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const void* a10)const{return this->m_profile(2782,m_next_glCompressedTexSubImage3DARB,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC m_next_glProgramBinary = nullptr;
+void m_glProgramBinary_profile(GLuint a0,GLenum a1,const void* a2,GLsizei a3)const{return this->m_profile(2783,m_next_glProgramBinary,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC m_next_glPresentFrameKeyedNV = nullptr;
+void m_glPresentFrameKeyedNV_profile(GLuint a0,GLuint64EXT a1,GLuint a2,GLuint a3,GLenum a4,GLenum a5,GLuint a6,GLuint a7,GLenum a8,GLuint a9,GLuint a10)const{return this->m_profile(2784,m_next_glPresentFrameKeyedNV,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC m_next_glVertexAttribI4bv = nullptr;
+void m_glVertexAttribI4bv_profile(GLuint a0,const GLbyte* a1)const{return this->m_profile(2785,m_next_glVertexAttribI4bv,a0,a1);}
+FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC m_next_glPathCoverDepthFuncNV = nullptr;
+void m_glPathCoverDepthFuncNV_profile(GLenum a0)const{return this->m_profile(2786,m_next_glPathCoverDepthFuncNV,a0);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC m_next_glTransformFeedbackStreamAttribsNV = nullptr;
+void m_glTransformFeedbackStreamAttribsNV_profile(GLsizei a0,const GLint* a1,GLsizei a2,const GLint* a3,GLenum a4)const{return this->m_profile(2787,m_next_glTransformFeedbackStreamAttribsNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC m_next_glSecondaryColor3usEXT = nullptr;
+void m_glSecondaryColor3usEXT_profile(GLushort a0,GLushort a1,GLushort a2)const{return this->m_profile(2788,m_next_glSecondaryColor3usEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC m_next_glCopyColorTableSGI = nullptr;
+void m_glCopyColorTableSGI_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{return this->m_profile(2789,m_next_glCopyColorTableSGI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC m_next_glProgramEnvParameter4fvARB = nullptr;
+void m_glProgramEnvParameter4fvARB_profile(GLenum a0,GLuint a1,const GLfloat* a2)const{return this->m_profile(2790,m_next_glProgramEnvParameter4fvARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC m_next_glMultiTexCoord4sARB = nullptr;
+void m_glMultiTexCoord4sARB_profile(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{return this->m_profile(2791,m_next_glMultiTexCoord4sARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC m_next_glGetVertexArrayIndexed64iv = nullptr;
+void m_glGetVertexArrayIndexed64iv_profile(GLuint a0,GLuint a1,GLenum a2,GLint64* a3)const{return this->m_profile(2792,m_next_glGetVertexArrayIndexed64iv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC m_next_glMatrixMultTranspose3x3fNV = nullptr;
+void m_glMatrixMultTranspose3x3fNV_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2793,m_next_glMatrixMultTranspose3x3fNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC m_next_glTexParameterIiv = nullptr;
+void m_glTexParameterIiv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2794,m_next_glTexParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC m_next_glVertexArrayAttribFormat = nullptr;
+void m_glVertexArrayAttribFormat_profile(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLboolean a4,GLuint a5)const{return this->m_profile(2795,m_next_glVertexArrayAttribFormat,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC m_next_glEndTransformFeedback = nullptr;
+void m_glEndTransformFeedback_profile()const{return this->m_profile(2796,m_next_glEndTransformFeedback);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC m_next_glDrawCommandsStatesAddressNV = nullptr;
+void m_glDrawCommandsStatesAddressNV_profile(const GLuint64* a0,const GLsizei* a1,const GLuint* a2,const GLuint* a3,GLuint a4)const{return this->m_profile(2797,m_next_glDrawCommandsStatesAddressNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC m_next_glUniform4ui64NV = nullptr;
+void m_glUniform4ui64NV_profile(GLint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{return this->m_profile(2798,m_next_glUniform4ui64NV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMATERIALIVPROC m_next_glMaterialiv = nullptr;
+void m_glMaterialiv_profile(GLenum a0,GLenum a1,const GLint* a2)const{return this->m_profile(2799,m_next_glMaterialiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC m_next_glTexImage2DMultisample = nullptr;
+void m_glTexImage2DMultisample_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{return this->m_profile(2800,m_next_glTexImage2DMultisample,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC m_next_glBindTextureEXT = nullptr;
+void m_glBindTextureEXT_profile(GLenum a0,GLuint a1)const{return this->m_profile(2801,m_next_glBindTextureEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLISBUFFERPROC m_next_glIsBuffer = nullptr;
+GLboolean m_glIsBuffer_profile(GLuint a0)const{return this->m_profile(2802,m_next_glIsBuffer,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC m_next_glVertexAttribI1iv = nullptr;
+void m_glVertexAttribI1iv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2803,m_next_glVertexAttribI1iv,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC m_next_glGetFinalCombinerInputParameterfvNV = nullptr;
+void m_glGetFinalCombinerInputParameterfvNV_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2804,m_next_glGetFinalCombinerInputParameterfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC m_next_glMultiTexCoord3bvOES = nullptr;
+void m_glMultiTexCoord3bvOES_profile(GLenum a0,const GLbyte* a1)const{return this->m_profile(2805,m_next_glMultiTexCoord3bvOES,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC m_next_glVertexAttribDivisor = nullptr;
+void m_glVertexAttribDivisor_profile(GLuint a0,GLuint a1)const{return this->m_profile(2806,m_next_glVertexAttribDivisor,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC m_next_glCopyBufferSubData = nullptr;
+void m_glCopyBufferSubData_profile(GLenum a0,GLenum a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{return this->m_profile(2807,m_next_glCopyBufferSubData,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC m_next_glBindTexGenParameterEXT = nullptr;
+GLuint m_glBindTexGenParameterEXT_profile(GLenum a0,GLenum a1,GLenum a2)const{return this->m_profile(2808,m_next_glBindTexGenParameterEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC m_next_glNormalStream3bATI = nullptr;
+void m_glNormalStream3bATI_profile(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3)const{return this->m_profile(2809,m_next_glNormalStream3bATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC m_next_glTexStorageMem2DEXT = nullptr;
+void m_glTexStorageMem2DEXT_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLuint a5,GLuint64 a6)const{return this->m_profile(2810,m_next_glTexStorageMem2DEXT,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC m_next_glTextureImage2DEXT = nullptr;
+void m_glTextureImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{return this->m_profile(2811,m_next_glTextureImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC m_next_glGetColorTableParameteriv = nullptr;
+void m_glGetColorTableParameteriv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2812,m_next_glGetColorTableParameteriv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC m_next_glActiveTextureARB = nullptr;
+void m_glActiveTextureARB_profile(GLenum a0)const{return this->m_profile(2813,m_next_glActiveTextureARB,a0);}
+FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC m_next_glTexCoord4xOES = nullptr;
+void m_glTexCoord4xOES_profile(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{return this->m_profile(2814,m_next_glTexCoord4xOES,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC m_next_glNamedBufferStorageExternalEXT = nullptr;
+void m_glNamedBufferStorageExternalEXT_profile(GLuint a0,GLintptr a1,GLsizeiptr a2,GLeglClientBufferEXT a3,GLbitfield a4)const{return this->m_profile(2815,m_next_glNamedBufferStorageExternalEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC m_next_glSecondaryColor3fvEXT = nullptr;
+void m_glSecondaryColor3fvEXT_profile(const GLfloat* a0)const{return this->m_profile(2816,m_next_glSecondaryColor3fvEXT,a0);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC m_next_glUniformMatrix4x2fv = nullptr;
+void m_glUniformMatrix4x2fv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2817,m_next_glUniformMatrix4x2fv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC m_next_glStartInstrumentsSGIX = nullptr;
+void m_glStartInstrumentsSGIX_profile()const{return this->m_profile(2818,m_next_glStartInstrumentsSGIX);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC m_next_glProgramNamedParameter4fvNV = nullptr;
+void m_glProgramNamedParameter4fvNV_profile(GLuint a0,GLsizei a1,const GLubyte* a2,const GLfloat* a3)const{return this->m_profile(2819,m_next_glProgramNamedParameter4fvNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC m_next_glEndVideoCaptureNV = nullptr;
+void m_glEndVideoCaptureNV_profile(GLuint a0)const{return this->m_profile(2820,m_next_glEndVideoCaptureNV,a0);}
+FunctionTable::MEMBERPFNGLGENLISTSPROC m_next_glGenLists = nullptr;
+GLuint m_glGenLists_profile(GLsizei a0)const{return this->m_profile(2821,m_next_glGenLists,a0);}
+FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC m_next_glUniform1fARB = nullptr;
+void m_glUniform1fARB_profile(GLint a0,GLfloat a1)const{return this->m_profile(2822,m_next_glUniform1fARB,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC m_next_glNamedFramebufferTexture1DEXT = nullptr;
+void m_glNamedFramebufferTexture1DEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{return this->m_profile(2823,m_next_glNamedFramebufferTexture1DEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC m_next_glMapBufferRange = nullptr;
+void* m_glMapBufferRange_profile(GLenum a0,GLintptr a1,GLsizeiptr a2,GLbitfield a3)const{return this->m_profile(2824,m_next_glMapBufferRange,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC m_next_glMultiDrawElementsIndirectCountARB = nullptr;
+void m_glMultiDrawElementsIndirectCountARB_profile(GLenum a0,GLenum a1,const void* a2,GLintptr a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2825,m_next_glMultiDrawElementsIndirectCountARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC m_next_glProgramUniformMatrix4x2fv = nullptr;
+void m_glProgramUniformMatrix4x2fv_profile(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{return this->m_profile(2826,m_next_glProgramUniformMatrix4x2fv,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC m_next_glGetTextureParameterIivEXT = nullptr;
+void m_glGetTextureParameterIivEXT_profile(GLuint a0,GLenum a1,GLenum a2,GLint* a3)const{return this->m_profile(2827,m_next_glGetTextureParameterIivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC m_next_glMultiTexCoord3hNV = nullptr;
+void m_glMultiTexCoord3hNV_profile(GLenum a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{return this->m_profile(2828,m_next_glMultiTexCoord3hNV,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC m_next_glNamedProgramLocalParametersI4uivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4uivEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLuint* a4)const{return this->m_profile(2829,m_next_glNamedProgramLocalParametersI4uivEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLENDLISTPROC m_next_glEndList = nullptr;
+void m_glEndList_profile()const{return this->m_profile(2830,m_next_glEndList);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_next_glTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11)const{return this->m_profile(2831,m_next_glTexCoord2fColor4fNormal3fVertex3fSUN,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC m_next_glGenTransformFeedbacksNV = nullptr;
+void m_glGenTransformFeedbacksNV_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2832,m_next_glGenTransformFeedbacksNV,a0,a1);}
+FunctionTable::MEMBERPFNGLEDGEFLAGVPROC m_next_glEdgeFlagv = nullptr;
+void m_glEdgeFlagv_profile(const GLboolean* a0)const{return this->m_profile(2833,m_next_glEdgeFlagv,a0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC m_next_glVertexAttribI2iv = nullptr;
+void m_glVertexAttribI2iv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2834,m_next_glVertexAttribI2iv,a0,a1);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC m_next_glCopyMultiTexImage2DEXT = nullptr;
+void m_glCopyMultiTexImage2DEXT_profile(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLint a8)const{return this->m_profile(2835,m_next_glCopyMultiTexImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC m_next_glUniformMatrix3x2dv = nullptr;
+void m_glUniformMatrix3x2dv_profile(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{return this->m_profile(2836,m_next_glUniformMatrix3x2dv,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC m_next_glTexImage3DMultisampleCoverageNV = nullptr;
+void m_glTexImage3DMultisampleCoverageNV_profile(GLenum a0,GLsizei a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{return this->m_profile(2837,m_next_glTexImage3DMultisampleCoverageNV,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC m_next_glGetShaderPrecisionFormat = nullptr;
+void m_glGetShaderPrecisionFormat_profile(GLenum a0,GLenum a1,GLint* a2,GLint* a3)const{return this->m_profile(2838,m_next_glGetShaderPrecisionFormat,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC m_next_glTexSubImage4DSGIS = nullptr;
+void m_glTexSubImage4DSGIS_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLsizei a9,GLenum a10,GLenum a11,const void* a12)const{return this->m_profile(2839,m_next_glTexSubImage4DSGIS,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC m_next_glRasterSamplesEXT = nullptr;
+void m_glRasterSamplesEXT_profile(GLuint a0,GLboolean a1)const{return this->m_profile(2840,m_next_glRasterSamplesEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC m_next_glTextureView = nullptr;
+void m_glTextureView_profile(GLuint a0,GLenum a1,GLuint a2,GLenum a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7)const{return this->m_profile(2841,m_next_glTextureView,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLEVALMAPSNVPROC m_next_glEvalMapsNV = nullptr;
+void m_glEvalMapsNV_profile(GLenum a0,GLenum a1)const{return this->m_profile(2842,m_next_glEvalMapsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC m_next_glGetFragDataLocationEXT = nullptr;
+GLint m_glGetFragDataLocationEXT_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(2843,m_next_glGetFragDataLocationEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC m_next_glGetCompressedMultiTexImageEXT = nullptr;
+void m_glGetCompressedMultiTexImageEXT_profile(GLenum a0,GLenum a1,GLint a2,void* a3)const{return this->m_profile(2844,m_next_glGetCompressedMultiTexImageEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLINDEXMASKPROC m_next_glIndexMask = nullptr;
+void m_glIndexMask_profile(GLuint a0)const{return this->m_profile(2845,m_next_glIndexMask,a0);}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC m_next_glPushClientAttrib = nullptr;
+void m_glPushClientAttrib_profile(GLbitfield a0)const{return this->m_profile(2846,m_next_glPushClientAttrib,a0);}
+FunctionTable::MEMBERPFNGLSHADERSOURCEPROC m_next_glShaderSource = nullptr;
+void m_glShaderSource_profile(GLuint a0,GLsizei a1,const GLchar*const* a2,const GLint* a3)const{return this->m_profile(2847,m_next_glShaderSource,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC m_next_glDispatchComputeGroupSizeARB = nullptr;
+void m_glDispatchComputeGroupSizeARB_profile(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{return this->m_profile(2848,m_next_glDispatchComputeGroupSizeARB,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC m_next_glLGPUNamedBufferSubDataNVX = nullptr;
+void m_glLGPUNamedBufferSubDataNVX_profile(GLbitfield a0,GLuint a1,GLintptr a2,GLsizeiptr a3,const void* a4)const{return this->m_profile(2849,m_next_glLGPUNamedBufferSubDataNVX,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC m_next_glGetnPixelMapfv = nullptr;
+void m_glGetnPixelMapfv_profile(GLenum a0,GLsizei a1,GLfloat* a2)const{return this->m_profile(2850,m_next_glGetnPixelMapfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC m_next_glTexCoordP2uiv = nullptr;
+void m_glTexCoordP2uiv_profile(GLenum a0,const GLuint* a1)const{return this->m_profile(2851,m_next_glTexCoordP2uiv,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM2FPROC m_next_glUniform2f = nullptr;
+void m_glUniform2f_profile(GLint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2852,m_next_glUniform2f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC m_next_glGetNamedBufferParameteri64v = nullptr;
+void m_glGetNamedBufferParameteri64v_profile(GLuint a0,GLenum a1,GLint64* a2)const{return this->m_profile(2853,m_next_glGetNamedBufferParameteri64v,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC m_next_glCommandListSegmentsNV = nullptr;
+void m_glCommandListSegmentsNV_profile(GLuint a0,GLuint a1)const{return this->m_profile(2854,m_next_glCommandListSegmentsNV,a0,a1);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC m_next_glTextureParameterIivEXT = nullptr;
+void m_glTextureParameterIivEXT_profile(GLuint a0,GLenum a1,GLenum a2,const GLint* a3)const{return this->m_profile(2855,m_next_glTextureParameterIivEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC m_next_glMultiTexParameterfvEXT = nullptr;
+void m_glMultiTexParameterfvEXT_profile(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{return this->m_profile(2856,m_next_glMultiTexParameterfvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC m_next_glProgramUniform2ui64ARB = nullptr;
+void m_glProgramUniform2ui64ARB_profile(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3)const{return this->m_profile(2857,m_next_glProgramUniform2ui64ARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEX4DPROC m_next_glVertex4d = nullptr;
+void m_glVertex4d_profile(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{return this->m_profile(2858,m_next_glVertex4d,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC m_next_glNewObjectBufferATI = nullptr;
+GLuint m_glNewObjectBufferATI_profile(GLsizei a0,const void* a1,GLenum a2)const{return this->m_profile(2859,m_next_glNewObjectBufferATI,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC m_next_glViewportSwizzleNV = nullptr;
+void m_glViewportSwizzleNV_profile(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{return this->m_profile(2860,m_next_glViewportSwizzleNV,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLBUFFERDATAPROC m_next_glBufferData = nullptr;
+void m_glBufferData_profile(GLenum a0,GLsizeiptr a1,const void* a2,GLenum a3)const{return this->m_profile(2861,m_next_glBufferData,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC m_next_glTextureImage1DEXT = nullptr;
+void m_glTextureImage1DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const void* a8)const{return this->m_profile(2862,m_next_glTextureImage1DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC m_next_glGetTexParameterIiv = nullptr;
+void m_glGetTexParameterIiv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2863,m_next_glGetTexParameterIiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC m_next_glCopyTexSubImage1DEXT = nullptr;
+void m_glCopyTexSubImage1DEXT_profile(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{return this->m_profile(2864,m_next_glCopyTexSubImage1DEXT,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLVERTEX4FPROC m_next_glVertex4f = nullptr;
+void m_glVertex4f_profile(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{return this->m_profile(2865,m_next_glVertex4f,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC m_next_glUniformMatrix3fvARB = nullptr;
+void m_glUniformMatrix3fvARB_profile(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{return this->m_profile(2866,m_next_glUniformMatrix3fvARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC m_next_glTexCoordP1ui = nullptr;
+void m_glTexCoordP1ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(2867,m_next_glTexCoordP1ui,a0,a1);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC m_next_glPointParameterfvEXT = nullptr;
+void m_glPointParameterfvEXT_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2868,m_next_glPointParameterfvEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC m_next_glUniform4fARB = nullptr;
+void m_glUniform4fARB_profile(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{return this->m_profile(2869,m_next_glUniform4fARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC m_next_glImportMemoryFdEXT = nullptr;
+void m_glImportMemoryFdEXT_profile(GLuint a0,GLuint64 a1,GLenum a2,GLint a3)const{return this->m_profile(2870,m_next_glImportMemoryFdEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC m_next_glCopyTextureSubImage3D = nullptr;
+void m_glCopyTextureSubImage3D_profile(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{return this->m_profile(2871,m_next_glCopyTextureSubImage3D,a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC m_next_glMultiTexCoord2fv = nullptr;
+void m_glMultiTexCoord2fv_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2872,m_next_glMultiTexCoord2fv,a0,a1);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_next_glNamedFramebufferSamplePositionsfvAMD = nullptr;
+void m_glNamedFramebufferSamplePositionsfvAMD_profile(GLuint a0,GLuint a1,GLuint a2,const GLfloat* a3)const{return this->m_profile(2873,m_next_glNamedFramebufferSamplePositionsfvAMD,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNORMALP3UIPROC m_next_glNormalP3ui = nullptr;
+void m_glNormalP3ui_profile(GLenum a0,GLuint a1)const{return this->m_profile(2874,m_next_glNormalP3ui,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC m_next_glDrawRangeElementArrayATI = nullptr;
+void m_glDrawRangeElementArrayATI_profile(GLenum a0,GLuint a1,GLuint a2,GLsizei a3)const{return this->m_profile(2875,m_next_glDrawRangeElementArrayATI,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC m_next_glVertexAttribI1i = nullptr;
+void m_glVertexAttribI1i_profile(GLuint a0,GLint a1)const{return this->m_profile(2876,m_next_glVertexAttribI1i,a0,a1);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC m_next_glDrawArraysInstancedARB = nullptr;
+void m_glDrawArraysInstancedARB_profile(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{return this->m_profile(2877,m_next_glDrawArraysInstancedARB,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC m_next_glEnableVertexAttribAPPLE = nullptr;
+void m_glEnableVertexAttribAPPLE_profile(GLuint a0,GLenum a1)const{return this->m_profile(2878,m_next_glEnableVertexAttribAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC m_next_glGetDebugMessageLogARB = nullptr;
+GLuint m_glGetDebugMessageLogARB_profile(GLuint a0,GLsizei a1,GLenum* a2,GLenum* a3,GLuint* a4,GLenum* a5,GLsizei* a6,GLchar* a7)const{return this->m_profile(2879,m_next_glGetDebugMessageLogARB,a0,a1,a2,a3,a4,a5,a6,a7);}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC m_next_glGetPathTexGenfvNV = nullptr;
+void m_glGetPathTexGenfvNV_profile(GLenum a0,GLenum a1,GLfloat* a2)const{return this->m_profile(2880,m_next_glGetPathTexGenfvNV,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC m_next_glNamedProgramLocalParameters4fvEXT = nullptr;
+void m_glNamedProgramLocalParameters4fvEXT_profile(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{return this->m_profile(2881,m_next_glNamedProgramLocalParameters4fvEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC m_next_glQueryResourceTagNV = nullptr;
+void m_glQueryResourceTagNV_profile(GLint a0,const GLchar* a1)const{return this->m_profile(2882,m_next_glQueryResourceTagNV,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC m_next_glVertexStream3fvATI = nullptr;
+void m_glVertexStream3fvATI_profile(GLenum a0,const GLfloat* a1)const{return this->m_profile(2883,m_next_glVertexStream3fvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC m_next_glFramebufferTexture3D = nullptr;
+void m_glFramebufferTexture3D_profile(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{return this->m_profile(2884,m_next_glFramebufferTexture3D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC m_next_glCompressedTextureSubImage2DEXT = nullptr;
+void m_glCompressedTextureSubImage2DEXT_profile(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLsizei a8,const void* a9)const{return this->m_profile(2885,m_next_glCompressedTextureSubImage2DEXT,a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC m_next_glWindowPos3dv = nullptr;
+void m_glWindowPos3dv_profile(const GLdouble* a0)const{return this->m_profile(2886,m_next_glWindowPos3dv,a0);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC m_next_glCopyConvolutionFilter2D = nullptr;
+void m_glCopyConvolutionFilter2D_profile(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5)const{return this->m_profile(2887,m_next_glCopyConvolutionFilter2D,a0,a1,a2,a3,a4,a5);}
+FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC m_next_glReadInstrumentsSGIX = nullptr;
+void m_glReadInstrumentsSGIX_profile(GLint a0)const{return this->m_profile(2888,m_next_glReadInstrumentsSGIX,a0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC m_next_glProgramUniform2dvEXT = nullptr;
+void m_glProgramUniform2dvEXT_profile(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{return this->m_profile(2889,m_next_glProgramUniform2dvEXT,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC m_next_glSamplerParameterfv = nullptr;
+void m_glSamplerParameterfv_profile(GLuint a0,GLenum a1,const GLfloat* a2)const{return this->m_profile(2890,m_next_glSamplerParameterfv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC m_next_glBindBufferARB = nullptr;
+void m_glBindBufferARB_profile(GLenum a0,GLuint a1)const{return this->m_profile(2891,m_next_glBindBufferARB,a0,a1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC m_next_glVertexAttrib1sNV = nullptr;
+void m_glVertexAttrib1sNV_profile(GLuint a0,GLshort a1)const{return this->m_profile(2892,m_next_glVertexAttrib1sNV,a0,a1);}
+FunctionTable::MEMBERPFNGLGETMATERIALIVPROC m_next_glGetMaterialiv = nullptr;
+void m_glGetMaterialiv_profile(GLenum a0,GLenum a1,GLint* a2)const{return this->m_profile(2893,m_next_glGetMaterialiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1FVPROC m_next_glUniform1fv = nullptr;
+void m_glUniform1fv_profile(GLint a0,GLsizei a1,const GLfloat* a2)const{return this->m_profile(2894,m_next_glUniform1fv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC m_next_glBeginOcclusionQueryNV = nullptr;
+void m_glBeginOcclusionQueryNV_profile(GLuint a0)const{return this->m_profile(2895,m_next_glBeginOcclusionQueryNV,a0);}
+FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC m_next_glGenFencesAPPLE = nullptr;
+void m_glGenFencesAPPLE_profile(GLsizei a0,GLuint* a1)const{return this->m_profile(2896,m_next_glGenFencesAPPLE,a0,a1);}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC m_next_glScissorIndexedv = nullptr;
+void m_glScissorIndexedv_profile(GLuint a0,const GLint* a1)const{return this->m_profile(2897,m_next_glScissorIndexedv,a0,a1);}
+FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC m_next_glDisableVariantClientStateEXT = nullptr;
+void m_glDisableVariantClientStateEXT_profile(GLuint a0)const{return this->m_profile(2898,m_next_glDisableVariantClientStateEXT,a0);}
+FunctionTable::MEMBERPFNGLMINMAXEXTPROC m_next_glMinmaxEXT = nullptr;
+void m_glMinmaxEXT_profile(GLenum a0,GLenum a1,GLboolean a2)const{return this->m_profile(2899,m_next_glMinmaxEXT,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC m_next_glNormalPointervINTEL = nullptr;
+void m_glNormalPointervINTEL_profile(GLenum a0,const void** a1)const{return this->m_profile(2900,m_next_glNormalPointervINTEL,a0,a1);}
+FunctionTable::MEMBERPFNGLNORMAL3SPROC m_next_glNormal3s = nullptr;
+void m_glNormal3s_profile(GLshort a0,GLshort a1,GLshort a2)const{return this->m_profile(2901,m_next_glNormal3s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC m_next_glGetnPixelMapuiv = nullptr;
+void m_glGetnPixelMapuiv_profile(GLenum a0,GLsizei a1,GLuint* a2)const{return this->m_profile(2902,m_next_glGetnPixelMapuiv,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC m_next_glNormalStream3bvATI = nullptr;
+void m_glNormalStream3bvATI_profile(GLenum a0,const GLbyte* a1)const{return this->m_profile(2903,m_next_glNormalStream3bvATI,a0,a1);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC m_next_glGetObjectParameterivAPPLE = nullptr;
+void m_glGetObjectParameterivAPPLE_profile(GLenum a0,GLuint a1,GLenum a2,GLint* a3)const{return this->m_profile(2904,m_next_glGetObjectParameterivAPPLE,a0,a1,a2,a3);}
+FunctionTable::MEMBERPFNGLNORMAL3IPROC m_next_glNormal3i = nullptr;
+void m_glNormal3i_profile(GLint a0,GLint a1,GLint a2)const{return this->m_profile(2905,m_next_glNormal3i,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC m_next_glUniform1ivARB = nullptr;
+void m_glUniform1ivARB_profile(GLint a0,GLsizei a1,const GLint* a2)const{return this->m_profile(2906,m_next_glUniform1ivARB,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLNORMAL3DPROC m_next_glNormal3d = nullptr;
+void m_glNormal3d_profile(GLdouble a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2907,m_next_glNormal3d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC m_next_glUpdateObjectBufferATI = nullptr;
+void m_glUpdateObjectBufferATI_profile(GLuint a0,GLuint a1,GLsizei a2,const void* a3,GLenum a4)const{return this->m_profile(2908,m_next_glUpdateObjectBufferATI,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLNORMAL3BPROC m_next_glNormal3b = nullptr;
+void m_glNormal3b_profile(GLbyte a0,GLbyte a1,GLbyte a2)const{return this->m_profile(2909,m_next_glNormal3b,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC m_next_glGetUniformBufferSizeEXT = nullptr;
+GLint m_glGetUniformBufferSizeEXT_profile(GLuint a0,GLint a1)const{return this->m_profile(2910,m_next_glGetUniformBufferSizeEXT,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC m_next_glMultiTexCoord4dv = nullptr;
+void m_glMultiTexCoord4dv_profile(GLenum a0,const GLdouble* a1)const{return this->m_profile(2911,m_next_glMultiTexCoord4dv,a0,a1);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC m_next_glProgramUniform3i64ARB = nullptr;
+void m_glProgramUniform3i64ARB_profile(GLuint a0,GLint a1,GLint64 a2,GLint64 a3,GLint64 a4)const{return this->m_profile(2912,m_next_glProgramUniform3i64ARB,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC m_next_glVertexAttrib2d = nullptr;
+void m_glVertexAttrib2d_profile(GLuint a0,GLdouble a1,GLdouble a2)const{return this->m_profile(2913,m_next_glVertexAttrib2d,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC m_next_glVertexAttrib2f = nullptr;
+void m_glVertexAttrib2f_profile(GLuint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2914,m_next_glVertexAttrib2f,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC m_next_glMultiDrawElementsEXT = nullptr;
+void m_glMultiDrawElementsEXT_profile(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4)const{return this->m_profile(2915,m_next_glMultiDrawElementsEXT,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC m_next_glVertexAttrib3dv = nullptr;
+void m_glVertexAttrib3dv_profile(GLuint a0,const GLdouble* a1)const{return this->m_profile(2916,m_next_glVertexAttrib3dv,a0,a1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC m_next_glMultiTexCoord2bOES = nullptr;
+void m_glMultiTexCoord2bOES_profile(GLenum a0,GLbyte a1,GLbyte a2)const{return this->m_profile(2917,m_next_glMultiTexCoord2bOES,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC m_next_glVertexAttrib2s = nullptr;
+void m_glVertexAttrib2s_profile(GLuint a0,GLshort a1,GLshort a2)const{return this->m_profile(2918,m_next_glVertexAttrib2s,a0,a1,a2);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC m_next_glTexImage3DMultisample = nullptr;
+void m_glTexImage3DMultisample_profile(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{return this->m_profile(2919,m_next_glTexImage3DMultisample,a0,a1,a2,a3,a4,a5,a6);}
+FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC m_next_glGetUniformBlockIndex = nullptr;
+GLuint m_glGetUniformBlockIndex_profile(GLuint a0,const GLchar* a1)const{return this->m_profile(2920,m_next_glGetUniformBlockIndex,a0,a1);}
+FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC m_next_glReleaseKeyedMutexWin32EXT = nullptr;
+GLboolean m_glReleaseKeyedMutexWin32EXT_profile(GLuint a0,GLuint64 a1)const{return this->m_profile(2921,m_next_glReleaseKeyedMutexWin32EXT,a0,a1);}
+FunctionTable::MEMBERPFNGLFRONTFACEPROC m_next_glFrontFace = nullptr;
+void m_glFrontFace_profile(GLenum a0)const{return this->m_profile(2922,m_next_glFrontFace,a0);}
+FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC m_next_glEvalCoord1xOES = nullptr;
+void m_glEvalCoord1xOES_profile(GLfixed a0)const{return this->m_profile(2923,m_next_glEvalCoord1xOES,a0);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC m_next_glDrawArraysInstancedBaseInstance = nullptr;
+void m_glDrawArraysInstancedBaseInstance_profile(GLenum a0,GLint a1,GLsizei a2,GLsizei a3,GLuint a4)const{return this->m_profile(2924,m_next_glDrawArraysInstancedBaseInstance,a0,a1,a2,a3,a4);}
+FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC m_next_glIsPointInStrokePathNV = nullptr;
+GLboolean m_glIsPointInStrokePathNV_profile(GLuint a0,GLfloat a1,GLfloat a2)const{return this->m_profile(2925,m_next_glIsPointInStrokePathNV,a0,a1,a2);}
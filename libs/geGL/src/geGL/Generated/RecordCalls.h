@@ -0,0 +1,2926 @@
+this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_record;
+this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&RecordTableDecorator::m_glTextureParameterfv_record;
+this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&RecordTableDecorator::m_glGetListParameterivSGIX_record;
+this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&RecordTableDecorator::m_glProgramUniform1i64ARB_record;
+this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&RecordTableDecorator::m_glVertexArrayElementBuffer_record;
+this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&RecordTableDecorator::m_glHintPGI_record;
+this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&RecordTableDecorator::m_glStencilMaskSeparate_record;
+this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_record;
+this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&RecordTableDecorator::m_glTextureStorage3DMultisample_record;
+this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&RecordTableDecorator::m_glGetIntegerIndexedvEXT_record;
+this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&RecordTableDecorator::m_glCopyTexImage1D_record;
+this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&RecordTableDecorator::m_glVertexAttrib4usv_record;
+this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&RecordTableDecorator::m_glTexRenderbufferNV_record;
+this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&RecordTableDecorator::m_glVertexAttrib3hvNV_record;
+this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&RecordTableDecorator::m_glProgramUniform4ui64ARB_record;
+this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&RecordTableDecorator::m_glInstrumentsBufferSGIX_record;
+this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&RecordTableDecorator::m_glIndexi_record;
+this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&RecordTableDecorator::m_glMultiTexCoord2sARB_record;
+this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&RecordTableDecorator::m_glProgramEnvParameter4fARB_record;
+this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&RecordTableDecorator::m_glCompressedTexSubImage3D_record;
+this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&RecordTableDecorator::m_glEvalCoord2d_record;
+this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&RecordTableDecorator::m_glEvalCoord2f_record;
+this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&RecordTableDecorator::m_glIndexd_record;
+this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&RecordTableDecorator::m_glSecondaryColor3hvNV_record;
+this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&RecordTableDecorator::m_glIndexf_record;
+this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&RecordTableDecorator::m_glFrustumxOES_record;
+this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&RecordTableDecorator::m_glTextureStorage3DEXT_record;
+this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&RecordTableDecorator::m_glDrawCommandsStatesNV_record;
+this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&RecordTableDecorator::m_glUniform4uiEXT_record;
+this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&RecordTableDecorator::m_glProgramUniform3ui64ARB_record;
+this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&RecordTableDecorator::m_glIndexs_record;
+this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&RecordTableDecorator::m_glVertexArrayBindVertexBufferEXT_record;
+this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&RecordTableDecorator::m_glConvolutionParameteriEXT_record;
+this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&RecordTableDecorator::m_glColor4ubVertex2fSUN_record;
+this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&RecordTableDecorator::m_glProgramUniform1ivEXT_record;
+this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&RecordTableDecorator::m_glGetnMapfv_record;
+this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&RecordTableDecorator::m_glTransformFeedbackBufferRange_record;
+this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&RecordTableDecorator::m_glPathGlyphsNV_record;
+this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&RecordTableDecorator::m_glSecondaryColor3fv_record;
+this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetCombinerInputParameterivNV_record;
+this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&RecordTableDecorator::m_glEndPerfMonitorAMD_record;
+this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&RecordTableDecorator::m_glPointParameterfvARB_record;
+this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&RecordTableDecorator::m_glVertex2xOES_record;
+this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&RecordTableDecorator::m_glDrawElementsInstancedBaseInstance_record;
+this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&RecordTableDecorator::m_glMultTransposeMatrixdARB_record;
+this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&RecordTableDecorator::m_glVertexAttribL4dEXT_record;
+this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&RecordTableDecorator::m_glVertex4iv_record;
+this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glCoverStrokePathInstancedNV_record;
+this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&RecordTableDecorator::m_glDeformSGIX_record;
+this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&RecordTableDecorator::m_glUniform2ui64NV_record;
+this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&RecordTableDecorator::m_glCopyPathNV_record;
+this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&RecordTableDecorator::m_glVertexAttribP4ui_record;
+this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&RecordTableDecorator::m_glVertexAttribL2d_record;
+this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&RecordTableDecorator::m_glGetMultisamplefv_record;
+this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexSubImage3DEXT_record;
+this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&RecordTableDecorator::m_glVDPAURegisterOutputSurfaceNV_record;
+this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&RecordTableDecorator::m_glMinSampleShading_record;
+this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&RecordTableDecorator::m_glProgramUniform4fEXT_record;
+this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&RecordTableDecorator::m_glCoverStrokePathNV_record;
+this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&RecordTableDecorator::m_glTextureImage2DMultisampleNV_record;
+this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&RecordTableDecorator::m_glVertex3bOES_record;
+this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&RecordTableDecorator::m_glImportMemoryWin32HandleEXT_record;
+this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&RecordTableDecorator::m_glTessellationFactorAMD_record;
+this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&RecordTableDecorator::m_glDebugMessageControl_record;
+this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glIsObjectBufferATI_record;
+this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&RecordTableDecorator::m_glPopAttrib_record;
+this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&RecordTableDecorator::m_glProgramUniform4iEXT_record;
+this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&RecordTableDecorator::m_glVertexAttrib4ubNV_record;
+this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&RecordTableDecorator::m_glColorMaterial_record;
+this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&RecordTableDecorator::m_glVertexAttrib2svARB_record;
+this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&RecordTableDecorator::m_glMinSampleShadingARB_record;
+this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&RecordTableDecorator::m_glColor3b_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_record;
+this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&RecordTableDecorator::m_glColor3f_record;
+this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&RecordTableDecorator::m_glVDPAUGetSurfaceivNV_record;
+this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&RecordTableDecorator::m_glColor3d_record;
+this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&RecordTableDecorator::m_glGetnMapiv_record;
+this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&RecordTableDecorator::m_glColor3i_record;
+this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&RecordTableDecorator::m_glGetInternalformatSampleivNV_record;
+this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&RecordTableDecorator::m_glVertexAttrib4ubv_record;
+this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&RecordTableDecorator::m_glColor3s_record;
+this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&RecordTableDecorator::m_glVertexAttribs4hvNV_record;
+this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NubvARB_record;
+this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&RecordTableDecorator::m_glMultiTexCoord3hvNV_record;
+this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&RecordTableDecorator::m_glMatrixPushEXT_record;
+this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&RecordTableDecorator::m_glProgramUniform2fEXT_record;
+this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&RecordTableDecorator::m_glGetVertexArrayIndexediv_record;
+this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&RecordTableDecorator::m_glBlitFramebuffer_record;
+this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&RecordTableDecorator::m_glMultiTexCoordP2ui_record;
+this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&RecordTableDecorator::m_glColorPointerListIBM_record;
+this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&RecordTableDecorator::m_glVertexAttribL4d_record;
+this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&RecordTableDecorator::m_glGetFragmentMaterialfvSGIX_record;
+this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&RecordTableDecorator::m_glVertex2iv_record;
+this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&RecordTableDecorator::m_glGetTexEnvxvOES_record;
+this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&RecordTableDecorator::m_glUniformMatrix3dv_record;
+this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&RecordTableDecorator::m_glGetVertexAttribLdvEXT_record;
+this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&RecordTableDecorator::m_glTexCoordP3uiv_record;
+this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&RecordTableDecorator::m_glDeformationMap3dSGIX_record;
+this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glResumeTransformFeedback_record;
+this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&RecordTableDecorator::m_glInsertEventMarkerEXT_record;
+this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&RecordTableDecorator::m_glTessellationModeAMD_record;
+this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&RecordTableDecorator::m_glDrawCommandsAddressNV_record;
+this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&RecordTableDecorator::m_glFogi_record;
+this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&RecordTableDecorator::m_glGetTexParameterxvOES_record;
+this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&RecordTableDecorator::m_glVertexPointer_record;
+this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorCounterDataAMD_record;
+this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&RecordTableDecorator::m_glFogf_record;
+this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&RecordTableDecorator::m_glMultiTexCoord1d_record;
+this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&RecordTableDecorator::m_glMultiTexCoord1f_record;
+this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexParameterivEXT_record;
+this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x4fvEXT_record;
+this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&RecordTableDecorator::m_glVertexAttribI2i_record;
+this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&RecordTableDecorator::m_glMultiTexCoord1i_record;
+this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&RecordTableDecorator::m_glDeleteSemaphoresEXT_record;
+this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&RecordTableDecorator::m_glLoadProgramNV_record;
+this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&RecordTableDecorator::m_glWriteMaskEXT_record;
+this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&RecordTableDecorator::m_glGetGraphicsResetStatus_record;
+this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&RecordTableDecorator::m_glVertexAttrib1fv_record;
+this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&RecordTableDecorator::m_glMultiTexCoord1s_record;
+this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&RecordTableDecorator::m_glImageTransformParameterfvHP_record;
+this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&RecordTableDecorator::m_glFramebufferTexture2D_record;
+this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&RecordTableDecorator::m_glGetFragmentLightfvSGIX_record;
+this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&RecordTableDecorator::m_glListParameterfSGIX_record;
+this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&RecordTableDecorator::m_glTexCoord3sv_record;
+this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&RecordTableDecorator::m_glNamedFramebufferRenderbufferEXT_record;
+this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&RecordTableDecorator::m_glFragmentLightModelfSGIX_record;
+this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&RecordTableDecorator::m_glIndexPointerEXT_record;
+this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&RecordTableDecorator::m_glBlendEquationSeparateATI_record;
+this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&RecordTableDecorator::m_glVertexArrayAttribIFormat_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_record;
+this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&RecordTableDecorator::m_glReplacementCodeubvSUN_record;
+this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&RecordTableDecorator::m_glGenFramebuffers_record;
+this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&RecordTableDecorator::m_glPixelMapx_record;
+this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glTexSubImage3DEXT_record;
+this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&RecordTableDecorator::m_glGetAttachedShaders_record;
+this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&RecordTableDecorator::m_glGetPixelTexGenParameterfvSGIS_record;
+this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_record;
+this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&RecordTableDecorator::m_glGetDebugMessageLogAMD_record;
+this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&RecordTableDecorator::m_glVertexStream4sATI_record;
+this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&RecordTableDecorator::m_glVertexAttribs4dvNV_record;
+this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&RecordTableDecorator::m_glGetnMapdvARB_record;
+this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&RecordTableDecorator::m_glOrthofOES_record;
+this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&RecordTableDecorator::m_glViewportArrayv_record;
+this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&RecordTableDecorator::m_glDrawElementArrayATI_record;
+this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&RecordTableDecorator::m_glBufferStorageMemEXT_record;
+this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&RecordTableDecorator::m_glGetPathColorGenfvNV_record;
+this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&RecordTableDecorator::m_glWindowPos3iMESA_record;
+this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&RecordTableDecorator::m_glMultiTexCoord2s_record;
+this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&RecordTableDecorator::m_glVertex3dv_record;
+this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&RecordTableDecorator::m_glVertexAttribI3uivEXT_record;
+this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&RecordTableDecorator::m_glUniform3ui64ARB_record;
+this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&RecordTableDecorator::m_glVertexAttrib2fvNV_record;
+this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&RecordTableDecorator::m_glGetNamedBufferSubDataEXT_record;
+this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&RecordTableDecorator::m_glConvolutionFilter2D_record;
+this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&RecordTableDecorator::m_glMemoryBarrierByRegion_record;
+this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&RecordTableDecorator::m_glVertexArrayBindingDivisor_record;
+this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&RecordTableDecorator::m_glMatrixRotatedEXT_record;
+this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&RecordTableDecorator::m_glTexCoord2sv_record;
+this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&RecordTableDecorator::m_glIsProgramNV_record;
+this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&RecordTableDecorator::m_glUniform2dv_record;
+this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&RecordTableDecorator::m_glGetPixelMapuiv_record;
+this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&RecordTableDecorator::m_glDepthBoundsEXT_record;
+this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&RecordTableDecorator::m_glVertexAttrib4hvNV_record;
+this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&RecordTableDecorator::m_glMultiTexParameteriEXT_record;
+this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&RecordTableDecorator::m_glGetPointerv_record;
+this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&RecordTableDecorator::m_glPathCommandsNV_record;
+this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&RecordTableDecorator::m_glGetListParameterfvSGIX_record;
+this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&RecordTableDecorator::m_glGetUniformuiv_record;
+this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&RecordTableDecorator::m_glDebugMessageInsertAMD_record;
+this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&RecordTableDecorator::m_glFrustum_record;
+this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&RecordTableDecorator::m_glVertexAttribL1ui64vNV_record;
+this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&RecordTableDecorator::m_glClearColorxOES_record;
+this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3fv_record;
+this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&RecordTableDecorator::m_glSampleMaskIndexedNV_record;
+this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&RecordTableDecorator::m_glCompileShaderIncludeARB_record;
+this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&RecordTableDecorator::m_glGetArrayObjectfvATI_record;
+this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&RecordTableDecorator::m_glVertexStream4svATI_record;
+this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&RecordTableDecorator::m_glMultiTexCoord4iARB_record;
+this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&RecordTableDecorator::m_glVariantfvEXT_record;
+this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&RecordTableDecorator::m_glMatrixLoadfEXT_record;
+this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&RecordTableDecorator::m_glLoadIdentityDeformationMapSGIX_record;
+this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetRenderbufferParameteriv_record;
+this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&RecordTableDecorator::m_glProgramUniform3fEXT_record;
+this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&RecordTableDecorator::m_glNamedRenderbufferStorage_record;
+this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&RecordTableDecorator::m_glBindFragDataLocation_record;
+this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&RecordTableDecorator::m_glPolygonOffsetClamp_record;
+this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&RecordTableDecorator::m_glFogCoordPointerListIBM_record;
+this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&RecordTableDecorator::m_glFenceSync_record;
+this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&RecordTableDecorator::m_glGetVertexAttribIivEXT_record;
+this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&RecordTableDecorator::m_glFramebufferDrawBuffersEXT_record;
+this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&RecordTableDecorator::m_glVertexAttribs4fvNV_record;
+this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glPauseTransformFeedbackNV_record;
+this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&RecordTableDecorator::m_glGetQueryObjecti64vEXT_record;
+this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&RecordTableDecorator::m_glVDPAUSurfaceAccessNV_record;
+this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&RecordTableDecorator::m_glValidateProgramPipeline_record;
+this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&RecordTableDecorator::m_glTexPageCommitmentARB_record;
+this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&RecordTableDecorator::m_glWindowPos3dvARB_record;
+this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glStencilStrokePathInstancedNV_record;
+this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&RecordTableDecorator::m_glFogfv_record;
+this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&RecordTableDecorator::m_glGenQueriesARB_record;
+this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&RecordTableDecorator::m_glProgramUniform2i64NV_record;
+this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&RecordTableDecorator::m_glVertexP4ui_record;
+this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&RecordTableDecorator::m_glVertexStream1ivATI_record;
+this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&RecordTableDecorator::m_glProgramEnvParameterI4iNV_record;
+this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&RecordTableDecorator::m_glGenVertexArraysAPPLE_record;
+this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&RecordTableDecorator::m_glDrawTransformFeedbackInstanced_record;
+this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&RecordTableDecorator::m_glStencilThenCoverStrokePathNV_record;
+this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&RecordTableDecorator::m_glDeleteVertexArraysAPPLE_record;
+this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&RecordTableDecorator::m_glGetNamedBufferParameterui64vNV_record;
+this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&RecordTableDecorator::m_glQueryMatrixxOES_record;
+this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&RecordTableDecorator::m_glSecondaryColor3usv_record;
+this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&RecordTableDecorator::m_glTranslatexOES_record;
+this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glDrawTransformFeedback_record;
+this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_record;
+this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&RecordTableDecorator::m_glVDPAURegisterVideoSurfaceNV_record;
+this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&RecordTableDecorator::m_glGetTexParameterIuiv_record;
+this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&RecordTableDecorator::m_glBindBufferBaseNV_record;
+this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&RecordTableDecorator::m_glIndexPointer_record;
+this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&RecordTableDecorator::m_glGenQueryResourceTagNV_record;
+this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&RecordTableDecorator::m_glVertexAttrib4Nbv_record;
+this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&RecordTableDecorator::m_glListParameteriSGIX_record;
+this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&RecordTableDecorator::m_glBlendColorxOES_record;
+this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&RecordTableDecorator::m_glUniformui64vNV_record;
+this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&RecordTableDecorator::m_glIsSync_record;
+this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetTextureParameterivEXT_record;
+this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&RecordTableDecorator::m_glFogCoordhvNV_record;
+this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&RecordTableDecorator::m_glFramebufferTextureLayerEXT_record;
+this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&RecordTableDecorator::m_glGetObjectPtrLabel_record;
+this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&RecordTableDecorator::m_glTextureParameteri_record;
+this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&RecordTableDecorator::m_glMultiTexCoord1fARB_record;
+this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&RecordTableDecorator::m_glUniformMatrix2x3dv_record;
+this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&RecordTableDecorator::m_glFramebufferDrawBufferEXT_record;
+this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&RecordTableDecorator::m_glCopyColorSubTable_record;
+this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&RecordTableDecorator::m_glGetNamedFramebufferParameterfvAMD_record;
+this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&RecordTableDecorator::m_glVertexAttribL3d_record;
+this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&RecordTableDecorator::m_glFragmentMaterialfvSGIX_record;
+this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&RecordTableDecorator::m_glMatrixLoadTranspose3x3fNV_record;
+this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&RecordTableDecorator::m_glDeleteNamesAMD_record;
+this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&RecordTableDecorator::m_glDrawRangeElementsEXT_record;
+this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&RecordTableDecorator::m_glOrtho_record;
+this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&RecordTableDecorator::m_glProgramUniform1dvEXT_record;
+this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&RecordTableDecorator::m_glColor4xOES_record;
+this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&RecordTableDecorator::m_glTexImage4DSGIS_record;
+this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&RecordTableDecorator::m_glProgramUniform1ui_record;
+this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&RecordTableDecorator::m_glDeleteBuffersARB_record;
+this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&RecordTableDecorator::m_glUnmapBufferARB_record;
+this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&RecordTableDecorator::m_glCopyTexImage2D_record;
+this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&RecordTableDecorator::m_glMaterialxOES_record;
+this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x4fvEXT_record;
+this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&RecordTableDecorator::m_glTestObjectAPPLE_record;
+this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&RecordTableDecorator::m_glRenderbufferStorageEXT_record;
+this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&RecordTableDecorator::m_glVertexAttribL1ui64ARB_record;
+this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&RecordTableDecorator::m_glEndFragmentShaderATI_record;
+this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&RecordTableDecorator::m_glPathParameterivNV_record;
+this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&RecordTableDecorator::m_glUniform4uiv_record;
+this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&RecordTableDecorator::m_glFrameZoomSGIX_record;
+this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&RecordTableDecorator::m_glSecondaryColor3fEXT_record;
+this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&RecordTableDecorator::m_glLGPUInterlockNVX_record;
+this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&RecordTableDecorator::m_glVertexAttribL1dv_record;
+this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&RecordTableDecorator::m_glNormalStream3svATI_record;
+this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&RecordTableDecorator::m_glPathStencilFuncNV_record;
+this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&RecordTableDecorator::m_glSetInvariantEXT_record;
+this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&RecordTableDecorator::m_glGetTexBumpParameterivATI_record;
+this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&RecordTableDecorator::m_glBlendEquationSeparateEXT_record;
+this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&RecordTableDecorator::m_glEndOcclusionQueryNV_record;
+this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&RecordTableDecorator::m_glScissorArrayv_record;
+this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&RecordTableDecorator::m_glCallList_record;
+this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&RecordTableDecorator::m_glMapTexture2DINTEL_record;
+this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&RecordTableDecorator::m_glGetVkProcAddrNV_record;
+this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&RecordTableDecorator::m_glPixelTransferxOES_record;
+this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&RecordTableDecorator::m_glDeleteRenderbuffersEXT_record;
+this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&RecordTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_record;
+this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4dvEXT_record;
+this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&RecordTableDecorator::m_glGetnColorTable_record;
+this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&RecordTableDecorator::m_glFramebufferTextureLayerARB_record;
+this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&RecordTableDecorator::m_glVertexAttribL2dvEXT_record;
+this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetCombinerStageParameterfvNV_record;
+this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&RecordTableDecorator::m_glMultiTexCoord1xvOES_record;
+this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&RecordTableDecorator::m_glMapBuffer_record;
+this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&RecordTableDecorator::m_glSecondaryColor3d_record;
+this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&RecordTableDecorator::m_glSecondaryColor3f_record;
+this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&RecordTableDecorator::m_glVertexAttribLFormat_record;
+this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&RecordTableDecorator::m_glElementPointerAPPLE_record;
+this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&RecordTableDecorator::m_glVertexStream1fATI_record;
+this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&RecordTableDecorator::m_glCoverageModulationNV_record;
+this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&RecordTableDecorator::m_glSecondaryColor3i_record;
+this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&RecordTableDecorator::m_glDeleteSync_record;
+this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetProgramParameterfvNV_record;
+this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&RecordTableDecorator::m_glMaxShaderCompilerThreadsARB_record;
+this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&RecordTableDecorator::m_glUniformMatrix4x2dv_record;
+this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_record;
+this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&RecordTableDecorator::m_glSecondaryColor3s_record;
+this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&RecordTableDecorator::m_glIsImageHandleResidentNV_record;
+this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&RecordTableDecorator::m_glUniform3iv_record;
+this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&RecordTableDecorator::m_glVertexAttribL3i64vNV_record;
+this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&RecordTableDecorator::m_glPolygonMode_record;
+this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&RecordTableDecorator::m_glFramebufferSamplePositionsfvAMD_record;
+this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&RecordTableDecorator::m_glConvolutionFilter1DEXT_record;
+this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&RecordTableDecorator::m_glVertexAttrib1dvARB_record;
+this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glTextureSubImage2DEXT_record;
+this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&RecordTableDecorator::m_glIsVertexArrayAPPLE_record;
+this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&RecordTableDecorator::m_glUseProgram_record;
+this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&RecordTableDecorator::m_glLineStipple_record;
+this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&RecordTableDecorator::m_glMultiTexCoord4fvARB_record;
+this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&RecordTableDecorator::m_glVideoCaptureNV_record;
+this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_record;
+this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&RecordTableDecorator::m_glUniform3fvARB_record;
+this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x2fvEXT_record;
+this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glCopyTextureSubImage3DEXT_record;
+this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&RecordTableDecorator::m_glMultiTexCoord2bvOES_record;
+this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&RecordTableDecorator::m_glDeleteObjectARB_record;
+this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&RecordTableDecorator::m_glTextureLightEXT_record;
+this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&RecordTableDecorator::m_glRasterPos3i_record;
+this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&RecordTableDecorator::m_glMultiTexCoord3dARB_record;
+this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&RecordTableDecorator::m_glNamedFramebufferTextureEXT_record;
+this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&RecordTableDecorator::m_glTextureParameteriEXT_record;
+this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&RecordTableDecorator::m_glEvalCoord2xvOES_record;
+this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&RecordTableDecorator::m_glBindVideoCaptureStreamBufferNV_record;
+this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&RecordTableDecorator::m_glTexImage2DMultisampleCoverageNV_record;
+this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&RecordTableDecorator::m_glGetAttribLocationARB_record;
+this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&RecordTableDecorator::m_glDeleteShader_record;
+this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&RecordTableDecorator::m_glVertexAttrib1fARB_record;
+this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_record;
+this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&RecordTableDecorator::m_glTexCoord4fVertex4fSUN_record;
+this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&RecordTableDecorator::m_glGetMapdv_record;
+this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&RecordTableDecorator::m_glMapParameterfvNV_record;
+this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&RecordTableDecorator::m_glTextureParameterIuiv_record;
+this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&RecordTableDecorator::m_glTransformFeedbackAttribsNV_record;
+this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&RecordTableDecorator::m_glFragmentLightfvSGIX_record;
+this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&RecordTableDecorator::m_glWindowPos3sARB_record;
+this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&RecordTableDecorator::m_glGetConvolutionParameterfv_record;
+this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&RecordTableDecorator::m_glCopyTexSubImage3D_record;
+this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&RecordTableDecorator::m_glVertexAttribI3i_record;
+this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&RecordTableDecorator::m_glCreateShaderObjectARB_record;
+this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&RecordTableDecorator::m_glVertexAttribFormat_record;
+this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&RecordTableDecorator::m_glGetProgramivARB_record;
+this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&RecordTableDecorator::m_glVertexAttribI4usv_record;
+this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&RecordTableDecorator::m_glTexParameterf_record;
+this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&RecordTableDecorator::m_glVertexAttribBinding_record;
+this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&RecordTableDecorator::m_glGetHistogramParameteriv_record;
+this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&RecordTableDecorator::m_glTexParameteri_record;
+this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&RecordTableDecorator::m_glGetShaderSource_record;
+this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&RecordTableDecorator::m_glVertexAttrib4s_record;
+this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&RecordTableDecorator::m_glVertexAttrib4dvNV_record;
+this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&RecordTableDecorator::m_glVertexAttrib1dvNV_record;
+this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&RecordTableDecorator::m_glPopName_record;
+this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&RecordTableDecorator::m_glTextureBufferEXT_record;
+this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&RecordTableDecorator::m_glGetMultiTexImageEXT_record;
+this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&RecordTableDecorator::m_glGetPointerIndexedvEXT_record;
+this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&RecordTableDecorator::m_glIsNameAMD_record;
+this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&RecordTableDecorator::m_glColor4ub_record;
+this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&RecordTableDecorator::m_glBufferParameteriAPPLE_record;
+this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&RecordTableDecorator::m_glColor4ui_record;
+this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&RecordTableDecorator::m_glGetInternalformativ_record;
+this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&RecordTableDecorator::m_glColor4us_record;
+this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&RecordTableDecorator::m_glVertexAttribP1uiv_record;
+this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&RecordTableDecorator::m_glLinkProgram_record;
+this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&RecordTableDecorator::m_glTexCoord3s_record;
+this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&RecordTableDecorator::m_glTexCoord2dv_record;
+this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&RecordTableDecorator::m_glGetObjectLabel_record;
+this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&RecordTableDecorator::m_glVertexPointerEXT_record;
+this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&RecordTableDecorator::m_glDebugMessageCallbackARB_record;
+this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&RecordTableDecorator::m_glGetString_record;
+this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetPathParameterfvNV_record;
+this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&RecordTableDecorator::m_glLightxvOES_record;
+this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&RecordTableDecorator::m_glEndQuery_record;
+this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&RecordTableDecorator::m_glSecondaryColor3uiv_record;
+this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&RecordTableDecorator::m_glPrioritizeTexturesxOES_record;
+this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&RecordTableDecorator::m_glEdgeFlagPointer_record;
+this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&RecordTableDecorator::m_glFramebufferParameteri_record;
+this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&RecordTableDecorator::m_glTexCoord3hNV_record;
+this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&RecordTableDecorator::m_glMultiModeDrawElementsIBM_record;
+this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&RecordTableDecorator::m_glCopyPixels_record;
+this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&RecordTableDecorator::m_glVertexAttribI2ui_record;
+this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&RecordTableDecorator::m_glClampColorARB_record;
+this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&RecordTableDecorator::m_glColorPointervINTEL_record;
+this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&RecordTableDecorator::m_glDeleteTextures_record;
+this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetMinmaxParameterfvEXT_record;
+this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&RecordTableDecorator::m_glWindowPos3sMESA_record;
+this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&RecordTableDecorator::m_glVertexAttrib4f_record;
+this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&RecordTableDecorator::m_glNamedFramebufferParameteri_record;
+this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glTexCoord2fVertex3fvSUN_record;
+this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&RecordTableDecorator::m_glReplacementCodeusSUN_record;
+this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetNamedFramebufferParameteriv_record;
+this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&RecordTableDecorator::m_glVertexStream1fvATI_record;
+this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&RecordTableDecorator::m_glCreateVertexArrays_record;
+this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&RecordTableDecorator::m_glBeginConditionalRender_record;
+this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&RecordTableDecorator::m_glGetUnsignedBytevEXT_record;
+this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&RecordTableDecorator::m_glConvolutionFilter1D_record;
+this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&RecordTableDecorator::m_glMultiTexCoord3fARB_record;
+this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&RecordTableDecorator::m_glGetQueryObjectuivARB_record;
+this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&RecordTableDecorator::m_glScalexOES_record;
+this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&RecordTableDecorator::m_glSamplerParameteri_record;
+this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&RecordTableDecorator::m_glSamplerParameterf_record;
+this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&RecordTableDecorator::m_glShaderOp1EXT_record;
+this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&RecordTableDecorator::m_glBeginVideoCaptureNV_record;
+this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&RecordTableDecorator::m_glGetnHistogram_record;
+this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&RecordTableDecorator::m_glUniform1d_record;
+this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&RecordTableDecorator::m_glRenderMode_record;
+this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&RecordTableDecorator::m_glClearColorIiEXT_record;
+this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&RecordTableDecorator::m_glSignalSemaphoreEXT_record;
+this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&RecordTableDecorator::m_glGetCompressedTexImage_record;
+this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&RecordTableDecorator::m_glCompressedTextureImage1DEXT_record;
+this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&RecordTableDecorator::m_glGetActiveUniformBlockiv_record;
+this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&RecordTableDecorator::m_glUniform1i_record;
+this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirectCount_record;
+this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&RecordTableDecorator::m_glGetTexEnvfv_record;
+this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&RecordTableDecorator::m_glColorTableParameterivSGI_record;
+this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&RecordTableDecorator::m_glCullFace_record;
+this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&RecordTableDecorator::m_glDeleteFencesAPPLE_record;
+this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&RecordTableDecorator::m_glProgramUniform4i_record;
+this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&RecordTableDecorator::m_glUniformHandleui64ARB_record;
+this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&RecordTableDecorator::m_glProgramUniform4f_record;
+this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&RecordTableDecorator::m_glViewportIndexedf_record;
+this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&RecordTableDecorator::m_glProgramUniform4d_record;
+this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&RecordTableDecorator::m_glTexCoord1xOES_record;
+this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&RecordTableDecorator::m_glVertexStream3ivATI_record;
+this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&RecordTableDecorator::m_glPointAlongPathNV_record;
+this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&RecordTableDecorator::m_glEndQueryARB_record;
+this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&RecordTableDecorator::m_glVDPAUMapSurfacesNV_record;
+this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&RecordTableDecorator::m_glVertex3i_record;
+this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&RecordTableDecorator::m_glVertexAttrib4uivARB_record;
+this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&RecordTableDecorator::m_glTextureStorageMem3DEXT_record;
+this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&RecordTableDecorator::m_glAttachShader_record;
+this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&RecordTableDecorator::m_glColor4hNV_record;
+this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&RecordTableDecorator::m_glGetFenceivNV_record;
+this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_record;
+this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&RecordTableDecorator::m_glGetColorTable_record;
+this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&RecordTableDecorator::m_glFogCoordPointer_record;
+this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&RecordTableDecorator::m_glTexStorageSparseAMD_record;
+this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&RecordTableDecorator::m_glUnmapNamedBuffer_record;
+this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&RecordTableDecorator::m_glTexCoord4bvOES_record;
+this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&RecordTableDecorator::m_glVertexAttrib3fARB_record;
+this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&RecordTableDecorator::m_glRasterPos2xOES_record;
+this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&RecordTableDecorator::m_glCreateMemoryObjectsEXT_record;
+this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&RecordTableDecorator::m_glColor4ubVertex2fvSUN_record;
+this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&RecordTableDecorator::m_glSecondaryColor3dv_record;
+this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&RecordTableDecorator::m_glVertexAttribI4sv_record;
+this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&RecordTableDecorator::m_glDrawTransformFeedbackStreamInstanced_record;
+this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&RecordTableDecorator::m_glMultiTexCoord4ivARB_record;
+this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&RecordTableDecorator::m_glSpriteParameterfSGIX_record;
+this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&RecordTableDecorator::m_glSecondaryColor3sv_record;
+this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&RecordTableDecorator::m_glBindVideoCaptureStreamTextureNV_record;
+this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&RecordTableDecorator::m_glTexParameterIuiv_record;
+this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&RecordTableDecorator::m_glFlushPixelDataRangeNV_record;
+this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&RecordTableDecorator::m_glWindowPos3fv_record;
+this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&RecordTableDecorator::m_glVertexAttribLFormatNV_record;
+this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&RecordTableDecorator::m_glLightModelfv_record;
+this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&RecordTableDecorator::m_glGetColorTableSGI_record;
+this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&RecordTableDecorator::m_glGetCompressedTexImageARB_record;
+this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&RecordTableDecorator::m_glConvolutionParameteri_record;
+this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&RecordTableDecorator::m_glVertexWeighthNV_record;
+this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&RecordTableDecorator::m_glColorMaskIndexedEXT_record;
+this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&RecordTableDecorator::m_glColorMaski_record;
+this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&RecordTableDecorator::m_glColorFragmentOp1ATI_record;
+this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4ubvEXT_record;
+this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&RecordTableDecorator::m_glVertexAttrib1dNV_record;
+this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glUnmapObjectBufferATI_record;
+this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_record;
+this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&RecordTableDecorator::m_glProgramUniform1iEXT_record;
+this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&RecordTableDecorator::m_glDeleteQueriesARB_record;
+this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&RecordTableDecorator::m_glWindowPos3svARB_record;
+this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&RecordTableDecorator::m_glVertex4s_record;
+this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&RecordTableDecorator::m_glImportMemoryWin32NameEXT_record;
+this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&RecordTableDecorator::m_glStringMarkerGREMEDY_record;
+this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glIsTransformFeedback_record;
+this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x3dvEXT_record;
+this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&RecordTableDecorator::m_glGetObjectLabelEXT_record;
+this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&RecordTableDecorator::m_glUniformHandleui64vNV_record;
+this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&RecordTableDecorator::m_glRotated_record;
+this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&RecordTableDecorator::m_glIsProgramPipeline_record;
+this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&RecordTableDecorator::m_glRotatef_record;
+this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&RecordTableDecorator::m_glVertex4i_record;
+this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&RecordTableDecorator::m_glGetActiveSubroutineUniformName_record;
+this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&RecordTableDecorator::m_glVertexAttrib4sNV_record;
+this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&RecordTableDecorator::m_glProgramLocalParameter4dvARB_record;
+this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&RecordTableDecorator::m_glReplacementCodeubSUN_record;
+this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_record;
+this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&RecordTableDecorator::m_glImportSemaphoreWin32HandleEXT_record;
+this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&RecordTableDecorator::m_glUniformMatrix3fv_record;
+this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&RecordTableDecorator::m_glGetnMapfvARB_record;
+this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&RecordTableDecorator::m_glGetnUniformfv_record;
+this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&RecordTableDecorator::m_glVertexAttribL2dv_record;
+this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&RecordTableDecorator::m_glVertexWeightPointerEXT_record;
+this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&RecordTableDecorator::m_glTangent3sEXT_record;
+this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&RecordTableDecorator::m_glSecondaryColorPointer_record;
+this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&RecordTableDecorator::m_glAlphaFunc_record;
+this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&RecordTableDecorator::m_glGetNamedStringARB_record;
+this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&RecordTableDecorator::m_glTexCoord4d_record;
+this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&RecordTableDecorator::m_glBufferPageCommitmentARB_record;
+this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&RecordTableDecorator::m_glProgramLocalParameters4fvEXT_record;
+this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&RecordTableDecorator::m_glStencilFunc_record;
+this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&RecordTableDecorator::m_glSemaphoreParameterui64vEXT_record;
+this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&RecordTableDecorator::m_glGetVertexAttribdvNV_record;
+this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&RecordTableDecorator::m_glTexCoord3dv_record;
+this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&RecordTableDecorator::m_glGetQueryBufferObjectiv_record;
+this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&RecordTableDecorator::m_glTexGenxOES_record;
+this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&RecordTableDecorator::m_glMultiTexCoord1fvARB_record;
+this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&RecordTableDecorator::m_glLightEnviSGIX_record;
+this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&RecordTableDecorator::m_glGetProgramPipelineiv_record;
+this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&RecordTableDecorator::m_glVertexStream2ivATI_record;
+this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&RecordTableDecorator::m_glGetColorTableEXT_record;
+this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&RecordTableDecorator::m_glGetShaderInfoLog_record;
+this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&RecordTableDecorator::m_glGetOcclusionQueryuivNV_record;
+this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&RecordTableDecorator::m_glInvalidateNamedFramebufferSubData_record;
+this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&RecordTableDecorator::m_glVertexAttribL1i64NV_record;
+this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&RecordTableDecorator::m_glVDPAUInitNV_record;
+this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&RecordTableDecorator::m_glVertexAttrib1hvNV_record;
+this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&RecordTableDecorator::m_glVertexAttribI4i_record;
+this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&RecordTableDecorator::m_glRasterPos2iv_record;
+this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&RecordTableDecorator::m_glGetIntegerui64i_vNV_record;
+this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&RecordTableDecorator::m_glUniformHandleui64NV_record;
+this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&RecordTableDecorator::m_glWindowPos3ivMESA_record;
+this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&RecordTableDecorator::m_glBlendEquationSeparate_record;
+this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&RecordTableDecorator::m_glDrawElementsInstancedARB_record;
+this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&RecordTableDecorator::m_glGetSubroutineIndex_record;
+this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&RecordTableDecorator::m_glVertexAttrib2sv_record;
+this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&RecordTableDecorator::m_glSamplePatternSGIS_record;
+this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&RecordTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_record;
+this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&RecordTableDecorator::m_glPushAttrib_record;
+this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&RecordTableDecorator::m_glVertex3hNV_record;
+this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&RecordTableDecorator::m_glRasterPos3xvOES_record;
+this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&RecordTableDecorator::m_glPathParameterfNV_record;
+this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&RecordTableDecorator::m_glGetUniformi64vNV_record;
+this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&RecordTableDecorator::m_glLightiv_record;
+this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&RecordTableDecorator::m_glMaterialxvOES_record;
+this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameter4fEXT_record;
+this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&RecordTableDecorator::m_glVertexAttribL1dEXT_record;
+this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&RecordTableDecorator::m_glGetnUniformdvARB_record;
+this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&RecordTableDecorator::m_glSecondaryColor3bEXT_record;
+this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&RecordTableDecorator::m_glBeginPerfQueryINTEL_record;
+this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&RecordTableDecorator::m_glProgramUniform1uivEXT_record;
+this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&RecordTableDecorator::m_glImageTransformParameterivHP_record;
+this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&RecordTableDecorator::m_glDeleteBuffers_record;
+this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&RecordTableDecorator::m_glBindProgramPipeline_record;
+this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&RecordTableDecorator::m_glScissor_record;
+this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&RecordTableDecorator::m_glProgramUniform4fv_record;
+this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&RecordTableDecorator::m_glGetBooleanv_record;
+this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&RecordTableDecorator::m_glMaterialfv_record;
+this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&RecordTableDecorator::m_glWindowPos4fvMESA_record;
+this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&RecordTableDecorator::m_glVertexAttribIPointerEXT_record;
+this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&RecordTableDecorator::m_glProgramBufferParametersfvNV_record;
+this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&RecordTableDecorator::m_glAlphaFuncxOES_record;
+this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirectAMD_record;
+this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&RecordTableDecorator::m_glNormalStream3ivATI_record;
+this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&RecordTableDecorator::m_glTextureImage3DMultisampleNV_record;
+this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&RecordTableDecorator::m_glProgramUniform4uivEXT_record;
+this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&RecordTableDecorator::m_glReplacementCodeusvSUN_record;
+this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&RecordTableDecorator::m_glPollInstrumentsSGIX_record;
+this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&RecordTableDecorator::m_glGetTextureLevelParameteriv_record;
+this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&RecordTableDecorator::m_glVertexAttribI2uiv_record;
+this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&RecordTableDecorator::m_glMapControlPointsNV_record;
+this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&RecordTableDecorator::m_glColor4dv_record;
+this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&RecordTableDecorator::m_glInvalidateBufferSubData_record;
+this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&RecordTableDecorator::m_glMultiTexCoord1hNV_record;
+this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&RecordTableDecorator::m_glPointParameterfv_record;
+this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&RecordTableDecorator::m_glUniformMatrix2fvARB_record;
+this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&RecordTableDecorator::m_glUniform2fv_record;
+this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&RecordTableDecorator::m_glVertexPointerListIBM_record;
+this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&RecordTableDecorator::m_glGetMultiTexGenfvEXT_record;
+this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&RecordTableDecorator::m_glGetMinmaxEXT_record;
+this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&RecordTableDecorator::m_glIsFenceNV_record;
+this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&RecordTableDecorator::m_glMatrixFrustumEXT_record;
+this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&RecordTableDecorator::m_glDispatchComputeIndirect_record;
+this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&RecordTableDecorator::m_glQueryResourceNV_record;
+this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&RecordTableDecorator::m_glMultiTexCoord4bOES_record;
+this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&RecordTableDecorator::m_glProgramEnvParameter4dARB_record;
+this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&RecordTableDecorator::m_glProgramUniform1uiEXT_record;
+this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&RecordTableDecorator::m_glBindBufferRange_record;
+this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&RecordTableDecorator::m_glNormal3iv_record;
+this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&RecordTableDecorator::m_glVertexAttribL3dv_record;
+this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&RecordTableDecorator::m_glGetUniformdv_record;
+this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetMultiTexLevelParameterfvEXT_record;
+this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&RecordTableDecorator::m_glFinalCombinerInputNV_record;
+this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&RecordTableDecorator::m_glCullParameterdvEXT_record;
+this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&RecordTableDecorator::m_glMultiTexCoord4s_record;
+this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&RecordTableDecorator::m_glMapVertexAttrib1fAPPLE_record;
+this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&RecordTableDecorator::m_glConvolutionParameterfEXT_record;
+this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&RecordTableDecorator::m_glTexCoord1iv_record;
+this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&RecordTableDecorator::m_glProgramUniform3fvEXT_record;
+this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&RecordTableDecorator::m_glColor3uiv_record;
+this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&RecordTableDecorator::m_glRenderGpuMaskNV_record;
+this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&RecordTableDecorator::m_glListBase_record;
+this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&RecordTableDecorator::m_glTexCoord2bOES_record;
+this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&RecordTableDecorator::m_glBindMaterialParameterEXT_record;
+this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactorubSUN_record;
+this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&RecordTableDecorator::m_glVertexAttribL1ui64NV_record;
+this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&RecordTableDecorator::m_glPointParameterfSGIS_record;
+this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&RecordTableDecorator::m_glGetImageTransformParameterivHP_record;
+this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&RecordTableDecorator::m_glColorSubTableEXT_record;
+this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&RecordTableDecorator::m_glPixelTexGenParameterfvSGIS_record;
+this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&RecordTableDecorator::m_glClientWaitSync_record;
+this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&RecordTableDecorator::m_glQueryObjectParameteruiAMD_record;
+this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&RecordTableDecorator::m_glVertexAttribs1fvNV_record;
+this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NusvARB_record;
+this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&RecordTableDecorator::m_glVariantPointerEXT_record;
+this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&RecordTableDecorator::m_glTextureBuffer_record;
+this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&RecordTableDecorator::m_glVertexAttribI1uiEXT_record;
+this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&RecordTableDecorator::m_glInvalidateTexImage_record;
+this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&RecordTableDecorator::m_glProgramEnvParametersI4ivNV_record;
+this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&RecordTableDecorator::m_glPathGlyphIndexArrayNV_record;
+this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&RecordTableDecorator::m_glCopyImageSubData_record;
+this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&RecordTableDecorator::m_glGetUniformSubroutineuiv_record;
+this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&RecordTableDecorator::m_glBindVertexBuffer_record;
+this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&RecordTableDecorator::m_glMultiTexCoord1iARB_record;
+this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&RecordTableDecorator::m_glDebugMessageInsert_record;
+this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&RecordTableDecorator::m_glBeginVertexShaderEXT_record;
+this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&RecordTableDecorator::m_glIsVariantEnabledEXT_record;
+this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&RecordTableDecorator::m_glPassThroughxOES_record;
+this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&RecordTableDecorator::m_glIsSampler_record;
+this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&RecordTableDecorator::m_glConservativeRasterParameterfNV_record;
+this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&RecordTableDecorator::m_glMultiTexGenivEXT_record;
+this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&RecordTableDecorator::m_glNamedFramebufferTexture2DEXT_record;
+this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&RecordTableDecorator::m_glCopyTexSubImage1D_record;
+this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&RecordTableDecorator::m_glTexCoord1i_record;
+this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&RecordTableDecorator::m_glCheckFramebufferStatus_record;
+this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&RecordTableDecorator::m_glDrawElementArrayAPPLE_record;
+this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&RecordTableDecorator::m_glTexCoord1d_record;
+this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&RecordTableDecorator::m_glTexCoord1f_record;
+this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&RecordTableDecorator::m_glFragmentLightivSGIX_record;
+this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&RecordTableDecorator::m_glBindImageTexture_record;
+this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&RecordTableDecorator::m_glTransformFeedbackVaryings_record;
+this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&RecordTableDecorator::m_glMulticastBufferSubDataNV_record;
+this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&RecordTableDecorator::m_glDrawRangeElements_record;
+this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&RecordTableDecorator::m_glTexCoord1s_record;
+this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&RecordTableDecorator::m_glBindBufferBase_record;
+this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&RecordTableDecorator::m_glColor3bv_record;
+this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&RecordTableDecorator::m_glSyncTextureINTEL_record;
+this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&RecordTableDecorator::m_glCreateSamplers_record;
+this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&RecordTableDecorator::m_glCombinerParameterfNV_record;
+this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&RecordTableDecorator::m_glGetArrayObjectivATI_record;
+this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&RecordTableDecorator::m_glMultiDrawArrays_record;
+this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&RecordTableDecorator::m_glSampleMapATI_record;
+this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&RecordTableDecorator::m_glProgramUniform2i64ARB_record;
+this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&RecordTableDecorator::m_glBinormal3ivEXT_record;
+this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirectCountARB_record;
+this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&RecordTableDecorator::m_glTextureStorageMem1DEXT_record;
+this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&RecordTableDecorator::m_glWindowPos2ivMESA_record;
+this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&RecordTableDecorator::m_glTexCoordP4ui_record;
+this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glMultiTexSubImage1DEXT_record;
+this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x3fvEXT_record;
+this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&RecordTableDecorator::m_glBufferDataARB_record;
+this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&RecordTableDecorator::m_glVertexAttribIFormat_record;
+this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&RecordTableDecorator::m_glCreateFramebuffers_record;
+this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&RecordTableDecorator::m_glNormalStream3dvATI_record;
+this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&RecordTableDecorator::m_glClearAccum_record;
+this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&RecordTableDecorator::m_glUniform3i64vNV_record;
+this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glNormal3fVertex3fSUN_record;
+this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&RecordTableDecorator::m_glUniform2uivEXT_record;
+this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&RecordTableDecorator::m_glBeginQuery_record;
+this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_record;
+this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&RecordTableDecorator::m_glBindBuffer_record;
+this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&RecordTableDecorator::m_glMap2d_record;
+this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&RecordTableDecorator::m_glMap2f_record;
+this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&RecordTableDecorator::m_glMakeImageHandleResidentNV_record;
+this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&RecordTableDecorator::m_glUniformMatrix2x4fv_record;
+this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetMultiTexParameterfvEXT_record;
+this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&RecordTableDecorator::m_glDepthRangeIndexed_record;
+this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&RecordTableDecorator::m_glIsEnabled_record;
+this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&RecordTableDecorator::m_glMatrixScalefEXT_record;
+this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&RecordTableDecorator::m_glGetError_record;
+this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&RecordTableDecorator::m_glGetTexEnviv_record;
+this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&RecordTableDecorator::m_glBindTextureUnitParameterEXT_record;
+this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&RecordTableDecorator::m_glGetnUniformfvARB_record;
+this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_record;
+this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&RecordTableDecorator::m_glDeletePerfQueryINTEL_record;
+this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&RecordTableDecorator::m_glActiveVaryingNV_record;
+this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&RecordTableDecorator::m_glGetActiveUniformARB_record;
+this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&RecordTableDecorator::m_glVertexAttribI3ivEXT_record;
+this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&RecordTableDecorator::m_glEvalCoord1d_record;
+this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&RecordTableDecorator::m_glNamedCopyBufferSubDataEXT_record;
+this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&RecordTableDecorator::m_glEvalCoord1f_record;
+this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&RecordTableDecorator::m_glPixelMapfv_record;
+this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&RecordTableDecorator::m_glVertexAttribI1ivEXT_record;
+this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&RecordTableDecorator::m_glCreateSyncFromCLeventARB_record;
+this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&RecordTableDecorator::m_glGetPixelMapusv_record;
+this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&RecordTableDecorator::m_glGetnColorTableARB_record;
+this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&RecordTableDecorator::m_glAccum_record;
+this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&RecordTableDecorator::m_glRasterPos3sv_record;
+this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&RecordTableDecorator::m_glTexCoord2iv_record;
+this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&RecordTableDecorator::m_glBlendFunciARB_record;
+this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&RecordTableDecorator::m_glProgramUniform3i64vARB_record;
+this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&RecordTableDecorator::m_glGetFramebufferAttachmentParameteriv_record;
+this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&RecordTableDecorator::m_glProgramUniform4ui_record;
+this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&RecordTableDecorator::m_glStencilMask_record;
+this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&RecordTableDecorator::m_glResetHistogramEXT_record;
+this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&RecordTableDecorator::m_glLightxOES_record;
+this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&RecordTableDecorator::m_glNamedBufferData_record;
+this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&RecordTableDecorator::m_glVertexStream3sATI_record;
+this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&RecordTableDecorator::m_glVertexAttrib3fvARB_record;
+this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&RecordTableDecorator::m_glClearNamedBufferSubData_record;
+this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&RecordTableDecorator::m_glProgramUniformHandleui64ARB_record;
+this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&RecordTableDecorator::m_glUniform3iARB_record;
+this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&RecordTableDecorator::m_glCreateProgramObjectARB_record;
+this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&RecordTableDecorator::m_glMultiTexCoord1dvARB_record;
+this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&RecordTableDecorator::m_glGetObjectParameterfvARB_record;
+this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&RecordTableDecorator::m_glRectsv_record;
+this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&RecordTableDecorator::m_glMultiTexImage2DEXT_record;
+this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&RecordTableDecorator::m_glProgramUniform1i64NV_record;
+this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&RecordTableDecorator::m_glGetObjectBufferivATI_record;
+this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&RecordTableDecorator::m_glUniform4i64ARB_record;
+this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_record;
+this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&RecordTableDecorator::m_glBlendFuncSeparateINGR_record;
+this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&RecordTableDecorator::m_glGetVideoCaptureStreamfvNV_record;
+this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&RecordTableDecorator::m_glVertexAttrib2fARB_record;
+this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&RecordTableDecorator::m_glGetTexGeniv_record;
+this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&RecordTableDecorator::m_glPixelStorei_record;
+this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&RecordTableDecorator::m_glGetCompressedTextureSubImage_record;
+this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&RecordTableDecorator::m_glCopyImageSubDataNV_record;
+this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&RecordTableDecorator::m_glActiveShaderProgram_record;
+this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&RecordTableDecorator::m_glVertexStream1iATI_record;
+this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&RecordTableDecorator::m_glPatchParameterfv_record;
+this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&RecordTableDecorator::m_glIsFramebufferEXT_record;
+this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&RecordTableDecorator::m_glTextureStorage2D_record;
+this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&RecordTableDecorator::m_glProgramUniform1ui64ARB_record;
+this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&RecordTableDecorator::m_glTexBufferRange_record;
+this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&RecordTableDecorator::m_glGetPixelTexGenParameterivSGIS_record;
+this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glTextureSubImage3DEXT_record;
+this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&RecordTableDecorator::m_glClipControl_record;
+this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&RecordTableDecorator::m_glGetProgramResourceiv_record;
+this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&RecordTableDecorator::m_glMultiTexCoordP2uiv_record;
+this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&RecordTableDecorator::m_glVertexAttribI3ui_record;
+this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&RecordTableDecorator::m_glSampleMaskSGIS_record;
+this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NivARB_record;
+this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactorfSUN_record;
+this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&RecordTableDecorator::m_glBlendEquationSeparateIndexedAMD_record;
+this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&RecordTableDecorator::m_glGetPerfCounterInfoINTEL_record;
+this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&RecordTableDecorator::m_glDeleteProgramsNV_record;
+this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&RecordTableDecorator::m_glPixelZoomxOES_record;
+this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetCombinerOutputParameterivNV_record;
+this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&RecordTableDecorator::m_glRasterPos2xvOES_record;
+this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&RecordTableDecorator::m_glGetTexImage_record;
+this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&RecordTableDecorator::m_glVertexArrayVertexBuffers_record;
+this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&RecordTableDecorator::m_glUniform1ui64NV_record;
+this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&RecordTableDecorator::m_glProgramParameteri_record;
+this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&RecordTableDecorator::m_glNormal3xOES_record;
+this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&RecordTableDecorator::m_glGetMapfv_record;
+this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&RecordTableDecorator::m_glVertexStream2dvATI_record;
+this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&RecordTableDecorator::m_glPathStencilDepthOffsetNV_record;
+this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&RecordTableDecorator::m_glIsStateNV_record;
+this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&RecordTableDecorator::m_glGetIntegerui64vNV_record;
+this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&RecordTableDecorator::m_glGetImageTransformParameterfvHP_record;
+this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&RecordTableDecorator::m_glRasterPos2fv_record;
+this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&RecordTableDecorator::m_glVertex3xOES_record;
+this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&RecordTableDecorator::m_glIsMemoryObjectEXT_record;
+this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&RecordTableDecorator::m_glWeightPointerARB_record;
+this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&RecordTableDecorator::m_glFinishFenceNV_record;
+this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&RecordTableDecorator::m_glDepthRangexOES_record;
+this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&RecordTableDecorator::m_glEnableVertexArrayAttribEXT_record;
+this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&RecordTableDecorator::m_glProgramUniform2uivEXT_record;
+this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&RecordTableDecorator::m_glGetDoubleIndexedvEXT_record;
+this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&RecordTableDecorator::m_glWindowPos2fMESA_record;
+this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&RecordTableDecorator::m_glSecondaryColor3b_record;
+this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&RecordTableDecorator::m_glCopyConvolutionFilter1DEXT_record;
+this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&RecordTableDecorator::m_glWindowPos2sv_record;
+this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&RecordTableDecorator::m_glBindFramebufferEXT_record;
+this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&RecordTableDecorator::m_glCreateShader_record;
+this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&RecordTableDecorator::m_glGenPathsNV_record;
+this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&RecordTableDecorator::m_glGenRenderbuffers_record;
+this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&RecordTableDecorator::m_glCopyTexSubImage2D_record;
+this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&RecordTableDecorator::m_glVertexAttrib4ubvARB_record;
+this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&RecordTableDecorator::m_glDrawTextureNV_record;
+this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&RecordTableDecorator::m_glVertexAttribs1svNV_record;
+this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&RecordTableDecorator::m_glClearNamedBufferSubDataEXT_record;
+this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&RecordTableDecorator::m_glBlendFuncSeparate_record;
+this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&RecordTableDecorator::m_glPointParameterfARB_record;
+this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&RecordTableDecorator::m_glTexCoord2fv_record;
+this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&RecordTableDecorator::m_glGetVariantFloatvEXT_record;
+this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&RecordTableDecorator::m_glVertexP2ui_record;
+this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&RecordTableDecorator::m_glWindowPos2dMESA_record;
+this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&RecordTableDecorator::m_glTexCoord4fv_record;
+this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&RecordTableDecorator::m_glBindFragDataLocationEXT_record;
+this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&RecordTableDecorator::m_glCompressedTexSubImage1DARB_record;
+this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&RecordTableDecorator::m_glGetTextureImageEXT_record;
+this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&RecordTableDecorator::m_glFogCoordd_record;
+this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&RecordTableDecorator::m_glPointSize_record;
+this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&RecordTableDecorator::m_glBindTextureUnit_record;
+this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&RecordTableDecorator::m_glProgramEnvParameterI4uiNV_record;
+this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&RecordTableDecorator::m_glGetProgramPipelineInfoLog_record;
+this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&RecordTableDecorator::m_glProgramUniform4i64vARB_record;
+this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&RecordTableDecorator::m_glVertexAttrib4Nuiv_record;
+this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&RecordTableDecorator::m_glGetUniformfvARB_record;
+this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&RecordTableDecorator::m_glWaitSync_record;
+this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&RecordTableDecorator::m_glUniform3i_record;
+this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&RecordTableDecorator::m_glBlendEquationSeparatei_record;
+this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&RecordTableDecorator::m_glVertexAttrib2hvNV_record;
+this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&RecordTableDecorator::m_glTextureParameterivEXT_record;
+this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&RecordTableDecorator::m_glUniform3d_record;
+this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&RecordTableDecorator::m_glUniform3f_record;
+this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&RecordTableDecorator::m_glActiveProgramEXT_record;
+this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&RecordTableDecorator::m_glProgramUniform3uiv_record;
+this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&RecordTableDecorator::m_glUniform3ui64vARB_record;
+this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&RecordTableDecorator::m_glProgramUniform1ui64vARB_record;
+this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&RecordTableDecorator::m_glTextureParameterfEXT_record;
+this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&RecordTableDecorator::m_glSetFragmentShaderConstantATI_record;
+this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&RecordTableDecorator::m_glColorSubTable_record;
+this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&RecordTableDecorator::m_glReplacementCodeuiSUN_record;
+this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&RecordTableDecorator::m_glStateCaptureNV_record;
+this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&RecordTableDecorator::m_glBindAttribLocation_record;
+this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&RecordTableDecorator::m_glWeightusvARB_record;
+this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&RecordTableDecorator::m_glGetFragDataIndex_record;
+this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&RecordTableDecorator::m_glMultiTexCoord2xOES_record;
+this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&RecordTableDecorator::m_glColor3sv_record;
+this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&RecordTableDecorator::m_glTexCoord2fVertex3fSUN_record;
+this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetMemoryObjectParameterivEXT_record;
+this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&RecordTableDecorator::m_glPolygonOffsetEXT_record;
+this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&RecordTableDecorator::m_glWeightPathsNV_record;
+this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&RecordTableDecorator::m_glCombinerStageParameterfvNV_record;
+this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&RecordTableDecorator::m_glPointParameterfEXT_record;
+this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyTexImage1DEXT_record;
+this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&RecordTableDecorator::m_glVertex4sv_record;
+this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&RecordTableDecorator::m_glMatrixMultfEXT_record;
+this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glCompressedTextureSubImage3DEXT_record;
+this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&RecordTableDecorator::m_glGetTexLevelParameterxvOES_record;
+this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&RecordTableDecorator::m_glVertexAttribL3dvEXT_record;
+this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&RecordTableDecorator::m_glMultiTexCoordP4ui_record;
+this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetTextureLevelParameterivEXT_record;
+this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&RecordTableDecorator::m_glAlphaFragmentOp2ATI_record;
+this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&RecordTableDecorator::m_glDeleteFramebuffers_record;
+this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&RecordTableDecorator::m_glDrawArrays_record;
+this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&RecordTableDecorator::m_glGetTransformFeedbackiv_record;
+this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&RecordTableDecorator::m_glGetnTexImageARB_record;
+this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&RecordTableDecorator::m_glClear_record;
+this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&RecordTableDecorator::m_glVertexArrayParameteriAPPLE_record;
+this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&RecordTableDecorator::m_glMultiTexCoord2dvARB_record;
+this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&RecordTableDecorator::m_glGetVideoCaptureStreamdvNV_record;
+this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&RecordTableDecorator::m_glFragmentLightModelivSGIX_record;
+this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&RecordTableDecorator::m_glVertexAttribP2ui_record;
+this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&RecordTableDecorator::m_glMultiTexCoordPointerEXT_record;
+this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&RecordTableDecorator::m_glProgramUniform3iEXT_record;
+this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&RecordTableDecorator::m_glTranslatef_record;
+this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&RecordTableDecorator::m_glVertexAttrib4Nub_record;
+this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&RecordTableDecorator::m_glTranslated_record;
+this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&RecordTableDecorator::m_glSamplerParameterIiv_record;
+this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&RecordTableDecorator::m_glTexCoord4hNV_record;
+this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&RecordTableDecorator::m_glDrawElementsIndirect_record;
+this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&RecordTableDecorator::m_glDeletePerfMonitorsAMD_record;
+this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&RecordTableDecorator::m_glIsRenderbufferEXT_record;
+this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&RecordTableDecorator::m_glDrawCommandsNV_record;
+this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&RecordTableDecorator::m_glUniform3ivARB_record;
+this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&RecordTableDecorator::m_glBufferSubData_record;
+this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&RecordTableDecorator::m_glSecondaryColor3bv_record;
+this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&RecordTableDecorator::m_glMatrixMultTransposedEXT_record;
+this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&RecordTableDecorator::m_glRequestResidentProgramsNV_record;
+this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&RecordTableDecorator::m_glAlphaFragmentOp1ATI_record;
+this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&RecordTableDecorator::m_glGetQueryObjecti64v_record;
+this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&RecordTableDecorator::m_glMatrixMult3x3fNV_record;
+this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&RecordTableDecorator::m_glColorTableParameteriv_record;
+this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&RecordTableDecorator::m_glPathSubCommandsNV_record;
+this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetFinalCombinerInputParameterivNV_record;
+this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&RecordTableDecorator::m_glIsRenderbuffer_record;
+this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&RecordTableDecorator::m_glVertex3iv_record;
+this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&RecordTableDecorator::m_glTexGenfv_record;
+this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&RecordTableDecorator::m_glFrustumfOES_record;
+this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&RecordTableDecorator::m_glBindVertexBuffers_record;
+this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&RecordTableDecorator::m_glMateriali_record;
+this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&RecordTableDecorator::m_glMultiTexCoord2svARB_record;
+this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&RecordTableDecorator::m_glDisableVertexAttribArray_record;
+this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&RecordTableDecorator::m_glWindowPos3ivARB_record;
+this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&RecordTableDecorator::m_glTexCoordFormatNV_record;
+this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&RecordTableDecorator::m_glBlitNamedFramebuffer_record;
+this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&RecordTableDecorator::m_glMatrixLoadTransposefEXT_record;
+this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&RecordTableDecorator::m_glMultiTexGenfEXT_record;
+this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&RecordTableDecorator::m_glShaderStorageBlockBinding_record;
+this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&RecordTableDecorator::m_glMaterialf_record;
+this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_record;
+this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&RecordTableDecorator::m_glCheckNamedFramebufferStatusEXT_record;
+this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribFormatEXT_record;
+this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&RecordTableDecorator::m_glVertex2hNV_record;
+this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&RecordTableDecorator::m_glDeleteVertexShaderEXT_record;
+this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&RecordTableDecorator::m_glTexImage3DEXT_record;
+this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&RecordTableDecorator::m_glSignalVkFenceNV_record;
+this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&RecordTableDecorator::m_glProgramLocalParameterI4ivNV_record;
+this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactoriSUN_record;
+this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&RecordTableDecorator::m_glTextureStorage1D_record;
+this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&RecordTableDecorator::m_glBinormal3sEXT_record;
+this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&RecordTableDecorator::m_glGetProgramInterfaceiv_record;
+this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&RecordTableDecorator::m_glMatrixIndexPointerARB_record;
+this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&RecordTableDecorator::m_glTexCoordPointerEXT_record;
+this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&RecordTableDecorator::m_glMultiTexGeniEXT_record;
+this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&RecordTableDecorator::m_glVertexAttrib2fNV_record;
+this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&RecordTableDecorator::m_glNamedProgramStringEXT_record;
+this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&RecordTableDecorator::m_glMapNamedBuffer_record;
+this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&RecordTableDecorator::m_glGetMinmaxParameteriv_record;
+this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&RecordTableDecorator::m_glGetnUniformdv_record;
+this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&RecordTableDecorator::m_glEndConditionalRenderNVX_record;
+this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&RecordTableDecorator::m_glBinormal3fEXT_record;
+this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&RecordTableDecorator::m_glNormalStream3iATI_record;
+this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&RecordTableDecorator::m_glProgramBufferParametersIivNV_record;
+this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&RecordTableDecorator::m_glMapGrid1xOES_record;
+this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&RecordTableDecorator::m_glGetVertexAttribPointervARB_record;
+this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&RecordTableDecorator::m_glFlushMappedNamedBufferRangeEXT_record;
+this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&RecordTableDecorator::m_glGetVertexAttribIiv_record;
+this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&RecordTableDecorator::m_glVertexP4uiv_record;
+this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&RecordTableDecorator::m_glUniformui64NV_record;
+this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&RecordTableDecorator::m_glColor4fv_record;
+this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&RecordTableDecorator::m_glTexParameterxvOES_record;
+this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&RecordTableDecorator::m_glPatchParameteri_record;
+this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&RecordTableDecorator::m_glMap1d_record;
+this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&RecordTableDecorator::m_glGetTexFilterFuncSGIS_record;
+this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&RecordTableDecorator::m_glVertexStream3dATI_record;
+this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&RecordTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_record;
+this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&RecordTableDecorator::m_glMultiTexCoord3svARB_record;
+this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&RecordTableDecorator::m_glBindProgramNV_record;
+this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&RecordTableDecorator::m_glGetConvolutionParameteriv_record;
+this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&RecordTableDecorator::m_glGetProgramLocalParameterfvARB_record;
+this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&RecordTableDecorator::m_glGenFragmentShadersATI_record;
+this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&RecordTableDecorator::m_glTexBumpParameterivATI_record;
+this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&RecordTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_record;
+this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&RecordTableDecorator::m_glGetnSeparableFilter_record;
+this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&RecordTableDecorator::m_glNormal3xvOES_record;
+this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&RecordTableDecorator::m_glPassTexCoordATI_record;
+this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&RecordTableDecorator::m_glFramebufferTextureFaceARB_record;
+this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&RecordTableDecorator::m_glProgramUniform1dv_record;
+this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&RecordTableDecorator::m_glTextureStorage2DEXT_record;
+this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayFogCoordOffsetEXT_record;
+this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&RecordTableDecorator::m_glDeleteNamedStringARB_record;
+this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&RecordTableDecorator::m_glMulticastGetQueryObjecti64vNV_record;
+this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&RecordTableDecorator::m_glGenOcclusionQueriesNV_record;
+this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&RecordTableDecorator::m_glLighti_record;
+this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&RecordTableDecorator::m_glTexImage1D_record;
+this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&RecordTableDecorator::m_glLightf_record;
+this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&RecordTableDecorator::m_glClientAttribDefaultEXT_record;
+this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&RecordTableDecorator::m_glVertexAttrib4bvARB_record;
+this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&RecordTableDecorator::m_glVertexAttribIFormatNV_record;
+this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&RecordTableDecorator::m_glStencilFuncSeparate_record;
+this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&RecordTableDecorator::m_glGetVertexAttribfvARB_record;
+this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&RecordTableDecorator::m_glVertexAttrib2dNV_record;
+this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&RecordTableDecorator::m_glProgramUniform2iEXT_record;
+this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&RecordTableDecorator::m_glClientActiveVertexStreamATI_record;
+this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&RecordTableDecorator::m_glRasterPos3xOES_record;
+this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetMapParameterivNV_record;
+this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&RecordTableDecorator::m_glSampleCoverage_record;
+this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&RecordTableDecorator::m_glClearDepthxOES_record;
+this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&RecordTableDecorator::m_glUniformBufferEXT_record;
+this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_record;
+this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&RecordTableDecorator::m_glMulticastGetQueryObjectuivNV_record;
+this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&RecordTableDecorator::m_glGetFirstPerfQueryIdINTEL_record;
+this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&RecordTableDecorator::m_glUnmapNamedBufferEXT_record;
+this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&RecordTableDecorator::m_glGetTransformFeedbacki_v_record;
+this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&RecordTableDecorator::m_glUniform4fvARB_record;
+this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&RecordTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_record;
+this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&RecordTableDecorator::m_glGetFloati_vEXT_record;
+this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&RecordTableDecorator::m_glBindAttribLocationARB_record;
+this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&RecordTableDecorator::m_glBufferAddressRangeNV_record;
+this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&RecordTableDecorator::m_glGenProgramsARB_record;
+this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&RecordTableDecorator::m_glMultiTexEnvivEXT_record;
+this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&RecordTableDecorator::m_glSecondaryColor3uiEXT_record;
+this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&RecordTableDecorator::m_glCompressedTextureImage2DEXT_record;
+this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&RecordTableDecorator::m_glUniform2i_record;
+this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyTexImage2DEXT_record;
+this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&RecordTableDecorator::m_glUniform2d_record;
+this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&RecordTableDecorator::m_glVertexAttribL1d_record;
+this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&RecordTableDecorator::m_glFramebufferTextureFaceEXT_record;
+this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&RecordTableDecorator::m_glFramebufferTextureLayer_record;
+this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&RecordTableDecorator::m_glMultiTexCoord4bvOES_record;
+this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&RecordTableDecorator::m_glGetVertexArrayPointeri_vEXT_record;
+this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameter4dEXT_record;
+this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&RecordTableDecorator::m_glBinormal3bEXT_record;
+this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&RecordTableDecorator::m_glConvolutionFilter2DEXT_record;
+this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&RecordTableDecorator::m_glProgramUniform2fv_record;
+this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glColor3fVertex3fSUN_record;
+this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glNormal3fVertex3fvSUN_record;
+this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glCopyMultiTexSubImage3DEXT_record;
+this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&RecordTableDecorator::m_glProgramLocalParameterI4iNV_record;
+this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x4dv_record;
+this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&RecordTableDecorator::m_glPathMemoryGlyphIndexArrayNV_record;
+this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&RecordTableDecorator::m_glDrawArraysEXT_record;
+this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&RecordTableDecorator::m_glBlendEquationEXT_record;
+this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&RecordTableDecorator::m_glStencilOp_record;
+this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyTextureSubImage2DEXT_record;
+this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&RecordTableDecorator::m_glTexEnvf_record;
+this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&RecordTableDecorator::m_glVertexAttrib2dvNV_record;
+this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&RecordTableDecorator::m_glGenPerfMonitorsAMD_record;
+this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&RecordTableDecorator::m_glGetInteger64i_v_record;
+this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&RecordTableDecorator::m_glGetHistogramParameterfv_record;
+this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&RecordTableDecorator::m_glVertexFormatNV_record;
+this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&RecordTableDecorator::m_glBlendFuncIndexedAMD_record;
+this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&RecordTableDecorator::m_glTexEnvi_record;
+this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&RecordTableDecorator::m_glMultiTexCoord1iv_record;
+this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&RecordTableDecorator::m_glIsEnabledi_record;
+this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&RecordTableDecorator::m_glVertexAttribL2ui64vNV_record;
+this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&RecordTableDecorator::m_glVertexAttribL4i64NV_record;
+this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&RecordTableDecorator::m_glMatrixTranslatedEXT_record;
+this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&RecordTableDecorator::m_glMakeTextureHandleResidentARB_record;
+this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&RecordTableDecorator::m_glMatrixMultdEXT_record;
+this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&RecordTableDecorator::m_glBinormal3dvEXT_record;
+this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&RecordTableDecorator::m_glImportSyncEXT_record;
+this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&RecordTableDecorator::m_glGetMapiv_record;
+this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&RecordTableDecorator::m_glImportSemaphoreFdEXT_record;
+this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&RecordTableDecorator::m_glMultiTexCoord4sv_record;
+this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&RecordTableDecorator::m_glPNTrianglesiATI_record;
+this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&RecordTableDecorator::m_glBindVertexArrayAPPLE_record;
+this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&RecordTableDecorator::m_glObjectPtrLabel_record;
+this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&RecordTableDecorator::m_glGetDebugMessageLog_record;
+this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&RecordTableDecorator::m_glTrackMatrixNV_record;
+this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&RecordTableDecorator::m_glProgramPathFragmentInputGenNV_record;
+this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&RecordTableDecorator::m_glTangent3ivEXT_record;
+this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&RecordTableDecorator::m_glGetUniformfv_record;
+this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&RecordTableDecorator::m_glSecondaryColor3ubv_record;
+this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&RecordTableDecorator::m_glMakeTextureHandleNonResidentNV_record;
+this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&RecordTableDecorator::m_glVertexAttribs4ubvNV_record;
+this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&RecordTableDecorator::m_glClipPlanexOES_record;
+this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&RecordTableDecorator::m_glMultiTexCoord3iv_record;
+this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&RecordTableDecorator::m_glGetnPolygonStippleARB_record;
+this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&RecordTableDecorator::m_glUniform2i64vNV_record;
+this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&RecordTableDecorator::m_glLightModelf_record;
+this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&RecordTableDecorator::m_glDeleteMemoryObjectsEXT_record;
+this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glMultiTexSubImage2DEXT_record;
+this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_record;
+this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&RecordTableDecorator::m_glTangent3dvEXT_record;
+this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&RecordTableDecorator::m_glLightModeli_record;
+this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&RecordTableDecorator::m_glVertexWeighthvNV_record;
+this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&RecordTableDecorator::m_glWindowPos3iv_record;
+this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&RecordTableDecorator::m_glMultiTexCoordP1uiv_record;
+this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&RecordTableDecorator::m_glTransformPathNV_record;
+this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&RecordTableDecorator::m_glProgramNamedParameter4dNV_record;
+this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirect_record;
+this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&RecordTableDecorator::m_glProgramUniform1dEXT_record;
+this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&RecordTableDecorator::m_glCallLists_record;
+this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&RecordTableDecorator::m_glNormal3hvNV_record;
+this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetCombinerOutputParameterfvNV_record;
+this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&RecordTableDecorator::m_glVertexAttrib4sARB_record;
+this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&RecordTableDecorator::m_glTexCoord3i_record;
+this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&RecordTableDecorator::m_glVertexAttribI3uiv_record;
+this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&RecordTableDecorator::m_glPushDebugGroup_record;
+this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&RecordTableDecorator::m_glTexCoord3f_record;
+this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&RecordTableDecorator::m_glTexCoord3d_record;
+this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&RecordTableDecorator::m_glTexCoord2xOES_record;
+this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&RecordTableDecorator::m_glGetStageIndexNV_record;
+this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&RecordTableDecorator::m_glProgramUniform4i64vNV_record;
+this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&RecordTableDecorator::m_glGetNamedBufferPointervEXT_record;
+this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&RecordTableDecorator::m_glTextureBarrierNV_record;
+this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&RecordTableDecorator::m_glColor4ubVertex3fvSUN_record;
+this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&RecordTableDecorator::m_glGetCommandHeaderNV_record;
+this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorCounterInfoAMD_record;
+this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&RecordTableDecorator::m_glVertexAttrib1svARB_record;
+this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&RecordTableDecorator::m_glCombinerParameteriNV_record;
+this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&RecordTableDecorator::m_glMatrixMultTransposefEXT_record;
+this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&RecordTableDecorator::m_glDetailTexFuncSGIS_record;
+this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&RecordTableDecorator::m_glAreTexturesResident_record;
+this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&RecordTableDecorator::m_glProgramUniform2d_record;
+this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetConvolutionParameterfvEXT_record;
+this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&RecordTableDecorator::m_glIndexPointerListIBM_record;
+this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&RecordTableDecorator::m_glVertexAttribI4iEXT_record;
+this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&RecordTableDecorator::m_glProgramUniform2f_record;
+this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&RecordTableDecorator::m_glRasterPos4sv_record;
+this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&RecordTableDecorator::m_glColor4s_record;
+this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&RecordTableDecorator::m_glMulticastGetQueryObjectivNV_record;
+this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&RecordTableDecorator::m_glColorFragmentOp3ATI_record;
+this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&RecordTableDecorator::m_glResizeBuffersMESA_record;
+this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&RecordTableDecorator::m_glGetMinmaxParameterfv_record;
+this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&RecordTableDecorator::m_glClientActiveTextureARB_record;
+this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&RecordTableDecorator::m_glBindVertexArray_record;
+this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&RecordTableDecorator::m_glColor4b_record;
+this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&RecordTableDecorator::m_glColor4f_record;
+this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&RecordTableDecorator::m_glColor4d_record;
+this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&RecordTableDecorator::m_glColor4i_record;
+this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&RecordTableDecorator::m_glEdgeFlagFormatNV_record;
+this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&RecordTableDecorator::m_glNamedBufferSubData_record;
+this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&RecordTableDecorator::m_glDrawElementsInstanced_record;
+this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexParameterIivEXT_record;
+this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&RecordTableDecorator::m_glVertex2dv_record;
+this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&RecordTableDecorator::m_glDisableVertexArrayAttribEXT_record;
+this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&RecordTableDecorator::m_glObjectUnpurgeableAPPLE_record;
+this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&RecordTableDecorator::m_glVertexAttribs2dvNV_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_record;
+this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetMapParameterfvNV_record;
+this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&RecordTableDecorator::m_glProgramUniform4ivEXT_record;
+this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&RecordTableDecorator::m_glProgramUniform3ui64vNV_record;
+this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&RecordTableDecorator::m_glRectfv_record;
+this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&RecordTableDecorator::m_glTexFilterFuncSGIS_record;
+this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&RecordTableDecorator::m_glSpriteParameterfvSGIX_record;
+this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyMultiTexImage1DEXT_record;
+this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&RecordTableDecorator::m_glGetVertexAttribIuivEXT_record;
+this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&RecordTableDecorator::m_glUniformMatrix2x4dv_record;
+this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&RecordTableDecorator::m_glGetProgramResourceLocationIndex_record;
+this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&RecordTableDecorator::m_glColor3hNV_record;
+this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&RecordTableDecorator::m_glViewport_record;
+this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&RecordTableDecorator::m_glProgramNamedParameter4fNV_record;
+this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&RecordTableDecorator::m_glGetInvariantBooleanvEXT_record;
+this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&RecordTableDecorator::m_glTexStorage2DMultisample_record;
+this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&RecordTableDecorator::m_glPixelStorex_record;
+this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&RecordTableDecorator::m_glVertexAttribL1dvEXT_record;
+this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&RecordTableDecorator::m_glGetActiveSubroutineUniformiv_record;
+this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&RecordTableDecorator::m_glVertexAttribPointerARB_record;
+this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&RecordTableDecorator::m_glCompressedTexSubImage2DARB_record;
+this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&RecordTableDecorator::m_glTexStorageMem1DEXT_record;
+this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&RecordTableDecorator::m_glVertex2hvNV_record;
+this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&RecordTableDecorator::m_glTexBuffer_record;
+this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&RecordTableDecorator::m_glArrayElement_record;
+this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&RecordTableDecorator::m_glValidateProgram_record;
+this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&RecordTableDecorator::m_glPixelStoref_record;
+this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&RecordTableDecorator::m_glWindowPos3dARB_record;
+this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&RecordTableDecorator::m_glEvalCoord1dv_record;
+this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&RecordTableDecorator::m_glVertexAttribs2fvNV_record;
+this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&RecordTableDecorator::m_glRecti_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_record;
+this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&RecordTableDecorator::m_glTexCoord1bOES_record;
+this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&RecordTableDecorator::m_glProgramUniform2i64vARB_record;
+this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&RecordTableDecorator::m_glWindowPos2dARB_record;
+this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&RecordTableDecorator::m_glGetProgramParameterdvNV_record;
+this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&RecordTableDecorator::m_glRectf_record;
+this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&RecordTableDecorator::m_glRectd_record;
+this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&RecordTableDecorator::m_glMap1xOES_record;
+this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&RecordTableDecorator::m_glVertexAttrib3fvNV_record;
+this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&RecordTableDecorator::m_glReferencePlaneSGIX_record;
+this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&RecordTableDecorator::m_glMulticastBlitFramebufferNV_record;
+this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetCombinerInputParameterfvNV_record;
+this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&RecordTableDecorator::m_glGetTextureSamplerHandleARB_record;
+this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&RecordTableDecorator::m_glBindTexture_record;
+this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&RecordTableDecorator::m_glRects_record;
+this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&RecordTableDecorator::m_glGetActiveAttribARB_record;
+this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&RecordTableDecorator::m_glHistogramEXT_record;
+this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&RecordTableDecorator::m_glGetTextureSamplerHandleNV_record;
+this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&RecordTableDecorator::m_glDetachShader_record;
+this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&RecordTableDecorator::m_glFinishTextureSUNX_record;
+this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&RecordTableDecorator::m_glUniformMatrix3x4dv_record;
+this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&RecordTableDecorator::m_glVertexAttrib4fARB_record;
+this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&RecordTableDecorator::m_glGetPathColorGenivNV_record;
+this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&RecordTableDecorator::m_glGetProgramResourceLocation_record;
+this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&RecordTableDecorator::m_glVertexArrayAttribLFormat_record;
+this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&RecordTableDecorator::m_glGetTexLevelParameterfv_record;
+this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_record;
+this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&RecordTableDecorator::m_glIndexFormatNV_record;
+this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&RecordTableDecorator::m_glMultiTexCoord3i_record;
+this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiVertex3fvSUN_record;
+this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&RecordTableDecorator::m_glViewportIndexedfv_record;
+this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&RecordTableDecorator::m_glBindBuffersBase_record;
+this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&RecordTableDecorator::m_glTexBumpParameterfvATI_record;
+this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&RecordTableDecorator::m_glMatrixIndexuivARB_record;
+this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&RecordTableDecorator::m_glVertexAttrib1hNV_record;
+this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&RecordTableDecorator::m_glWindowPos3svMESA_record;
+this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&RecordTableDecorator::m_glStencilOpSeparateATI_record;
+this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&RecordTableDecorator::m_glDrawElementsBaseVertex_record;
+this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&RecordTableDecorator::m_glBlendEquationSeparateiARB_record;
+this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&RecordTableDecorator::m_glVertexAttrib1fNV_record;
+this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&RecordTableDecorator::m_glMapVertexAttrib2fAPPLE_record;
+this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glCompressedTextureSubImage1DEXT_record;
+this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&RecordTableDecorator::m_glClearBufferSubData_record;
+this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&RecordTableDecorator::m_glTexStorage1D_record;
+this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&RecordTableDecorator::m_glVertexAttribI3iEXT_record;
+this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&RecordTableDecorator::m_glMakeTextureHandleNonResidentARB_record;
+this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&RecordTableDecorator::m_glMultiDrawElementArrayAPPLE_record;
+this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&RecordTableDecorator::m_glVertexStream4dATI_record;
+this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2dvEXT_record;
+this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&RecordTableDecorator::m_glVertexAttribs2hvNV_record;
+this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&RecordTableDecorator::m_glGetUniformiv_record;
+this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&RecordTableDecorator::m_glClipPlanefOES_record;
+this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&RecordTableDecorator::m_glRenderbufferStorage_record;
+this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&RecordTableDecorator::m_glUniform4ui_record;
+this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&RecordTableDecorator::m_glBindFramebuffer_record;
+this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&RecordTableDecorator::m_glValidateProgramARB_record;
+this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&RecordTableDecorator::m_glTexGenf_record;
+this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&RecordTableDecorator::m_glTexGend_record;
+this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&RecordTableDecorator::m_glTexGeni_record;
+this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&RecordTableDecorator::m_glDeleteFramebuffersEXT_record;
+this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&RecordTableDecorator::m_glResetMinmaxEXT_record;
+this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&RecordTableDecorator::m_glVertexAttrib1fvNV_record;
+this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&RecordTableDecorator::m_glIsQueryARB_record;
+this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&RecordTableDecorator::m_glEnableVariantClientStateEXT_record;
+this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&RecordTableDecorator::m_glScissorIndexed_record;
+this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&RecordTableDecorator::m_glGetInvariantIntegervEXT_record;
+this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&RecordTableDecorator::m_glProgramLocalParameterI4uiNV_record;
+this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&RecordTableDecorator::m_glConvolutionParameterxvOES_record;
+this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&RecordTableDecorator::m_glGenFramebuffersEXT_record;
+this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayColorOffsetEXT_record;
+this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&RecordTableDecorator::m_glMultiTexCoord3ivARB_record;
+this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&RecordTableDecorator::m_glVertexWeightfEXT_record;
+this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&RecordTableDecorator::m_glRasterPos4dv_record;
+this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&RecordTableDecorator::m_glIsTextureHandleResidentARB_record;
+this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&RecordTableDecorator::m_glRasterPos2dv_record;
+this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&RecordTableDecorator::m_glWindowPos4ivMESA_record;
+this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&RecordTableDecorator::m_glGetVariantPointervEXT_record;
+this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&RecordTableDecorator::m_glMapNamedBufferRangeEXT_record;
+this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&RecordTableDecorator::m_glGetnUniformui64vARB_record;
+this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&RecordTableDecorator::m_glCreateShaderProgramv_record;
+this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&RecordTableDecorator::m_glGetQueryObjectiv_record;
+this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&RecordTableDecorator::m_glMaxShaderCompilerThreadsKHR_record;
+this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&RecordTableDecorator::m_glPNTrianglesfATI_record;
+this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactorusSUN_record;
+this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&RecordTableDecorator::m_glVertexAttrib3dvNV_record;
+this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&RecordTableDecorator::m_glMultiTexCoord3sARB_record;
+this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&RecordTableDecorator::m_glGenerateMipmap_record;
+this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&RecordTableDecorator::m_glCompressedTextureSubImage2D_record;
+this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_record;
+this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&RecordTableDecorator::m_glPolygonOffsetClampEXT_record;
+this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&RecordTableDecorator::m_glTextureRangeAPPLE_record;
+this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&RecordTableDecorator::m_glBlendEquationIndexedAMD_record;
+this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&RecordTableDecorator::m_glTexCoord2d_record;
+this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&RecordTableDecorator::m_glPointParameteri_record;
+this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&RecordTableDecorator::m_glTexCoord2f_record;
+this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&RecordTableDecorator::m_glGetUnsignedBytei_vEXT_record;
+this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&RecordTableDecorator::m_glColor4iv_record;
+this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&RecordTableDecorator::m_glMapNamedBufferRange_record;
+this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&RecordTableDecorator::m_glUnmapBuffer_record;
+this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&RecordTableDecorator::m_glSampleMaskEXT_record;
+this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&RecordTableDecorator::m_glTexCoord2i_record;
+this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&RecordTableDecorator::m_glTexCoord1xvOES_record;
+this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&RecordTableDecorator::m_glVertexAttrib1sARB_record;
+this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&RecordTableDecorator::m_glGetVertexArrayiv_record;
+this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&RecordTableDecorator::m_glProgramParameter4dvNV_record;
+this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&RecordTableDecorator::m_glTexCoord2s_record;
+this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glTextureParameterIuivEXT_record;
+this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&RecordTableDecorator::m_glGetColorTableParameterfvSGI_record;
+this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&RecordTableDecorator::m_glTexCoord4dv_record;
+this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&RecordTableDecorator::m_glVertexAttrib1svNV_record;
+this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&RecordTableDecorator::m_glNamedFramebufferTextureFaceEXT_record;
+this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&RecordTableDecorator::m_glProgramUniform2ui64vNV_record;
+this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&RecordTableDecorator::m_glStencilFillPathNV_record;
+this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&RecordTableDecorator::m_glNormal3dv_record;
+this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&RecordTableDecorator::m_glReleaseShaderCompiler_record;
+this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&RecordTableDecorator::m_glTexStorageMem3DEXT_record;
+this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&RecordTableDecorator::m_glTexCoord3bvOES_record;
+this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&RecordTableDecorator::m_glIsVertexAttribEnabledAPPLE_record;
+this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&RecordTableDecorator::m_glTexCoord1dv_record;
+this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&RecordTableDecorator::m_glReadPixels_record;
+this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&RecordTableDecorator::m_glVertexAttribI3iv_record;
+this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&RecordTableDecorator::m_glSetFenceAPPLE_record;
+this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&RecordTableDecorator::m_glWeightsvARB_record;
+this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&RecordTableDecorator::m_glShadeModel_record;
+this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTextureStorageMem3DMultisampleEXT_record;
+this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&RecordTableDecorator::m_glMapGrid1d_record;
+this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetHistogramParameterivEXT_record;
+this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&RecordTableDecorator::m_glConservativeRasterParameteriNV_record;
+this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&RecordTableDecorator::m_glClearNamedBufferData_record;
+this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&RecordTableDecorator::m_glClearDepthf_record;
+this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&RecordTableDecorator::m_glCreatePerfQueryINTEL_record;
+this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&RecordTableDecorator::m_glFogCoordfEXT_record;
+this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&RecordTableDecorator::m_glVertexAttrib2dARB_record;
+this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&RecordTableDecorator::m_glMultiTexCoord4dARB_record;
+this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&RecordTableDecorator::m_glReadnPixelsARB_record;
+this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&RecordTableDecorator::m_glMultiTexBufferEXT_record;
+this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&RecordTableDecorator::m_glWindowPos4dvMESA_record;
+this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&RecordTableDecorator::m_glInvalidateNamedFramebufferData_record;
+this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&RecordTableDecorator::m_glSecondaryColorPointerListIBM_record;
+this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&RecordTableDecorator::m_glRectiv_record;
+this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&RecordTableDecorator::m_glColorP4ui_record;
+this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&RecordTableDecorator::m_glUseProgramStages_record;
+this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&RecordTableDecorator::m_glRasterPos3dv_record;
+this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&RecordTableDecorator::m_glPathTexGenNV_record;
+this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&RecordTableDecorator::m_glVertexBlendEnviATI_record;
+this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&RecordTableDecorator::m_glUniform3i64ARB_record;
+this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&RecordTableDecorator::m_glLoadMatrixf_record;
+this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&RecordTableDecorator::m_glProgramUniform2dEXT_record;
+this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&RecordTableDecorator::m_glVertexAttribI4iv_record;
+this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&RecordTableDecorator::m_glNamedFramebufferDrawBuffer_record;
+this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&RecordTableDecorator::m_glColor4ubv_record;
+this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&RecordTableDecorator::m_glColor3hvNV_record;
+this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetMapAttribParameterfvNV_record;
+this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&RecordTableDecorator::m_glGetBufferSubData_record;
+this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&RecordTableDecorator::m_glGetVertexAttribLdv_record;
+this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&RecordTableDecorator::m_glGetnUniformuiv_record;
+this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&RecordTableDecorator::m_glGetUniformui64vNV_record;
+this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&RecordTableDecorator::m_glNamedRenderbufferStorageEXT_record;
+this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&RecordTableDecorator::m_glVertexAttrib3dNV_record;
+this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&RecordTableDecorator::m_glTextureStorage1DEXT_record;
+this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&RecordTableDecorator::m_glPixelTexGenParameteriSGIS_record;
+this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&RecordTableDecorator::m_glColorTableEXT_record;
+this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&RecordTableDecorator::m_glGenBuffers_record;
+this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&RecordTableDecorator::m_glMultiTexCoord3xvOES_record;
+this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&RecordTableDecorator::m_glExecuteProgramNV_record;
+this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&RecordTableDecorator::m_glVariantArrayObjectATI_record;
+this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&RecordTableDecorator::m_glColor3xvOES_record;
+this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&RecordTableDecorator::m_glGetnConvolutionFilterARB_record;
+this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&RecordTableDecorator::m_glNormalFormatNV_record;
+this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&RecordTableDecorator::m_glGetInvariantFloatvEXT_record;
+this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&RecordTableDecorator::m_glClearNamedFramebufferiv_record;
+this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&RecordTableDecorator::m_glTexImage3D_record;
+this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&RecordTableDecorator::m_glGenSamplers_record;
+this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&RecordTableDecorator::m_glIsFramebuffer_record;
+this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&RecordTableDecorator::m_glProgramUniform3dvEXT_record;
+this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&RecordTableDecorator::m_glGetVertexAttribfvNV_record;
+this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&RecordTableDecorator::m_glDrawRangeElementArrayAPPLE_record;
+this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&RecordTableDecorator::m_glUniform3i64NV_record;
+this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&RecordTableDecorator::m_glMatrixPopEXT_record;
+this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&RecordTableDecorator::m_glVertexStream1sATI_record;
+this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&RecordTableDecorator::m_glGetnPixelMapuivARB_record;
+this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&RecordTableDecorator::m_glMultiTexEnviEXT_record;
+this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&RecordTableDecorator::m_glVertexAttribI2iEXT_record;
+this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&RecordTableDecorator::m_glProgramParameter4fvNV_record;
+this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&RecordTableDecorator::m_glWaitSemaphoreEXT_record;
+this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&RecordTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_record;
+this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&RecordTableDecorator::m_glTexCoordP4uiv_record;
+this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&RecordTableDecorator::m_glRectxvOES_record;
+this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&RecordTableDecorator::m_glGetVariantIntegervEXT_record;
+this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&RecordTableDecorator::m_glDeleteLists_record;
+this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&RecordTableDecorator::m_glTexGendv_record;
+this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&RecordTableDecorator::m_glVertexP2uiv_record;
+this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorGroupsAMD_record;
+this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&RecordTableDecorator::m_glMultTransposeMatrixfARB_record;
+this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&RecordTableDecorator::m_glVertexAttribI2ivEXT_record;
+this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_record;
+this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&RecordTableDecorator::m_glDeleteStatesNV_record;
+this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&RecordTableDecorator::m_glGetBufferParameteri64v_record;
+this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&RecordTableDecorator::m_glProgramUniform4dv_record;
+this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&RecordTableDecorator::m_glEdgeFlagPointerEXT_record;
+this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&RecordTableDecorator::m_glVideoCaptureStreamParameterivNV_record;
+this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&RecordTableDecorator::m_glVertexStream4iATI_record;
+this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&RecordTableDecorator::m_glVDPAUFiniNV_record;
+this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&RecordTableDecorator::m_glMakeBufferNonResidentNV_record;
+this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&RecordTableDecorator::m_glUniform1ui64ARB_record;
+this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&RecordTableDecorator::m_glStencilStrokePathNV_record;
+this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&RecordTableDecorator::m_glVariantuivEXT_record;
+this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glCopyTexSubImage3DEXT_record;
+this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&RecordTableDecorator::m_glSpriteParameteriSGIX_record;
+this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&RecordTableDecorator::m_glMultiTexCoord1sARB_record;
+this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&RecordTableDecorator::m_glConvolutionParameterfv_record;
+this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&RecordTableDecorator::m_glMakeTextureHandleResidentNV_record;
+this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&RecordTableDecorator::m_glMultMatrixxOES_record;
+this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&RecordTableDecorator::m_glTextureNormalEXT_record;
+this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&RecordTableDecorator::m_glGetQueryivARB_record;
+this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexImage3DEXT_record;
+this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&RecordTableDecorator::m_glGetInstrumentsSGIX_record;
+this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x3fvEXT_record;
+this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&RecordTableDecorator::m_glPointParameterf_record;
+this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&RecordTableDecorator::m_glProgramUniform3dEXT_record;
+this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&RecordTableDecorator::m_glMultiTexCoord2hNV_record;
+this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&RecordTableDecorator::m_glGetConvolutionFilterEXT_record;
+this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&RecordTableDecorator::m_glVertexAttrib2hNV_record;
+this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&RecordTableDecorator::m_glCurrentPaletteMatrixARB_record;
+this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&RecordTableDecorator::m_glFogxvOES_record;
+this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&RecordTableDecorator::m_glCreateRenderbuffers_record;
+this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&RecordTableDecorator::m_glVertexAttrib4Nusv_record;
+this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&RecordTableDecorator::m_glCombinerInputNV_record;
+this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&RecordTableDecorator::m_glDepthFunc_record;
+this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&RecordTableDecorator::m_glWindowPos4fMESA_record;
+this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&RecordTableDecorator::m_glEnableClientStateIndexedEXT_record;
+this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&RecordTableDecorator::m_glTexCoord4iv_record;
+this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&RecordTableDecorator::m_glProgramUniform4i64ARB_record;
+this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&RecordTableDecorator::m_glBlendFunci_record;
+this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&RecordTableDecorator::m_glResolveDepthValuesNV_record;
+this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&RecordTableDecorator::m_glTextureColorMaskSGIS_record;
+this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&RecordTableDecorator::m_glCreateShaderProgramEXT_record;
+this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&RecordTableDecorator::m_glBufferStorage_record;
+this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&RecordTableDecorator::m_glMakeNamedBufferNonResidentNV_record;
+this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glRenderbufferStorageMultisampleEXT_record;
+this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&RecordTableDecorator::m_glGetFloati_v_record;
+this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&RecordTableDecorator::m_glUniform2ui64ARB_record;
+this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&RecordTableDecorator::m_glVertex3fv_record;
+this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&RecordTableDecorator::m_glGetUniformLocation_record;
+this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&RecordTableDecorator::m_glVertexStream1svATI_record;
+this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&RecordTableDecorator::m_glVertexStream3fATI_record;
+this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&RecordTableDecorator::m_glNamedFramebufferDrawBuffers_record;
+this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&RecordTableDecorator::m_glUniform2ui64vNV_record;
+this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&RecordTableDecorator::m_glTexCoordPointervINTEL_record;
+this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&RecordTableDecorator::m_glUniform4fv_record;
+this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&RecordTableDecorator::m_glNormalPointerEXT_record;
+this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&RecordTableDecorator::m_glVertexAttrib4hNV_record;
+this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&RecordTableDecorator::m_glNormal3f_record;
+this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&RecordTableDecorator::m_glVertexStream2iATI_record;
+this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&RecordTableDecorator::m_glVertexAttribP4uiv_record;
+this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&RecordTableDecorator::m_glCompressedTextureSubImage3D_record;
+this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&RecordTableDecorator::m_glAsyncMarkerSGIX_record;
+this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&RecordTableDecorator::m_glTextureStorageSparseAMD_record;
+this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetConvolutionParameterivEXT_record;
+this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&RecordTableDecorator::m_glEndPerfQueryINTEL_record;
+this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&RecordTableDecorator::m_glFragmentLightModeliSGIX_record;
+this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&RecordTableDecorator::m_glPrioritizeTexturesEXT_record;
+this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&RecordTableDecorator::m_glEndConditionalRender_record;
+this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&RecordTableDecorator::m_glEnableClientState_record;
+this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&RecordTableDecorator::m_glResetHistogram_record;
+this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&RecordTableDecorator::m_glGetOcclusionQueryivNV_record;
+this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&RecordTableDecorator::m_glUniform1uiEXT_record;
+this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&RecordTableDecorator::m_glMultiTexCoord2sv_record;
+this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glTexSubImage2DEXT_record;
+this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&RecordTableDecorator::m_glProgramUniform2uiv_record;
+this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&RecordTableDecorator::m_glMultiTexCoord2iARB_record;
+this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&RecordTableDecorator::m_glGetQueryObjectuiv_record;
+this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&RecordTableDecorator::m_glGenerateMultiTexMipmapEXT_record;
+this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&RecordTableDecorator::m_glVertexAttrib4iv_record;
+this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&RecordTableDecorator::m_glWindowPos3dvMESA_record;
+this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&RecordTableDecorator::m_glLabelObjectEXT_record;
+this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&RecordTableDecorator::m_glProgramUniform1uiv_record;
+this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&RecordTableDecorator::m_glFramebufferTexture_record;
+this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&RecordTableDecorator::m_glMultiTexEnvfEXT_record;
+this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&RecordTableDecorator::m_glGetTexGendv_record;
+this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&RecordTableDecorator::m_glVertex4xOES_record;
+this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&RecordTableDecorator::m_glVertexAttribI2uivEXT_record;
+this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameter4fvEXT_record;
+this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&RecordTableDecorator::m_glColor3usv_record;
+this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetPixelTransformParameterfvEXT_record;
+this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&RecordTableDecorator::m_glIndexxvOES_record;
+this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&RecordTableDecorator::m_glDepthMask_record;
+this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x4fv_record;
+this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&RecordTableDecorator::m_glAreProgramsResidentNV_record;
+this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&RecordTableDecorator::m_glColorTable_record;
+this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&RecordTableDecorator::m_glBeginQueryIndexed_record;
+this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&RecordTableDecorator::m_glVertexStream1dvATI_record;
+this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&RecordTableDecorator::m_glGetMultiTexEnvfvEXT_record;
+this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&RecordTableDecorator::m_glDeleteFencesNV_record;
+this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&RecordTableDecorator::m_glVertexAttribs1dvNV_record;
+this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&RecordTableDecorator::m_glBufferStorageExternalEXT_record;
+this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&RecordTableDecorator::m_glVertexStream2sATI_record;
+this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&RecordTableDecorator::m_glGetnSeparableFilterARB_record;
+this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&RecordTableDecorator::m_glProgramUniform2dv_record;
+this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&RecordTableDecorator::m_glActiveStencilFaceEXT_record;
+this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&RecordTableDecorator::m_glProgramUniform4dEXT_record;
+this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&RecordTableDecorator::m_glPointSizexOES_record;
+this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&RecordTableDecorator::m_glRasterPos2sv_record;
+this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&RecordTableDecorator::m_glBindParameterEXT_record;
+this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&RecordTableDecorator::m_glTexCoord1sv_record;
+this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&RecordTableDecorator::m_glBlendParameteriNV_record;
+this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameter4dvEXT_record;
+this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&RecordTableDecorator::m_glProgramUniformHandleui64NV_record;
+this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetTextureParameterfvEXT_record;
+this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&RecordTableDecorator::m_glGetPathMetricsNV_record;
+this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&RecordTableDecorator::m_glVertex2i_record;
+this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&RecordTableDecorator::m_glNewList_record;
+this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&RecordTableDecorator::m_glMatrixLoad3x3fNV_record;
+this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&RecordTableDecorator::m_glMultiTexCoord2fARB_record;
+this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&RecordTableDecorator::m_glWeightdvARB_record;
+this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glIsTransformFeedbackNV_record;
+this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&RecordTableDecorator::m_glVertexAttribDivisorARB_record;
+this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&RecordTableDecorator::m_glSecondaryColorP3uiv_record;
+this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&RecordTableDecorator::m_glGetnCompressedTexImageARB_record;
+this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&RecordTableDecorator::m_glGetIntegerv_record;
+this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&RecordTableDecorator::m_glMatrixLoaddEXT_record;
+this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&RecordTableDecorator::m_glGetPathLengthNV_record;
+this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3dv_record;
+this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&RecordTableDecorator::m_glUniform4i64NV_record;
+this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&RecordTableDecorator::m_glGetHistogramEXT_record;
+this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NuivARB_record;
+this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&RecordTableDecorator::m_glMapGrid2xOES_record;
+this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&RecordTableDecorator::m_glTexImage2D_record;
+this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&RecordTableDecorator::m_glWindowPos2fvARB_record;
+this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&RecordTableDecorator::m_glEnableIndexedEXT_record;
+this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&RecordTableDecorator::m_glTexCoord1bvOES_record;
+this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&RecordTableDecorator::m_glDrawPixels_record;
+this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&RecordTableDecorator::m_glMultMatrixd_record;
+this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&RecordTableDecorator::m_glMultMatrixf_record;
+this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&RecordTableDecorator::m_glReplacementCodePointerSUN_record;
+this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&RecordTableDecorator::m_glLoadTransposeMatrixdARB_record;
+this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&RecordTableDecorator::m_glVertexAttrib4Nubv_record;
+this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_record;
+this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&RecordTableDecorator::m_glCompileShaderARB_record;
+this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&RecordTableDecorator::m_glWindowPos3dMESA_record;
+this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&RecordTableDecorator::m_glNormalStream3fvATI_record;
+this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&RecordTableDecorator::m_glColor4usv_record;
+this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&RecordTableDecorator::m_glMapGrid1f_record;
+this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&RecordTableDecorator::m_glPolygonStipple_record;
+this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&RecordTableDecorator::m_glUniform4ui64ARB_record;
+this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&RecordTableDecorator::m_glTextureRenderbufferEXT_record;
+this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&RecordTableDecorator::m_glGetSubroutineUniformLocation_record;
+this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetFramebufferParameteriv_record;
+this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&RecordTableDecorator::m_glPixelMapusv_record;
+this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&RecordTableDecorator::m_glGetSamplerParameteriv_record;
+this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&RecordTableDecorator::m_glVertexStream2fvATI_record;
+this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&RecordTableDecorator::m_glProgramStringARB_record;
+this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3dvEXT_record;
+this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&RecordTableDecorator::m_glSeparableFilter2D_record;
+this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&RecordTableDecorator::m_glVertexAttribI1uiv_record;
+this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&RecordTableDecorator::m_glLGPUCopyImageSubDataNVX_record;
+this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&RecordTableDecorator::m_glTexStorage2D_record;
+this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&RecordTableDecorator::m_glColor3fv_record;
+this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&RecordTableDecorator::m_glGetMultiTexGendvEXT_record;
+this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&RecordTableDecorator::m_glVertexAttribL4dvEXT_record;
+this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&RecordTableDecorator::m_glGetActiveUniform_record;
+this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&RecordTableDecorator::m_glUniform2ui64vARB_record;
+this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&RecordTableDecorator::m_glMakeNamedBufferResidentNV_record;
+this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&RecordTableDecorator::m_glPathGlyphIndexRangeNV_record;
+this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&RecordTableDecorator::m_glColorPointer_record;
+this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&RecordTableDecorator::m_glProgramEnvParameterI4ivNV_record;
+this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&RecordTableDecorator::m_glMulticastGetQueryObjectui64vNV_record;
+this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&RecordTableDecorator::m_glMultiTexParameterfEXT_record;
+this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&RecordTableDecorator::m_glNamedFramebufferTextureLayer_record;
+this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&RecordTableDecorator::m_glGetVertexArrayIntegervEXT_record;
+this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&RecordTableDecorator::m_glVertexAttrib3dARB_record;
+this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&RecordTableDecorator::m_glVDPAUIsSurfaceNV_record;
+this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&RecordTableDecorator::m_glMultiTexImage1DEXT_record;
+this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&RecordTableDecorator::m_glIsAsyncMarkerSGIX_record;
+this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&RecordTableDecorator::m_glGetDoublei_vEXT_record;
+this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&RecordTableDecorator::m_glUniform2i64NV_record;
+this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&RecordTableDecorator::m_glIsCommandListNV_record;
+this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&RecordTableDecorator::m_glUniform3uiEXT_record;
+this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glTexParameterIuivEXT_record;
+this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4fv_record;
+this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&RecordTableDecorator::m_glVertex2fv_record;
+this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&RecordTableDecorator::m_glVertexAttribL3dEXT_record;
+this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&RecordTableDecorator::m_glFramebufferRenderbuffer_record;
+this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&RecordTableDecorator::m_glGetUniformLocationARB_record;
+this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&RecordTableDecorator::m_glPathParameterfvNV_record;
+this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&RecordTableDecorator::m_glVertexAttrib3sNV_record;
+this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&RecordTableDecorator::m_glGetDoublei_v_record;
+this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&RecordTableDecorator::m_glVertexAttrib1sv_record;
+this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&RecordTableDecorator::m_glBindSampler_record;
+this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&RecordTableDecorator::m_glLineWidth_record;
+this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&RecordTableDecorator::m_glVertexArrayRangeAPPLE_record;
+this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&RecordTableDecorator::m_glBindBufferOffsetEXT_record;
+this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&RecordTableDecorator::m_glWeightfvARB_record;
+this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&RecordTableDecorator::m_glGetIntegeri_v_record;
+this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&RecordTableDecorator::m_glGetTransformFeedbackVarying_record;
+this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&RecordTableDecorator::m_glProgramLocalParameter4fvARB_record;
+this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&RecordTableDecorator::m_glGetTransformFeedbackVaryingNV_record;
+this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&RecordTableDecorator::m_glWindowPos2iv_record;
+this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&RecordTableDecorator::m_glVertexStream1dATI_record;
+this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&RecordTableDecorator::m_glColorFragmentOp2ATI_record;
+this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&RecordTableDecorator::m_glFogiv_record;
+this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&RecordTableDecorator::m_glGetTextureHandleNV_record;
+this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&RecordTableDecorator::m_glLightModeliv_record;
+this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&RecordTableDecorator::m_glDepthRangef_record;
+this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&RecordTableDecorator::m_glGetFragmentMaterialivSGIX_record;
+this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&RecordTableDecorator::m_glVideoCaptureStreamParameterfvNV_record;
+this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&RecordTableDecorator::m_glDeleteProgramsARB_record;
+this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&RecordTableDecorator::m_glWindowPos3fvARB_record;
+this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&RecordTableDecorator::m_glFeedbackBufferxOES_record;
+this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&RecordTableDecorator::m_glGetTexBumpParameterfvATI_record;
+this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&RecordTableDecorator::m_glEnablei_record;
+this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&RecordTableDecorator::m_glGetActiveSubroutineName_record;
+this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&RecordTableDecorator::m_glDrawBuffersARB_record;
+this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&RecordTableDecorator::m_glBindProgramARB_record;
+this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&RecordTableDecorator::m_glEvalCoord1fv_record;
+this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&RecordTableDecorator::m_glProgramUniform3ui64vARB_record;
+this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2dv_record;
+this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&RecordTableDecorator::m_glMultiTexCoord2hvNV_record;
+this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&RecordTableDecorator::m_glGetFloatIndexedvEXT_record;
+this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&RecordTableDecorator::m_glSampleCoverageARB_record;
+this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&RecordTableDecorator::m_glProgramUniform2ui64vARB_record;
+this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&RecordTableDecorator::m_glPixelDataRangeNV_record;
+this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&RecordTableDecorator::m_glVertexStream3svATI_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_record;
+this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&RecordTableDecorator::m_glTexCoord3hvNV_record;
+this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&RecordTableDecorator::m_glSampleMaski_record;
+this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&RecordTableDecorator::m_glIndexFuncEXT_record;
+this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&RecordTableDecorator::m_glPointParameteriNV_record;
+this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&RecordTableDecorator::m_glUniformMatrix3x2fv_record;
+this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetFramebufferParameterivEXT_record;
+this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&RecordTableDecorator::m_glUniform2i64ARB_record;
+this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&RecordTableDecorator::m_glNamedBufferStorageEXT_record;
+this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&RecordTableDecorator::m_glNamedFramebufferTexture3DEXT_record;
+this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&RecordTableDecorator::m_glVertexAttrib2dv_record;
+this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&RecordTableDecorator::m_glGetVertexArrayPointervEXT_record;
+this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&RecordTableDecorator::m_glGetVertexAttribArrayObjectivATI_record;
+this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3fvEXT_record;
+this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&RecordTableDecorator::m_glEnableVertexArrayEXT_record;
+this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&RecordTableDecorator::m_glColorTableParameterfvSGI_record;
+this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&RecordTableDecorator::m_glEdgeFlag_record;
+this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&RecordTableDecorator::m_glFogCoordf_record;
+this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&RecordTableDecorator::m_glVertex3d_record;
+this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&RecordTableDecorator::m_glVertex3f_record;
+this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&RecordTableDecorator::m_glSpriteParameterivSGIX_record;
+this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&RecordTableDecorator::m_glPathGlyphRangeNV_record;
+this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&RecordTableDecorator::m_glPrimitiveBoundingBoxARB_record;
+this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&RecordTableDecorator::m_glVertexAttribL3ui64vNV_record;
+this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&RecordTableDecorator::m_glVertex3s_record;
+this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&RecordTableDecorator::m_glTexCoordP2ui_record;
+this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&RecordTableDecorator::m_glProgramUniform2fvEXT_record;
+this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&RecordTableDecorator::m_glDeletePathsNV_record;
+this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&RecordTableDecorator::m_glPrimitiveRestartIndexNV_record;
+this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_record;
+this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&RecordTableDecorator::m_glTexCoordPointerListIBM_record;
+this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&RecordTableDecorator::m_glRectxOES_record;
+this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&RecordTableDecorator::m_glCopyNamedBufferSubData_record;
+this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&RecordTableDecorator::m_glGenProgramsNV_record;
+this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&RecordTableDecorator::m_glFragmentLightfSGIX_record;
+this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&RecordTableDecorator::m_glTexStorage3D_record;
+this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&RecordTableDecorator::m_glTextureParameteriv_record;
+this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&RecordTableDecorator::m_glNamedBufferDataEXT_record;
+this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&RecordTableDecorator::m_glImportSemaphoreWin32NameEXT_record;
+this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&RecordTableDecorator::m_glMultiTexCoord3fvARB_record;
+this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&RecordTableDecorator::m_glUniformMatrix3x4fv_record;
+this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&RecordTableDecorator::m_glSubpixelPrecisionBiasNV_record;
+this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&RecordTableDecorator::m_glNormalPointer_record;
+this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&RecordTableDecorator::m_glNamedFramebufferTexture_record;
+this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NsvARB_record;
+this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&RecordTableDecorator::m_glPassThrough_record;
+this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&RecordTableDecorator::m_glSecondaryColorP3ui_record;
+this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&RecordTableDecorator::m_glInvalidateTexSubImage_record;
+this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&RecordTableDecorator::m_glIsImageHandleResidentARB_record;
+this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&RecordTableDecorator::m_glTangent3fvEXT_record;
+this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x3fv_record;
+this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&RecordTableDecorator::m_glBegin_record;
+this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&RecordTableDecorator::m_glEvalCoord2dv_record;
+this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&RecordTableDecorator::m_glColor3ubv_record;
+this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&RecordTableDecorator::m_glFogCoordfvEXT_record;
+this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&RecordTableDecorator::m_glVertexP3ui_record;
+this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&RecordTableDecorator::m_glLightfv_record;
+this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&RecordTableDecorator::m_glVertexAttribL3i64NV_record;
+this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&RecordTableDecorator::m_glStencilClearTagEXT_record;
+this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&RecordTableDecorator::m_glGetActiveUniformName_record;
+this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&RecordTableDecorator::m_glTangentPointerEXT_record;
+this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&RecordTableDecorator::m_glUniform4ui64vNV_record;
+this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&RecordTableDecorator::m_glDebugMessageEnableAMD_record;
+this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&RecordTableDecorator::m_glProgramUniform2ui_record;
+this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyTexSubImage2DEXT_record;
+this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&RecordTableDecorator::m_glGenRenderbuffersEXT_record;
+this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_record;
+this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&RecordTableDecorator::m_glMultiTexCoord2f_record;
+this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&RecordTableDecorator::m_glMapGrid2d_record;
+this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexParameterIuivEXT_record;
+this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&RecordTableDecorator::m_glBlendEquationiARB_record;
+this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&RecordTableDecorator::m_glTexParameteriv_record;
+this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&RecordTableDecorator::m_glUniform4ivARB_record;
+this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&RecordTableDecorator::m_glMatrixOrthoEXT_record;
+this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&RecordTableDecorator::m_glVertexArrayVertexBuffer_record;
+this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&RecordTableDecorator::m_glProgramLocalParametersI4ivNV_record;
+this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&RecordTableDecorator::m_glProgramUniform4ui64vNV_record;
+this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&RecordTableDecorator::m_glGetNamedStringivARB_record;
+this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&RecordTableDecorator::m_glVertexAttribL1i64vNV_record;
+this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&RecordTableDecorator::m_glTransformFeedbackBufferBase_record;
+this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&RecordTableDecorator::m_glIndexsv_record;
+this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&RecordTableDecorator::m_glPointParameterivNV_record;
+this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&RecordTableDecorator::m_glGetDetailTexFuncSGIS_record;
+this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_record;
+this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&RecordTableDecorator::m_glProgramLocalParameter4fARB_record;
+this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&RecordTableDecorator::m_glBitmap_record;
+this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&RecordTableDecorator::m_glNamedFramebufferTextureLayerEXT_record;
+this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&RecordTableDecorator::m_glMultiTexGenfvEXT_record;
+this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&RecordTableDecorator::m_glGetNamedBufferSubData_record;
+this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&RecordTableDecorator::m_glStencilFuncSeparateATI_record;
+this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&RecordTableDecorator::m_glProgramUniform2iv_record;
+this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&RecordTableDecorator::m_glGetQueryiv_record;
+this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&RecordTableDecorator::m_glTexCoord4f_record;
+this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&RecordTableDecorator::m_glMapGrid2f_record;
+this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&RecordTableDecorator::m_glListParameterivSGIX_record;
+this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&RecordTableDecorator::m_glCreateQueries_record;
+this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&RecordTableDecorator::m_glGetSamplerParameterfv_record;
+this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&RecordTableDecorator::m_glTexCoord4i_record;
+this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&RecordTableDecorator::m_glObjectLabel_record;
+this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&RecordTableDecorator::m_glProgramUniform3i64NV_record;
+this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&RecordTableDecorator::m_glGetTextureHandleARB_record;
+this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&RecordTableDecorator::m_glTexCoord4s_record;
+this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&RecordTableDecorator::m_glUniform4iARB_record;
+this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&RecordTableDecorator::m_glGetUniformIndices_record;
+this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&RecordTableDecorator::m_glMultiTexImage3DEXT_record;
+this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&RecordTableDecorator::m_glCoverageModulationTableNV_record;
+this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&RecordTableDecorator::m_glPointParameteriv_record;
+this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&RecordTableDecorator::m_glMultiTexCoord4svARB_record;
+this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&RecordTableDecorator::m_glNormal3fv_record;
+this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x4dvEXT_record;
+this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&RecordTableDecorator::m_glTexCoord1fv_record;
+this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x3dvEXT_record;
+this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&RecordTableDecorator::m_glGetActiveVaryingNV_record;
+this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&RecordTableDecorator::m_glUniform1i64vARB_record;
+this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&RecordTableDecorator::m_glMultiTexCoord1dv_record;
+this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&RecordTableDecorator::m_glTexCoord3fv_record;
+this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&RecordTableDecorator::m_glMatrixTranslatefEXT_record;
+this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&RecordTableDecorator::m_glProgramUniform1ui64vNV_record;
+this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&RecordTableDecorator::m_glTextureMaterialEXT_record;
+this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&RecordTableDecorator::m_glMultiTexCoordP3uiv_record;
+this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&RecordTableDecorator::m_glVertexAttribP3ui_record;
+this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&RecordTableDecorator::m_glInterpolatePathsNV_record;
+this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&RecordTableDecorator::m_glTextureBufferRange_record;
+this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&RecordTableDecorator::m_glVertexAttribL2dEXT_record;
+this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetPixelTransformParameterivEXT_record;
+this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&RecordTableDecorator::m_glTexCoord4xvOES_record;
+this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&RecordTableDecorator::m_glGetVariantBooleanvEXT_record;
+this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&RecordTableDecorator::m_glDepthRange_record;
+this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&RecordTableDecorator::m_glGetVertexAttribdvARB_record;
+this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&RecordTableDecorator::m_glGetColorTableParameterfv_record;
+this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&RecordTableDecorator::m_glDrawArraysInstancedEXT_record;
+this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&RecordTableDecorator::m_glDisableClientStateIndexedEXT_record;
+this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&RecordTableDecorator::m_glDrawBuffer_record;
+this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_record;
+this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&RecordTableDecorator::m_glGetnPixelMapusv_record;
+this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&RecordTableDecorator::m_glRasterPos3fv_record;
+this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&RecordTableDecorator::m_glClearBufferuiv_record;
+this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&RecordTableDecorator::m_glGetInternalformati64v_record;
+this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&RecordTableDecorator::m_glShaderSourceARB_record;
+this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&RecordTableDecorator::m_glShaderOp3EXT_record;
+this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&RecordTableDecorator::m_glWindowPos2dvMESA_record;
+this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&RecordTableDecorator::m_glClearIndex_record;
+this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&RecordTableDecorator::m_glProvokingVertexEXT_record;
+this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&RecordTableDecorator::m_glVariantubvEXT_record;
+this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&RecordTableDecorator::m_glFlush_record;
+this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&RecordTableDecorator::m_glFramebufferTexture2DEXT_record;
+this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetColorTableParameterivEXT_record;
+this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&RecordTableDecorator::m_glPresentFrameDualFillNV_record;
+this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&RecordTableDecorator::m_glGenVertexShadersEXT_record;
+this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&RecordTableDecorator::m_glSpecializeShaderARB_record;
+this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&RecordTableDecorator::m_glProgramUniformHandleui64vARB_record;
+this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&RecordTableDecorator::m_glDepthRangefOES_record;
+this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&RecordTableDecorator::m_glDeleteVertexArrays_record;
+this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&RecordTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_record;
+this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&RecordTableDecorator::m_glGetTexLevelParameteriv_record;
+this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&RecordTableDecorator::m_glDrawVkImageNV_record;
+this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&RecordTableDecorator::m_glWindowPos3iARB_record;
+this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&RecordTableDecorator::m_glPrioritizeTextures_record;
+this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&RecordTableDecorator::m_glWindowPos3fvMESA_record;
+this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x2dvEXT_record;
+this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&RecordTableDecorator::m_glVertex4xvOES_record;
+this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&RecordTableDecorator::m_glTexStorage3DMultisample_record;
+this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&RecordTableDecorator::m_glWindowPos2sARB_record;
+this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&RecordTableDecorator::m_glStencilOpValueAMD_record;
+this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&RecordTableDecorator::m_glProgramVertexLimitNV_record;
+this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&RecordTableDecorator::m_glGetTexParameterPointervAPPLE_record;
+this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&RecordTableDecorator::m_glProgramUniform3uivEXT_record;
+this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&RecordTableDecorator::m_glClampColor_record;
+this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&RecordTableDecorator::m_glClearStencil_record;
+this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&RecordTableDecorator::m_glTexCoordP1uiv_record;
+this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&RecordTableDecorator::m_glVertexAttribs3svNV_record;
+this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&RecordTableDecorator::m_glMultiTexCoord3fv_record;
+this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&RecordTableDecorator::m_glVertexBlendEnvfATI_record;
+this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&RecordTableDecorator::m_glIsFenceAPPLE_record;
+this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&RecordTableDecorator::m_glGetBufferParameterui64vNV_record;
+this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4bvEXT_record;
+this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&RecordTableDecorator::m_glUniform2fARB_record;
+this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&RecordTableDecorator::m_glStopInstrumentsSGIX_record;
+this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&RecordTableDecorator::m_glVertexAttrib3fNV_record;
+this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&RecordTableDecorator::m_glMapVertexAttrib2dAPPLE_record;
+this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&RecordTableDecorator::m_glVertex2f_record;
+this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyTextureImage2DEXT_record;
+this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&RecordTableDecorator::m_glVertex2d_record;
+this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3bvEXT_record;
+this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&RecordTableDecorator::m_glMultiTexCoord4fARB_record;
+this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&RecordTableDecorator::m_glPolygonOffset_record;
+this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&RecordTableDecorator::m_glTangent3bvEXT_record;
+this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&RecordTableDecorator::m_glHistogram_record;
+this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&RecordTableDecorator::m_glGetProgramiv_record;
+this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&RecordTableDecorator::m_glMatrixIndexubvARB_record;
+this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&RecordTableDecorator::m_glVertex2s_record;
+this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&RecordTableDecorator::m_glGetVertexAttribLui64vNV_record;
+this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&RecordTableDecorator::m_glGetProgramStringARB_record;
+this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&RecordTableDecorator::m_glFlushMappedBufferRange_record;
+this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&RecordTableDecorator::m_glVertexAttribI3uiEXT_record;
+this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&RecordTableDecorator::m_glLineWidthxOES_record;
+this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2fvEXT_record;
+this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glGetTextureParameterIuivEXT_record;
+this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexEnvivEXT_record;
+this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&RecordTableDecorator::m_glPixelTexGenParameterivSGIS_record;
+this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&RecordTableDecorator::m_glGenQueries_record;
+this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&RecordTableDecorator::m_glGetPixelMapfv_record;
+this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&RecordTableDecorator::m_glBlendColorEXT_record;
+this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&RecordTableDecorator::m_glResetMinmax_record;
+this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&RecordTableDecorator::m_glGetnUniformivARB_record;
+this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&RecordTableDecorator::m_glVertexBlendARB_record;
+this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&RecordTableDecorator::m_glVertexAttrib4d_record;
+this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&RecordTableDecorator::m_glGetVaryingLocationNV_record;
+this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetMapAttribParameterivNV_record;
+this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&RecordTableDecorator::m_glTexSubImage3D_record;
+this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&RecordTableDecorator::m_glDeleteSamplers_record;
+this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&RecordTableDecorator::m_glGetLightxOES_record;
+this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&RecordTableDecorator::m_glGetVertexAttribArrayObjectfvATI_record;
+this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayNormalOffsetEXT_record;
+this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&RecordTableDecorator::m_glGetBufferParameterivARB_record;
+this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&RecordTableDecorator::m_glGetTextureParameterfv_record;
+this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&RecordTableDecorator::m_glDrawMeshArraysSUN_record;
+this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&RecordTableDecorator::m_glVertexAttrib4dNV_record;
+this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&RecordTableDecorator::m_glGetMultisamplefvNV_record;
+this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glMapObjectBufferATI_record;
+this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&RecordTableDecorator::m_glGetPathCommandsNV_record;
+this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayTexCoordOffsetEXT_record;
+this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&RecordTableDecorator::m_glGetHistogram_record;
+this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&RecordTableDecorator::m_glMatrixMode_record;
+this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&RecordTableDecorator::m_glColorFormatNV_record;
+this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&RecordTableDecorator::m_glProgramUniformui64NV_record;
+this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x2fvEXT_record;
+this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&RecordTableDecorator::m_glLoadMatrixxOES_record;
+this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetColorTableParameterfvEXT_record;
+this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&RecordTableDecorator::m_glRasterPos4i_record;
+this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&RecordTableDecorator::m_glVertexAttribL2i64NV_record;
+this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&RecordTableDecorator::m_glBindTextures_record;
+this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&RecordTableDecorator::m_glMatrixRotatefEXT_record;
+this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&RecordTableDecorator::m_glGetClipPlanexOES_record;
+this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3uivEXT_record;
+this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&RecordTableDecorator::m_glGetPerfQueryInfoINTEL_record;
+this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&RecordTableDecorator::m_glGetDoublev_record;
+this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&RecordTableDecorator::m_glBindBufferRangeEXT_record;
+this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&RecordTableDecorator::m_glCompressedTexImage2D_record;
+this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&RecordTableDecorator::m_glMapBufferARB_record;
+this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&RecordTableDecorator::m_glGetPathSpacingNV_record;
+this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&RecordTableDecorator::m_glUniform4dv_record;
+this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactordSUN_record;
+this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&RecordTableDecorator::m_glProgramUniform3dv_record;
+this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&RecordTableDecorator::m_glGetShaderSourceARB_record;
+this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&RecordTableDecorator::m_glVertexAttrib3dvARB_record;
+this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&RecordTableDecorator::m_glInvalidateBufferData_record;
+this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&RecordTableDecorator::m_glMatrixLoad3x2fNV_record;
+this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&RecordTableDecorator::m_glCompressedTextureSubImage1D_record;
+this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&RecordTableDecorator::m_glTexCoord3xvOES_record;
+this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&RecordTableDecorator::m_glGenTexturesEXT_record;
+this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&RecordTableDecorator::m_glTangent3iEXT_record;
+this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&RecordTableDecorator::m_glClearTexImage_record;
+this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&RecordTableDecorator::m_glBinormal3bvEXT_record;
+this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&RecordTableDecorator::m_glUniform3fv_record;
+this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&RecordTableDecorator::m_glGetnPixelMapusvARB_record;
+this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&RecordTableDecorator::m_glMemoryObjectParameterivEXT_record;
+this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&RecordTableDecorator::m_glGenSemaphoresEXT_record;
+this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&RecordTableDecorator::m_glMultiTexCoordP1ui_record;
+this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&RecordTableDecorator::m_glClearNamedBufferDataEXT_record;
+this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&RecordTableDecorator::m_glUniformMatrix4dv_record;
+this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&RecordTableDecorator::m_glWindowPos3fMESA_record;
+this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&RecordTableDecorator::m_glDeleteRenderbuffers_record;
+this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetTextureLevelParameterfvEXT_record;
+this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&RecordTableDecorator::m_glGetHistogramParameterxvOES_record;
+this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&RecordTableDecorator::m_glMultiDrawElements_record;
+this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&RecordTableDecorator::m_glMakeImageHandleNonResidentNV_record;
+this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glTexSubImage1DEXT_record;
+this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&RecordTableDecorator::m_glNormalStream3dATI_record;
+this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&RecordTableDecorator::m_glVertexAttribL4i64vNV_record;
+this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&RecordTableDecorator::m_glDrawBuffers_record;
+this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyTextureSubImage1DEXT_record;
+this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&RecordTableDecorator::m_glWindowRectanglesEXT_record;
+this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&RecordTableDecorator::m_glNamedFramebufferReadBuffer_record;
+this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&RecordTableDecorator::m_glUniform2i64vARB_record;
+this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&RecordTableDecorator::m_glVertexAttribI1uivEXT_record;
+this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&RecordTableDecorator::m_glGetTexGenfv_record;
+this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&RecordTableDecorator::m_glBeginQueryARB_record;
+this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&RecordTableDecorator::m_glUniform1iARB_record;
+this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&RecordTableDecorator::m_glVertex4bvOES_record;
+this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&RecordTableDecorator::m_glInvalidateSubFramebuffer_record;
+this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&RecordTableDecorator::m_glUniform1fvARB_record;
+this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&RecordTableDecorator::m_glTestFenceNV_record;
+this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glBindTransformFeedback_record;
+this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&RecordTableDecorator::m_glMultiTexCoord2iv_record;
+this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyMultiTexSubImage1DEXT_record;
+this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&RecordTableDecorator::m_glVariantbvEXT_record;
+this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&RecordTableDecorator::m_glTexCoord1hNV_record;
+this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&RecordTableDecorator::m_glGenFencesNV_record;
+this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&RecordTableDecorator::m_glRasterPos3iv_record;
+this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&RecordTableDecorator::m_glVertexAttribL2ui64NV_record;
+this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&RecordTableDecorator::m_glMultiTexCoord1hvNV_record;
+this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&RecordTableDecorator::m_glGetnConvolutionFilter_record;
+this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&RecordTableDecorator::m_glNormal3bv_record;
+this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&RecordTableDecorator::m_glWeightbvARB_record;
+this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&RecordTableDecorator::m_glTexCoord4sv_record;
+this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&RecordTableDecorator::m_glUniform2uiv_record;
+this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&RecordTableDecorator::m_glBeginConditionalRenderNVX_record;
+this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&RecordTableDecorator::m_glFinish_record;
+this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&RecordTableDecorator::m_glColorTableParameterfv_record;
+this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&RecordTableDecorator::m_glFragmentCoverageColorNV_record;
+this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&RecordTableDecorator::m_glProgramUniform3ivEXT_record;
+this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexOffsetEXT_record;
+this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&RecordTableDecorator::m_glViewportPositionWScaleNV_record;
+this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&RecordTableDecorator::m_glGetProgramLocalParameterIuivNV_record;
+this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_record;
+this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&RecordTableDecorator::m_glUniform1uiv_record;
+this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&RecordTableDecorator::m_glUniformMatrix2dv_record;
+this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&RecordTableDecorator::m_glIndexdv_record;
+this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3ivEXT_record;
+this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&RecordTableDecorator::m_glTexCoord3iv_record;
+this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&RecordTableDecorator::m_glVertexStream4fvATI_record;
+this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&RecordTableDecorator::m_glDeformationMap3fSGIX_record;
+this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&RecordTableDecorator::m_glClearDepth_record;
+this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&RecordTableDecorator::m_glGenAsyncMarkersSGIX_record;
+this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&RecordTableDecorator::m_glDisableIndexedEXT_record;
+this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&RecordTableDecorator::m_glVertexWeightfvEXT_record;
+this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&RecordTableDecorator::m_glGetProgramLocalParameterIivNV_record;
+this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&RecordTableDecorator::m_glCompressedTexImage3DARB_record;
+this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&RecordTableDecorator::m_glProgramParameter4fNV_record;
+this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&RecordTableDecorator::m_glConvolutionParameterxOES_record;
+this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&RecordTableDecorator::m_glInsertComponentEXT_record;
+this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&RecordTableDecorator::m_glCreateTextures_record;
+this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&RecordTableDecorator::m_glSecondaryColor3iv_record;
+this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&RecordTableDecorator::m_glCreateBuffers_record;
+this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&RecordTableDecorator::m_glMultiTexCoord2xvOES_record;
+this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&RecordTableDecorator::m_glTexGenxvOES_record;
+this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&RecordTableDecorator::m_glMultTransposeMatrixf_record;
+this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&RecordTableDecorator::m_glBeginTransformFeedbackEXT_record;
+this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_record;
+this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&RecordTableDecorator::m_glNormal3sv_record;
+this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glFreeObjectBufferATI_record;
+this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&RecordTableDecorator::m_glBlendBarrierNV_record;
+this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&RecordTableDecorator::m_glUniform4i64vNV_record;
+this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&RecordTableDecorator::m_glGetnUniformuivARB_record;
+this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&RecordTableDecorator::m_glAlphaFragmentOp3ATI_record;
+this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&RecordTableDecorator::m_glProgramEnvParameters4fvEXT_record;
+this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&RecordTableDecorator::m_glBlendFuncSeparateEXT_record;
+this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&RecordTableDecorator::m_glConvolutionParameterivEXT_record;
+this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&RecordTableDecorator::m_glPixelTexGenSGIX_record;
+this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&RecordTableDecorator::m_glDeleteProgram_record;
+this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&RecordTableDecorator::m_glUniformMatrix4x3dv_record;
+this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&RecordTableDecorator::m_glGetVideoCaptureStreamivNV_record;
+this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&RecordTableDecorator::m_glProgramUniform4uiEXT_record;
+this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&RecordTableDecorator::m_glMakeImageHandleNonResidentARB_record;
+this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&RecordTableDecorator::m_glSecondaryColor3dEXT_record;
+this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&RecordTableDecorator::m_glDeleteQueries_record;
+this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&RecordTableDecorator::m_glNormalP3uiv_record;
+this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&RecordTableDecorator::m_glRasterPos2d_record;
+this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&RecordTableDecorator::m_glInitNames_record;
+this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&RecordTableDecorator::m_glBinormal3fvEXT_record;
+this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&RecordTableDecorator::m_glColor3dv_record;
+this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_record;
+this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&RecordTableDecorator::m_glArrayElementEXT_record;
+this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&RecordTableDecorator::m_glProgramParameter4dNV_record;
+this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&RecordTableDecorator::m_glIndexxOES_record;
+this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&RecordTableDecorator::m_glUniform3uivEXT_record;
+this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&RecordTableDecorator::m_glPopGroupMarkerEXT_record;
+this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&RecordTableDecorator::m_glClearNamedFramebufferuiv_record;
+this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&RecordTableDecorator::m_glSetLocalConstantEXT_record;
+this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&RecordTableDecorator::m_glProgramUniform1ui64NV_record;
+this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&RecordTableDecorator::m_glColor4hvNV_record;
+this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&RecordTableDecorator::m_glGetVertexAttribfv_record;
+this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&RecordTableDecorator::m_glDispatchCompute_record;
+this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&RecordTableDecorator::m_glGetActiveAttrib_record;
+this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&RecordTableDecorator::m_glFragmentColorMaterialSGIX_record;
+this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&RecordTableDecorator::m_glTexSubImage2D_record;
+this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&RecordTableDecorator::m_glGetnMinmaxARB_record;
+this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&RecordTableDecorator::m_glLogicOp_record;
+this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x4fv_record;
+this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&RecordTableDecorator::m_glWindowPos4iMESA_record;
+this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&RecordTableDecorator::m_glPixelTransferf_record;
+this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&RecordTableDecorator::m_glGetTextureParameterIuiv_record;
+this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&RecordTableDecorator::m_glMultiTexCoord1xOES_record;
+this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4dv_record;
+this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&RecordTableDecorator::m_glGetnUniformiv_record;
+this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&RecordTableDecorator::m_glFramebufferTexture1DEXT_record;
+this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&RecordTableDecorator::m_glVertexPointervINTEL_record;
+this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&RecordTableDecorator::m_glTextureParameterIiv_record;
+this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&RecordTableDecorator::m_glGetSeparableFilterEXT_record;
+this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&RecordTableDecorator::m_glMultiTexCoord3iARB_record;
+this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&RecordTableDecorator::m_glRasterPos4xvOES_record;
+this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&RecordTableDecorator::m_glDrawTransformFeedbackStream_record;
+this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&RecordTableDecorator::m_glVertex3hvNV_record;
+this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_record;
+this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&RecordTableDecorator::m_glProvokingVertex_record;
+this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&RecordTableDecorator::m_glAccumxOES_record;
+this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&RecordTableDecorator::m_glShaderBinary_record;
+this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexGenivEXT_record;
+this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&RecordTableDecorator::m_glPointParameterxvOES_record;
+this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&RecordTableDecorator::m_glCreateStatesNV_record;
+this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&RecordTableDecorator::m_glClearDepthdNV_record;
+this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&RecordTableDecorator::m_glClearColorIuiEXT_record;
+this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&RecordTableDecorator::m_glBindMultiTextureEXT_record;
+this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&RecordTableDecorator::m_glTexGeniv_record;
+this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&RecordTableDecorator::m_glDrawElements_record;
+this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&RecordTableDecorator::m_glProgramUniform4iv_record;
+this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&RecordTableDecorator::m_glDisableVertexArrayEXT_record;
+this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&RecordTableDecorator::m_glProgramUniform3ui64NV_record;
+this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&RecordTableDecorator::m_glClientActiveTexture_record;
+this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glMultiTexParameterIivEXT_record;
+this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&RecordTableDecorator::m_glUniform1i64ARB_record;
+this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&RecordTableDecorator::m_glUniform1iv_record;
+this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&RecordTableDecorator::m_glMulticastBarrierNV_record;
+this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&RecordTableDecorator::m_glVertexAttribArrayObjectATI_record;
+this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&RecordTableDecorator::m_glUniform2iARB_record;
+this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&RecordTableDecorator::m_glDrawArraysInstanced_record;
+this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&RecordTableDecorator::m_glVertexAttrib2sNV_record;
+this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&RecordTableDecorator::m_glTexBufferEXT_record;
+this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&RecordTableDecorator::m_glVertexStream2fATI_record;
+this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&RecordTableDecorator::m_glDebugMessageCallbackAMD_record;
+this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&RecordTableDecorator::m_glSamplerParameteriv_record;
+this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&RecordTableDecorator::m_glVertexAttrib4uiv_record;
+this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&RecordTableDecorator::m_glEndQueryIndexed_record;
+this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&RecordTableDecorator::m_glNormalStream3sATI_record;
+this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&RecordTableDecorator::m_glProgramParameteriARB_record;
+this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&RecordTableDecorator::m_glTexEnvxOES_record;
+this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&RecordTableDecorator::m_glProgramUniform1iv_record;
+this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&RecordTableDecorator::m_glDisableVertexAttribAPPLE_record;
+this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&RecordTableDecorator::m_glBindRenderbuffer_record;
+this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&RecordTableDecorator::m_glMultiTexSubImage3DEXT_record;
+this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&RecordTableDecorator::m_glIsProgram_record;
+this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirectAMD_record;
+this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&RecordTableDecorator::m_glGetProgramInfoLog_record;
+this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&RecordTableDecorator::m_glGetLocalConstantBooleanvEXT_record;
+this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&RecordTableDecorator::m_glPixelTransformParameteriEXT_record;
+this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&RecordTableDecorator::m_glTexCoord4bOES_record;
+this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&RecordTableDecorator::m_glVertexAttrib4fv_record;
+this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x3dv_record;
+this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&RecordTableDecorator::m_glProgramEnvParametersI4uivNV_record;
+this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&RecordTableDecorator::m_glTexCoord3xOES_record;
+this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&RecordTableDecorator::m_glLoadTransposeMatrixfARB_record;
+this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&RecordTableDecorator::m_glImageTransformParameteriHP_record;
+this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&RecordTableDecorator::m_glMultiTexCoord4xOES_record;
+this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&RecordTableDecorator::m_glVertexAttribs3fvNV_record;
+this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&RecordTableDecorator::m_glVertexAttrib2fv_record;
+this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&RecordTableDecorator::m_glUniform3ui64NV_record;
+this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&RecordTableDecorator::m_glCombinerParameterfvNV_record;
+this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&RecordTableDecorator::m_glFragmentMaterialiSGIX_record;
+this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&RecordTableDecorator::m_glGetBooleani_v_record;
+this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&RecordTableDecorator::m_glGetProgramResourceIndex_record;
+this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&RecordTableDecorator::m_glBeginConditionalRenderNV_record;
+this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&RecordTableDecorator::m_glDisableClientState_record;
+this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&RecordTableDecorator::m_glPathFogGenNV_record;
+this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&RecordTableDecorator::m_glStencilThenCoverFillPathNV_record;
+this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayIndexOffsetEXT_record;
+this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&RecordTableDecorator::m_glProgramBufferParametersIuivNV_record;
+this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&RecordTableDecorator::m_glPixelTransformParameterivEXT_record;
+this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&RecordTableDecorator::m_glDisableClientStateiEXT_record;
+this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&RecordTableDecorator::m_glTexBufferARB_record;
+this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&RecordTableDecorator::m_glGetLocalConstantIntegervEXT_record;
+this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&RecordTableDecorator::m_glColor4uiv_record;
+this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&RecordTableDecorator::m_glProgramUniform3i_record;
+this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_record;
+this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&RecordTableDecorator::m_glGetBufferPointervARB_record;
+this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glMultiTexParameterIuivEXT_record;
+this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&RecordTableDecorator::m_glEvalMesh2_record;
+this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&RecordTableDecorator::m_glEvalMesh1_record;
+this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&RecordTableDecorator::m_glProgramUniform3f_record;
+this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glStencilThenCoverFillPathInstancedNV_record;
+this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&RecordTableDecorator::m_glProgramUniform3d_record;
+this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&RecordTableDecorator::m_glMapVertexAttrib1dAPPLE_record;
+this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&RecordTableDecorator::m_glEvalCoord2fv_record;
+this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&RecordTableDecorator::m_glGetUniformivARB_record;
+this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&RecordTableDecorator::m_glLoadTransposeMatrixd_record;
+this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&RecordTableDecorator::m_glLoadTransposeMatrixf_record;
+this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&RecordTableDecorator::m_glGetPointervEXT_record;
+this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&RecordTableDecorator::m_glSignalVkSemaphoreNV_record;
+this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&RecordTableDecorator::m_glEndConditionalRenderNV_record;
+this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_record;
+this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&RecordTableDecorator::m_glUniform3i64vARB_record;
+this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&RecordTableDecorator::m_glProgramUniform2uiEXT_record;
+this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&RecordTableDecorator::m_glVertexAttribI1ui_record;
+this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&RecordTableDecorator::m_glProgramNamedParameter4dvNV_record;
+this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&RecordTableDecorator::m_glCompileCommandListNV_record;
+this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetRenderbufferParameterivEXT_record;
+this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&RecordTableDecorator::m_glGetnPolygonStipple_record;
+this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&RecordTableDecorator::m_glIsBufferResidentNV_record;
+this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3ubvEXT_record;
+this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetNamedRenderbufferParameterivEXT_record;
+this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&RecordTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_record;
+this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&RecordTableDecorator::m_glMultiTexGendvEXT_record;
+this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&RecordTableDecorator::m_glVertexArrayRangeNV_record;
+this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&RecordTableDecorator::m_glIsTextureHandleResidentNV_record;
+this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&RecordTableDecorator::m_glGetProgramEnvParameterdvARB_record;
+this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&RecordTableDecorator::m_glIsNamedStringARB_record;
+this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&RecordTableDecorator::m_glSecondaryColorFormatNV_record;
+this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&RecordTableDecorator::m_glVertexAttrib4ubvNV_record;
+this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&RecordTableDecorator::m_glTagSampleBufferSGIX_record;
+this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&RecordTableDecorator::m_glVDPAUUnregisterSurfaceNV_record;
+this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&RecordTableDecorator::m_glGetPerfQueryIdByNameINTEL_record;
+this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&RecordTableDecorator::m_glGetInteger64v_record;
+this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&RecordTableDecorator::m_glClipPlane_record;
+this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&RecordTableDecorator::m_glColor4ubVertex3fSUN_record;
+this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&RecordTableDecorator::m_glIndexub_record;
+this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&RecordTableDecorator::m_glGetProgramEnvParameterfvARB_record;
+this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&RecordTableDecorator::m_glVertexAttrib4usvARB_record;
+this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&RecordTableDecorator::m_glNamedFramebufferRenderbuffer_record;
+this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x4dv_record;
+this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&RecordTableDecorator::m_glTestFenceAPPLE_record;
+this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&RecordTableDecorator::m_glVertexAttrib4Niv_record;
+this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&RecordTableDecorator::m_glVertexAttribL2i64vNV_record;
+this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&RecordTableDecorator::m_glColorP4uiv_record;
+this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&RecordTableDecorator::m_glUniformMatrix2x3fv_record;
+this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&RecordTableDecorator::m_glCallCommandListNV_record;
+this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&RecordTableDecorator::m_glClearBufferiv_record;
+this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&RecordTableDecorator::m_glNamedStringARB_record;
+this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&RecordTableDecorator::m_glMatrixMult3x2fNV_record;
+this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&RecordTableDecorator::m_glGetNamedProgramStringEXT_record;
+this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&RecordTableDecorator::m_glGetnHistogramARB_record;
+this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&RecordTableDecorator::m_glGetTextureLevelParameterfv_record;
+this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&RecordTableDecorator::m_glMultiTexCoord1fv_record;
+this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&RecordTableDecorator::m_glBitmapxOES_record;
+this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&RecordTableDecorator::m_glGetSamplerParameterIuiv_record;
+this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&RecordTableDecorator::m_glTexCoordP3ui_record;
+this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&RecordTableDecorator::m_glTextureSubImage1D_record;
+this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&RecordTableDecorator::m_glVertexAttribLPointerEXT_record;
+this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&RecordTableDecorator::m_glFogCoordPointerEXT_record;
+this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&RecordTableDecorator::m_glWindowPos3s_record;
+this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&RecordTableDecorator::m_glVertexAttribs2svNV_record;
+this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&RecordTableDecorator::m_glTextureImage3DEXT_record;
+this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&RecordTableDecorator::m_glWindowPos3i_record;
+this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&RecordTableDecorator::m_glWindowPos3d_record;
+this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&RecordTableDecorator::m_glWindowPos3f_record;
+this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&RecordTableDecorator::m_glIsEnabledIndexedEXT_record;
+this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&RecordTableDecorator::m_glGetNamedProgramivEXT_record;
+this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&RecordTableDecorator::m_glVertex3xvOES_record;
+this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&RecordTableDecorator::m_glColor3us_record;
+this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&RecordTableDecorator::m_glBeginPerfMonitorAMD_record;
+this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x3dv_record;
+this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_record;
+this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&RecordTableDecorator::m_glReadnPixels_record;
+this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&RecordTableDecorator::m_glMultiTexCoord4f_record;
+this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&RecordTableDecorator::m_glColor3ub_record;
+this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&RecordTableDecorator::m_glMultiTexCoord4d_record;
+this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&RecordTableDecorator::m_glVertexAttribL3ui64NV_record;
+this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&RecordTableDecorator::m_glColor3ui_record;
+this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&RecordTableDecorator::m_glProgramUniform4fvEXT_record;
+this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&RecordTableDecorator::m_glVertexAttrib2sARB_record;
+this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&RecordTableDecorator::m_glMultiTexCoord4i_record;
+this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&RecordTableDecorator::m_glCheckFramebufferStatusEXT_record;
+this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&RecordTableDecorator::m_glGetnMapivARB_record;
+this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&RecordTableDecorator::m_glMultiTexCoord1ivARB_record;
+this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&RecordTableDecorator::m_glDisableVertexAttribArrayARB_record;
+this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&RecordTableDecorator::m_glGetPolygonStipple_record;
+this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&RecordTableDecorator::m_glVertexAttribI4ui_record;
+this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&RecordTableDecorator::m_glGetPathDashArrayNV_record;
+this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&RecordTableDecorator::m_glMultiTexRenderbufferEXT_record;
+this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&RecordTableDecorator::m_glCopyTextureSubImage1D_record;
+this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&RecordTableDecorator::m_glDeleteOcclusionQueriesNV_record;
+this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&RecordTableDecorator::m_glVertex4hvNV_record;
+this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&RecordTableDecorator::m_glGetnTexImage_record;
+this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&RecordTableDecorator::m_glProgramLocalParameter4dARB_record;
+this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&RecordTableDecorator::m_glBlendEquation_record;
+this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&RecordTableDecorator::m_glUnlockArraysEXT_record;
+this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&RecordTableDecorator::m_glGetQueryObjectui64vEXT_record;
+this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4uivEXT_record;
+this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&RecordTableDecorator::m_glUniform1i64vNV_record;
+this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&RecordTableDecorator::m_glMultiTexCoord3dv_record;
+this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&RecordTableDecorator::m_glColor4sv_record;
+this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&RecordTableDecorator::m_glVertexStream4ivATI_record;
+this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&RecordTableDecorator::m_glPopClientAttrib_record;
+this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&RecordTableDecorator::m_glClearBufferData_record;
+this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&RecordTableDecorator::m_glGetProgramivNV_record;
+this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glBeginTransformFeedback_record;
+this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&RecordTableDecorator::m_glFinishObjectAPPLE_record;
+this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetMinmaxParameterivEXT_record;
+this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&RecordTableDecorator::m_glColor3iv_record;
+this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&RecordTableDecorator::m_glVertexAttrib3sv_record;
+this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&RecordTableDecorator::m_glCompressedTexImage1D_record;
+this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&RecordTableDecorator::m_glDeleteTransformFeedbacks_record;
+this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&RecordTableDecorator::m_glGetVideoi64vNV_record;
+this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&RecordTableDecorator::m_glDrawRangeElementsBaseVertex_record;
+this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&RecordTableDecorator::m_glUniform4i64vARB_record;
+this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTextureStorage3DMultisampleEXT_record;
+this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&RecordTableDecorator::m_glGetTexParameterfv_record;
+this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&RecordTableDecorator::m_glProgramUniformui64vNV_record;
+this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexImage1DEXT_record;
+this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&RecordTableDecorator::m_glProgramUniform2ivEXT_record;
+this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&RecordTableDecorator::m_glPushGroupMarkerEXT_record;
+this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&RecordTableDecorator::m_glVertexAttrib1dv_record;
+this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&RecordTableDecorator::m_glMatrixLoadIdentityEXT_record;
+this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&RecordTableDecorator::m_glMultTransposeMatrixxOES_record;
+this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&RecordTableDecorator::m_glGetPixelMapxv_record;
+this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&RecordTableDecorator::m_glFramebufferSampleLocationsfvARB_record;
+this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&RecordTableDecorator::m_glGetLightiv_record;
+this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&RecordTableDecorator::m_glBlendFuncSeparatei_record;
+this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&RecordTableDecorator::m_glAcquireKeyedMutexWin32EXT_record;
+this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&RecordTableDecorator::m_glGetBooleanIndexedvEXT_record;
+this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&RecordTableDecorator::m_glGetProgramSubroutineParameteruivNV_record;
+this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&RecordTableDecorator::m_glUniform2ui_record;
+this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&RecordTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_record;
+this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&RecordTableDecorator::m_glWindowPos2fv_record;
+this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&RecordTableDecorator::m_glWaitVkSemaphoreNV_record;
+this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&RecordTableDecorator::m_glDisablei_record;
+this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&RecordTableDecorator::m_glSelectPerfMonitorCountersAMD_record;
+this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&RecordTableDecorator::m_glGetVertexAttribLi64vNV_record;
+this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&RecordTableDecorator::m_glBlendFuncSeparateiARB_record;
+this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&RecordTableDecorator::m_glWeightuivARB_record;
+this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&RecordTableDecorator::m_glWindowPos2iARB_record;
+this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&RecordTableDecorator::m_glGetProgramLocalParameterdvARB_record;
+this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&RecordTableDecorator::m_glGetUniformui64vARB_record;
+this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&RecordTableDecorator::m_glSecondaryColor3us_record;
+this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&RecordTableDecorator::m_glGetSynciv_record;
+this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&RecordTableDecorator::m_glMakeImageHandleResidentARB_record;
+this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetProgramNamedParameterfvNV_record;
+this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&RecordTableDecorator::m_glTextureStorage3D_record;
+this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&RecordTableDecorator::m_glVertexAttrib4svNV_record;
+this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&RecordTableDecorator::m_glProgramUniform2i_record;
+this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&RecordTableDecorator::m_glListDrawCommandsStatesClientNV_record;
+this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&RecordTableDecorator::m_glProgramLocalParametersI4uivNV_record;
+this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glBeginTransformFeedbackNV_record;
+this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&RecordTableDecorator::m_glGetProgramBinary_record;
+this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&RecordTableDecorator::m_glBinormal3iEXT_record;
+this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&RecordTableDecorator::m_glEvalPoint1_record;
+this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&RecordTableDecorator::m_glEvalPoint2_record;
+this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glPauseTransformFeedback_record;
+this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&RecordTableDecorator::m_glWindowPos2sMESA_record;
+this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactorbSUN_record;
+this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&RecordTableDecorator::m_glCreateTransformFeedbacks_record;
+this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&RecordTableDecorator::m_glTexturePageCommitmentEXT_record;
+this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&RecordTableDecorator::m_glTransformFeedbackVaryingsNV_record;
+this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&RecordTableDecorator::m_glTexSubImage1D_record;
+this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&RecordTableDecorator::m_glConvolutionParameterfvEXT_record;
+this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&RecordTableDecorator::m_glBlitFramebufferEXT_record;
+this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&RecordTableDecorator::m_glUniformMatrix4fvARB_record;
+this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&RecordTableDecorator::m_glProgramEnvParameter4dvARB_record;
+this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&RecordTableDecorator::m_glTextureStorageMem2DEXT_record;
+this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&RecordTableDecorator::m_glVertexAttribP3uiv_record;
+this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&RecordTableDecorator::m_glFogCoordFormatNV_record;
+this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetMultiTexLevelParameterivEXT_record;
+this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&RecordTableDecorator::m_glIsOcclusionQueryNV_record;
+this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&RecordTableDecorator::m_glCompressedTexImage2DARB_record;
+this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&RecordTableDecorator::m_glGetProgramEnvParameterIuivNV_record;
+this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&RecordTableDecorator::m_glVertexAttrib4sv_record;
+this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&RecordTableDecorator::m_glVertexAttrib4fvARB_record;
+this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&RecordTableDecorator::m_glLoadName_record;
+this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&RecordTableDecorator::m_glBindVertexShaderEXT_record;
+this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_record;
+this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&RecordTableDecorator::m_glProgramUniform3uiEXT_record;
+this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x2dvEXT_record;
+this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&RecordTableDecorator::m_glTexCoord1hvNV_record;
+this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&RecordTableDecorator::m_glLoadMatrixd_record;
+this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&RecordTableDecorator::m_glTexParameterfv_record;
+this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&RecordTableDecorator::m_glVariantdvEXT_record;
+this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&RecordTableDecorator::m_glCullParameterfvEXT_record;
+this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&RecordTableDecorator::m_glUniform3dv_record;
+this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&RecordTableDecorator::m_glProgramUniform3fv_record;
+this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&RecordTableDecorator::m_glIsBufferARB_record;
+this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&RecordTableDecorator::m_glMultiTexCoord1bOES_record;
+this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&RecordTableDecorator::m_glFogCoordhNV_record;
+this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&RecordTableDecorator::m_glFramebufferSampleLocationsfvNV_record;
+this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&RecordTableDecorator::m_glGenSymbolsEXT_record;
+this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&RecordTableDecorator::m_glGetConvolutionFilter_record;
+this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&RecordTableDecorator::m_glProgramUniform1fvEXT_record;
+this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&RecordTableDecorator::m_glGetNextPerfQueryIdINTEL_record;
+this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&RecordTableDecorator::m_glCompressedTexImage1DARB_record;
+this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&RecordTableDecorator::m_glBindSamplers_record;
+this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&RecordTableDecorator::m_glGetProgramEnvParameterIivNV_record;
+this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&RecordTableDecorator::m_glGetQueryObjectui64v_record;
+this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&RecordTableDecorator::m_glVertexAttribL4ui64vNV_record;
+this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&RecordTableDecorator::m_glGetVideoivNV_record;
+this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&RecordTableDecorator::m_glGetTextureImage_record;
+this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&RecordTableDecorator::m_glProgramUniform1fv_record;
+this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&RecordTableDecorator::m_glUniformMatrix4fv_record;
+this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&RecordTableDecorator::m_glColorMask_record;
+this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&RecordTableDecorator::m_glBeginFragmentShaderATI_record;
+this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&RecordTableDecorator::m_glMultiDrawArraysEXT_record;
+this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&RecordTableDecorator::m_glGenNamesAMD_record;
+this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&RecordTableDecorator::m_glPathParameteriNV_record;
+this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&RecordTableDecorator::m_glCreateCommandListsNV_record;
+this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&RecordTableDecorator::m_glDeleteProgramPipelines_record;
+this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&RecordTableDecorator::m_glCopyColorSubTableEXT_record;
+this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&RecordTableDecorator::m_glVariantsvEXT_record;
+this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&RecordTableDecorator::m_glGenProgramPipelines_record;
+this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&RecordTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_record;
+this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&RecordTableDecorator::m_glWindowPos2s_record;
+this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&RecordTableDecorator::m_glSecondaryColor3iEXT_record;
+this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&RecordTableDecorator::m_glWindowPos2i_record;
+this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&RecordTableDecorator::m_glWindowPos2f_record;
+this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&RecordTableDecorator::m_glWindowPos2d_record;
+this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&RecordTableDecorator::m_glUniform4uivEXT_record;
+this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&RecordTableDecorator::m_glOrthoxOES_record;
+this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&RecordTableDecorator::m_glUniformSubroutinesuiv_record;
+this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&RecordTableDecorator::m_glRectdv_record;
+this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&RecordTableDecorator::m_glProgramUniform1i64vNV_record;
+this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&RecordTableDecorator::m_glVertexAttribI4uiEXT_record;
+this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&RecordTableDecorator::m_glSecondaryColor3ubEXT_record;
+this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexSubImage1DEXT_record;
+this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&RecordTableDecorator::m_glMultiTexGendEXT_record;
+this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&RecordTableDecorator::m_glColorP3uiv_record;
+this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&RecordTableDecorator::m_glFogCoordfv_record;
+this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&RecordTableDecorator::m_glCompileShader_record;
+this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&RecordTableDecorator::m_glTexCoord2hNV_record;
+this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&RecordTableDecorator::m_glUniform1uivEXT_record;
+this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&RecordTableDecorator::m_glMatrixLoadTransposedEXT_record;
+this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&RecordTableDecorator::m_glIndexfv_record;
+this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&RecordTableDecorator::m_glGetCompressedTextureImage_record;
+this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&RecordTableDecorator::m_glGetUniformuivEXT_record;
+this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&RecordTableDecorator::m_glGetnPixelMapfvARB_record;
+this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&RecordTableDecorator::m_glFramebufferTextureEXT_record;
+this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirectCount_record;
+this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&RecordTableDecorator::m_glVertexAttribIPointer_record;
+this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&RecordTableDecorator::m_glMultiTexCoordP3ui_record;
+this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&RecordTableDecorator::m_glEvaluateDepthValuesARB_record;
+this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetNamedBufferParameteriv_record;
+this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_record;
+this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glColor4fNormal3fVertex3fvSUN_record;
+this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&RecordTableDecorator::m_glSeparableFilter2DEXT_record;
+this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&RecordTableDecorator::m_glTexParameterxOES_record;
+this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&RecordTableDecorator::m_glClearAccumxOES_record;
+this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&RecordTableDecorator::m_glInvalidateFramebuffer_record;
+this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&RecordTableDecorator::m_glWeightubvARB_record;
+this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&RecordTableDecorator::m_glVertexAttrib1d_record;
+this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&RecordTableDecorator::m_glVertexAttrib1f_record;
+this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&RecordTableDecorator::m_glVertex4fv_record;
+this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&RecordTableDecorator::m_glClearNamedFramebufferfi_record;
+this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&RecordTableDecorator::m_glGetQueryBufferObjectuiv_record;
+this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&RecordTableDecorator::m_glClearNamedFramebufferfv_record;
+this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&RecordTableDecorator::m_glEndVertexShaderEXT_record;
+this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&RecordTableDecorator::m_glVertexAttrib1s_record;
+this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&RecordTableDecorator::m_glMultiTexCoord4dvARB_record;
+this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&RecordTableDecorator::m_glMultiTexCoord1sv_record;
+this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&RecordTableDecorator::m_glUniform1ui64vNV_record;
+this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&RecordTableDecorator::m_glGetClipPlanefOES_record;
+this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&RecordTableDecorator::m_glRasterPos2s_record;
+this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&RecordTableDecorator::m_glWeightivARB_record;
+this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&RecordTableDecorator::m_glMultiTexCoord4hvNV_record;
+this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&RecordTableDecorator::m_glNormal3hNV_record;
+this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&RecordTableDecorator::m_glGetSeparableFilter_record;
+this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&RecordTableDecorator::m_glGetPathTexGenivNV_record;
+this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&RecordTableDecorator::m_glColor4bv_record;
+this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&RecordTableDecorator::m_glRasterPos2f_record;
+this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&RecordTableDecorator::m_glNamedBufferPageCommitmentARB_record;
+this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&RecordTableDecorator::m_glLoadIdentity_record;
+this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&RecordTableDecorator::m_glRasterPos2i_record;
+this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&RecordTableDecorator::m_glRasterPos4iv_record;
+this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&RecordTableDecorator::m_glMultiTexCoord2fvARB_record;
+this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&RecordTableDecorator::m_glUniformMatrix4x3fv_record;
+this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&RecordTableDecorator::m_glClearBufferfv_record;
+this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&RecordTableDecorator::m_glMultiTexCoord4hNV_record;
+this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&RecordTableDecorator::m_glTextureBarrier_record;
+this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&RecordTableDecorator::m_glReplacementCodeuivSUN_record;
+this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&RecordTableDecorator::m_glDeleteAsyncMarkersSGIX_record;
+this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&RecordTableDecorator::m_glTexCoord2bvOES_record;
+this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&RecordTableDecorator::m_glEvalCoord2xOES_record;
+this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&RecordTableDecorator::m_glGetSharpenTexFuncSGIS_record;
+this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&RecordTableDecorator::m_glProgramUniformHandleui64vNV_record;
+this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&RecordTableDecorator::m_glIglooInterfaceSGIX_record;
+this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&RecordTableDecorator::m_glWindowPos2dvARB_record;
+this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&RecordTableDecorator::m_glClearBufferfi_record;
+this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&RecordTableDecorator::m_glDrawArraysIndirect_record;
+this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&RecordTableDecorator::m_glGenVertexArrays_record;
+this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&RecordTableDecorator::m_glGetTransformFeedbacki64_v_record;
+this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&RecordTableDecorator::m_glEnableVertexArrayAttrib_record;
+this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x2dv_record;
+this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&RecordTableDecorator::m_glVertexStream4fATI_record;
+this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&RecordTableDecorator::m_glVertexBindingDivisor_record;
+this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&RecordTableDecorator::m_glGetSamplerParameterIiv_record;
+this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&RecordTableDecorator::m_glGetCoverageModulationTableNV_record;
+this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&RecordTableDecorator::m_glDepthRangedNV_record;
+this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&RecordTableDecorator::m_glVertexAttrib3f_record;
+this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&RecordTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_record;
+this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&RecordTableDecorator::m_glVertexAttribFormatNV_record;
+this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&RecordTableDecorator::m_glGetQueryBufferObjecti64v_record;
+this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&RecordTableDecorator::m_glGetVertexAttribdv_record;
+this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&RecordTableDecorator::m_glGetUniformi64vARB_record;
+this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&RecordTableDecorator::m_glAreTexturesResidentEXT_record;
+this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&RecordTableDecorator::m_glGetHandleARB_record;
+this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&RecordTableDecorator::m_glVideoCaptureStreamParameterdvNV_record;
+this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&RecordTableDecorator::m_glMapParameterivNV_record;
+this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&RecordTableDecorator::m_glIsVertexArray_record;
+this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&RecordTableDecorator::m_glSecondaryColor3sEXT_record;
+this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glGetTexParameterIivEXT_record;
+this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&RecordTableDecorator::m_glFrameTerminatorGREMEDY_record;
+this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&RecordTableDecorator::m_glBlendBarrierKHR_record;
+this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&RecordTableDecorator::m_glVertexAttrib4NubARB_record;
+this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&RecordTableDecorator::m_glPrimitiveRestartNV_record;
+this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&RecordTableDecorator::m_glVertexAttribL1ui64vARB_record;
+this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4ivEXT_record;
+this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&RecordTableDecorator::m_glVertexAttribs4svNV_record;
+this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&RecordTableDecorator::m_glUniform1ui_record;
+this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&RecordTableDecorator::m_glVertexAttrib2fvARB_record;
+this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4svEXT_record;
+this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&RecordTableDecorator::m_glTextureImage3DMultisampleCoverageNV_record;
+this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&RecordTableDecorator::m_glMemoryBarrier_record;
+this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&RecordTableDecorator::m_glGetVariantArrayObjectfvATI_record;
+this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&RecordTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_record;
+this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&RecordTableDecorator::m_glIsProgramARB_record;
+this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&RecordTableDecorator::m_glBindImageTextureEXT_record;
+this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&RecordTableDecorator::m_glGetFragDataLocation_record;
+this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&RecordTableDecorator::m_glMultiTexCoord1svARB_record;
+this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&RecordTableDecorator::m_glGetMapxvOES_record;
+this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTextureStorage2DMultisampleEXT_record;
+this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&RecordTableDecorator::m_glGetMaterialfv_record;
+this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&RecordTableDecorator::m_glVertexAttrib4NbvARB_record;
+this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&RecordTableDecorator::m_glPixelMapuiv_record;
+this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&RecordTableDecorator::m_glColorPointerEXT_record;
+this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&RecordTableDecorator::m_glEnableClientStateiEXT_record;
+this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&RecordTableDecorator::m_glClearTexSubImage_record;
+this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&RecordTableDecorator::m_glEvalCoord1xvOES_record;
+this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&RecordTableDecorator::m_glDetachObjectARB_record;
+this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&RecordTableDecorator::m_glGetTextureParameterIiv_record;
+this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&RecordTableDecorator::m_glVariantusvEXT_record;
+this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&RecordTableDecorator::m_glCompressedTextureImage3DEXT_record;
+this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&RecordTableDecorator::m_glMultiTexCoord1dARB_record;
+this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&RecordTableDecorator::m_glGetVertexArrayIntegeri_vEXT_record;
+this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&RecordTableDecorator::m_glVertexAttribI4ubv_record;
+this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&RecordTableDecorator::m_glPixelTexGenParameterfSGIS_record;
+this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x2dv_record;
+this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&RecordTableDecorator::m_glUniform3fARB_record;
+this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&RecordTableDecorator::m_glIsShader_record;
+this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&RecordTableDecorator::m_glConvolutionParameteriv_record;
+this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyMultiTexSubImage2DEXT_record;
+this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&RecordTableDecorator::m_glEnableVertexAttribArrayARB_record;
+this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&RecordTableDecorator::m_glMulticastCopyBufferSubDataNV_record;
+this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&RecordTableDecorator::m_glEnable_record;
+this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&RecordTableDecorator::m_glGetActiveUniformsiv_record;
+this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&RecordTableDecorator::m_glGetVertexAttribivARB_record;
+this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&RecordTableDecorator::m_glTexCoord4hvNV_record;
+this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&RecordTableDecorator::m_glUseProgramObjectARB_record;
+this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&RecordTableDecorator::m_glGetAttribLocation_record;
+this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&RecordTableDecorator::m_glVertexAttrib4dv_record;
+this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&RecordTableDecorator::m_glGetTextureParameteriv_record;
+this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&RecordTableDecorator::m_glNamedBufferStorageMemEXT_record;
+this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&RecordTableDecorator::m_glPathSubCoordsNV_record;
+this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&RecordTableDecorator::m_glMatrixIndexusvARB_record;
+this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&RecordTableDecorator::m_glGetVideouivNV_record;
+this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&RecordTableDecorator::m_glGetVideoCaptureivNV_record;
+this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&RecordTableDecorator::m_glProgramUniform3ui_record;
+this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&RecordTableDecorator::m_glVertexAttrib3svARB_record;
+this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetNamedBufferParameterivEXT_record;
+this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&RecordTableDecorator::m_glMatrixScaledEXT_record;
+this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x3fv_record;
+this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&RecordTableDecorator::m_glGetFragmentLightivSGIX_record;
+this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&RecordTableDecorator::m_glGetStringi_record;
+this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&RecordTableDecorator::m_glWindowPos2svARB_record;
+this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&RecordTableDecorator::m_glVertexAttrib2svNV_record;
+this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&RecordTableDecorator::m_glWindowPos2ivARB_record;
+this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&RecordTableDecorator::m_glGetVertexAttribPointervNV_record;
+this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&RecordTableDecorator::m_glPushMatrix_record;
+this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&RecordTableDecorator::m_glEdgeFlagPointerListIBM_record;
+this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&RecordTableDecorator::m_glGenerateMipmapEXT_record;
+this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&RecordTableDecorator::m_glWindowPos3sv_record;
+this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&RecordTableDecorator::m_glPathCoordsNV_record;
+this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&RecordTableDecorator::m_glProgramUniform1i_record;
+this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&RecordTableDecorator::m_glProgramUniform1d_record;
+this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&RecordTableDecorator::m_glProgramUniform1f_record;
+this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&RecordTableDecorator::m_glProgramParameteriEXT_record;
+this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexImage2DEXT_record;
+this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&RecordTableDecorator::m_glProgramUniform3iv_record;
+this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&RecordTableDecorator::m_glIndexiv_record;
+this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&RecordTableDecorator::m_glMultiTexCoord4xvOES_record;
+this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&RecordTableDecorator::m_glEGLImageTargetTexture2DOES_record;
+this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&RecordTableDecorator::m_glPixelZoom_record;
+this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&RecordTableDecorator::m_glVertex3bvOES_record;
+this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&RecordTableDecorator::m_glFramebufferReadBufferEXT_record;
+this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&RecordTableDecorator::m_glExtractComponentEXT_record;
+this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&RecordTableDecorator::m_glCombinerParameterivNV_record;
+this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&RecordTableDecorator::m_glMinmax_record;
+this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&RecordTableDecorator::m_glColorP3ui_record;
+this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&RecordTableDecorator::m_glPointParameterfvSGIS_record;
+this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&RecordTableDecorator::m_glBlendEquationi_record;
+this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&RecordTableDecorator::m_glGetFogFuncSGIS_record;
+this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&RecordTableDecorator::m_glVertexAttrib4fvNV_record;
+this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&RecordTableDecorator::m_glGetnMinmax_record;
+this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&RecordTableDecorator::m_glFragmentLightiSGIX_record;
+this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&RecordTableDecorator::m_glMultiTexCoord1bvOES_record;
+this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&RecordTableDecorator::m_glSecondaryColorPointerEXT_record;
+this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&RecordTableDecorator::m_glMultiTexCoordP4uiv_record;
+this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&RecordTableDecorator::m_glGetBufferSubDataARB_record;
+this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&RecordTableDecorator::m_glSecondaryColor3hNV_record;
+this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&RecordTableDecorator::m_glGetPathParameterivNV_record;
+this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&RecordTableDecorator::m_glFlushRasterSGIX_record;
+this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&RecordTableDecorator::m_glElementPointerATI_record;
+this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&RecordTableDecorator::m_glGetAttachedObjectsARB_record;
+this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&RecordTableDecorator::m_glUniform4iv_record;
+this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&RecordTableDecorator::m_glFogxOES_record;
+this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&RecordTableDecorator::m_glSharpenTexFuncSGIS_record;
+this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&RecordTableDecorator::m_glClearDepthfOES_record;
+this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&RecordTableDecorator::m_glDeleteCommandListsNV_record;
+this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&RecordTableDecorator::m_glSpecializeShader_record;
+this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&RecordTableDecorator::m_glVertex4hNV_record;
+this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3dvEXT_record;
+this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&RecordTableDecorator::m_glGenTextures_record;
+this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&RecordTableDecorator::m_glTextureStorage2DMultisample_record;
+this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&RecordTableDecorator::m_glUniform3ui64vNV_record;
+this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&RecordTableDecorator::m_glBlendFuncSeparateIndexedAMD_record;
+this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&RecordTableDecorator::m_glMakeBufferResidentNV_record;
+this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&RecordTableDecorator::m_glShaderOp2EXT_record;
+this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&RecordTableDecorator::m_glGetVertexAttribivNV_record;
+this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glTexParameterIivEXT_record;
+this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&RecordTableDecorator::m_glGetPerfQueryDataINTEL_record;
+this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&RecordTableDecorator::m_glVertexAttrib4dvARB_record;
+this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glTextureSubImage1DEXT_record;
+this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&RecordTableDecorator::m_glGetActiveUniformBlockName_record;
+this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&RecordTableDecorator::m_glVertexAttrib2dvARB_record;
+this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&RecordTableDecorator::m_glVertexAttribPointer_record;
+this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&RecordTableDecorator::m_glDepthBoundsdNV_record;
+this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&RecordTableDecorator::m_glDeleteTexturesEXT_record;
+this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&RecordTableDecorator::m_glDrawBuffersATI_record;
+this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&RecordTableDecorator::m_glLightModelxvOES_record;
+this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&RecordTableDecorator::m_glApplyTextureEXT_record;
+this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&RecordTableDecorator::m_glGetImageHandleNV_record;
+this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&RecordTableDecorator::m_glGetMinmax_record;
+this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&RecordTableDecorator::m_glGetFixedvOES_record;
+this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&RecordTableDecorator::m_glSamplePatternEXT_record;
+this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&RecordTableDecorator::m_glUniform1f_record;
+this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glColor4fNormal3fVertex3fSUN_record;
+this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&RecordTableDecorator::m_glFogCoorddvEXT_record;
+this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyTextureImage1DEXT_record;
+this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&RecordTableDecorator::m_glFlushMappedBufferRangeAPPLE_record;
+this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&RecordTableDecorator::m_glVertex3sv_record;
+this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&RecordTableDecorator::m_glFlushStaticDataIBM_record;
+this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&RecordTableDecorator::m_glProgramUniform4ui64NV_record;
+this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&RecordTableDecorator::m_glRasterPos4xOES_record;
+this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&RecordTableDecorator::m_glVertexAttribP1ui_record;
+this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&RecordTableDecorator::m_glProgramUniform4dvEXT_record;
+this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&RecordTableDecorator::m_glEndTransformFeedbackEXT_record;
+this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&RecordTableDecorator::m_glBinormal3dEXT_record;
+this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&RecordTableDecorator::m_glGetTextureSubImage_record;
+this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetNamedRenderbufferParameteriv_record;
+this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&RecordTableDecorator::m_glBindBuffersRange_record;
+this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&RecordTableDecorator::m_glFinishAsyncSGIX_record;
+this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&RecordTableDecorator::m_glBindFragDataLocationIndexed_record;
+this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&RecordTableDecorator::m_glMultiTexCoord2dv_record;
+this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&RecordTableDecorator::m_glUniform2iv_record;
+this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&RecordTableDecorator::m_glProgramUniform2i64vNV_record;
+this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&RecordTableDecorator::m_glFlushVertexArrayRangeAPPLE_record;
+this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&RecordTableDecorator::m_glTextureParameterf_record;
+this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&RecordTableDecorator::m_glMultiTexCoord3dvARB_record;
+this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&RecordTableDecorator::m_glFeedbackBuffer_record;
+this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&RecordTableDecorator::m_glDebugMessageInsertARB_record;
+this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&RecordTableDecorator::m_glMultiTexCoord2i_record;
+this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&RecordTableDecorator::m_glTextureSubImage3D_record;
+this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&RecordTableDecorator::m_glFramebufferTexture1D_record;
+this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&RecordTableDecorator::m_glGetShaderiv_record;
+this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&RecordTableDecorator::m_glMultiTexCoord2d_record;
+this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&RecordTableDecorator::m_glArrayObjectATI_record;
+this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&RecordTableDecorator::m_glGetPointeri_vEXT_record;
+this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorCountersAMD_record;
+this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&RecordTableDecorator::m_glNamedBufferStorage_record;
+this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&RecordTableDecorator::m_glTexEnvxvOES_record;
+this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&RecordTableDecorator::m_glProgramUniform2ui64NV_record;
+this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&RecordTableDecorator::m_glMultiTexCoord3bOES_record;
+this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&RecordTableDecorator::m_glUniform1dv_record;
+this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&RecordTableDecorator::m_glPixelTransferi_record;
+this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3usvEXT_record;
+this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&RecordTableDecorator::m_glProgramEnvParameterI4uivNV_record;
+this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&RecordTableDecorator::m_glVertex2sv_record;
+this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&RecordTableDecorator::m_glWindowPos4dMESA_record;
+this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&RecordTableDecorator::m_glDebugMessageControlARB_record;
+this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&RecordTableDecorator::m_glIsTextureEXT_record;
+this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&RecordTableDecorator::m_glFragmentMaterialivSGIX_record;
+this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&RecordTableDecorator::m_glLinkProgramARB_record;
+this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&RecordTableDecorator::m_glFinishFenceAPPLE_record;
+this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribBindingEXT_record;
+this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTexStorageMem3DMultisampleEXT_record;
+this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&RecordTableDecorator::m_glUniform1ui64vARB_record;
+this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&RecordTableDecorator::m_glMultiTexCoord4fv_record;
+this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&RecordTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_record;
+this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&RecordTableDecorator::m_glRasterPos3d_record;
+this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&RecordTableDecorator::m_glPollAsyncSGIX_record;
+this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&RecordTableDecorator::m_glRasterPos3f_record;
+this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&RecordTableDecorator::m_glCompressedTexImage3D_record;
+this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&RecordTableDecorator::m_glVariantivEXT_record;
+this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&RecordTableDecorator::m_glUnmapTexture2DINTEL_record;
+this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&RecordTableDecorator::m_glMulticastWaitSyncNV_record;
+this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&RecordTableDecorator::m_glGetVertexAttribiv_record;
+this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&RecordTableDecorator::m_glGetPathCoordsNV_record;
+this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&RecordTableDecorator::m_glColor4xvOES_record;
+this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&RecordTableDecorator::m_glVertexAttrib3fv_record;
+this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&RecordTableDecorator::m_glRasterPos3s_record;
+this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&RecordTableDecorator::m_glVertex4bOES_record;
+this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&RecordTableDecorator::m_glTransformFeedbackVaryingsEXT_record;
+this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&RecordTableDecorator::m_glCombinerOutputNV_record;
+this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&RecordTableDecorator::m_glWindowPos4sMESA_record;
+this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&RecordTableDecorator::m_glVertexAttrib4svARB_record;
+this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&RecordTableDecorator::m_glIsList_record;
+this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&RecordTableDecorator::m_glGetInfoLogARB_record;
+this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&RecordTableDecorator::m_glUniformMatrix2fv_record;
+this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&RecordTableDecorator::m_glVertexAttribs3dvNV_record;
+this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactorsSUN_record;
+this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&RecordTableDecorator::m_glGetTrackMatrixivNV_record;
+this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&RecordTableDecorator::m_glTextureParameterfvEXT_record;
+this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&RecordTableDecorator::m_glIsNamedBufferResidentNV_record;
+this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&RecordTableDecorator::m_glProgramUniform4ui64vARB_record;
+this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&RecordTableDecorator::m_glTbufferMask3DFX_record;
+this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&RecordTableDecorator::m_glCoverFillPathNV_record;
+this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&RecordTableDecorator::m_glVertexAttrib1fvARB_record;
+this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&RecordTableDecorator::m_glGenerateTextureMipmap_record;
+this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_record;
+this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&RecordTableDecorator::m_glMultiDrawElementsBaseVertex_record;
+this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&RecordTableDecorator::m_glProgramSubroutineParametersuivNV_record;
+this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix2x4dvEXT_record;
+this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&RecordTableDecorator::m_glRotatexOES_record;
+this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&RecordTableDecorator::m_glMemoryBarrierEXT_record;
+this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&RecordTableDecorator::m_glVertexAttrib3svNV_record;
+this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&RecordTableDecorator::m_glVertexStream3iATI_record;
+this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&RecordTableDecorator::m_glCompressedTexSubImage1D_record;
+this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&RecordTableDecorator::m_glSetFenceNV_record;
+this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&RecordTableDecorator::m_glAttachObjectARB_record;
+this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&RecordTableDecorator::m_glCopyConvolutionFilter1D_record;
+this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTexStorageMem2DMultisampleEXT_record;
+this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&RecordTableDecorator::m_glProgramParameters4fvNV_record;
+this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&RecordTableDecorator::m_glNamedFramebufferParameteriEXT_record;
+this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&RecordTableDecorator::m_glVertexAttrib4Nsv_record;
+this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&RecordTableDecorator::m_glVertexAttribI4usvEXT_record;
+this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&RecordTableDecorator::m_glTextureBufferRangeEXT_record;
+this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&RecordTableDecorator::m_glVertexP3uiv_record;
+this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&RecordTableDecorator::m_glIsPathNV_record;
+this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&RecordTableDecorator::m_glGetnUniformi64vARB_record;
+this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&RecordTableDecorator::m_glFramebufferTextureMultiviewOVR_record;
+this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glCompressedMultiTexSubImage2DEXT_record;
+this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&RecordTableDecorator::m_glGetnMapdv_record;
+this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&RecordTableDecorator::m_glDebugMessageCallback_record;
+this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&RecordTableDecorator::m_glTangent3svEXT_record;
+this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&RecordTableDecorator::m_glVertexAttribParameteriAMD_record;
+this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&RecordTableDecorator::m_glBufferSubDataARB_record;
+this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&RecordTableDecorator::m_glGetVertexAttribLui64vARB_record;
+this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&RecordTableDecorator::m_glVertexAttribL4ui64NV_record;
+this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_record;
+this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&RecordTableDecorator::m_glImageTransformParameterfHP_record;
+this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&RecordTableDecorator::m_glMap1f_record;
+this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&RecordTableDecorator::m_glRasterPos4fv_record;
+this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&RecordTableDecorator::m_glVertex2bvOES_record;
+this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&RecordTableDecorator::m_glGetMapControlPointsNV_record;
+this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_record;
+this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&RecordTableDecorator::m_glBindBufferRangeNV_record;
+this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&RecordTableDecorator::m_glVertexStream3dvATI_record;
+this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&RecordTableDecorator::m_glNormalPointerListIBM_record;
+this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&RecordTableDecorator::m_glFogFuncSGIS_record;
+this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&RecordTableDecorator::m_glMultiModeDrawArraysIBM_record;
+this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_record;
+this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&RecordTableDecorator::m_glGetFloatv_record;
+this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&RecordTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_record;
+this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&RecordTableDecorator::m_glHint_record;
+this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&RecordTableDecorator::m_glVertexStream2svATI_record;
+this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&RecordTableDecorator::m_glMultiDrawArraysIndirect_record;
+this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&RecordTableDecorator::m_glMultiTexEnvfvEXT_record;
+this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&RecordTableDecorator::m_glVertexAttribP2uiv_record;
+this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&RecordTableDecorator::m_glProgramUniform1i64vARB_record;
+this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&RecordTableDecorator::m_glFramebufferTextureARB_record;
+this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&RecordTableDecorator::m_glPushClientAttribDefaultEXT_record;
+this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&RecordTableDecorator::m_glScalef_record;
+this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&RecordTableDecorator::m_glScaled_record;
+this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&RecordTableDecorator::m_glGetConvolutionParameterxvOES_record;
+this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&RecordTableDecorator::m_glGetProgramResourceName_record;
+this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&RecordTableDecorator::m_glCopyColorTable_record;
+this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&RecordTableDecorator::m_glDepthRangeArrayv_record;
+this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glCoverFillPathInstancedNV_record;
+this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&RecordTableDecorator::m_glMultiTexParameterivEXT_record;
+this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&RecordTableDecorator::m_glGetActiveAtomicCounterBufferiv_record;
+this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&RecordTableDecorator::m_glStencilOpSeparate_record;
+this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&RecordTableDecorator::m_glVertexAttrib4fNV_record;
+this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&RecordTableDecorator::m_glGetColorTableParameterivSGI_record;
+this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&RecordTableDecorator::m_glVertexArrayAttribBinding_record;
+this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&RecordTableDecorator::m_glIsSemaphoreEXT_record;
+this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&RecordTableDecorator::m_glProgramParameters4dvNV_record;
+this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&RecordTableDecorator::m_glVertexAttribL4dv_record;
+this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&RecordTableDecorator::m_glGetTexParameteriv_record;
+this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&RecordTableDecorator::m_glGetUniformOffsetEXT_record;
+this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&RecordTableDecorator::m_glGetVertexAttribPointerv_record;
+this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glResumeTransformFeedbackNV_record;
+this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&RecordTableDecorator::m_glProgramUniform3i64vNV_record;
+this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&RecordTableDecorator::m_glTangent3fEXT_record;
+this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&RecordTableDecorator::m_glGetPathMetricRangeNV_record;
+this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&RecordTableDecorator::m_glWindowPos2iMESA_record;
+this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&RecordTableDecorator::m_glVertex2xvOES_record;
+this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&RecordTableDecorator::m_glGetnCompressedTexImage_record;
+this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&RecordTableDecorator::m_glWindowPos2dv_record;
+this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&RecordTableDecorator::m_glReplacementCodeuiVertex3fSUN_record;
+this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&RecordTableDecorator::m_glGetTransformFeedbackVaryingEXT_record;
+this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&RecordTableDecorator::m_glWindowPos3fARB_record;
+this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&RecordTableDecorator::m_glMapNamedBufferEXT_record;
+this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&RecordTableDecorator::m_glDisable_record;
+this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&RecordTableDecorator::m_glIsPointInFillPathNV_record;
+this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&RecordTableDecorator::m_glVertexAttribI2uiEXT_record;
+this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&RecordTableDecorator::m_glProgramUniform4uiv_record;
+this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&RecordTableDecorator::m_glQueryCounter_record;
+this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&RecordTableDecorator::m_glFramebufferRenderbufferEXT_record;
+this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&RecordTableDecorator::m_glBinormal3svEXT_record;
+this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&RecordTableDecorator::m_glBindBufferOffsetNV_record;
+this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&RecordTableDecorator::m_glCopyTextureSubImage2D_record;
+this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&RecordTableDecorator::m_glGetProgramResourcefvNV_record;
+this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&RecordTableDecorator::m_glBinormalPointerEXT_record;
+this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&RecordTableDecorator::m_glGetLightfv_record;
+this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&RecordTableDecorator::m_glMulticastCopyImageSubDataNV_record;
+this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&RecordTableDecorator::m_glVertex2bOES_record;
+this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&RecordTableDecorator::m_glUniform2ivARB_record;
+this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&RecordTableDecorator::m_glMultiTexCoord3s_record;
+this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&RecordTableDecorator::m_glGetHistogramParameterfvEXT_record;
+this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&RecordTableDecorator::m_glGetProgramStringNV_record;
+this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&RecordTableDecorator::m_glGetTexGenxvOES_record;
+this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&RecordTableDecorator::m_glTextureSubImage2D_record;
+this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&RecordTableDecorator::m_glObjectPurgeableAPPLE_record;
+this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&RecordTableDecorator::m_glColorTableSGI_record;
+this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&RecordTableDecorator::m_glCopyConvolutionFilter2DEXT_record;
+this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&RecordTableDecorator::m_glMultiTexCoord3f_record;
+this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&RecordTableDecorator::m_glMultiTexCoord3d_record;
+this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&RecordTableDecorator::m_glFogCoorddv_record;
+this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&RecordTableDecorator::m_glGetBufferPointerv_record;
+this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&RecordTableDecorator::m_glProgramUniform1fEXT_record;
+this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&RecordTableDecorator::m_glWindowPos2fvMESA_record;
+this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&RecordTableDecorator::m_glAlphaToCoverageDitherControlNV_record;
+this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&RecordTableDecorator::m_glPolygonOffsetxOES_record;
+this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&RecordTableDecorator::m_glVertexAttrib4dARB_record;
+this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&RecordTableDecorator::m_glUniformHandleui64vARB_record;
+this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&RecordTableDecorator::m_glFragmentLightModelfvSGIX_record;
+this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&RecordTableDecorator::m_glSwizzleEXT_record;
+this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&RecordTableDecorator::m_glBindFragmentShaderATI_record;
+this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&RecordTableDecorator::m_glVertexAttribs3hvNV_record;
+this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&RecordTableDecorator::m_glGenBuffersARB_record;
+this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&RecordTableDecorator::m_glTextureStorageMem2DMultisampleEXT_record;
+this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&RecordTableDecorator::m_glListParameterfvSGIX_record;
+this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&RecordTableDecorator::m_glNamedRenderbufferStorageMultisample_record;
+this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&RecordTableDecorator::m_glVertexAttribI1iEXT_record;
+this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&RecordTableDecorator::m_glMultiTexCoord2ivARB_record;
+this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&RecordTableDecorator::m_glLightModelxOES_record;
+this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&RecordTableDecorator::m_glColor3xOES_record;
+this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&RecordTableDecorator::m_glReadBuffer_record;
+this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&RecordTableDecorator::m_glStencilFillPathInstancedNV_record;
+this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&RecordTableDecorator::m_glVDPAUUnmapSurfacesNV_record;
+this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&RecordTableDecorator::m_glProgramUniform4i64NV_record;
+this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&RecordTableDecorator::m_glVertexStream4dvATI_record;
+this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&RecordTableDecorator::m_glIsQuery_record;
+this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&RecordTableDecorator::m_glProgramUniformMatrix4fvEXT_record;
+this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&RecordTableDecorator::m_glVertexAttrib3hNV_record;
+this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&RecordTableDecorator::m_glFlushMappedNamedBufferRange_record;
+this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&RecordTableDecorator::m_glPushName_record;
+this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&RecordTableDecorator::m_glGetClipPlane_record;
+this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&RecordTableDecorator::m_glVertex4dv_record;
+this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&RecordTableDecorator::m_glVertexAttrib3d_record;
+this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&RecordTableDecorator::m_glBlendColor_record;
+this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glBindTransformFeedbackNV_record;
+this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&RecordTableDecorator::m_glSamplerParameterIuiv_record;
+this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&RecordTableDecorator::m_glIndexubv_record;
+this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&RecordTableDecorator::m_glNamedBufferPageCommitmentEXT_record;
+this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&RecordTableDecorator::m_glCheckNamedFramebufferStatus_record;
+this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&RecordTableDecorator::m_glGetObjectBufferfvATI_record;
+this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&RecordTableDecorator::m_glRasterPos4d_record;
+this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&RecordTableDecorator::m_glRasterPos4f_record;
+this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorCounterStringAMD_record;
+this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&RecordTableDecorator::m_glVertexAttrib3s_record;
+this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&RecordTableDecorator::m_glDrawElementsInstancedEXT_record;
+this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameterI4iEXT_record;
+this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&RecordTableDecorator::m_glRasterPos4s_record;
+this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&RecordTableDecorator::m_glGetProgramStageiv_record;
+this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&RecordTableDecorator::m_glGetMaterialxOES_record;
+this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&RecordTableDecorator::m_glPopMatrix_record;
+this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&RecordTableDecorator::m_glGetVideoui64vNV_record;
+this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&RecordTableDecorator::m_glTangent3bEXT_record;
+this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&RecordTableDecorator::m_glGetGraphicsResetStatusARB_record;
+this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&RecordTableDecorator::m_glUniform4i_record;
+this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&RecordTableDecorator::m_glActiveTexture_record;
+this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&RecordTableDecorator::m_glEnableVertexAttribArray_record;
+this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&RecordTableDecorator::m_glTexCoord4fVertex4fvSUN_record;
+this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&RecordTableDecorator::m_glUniform4d_record;
+this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&RecordTableDecorator::m_glUniform4f_record;
+this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&RecordTableDecorator::m_glRenderbufferStorageMultisample_record;
+this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&RecordTableDecorator::m_glCreateProgramPipelines_record;
+this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&RecordTableDecorator::m_glVertexAttribLPointer_record;
+this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&RecordTableDecorator::m_glUniform2uiEXT_record;
+this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&RecordTableDecorator::m_glMultiTexCoord3sv_record;
+this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&RecordTableDecorator::m_glDrawElementsInstancedBaseVertex_record;
+this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&RecordTableDecorator::m_glPixelTransformParameterfvEXT_record;
+this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glDrawTransformFeedbackNV_record;
+this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&RecordTableDecorator::m_glTextureImage2DMultisampleCoverageNV_record;
+this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&RecordTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_record;
+this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&RecordTableDecorator::m_glIsTexture_record;
+this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&RecordTableDecorator::m_glMultiTexCoord4iv_record;
+this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&RecordTableDecorator::m_glTexEnvfv_record;
+this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&RecordTableDecorator::m_glPopDebugGroup_record;
+this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&RecordTableDecorator::m_glUniformBlockBinding_record;
+this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&RecordTableDecorator::m_glWindowPos2svMESA_record;
+this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&RecordTableDecorator::m_glGenerateTextureMipmapEXT_record;
+this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&RecordTableDecorator::m_glBindLightParameterEXT_record;
+this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&RecordTableDecorator::m_glTexCoord3bOES_record;
+this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&RecordTableDecorator::m_glTexCoordPointer_record;
+this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix3x2fv_record;
+this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&RecordTableDecorator::m_glUniform2fvARB_record;
+this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&RecordTableDecorator::m_glProgramLocalParameterI4uivNV_record;
+this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&RecordTableDecorator::m_glFlushVertexArrayRangeNV_record;
+this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3svEXT_record;
+this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&RecordTableDecorator::m_glGetBufferParameteriv_record;
+this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&RecordTableDecorator::m_glGetQueryIndexediv_record;
+this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&RecordTableDecorator::m_glFramebufferTexture3DEXT_record;
+this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&RecordTableDecorator::m_glLoadTransposeMatrixxOES_record;
+this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&RecordTableDecorator::m_glDeleteTransformFeedbacksNV_record;
+this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&RecordTableDecorator::m_glGetCompressedTextureImageEXT_record;
+this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&RecordTableDecorator::m_glIndexMaterialEXT_record;
+this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&RecordTableDecorator::m_glFogCoorddEXT_record;
+this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&RecordTableDecorator::m_glTexCoord2hvNV_record;
+this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&RecordTableDecorator::m_glGetFramebufferParameterfvAMD_record;
+this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&RecordTableDecorator::m_glTexEnviv_record;
+this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&RecordTableDecorator::m_glEndTransformFeedbackNV_record;
+this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&RecordTableDecorator::m_glGlobalAlphaFactoruiSUN_record;
+this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&RecordTableDecorator::m_glSelectBuffer_record;
+this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&RecordTableDecorator::m_glNamedBufferSubDataEXT_record;
+this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&RecordTableDecorator::m_glDisableVertexArrayAttrib_record;
+this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&RecordTableDecorator::m_glBlendFunc_record;
+this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&RecordTableDecorator::m_glCreateProgram_record;
+this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&RecordTableDecorator::m_glVertexStream2dATI_record;
+this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&RecordTableDecorator::m_glUniform4ui64vARB_record;
+this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&RecordTableDecorator::m_glGetSemaphoreParameterui64vEXT_record;
+this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&RecordTableDecorator::m_glPrimitiveRestartIndex_record;
+this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&RecordTableDecorator::m_glNormalStream3fATI_record;
+this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix2fv_record;
+this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&RecordTableDecorator::m_glVertexAttribs1hvNV_record;
+this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&RecordTableDecorator::m_glWindowPos4svMESA_record;
+this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&RecordTableDecorator::m_glDeleteFragmentShaderATI_record;
+this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&RecordTableDecorator::m_glBindImageTextures_record;
+this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&RecordTableDecorator::m_glMap2xOES_record;
+this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&RecordTableDecorator::m_glEnd_record;
+this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&RecordTableDecorator::m_glMultiTexCoord2dARB_record;
+this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&RecordTableDecorator::m_glUniform1i64NV_record;
+this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&RecordTableDecorator::m_glPathStringNV_record;
+this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&RecordTableDecorator::m_glGetNamedFramebufferParameterivEXT_record;
+this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&RecordTableDecorator::m_glGetProgramNamedParameterdvNV_record;
+this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&RecordTableDecorator::m_glPathDashArrayNV_record;
+this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&RecordTableDecorator::m_glUniform3uiv_record;
+this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&RecordTableDecorator::m_glColor3fVertex3fvSUN_record;
+this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&RecordTableDecorator::m_glMultTransposeMatrixd_record;
+this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&RecordTableDecorator::m_glClearColor_record;
+this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&RecordTableDecorator::m_glGetImageHandleARB_record;
+this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&RecordTableDecorator::m_glTangent3dEXT_record;
+this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&RecordTableDecorator::m_glGetQueryObjectivARB_record;
+this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&RecordTableDecorator::m_glGetLocalConstantFloatvEXT_record;
+this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&RecordTableDecorator::m_glUseShaderProgramEXT_record;
+this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&RecordTableDecorator::m_glBindRenderbufferEXT_record;
+this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&RecordTableDecorator::m_glInterleavedArrays_record;
+this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&RecordTableDecorator::m_glGetPerfMonitorGroupStringAMD_record;
+this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&RecordTableDecorator::m_glUniform3ui_record;
+this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&RecordTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_record;
+this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&RecordTableDecorator::m_glDeleteQueryResourceTagNV_record;
+this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&RecordTableDecorator::m_glVertexAttribI4uiv_record;
+this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&RecordTableDecorator::m_glVertexAttrib4bv_record;
+this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&RecordTableDecorator::m_glMultiTexCoord3xOES_record;
+this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&RecordTableDecorator::m_glSecondaryColor3ub_record;
+this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&RecordTableDecorator::m_glFragmentMaterialfSGIX_record;
+this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&RecordTableDecorator::m_glGetVariantArrayObjectivATI_record;
+this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&RecordTableDecorator::m_glSecondaryColor3ui_record;
+this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&RecordTableDecorator::m_glVertexAttrib1dARB_record;
+this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&RecordTableDecorator::m_glGetNamedBufferPointerv_record;
+this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&RecordTableDecorator::m_glLockArraysEXT_record;
+this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&RecordTableDecorator::m_glVertexAttribPointerNV_record;
+this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&RecordTableDecorator::m_glConvolutionParameterf_record;
+this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&RecordTableDecorator::m_glBindBufferBaseEXT_record;
+this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&RecordTableDecorator::m_glTexCoord2xvOES_record;
+this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&RecordTableDecorator::m_glGetQueryBufferObjectui64v_record;
+this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&RecordTableDecorator::m_glSetMultisamplefvAMD_record;
+this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&RecordTableDecorator::m_glPathColorGenNV_record;
+this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&RecordTableDecorator::m_glVertexAttrib3sARB_record;
+this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&RecordTableDecorator::m_glVertexAttrib4ivARB_record;
+this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&RecordTableDecorator::m_glGenTransformFeedbacks_record;
+this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&RecordTableDecorator::m_glGetVertexAttribIuiv_record;
+this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&RecordTableDecorator::m_glPixelTransformParameterfEXT_record;
+this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&RecordTableDecorator::m_glGetTexParameterIuivEXT_record;
+this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&RecordTableDecorator::m_glGetObjectParameterivARB_record;
+this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&RecordTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_record;
+this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&RecordTableDecorator::m_glWindowPos2fARB_record;
+this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&RecordTableDecorator::m_glCompressedTexSubImage2D_record;
+this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&RecordTableDecorator::m_glCompressedTexSubImage3DARB_record;
+this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&RecordTableDecorator::m_glProgramBinary_record;
+this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&RecordTableDecorator::m_glPresentFrameKeyedNV_record;
+this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&RecordTableDecorator::m_glVertexAttribI4bv_record;
+this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&RecordTableDecorator::m_glPathCoverDepthFuncNV_record;
+this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&RecordTableDecorator::m_glTransformFeedbackStreamAttribsNV_record;
+this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&RecordTableDecorator::m_glSecondaryColor3usEXT_record;
+this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&RecordTableDecorator::m_glCopyColorTableSGI_record;
+this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&RecordTableDecorator::m_glProgramEnvParameter4fvARB_record;
+this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&RecordTableDecorator::m_glMultiTexCoord4sARB_record;
+this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&RecordTableDecorator::m_glGetVertexArrayIndexed64iv_record;
+this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&RecordTableDecorator::m_glMatrixMultTranspose3x3fNV_record;
+this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&RecordTableDecorator::m_glTexParameterIiv_record;
+this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&RecordTableDecorator::m_glVertexArrayAttribFormat_record;
+this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&RecordTableDecorator::m_glEndTransformFeedback_record;
+this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&RecordTableDecorator::m_glDrawCommandsStatesAddressNV_record;
+this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&RecordTableDecorator::m_glUniform4ui64NV_record;
+this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&RecordTableDecorator::m_glMaterialiv_record;
+this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&RecordTableDecorator::m_glTexImage2DMultisample_record;
+this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&RecordTableDecorator::m_glBindTextureEXT_record;
+this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&RecordTableDecorator::m_glIsBuffer_record;
+this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&RecordTableDecorator::m_glVertexAttribI1iv_record;
+this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&RecordTableDecorator::m_glGetFinalCombinerInputParameterfvNV_record;
+this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&RecordTableDecorator::m_glMultiTexCoord3bvOES_record;
+this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&RecordTableDecorator::m_glVertexAttribDivisor_record;
+this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&RecordTableDecorator::m_glCopyBufferSubData_record;
+this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&RecordTableDecorator::m_glBindTexGenParameterEXT_record;
+this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&RecordTableDecorator::m_glNormalStream3bATI_record;
+this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&RecordTableDecorator::m_glTexStorageMem2DEXT_record;
+this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&RecordTableDecorator::m_glTextureImage2DEXT_record;
+this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&RecordTableDecorator::m_glGetColorTableParameteriv_record;
+this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&RecordTableDecorator::m_glActiveTextureARB_record;
+this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&RecordTableDecorator::m_glTexCoord4xOES_record;
+this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&RecordTableDecorator::m_glNamedBufferStorageExternalEXT_record;
+this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&RecordTableDecorator::m_glSecondaryColor3fvEXT_record;
+this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&RecordTableDecorator::m_glUniformMatrix4x2fv_record;
+this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&RecordTableDecorator::m_glStartInstrumentsSGIX_record;
+this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&RecordTableDecorator::m_glProgramNamedParameter4fvNV_record;
+this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&RecordTableDecorator::m_glEndVideoCaptureNV_record;
+this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&RecordTableDecorator::m_glGenLists_record;
+this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&RecordTableDecorator::m_glUniform1fARB_record;
+this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&RecordTableDecorator::m_glNamedFramebufferTexture1DEXT_record;
+this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&RecordTableDecorator::m_glMapBufferRange_record;
+this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&RecordTableDecorator::m_glMultiDrawElementsIndirectCountARB_record;
+this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&RecordTableDecorator::m_glProgramUniformMatrix4x2fv_record;
+this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glGetTextureParameterIivEXT_record;
+this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&RecordTableDecorator::m_glMultiTexCoord3hNV_record;
+this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_record;
+this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&RecordTableDecorator::m_glEndList_record;
+this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&RecordTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_record;
+this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&RecordTableDecorator::m_glGenTransformFeedbacksNV_record;
+this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&RecordTableDecorator::m_glEdgeFlagv_record;
+this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&RecordTableDecorator::m_glVertexAttribI2iv_record;
+this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&RecordTableDecorator::m_glCopyMultiTexImage2DEXT_record;
+this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&RecordTableDecorator::m_glUniformMatrix3x2dv_record;
+this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&RecordTableDecorator::m_glTexImage3DMultisampleCoverageNV_record;
+this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&RecordTableDecorator::m_glGetShaderPrecisionFormat_record;
+this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&RecordTableDecorator::m_glTexSubImage4DSGIS_record;
+this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&RecordTableDecorator::m_glRasterSamplesEXT_record;
+this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&RecordTableDecorator::m_glTextureView_record;
+this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&RecordTableDecorator::m_glEvalMapsNV_record;
+this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&RecordTableDecorator::m_glGetFragDataLocationEXT_record;
+this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&RecordTableDecorator::m_glGetCompressedMultiTexImageEXT_record;
+this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&RecordTableDecorator::m_glIndexMask_record;
+this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&RecordTableDecorator::m_glPushClientAttrib_record;
+this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&RecordTableDecorator::m_glShaderSource_record;
+this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&RecordTableDecorator::m_glDispatchComputeGroupSizeARB_record;
+this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&RecordTableDecorator::m_glLGPUNamedBufferSubDataNVX_record;
+this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&RecordTableDecorator::m_glGetnPixelMapfv_record;
+this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&RecordTableDecorator::m_glTexCoordP2uiv_record;
+this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&RecordTableDecorator::m_glUniform2f_record;
+this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&RecordTableDecorator::m_glGetNamedBufferParameteri64v_record;
+this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&RecordTableDecorator::m_glCommandListSegmentsNV_record;
+this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&RecordTableDecorator::m_glTextureParameterIivEXT_record;
+this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&RecordTableDecorator::m_glMultiTexParameterfvEXT_record;
+this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&RecordTableDecorator::m_glProgramUniform2ui64ARB_record;
+this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&RecordTableDecorator::m_glVertex4d_record;
+this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glNewObjectBufferATI_record;
+this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&RecordTableDecorator::m_glViewportSwizzleNV_record;
+this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&RecordTableDecorator::m_glBufferData_record;
+this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&RecordTableDecorator::m_glTextureImage1DEXT_record;
+this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&RecordTableDecorator::m_glGetTexParameterIiv_record;
+this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&RecordTableDecorator::m_glCopyTexSubImage1DEXT_record;
+this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&RecordTableDecorator::m_glVertex4f_record;
+this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&RecordTableDecorator::m_glUniformMatrix3fvARB_record;
+this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&RecordTableDecorator::m_glTexCoordP1ui_record;
+this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&RecordTableDecorator::m_glPointParameterfvEXT_record;
+this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&RecordTableDecorator::m_glUniform4fARB_record;
+this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&RecordTableDecorator::m_glImportMemoryFdEXT_record;
+this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&RecordTableDecorator::m_glCopyTextureSubImage3D_record;
+this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&RecordTableDecorator::m_glMultiTexCoord2fv_record;
+this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&RecordTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_record;
+this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&RecordTableDecorator::m_glNormalP3ui_record;
+this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&RecordTableDecorator::m_glDrawRangeElementArrayATI_record;
+this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&RecordTableDecorator::m_glVertexAttribI1i_record;
+this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&RecordTableDecorator::m_glDrawArraysInstancedARB_record;
+this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&RecordTableDecorator::m_glEnableVertexAttribAPPLE_record;
+this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&RecordTableDecorator::m_glGetDebugMessageLogARB_record;
+this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&RecordTableDecorator::m_glGetPathTexGenfvNV_record;
+this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&RecordTableDecorator::m_glNamedProgramLocalParameters4fvEXT_record;
+this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&RecordTableDecorator::m_glQueryResourceTagNV_record;
+this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&RecordTableDecorator::m_glVertexStream3fvATI_record;
+this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&RecordTableDecorator::m_glFramebufferTexture3D_record;
+this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&RecordTableDecorator::m_glCompressedTextureSubImage2DEXT_record;
+this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&RecordTableDecorator::m_glWindowPos3dv_record;
+this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&RecordTableDecorator::m_glCopyConvolutionFilter2D_record;
+this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&RecordTableDecorator::m_glReadInstrumentsSGIX_record;
+this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&RecordTableDecorator::m_glProgramUniform2dvEXT_record;
+this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&RecordTableDecorator::m_glSamplerParameterfv_record;
+this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&RecordTableDecorator::m_glBindBufferARB_record;
+this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&RecordTableDecorator::m_glVertexAttrib1sNV_record;
+this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&RecordTableDecorator::m_glGetMaterialiv_record;
+this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&RecordTableDecorator::m_glUniform1fv_record;
+this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&RecordTableDecorator::m_glBeginOcclusionQueryNV_record;
+this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&RecordTableDecorator::m_glGenFencesAPPLE_record;
+this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&RecordTableDecorator::m_glScissorIndexedv_record;
+this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&RecordTableDecorator::m_glDisableVariantClientStateEXT_record;
+this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&RecordTableDecorator::m_glMinmaxEXT_record;
+this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&RecordTableDecorator::m_glNormalPointervINTEL_record;
+this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&RecordTableDecorator::m_glNormal3s_record;
+this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&RecordTableDecorator::m_glGetnPixelMapuiv_record;
+this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&RecordTableDecorator::m_glNormalStream3bvATI_record;
+this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&RecordTableDecorator::m_glGetObjectParameterivAPPLE_record;
+this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&RecordTableDecorator::m_glNormal3i_record;
+this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&RecordTableDecorator::m_glUniform1ivARB_record;
+this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&RecordTableDecorator::m_glNormal3d_record;
+this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&RecordTableDecorator::m_glUpdateObjectBufferATI_record;
+this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&RecordTableDecorator::m_glNormal3b_record;
+this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&RecordTableDecorator::m_glGetUniformBufferSizeEXT_record;
+this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&RecordTableDecorator::m_glMultiTexCoord4dv_record;
+this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&RecordTableDecorator::m_glProgramUniform3i64ARB_record;
+this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&RecordTableDecorator::m_glVertexAttrib2d_record;
+this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&RecordTableDecorator::m_glVertexAttrib2f_record;
+this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&RecordTableDecorator::m_glMultiDrawElementsEXT_record;
+this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&RecordTableDecorator::m_glVertexAttrib3dv_record;
+this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&RecordTableDecorator::m_glMultiTexCoord2bOES_record;
+this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&RecordTableDecorator::m_glVertexAttrib2s_record;
+this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&RecordTableDecorator::m_glTexImage3DMultisample_record;
+this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&RecordTableDecorator::m_glGetUniformBlockIndex_record;
+this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&RecordTableDecorator::m_glReleaseKeyedMutexWin32EXT_record;
+this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&RecordTableDecorator::m_glFrontFace_record;
+this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&RecordTableDecorator::m_glEvalCoord1xOES_record;
+this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&RecordTableDecorator::m_glDrawArraysInstancedBaseInstance_record;
+this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&RecordTableDecorator::m_glIsPointInStrokePathNV_record;
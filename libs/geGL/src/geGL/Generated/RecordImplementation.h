@@ -0,0 +1,2926 @@
+void m_glMultiDrawArraysIndirectBindlessCountNV_record(GLenum a0,const void* a1,GLsizei a2,GLsizei a3,GLsizei a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessCountNV>(a0,a1,a2,a3,a4,a5);}
+void m_glTextureParameterfv_record(GLuint a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC,&FunctionTable::m_ptr_glTextureParameterfv>(a0,a1,a2);}
+void m_glGetListParameterivSGIX_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetListParameterivSGIX");return (void)0;}
+void m_glProgramUniform1i64ARB_record(GLuint a0,GLint a1,GLint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC,&FunctionTable::m_ptr_glProgramUniform1i64ARB>(a0,a1,a2);}
+void m_glVertexArrayElementBuffer_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC,&FunctionTable::m_ptr_glVertexArrayElementBuffer>(a0,a1);}
+void m_glHintPGI_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLHINTPGIPROC,&FunctionTable::m_ptr_glHintPGI>(a0,a1);}
+void m_glStencilMaskSeparate_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC,&FunctionTable::m_ptr_glStencilMaskSeparate>(a0,a1);}
+void m_glGetFramebufferAttachmentParameterivEXT_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFramebufferAttachmentParameterivEXT");return (void)0;}
+void m_glTextureStorage3DMultisample_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTextureStorage3DMultisample>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetIntegerIndexedvEXT_record(GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetIntegerIndexedvEXT");return (void)0;}
+void m_glCopyTexImage1D_record(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC,&FunctionTable::m_ptr_glCopyTexImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttrib4usv_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC,&FunctionTable::m_ptr_glVertexAttrib4usv>(a0,a1);}
+void m_glTexRenderbufferNV_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC,&FunctionTable::m_ptr_glTexRenderbufferNV>(a0,a1);}
+void m_glVertexAttrib3hvNV_record(GLuint a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC,&FunctionTable::m_ptr_glVertexAttrib3hvNV>(a0,a1);}
+void m_glProgramUniform4ui64ARB_record(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3,GLuint64 a4,GLuint64 a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC,&FunctionTable::m_ptr_glProgramUniform4ui64ARB>(a0,a1,a2,a3,a4,a5);}
+void m_glInstrumentsBufferSGIX_record(GLsizei a0,GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC,&FunctionTable::m_ptr_glInstrumentsBufferSGIX>(a0,a1);}
+void m_glIndexi_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXIPROC,&FunctionTable::m_ptr_glIndexi>(a0);}
+void m_glMultiTexCoord2sARB_record(GLenum a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2sARB>(a0,a1,a2);}
+void m_glProgramEnvParameter4fARB_record(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC,&FunctionTable::m_ptr_glProgramEnvParameter4fARB>(a0,a1,a2,a3,a4,a5);}
+void m_glCompressedTexSubImage3D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const GLvoid* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC,&FunctionTable::m_ptr_glCompressedTexSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glEvalCoord2d_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2DPROC,&FunctionTable::m_ptr_glEvalCoord2d>(a0,a1);}
+void m_glEvalCoord2f_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2FPROC,&FunctionTable::m_ptr_glEvalCoord2f>(a0,a1);}
+void m_glIndexd_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXDPROC,&FunctionTable::m_ptr_glIndexd>(a0);}
+void m_glSecondaryColor3hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC,&FunctionTable::m_ptr_glSecondaryColor3hvNV>(a0);}
+void m_glIndexf_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXFPROC,&FunctionTable::m_ptr_glIndexf>(a0);}
+void m_glFrustumxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC,&FunctionTable::m_ptr_glFrustumxOES>(a0,a1,a2,a3,a4,a5);}
+void m_glTextureStorage3DEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC,&FunctionTable::m_ptr_glTextureStorage3DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glDrawCommandsStatesNV_record(GLuint a0,const GLintptr* a1,const GLsizei* a2,const GLuint* a3,const GLuint* a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC,&FunctionTable::m_ptr_glDrawCommandsStatesNV>(a0,a1,a2,a3,a4,a5);}
+void m_glUniform4uiEXT_record(GLint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC,&FunctionTable::m_ptr_glUniform4uiEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform3ui64ARB_record(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3,GLuint64 a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC,&FunctionTable::m_ptr_glProgramUniform3ui64ARB>(a0,a1,a2,a3,a4);}
+void m_glIndexs_record(GLshort a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXSPROC,&FunctionTable::m_ptr_glIndexs>(a0);}
+void m_glVertexArrayBindVertexBufferEXT_record(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC,&FunctionTable::m_ptr_glVertexArrayBindVertexBufferEXT>(a0,a1,a2,a3,a4);}
+void m_glConvolutionParameteriEXT_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC,&FunctionTable::m_ptr_glConvolutionParameteriEXT>(a0,a1,a2);}
+void m_glColor4ubVertex2fSUN_record(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC,&FunctionTable::m_ptr_glColor4ubVertex2fSUN>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramUniform1ivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC,&FunctionTable::m_ptr_glProgramUniform1ivEXT>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glGetnMapfv_record(GLenum,GLenum,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapfv");return (void)0;}
+void m_glTransformFeedbackBufferRange_record(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC,&FunctionTable::m_ptr_glTransformFeedbackBufferRange>(a0,a1,a2,a3,a4);}
+void m_glPathGlyphsNV_record(GLuint a0,GLenum a1,const void* a2,GLbitfield a3,GLsizei a4,GLenum a5,const void* a6,GLenum a7,GLuint a8,GLfloat a9)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC,&FunctionTable::m_ptr_glPathGlyphsNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glSecondaryColor3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC,&FunctionTable::m_ptr_glSecondaryColor3fv>(a0);}
+void m_glGetCombinerInputParameterivNV_record(GLenum,GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCombinerInputParameterivNV");return (void)0;}
+void m_glEndPerfMonitorAMD_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC,&FunctionTable::m_ptr_glEndPerfMonitorAMD>(a0);}
+void m_glPointParameterfvARB_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC,&FunctionTable::m_ptr_glPointParameterfvARB>(a0,a1);}
+void m_glVertex2xOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2XOESPROC,&FunctionTable::m_ptr_glVertex2xOES>(a0);}
+void m_glDrawElementsInstancedBaseInstance_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC,&FunctionTable::m_ptr_glDrawElementsInstancedBaseInstance>(a0,a1,a2,a3,a4,a5);}
+void m_glMultTransposeMatrixdARB_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC,&FunctionTable::m_ptr_glMultTransposeMatrixdARB>(a0);}
+void m_glVertexAttribL4dEXT_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC,&FunctionTable::m_ptr_glVertexAttribL4dEXT>(a0,a1,a2,a3,a4);}
+void m_glVertex4iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4IVPROC,&FunctionTable::m_ptr_glVertex4iv>(a0);}
+void m_glCoverStrokePathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLenum a5,const GLfloat* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glCoverStrokePathInstancedNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glDeformSGIX_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDEFORMSGIXPROC,&FunctionTable::m_ptr_glDeformSGIX>(a0);}
+void m_glUniform2ui64NV_record(GLint a0,GLuint64EXT a1,GLuint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC,&FunctionTable::m_ptr_glUniform2ui64NV>(a0,a1,a2);}
+void m_glCopyPathNV_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYPATHNVPROC,&FunctionTable::m_ptr_glCopyPathNV>(a0,a1);}
+void m_glVertexAttribP4ui_record(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC,&FunctionTable::m_ptr_glVertexAttribP4ui>(a0,a1,a2,a3);}
+void m_glVertexAttribL2d_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC,&FunctionTable::m_ptr_glVertexAttribL2d>(a0,a1,a2);}
+void m_glGetMultisamplefv_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultisamplefv");return (void)0;}
+void m_glCompressedMultiTexSubImage3DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLsizei a10,const void* a11)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_record(const void*,GLenum,GLsizei,const GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glVDPAURegisterOutputSurfaceNV");return (GLvdpauSurfaceNV)0;}
+void m_glMinSampleShading_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC,&FunctionTable::m_ptr_glMinSampleShading>(a0);}
+void m_glProgramUniform4fEXT_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC,&FunctionTable::m_ptr_glProgramUniform4fEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glCoverStrokePathNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC,&FunctionTable::m_ptr_glCoverStrokePathNV>(a0,a1);}
+void m_glTextureImage2DMultisampleNV_record(GLuint a0,GLenum a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC,&FunctionTable::m_ptr_glTextureImage2DMultisampleNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertex3bOES_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3BOESPROC,&FunctionTable::m_ptr_glVertex3bOES>(a0,a1,a2);}
+void m_glImportMemoryWin32HandleEXT_record(GLuint a0,GLuint64 a1,GLenum a2,void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC,&FunctionTable::m_ptr_glImportMemoryWin32HandleEXT>(a0,a1,a2,a3);}
+void m_glTessellationFactorAMD_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC,&FunctionTable::m_ptr_glTessellationFactorAMD>(a0);}
+void m_glDebugMessageControl_record(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,const GLuint* a4,GLboolean a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC,&FunctionTable::m_ptr_glDebugMessageControl>(a0,a1,a2,a3,a4,a5);}
+GLboolean m_glIsObjectBufferATI_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsObjectBufferATI");return (GLboolean)0;}
+void m_glPopAttrib_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPATTRIBPROC,&FunctionTable::m_ptr_glPopAttrib>();}
+void m_glProgramUniform4iEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC,&FunctionTable::m_ptr_glProgramUniform4iEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttrib4ubNV_record(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC,&FunctionTable::m_ptr_glVertexAttrib4ubNV>(a0,a1,a2,a3,a4);}
+void m_glColorMaterial_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORMATERIALPROC,&FunctionTable::m_ptr_glColorMaterial>(a0,a1);}
+void m_glVertexAttrib2svARB_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC,&FunctionTable::m_ptr_glVertexAttrib2svARB>(a0,a1);}
+void m_glMinSampleShadingARB_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC,&FunctionTable::m_ptr_glMinSampleShadingARB>(a0);}
+void m_glColor3b_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3BPROC,&FunctionTable::m_ptr_glColor3b>(a0,a1,a2);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glColor3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3FPROC,&FunctionTable::m_ptr_glColor3f>(a0,a1,a2);}
+void m_glVDPAUGetSurfaceivNV_record(GLvdpauSurfaceNV a0,GLenum a1,GLsizei a2,GLsizei* a3,GLint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC,&FunctionTable::m_ptr_glVDPAUGetSurfaceivNV>(a0,a1,a2,a3,a4);}
+void m_glColor3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3DPROC,&FunctionTable::m_ptr_glColor3d>(a0,a1,a2);}
+void m_glGetnMapiv_record(GLenum,GLenum,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapiv");return (void)0;}
+void m_glColor3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3IPROC,&FunctionTable::m_ptr_glColor3i>(a0,a1,a2);}
+void m_glGetInternalformatSampleivNV_record(GLenum,GLenum,GLsizei,GLenum,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInternalformatSampleivNV");return (void)0;}
+void m_glVertexAttrib4ubv_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC,&FunctionTable::m_ptr_glVertexAttrib4ubv>(a0,a1);}
+void m_glColor3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3SPROC,&FunctionTable::m_ptr_glColor3s>(a0,a1,a2);}
+void m_glVertexAttribs4hvNV_record(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC,&FunctionTable::m_ptr_glVertexAttribs4hvNV>(a0,a1,a2);}
+void m_glVertexAttrib4NubvARB_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NubvARB>(a0,a1);}
+void m_glMultiTexCoord3hvNV_record(GLenum a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC,&FunctionTable::m_ptr_glMultiTexCoord3hvNV>(a0,a1);}
+void m_glMatrixPushEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC,&FunctionTable::m_ptr_glMatrixPushEXT>(a0);}
+void m_glProgramUniform2fEXT_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC,&FunctionTable::m_ptr_glProgramUniform2fEXT>(a0,a1,a2,a3);}
+void m_glGetVertexArrayIndexediv_record(GLuint,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayIndexediv");return (void)0;}
+void m_glBlitFramebuffer_record(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLbitfield a8,GLenum a9)const{this->template m_record<FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC,&FunctionTable::m_ptr_glBlitFramebuffer>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glMultiTexCoordP2ui_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC,&FunctionTable::m_ptr_glMultiTexCoordP2ui>(a0,a1,a2);}
+void m_glColorPointerListIBM_record(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glColorPointerListIBM>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribL4d_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC,&FunctionTable::m_ptr_glVertexAttribL4d>(a0,a1,a2,a3,a4);}
+void m_glGetFragmentMaterialfvSGIX_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragmentMaterialfvSGIX");return (void)0;}
+void m_glVertex2iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2IVPROC,&FunctionTable::m_ptr_glVertex2iv>(a0);}
+void m_glGetTexEnvxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexEnvxvOES");return (void)0;}
+void m_glUniformMatrix3dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC,&FunctionTable::m_ptr_glUniformMatrix3dv>(a0,a1,a2,this->m_copy(a3,a1,3*3*sizeof(*a3)));}
+void m_glGetVertexAttribLdvEXT_record(GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribLdvEXT");return (void)0;}
+void m_glTexCoordP3uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC,&FunctionTable::m_ptr_glTexCoordP3uiv>(a0,a1);}
+void m_glDeformationMap3dSGIX_record(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,GLdouble a5,GLdouble a6,GLint a7,GLint a8,GLdouble a9,GLdouble a10,GLint a11,GLint a12,const GLdouble* a13)const{this->template m_record<FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC,&FunctionTable::m_ptr_glDeformationMap3dSGIX>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+void m_glResumeTransformFeedback_record()const{this->template m_record<FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glResumeTransformFeedback>();}
+void m_glInsertEventMarkerEXT_record(GLsizei a0,const GLchar* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC,&FunctionTable::m_ptr_glInsertEventMarkerEXT>(a0,a1);}
+void m_glTessellationModeAMD_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC,&FunctionTable::m_ptr_glTessellationModeAMD>(a0);}
+void m_glDrawCommandsAddressNV_record(GLenum a0,const GLuint64* a1,const GLsizei* a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC,&FunctionTable::m_ptr_glDrawCommandsAddressNV>(a0,a1,a2,a3);}
+void m_glFogi_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGIPROC,&FunctionTable::m_ptr_glFogi>(a0,a1);}
+void m_glGetTexParameterxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterxvOES");return (void)0;}
+void m_glVertexPointer_record(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC,&FunctionTable::m_ptr_glVertexPointer>(a0,a1,a2,a3);}
+void m_glGetPerfMonitorCounterDataAMD_record(GLuint,GLenum,GLsizei,GLuint*,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorCounterDataAMD");return (void)0;}
+void m_glFogf_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGFPROC,&FunctionTable::m_ptr_glFogf>(a0,a1);}
+void m_glMultiTexCoord1d_record(GLenum a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC,&FunctionTable::m_ptr_glMultiTexCoord1d>(a0,a1);}
+void m_glMultiTexCoord1f_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC,&FunctionTable::m_ptr_glMultiTexCoord1f>(a0,a1);}
+void m_glGetMultiTexParameterivEXT_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexParameterivEXT");return (void)0;}
+void m_glProgramUniformMatrix3x4fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x4fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*4*sizeof(*a4)));}
+void m_glVertexAttribI2i_record(GLuint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC,&FunctionTable::m_ptr_glVertexAttribI2i>(a0,a1,a2);}
+void m_glMultiTexCoord1i_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC,&FunctionTable::m_ptr_glMultiTexCoord1i>(a0,a1);}
+void m_glDeleteSemaphoresEXT_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC,&FunctionTable::m_ptr_glDeleteSemaphoresEXT>(a0,a1);}
+void m_glLoadProgramNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLubyte* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC,&FunctionTable::m_ptr_glLoadProgramNV>(a0,a1,a2,a3);}
+void m_glWriteMaskEXT_record(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{this->template m_record<FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC,&FunctionTable::m_ptr_glWriteMaskEXT>(a0,a1,a2,a3,a4,a5);}
+GLenum m_glGetGraphicsResetStatus_record()const{this->m_printUnrecordableFunctionErrorAndExit("glGetGraphicsResetStatus");return (GLenum)0;}
+void m_glVertexAttrib1fv_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC,&FunctionTable::m_ptr_glVertexAttrib1fv>(a0,a1);}
+void m_glMultiTexCoord1s_record(GLenum a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC,&FunctionTable::m_ptr_glMultiTexCoord1s>(a0,a1);}
+void m_glImageTransformParameterfvHP_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC,&FunctionTable::m_ptr_glImageTransformParameterfvHP>(a0,a1,a2);}
+void m_glFramebufferTexture2D_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC,&FunctionTable::m_ptr_glFramebufferTexture2D>(a0,a1,a2,a3,a4);}
+void m_glGetFragmentLightfvSGIX_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragmentLightfvSGIX");return (void)0;}
+void m_glListParameterfSGIX_record(GLuint a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC,&FunctionTable::m_ptr_glListParameterfSGIX>(a0,a1,a2);}
+void m_glTexCoord3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC,&FunctionTable::m_ptr_glTexCoord3sv>(a0);}
+void m_glNamedFramebufferRenderbufferEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC,&FunctionTable::m_ptr_glNamedFramebufferRenderbufferEXT>(a0,a1,a2,a3);}
+void m_glFragmentLightModelfSGIX_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC,&FunctionTable::m_ptr_glFragmentLightModelfSGIX>(a0,a1);}
+void m_glIndexPointerEXT_record(GLenum a0,GLsizei a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC,&FunctionTable::m_ptr_glIndexPointerEXT>(a0,a1,a2,a3);}
+void m_glBlendEquationSeparateATI_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC,&FunctionTable::m_ptr_glBlendEquationSeparateATI>(a0,a1);}
+void m_glVertexArrayAttribIFormat_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC,&FunctionTable::m_ptr_glVertexArrayAttribIFormat>(a0,a1,a2,a3,a4);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11,GLfloat a12)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+void m_glReplacementCodeubvSUN_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeubvSUN>(a0);}
+void m_glGenFramebuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenFramebuffers");return (void)0;}
+void m_glPixelMapx_record(GLenum a0,GLint a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELMAPXPROC,&FunctionTable::m_ptr_glPixelMapx>(a0,a1,a2);}
+void m_glTexSubImage3DEXT_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glTexSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glGetAttachedShaders_record(GLuint,GLsizei,GLsizei*,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetAttachedShaders");return (void)0;}
+void m_glGetPixelTexGenParameterfvSGIS_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelTexGenParameterfvSGIS");return (void)0;}
+void m_glReplacementCodeuiNormal3fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6);}
+GLuint m_glGetDebugMessageLogAMD_record(GLuint,GLsizei,GLenum*,GLuint*,GLuint*,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDebugMessageLogAMD");return (GLuint)0;}
+void m_glVertexStream4sATI_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC,&FunctionTable::m_ptr_glVertexStream4sATI>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribs4dvNV_record(GLuint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC,&FunctionTable::m_ptr_glVertexAttribs4dvNV>(a0,a1,a2);}
+void m_glGetnMapdvARB_record(GLenum,GLenum,GLsizei,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapdvARB");return (void)0;}
+void m_glOrthofOES_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLORTHOFOESPROC,&FunctionTable::m_ptr_glOrthofOES>(a0,a1,a2,a3,a4,a5);}
+void m_glViewportArrayv_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC,&FunctionTable::m_ptr_glViewportArrayv>(a0,a1,a2);}
+void m_glDrawElementArrayATI_record(GLenum a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC,&FunctionTable::m_ptr_glDrawElementArrayATI>(a0,a1);}
+void m_glBufferStorageMemEXT_record(GLenum a0,GLsizeiptr a1,GLuint a2,GLuint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC,&FunctionTable::m_ptr_glBufferStorageMemEXT>(a0,a1,a2,a3);}
+void m_glGetPathColorGenfvNV_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathColorGenfvNV");return (void)0;}
+void m_glWindowPos3iMESA_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC,&FunctionTable::m_ptr_glWindowPos3iMESA>(a0,a1,a2);}
+void m_glMultiTexCoord2s_record(GLenum a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC,&FunctionTable::m_ptr_glMultiTexCoord2s>(a0,a1,a2);}
+void m_glVertex3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3DVPROC,&FunctionTable::m_ptr_glVertex3dv>(a0);}
+void m_glVertexAttribI3uivEXT_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI3uivEXT>(a0,a1);}
+void m_glUniform3ui64ARB_record(GLint a0,GLuint64 a1,GLuint64 a2,GLuint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC,&FunctionTable::m_ptr_glUniform3ui64ARB>(a0,a1,a2,a3);}
+void m_glVertexAttrib2fvNV_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC,&FunctionTable::m_ptr_glVertexAttrib2fvNV>(a0,a1);}
+void m_glGetNamedBufferSubDataEXT_record(GLuint,GLintptr,GLsizeiptr,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferSubDataEXT");return (void)0;}
+void m_glConvolutionFilter2D_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC,&FunctionTable::m_ptr_glConvolutionFilter2D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glMemoryBarrierByRegion_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC,&FunctionTable::m_ptr_glMemoryBarrierByRegion>(a0);}
+void m_glVertexArrayBindingDivisor_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC,&FunctionTable::m_ptr_glVertexArrayBindingDivisor>(a0,a1,a2);}
+void m_glMatrixRotatedEXT_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC,&FunctionTable::m_ptr_glMatrixRotatedEXT>(a0,a1,a2,a3,a4);}
+void m_glTexCoord2sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC,&FunctionTable::m_ptr_glTexCoord2sv>(a0);}
+GLboolean m_glIsProgramNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsProgramNV");return (GLboolean)0;}
+void m_glUniform2dv_record(GLint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2DVPROC,&FunctionTable::m_ptr_glUniform2dv>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glGetPixelMapuiv_record(GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelMapuiv");return (void)0;}
+void m_glDepthBoundsEXT_record(GLclampd a0,GLclampd a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC,&FunctionTable::m_ptr_glDepthBoundsEXT>(a0,a1);}
+void m_glVertexAttrib4hvNV_record(GLuint a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC,&FunctionTable::m_ptr_glVertexAttrib4hvNV>(a0,a1);}
+void m_glMultiTexParameteriEXT_record(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC,&FunctionTable::m_ptr_glMultiTexParameteriEXT>(a0,a1,a2,a3);}
+void m_glGetPointerv_record(GLenum,GLvoid**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPointerv");return (void)0;}
+void m_glPathCommandsNV_record(GLuint a0,GLsizei a1,const GLubyte* a2,GLsizei a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC,&FunctionTable::m_ptr_glPathCommandsNV>(a0,a1,a2,a3,a4,a5);}
+void m_glGetListParameterfvSGIX_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetListParameterfvSGIX");return (void)0;}
+void m_glGetUniformuiv_record(GLuint,GLint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformuiv");return (void)0;}
+void m_glDebugMessageInsertAMD_record(GLenum a0,GLenum a1,GLuint a2,GLsizei a3,const GLchar* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC,&FunctionTable::m_ptr_glDebugMessageInsertAMD>(a0,a1,a2,a3,a4);}
+void m_glFrustum_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRUSTUMPROC,&FunctionTable::m_ptr_glFrustum>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttribL1ui64vNV_record(GLuint a0,const GLuint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL1ui64vNV>(a0,a1);}
+void m_glClearColorxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC,&FunctionTable::m_ptr_glClearColorxOES>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix3fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3fv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*3*sizeof(*a4)));}
+void m_glSampleMaskIndexedNV_record(GLuint a0,GLbitfield a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC,&FunctionTable::m_ptr_glSampleMaskIndexedNV>(a0,a1);}
+void m_glCompileShaderIncludeARB_record(GLuint a0,GLsizei a1,const GLchar*const* a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC,&FunctionTable::m_ptr_glCompileShaderIncludeARB>(a0,a1,a2,a3);}
+void m_glGetArrayObjectfvATI_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetArrayObjectfvATI");return (void)0;}
+void m_glVertexStream4svATI_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC,&FunctionTable::m_ptr_glVertexStream4svATI>(a0,a1);}
+void m_glMultiTexCoord4iARB_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4iARB>(a0,a1,a2,a3,a4);}
+void m_glVariantfvEXT_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC,&FunctionTable::m_ptr_glVariantfvEXT>(a0,a1);}
+void m_glMatrixLoadfEXT_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC,&FunctionTable::m_ptr_glMatrixLoadfEXT>(a0,a1);}
+void m_glLoadIdentityDeformationMapSGIX_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC,&FunctionTable::m_ptr_glLoadIdentityDeformationMapSGIX>(a0);}
+void m_glGetRenderbufferParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetRenderbufferParameteriv");return (void)0;}
+void m_glProgramUniform3fEXT_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC,&FunctionTable::m_ptr_glProgramUniform3fEXT>(a0,a1,a2,a3,a4);}
+void m_glNamedRenderbufferStorage_record(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC,&FunctionTable::m_ptr_glNamedRenderbufferStorage>(a0,a1,a2,a3);}
+void m_glBindFragDataLocation_record(GLuint a0,GLuint a1,const GLchar* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC,&FunctionTable::m_ptr_glBindFragDataLocation>(a0,a1,a2);}
+void m_glPolygonOffsetClamp_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC,&FunctionTable::m_ptr_glPolygonOffsetClamp>(a0,a1,a2);}
+void m_glFogCoordPointerListIBM_record(GLenum a0,GLint a1,const void** a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glFogCoordPointerListIBM>(a0,a1,a2,a3);}
+GLsync m_glFenceSync_record(GLenum,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glFenceSync");return (GLsync)0;}
+void m_glGetVertexAttribIivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribIivEXT");return (void)0;}
+void m_glFramebufferDrawBuffersEXT_record(GLuint a0,GLsizei a1,const GLenum* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC,&FunctionTable::m_ptr_glFramebufferDrawBuffersEXT>(a0,a1,a2);}
+void m_glVertexAttribs4fvNV_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC,&FunctionTable::m_ptr_glVertexAttribs4fvNV>(a0,a1,a2);}
+void m_glPauseTransformFeedbackNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glPauseTransformFeedbackNV>();}
+void m_glGetQueryObjecti64vEXT_record(GLuint,GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjecti64vEXT");return (void)0;}
+void m_glVDPAUSurfaceAccessNV_record(GLvdpauSurfaceNV a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC,&FunctionTable::m_ptr_glVDPAUSurfaceAccessNV>(a0,a1);}
+void m_glValidateProgramPipeline_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC,&FunctionTable::m_ptr_glValidateProgramPipeline>(a0);}
+void m_glTexPageCommitmentARB_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC,&FunctionTable::m_ptr_glTexPageCommitmentARB>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glWindowPos3dvARB_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC,&FunctionTable::m_ptr_glWindowPos3dvARB>(a0);}
+void m_glStencilStrokePathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLint a4,GLuint a5,GLenum a6,const GLfloat* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glStencilStrokePathInstancedNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glFogfv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGFVPROC,&FunctionTable::m_ptr_glFogfv>(a0,a1);}
+void m_glGenQueriesARB_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenQueriesARB");return (void)0;}
+void m_glProgramUniform2i64NV_record(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC,&FunctionTable::m_ptr_glProgramUniform2i64NV>(a0,a1,a2,a3);}
+void m_glVertexP4ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP4UIPROC,&FunctionTable::m_ptr_glVertexP4ui>(a0,a1);}
+void m_glVertexStream1ivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC,&FunctionTable::m_ptr_glVertexStream1ivATI>(a0,a1);}
+void m_glProgramEnvParameterI4iNV_record(GLenum a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC,&FunctionTable::m_ptr_glProgramEnvParameterI4iNV>(a0,a1,a2,a3,a4,a5);}
+void m_glGenVertexArraysAPPLE_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenVertexArraysAPPLE");return (void)0;}
+void m_glDrawTransformFeedbackInstanced_record(GLenum a0,GLuint a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC,&FunctionTable::m_ptr_glDrawTransformFeedbackInstanced>(a0,a1,a2);}
+void m_glStencilThenCoverStrokePathNV_record(GLuint a0,GLint a1,GLuint a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC,&FunctionTable::m_ptr_glStencilThenCoverStrokePathNV>(a0,a1,a2,a3);}
+void m_glDeleteVertexArraysAPPLE_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC,&FunctionTable::m_ptr_glDeleteVertexArraysAPPLE>(a0,a1);}
+void m_glGetNamedBufferParameterui64vNV_record(GLuint,GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferParameterui64vNV");return (void)0;}
+GLbitfield m_glQueryMatrixxOES_record(GLfixed*,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glQueryMatrixxOES");return (GLbitfield)0;}
+void m_glSecondaryColor3usv_record(const GLushort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC,&FunctionTable::m_ptr_glSecondaryColor3usv>(a0);}
+void m_glTranslatexOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC,&FunctionTable::m_ptr_glTranslatexOES>(a0,a1,a2);}
+void m_glDrawTransformFeedback_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glDrawTransformFeedback>(a0,a1);}
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN>(a0,a1,a2,a3);}
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_record(const void*,GLenum,GLsizei,const GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glVDPAURegisterVideoSurfaceNV");return (GLvdpauSurfaceNV)0;}
+void m_glGetTexParameterIuiv_record(GLenum,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterIuiv");return (void)0;}
+void m_glBindBufferBaseNV_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC,&FunctionTable::m_ptr_glBindBufferBaseNV>(a0,a1,a2);}
+void m_glIndexPointer_record(GLenum a0,GLsizei a1,const GLvoid* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXPOINTERPROC,&FunctionTable::m_ptr_glIndexPointer>(a0,a1,a2);}
+void m_glGenQueryResourceTagNV_record(GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenQueryResourceTagNV");return (void)0;}
+void m_glVertexAttrib4Nbv_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC,&FunctionTable::m_ptr_glVertexAttrib4Nbv>(a0,a1);}
+void m_glListParameteriSGIX_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC,&FunctionTable::m_ptr_glListParameteriSGIX>(a0,a1,a2);}
+void m_glBlendColorxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC,&FunctionTable::m_ptr_glBlendColorxOES>(a0,a1,a2,a3);}
+void m_glUniformui64vNV_record(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC,&FunctionTable::m_ptr_glUniformui64vNV>(a0,a1,a2);}
+GLboolean m_glIsSync_record(GLsync)const{this->m_printUnrecordableFunctionErrorAndExit("glIsSync");return (GLboolean)0;}
+void m_glGetTextureParameterivEXT_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterivEXT");return (void)0;}
+void m_glFogCoordhvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC,&FunctionTable::m_ptr_glFogCoordhvNV>(a0);}
+void m_glFramebufferTextureLayerEXT_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC,&FunctionTable::m_ptr_glFramebufferTextureLayerEXT>(a0,a1,a2,a3,a4);}
+void m_glGetObjectPtrLabel_record(const void*,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectPtrLabel");return (void)0;}
+void m_glTextureParameteri_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC,&FunctionTable::m_ptr_glTextureParameteri>(a0,a1,a2);}
+void m_glMultiTexCoord1fARB_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1fARB>(a0,a1);}
+void m_glUniformMatrix2x3dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC,&FunctionTable::m_ptr_glUniformMatrix2x3dv>(a0,a1,a2,this->m_copy(a3,a1,2*3*sizeof(*a3)));}
+void m_glFramebufferDrawBufferEXT_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC,&FunctionTable::m_ptr_glFramebufferDrawBufferEXT>(a0,a1);}
+void m_glCopyColorSubTable_record(GLenum a0,GLsizei a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC,&FunctionTable::m_ptr_glCopyColorSubTable>(a0,a1,a2,a3,a4);}
+void m_glGetNamedFramebufferParameterfvAMD_record(GLuint,GLenum,GLuint,GLuint,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedFramebufferParameterfvAMD");return (void)0;}
+void m_glVertexAttribL3d_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC,&FunctionTable::m_ptr_glVertexAttribL3d>(a0,a1,a2,a3);}
+void m_glFragmentMaterialfvSGIX_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC,&FunctionTable::m_ptr_glFragmentMaterialfvSGIX>(a0,a1,a2);}
+void m_glMatrixLoadTranspose3x3fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC,&FunctionTable::m_ptr_glMatrixLoadTranspose3x3fNV>(a0,a1);}
+void m_glDeleteNamesAMD_record(GLenum a0,GLuint a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC,&FunctionTable::m_ptr_glDeleteNamesAMD>(a0,a1,a2);}
+void m_glDrawRangeElementsEXT_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC,&FunctionTable::m_ptr_glDrawRangeElementsEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glOrtho_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLORTHOPROC,&FunctionTable::m_ptr_glOrtho>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramUniform1dvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC,&FunctionTable::m_ptr_glProgramUniform1dvEXT>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glColor4xOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4XOESPROC,&FunctionTable::m_ptr_glColor4xOES>(a0,a1,a2,a3);}
+void m_glTexImage4DSGIS_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC,&FunctionTable::m_ptr_glTexImage4DSGIS>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glProgramUniform1ui_record(GLuint a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC,&FunctionTable::m_ptr_glProgramUniform1ui>(a0,a1,a2);}
+void m_glDeleteBuffersARB_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC,&FunctionTable::m_ptr_glDeleteBuffersARB>(a0,a1);}
+GLboolean m_glUnmapBufferARB_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glUnmapBufferARB");return (GLboolean)0;}
+void m_glCopyTexImage2D_record(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLint a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC,&FunctionTable::m_ptr_glCopyTexImage2D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glMaterialxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALXOESPROC,&FunctionTable::m_ptr_glMaterialxOES>(a0,a1,a2);}
+void m_glProgramUniformMatrix2x4fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x4fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*4*sizeof(*a4)));}
+GLboolean m_glTestObjectAPPLE_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glTestObjectAPPLE");return (GLboolean)0;}
+void m_glRenderbufferStorageEXT_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC,&FunctionTable::m_ptr_glRenderbufferStorageEXT>(a0,a1,a2,a3);}
+void m_glVertexAttribL1ui64ARB_record(GLuint a0,GLuint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC,&FunctionTable::m_ptr_glVertexAttribL1ui64ARB>(a0,a1);}
+void m_glEndFragmentShaderATI_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC,&FunctionTable::m_ptr_glEndFragmentShaderATI>();}
+void m_glPathParameterivNV_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC,&FunctionTable::m_ptr_glPathParameterivNV>(a0,a1,a2);}
+void m_glUniform4uiv_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC,&FunctionTable::m_ptr_glUniform4uiv>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glFrameZoomSGIX_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC,&FunctionTable::m_ptr_glFrameZoomSGIX>(a0);}
+void m_glSecondaryColor3fEXT_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3fEXT>(a0,a1,a2);}
+void m_glLGPUInterlockNVX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC,&FunctionTable::m_ptr_glLGPUInterlockNVX>();}
+void m_glVertexAttribL1dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC,&FunctionTable::m_ptr_glVertexAttribL1dv>(a0,a1);}
+void m_glNormalStream3svATI_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC,&FunctionTable::m_ptr_glNormalStream3svATI>(a0,a1);}
+void m_glPathStencilFuncNV_record(GLenum a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC,&FunctionTable::m_ptr_glPathStencilFuncNV>(a0,a1,a2);}
+void m_glSetInvariantEXT_record(GLuint a0,GLenum a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC,&FunctionTable::m_ptr_glSetInvariantEXT>(a0,a1,a2);}
+void m_glGetTexBumpParameterivATI_record(GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexBumpParameterivATI");return (void)0;}
+void m_glBlendEquationSeparateEXT_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC,&FunctionTable::m_ptr_glBlendEquationSeparateEXT>(a0,a1);}
+void m_glEndOcclusionQueryNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC,&FunctionTable::m_ptr_glEndOcclusionQueryNV>();}
+void m_glScissorArrayv_record(GLuint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC,&FunctionTable::m_ptr_glScissorArrayv>(a0,a1,a2);}
+void m_glCallList_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCALLLISTPROC,&FunctionTable::m_ptr_glCallList>(a0);}
+void* m_glMapTexture2DINTEL_record(GLuint,GLint,GLbitfield,GLint*,GLenum*)const{this->m_printUnrecordableFunctionErrorAndExit("glMapTexture2DINTEL");return (void*)0;}
+GLVULKANPROCNV m_glGetVkProcAddrNV_record(const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVkProcAddrNV");return (GLVULKANPROCNV)0;}
+void m_glPixelTransferxOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC,&FunctionTable::m_ptr_glPixelTransferxOES>(a0,a1);}
+void m_glDeleteRenderbuffersEXT_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC,&FunctionTable::m_ptr_glDeleteRenderbuffersEXT>(a0,a1);}
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11,GLfloat a12,GLfloat a13,GLfloat a14)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC,&FunctionTable::m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+void m_glProgramUniformMatrix4dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*4*sizeof(*a4)));}
+void m_glGetnColorTable_record(GLenum,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnColorTable");return (void)0;}
+void m_glFramebufferTextureLayerARB_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC,&FunctionTable::m_ptr_glFramebufferTextureLayerARB>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribL2dvEXT_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC,&FunctionTable::m_ptr_glVertexAttribL2dvEXT>(a0,a1);}
+void m_glGetCombinerStageParameterfvNV_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCombinerStageParameterfvNV");return (void)0;}
+void m_glMultiTexCoord1xvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord1xvOES>(a0,a1);}
+void* m_glMapBuffer_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glMapBuffer");return (void*)0;}
+void m_glSecondaryColor3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC,&FunctionTable::m_ptr_glSecondaryColor3d>(a0,a1,a2);}
+void m_glSecondaryColor3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC,&FunctionTable::m_ptr_glSecondaryColor3f>(a0,a1,a2);}
+void m_glVertexAttribLFormat_record(GLuint a0,GLint a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC,&FunctionTable::m_ptr_glVertexAttribLFormat>(a0,a1,a2,a3);}
+void m_glElementPointerAPPLE_record(GLenum a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC,&FunctionTable::m_ptr_glElementPointerAPPLE>(a0,a1);}
+void m_glVertexStream1fATI_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC,&FunctionTable::m_ptr_glVertexStream1fATI>(a0,a1);}
+void m_glCoverageModulationNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC,&FunctionTable::m_ptr_glCoverageModulationNV>(a0);}
+void m_glSecondaryColor3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC,&FunctionTable::m_ptr_glSecondaryColor3i>(a0,a1,a2);}
+void m_glDeleteSync_record(GLsync a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETESYNCPROC,&FunctionTable::m_ptr_glDeleteSync>(a0);}
+void m_glGetProgramParameterfvNV_record(GLenum,GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramParameterfvNV");return (void)0;}
+void m_glMaxShaderCompilerThreadsARB_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC,&FunctionTable::m_ptr_glMaxShaderCompilerThreadsARB>(a0);}
+void m_glUniformMatrix4x2dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC,&FunctionTable::m_ptr_glUniformMatrix4x2dv>(a0,a1,a2,this->m_copy(a3,a1,4*2*sizeof(*a3)));}
+void m_glVertexArrayVertexAttribLOffsetEXT_record(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribLOffsetEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glSecondaryColor3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC,&FunctionTable::m_ptr_glSecondaryColor3s>(a0,a1,a2);}
+GLboolean m_glIsImageHandleResidentNV_record(GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glIsImageHandleResidentNV");return (GLboolean)0;}
+void m_glUniform3iv_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3IVPROC,&FunctionTable::m_ptr_glUniform3iv>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glVertexAttribL3i64vNV_record(GLuint a0,const GLint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL3i64vNV>(a0,a1);}
+void m_glPolygonMode_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONMODEPROC,&FunctionTable::m_ptr_glPolygonMode>(a0,a1);}
+void m_glFramebufferSamplePositionsfvAMD_record(GLenum a0,GLuint a1,GLuint a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC,&FunctionTable::m_ptr_glFramebufferSamplePositionsfvAMD>(a0,a1,a2,a3);}
+void m_glConvolutionFilter1DEXT_record(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC,&FunctionTable::m_ptr_glConvolutionFilter1DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttrib1dvARB_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC,&FunctionTable::m_ptr_glVertexAttrib1dvARB>(a0,a1);}
+void m_glTextureSubImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLenum a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glTextureSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+GLboolean m_glIsVertexArrayAPPLE_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsVertexArrayAPPLE");return (GLboolean)0;}
+void m_glUseProgram_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLUSEPROGRAMPROC,&FunctionTable::m_ptr_glUseProgram>(a0);}
+void m_glLineStipple_record(GLint a0,GLushort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLINESTIPPLEPROC,&FunctionTable::m_ptr_glLineStipple>(a0,a1);}
+void m_glMultiTexCoord4fvARB_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4fvARB>(a0,a1);}
+GLenum m_glVideoCaptureNV_record(GLuint,GLuint*,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glVideoCaptureNV");return (GLenum)0;}
+void m_glVertexArrayVertexAttribLFormatEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribLFormatEXT>(a0,a1,a2,a3,a4);}
+void m_glUniform3fvARB_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC,&FunctionTable::m_ptr_glUniform3fvARB>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glProgramUniformMatrix3x2fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x2fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*2*sizeof(*a4)));}
+void m_glCopyTextureSubImage3DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLsizei a8,GLsizei a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCopyTextureSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glMultiTexCoord2bvOES_record(GLenum a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord2bvOES>(a0,a1);}
+void m_glDeleteObjectARB_record(GLhandleARB a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC,&FunctionTable::m_ptr_glDeleteObjectARB>(a0);}
+void m_glTextureLightEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC,&FunctionTable::m_ptr_glTextureLightEXT>(a0);}
+void m_glRasterPos3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3IPROC,&FunctionTable::m_ptr_glRasterPos3i>(a0,a1,a2);}
+void m_glMultiTexCoord3dARB_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3dARB>(a0,a1,a2,a3);}
+void m_glNamedFramebufferTextureEXT_record(GLuint a0,GLenum a1,GLuint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTextureEXT>(a0,a1,a2,a3);}
+void m_glTextureParameteriEXT_record(GLuint a0,GLenum a1,GLenum a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC,&FunctionTable::m_ptr_glTextureParameteriEXT>(a0,a1,a2,a3);}
+void m_glEvalCoord2xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC,&FunctionTable::m_ptr_glEvalCoord2xvOES>(a0);}
+void m_glBindVideoCaptureStreamBufferNV_record(GLuint a0,GLuint a1,GLenum a2,GLintptrARB a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC,&FunctionTable::m_ptr_glBindVideoCaptureStreamBufferNV>(a0,a1,a2,a3);}
+void m_glTexImage2DMultisampleCoverageNV_record(GLenum a0,GLsizei a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC,&FunctionTable::m_ptr_glTexImage2DMultisampleCoverageNV>(a0,a1,a2,a3,a4,a5,a6);}
+GLint m_glGetAttribLocationARB_record(GLhandleARB,const GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetAttribLocationARB");return (GLint)0;}
+void m_glDeleteShader_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETESHADERPROC,&FunctionTable::m_ptr_glDeleteShader>(a0);}
+void m_glVertexAttrib1fARB_record(GLuint a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC,&FunctionTable::m_ptr_glVertexAttrib1fARB>(a0,a1);}
+void m_glTexCoord2fColor4ubVertex3fSUN_record(GLfloat a0,GLfloat a1,GLubyte a2,GLubyte a3,GLubyte a4,GLubyte a5,GLfloat a6,GLfloat a7,GLfloat a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor4ubVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glTexCoord4fVertex4fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC,&FunctionTable::m_ptr_glTexCoord4fVertex4fSUN>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetMapdv_record(GLenum,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapdv");return (void)0;}
+void m_glMapParameterfvNV_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC,&FunctionTable::m_ptr_glMapParameterfvNV>(a0,a1,a2);}
+void m_glTextureParameterIuiv_record(GLuint a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC,&FunctionTable::m_ptr_glTextureParameterIuiv>(a0,a1,a2);}
+void m_glTransformFeedbackAttribsNV_record(GLsizei a0,const GLint* a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC,&FunctionTable::m_ptr_glTransformFeedbackAttribsNV>(a0,a1,a2);}
+void m_glFragmentLightfvSGIX_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC,&FunctionTable::m_ptr_glFragmentLightfvSGIX>(a0,a1,a2);}
+void m_glWindowPos3sARB_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC,&FunctionTable::m_ptr_glWindowPos3sARB>(a0,a1,a2);}
+void m_glGetConvolutionParameterfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionParameterfv");return (void)0;}
+void m_glCopyTexSubImage3D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC,&FunctionTable::m_ptr_glCopyTexSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glVertexAttribI3i_record(GLuint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC,&FunctionTable::m_ptr_glVertexAttribI3i>(a0,a1,a2,a3);}
+GLhandleARB m_glCreateShaderObjectARB_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateShaderObjectARB");return (GLhandleARB)0;}
+void m_glVertexAttribFormat_record(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC,&FunctionTable::m_ptr_glVertexAttribFormat>(a0,a1,a2,a3,a4);}
+void m_glGetProgramivARB_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramivARB");return (void)0;}
+void m_glVertexAttribI4usv_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC,&FunctionTable::m_ptr_glVertexAttribI4usv>(a0,a1);}
+void m_glTexParameterf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC,&FunctionTable::m_ptr_glTexParameterf>(a0,a1,a2);}
+void m_glVertexAttribBinding_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC,&FunctionTable::m_ptr_glVertexAttribBinding>(a0,a1);}
+void m_glGetHistogramParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramParameteriv");return (void)0;}
+void m_glTexParameteri_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC,&FunctionTable::m_ptr_glTexParameteri>(a0,a1,a2);}
+void m_glGetShaderSource_record(GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetShaderSource");return (void)0;}
+void m_glVertexAttrib4s_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC,&FunctionTable::m_ptr_glVertexAttrib4s>(a0,a1,a2,a3,a4);}
+void m_glVertexAttrib4dvNV_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC,&FunctionTable::m_ptr_glVertexAttrib4dvNV>(a0,a1);}
+void m_glVertexAttrib1dvNV_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC,&FunctionTable::m_ptr_glVertexAttrib1dvNV>(a0,a1);}
+void m_glPopName_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPNAMEPROC,&FunctionTable::m_ptr_glPopName>();}
+void m_glTextureBufferEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC,&FunctionTable::m_ptr_glTextureBufferEXT>(a0,a1,a2,a3);}
+void m_glGetMultiTexImageEXT_record(GLenum,GLenum,GLint,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexImageEXT");return (void)0;}
+void m_glGetPointerIndexedvEXT_record(GLenum,GLuint,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPointerIndexedvEXT");return (void)0;}
+GLboolean m_glIsNameAMD_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsNameAMD");return (GLboolean)0;}
+void m_glColor4ub_record(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBPROC,&FunctionTable::m_ptr_glColor4ub>(a0,a1,a2,a3);}
+void m_glBufferParameteriAPPLE_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC,&FunctionTable::m_ptr_glBufferParameteriAPPLE>(a0,a1,a2);}
+void m_glColor4ui_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UIPROC,&FunctionTable::m_ptr_glColor4ui>(a0,a1,a2,a3);}
+void m_glGetInternalformativ_record(GLenum,GLenum,GLenum,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInternalformativ");return (void)0;}
+void m_glColor4us_record(GLushort a0,GLushort a1,GLushort a2,GLushort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4USPROC,&FunctionTable::m_ptr_glColor4us>(a0,a1,a2,a3);}
+void m_glVertexAttribP1uiv_record(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC,&FunctionTable::m_ptr_glVertexAttribP1uiv>(a0,a1,a2,a3);}
+void m_glLinkProgram_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLINKPROGRAMPROC,&FunctionTable::m_ptr_glLinkProgram>(a0);}
+void m_glTexCoord3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3SPROC,&FunctionTable::m_ptr_glTexCoord3s>(a0,a1,a2);}
+void m_glTexCoord2dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC,&FunctionTable::m_ptr_glTexCoord2dv>(a0);}
+void m_glGetObjectLabel_record(GLenum,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectLabel");return (void)0;}
+void m_glVertexPointerEXT_record(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC,&FunctionTable::m_ptr_glVertexPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glDebugMessageCallbackARB_record(GLDEBUGPROCARB a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC,&FunctionTable::m_ptr_glDebugMessageCallbackARB>(a0,a1);}
+const GLubyte* m_glGetString_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGetString");return (const GLubyte*)0;}
+void m_glGetPathParameterfvNV_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathParameterfvNV");return (void)0;}
+void m_glLightxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTXVOESPROC,&FunctionTable::m_ptr_glLightxvOES>(a0,a1,a2);}
+void m_glEndQuery_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENDQUERYPROC,&FunctionTable::m_ptr_glEndQuery>(a0);}
+void m_glSecondaryColor3uiv_record(const GLuint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC,&FunctionTable::m_ptr_glSecondaryColor3uiv>(a0);}
+void m_glPrioritizeTexturesxOES_record(GLsizei a0,const GLuint* a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC,&FunctionTable::m_ptr_glPrioritizeTexturesxOES>(a0,a1,a2);}
+void m_glEdgeFlagPointer_record(GLsizei a0,const GLvoid* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC,&FunctionTable::m_ptr_glEdgeFlagPointer>(a0,a1);}
+void m_glFramebufferParameteri_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC,&FunctionTable::m_ptr_glFramebufferParameteri>(a0,a1,a2);}
+void m_glTexCoord3hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC,&FunctionTable::m_ptr_glTexCoord3hNV>(a0,a1,a2);}
+void m_glMultiModeDrawElementsIBM_record(const GLenum* a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC,&FunctionTable::m_ptr_glMultiModeDrawElementsIBM>(a0,a1,a2,a3,a4,a5);}
+void m_glCopyPixels_record(GLint a0,GLint a1,GLsizei a2,GLsizei a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYPIXELSPROC,&FunctionTable::m_ptr_glCopyPixels>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribI2ui_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC,&FunctionTable::m_ptr_glVertexAttribI2ui>(a0,a1,a2);}
+void m_glClampColorARB_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC,&FunctionTable::m_ptr_glClampColorARB>(a0,a1);}
+void m_glColorPointervINTEL_record(GLint a0,GLenum a1,const void** a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC,&FunctionTable::m_ptr_glColorPointervINTEL>(a0,a1,a2);}
+void m_glDeleteTextures_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETETEXTURESPROC,&FunctionTable::m_ptr_glDeleteTextures>(a0,a1);}
+void m_glGetMinmaxParameterfvEXT_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmaxParameterfvEXT");return (void)0;}
+void m_glWindowPos3sMESA_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC,&FunctionTable::m_ptr_glWindowPos3sMESA>(a0,a1,a2);}
+void m_glVertexAttrib4f_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC,&FunctionTable::m_ptr_glVertexAttrib4f>(a0,a1,a2,a3,a4);}
+void m_glNamedFramebufferParameteri_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC,&FunctionTable::m_ptr_glNamedFramebufferParameteri>(a0,a1,a2);}
+void m_glTexCoord2fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glTexCoord2fVertex3fvSUN>(a0,a1);}
+void m_glReplacementCodeusSUN_record(GLushort a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC,&FunctionTable::m_ptr_glReplacementCodeusSUN>(a0);}
+void m_glGetNamedFramebufferParameteriv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedFramebufferParameteriv");return (void)0;}
+void m_glVertexStream1fvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC,&FunctionTable::m_ptr_glVertexStream1fvATI>(a0,a1);}
+void m_glCreateVertexArrays_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateVertexArrays");return (void)0;}
+void m_glBeginConditionalRender_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC,&FunctionTable::m_ptr_glBeginConditionalRender>(a0,a1);}
+void m_glGetUnsignedBytevEXT_record(GLenum,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUnsignedBytevEXT");return (void)0;}
+void m_glConvolutionFilter1D_record(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC,&FunctionTable::m_ptr_glConvolutionFilter1D>(a0,a1,a2,a3,a4,a5);}
+void m_glMultiTexCoord3fARB_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3fARB>(a0,a1,a2,a3);}
+void m_glGetQueryObjectuivARB_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectuivARB");return (void)0;}
+void m_glScalexOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSCALEXOESPROC,&FunctionTable::m_ptr_glScalexOES>(a0,a1,a2);}
+void m_glSamplerParameteri_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC,&FunctionTable::m_ptr_glSamplerParameteri>(a0,a1,a2);}
+void m_glSamplerParameterf_record(GLuint a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC,&FunctionTable::m_ptr_glSamplerParameterf>(a0,a1,a2);}
+void m_glShaderOp1EXT_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC,&FunctionTable::m_ptr_glShaderOp1EXT>(a0,a1,a2);}
+void m_glBeginVideoCaptureNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC,&FunctionTable::m_ptr_glBeginVideoCaptureNV>(a0);}
+void m_glGetnHistogram_record(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnHistogram");return (void)0;}
+void m_glUniform1d_record(GLint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1DPROC,&FunctionTable::m_ptr_glUniform1d>(a0,a1);}
+GLint m_glRenderMode_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glRenderMode");return (GLint)0;}
+void m_glClearColorIiEXT_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC,&FunctionTable::m_ptr_glClearColorIiEXT>(a0,a1,a2,a3);}
+void m_glSignalSemaphoreEXT_record(GLuint a0,GLuint a1,const GLuint* a2,GLuint a3,const GLuint* a4,const GLenum* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC,&FunctionTable::m_ptr_glSignalSemaphoreEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glGetCompressedTexImage_record(GLenum,GLint,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedTexImage");return (void)0;}
+void m_glCompressedTextureImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetActiveUniformBlockiv_record(GLuint,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniformBlockiv");return (void)0;}
+void m_glUniform1i_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1IPROC,&FunctionTable::m_ptr_glUniform1i>(a0,a1);}
+void m_glMultiDrawArraysIndirectCount_record(GLenum a0,const void* a1,GLintptr a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirectCount>(a0,a1,a2,a3,a4);}
+void m_glGetTexEnvfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexEnvfv");return (void)0;}
+void m_glColorTableParameterivSGI_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC,&FunctionTable::m_ptr_glColorTableParameterivSGI>(a0,a1,a2);}
+void m_glCullFace_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCULLFACEPROC,&FunctionTable::m_ptr_glCullFace>(a0);}
+void m_glDeleteFencesAPPLE_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC,&FunctionTable::m_ptr_glDeleteFencesAPPLE>(a0,a1);}
+void m_glProgramUniform4i_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC,&FunctionTable::m_ptr_glProgramUniform4i>(a0,a1,a2,a3,a4,a5);}
+void m_glUniformHandleui64ARB_record(GLint a0,GLuint64 a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC,&FunctionTable::m_ptr_glUniformHandleui64ARB>(a0,a1);}
+void m_glProgramUniform4f_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC,&FunctionTable::m_ptr_glProgramUniform4f>(a0,a1,a2,a3,a4,a5);}
+void m_glViewportIndexedf_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC,&FunctionTable::m_ptr_glViewportIndexedf>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform4d_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC,&FunctionTable::m_ptr_glProgramUniform4d>(a0,a1,a2,a3,a4,a5);}
+void m_glTexCoord1xOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC,&FunctionTable::m_ptr_glTexCoord1xOES>(a0);}
+void m_glVertexStream3ivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC,&FunctionTable::m_ptr_glVertexStream3ivATI>(a0,a1);}
+GLboolean m_glPointAlongPathNV_record(GLuint,GLsizei,GLsizei,GLfloat,GLfloat*,GLfloat*,GLfloat*,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glPointAlongPathNV");return (GLboolean)0;}
+void m_glEndQueryARB_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENDQUERYARBPROC,&FunctionTable::m_ptr_glEndQueryARB>(a0);}
+void m_glVDPAUMapSurfacesNV_record(GLsizei a0,const GLvdpauSurfaceNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC,&FunctionTable::m_ptr_glVDPAUMapSurfacesNV>(a0,a1);}
+void m_glVertex3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3IPROC,&FunctionTable::m_ptr_glVertex3i>(a0,a1,a2);}
+void m_glVertexAttrib4uivARB_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4uivARB>(a0,a1);}
+void m_glTextureStorageMem3DEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLuint a6,GLuint64 a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC,&FunctionTable::m_ptr_glTextureStorageMem3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glAttachShader_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLATTACHSHADERPROC,&FunctionTable::m_ptr_glAttachShader>(a0,a1);}
+void m_glColor4hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4HNVPROC,&FunctionTable::m_ptr_glColor4hNV>(a0,a1,a2,a3);}
+void m_glGetFenceivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFenceivNV");return (void)0;}
+void m_glTexCoord2fColor4ubVertex3fvSUN_record(const GLfloat* a0,const GLubyte* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor4ubVertex3fvSUN>(a0,a1,a2);}
+void m_glGetColorTable_record(GLenum,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTable");return (void)0;}
+void m_glFogCoordPointer_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC,&FunctionTable::m_ptr_glFogCoordPointer>(a0,a1,a2);}
+void m_glTexStorageSparseAMD_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLsizei a4,GLsizei a5,GLbitfield a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC,&FunctionTable::m_ptr_glTexStorageSparseAMD>(a0,a1,a2,a3,a4,a5,a6);}
+GLboolean m_glUnmapNamedBuffer_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glUnmapNamedBuffer");return (GLboolean)0;}
+void m_glTexCoord4bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC,&FunctionTable::m_ptr_glTexCoord4bvOES>(a0);}
+void m_glVertexAttrib3fARB_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC,&FunctionTable::m_ptr_glVertexAttrib3fARB>(a0,a1,a2,a3);}
+void m_glRasterPos2xOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC,&FunctionTable::m_ptr_glRasterPos2xOES>(a0,a1);}
+void m_glCreateMemoryObjectsEXT_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateMemoryObjectsEXT");return (void)0;}
+void m_glColor4ubVertex2fvSUN_record(const GLubyte* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC,&FunctionTable::m_ptr_glColor4ubVertex2fvSUN>(a0,a1);}
+void m_glSecondaryColor3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC,&FunctionTable::m_ptr_glSecondaryColor3dv>(a0);}
+void m_glVertexAttribI4sv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC,&FunctionTable::m_ptr_glVertexAttribI4sv>(a0,a1);}
+void m_glDrawTransformFeedbackStreamInstanced_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC,&FunctionTable::m_ptr_glDrawTransformFeedbackStreamInstanced>(a0,a1,a2,a3);}
+void m_glMultiTexCoord4ivARB_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4ivARB>(a0,a1);}
+void m_glSpriteParameterfSGIX_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC,&FunctionTable::m_ptr_glSpriteParameterfSGIX>(a0,a1);}
+void m_glSecondaryColor3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC,&FunctionTable::m_ptr_glSecondaryColor3sv>(a0);}
+void m_glBindVideoCaptureStreamTextureNV_record(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC,&FunctionTable::m_ptr_glBindVideoCaptureStreamTextureNV>(a0,a1,a2,a3,a4);}
+void m_glTexParameterIuiv_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC,&FunctionTable::m_ptr_glTexParameterIuiv>(a0,a1,a2);}
+void m_glFlushPixelDataRangeNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC,&FunctionTable::m_ptr_glFlushPixelDataRangeNV>(a0);}
+void m_glWindowPos3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC,&FunctionTable::m_ptr_glWindowPos3fv>(a0);}
+void m_glVertexAttribLFormatNV_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC,&FunctionTable::m_ptr_glVertexAttribLFormatNV>(a0,a1,a2,a3);}
+void m_glLightModelfv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC,&FunctionTable::m_ptr_glLightModelfv>(a0,a1);}
+void m_glGetColorTableSGI_record(GLenum,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableSGI");return (void)0;}
+void m_glGetCompressedTexImageARB_record(GLenum,GLint,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedTexImageARB");return (void)0;}
+void m_glConvolutionParameteri_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC,&FunctionTable::m_ptr_glConvolutionParameteri>(a0,a1,a2);}
+void m_glVertexWeighthNV_record(GLhalfNV a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC,&FunctionTable::m_ptr_glVertexWeighthNV>(a0);}
+void m_glColorMaskIndexedEXT_record(GLuint a0,GLboolean a1,GLboolean a2,GLboolean a3,GLboolean a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC,&FunctionTable::m_ptr_glColorMaskIndexedEXT>(a0,a1,a2,a3,a4);}
+void m_glColorMaski_record(GLuint a0,GLboolean a1,GLboolean a2,GLboolean a3,GLboolean a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORMASKIPROC,&FunctionTable::m_ptr_glColorMaski>(a0,a1,a2,a3,a4);}
+void m_glColorFragmentOp1ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC,&FunctionTable::m_ptr_glColorFragmentOp1ATI>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttribI4ubvEXT_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4ubvEXT>(a0,a1);}
+void m_glVertexAttrib1dNV_record(GLuint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC,&FunctionTable::m_ptr_glVertexAttrib1dNV>(a0,a1);}
+void m_glUnmapObjectBufferATI_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC,&FunctionTable::m_ptr_glUnmapObjectBufferATI>(a0);}
+void m_glNamedProgramLocalParameterI4uiEXT_record(GLuint a0,GLenum a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameterI4uiEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glProgramUniform1iEXT_record(GLuint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC,&FunctionTable::m_ptr_glProgramUniform1iEXT>(a0,a1,a2);}
+void m_glDeleteQueriesARB_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC,&FunctionTable::m_ptr_glDeleteQueriesARB>(a0,a1);}
+void m_glWindowPos3svARB_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC,&FunctionTable::m_ptr_glWindowPos3svARB>(a0);}
+void m_glVertex4s_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4SPROC,&FunctionTable::m_ptr_glVertex4s>(a0,a1,a2,a3);}
+void m_glImportMemoryWin32NameEXT_record(GLuint a0,GLuint64 a1,GLenum a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC,&FunctionTable::m_ptr_glImportMemoryWin32NameEXT>(a0,a1,a2,a3);}
+void m_glStringMarkerGREMEDY_record(GLsizei a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC,&FunctionTable::m_ptr_glStringMarkerGREMEDY>(a0,a1);}
+GLboolean m_glIsTransformFeedback_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTransformFeedback");return (GLboolean)0;}
+void m_glProgramUniformMatrix2x3dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x3dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*3*sizeof(*a4)));}
+void m_glGetObjectLabelEXT_record(GLenum,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectLabelEXT");return (void)0;}
+void m_glUniformHandleui64vNV_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC,&FunctionTable::m_ptr_glUniformHandleui64vNV>(a0,a1,a2);}
+void m_glRotated_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLROTATEDPROC,&FunctionTable::m_ptr_glRotated>(a0,a1,a2,a3);}
+GLboolean m_glIsProgramPipeline_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsProgramPipeline");return (GLboolean)0;}
+void m_glRotatef_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLROTATEFPROC,&FunctionTable::m_ptr_glRotatef>(a0,a1,a2,a3);}
+void m_glVertex4i_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4IPROC,&FunctionTable::m_ptr_glVertex4i>(a0,a1,a2,a3);}
+void m_glGetActiveSubroutineUniformName_record(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveSubroutineUniformName");return (void)0;}
+void m_glVertexAttrib4sNV_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC,&FunctionTable::m_ptr_glVertexAttrib4sNV>(a0,a1,a2,a3,a4);}
+void m_glProgramLocalParameter4dvARB_record(GLenum a0,GLuint a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC,&FunctionTable::m_ptr_glProgramLocalParameter4dvARB>(a0,a1,a2);}
+void m_glReplacementCodeubSUN_record(GLubyte a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC,&FunctionTable::m_ptr_glReplacementCodeubSUN>(a0);}
+void m_glMultiDrawElementsIndirectBindlessNV_record(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirectBindlessNV>(a0,a1,a2,a3,a4,a5);}
+void m_glImportSemaphoreWin32HandleEXT_record(GLuint a0,GLenum a1,void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC,&FunctionTable::m_ptr_glImportSemaphoreWin32HandleEXT>(a0,a1,a2);}
+void m_glUniformMatrix3fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC,&FunctionTable::m_ptr_glUniformMatrix3fv>(a0,a1,a2,this->m_copy(a3,a1,3*3*sizeof(*a3)));}
+void m_glGetnMapfvARB_record(GLenum,GLenum,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapfvARB");return (void)0;}
+void m_glGetnUniformfv_record(GLuint,GLint,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformfv");return (void)0;}
+void m_glVertexAttribL2dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC,&FunctionTable::m_ptr_glVertexAttribL2dv>(a0,a1);}
+void m_glVertexWeightPointerEXT_record(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC,&FunctionTable::m_ptr_glVertexWeightPointerEXT>(a0,a1,a2,a3);}
+void m_glTangent3sEXT_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC,&FunctionTable::m_ptr_glTangent3sEXT>(a0,a1,a2);}
+void m_glSecondaryColorPointer_record(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC,&FunctionTable::m_ptr_glSecondaryColorPointer>(a0,a1,a2,a3);}
+void m_glAlphaFunc_record(GLenum a0,GLclampf a1)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHAFUNCPROC,&FunctionTable::m_ptr_glAlphaFunc>(a0,a1);}
+void m_glGetNamedStringARB_record(GLint,const GLchar*,GLsizei,GLint*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedStringARB");return (void)0;}
+void m_glTexCoord4d_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4DPROC,&FunctionTable::m_ptr_glTexCoord4d>(a0,a1,a2,a3);}
+void m_glBufferPageCommitmentARB_record(GLenum a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC,&FunctionTable::m_ptr_glBufferPageCommitmentARB>(a0,a1,a2,a3);}
+void m_glProgramLocalParameters4fvEXT_record(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC,&FunctionTable::m_ptr_glProgramLocalParameters4fvEXT>(a0,a1,a2,a3);}
+void m_glStencilFunc_record(GLenum a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILFUNCPROC,&FunctionTable::m_ptr_glStencilFunc>(a0,a1,a2);}
+void m_glSemaphoreParameterui64vEXT_record(GLuint a0,GLenum a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC,&FunctionTable::m_ptr_glSemaphoreParameterui64vEXT>(a0,a1,a2);}
+void m_glGetVertexAttribdvNV_record(GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribdvNV");return (void)0;}
+void m_glTexCoord3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC,&FunctionTable::m_ptr_glTexCoord3dv>(a0);}
+void m_glGetQueryBufferObjectiv_record(GLuint,GLuint,GLenum,GLintptr)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryBufferObjectiv");return (void)0;}
+void m_glTexGenxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENXOESPROC,&FunctionTable::m_ptr_glTexGenxOES>(a0,a1,a2);}
+void m_glMultiTexCoord1fvARB_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1fvARB>(a0,a1);}
+void m_glLightEnviSGIX_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC,&FunctionTable::m_ptr_glLightEnviSGIX>(a0,a1);}
+void m_glGetProgramPipelineiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramPipelineiv");return (void)0;}
+void m_glVertexStream2ivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC,&FunctionTable::m_ptr_glVertexStream2ivATI>(a0,a1);}
+void m_glGetColorTableEXT_record(GLenum,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableEXT");return (void)0;}
+void m_glGetShaderInfoLog_record(GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetShaderInfoLog");return (void)0;}
+void m_glGetOcclusionQueryuivNV_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetOcclusionQueryuivNV");return (void)0;}
+void m_glInvalidateNamedFramebufferSubData_record(GLuint a0,GLsizei a1,const GLenum* a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glInvalidateNamedFramebufferSubData>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttribL1i64NV_record(GLuint a0,GLint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC,&FunctionTable::m_ptr_glVertexAttribL1i64NV>(a0,a1);}
+void m_glVDPAUInitNV_record(const void* a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUINITNVPROC,&FunctionTable::m_ptr_glVDPAUInitNV>(a0,a1);}
+void m_glVertexAttrib1hvNV_record(GLuint a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC,&FunctionTable::m_ptr_glVertexAttrib1hvNV>(a0,a1);}
+void m_glVertexAttribI4i_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC,&FunctionTable::m_ptr_glVertexAttribI4i>(a0,a1,a2,a3,a4);}
+void m_glRasterPos2iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC,&FunctionTable::m_ptr_glRasterPos2iv>(a0);}
+void m_glGetIntegerui64i_vNV_record(GLenum,GLuint,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetIntegerui64i_vNV");return (void)0;}
+void m_glUniformHandleui64NV_record(GLint a0,GLuint64 a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC,&FunctionTable::m_ptr_glUniformHandleui64NV>(a0,a1);}
+void m_glWindowPos3ivMESA_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC,&FunctionTable::m_ptr_glWindowPos3ivMESA>(a0);}
+void m_glBlendEquationSeparate_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC,&FunctionTable::m_ptr_glBlendEquationSeparate>(a0,a1);}
+void m_glDrawElementsInstancedARB_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC,&FunctionTable::m_ptr_glDrawElementsInstancedARB>(a0,a1,a2,a3,a4);}
+GLuint m_glGetSubroutineIndex_record(GLuint,GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSubroutineIndex");return (GLuint)0;}
+void m_glVertexAttrib2sv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC,&FunctionTable::m_ptr_glVertexAttrib2sv>(a0,a1);}
+void m_glSamplePatternSGIS_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC,&FunctionTable::m_ptr_glSamplePatternSGIS>(a0);}
+void m_glEGLImageTargetRenderbufferStorageOES_record(GLenum a0,GLeglImageOES a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC,&FunctionTable::m_ptr_glEGLImageTargetRenderbufferStorageOES>(a0,a1);}
+void m_glPushAttrib_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHATTRIBPROC,&FunctionTable::m_ptr_glPushAttrib>(a0);}
+void m_glVertex3hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3HNVPROC,&FunctionTable::m_ptr_glVertex3hNV>(a0,a1,a2);}
+void m_glRasterPos3xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC,&FunctionTable::m_ptr_glRasterPos3xvOES>(a0);}
+void m_glPathParameterfNV_record(GLuint a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC,&FunctionTable::m_ptr_glPathParameterfNV>(a0,a1,a2);}
+void m_glGetUniformi64vNV_record(GLuint,GLint,GLint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformi64vNV");return (void)0;}
+void m_glLightiv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTIVPROC,&FunctionTable::m_ptr_glLightiv>(a0,a1,a2);}
+void m_glMaterialxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALXVOESPROC,&FunctionTable::m_ptr_glMaterialxvOES>(a0,a1,a2);}
+void m_glNamedProgramLocalParameter4fEXT_record(GLuint a0,GLenum a1,GLuint a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameter4fEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttribL1dEXT_record(GLuint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC,&FunctionTable::m_ptr_glVertexAttribL1dEXT>(a0,a1);}
+void m_glGetnUniformdvARB_record(GLuint,GLint,GLsizei,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformdvARB");return (void)0;}
+void m_glSecondaryColor3bEXT_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3bEXT>(a0,a1,a2);}
+void m_glBeginPerfQueryINTEL_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC,&FunctionTable::m_ptr_glBeginPerfQueryINTEL>(a0);}
+void m_glProgramUniform1uivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC,&FunctionTable::m_ptr_glProgramUniform1uivEXT>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glImageTransformParameterivHP_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC,&FunctionTable::m_ptr_glImageTransformParameterivHP>(a0,a1,a2);}
+void m_glDeleteBuffers_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC,&FunctionTable::m_ptr_glDeleteBuffers>(a0,a1);}
+void m_glBindProgramPipeline_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC,&FunctionTable::m_ptr_glBindProgramPipeline>(a0);}
+void m_glScissor_record(GLint a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSCISSORPROC,&FunctionTable::m_ptr_glScissor>(a0,a1,a2,a3);}
+void m_glProgramUniform4fv_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC,&FunctionTable::m_ptr_glProgramUniform4fv>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glGetBooleanv_record(GLenum,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBooleanv");return (void)0;}
+void m_glMaterialfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALFVPROC,&FunctionTable::m_ptr_glMaterialfv>(a0,a1,a2);}
+void m_glWindowPos4fvMESA_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC,&FunctionTable::m_ptr_glWindowPos4fvMESA>(a0);}
+void m_glVertexAttribIPointerEXT_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC,&FunctionTable::m_ptr_glVertexAttribIPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramBufferParametersfvNV_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC,&FunctionTable::m_ptr_glProgramBufferParametersfvNV>(a0,a1,a2,a3,a4);}
+void m_glAlphaFuncxOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC,&FunctionTable::m_ptr_glAlphaFuncxOES>(a0,a1);}
+void m_glMultiDrawArraysIndirectAMD_record(GLenum a0,const void* a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirectAMD>(a0,a1,a2,a3);}
+void m_glNormalStream3ivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC,&FunctionTable::m_ptr_glNormalStream3ivATI>(a0,a1);}
+void m_glTextureImage3DMultisampleNV_record(GLuint a0,GLenum a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC,&FunctionTable::m_ptr_glTextureImage3DMultisampleNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glProgramUniform4uivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC,&FunctionTable::m_ptr_glProgramUniform4uivEXT>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glReplacementCodeusvSUN_record(const GLushort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeusvSUN>(a0);}
+GLint m_glPollInstrumentsSGIX_record(GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glPollInstrumentsSGIX");return (GLint)0;}
+void m_glGetTextureLevelParameteriv_record(GLuint,GLint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureLevelParameteriv");return (void)0;}
+void m_glVertexAttribI2uiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC,&FunctionTable::m_ptr_glVertexAttribI2uiv>(a0,a1);}
+void m_glMapControlPointsNV_record(GLenum a0,GLuint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLint a6,GLboolean a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC,&FunctionTable::m_ptr_glMapControlPointsNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glColor4dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4DVPROC,&FunctionTable::m_ptr_glColor4dv>(a0);}
+void m_glInvalidateBufferSubData_record(GLuint a0,GLintptr a1,GLsizeiptr a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glInvalidateBufferSubData>(a0,a1,a2);}
+void m_glMultiTexCoord1hNV_record(GLenum a0,GLhalfNV a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC,&FunctionTable::m_ptr_glMultiTexCoord1hNV>(a0,a1);}
+void m_glPointParameterfv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC,&FunctionTable::m_ptr_glPointParameterfv>(a0,a1);}
+void m_glUniformMatrix2fvARB_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC,&FunctionTable::m_ptr_glUniformMatrix2fvARB>(a0,a1,a2,this->m_copy(a3,a1,2*2*sizeof(*a3)));}
+void m_glUniform2fv_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2FVPROC,&FunctionTable::m_ptr_glUniform2fv>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glVertexPointerListIBM_record(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glVertexPointerListIBM>(a0,a1,a2,a3,a4);}
+void m_glGetMultiTexGenfvEXT_record(GLenum,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexGenfvEXT");return (void)0;}
+void m_glGetMinmaxEXT_record(GLenum,GLboolean,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmaxEXT");return (void)0;}
+GLboolean m_glIsFenceNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsFenceNV");return (GLboolean)0;}
+void m_glMatrixFrustumEXT_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC,&FunctionTable::m_ptr_glMatrixFrustumEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glDispatchComputeIndirect_record(GLintptr a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC,&FunctionTable::m_ptr_glDispatchComputeIndirect>(a0);}
+GLint m_glQueryResourceNV_record(GLenum,GLint,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glQueryResourceNV");return (GLint)0;}
+void m_glMultiTexCoord4bOES_record(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3,GLbyte a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC,&FunctionTable::m_ptr_glMultiTexCoord4bOES>(a0,a1,a2,a3,a4);}
+void m_glProgramEnvParameter4dARB_record(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC,&FunctionTable::m_ptr_glProgramEnvParameter4dARB>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramUniform1uiEXT_record(GLuint a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC,&FunctionTable::m_ptr_glProgramUniform1uiEXT>(a0,a1,a2);}
+void m_glBindBufferRange_record(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC,&FunctionTable::m_ptr_glBindBufferRange>(a0,a1,a2,a3,a4);}
+void m_glNormal3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3IVPROC,&FunctionTable::m_ptr_glNormal3iv>(a0);}
+void m_glVertexAttribL3dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC,&FunctionTable::m_ptr_glVertexAttribL3dv>(a0,a1);}
+void m_glGetUniformdv_record(GLuint,GLint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformdv");return (void)0;}
+void m_glGetMultiTexLevelParameterfvEXT_record(GLenum,GLenum,GLint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexLevelParameterfvEXT");return (void)0;}
+void m_glFinalCombinerInputNV_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC,&FunctionTable::m_ptr_glFinalCombinerInputNV>(a0,a1,a2,a3);}
+void m_glCullParameterdvEXT_record(GLenum a0,GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC,&FunctionTable::m_ptr_glCullParameterdvEXT>(a0,a1);}
+void m_glMultiTexCoord4s_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC,&FunctionTable::m_ptr_glMultiTexCoord4s>(a0,a1,a2,a3,a4);}
+void m_glMapVertexAttrib1fAPPLE_record(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLint a4,GLint a5,const GLfloat* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC,&FunctionTable::m_ptr_glMapVertexAttrib1fAPPLE>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glConvolutionParameterfEXT_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC,&FunctionTable::m_ptr_glConvolutionParameterfEXT>(a0,a1,a2);}
+void m_glTexCoord1iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC,&FunctionTable::m_ptr_glTexCoord1iv>(a0);}
+void m_glProgramUniform3fvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC,&FunctionTable::m_ptr_glProgramUniform3fvEXT>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glColor3uiv_record(const GLuint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3UIVPROC,&FunctionTable::m_ptr_glColor3uiv>(a0);}
+void m_glRenderGpuMaskNV_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC,&FunctionTable::m_ptr_glRenderGpuMaskNV>(a0);}
+void m_glListBase_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTBASEPROC,&FunctionTable::m_ptr_glListBase>(a0);}
+void m_glTexCoord2bOES_record(GLbyte a0,GLbyte a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC,&FunctionTable::m_ptr_glTexCoord2bOES>(a0,a1);}
+GLuint m_glBindMaterialParameterEXT_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glBindMaterialParameterEXT");return (GLuint)0;}
+void m_glGlobalAlphaFactorubSUN_record(GLubyte a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactorubSUN>(a0);}
+void m_glVertexAttribL1ui64NV_record(GLuint a0,GLuint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC,&FunctionTable::m_ptr_glVertexAttribL1ui64NV>(a0,a1);}
+void m_glPointParameterfSGIS_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC,&FunctionTable::m_ptr_glPointParameterfSGIS>(a0,a1);}
+void m_glGetImageTransformParameterivHP_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetImageTransformParameterivHP");return (void)0;}
+void m_glColorSubTableEXT_record(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC,&FunctionTable::m_ptr_glColorSubTableEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glPixelTexGenParameterfvSGIS_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC,&FunctionTable::m_ptr_glPixelTexGenParameterfvSGIS>(a0,a1);}
+GLenum m_glClientWaitSync_record(GLsync,GLbitfield,GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glClientWaitSync");return (GLenum)0;}
+void m_glQueryObjectParameteruiAMD_record(GLenum a0,GLuint a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC,&FunctionTable::m_ptr_glQueryObjectParameteruiAMD>(a0,a1,a2,a3);}
+void m_glVertexAttribs1fvNV_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC,&FunctionTable::m_ptr_glVertexAttribs1fvNV>(a0,a1,a2);}
+void m_glVertexAttrib4NusvARB_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NusvARB>(a0,a1);}
+void m_glVariantPointerEXT_record(GLuint a0,GLenum a1,GLuint a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC,&FunctionTable::m_ptr_glVariantPointerEXT>(a0,a1,a2,a3);}
+void m_glTextureBuffer_record(GLuint a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC,&FunctionTable::m_ptr_glTextureBuffer>(a0,a1,a2);}
+void m_glVertexAttribI1uiEXT_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC,&FunctionTable::m_ptr_glVertexAttribI1uiEXT>(a0,a1);}
+void m_glInvalidateTexImage_record(GLuint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC,&FunctionTable::m_ptr_glInvalidateTexImage>(a0,a1);}
+void m_glProgramEnvParametersI4ivNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC,&FunctionTable::m_ptr_glProgramEnvParametersI4ivNV>(a0,a1,a2,a3);}
+GLenum m_glPathGlyphIndexArrayNV_record(GLuint,GLenum,const void*,GLbitfield,GLuint,GLsizei,GLuint,GLfloat)const{this->m_printUnrecordableFunctionErrorAndExit("glPathGlyphIndexArrayNV");return (GLenum)0;}
+void m_glCopyImageSubData_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLuint a6,GLenum a7,GLint a8,GLint a9,GLint a10,GLint a11,GLsizei a12,GLsizei a13,GLsizei a14)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC,&FunctionTable::m_ptr_glCopyImageSubData>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+void m_glGetUniformSubroutineuiv_record(GLenum,GLint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformSubroutineuiv");return (void)0;}
+void m_glBindVertexBuffer_record(GLuint a0,GLuint a1,GLintptr a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC,&FunctionTable::m_ptr_glBindVertexBuffer>(a0,a1,a2,a3);}
+void m_glMultiTexCoord1iARB_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1iARB>(a0,a1);}
+void m_glDebugMessageInsert_record(GLenum a0,GLenum a1,GLuint a2,GLenum a3,GLsizei a4,const GLchar* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC,&FunctionTable::m_ptr_glDebugMessageInsert>(a0,a1,a2,a3,a4,a5);}
+void m_glBeginVertexShaderEXT_record()const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC,&FunctionTable::m_ptr_glBeginVertexShaderEXT>();}
+GLboolean m_glIsVariantEnabledEXT_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glIsVariantEnabledEXT");return (GLboolean)0;}
+void m_glPassThroughxOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC,&FunctionTable::m_ptr_glPassThroughxOES>(a0);}
+GLboolean m_glIsSampler_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsSampler");return (GLboolean)0;}
+void m_glConservativeRasterParameterfNV_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC,&FunctionTable::m_ptr_glConservativeRasterParameterfNV>(a0,a1);}
+void m_glMultiTexGenivEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC,&FunctionTable::m_ptr_glMultiTexGenivEXT>(a0,a1,a2,a3);}
+void m_glNamedFramebufferTexture2DEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTexture2DEXT>(a0,a1,a2,a3,a4);}
+void m_glCopyTexSubImage1D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC,&FunctionTable::m_ptr_glCopyTexSubImage1D>(a0,a1,a2,a3,a4,a5);}
+void m_glTexCoord1i_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1IPROC,&FunctionTable::m_ptr_glTexCoord1i>(a0);}
+GLenum m_glCheckFramebufferStatus_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCheckFramebufferStatus");return (GLenum)0;}
+void m_glDrawElementArrayAPPLE_record(GLenum a0,GLint a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC,&FunctionTable::m_ptr_glDrawElementArrayAPPLE>(a0,a1,a2);}
+void m_glTexCoord1d_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1DPROC,&FunctionTable::m_ptr_glTexCoord1d>(a0);}
+void m_glTexCoord1f_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1FPROC,&FunctionTable::m_ptr_glTexCoord1f>(a0);}
+void m_glFragmentLightivSGIX_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC,&FunctionTable::m_ptr_glFragmentLightivSGIX>(a0,a1,a2);}
+void m_glBindImageTexture_record(GLuint a0,GLuint a1,GLint a2,GLboolean a3,GLint a4,GLenum a5,GLenum a6)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC,&FunctionTable::m_ptr_glBindImageTexture>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glTransformFeedbackVaryings_record(GLuint a0,GLsizei a1,const GLchar*const* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC,&FunctionTable::m_ptr_glTransformFeedbackVaryings>(a0,a1,a2,a3);}
+void m_glMulticastBufferSubDataNV_record(GLbitfield a0,GLuint a1,GLintptr a2,GLsizeiptr a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC,&FunctionTable::m_ptr_glMulticastBufferSubDataNV>(a0,a1,a2,a3,a4);}
+void m_glDrawRangeElements_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const GLvoid* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC,&FunctionTable::m_ptr_glDrawRangeElements>(a0,a1,a2,a3,a4,a5);}
+void m_glTexCoord1s_record(GLshort a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1SPROC,&FunctionTable::m_ptr_glTexCoord1s>(a0);}
+void m_glBindBufferBase_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC,&FunctionTable::m_ptr_glBindBufferBase>(a0,a1,a2);}
+void m_glColor3bv_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3BVPROC,&FunctionTable::m_ptr_glColor3bv>(a0);}
+void m_glSyncTextureINTEL_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC,&FunctionTable::m_ptr_glSyncTextureINTEL>(a0);}
+void m_glCreateSamplers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateSamplers");return (void)0;}
+void m_glCombinerParameterfNV_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC,&FunctionTable::m_ptr_glCombinerParameterfNV>(a0,a1);}
+void m_glGetArrayObjectivATI_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetArrayObjectivATI");return (void)0;}
+void m_glMultiDrawArrays_record(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC,&FunctionTable::m_ptr_glMultiDrawArrays>(a0,a1,a2,a3);}
+void m_glSampleMapATI_record(GLuint a0,GLuint a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC,&FunctionTable::m_ptr_glSampleMapATI>(a0,a1,a2);}
+void m_glProgramUniform2i64ARB_record(GLuint a0,GLint a1,GLint64 a2,GLint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC,&FunctionTable::m_ptr_glProgramUniform2i64ARB>(a0,a1,a2,a3);}
+void m_glBinormal3ivEXT_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC,&FunctionTable::m_ptr_glBinormal3ivEXT>(a0);}
+void m_glMultiDrawArraysIndirectCountARB_record(GLenum a0,const void* a1,GLintptr a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirectCountARB>(a0,a1,a2,a3,a4);}
+void m_glTextureStorageMem1DEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLuint a4,GLuint64 a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC,&FunctionTable::m_ptr_glTextureStorageMem1DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glWindowPos2ivMESA_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC,&FunctionTable::m_ptr_glWindowPos2ivMESA>(a0);}
+void m_glTexCoordP4ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC,&FunctionTable::m_ptr_glTexCoordP4ui>(a0,a1);}
+void m_glMultiTexSubImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLenum a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glMultiTexSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glProgramUniformMatrix2x3fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x3fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*3*sizeof(*a4)));}
+void m_glBufferDataARB_record(GLenum a0,GLsizeiptrARB a1,const void* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC,&FunctionTable::m_ptr_glBufferDataARB>(a0,a1,this->m_copy(a2,a1,1),a3);}
+void m_glVertexAttribIFormat_record(GLuint a0,GLint a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC,&FunctionTable::m_ptr_glVertexAttribIFormat>(a0,a1,a2,a3);}
+void m_glCreateFramebuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateFramebuffers");return (void)0;}
+void m_glNormalStream3dvATI_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC,&FunctionTable::m_ptr_glNormalStream3dvATI>(a0,a1);}
+void m_glClearAccum_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARACCUMPROC,&FunctionTable::m_ptr_glClearAccum>(a0,a1,a2,a3);}
+void m_glUniform3i64vNV_record(GLint a0,GLsizei a1,const GLint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC,&FunctionTable::m_ptr_glUniform3i64vNV>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glNormal3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5);}
+void m_glUniform2uivEXT_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC,&FunctionTable::m_ptr_glUniform2uivEXT>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glBeginQuery_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINQUERYPROC,&FunctionTable::m_ptr_glBeginQuery>(a0,a1);}
+void m_glStencilThenCoverStrokePathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLint a4,GLuint a5,GLenum a6,GLenum a7,const GLfloat* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glStencilThenCoverStrokePathInstancedNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glBindBuffer_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERPROC,&FunctionTable::m_ptr_glBindBuffer>(a0,a1);}
+void m_glMap2d_record(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,GLdouble a5,GLdouble a6,GLint a7,GLint a8,const GLdouble* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP2DPROC,&FunctionTable::m_ptr_glMap2d>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glMap2f_record(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,GLfloat a5,GLfloat a6,GLint a7,GLint a8,const GLfloat* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP2FPROC,&FunctionTable::m_ptr_glMap2f>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glMakeImageHandleResidentNV_record(GLuint64 a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC,&FunctionTable::m_ptr_glMakeImageHandleResidentNV>(a0,a1);}
+void m_glUniformMatrix2x4fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC,&FunctionTable::m_ptr_glUniformMatrix2x4fv>(a0,a1,a2,this->m_copy(a3,a1,2*4*sizeof(*a3)));}
+void m_glGetMultiTexParameterfvEXT_record(GLenum,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexParameterfvEXT");return (void)0;}
+void m_glDepthRangeIndexed_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC,&FunctionTable::m_ptr_glDepthRangeIndexed>(a0,a1,a2);}
+GLboolean m_glIsEnabled_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glIsEnabled");return (GLboolean)0;}
+void m_glMatrixScalefEXT_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC,&FunctionTable::m_ptr_glMatrixScalefEXT>(a0,a1,a2,a3);}
+GLenum m_glGetError_record()const{this->m_printUnrecordableFunctionErrorAndExit("glGetError");return (GLenum)0;}
+void m_glGetTexEnviv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexEnviv");return (void)0;}
+GLuint m_glBindTextureUnitParameterEXT_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glBindTextureUnitParameterEXT");return (GLuint)0;}
+void m_glGetnUniformfvARB_record(GLuint,GLint,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformfvARB");return (void)0;}
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN>(a0,a1,a2);}
+void m_glDeletePerfQueryINTEL_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC,&FunctionTable::m_ptr_glDeletePerfQueryINTEL>(a0);}
+void m_glActiveVaryingNV_record(GLuint a0,const GLchar* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC,&FunctionTable::m_ptr_glActiveVaryingNV>(a0,a1);}
+void m_glGetActiveUniformARB_record(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniformARB");return (void)0;}
+void m_glVertexAttribI3ivEXT_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI3ivEXT>(a0,a1);}
+void m_glEvalCoord1d_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1DPROC,&FunctionTable::m_ptr_glEvalCoord1d>(a0);}
+void m_glNamedCopyBufferSubDataEXT_record(GLuint a0,GLuint a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC,&FunctionTable::m_ptr_glNamedCopyBufferSubDataEXT>(a0,a1,a2,a3,a4);}
+void m_glEvalCoord1f_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1FPROC,&FunctionTable::m_ptr_glEvalCoord1f>(a0);}
+void m_glPixelMapfv_record(GLenum a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELMAPFVPROC,&FunctionTable::m_ptr_glPixelMapfv>(a0,a1,a2);}
+void m_glVertexAttribI1ivEXT_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI1ivEXT>(a0,a1);}
+GLsync m_glCreateSyncFromCLeventARB_record(struct _cl_context*,struct _cl_event*,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateSyncFromCLeventARB");return (GLsync)0;}
+void m_glGetPixelMapusv_record(GLenum,GLushort*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelMapusv");return (void)0;}
+void m_glGetnColorTableARB_record(GLenum,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnColorTableARB");return (void)0;}
+void m_glAccum_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLACCUMPROC,&FunctionTable::m_ptr_glAccum>(a0,a1);}
+void m_glRasterPos3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC,&FunctionTable::m_ptr_glRasterPos3sv>(a0);}
+void m_glTexCoord2iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC,&FunctionTable::m_ptr_glTexCoord2iv>(a0);}
+void m_glBlendFunciARB_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC,&FunctionTable::m_ptr_glBlendFunciARB>(a0,a1,a2);}
+void m_glProgramUniform3i64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC,&FunctionTable::m_ptr_glProgramUniform3i64vARB>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glGetFramebufferAttachmentParameteriv_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFramebufferAttachmentParameteriv");return (void)0;}
+void m_glProgramUniform4ui_record(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC,&FunctionTable::m_ptr_glProgramUniform4ui>(a0,a1,a2,a3,a4,a5);}
+void m_glStencilMask_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILMASKPROC,&FunctionTable::m_ptr_glStencilMask>(a0);}
+void m_glResetHistogramEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC,&FunctionTable::m_ptr_glResetHistogramEXT>(a0);}
+void m_glLightxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTXOESPROC,&FunctionTable::m_ptr_glLightxOES>(a0,a1,a2);}
+void m_glNamedBufferData_record(GLuint a0,GLsizeiptr a1,const void* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC,&FunctionTable::m_ptr_glNamedBufferData>(a0,a1,this->m_copy(a2,a1,1),a3);}
+void m_glVertexStream3sATI_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC,&FunctionTable::m_ptr_glVertexStream3sATI>(a0,a1,a2,a3);}
+void m_glVertexAttrib3fvARB_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC,&FunctionTable::m_ptr_glVertexAttrib3fvARB>(a0,a1);}
+void m_glClearNamedBufferSubData_record(GLuint a0,GLenum a1,GLintptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glClearNamedBufferSubData>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glProgramUniformHandleui64ARB_record(GLuint a0,GLint a1,GLuint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC,&FunctionTable::m_ptr_glProgramUniformHandleui64ARB>(a0,a1,a2);}
+void m_glUniform3iARB_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC,&FunctionTable::m_ptr_glUniform3iARB>(a0,a1,a2,a3);}
+GLhandleARB m_glCreateProgramObjectARB_record()const{this->m_printUnrecordableFunctionErrorAndExit("glCreateProgramObjectARB");return (GLhandleARB)0;}
+void m_glMultiTexCoord1dvARB_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1dvARB>(a0,a1);}
+void m_glGetObjectParameterfvARB_record(GLhandleARB,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectParameterfvARB");return (void)0;}
+void m_glRectsv_record(const GLshort* a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTSVPROC,&FunctionTable::m_ptr_glRectsv>(a0,a1);}
+void m_glMultiTexImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC,&FunctionTable::m_ptr_glMultiTexImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glProgramUniform1i64NV_record(GLuint a0,GLint a1,GLint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC,&FunctionTable::m_ptr_glProgramUniform1i64NV>(a0,a1,a2);}
+void m_glGetObjectBufferivATI_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectBufferivATI");return (void)0;}
+void m_glUniform4i64ARB_record(GLint a0,GLint64 a1,GLint64 a2,GLint64 a3,GLint64 a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC,&FunctionTable::m_ptr_glUniform4i64ARB>(a0,a1,a2,a3,a4);}
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_record(const GLuint* a0,const GLubyte* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN>(a0,a1,a2);}
+void m_glBlendFuncSeparateINGR_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC,&FunctionTable::m_ptr_glBlendFuncSeparateINGR>(a0,a1,a2,a3);}
+void m_glGetVideoCaptureStreamfvNV_record(GLuint,GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoCaptureStreamfvNV");return (void)0;}
+void m_glVertexAttrib2fARB_record(GLuint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC,&FunctionTable::m_ptr_glVertexAttrib2fARB>(a0,a1,a2);}
+void m_glGetTexGeniv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexGeniv");return (void)0;}
+void m_glPixelStorei_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELSTOREIPROC,&FunctionTable::m_ptr_glPixelStorei>(a0,a1);}
+void m_glGetCompressedTextureSubImage_record(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedTextureSubImage");return (void)0;}
+void m_glCopyImageSubDataNV_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLuint a6,GLenum a7,GLint a8,GLint a9,GLint a10,GLint a11,GLsizei a12,GLsizei a13,GLsizei a14)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC,&FunctionTable::m_ptr_glCopyImageSubDataNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}
+void m_glActiveShaderProgram_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC,&FunctionTable::m_ptr_glActiveShaderProgram>(a0,a1);}
+void m_glVertexStream1iATI_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC,&FunctionTable::m_ptr_glVertexStream1iATI>(a0,a1);}
+void m_glPatchParameterfv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC,&FunctionTable::m_ptr_glPatchParameterfv>(a0,a1);}
+GLboolean m_glIsFramebufferEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsFramebufferEXT");return (GLboolean)0;}
+void m_glTextureStorage2D_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC,&FunctionTable::m_ptr_glTextureStorage2D>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform1ui64ARB_record(GLuint a0,GLint a1,GLuint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC,&FunctionTable::m_ptr_glProgramUniform1ui64ARB>(a0,a1,a2);}
+void m_glTexBufferRange_record(GLenum a0,GLenum a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC,&FunctionTable::m_ptr_glTexBufferRange>(a0,a1,a2,a3,a4);}
+void m_glGetPixelTexGenParameterivSGIS_record(GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelTexGenParameterivSGIS");return (void)0;}
+void m_glTextureSubImage3DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLenum a10,const void* a11)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glTextureSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glClipControl_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIPCONTROLPROC,&FunctionTable::m_ptr_glClipControl>(a0,a1);}
+void m_glGetProgramResourceiv_record(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourceiv");return (void)0;}
+void m_glMultiTexCoordP2uiv_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC,&FunctionTable::m_ptr_glMultiTexCoordP2uiv>(a0,a1,a2);}
+void m_glVertexAttribI3ui_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC,&FunctionTable::m_ptr_glVertexAttribI3ui>(a0,a1,a2,a3);}
+void m_glSampleMaskSGIS_record(GLclampf a0,GLboolean a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC,&FunctionTable::m_ptr_glSampleMaskSGIS>(a0,a1);}
+void m_glVertexAttrib4NivARB_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NivARB>(a0,a1);}
+void m_glGlobalAlphaFactorfSUN_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactorfSUN>(a0);}
+void m_glBlendEquationSeparateIndexedAMD_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC,&FunctionTable::m_ptr_glBlendEquationSeparateIndexedAMD>(a0,a1,a2);}
+void m_glGetPerfCounterInfoINTEL_record(GLuint,GLuint,GLuint,GLchar*,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfCounterInfoINTEL");return (void)0;}
+void m_glDeleteProgramsNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC,&FunctionTable::m_ptr_glDeleteProgramsNV>(a0,a1);}
+void m_glPixelZoomxOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC,&FunctionTable::m_ptr_glPixelZoomxOES>(a0,a1);}
+void m_glGetCombinerOutputParameterivNV_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCombinerOutputParameterivNV");return (void)0;}
+void m_glRasterPos2xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC,&FunctionTable::m_ptr_glRasterPos2xvOES>(a0);}
+void m_glGetTexImage_record(GLenum,GLint,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexImage");return (void)0;}
+void m_glVertexArrayVertexBuffers_record(GLuint a0,GLuint a1,GLsizei a2,const GLuint* a3,const GLintptr* a4,const GLsizei* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC,&FunctionTable::m_ptr_glVertexArrayVertexBuffers>(a0,a1,a2,a3,a4,a5);}
+void m_glUniform1ui64NV_record(GLint a0,GLuint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC,&FunctionTable::m_ptr_glUniform1ui64NV>(a0,a1);}
+void m_glProgramParameteri_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC,&FunctionTable::m_ptr_glProgramParameteri>(a0,a1,a2);}
+void m_glNormal3xOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3XOESPROC,&FunctionTable::m_ptr_glNormal3xOES>(a0,a1,a2);}
+void m_glGetMapfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapfv");return (void)0;}
+void m_glVertexStream2dvATI_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC,&FunctionTable::m_ptr_glVertexStream2dvATI>(a0,a1);}
+void m_glPathStencilDepthOffsetNV_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC,&FunctionTable::m_ptr_glPathStencilDepthOffsetNV>(a0,a1);}
+GLboolean m_glIsStateNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsStateNV");return (GLboolean)0;}
+void m_glGetIntegerui64vNV_record(GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetIntegerui64vNV");return (void)0;}
+void m_glGetImageTransformParameterfvHP_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetImageTransformParameterfvHP");return (void)0;}
+void m_glRasterPos2fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC,&FunctionTable::m_ptr_glRasterPos2fv>(a0);}
+void m_glVertex3xOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3XOESPROC,&FunctionTable::m_ptr_glVertex3xOES>(a0,a1);}
+GLboolean m_glIsMemoryObjectEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsMemoryObjectEXT");return (GLboolean)0;}
+void m_glWeightPointerARB_record(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC,&FunctionTable::m_ptr_glWeightPointerARB>(a0,a1,a2,a3);}
+void m_glFinishFenceNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFINISHFENCENVPROC,&FunctionTable::m_ptr_glFinishFenceNV>(a0);}
+void m_glDepthRangexOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC,&FunctionTable::m_ptr_glDepthRangexOES>(a0,a1);}
+void m_glEnableVertexArrayAttribEXT_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC,&FunctionTable::m_ptr_glEnableVertexArrayAttribEXT>(a0,a1);}
+void m_glProgramUniform2uivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC,&FunctionTable::m_ptr_glProgramUniform2uivEXT>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glGetDoubleIndexedvEXT_record(GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDoubleIndexedvEXT");return (void)0;}
+void m_glWindowPos2fMESA_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC,&FunctionTable::m_ptr_glWindowPos2fMESA>(a0,a1);}
+void m_glSecondaryColor3b_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC,&FunctionTable::m_ptr_glSecondaryColor3b>(a0,a1,a2);}
+void m_glCopyConvolutionFilter1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC,&FunctionTable::m_ptr_glCopyConvolutionFilter1DEXT>(a0,a1,a2,a3,a4);}
+void m_glWindowPos2sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC,&FunctionTable::m_ptr_glWindowPos2sv>(a0);}
+void m_glBindFramebufferEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC,&FunctionTable::m_ptr_glBindFramebufferEXT>(a0,a1);}
+GLuint m_glCreateShader_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateShader");return (GLuint)0;}
+GLuint m_glGenPathsNV_record(GLsizei)const{this->m_printUnrecordableFunctionErrorAndExit("glGenPathsNV");return (GLuint)0;}
+void m_glGenRenderbuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenRenderbuffers");return (void)0;}
+void m_glCopyTexSubImage2D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC,&FunctionTable::m_ptr_glCopyTexSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glVertexAttrib4ubvARB_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4ubvARB>(a0,a1);}
+void m_glDrawTextureNV_record(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC,&FunctionTable::m_ptr_glDrawTextureNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glVertexAttribs1svNV_record(GLuint a0,GLsizei a1,const GLshort* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC,&FunctionTable::m_ptr_glVertexAttribs1svNV>(a0,a1,a2);}
+void m_glClearNamedBufferSubDataEXT_record(GLuint a0,GLenum a1,GLsizeiptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC,&FunctionTable::m_ptr_glClearNamedBufferSubDataEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glBlendFuncSeparate_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC,&FunctionTable::m_ptr_glBlendFuncSeparate>(a0,a1,a2,a3);}
+void m_glPointParameterfARB_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC,&FunctionTable::m_ptr_glPointParameterfARB>(a0,a1);}
+void m_glTexCoord2fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC,&FunctionTable::m_ptr_glTexCoord2fv>(a0);}
+void m_glGetVariantFloatvEXT_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantFloatvEXT");return (void)0;}
+void m_glVertexP2ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP2UIPROC,&FunctionTable::m_ptr_glVertexP2ui>(a0,a1);}
+void m_glWindowPos2dMESA_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC,&FunctionTable::m_ptr_glWindowPos2dMESA>(a0,a1);}
+void m_glTexCoord4fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC,&FunctionTable::m_ptr_glTexCoord4fv>(a0);}
+void m_glBindFragDataLocationEXT_record(GLuint a0,GLuint a1,const GLchar* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC,&FunctionTable::m_ptr_glBindFragDataLocationEXT>(a0,a1,a2);}
+void m_glCompressedTexSubImage1DARB_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC,&FunctionTable::m_ptr_glCompressedTexSubImage1DARB>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetTextureImageEXT_record(GLuint,GLenum,GLint,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureImageEXT");return (void)0;}
+void m_glFogCoordd_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDDPROC,&FunctionTable::m_ptr_glFogCoordd>(a0);}
+void m_glPointSize_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTSIZEPROC,&FunctionTable::m_ptr_glPointSize>(a0);}
+void m_glBindTextureUnit_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC,&FunctionTable::m_ptr_glBindTextureUnit>(a0,a1);}
+void m_glProgramEnvParameterI4uiNV_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC,&FunctionTable::m_ptr_glProgramEnvParameterI4uiNV>(a0,a1,a2,a3,a4,a5);}
+void m_glGetProgramPipelineInfoLog_record(GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramPipelineInfoLog");return (void)0;}
+void m_glProgramUniform4i64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC,&FunctionTable::m_ptr_glProgramUniform4i64vARB>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glVertexAttrib4Nuiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC,&FunctionTable::m_ptr_glVertexAttrib4Nuiv>(a0,a1);}
+void m_glGetUniformfvARB_record(GLhandleARB,GLint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformfvARB");return (void)0;}
+void m_glWaitSync_record(GLsync a0,GLbitfield a1,GLuint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWAITSYNCPROC,&FunctionTable::m_ptr_glWaitSync>(a0,a1,a2);}
+void m_glUniform3i_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3IPROC,&FunctionTable::m_ptr_glUniform3i>(a0,a1,a2,a3);}
+void m_glBlendEquationSeparatei_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC,&FunctionTable::m_ptr_glBlendEquationSeparatei>(a0,a1,a2);}
+void m_glVertexAttrib2hvNV_record(GLuint a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC,&FunctionTable::m_ptr_glVertexAttrib2hvNV>(a0,a1);}
+void m_glTextureParameterivEXT_record(GLuint a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC,&FunctionTable::m_ptr_glTextureParameterivEXT>(a0,a1,a2,a3);}
+void m_glUniform3d_record(GLint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3DPROC,&FunctionTable::m_ptr_glUniform3d>(a0,a1,a2,a3);}
+void m_glUniform3f_record(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3FPROC,&FunctionTable::m_ptr_glUniform3f>(a0,a1,a2,a3);}
+void m_glActiveProgramEXT_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC,&FunctionTable::m_ptr_glActiveProgramEXT>(a0);}
+void m_glProgramUniform3uiv_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC,&FunctionTable::m_ptr_glProgramUniform3uiv>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glUniform3ui64vARB_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC,&FunctionTable::m_ptr_glUniform3ui64vARB>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glProgramUniform1ui64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC,&FunctionTable::m_ptr_glProgramUniform1ui64vARB>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glTextureParameterfEXT_record(GLuint a0,GLenum a1,GLenum a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC,&FunctionTable::m_ptr_glTextureParameterfEXT>(a0,a1,a2,a3);}
+void m_glSetFragmentShaderConstantATI_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC,&FunctionTable::m_ptr_glSetFragmentShaderConstantATI>(a0,a1);}
+void m_glColorSubTable_record(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC,&FunctionTable::m_ptr_glColorSubTable>(a0,a1,a2,a3,a4,a5);}
+void m_glReplacementCodeuiSUN_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiSUN>(a0);}
+void m_glStateCaptureNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC,&FunctionTable::m_ptr_glStateCaptureNV>(a0,a1);}
+void m_glBindAttribLocation_record(GLuint a0,GLuint a1,const GLchar* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC,&FunctionTable::m_ptr_glBindAttribLocation>(a0,a1,a2);}
+void m_glWeightusvARB_record(GLint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC,&FunctionTable::m_ptr_glWeightusvARB>(a0,a1);}
+GLint m_glGetFragDataIndex_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragDataIndex");return (GLint)0;}
+void m_glMultiTexCoord2xOES_record(GLenum a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC,&FunctionTable::m_ptr_glMultiTexCoord2xOES>(a0,a1,a2);}
+void m_glColor3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3SVPROC,&FunctionTable::m_ptr_glColor3sv>(a0);}
+void m_glTexCoord2fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glTexCoord2fVertex3fSUN>(a0,a1,a2,a3,a4);}
+void m_glGetMemoryObjectParameterivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMemoryObjectParameterivEXT");return (void)0;}
+void m_glPolygonOffsetEXT_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC,&FunctionTable::m_ptr_glPolygonOffsetEXT>(a0,a1);}
+void m_glWeightPathsNV_record(GLuint a0,GLsizei a1,const GLuint* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC,&FunctionTable::m_ptr_glWeightPathsNV>(a0,a1,a2,a3);}
+void m_glCombinerStageParameterfvNV_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC,&FunctionTable::m_ptr_glCombinerStageParameterfvNV>(a0,a1,a2);}
+void m_glPointParameterfEXT_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC,&FunctionTable::m_ptr_glPointParameterfEXT>(a0,a1);}
+void m_glCopyTexImage1DEXT_record(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyTexImage1DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertex4sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4SVPROC,&FunctionTable::m_ptr_glVertex4sv>(a0);}
+void m_glMatrixMultfEXT_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC,&FunctionTable::m_ptr_glMatrixMultfEXT>(a0,a1);}
+void m_glCompressedTextureSubImage3DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLsizei a10,const void* a11)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glGetTexLevelParameterxvOES_record(GLenum,GLint,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexLevelParameterxvOES");return (void)0;}
+void m_glVertexAttribL3dvEXT_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC,&FunctionTable::m_ptr_glVertexAttribL3dvEXT>(a0,a1);}
+void m_glMultiTexCoordP4ui_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC,&FunctionTable::m_ptr_glMultiTexCoordP4ui>(a0,a1,a2);}
+void m_glGetTextureLevelParameterivEXT_record(GLuint,GLenum,GLint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureLevelParameterivEXT");return (void)0;}
+void m_glAlphaFragmentOp2ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC,&FunctionTable::m_ptr_glAlphaFragmentOp2ATI>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glDeleteFramebuffers_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC,&FunctionTable::m_ptr_glDeleteFramebuffers>(a0,a1);}
+void m_glDrawArrays_record(GLenum a0,GLint a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSPROC,&FunctionTable::m_ptr_glDrawArrays>(a0,a1,a2);}
+void m_glGetTransformFeedbackiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbackiv");return (void)0;}
+void m_glGetnTexImageARB_record(GLenum,GLint,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnTexImageARB");return (void)0;}
+void m_glClear_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARPROC,&FunctionTable::m_ptr_glClear>(a0);}
+void m_glVertexArrayParameteriAPPLE_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC,&FunctionTable::m_ptr_glVertexArrayParameteriAPPLE>(a0,a1);}
+void m_glMultiTexCoord2dvARB_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2dvARB>(a0,a1);}
+void m_glGetVideoCaptureStreamdvNV_record(GLuint,GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoCaptureStreamdvNV");return (void)0;}
+void m_glFragmentLightModelivSGIX_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC,&FunctionTable::m_ptr_glFragmentLightModelivSGIX>(a0,a1);}
+void m_glVertexAttribP2ui_record(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC,&FunctionTable::m_ptr_glVertexAttribP2ui>(a0,a1,a2,a3);}
+void m_glMultiTexCoordPointerEXT_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC,&FunctionTable::m_ptr_glMultiTexCoordPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform3iEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC,&FunctionTable::m_ptr_glProgramUniform3iEXT>(a0,a1,a2,a3,a4);}
+void m_glTranslatef_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSLATEFPROC,&FunctionTable::m_ptr_glTranslatef>(a0,a1,a2);}
+void m_glVertexAttrib4Nub_record(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC,&FunctionTable::m_ptr_glVertexAttrib4Nub>(a0,a1,a2,a3,a4);}
+void m_glTranslated_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSLATEDPROC,&FunctionTable::m_ptr_glTranslated>(a0,a1,a2);}
+void m_glSamplerParameterIiv_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC,&FunctionTable::m_ptr_glSamplerParameterIiv>(a0,a1,a2);}
+void m_glTexCoord4hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC,&FunctionTable::m_ptr_glTexCoord4hNV>(a0,a1,a2,a3);}
+void m_glDrawElementsIndirect_record(GLenum a0,GLenum a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC,&FunctionTable::m_ptr_glDrawElementsIndirect>(a0,a1,a2);}
+void m_glDeletePerfMonitorsAMD_record(GLsizei a0,GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC,&FunctionTable::m_ptr_glDeletePerfMonitorsAMD>(a0,a1);}
+GLboolean m_glIsRenderbufferEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsRenderbufferEXT");return (GLboolean)0;}
+void m_glDrawCommandsNV_record(GLenum a0,GLuint a1,const GLintptr* a2,const GLsizei* a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC,&FunctionTable::m_ptr_glDrawCommandsNV>(a0,a1,a2,a3,a4);}
+void m_glUniform3ivARB_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC,&FunctionTable::m_ptr_glUniform3ivARB>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glBufferSubData_record(GLenum a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glBufferSubData>(a0,a1,a2,this->m_copy(a3,a2,1));}
+void m_glSecondaryColor3bv_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC,&FunctionTable::m_ptr_glSecondaryColor3bv>(a0);}
+void m_glMatrixMultTransposedEXT_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC,&FunctionTable::m_ptr_glMatrixMultTransposedEXT>(a0,a1);}
+void m_glRequestResidentProgramsNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC,&FunctionTable::m_ptr_glRequestResidentProgramsNV>(a0,a1);}
+void m_glAlphaFragmentOp1ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC,&FunctionTable::m_ptr_glAlphaFragmentOp1ATI>(a0,a1,a2,a3,a4,a5);}
+void m_glGetQueryObjecti64v_record(GLuint,GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjecti64v");return (void)0;}
+void m_glMatrixMult3x3fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC,&FunctionTable::m_ptr_glMatrixMult3x3fNV>(a0,a1);}
+void m_glColorTableParameteriv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC,&FunctionTable::m_ptr_glColorTableParameteriv>(a0,a1,a2);}
+void m_glPathSubCommandsNV_record(GLuint a0,GLsizei a1,GLsizei a2,GLsizei a3,const GLubyte* a4,GLsizei a5,GLenum a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC,&FunctionTable::m_ptr_glPathSubCommandsNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetFinalCombinerInputParameterivNV_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFinalCombinerInputParameterivNV");return (void)0;}
+GLboolean m_glIsRenderbuffer_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsRenderbuffer");return (GLboolean)0;}
+void m_glVertex3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3IVPROC,&FunctionTable::m_ptr_glVertex3iv>(a0);}
+void m_glTexGenfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENFVPROC,&FunctionTable::m_ptr_glTexGenfv>(a0,a1,a2);}
+void m_glFrustumfOES_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC,&FunctionTable::m_ptr_glFrustumfOES>(a0,a1,a2,a3,a4,a5);}
+void m_glBindVertexBuffers_record(GLuint a0,GLsizei a1,const GLuint* a2,const GLintptr* a3,const GLsizei* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC,&FunctionTable::m_ptr_glBindVertexBuffers>(a0,a1,a2,a3,a4);}
+void m_glMateriali_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALIPROC,&FunctionTable::m_ptr_glMateriali>(a0,a1,a2);}
+void m_glMultiTexCoord2svARB_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2svARB>(a0,a1);}
+void m_glDisableVertexAttribArray_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC,&FunctionTable::m_ptr_glDisableVertexAttribArray>(a0);}
+void m_glWindowPos3ivARB_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC,&FunctionTable::m_ptr_glWindowPos3ivARB>(a0);}
+void m_glTexCoordFormatNV_record(GLint a0,GLenum a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC,&FunctionTable::m_ptr_glTexCoordFormatNV>(a0,a1,a2);}
+void m_glBlitNamedFramebuffer_record(GLuint a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLint a8,GLint a9,GLbitfield a10,GLenum a11)const{this->template m_record<FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC,&FunctionTable::m_ptr_glBlitNamedFramebuffer>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glMatrixLoadTransposefEXT_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC,&FunctionTable::m_ptr_glMatrixLoadTransposefEXT>(a0,a1);}
+void m_glMultiTexGenfEXT_record(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC,&FunctionTable::m_ptr_glMultiTexGenfEXT>(a0,a1,a2,a3);}
+void m_glShaderStorageBlockBinding_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC,&FunctionTable::m_ptr_glShaderStorageBlockBinding>(a0,a1,a2);}
+void m_glMaterialf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALFPROC,&FunctionTable::m_ptr_glMaterialf>(a0,a1,a2);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+GLenum m_glCheckNamedFramebufferStatusEXT_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCheckNamedFramebufferStatusEXT");return (GLenum)0;}
+void m_glVertexArrayVertexAttribFormatEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLboolean a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribFormatEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertex2hNV_record(GLhalfNV a0,GLhalfNV a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2HNVPROC,&FunctionTable::m_ptr_glVertex2hNV>(a0,a1);}
+void m_glDeleteVertexShaderEXT_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC,&FunctionTable::m_ptr_glDeleteVertexShaderEXT>(a0);}
+void m_glTexImage3DEXT_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC,&FunctionTable::m_ptr_glTexImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glSignalVkFenceNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC,&FunctionTable::m_ptr_glSignalVkFenceNV>(a0);}
+void m_glProgramLocalParameterI4ivNV_record(GLenum a0,GLuint a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC,&FunctionTable::m_ptr_glProgramLocalParameterI4ivNV>(a0,a1,a2);}
+void m_glGlobalAlphaFactoriSUN_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactoriSUN>(a0);}
+void m_glTextureStorage1D_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC,&FunctionTable::m_ptr_glTextureStorage1D>(a0,a1,a2,a3);}
+void m_glBinormal3sEXT_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC,&FunctionTable::m_ptr_glBinormal3sEXT>(a0,a1,a2);}
+void m_glGetProgramInterfaceiv_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramInterfaceiv");return (void)0;}
+void m_glMatrixIndexPointerARB_record(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC,&FunctionTable::m_ptr_glMatrixIndexPointerARB>(a0,a1,a2,a3);}
+void m_glTexCoordPointerEXT_record(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC,&FunctionTable::m_ptr_glTexCoordPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glMultiTexGeniEXT_record(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC,&FunctionTable::m_ptr_glMultiTexGeniEXT>(a0,a1,a2,a3);}
+void m_glVertexAttrib2fNV_record(GLuint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC,&FunctionTable::m_ptr_glVertexAttrib2fNV>(a0,a1,a2);}
+void m_glNamedProgramStringEXT_record(GLuint a0,GLenum a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC,&FunctionTable::m_ptr_glNamedProgramStringEXT>(a0,a1,a2,a3,a4);}
+void* m_glMapNamedBuffer_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glMapNamedBuffer");return (void*)0;}
+void m_glGetMinmaxParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmaxParameteriv");return (void)0;}
+void m_glGetnUniformdv_record(GLuint,GLint,GLsizei,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformdv");return (void)0;}
+void m_glEndConditionalRenderNVX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC,&FunctionTable::m_ptr_glEndConditionalRenderNVX>();}
+void m_glBinormal3fEXT_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC,&FunctionTable::m_ptr_glBinormal3fEXT>(a0,a1,a2);}
+void m_glNormalStream3iATI_record(GLenum a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC,&FunctionTable::m_ptr_glNormalStream3iATI>(a0,a1,a2,a3);}
+void m_glProgramBufferParametersIivNV_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC,&FunctionTable::m_ptr_glProgramBufferParametersIivNV>(a0,a1,a2,a3,a4);}
+void m_glMapGrid1xOES_record(GLint a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC,&FunctionTable::m_ptr_glMapGrid1xOES>(a0,a1,a2);}
+void m_glGetVertexAttribPointervARB_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribPointervARB");return (void)0;}
+void m_glFlushMappedNamedBufferRangeEXT_record(GLuint a0,GLintptr a1,GLsizeiptr a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC,&FunctionTable::m_ptr_glFlushMappedNamedBufferRangeEXT>(a0,a1,a2);}
+void m_glGetVertexAttribIiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribIiv");return (void)0;}
+void m_glVertexP4uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC,&FunctionTable::m_ptr_glVertexP4uiv>(a0,a1);}
+void m_glUniformui64NV_record(GLint a0,GLuint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC,&FunctionTable::m_ptr_glUniformui64NV>(a0,a1);}
+void m_glColor4fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4FVPROC,&FunctionTable::m_ptr_glColor4fv>(a0);}
+void m_glTexParameterxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC,&FunctionTable::m_ptr_glTexParameterxvOES>(a0,a1,a2);}
+void m_glPatchParameteri_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC,&FunctionTable::m_ptr_glPatchParameteri>(a0,a1);}
+void m_glMap1d_record(GLenum a0,GLdouble a1,GLdouble a2,GLint a3,GLint a4,const GLdouble* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP1DPROC,&FunctionTable::m_ptr_glMap1d>(a0,a1,a2,a3,a4,a5);}
+void m_glGetTexFilterFuncSGIS_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexFilterFuncSGIS");return (void)0;}
+void m_glVertexStream3dATI_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC,&FunctionTable::m_ptr_glVertexStream3dATI>(a0,a1,a2,a3);}
+void m_glVertexArrayVertexBindingDivisorEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexBindingDivisorEXT>(a0,a1,a2);}
+void m_glMultiTexCoord3svARB_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3svARB>(a0,a1);}
+void m_glBindProgramNV_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC,&FunctionTable::m_ptr_glBindProgramNV>(a0,a1);}
+void m_glGetConvolutionParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionParameteriv");return (void)0;}
+void m_glGetProgramLocalParameterfvARB_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramLocalParameterfvARB");return (void)0;}
+GLuint m_glGenFragmentShadersATI_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGenFragmentShadersATI");return (GLuint)0;}
+void m_glTexBumpParameterivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC,&FunctionTable::m_ptr_glTexBumpParameterivATI>(a0,a1);}
+void m_glGetNamedFramebufferAttachmentParameteriv_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedFramebufferAttachmentParameteriv");return (void)0;}
+void m_glGetnSeparableFilter_record(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnSeparableFilter");return (void)0;}
+void m_glNormal3xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC,&FunctionTable::m_ptr_glNormal3xvOES>(a0);}
+void m_glPassTexCoordATI_record(GLuint a0,GLuint a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC,&FunctionTable::m_ptr_glPassTexCoordATI>(a0,a1,a2);}
+void m_glFramebufferTextureFaceARB_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC,&FunctionTable::m_ptr_glFramebufferTextureFaceARB>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform1dv_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC,&FunctionTable::m_ptr_glProgramUniform1dv>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glTextureStorage2DEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC,&FunctionTable::m_ptr_glTextureStorage2DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexArrayFogCoordOffsetEXT_record(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayFogCoordOffsetEXT>(a0,a1,a2,a3,a4);}
+void m_glDeleteNamedStringARB_record(GLint a0,const GLchar* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC,&FunctionTable::m_ptr_glDeleteNamedStringARB>(a0,a1);}
+void m_glMulticastGetQueryObjecti64vNV_record(GLuint a0,GLuint a1,GLenum a2,GLint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC,&FunctionTable::m_ptr_glMulticastGetQueryObjecti64vNV>(a0,a1,a2,a3);}
+void m_glGenOcclusionQueriesNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenOcclusionQueriesNV");return (void)0;}
+void m_glLighti_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTIPROC,&FunctionTable::m_ptr_glLighti>(a0,a1,a2);}
+void m_glTexImage1D_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLint a4,GLenum a5,GLenum a6,const GLvoid* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC,&FunctionTable::m_ptr_glTexImage1D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glLightf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTFPROC,&FunctionTable::m_ptr_glLightf>(a0,a1,a2);}
+void m_glClientAttribDefaultEXT_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC,&FunctionTable::m_ptr_glClientAttribDefaultEXT>(a0);}
+void m_glVertexAttrib4bvARB_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4bvARB>(a0,a1);}
+void m_glVertexAttribIFormatNV_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC,&FunctionTable::m_ptr_glVertexAttribIFormatNV>(a0,a1,a2,a3);}
+void m_glStencilFuncSeparate_record(GLenum a0,GLenum a1,GLint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC,&FunctionTable::m_ptr_glStencilFuncSeparate>(a0,a1,a2,a3);}
+void m_glGetVertexAttribfvARB_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribfvARB");return (void)0;}
+void m_glVertexAttrib2dNV_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC,&FunctionTable::m_ptr_glVertexAttrib2dNV>(a0,a1,a2);}
+void m_glProgramUniform2iEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC,&FunctionTable::m_ptr_glProgramUniform2iEXT>(a0,a1,a2,a3);}
+void m_glClientActiveVertexStreamATI_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC,&FunctionTable::m_ptr_glClientActiveVertexStreamATI>(a0);}
+void m_glRasterPos3xOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC,&FunctionTable::m_ptr_glRasterPos3xOES>(a0,a1,a2);}
+void m_glGetMapParameterivNV_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapParameterivNV");return (void)0;}
+void m_glSampleCoverage_record(GLclampf a0,GLboolean a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC,&FunctionTable::m_ptr_glSampleCoverage>(a0,a1);}
+void m_glClearDepthxOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC,&FunctionTable::m_ptr_glClearDepthxOES>(a0);}
+void m_glUniformBufferEXT_record(GLuint a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC,&FunctionTable::m_ptr_glUniformBufferEXT>(a0,a1,a2);}
+void m_glTexCoord2fNormal3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glTexCoord2fNormal3fVertex3fvSUN>(a0,a1,a2);}
+void m_glMulticastGetQueryObjectuivNV_record(GLuint a0,GLuint a1,GLenum a2,GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC,&FunctionTable::m_ptr_glMulticastGetQueryObjectuivNV>(a0,a1,a2,a3);}
+void m_glGetFirstPerfQueryIdINTEL_record(GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFirstPerfQueryIdINTEL");return (void)0;}
+GLboolean m_glUnmapNamedBufferEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glUnmapNamedBufferEXT");return (GLboolean)0;}
+void m_glGetTransformFeedbacki_v_record(GLuint,GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbacki_v");return (void)0;}
+void m_glUniform4fvARB_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC,&FunctionTable::m_ptr_glUniform4fvARB>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glRenderbufferStorageMultisampleCoverageNV_record(GLenum a0,GLsizei a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC,&FunctionTable::m_ptr_glRenderbufferStorageMultisampleCoverageNV>(a0,a1,a2,a3,a4,a5);}
+void m_glGetFloati_vEXT_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFloati_vEXT");return (void)0;}
+void m_glBindAttribLocationARB_record(GLhandleARB a0,GLuint a1,const GLcharARB* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC,&FunctionTable::m_ptr_glBindAttribLocationARB>(a0,a1,a2);}
+void m_glBufferAddressRangeNV_record(GLenum a0,GLuint a1,GLuint64EXT a2,GLsizeiptr a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC,&FunctionTable::m_ptr_glBufferAddressRangeNV>(a0,a1,a2,a3);}
+void m_glGenProgramsARB_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenProgramsARB");return (void)0;}
+void m_glMultiTexEnvivEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC,&FunctionTable::m_ptr_glMultiTexEnvivEXT>(a0,a1,a2,a3);}
+void m_glSecondaryColor3uiEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3uiEXT>(a0,a1,a2);}
+void m_glCompressedTextureImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glUniform2i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2IPROC,&FunctionTable::m_ptr_glUniform2i>(a0,a1,a2);}
+void m_glCopyTexImage2DEXT_record(GLenum a0,GLint a1,GLenum a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLint a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyTexImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glUniform2d_record(GLint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2DPROC,&FunctionTable::m_ptr_glUniform2d>(a0,a1,a2);}
+void m_glVertexAttribL1d_record(GLuint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC,&FunctionTable::m_ptr_glVertexAttribL1d>(a0,a1);}
+void m_glFramebufferTextureFaceEXT_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC,&FunctionTable::m_ptr_glFramebufferTextureFaceEXT>(a0,a1,a2,a3,a4);}
+void m_glFramebufferTextureLayer_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC,&FunctionTable::m_ptr_glFramebufferTextureLayer>(a0,a1,a2,a3,a4);}
+void m_glMultiTexCoord4bvOES_record(GLenum a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord4bvOES>(a0,a1);}
+void m_glGetVertexArrayPointeri_vEXT_record(GLuint,GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayPointeri_vEXT");return (void)0;}
+void m_glNamedProgramLocalParameter4dEXT_record(GLuint a0,GLenum a1,GLuint a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameter4dEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glBinormal3bEXT_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC,&FunctionTable::m_ptr_glBinormal3bEXT>(a0,a1,a2);}
+void m_glConvolutionFilter2DEXT_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC,&FunctionTable::m_ptr_glConvolutionFilter2DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glProgramUniform2fv_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC,&FunctionTable::m_ptr_glProgramUniform2fv>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glColor3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glColor3fVertex3fSUN>(a0,a1,a2,a3,a4,a5);}
+void m_glNormal3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glNormal3fVertex3fvSUN>(a0,a1);}
+void m_glCopyMultiTexSubImage3DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLsizei a8,GLsizei a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCopyMultiTexSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glProgramLocalParameterI4iNV_record(GLenum a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC,&FunctionTable::m_ptr_glProgramLocalParameterI4iNV>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramUniformMatrix2x4dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x4dv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*4*sizeof(*a4)));}
+GLenum m_glPathMemoryGlyphIndexArrayNV_record(GLuint,GLenum,GLsizeiptr,const void*,GLsizei,GLuint,GLsizei,GLuint,GLfloat)const{this->m_printUnrecordableFunctionErrorAndExit("glPathMemoryGlyphIndexArrayNV");return (GLenum)0;}
+void m_glDrawArraysEXT_record(GLenum a0,GLint a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC,&FunctionTable::m_ptr_glDrawArraysEXT>(a0,a1,a2);}
+void m_glBlendEquationEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC,&FunctionTable::m_ptr_glBlendEquationEXT>(a0);}
+void m_glStencilOp_record(GLenum a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILOPPROC,&FunctionTable::m_ptr_glStencilOp>(a0,a1,a2);}
+void m_glCopyTextureSubImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyTextureSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glTexEnvf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVFPROC,&FunctionTable::m_ptr_glTexEnvf>(a0,a1,a2);}
+void m_glVertexAttrib2dvNV_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC,&FunctionTable::m_ptr_glVertexAttrib2dvNV>(a0,a1);}
+void m_glGenPerfMonitorsAMD_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenPerfMonitorsAMD");return (void)0;}
+void m_glGetInteger64i_v_record(GLenum,GLuint,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInteger64i_v");return (void)0;}
+void m_glGetHistogramParameterfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramParameterfv");return (void)0;}
+void m_glVertexFormatNV_record(GLint a0,GLenum a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC,&FunctionTable::m_ptr_glVertexFormatNV>(a0,a1,a2);}
+void m_glBlendFuncIndexedAMD_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC,&FunctionTable::m_ptr_glBlendFuncIndexedAMD>(a0,a1,a2);}
+void m_glTexEnvi_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVIPROC,&FunctionTable::m_ptr_glTexEnvi>(a0,a1,a2);}
+void m_glMultiTexCoord1iv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC,&FunctionTable::m_ptr_glMultiTexCoord1iv>(a0,a1);}
+GLboolean m_glIsEnabledi_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsEnabledi");return (GLboolean)0;}
+void m_glVertexAttribL2ui64vNV_record(GLuint a0,const GLuint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL2ui64vNV>(a0,a1);}
+void m_glVertexAttribL4i64NV_record(GLuint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC,&FunctionTable::m_ptr_glVertexAttribL4i64NV>(a0,a1,a2,a3,a4);}
+void m_glMatrixTranslatedEXT_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC,&FunctionTable::m_ptr_glMatrixTranslatedEXT>(a0,a1,a2,a3);}
+void m_glMakeTextureHandleResidentARB_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC,&FunctionTable::m_ptr_glMakeTextureHandleResidentARB>(a0);}
+void m_glMatrixMultdEXT_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC,&FunctionTable::m_ptr_glMatrixMultdEXT>(a0,a1);}
+void m_glBinormal3dvEXT_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC,&FunctionTable::m_ptr_glBinormal3dvEXT>(a0);}
+GLsync m_glImportSyncEXT_record(GLenum,GLintptr,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glImportSyncEXT");return (GLsync)0;}
+void m_glGetMapiv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapiv");return (void)0;}
+void m_glImportSemaphoreFdEXT_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC,&FunctionTable::m_ptr_glImportSemaphoreFdEXT>(a0,a1,a2);}
+void m_glMultiTexCoord4sv_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC,&FunctionTable::m_ptr_glMultiTexCoord4sv>(a0,a1);}
+void m_glPNTrianglesiATI_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC,&FunctionTable::m_ptr_glPNTrianglesiATI>(a0,a1);}
+void m_glBindVertexArrayAPPLE_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC,&FunctionTable::m_ptr_glBindVertexArrayAPPLE>(a0);}
+void m_glObjectPtrLabel_record(const void* a0,GLsizei a1,const GLchar* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC,&FunctionTable::m_ptr_glObjectPtrLabel>(a0,a1,a2);}
+GLuint m_glGetDebugMessageLog_record(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDebugMessageLog");return (GLuint)0;}
+void m_glTrackMatrixNV_record(GLenum a0,GLuint a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC,&FunctionTable::m_ptr_glTrackMatrixNV>(a0,a1,a2,a3);}
+void m_glProgramPathFragmentInputGenNV_record(GLuint a0,GLint a1,GLenum a2,GLint a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC,&FunctionTable::m_ptr_glProgramPathFragmentInputGenNV>(a0,a1,a2,a3,a4);}
+void m_glTangent3ivEXT_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC,&FunctionTable::m_ptr_glTangent3ivEXT>(a0);}
+void m_glGetUniformfv_record(GLuint,GLint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformfv");return (void)0;}
+void m_glSecondaryColor3ubv_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC,&FunctionTable::m_ptr_glSecondaryColor3ubv>(a0);}
+void m_glMakeTextureHandleNonResidentNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeTextureHandleNonResidentNV>(a0);}
+void m_glVertexAttribs4ubvNV_record(GLuint a0,GLsizei a1,const GLubyte* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC,&FunctionTable::m_ptr_glVertexAttribs4ubvNV>(a0,a1,a2);}
+void m_glClipPlanexOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC,&FunctionTable::m_ptr_glClipPlanexOES>(a0,a1);}
+void m_glMultiTexCoord3iv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC,&FunctionTable::m_ptr_glMultiTexCoord3iv>(a0,a1);}
+void m_glGetnPolygonStippleARB_record(GLsizei,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPolygonStippleARB");return (void)0;}
+void m_glUniform2i64vNV_record(GLint a0,GLsizei a1,const GLint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC,&FunctionTable::m_ptr_glUniform2i64vNV>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glLightModelf_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELFPROC,&FunctionTable::m_ptr_glLightModelf>(a0,a1);}
+void m_glDeleteMemoryObjectsEXT_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC,&FunctionTable::m_ptr_glDeleteMemoryObjectsEXT>(a0,a1);}
+void m_glMultiTexSubImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLenum a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glMultiTexSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glReplacementCodeuiColor3fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glTangent3dvEXT_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC,&FunctionTable::m_ptr_glTangent3dvEXT>(a0);}
+void m_glLightModeli_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELIPROC,&FunctionTable::m_ptr_glLightModeli>(a0,a1);}
+void m_glVertexWeighthvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC,&FunctionTable::m_ptr_glVertexWeighthvNV>(a0);}
+void m_glWindowPos3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC,&FunctionTable::m_ptr_glWindowPos3iv>(a0);}
+void m_glMultiTexCoordP1uiv_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC,&FunctionTable::m_ptr_glMultiTexCoordP1uiv>(a0,a1,a2);}
+void m_glTransformPathNV_record(GLuint a0,GLuint a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC,&FunctionTable::m_ptr_glTransformPathNV>(a0,a1,a2,a3);}
+void m_glProgramNamedParameter4dNV_record(GLuint a0,GLsizei a1,const GLubyte* a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC,&FunctionTable::m_ptr_glProgramNamedParameter4dNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glMultiDrawElementsIndirect_record(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirect>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform1dEXT_record(GLuint a0,GLint a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC,&FunctionTable::m_ptr_glProgramUniform1dEXT>(a0,a1,a2);}
+void m_glCallLists_record(GLsizei a0,GLenum a1,const GLvoid* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCALLLISTSPROC,&FunctionTable::m_ptr_glCallLists>(a0,a1,a2);}
+void m_glNormal3hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC,&FunctionTable::m_ptr_glNormal3hvNV>(a0);}
+void m_glGetCombinerOutputParameterfvNV_record(GLenum,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCombinerOutputParameterfvNV");return (void)0;}
+void m_glVertexAttrib4sARB_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC,&FunctionTable::m_ptr_glVertexAttrib4sARB>(a0,a1,a2,a3,a4);}
+void m_glTexCoord3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3IPROC,&FunctionTable::m_ptr_glTexCoord3i>(a0,a1,a2);}
+void m_glVertexAttribI3uiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC,&FunctionTable::m_ptr_glVertexAttribI3uiv>(a0,a1);}
+void m_glPushDebugGroup_record(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC,&FunctionTable::m_ptr_glPushDebugGroup>(a0,a1,a2,a3);}
+void m_glTexCoord3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3FPROC,&FunctionTable::m_ptr_glTexCoord3f>(a0,a1,a2);}
+void m_glTexCoord3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3DPROC,&FunctionTable::m_ptr_glTexCoord3d>(a0,a1,a2);}
+void m_glTexCoord2xOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC,&FunctionTable::m_ptr_glTexCoord2xOES>(a0,a1);}
+GLushort m_glGetStageIndexNV_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGetStageIndexNV");return (GLushort)0;}
+void m_glProgramUniform4i64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC,&FunctionTable::m_ptr_glProgramUniform4i64vNV>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glGetNamedBufferPointervEXT_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferPointervEXT");return (void)0;}
+void m_glTextureBarrierNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC,&FunctionTable::m_ptr_glTextureBarrierNV>();}
+void m_glColor4ubVertex3fvSUN_record(const GLubyte* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glColor4ubVertex3fvSUN>(a0,a1);}
+GLuint m_glGetCommandHeaderNV_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCommandHeaderNV");return (GLuint)0;}
+void m_glGetPerfMonitorCounterInfoAMD_record(GLuint,GLuint,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorCounterInfoAMD");return (void)0;}
+void m_glVertexAttrib1svARB_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC,&FunctionTable::m_ptr_glVertexAttrib1svARB>(a0,a1);}
+void m_glCombinerParameteriNV_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC,&FunctionTable::m_ptr_glCombinerParameteriNV>(a0,a1);}
+void m_glMatrixMultTransposefEXT_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC,&FunctionTable::m_ptr_glMatrixMultTransposefEXT>(a0,a1);}
+void m_glDetailTexFuncSGIS_record(GLenum a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC,&FunctionTable::m_ptr_glDetailTexFuncSGIS>(a0,a1,a2);}
+GLboolean m_glAreTexturesResident_record(GLsizei,const GLuint*,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glAreTexturesResident");return (GLboolean)0;}
+void m_glProgramUniform2d_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC,&FunctionTable::m_ptr_glProgramUniform2d>(a0,a1,a2,a3);}
+void m_glGetConvolutionParameterfvEXT_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionParameterfvEXT");return (void)0;}
+void m_glIndexPointerListIBM_record(GLenum a0,GLint a1,const void** a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glIndexPointerListIBM>(a0,a1,a2,a3);}
+void m_glVertexAttribI4iEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4iEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform2f_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC,&FunctionTable::m_ptr_glProgramUniform2f>(a0,a1,a2,a3);}
+void m_glRasterPos4sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC,&FunctionTable::m_ptr_glRasterPos4sv>(a0);}
+void m_glColor4s_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4SPROC,&FunctionTable::m_ptr_glColor4s>(a0,a1,a2,a3);}
+void m_glMulticastGetQueryObjectivNV_record(GLuint a0,GLuint a1,GLenum a2,GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC,&FunctionTable::m_ptr_glMulticastGetQueryObjectivNV>(a0,a1,a2,a3);}
+void m_glColorFragmentOp3ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9,GLuint a10,GLuint a11,GLuint a12)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC,&FunctionTable::m_ptr_glColorFragmentOp3ATI>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+void m_glResizeBuffersMESA_record()const{this->template m_record<FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC,&FunctionTable::m_ptr_glResizeBuffersMESA>();}
+void m_glGetMinmaxParameterfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmaxParameterfv");return (void)0;}
+void m_glClientActiveTextureARB_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC,&FunctionTable::m_ptr_glClientActiveTextureARB>(a0);}
+void m_glBindVertexArray_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC,&FunctionTable::m_ptr_glBindVertexArray>(a0);}
+void m_glColor4b_record(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4BPROC,&FunctionTable::m_ptr_glColor4b>(a0,a1,a2,a3);}
+void m_glColor4f_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4FPROC,&FunctionTable::m_ptr_glColor4f>(a0,a1,a2,a3);}
+void m_glColor4d_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4DPROC,&FunctionTable::m_ptr_glColor4d>(a0,a1,a2,a3);}
+void m_glColor4i_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4IPROC,&FunctionTable::m_ptr_glColor4i>(a0,a1,a2,a3);}
+void m_glEdgeFlagFormatNV_record(GLsizei a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC,&FunctionTable::m_ptr_glEdgeFlagFormatNV>(a0);}
+void m_glNamedBufferSubData_record(GLuint a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glNamedBufferSubData>(a0,a1,a2,this->m_copy(a3,a2,1));}
+void m_glDrawElementsInstanced_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC,&FunctionTable::m_ptr_glDrawElementsInstanced>(a0,a1,a2,a3,a4);}
+void m_glGetMultiTexParameterIivEXT_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexParameterIivEXT");return (void)0;}
+void m_glVertex2dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2DVPROC,&FunctionTable::m_ptr_glVertex2dv>(a0);}
+void m_glDisableVertexArrayAttribEXT_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC,&FunctionTable::m_ptr_glDisableVertexArrayAttribEXT>(a0,a1);}
+GLenum m_glObjectUnpurgeableAPPLE_record(GLenum,GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glObjectUnpurgeableAPPLE");return (GLenum)0;}
+void m_glVertexAttribs2dvNV_record(GLuint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC,&FunctionTable::m_ptr_glVertexAttribs2dvNV>(a0,a1,a2);}
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN>(a0,a1,a2,a3,a4,a5);}
+void m_glGetMapParameterfvNV_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapParameterfvNV");return (void)0;}
+void m_glProgramUniform4ivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC,&FunctionTable::m_ptr_glProgramUniform4ivEXT>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glProgramUniform3ui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC,&FunctionTable::m_ptr_glProgramUniform3ui64vNV>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glRectfv_record(const GLfloat* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTFVPROC,&FunctionTable::m_ptr_glRectfv>(a0,a1);}
+void m_glTexFilterFuncSGIS_record(GLenum a0,GLenum a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC,&FunctionTable::m_ptr_glTexFilterFuncSGIS>(a0,a1,a2,a3);}
+void m_glSpriteParameterfvSGIX_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC,&FunctionTable::m_ptr_glSpriteParameterfvSGIX>(a0,a1);}
+void m_glCopyMultiTexImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLint a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyMultiTexImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetVertexAttribIuivEXT_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribIuivEXT");return (void)0;}
+void m_glUniformMatrix2x4dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC,&FunctionTable::m_ptr_glUniformMatrix2x4dv>(a0,a1,a2,this->m_copy(a3,a1,2*4*sizeof(*a3)));}
+GLint m_glGetProgramResourceLocationIndex_record(GLuint,GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourceLocationIndex");return (GLint)0;}
+void m_glColor3hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3HNVPROC,&FunctionTable::m_ptr_glColor3hNV>(a0,a1,a2);}
+void m_glViewport_record(GLint a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTPROC,&FunctionTable::m_ptr_glViewport>(a0,a1,a2,a3);}
+void m_glProgramNamedParameter4fNV_record(GLuint a0,GLsizei a1,const GLubyte* a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC,&FunctionTable::m_ptr_glProgramNamedParameter4fNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetInvariantBooleanvEXT_record(GLuint,GLenum,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInvariantBooleanvEXT");return (void)0;}
+void m_glTexStorage2DMultisample_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTexStorage2DMultisample>(a0,a1,a2,a3,a4,a5);}
+void m_glPixelStorex_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELSTOREXPROC,&FunctionTable::m_ptr_glPixelStorex>(a0,a1);}
+void m_glVertexAttribL1dvEXT_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC,&FunctionTable::m_ptr_glVertexAttribL1dvEXT>(a0,a1);}
+void m_glGetActiveSubroutineUniformiv_record(GLuint,GLenum,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveSubroutineUniformiv");return (void)0;}
+void m_glVertexAttribPointerARB_record(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC,&FunctionTable::m_ptr_glVertexAttribPointerARB>(a0,a1,a2,a3,a4,a5);}
+void m_glCompressedTexSubImage2DARB_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC,&FunctionTable::m_ptr_glCompressedTexSubImage2DARB>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glTexStorageMem1DEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLuint a4,GLuint64 a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC,&FunctionTable::m_ptr_glTexStorageMem1DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertex2hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC,&FunctionTable::m_ptr_glVertex2hvNV>(a0);}
+void m_glTexBuffer_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUFFERPROC,&FunctionTable::m_ptr_glTexBuffer>(a0,a1,a2);}
+void m_glArrayElement_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLARRAYELEMENTPROC,&FunctionTable::m_ptr_glArrayElement>(a0);}
+void m_glValidateProgram_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC,&FunctionTable::m_ptr_glValidateProgram>(a0);}
+void m_glPixelStoref_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELSTOREFPROC,&FunctionTable::m_ptr_glPixelStoref>(a0,a1);}
+void m_glWindowPos3dARB_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC,&FunctionTable::m_ptr_glWindowPos3dARB>(a0,a1,a2);}
+void m_glEvalCoord1dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC,&FunctionTable::m_ptr_glEvalCoord1dv>(a0);}
+void m_glVertexAttribs2fvNV_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC,&FunctionTable::m_ptr_glVertexAttribs2fvNV>(a0,a1,a2);}
+void m_glRecti_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTIPROC,&FunctionTable::m_ptr_glRecti>(a0,a1,a2,a3);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN>(a0,a1,a2,a3,a4);}
+void m_glTexCoord1bOES_record(GLbyte a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC,&FunctionTable::m_ptr_glTexCoord1bOES>(a0);}
+void m_glProgramUniform2i64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC,&FunctionTable::m_ptr_glProgramUniform2i64vARB>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glWindowPos2dARB_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC,&FunctionTable::m_ptr_glWindowPos2dARB>(a0,a1);}
+void m_glGetProgramParameterdvNV_record(GLenum,GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramParameterdvNV");return (void)0;}
+void m_glRectf_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTFPROC,&FunctionTable::m_ptr_glRectf>(a0,a1,a2,a3);}
+void m_glRectd_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTDPROC,&FunctionTable::m_ptr_glRectd>(a0,a1,a2,a3);}
+void m_glMap1xOES_record(GLenum a0,GLfixed a1,GLfixed a2,GLint a3,GLint a4,GLfixed a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP1XOESPROC,&FunctionTable::m_ptr_glMap1xOES>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttrib3fvNV_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC,&FunctionTable::m_ptr_glVertexAttrib3fvNV>(a0,a1);}
+void m_glReferencePlaneSGIX_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC,&FunctionTable::m_ptr_glReferencePlaneSGIX>(a0);}
+void m_glMulticastBlitFramebufferNV_record(GLuint a0,GLuint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLint a8,GLint a9,GLbitfield a10,GLenum a11)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC,&FunctionTable::m_ptr_glMulticastBlitFramebufferNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glGetCombinerInputParameterfvNV_record(GLenum,GLenum,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCombinerInputParameterfvNV");return (void)0;}
+GLuint64 m_glGetTextureSamplerHandleARB_record(GLuint,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureSamplerHandleARB");return (GLuint64)0;}
+void m_glBindTexture_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTEXTUREPROC,&FunctionTable::m_ptr_glBindTexture>(a0,a1);}
+void m_glRects_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTSPROC,&FunctionTable::m_ptr_glRects>(a0,a1,a2,a3);}
+void m_glGetActiveAttribARB_record(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveAttribARB");return (void)0;}
+void m_glHistogramEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC,&FunctionTable::m_ptr_glHistogramEXT>(a0,a1,a2,a3);}
+GLuint64 m_glGetTextureSamplerHandleNV_record(GLuint,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureSamplerHandleNV");return (GLuint64)0;}
+void m_glDetachShader_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDETACHSHADERPROC,&FunctionTable::m_ptr_glDetachShader>(a0,a1);}
+void m_glFinishTextureSUNX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC,&FunctionTable::m_ptr_glFinishTextureSUNX>();}
+void m_glUniformMatrix3x4dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC,&FunctionTable::m_ptr_glUniformMatrix3x4dv>(a0,a1,a2,this->m_copy(a3,a1,3*4*sizeof(*a3)));}
+void m_glVertexAttrib4fARB_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC,&FunctionTable::m_ptr_glVertexAttrib4fARB>(a0,a1,a2,a3,a4);}
+void m_glGetPathColorGenivNV_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathColorGenivNV");return (void)0;}
+GLint m_glGetProgramResourceLocation_record(GLuint,GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourceLocation");return (GLint)0;}
+void m_glVertexArrayAttribLFormat_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC,&FunctionTable::m_ptr_glVertexArrayAttribLFormat>(a0,a1,a2,a3,a4);}
+void m_glGetTexLevelParameterfv_record(GLenum,GLint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexLevelParameterfv");return (void)0;}
+void m_glVertexArrayVertexAttribOffsetEXT_record(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLboolean a5,GLsizei a6,GLintptr a7)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribOffsetEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glIndexFormatNV_record(GLenum a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC,&FunctionTable::m_ptr_glIndexFormatNV>(a0,a1);}
+void m_glMultiTexCoord3i_record(GLenum a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC,&FunctionTable::m_ptr_glMultiTexCoord3i>(a0,a1,a2,a3);}
+void m_glReplacementCodeuiVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiVertex3fvSUN>(a0,a1);}
+void m_glViewportIndexedfv_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC,&FunctionTable::m_ptr_glViewportIndexedfv>(a0,a1);}
+void m_glBindBuffersBase_record(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC,&FunctionTable::m_ptr_glBindBuffersBase>(a0,a1,a2,a3);}
+void m_glTexBumpParameterfvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC,&FunctionTable::m_ptr_glTexBumpParameterfvATI>(a0,a1);}
+void m_glMatrixIndexuivARB_record(GLint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC,&FunctionTable::m_ptr_glMatrixIndexuivARB>(a0,a1);}
+void m_glVertexAttrib1hNV_record(GLuint a0,GLhalfNV a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC,&FunctionTable::m_ptr_glVertexAttrib1hNV>(a0,a1);}
+void m_glWindowPos3svMESA_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC,&FunctionTable::m_ptr_glWindowPos3svMESA>(a0);}
+void m_glStencilOpSeparateATI_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC,&FunctionTable::m_ptr_glStencilOpSeparateATI>(a0,a1,a2,a3);}
+void m_glDrawElementsBaseVertex_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC,&FunctionTable::m_ptr_glDrawElementsBaseVertex>(a0,a1,a2,a3,a4);}
+void m_glBlendEquationSeparateiARB_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC,&FunctionTable::m_ptr_glBlendEquationSeparateiARB>(a0,a1,a2);}
+void m_glVertexAttrib1fNV_record(GLuint a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC,&FunctionTable::m_ptr_glVertexAttrib1fNV>(a0,a1);}
+void m_glMapVertexAttrib2fAPPLE_record(GLuint a0,GLuint a1,GLfloat a2,GLfloat a3,GLint a4,GLint a5,GLfloat a6,GLfloat a7,GLint a8,GLint a9,const GLfloat* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC,&FunctionTable::m_ptr_glMapVertexAttrib2fAPPLE>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glCompressedTextureSubImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLsizei a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glClearBufferSubData_record(GLenum a0,GLenum a1,GLintptr a2,GLsizeiptr a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glClearBufferSubData>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glTexStorage1D_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC,&FunctionTable::m_ptr_glTexStorage1D>(a0,a1,a2,a3);}
+void m_glVertexAttribI3iEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC,&FunctionTable::m_ptr_glVertexAttribI3iEXT>(a0,a1,a2,a3);}
+void m_glMakeTextureHandleNonResidentARB_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,&FunctionTable::m_ptr_glMakeTextureHandleNonResidentARB>(a0);}
+void m_glMultiDrawElementArrayAPPLE_record(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC,&FunctionTable::m_ptr_glMultiDrawElementArrayAPPLE>(a0,a1,a2,a3);}
+void m_glVertexStream4dATI_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC,&FunctionTable::m_ptr_glVertexStream4dATI>(a0,a1,a2,a3,a4);}
+void m_glProgramUniformMatrix2dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*2*sizeof(*a4)));}
+void m_glVertexAttribs2hvNV_record(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC,&FunctionTable::m_ptr_glVertexAttribs2hvNV>(a0,a1,a2);}
+void m_glGetUniformiv_record(GLuint,GLint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformiv");return (void)0;}
+void m_glClipPlanefOES_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC,&FunctionTable::m_ptr_glClipPlanefOES>(a0,a1);}
+void m_glRenderbufferStorage_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC,&FunctionTable::m_ptr_glRenderbufferStorage>(a0,a1,a2,a3);}
+void m_glUniform4ui_record(GLint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UIPROC,&FunctionTable::m_ptr_glUniform4ui>(a0,a1,a2,a3,a4);}
+void m_glBindFramebuffer_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC,&FunctionTable::m_ptr_glBindFramebuffer>(a0,a1);}
+void m_glValidateProgramARB_record(GLhandleARB a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC,&FunctionTable::m_ptr_glValidateProgramARB>(a0);}
+void m_glTexGenf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENFPROC,&FunctionTable::m_ptr_glTexGenf>(a0,a1,a2);}
+void m_glTexGend_record(GLenum a0,GLenum a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENDPROC,&FunctionTable::m_ptr_glTexGend>(a0,a1,a2);}
+void m_glTexGeni_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENIPROC,&FunctionTable::m_ptr_glTexGeni>(a0,a1,a2);}
+void m_glDeleteFramebuffersEXT_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC,&FunctionTable::m_ptr_glDeleteFramebuffersEXT>(a0,a1);}
+void m_glResetMinmaxEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC,&FunctionTable::m_ptr_glResetMinmaxEXT>(a0);}
+void m_glVertexAttrib1fvNV_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC,&FunctionTable::m_ptr_glVertexAttrib1fvNV>(a0,a1);}
+GLboolean m_glIsQueryARB_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsQueryARB");return (GLboolean)0;}
+void m_glEnableVariantClientStateEXT_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC,&FunctionTable::m_ptr_glEnableVariantClientStateEXT>(a0);}
+void m_glScissorIndexed_record(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC,&FunctionTable::m_ptr_glScissorIndexed>(a0,a1,a2,a3,a4);}
+void m_glGetInvariantIntegervEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInvariantIntegervEXT");return (void)0;}
+void m_glProgramLocalParameterI4uiNV_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC,&FunctionTable::m_ptr_glProgramLocalParameterI4uiNV>(a0,a1,a2,a3,a4,a5);}
+void m_glConvolutionParameterxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC,&FunctionTable::m_ptr_glConvolutionParameterxvOES>(a0,a1,a2);}
+void m_glGenFramebuffersEXT_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenFramebuffersEXT");return (void)0;}
+void m_glVertexArrayColorOffsetEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayColorOffsetEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glMultiTexCoord3ivARB_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3ivARB>(a0,a1);}
+void m_glVertexWeightfEXT_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC,&FunctionTable::m_ptr_glVertexWeightfEXT>(a0);}
+void m_glRasterPos4dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC,&FunctionTable::m_ptr_glRasterPos4dv>(a0);}
+GLboolean m_glIsTextureHandleResidentARB_record(GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTextureHandleResidentARB");return (GLboolean)0;}
+void m_glRasterPos2dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC,&FunctionTable::m_ptr_glRasterPos2dv>(a0);}
+void m_glWindowPos4ivMESA_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC,&FunctionTable::m_ptr_glWindowPos4ivMESA>(a0);}
+void m_glGetVariantPointervEXT_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantPointervEXT");return (void)0;}
+void* m_glMapNamedBufferRangeEXT_record(GLuint,GLintptr,GLsizeiptr,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glMapNamedBufferRangeEXT");return (void*)0;}
+void m_glGetnUniformui64vARB_record(GLuint,GLint,GLsizei,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformui64vARB");return (void)0;}
+GLuint m_glCreateShaderProgramv_record(GLenum,GLsizei,const GLchar*const*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateShaderProgramv");return (GLuint)0;}
+void m_glGetQueryObjectiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectiv");return (void)0;}
+void m_glMaxShaderCompilerThreadsKHR_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC,&FunctionTable::m_ptr_glMaxShaderCompilerThreadsKHR>(a0);}
+void m_glPNTrianglesfATI_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC,&FunctionTable::m_ptr_glPNTrianglesfATI>(a0,a1);}
+void m_glGlobalAlphaFactorusSUN_record(GLushort a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactorusSUN>(a0);}
+void m_glVertexAttrib3dvNV_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC,&FunctionTable::m_ptr_glVertexAttrib3dvNV>(a0,a1);}
+void m_glMultiTexCoord3sARB_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3sARB>(a0,a1,a2,a3);}
+void m_glGenerateMipmap_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGenerateMipmap");return (void)0;}
+void m_glCompressedTextureSubImage2D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glNamedRenderbufferStorageMultisampleEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glNamedRenderbufferStorageMultisampleEXT>(a0,a1,a2,a3,a4);}
+void m_glPolygonOffsetClampEXT_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC,&FunctionTable::m_ptr_glPolygonOffsetClampEXT>(a0,a1,a2);}
+void m_glTextureRangeAPPLE_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC,&FunctionTable::m_ptr_glTextureRangeAPPLE>(a0,a1,a2);}
+void m_glBlendEquationIndexedAMD_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC,&FunctionTable::m_ptr_glBlendEquationIndexedAMD>(a0,a1);}
+void m_glTexCoord2d_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2DPROC,&FunctionTable::m_ptr_glTexCoord2d>(a0,a1);}
+void m_glPointParameteri_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC,&FunctionTable::m_ptr_glPointParameteri>(a0,a1);}
+void m_glTexCoord2f_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FPROC,&FunctionTable::m_ptr_glTexCoord2f>(a0,a1);}
+void m_glGetUnsignedBytei_vEXT_record(GLenum,GLuint,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUnsignedBytei_vEXT");return (void)0;}
+void m_glColor4iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4IVPROC,&FunctionTable::m_ptr_glColor4iv>(a0);}
+void* m_glMapNamedBufferRange_record(GLuint,GLintptr,GLsizeiptr,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glMapNamedBufferRange");return (void*)0;}
+GLboolean m_glUnmapBuffer_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glUnmapBuffer");return (GLboolean)0;}
+void m_glSampleMaskEXT_record(GLclampf a0,GLboolean a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC,&FunctionTable::m_ptr_glSampleMaskEXT>(a0,a1);}
+void m_glTexCoord2i_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2IPROC,&FunctionTable::m_ptr_glTexCoord2i>(a0,a1);}
+void m_glTexCoord1xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC,&FunctionTable::m_ptr_glTexCoord1xvOES>(a0);}
+void m_glVertexAttrib1sARB_record(GLuint a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC,&FunctionTable::m_ptr_glVertexAttrib1sARB>(a0,a1);}
+void m_glGetVertexArrayiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayiv");return (void)0;}
+void m_glProgramParameter4dvNV_record(GLenum a0,GLuint a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC,&FunctionTable::m_ptr_glProgramParameter4dvNV>(a0,a1,a2);}
+void m_glTexCoord2s_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2SPROC,&FunctionTable::m_ptr_glTexCoord2s>(a0,a1);}
+void m_glTextureParameterIuivEXT_record(GLuint a0,GLenum a1,GLenum a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC,&FunctionTable::m_ptr_glTextureParameterIuivEXT>(a0,a1,a2,a3);}
+void m_glGetColorTableParameterfvSGI_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameterfvSGI");return (void)0;}
+void m_glTexCoord4dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC,&FunctionTable::m_ptr_glTexCoord4dv>(a0);}
+void m_glVertexAttrib1svNV_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC,&FunctionTable::m_ptr_glVertexAttrib1svNV>(a0,a1);}
+void m_glNamedFramebufferTextureFaceEXT_record(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTextureFaceEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform2ui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC,&FunctionTable::m_ptr_glProgramUniform2ui64vNV>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glStencilFillPathNV_record(GLuint a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC,&FunctionTable::m_ptr_glStencilFillPathNV>(a0,a1,a2);}
+void m_glNormal3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3DVPROC,&FunctionTable::m_ptr_glNormal3dv>(a0);}
+void m_glReleaseShaderCompiler_record()const{this->template m_record<FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC,&FunctionTable::m_ptr_glReleaseShaderCompiler>();}
+void m_glTexStorageMem3DEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLuint a6,GLuint64 a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC,&FunctionTable::m_ptr_glTexStorageMem3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glTexCoord3bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC,&FunctionTable::m_ptr_glTexCoord3bvOES>(a0);}
+GLboolean m_glIsVertexAttribEnabledAPPLE_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glIsVertexAttribEnabledAPPLE");return (GLboolean)0;}
+void m_glTexCoord1dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC,&FunctionTable::m_ptr_glTexCoord1dv>(a0);}
+void m_glReadPixels_record(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glReadPixels");return (void)0;}
+void m_glVertexAttribI3iv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC,&FunctionTable::m_ptr_glVertexAttribI3iv>(a0,a1);}
+void m_glSetFenceAPPLE_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC,&FunctionTable::m_ptr_glSetFenceAPPLE>(a0);}
+void m_glWeightsvARB_record(GLint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC,&FunctionTable::m_ptr_glWeightsvARB>(a0,a1);}
+void m_glShadeModel_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADEMODELPROC,&FunctionTable::m_ptr_glShadeModel>(a0);}
+void m_glTextureStorageMem3DMultisampleEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6,GLuint a7,GLuint64 a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTextureStorageMem3DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glMapGrid1d_record(GLint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID1DPROC,&FunctionTable::m_ptr_glMapGrid1d>(a0,a1,a2);}
+void m_glGetHistogramParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramParameterivEXT");return (void)0;}
+void m_glConservativeRasterParameteriNV_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC,&FunctionTable::m_ptr_glConservativeRasterParameteriNV>(a0,a1);}
+void m_glClearNamedBufferData_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC,&FunctionTable::m_ptr_glClearNamedBufferData>(a0,a1,a2,a3,a4);}
+void m_glClearDepthf_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC,&FunctionTable::m_ptr_glClearDepthf>(a0);}
+void m_glCreatePerfQueryINTEL_record(GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreatePerfQueryINTEL");return (void)0;}
+void m_glFogCoordfEXT_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC,&FunctionTable::m_ptr_glFogCoordfEXT>(a0);}
+void m_glVertexAttrib2dARB_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC,&FunctionTable::m_ptr_glVertexAttrib2dARB>(a0,a1,a2);}
+void m_glMultiTexCoord4dARB_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4dARB>(a0,a1,a2,a3,a4);}
+void m_glReadnPixelsARB_record(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glReadnPixelsARB");return (void)0;}
+void m_glMultiTexBufferEXT_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC,&FunctionTable::m_ptr_glMultiTexBufferEXT>(a0,a1,a2,a3);}
+void m_glWindowPos4dvMESA_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC,&FunctionTable::m_ptr_glWindowPos4dvMESA>(a0);}
+void m_glInvalidateNamedFramebufferData_record(GLuint a0,GLsizei a1,const GLenum* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC,&FunctionTable::m_ptr_glInvalidateNamedFramebufferData>(a0,a1,a2);}
+void m_glSecondaryColorPointerListIBM_record(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glSecondaryColorPointerListIBM>(a0,a1,a2,a3,a4);}
+void m_glRectiv_record(const GLint* a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTIVPROC,&FunctionTable::m_ptr_glRectiv>(a0,a1);}
+void m_glColorP4ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORP4UIPROC,&FunctionTable::m_ptr_glColorP4ui>(a0,a1);}
+void m_glUseProgramStages_record(GLuint a0,GLbitfield a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC,&FunctionTable::m_ptr_glUseProgramStages>(a0,a1,a2);}
+void m_glRasterPos3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC,&FunctionTable::m_ptr_glRasterPos3dv>(a0);}
+void m_glPathTexGenNV_record(GLenum a0,GLenum a1,GLint a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC,&FunctionTable::m_ptr_glPathTexGenNV>(a0,a1,a2,a3);}
+void m_glVertexBlendEnviATI_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC,&FunctionTable::m_ptr_glVertexBlendEnviATI>(a0,a1);}
+void m_glUniform3i64ARB_record(GLint a0,GLint64 a1,GLint64 a2,GLint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC,&FunctionTable::m_ptr_glUniform3i64ARB>(a0,a1,a2,a3);}
+void m_glLoadMatrixf_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADMATRIXFPROC,&FunctionTable::m_ptr_glLoadMatrixf>(a0);}
+void m_glProgramUniform2dEXT_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC,&FunctionTable::m_ptr_glProgramUniform2dEXT>(a0,a1,a2,a3);}
+void m_glVertexAttribI4iv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC,&FunctionTable::m_ptr_glVertexAttribI4iv>(a0,a1);}
+void m_glNamedFramebufferDrawBuffer_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC,&FunctionTable::m_ptr_glNamedFramebufferDrawBuffer>(a0,a1);}
+void m_glColor4ubv_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBVPROC,&FunctionTable::m_ptr_glColor4ubv>(a0);}
+void m_glColor3hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC,&FunctionTable::m_ptr_glColor3hvNV>(a0);}
+void m_glGetMapAttribParameterfvNV_record(GLenum,GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapAttribParameterfvNV");return (void)0;}
+void m_glGetBufferSubData_record(GLenum,GLintptr,GLsizeiptr,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferSubData");return (void)0;}
+void m_glGetVertexAttribLdv_record(GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribLdv");return (void)0;}
+void m_glGetnUniformuiv_record(GLuint,GLint,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformuiv");return (void)0;}
+void m_glGetUniformui64vNV_record(GLuint,GLint,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformui64vNV");return (void)0;}
+void m_glNamedRenderbufferStorageEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC,&FunctionTable::m_ptr_glNamedRenderbufferStorageEXT>(a0,a1,a2,a3);}
+void m_glVertexAttrib3dNV_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC,&FunctionTable::m_ptr_glVertexAttrib3dNV>(a0,a1,a2,a3);}
+void m_glTextureStorage1DEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC,&FunctionTable::m_ptr_glTextureStorage1DEXT>(a0,a1,a2,a3,a4);}
+void m_glPixelTexGenParameteriSGIS_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC,&FunctionTable::m_ptr_glPixelTexGenParameteriSGIS>(a0,a1);}
+void m_glColorTableEXT_record(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC,&FunctionTable::m_ptr_glColorTableEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glGenBuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenBuffers");return (void)0;}
+void m_glMultiTexCoord3xvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord3xvOES>(a0,a1);}
+void m_glExecuteProgramNV_record(GLenum a0,GLuint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC,&FunctionTable::m_ptr_glExecuteProgramNV>(a0,a1,a2);}
+void m_glVariantArrayObjectATI_record(GLuint a0,GLenum a1,GLsizei a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC,&FunctionTable::m_ptr_glVariantArrayObjectATI>(a0,a1,a2,a3,a4);}
+void m_glColor3xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC,&FunctionTable::m_ptr_glColor3xvOES>(a0);}
+void m_glGetnConvolutionFilterARB_record(GLenum,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnConvolutionFilterARB");return (void)0;}
+void m_glNormalFormatNV_record(GLenum a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC,&FunctionTable::m_ptr_glNormalFormatNV>(a0,a1);}
+void m_glGetInvariantFloatvEXT_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInvariantFloatvEXT");return (void)0;}
+void m_glClearNamedFramebufferiv_record(GLuint a0,GLenum a1,GLint a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC,&FunctionTable::m_ptr_glClearNamedFramebufferiv>(a0,a1,a2,a3);}
+void m_glTexImage3D_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const GLvoid* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC,&FunctionTable::m_ptr_glTexImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glGenSamplers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenSamplers");return (void)0;}
+GLboolean m_glIsFramebuffer_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsFramebuffer");return (GLboolean)0;}
+void m_glProgramUniform3dvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC,&FunctionTable::m_ptr_glProgramUniform3dvEXT>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glGetVertexAttribfvNV_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribfvNV");return (void)0;}
+void m_glDrawRangeElementArrayAPPLE_record(GLenum a0,GLuint a1,GLuint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC,&FunctionTable::m_ptr_glDrawRangeElementArrayAPPLE>(a0,a1,a2,a3,a4);}
+void m_glUniform3i64NV_record(GLint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC,&FunctionTable::m_ptr_glUniform3i64NV>(a0,a1,a2,a3);}
+void m_glMatrixPopEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC,&FunctionTable::m_ptr_glMatrixPopEXT>(a0);}
+void m_glVertexStream1sATI_record(GLenum a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC,&FunctionTable::m_ptr_glVertexStream1sATI>(a0,a1);}
+void m_glGetnPixelMapuivARB_record(GLenum,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapuivARB");return (void)0;}
+void m_glMultiTexEnviEXT_record(GLenum a0,GLenum a1,GLenum a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC,&FunctionTable::m_ptr_glMultiTexEnviEXT>(a0,a1,a2,a3);}
+void m_glVertexAttribI2iEXT_record(GLuint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC,&FunctionTable::m_ptr_glVertexAttribI2iEXT>(a0,a1,a2);}
+void m_glProgramParameter4fvNV_record(GLenum a0,GLuint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC,&FunctionTable::m_ptr_glProgramParameter4fvNV>(a0,a1,a2);}
+void m_glWaitSemaphoreEXT_record(GLuint a0,GLuint a1,const GLuint* a2,GLuint a3,const GLuint* a4,const GLenum* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC,&FunctionTable::m_ptr_glWaitSemaphoreEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glNamedFramebufferSampleLocationsfvNV_record(GLuint a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC,&FunctionTable::m_ptr_glNamedFramebufferSampleLocationsfvNV>(a0,a1,a2,a3);}
+void m_glTexCoordP4uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC,&FunctionTable::m_ptr_glTexCoordP4uiv>(a0,a1);}
+void m_glRectxvOES_record(const GLfixed* a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTXVOESPROC,&FunctionTable::m_ptr_glRectxvOES>(a0,a1);}
+void m_glGetVariantIntegervEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantIntegervEXT");return (void)0;}
+void m_glDeleteLists_record(GLuint a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETELISTSPROC,&FunctionTable::m_ptr_glDeleteLists>(a0,a1);}
+void m_glTexGendv_record(GLenum a0,GLenum a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENDVPROC,&FunctionTable::m_ptr_glTexGendv>(a0,a1,a2);}
+void m_glVertexP2uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC,&FunctionTable::m_ptr_glVertexP2uiv>(a0,a1);}
+void m_glGetPerfMonitorGroupsAMD_record(GLint*,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorGroupsAMD");return (void)0;}
+void m_glMultTransposeMatrixfARB_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC,&FunctionTable::m_ptr_glMultTransposeMatrixfARB>(a0);}
+void m_glVertexAttribI2ivEXT_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI2ivEXT>(a0,a1);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN>(a0,a1,a2,a3);}
+void m_glDeleteStatesNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETESTATESNVPROC,&FunctionTable::m_ptr_glDeleteStatesNV>(a0,a1);}
+void m_glGetBufferParameteri64v_record(GLenum,GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferParameteri64v");return (void)0;}
+void m_glProgramUniform4dv_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC,&FunctionTable::m_ptr_glProgramUniform4dv>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glEdgeFlagPointerEXT_record(GLsizei a0,GLsizei a1,const GLboolean* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC,&FunctionTable::m_ptr_glEdgeFlagPointerEXT>(a0,a1,a2);}
+void m_glVideoCaptureStreamParameterivNV_record(GLuint a0,GLuint a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC,&FunctionTable::m_ptr_glVideoCaptureStreamParameterivNV>(a0,a1,a2,a3);}
+void m_glVertexStream4iATI_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC,&FunctionTable::m_ptr_glVertexStream4iATI>(a0,a1,a2,a3,a4);}
+void m_glVDPAUFiniNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUFININVPROC,&FunctionTable::m_ptr_glVDPAUFiniNV>();}
+void m_glMakeBufferNonResidentNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeBufferNonResidentNV>(a0);}
+void m_glUniform1ui64ARB_record(GLint a0,GLuint64 a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC,&FunctionTable::m_ptr_glUniform1ui64ARB>(a0,a1);}
+void m_glStencilStrokePathNV_record(GLuint a0,GLint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC,&FunctionTable::m_ptr_glStencilStrokePathNV>(a0,a1,a2);}
+void m_glVariantuivEXT_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC,&FunctionTable::m_ptr_glVariantuivEXT>(a0,a1);}
+void m_glCopyTexSubImage3DEXT_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCopyTexSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glSpriteParameteriSGIX_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC,&FunctionTable::m_ptr_glSpriteParameteriSGIX>(a0,a1);}
+void m_glMultiTexCoord1sARB_record(GLenum a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1sARB>(a0,a1);}
+void m_glConvolutionParameterfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC,&FunctionTable::m_ptr_glConvolutionParameterfv>(a0,a1,a2);}
+void m_glMakeTextureHandleResidentNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC,&FunctionTable::m_ptr_glMakeTextureHandleResidentNV>(a0);}
+void m_glMultMatrixxOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC,&FunctionTable::m_ptr_glMultMatrixxOES>(a0);}
+void m_glTextureNormalEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC,&FunctionTable::m_ptr_glTextureNormalEXT>(a0);}
+void m_glGetQueryivARB_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryivARB");return (void)0;}
+void m_glCompressedMultiTexImage3DEXT_record(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLsizei a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+GLint m_glGetInstrumentsSGIX_record()const{this->m_printUnrecordableFunctionErrorAndExit("glGetInstrumentsSGIX");return (GLint)0;}
+void m_glProgramUniformMatrix4x3fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x3fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*3*sizeof(*a4)));}
+void m_glPointParameterf_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC,&FunctionTable::m_ptr_glPointParameterf>(a0,a1);}
+void m_glProgramUniform3dEXT_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC,&FunctionTable::m_ptr_glProgramUniform3dEXT>(a0,a1,a2,a3,a4);}
+void m_glMultiTexCoord2hNV_record(GLenum a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC,&FunctionTable::m_ptr_glMultiTexCoord2hNV>(a0,a1,a2);}
+void m_glGetConvolutionFilterEXT_record(GLenum,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionFilterEXT");return (void)0;}
+void m_glVertexAttrib2hNV_record(GLuint a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC,&FunctionTable::m_ptr_glVertexAttrib2hNV>(a0,a1,a2);}
+void m_glCurrentPaletteMatrixARB_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC,&FunctionTable::m_ptr_glCurrentPaletteMatrixARB>(a0);}
+void m_glFogxvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGXVOESPROC,&FunctionTable::m_ptr_glFogxvOES>(a0,a1);}
+void m_glCreateRenderbuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateRenderbuffers");return (void)0;}
+void m_glVertexAttrib4Nusv_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC,&FunctionTable::m_ptr_glVertexAttrib4Nusv>(a0,a1);}
+void m_glCombinerInputNV_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC,&FunctionTable::m_ptr_glCombinerInputNV>(a0,a1,a2,a3,a4,a5);}
+void m_glDepthFunc_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHFUNCPROC,&FunctionTable::m_ptr_glDepthFunc>(a0);}
+void m_glWindowPos4fMESA_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC,&FunctionTable::m_ptr_glWindowPos4fMESA>(a0,a1,a2,a3);}
+void m_glEnableClientStateIndexedEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC,&FunctionTable::m_ptr_glEnableClientStateIndexedEXT>(a0,a1);}
+void m_glTexCoord4iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC,&FunctionTable::m_ptr_glTexCoord4iv>(a0);}
+void m_glProgramUniform4i64ARB_record(GLuint a0,GLint a1,GLint64 a2,GLint64 a3,GLint64 a4,GLint64 a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC,&FunctionTable::m_ptr_glProgramUniform4i64ARB>(a0,a1,a2,a3,a4,a5);}
+void m_glBlendFunci_record(GLuint a0,GLenum a1,GLenum a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCIPROC,&FunctionTable::m_ptr_glBlendFunci>(a0,a1,a2);}
+void m_glResolveDepthValuesNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC,&FunctionTable::m_ptr_glResolveDepthValuesNV>();}
+void m_glTextureColorMaskSGIS_record(GLboolean a0,GLboolean a1,GLboolean a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC,&FunctionTable::m_ptr_glTextureColorMaskSGIS>(a0,a1,a2,a3);}
+GLuint m_glCreateShaderProgramEXT_record(GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateShaderProgramEXT");return (GLuint)0;}
+void m_glBufferStorage_record(GLenum a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC,&FunctionTable::m_ptr_glBufferStorage>(a0,a1,a2,a3);}
+void m_glMakeNamedBufferNonResidentNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeNamedBufferNonResidentNV>(a0);}
+void m_glRenderbufferStorageMultisampleEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glRenderbufferStorageMultisampleEXT>(a0,a1,a2,a3,a4);}
+void m_glGetFloati_v_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFloati_v");return (void)0;}
+void m_glUniform2ui64ARB_record(GLint a0,GLuint64 a1,GLuint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC,&FunctionTable::m_ptr_glUniform2ui64ARB>(a0,a1,a2);}
+void m_glVertex3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3FVPROC,&FunctionTable::m_ptr_glVertex3fv>(a0);}
+GLint m_glGetUniformLocation_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformLocation");return (GLint)0;}
+void m_glVertexStream1svATI_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC,&FunctionTable::m_ptr_glVertexStream1svATI>(a0,a1);}
+void m_glVertexStream3fATI_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC,&FunctionTable::m_ptr_glVertexStream3fATI>(a0,a1,a2,a3);}
+void m_glNamedFramebufferDrawBuffers_record(GLuint a0,GLsizei a1,const GLenum* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC,&FunctionTable::m_ptr_glNamedFramebufferDrawBuffers>(a0,a1,a2);}
+void m_glUniform2ui64vNV_record(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC,&FunctionTable::m_ptr_glUniform2ui64vNV>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glTexCoordPointervINTEL_record(GLint a0,GLenum a1,const void** a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC,&FunctionTable::m_ptr_glTexCoordPointervINTEL>(a0,a1,a2);}
+void m_glUniform4fv_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4FVPROC,&FunctionTable::m_ptr_glUniform4fv>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glNormalPointerEXT_record(GLenum a0,GLsizei a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC,&FunctionTable::m_ptr_glNormalPointerEXT>(a0,a1,a2,a3);}
+void m_glVertexAttrib4hNV_record(GLuint a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3,GLhalfNV a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC,&FunctionTable::m_ptr_glVertexAttrib4hNV>(a0,a1,a2,a3,a4);}
+void m_glNormal3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3FPROC,&FunctionTable::m_ptr_glNormal3f>(a0,a1,a2);}
+void m_glVertexStream2iATI_record(GLenum a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC,&FunctionTable::m_ptr_glVertexStream2iATI>(a0,a1,a2);}
+void m_glVertexAttribP4uiv_record(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC,&FunctionTable::m_ptr_glVertexAttribP4uiv>(a0,a1,a2,a3);}
+void m_glCompressedTextureSubImage3D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glAsyncMarkerSGIX_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC,&FunctionTable::m_ptr_glAsyncMarkerSGIX>(a0);}
+void m_glTextureStorageSparseAMD_record(GLuint a0,GLenum a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLsizei a6,GLbitfield a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC,&FunctionTable::m_ptr_glTextureStorageSparseAMD>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetConvolutionParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionParameterivEXT");return (void)0;}
+void m_glEndPerfQueryINTEL_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC,&FunctionTable::m_ptr_glEndPerfQueryINTEL>(a0);}
+void m_glFragmentLightModeliSGIX_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC,&FunctionTable::m_ptr_glFragmentLightModeliSGIX>(a0,a1);}
+void m_glPrioritizeTexturesEXT_record(GLsizei a0,const GLuint* a1,const GLclampf* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC,&FunctionTable::m_ptr_glPrioritizeTexturesEXT>(a0,a1,a2);}
+void m_glEndConditionalRender_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC,&FunctionTable::m_ptr_glEndConditionalRender>();}
+void m_glEnableClientState_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC,&FunctionTable::m_ptr_glEnableClientState>(a0);}
+void m_glResetHistogram_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC,&FunctionTable::m_ptr_glResetHistogram>(a0);}
+void m_glGetOcclusionQueryivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetOcclusionQueryivNV");return (void)0;}
+void m_glUniform1uiEXT_record(GLint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC,&FunctionTable::m_ptr_glUniform1uiEXT>(a0,a1);}
+void m_glMultiTexCoord2sv_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC,&FunctionTable::m_ptr_glMultiTexCoord2sv>(a0,a1);}
+void m_glTexSubImage2DEXT_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glTexSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glProgramUniform2uiv_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC,&FunctionTable::m_ptr_glProgramUniform2uiv>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glMultiTexCoord2iARB_record(GLenum a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2iARB>(a0,a1,a2);}
+void m_glGetQueryObjectuiv_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectuiv");return (void)0;}
+void m_glGenerateMultiTexMipmapEXT_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGenerateMultiTexMipmapEXT");return (void)0;}
+void m_glVertexAttrib4iv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC,&FunctionTable::m_ptr_glVertexAttrib4iv>(a0,a1);}
+void m_glWindowPos3dvMESA_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC,&FunctionTable::m_ptr_glWindowPos3dvMESA>(a0);}
+void m_glLabelObjectEXT_record(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC,&FunctionTable::m_ptr_glLabelObjectEXT>(a0,a1,a2,a3);}
+void m_glProgramUniform1uiv_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC,&FunctionTable::m_ptr_glProgramUniform1uiv>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glFramebufferTexture_record(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC,&FunctionTable::m_ptr_glFramebufferTexture>(a0,a1,a2,a3);}
+void m_glMultiTexEnvfEXT_record(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC,&FunctionTable::m_ptr_glMultiTexEnvfEXT>(a0,a1,a2,a3);}
+void m_glGetTexGendv_record(GLenum,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexGendv");return (void)0;}
+void m_glVertex4xOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4XOESPROC,&FunctionTable::m_ptr_glVertex4xOES>(a0,a1,a2);}
+void m_glVertexAttribI2uivEXT_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI2uivEXT>(a0,a1);}
+void m_glNamedProgramLocalParameter4fvEXT_record(GLuint a0,GLenum a1,GLuint a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameter4fvEXT>(a0,a1,a2,a3);}
+void m_glColor3usv_record(const GLushort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3USVPROC,&FunctionTable::m_ptr_glColor3usv>(a0);}
+void m_glGetPixelTransformParameterfvEXT_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelTransformParameterfvEXT");return (void)0;}
+void m_glIndexxvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXXVOESPROC,&FunctionTable::m_ptr_glIndexxvOES>(a0);}
+void m_glDepthMask_record(GLboolean a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHMASKPROC,&FunctionTable::m_ptr_glDepthMask>(a0);}
+void m_glProgramUniformMatrix2x4fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x4fv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*4*sizeof(*a4)));}
+GLboolean m_glAreProgramsResidentNV_record(GLsizei,const GLuint*,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glAreProgramsResidentNV");return (GLboolean)0;}
+void m_glColorTable_record(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const GLvoid* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEPROC,&FunctionTable::m_ptr_glColorTable>(a0,a1,a2,a3,a4,a5);}
+void m_glBeginQueryIndexed_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC,&FunctionTable::m_ptr_glBeginQueryIndexed>(a0,a1,a2);}
+void m_glVertexStream1dvATI_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC,&FunctionTable::m_ptr_glVertexStream1dvATI>(a0,a1);}
+void m_glGetMultiTexEnvfvEXT_record(GLenum,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexEnvfvEXT");return (void)0;}
+void m_glDeleteFencesNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC,&FunctionTable::m_ptr_glDeleteFencesNV>(a0,a1);}
+void m_glVertexAttribs1dvNV_record(GLuint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC,&FunctionTable::m_ptr_glVertexAttribs1dvNV>(a0,a1,a2);}
+void m_glBufferStorageExternalEXT_record(GLenum a0,GLintptr a1,GLsizeiptr a2,GLeglClientBufferEXT a3,GLbitfield a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC,&FunctionTable::m_ptr_glBufferStorageExternalEXT>(a0,a1,a2,a3,a4);}
+void m_glVertexStream2sATI_record(GLenum a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC,&FunctionTable::m_ptr_glVertexStream2sATI>(a0,a1,a2);}
+void m_glGetnSeparableFilterARB_record(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnSeparableFilterARB");return (void)0;}
+void m_glProgramUniform2dv_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC,&FunctionTable::m_ptr_glProgramUniform2dv>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glActiveStencilFaceEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC,&FunctionTable::m_ptr_glActiveStencilFaceEXT>(a0);}
+void m_glProgramUniform4dEXT_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC,&FunctionTable::m_ptr_glProgramUniform4dEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glPointSizexOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC,&FunctionTable::m_ptr_glPointSizexOES>(a0);}
+void m_glRasterPos2sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC,&FunctionTable::m_ptr_glRasterPos2sv>(a0);}
+GLuint m_glBindParameterEXT_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glBindParameterEXT");return (GLuint)0;}
+void m_glTexCoord1sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC,&FunctionTable::m_ptr_glTexCoord1sv>(a0);}
+void m_glBlendParameteriNV_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC,&FunctionTable::m_ptr_glBlendParameteriNV>(a0,a1);}
+void m_glNamedProgramLocalParameter4dvEXT_record(GLuint a0,GLenum a1,GLuint a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameter4dvEXT>(a0,a1,a2,a3);}
+void m_glProgramUniformHandleui64NV_record(GLuint a0,GLint a1,GLuint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC,&FunctionTable::m_ptr_glProgramUniformHandleui64NV>(a0,a1,a2);}
+void m_glGetTextureParameterfvEXT_record(GLuint,GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterfvEXT");return (void)0;}
+void m_glGetPathMetricsNV_record(GLbitfield,GLsizei,GLenum,const void*,GLuint,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathMetricsNV");return (void)0;}
+void m_glVertex2i_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2IPROC,&FunctionTable::m_ptr_glVertex2i>(a0,a1);}
+void m_glNewList_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNEWLISTPROC,&FunctionTable::m_ptr_glNewList>(a0,a1);}
+void m_glMatrixLoad3x3fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC,&FunctionTable::m_ptr_glMatrixLoad3x3fNV>(a0,a1);}
+void m_glMultiTexCoord2fARB_record(GLenum a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2fARB>(a0,a1,a2);}
+void m_glWeightdvARB_record(GLint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC,&FunctionTable::m_ptr_glWeightdvARB>(a0,a1);}
+GLboolean m_glIsTransformFeedbackNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTransformFeedbackNV");return (GLboolean)0;}
+void m_glVertexAttribDivisorARB_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC,&FunctionTable::m_ptr_glVertexAttribDivisorARB>(a0,a1);}
+void m_glSecondaryColorP3uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC,&FunctionTable::m_ptr_glSecondaryColorP3uiv>(a0,a1);}
+void m_glGetnCompressedTexImageARB_record(GLenum,GLint,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnCompressedTexImageARB");return (void)0;}
+void m_glGetIntegerv_record(GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetIntegerv");return (void)0;}
+void m_glMatrixLoaddEXT_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC,&FunctionTable::m_ptr_glMatrixLoaddEXT>(a0,a1);}
+GLfloat m_glGetPathLengthNV_record(GLuint,GLsizei,GLsizei)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathLengthNV");return (GLfloat)0;}
+void m_glProgramUniformMatrix3dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3dv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*3*sizeof(*a4)));}
+void m_glUniform4i64NV_record(GLint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC,&FunctionTable::m_ptr_glUniform4i64NV>(a0,a1,a2,a3,a4);}
+void m_glGetHistogramEXT_record(GLenum,GLboolean,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramEXT");return (void)0;}
+void m_glVertexAttrib4NuivARB_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NuivARB>(a0,a1);}
+void m_glMapGrid2xOES_record(GLint a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC,&FunctionTable::m_ptr_glMapGrid2xOES>(a0,a1,a2,a3,a4);}
+void m_glTexImage2D_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const GLvoid* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC,&FunctionTable::m_ptr_glTexImage2D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glWindowPos2fvARB_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC,&FunctionTable::m_ptr_glWindowPos2fvARB>(a0);}
+void m_glEnableIndexedEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC,&FunctionTable::m_ptr_glEnableIndexedEXT>(a0,a1);}
+void m_glTexCoord1bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC,&FunctionTable::m_ptr_glTexCoord1bvOES>(a0);}
+void m_glDrawPixels_record(GLsizei a0,GLsizei a1,GLenum a2,GLenum a3,const GLvoid* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWPIXELSPROC,&FunctionTable::m_ptr_glDrawPixels>(a0,a1,a2,a3,a4);}
+void m_glMultMatrixd_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTMATRIXDPROC,&FunctionTable::m_ptr_glMultMatrixd>(a0);}
+void m_glMultMatrixf_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTMATRIXFPROC,&FunctionTable::m_ptr_glMultMatrixf>(a0);}
+void m_glReplacementCodePointerSUN_record(GLenum a0,GLsizei a1,const void** a2)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC,&FunctionTable::m_ptr_glReplacementCodePointerSUN>(a0,a1,a2);}
+void m_glLoadTransposeMatrixdARB_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC,&FunctionTable::m_ptr_glLoadTransposeMatrixdARB>(a0);}
+void m_glVertexAttrib4Nubv_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC,&FunctionTable::m_ptr_glVertexAttrib4Nubv>(a0,a1);}
+void m_glVertexArrayVertexAttribIOffsetEXT_record(GLuint a0,GLuint a1,GLuint a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribIOffsetEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glCompileShaderARB_record(GLhandleARB a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC,&FunctionTable::m_ptr_glCompileShaderARB>(a0);}
+void m_glWindowPos3dMESA_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC,&FunctionTable::m_ptr_glWindowPos3dMESA>(a0,a1,a2);}
+void m_glNormalStream3fvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC,&FunctionTable::m_ptr_glNormalStream3fvATI>(a0,a1);}
+void m_glColor4usv_record(const GLushort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4USVPROC,&FunctionTable::m_ptr_glColor4usv>(a0);}
+void m_glMapGrid1f_record(GLint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID1FPROC,&FunctionTable::m_ptr_glMapGrid1f>(a0,a1,a2);}
+void m_glPolygonStipple_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC,&FunctionTable::m_ptr_glPolygonStipple>(a0);}
+void m_glUniform4ui64ARB_record(GLint a0,GLuint64 a1,GLuint64 a2,GLuint64 a3,GLuint64 a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC,&FunctionTable::m_ptr_glUniform4ui64ARB>(a0,a1,a2,a3,a4);}
+void m_glTextureRenderbufferEXT_record(GLuint a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC,&FunctionTable::m_ptr_glTextureRenderbufferEXT>(a0,a1,a2);}
+GLint m_glGetSubroutineUniformLocation_record(GLuint,GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSubroutineUniformLocation");return (GLint)0;}
+void m_glGetFramebufferParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFramebufferParameteriv");return (void)0;}
+void m_glPixelMapusv_record(GLenum a0,GLsizei a1,const GLushort* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC,&FunctionTable::m_ptr_glPixelMapusv>(a0,a1,a2);}
+void m_glGetSamplerParameteriv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSamplerParameteriv");return (void)0;}
+void m_glVertexStream2fvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC,&FunctionTable::m_ptr_glVertexStream2fvATI>(a0,a1);}
+void m_glProgramStringARB_record(GLenum a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC,&FunctionTable::m_ptr_glProgramStringARB>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix3dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*3*sizeof(*a4)));}
+void m_glSeparableFilter2D_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6,const GLvoid* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC,&FunctionTable::m_ptr_glSeparableFilter2D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glVertexAttribI1uiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC,&FunctionTable::m_ptr_glVertexAttribI1uiv>(a0,a1);}
+void m_glLGPUCopyImageSubDataNVX_record(GLuint a0,GLbitfield a1,GLuint a2,GLenum a3,GLint a4,GLint a5,GLint a6,GLint a7,GLuint a8,GLenum a9,GLint a10,GLint a11,GLint a12,GLint a13,GLsizei a14,GLsizei a15,GLsizei a16)const{this->template m_record<FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC,&FunctionTable::m_ptr_glLGPUCopyImageSubDataNVX>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}
+void m_glTexStorage2D_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC,&FunctionTable::m_ptr_glTexStorage2D>(a0,a1,a2,a3,a4);}
+void m_glColor3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3FVPROC,&FunctionTable::m_ptr_glColor3fv>(a0);}
+void m_glGetMultiTexGendvEXT_record(GLenum,GLenum,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexGendvEXT");return (void)0;}
+void m_glVertexAttribL4dvEXT_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC,&FunctionTable::m_ptr_glVertexAttribL4dvEXT>(a0,a1);}
+void m_glGetActiveUniform_record(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniform");return (void)0;}
+void m_glUniform2ui64vARB_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC,&FunctionTable::m_ptr_glUniform2ui64vARB>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glMakeNamedBufferResidentNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeNamedBufferResidentNV>(a0,a1);}
+GLenum m_glPathGlyphIndexRangeNV_record(GLenum,const void*,GLbitfield,GLuint,GLfloat,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glPathGlyphIndexRangeNV");return (GLenum)0;}
+void m_glColorPointer_record(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORPOINTERPROC,&FunctionTable::m_ptr_glColorPointer>(a0,a1,a2,a3);}
+void m_glProgramEnvParameterI4ivNV_record(GLenum a0,GLuint a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC,&FunctionTable::m_ptr_glProgramEnvParameterI4ivNV>(a0,a1,a2);}
+void m_glMulticastGetQueryObjectui64vNV_record(GLuint a0,GLuint a1,GLenum a2,GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC,&FunctionTable::m_ptr_glMulticastGetQueryObjectui64vNV>(a0,a1,a2,a3);}
+void m_glMultiTexParameterfEXT_record(GLenum a0,GLenum a1,GLenum a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC,&FunctionTable::m_ptr_glMultiTexParameterfEXT>(a0,a1,a2,a3);}
+void m_glNamedFramebufferTextureLayer_record(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC,&FunctionTable::m_ptr_glNamedFramebufferTextureLayer>(a0,a1,a2,a3,a4);}
+void m_glGetVertexArrayIntegervEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayIntegervEXT");return (void)0;}
+void m_glVertexAttrib3dARB_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC,&FunctionTable::m_ptr_glVertexAttrib3dARB>(a0,a1,a2,a3);}
+GLboolean m_glVDPAUIsSurfaceNV_record(GLvdpauSurfaceNV)const{this->m_printUnrecordableFunctionErrorAndExit("glVDPAUIsSurfaceNV");return (GLboolean)0;}
+void m_glMultiTexImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC,&FunctionTable::m_ptr_glMultiTexImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+GLboolean m_glIsAsyncMarkerSGIX_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsAsyncMarkerSGIX");return (GLboolean)0;}
+void m_glGetDoublei_vEXT_record(GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDoublei_vEXT");return (void)0;}
+void m_glUniform2i64NV_record(GLint a0,GLint64EXT a1,GLint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC,&FunctionTable::m_ptr_glUniform2i64NV>(a0,a1,a2);}
+GLboolean m_glIsCommandListNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsCommandListNV");return (GLboolean)0;}
+void m_glUniform3uiEXT_record(GLint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC,&FunctionTable::m_ptr_glUniform3uiEXT>(a0,a1,a2,a3);}
+void m_glTexParameterIuivEXT_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC,&FunctionTable::m_ptr_glTexParameterIuivEXT>(a0,a1,a2);}
+void m_glProgramUniformMatrix4fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4fv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*4*sizeof(*a4)));}
+void m_glVertex2fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2FVPROC,&FunctionTable::m_ptr_glVertex2fv>(a0);}
+void m_glVertexAttribL3dEXT_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC,&FunctionTable::m_ptr_glVertexAttribL3dEXT>(a0,a1,a2,a3);}
+void m_glFramebufferRenderbuffer_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC,&FunctionTable::m_ptr_glFramebufferRenderbuffer>(a0,a1,a2,a3);}
+GLint m_glGetUniformLocationARB_record(GLhandleARB,const GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformLocationARB");return (GLint)0;}
+void m_glPathParameterfvNV_record(GLuint a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC,&FunctionTable::m_ptr_glPathParameterfvNV>(a0,a1,a2);}
+void m_glVertexAttrib3sNV_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC,&FunctionTable::m_ptr_glVertexAttrib3sNV>(a0,a1,a2,a3);}
+void m_glGetDoublei_v_record(GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDoublei_v");return (void)0;}
+void m_glVertexAttrib1sv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC,&FunctionTable::m_ptr_glVertexAttrib1sv>(a0,a1);}
+void m_glBindSampler_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDSAMPLERPROC,&FunctionTable::m_ptr_glBindSampler>(a0,a1);}
+void m_glLineWidth_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLINEWIDTHPROC,&FunctionTable::m_ptr_glLineWidth>(a0);}
+void m_glVertexArrayRangeAPPLE_record(GLsizei a0,void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC,&FunctionTable::m_ptr_glVertexArrayRangeAPPLE>(a0,a1);}
+void m_glBindBufferOffsetEXT_record(GLenum a0,GLuint a1,GLuint a2,GLintptr a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC,&FunctionTable::m_ptr_glBindBufferOffsetEXT>(a0,a1,a2,a3);}
+void m_glWeightfvARB_record(GLint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC,&FunctionTable::m_ptr_glWeightfvARB>(a0,a1);}
+void m_glGetIntegeri_v_record(GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetIntegeri_v");return (void)0;}
+void m_glGetTransformFeedbackVarying_record(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbackVarying");return (void)0;}
+void m_glProgramLocalParameter4fvARB_record(GLenum a0,GLuint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC,&FunctionTable::m_ptr_glProgramLocalParameter4fvARB>(a0,a1,a2);}
+void m_glGetTransformFeedbackVaryingNV_record(GLuint,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbackVaryingNV");return (void)0;}
+void m_glWindowPos2iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC,&FunctionTable::m_ptr_glWindowPos2iv>(a0);}
+void m_glVertexStream1dATI_record(GLenum a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC,&FunctionTable::m_ptr_glVertexStream1dATI>(a0,a1);}
+void m_glColorFragmentOp2ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC,&FunctionTable::m_ptr_glColorFragmentOp2ATI>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glFogiv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGIVPROC,&FunctionTable::m_ptr_glFogiv>(a0,a1);}
+GLuint64 m_glGetTextureHandleNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureHandleNV");return (GLuint64)0;}
+void m_glLightModeliv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC,&FunctionTable::m_ptr_glLightModeliv>(a0,a1);}
+void m_glDepthRangef_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC,&FunctionTable::m_ptr_glDepthRangef>(a0,a1);}
+void m_glGetFragmentMaterialivSGIX_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragmentMaterialivSGIX");return (void)0;}
+void m_glVideoCaptureStreamParameterfvNV_record(GLuint a0,GLuint a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC,&FunctionTable::m_ptr_glVideoCaptureStreamParameterfvNV>(a0,a1,a2,a3);}
+void m_glDeleteProgramsARB_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC,&FunctionTable::m_ptr_glDeleteProgramsARB>(a0,a1);}
+void m_glWindowPos3fvARB_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC,&FunctionTable::m_ptr_glWindowPos3fvARB>(a0);}
+void m_glFeedbackBufferxOES_record(GLsizei a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC,&FunctionTable::m_ptr_glFeedbackBufferxOES>(a0,a1,a2);}
+void m_glGetTexBumpParameterfvATI_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexBumpParameterfvATI");return (void)0;}
+void m_glEnablei_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEIPROC,&FunctionTable::m_ptr_glEnablei>(a0,a1);}
+void m_glGetActiveSubroutineName_record(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveSubroutineName");return (void)0;}
+void m_glDrawBuffersARB_record(GLsizei a0,const GLenum* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC,&FunctionTable::m_ptr_glDrawBuffersARB>(a0,a1);}
+void m_glBindProgramARB_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC,&FunctionTable::m_ptr_glBindProgramARB>(a0,a1);}
+void m_glEvalCoord1fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC,&FunctionTable::m_ptr_glEvalCoord1fv>(a0);}
+void m_glProgramUniform3ui64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC,&FunctionTable::m_ptr_glProgramUniform3ui64vARB>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glProgramUniformMatrix2dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2dv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*2*sizeof(*a4)));}
+void m_glMultiTexCoord2hvNV_record(GLenum a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC,&FunctionTable::m_ptr_glMultiTexCoord2hvNV>(a0,a1);}
+void m_glGetFloatIndexedvEXT_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFloatIndexedvEXT");return (void)0;}
+void m_glSampleCoverageARB_record(GLfloat a0,GLboolean a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC,&FunctionTable::m_ptr_glSampleCoverageARB>(a0,a1);}
+void m_glProgramUniform2ui64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC,&FunctionTable::m_ptr_glProgramUniform2ui64vARB>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glPixelDataRangeNV_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC,&FunctionTable::m_ptr_glPixelDataRangeNV>(a0,a1,a2);}
+void m_glVertexStream3svATI_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC,&FunctionTable::m_ptr_glVertexStream3svATI>(a0,a1);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN>(a0,a1,a2,a3);}
+void m_glTexCoord3hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC,&FunctionTable::m_ptr_glTexCoord3hvNV>(a0);}
+void m_glSampleMaski_record(GLuint a0,GLbitfield a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC,&FunctionTable::m_ptr_glSampleMaski>(a0,a1);}
+void m_glIndexFuncEXT_record(GLenum a0,GLclampf a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC,&FunctionTable::m_ptr_glIndexFuncEXT>(a0,a1);}
+void m_glPointParameteriNV_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC,&FunctionTable::m_ptr_glPointParameteriNV>(a0,a1);}
+void m_glUniformMatrix3x2fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC,&FunctionTable::m_ptr_glUniformMatrix3x2fv>(a0,a1,a2,this->m_copy(a3,a1,3*2*sizeof(*a3)));}
+void m_glGetFramebufferParameterivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFramebufferParameterivEXT");return (void)0;}
+void m_glUniform2i64ARB_record(GLint a0,GLint64 a1,GLint64 a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC,&FunctionTable::m_ptr_glUniform2i64ARB>(a0,a1,a2);}
+void m_glNamedBufferStorageEXT_record(GLuint a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC,&FunctionTable::m_ptr_glNamedBufferStorageEXT>(a0,a1,a2,a3);}
+void m_glNamedFramebufferTexture3DEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTexture3DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttrib2dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC,&FunctionTable::m_ptr_glVertexAttrib2dv>(a0,a1);}
+void m_glGetVertexArrayPointervEXT_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayPointervEXT");return (void)0;}
+void m_glGetVertexAttribArrayObjectivATI_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribArrayObjectivATI");return (void)0;}
+void m_glProgramUniformMatrix3fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*3*sizeof(*a4)));}
+void m_glEnableVertexArrayEXT_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC,&FunctionTable::m_ptr_glEnableVertexArrayEXT>(a0,a1);}
+void m_glColorTableParameterfvSGI_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC,&FunctionTable::m_ptr_glColorTableParameterfvSGI>(a0,a1,a2);}
+void m_glEdgeFlag_record(GLboolean a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGPROC,&FunctionTable::m_ptr_glEdgeFlag>(a0);}
+void m_glFogCoordf_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDFPROC,&FunctionTable::m_ptr_glFogCoordf>(a0);}
+void m_glVertex3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3DPROC,&FunctionTable::m_ptr_glVertex3d>(a0,a1,a2);}
+void m_glVertex3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3FPROC,&FunctionTable::m_ptr_glVertex3f>(a0,a1,a2);}
+void m_glSpriteParameterivSGIX_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC,&FunctionTable::m_ptr_glSpriteParameterivSGIX>(a0,a1);}
+void m_glPathGlyphRangeNV_record(GLuint a0,GLenum a1,const void* a2,GLbitfield a3,GLuint a4,GLsizei a5,GLenum a6,GLuint a7,GLfloat a8)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC,&FunctionTable::m_ptr_glPathGlyphRangeNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glPrimitiveBoundingBoxARB_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC,&FunctionTable::m_ptr_glPrimitiveBoundingBoxARB>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glVertexAttribL3ui64vNV_record(GLuint a0,const GLuint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL3ui64vNV>(a0,a1);}
+void m_glVertex3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3SPROC,&FunctionTable::m_ptr_glVertex3s>(a0,a1,a2);}
+void m_glTexCoordP2ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC,&FunctionTable::m_ptr_glTexCoordP2ui>(a0,a1);}
+void m_glProgramUniform2fvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC,&FunctionTable::m_ptr_glProgramUniform2fvEXT>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glDeletePathsNV_record(GLuint a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC,&FunctionTable::m_ptr_glDeletePathsNV>(a0,a1);}
+void m_glPrimitiveRestartIndexNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC,&FunctionTable::m_ptr_glPrimitiveRestartIndexNV>(a0);}
+void m_glTexCoord2fColor3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor3fVertex3fvSUN>(a0,a1,a2);}
+void m_glTexCoordPointerListIBM_record(GLint a0,GLenum a1,GLint a2,const void** a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glTexCoordPointerListIBM>(a0,a1,a2,a3,a4);}
+void m_glRectxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTXOESPROC,&FunctionTable::m_ptr_glRectxOES>(a0,a1,a2,a3);}
+void m_glCopyNamedBufferSubData_record(GLuint a0,GLuint a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glCopyNamedBufferSubData>(a0,a1,a2,a3,a4);}
+void m_glGenProgramsNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenProgramsNV");return (void)0;}
+void m_glFragmentLightfSGIX_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC,&FunctionTable::m_ptr_glFragmentLightfSGIX>(a0,a1,a2);}
+void m_glTexStorage3D_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC,&FunctionTable::m_ptr_glTexStorage3D>(a0,a1,a2,a3,a4,a5);}
+void m_glTextureParameteriv_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC,&FunctionTable::m_ptr_glTextureParameteriv>(a0,a1,a2);}
+void m_glNamedBufferDataEXT_record(GLuint a0,GLsizeiptr a1,const void* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC,&FunctionTable::m_ptr_glNamedBufferDataEXT>(a0,a1,this->m_copy(a2,a1,1),a3);}
+void m_glImportSemaphoreWin32NameEXT_record(GLuint a0,GLenum a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC,&FunctionTable::m_ptr_glImportSemaphoreWin32NameEXT>(a0,a1,a2);}
+void m_glMultiTexCoord3fvARB_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3fvARB>(a0,a1);}
+void m_glUniformMatrix3x4fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC,&FunctionTable::m_ptr_glUniformMatrix3x4fv>(a0,a1,a2,this->m_copy(a3,a1,3*4*sizeof(*a3)));}
+void m_glSubpixelPrecisionBiasNV_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC,&FunctionTable::m_ptr_glSubpixelPrecisionBiasNV>(a0,a1);}
+void m_glNormalPointer_record(GLenum a0,GLsizei a1,const GLvoid* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALPOINTERPROC,&FunctionTable::m_ptr_glNormalPointer>(a0,a1,a2);}
+void m_glNamedFramebufferTexture_record(GLuint a0,GLenum a1,GLuint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC,&FunctionTable::m_ptr_glNamedFramebufferTexture>(a0,a1,a2,a3);}
+void m_glVertexAttrib4NsvARB_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NsvARB>(a0,a1);}
+void m_glPassThrough_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPASSTHROUGHPROC,&FunctionTable::m_ptr_glPassThrough>(a0);}
+void m_glSecondaryColorP3ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC,&FunctionTable::m_ptr_glSecondaryColorP3ui>(a0,a1);}
+void m_glInvalidateTexSubImage_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC,&FunctionTable::m_ptr_glInvalidateTexSubImage>(a0,a1,a2,a3,a4,a5,a6,a7);}
+GLboolean m_glIsImageHandleResidentARB_record(GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glIsImageHandleResidentARB");return (GLboolean)0;}
+void m_glTangent3fvEXT_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC,&FunctionTable::m_ptr_glTangent3fvEXT>(a0);}
+void m_glProgramUniformMatrix4x3fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x3fv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*3*sizeof(*a4)));}
+void m_glBegin_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINPROC,&FunctionTable::m_ptr_glBegin>(a0);}
+void m_glEvalCoord2dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC,&FunctionTable::m_ptr_glEvalCoord2dv>(a0);}
+void m_glColor3ubv_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3UBVPROC,&FunctionTable::m_ptr_glColor3ubv>(a0);}
+void m_glFogCoordfvEXT_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC,&FunctionTable::m_ptr_glFogCoordfvEXT>(a0);}
+void m_glVertexP3ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP3UIPROC,&FunctionTable::m_ptr_glVertexP3ui>(a0,a1);}
+void m_glLightfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTFVPROC,&FunctionTable::m_ptr_glLightfv>(a0,a1,a2);}
+void m_glVertexAttribL3i64NV_record(GLuint a0,GLint64EXT a1,GLint64EXT a2,GLint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC,&FunctionTable::m_ptr_glVertexAttribL3i64NV>(a0,a1,a2,a3);}
+void m_glStencilClearTagEXT_record(GLsizei a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC,&FunctionTable::m_ptr_glStencilClearTagEXT>(a0,a1);}
+void m_glGetActiveUniformName_record(GLuint,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniformName");return (void)0;}
+void m_glTangentPointerEXT_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC,&FunctionTable::m_ptr_glTangentPointerEXT>(a0,a1,a2);}
+void m_glUniform4ui64vNV_record(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC,&FunctionTable::m_ptr_glUniform4ui64vNV>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glDebugMessageEnableAMD_record(GLenum a0,GLenum a1,GLsizei a2,const GLuint* a3,GLboolean a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC,&FunctionTable::m_ptr_glDebugMessageEnableAMD>(a0,a1,a2,a3,a4);}
+void m_glProgramUniform2ui_record(GLuint a0,GLint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC,&FunctionTable::m_ptr_glProgramUniform2ui>(a0,a1,a2,a3);}
+void m_glCopyTexSubImage2DEXT_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyTexSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGenRenderbuffersEXT_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenRenderbuffersEXT");return (void)0;}
+void m_glNamedProgramLocalParameterI4ivEXT_record(GLuint a0,GLenum a1,GLuint a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameterI4ivEXT>(a0,a1,a2,a3);}
+void m_glMultiTexCoord2f_record(GLenum a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC,&FunctionTable::m_ptr_glMultiTexCoord2f>(a0,a1,a2);}
+void m_glMapGrid2d_record(GLint a0,GLdouble a1,GLdouble a2,GLint a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID2DPROC,&FunctionTable::m_ptr_glMapGrid2d>(a0,a1,a2,a3,a4,a5);}
+void m_glGetMultiTexParameterIuivEXT_record(GLenum,GLenum,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexParameterIuivEXT");return (void)0;}
+void m_glBlendEquationiARB_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC,&FunctionTable::m_ptr_glBlendEquationiARB>(a0,a1);}
+void m_glTexParameteriv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC,&FunctionTable::m_ptr_glTexParameteriv>(a0,a1,a2);}
+void m_glUniform4ivARB_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC,&FunctionTable::m_ptr_glUniform4ivARB>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glMatrixOrthoEXT_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5,GLdouble a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC,&FunctionTable::m_ptr_glMatrixOrthoEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexArrayVertexBuffer_record(GLuint a0,GLuint a1,GLuint a2,GLintptr a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC,&FunctionTable::m_ptr_glVertexArrayVertexBuffer>(a0,a1,a2,a3,a4);}
+void m_glProgramLocalParametersI4ivNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC,&FunctionTable::m_ptr_glProgramLocalParametersI4ivNV>(a0,a1,a2,a3);}
+void m_glProgramUniform4ui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC,&FunctionTable::m_ptr_glProgramUniform4ui64vNV>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glGetNamedStringivARB_record(GLint,const GLchar*,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedStringivARB");return (void)0;}
+void m_glVertexAttribL1i64vNV_record(GLuint a0,const GLint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL1i64vNV>(a0,a1);}
+void m_glTransformFeedbackBufferBase_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC,&FunctionTable::m_ptr_glTransformFeedbackBufferBase>(a0,a1,a2);}
+void m_glIndexsv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXSVPROC,&FunctionTable::m_ptr_glIndexsv>(a0);}
+void m_glPointParameterivNV_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC,&FunctionTable::m_ptr_glPointParameterivNV>(a0,a1);}
+void m_glGetDetailTexFuncSGIS_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDetailTexFuncSGIS");return (void)0;}
+void m_glReplacementCodeuiColor3fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor3fVertex3fvSUN>(a0,a1,a2);}
+void m_glProgramLocalParameter4fARB_record(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC,&FunctionTable::m_ptr_glProgramLocalParameter4fARB>(a0,a1,a2,a3,a4,a5);}
+void m_glBitmap_record(GLsizei a0,GLsizei a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,const GLubyte* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLBITMAPPROC,&FunctionTable::m_ptr_glBitmap>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glNamedFramebufferTextureLayerEXT_record(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTextureLayerEXT>(a0,a1,a2,a3,a4);}
+void m_glMultiTexGenfvEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC,&FunctionTable::m_ptr_glMultiTexGenfvEXT>(a0,a1,a2,a3);}
+void m_glGetNamedBufferSubData_record(GLuint,GLintptr,GLsizeiptr,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferSubData");return (void)0;}
+void m_glStencilFuncSeparateATI_record(GLenum a0,GLenum a1,GLint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC,&FunctionTable::m_ptr_glStencilFuncSeparateATI>(a0,a1,a2,a3);}
+void m_glProgramUniform2iv_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC,&FunctionTable::m_ptr_glProgramUniform2iv>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glGetQueryiv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryiv");return (void)0;}
+void m_glTexCoord4f_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FPROC,&FunctionTable::m_ptr_glTexCoord4f>(a0,a1,a2,a3);}
+void m_glMapGrid2f_record(GLint a0,GLfloat a1,GLfloat a2,GLint a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPGRID2FPROC,&FunctionTable::m_ptr_glMapGrid2f>(a0,a1,a2,a3,a4,a5);}
+void m_glListParameterivSGIX_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC,&FunctionTable::m_ptr_glListParameterivSGIX>(a0,a1,a2);}
+void m_glCreateQueries_record(GLenum,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateQueries");return (void)0;}
+void m_glGetSamplerParameterfv_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSamplerParameterfv");return (void)0;}
+void m_glTexCoord4i_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4IPROC,&FunctionTable::m_ptr_glTexCoord4i>(a0,a1,a2,a3);}
+void m_glObjectLabel_record(GLenum a0,GLuint a1,GLsizei a2,const GLchar* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLOBJECTLABELPROC,&FunctionTable::m_ptr_glObjectLabel>(a0,a1,a2,a3);}
+void m_glProgramUniform3i64NV_record(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC,&FunctionTable::m_ptr_glProgramUniform3i64NV>(a0,a1,a2,a3,a4);}
+GLuint64 m_glGetTextureHandleARB_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureHandleARB");return (GLuint64)0;}
+void m_glTexCoord4s_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4SPROC,&FunctionTable::m_ptr_glTexCoord4s>(a0,a1,a2,a3);}
+void m_glUniform4iARB_record(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC,&FunctionTable::m_ptr_glUniform4iARB>(a0,a1,a2,a3,a4);}
+void m_glGetUniformIndices_record(GLuint,GLsizei,const GLchar*const*,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformIndices");return (void)0;}
+void m_glMultiTexImage3DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC,&FunctionTable::m_ptr_glMultiTexImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glCoverageModulationTableNV_record(GLsizei a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC,&FunctionTable::m_ptr_glCoverageModulationTableNV>(a0,a1);}
+void m_glPointParameteriv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC,&FunctionTable::m_ptr_glPointParameteriv>(a0,a1);}
+void m_glMultiTexCoord4svARB_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4svARB>(a0,a1);}
+void m_glNormal3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3FVPROC,&FunctionTable::m_ptr_glNormal3fv>(a0);}
+void m_glProgramUniformMatrix3x4dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x4dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*4*sizeof(*a4)));}
+void m_glTexCoord1fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC,&FunctionTable::m_ptr_glTexCoord1fv>(a0);}
+void m_glProgramUniformMatrix4x3dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x3dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*3*sizeof(*a4)));}
+void m_glGetActiveVaryingNV_record(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveVaryingNV");return (void)0;}
+void m_glUniform1i64vARB_record(GLint a0,GLsizei a1,const GLint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC,&FunctionTable::m_ptr_glUniform1i64vARB>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glMultiTexCoord1dv_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC,&FunctionTable::m_ptr_glMultiTexCoord1dv>(a0,a1);}
+void m_glTexCoord3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC,&FunctionTable::m_ptr_glTexCoord3fv>(a0);}
+void m_glMatrixTranslatefEXT_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC,&FunctionTable::m_ptr_glMatrixTranslatefEXT>(a0,a1,a2,a3);}
+void m_glProgramUniform1ui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC,&FunctionTable::m_ptr_glProgramUniform1ui64vNV>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glTextureMaterialEXT_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC,&FunctionTable::m_ptr_glTextureMaterialEXT>(a0,a1);}
+void m_glMultiTexCoordP3uiv_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC,&FunctionTable::m_ptr_glMultiTexCoordP3uiv>(a0,a1,a2);}
+void m_glVertexAttribP3ui_record(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC,&FunctionTable::m_ptr_glVertexAttribP3ui>(a0,a1,a2,a3);}
+void m_glInterpolatePathsNV_record(GLuint a0,GLuint a1,GLuint a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC,&FunctionTable::m_ptr_glInterpolatePathsNV>(a0,a1,a2,a3);}
+void m_glTextureBufferRange_record(GLuint a0,GLenum a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC,&FunctionTable::m_ptr_glTextureBufferRange>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribL2dEXT_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC,&FunctionTable::m_ptr_glVertexAttribL2dEXT>(a0,a1,a2);}
+void m_glGetPixelTransformParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelTransformParameterivEXT");return (void)0;}
+void m_glTexCoord4xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC,&FunctionTable::m_ptr_glTexCoord4xvOES>(a0);}
+void m_glGetVariantBooleanvEXT_record(GLuint,GLenum,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantBooleanvEXT");return (void)0;}
+void m_glDepthRange_record(GLclampd a0,GLclampd a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEPROC,&FunctionTable::m_ptr_glDepthRange>(a0,a1);}
+void m_glGetVertexAttribdvARB_record(GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribdvARB");return (void)0;}
+void m_glGetColorTableParameterfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameterfv");return (void)0;}
+void m_glDrawArraysInstancedEXT_record(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC,&FunctionTable::m_ptr_glDrawArraysInstancedEXT>(a0,a1,a2,a3);}
+void m_glDisableClientStateIndexedEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC,&FunctionTable::m_ptr_glDisableClientStateIndexedEXT>(a0,a1);}
+void m_glDrawBuffer_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWBUFFERPROC,&FunctionTable::m_ptr_glDrawBuffer>(a0);}
+void m_glMultiDrawArraysIndirectBindlessNV_record(GLenum a0,const void* a1,GLsizei a2,GLsizei a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessNV>(a0,a1,a2,a3,a4);}
+void m_glGetnPixelMapusv_record(GLenum,GLsizei,GLushort*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapusv");return (void)0;}
+void m_glRasterPos3fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC,&FunctionTable::m_ptr_glRasterPos3fv>(a0);}
+void m_glClearBufferuiv_record(GLenum a0,GLint a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC,&FunctionTable::m_ptr_glClearBufferuiv>(a0,a1,a2);}
+void m_glGetInternalformati64v_record(GLenum,GLenum,GLenum,GLsizei,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInternalformati64v");return (void)0;}
+void m_glShaderSourceARB_record(GLhandleARB a0,GLsizei a1,const GLcharARB** a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC,&FunctionTable::m_ptr_glShaderSourceARB>(a0,a1,a2,a3);}
+void m_glShaderOp3EXT_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC,&FunctionTable::m_ptr_glShaderOp3EXT>(a0,a1,a2,a3,a4);}
+void m_glWindowPos2dvMESA_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC,&FunctionTable::m_ptr_glWindowPos2dvMESA>(a0);}
+void m_glClearIndex_record(GLfloat a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARINDEXPROC,&FunctionTable::m_ptr_glClearIndex>(a0);}
+void m_glProvokingVertexEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC,&FunctionTable::m_ptr_glProvokingVertexEXT>(a0);}
+void m_glVariantubvEXT_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC,&FunctionTable::m_ptr_glVariantubvEXT>(a0,a1);}
+void m_glFlush_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHPROC,&FunctionTable::m_ptr_glFlush>();}
+void m_glFramebufferTexture2DEXT_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC,&FunctionTable::m_ptr_glFramebufferTexture2DEXT>(a0,a1,a2,a3,a4);}
+void m_glGetColorTableParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameterivEXT");return (void)0;}
+void m_glPresentFrameDualFillNV_record(GLuint a0,GLuint64EXT a1,GLuint a2,GLuint a3,GLenum a4,GLenum a5,GLuint a6,GLenum a7,GLuint a8,GLenum a9,GLuint a10,GLenum a11,GLuint a12)const{this->template m_record<FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC,&FunctionTable::m_ptr_glPresentFrameDualFillNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+GLuint m_glGenVertexShadersEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGenVertexShadersEXT");return (GLuint)0;}
+void m_glSpecializeShaderARB_record(GLuint a0,const GLchar* a1,GLuint a2,const GLuint* a3,const GLuint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC,&FunctionTable::m_ptr_glSpecializeShaderARB>(a0,a1,a2,a3,a4);}
+void m_glProgramUniformHandleui64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC,&FunctionTable::m_ptr_glProgramUniformHandleui64vARB>(a0,a1,a2,a3);}
+void m_glDepthRangefOES_record(GLclampf a0,GLclampf a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC,&FunctionTable::m_ptr_glDepthRangefOES>(a0,a1);}
+void m_glDeleteVertexArrays_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC,&FunctionTable::m_ptr_glDeleteVertexArrays>(a0,a1);}
+void m_glDrawElementsInstancedBaseVertexBaseInstance_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLint a5,GLuint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC,&FunctionTable::m_ptr_glDrawElementsInstancedBaseVertexBaseInstance>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetTexLevelParameteriv_record(GLenum,GLint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexLevelParameteriv");return (void)0;}
+void m_glDrawVkImageNV_record(GLuint64 a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC,&FunctionTable::m_ptr_glDrawVkImageNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glWindowPos3iARB_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC,&FunctionTable::m_ptr_glWindowPos3iARB>(a0,a1,a2);}
+void m_glPrioritizeTextures_record(GLsizei a0,const GLuint* a1,const GLclampf* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC,&FunctionTable::m_ptr_glPrioritizeTextures>(a0,a1,a2);}
+void m_glWindowPos3fvMESA_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC,&FunctionTable::m_ptr_glWindowPos3fvMESA>(a0);}
+void m_glProgramUniformMatrix3x2dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x2dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,3*2*sizeof(*a4)));}
+void m_glVertex4xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC,&FunctionTable::m_ptr_glVertex4xvOES>(a0);}
+void m_glTexStorage3DMultisample_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTexStorage3DMultisample>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glWindowPos2sARB_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC,&FunctionTable::m_ptr_glWindowPos2sARB>(a0,a1);}
+void m_glStencilOpValueAMD_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC,&FunctionTable::m_ptr_glStencilOpValueAMD>(a0,a1);}
+void m_glProgramVertexLimitNV_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC,&FunctionTable::m_ptr_glProgramVertexLimitNV>(a0,a1);}
+void m_glGetTexParameterPointervAPPLE_record(GLenum,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterPointervAPPLE");return (void)0;}
+void m_glProgramUniform3uivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC,&FunctionTable::m_ptr_glProgramUniform3uivEXT>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glClampColor_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLAMPCOLORPROC,&FunctionTable::m_ptr_glClampColor>(a0,a1);}
+void m_glClearStencil_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARSTENCILPROC,&FunctionTable::m_ptr_glClearStencil>(a0);}
+void m_glTexCoordP1uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC,&FunctionTable::m_ptr_glTexCoordP1uiv>(a0,a1);}
+void m_glVertexAttribs3svNV_record(GLuint a0,GLsizei a1,const GLshort* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC,&FunctionTable::m_ptr_glVertexAttribs3svNV>(a0,a1,a2);}
+void m_glMultiTexCoord3fv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC,&FunctionTable::m_ptr_glMultiTexCoord3fv>(a0,a1);}
+void m_glVertexBlendEnvfATI_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC,&FunctionTable::m_ptr_glVertexBlendEnvfATI>(a0,a1);}
+GLboolean m_glIsFenceAPPLE_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsFenceAPPLE");return (GLboolean)0;}
+void m_glGetBufferParameterui64vNV_record(GLenum,GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferParameterui64vNV");return (void)0;}
+void m_glVertexAttribI4bvEXT_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4bvEXT>(a0,a1);}
+void m_glUniform2fARB_record(GLint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC,&FunctionTable::m_ptr_glUniform2fARB>(a0,a1,a2);}
+void m_glStopInstrumentsSGIX_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC,&FunctionTable::m_ptr_glStopInstrumentsSGIX>(a0);}
+void m_glVertexAttrib3fNV_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC,&FunctionTable::m_ptr_glVertexAttrib3fNV>(a0,a1,a2,a3);}
+void m_glMapVertexAttrib2dAPPLE_record(GLuint a0,GLuint a1,GLdouble a2,GLdouble a3,GLint a4,GLint a5,GLdouble a6,GLdouble a7,GLint a8,GLint a9,const GLdouble* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC,&FunctionTable::m_ptr_glMapVertexAttrib2dAPPLE>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glVertex2f_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2FPROC,&FunctionTable::m_ptr_glVertex2f>(a0,a1);}
+void m_glCopyTextureImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLint a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyTextureImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glVertex2d_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2DPROC,&FunctionTable::m_ptr_glVertex2d>(a0,a1);}
+void m_glSecondaryColor3bvEXT_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3bvEXT>(a0);}
+void m_glMultiTexCoord4fARB_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4fARB>(a0,a1,a2,a3,a4);}
+void m_glPolygonOffset_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC,&FunctionTable::m_ptr_glPolygonOffset>(a0,a1);}
+void m_glTangent3bvEXT_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC,&FunctionTable::m_ptr_glTangent3bvEXT>(a0);}
+void m_glHistogram_record(GLenum a0,GLsizei a1,GLenum a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLHISTOGRAMPROC,&FunctionTable::m_ptr_glHistogram>(a0,a1,a2,a3);}
+void m_glGetProgramiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramiv");return (void)0;}
+void m_glMatrixIndexubvARB_record(GLint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC,&FunctionTable::m_ptr_glMatrixIndexubvARB>(a0,a1);}
+void m_glVertex2s_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2SPROC,&FunctionTable::m_ptr_glVertex2s>(a0,a1);}
+void m_glGetVertexAttribLui64vNV_record(GLuint,GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribLui64vNV");return (void)0;}
+void m_glGetProgramStringARB_record(GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramStringARB");return (void)0;}
+void m_glFlushMappedBufferRange_record(GLenum a0,GLintptr a1,GLsizeiptr a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC,&FunctionTable::m_ptr_glFlushMappedBufferRange>(a0,a1,a2);}
+void m_glVertexAttribI3uiEXT_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC,&FunctionTable::m_ptr_glVertexAttribI3uiEXT>(a0,a1,a2,a3);}
+void m_glLineWidthxOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC,&FunctionTable::m_ptr_glLineWidthxOES>(a0);}
+void m_glProgramUniformMatrix2fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*2*sizeof(*a4)));}
+void m_glGetTextureParameterIuivEXT_record(GLuint,GLenum,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterIuivEXT");return (void)0;}
+void m_glGetMultiTexEnvivEXT_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexEnvivEXT");return (void)0;}
+void m_glPixelTexGenParameterivSGIS_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC,&FunctionTable::m_ptr_glPixelTexGenParameterivSGIS>(a0,a1);}
+void m_glGenQueries_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenQueries");return (void)0;}
+void m_glGetPixelMapfv_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelMapfv");return (void)0;}
+void m_glBlendColorEXT_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC,&FunctionTable::m_ptr_glBlendColorEXT>(a0,a1,a2,a3);}
+void m_glResetMinmax_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRESETMINMAXPROC,&FunctionTable::m_ptr_glResetMinmax>(a0);}
+void m_glGetnUniformivARB_record(GLuint,GLint,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformivARB");return (void)0;}
+void m_glVertexBlendARB_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC,&FunctionTable::m_ptr_glVertexBlendARB>(a0);}
+void m_glVertexAttrib4d_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC,&FunctionTable::m_ptr_glVertexAttrib4d>(a0,a1,a2,a3,a4);}
+GLint m_glGetVaryingLocationNV_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVaryingLocationNV");return (GLint)0;}
+void m_glGetMapAttribParameterivNV_record(GLenum,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapAttribParameterivNV");return (void)0;}
+void m_glTexSubImage3D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const GLvoid* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC,&FunctionTable::m_ptr_glTexSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glDeleteSamplers_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC,&FunctionTable::m_ptr_glDeleteSamplers>(a0,a1);}
+void m_glGetLightxOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLightxOES");return (void)0;}
+void m_glGetVertexAttribArrayObjectfvATI_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribArrayObjectfvATI");return (void)0;}
+void m_glVertexArrayNormalOffsetEXT_record(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayNormalOffsetEXT>(a0,a1,a2,a3,a4);}
+void m_glGetBufferParameterivARB_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferParameterivARB");return (void)0;}
+void m_glGetTextureParameterfv_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterfv");return (void)0;}
+void m_glDrawMeshArraysSUN_record(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC,&FunctionTable::m_ptr_glDrawMeshArraysSUN>(a0,a1,a2,a3);}
+void m_glVertexAttrib4dNV_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC,&FunctionTable::m_ptr_glVertexAttrib4dNV>(a0,a1,a2,a3,a4);}
+void m_glGetMultisamplefvNV_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultisamplefvNV");return (void)0;}
+void* m_glMapObjectBufferATI_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glMapObjectBufferATI");return (void*)0;}
+void m_glGetPathCommandsNV_record(GLuint,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathCommandsNV");return (void)0;}
+void m_glVertexArrayTexCoordOffsetEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayTexCoordOffsetEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glGetHistogram_record(GLenum,GLboolean,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogram");return (void)0;}
+void m_glMatrixMode_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMODEPROC,&FunctionTable::m_ptr_glMatrixMode>(a0);}
+void m_glColorFormatNV_record(GLint a0,GLenum a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC,&FunctionTable::m_ptr_glColorFormatNV>(a0,a1,a2);}
+void m_glProgramUniformui64NV_record(GLuint a0,GLint a1,GLuint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC,&FunctionTable::m_ptr_glProgramUniformui64NV>(a0,a1,a2);}
+void m_glProgramUniformMatrix4x2fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x2fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*2*sizeof(*a4)));}
+void m_glLoadMatrixxOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC,&FunctionTable::m_ptr_glLoadMatrixxOES>(a0);}
+void m_glGetColorTableParameterfvEXT_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameterfvEXT");return (void)0;}
+void m_glRasterPos4i_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4IPROC,&FunctionTable::m_ptr_glRasterPos4i>(a0,a1,a2,a3);}
+void m_glVertexAttribL2i64NV_record(GLuint a0,GLint64EXT a1,GLint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC,&FunctionTable::m_ptr_glVertexAttribL2i64NV>(a0,a1,a2);}
+void m_glBindTextures_record(GLuint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTEXTURESPROC,&FunctionTable::m_ptr_glBindTextures>(a0,a1,a2);}
+void m_glMatrixRotatefEXT_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC,&FunctionTable::m_ptr_glMatrixRotatefEXT>(a0,a1,a2,a3,a4);}
+void m_glGetClipPlanexOES_record(GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetClipPlanexOES");return (void)0;}
+void m_glSecondaryColor3uivEXT_record(const GLuint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3uivEXT>(a0);}
+void m_glGetPerfQueryInfoINTEL_record(GLuint,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfQueryInfoINTEL");return (void)0;}
+void m_glGetDoublev_record(GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDoublev");return (void)0;}
+void m_glBindBufferRangeEXT_record(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC,&FunctionTable::m_ptr_glBindBufferRangeEXT>(a0,a1,a2,a3,a4);}
+void m_glCompressedTexImage2D_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLsizei a6,const GLvoid* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC,&FunctionTable::m_ptr_glCompressedTexImage2D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void* m_glMapBufferARB_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glMapBufferARB");return (void*)0;}
+void m_glGetPathSpacingNV_record(GLenum,GLsizei,GLenum,const void*,GLuint,GLfloat,GLfloat,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathSpacingNV");return (void)0;}
+void m_glUniform4dv_record(GLint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4DVPROC,&FunctionTable::m_ptr_glUniform4dv>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glGlobalAlphaFactordSUN_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactordSUN>(a0);}
+void m_glProgramUniform3dv_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC,&FunctionTable::m_ptr_glProgramUniform3dv>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glGetShaderSourceARB_record(GLhandleARB,GLsizei,GLsizei*,GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetShaderSourceARB");return (void)0;}
+void m_glVertexAttrib3dvARB_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC,&FunctionTable::m_ptr_glVertexAttrib3dvARB>(a0,a1);}
+void m_glInvalidateBufferData_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC,&FunctionTable::m_ptr_glInvalidateBufferData>(a0);}
+void m_glMatrixLoad3x2fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC,&FunctionTable::m_ptr_glMatrixLoad3x2fNV>(a0,a1);}
+void m_glCompressedTextureSubImage1D_record(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glTexCoord3xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC,&FunctionTable::m_ptr_glTexCoord3xvOES>(a0);}
+void m_glGenTexturesEXT_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenTexturesEXT");return (void)0;}
+void m_glTangent3iEXT_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC,&FunctionTable::m_ptr_glTangent3iEXT>(a0,a1,a2);}
+void m_glClearTexImage_record(GLuint a0,GLint a1,GLenum a2,GLenum a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC,&FunctionTable::m_ptr_glClearTexImage>(a0,a1,a2,a3,a4);}
+void m_glBinormal3bvEXT_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC,&FunctionTable::m_ptr_glBinormal3bvEXT>(a0);}
+void m_glUniform3fv_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3FVPROC,&FunctionTable::m_ptr_glUniform3fv>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glGetnPixelMapusvARB_record(GLenum,GLsizei,GLushort*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapusvARB");return (void)0;}
+void m_glMemoryObjectParameterivEXT_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC,&FunctionTable::m_ptr_glMemoryObjectParameterivEXT>(a0,a1,a2);}
+void m_glGenSemaphoresEXT_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenSemaphoresEXT");return (void)0;}
+void m_glMultiTexCoordP1ui_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC,&FunctionTable::m_ptr_glMultiTexCoordP1ui>(a0,a1,a2);}
+void m_glClearNamedBufferDataEXT_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC,&FunctionTable::m_ptr_glClearNamedBufferDataEXT>(a0,a1,a2,a3,a4);}
+void m_glUniformMatrix4dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC,&FunctionTable::m_ptr_glUniformMatrix4dv>(a0,a1,a2,this->m_copy(a3,a1,4*4*sizeof(*a3)));}
+void m_glWindowPos3fMESA_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC,&FunctionTable::m_ptr_glWindowPos3fMESA>(a0,a1,a2);}
+void m_glDeleteRenderbuffers_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC,&FunctionTable::m_ptr_glDeleteRenderbuffers>(a0,a1);}
+void m_glGetTextureLevelParameterfvEXT_record(GLuint,GLenum,GLint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureLevelParameterfvEXT");return (void)0;}
+void m_glGetHistogramParameterxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramParameterxvOES");return (void)0;}
+void m_glMultiDrawElements_record(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC,&FunctionTable::m_ptr_glMultiDrawElements>(a0,a1,a2,a3,a4);}
+void m_glMakeImageHandleNonResidentNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeImageHandleNonResidentNV>(a0);}
+void m_glTexSubImage1DEXT_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glTexSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glNormalStream3dATI_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC,&FunctionTable::m_ptr_glNormalStream3dATI>(a0,a1,a2,a3);}
+void m_glVertexAttribL4i64vNV_record(GLuint a0,const GLint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL4i64vNV>(a0,a1);}
+void m_glDrawBuffers_record(GLsizei a0,const GLenum* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC,&FunctionTable::m_ptr_glDrawBuffers>(a0,a1);}
+void m_glCopyTextureSubImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyTextureSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glWindowRectanglesEXT_record(GLenum a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC,&FunctionTable::m_ptr_glWindowRectanglesEXT>(a0,a1,a2);}
+void m_glNamedFramebufferReadBuffer_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC,&FunctionTable::m_ptr_glNamedFramebufferReadBuffer>(a0,a1);}
+void m_glUniform2i64vARB_record(GLint a0,GLsizei a1,const GLint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC,&FunctionTable::m_ptr_glUniform2i64vARB>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glVertexAttribI1uivEXT_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI1uivEXT>(a0,a1);}
+void m_glGetTexGenfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexGenfv");return (void)0;}
+void m_glBeginQueryARB_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC,&FunctionTable::m_ptr_glBeginQueryARB>(a0,a1);}
+void m_glUniform1iARB_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC,&FunctionTable::m_ptr_glUniform1iARB>(a0,a1);}
+void m_glVertex4bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC,&FunctionTable::m_ptr_glVertex4bvOES>(a0);}
+void m_glInvalidateSubFramebuffer_record(GLenum a0,GLsizei a1,const GLenum* a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC,&FunctionTable::m_ptr_glInvalidateSubFramebuffer>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glUniform1fvARB_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC,&FunctionTable::m_ptr_glUniform1fvARB>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+GLboolean m_glTestFenceNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glTestFenceNV");return (GLboolean)0;}
+void m_glBindTransformFeedback_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glBindTransformFeedback>(a0,a1);}
+void m_glMultiTexCoord2iv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC,&FunctionTable::m_ptr_glMultiTexCoord2iv>(a0,a1);}
+void m_glCopyMultiTexSubImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyMultiTexSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVariantbvEXT_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC,&FunctionTable::m_ptr_glVariantbvEXT>(a0,a1);}
+void m_glTexCoord1hNV_record(GLhalfNV a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC,&FunctionTable::m_ptr_glTexCoord1hNV>(a0);}
+void m_glGenFencesNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenFencesNV");return (void)0;}
+void m_glRasterPos3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC,&FunctionTable::m_ptr_glRasterPos3iv>(a0);}
+void m_glVertexAttribL2ui64NV_record(GLuint a0,GLuint64EXT a1,GLuint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC,&FunctionTable::m_ptr_glVertexAttribL2ui64NV>(a0,a1,a2);}
+void m_glMultiTexCoord1hvNV_record(GLenum a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC,&FunctionTable::m_ptr_glMultiTexCoord1hvNV>(a0,a1);}
+void m_glGetnConvolutionFilter_record(GLenum,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnConvolutionFilter");return (void)0;}
+void m_glNormal3bv_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3BVPROC,&FunctionTable::m_ptr_glNormal3bv>(a0);}
+void m_glWeightbvARB_record(GLint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC,&FunctionTable::m_ptr_glWeightbvARB>(a0,a1);}
+void m_glTexCoord4sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC,&FunctionTable::m_ptr_glTexCoord4sv>(a0);}
+void m_glUniform2uiv_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC,&FunctionTable::m_ptr_glUniform2uiv>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glBeginConditionalRenderNVX_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC,&FunctionTable::m_ptr_glBeginConditionalRenderNVX>(a0);}
+void m_glFinish_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFINISHPROC,&FunctionTable::m_ptr_glFinish>();}
+void m_glColorTableParameterfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC,&FunctionTable::m_ptr_glColorTableParameterfv>(a0,a1,a2);}
+void m_glFragmentCoverageColorNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC,&FunctionTable::m_ptr_glFragmentCoverageColorNV>(a0);}
+void m_glProgramUniform3ivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC,&FunctionTable::m_ptr_glProgramUniform3ivEXT>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glVertexArrayVertexOffsetEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexOffsetEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glViewportPositionWScaleNV_record(GLuint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC,&FunctionTable::m_ptr_glViewportPositionWScaleNV>(a0,a1,a2);}
+void m_glGetProgramLocalParameterIuivNV_record(GLenum,GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramLocalParameterIuivNV");return (void)0;}
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_record(const GLuint* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN>(a0,a1,a2);}
+void m_glUniform1uiv_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC,&FunctionTable::m_ptr_glUniform1uiv>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glUniformMatrix2dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC,&FunctionTable::m_ptr_glUniformMatrix2dv>(a0,a1,a2,this->m_copy(a3,a1,2*2*sizeof(*a3)));}
+void m_glIndexdv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXDVPROC,&FunctionTable::m_ptr_glIndexdv>(a0);}
+void m_glSecondaryColor3ivEXT_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3ivEXT>(a0);}
+void m_glTexCoord3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC,&FunctionTable::m_ptr_glTexCoord3iv>(a0);}
+void m_glVertexStream4fvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC,&FunctionTable::m_ptr_glVertexStream4fvATI>(a0,a1);}
+void m_glDeformationMap3fSGIX_record(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,GLfloat a5,GLfloat a6,GLint a7,GLint a8,GLfloat a9,GLfloat a10,GLint a11,GLint a12,const GLfloat* a13)const{this->template m_record<FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC,&FunctionTable::m_ptr_glDeformationMap3fSGIX>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}
+void m_glClearDepth_record(GLclampd a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARDEPTHPROC,&FunctionTable::m_ptr_glClearDepth>(a0);}
+GLuint m_glGenAsyncMarkersSGIX_record(GLsizei)const{this->m_printUnrecordableFunctionErrorAndExit("glGenAsyncMarkersSGIX");return (GLuint)0;}
+void m_glDisableIndexedEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC,&FunctionTable::m_ptr_glDisableIndexedEXT>(a0,a1);}
+void m_glVertexWeightfvEXT_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC,&FunctionTable::m_ptr_glVertexWeightfvEXT>(a0);}
+void m_glGetProgramLocalParameterIivNV_record(GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramLocalParameterIivNV");return (void)0;}
+void m_glCompressedTexImage3DARB_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC,&FunctionTable::m_ptr_glCompressedTexImage3DARB>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glProgramParameter4fNV_record(GLenum a0,GLuint a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC,&FunctionTable::m_ptr_glProgramParameter4fNV>(a0,a1,a2,a3,a4,a5);}
+void m_glConvolutionParameterxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC,&FunctionTable::m_ptr_glConvolutionParameterxOES>(a0,a1,a2);}
+void m_glInsertComponentEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC,&FunctionTable::m_ptr_glInsertComponentEXT>(a0,a1,a2);}
+void m_glCreateTextures_record(GLenum,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateTextures");return (void)0;}
+void m_glSecondaryColor3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC,&FunctionTable::m_ptr_glSecondaryColor3iv>(a0);}
+void m_glCreateBuffers_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateBuffers");return (void)0;}
+void m_glMultiTexCoord2xvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord2xvOES>(a0,a1);}
+void m_glTexGenxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENXVOESPROC,&FunctionTable::m_ptr_glTexGenxvOES>(a0,a1,a2);}
+void m_glMultTransposeMatrixf_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC,&FunctionTable::m_ptr_glMultTransposeMatrixf>(a0);}
+void m_glBeginTransformFeedbackEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC,&FunctionTable::m_ptr_glBeginTransformFeedbackEXT>(a0);}
+void m_glTexCoord2fColor3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glNormal3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3SVPROC,&FunctionTable::m_ptr_glNormal3sv>(a0);}
+void m_glFreeObjectBufferATI_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC,&FunctionTable::m_ptr_glFreeObjectBufferATI>(a0);}
+void m_glBlendBarrierNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC,&FunctionTable::m_ptr_glBlendBarrierNV>();}
+void m_glUniform4i64vNV_record(GLint a0,GLsizei a1,const GLint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC,&FunctionTable::m_ptr_glUniform4i64vNV>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glGetnUniformuivARB_record(GLuint,GLint,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformuivARB");return (void)0;}
+void m_glAlphaFragmentOp3ATI_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7,GLuint a8,GLuint a9,GLuint a10,GLuint a11)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC,&FunctionTable::m_ptr_glAlphaFragmentOp3ATI>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glProgramEnvParameters4fvEXT_record(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC,&FunctionTable::m_ptr_glProgramEnvParameters4fvEXT>(a0,a1,a2,a3);}
+void m_glBlendFuncSeparateEXT_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC,&FunctionTable::m_ptr_glBlendFuncSeparateEXT>(a0,a1,a2,a3);}
+void m_glConvolutionParameterivEXT_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC,&FunctionTable::m_ptr_glConvolutionParameterivEXT>(a0,a1,a2);}
+void m_glPixelTexGenSGIX_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC,&FunctionTable::m_ptr_glPixelTexGenSGIX>(a0);}
+void m_glDeleteProgram_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC,&FunctionTable::m_ptr_glDeleteProgram>(a0);}
+void m_glUniformMatrix4x3dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC,&FunctionTable::m_ptr_glUniformMatrix4x3dv>(a0,a1,a2,this->m_copy(a3,a1,4*3*sizeof(*a3)));}
+void m_glGetVideoCaptureStreamivNV_record(GLuint,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoCaptureStreamivNV");return (void)0;}
+void m_glProgramUniform4uiEXT_record(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC,&FunctionTable::m_ptr_glProgramUniform4uiEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glMakeImageHandleNonResidentARB_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC,&FunctionTable::m_ptr_glMakeImageHandleNonResidentARB>(a0);}
+void m_glSecondaryColor3dEXT_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3dEXT>(a0,a1,a2);}
+void m_glDeleteQueries_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEQUERIESPROC,&FunctionTable::m_ptr_glDeleteQueries>(a0,a1);}
+void m_glNormalP3uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALP3UIVPROC,&FunctionTable::m_ptr_glNormalP3uiv>(a0,a1);}
+void m_glRasterPos2d_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2DPROC,&FunctionTable::m_ptr_glRasterPos2d>(a0,a1);}
+void m_glInitNames_record()const{this->template m_record<FunctionTable::MEMBERPFNGLINITNAMESPROC,&FunctionTable::m_ptr_glInitNames>();}
+void m_glBinormal3fvEXT_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC,&FunctionTable::m_ptr_glBinormal3fvEXT>(a0);}
+void m_glColor3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3DVPROC,&FunctionTable::m_ptr_glColor3dv>(a0);}
+void m_glVertexArrayVertexAttribDivisorEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribDivisorEXT>(a0,a1,a2);}
+void m_glArrayElementEXT_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC,&FunctionTable::m_ptr_glArrayElementEXT>(a0);}
+void m_glProgramParameter4dNV_record(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC,&FunctionTable::m_ptr_glProgramParameter4dNV>(a0,a1,a2,a3,a4,a5);}
+void m_glIndexxOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXXOESPROC,&FunctionTable::m_ptr_glIndexxOES>(a0);}
+void m_glUniform3uivEXT_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC,&FunctionTable::m_ptr_glUniform3uivEXT>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glPopGroupMarkerEXT_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC,&FunctionTable::m_ptr_glPopGroupMarkerEXT>();}
+void m_glClearNamedFramebufferuiv_record(GLuint a0,GLenum a1,GLint a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC,&FunctionTable::m_ptr_glClearNamedFramebufferuiv>(a0,a1,a2,a3);}
+void m_glSetLocalConstantEXT_record(GLuint a0,GLenum a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC,&FunctionTable::m_ptr_glSetLocalConstantEXT>(a0,a1,a2);}
+void m_glProgramUniform1ui64NV_record(GLuint a0,GLint a1,GLuint64EXT a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC,&FunctionTable::m_ptr_glProgramUniform1ui64NV>(a0,a1,a2);}
+void m_glColor4hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC,&FunctionTable::m_ptr_glColor4hvNV>(a0);}
+void m_glGetVertexAttribfv_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribfv");return (void)0;}
+void m_glDispatchCompute_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC,&FunctionTable::m_ptr_glDispatchCompute>(a0,a1,a2);}
+void m_glGetActiveAttrib_record(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveAttrib");return (void)0;}
+void m_glFragmentColorMaterialSGIX_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC,&FunctionTable::m_ptr_glFragmentColorMaterialSGIX>(a0,a1);}
+void m_glTexSubImage2D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const GLvoid* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC,&FunctionTable::m_ptr_glTexSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glGetnMinmaxARB_record(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMinmaxARB");return (void)0;}
+void m_glLogicOp_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOGICOPPROC,&FunctionTable::m_ptr_glLogicOp>(a0);}
+void m_glProgramUniformMatrix3x4fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x4fv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*4*sizeof(*a4)));}
+void m_glWindowPos4iMESA_record(GLint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC,&FunctionTable::m_ptr_glWindowPos4iMESA>(a0,a1,a2,a3);}
+void m_glPixelTransferf_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC,&FunctionTable::m_ptr_glPixelTransferf>(a0,a1);}
+void m_glGetTextureParameterIuiv_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterIuiv");return (void)0;}
+void m_glMultiTexCoord1xOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC,&FunctionTable::m_ptr_glMultiTexCoord1xOES>(a0,a1);}
+void m_glProgramUniformMatrix4dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4dv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*4*sizeof(*a4)));}
+void m_glGetnUniformiv_record(GLuint,GLint,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformiv");return (void)0;}
+void m_glFramebufferTexture1DEXT_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC,&FunctionTable::m_ptr_glFramebufferTexture1DEXT>(a0,a1,a2,a3,a4);}
+void m_glVertexPointervINTEL_record(GLint a0,GLenum a1,const void** a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC,&FunctionTable::m_ptr_glVertexPointervINTEL>(a0,a1,a2);}
+void m_glTextureParameterIiv_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC,&FunctionTable::m_ptr_glTextureParameterIiv>(a0,a1,a2);}
+void m_glGetSeparableFilterEXT_record(GLenum,GLenum,GLenum,void*,void*,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSeparableFilterEXT");return (void)0;}
+void m_glMultiTexCoord3iARB_record(GLenum a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3iARB>(a0,a1,a2,a3);}
+void m_glRasterPos4xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC,&FunctionTable::m_ptr_glRasterPos4xvOES>(a0);}
+void m_glDrawTransformFeedbackStream_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC,&FunctionTable::m_ptr_glDrawTransformFeedbackStream>(a0,a1,a2);}
+void m_glVertex3hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC,&FunctionTable::m_ptr_glVertex3hvNV>(a0);}
+void m_glVertexArrayMultiTexCoordOffsetEXT_record(GLuint a0,GLuint a1,GLenum a2,GLint a3,GLenum a4,GLsizei a5,GLintptr a6)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayMultiTexCoordOffsetEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glProvokingVertex_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC,&FunctionTable::m_ptr_glProvokingVertex>(a0);}
+void m_glAccumxOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLACCUMXOESPROC,&FunctionTable::m_ptr_glAccumxOES>(a0,a1);}
+void m_glShaderBinary_record(GLsizei a0,const GLuint* a1,GLenum a2,const void* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADERBINARYPROC,&FunctionTable::m_ptr_glShaderBinary>(a0,a1,a2,a3,a4);}
+void m_glGetMultiTexGenivEXT_record(GLenum,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexGenivEXT");return (void)0;}
+void m_glPointParameterxvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC,&FunctionTable::m_ptr_glPointParameterxvOES>(a0,a1);}
+void m_glCreateStatesNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateStatesNV");return (void)0;}
+void m_glClearDepthdNV_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC,&FunctionTable::m_ptr_glClearDepthdNV>(a0);}
+void m_glClearColorIuiEXT_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC,&FunctionTable::m_ptr_glClearColorIuiEXT>(a0,a1,a2,a3);}
+void m_glBindMultiTextureEXT_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC,&FunctionTable::m_ptr_glBindMultiTextureEXT>(a0,a1,a2);}
+void m_glTexGeniv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXGENIVPROC,&FunctionTable::m_ptr_glTexGeniv>(a0,a1,a2);}
+void m_glDrawElements_record(GLenum a0,GLsizei a1,GLenum a2,const GLvoid* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC,&FunctionTable::m_ptr_glDrawElements>(a0,a1,a2,a3);}
+void m_glProgramUniform4iv_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC,&FunctionTable::m_ptr_glProgramUniform4iv>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glDisableVertexArrayEXT_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC,&FunctionTable::m_ptr_glDisableVertexArrayEXT>(a0,a1);}
+void m_glProgramUniform3ui64NV_record(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC,&FunctionTable::m_ptr_glProgramUniform3ui64NV>(a0,a1,a2,a3,a4);}
+void m_glClientActiveTexture_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC,&FunctionTable::m_ptr_glClientActiveTexture>(a0);}
+void m_glMultiTexParameterIivEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC,&FunctionTable::m_ptr_glMultiTexParameterIivEXT>(a0,a1,a2,a3);}
+void m_glUniform1i64ARB_record(GLint a0,GLint64 a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC,&FunctionTable::m_ptr_glUniform1i64ARB>(a0,a1);}
+void m_glUniform1iv_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1IVPROC,&FunctionTable::m_ptr_glUniform1iv>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glMulticastBarrierNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC,&FunctionTable::m_ptr_glMulticastBarrierNV>();}
+void m_glVertexAttribArrayObjectATI_record(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,GLuint a5,GLuint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC,&FunctionTable::m_ptr_glVertexAttribArrayObjectATI>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glUniform2iARB_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC,&FunctionTable::m_ptr_glUniform2iARB>(a0,a1,a2);}
+void m_glDrawArraysInstanced_record(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC,&FunctionTable::m_ptr_glDrawArraysInstanced>(a0,a1,a2,a3);}
+void m_glVertexAttrib2sNV_record(GLuint a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC,&FunctionTable::m_ptr_glVertexAttrib2sNV>(a0,a1,a2);}
+void m_glTexBufferEXT_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC,&FunctionTable::m_ptr_glTexBufferEXT>(a0,a1,a2);}
+void m_glVertexStream2fATI_record(GLenum a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC,&FunctionTable::m_ptr_glVertexStream2fATI>(a0,a1,a2);}
+void m_glDebugMessageCallbackAMD_record(GLDEBUGPROCAMD a0,void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC,&FunctionTable::m_ptr_glDebugMessageCallbackAMD>(a0,a1);}
+void m_glSamplerParameteriv_record(GLuint a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC,&FunctionTable::m_ptr_glSamplerParameteriv>(a0,a1,a2);}
+void m_glVertexAttrib4uiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC,&FunctionTable::m_ptr_glVertexAttrib4uiv>(a0,a1);}
+void m_glEndQueryIndexed_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC,&FunctionTable::m_ptr_glEndQueryIndexed>(a0,a1);}
+void m_glNormalStream3sATI_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC,&FunctionTable::m_ptr_glNormalStream3sATI>(a0,a1,a2,a3);}
+void m_glProgramParameteriARB_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC,&FunctionTable::m_ptr_glProgramParameteriARB>(a0,a1,a2);}
+void m_glTexEnvxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVXOESPROC,&FunctionTable::m_ptr_glTexEnvxOES>(a0,a1,a2);}
+void m_glProgramUniform1iv_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC,&FunctionTable::m_ptr_glProgramUniform1iv>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glDisableVertexAttribAPPLE_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC,&FunctionTable::m_ptr_glDisableVertexAttribAPPLE>(a0,a1);}
+void m_glBindRenderbuffer_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC,&FunctionTable::m_ptr_glBindRenderbuffer>(a0,a1);}
+void m_glMultiTexSubImage3DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLenum a9,GLenum a10,const void* a11)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC,&FunctionTable::m_ptr_glMultiTexSubImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+GLboolean m_glIsProgram_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsProgram");return (GLboolean)0;}
+void m_glMultiDrawElementsIndirectAMD_record(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirectAMD>(a0,a1,a2,a3,a4);}
+void m_glGetProgramInfoLog_record(GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramInfoLog");return (void)0;}
+void m_glGetLocalConstantBooleanvEXT_record(GLuint,GLenum,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLocalConstantBooleanvEXT");return (void)0;}
+void m_glPixelTransformParameteriEXT_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC,&FunctionTable::m_ptr_glPixelTransformParameteriEXT>(a0,a1,a2);}
+void m_glTexCoord4bOES_record(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC,&FunctionTable::m_ptr_glTexCoord4bOES>(a0,a1,a2,a3);}
+void m_glVertexAttrib4fv_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC,&FunctionTable::m_ptr_glVertexAttrib4fv>(a0,a1);}
+void m_glProgramUniformMatrix2x3dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x3dv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*3*sizeof(*a4)));}
+void m_glProgramEnvParametersI4uivNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC,&FunctionTable::m_ptr_glProgramEnvParametersI4uivNV>(a0,a1,a2,a3);}
+void m_glTexCoord3xOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC,&FunctionTable::m_ptr_glTexCoord3xOES>(a0,a1,a2);}
+void m_glLoadTransposeMatrixfARB_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC,&FunctionTable::m_ptr_glLoadTransposeMatrixfARB>(a0);}
+void m_glImageTransformParameteriHP_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC,&FunctionTable::m_ptr_glImageTransformParameteriHP>(a0,a1,a2);}
+void m_glMultiTexCoord4xOES_record(GLenum a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC,&FunctionTable::m_ptr_glMultiTexCoord4xOES>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribs3fvNV_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC,&FunctionTable::m_ptr_glVertexAttribs3fvNV>(a0,a1,a2);}
+void m_glVertexAttrib2fv_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC,&FunctionTable::m_ptr_glVertexAttrib2fv>(a0,a1);}
+void m_glUniform3ui64NV_record(GLint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC,&FunctionTable::m_ptr_glUniform3ui64NV>(a0,a1,a2,a3);}
+void m_glCombinerParameterfvNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC,&FunctionTable::m_ptr_glCombinerParameterfvNV>(a0,a1);}
+void m_glFragmentMaterialiSGIX_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC,&FunctionTable::m_ptr_glFragmentMaterialiSGIX>(a0,a1,a2);}
+void m_glGetBooleani_v_record(GLenum,GLuint,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBooleani_v");return (void)0;}
+GLuint m_glGetProgramResourceIndex_record(GLuint,GLenum,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourceIndex");return (GLuint)0;}
+void m_glBeginConditionalRenderNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC,&FunctionTable::m_ptr_glBeginConditionalRenderNV>(a0,a1);}
+void m_glDisableClientState_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC,&FunctionTable::m_ptr_glDisableClientState>(a0);}
+void m_glPathFogGenNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC,&FunctionTable::m_ptr_glPathFogGenNV>(a0);}
+void m_glStencilThenCoverFillPathNV_record(GLuint a0,GLenum a1,GLuint a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC,&FunctionTable::m_ptr_glStencilThenCoverFillPathNV>(a0,a1,a2,a3);}
+void m_glVertexArrayIndexOffsetEXT_record(GLuint a0,GLuint a1,GLenum a2,GLsizei a3,GLintptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayIndexOffsetEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramBufferParametersIuivNV_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,const GLuint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC,&FunctionTable::m_ptr_glProgramBufferParametersIuivNV>(a0,a1,a2,a3,a4);}
+void m_glPixelTransformParameterivEXT_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC,&FunctionTable::m_ptr_glPixelTransformParameterivEXT>(a0,a1,a2);}
+void m_glDisableClientStateiEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC,&FunctionTable::m_ptr_glDisableClientStateiEXT>(a0,a1);}
+void m_glTexBufferARB_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC,&FunctionTable::m_ptr_glTexBufferARB>(a0,a1,a2);}
+void m_glGetLocalConstantIntegervEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLocalConstantIntegervEXT");return (void)0;}
+void m_glColor4uiv_record(const GLuint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UIVPROC,&FunctionTable::m_ptr_glColor4uiv>(a0);}
+void m_glProgramUniform3i_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC,&FunctionTable::m_ptr_glProgramUniform3i>(a0,a1,a2,a3,a4);}
+void m_glMultiDrawElementsIndirectBindlessCountNV_record(GLenum a0,GLenum a1,const void* a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirectBindlessCountNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetBufferPointervARB_record(GLenum,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferPointervARB");return (void)0;}
+void m_glMultiTexParameterIuivEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC,&FunctionTable::m_ptr_glMultiTexParameterIuivEXT>(a0,a1,a2,a3);}
+void m_glEvalMesh2_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALMESH2PROC,&FunctionTable::m_ptr_glEvalMesh2>(a0,a1,a2,a3,a4);}
+void m_glEvalMesh1_record(GLenum a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALMESH1PROC,&FunctionTable::m_ptr_glEvalMesh1>(a0,a1,a2);}
+void m_glProgramUniform3f_record(GLuint a0,GLint a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC,&FunctionTable::m_ptr_glProgramUniform3f>(a0,a1,a2,a3,a4);}
+void m_glStencilThenCoverFillPathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLuint a5,GLenum a6,GLenum a7,const GLfloat* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glStencilThenCoverFillPathInstancedNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glProgramUniform3d_record(GLuint a0,GLint a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC,&FunctionTable::m_ptr_glProgramUniform3d>(a0,a1,a2,a3,a4);}
+void m_glMapVertexAttrib1dAPPLE_record(GLuint a0,GLuint a1,GLdouble a2,GLdouble a3,GLint a4,GLint a5,const GLdouble* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC,&FunctionTable::m_ptr_glMapVertexAttrib1dAPPLE>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glEvalCoord2fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC,&FunctionTable::m_ptr_glEvalCoord2fv>(a0);}
+void m_glGetUniformivARB_record(GLhandleARB,GLint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformivARB");return (void)0;}
+void m_glLoadTransposeMatrixd_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC,&FunctionTable::m_ptr_glLoadTransposeMatrixd>(a0);}
+void m_glLoadTransposeMatrixf_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC,&FunctionTable::m_ptr_glLoadTransposeMatrixf>(a0);}
+void m_glGetPointervEXT_record(GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPointervEXT");return (void)0;}
+void m_glSignalVkSemaphoreNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC,&FunctionTable::m_ptr_glSignalVkSemaphoreNV>(a0);}
+void m_glEndConditionalRenderNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC,&FunctionTable::m_ptr_glEndConditionalRenderNV>();}
+void m_glTexCoord2fNormal3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glTexCoord2fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glUniform3i64vARB_record(GLint a0,GLsizei a1,const GLint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC,&FunctionTable::m_ptr_glUniform3i64vARB>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glProgramUniform2uiEXT_record(GLuint a0,GLint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC,&FunctionTable::m_ptr_glProgramUniform2uiEXT>(a0,a1,a2,a3);}
+void m_glVertexAttribI1ui_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC,&FunctionTable::m_ptr_glVertexAttribI1ui>(a0,a1);}
+void m_glProgramNamedParameter4dvNV_record(GLuint a0,GLsizei a1,const GLubyte* a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC,&FunctionTable::m_ptr_glProgramNamedParameter4dvNV>(a0,a1,a2,a3);}
+void m_glCompileCommandListNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC,&FunctionTable::m_ptr_glCompileCommandListNV>(a0);}
+void m_glGetRenderbufferParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetRenderbufferParameterivEXT");return (void)0;}
+void m_glGetnPolygonStipple_record(GLsizei,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPolygonStipple");return (void)0;}
+GLboolean m_glIsBufferResidentNV_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glIsBufferResidentNV");return (GLboolean)0;}
+void m_glSecondaryColor3ubvEXT_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3ubvEXT>(a0);}
+void m_glGetNamedRenderbufferParameterivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedRenderbufferParameterivEXT");return (void)0;}
+void m_glNamedFramebufferSampleLocationsfvARB_record(GLuint a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC,&FunctionTable::m_ptr_glNamedFramebufferSampleLocationsfvARB>(a0,a1,a2,a3);}
+void m_glMultiTexGendvEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC,&FunctionTable::m_ptr_glMultiTexGendvEXT>(a0,a1,a2,a3);}
+void m_glVertexArrayRangeNV_record(GLsizei a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC,&FunctionTable::m_ptr_glVertexArrayRangeNV>(a0,a1);}
+GLboolean m_glIsTextureHandleResidentNV_record(GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTextureHandleResidentNV");return (GLboolean)0;}
+void m_glGetProgramEnvParameterdvARB_record(GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramEnvParameterdvARB");return (void)0;}
+GLboolean m_glIsNamedStringARB_record(GLint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glIsNamedStringARB");return (GLboolean)0;}
+void m_glSecondaryColorFormatNV_record(GLint a0,GLenum a1,GLsizei a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC,&FunctionTable::m_ptr_glSecondaryColorFormatNV>(a0,a1,a2);}
+void m_glVertexAttrib4ubvNV_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC,&FunctionTable::m_ptr_glVertexAttrib4ubvNV>(a0,a1);}
+void m_glTagSampleBufferSGIX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC,&FunctionTable::m_ptr_glTagSampleBufferSGIX>();}
+void m_glVDPAUUnregisterSurfaceNV_record(GLvdpauSurfaceNV a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC,&FunctionTable::m_ptr_glVDPAUUnregisterSurfaceNV>(a0);}
+void m_glGetPerfQueryIdByNameINTEL_record(GLchar*,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfQueryIdByNameINTEL");return (void)0;}
+void m_glGetInteger64v_record(GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInteger64v");return (void)0;}
+void m_glClipPlane_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCLIPPLANEPROC,&FunctionTable::m_ptr_glClipPlane>(a0,a1);}
+void m_glColor4ubVertex3fSUN_record(GLubyte a0,GLubyte a1,GLubyte a2,GLubyte a3,GLfloat a4,GLfloat a5,GLfloat a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC,&FunctionTable::m_ptr_glColor4ubVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glIndexub_record(GLubyte a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXUBPROC,&FunctionTable::m_ptr_glIndexub>(a0);}
+void m_glGetProgramEnvParameterfvARB_record(GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramEnvParameterfvARB");return (void)0;}
+void m_glVertexAttrib4usvARB_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4usvARB>(a0,a1);}
+void m_glNamedFramebufferRenderbuffer_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC,&FunctionTable::m_ptr_glNamedFramebufferRenderbuffer>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix3x4dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x4dv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*4*sizeof(*a4)));}
+GLboolean m_glTestFenceAPPLE_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glTestFenceAPPLE");return (GLboolean)0;}
+void m_glVertexAttrib4Niv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC,&FunctionTable::m_ptr_glVertexAttrib4Niv>(a0,a1);}
+void m_glVertexAttribL2i64vNV_record(GLuint a0,const GLint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL2i64vNV>(a0,a1);}
+void m_glColorP4uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORP4UIVPROC,&FunctionTable::m_ptr_glColorP4uiv>(a0,a1);}
+void m_glUniformMatrix2x3fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC,&FunctionTable::m_ptr_glUniformMatrix2x3fv>(a0,a1,a2,this->m_copy(a3,a1,2*3*sizeof(*a3)));}
+void m_glCallCommandListNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC,&FunctionTable::m_ptr_glCallCommandListNV>(a0);}
+void m_glClearBufferiv_record(GLenum a0,GLint a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC,&FunctionTable::m_ptr_glClearBufferiv>(a0,a1,a2);}
+void m_glNamedStringARB_record(GLenum a0,GLint a1,const GLchar* a2,GLint a3,const GLchar* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC,&FunctionTable::m_ptr_glNamedStringARB>(a0,a1,a2,a3,a4);}
+void m_glMatrixMult3x2fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC,&FunctionTable::m_ptr_glMatrixMult3x2fNV>(a0,a1);}
+void m_glGetNamedProgramStringEXT_record(GLuint,GLenum,GLenum,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramStringEXT");return (void)0;}
+void m_glGetnHistogramARB_record(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnHistogramARB");return (void)0;}
+void m_glGetTextureLevelParameterfv_record(GLuint,GLint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureLevelParameterfv");return (void)0;}
+void m_glMultiTexCoord1fv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC,&FunctionTable::m_ptr_glMultiTexCoord1fv>(a0,a1);}
+void m_glBitmapxOES_record(GLsizei a0,GLsizei a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5,const GLubyte* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLBITMAPXOESPROC,&FunctionTable::m_ptr_glBitmapxOES>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetSamplerParameterIuiv_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSamplerParameterIuiv");return (void)0;}
+void m_glTexCoordP3ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC,&FunctionTable::m_ptr_glTexCoordP3ui>(a0,a1);}
+void m_glTextureSubImage1D_record(GLuint a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC,&FunctionTable::m_ptr_glTextureSubImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttribLPointerEXT_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC,&FunctionTable::m_ptr_glVertexAttribLPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glFogCoordPointerEXT_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC,&FunctionTable::m_ptr_glFogCoordPointerEXT>(a0,a1,a2);}
+void m_glWindowPos3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC,&FunctionTable::m_ptr_glWindowPos3s>(a0,a1,a2);}
+void m_glVertexAttribs2svNV_record(GLuint a0,GLsizei a1,const GLshort* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC,&FunctionTable::m_ptr_glVertexAttribs2svNV>(a0,a1,a2);}
+void m_glTextureImage3DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC,&FunctionTable::m_ptr_glTextureImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glWindowPos3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC,&FunctionTable::m_ptr_glWindowPos3i>(a0,a1,a2);}
+void m_glWindowPos3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC,&FunctionTable::m_ptr_glWindowPos3d>(a0,a1,a2);}
+void m_glWindowPos3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC,&FunctionTable::m_ptr_glWindowPos3f>(a0,a1,a2);}
+GLboolean m_glIsEnabledIndexedEXT_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsEnabledIndexedEXT");return (GLboolean)0;}
+void m_glGetNamedProgramivEXT_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramivEXT");return (void)0;}
+void m_glVertex3xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC,&FunctionTable::m_ptr_glVertex3xvOES>(a0);}
+void m_glColor3us_record(GLushort a0,GLushort a1,GLushort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3USPROC,&FunctionTable::m_ptr_glColor3us>(a0,a1,a2);}
+void m_glBeginPerfMonitorAMD_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC,&FunctionTable::m_ptr_glBeginPerfMonitorAMD>(a0);}
+void m_glProgramUniformMatrix4x3dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x3dv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*3*sizeof(*a4)));}
+void m_glGetNamedProgramLocalParameterIuivEXT_record(GLuint,GLenum,GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramLocalParameterIuivEXT");return (void)0;}
+void m_glReadnPixels_record(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glReadnPixels");return (void)0;}
+void m_glMultiTexCoord4f_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC,&FunctionTable::m_ptr_glMultiTexCoord4f>(a0,a1,a2,a3,a4);}
+void m_glColor3ub_record(GLubyte a0,GLubyte a1,GLubyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3UBPROC,&FunctionTable::m_ptr_glColor3ub>(a0,a1,a2);}
+void m_glMultiTexCoord4d_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC,&FunctionTable::m_ptr_glMultiTexCoord4d>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribL3ui64NV_record(GLuint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC,&FunctionTable::m_ptr_glVertexAttribL3ui64NV>(a0,a1,a2,a3);}
+void m_glColor3ui_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3UIPROC,&FunctionTable::m_ptr_glColor3ui>(a0,a1,a2);}
+void m_glProgramUniform4fvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC,&FunctionTable::m_ptr_glProgramUniform4fvEXT>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glVertexAttrib2sARB_record(GLuint a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC,&FunctionTable::m_ptr_glVertexAttrib2sARB>(a0,a1,a2);}
+void m_glMultiTexCoord4i_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC,&FunctionTable::m_ptr_glMultiTexCoord4i>(a0,a1,a2,a3,a4);}
+GLenum m_glCheckFramebufferStatusEXT_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCheckFramebufferStatusEXT");return (GLenum)0;}
+void m_glGetnMapivARB_record(GLenum,GLenum,GLsizei,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapivARB");return (void)0;}
+void m_glMultiTexCoord1ivARB_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1ivARB>(a0,a1);}
+void m_glDisableVertexAttribArrayARB_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC,&FunctionTable::m_ptr_glDisableVertexAttribArrayARB>(a0);}
+void m_glGetPolygonStipple_record(GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPolygonStipple");return (void)0;}
+void m_glVertexAttribI4ui_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC,&FunctionTable::m_ptr_glVertexAttribI4ui>(a0,a1,a2,a3,a4);}
+void m_glGetPathDashArrayNV_record(GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathDashArrayNV");return (void)0;}
+void m_glMultiTexRenderbufferEXT_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC,&FunctionTable::m_ptr_glMultiTexRenderbufferEXT>(a0,a1,a2);}
+void m_glCopyTextureSubImage1D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC,&FunctionTable::m_ptr_glCopyTextureSubImage1D>(a0,a1,a2,a3,a4,a5);}
+void m_glDeleteOcclusionQueriesNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC,&FunctionTable::m_ptr_glDeleteOcclusionQueriesNV>(a0,a1);}
+void m_glVertex4hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC,&FunctionTable::m_ptr_glVertex4hvNV>(a0);}
+void m_glGetnTexImage_record(GLenum,GLint,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnTexImage");return (void)0;}
+void m_glProgramLocalParameter4dARB_record(GLenum a0,GLuint a1,GLdouble a2,GLdouble a3,GLdouble a4,GLdouble a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC,&FunctionTable::m_ptr_glProgramLocalParameter4dARB>(a0,a1,a2,a3,a4,a5);}
+void m_glBlendEquation_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC,&FunctionTable::m_ptr_glBlendEquation>(a0);}
+void m_glUnlockArraysEXT_record()const{this->template m_record<FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC,&FunctionTable::m_ptr_glUnlockArraysEXT>();}
+void m_glGetQueryObjectui64vEXT_record(GLuint,GLenum,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectui64vEXT");return (void)0;}
+void m_glVertexAttribI4uivEXT_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4uivEXT>(a0,a1);}
+void m_glUniform1i64vNV_record(GLint a0,GLsizei a1,const GLint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC,&FunctionTable::m_ptr_glUniform1i64vNV>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glMultiTexCoord3dv_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC,&FunctionTable::m_ptr_glMultiTexCoord3dv>(a0,a1);}
+void m_glColor4sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4SVPROC,&FunctionTable::m_ptr_glColor4sv>(a0);}
+void m_glVertexStream4ivATI_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC,&FunctionTable::m_ptr_glVertexStream4ivATI>(a0,a1);}
+void m_glPopClientAttrib_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC,&FunctionTable::m_ptr_glPopClientAttrib>();}
+void m_glClearBufferData_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC,&FunctionTable::m_ptr_glClearBufferData>(a0,a1,a2,a3,a4);}
+void m_glGetProgramivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramivNV");return (void)0;}
+void m_glBeginTransformFeedback_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glBeginTransformFeedback>(a0);}
+void m_glFinishObjectAPPLE_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC,&FunctionTable::m_ptr_glFinishObjectAPPLE>(a0,a1);}
+void m_glGetMinmaxParameterivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmaxParameterivEXT");return (void)0;}
+void m_glColor3iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3IVPROC,&FunctionTable::m_ptr_glColor3iv>(a0);}
+void m_glVertexAttrib3sv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC,&FunctionTable::m_ptr_glVertexAttrib3sv>(a0,a1);}
+void m_glCompressedTexImage1D_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLint a4,GLsizei a5,const GLvoid* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC,&FunctionTable::m_ptr_glCompressedTexImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glDeleteTransformFeedbacks_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC,&FunctionTable::m_ptr_glDeleteTransformFeedbacks>(a0,a1);}
+void m_glGetVideoi64vNV_record(GLuint,GLenum,GLint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoi64vNV");return (void)0;}
+void m_glDrawRangeElementsBaseVertex_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3,GLenum a4,const void* a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC,&FunctionTable::m_ptr_glDrawRangeElementsBaseVertex>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glUniform4i64vARB_record(GLint a0,GLsizei a1,const GLint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC,&FunctionTable::m_ptr_glUniform4i64vARB>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glTextureStorage3DMultisampleEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTextureStorage3DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetTexParameterfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterfv");return (void)0;}
+void m_glProgramUniformui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC,&FunctionTable::m_ptr_glProgramUniformui64vNV>(a0,a1,a2,a3);}
+void m_glCompressedMultiTexImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glProgramUniform2ivEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC,&FunctionTable::m_ptr_glProgramUniform2ivEXT>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glPushGroupMarkerEXT_record(GLsizei a0,const GLchar* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC,&FunctionTable::m_ptr_glPushGroupMarkerEXT>(a0,a1);}
+void m_glVertexAttrib1dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC,&FunctionTable::m_ptr_glVertexAttrib1dv>(a0,a1);}
+void m_glMatrixLoadIdentityEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC,&FunctionTable::m_ptr_glMatrixLoadIdentityEXT>(a0);}
+void m_glMultTransposeMatrixxOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC,&FunctionTable::m_ptr_glMultTransposeMatrixxOES>(a0);}
+void m_glGetPixelMapxv_record(GLenum,GLint,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPixelMapxv");return (void)0;}
+void m_glFramebufferSampleLocationsfvARB_record(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC,&FunctionTable::m_ptr_glFramebufferSampleLocationsfvARB>(a0,a1,a2,a3);}
+void m_glGetLightiv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLightiv");return (void)0;}
+void m_glBlendFuncSeparatei_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC,&FunctionTable::m_ptr_glBlendFuncSeparatei>(a0,a1,a2,a3,a4);}
+GLboolean m_glAcquireKeyedMutexWin32EXT_record(GLuint,GLuint64,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glAcquireKeyedMutexWin32EXT");return (GLboolean)0;}
+void m_glGetBooleanIndexedvEXT_record(GLenum,GLuint,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBooleanIndexedvEXT");return (void)0;}
+void m_glGetProgramSubroutineParameteruivNV_record(GLenum,GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramSubroutineParameteruivNV");return (void)0;}
+void m_glUniform2ui_record(GLint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UIPROC,&FunctionTable::m_ptr_glUniform2ui>(a0,a1,a2);}
+void m_glApplyFramebufferAttachmentCMAAINTEL_record()const{this->template m_record<FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC,&FunctionTable::m_ptr_glApplyFramebufferAttachmentCMAAINTEL>();}
+void m_glWindowPos2fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC,&FunctionTable::m_ptr_glWindowPos2fv>(a0);}
+void m_glWaitVkSemaphoreNV_record(GLuint64 a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC,&FunctionTable::m_ptr_glWaitVkSemaphoreNV>(a0);}
+void m_glDisablei_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEIPROC,&FunctionTable::m_ptr_glDisablei>(a0,a1);}
+void m_glSelectPerfMonitorCountersAMD_record(GLuint a0,GLboolean a1,GLuint a2,GLint a3,GLuint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC,&FunctionTable::m_ptr_glSelectPerfMonitorCountersAMD>(a0,a1,a2,a3,a4);}
+void m_glGetVertexAttribLi64vNV_record(GLuint,GLenum,GLint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribLi64vNV");return (void)0;}
+void m_glBlendFuncSeparateiARB_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC,&FunctionTable::m_ptr_glBlendFuncSeparateiARB>(a0,a1,a2,a3,a4);}
+void m_glWeightuivARB_record(GLint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC,&FunctionTable::m_ptr_glWeightuivARB>(a0,a1);}
+void m_glWindowPos2iARB_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC,&FunctionTable::m_ptr_glWindowPos2iARB>(a0,a1);}
+void m_glGetProgramLocalParameterdvARB_record(GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramLocalParameterdvARB");return (void)0;}
+void m_glGetUniformui64vARB_record(GLuint,GLint,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformui64vARB");return (void)0;}
+void m_glSecondaryColor3us_record(GLushort a0,GLushort a1,GLushort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC,&FunctionTable::m_ptr_glSecondaryColor3us>(a0,a1,a2);}
+void m_glGetSynciv_record(GLsync,GLenum,GLsizei,GLsizei*,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSynciv");return (void)0;}
+void m_glMakeImageHandleResidentARB_record(GLuint64 a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC,&FunctionTable::m_ptr_glMakeImageHandleResidentARB>(a0,a1);}
+void m_glGetProgramNamedParameterfvNV_record(GLuint,GLsizei,const GLubyte*,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramNamedParameterfvNV");return (void)0;}
+void m_glTextureStorage3D_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC,&FunctionTable::m_ptr_glTextureStorage3D>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttrib4svNV_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC,&FunctionTable::m_ptr_glVertexAttrib4svNV>(a0,a1);}
+void m_glProgramUniform2i_record(GLuint a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC,&FunctionTable::m_ptr_glProgramUniform2i>(a0,a1,a2,a3);}
+void m_glListDrawCommandsStatesClientNV_record(GLuint a0,GLuint a1,const void** a2,const GLsizei* a3,const GLuint* a4,const GLuint* a5,GLuint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC,&FunctionTable::m_ptr_glListDrawCommandsStatesClientNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glProgramLocalParametersI4uivNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC,&FunctionTable::m_ptr_glProgramLocalParametersI4uivNV>(a0,a1,a2,a3);}
+void m_glBeginTransformFeedbackNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glBeginTransformFeedbackNV>(a0);}
+void m_glGetProgramBinary_record(GLuint,GLsizei,GLsizei*,GLenum*,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramBinary");return (void)0;}
+void m_glBinormal3iEXT_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC,&FunctionTable::m_ptr_glBinormal3iEXT>(a0,a1,a2);}
+void m_glEvalPoint1_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALPOINT1PROC,&FunctionTable::m_ptr_glEvalPoint1>(a0);}
+void m_glEvalPoint2_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALPOINT2PROC,&FunctionTable::m_ptr_glEvalPoint2>(a0,a1);}
+void m_glPauseTransformFeedback_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glPauseTransformFeedback>();}
+void m_glWindowPos2sMESA_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC,&FunctionTable::m_ptr_glWindowPos2sMESA>(a0,a1);}
+void m_glGlobalAlphaFactorbSUN_record(GLbyte a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactorbSUN>(a0);}
+void m_glCreateTransformFeedbacks_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateTransformFeedbacks");return (void)0;}
+void m_glTexturePageCommitmentEXT_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC,&FunctionTable::m_ptr_glTexturePageCommitmentEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glTransformFeedbackVaryingsNV_record(GLuint a0,GLsizei a1,const GLint* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC,&FunctionTable::m_ptr_glTransformFeedbackVaryingsNV>(a0,a1,a2,a3);}
+void m_glTexSubImage1D_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLenum a5,const GLvoid* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC,&FunctionTable::m_ptr_glTexSubImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glConvolutionParameterfvEXT_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glConvolutionParameterfvEXT>(a0,a1,a2);}
+void m_glBlitFramebufferEXT_record(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLint a7,GLbitfield a8,GLenum a9)const{this->template m_record<FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC,&FunctionTable::m_ptr_glBlitFramebufferEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glUniformMatrix4fvARB_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC,&FunctionTable::m_ptr_glUniformMatrix4fvARB>(a0,a1,a2,this->m_copy(a3,a1,4*4*sizeof(*a3)));}
+void m_glProgramEnvParameter4dvARB_record(GLenum a0,GLuint a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC,&FunctionTable::m_ptr_glProgramEnvParameter4dvARB>(a0,a1,a2);}
+void m_glTextureStorageMem2DEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLuint a5,GLuint64 a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC,&FunctionTable::m_ptr_glTextureStorageMem2DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glVertexAttribP3uiv_record(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC,&FunctionTable::m_ptr_glVertexAttribP3uiv>(a0,a1,a2,a3);}
+void m_glFogCoordFormatNV_record(GLenum a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC,&FunctionTable::m_ptr_glFogCoordFormatNV>(a0,a1);}
+void m_glGetMultiTexLevelParameterivEXT_record(GLenum,GLenum,GLint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMultiTexLevelParameterivEXT");return (void)0;}
+GLboolean m_glIsOcclusionQueryNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsOcclusionQueryNV");return (GLboolean)0;}
+void m_glCompressedTexImage2DARB_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLint a5,GLsizei a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC,&FunctionTable::m_ptr_glCompressedTexImage2DARB>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetProgramEnvParameterIuivNV_record(GLenum,GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramEnvParameterIuivNV");return (void)0;}
+void m_glVertexAttrib4sv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC,&FunctionTable::m_ptr_glVertexAttrib4sv>(a0,a1);}
+void m_glVertexAttrib4fvARB_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4fvARB>(a0,a1);}
+void m_glLoadName_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADNAMEPROC,&FunctionTable::m_ptr_glLoadName>(a0);}
+void m_glBindVertexShaderEXT_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC,&FunctionTable::m_ptr_glBindVertexShaderEXT>(a0);}
+void m_glGetNamedProgramLocalParameterIivEXT_record(GLuint,GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramLocalParameterIivEXT");return (void)0;}
+void m_glProgramUniform3uiEXT_record(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC,&FunctionTable::m_ptr_glProgramUniform3uiEXT>(a0,a1,a2,a3,a4);}
+void m_glProgramUniformMatrix4x2dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x2dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*2*sizeof(*a4)));}
+void m_glTexCoord1hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC,&FunctionTable::m_ptr_glTexCoord1hvNV>(a0);}
+void m_glLoadMatrixd_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADMATRIXDPROC,&FunctionTable::m_ptr_glLoadMatrixd>(a0);}
+void m_glTexParameterfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC,&FunctionTable::m_ptr_glTexParameterfv>(a0,a1,a2);}
+void m_glVariantdvEXT_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC,&FunctionTable::m_ptr_glVariantdvEXT>(a0,a1);}
+void m_glCullParameterfvEXT_record(GLenum a0,GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glCullParameterfvEXT>(a0,a1);}
+void m_glUniform3dv_record(GLint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3DVPROC,&FunctionTable::m_ptr_glUniform3dv>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glProgramUniform3fv_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC,&FunctionTable::m_ptr_glProgramUniform3fv>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+GLboolean m_glIsBufferARB_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsBufferARB");return (GLboolean)0;}
+void m_glMultiTexCoord1bOES_record(GLenum a0,GLbyte a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC,&FunctionTable::m_ptr_glMultiTexCoord1bOES>(a0,a1);}
+void m_glFogCoordhNV_record(GLhalfNV a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC,&FunctionTable::m_ptr_glFogCoordhNV>(a0);}
+void m_glFramebufferSampleLocationsfvNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC,&FunctionTable::m_ptr_glFramebufferSampleLocationsfvNV>(a0,a1,a2,a3);}
+GLuint m_glGenSymbolsEXT_record(GLenum,GLenum,GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGenSymbolsEXT");return (GLuint)0;}
+void m_glGetConvolutionFilter_record(GLenum,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionFilter");return (void)0;}
+void m_glProgramUniform1fvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC,&FunctionTable::m_ptr_glProgramUniform1fvEXT>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glGetNextPerfQueryIdINTEL_record(GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNextPerfQueryIdINTEL");return (void)0;}
+void m_glCompressedTexImage1DARB_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLint a4,GLsizei a5,const void* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC,&FunctionTable::m_ptr_glCompressedTexImage1DARB>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glBindSamplers_record(GLuint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC,&FunctionTable::m_ptr_glBindSamplers>(a0,a1,a2);}
+void m_glGetProgramEnvParameterIivNV_record(GLenum,GLuint,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramEnvParameterIivNV");return (void)0;}
+void m_glGetQueryObjectui64v_record(GLuint,GLenum,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectui64v");return (void)0;}
+void m_glVertexAttribL4ui64vNV_record(GLuint a0,const GLuint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC,&FunctionTable::m_ptr_glVertexAttribL4ui64vNV>(a0,a1);}
+void m_glGetVideoivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoivNV");return (void)0;}
+void m_glGetTextureImage_record(GLuint,GLint,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureImage");return (void)0;}
+void m_glProgramUniform1fv_record(GLuint a0,GLint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC,&FunctionTable::m_ptr_glProgramUniform1fv>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glUniformMatrix4fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC,&FunctionTable::m_ptr_glUniformMatrix4fv>(a0,a1,a2,this->m_copy(a3,a1,4*4*sizeof(*a3)));}
+void m_glColorMask_record(GLboolean a0,GLboolean a1,GLboolean a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORMASKPROC,&FunctionTable::m_ptr_glColorMask>(a0,a1,a2,a3);}
+void m_glBeginFragmentShaderATI_record()const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC,&FunctionTable::m_ptr_glBeginFragmentShaderATI>();}
+void m_glMultiDrawArraysEXT_record(GLenum a0,const GLint* a1,const GLsizei* a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC,&FunctionTable::m_ptr_glMultiDrawArraysEXT>(a0,a1,a2,a3);}
+void m_glGenNamesAMD_record(GLenum,GLuint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenNamesAMD");return (void)0;}
+void m_glPathParameteriNV_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC,&FunctionTable::m_ptr_glPathParameteriNV>(a0,a1,a2);}
+void m_glCreateCommandListsNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateCommandListsNV");return (void)0;}
+void m_glDeleteProgramPipelines_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC,&FunctionTable::m_ptr_glDeleteProgramPipelines>(a0,a1);}
+void m_glCopyColorSubTableEXT_record(GLenum a0,GLsizei a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC,&FunctionTable::m_ptr_glCopyColorSubTableEXT>(a0,a1,a2,a3,a4);}
+void m_glVariantsvEXT_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC,&FunctionTable::m_ptr_glVariantsvEXT>(a0,a1);}
+void m_glGenProgramPipelines_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenProgramPipelines");return (void)0;}
+void m_glVertexArrayEdgeFlagOffsetEXT_record(GLuint a0,GLuint a1,GLsizei a2,GLintptr a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArrayEdgeFlagOffsetEXT>(a0,a1,a2,a3);}
+void m_glWindowPos2s_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC,&FunctionTable::m_ptr_glWindowPos2s>(a0,a1);}
+void m_glSecondaryColor3iEXT_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3iEXT>(a0,a1,a2);}
+void m_glWindowPos2i_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC,&FunctionTable::m_ptr_glWindowPos2i>(a0,a1);}
+void m_glWindowPos2f_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC,&FunctionTable::m_ptr_glWindowPos2f>(a0,a1);}
+void m_glWindowPos2d_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC,&FunctionTable::m_ptr_glWindowPos2d>(a0,a1);}
+void m_glUniform4uivEXT_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC,&FunctionTable::m_ptr_glUniform4uivEXT>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glOrthoxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3,GLfixed a4,GLfixed a5)const{this->template m_record<FunctionTable::MEMBERPFNGLORTHOXOESPROC,&FunctionTable::m_ptr_glOrthoxOES>(a0,a1,a2,a3,a4,a5);}
+void m_glUniformSubroutinesuiv_record(GLenum a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC,&FunctionTable::m_ptr_glUniformSubroutinesuiv>(a0,a1,a2);}
+void m_glRectdv_record(const GLdouble* a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRECTDVPROC,&FunctionTable::m_ptr_glRectdv>(a0,a1);}
+void m_glProgramUniform1i64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC,&FunctionTable::m_ptr_glProgramUniform1i64vNV>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glVertexAttribI4uiEXT_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4uiEXT>(a0,a1,a2,a3,a4);}
+void m_glSecondaryColor3ubEXT_record(GLubyte a0,GLubyte a1,GLubyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3ubEXT>(a0,a1,a2);}
+void m_glCompressedMultiTexSubImage1DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLsizei a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glMultiTexGendEXT_record(GLenum a0,GLenum a1,GLenum a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC,&FunctionTable::m_ptr_glMultiTexGendEXT>(a0,a1,a2,a3);}
+void m_glColorP3uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORP3UIVPROC,&FunctionTable::m_ptr_glColorP3uiv>(a0,a1);}
+void m_glFogCoordfv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDFVPROC,&FunctionTable::m_ptr_glFogCoordfv>(a0);}
+void m_glCompileShader_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPILESHADERPROC,&FunctionTable::m_ptr_glCompileShader>(a0);}
+void m_glTexCoord2hNV_record(GLhalfNV a0,GLhalfNV a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC,&FunctionTable::m_ptr_glTexCoord2hNV>(a0,a1);}
+void m_glUniform1uivEXT_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC,&FunctionTable::m_ptr_glUniform1uivEXT>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glMatrixLoadTransposedEXT_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC,&FunctionTable::m_ptr_glMatrixLoadTransposedEXT>(a0,a1);}
+void m_glIndexfv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXFVPROC,&FunctionTable::m_ptr_glIndexfv>(a0);}
+void m_glGetCompressedTextureImage_record(GLuint,GLint,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedTextureImage");return (void)0;}
+void m_glGetUniformuivEXT_record(GLuint,GLint,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformuivEXT");return (void)0;}
+void m_glGetnPixelMapfvARB_record(GLenum,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapfvARB");return (void)0;}
+void m_glFramebufferTextureEXT_record(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC,&FunctionTable::m_ptr_glFramebufferTextureEXT>(a0,a1,a2,a3);}
+void m_glMultiDrawElementsIndirectCount_record(GLenum a0,GLenum a1,const void* a2,GLintptr a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirectCount>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttribIPointer_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC,&FunctionTable::m_ptr_glVertexAttribIPointer>(a0,a1,a2,a3,a4);}
+void m_glMultiTexCoordP3ui_record(GLenum a0,GLenum a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC,&FunctionTable::m_ptr_glMultiTexCoordP3ui>(a0,a1,a2);}
+void m_glEvaluateDepthValuesARB_record()const{this->template m_record<FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC,&FunctionTable::m_ptr_glEvaluateDepthValuesARB>();}
+void m_glGetNamedBufferParameteriv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferParameteriv");return (void)0;}
+void m_glGetNamedProgramLocalParameterfvEXT_record(GLuint,GLenum,GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramLocalParameterfvEXT");return (void)0;}
+void m_glColor4fNormal3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glColor4fNormal3fVertex3fvSUN>(a0,a1,a2);}
+void m_glSeparableFilter2DEXT_record(GLenum a0,GLenum a1,GLsizei a2,GLsizei a3,GLenum a4,GLenum a5,const void* a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC,&FunctionTable::m_ptr_glSeparableFilter2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glTexParameterxOES_record(GLenum a0,GLenum a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC,&FunctionTable::m_ptr_glTexParameterxOES>(a0,a1,a2);}
+void m_glClearAccumxOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC,&FunctionTable::m_ptr_glClearAccumxOES>(a0,a1,a2,a3);}
+void m_glInvalidateFramebuffer_record(GLenum a0,GLsizei a1,const GLenum* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC,&FunctionTable::m_ptr_glInvalidateFramebuffer>(a0,a1,a2);}
+void m_glWeightubvARB_record(GLint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC,&FunctionTable::m_ptr_glWeightubvARB>(a0,a1);}
+void m_glVertexAttrib1d_record(GLuint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC,&FunctionTable::m_ptr_glVertexAttrib1d>(a0,a1);}
+void m_glVertexAttrib1f_record(GLuint a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC,&FunctionTable::m_ptr_glVertexAttrib1f>(a0,a1);}
+void m_glVertex4fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4FVPROC,&FunctionTable::m_ptr_glVertex4fv>(a0);}
+void m_glClearNamedFramebufferfi_record(GLuint a0,GLenum a1,GLint a2,GLfloat a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC,&FunctionTable::m_ptr_glClearNamedFramebufferfi>(a0,a1,a2,a3,a4);}
+void m_glGetQueryBufferObjectuiv_record(GLuint,GLuint,GLenum,GLintptr)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryBufferObjectuiv");return (void)0;}
+void m_glClearNamedFramebufferfv_record(GLuint a0,GLenum a1,GLint a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC,&FunctionTable::m_ptr_glClearNamedFramebufferfv>(a0,a1,a2,a3);}
+void m_glEndVertexShaderEXT_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC,&FunctionTable::m_ptr_glEndVertexShaderEXT>();}
+void m_glVertexAttrib1s_record(GLuint a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC,&FunctionTable::m_ptr_glVertexAttrib1s>(a0,a1);}
+void m_glMultiTexCoord4dvARB_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4dvARB>(a0,a1);}
+void m_glMultiTexCoord1sv_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC,&FunctionTable::m_ptr_glMultiTexCoord1sv>(a0,a1);}
+void m_glUniform1ui64vNV_record(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC,&FunctionTable::m_ptr_glUniform1ui64vNV>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glGetClipPlanefOES_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetClipPlanefOES");return (void)0;}
+void m_glRasterPos2s_record(GLshort a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2SPROC,&FunctionTable::m_ptr_glRasterPos2s>(a0,a1);}
+void m_glWeightivARB_record(GLint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC,&FunctionTable::m_ptr_glWeightivARB>(a0,a1);}
+void m_glMultiTexCoord4hvNV_record(GLenum a0,const GLhalfNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC,&FunctionTable::m_ptr_glMultiTexCoord4hvNV>(a0,a1);}
+void m_glNormal3hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3HNVPROC,&FunctionTable::m_ptr_glNormal3hNV>(a0,a1,a2);}
+void m_glGetSeparableFilter_record(GLenum,GLenum,GLenum,GLvoid*,GLvoid*,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSeparableFilter");return (void)0;}
+void m_glGetPathTexGenivNV_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathTexGenivNV");return (void)0;}
+void m_glColor4bv_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4BVPROC,&FunctionTable::m_ptr_glColor4bv>(a0);}
+void m_glRasterPos2f_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2FPROC,&FunctionTable::m_ptr_glRasterPos2f>(a0,a1);}
+void m_glNamedBufferPageCommitmentARB_record(GLuint a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC,&FunctionTable::m_ptr_glNamedBufferPageCommitmentARB>(a0,a1,a2,a3);}
+void m_glLoadIdentity_record()const{this->template m_record<FunctionTable::MEMBERPFNGLLOADIDENTITYPROC,&FunctionTable::m_ptr_glLoadIdentity>();}
+void m_glRasterPos2i_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS2IPROC,&FunctionTable::m_ptr_glRasterPos2i>(a0,a1);}
+void m_glRasterPos4iv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC,&FunctionTable::m_ptr_glRasterPos4iv>(a0);}
+void m_glMultiTexCoord2fvARB_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2fvARB>(a0,a1);}
+void m_glUniformMatrix4x3fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC,&FunctionTable::m_ptr_glUniformMatrix4x3fv>(a0,a1,a2,this->m_copy(a3,a1,4*3*sizeof(*a3)));}
+void m_glClearBufferfv_record(GLenum a0,GLint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC,&FunctionTable::m_ptr_glClearBufferfv>(a0,a1,a2);}
+void m_glMultiTexCoord4hNV_record(GLenum a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3,GLhalfNV a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC,&FunctionTable::m_ptr_glMultiTexCoord4hNV>(a0,a1,a2,a3,a4);}
+void m_glTextureBarrier_record()const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC,&FunctionTable::m_ptr_glTextureBarrier>();}
+void m_glReplacementCodeuivSUN_record(const GLuint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuivSUN>(a0);}
+void m_glDeleteAsyncMarkersSGIX_record(GLuint a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC,&FunctionTable::m_ptr_glDeleteAsyncMarkersSGIX>(a0,a1);}
+void m_glTexCoord2bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC,&FunctionTable::m_ptr_glTexCoord2bvOES>(a0);}
+void m_glEvalCoord2xOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC,&FunctionTable::m_ptr_glEvalCoord2xOES>(a0,a1);}
+void m_glGetSharpenTexFuncSGIS_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSharpenTexFuncSGIS");return (void)0;}
+void m_glProgramUniformHandleui64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC,&FunctionTable::m_ptr_glProgramUniformHandleui64vNV>(a0,a1,a2,a3);}
+void m_glIglooInterfaceSGIX_record(GLenum a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC,&FunctionTable::m_ptr_glIglooInterfaceSGIX>(a0,a1);}
+void m_glWindowPos2dvARB_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC,&FunctionTable::m_ptr_glWindowPos2dvARB>(a0);}
+void m_glClearBufferfi_record(GLenum a0,GLint a1,GLfloat a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC,&FunctionTable::m_ptr_glClearBufferfi>(a0,a1,a2,a3);}
+void m_glDrawArraysIndirect_record(GLenum a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC,&FunctionTable::m_ptr_glDrawArraysIndirect>(a0,a1);}
+void m_glGenVertexArrays_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenVertexArrays");return (void)0;}
+void m_glGetTransformFeedbacki64_v_record(GLuint,GLenum,GLuint,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbacki64_v");return (void)0;}
+void m_glEnableVertexArrayAttrib_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC,&FunctionTable::m_ptr_glEnableVertexArrayAttrib>(a0,a1);}
+void m_glProgramUniformMatrix3x2dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x2dv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*2*sizeof(*a4)));}
+void m_glVertexStream4fATI_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC,&FunctionTable::m_ptr_glVertexStream4fATI>(a0,a1,a2,a3,a4);}
+void m_glVertexBindingDivisor_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC,&FunctionTable::m_ptr_glVertexBindingDivisor>(a0,a1);}
+void m_glGetSamplerParameterIiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSamplerParameterIiv");return (void)0;}
+void m_glGetCoverageModulationTableNV_record(GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCoverageModulationTableNV");return (void)0;}
+void m_glDepthRangedNV_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC,&FunctionTable::m_ptr_glDepthRangedNV>(a0,a1);}
+void m_glVertexAttrib3f_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC,&FunctionTable::m_ptr_glVertexAttrib3f>(a0,a1,a2,a3);}
+void m_glMultiDrawRangeElementArrayAPPLE_record(GLenum a0,GLuint a1,GLuint a2,const GLint* a3,const GLsizei* a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC,&FunctionTable::m_ptr_glMultiDrawRangeElementArrayAPPLE>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexAttribFormatNV_record(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC,&FunctionTable::m_ptr_glVertexAttribFormatNV>(a0,a1,a2,a3,a4);}
+void m_glGetQueryBufferObjecti64v_record(GLuint,GLuint,GLenum,GLintptr)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryBufferObjecti64v");return (void)0;}
+void m_glGetVertexAttribdv_record(GLuint,GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribdv");return (void)0;}
+void m_glGetUniformi64vARB_record(GLuint,GLint,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformi64vARB");return (void)0;}
+GLboolean m_glAreTexturesResidentEXT_record(GLsizei,const GLuint*,GLboolean*)const{this->m_printUnrecordableFunctionErrorAndExit("glAreTexturesResidentEXT");return (GLboolean)0;}
+GLhandleARB m_glGetHandleARB_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHandleARB");return (GLhandleARB)0;}
+void m_glVideoCaptureStreamParameterdvNV_record(GLuint a0,GLuint a1,GLenum a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC,&FunctionTable::m_ptr_glVideoCaptureStreamParameterdvNV>(a0,a1,a2,a3);}
+void m_glMapParameterivNV_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC,&FunctionTable::m_ptr_glMapParameterivNV>(a0,a1,a2);}
+GLboolean m_glIsVertexArray_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsVertexArray");return (GLboolean)0;}
+void m_glSecondaryColor3sEXT_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3sEXT>(a0,a1,a2);}
+void m_glGetTexParameterIivEXT_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterIivEXT");return (void)0;}
+void m_glFrameTerminatorGREMEDY_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC,&FunctionTable::m_ptr_glFrameTerminatorGREMEDY>();}
+void m_glBlendBarrierKHR_record()const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC,&FunctionTable::m_ptr_glBlendBarrierKHR>();}
+void m_glVertexAttrib4NubARB_record(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NubARB>(a0,a1,a2,a3,a4);}
+void m_glPrimitiveRestartNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC,&FunctionTable::m_ptr_glPrimitiveRestartNV>();}
+void m_glVertexAttribL1ui64vARB_record(GLuint a0,const GLuint64EXT* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC,&FunctionTable::m_ptr_glVertexAttribL1ui64vARB>(a0,a1);}
+void m_glVertexAttribI4ivEXT_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4ivEXT>(a0,a1);}
+void m_glVertexAttribs4svNV_record(GLuint a0,GLsizei a1,const GLshort* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC,&FunctionTable::m_ptr_glVertexAttribs4svNV>(a0,a1,a2);}
+void m_glUniform1ui_record(GLint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UIPROC,&FunctionTable::m_ptr_glUniform1ui>(a0,a1);}
+void m_glVertexAttrib2fvARB_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC,&FunctionTable::m_ptr_glVertexAttrib2fvARB>(a0,a1);}
+void m_glVertexAttribI4svEXT_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4svEXT>(a0,a1);}
+void m_glTextureImage3DMultisampleCoverageNV_record(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLboolean a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC,&FunctionTable::m_ptr_glTextureImage3DMultisampleCoverageNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glMemoryBarrier_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC,&FunctionTable::m_ptr_glMemoryBarrier>(a0);}
+void m_glGetVariantArrayObjectfvATI_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantArrayObjectfvATI");return (void)0;}
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_record(const GLfloat* a0,const GLfloat* a1,const GLfloat* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC,&FunctionTable::m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN>(a0,a1,a2,a3);}
+GLboolean m_glIsProgramARB_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsProgramARB");return (GLboolean)0;}
+void m_glBindImageTextureEXT_record(GLuint a0,GLuint a1,GLint a2,GLboolean a3,GLint a4,GLenum a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC,&FunctionTable::m_ptr_glBindImageTextureEXT>(a0,a1,a2,a3,a4,a5,a6);}
+GLint m_glGetFragDataLocation_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragDataLocation");return (GLint)0;}
+void m_glMultiTexCoord1svARB_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1svARB>(a0,a1);}
+void m_glGetMapxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapxvOES");return (void)0;}
+void m_glTextureStorage2DMultisampleEXT_record(GLuint a0,GLenum a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTextureStorage2DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glGetMaterialfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMaterialfv");return (void)0;}
+void m_glVertexAttrib4NbvARB_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4NbvARB>(a0,a1);}
+void m_glPixelMapuiv_record(GLenum a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC,&FunctionTable::m_ptr_glPixelMapuiv>(a0,a1,a2);}
+void m_glColorPointerEXT_record(GLint a0,GLenum a1,GLsizei a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC,&FunctionTable::m_ptr_glColorPointerEXT>(a0,a1,a2,a3,a4);}
+void m_glEnableClientStateiEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC,&FunctionTable::m_ptr_glEnableClientStateiEXT>(a0,a1);}
+void m_glClearTexSubImage_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC,&FunctionTable::m_ptr_glClearTexSubImage>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glEvalCoord1xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC,&FunctionTable::m_ptr_glEvalCoord1xvOES>(a0);}
+void m_glDetachObjectARB_record(GLhandleARB a0,GLhandleARB a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC,&FunctionTable::m_ptr_glDetachObjectARB>(a0,a1);}
+void m_glGetTextureParameterIiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterIiv");return (void)0;}
+void m_glVariantusvEXT_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC,&FunctionTable::m_ptr_glVariantusvEXT>(a0,a1);}
+void m_glCompressedTextureImage3DEXT_record(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLsizei a6,GLint a7,GLsizei a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureImage3DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glMultiTexCoord1dARB_record(GLenum a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC,&FunctionTable::m_ptr_glMultiTexCoord1dARB>(a0,a1);}
+void m_glGetVertexArrayIntegeri_vEXT_record(GLuint,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayIntegeri_vEXT");return (void)0;}
+void m_glVertexAttribI4ubv_record(GLuint a0,const GLubyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC,&FunctionTable::m_ptr_glVertexAttribI4ubv>(a0,a1);}
+void m_glPixelTexGenParameterfSGIS_record(GLenum a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC,&FunctionTable::m_ptr_glPixelTexGenParameterfSGIS>(a0,a1);}
+void m_glProgramUniformMatrix4x2dv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x2dv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*2*sizeof(*a4)));}
+void m_glUniform3fARB_record(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC,&FunctionTable::m_ptr_glUniform3fARB>(a0,a1,a2,a3);}
+GLboolean m_glIsShader_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsShader");return (GLboolean)0;}
+void m_glConvolutionParameteriv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC,&FunctionTable::m_ptr_glConvolutionParameteriv>(a0,a1,a2);}
+void m_glCopyMultiTexSubImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyMultiTexSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glEnableVertexAttribArrayARB_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC,&FunctionTable::m_ptr_glEnableVertexAttribArrayARB>(a0);}
+void m_glMulticastCopyBufferSubDataNV_record(GLuint a0,GLbitfield a1,GLuint a2,GLuint a3,GLintptr a4,GLintptr a5,GLsizeiptr a6)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC,&FunctionTable::m_ptr_glMulticastCopyBufferSubDataNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glEnable_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEPROC,&FunctionTable::m_ptr_glEnable>(a0);}
+void m_glGetActiveUniformsiv_record(GLuint,GLsizei,const GLuint*,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniformsiv");return (void)0;}
+void m_glGetVertexAttribivARB_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribivARB");return (void)0;}
+void m_glTexCoord4hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC,&FunctionTable::m_ptr_glTexCoord4hvNV>(a0);}
+void m_glUseProgramObjectARB_record(GLhandleARB a0)const{this->template m_record<FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC,&FunctionTable::m_ptr_glUseProgramObjectARB>(a0);}
+GLint m_glGetAttribLocation_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetAttribLocation");return (GLint)0;}
+void m_glVertexAttrib4dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC,&FunctionTable::m_ptr_glVertexAttrib4dv>(a0,a1);}
+void m_glGetTextureParameteriv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameteriv");return (void)0;}
+void m_glNamedBufferStorageMemEXT_record(GLuint a0,GLsizeiptr a1,GLuint a2,GLuint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC,&FunctionTable::m_ptr_glNamedBufferStorageMemEXT>(a0,a1,a2,a3);}
+void m_glPathSubCoordsNV_record(GLuint a0,GLsizei a1,GLsizei a2,GLenum a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC,&FunctionTable::m_ptr_glPathSubCoordsNV>(a0,a1,a2,a3,a4);}
+void m_glMatrixIndexusvARB_record(GLint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC,&FunctionTable::m_ptr_glMatrixIndexusvARB>(a0,a1);}
+void m_glGetVideouivNV_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideouivNV");return (void)0;}
+void m_glGetVideoCaptureivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoCaptureivNV");return (void)0;}
+void m_glProgramUniform3ui_record(GLuint a0,GLint a1,GLuint a2,GLuint a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC,&FunctionTable::m_ptr_glProgramUniform3ui>(a0,a1,a2,a3,a4);}
+void m_glVertexAttrib3svARB_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC,&FunctionTable::m_ptr_glVertexAttrib3svARB>(a0,a1);}
+void m_glGetNamedBufferParameterivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferParameterivEXT");return (void)0;}
+void m_glMatrixScaledEXT_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC,&FunctionTable::m_ptr_glMatrixScaledEXT>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix2x3fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x3fv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*3*sizeof(*a4)));}
+void m_glGetFragmentLightivSGIX_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragmentLightivSGIX");return (void)0;}
+const GLubyte* m_glGetStringi_record(GLenum,GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetStringi");return (const GLubyte*)0;}
+void m_glWindowPos2svARB_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC,&FunctionTable::m_ptr_glWindowPos2svARB>(a0);}
+void m_glVertexAttrib2svNV_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC,&FunctionTable::m_ptr_glVertexAttrib2svNV>(a0,a1);}
+void m_glWindowPos2ivARB_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC,&FunctionTable::m_ptr_glWindowPos2ivARB>(a0);}
+void m_glGetVertexAttribPointervNV_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribPointervNV");return (void)0;}
+void m_glPushMatrix_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHMATRIXPROC,&FunctionTable::m_ptr_glPushMatrix>();}
+void m_glEdgeFlagPointerListIBM_record(GLint a0,const GLboolean** a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glEdgeFlagPointerListIBM>(a0,a1,a2);}
+void m_glGenerateMipmapEXT_record(GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGenerateMipmapEXT");return (void)0;}
+void m_glWindowPos3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC,&FunctionTable::m_ptr_glWindowPos3sv>(a0);}
+void m_glPathCoordsNV_record(GLuint a0,GLsizei a1,GLenum a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC,&FunctionTable::m_ptr_glPathCoordsNV>(a0,a1,a2,a3);}
+void m_glProgramUniform1i_record(GLuint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC,&FunctionTable::m_ptr_glProgramUniform1i>(a0,a1,a2);}
+void m_glProgramUniform1d_record(GLuint a0,GLint a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC,&FunctionTable::m_ptr_glProgramUniform1d>(a0,a1,a2);}
+void m_glProgramUniform1f_record(GLuint a0,GLint a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC,&FunctionTable::m_ptr_glProgramUniform1f>(a0,a1,a2);}
+void m_glProgramParameteriEXT_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC,&FunctionTable::m_ptr_glProgramParameteriEXT>(a0,a1,a2);}
+void m_glCompressedMultiTexImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glProgramUniform3iv_record(GLuint a0,GLint a1,GLsizei a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC,&FunctionTable::m_ptr_glProgramUniform3iv>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glIndexiv_record(const GLint* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXIVPROC,&FunctionTable::m_ptr_glIndexiv>(a0);}
+void m_glMultiTexCoord4xvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord4xvOES>(a0,a1);}
+void m_glEGLImageTargetTexture2DOES_record(GLenum a0,GLeglImageOES a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC,&FunctionTable::m_ptr_glEGLImageTargetTexture2DOES>(a0,a1);}
+void m_glPixelZoom_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELZOOMPROC,&FunctionTable::m_ptr_glPixelZoom>(a0,a1);}
+void m_glVertex3bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC,&FunctionTable::m_ptr_glVertex3bvOES>(a0);}
+void m_glFramebufferReadBufferEXT_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC,&FunctionTable::m_ptr_glFramebufferReadBufferEXT>(a0,a1);}
+void m_glExtractComponentEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC,&FunctionTable::m_ptr_glExtractComponentEXT>(a0,a1,a2);}
+void m_glCombinerParameterivNV_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC,&FunctionTable::m_ptr_glCombinerParameterivNV>(a0,a1);}
+void m_glMinmax_record(GLenum a0,GLenum a1,GLboolean a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMINMAXPROC,&FunctionTable::m_ptr_glMinmax>(a0,a1,a2);}
+void m_glColorP3ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORP3UIPROC,&FunctionTable::m_ptr_glColorP3ui>(a0,a1);}
+void m_glPointParameterfvSGIS_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC,&FunctionTable::m_ptr_glPointParameterfvSGIS>(a0,a1);}
+void m_glBlendEquationi_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC,&FunctionTable::m_ptr_glBlendEquationi>(a0,a1);}
+void m_glGetFogFuncSGIS_record(GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFogFuncSGIS");return (void)0;}
+void m_glVertexAttrib4fvNV_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC,&FunctionTable::m_ptr_glVertexAttrib4fvNV>(a0,a1);}
+void m_glGetnMinmax_record(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMinmax");return (void)0;}
+void m_glFragmentLightiSGIX_record(GLenum a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC,&FunctionTable::m_ptr_glFragmentLightiSGIX>(a0,a1,a2);}
+void m_glMultiTexCoord1bvOES_record(GLenum a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord1bvOES>(a0,a1);}
+void m_glSecondaryColorPointerEXT_record(GLint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC,&FunctionTable::m_ptr_glSecondaryColorPointerEXT>(a0,a1,a2,a3);}
+void m_glMultiTexCoordP4uiv_record(GLenum a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC,&FunctionTable::m_ptr_glMultiTexCoordP4uiv>(a0,a1,a2);}
+void m_glGetBufferSubDataARB_record(GLenum,GLintptrARB,GLsizeiptrARB,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferSubDataARB");return (void)0;}
+void m_glSecondaryColor3hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC,&FunctionTable::m_ptr_glSecondaryColor3hNV>(a0,a1,a2);}
+void m_glGetPathParameterivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathParameterivNV");return (void)0;}
+void m_glFlushRasterSGIX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC,&FunctionTable::m_ptr_glFlushRasterSGIX>();}
+void m_glElementPointerATI_record(GLenum a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC,&FunctionTable::m_ptr_glElementPointerATI>(a0,a1);}
+void m_glGetAttachedObjectsARB_record(GLhandleARB,GLsizei,GLsizei*,GLhandleARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetAttachedObjectsARB");return (void)0;}
+void m_glUniform4iv_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4IVPROC,&FunctionTable::m_ptr_glUniform4iv>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glFogxOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGXOESPROC,&FunctionTable::m_ptr_glFogxOES>(a0,a1);}
+void m_glSharpenTexFuncSGIS_record(GLenum a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC,&FunctionTable::m_ptr_glSharpenTexFuncSGIS>(a0,a1,a2);}
+void m_glClearDepthfOES_record(GLclampf a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC,&FunctionTable::m_ptr_glClearDepthfOES>(a0);}
+void m_glDeleteCommandListsNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC,&FunctionTable::m_ptr_glDeleteCommandListsNV>(a0,a1);}
+void m_glSpecializeShader_record(GLuint a0,const GLchar* a1,GLuint a2,const GLuint* a3,const GLuint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC,&FunctionTable::m_ptr_glSpecializeShader>(a0,a1,a2,a3,a4);}
+void m_glVertex4hNV_record(GLhalfNV a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4HNVPROC,&FunctionTable::m_ptr_glVertex4hNV>(a0,a1,a2,a3);}
+void m_glSecondaryColor3dvEXT_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3dvEXT>(a0);}
+void m_glGenTextures_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenTextures");return (void)0;}
+void m_glTextureStorage2DMultisample_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTextureStorage2DMultisample>(a0,a1,a2,a3,a4,a5);}
+void m_glUniform3ui64vNV_record(GLint a0,GLsizei a1,const GLuint64EXT* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC,&FunctionTable::m_ptr_glUniform3ui64vNV>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glBlendFuncSeparateIndexedAMD_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC,&FunctionTable::m_ptr_glBlendFuncSeparateIndexedAMD>(a0,a1,a2,a3,a4);}
+void m_glMakeBufferResidentNV_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC,&FunctionTable::m_ptr_glMakeBufferResidentNV>(a0,a1);}
+void m_glShaderOp2EXT_record(GLenum a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC,&FunctionTable::m_ptr_glShaderOp2EXT>(a0,a1,a2,a3);}
+void m_glGetVertexAttribivNV_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribivNV");return (void)0;}
+void m_glTexParameterIivEXT_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC,&FunctionTable::m_ptr_glTexParameterIivEXT>(a0,a1,a2);}
+void m_glGetPerfQueryDataINTEL_record(GLuint,GLuint,GLsizei,void*,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfQueryDataINTEL");return (void)0;}
+void m_glVertexAttrib4dvARB_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4dvARB>(a0,a1);}
+void m_glTextureSubImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLenum a5,GLenum a6,const void* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glTextureSubImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetActiveUniformBlockName_record(GLuint,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveUniformBlockName");return (void)0;}
+void m_glVertexAttrib2dvARB_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC,&FunctionTable::m_ptr_glVertexAttrib2dvARB>(a0,a1);}
+void m_glVertexAttribPointer_record(GLuint a0,GLint a1,GLenum a2,GLboolean a3,GLsizei a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC,&FunctionTable::m_ptr_glVertexAttribPointer>(a0,a1,a2,a3,a4,a5);}
+void m_glDepthBoundsdNV_record(GLdouble a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC,&FunctionTable::m_ptr_glDepthBoundsdNV>(a0,a1);}
+void m_glDeleteTexturesEXT_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC,&FunctionTable::m_ptr_glDeleteTexturesEXT>(a0,a1);}
+void m_glDrawBuffersATI_record(GLsizei a0,const GLenum* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC,&FunctionTable::m_ptr_glDrawBuffersATI>(a0,a1);}
+void m_glLightModelxvOES_record(GLenum a0,const GLfixed* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC,&FunctionTable::m_ptr_glLightModelxvOES>(a0,a1);}
+void m_glApplyTextureEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC,&FunctionTable::m_ptr_glApplyTextureEXT>(a0);}
+GLuint64 m_glGetImageHandleNV_record(GLuint,GLint,GLboolean,GLint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGetImageHandleNV");return (GLuint64)0;}
+void m_glGetMinmax_record(GLenum,GLboolean,GLenum,GLenum,GLvoid*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMinmax");return (void)0;}
+void m_glGetFixedvOES_record(GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFixedvOES");return (void)0;}
+void m_glSamplePatternEXT_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC,&FunctionTable::m_ptr_glSamplePatternEXT>(a0);}
+void m_glUniform1f_record(GLint a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1FPROC,&FunctionTable::m_ptr_glUniform1f>(a0,a1);}
+void m_glColor4fNormal3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glColor4fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glFogCoorddvEXT_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC,&FunctionTable::m_ptr_glFogCoorddvEXT>(a0);}
+void m_glCopyTextureImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLint a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyTextureImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glFlushMappedBufferRangeAPPLE_record(GLenum a0,GLintptr a1,GLsizeiptr a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC,&FunctionTable::m_ptr_glFlushMappedBufferRangeAPPLE>(a0,a1,a2);}
+void m_glVertex3sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX3SVPROC,&FunctionTable::m_ptr_glVertex3sv>(a0);}
+void m_glFlushStaticDataIBM_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC,&FunctionTable::m_ptr_glFlushStaticDataIBM>(a0);}
+void m_glProgramUniform4ui64NV_record(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4,GLuint64EXT a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC,&FunctionTable::m_ptr_glProgramUniform4ui64NV>(a0,a1,a2,a3,a4,a5);}
+void m_glRasterPos4xOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC,&FunctionTable::m_ptr_glRasterPos4xOES>(a0,a1,a2,a3);}
+void m_glVertexAttribP1ui_record(GLuint a0,GLenum a1,GLboolean a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC,&FunctionTable::m_ptr_glVertexAttribP1ui>(a0,a1,a2,a3);}
+void m_glProgramUniform4dvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC,&FunctionTable::m_ptr_glProgramUniform4dvEXT>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glEndTransformFeedbackEXT_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC,&FunctionTable::m_ptr_glEndTransformFeedbackEXT>();}
+void m_glBinormal3dEXT_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC,&FunctionTable::m_ptr_glBinormal3dEXT>(a0,a1,a2);}
+void m_glGetTextureSubImage_record(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureSubImage");return (void)0;}
+void m_glGetNamedRenderbufferParameteriv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedRenderbufferParameteriv");return (void)0;}
+void m_glBindBuffersRange_record(GLenum a0,GLuint a1,GLsizei a2,const GLuint* a3,const GLintptr* a4,const GLsizeiptr* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC,&FunctionTable::m_ptr_glBindBuffersRange>(a0,a1,a2,a3,a4,a5);}
+GLint m_glFinishAsyncSGIX_record(GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glFinishAsyncSGIX");return (GLint)0;}
+void m_glBindFragDataLocationIndexed_record(GLuint a0,GLuint a1,GLuint a2,const GLchar* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC,&FunctionTable::m_ptr_glBindFragDataLocationIndexed>(a0,a1,a2,a3);}
+void m_glMultiTexCoord2dv_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC,&FunctionTable::m_ptr_glMultiTexCoord2dv>(a0,a1);}
+void m_glUniform2iv_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2IVPROC,&FunctionTable::m_ptr_glUniform2iv>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glProgramUniform2i64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC,&FunctionTable::m_ptr_glProgramUniform2i64vNV>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glFlushVertexArrayRangeAPPLE_record(GLsizei a0,void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC,&FunctionTable::m_ptr_glFlushVertexArrayRangeAPPLE>(a0,a1);}
+void m_glTextureParameterf_record(GLuint a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC,&FunctionTable::m_ptr_glTextureParameterf>(a0,a1,a2);}
+void m_glMultiTexCoord3dvARB_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord3dvARB>(a0,a1);}
+void m_glFeedbackBuffer_record(GLsizei a0,GLenum a1,GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC,&FunctionTable::m_ptr_glFeedbackBuffer>(a0,a1,a2);}
+void m_glDebugMessageInsertARB_record(GLenum a0,GLenum a1,GLuint a2,GLenum a3,GLsizei a4,const GLchar* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC,&FunctionTable::m_ptr_glDebugMessageInsertARB>(a0,a1,a2,a3,a4,a5);}
+void m_glMultiTexCoord2i_record(GLenum a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC,&FunctionTable::m_ptr_glMultiTexCoord2i>(a0,a1,a2);}
+void m_glTextureSubImage3D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLenum a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC,&FunctionTable::m_ptr_glTextureSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glFramebufferTexture1D_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC,&FunctionTable::m_ptr_glFramebufferTexture1D>(a0,a1,a2,a3,a4);}
+void m_glGetShaderiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetShaderiv");return (void)0;}
+void m_glMultiTexCoord2d_record(GLenum a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC,&FunctionTable::m_ptr_glMultiTexCoord2d>(a0,a1,a2);}
+void m_glArrayObjectATI_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC,&FunctionTable::m_ptr_glArrayObjectATI>(a0,a1,a2,a3,a4,a5);}
+void m_glGetPointeri_vEXT_record(GLenum,GLuint,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPointeri_vEXT");return (void)0;}
+void m_glGetPerfMonitorCountersAMD_record(GLuint,GLint*,GLint*,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorCountersAMD");return (void)0;}
+void m_glNamedBufferStorage_record(GLuint a0,GLsizeiptr a1,const void* a2,GLbitfield a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC,&FunctionTable::m_ptr_glNamedBufferStorage>(a0,a1,a2,a3);}
+void m_glTexEnvxvOES_record(GLenum a0,GLenum a1,const GLfixed* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVXVOESPROC,&FunctionTable::m_ptr_glTexEnvxvOES>(a0,a1,a2);}
+void m_glProgramUniform2ui64NV_record(GLuint a0,GLint a1,GLuint64EXT a2,GLuint64EXT a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC,&FunctionTable::m_ptr_glProgramUniform2ui64NV>(a0,a1,a2,a3);}
+void m_glMultiTexCoord3bOES_record(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC,&FunctionTable::m_ptr_glMultiTexCoord3bOES>(a0,a1,a2,a3);}
+void m_glUniform1dv_record(GLint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1DVPROC,&FunctionTable::m_ptr_glUniform1dv>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glPixelTransferi_record(GLenum a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC,&FunctionTable::m_ptr_glPixelTransferi>(a0,a1);}
+void m_glSecondaryColor3usvEXT_record(const GLushort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3usvEXT>(a0);}
+void m_glProgramEnvParameterI4uivNV_record(GLenum a0,GLuint a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC,&FunctionTable::m_ptr_glProgramEnvParameterI4uivNV>(a0,a1,a2);}
+void m_glVertex2sv_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2SVPROC,&FunctionTable::m_ptr_glVertex2sv>(a0);}
+void m_glWindowPos4dMESA_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC,&FunctionTable::m_ptr_glWindowPos4dMESA>(a0,a1,a2,a3);}
+void m_glDebugMessageControlARB_record(GLenum a0,GLenum a1,GLenum a2,GLsizei a3,const GLuint* a4,GLboolean a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC,&FunctionTable::m_ptr_glDebugMessageControlARB>(a0,a1,a2,a3,a4,a5);}
+GLboolean m_glIsTextureEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTextureEXT");return (GLboolean)0;}
+void m_glFragmentMaterialivSGIX_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC,&FunctionTable::m_ptr_glFragmentMaterialivSGIX>(a0,a1,a2);}
+void m_glLinkProgramARB_record(GLhandleARB a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC,&FunctionTable::m_ptr_glLinkProgramARB>(a0);}
+void m_glFinishFenceAPPLE_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC,&FunctionTable::m_ptr_glFinishFenceAPPLE>(a0);}
+void m_glVertexArrayVertexAttribBindingEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribBindingEXT>(a0,a1,a2);}
+void m_glTexStorageMem3DMultisampleEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6,GLuint a7,GLuint64 a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTexStorageMem3DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glUniform1ui64vARB_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC,&FunctionTable::m_ptr_glUniform1ui64vARB>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glMultiTexCoord4fv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC,&FunctionTable::m_ptr_glMultiTexCoord4fv>(a0,a1);}
+void m_glMulticastFramebufferSampleLocationsfvNV_record(GLuint a0,GLuint a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC,&FunctionTable::m_ptr_glMulticastFramebufferSampleLocationsfvNV>(a0,a1,a2,a3,a4);}
+void m_glRasterPos3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3DPROC,&FunctionTable::m_ptr_glRasterPos3d>(a0,a1,a2);}
+GLint m_glPollAsyncSGIX_record(GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glPollAsyncSGIX");return (GLint)0;}
+void m_glRasterPos3f_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3FPROC,&FunctionTable::m_ptr_glRasterPos3f>(a0,a1,a2);}
+void m_glCompressedTexImage3D_record(GLenum a0,GLint a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLint a6,GLsizei a7,const GLvoid* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC,&FunctionTable::m_ptr_glCompressedTexImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glVariantivEXT_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC,&FunctionTable::m_ptr_glVariantivEXT>(a0,a1);}
+void m_glUnmapTexture2DINTEL_record(GLuint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC,&FunctionTable::m_ptr_glUnmapTexture2DINTEL>(a0,a1);}
+void m_glMulticastWaitSyncNV_record(GLuint a0,GLbitfield a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC,&FunctionTable::m_ptr_glMulticastWaitSyncNV>(a0,a1);}
+void m_glGetVertexAttribiv_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribiv");return (void)0;}
+void m_glGetPathCoordsNV_record(GLuint,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathCoordsNV");return (void)0;}
+void m_glColor4xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC,&FunctionTable::m_ptr_glColor4xvOES>(a0);}
+void m_glVertexAttrib3fv_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC,&FunctionTable::m_ptr_glVertexAttrib3fv>(a0,a1);}
+void m_glRasterPos3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS3SPROC,&FunctionTable::m_ptr_glRasterPos3s>(a0,a1,a2);}
+void m_glVertex4bOES_record(GLbyte a0,GLbyte a1,GLbyte a2,GLbyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4BOESPROC,&FunctionTable::m_ptr_glVertex4bOES>(a0,a1,a2,a3);}
+void m_glTransformFeedbackVaryingsEXT_record(GLuint a0,GLsizei a1,const GLchar*const* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC,&FunctionTable::m_ptr_glTransformFeedbackVaryingsEXT>(a0,a1,a2,a3);}
+void m_glCombinerOutputNV_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5,GLenum a6,GLboolean a7,GLboolean a8,GLboolean a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC,&FunctionTable::m_ptr_glCombinerOutputNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glWindowPos4sMESA_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC,&FunctionTable::m_ptr_glWindowPos4sMESA>(a0,a1,a2,a3);}
+void m_glVertexAttrib4svARB_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4svARB>(a0,a1);}
+GLboolean m_glIsList_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsList");return (GLboolean)0;}
+void m_glGetInfoLogARB_record(GLhandleARB,GLsizei,GLsizei*,GLcharARB*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetInfoLogARB");return (void)0;}
+void m_glUniformMatrix2fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC,&FunctionTable::m_ptr_glUniformMatrix2fv>(a0,a1,a2,this->m_copy(a3,a1,2*2*sizeof(*a3)));}
+void m_glVertexAttribs3dvNV_record(GLuint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC,&FunctionTable::m_ptr_glVertexAttribs3dvNV>(a0,a1,a2);}
+void m_glGlobalAlphaFactorsSUN_record(GLshort a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactorsSUN>(a0);}
+void m_glGetTrackMatrixivNV_record(GLenum,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTrackMatrixivNV");return (void)0;}
+void m_glTextureParameterfvEXT_record(GLuint a0,GLenum a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glTextureParameterfvEXT>(a0,a1,a2,a3);}
+GLboolean m_glIsNamedBufferResidentNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsNamedBufferResidentNV");return (GLboolean)0;}
+void m_glProgramUniform4ui64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLuint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC,&FunctionTable::m_ptr_glProgramUniform4ui64vARB>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glTbufferMask3DFX_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC,&FunctionTable::m_ptr_glTbufferMask3DFX>(a0);}
+void m_glCoverFillPathNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC,&FunctionTable::m_ptr_glCoverFillPathNV>(a0,a1);}
+void m_glVertexAttrib1fvARB_record(GLuint a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC,&FunctionTable::m_ptr_glVertexAttrib1fvARB>(a0,a1);}
+void m_glGenerateTextureMipmap_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glGenerateTextureMipmap");return (void)0;}
+void m_glNamedProgramLocalParameterI4uivEXT_record(GLuint a0,GLenum a1,GLuint a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameterI4uivEXT>(a0,a1,a2,a3);}
+void m_glMultiDrawElementsBaseVertex_record(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4,const GLint* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,&FunctionTable::m_ptr_glMultiDrawElementsBaseVertex>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramSubroutineParametersuivNV_record(GLenum a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC,&FunctionTable::m_ptr_glProgramSubroutineParametersuivNV>(a0,a1,a2);}
+void m_glProgramUniformMatrix2x4dvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLdouble* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2x4dvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,2*4*sizeof(*a4)));}
+void m_glRotatexOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLROTATEXOESPROC,&FunctionTable::m_ptr_glRotatexOES>(a0,a1,a2,a3);}
+void m_glMemoryBarrierEXT_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC,&FunctionTable::m_ptr_glMemoryBarrierEXT>(a0);}
+void m_glVertexAttrib3svNV_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC,&FunctionTable::m_ptr_glVertexAttrib3svNV>(a0,a1);}
+void m_glVertexStream3iATI_record(GLenum a0,GLint a1,GLint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC,&FunctionTable::m_ptr_glVertexStream3iATI>(a0,a1,a2,a3);}
+void m_glCompressedTexSubImage1D_record(GLenum a0,GLint a1,GLint a2,GLsizei a3,GLenum a4,GLsizei a5,const GLvoid* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC,&FunctionTable::m_ptr_glCompressedTexSubImage1D>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glSetFenceNV_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSETFENCENVPROC,&FunctionTable::m_ptr_glSetFenceNV>(a0,a1);}
+void m_glAttachObjectARB_record(GLhandleARB a0,GLhandleARB a1)const{this->template m_record<FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC,&FunctionTable::m_ptr_glAttachObjectARB>(a0,a1);}
+void m_glCopyConvolutionFilter1D_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC,&FunctionTable::m_ptr_glCopyConvolutionFilter1D>(a0,a1,a2,a3,a4);}
+void m_glTexStorageMem2DMultisampleEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5,GLuint a6,GLuint64 a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTexStorageMem2DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glProgramParameters4fvNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC,&FunctionTable::m_ptr_glProgramParameters4fvNV>(a0,a1,a2,a3);}
+void m_glNamedFramebufferParameteriEXT_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferParameteriEXT>(a0,a1,a2);}
+void m_glVertexAttrib4Nsv_record(GLuint a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC,&FunctionTable::m_ptr_glVertexAttrib4Nsv>(a0,a1);}
+void m_glVertexAttribI4usvEXT_record(GLuint a0,const GLushort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC,&FunctionTable::m_ptr_glVertexAttribI4usvEXT>(a0,a1);}
+void m_glTextureBufferRangeEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLintptr a4,GLsizeiptr a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC,&FunctionTable::m_ptr_glTextureBufferRangeEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexP3uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC,&FunctionTable::m_ptr_glVertexP3uiv>(a0,a1);}
+GLboolean m_glIsPathNV_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsPathNV");return (GLboolean)0;}
+void m_glGetnUniformi64vARB_record(GLuint,GLint,GLsizei,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnUniformi64vARB");return (void)0;}
+void m_glFramebufferTextureMultiviewOVR_record(GLenum a0,GLenum a1,GLuint a2,GLint a3,GLint a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC,&FunctionTable::m_ptr_glFramebufferTextureMultiviewOVR>(a0,a1,a2,a3,a4,a5);}
+void m_glCompressedMultiTexSubImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLsizei a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCompressedMultiTexSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glGetnMapdv_record(GLenum,GLenum,GLsizei,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnMapdv");return (void)0;}
+void m_glDebugMessageCallback_record(GLDEBUGPROC a0,const void* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC,&FunctionTable::m_ptr_glDebugMessageCallback>(a0,a1);}
+void m_glTangent3svEXT_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC,&FunctionTable::m_ptr_glTangent3svEXT>(a0);}
+void m_glVertexAttribParameteriAMD_record(GLuint a0,GLenum a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC,&FunctionTable::m_ptr_glVertexAttribParameteriAMD>(a0,a1,a2);}
+void m_glBufferSubDataARB_record(GLenum a0,GLintptrARB a1,GLsizeiptrARB a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC,&FunctionTable::m_ptr_glBufferSubDataARB>(a0,a1,a2,this->m_copy(a3,a2,1));}
+void m_glGetVertexAttribLui64vARB_record(GLuint,GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribLui64vARB");return (void)0;}
+void m_glVertexAttribL4ui64NV_record(GLuint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC,&FunctionTable::m_ptr_glVertexAttribL4ui64NV>(a0,a1,a2,a3,a4);}
+void m_glReplacementCodeuiColor4ubVertex3fSUN_record(GLuint a0,GLubyte a1,GLubyte a2,GLubyte a3,GLubyte a4,GLfloat a5,GLfloat a6,GLfloat a7)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiColor4ubVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glImageTransformParameterfHP_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC,&FunctionTable::m_ptr_glImageTransformParameterfHP>(a0,a1,a2);}
+void m_glMap1f_record(GLenum a0,GLfloat a1,GLfloat a2,GLint a3,GLint a4,const GLfloat* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP1FPROC,&FunctionTable::m_ptr_glMap1f>(a0,a1,a2,a3,a4,a5);}
+void m_glRasterPos4fv_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC,&FunctionTable::m_ptr_glRasterPos4fv>(a0);}
+void m_glVertex2bvOES_record(const GLbyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC,&FunctionTable::m_ptr_glVertex2bvOES>(a0);}
+void m_glGetMapControlPointsNV_record(GLenum,GLuint,GLenum,GLsizei,GLsizei,GLboolean,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMapControlPointsNV");return (void)0;}
+void m_glNamedProgramLocalParametersI4ivEXT_record(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParametersI4ivEXT>(a0,a1,a2,a3,a4);}
+void m_glBindBufferRangeNV_record(GLenum a0,GLuint a1,GLuint a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC,&FunctionTable::m_ptr_glBindBufferRangeNV>(a0,a1,a2,a3,a4);}
+void m_glVertexStream3dvATI_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC,&FunctionTable::m_ptr_glVertexStream3dvATI>(a0,a1);}
+void m_glNormalPointerListIBM_record(GLenum a0,GLint a1,const void** a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC,&FunctionTable::m_ptr_glNormalPointerListIBM>(a0,a1,a2,a3);}
+void m_glFogFuncSGIS_record(GLsizei a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC,&FunctionTable::m_ptr_glFogFuncSGIS>(a0,a1);}
+void m_glMultiModeDrawArraysIBM_record(const GLenum* a0,const GLint* a1,const GLsizei* a2,GLsizei a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC,&FunctionTable::m_ptr_glMultiModeDrawArraysIBM>(a0,a1,a2,a3,a4);}
+void m_glGetNamedFramebufferAttachmentParameterivEXT_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedFramebufferAttachmentParameterivEXT");return (void)0;}
+void m_glGetFloatv_record(GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFloatv");return (void)0;}
+void m_glVertexArrayVertexAttribIFormatEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC,&FunctionTable::m_ptr_glVertexArrayVertexAttribIFormatEXT>(a0,a1,a2,a3,a4);}
+void m_glHint_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLHINTPROC,&FunctionTable::m_ptr_glHint>(a0,a1);}
+void m_glVertexStream2svATI_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC,&FunctionTable::m_ptr_glVertexStream2svATI>(a0,a1);}
+void m_glMultiDrawArraysIndirect_record(GLenum a0,const void* a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC,&FunctionTable::m_ptr_glMultiDrawArraysIndirect>(a0,a1,a2,a3);}
+void m_glMultiTexEnvfvEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC,&FunctionTable::m_ptr_glMultiTexEnvfvEXT>(a0,a1,a2,a3);}
+void m_glVertexAttribP2uiv_record(GLuint a0,GLenum a1,GLboolean a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC,&FunctionTable::m_ptr_glVertexAttribP2uiv>(a0,a1,a2,a3);}
+void m_glProgramUniform1i64vARB_record(GLuint a0,GLint a1,GLsizei a2,const GLint64* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC,&FunctionTable::m_ptr_glProgramUniform1i64vARB>(a0,a1,a2,this->m_copy(a3,a2,1*sizeof(*a3)));}
+void m_glFramebufferTextureARB_record(GLenum a0,GLenum a1,GLuint a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC,&FunctionTable::m_ptr_glFramebufferTextureARB>(a0,a1,a2,a3);}
+void m_glPushClientAttribDefaultEXT_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC,&FunctionTable::m_ptr_glPushClientAttribDefaultEXT>(a0);}
+void m_glScalef_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSCALEFPROC,&FunctionTable::m_ptr_glScalef>(a0,a1,a2);}
+void m_glScaled_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSCALEDPROC,&FunctionTable::m_ptr_glScaled>(a0,a1,a2);}
+void m_glGetConvolutionParameterxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetConvolutionParameterxvOES");return (void)0;}
+void m_glGetProgramResourceName_record(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourceName");return (void)0;}
+void m_glCopyColorTable_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC,&FunctionTable::m_ptr_glCopyColorTable>(a0,a1,a2,a3,a4);}
+void m_glDepthRangeArrayv_record(GLuint a0,GLsizei a1,const GLdouble* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC,&FunctionTable::m_ptr_glDepthRangeArrayv>(a0,a1,a2);}
+void m_glCoverFillPathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLenum a5,const GLfloat* a6)const{this->template m_record<FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glCoverFillPathInstancedNV>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glMultiTexParameterivEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC,&FunctionTable::m_ptr_glMultiTexParameterivEXT>(a0,a1,a2,a3);}
+void m_glGetActiveAtomicCounterBufferiv_record(GLuint,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetActiveAtomicCounterBufferiv");return (void)0;}
+void m_glStencilOpSeparate_record(GLenum a0,GLenum a1,GLenum a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC,&FunctionTable::m_ptr_glStencilOpSeparate>(a0,a1,a2,a3);}
+void m_glVertexAttrib4fNV_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC,&FunctionTable::m_ptr_glVertexAttrib4fNV>(a0,a1,a2,a3,a4);}
+void m_glGetColorTableParameterivSGI_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameterivSGI");return (void)0;}
+void m_glVertexArrayAttribBinding_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC,&FunctionTable::m_ptr_glVertexArrayAttribBinding>(a0,a1,a2);}
+GLboolean m_glIsSemaphoreEXT_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsSemaphoreEXT");return (GLboolean)0;}
+void m_glProgramParameters4dvNV_record(GLenum a0,GLuint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC,&FunctionTable::m_ptr_glProgramParameters4dvNV>(a0,a1,a2,a3);}
+void m_glVertexAttribL4dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC,&FunctionTable::m_ptr_glVertexAttribL4dv>(a0,a1);}
+void m_glGetTexParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameteriv");return (void)0;}
+GLintptr m_glGetUniformOffsetEXT_record(GLuint,GLint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformOffsetEXT");return (GLintptr)0;}
+void m_glGetVertexAttribPointerv_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribPointerv");return (void)0;}
+void m_glResumeTransformFeedbackNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glResumeTransformFeedbackNV>();}
+void m_glProgramUniform3i64vNV_record(GLuint a0,GLint a1,GLsizei a2,const GLint64EXT* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC,&FunctionTable::m_ptr_glProgramUniform3i64vNV>(a0,a1,a2,this->m_copy(a3,a2,3*sizeof(*a3)));}
+void m_glTangent3fEXT_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC,&FunctionTable::m_ptr_glTangent3fEXT>(a0,a1,a2);}
+void m_glGetPathMetricRangeNV_record(GLbitfield,GLuint,GLsizei,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathMetricRangeNV");return (void)0;}
+void m_glWindowPos2iMESA_record(GLint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC,&FunctionTable::m_ptr_glWindowPos2iMESA>(a0,a1);}
+void m_glVertex2xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC,&FunctionTable::m_ptr_glVertex2xvOES>(a0);}
+void m_glGetnCompressedTexImage_record(GLenum,GLint,GLsizei,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnCompressedTexImage");return (void)0;}
+void m_glWindowPos2dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC,&FunctionTable::m_ptr_glWindowPos2dv>(a0);}
+void m_glReplacementCodeuiVertex3fSUN_record(GLuint a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC,&FunctionTable::m_ptr_glReplacementCodeuiVertex3fSUN>(a0,a1,a2,a3);}
+void m_glGetTransformFeedbackVaryingEXT_record(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTransformFeedbackVaryingEXT");return (void)0;}
+void m_glWindowPos3fARB_record(GLfloat a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC,&FunctionTable::m_ptr_glWindowPos3fARB>(a0,a1,a2);}
+void* m_glMapNamedBufferEXT_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glMapNamedBufferEXT");return (void*)0;}
+void m_glDisable_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEPROC,&FunctionTable::m_ptr_glDisable>(a0);}
+GLboolean m_glIsPointInFillPathNV_record(GLuint,GLuint,GLfloat,GLfloat)const{this->m_printUnrecordableFunctionErrorAndExit("glIsPointInFillPathNV");return (GLboolean)0;}
+void m_glVertexAttribI2uiEXT_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC,&FunctionTable::m_ptr_glVertexAttribI2uiEXT>(a0,a1,a2);}
+void m_glProgramUniform4uiv_record(GLuint a0,GLint a1,GLsizei a2,const GLuint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC,&FunctionTable::m_ptr_glProgramUniform4uiv>(a0,a1,a2,this->m_copy(a3,a2,4*sizeof(*a3)));}
+void m_glQueryCounter_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC,&FunctionTable::m_ptr_glQueryCounter>(a0,a1);}
+void m_glFramebufferRenderbufferEXT_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC,&FunctionTable::m_ptr_glFramebufferRenderbufferEXT>(a0,a1,a2,a3);}
+void m_glBinormal3svEXT_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC,&FunctionTable::m_ptr_glBinormal3svEXT>(a0);}
+void m_glBindBufferOffsetNV_record(GLenum a0,GLuint a1,GLuint a2,GLintptr a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC,&FunctionTable::m_ptr_glBindBufferOffsetNV>(a0,a1,a2,a3);}
+void m_glCopyTextureSubImage2D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC,&FunctionTable::m_ptr_glCopyTextureSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetProgramResourcefvNV_record(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramResourcefvNV");return (void)0;}
+void m_glBinormalPointerEXT_record(GLenum a0,GLsizei a1,const void* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC,&FunctionTable::m_ptr_glBinormalPointerEXT>(a0,a1,a2);}
+void m_glGetLightfv_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLightfv");return (void)0;}
+void m_glMulticastCopyImageSubDataNV_record(GLuint a0,GLbitfield a1,GLuint a2,GLenum a3,GLint a4,GLint a5,GLint a6,GLint a7,GLuint a8,GLenum a9,GLint a10,GLint a11,GLint a12,GLint a13,GLsizei a14,GLsizei a15,GLsizei a16)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC,&FunctionTable::m_ptr_glMulticastCopyImageSubDataNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}
+void m_glVertex2bOES_record(GLbyte a0,GLbyte a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX2BOESPROC,&FunctionTable::m_ptr_glVertex2bOES>(a0,a1);}
+void m_glUniform2ivARB_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC,&FunctionTable::m_ptr_glUniform2ivARB>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glMultiTexCoord3s_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC,&FunctionTable::m_ptr_glMultiTexCoord3s>(a0,a1,a2,a3);}
+void m_glGetHistogramParameterfvEXT_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetHistogramParameterfvEXT");return (void)0;}
+void m_glGetProgramStringNV_record(GLuint,GLenum,GLubyte*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramStringNV");return (void)0;}
+void m_glGetTexGenxvOES_record(GLenum,GLenum,GLfixed*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexGenxvOES");return (void)0;}
+void m_glTextureSubImage2D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLenum a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC,&FunctionTable::m_ptr_glTextureSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+GLenum m_glObjectPurgeableAPPLE_record(GLenum,GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glObjectPurgeableAPPLE");return (GLenum)0;}
+void m_glColorTableSGI_record(GLenum a0,GLenum a1,GLsizei a2,GLenum a3,GLenum a4,const void* a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC,&FunctionTable::m_ptr_glColorTableSGI>(a0,a1,a2,a3,a4,a5);}
+void m_glCopyConvolutionFilter2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC,&FunctionTable::m_ptr_glCopyConvolutionFilter2DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glMultiTexCoord3f_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC,&FunctionTable::m_ptr_glMultiTexCoord3f>(a0,a1,a2,a3);}
+void m_glMultiTexCoord3d_record(GLenum a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC,&FunctionTable::m_ptr_glMultiTexCoord3d>(a0,a1,a2,a3);}
+void m_glFogCoorddv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDDVPROC,&FunctionTable::m_ptr_glFogCoorddv>(a0);}
+void m_glGetBufferPointerv_record(GLenum,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferPointerv");return (void)0;}
+void m_glProgramUniform1fEXT_record(GLuint a0,GLint a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC,&FunctionTable::m_ptr_glProgramUniform1fEXT>(a0,a1,a2);}
+void m_glWindowPos2fvMESA_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC,&FunctionTable::m_ptr_glWindowPos2fvMESA>(a0);}
+void m_glAlphaToCoverageDitherControlNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC,&FunctionTable::m_ptr_glAlphaToCoverageDitherControlNV>(a0);}
+void m_glPolygonOffsetxOES_record(GLfixed a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC,&FunctionTable::m_ptr_glPolygonOffsetxOES>(a0,a1);}
+void m_glVertexAttrib4dARB_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC,&FunctionTable::m_ptr_glVertexAttrib4dARB>(a0,a1,a2,a3,a4);}
+void m_glUniformHandleui64vARB_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC,&FunctionTable::m_ptr_glUniformHandleui64vARB>(a0,a1,a2);}
+void m_glFragmentLightModelfvSGIX_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC,&FunctionTable::m_ptr_glFragmentLightModelfvSGIX>(a0,a1);}
+void m_glSwizzleEXT_record(GLuint a0,GLuint a1,GLenum a2,GLenum a3,GLenum a4,GLenum a5)const{this->template m_record<FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC,&FunctionTable::m_ptr_glSwizzleEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glBindFragmentShaderATI_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC,&FunctionTable::m_ptr_glBindFragmentShaderATI>(a0);}
+void m_glVertexAttribs3hvNV_record(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC,&FunctionTable::m_ptr_glVertexAttribs3hvNV>(a0,a1,a2);}
+void m_glGenBuffersARB_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenBuffersARB");return (void)0;}
+void m_glTextureStorageMem2DMultisampleEXT_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5,GLuint a6,GLuint64 a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC,&FunctionTable::m_ptr_glTextureStorageMem2DMultisampleEXT>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glListParameterfvSGIX_record(GLuint a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC,&FunctionTable::m_ptr_glListParameterfvSGIX>(a0,a1,a2);}
+void m_glNamedRenderbufferStorageMultisample_record(GLuint a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC,&FunctionTable::m_ptr_glNamedRenderbufferStorageMultisample>(a0,a1,a2,a3,a4);}
+void m_glVertexAttribI1iEXT_record(GLuint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC,&FunctionTable::m_ptr_glVertexAttribI1iEXT>(a0,a1);}
+void m_glMultiTexCoord2ivARB_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2ivARB>(a0,a1);}
+void m_glLightModelxOES_record(GLenum a0,GLfixed a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC,&FunctionTable::m_ptr_glLightModelxOES>(a0,a1);}
+void m_glColor3xOES_record(GLfixed a0,GLfixed a1,GLfixed a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3XOESPROC,&FunctionTable::m_ptr_glColor3xOES>(a0,a1,a2);}
+void m_glReadBuffer_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREADBUFFERPROC,&FunctionTable::m_ptr_glReadBuffer>(a0);}
+void m_glStencilFillPathInstancedNV_record(GLsizei a0,GLenum a1,const void* a2,GLuint a3,GLenum a4,GLuint a5,GLenum a6,const GLfloat* a7)const{this->template m_record<FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC,&FunctionTable::m_ptr_glStencilFillPathInstancedNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glVDPAUUnmapSurfacesNV_record(GLsizei a0,const GLvdpauSurfaceNV* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC,&FunctionTable::m_ptr_glVDPAUUnmapSurfacesNV>(a0,a1);}
+void m_glProgramUniform4i64NV_record(GLuint a0,GLint a1,GLint64EXT a2,GLint64EXT a3,GLint64EXT a4,GLint64EXT a5)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC,&FunctionTable::m_ptr_glProgramUniform4i64NV>(a0,a1,a2,a3,a4,a5);}
+void m_glVertexStream4dvATI_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC,&FunctionTable::m_ptr_glVertexStream4dvATI>(a0,a1);}
+GLboolean m_glIsQuery_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsQuery");return (GLboolean)0;}
+void m_glProgramUniformMatrix4fvEXT_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4fvEXT>(a0,a1,a2,a3,this->m_copy(a4,a2,4*4*sizeof(*a4)));}
+void m_glVertexAttrib3hNV_record(GLuint a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC,&FunctionTable::m_ptr_glVertexAttrib3hNV>(a0,a1,a2,a3);}
+void m_glFlushMappedNamedBufferRange_record(GLuint a0,GLintptr a1,GLsizeiptr a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC,&FunctionTable::m_ptr_glFlushMappedNamedBufferRange>(a0,a1,a2);}
+void m_glPushName_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHNAMEPROC,&FunctionTable::m_ptr_glPushName>(a0);}
+void m_glGetClipPlane_record(GLenum,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetClipPlane");return (void)0;}
+void m_glVertex4dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4DVPROC,&FunctionTable::m_ptr_glVertex4dv>(a0);}
+void m_glVertexAttrib3d_record(GLuint a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC,&FunctionTable::m_ptr_glVertexAttrib3d>(a0,a1,a2,a3);}
+void m_glBlendColor_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDCOLORPROC,&FunctionTable::m_ptr_glBlendColor>(a0,a1,a2,a3);}
+void m_glBindTransformFeedbackNV_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glBindTransformFeedbackNV>(a0,a1);}
+void m_glSamplerParameterIuiv_record(GLuint a0,GLenum a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC,&FunctionTable::m_ptr_glSamplerParameterIuiv>(a0,a1,a2);}
+void m_glIndexubv_record(const GLubyte* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXUBVPROC,&FunctionTable::m_ptr_glIndexubv>(a0);}
+void m_glNamedBufferPageCommitmentEXT_record(GLuint a0,GLintptr a1,GLsizeiptr a2,GLboolean a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC,&FunctionTable::m_ptr_glNamedBufferPageCommitmentEXT>(a0,a1,a2,a3);}
+GLenum m_glCheckNamedFramebufferStatus_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glCheckNamedFramebufferStatus");return (GLenum)0;}
+void m_glGetObjectBufferfvATI_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectBufferfvATI");return (void)0;}
+void m_glRasterPos4d_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4DPROC,&FunctionTable::m_ptr_glRasterPos4d>(a0,a1,a2,a3);}
+void m_glRasterPos4f_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4FPROC,&FunctionTable::m_ptr_glRasterPos4f>(a0,a1,a2,a3);}
+void m_glGetPerfMonitorCounterStringAMD_record(GLuint,GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorCounterStringAMD");return (void)0;}
+void m_glVertexAttrib3s_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC,&FunctionTable::m_ptr_glVertexAttrib3s>(a0,a1,a2,a3);}
+void m_glDrawElementsInstancedEXT_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC,&FunctionTable::m_ptr_glDrawElementsInstancedEXT>(a0,a1,a2,a3,a4);}
+void m_glNamedProgramLocalParameterI4iEXT_record(GLuint a0,GLenum a1,GLuint a2,GLint a3,GLint a4,GLint a5,GLint a6)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameterI4iEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glRasterPos4s_record(GLshort a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERPOS4SPROC,&FunctionTable::m_ptr_glRasterPos4s>(a0,a1,a2,a3);}
+void m_glGetProgramStageiv_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramStageiv");return (void)0;}
+void m_glGetMaterialxOES_record(GLenum,GLenum,GLfixed)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMaterialxOES");return (void)0;}
+void m_glPopMatrix_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPMATRIXPROC,&FunctionTable::m_ptr_glPopMatrix>();}
+void m_glGetVideoui64vNV_record(GLuint,GLenum,GLuint64EXT*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVideoui64vNV");return (void)0;}
+void m_glTangent3bEXT_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC,&FunctionTable::m_ptr_glTangent3bEXT>(a0,a1,a2);}
+GLenum m_glGetGraphicsResetStatusARB_record()const{this->m_printUnrecordableFunctionErrorAndExit("glGetGraphicsResetStatusARB");return (GLenum)0;}
+void m_glUniform4i_record(GLint a0,GLint a1,GLint a2,GLint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4IPROC,&FunctionTable::m_ptr_glUniform4i>(a0,a1,a2,a3,a4);}
+void m_glActiveTexture_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC,&FunctionTable::m_ptr_glActiveTexture>(a0);}
+void m_glEnableVertexAttribArray_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC,&FunctionTable::m_ptr_glEnableVertexAttribArray>(a0);}
+void m_glTexCoord4fVertex4fvSUN_record(const GLfloat* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC,&FunctionTable::m_ptr_glTexCoord4fVertex4fvSUN>(a0,a1);}
+void m_glUniform4d_record(GLint a0,GLdouble a1,GLdouble a2,GLdouble a3,GLdouble a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4DPROC,&FunctionTable::m_ptr_glUniform4d>(a0,a1,a2,a3,a4);}
+void m_glUniform4f_record(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4FPROC,&FunctionTable::m_ptr_glUniform4f>(a0,a1,a2,a3,a4);}
+void m_glRenderbufferStorageMultisample_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC,&FunctionTable::m_ptr_glRenderbufferStorageMultisample>(a0,a1,a2,a3,a4);}
+void m_glCreateProgramPipelines_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glCreateProgramPipelines");return (void)0;}
+void m_glVertexAttribLPointer_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC,&FunctionTable::m_ptr_glVertexAttribLPointer>(a0,a1,a2,a3,a4);}
+void m_glUniform2uiEXT_record(GLint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC,&FunctionTable::m_ptr_glUniform2uiEXT>(a0,a1,a2);}
+void m_glMultiTexCoord3sv_record(GLenum a0,const GLshort* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC,&FunctionTable::m_ptr_glMultiTexCoord3sv>(a0,a1);}
+void m_glDrawElementsInstancedBaseVertex_record(GLenum a0,GLsizei a1,GLenum a2,const void* a3,GLsizei a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,&FunctionTable::m_ptr_glDrawElementsInstancedBaseVertex>(a0,a1,a2,a3,a4,a5);}
+void m_glPixelTransformParameterfvEXT_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glPixelTransformParameterfvEXT>(a0,a1,a2);}
+void m_glDrawTransformFeedbackNV_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glDrawTransformFeedbackNV>(a0,a1);}
+void m_glTextureImage2DMultisampleCoverageNV_record(GLuint a0,GLenum a1,GLsizei a2,GLsizei a3,GLint a4,GLsizei a5,GLsizei a6,GLboolean a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC,&FunctionTable::m_ptr_glTextureImage2DMultisampleCoverageNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_record(GLuint a0,GLsizei a1,GLsizei a2,GLenum a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC,&FunctionTable::m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT>(a0,a1,a2,a3,a4,a5);}
+GLboolean m_glIsTexture_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsTexture");return (GLboolean)0;}
+void m_glMultiTexCoord4iv_record(GLenum a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC,&FunctionTable::m_ptr_glMultiTexCoord4iv>(a0,a1);}
+void m_glTexEnvfv_record(GLenum a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVFVPROC,&FunctionTable::m_ptr_glTexEnvfv>(a0,a1,a2);}
+void m_glPopDebugGroup_record()const{this->template m_record<FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC,&FunctionTable::m_ptr_glPopDebugGroup>();}
+void m_glUniformBlockBinding_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC,&FunctionTable::m_ptr_glUniformBlockBinding>(a0,a1,a2);}
+void m_glWindowPos2svMESA_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC,&FunctionTable::m_ptr_glWindowPos2svMESA>(a0);}
+void m_glGenerateTextureMipmapEXT_record(GLuint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGenerateTextureMipmapEXT");return (void)0;}
+GLuint m_glBindLightParameterEXT_record(GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glBindLightParameterEXT");return (GLuint)0;}
+void m_glTexCoord3bOES_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC,&FunctionTable::m_ptr_glTexCoord3bOES>(a0,a1,a2);}
+void m_glTexCoordPointer_record(GLint a0,GLenum a1,GLsizei a2,const GLvoid* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC,&FunctionTable::m_ptr_glTexCoordPointer>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix3x2fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix3x2fv>(a0,a1,a2,a3,this->m_copy(a4,a2,3*2*sizeof(*a4)));}
+void m_glUniform2fvARB_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC,&FunctionTable::m_ptr_glUniform2fvARB>(a0,a1,this->m_copy(a2,a1,2*sizeof(*a2)));}
+void m_glProgramLocalParameterI4uivNV_record(GLenum a0,GLuint a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC,&FunctionTable::m_ptr_glProgramLocalParameterI4uivNV>(a0,a1,a2);}
+void m_glFlushVertexArrayRangeNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC,&FunctionTable::m_ptr_glFlushVertexArrayRangeNV>();}
+void m_glSecondaryColor3svEXT_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3svEXT>(a0);}
+void m_glGetBufferParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetBufferParameteriv");return (void)0;}
+void m_glGetQueryIndexediv_record(GLenum,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryIndexediv");return (void)0;}
+void m_glFramebufferTexture3DEXT_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC,&FunctionTable::m_ptr_glFramebufferTexture3DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glLoadTransposeMatrixxOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC,&FunctionTable::m_ptr_glLoadTransposeMatrixxOES>(a0);}
+void m_glDeleteTransformFeedbacksNV_record(GLsizei a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC,&FunctionTable::m_ptr_glDeleteTransformFeedbacksNV>(a0,a1);}
+void m_glGetCompressedTextureImageEXT_record(GLuint,GLenum,GLint,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedTextureImageEXT");return (void)0;}
+void m_glIndexMaterialEXT_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC,&FunctionTable::m_ptr_glIndexMaterialEXT>(a0,a1);}
+void m_glFogCoorddEXT_record(GLdouble a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC,&FunctionTable::m_ptr_glFogCoorddEXT>(a0);}
+void m_glTexCoord2hvNV_record(const GLhalfNV* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC,&FunctionTable::m_ptr_glTexCoord2hvNV>(a0);}
+void m_glGetFramebufferParameterfvAMD_record(GLenum,GLenum,GLuint,GLuint,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFramebufferParameterfvAMD");return (void)0;}
+void m_glTexEnviv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXENVIVPROC,&FunctionTable::m_ptr_glTexEnviv>(a0,a1,a2);}
+void m_glEndTransformFeedbackNV_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC,&FunctionTable::m_ptr_glEndTransformFeedbackNV>();}
+void m_glGlobalAlphaFactoruiSUN_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC,&FunctionTable::m_ptr_glGlobalAlphaFactoruiSUN>(a0);}
+void m_glSelectBuffer_record(GLsizei a0,GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSELECTBUFFERPROC,&FunctionTable::m_ptr_glSelectBuffer>(a0,a1);}
+void m_glNamedBufferSubDataEXT_record(GLuint a0,GLintptr a1,GLsizeiptr a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC,&FunctionTable::m_ptr_glNamedBufferSubDataEXT>(a0,a1,a2,this->m_copy(a3,a2,1));}
+void m_glDisableVertexArrayAttrib_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC,&FunctionTable::m_ptr_glDisableVertexArrayAttrib>(a0,a1);}
+void m_glBlendFunc_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBLENDFUNCPROC,&FunctionTable::m_ptr_glBlendFunc>(a0,a1);}
+GLuint m_glCreateProgram_record()const{this->m_printUnrecordableFunctionErrorAndExit("glCreateProgram");return (GLuint)0;}
+void m_glVertexStream2dATI_record(GLenum a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC,&FunctionTable::m_ptr_glVertexStream2dATI>(a0,a1,a2);}
+void m_glUniform4ui64vARB_record(GLint a0,GLsizei a1,const GLuint64* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC,&FunctionTable::m_ptr_glUniform4ui64vARB>(a0,a1,this->m_copy(a2,a1,4*sizeof(*a2)));}
+void m_glGetSemaphoreParameterui64vEXT_record(GLuint,GLenum,GLuint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetSemaphoreParameterui64vEXT");return (void)0;}
+void m_glPrimitiveRestartIndex_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC,&FunctionTable::m_ptr_glPrimitiveRestartIndex>(a0);}
+void m_glNormalStream3fATI_record(GLenum a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC,&FunctionTable::m_ptr_glNormalStream3fATI>(a0,a1,a2,a3);}
+void m_glProgramUniformMatrix2fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix2fv>(a0,a1,a2,a3,this->m_copy(a4,a2,2*2*sizeof(*a4)));}
+void m_glVertexAttribs1hvNV_record(GLuint a0,GLsizei a1,const GLhalfNV* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC,&FunctionTable::m_ptr_glVertexAttribs1hvNV>(a0,a1,a2);}
+void m_glWindowPos4svMESA_record(const GLshort* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC,&FunctionTable::m_ptr_glWindowPos4svMESA>(a0);}
+void m_glDeleteFragmentShaderATI_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC,&FunctionTable::m_ptr_glDeleteFragmentShaderATI>(a0);}
+void m_glBindImageTextures_record(GLuint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC,&FunctionTable::m_ptr_glBindImageTextures>(a0,a1,a2);}
+void m_glMap2xOES_record(GLenum a0,GLfixed a1,GLfixed a2,GLint a3,GLint a4,GLfixed a5,GLfixed a6,GLint a7,GLint a8,GLfixed a9)const{this->template m_record<FunctionTable::MEMBERPFNGLMAP2XOESPROC,&FunctionTable::m_ptr_glMap2xOES>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glEnd_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDPROC,&FunctionTable::m_ptr_glEnd>();}
+void m_glMultiTexCoord2dARB_record(GLenum a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC,&FunctionTable::m_ptr_glMultiTexCoord2dARB>(a0,a1,a2);}
+void m_glUniform1i64NV_record(GLint a0,GLint64EXT a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC,&FunctionTable::m_ptr_glUniform1i64NV>(a0,a1);}
+void m_glPathStringNV_record(GLuint a0,GLenum a1,GLsizei a2,const void* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC,&FunctionTable::m_ptr_glPathStringNV>(a0,a1,a2,a3);}
+void m_glGetNamedFramebufferParameterivEXT_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedFramebufferParameterivEXT");return (void)0;}
+void m_glGetProgramNamedParameterdvNV_record(GLuint,GLsizei,const GLubyte*,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetProgramNamedParameterdvNV");return (void)0;}
+void m_glPathDashArrayNV_record(GLuint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC,&FunctionTable::m_ptr_glPathDashArrayNV>(a0,a1,a2);}
+void m_glUniform3uiv_record(GLint a0,GLsizei a1,const GLuint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC,&FunctionTable::m_ptr_glUniform3uiv>(a0,a1,this->m_copy(a2,a1,3*sizeof(*a2)));}
+void m_glColor3fVertex3fvSUN_record(const GLfloat* a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC,&FunctionTable::m_ptr_glColor3fVertex3fvSUN>(a0,a1);}
+void m_glMultTransposeMatrixd_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC,&FunctionTable::m_ptr_glMultTransposeMatrixd>(a0);}
+void m_glClearColor_record(GLclampf a0,GLclampf a1,GLclampf a2,GLclampf a3)const{this->template m_record<FunctionTable::MEMBERPFNGLCLEARCOLORPROC,&FunctionTable::m_ptr_glClearColor>(a0,a1,a2,a3);}
+GLuint64 m_glGetImageHandleARB_record(GLuint,GLint,GLboolean,GLint,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glGetImageHandleARB");return (GLuint64)0;}
+void m_glTangent3dEXT_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC,&FunctionTable::m_ptr_glTangent3dEXT>(a0,a1,a2);}
+void m_glGetQueryObjectivARB_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryObjectivARB");return (void)0;}
+void m_glGetLocalConstantFloatvEXT_record(GLuint,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetLocalConstantFloatvEXT");return (void)0;}
+void m_glUseShaderProgramEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC,&FunctionTable::m_ptr_glUseShaderProgramEXT>(a0,a1);}
+void m_glBindRenderbufferEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC,&FunctionTable::m_ptr_glBindRenderbufferEXT>(a0,a1);}
+void m_glInterleavedArrays_record(GLenum a0,GLsizei a1,const GLvoid* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC,&FunctionTable::m_ptr_glInterleavedArrays>(a0,a1,a2);}
+void m_glGetPerfMonitorGroupStringAMD_record(GLuint,GLsizei,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPerfMonitorGroupStringAMD");return (void)0;}
+void m_glUniform3ui_record(GLint a0,GLuint a1,GLuint a2,GLuint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM3UIPROC,&FunctionTable::m_ptr_glUniform3ui>(a0,a1,a2,a3);}
+void m_glGetNamedProgramLocalParameterdvEXT_record(GLuint,GLenum,GLuint,GLdouble*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedProgramLocalParameterdvEXT");return (void)0;}
+void m_glDeleteQueryResourceTagNV_record(GLsizei a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC,&FunctionTable::m_ptr_glDeleteQueryResourceTagNV>(a0,a1);}
+void m_glVertexAttribI4uiv_record(GLuint a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC,&FunctionTable::m_ptr_glVertexAttribI4uiv>(a0,a1);}
+void m_glVertexAttrib4bv_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC,&FunctionTable::m_ptr_glVertexAttrib4bv>(a0,a1);}
+void m_glMultiTexCoord3xOES_record(GLenum a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC,&FunctionTable::m_ptr_glMultiTexCoord3xOES>(a0,a1,a2,a3);}
+void m_glSecondaryColor3ub_record(GLubyte a0,GLubyte a1,GLubyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC,&FunctionTable::m_ptr_glSecondaryColor3ub>(a0,a1,a2);}
+void m_glFragmentMaterialfSGIX_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC,&FunctionTable::m_ptr_glFragmentMaterialfSGIX>(a0,a1,a2);}
+void m_glGetVariantArrayObjectivATI_record(GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVariantArrayObjectivATI");return (void)0;}
+void m_glSecondaryColor3ui_record(GLuint a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC,&FunctionTable::m_ptr_glSecondaryColor3ui>(a0,a1,a2);}
+void m_glVertexAttrib1dARB_record(GLuint a0,GLdouble a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC,&FunctionTable::m_ptr_glVertexAttrib1dARB>(a0,a1);}
+void m_glGetNamedBufferPointerv_record(GLuint,GLenum,void**)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferPointerv");return (void)0;}
+void m_glLockArraysEXT_record(GLint a0,GLsizei a1)const{this->template m_record<FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC,&FunctionTable::m_ptr_glLockArraysEXT>(a0,a1);}
+void m_glVertexAttribPointerNV_record(GLuint a0,GLint a1,GLenum a2,GLsizei a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC,&FunctionTable::m_ptr_glVertexAttribPointerNV>(a0,a1,a2,a3,a4);}
+void m_glConvolutionParameterf_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC,&FunctionTable::m_ptr_glConvolutionParameterf>(a0,a1,a2);}
+void m_glBindBufferBaseEXT_record(GLenum a0,GLuint a1,GLuint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC,&FunctionTable::m_ptr_glBindBufferBaseEXT>(a0,a1,a2);}
+void m_glTexCoord2xvOES_record(const GLfixed* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC,&FunctionTable::m_ptr_glTexCoord2xvOES>(a0);}
+void m_glGetQueryBufferObjectui64v_record(GLuint,GLuint,GLenum,GLintptr)const{this->m_printUnrecordableFunctionErrorAndExit("glGetQueryBufferObjectui64v");return (void)0;}
+void m_glSetMultisamplefvAMD_record(GLenum a0,GLuint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC,&FunctionTable::m_ptr_glSetMultisamplefvAMD>(a0,a1,a2);}
+void m_glPathColorGenNV_record(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC,&FunctionTable::m_ptr_glPathColorGenNV>(a0,a1,a2,a3);}
+void m_glVertexAttrib3sARB_record(GLuint a0,GLshort a1,GLshort a2,GLshort a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC,&FunctionTable::m_ptr_glVertexAttrib3sARB>(a0,a1,a2,a3);}
+void m_glVertexAttrib4ivARB_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC,&FunctionTable::m_ptr_glVertexAttrib4ivARB>(a0,a1);}
+void m_glGenTransformFeedbacks_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenTransformFeedbacks");return (void)0;}
+void m_glGetVertexAttribIuiv_record(GLuint,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexAttribIuiv");return (void)0;}
+void m_glPixelTransformParameterfEXT_record(GLenum a0,GLenum a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC,&FunctionTable::m_ptr_glPixelTransformParameterfEXT>(a0,a1,a2);}
+void m_glGetTexParameterIuivEXT_record(GLenum,GLenum,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterIuivEXT");return (void)0;}
+void m_glGetObjectParameterivARB_record(GLhandleARB,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectParameterivARB");return (void)0;}
+void m_glVertexArraySecondaryColorOffsetEXT_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLsizei a4,GLintptr a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC,&FunctionTable::m_ptr_glVertexArraySecondaryColorOffsetEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glWindowPos2fARB_record(GLfloat a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC,&FunctionTable::m_ptr_glWindowPos2fARB>(a0,a1);}
+void m_glCompressedTexSubImage2D_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLenum a6,GLsizei a7,const GLvoid* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC,&FunctionTable::m_ptr_glCompressedTexSubImage2D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glCompressedTexSubImage3DARB_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLsizei a7,GLenum a8,GLsizei a9,const void* a10)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC,&FunctionTable::m_ptr_glCompressedTexSubImage3DARB>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glProgramBinary_record(GLuint a0,GLenum a1,const void* a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC,&FunctionTable::m_ptr_glProgramBinary>(a0,a1,a2,a3);}
+void m_glPresentFrameKeyedNV_record(GLuint a0,GLuint64EXT a1,GLuint a2,GLuint a3,GLenum a4,GLenum a5,GLuint a6,GLuint a7,GLenum a8,GLuint a9,GLuint a10)const{this->template m_record<FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC,&FunctionTable::m_ptr_glPresentFrameKeyedNV>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}
+void m_glVertexAttribI4bv_record(GLuint a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC,&FunctionTable::m_ptr_glVertexAttribI4bv>(a0,a1);}
+void m_glPathCoverDepthFuncNV_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC,&FunctionTable::m_ptr_glPathCoverDepthFuncNV>(a0);}
+void m_glTransformFeedbackStreamAttribsNV_record(GLsizei a0,const GLint* a1,GLsizei a2,const GLint* a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC,&FunctionTable::m_ptr_glTransformFeedbackStreamAttribsNV>(a0,a1,a2,a3,a4);}
+void m_glSecondaryColor3usEXT_record(GLushort a0,GLushort a1,GLushort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3usEXT>(a0,a1,a2);}
+void m_glCopyColorTableSGI_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC,&FunctionTable::m_ptr_glCopyColorTableSGI>(a0,a1,a2,a3,a4);}
+void m_glProgramEnvParameter4fvARB_record(GLenum a0,GLuint a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC,&FunctionTable::m_ptr_glProgramEnvParameter4fvARB>(a0,a1,a2);}
+void m_glMultiTexCoord4sARB_record(GLenum a0,GLshort a1,GLshort a2,GLshort a3,GLshort a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC,&FunctionTable::m_ptr_glMultiTexCoord4sARB>(a0,a1,a2,a3,a4);}
+void m_glGetVertexArrayIndexed64iv_record(GLuint,GLuint,GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetVertexArrayIndexed64iv");return (void)0;}
+void m_glMatrixMultTranspose3x3fNV_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC,&FunctionTable::m_ptr_glMatrixMultTranspose3x3fNV>(a0,a1);}
+void m_glTexParameterIiv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC,&FunctionTable::m_ptr_glTexParameterIiv>(a0,a1,a2);}
+void m_glVertexArrayAttribFormat_record(GLuint a0,GLuint a1,GLint a2,GLenum a3,GLboolean a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC,&FunctionTable::m_ptr_glVertexArrayAttribFormat>(a0,a1,a2,a3,a4,a5);}
+void m_glEndTransformFeedback_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC,&FunctionTable::m_ptr_glEndTransformFeedback>();}
+void m_glDrawCommandsStatesAddressNV_record(const GLuint64* a0,const GLsizei* a1,const GLuint* a2,const GLuint* a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC,&FunctionTable::m_ptr_glDrawCommandsStatesAddressNV>(a0,a1,a2,a3,a4);}
+void m_glUniform4ui64NV_record(GLint a0,GLuint64EXT a1,GLuint64EXT a2,GLuint64EXT a3,GLuint64EXT a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC,&FunctionTable::m_ptr_glUniform4ui64NV>(a0,a1,a2,a3,a4);}
+void m_glMaterialiv_record(GLenum a0,GLenum a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMATERIALIVPROC,&FunctionTable::m_ptr_glMaterialiv>(a0,a1,a2);}
+void m_glTexImage2DMultisample_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLboolean a5)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTexImage2DMultisample>(a0,a1,a2,a3,a4,a5);}
+void m_glBindTextureEXT_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC,&FunctionTable::m_ptr_glBindTextureEXT>(a0,a1);}
+GLboolean m_glIsBuffer_record(GLuint)const{this->m_printUnrecordableFunctionErrorAndExit("glIsBuffer");return (GLboolean)0;}
+void m_glVertexAttribI1iv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC,&FunctionTable::m_ptr_glVertexAttribI1iv>(a0,a1);}
+void m_glGetFinalCombinerInputParameterfvNV_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFinalCombinerInputParameterfvNV");return (void)0;}
+void m_glMultiTexCoord3bvOES_record(GLenum a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC,&FunctionTable::m_ptr_glMultiTexCoord3bvOES>(a0,a1);}
+void m_glVertexAttribDivisor_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC,&FunctionTable::m_ptr_glVertexAttribDivisor>(a0,a1);}
+void m_glCopyBufferSubData_record(GLenum a0,GLenum a1,GLintptr a2,GLintptr a3,GLsizeiptr a4)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC,&FunctionTable::m_ptr_glCopyBufferSubData>(a0,a1,a2,a3,a4);}
+GLuint m_glBindTexGenParameterEXT_record(GLenum,GLenum,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glBindTexGenParameterEXT");return (GLuint)0;}
+void m_glNormalStream3bATI_record(GLenum a0,GLbyte a1,GLbyte a2,GLbyte a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC,&FunctionTable::m_ptr_glNormalStream3bATI>(a0,a1,a2,a3);}
+void m_glTexStorageMem2DEXT_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLuint a5,GLuint64 a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC,&FunctionTable::m_ptr_glTexStorageMem2DEXT>(a0,a1,a2,a3,a4,a5,a6);}
+void m_glTextureImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5,GLint a6,GLenum a7,GLenum a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC,&FunctionTable::m_ptr_glTextureImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glGetColorTableParameteriv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetColorTableParameteriv");return (void)0;}
+void m_glActiveTextureARB_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC,&FunctionTable::m_ptr_glActiveTextureARB>(a0);}
+void m_glTexCoord4xOES_record(GLfixed a0,GLfixed a1,GLfixed a2,GLfixed a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC,&FunctionTable::m_ptr_glTexCoord4xOES>(a0,a1,a2,a3);}
+void m_glNamedBufferStorageExternalEXT_record(GLuint a0,GLintptr a1,GLsizeiptr a2,GLeglClientBufferEXT a3,GLbitfield a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC,&FunctionTable::m_ptr_glNamedBufferStorageExternalEXT>(a0,a1,a2,a3,a4);}
+void m_glSecondaryColor3fvEXT_record(const GLfloat* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC,&FunctionTable::m_ptr_glSecondaryColor3fvEXT>(a0);}
+void m_glUniformMatrix4x2fv_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC,&FunctionTable::m_ptr_glUniformMatrix4x2fv>(a0,a1,a2,this->m_copy(a3,a1,4*2*sizeof(*a3)));}
+void m_glStartInstrumentsSGIX_record()const{this->template m_record<FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC,&FunctionTable::m_ptr_glStartInstrumentsSGIX>();}
+void m_glProgramNamedParameter4fvNV_record(GLuint a0,GLsizei a1,const GLubyte* a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC,&FunctionTable::m_ptr_glProgramNamedParameter4fvNV>(a0,a1,a2,a3);}
+void m_glEndVideoCaptureNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC,&FunctionTable::m_ptr_glEndVideoCaptureNV>(a0);}
+GLuint m_glGenLists_record(GLsizei)const{this->m_printUnrecordableFunctionErrorAndExit("glGenLists");return (GLuint)0;}
+void m_glUniform1fARB_record(GLint a0,GLfloat a1)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC,&FunctionTable::m_ptr_glUniform1fARB>(a0,a1);}
+void m_glNamedFramebufferTexture1DEXT_record(GLuint a0,GLenum a1,GLenum a2,GLuint a3,GLint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC,&FunctionTable::m_ptr_glNamedFramebufferTexture1DEXT>(a0,a1,a2,a3,a4);}
+void* m_glMapBufferRange_record(GLenum,GLintptr,GLsizeiptr,GLbitfield)const{this->m_printUnrecordableFunctionErrorAndExit("glMapBufferRange");return (void*)0;}
+void m_glMultiDrawElementsIndirectCountARB_record(GLenum a0,GLenum a1,const void* a2,GLintptr a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC,&FunctionTable::m_ptr_glMultiDrawElementsIndirectCountARB>(a0,a1,a2,a3,a4,a5);}
+void m_glProgramUniformMatrix4x2fv_record(GLuint a0,GLint a1,GLsizei a2,GLboolean a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC,&FunctionTable::m_ptr_glProgramUniformMatrix4x2fv>(a0,a1,a2,a3,this->m_copy(a4,a2,4*2*sizeof(*a4)));}
+void m_glGetTextureParameterIivEXT_record(GLuint,GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTextureParameterIivEXT");return (void)0;}
+void m_glMultiTexCoord3hNV_record(GLenum a0,GLhalfNV a1,GLhalfNV a2,GLhalfNV a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC,&FunctionTable::m_ptr_glMultiTexCoord3hNV>(a0,a1,a2,a3);}
+void m_glNamedProgramLocalParametersI4uivEXT_record(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLuint* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParametersI4uivEXT>(a0,a1,a2,a3,a4);}
+void m_glEndList_record()const{this->template m_record<FunctionTable::MEMBERPFNGLENDLISTPROC,&FunctionTable::m_ptr_glEndList>();}
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4,GLfloat a5,GLfloat a6,GLfloat a7,GLfloat a8,GLfloat a9,GLfloat a10,GLfloat a11)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC,&FunctionTable::m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}
+void m_glGenTransformFeedbacksNV_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenTransformFeedbacksNV");return (void)0;}
+void m_glEdgeFlagv_record(const GLboolean* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEDGEFLAGVPROC,&FunctionTable::m_ptr_glEdgeFlagv>(a0);}
+void m_glVertexAttribI2iv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC,&FunctionTable::m_ptr_glVertexAttribI2iv>(a0,a1);}
+void m_glCopyMultiTexImage2DEXT_record(GLenum a0,GLenum a1,GLint a2,GLenum a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLint a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCopyMultiTexImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glUniformMatrix3x2dv_record(GLint a0,GLsizei a1,GLboolean a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC,&FunctionTable::m_ptr_glUniformMatrix3x2dv>(a0,a1,a2,this->m_copy(a3,a1,3*2*sizeof(*a3)));}
+void m_glTexImage3DMultisampleCoverageNV_record(GLenum a0,GLsizei a1,GLsizei a2,GLint a3,GLsizei a4,GLsizei a5,GLsizei a6,GLboolean a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC,&FunctionTable::m_ptr_glTexImage3DMultisampleCoverageNV>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glGetShaderPrecisionFormat_record(GLenum,GLenum,GLint*,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetShaderPrecisionFormat");return (void)0;}
+void m_glTexSubImage4DSGIS_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLsizei a6,GLsizei a7,GLsizei a8,GLsizei a9,GLenum a10,GLenum a11,const void* a12)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC,&FunctionTable::m_ptr_glTexSubImage4DSGIS>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}
+void m_glRasterSamplesEXT_record(GLuint a0,GLboolean a1)const{this->template m_record<FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC,&FunctionTable::m_ptr_glRasterSamplesEXT>(a0,a1);}
+void m_glTextureView_record(GLuint a0,GLenum a1,GLuint a2,GLenum a3,GLuint a4,GLuint a5,GLuint a6,GLuint a7)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC,&FunctionTable::m_ptr_glTextureView>(a0,a1,a2,a3,a4,a5,a6,a7);}
+void m_glEvalMapsNV_record(GLenum a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALMAPSNVPROC,&FunctionTable::m_ptr_glEvalMapsNV>(a0,a1);}
+GLint m_glGetFragDataLocationEXT_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetFragDataLocationEXT");return (GLint)0;}
+void m_glGetCompressedMultiTexImageEXT_record(GLenum,GLenum,GLint,void*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetCompressedMultiTexImageEXT");return (void)0;}
+void m_glIndexMask_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLINDEXMASKPROC,&FunctionTable::m_ptr_glIndexMask>(a0);}
+void m_glPushClientAttrib_record(GLbitfield a0)const{this->template m_record<FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC,&FunctionTable::m_ptr_glPushClientAttrib>(a0);}
+void m_glShaderSource_record(GLuint a0,GLsizei a1,const GLchar*const* a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLSHADERSOURCEPROC,&FunctionTable::m_ptr_glShaderSource>(a0,a1,a2,a3);}
+void m_glDispatchComputeGroupSizeARB_record(GLuint a0,GLuint a1,GLuint a2,GLuint a3,GLuint a4,GLuint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC,&FunctionTable::m_ptr_glDispatchComputeGroupSizeARB>(a0,a1,a2,a3,a4,a5);}
+void m_glLGPUNamedBufferSubDataNVX_record(GLbitfield a0,GLuint a1,GLintptr a2,GLsizeiptr a3,const void* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC,&FunctionTable::m_ptr_glLGPUNamedBufferSubDataNVX>(a0,a1,a2,a3,a4);}
+void m_glGetnPixelMapfv_record(GLenum,GLsizei,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapfv");return (void)0;}
+void m_glTexCoordP2uiv_record(GLenum a0,const GLuint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC,&FunctionTable::m_ptr_glTexCoordP2uiv>(a0,a1);}
+void m_glUniform2f_record(GLint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM2FPROC,&FunctionTable::m_ptr_glUniform2f>(a0,a1,a2);}
+void m_glGetNamedBufferParameteri64v_record(GLuint,GLenum,GLint64*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetNamedBufferParameteri64v");return (void)0;}
+void m_glCommandListSegmentsNV_record(GLuint a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC,&FunctionTable::m_ptr_glCommandListSegmentsNV>(a0,a1);}
+void m_glTextureParameterIivEXT_record(GLuint a0,GLenum a1,GLenum a2,const GLint* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC,&FunctionTable::m_ptr_glTextureParameterIivEXT>(a0,a1,a2,a3);}
+void m_glMultiTexParameterfvEXT_record(GLenum a0,GLenum a1,GLenum a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glMultiTexParameterfvEXT>(a0,a1,a2,a3);}
+void m_glProgramUniform2ui64ARB_record(GLuint a0,GLint a1,GLuint64 a2,GLuint64 a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC,&FunctionTable::m_ptr_glProgramUniform2ui64ARB>(a0,a1,a2,a3);}
+void m_glVertex4d_record(GLdouble a0,GLdouble a1,GLdouble a2,GLdouble a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4DPROC,&FunctionTable::m_ptr_glVertex4d>(a0,a1,a2,a3);}
+GLuint m_glNewObjectBufferATI_record(GLsizei,const void*,GLenum)const{this->m_printUnrecordableFunctionErrorAndExit("glNewObjectBufferATI");return (GLuint)0;}
+void m_glViewportSwizzleNV_record(GLuint a0,GLenum a1,GLenum a2,GLenum a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC,&FunctionTable::m_ptr_glViewportSwizzleNV>(a0,a1,a2,a3,a4);}
+void m_glBufferData_record(GLenum a0,GLsizeiptr a1,const void* a2,GLenum a3)const{this->template m_record<FunctionTable::MEMBERPFNGLBUFFERDATAPROC,&FunctionTable::m_ptr_glBufferData>(a0,a1,this->m_copy(a2,a1,1),a3);}
+void m_glTextureImage1DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLint a5,GLenum a6,GLenum a7,const void* a8)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC,&FunctionTable::m_ptr_glTextureImage1DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glGetTexParameterIiv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetTexParameterIiv");return (void)0;}
+void m_glCopyTexSubImage1DEXT_record(GLenum a0,GLint a1,GLint a2,GLint a3,GLint a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC,&FunctionTable::m_ptr_glCopyTexSubImage1DEXT>(a0,a1,a2,a3,a4,a5);}
+void m_glVertex4f_record(GLfloat a0,GLfloat a1,GLfloat a2,GLfloat a3)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEX4FPROC,&FunctionTable::m_ptr_glVertex4f>(a0,a1,a2,a3);}
+void m_glUniformMatrix3fvARB_record(GLint a0,GLsizei a1,GLboolean a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC,&FunctionTable::m_ptr_glUniformMatrix3fvARB>(a0,a1,a2,this->m_copy(a3,a1,3*3*sizeof(*a3)));}
+void m_glTexCoordP1ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC,&FunctionTable::m_ptr_glTexCoordP1ui>(a0,a1);}
+void m_glPointParameterfvEXT_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC,&FunctionTable::m_ptr_glPointParameterfvEXT>(a0,a1);}
+void m_glUniform4fARB_record(GLint a0,GLfloat a1,GLfloat a2,GLfloat a3,GLfloat a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC,&FunctionTable::m_ptr_glUniform4fARB>(a0,a1,a2,a3,a4);}
+void m_glImportMemoryFdEXT_record(GLuint a0,GLuint64 a1,GLenum a2,GLint a3)const{this->template m_record<FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC,&FunctionTable::m_ptr_glImportMemoryFdEXT>(a0,a1,a2,a3);}
+void m_glCopyTextureSubImage3D_record(GLuint a0,GLint a1,GLint a2,GLint a3,GLint a4,GLint a5,GLint a6,GLsizei a7,GLsizei a8)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC,&FunctionTable::m_ptr_glCopyTextureSubImage3D>(a0,a1,a2,a3,a4,a5,a6,a7,a8);}
+void m_glMultiTexCoord2fv_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC,&FunctionTable::m_ptr_glMultiTexCoord2fv>(a0,a1);}
+void m_glNamedFramebufferSamplePositionsfvAMD_record(GLuint a0,GLuint a1,GLuint a2,const GLfloat* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC,&FunctionTable::m_ptr_glNamedFramebufferSamplePositionsfvAMD>(a0,a1,a2,a3);}
+void m_glNormalP3ui_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALP3UIPROC,&FunctionTable::m_ptr_glNormalP3ui>(a0,a1);}
+void m_glDrawRangeElementArrayATI_record(GLenum a0,GLuint a1,GLuint a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC,&FunctionTable::m_ptr_glDrawRangeElementArrayATI>(a0,a1,a2,a3);}
+void m_glVertexAttribI1i_record(GLuint a0,GLint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC,&FunctionTable::m_ptr_glVertexAttribI1i>(a0,a1);}
+void m_glDrawArraysInstancedARB_record(GLenum a0,GLint a1,GLsizei a2,GLsizei a3)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC,&FunctionTable::m_ptr_glDrawArraysInstancedARB>(a0,a1,a2,a3);}
+void m_glEnableVertexAttribAPPLE_record(GLuint a0,GLenum a1)const{this->template m_record<FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC,&FunctionTable::m_ptr_glEnableVertexAttribAPPLE>(a0,a1);}
+GLuint m_glGetDebugMessageLogARB_record(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetDebugMessageLogARB");return (GLuint)0;}
+void m_glGetPathTexGenfvNV_record(GLenum,GLenum,GLfloat*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetPathTexGenfvNV");return (void)0;}
+void m_glNamedProgramLocalParameters4fvEXT_record(GLuint a0,GLenum a1,GLuint a2,GLsizei a3,const GLfloat* a4)const{this->template m_record<FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC,&FunctionTable::m_ptr_glNamedProgramLocalParameters4fvEXT>(a0,a1,a2,a3,a4);}
+void m_glQueryResourceTagNV_record(GLint a0,const GLchar* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC,&FunctionTable::m_ptr_glQueryResourceTagNV>(a0,a1);}
+void m_glVertexStream3fvATI_record(GLenum a0,const GLfloat* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC,&FunctionTable::m_ptr_glVertexStream3fvATI>(a0,a1);}
+void m_glFramebufferTexture3D_record(GLenum a0,GLenum a1,GLenum a2,GLuint a3,GLint a4,GLint a5)const{this->template m_record<FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC,&FunctionTable::m_ptr_glFramebufferTexture3D>(a0,a1,a2,a3,a4,a5);}
+void m_glCompressedTextureSubImage2DEXT_record(GLuint a0,GLenum a1,GLint a2,GLint a3,GLint a4,GLsizei a5,GLsizei a6,GLenum a7,GLsizei a8,const void* a9)const{this->template m_record<FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC,&FunctionTable::m_ptr_glCompressedTextureSubImage2DEXT>(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}
+void m_glWindowPos3dv_record(const GLdouble* a0)const{this->template m_record<FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC,&FunctionTable::m_ptr_glWindowPos3dv>(a0);}
+void m_glCopyConvolutionFilter2D_record(GLenum a0,GLenum a1,GLint a2,GLint a3,GLsizei a4,GLsizei a5)const{this->template m_record<FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC,&FunctionTable::m_ptr_glCopyConvolutionFilter2D>(a0,a1,a2,a3,a4,a5);}
+void m_glReadInstrumentsSGIX_record(GLint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC,&FunctionTable::m_ptr_glReadInstrumentsSGIX>(a0);}
+void m_glProgramUniform2dvEXT_record(GLuint a0,GLint a1,GLsizei a2,const GLdouble* a3)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC,&FunctionTable::m_ptr_glProgramUniform2dvEXT>(a0,a1,a2,this->m_copy(a3,a2,2*sizeof(*a3)));}
+void m_glSamplerParameterfv_record(GLuint a0,GLenum a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC,&FunctionTable::m_ptr_glSamplerParameterfv>(a0,a1,a2);}
+void m_glBindBufferARB_record(GLenum a0,GLuint a1)const{this->template m_record<FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC,&FunctionTable::m_ptr_glBindBufferARB>(a0,a1);}
+void m_glVertexAttrib1sNV_record(GLuint a0,GLshort a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC,&FunctionTable::m_ptr_glVertexAttrib1sNV>(a0,a1);}
+void m_glGetMaterialiv_record(GLenum,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetMaterialiv");return (void)0;}
+void m_glUniform1fv_record(GLint a0,GLsizei a1,const GLfloat* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1FVPROC,&FunctionTable::m_ptr_glUniform1fv>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glBeginOcclusionQueryNV_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC,&FunctionTable::m_ptr_glBeginOcclusionQueryNV>(a0);}
+void m_glGenFencesAPPLE_record(GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGenFencesAPPLE");return (void)0;}
+void m_glScissorIndexedv_record(GLuint a0,const GLint* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC,&FunctionTable::m_ptr_glScissorIndexedv>(a0,a1);}
+void m_glDisableVariantClientStateEXT_record(GLuint a0)const{this->template m_record<FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC,&FunctionTable::m_ptr_glDisableVariantClientStateEXT>(a0);}
+void m_glMinmaxEXT_record(GLenum a0,GLenum a1,GLboolean a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMINMAXEXTPROC,&FunctionTable::m_ptr_glMinmaxEXT>(a0,a1,a2);}
+void m_glNormalPointervINTEL_record(GLenum a0,const void** a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC,&FunctionTable::m_ptr_glNormalPointervINTEL>(a0,a1);}
+void m_glNormal3s_record(GLshort a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3SPROC,&FunctionTable::m_ptr_glNormal3s>(a0,a1,a2);}
+void m_glGetnPixelMapuiv_record(GLenum,GLsizei,GLuint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetnPixelMapuiv");return (void)0;}
+void m_glNormalStream3bvATI_record(GLenum a0,const GLbyte* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC,&FunctionTable::m_ptr_glNormalStream3bvATI>(a0,a1);}
+void m_glGetObjectParameterivAPPLE_record(GLenum,GLuint,GLenum,GLint*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetObjectParameterivAPPLE");return (void)0;}
+void m_glNormal3i_record(GLint a0,GLint a1,GLint a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3IPROC,&FunctionTable::m_ptr_glNormal3i>(a0,a1,a2);}
+void m_glUniform1ivARB_record(GLint a0,GLsizei a1,const GLint* a2)const{this->template m_record<FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC,&FunctionTable::m_ptr_glUniform1ivARB>(a0,a1,this->m_copy(a2,a1,1*sizeof(*a2)));}
+void m_glNormal3d_record(GLdouble a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3DPROC,&FunctionTable::m_ptr_glNormal3d>(a0,a1,a2);}
+void m_glUpdateObjectBufferATI_record(GLuint a0,GLuint a1,GLsizei a2,const void* a3,GLenum a4)const{this->template m_record<FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC,&FunctionTable::m_ptr_glUpdateObjectBufferATI>(a0,a1,a2,a3,a4);}
+void m_glNormal3b_record(GLbyte a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLNORMAL3BPROC,&FunctionTable::m_ptr_glNormal3b>(a0,a1,a2);}
+GLint m_glGetUniformBufferSizeEXT_record(GLuint,GLint)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformBufferSizeEXT");return (GLint)0;}
+void m_glMultiTexCoord4dv_record(GLenum a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC,&FunctionTable::m_ptr_glMultiTexCoord4dv>(a0,a1);}
+void m_glProgramUniform3i64ARB_record(GLuint a0,GLint a1,GLint64 a2,GLint64 a3,GLint64 a4)const{this->template m_record<FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC,&FunctionTable::m_ptr_glProgramUniform3i64ARB>(a0,a1,a2,a3,a4);}
+void m_glVertexAttrib2d_record(GLuint a0,GLdouble a1,GLdouble a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC,&FunctionTable::m_ptr_glVertexAttrib2d>(a0,a1,a2);}
+void m_glVertexAttrib2f_record(GLuint a0,GLfloat a1,GLfloat a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC,&FunctionTable::m_ptr_glVertexAttrib2f>(a0,a1,a2);}
+void m_glMultiDrawElementsEXT_record(GLenum a0,const GLsizei* a1,GLenum a2,const void*const* a3,GLsizei a4)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC,&FunctionTable::m_ptr_glMultiDrawElementsEXT>(a0,a1,a2,a3,a4);}
+void m_glVertexAttrib3dv_record(GLuint a0,const GLdouble* a1)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC,&FunctionTable::m_ptr_glVertexAttrib3dv>(a0,a1);}
+void m_glMultiTexCoord2bOES_record(GLenum a0,GLbyte a1,GLbyte a2)const{this->template m_record<FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC,&FunctionTable::m_ptr_glMultiTexCoord2bOES>(a0,a1,a2);}
+void m_glVertexAttrib2s_record(GLuint a0,GLshort a1,GLshort a2)const{this->template m_record<FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC,&FunctionTable::m_ptr_glVertexAttrib2s>(a0,a1,a2);}
+void m_glTexImage3DMultisample_record(GLenum a0,GLsizei a1,GLenum a2,GLsizei a3,GLsizei a4,GLsizei a5,GLboolean a6)const{this->template m_record<FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC,&FunctionTable::m_ptr_glTexImage3DMultisample>(a0,a1,a2,a3,a4,a5,a6);}
+GLuint m_glGetUniformBlockIndex_record(GLuint,const GLchar*)const{this->m_printUnrecordableFunctionErrorAndExit("glGetUniformBlockIndex");return (GLuint)0;}
+GLboolean m_glReleaseKeyedMutexWin32EXT_record(GLuint,GLuint64)const{this->m_printUnrecordableFunctionErrorAndExit("glReleaseKeyedMutexWin32EXT");return (GLboolean)0;}
+void m_glFrontFace_record(GLenum a0)const{this->template m_record<FunctionTable::MEMBERPFNGLFRONTFACEPROC,&FunctionTable::m_ptr_glFrontFace>(a0);}
+void m_glEvalCoord1xOES_record(GLfixed a0)const{this->template m_record<FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC,&FunctionTable::m_ptr_glEvalCoord1xOES>(a0);}
+void m_glDrawArraysInstancedBaseInstance_record(GLenum a0,GLint a1,GLsizei a2,GLsizei a3,GLuint a4)const{this->template m_record<FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC,&FunctionTable::m_ptr_glDrawArraysInstancedBaseInstance>(a0,a1,a2,a3,a4);}
+GLboolean m_glIsPointInStrokePathNV_record(GLuint,GLfloat,GLfloat)const{this->m_printUnrecordableFunctionErrorAndExit("glIsPointInStrokePathNV");return (GLboolean)0;}
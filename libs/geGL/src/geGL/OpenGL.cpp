@@ -5,6 +5,7 @@
 #include<geGL/DSATableDecorator.h>
 #include<geGL/CapabilitiesTableDecorator.h>
 #include<geGL/TrapTableDecorator.h>
+#include<geGL/StateCacheTableDecorator.h>
 #include<geGL/OpenGLCapabilities.h>
 #include<geGL/OpenGLContext.h>
 
@@ -70,6 +71,27 @@ FunctionTablePointer ge::gl::createTable(FunctionLoaderInterfacePointer const&lo
   return table;
 }
 
+/**
+ * @brief Function creates OpenGL function table that eliminates redundant state changes
+ * Function table is decorated like createTable and then by StateCacheTableDecorator.
+ * Eliminated calls can be read using getStateCache(table)->getStateCacheStatistics().
+ *
+ * @param loader valid FunctionLoaderInterface that can load OpenGL functions
+ *
+ * @return OpenGLFunctionTable
+ */
+FunctionTablePointer ge::gl::createStateCacheTable(FunctionLoaderInterfacePointer const&loader){
+  auto table = std::make_shared<
+    StateCacheTableDecorator<
+    TrapTableDecorator<
+    CapabilitiesTableDecorator<
+    DSATableDecorator<
+    LoaderTableDecorator<
+    FunctionTable>>>>>>(loader);
+  table->construct();
+  return table;
+}
+
 /**
  * @brief Function creates Context instance
  *
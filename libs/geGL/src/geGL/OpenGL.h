@@ -19,6 +19,8 @@ namespace ge{
     GEGL_EXPORT void setDefaultFunctionTable(FunctionTablePointer const&table   );
     GEGL_EXPORT void setDefaultContext      (ContextPointer       const&provider);
     GEGL_EXPORT FunctionTablePointer createTable(FunctionLoaderInterfacePointer const&loader);
+    GEGL_EXPORT FunctionTablePointer createStateCacheTable(FunctionLoaderInterfacePointer const&loader);
+    GEGL_EXPORT FunctionTablePointer createProfileTable(FunctionLoaderInterfacePointer const&loader);
     GEGL_EXPORT ContextPointer createContext(FunctionTablePointer const&table = nullptr);
   }
 }
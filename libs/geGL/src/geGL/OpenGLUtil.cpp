@@ -437,6 +437,10 @@ std::string ge::gl::translateInternalFormat(GLenum internalFormat){
     case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:return "GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM";
     case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:return "GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT";
     case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:return "GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT";
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:return "GL_COMPRESSED_RGB_S3TC_DXT1_EXT";
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT";
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:return "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT";
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT";
     case GL_RGBA:return "GL_RGBA";
     case GL_RGB:return "GL_RGB";
     case GL_RG:return "GL_RG";
@@ -803,6 +807,10 @@ bool compressedInternalFormatTable(CompressedInternalFormatElement&info,GLenum i
     {GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM         ,"GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM","         ",GL_RGBA,false,CompressedInternalFormatElement::UNORM,},
     {GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT         ,"GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT","         ",GL_RGB ,false,CompressedInternalFormatElement::FLOAT,},
     {GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT       ,"GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT","       ",GL_RGB ,false,CompressedInternalFormatElement::FLOAT,},
+    {GL_COMPRESSED_RGB_S3TC_DXT1_EXT             ,"GL_COMPRESSED_RGB_S3TC_DXT1_EXT","             ",GL_RGB ,false,CompressedInternalFormatElement::UNORM,},
+    {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT            ,"GL_COMPRESSED_RGBA_S3TC_DXT1_EXT","            ",GL_RGBA,false,CompressedInternalFormatElement::UNORM,},
+    {GL_COMPRESSED_RGBA_S3TC_DXT3_EXT            ,"GL_COMPRESSED_RGBA_S3TC_DXT3_EXT","            ",GL_RGBA,false,CompressedInternalFormatElement::UNORM,},
+    {GL_COMPRESSED_RGBA_S3TC_DXT5_EXT            ,"GL_COMPRESSED_RGBA_S3TC_DXT5_EXT","            ",GL_RGBA,false,CompressedInternalFormatElement::UNORM,},
     {GL_COMPRESSED_RGB8_ETC2                     ,"GL_COMPRESSED_RGB8_ETC2","                     ",GL_RGB ,false,CompressedInternalFormatElement::UNORM,},
     {GL_COMPRESSED_SRGB8_ETC2                    ,"GL_COMPRESSED_SRGB8_ETC2","                    ",GL_RGB ,false,CompressedInternalFormatElement::UNORM,},
     {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 ,"GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2"," ",GL_RGB ,false,CompressedInternalFormatElement::UNORM,},
@@ -0,0 +1,45 @@
+#pragma once
+
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/Profiler.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator counts calls and measures wall time of every OpenGL entry point.
+     * It wraps all functions of decorated table, functions that are nullptr stay nullptr.
+     * Time of functions emulated by lower decorators includes time of nested calls.
+     * Table without this decorator is not affected at all.
+     */
+    template<typename T>
+      class ProfileTableDecorator: public T, public Profiler{
+        public:
+          template<typename...ARGS>
+            ProfileTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~ProfileTableDecorator(){}
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+#include<geGL/Generated/ProfileCalls.h>
+            return true;
+          }
+          /**
+           * @brief measures end of call also for functions that return void
+           */
+          struct Scope{
+            Scope(ProfileTableDecorator const*t,uint32_t f):table(t),function(f),begin(t->m_now()){}
+            ~Scope(){table->m_record(function,begin,table->m_now());}
+            ProfileTableDecorator const*table   ;
+            uint32_t                    function;
+            uint64_t                    begin   ;
+          };
+          template<typename PTR,typename...ARGS>
+            auto m_profile(uint32_t function,PTR next,ARGS...args)const{
+              Scope const scope(this,function);
+              return (this->*next)(args...);
+            }
+#include<geGL/Generated/ProfileImplementation.h>
+      };
+  }
+}
@@ -0,0 +1,223 @@
+#include<geGL/Profiler.h>
+#include<geGL/ProfileTableDecorator.h>
+#include<geGL/LoaderTableDecorator.h>
+#include<geGL/DSATableDecorator.h>
+#include<geGL/CapabilitiesTableDecorator.h>
+#include<geGL/TrapTableDecorator.h>
+#include<algorithm>
+#include<cassert>
+#include<cstring>
+#include<iostream>
+
+using namespace ge::gl;
+
+constexpr uint32_t Profiler::frameMarker;
+
+namespace{
+  char const*const functionNames[] = {
+#include<geGL/Generated/FunctionNames.h>
+  };
+
+  std::vector<Profiler::Entry>sorted(std::vector<Profiler::Entry>entries){
+    entries.erase(std::remove_if(entries.begin(),entries.end(),[](Profiler::Entry const&e){return e.calls == 0;}),entries.end());
+    std::sort(entries.begin(),entries.end(),[](Profiler::Entry const&a,Profiler::Entry const&b){return a.time > b.time;});
+    return entries;
+  }
+}
+
+/**
+ * @brief creates profiler with empty counters and disabled trace
+ */
+Profiler::Profiler():m_start(Clock::now()){
+  m_total.resize(GE_GL_NOF_OPENGL_FUNCTIONS);
+  for(uint32_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+    m_total[i].name = functionNames[i];
+  resetProfiler();
+}
+
+/**
+ * @brief destructor
+ */
+Profiler::~Profiler(){}
+
+/**
+ * @brief enables trace mode, last nofEvents calls are kept in ring buffer
+ *
+ * @param nofEvents capacity of ring buffer, 0 disables trace mode
+ */
+void Profiler::setTraceCapacity(size_t nofEvents)const{
+  assert(this!=nullptr);
+  m_trace.assign(nofEvents,Event{});
+  m_traceHead = 0;
+}
+
+/**
+ * @brief gets capacity of trace ring buffer
+ *
+ * @return number of events
+ */
+size_t Profiler::getTraceCapacity()const{
+  assert(this!=nullptr);
+  return m_trace.size();
+}
+
+/**
+ * @brief gets calls stored in ring buffer
+ *
+ * @return events from oldest to newest
+ */
+std::vector<Profiler::Event>Profiler::getTrace()const{
+  assert(this!=nullptr);
+  std::vector<Event>result;
+  if(m_trace.empty())return result;
+  auto const size  = m_trace.size();
+  auto const count = std::min<uint64_t>(m_traceHead,size);
+  result.reserve(count);
+  for(uint64_t i=m_traceHead-count;i<m_traceHead;++i)
+    result.push_back(m_trace[i % size]);
+  return result;
+}
+
+/**
+ * @brief finishes frame, counters of frame are moved into frame statistics and total statistics
+ */
+void Profiler::endFrame()const{
+  assert(this!=nullptr);
+  m_frame.clear();
+  for(uint32_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i){
+    if(m_calls[i] == 0)continue;
+    m_frame.push_back(Entry{functionNames[i],m_calls[i],m_times[i]});
+    m_total[i].calls += m_calls[i];
+    m_total[i].time  += m_times[i];
+  }
+  m_frame = sorted(m_frame);
+  std::memset(m_calls,0,sizeof(m_calls));
+  std::memset(m_times,0,sizeof(m_times));
+  m_nofFrames++;
+  if(!m_trace.empty()){
+    auto const now = m_now();
+    m_trace[m_traceHead % m_trace.size()] = Event{frameMarker,now,0};
+    m_traceHead++;
+  }
+}
+
+/**
+ * @brief gets number of finished frames
+ *
+ * @return number of endFrame calls
+ */
+size_t Profiler::getNofFrames()const{
+  assert(this!=nullptr);
+  return m_nofFrames;
+}
+
+/**
+ * @brief gets statistics of last finished frame
+ *
+ * @return called entry points sorted by time
+ */
+std::vector<Profiler::Entry>Profiler::getFrameStatistics()const{
+  assert(this!=nullptr);
+  return m_frame;
+}
+
+/**
+ * @brief gets statistics of all finished frames
+ *
+ * @return called entry points sorted by time
+ */
+std::vector<Profiler::Entry>Profiler::getTotalStatistics()const{
+  assert(this!=nullptr);
+  return sorted(m_total);
+}
+
+/**
+ * @brief writes statistics of last finished frame as JSON,
+ * times are in microseconds
+ *
+ * @param stream output stream
+ */
+void Profiler::writeFrameJSON(std::ostream&stream)const{
+  assert(this!=nullptr);
+  uint64_t calls = 0;
+  uint64_t time  = 0;
+  for(auto const&e:m_frame){
+    calls += e.calls;
+    time  += e.time ;
+  }
+  stream << "{\"frame\":" << m_nofFrames << ",\"calls\":" << calls << ",\"time\":" << time*1e-3 << ",\"functions\":[";
+  for(size_t i=0;i<m_frame.size();++i){
+    if(i)stream << ",";
+    stream << "{\"name\":\"" << m_frame[i].name << "\",\"calls\":" << m_frame[i].calls << ",\"time\":" << m_frame[i].time*1e-3 << "}";
+  }
+  stream << "]}";
+}
+
+/**
+ * @brief writes trace as Chrome trace event format (chrome://tracing, Perfetto)
+ *
+ * @param stream output stream
+ */
+void Profiler::writeChromeTrace(std::ostream&stream)const{
+  assert(this!=nullptr);
+  stream << "{\"traceEvents\":[";
+  bool first = true;
+  for(auto const&e:getTrace()){
+    if(!first)stream << ",";
+    first = false;
+    if(e.function == frameMarker)
+      stream << "{\"name\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":" << e.begin*1e-3 << "}";
+    else
+      stream << "{\"name\":\"" << functionNames[e.function] << "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" << e.begin*1e-3 << ",\"dur\":" << e.duration*1e-3 << "}";
+  }
+  stream << "],\"displayTimeUnit\":\"ns\"}";
+}
+
+/**
+ * @brief clears all counters, frame statistics and trace
+ */
+void Profiler::resetProfiler()const{
+  assert(this!=nullptr);
+  std::memset(m_calls,0,sizeof(m_calls));
+  std::memset(m_times,0,sizeof(m_times));
+  for(auto&e:m_total){
+    e.calls = 0;
+    e.time  = 0;
+  }
+  m_frame.clear();
+  m_nofFrames = 0;
+  m_traceHead = 0;
+}
+
+/**
+ * @brief gets name of entry point
+ *
+ * @param function index of entry point
+ *
+ * @return name of OpenGL function
+ */
+char const*Profiler::getFunctionName(uint32_t function){
+  if(function >= GE_GL_NOF_OPENGL_FUNCTIONS)return "frame";
+  return functionNames[function];
+}
+
+/**
+ * @brief Function creates OpenGL function table that profiles all calls
+ * Function table is decorated like createTable and then by ProfileTableDecorator.
+ * Statistics can be read using getProfiler(table).
+ *
+ * @param loader valid FunctionLoaderInterface that can load OpenGL functions
+ *
+ * @return OpenGLFunctionTable
+ */
+FunctionTablePointer ge::gl::createProfileTable(FunctionLoaderInterfacePointer const&loader){
+  auto table = std::make_shared<
+    ProfileTableDecorator<
+    TrapTableDecorator<
+    CapabilitiesTableDecorator<
+    DSATableDecorator<
+    LoaderTableDecorator<
+    FunctionTable>>>>>>(loader);
+  table->construct();
+  return table;
+}
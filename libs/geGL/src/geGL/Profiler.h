@@ -0,0 +1,82 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<chrono>
+#include<iosfwd>
+#include<vector>
+
+/**
+ * @brief Counters and call trace collected by ProfileTableDecorator.
+ * Every entry point has number of calls and accumulated wall time of current frame and of whole run.
+ * Optional trace mode stores last calls into ring buffer.
+ * Use getProfiler(table) to obtain profiler from function table.
+ */
+class GEGL_EXPORT ge::gl::Profiler{
+  public:
+    /**
+     * @brief statistics of one entry point
+     */
+    struct Entry{
+      char const*name        ;
+      uint64_t   calls    = 0;
+      uint64_t   time     = 0;///<wall time in nanoseconds
+    };
+    /**
+     * @brief one call in trace, times are in nanoseconds from creation of profiler
+     */
+    struct Event{
+      uint32_t function;///<index of entry point, frameMarker for end of frame
+      uint64_t begin   ;
+      uint64_t duration;
+    };
+    static constexpr uint32_t frameMarker = 0xffffffffu;
+    Profiler();
+    virtual ~Profiler();
+    void               setTraceCapacity    (size_t nofEvents)const;
+    size_t             getTraceCapacity    ()const;
+    std::vector<Event> getTrace            ()const;
+    void               endFrame            ()const;
+    size_t             getNofFrames        ()const;
+    std::vector<Entry> getFrameStatistics  ()const;
+    std::vector<Entry> getTotalStatistics  ()const;
+    void               writeFrameJSON      (std::ostream&stream)const;
+    void               writeChromeTrace    (std::ostream&stream)const;
+    void               resetProfiler       ()const;
+    static char const* getFunctionName     (uint32_t function);
+  protected:
+    using Clock = std::chrono::steady_clock;
+    uint64_t m_now()const{
+      return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count());
+    }
+    void m_record(uint32_t function,uint64_t begin,uint64_t end)const{
+      m_calls[function]++;
+      m_times[function] += end - begin;
+      if(m_trace.empty())return;
+      m_trace[m_traceHead % m_trace.size()] = Event{function,begin,end-begin};
+      m_traceHead++;
+    }
+    Clock::time_point          m_start                                    ;
+    mutable uint64_t           m_calls[GE_GL_NOF_OPENGL_FUNCTIONS]        ;///<calls of current frame
+    mutable uint64_t           m_times[GE_GL_NOF_OPENGL_FUNCTIONS]        ;///<time of current frame
+    mutable std::vector<Entry> m_frame                                    ;///<statistics of last finished frame
+    mutable std::vector<Entry> m_total                                    ;///<statistics of finished frames indexed by entry point
+    mutable size_t             m_nofFrames                          = 0   ;
+    mutable std::vector<Event> m_trace                                    ;///<ring buffer
+    mutable uint64_t           m_traceHead                          = 0   ;///<number of events written into ring buffer
+};
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief gets profiler of function table
+     *
+     * @param table function table
+     *
+     * @return profiler or nullptr if table is not decorated by ProfileTableDecorator
+     */
+    inline Profiler const*getProfiler(FunctionTablePointer const&table){
+      return dynamic_cast<Profiler const*>(table.get());
+    }
+  }
+}
@@ -6,14 +6,17 @@
 #include<iostream>
 #include<string>
 #include<limits>
-#include<sstream>
+#include<algorithm>
 //#include<GPUEngine/geCore/ErrorPrinter/ErrorPrinter.h>
 
 using namespace ge::gl;
 
 static bool printUniformWarnings = true;
 
-std::shared_ptr<ProgramInfo> const&Program::getInfo()const { return impl->info; }
+std::shared_ptr<ProgramInfo> const&Program::getInfo()const {
+  _ensureInfo();
+  return impl->info;
+}
 
 /**
  * @brief sets warning for setting non existing uniform 
@@ -141,7 +144,21 @@ void Program::link(ShaderPointers const&shaders){
   if(!getLinkStatus()){
     std::cerr<<getInfoLog()<<std::endl;
   }
-  _fillInfo();
+  _invalidateInfo();
+}
+
+/**
+ * @brief link program without waiting for driver.
+ * It does not query link status, reflection (getInfo) is filled lazily on first use.
+ * With KHR_parallel_shader_compile, getCompletionStatus can be used to poll the link.
+ *
+ * @param shaders optional vector of shaders (they can be compiled using Shader::compileDeferred)
+ */
+void Program::linkDeferred(ShaderPointers const&shaders){
+  assert(this!=nullptr);
+  attachShaders(shaders);
+  getContext().glLinkProgram(getId());
+  _invalidateInfo();
 }
 
 /**
@@ -184,6 +201,65 @@ GLint Program::getAttribLocation (std::string const&name)const{
   return getContext().glGetAttribLocation(getId(),name.c_str());
 }
 
+/**
+ * @brief resolves uniform variable, returned handle can be used in set functions
+ * without any string or map lookup
+ *
+ * @param name name of uniform variable
+ *
+ * @return handle of uniform variable, invalid handle if there is no such uniform
+ */
+UniformHandle Program::getUniformHandle(std::string const&name)const{
+  assert(this!=nullptr);
+  _ensureUniformInfo();
+  auto ii = impl->info->uniforms.find(name);
+  if(ii==impl->info->uniforms.end()){
+    if(printUniformWarnings)
+      throw std::invalid_argument("there is no such uniform: "+name);
+    return UniformHandle{};
+  }
+  UniformHandle result;
+  result.location = std::get<ProgramInfo::LOCATION>(ii->second);
+  result.type     = std::get<ProgramInfo::TYPE    >(ii->second);
+  result.size     = std::get<ProgramInfo::SIZE    >(ii->second);
+  return result;
+}
+
+/**
+ * @brief resolves uniform variable using hash of its name (see hashUniformName)
+ * This function does not allocate, it uses binary search over sorted hashes.
+ *
+ * @param nameHash hash of name of uniform variable
+ *
+ * @return handle of uniform variable, invalid handle if there is no such uniform
+ */
+UniformHandle Program::getUniformHandle(uint64_t nameHash)const{
+  assert(this!=nullptr);
+  _ensureUniformInfo();
+  auto ii = impl->info->uniforms.findHash(nameHash);
+  if(ii==impl->info->uniforms.end()){
+    if(printUniformWarnings)
+      throw std::invalid_argument("there is no uniform with hash: "+std::to_string(nameHash));
+    return UniformHandle{};
+  }
+  UniformHandle result;
+  result.location = std::get<ProgramInfo::LOCATION>(ii->second);
+  result.type     = std::get<ProgramInfo::TYPE    >(ii->second);
+  result.size     = std::get<ProgramInfo::SIZE    >(ii->second);
+  return result;
+}
+
+/**
+ * @brief gets completion status of linking, it does not block.
+ * It requires KHR_parallel_shader_compile.
+ *
+ * @return true if link has finished
+ */
+GLboolean Program::getCompletionStatus()const{
+  assert(this!=nullptr);
+  return (GLboolean)_getParam(GL_COMPLETION_STATUS_KHR);
+}
+
 /**
  * @brief gets delete status of shader program
  *
@@ -294,6 +370,52 @@ GLuint    Program::getBinaryLength()const{
   return _getParam(GL_PROGRAM_BINARY_LENGTH);
 }
 
+/**
+ * @brief gets binary representation of linked program
+ *
+ * @param format output binary format
+ *
+ * @return binary blob, it can be loaded using setBinary
+ */
+std::vector<uint8_t>Program::getBinary(GLenum&format)const{
+  assert(this!=nullptr);
+  std::vector<uint8_t>binary(getBinaryLength());
+  GLsizei length = 0;
+  getContext().glGetProgramBinary(getId(),(GLsizei)binary.size(),&length,&format,binary.data());
+  binary.resize(static_cast<size_t>(length));
+  return binary;
+}
+
+/**
+ * @brief loads program from binary instead of linking shaders
+ *
+ * @param format binary format obtained from getBinary
+ * @param binary binary blob
+ * @param length size of binary in bytes
+ *
+ * @return link status, driver can reject binary (e.g. after driver update)
+ */
+GLboolean Program::setBinary(GLenum format,void const*binary,GLsizei length){
+  assert(this!=nullptr);
+  create();
+  getContext().glProgramBinary(getId(),format,binary,length);
+  if(!getLinkStatus())return GL_FALSE;
+  _invalidateInfo();
+  return GL_TRUE;
+}
+
+/**
+ * @brief hints driver that binary of program will be retrieved.
+ * It has to be called before link.
+ *
+ * @param retrievable GL_TRUE if getBinary will be called
+ */
+void Program::setBinaryRetrievableHint(GLboolean retrievable){
+  assert(this!=nullptr);
+  create();
+  getContext().glProgramParameteri(getId(),GL_PROGRAM_BINARY_RETRIEVABLE_HINT,retrievable);
+}
+
 /**
  * @brief gets compute shaders work group size
  *
@@ -425,6 +547,7 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 #define GE_GL_PROGRAM_SET(fce,type,...)\
   assert(this!=nullptr);\
+  _ensureUniformInfo();\
   auto ii = impl->info->uniforms.find(name);\
   if(ii==impl->info->uniforms.end()){\
     if(printUniformWarnings)\
@@ -438,6 +561,7 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 #define GE_GL_PROGRAM_SETI(fce,type0,type1,...)\
   assert(this!=nullptr);\
+  _ensureUniformInfo();\
   auto ii = impl->info->uniforms.find(name);\
   if(ii==impl->info->uniforms.end()){\
     if(printUniformWarnings)\
@@ -453,6 +577,7 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 #define GE_GL_PROGRAM_SETV(fce,type)\
   assert(this!=nullptr);\
+  _ensureUniformInfo();\
   auto ii = impl->info->uniforms.find(name);\
   if(ii==impl->info->uniforms.end()){\
     if(printUniformWarnings)\
@@ -466,6 +591,7 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 #define GE_GL_PROGRAM_SETIV(fce,type0,type1)\
   assert(this!=nullptr);\
+  _ensureUniformInfo();\
   auto ii = impl->info->uniforms.find(name);\
   if(ii==impl->info->uniforms.end()){\
     if(printUniformWarnings)\
@@ -482,6 +608,7 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 #define GE_GL_PROGRAM_SETMATRIX(fce,type)\
   assert(this!=nullptr);\
+  _ensureUniformInfo();\
   auto ii = impl->info->uniforms.find(name);\
   if(ii==impl->info->uniforms.end()){\
     if(printUniformWarnings)\
@@ -664,48 +791,256 @@ Program const* Program::setMatrix2x3dv(std::string const&name,double const*v0,GL
   GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3dv,GL_DOUBLE_MAT2x3);
 }
 
+
+#define GE_GL_PROGRAM_HANDLE_SET(fce,uniformType,...)\
+  assert(this!=nullptr);\
+  if(uniform.location < 0)return this;\
+  assert(uniform.type == uniformType);\
+  getContext().fce(getId(),uniform.location,__VA_ARGS__);\
+  return this
+
+#define GE_GL_PROGRAM_HANDLE_SETI(fce,uniformType0,uniformType1,...)\
+  assert(this!=nullptr);\
+  if(uniform.location < 0)return this;\
+  assert(uniform.type == uniformType0 || uniform.type == uniformType1);\
+  getContext().fce(getId(),uniform.location,__VA_ARGS__);\
+  return this
+
+#define GE_GL_PROGRAM_HANDLE_SETV(fce,uniformType)\
+  assert(this!=nullptr);\
+  if(uniform.location < 0)return this;\
+  assert(uniform.type == uniformType);\
+  assert(count<=uniform.size);\
+  getContext().fce(getId(),uniform.location,count,v0);\
+  return this
+
+#define GE_GL_PROGRAM_HANDLE_SETIV(fce,uniformType0,uniformType1)\
+  assert(this!=nullptr);\
+  if(uniform.location < 0)return this;\
+  assert(uniform.type == uniformType0 || uniform.type == uniformType1);\
+  assert(count<=uniform.size);\
+  getContext().fce(getId(),uniform.location,count,v0);\
+  return this
+
+#define GE_GL_PROGRAM_HANDLE_SETMATRIX(fce,uniformType)\
+  assert(this!=nullptr);\
+  if(uniform.location < 0)return this;\
+  assert(uniform.type == uniformType);\
+  assert(count<=uniform.size);\
+  getContext().fce(getId(),uniform.location,count,transpose,v0);\
+  return this
+
+Program const* Program::set1f(UniformHandle const&uniform,float v0)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform1f,GL_FLOAT,v0);
+}
+
+Program const* Program::set2f(UniformHandle const&uniform,float v0,float v1)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform2f,GL_FLOAT_VEC2,v0,v1);
+}
+
+Program const* Program::set3f(UniformHandle const&uniform,float v0,float v1,float v2)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform3f,GL_FLOAT_VEC3,v0,v1,v2);
+}
+
+Program const* Program::set4f(UniformHandle const&uniform,float v0,float v1,float v2,float v3)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform4f,GL_FLOAT_VEC4,v0,v1,v2,v3);
+}
+
+Program const* Program::set1i(UniformHandle const&uniform,int32_t v0)const{
+  GE_GL_PROGRAM_HANDLE_SETI(glProgramUniform1i,GL_INT,GL_BOOL,v0);
+}
+
+Program const* Program::set2i(UniformHandle const&uniform,int32_t v0,int32_t v1)const{
+  GE_GL_PROGRAM_HANDLE_SETI(glProgramUniform2i,GL_INT_VEC2,GL_BOOL_VEC2,v0,v1);
+}
+
+Program const* Program::set3i(UniformHandle const&uniform,int32_t v0,int32_t v1,int32_t v2)const{
+  GE_GL_PROGRAM_HANDLE_SETI(glProgramUniform3i,GL_INT_VEC3,GL_BOOL_VEC3,v0,v1,v2);
+}
+
+Program const* Program::set4i(UniformHandle const&uniform,int32_t v0,int32_t v1,int32_t v2,int32_t v3)const{
+  GE_GL_PROGRAM_HANDLE_SETI(glProgramUniform4i,GL_INT_VEC4,GL_BOOL_VEC4,v0,v1,v2,v3);
+}
+
+Program const* Program::set1ui(UniformHandle const&uniform,uint32_t v0)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform1ui,GL_UNSIGNED_INT,v0);
+}
+
+Program const* Program::set2ui(UniformHandle const&uniform,uint32_t v0,uint32_t v1)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform2ui,GL_UNSIGNED_INT_VEC2,v0,v1);
+}
+
+Program const* Program::set3ui(UniformHandle const&uniform,uint32_t v0,uint32_t v1,uint32_t v2)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform3ui,GL_UNSIGNED_INT_VEC3,v0,v1,v2);
+}
+
+Program const* Program::set4ui(UniformHandle const&uniform,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3)const{
+  GE_GL_PROGRAM_HANDLE_SET(glProgramUniform4ui,GL_UNSIGNED_INT_VEC4,v0,v1,v2,v3);
+}
+
+Program const* Program::set1fv(UniformHandle const&uniform,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform1fv,GL_FLOAT);
+}
+
+Program const* Program::set2fv(UniformHandle const&uniform,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform2fv,GL_FLOAT_VEC2);
+}
+
+Program const* Program::set3fv(UniformHandle const&uniform,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform3fv,GL_FLOAT_VEC3);
+}
+
+Program const* Program::set4fv(UniformHandle const&uniform,float const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform4fv,GL_FLOAT_VEC4);
+}
+
+Program const* Program::set1iv(UniformHandle const&uniform,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETIV(glProgramUniform1iv,GL_INT,GL_BOOL);
+}
+
+Program const* Program::set2iv(UniformHandle const&uniform,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETIV(glProgramUniform2iv,GL_INT_VEC2,GL_BOOL_VEC2);
+}
+
+Program const* Program::set3iv(UniformHandle const&uniform,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETIV(glProgramUniform3iv,GL_INT_VEC3,GL_BOOL_VEC3);
+}
+
+Program const* Program::set4iv(UniformHandle const&uniform,int32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETIV(glProgramUniform4iv,GL_INT_VEC4,GL_BOOL_VEC4);
+}
+
+Program const* Program::set1uiv(UniformHandle const&uniform,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform1uiv,GL_UNSIGNED_INT);
+}
+
+Program const* Program::set2uiv(UniformHandle const&uniform,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform2uiv,GL_UNSIGNED_INT_VEC2);
+}
+
+Program const* Program::set3uiv(UniformHandle const&uniform,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform3uiv,GL_UNSIGNED_INT_VEC3);
+}
+
+Program const* Program::set4uiv(UniformHandle const&uniform,uint32_t const*v0,GLsizei count)const{
+  GE_GL_PROGRAM_HANDLE_SETV(glProgramUniform4uiv,GL_UNSIGNED_INT_VEC4);
+}
+
+Program const* Program::setMatrix4fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4fv,GL_FLOAT_MAT4);
+}
+
+Program const* Program::setMatrix3fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3fv,GL_FLOAT_MAT3);
+}
+
+Program const* Program::setMatrix2fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2fv,GL_FLOAT_MAT2);
+}
+
+Program const* Program::setMatrix4x3fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4x3fv,GL_FLOAT_MAT4x3);
+}
+
+Program const* Program::setMatrix4x2fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4x2fv,GL_FLOAT_MAT4x2);
+}
+
+Program const* Program::setMatrix3x4fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3x4fv,GL_FLOAT_MAT3x4);
+}
+
+Program const* Program::setMatrix3x2fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3x2fv,GL_FLOAT_MAT3x2);
+}
+
+Program const* Program::setMatrix2x4fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2x4fv,GL_FLOAT_MAT2x4);
+}
+
+Program const* Program::setMatrix2x3fv(UniformHandle const&uniform,float const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2x3fv,GL_FLOAT_MAT2x3);
+}
+
+Program const* Program::setMatrix4dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4dv,GL_DOUBLE_MAT4);
+}
+
+Program const* Program::setMatrix3dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3dv,GL_DOUBLE_MAT3);
+}
+
+Program const* Program::setMatrix2dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2dv,GL_DOUBLE_MAT2);
+}
+
+Program const* Program::setMatrix4x3dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4x3dv,GL_DOUBLE_MAT4x3);
+}
+
+Program const* Program::setMatrix4x2dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix4x2dv,GL_DOUBLE_MAT4x2);
+}
+
+Program const* Program::setMatrix3x4dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3x4dv,GL_DOUBLE_MAT3x4);
+}
+
+Program const* Program::setMatrix3x2dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix3x2dv,GL_DOUBLE_MAT3x2);
+}
+
+Program const* Program::setMatrix2x4dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2x4dv,GL_DOUBLE_MAT2x4);
+}
+
+Program const* Program::setMatrix2x3dv(UniformHandle const&uniform,double const*v0,GLsizei count,GLboolean transpose)const{
+  GE_GL_PROGRAM_HANDLE_SETMATRIX(glProgramUniformMatrix2x3dv,GL_DOUBLE_MAT2x3);
+}
+
 GLint Program::_getUniform(std::string name){
   assert(this!=nullptr);
+  _ensureUniformInfo();
   auto ii = impl->info->uniforms.find(name);
   if(ii==impl->info->uniforms.end())
     return -1;
   return std::get<ProgramInfo::LOCATION>(ii->second);
 }
 
-void Program::_fillUniformInfo(){
+void Program::_fillUniformInfo()const{
   assert(this!=nullptr);
   GLint nofUniforms = getNofActiveUniforms();
   GLint longestUniform = getActiveUniformMaxLength();
-  GLchar*buffer = new GLchar[longestUniform+1];
-  assert(buffer!=nullptr);
+  std::vector<GLchar>buffer(static_cast<size_t>(longestUniform)+1);
+  std::string uniformNameWithIndexing;
   for(GLint i=0;i<nofUniforms;++i){
     GLenum type;
     GLint size;
     std::string name;
     GLint location;
     GLsizei length;
-    getContext().glGetActiveUniform(getId(),i,longestUniform,&length,&size,&type,buffer);
-    name = _chopIndexingInPropertyName(std::string(buffer));
+    getContext().glGetActiveUniform(getId(),i,longestUniform,&length,&size,&type,buffer.data());
+    name = _chopIndexingInPropertyName(std::string(buffer.data()));
     location = getUniformLocation(name);
     impl->info->uniforms[name] = ProgramInfo::Properties(location,type,name,size);
     //add all variants name[0], name[1], ...
+    //elements of array of basic type have consecutive locations,
+    //so there is no need to ask driver for every element
     for(GLint s=0;s<size;++s){
-      std::stringstream ss;
-      ss << name << "[";
-      ss << s;
-      ss << "]";
-      std::string uniformNameWithIndexing = ss.str();
+      uniformNameWithIndexing = name;
+      uniformNameWithIndexing += '[';
+      uniformNameWithIndexing += std::to_string(s);
+      uniformNameWithIndexing += ']';
       impl->info->uniforms[uniformNameWithIndexing] = ProgramInfo::Properties(
-          getUniformLocation(uniformNameWithIndexing),
+          location < 0 ? location : location + s,
           type,
           uniformNameWithIndexing,
           1);
     }
   }
-  delete[]buffer;
 }
 
-void Program::_fillAttribInfo(){
+void Program::_fillAttribInfo()const{
   assert(this!=nullptr);
   GLint nofAttribs = getNofActiveAttributes();
   GLint longestAttrib = getActiveAttributeMaxLength();
@@ -725,21 +1060,27 @@ void Program::_fillAttribInfo(){
   delete[]buffer;
 }
 
-void Program::_fillBufferInfo(){
+void Program::_fillBufferInfo()const{
   assert(this!=nullptr);
-  GLuint nofBuffers = getInterfaceParam(GL_SHADER_STORAGE_BLOCK,GL_ACTIVE_RESOURCES);
+  _fillBufferInfo(impl->info->buffers      ,GL_SHADER_STORAGE_BLOCK);
+  _fillBufferInfo(impl->info->uniformBlocks,GL_UNIFORM_BLOCK       );
+}
+
+void Program::_fillBufferInfo(ProgramInfo::BufferTable&buffers,GLenum interf)const{
+  assert(this!=nullptr);
+  GLuint nofBuffers = getInterfaceParam(interf,GL_ACTIVE_RESOURCES);
   for(GLuint i=0;i<nofBuffers;++i){
-    std::string name = _chopIndexingInPropertyName(getResourceName(GL_SHADER_STORAGE_BLOCK,i));
-    GLint binding            = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_BUFFER_BINDING                      ,i);
-    GLint dataSize           = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_BUFFER_DATA_SIZE                    ,i);
-    GLint nofActiveVariables = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_NUM_ACTIVE_VARIABLES                ,i);
-    GLint vertex             = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_VERTEX_SHADER         ,i);
-    GLint control            = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_TESS_CONTROL_SHADER   ,i);
-    GLint evaluation         = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_TESS_EVALUATION_SHADER,i);
-    GLint geometry           = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_GEOMETRY_SHADER       ,i);
-    GLint fragment           = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_FRAGMENT_SHADER       ,i);
-    GLint compute            = getResourceParam(GL_SHADER_STORAGE_BLOCK,GL_REFERENCED_BY_COMPUTE_SHADER        ,i);
-    impl->info->buffers[name] = ProgramInfo::BufferProperties(
+    std::string name = _chopIndexingInPropertyName(getResourceName(interf,i));
+    GLint binding            = getResourceParam(interf,GL_BUFFER_BINDING                      ,i);
+    GLint dataSize           = getResourceParam(interf,GL_BUFFER_DATA_SIZE                    ,i);
+    GLint nofActiveVariables = getResourceParam(interf,GL_NUM_ACTIVE_VARIABLES                ,i);
+    GLint vertex             = getResourceParam(interf,GL_REFERENCED_BY_VERTEX_SHADER         ,i);
+    GLint control            = getResourceParam(interf,GL_REFERENCED_BY_TESS_CONTROL_SHADER   ,i);
+    GLint evaluation         = getResourceParam(interf,GL_REFERENCED_BY_TESS_EVALUATION_SHADER,i);
+    GLint geometry           = getResourceParam(interf,GL_REFERENCED_BY_GEOMETRY_SHADER       ,i);
+    GLint fragment           = getResourceParam(interf,GL_REFERENCED_BY_FRAGMENT_SHADER       ,i);
+    GLint compute            = getResourceParam(interf,GL_REFERENCED_BY_COMPUTE_SHADER        ,i);
+    buffers[name] = ProgramInfo::BufferProperties(
         name,
         binding,
         dataSize,
@@ -753,10 +1094,42 @@ void Program::_fillBufferInfo(){
   }
 }
 
-void Program::_fillInfo(){
+void Program::_invalidateInfo()const{
   assert(this!=nullptr);
+  impl->info->attribs      .clear();
+  impl->info->uniforms     .clear();
+  impl->info->buffers      .clear();
+  impl->info->uniformBlocks.clear();
+  impl->uniformsPending = true;
+  impl->attribsPending  = true;
+  impl->buffersPending  = true;
+}
+
+void Program::_ensureInfo()const{
+  assert(this!=nullptr);
+  _ensureUniformInfo();
+  _ensureAttribInfo ();
+  _ensureBufferInfo ();
+}
+
+void Program::_ensureUniformInfo()const{
+  assert(this!=nullptr);
+  if(!impl->uniformsPending)return;
+  impl->uniformsPending = false;
   _fillUniformInfo();
+}
+
+void Program::_ensureAttribInfo()const{
+  assert(this!=nullptr);
+  if(!impl->attribsPending)return;
+  impl->attribsPending = false;
   _fillAttribInfo();
+}
+
+void Program::_ensureBufferInfo()const{
+  assert(this!=nullptr);
+  if(!impl->buffersPending)return;
+  impl->buffersPending = false;
   _fillBufferInfo();
 }
 
@@ -771,6 +1144,7 @@ GLuint const Program::nonExistingBufferBinding = std::numeric_limits<GLuint>::ma
 
 GLuint Program::getBufferBinding(std::string const&name)const{
   assert(this != nullptr);
+  _ensureBufferInfo();
   auto ii = impl->info->buffers.find(name);
   if(ii == impl->info->buffers.end()){
     throw std::invalid_argument("there is no such buffer: "+name);
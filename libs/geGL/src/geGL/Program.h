@@ -8,6 +8,37 @@
 #include<geGL/Shader.h>
 #include<geGL/ProgramInfo.h>
 
+namespace ge{
+  namespace gl{
+    /**
+     * @brief pre-resolved uniform variable, see Program::getUniformHandle.
+     * Setting uniform through handle does not perform any string hashing,
+     * map lookup or allocation.
+     * Handle is valid until the program is relinked.
+     */
+    struct UniformHandle{
+      GLint  location = -1;
+      GLenum type     =  0;
+      GLint  size     =  0;
+      bool isValid()const{return location >= 0;}
+    };
+
+    /**
+     * @brief hash of uniform name, it can be evaluated at compile time.
+     * It is the same hash that is used by ProgramInfoTable.
+     *
+     * @param name name of uniform variable
+     *
+     * @return hash of name
+     */
+    constexpr uint64_t hashUniformName(char const*name){
+      size_t size = 0;
+      while(name[size])++size;
+      return hashResourceName(name,size);
+    }
+  }
+}
+
 class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   public:
     using ShaderPointer  = std::shared_ptr<Shader>;
@@ -21,11 +52,13 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
 	void attachShaders(ShaderPointers const&shaders = {});
 	void detachShaders(ShaderPointers const&shaders = {});
 	void link         (ShaderPointers const&shaders = {});
+	void linkDeferred (ShaderPointers const&shaders = {});
 	GLboolean isProgram()const;
 	void use ()const;
 	void validate()const;
 	GLboolean   getDeleteStatus                     ()const;
 	GLboolean   getLinkStatus                       ()const;
+	GLboolean   getCompletionStatus                 ()const;
 	GLboolean   getValidateStatus                   ()const;
 	GLuint      getInfoLogLength                    ()const;
 	GLuint      getNofShaders                       ()const;
@@ -35,6 +68,9 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
 	GLuint      getNofActiveUniforms                ()const;
 	GLuint      getActiveUniformMaxLength           ()const;
 	GLuint      getBinaryLength                     ()const;
+	std::vector<uint8_t>getBinary(GLenum&format)const;
+	GLboolean   setBinary(GLenum format,void const*binary,GLsizei length);
+	void        setBinaryRetrievableHint(GLboolean retrievable = GL_TRUE);
 	GLenum      getTransformFeedbackBufferMode      ()const;
 	GLuint      getNofTransfromFeedbackVaryings     ()const;
 	GLuint      getTransformFeedbackVaryingMaxLength()const;
@@ -45,6 +81,8 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
 	void        getComputeWorkGroupSize(GLint*x                                )const;
 	GLint       getUniformLocation     (std::string const&name                 )const;
 	GLint       getAttribLocation      (std::string const&name                 )const;
+	UniformHandle getUniformHandle     (std::string const&name                 )const;
+	UniformHandle getUniformHandle     (uint64_t           nameHash             )const;
 	GLint       getInterfaceParam      (GLenum interf,GLenum pname             )const;
 	std::string getResourceName        (GLenum interf,GLuint index             )const;
 	GLint       getResourceParam       (GLenum interf,GLenum pname,GLuint index)const;
@@ -90,6 +128,48 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   Program const*setMatrix3x2dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
   Program const*setMatrix2x4dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
   Program const*setMatrix2x3dv(std::string const&name,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*set1f         (UniformHandle const&uniform,float    v0                                                       )const;
+  Program const*set2f         (UniformHandle const&uniform,float    v0,float    v1                                           )const;
+  Program const*set3f         (UniformHandle const&uniform,float    v0,float    v1,float    v2                               )const;
+  Program const*set4f         (UniformHandle const&uniform,float    v0,float    v1,float    v2,float    v3                   )const;
+  Program const*set1i         (UniformHandle const&uniform,int32_t  v0                                                       )const;
+  Program const*set2i         (UniformHandle const&uniform,int32_t  v0,int32_t  v1                                           )const;
+  Program const*set3i         (UniformHandle const&uniform,int32_t  v0,int32_t  v1,int32_t  v2                               )const;
+  Program const*set4i         (UniformHandle const&uniform,int32_t  v0,int32_t  v1,int32_t  v2,int32_t  v3                   )const;
+  Program const*set1ui        (UniformHandle const&uniform,uint32_t v0                                                       )const;
+  Program const*set2ui        (UniformHandle const&uniform,uint32_t v0,uint32_t v1                                           )const;
+  Program const*set3ui        (UniformHandle const&uniform,uint32_t v0,uint32_t v1,uint32_t v2                               )const;
+  Program const*set4ui        (UniformHandle const&uniform,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3                   )const;
+  Program const*set1fv        (UniformHandle const&uniform,float    const*v0,GLsizei count = 1                               )const;
+  Program const*set2fv        (UniformHandle const&uniform,float    const*v0,GLsizei count = 1                               )const;
+  Program const*set3fv        (UniformHandle const&uniform,float    const*v0,GLsizei count = 1                               )const;
+  Program const*set4fv        (UniformHandle const&uniform,float    const*v0,GLsizei count = 1                               )const;
+  Program const*set1iv        (UniformHandle const&uniform,int32_t  const*v0,GLsizei count = 1                               )const;
+  Program const*set2iv        (UniformHandle const&uniform,int32_t  const*v0,GLsizei count = 1                               )const;
+  Program const*set3iv        (UniformHandle const&uniform,int32_t  const*v0,GLsizei count = 1                               )const;
+  Program const*set4iv        (UniformHandle const&uniform,int32_t  const*v0,GLsizei count = 1                               )const;
+  Program const*set1uiv       (UniformHandle const&uniform,uint32_t const*v0,GLsizei count = 1                               )const;
+  Program const*set2uiv       (UniformHandle const&uniform,uint32_t const*v0,GLsizei count = 1                               )const;
+  Program const*set3uiv       (UniformHandle const&uniform,uint32_t const*v0,GLsizei count = 1                               )const;
+  Program const*set4uiv       (UniformHandle const&uniform,uint32_t const*v0,GLsizei count = 1                               )const;
+  Program const*setMatrix4fv  (UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3fv  (UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2fv  (UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix4x3fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix4x2fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3x4fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3x2fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2x4fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2x3fv(UniformHandle const&uniform,float    const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix4dv  (UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3dv  (UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2dv  (UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix4x3dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix4x2dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3x4dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix3x2dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2x4dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
+  Program const*setMatrix2x3dv(UniformHandle const&uniform,double   const*v0,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
   void set(std::string const&name,float    v0                                    );
   void set(std::string const&name,float    v0,float    v1                        );
   void set(std::string const&name,float    v0,float    v1,float    v2            );
@@ -141,10 +221,15 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
 	ProgramImpl*impl = nullptr;
 	GLint _getUniform(std::string name);
 	GLint _getParam(GLenum pname)const;
-    void _fillUniformInfo();
-    void _fillAttribInfo();
-    void _fillBufferInfo();
-    void _fillInfo();
+    void _fillUniformInfo()const;
+    void _fillAttribInfo()const;
+    void _fillBufferInfo()const;
+    void _fillBufferInfo(ProgramInfo::BufferTable&buffers,GLenum interf)const;
+    void _invalidateInfo()const;
+    void _ensureInfo()const;
+    void _ensureUniformInfo()const;
+    void _ensureAttribInfo()const;
+    void _ensureBufferInfo()const;
     std::string _chopIndexingInPropertyName(std::string name)const;
     friend class Shader;
 };
@@ -0,0 +1,152 @@
+#include<geGL/ProgramBatch.h>
+#include<geGL/Program.h>
+#include<geGL/OpenGLContext.h>
+#include<cassert>
+#include<cstring>
+
+using namespace ge::gl;
+
+class ge::gl::ProgramBatchImpl{
+  public:
+    struct Entry{
+      std::shared_ptr<Program>program        ;
+      Program::ShaderPointers shaders        ;
+      bool                    ready = false  ;///<cached completion status
+    };
+    ProgramBatchImpl(FunctionTablePointer const&table,GLuint maxThreads):gl(table){
+      GLint nofExtensions = 0;
+      gl.glGetIntegerv(GL_NUM_EXTENSIONS,&nofExtensions);
+      bool khr = false;
+      bool arb = false;
+      for(GLint i=0;i<nofExtensions;++i){
+        auto const extension = reinterpret_cast<char const*>(gl.glGetStringi(GL_EXTENSIONS,i));
+        if(!extension)continue;
+        if(std::strcmp(extension,"GL_KHR_parallel_shader_compile") == 0)khr = true;
+        if(std::strcmp(extension,"GL_ARB_parallel_shader_compile") == 0)arb = true;
+      }
+      parallel = khr || arb;
+      if(khr)     gl.glMaxShaderCompilerThreadsKHR(maxThreads);
+      else if(arb)gl.glMaxShaderCompilerThreadsARB(maxThreads);
+    }
+    bool isReady(Entry&entry)const{
+      if(entry.ready)return true;
+      entry.ready = !parallel || entry.program->getCompletionStatus();
+      return entry.ready;
+    }
+    Context           gl              ;
+    bool              parallel = false;
+    std::vector<Entry>entries         ;
+};
+
+/**
+ * @brief creates batch of programs
+ *
+ * @param maxThreads number of driver compiler threads (glMaxShaderCompilerThreadsKHR)
+ */
+ProgramBatch::ProgramBatch(GLuint maxThreads):ProgramBatch(nullptr,maxThreads){}
+
+/**
+ * @brief creates batch of programs
+ *
+ * @param table opengl function table
+ * @param maxThreads number of driver compiler threads (glMaxShaderCompilerThreadsKHR)
+ */
+ProgramBatch::ProgramBatch(
+    FunctionTablePointer const&table     ,
+    GLuint                     maxThreads){
+  impl = new ProgramBatchImpl(table,maxThreads);
+}
+
+/**
+ * @brief destructor
+ */
+ProgramBatch::~ProgramBatch(){
+  delete impl;
+}
+
+/**
+ * @brief submits compilation of shaders and linking of program, it does not block
+ *
+ * @param stages shader stages of program
+ *
+ * @return program, it is usable after isReady() or wait()
+ */
+std::shared_ptr<Program>ProgramBatch::add(ShaderStages const&stages){
+  assert(this!=nullptr);
+  auto const table = impl->gl.getFunctionTable();
+  ProgramBatchImpl::Entry entry;
+  for(auto const&stage:stages){
+    auto shader = std::make_shared<Shader>(table);
+    shader->create(stage.type);
+    shader->compileDeferred(stage.sources);
+    entry.shaders.push_back(shader);
+  }
+  entry.program = std::make_shared<Program>(table,Program::ShaderPointers{});
+  entry.program->linkDeferred(entry.shaders);
+  impl->entries.push_back(entry);
+  return entry.program;
+}
+
+/**
+ * @brief is KHR_parallel_shader_compile (or ARB variant) supported
+ *
+ * @return true if completion status can be polled
+ */
+bool ProgramBatch::isParallel()const{
+  assert(this!=nullptr);
+  return impl->parallel;
+}
+
+/**
+ * @brief are all programs compiled and linked, it does not block.
+ * Without KHR_parallel_shader_compile it always returns true
+ * and first status query of program waits for driver.
+ *
+ * @return true if all programs are ready
+ */
+bool ProgramBatch::isReady()const{
+  assert(this!=nullptr);
+  return getNofReady() == getNofPrograms();
+}
+
+/**
+ * @brief gets number of programs that are ready, it does not block
+ *
+ * @return number of ready programs
+ */
+size_t ProgramBatch::getNofReady()const{
+  assert(this!=nullptr);
+  size_t result = 0;
+  for(auto&entry:impl->entries)
+    result += impl->isReady(entry);
+  return result;
+}
+
+/**
+ * @brief gets number of programs in batch
+ *
+ * @return number of programs
+ */
+size_t ProgramBatch::getNofPrograms()const{
+  assert(this!=nullptr);
+  return impl->entries.size();
+}
+
+/**
+ * @brief waits for all programs and prints logs of failed shaders and programs
+ *
+ * @return true if all programs were linked successfully
+ */
+bool ProgramBatch::wait()const{
+  assert(this!=nullptr);
+  bool result = true;
+  for(auto&entry:impl->entries){
+    entry.ready = true;
+    if(entry.program->getLinkStatus())continue;
+    result = false;
+    for(auto const&shader:entry.shaders)
+      if(!shader->getCompileStatus())std::cerr<<shader->getInfoLog()<<std::endl;
+    std::cerr<<entry.program->getInfoLog()<<std::endl;
+  }
+  return result;
+}
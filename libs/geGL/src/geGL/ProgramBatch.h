@@ -0,0 +1,32 @@
+#pragma once
+
+#include<geGL/Shader.h>
+#include<memory>
+#include<vector>
+
+/**
+ * @brief Group of programs that are compiled and linked without blocking.
+ * All shaders and programs are submitted to driver first, no compile or link
+ * status is queried. With KHR_parallel_shader_compile the driver compiles them
+ * on its worker threads and isReady() polls GL_COMPLETION_STATUS_KHR,
+ * so loading screen can overlap compilation with other work (e.g. asset I/O).
+ * Reflection of programs (Program::getInfo) is filled lazily on first use.
+ */
+class GEGL_EXPORT ge::gl::ProgramBatch{
+  public:
+    static GLuint const allThreads = 0xFFFFFFFFu;///<driver chooses number of compiler threads
+    ProgramBatch(GLuint maxThreads = allThreads);
+    ProgramBatch(
+        FunctionTablePointer const&table                 ,
+        GLuint                     maxThreads = allThreads);
+    ~ProgramBatch();
+    std::shared_ptr<Program>add(ShaderStages const&stages);
+    bool   isParallel    ()const;
+    bool   isReady       ()const;
+    size_t getNofReady   ()const;
+    size_t getNofPrograms()const;
+    bool   wait          ()const;
+    ProgramBatch(ProgramBatch const&) = delete;
+  private:
+    ProgramBatchImpl*impl = nullptr;
+};
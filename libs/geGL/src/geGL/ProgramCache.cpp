@@ -0,0 +1,212 @@
+#include<geGL/ProgramCache.h>
+#include<geGL/Program.h>
+#include<geGL/OpenGLContext.h>
+#include<cassert>
+#include<chrono>
+#include<cstdio>
+#include<cstring>
+#include<fstream>
+#include<iterator>
+#include<sstream>
+
+using namespace ge::gl;
+
+namespace{
+  char     const magic[8] = {'G','E','G','L','P','R','G','1'};
+  uint64_t const fnvBasis = 14695981039346656037ull;
+
+  uint64_t fnv1a(uint64_t hash,void const*data,size_t size){
+    auto const bytes = static_cast<uint8_t const*>(data);
+    for(size_t i=0;i<size;++i){
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  template<typename T>
+  uint64_t fnv1a(uint64_t hash,T const&value){
+    return fnv1a(hash,&value,sizeof(T));
+  }
+
+  uint64_t fnv1a(uint64_t hash,std::string const&str){
+    hash = fnv1a(hash,static_cast<uint64_t>(str.size()));
+    return fnv1a(hash,str.data(),str.size());
+  }
+
+  double elapsed(std::chrono::high_resolution_clock::time_point const&start){
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  }
+}
+
+class ge::gl::ProgramCacheImpl{
+  public:
+    ProgramCacheImpl(FunctionTablePointer const&table,std::string const&directory):
+      gl(table),directory(directory){}
+    std::string const&getDriver(){
+      if(!driver.empty())return driver;
+      for(auto const&name:{GL_VENDOR,GL_RENDERER,GL_VERSION}){
+        auto const str = gl.glGetString(name);
+        if(str)driver += reinterpret_cast<char const*>(str);
+        driver += "\n";
+      }
+      return driver;
+    }
+    bool load(uint64_t key,std::shared_ptr<Program>const&program,std::string const&fileName){
+      std::ifstream file(fileName,std::ios::binary);
+      if(!file.is_open())return false;
+      char     fileMagic[sizeof(magic)];
+      uint64_t fileKey;
+      uint32_t format ;
+      file.read(fileMagic,sizeof(fileMagic));
+      file.read(reinterpret_cast<char*>(&fileKey),sizeof(fileKey));
+      file.read(reinterpret_cast<char*>(&format ),sizeof(format ));
+      if(!file || std::memcmp(fileMagic,magic,sizeof(magic)) != 0 || fileKey != key)return false;
+      std::vector<char>binary{std::istreambuf_iterator<char>(file),std::istreambuf_iterator<char>()};
+      if(binary.empty())return false;
+      return program->setBinary(format,binary.data(),static_cast<GLsizei>(binary.size())) == GL_TRUE;
+    }
+    void store(uint64_t key,std::shared_ptr<Program>const&program,std::string const&fileName){
+      GLenum format = 0;
+      auto const binary = program->getBinary(format);
+      if(binary.empty())return;
+      auto const tmpName = fileName + ".tmp";
+      {
+        std::ofstream file(tmpName,std::ios::binary);
+        if(!file.is_open())return;
+        uint32_t const fileFormat = format;
+        file.write(magic,sizeof(magic));
+        file.write(reinterpret_cast<char const*>(&key       ),sizeof(key       ));
+        file.write(reinterpret_cast<char const*>(&fileFormat),sizeof(fileFormat));
+        file.write(reinterpret_cast<char const*>(binary.data()),static_cast<std::streamsize>(binary.size()));
+        if(!file)return;
+      }
+      //rename makes partially written files invisible for other processes
+      std::remove(fileName.c_str());
+      std::rename(tmpName.c_str(),fileName.c_str());
+    }
+    Context                  gl        ;
+    std::string              directory ;
+    std::string              driver    ;///<vendor, renderer and version strings
+    ProgramCache::Statistics statistics;
+};
+
+/**
+ * @brief creates program cache
+ *
+ * @param directory existing directory where binaries are stored
+ */
+ProgramCache::ProgramCache(std::string const&directory):ProgramCache(nullptr,directory){}
+
+/**
+ * @brief creates program cache
+ *
+ * @param table opengl function table
+ * @param directory existing directory where binaries are stored
+ */
+ProgramCache::ProgramCache(
+    FunctionTablePointer const&table    ,
+    std::string          const&directory){
+  impl = new ProgramCacheImpl(table,directory);
+}
+
+/**
+ * @brief destructor
+ */
+ProgramCache::~ProgramCache(){
+  delete impl;
+}
+
+/**
+ * @brief gets linked program, it is loaded from binary if it is possible
+ *
+ * @param stages shader stages of program
+ *
+ * @return linked program
+ */
+std::shared_ptr<Program>ProgramCache::get(Stages const&stages){
+  assert(this!=nullptr);
+  auto const key      = getKey(stages);
+  auto const fileName = getFileName(key);
+  auto const table    = impl->gl.getFunctionTable();
+
+  auto start = std::chrono::high_resolution_clock::now();
+  auto program = std::make_shared<Program>(table,Program::ShaderPointers{});
+  bool const found = std::ifstream(fileName).good();
+  if(found && impl->load(key,program,fileName)){
+    impl->statistics.loadTime += elapsed(start);
+    impl->statistics.hits++;
+    return program;
+  }
+  if(found)impl->statistics.rejected++;
+  impl->statistics.misses++;
+
+  start = std::chrono::high_resolution_clock::now();
+  program = std::make_shared<Program>(table,Program::ShaderPointers{});
+  Program::ShaderPointers shaders;
+  for(auto const&stage:stages)
+    shaders.push_back(std::make_shared<Shader>(table,stage.type,stage.sources));
+  program->setBinaryRetrievableHint();
+  program->link(shaders);
+  impl->statistics.compileTime += elapsed(start);
+
+  if(!program->getLinkStatus())return program;
+
+  start = std::chrono::high_resolution_clock::now();
+  impl->store(key,program,fileName);
+  impl->statistics.storeTime += elapsed(start);
+  return program;
+}
+
+/**
+ * @brief computes key of program
+ *
+ * @param stages shader stages of program
+ *
+ * @return hash of driver strings, shader types and shader sources
+ */
+uint64_t ProgramCache::getKey(Stages const&stages)const{
+  assert(this!=nullptr);
+  auto hash = fnv1a(fnvBasis,impl->getDriver());
+  for(auto const&stage:stages){
+    hash = fnv1a(hash,stage.type);
+    hash = fnv1a(hash,static_cast<uint64_t>(stage.sources.size()));
+    for(auto const&source:stage.sources)
+      hash = fnv1a(hash,source);
+  }
+  return hash;
+}
+
+/**
+ * @brief gets name of file that stores binary of program
+ *
+ * @param key key of program
+ *
+ * @return file name
+ */
+std::string ProgramCache::getFileName(uint64_t key)const{
+  assert(this!=nullptr);
+  std::stringstream ss;
+  ss << impl->directory << "/" << std::hex << key << ".glprogram";
+  return ss.str();
+}
+
+/**
+ * @brief gets statistics of cache
+ *
+ * @return hits, misses and timing
+ */
+ProgramCache::Statistics const&ProgramCache::getStatistics()const{
+  assert(this!=nullptr);
+  return impl->statistics;
+}
+
+/**
+ * @brief gets directory of cache
+ *
+ * @return directory
+ */
+std::string const&ProgramCache::getDirectory()const{
+  assert(this!=nullptr);
+  return impl->directory;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include<geGL/Shader.h>
+#include<memory>
+#include<string>
+#include<vector>
+
+/**
+ * @brief On-disk cache of linked programs.
+ * Programs are identified by hash of shader types, shader sources and
+ * vendor/renderer/version strings of the driver.
+ * Cache hit loads program using glProgramBinary, cache miss (or binary rejected
+ * by driver) compiles and links shaders and stores glGetProgramBinary blob.
+ */
+class GEGL_EXPORT ge::gl::ProgramCache{
+  public:
+    using Stage  = ShaderStage ;
+    using Stages = ShaderStages;
+    /**
+     * @brief cache statistics, times are in seconds
+     */
+    struct Statistics{
+      size_t hits        = 0 ;///<programs loaded from binary
+      size_t misses      = 0 ;///<programs compiled from sources
+      size_t rejected    = 0 ;///<binaries that were found but rejected by driver
+      double loadTime    = 0.;///<time spent by loading binaries
+      double compileTime = 0.;///<time spent by compiling and linking
+      double storeTime   = 0.;///<time spent by retrieving and writing binaries
+    };
+    ProgramCache(std::string const&directory);
+    ProgramCache(
+        FunctionTablePointer const&table    ,
+        std::string          const&directory);
+    ~ProgramCache();
+    std::shared_ptr<Program>get(Stages const&stages);
+    uint64_t           getKey       (Stages const&stages)const;
+    std::string        getFileName  (uint64_t key       )const;
+    Statistics  const& getStatistics()const;
+    std::string const& getDirectory ()const;
+    ProgramCache(ProgramCache const&) = delete;
+  private:
+    ProgramCacheImpl*impl = nullptr;
+};
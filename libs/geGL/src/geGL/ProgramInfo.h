@@ -1,18 +1,192 @@
 #pragma once
 
 #include<geGL/OpenGL.h>
+#include<algorithm>
+#include<cstring>
 #include<vector>
 #include<map>
 #include<set>
+#include<stdexcept>
+#include<string>
 #include<tuple>
 #include<iostream>
 
 namespace ge{
   namespace gl{
     class ProgramInfo;
+    template<typename VALUE>
+      class ProgramInfoTable;
+
+    /**
+     * @brief hash of name of program resource, it processes 8 characters per step.
+     * It can be evaluated at compile time.
+     *
+     * @param name name of resource
+     * @param size length of name
+     *
+     * @return hash of name
+     */
+    constexpr uint64_t hashResourceName(char const*name,size_t size){
+      uint64_t hash = 14695981039346656037ull ^ size;
+      size_t i = 0;
+      for(;;i+=8){
+        uint64_t word = 0;
+        for(size_t j=0;j<8 && i+j<size;++j)
+          word |= static_cast<uint64_t>(static_cast<uint8_t>(name[i+j])) << (8*j);
+        hash  = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 29;
+        if(i+8 >= size)break;
+      }
+      return hash;
+    }
   }
 }
 
+/**
+ * @brief Flat lookup table of program resources (name -> properties).
+ * It has the same query surface as std::map (find, count, at, operator[], iteration),
+ * but entries are stored in one array in insertion order.
+ * Names are interned into one contiguous pool and their hashes are precomputed.
+ * Lookup uses open addressing (linear probing) over array of entry indices,
+ * it compares precomputed hashes first and string only on hash match.
+ * The hash is hashResourceName, the same as ge::gl::hashUniformName.
+ */
+template<typename VALUE>
+class ge::gl::ProgramInfoTable{
+  public:
+    using key_type       = std::string;
+    using mapped_type    = VALUE;
+    using value_type     = std::pair<std::string,VALUE>;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+    /**
+     * @brief runtime version of hashResourceName that loads 8 characters at once
+     *
+     * @param name name of resource
+     *
+     * @return hash of name
+     */
+    static uint64_t hash(std::string const&name){
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ || defined(_WIN32)
+      auto const data = name.data();
+      auto const size = name.size();
+      uint64_t result = 14695981039346656037ull ^ size;
+      size_t i = 0;
+      for(;;i+=8){
+        uint64_t word = 0;
+        std::memcpy(&word,data+i,std::min<size_t>(8,size-i));
+        result  = (result ^ word) * 0x9e3779b97f4a7c15ull;
+        result ^= result >> 29;
+        if(i+8 >= size)break;
+      }
+      return result;
+#else
+      return hashResourceName(name.data(),name.size());
+#endif
+    }
+    iterator find(std::string const&name){
+      return entries.begin() + (m_find(name,hash(name)) - entries.cbegin());
+    }
+    const_iterator find(std::string const&name)const{
+      return m_find(name,hash(name));
+    }
+    /**
+     * @brief finds entry with given hash of name without string compare
+     *
+     * @param nameHash hash of name
+     *
+     * @return iterator to entry or end()
+     */
+    const_iterator findHash(uint64_t nameHash)const{
+      if(slots.empty())return entries.end();
+      for(size_t slot = nameHash & (slots.size()-1);slots[slot] != 0;slot = (slot+1) & (slots.size()-1)){
+        auto const index = slots[slot]-1;
+        if(hashes[index] == nameHash)return entries.begin() + index;
+      }
+      return entries.end();
+    }
+    size_t count(std::string const&name)const{
+      return find(name) != end();
+    }
+    VALUE&at(std::string const&name){
+      auto ii = find(name);
+      if(ii == end())throw std::out_of_range("there is no such resource: "+name);
+      return ii->second;
+    }
+    VALUE const&at(std::string const&name)const{
+      auto ii = find(name);
+      if(ii == end())throw std::out_of_range("there is no such resource: "+name);
+      return ii->second;
+    }
+    VALUE&operator[](std::string const&name){
+      auto const h = hash(name);
+      auto ii = m_find(name,h);
+      if(ii != entries.end())return entries[static_cast<size_t>(ii - entries.begin())].second;
+      hashes.push_back(h);
+      names .push_back(Name{static_cast<uint32_t>(pool.size()),static_cast<uint32_t>(name.size())});
+      pool  += name;
+      entries.emplace_back(name,VALUE());
+      if(entries.size()*2 > slots.size())m_rehash(entries.size()*4);
+      else m_insertSlot(entries.size()-1);
+      return entries.back().second;
+    }
+    void reserve(size_t n){
+      hashes .reserve(n);
+      names  .reserve(n);
+      entries.reserve(n);
+      if(n*2 > slots.size())m_rehash(n*4);
+    }
+    void clear(){
+      hashes .clear();
+      names  .clear();
+      pool   .clear();
+      entries.clear();
+      slots  .clear();
+    }
+    size_t         size ()const{return entries.size ();}
+    bool           empty()const{return entries.empty();}
+    iterator       begin()     {return entries.begin();}
+    iterator       end  ()     {return entries.end  ();}
+    const_iterator begin()const{return entries.begin();}
+    const_iterator end  ()const{return entries.end  ();}
+  private:
+    /**
+     * @brief interned name, it points into pool
+     */
+    struct Name{
+      uint32_t offset;
+      uint32_t size  ;
+    };
+    void m_insertSlot(size_t index){
+      size_t slot = hashes[index] & (slots.size()-1);
+      while(slots[slot] != 0)slot = (slot+1) & (slots.size()-1);
+      slots[slot] = static_cast<uint32_t>(index+1);
+    }
+    void m_rehash(size_t minSize){
+      size_t size = 16;
+      while(size < minSize)size *= 2;
+      slots.assign(size,0);
+      for(size_t i=0;i<entries.size();++i)
+        m_insertSlot(i);
+    }
+    const_iterator m_find(std::string const&name,uint64_t h)const{
+      if(slots.empty())return entries.end();
+      for(size_t slot = h & (slots.size()-1);slots[slot] != 0;slot = (slot+1) & (slots.size()-1)){
+        auto const index = slots[slot]-1;
+        if(hashes[index] != h)continue;
+        auto const&n = names[index];
+        if(n.size == name.size() && std::memcmp(pool.data()+n.offset,name.data(),n.size) == 0)
+          return entries.begin() + index;
+      }
+      return entries.end();
+    }
+    std::vector<uint32_t  >slots  ;///<open addressing table, index of entry + 1, 0 is empty slot
+    std::vector<uint64_t  >hashes ;///<precomputed hashes of names
+    std::vector<Name      >names  ;///<interned names
+    std::string            pool   ;///<characters of all names stored contiguously
+    std::vector<value_type>entries;///<entries in insertion order
+};
+
 class ge::gl::ProgramInfo{
   public:
     using Properties = 
@@ -66,9 +240,14 @@ class ge::gl::ProgramInfo{
       SUBROUTINE_UNIFORM_INDEX      = 4,
     };
 
-    std::map<std::string,Properties                 >attribs           ;
-    std::map<std::string,Properties                 >uniforms          ;
-    std::map<std::string,BufferProperties           >buffers           ;
-    std::map<std::string,SubroutineUniformProperties>subroutineUniforms;
+    using Table           = ProgramInfoTable<Properties                 >;
+    using BufferTable     = ProgramInfoTable<BufferProperties           >;
+    using SubroutineTable = ProgramInfoTable<SubroutineUniformProperties>;
+
+    Table           attribs           ;
+    Table           uniforms          ;
+    BufferTable     buffers           ;
+    BufferTable     uniformBlocks     ;
+    SubroutineTable subroutineUniforms;
 
 };
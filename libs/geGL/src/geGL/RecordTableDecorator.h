@@ -0,0 +1,71 @@
+#pragma once
+
+#include<new>
+#include<tuple>
+#include<utility>
+#include<iostream>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/CommandList.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator records OpenGL calls into CommandList instead of executing them.
+     * It does not need OpenGL context so it can be used by worker threads,
+     * every thread has to use its own table.
+     * Functions that return values (glGet*, glGen*, glCreate*, glReadPixels, glMapBuffer, ...)
+     * cannot be recorded and they terminate the application like TrapTableDecorator.
+     * Data passed to glUniform*v, glProgramUniform*v, glUniformMatrix*v, glProgramUniformMatrix*v,
+     * gl(Named)Buffer(Sub)Data are copied into the command list, so callers can pass temporaries.
+     * Other pointer arguments are recorded as pointers, pointed data have to stay valid until replay
+     * (CommandList::store can copy them into the command list).
+     */
+    template<typename T>
+      class RecordTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            RecordTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~RecordTableDecorator(){}
+          mutable CommandList commandList;
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+#include<geGL/Generated/RecordCalls.h>
+            return true;
+          }
+          void m_printUnrecordableFunctionErrorAndExit(std::string fceName)const{
+            std::cerr<<"ERROR: function: "<<fceName<<" cannot be recorded"<<std::endl;
+            std::exit(1);
+          }
+          template<typename PTR,PTR FunctionTable::*MEMBER,typename...ARGS>
+            void m_record(ARGS...args)const{
+              using Arguments = std::tuple<ARGS...>;
+              static_assert(alignof(Arguments) <= CommandList::alignment,"arguments of command are overaligned");
+              auto const data = commandList.allocateCommand(&RecordTableDecorator::m_replay<PTR,MEMBER,ARGS...>,sizeof(Arguments));
+              new(data)Arguments(args...);
+            }
+          template<typename D,typename N>
+            D*m_copy(D*data,N count,size_t elementSize)const{
+              if(data == nullptr || count <= 0)return data;
+              return static_cast<D*>(commandList.store(data,static_cast<size_t>(count)*elementSize));
+            }
+          template<typename PTR,PTR FunctionTable::*MEMBER,typename...ARGS>
+            static void m_replay(FunctionTable const&table,void const*data){
+              m_call<PTR,MEMBER>(table,*static_cast<std::tuple<ARGS...>const*>(data),std::index_sequence_for<ARGS...>{});
+            }
+          template<typename PTR,PTR FunctionTable::*MEMBER,typename TUPLE,size_t...I>
+            static void m_call(FunctionTable const&table,TUPLE const&args,std::index_sequence<I...>){
+              (table.*(table.*MEMBER))(std::get<I>(args)...);
+            }
+#include<geGL/Generated/RecordImplementation.h>
+      };
+
+    /**
+     * @brief Function creates function table that records commands
+     *
+     * @return recording function table
+     */
+    GEGL_EXPORT std::shared_ptr<RecordTableDecorator<FunctionTable>>createRecordTable();
+  }
+}
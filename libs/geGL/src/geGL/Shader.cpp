@@ -116,6 +116,19 @@ void Shader::compile(Sources const& sources){
   }
 }
 
+/**
+ * @brief this function sets shader source code and starts compilation.
+ * It does not query compile status so driver can compile shaders in parallel
+ * (KHR_parallel_shader_compile). Programs using this shader are not relinked.
+ *
+ * @param sources optional source codes
+ */
+void Shader::compileDeferred(Sources const& sources){
+  assert(this!=nullptr);
+  if(sources.size()>0)this->setSource(sources);
+  this->getContext().glCompileShader(this->getId());
+}
+
 /**
  * @brief function returns true if object represents valid shader
  *
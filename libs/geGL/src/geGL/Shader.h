@@ -4,9 +4,23 @@
 #include<iostream>
 #include<vector>
 #include<set>
+#include<string>
 #include<memory>
 #include<cassert>
 
+namespace ge{
+  namespace gl{
+    /**
+     * @brief description of one shader of program - type and source codes
+     */
+    struct ShaderStage{
+      GLenum                   type   ;///<GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, ...
+      std::vector<std::string> sources;///<source codes of shader
+    };
+    using ShaderStages = std::vector<ShaderStage>;
+  }
+}
+
 class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   friend class Program;
   public:
@@ -23,6 +37,7 @@ class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   void        create(GLenum type);
   void        setSource(Sources const& sources = {});
   void        compile  (Sources const& sources = {});
+  void        compileDeferred(Sources const& sources = {});
   GLboolean   isShader        ()const;
   GLenum      getType         ()const;
   GLboolean   getDeleteStatus ()const;
@@ -0,0 +1,385 @@
+#pragma once
+
+#include<unordered_map>
+#include<geGL/OpenGLFunctionTable.h>
+
+#define GE_GL_STATE_CACHE(name)\
+  if(this->m_ptr_##name){\
+    this->m_next_##name = this->m_ptr_##name;\
+    this->m_ptr_##name  =\
+      (decltype(FunctionTable::m_ptr_##name))\
+        &StateCacheTableDecorator::m_##name##_cache;\
+  }
+
+#define GE_GL_STATE_CACHE_NEXT(name)\
+  decltype(FunctionTable::m_ptr_##name)m_next_##name = nullptr
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief counters of StateCacheTableDecorator
+     */
+    struct StateCacheStatistics{
+      /**
+       * @brief counter of one kind of state
+       */
+      struct Counter{
+        size_t forwarded  = 0;///<calls that changed state and were passed to driver
+        size_t eliminated = 0;///<calls that did not change state and were dropped
+      };
+      Counter program    ;///<glUseProgram
+      Counter vertexArray;///<glBindVertexArray
+      Counter texture    ;///<glActiveTexture, glBindTexture, glBindTextureUnit
+      Counter buffer     ;///<glBindBuffer, glBindBufferBase, glBindBufferRange
+      Counter capability ;///<glEnable, glDisable
+      Counter polygonMode;///<glPolygonMode
+      size_t getNofEliminated()const{
+        return program.eliminated + vertexArray.eliminated + texture.eliminated + buffer.eliminated + capability.eliminated + polygonMode.eliminated;
+      }
+      size_t getNofForwarded()const{
+        return program.forwarded + vertexArray.forwarded + texture.forwarded + buffer.forwarded + capability.forwarded + polygonMode.forwarded;
+      }
+    };
+
+    /**
+     * @brief interface of state cache that does not depend on decorated type
+     * (use getStateCache(table) to obtain it from function table).
+     */
+    class StateCache{
+      public:
+        virtual ~StateCache(){}
+        /**
+         * @brief forgets all shadowed state.
+         * It has to be called when state was changed behind the function table
+         * (different function table, third party library, ...).
+         */
+        virtual void                        invalidateStateCache()const = 0;
+        virtual StateCacheStatistics const& getStateCacheStatistics()const = 0;
+        virtual void                        resetStateCacheStatistics()const = 0;
+    };
+
+    /**
+     * @brief gets state cache of function table
+     *
+     * @param table function table
+     *
+     * @return state cache or nullptr if table is not decorated by StateCacheTableDecorator
+     */
+    inline StateCache const*getStateCache(FunctionTablePointer const&table){
+      return dynamic_cast<StateCache const*>(table.get());
+    }
+
+    /**
+     * @brief This decorator shadows binding and enable state of context
+     * (program in use, vertex array, texture units, buffer bindings, capabilities and polygon mode)
+     * and drops calls that would not change it.
+     * Shadowed state starts unknown, so the first call of every binding is always forwarded.
+     * Function table has to be used by one context only.
+     */
+    template<typename T>
+      class StateCacheTableDecorator: public T, public StateCache{
+        public:
+          template<typename...ARGS>
+            StateCacheTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~StateCacheTableDecorator(){}
+          virtual void invalidateStateCache()const override{
+            m_programKnown     = false;
+            m_vertexArrayKnown = false;
+            m_activeKnown      = false;
+            m_frontKnown       = false;
+            m_backKnown        = false;
+            m_textures      .clear();
+            m_textureUnits  .clear();
+            m_buffers       .clear();
+            m_indexedBuffers.clear();
+            m_capabilities  .clear();
+          }
+          virtual StateCacheStatistics const&getStateCacheStatistics()const override{
+            return m_statistics;
+          }
+          virtual void resetStateCacheStatistics()const override{
+            m_statistics = StateCacheStatistics{};
+          }
+        protected:
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            GE_GL_STATE_CACHE(glUseProgram       );
+            GE_GL_STATE_CACHE(glBindVertexArray  );
+            GE_GL_STATE_CACHE(glDeleteVertexArrays);
+            GE_GL_STATE_CACHE(glActiveTexture    );
+            GE_GL_STATE_CACHE(glBindTexture      );
+            GE_GL_STATE_CACHE(glBindTextureUnit  );
+            GE_GL_STATE_CACHE(glBindTextures     );
+            GE_GL_STATE_CACHE(glDeleteTextures   );
+            GE_GL_STATE_CACHE(glBindBuffer       );
+            GE_GL_STATE_CACHE(glBindBufferBase   );
+            GE_GL_STATE_CACHE(glBindBufferRange  );
+            GE_GL_STATE_CACHE(glBindBuffersBase  );
+            GE_GL_STATE_CACHE(glBindBuffersRange );
+            GE_GL_STATE_CACHE(glDeleteBuffers    );
+            GE_GL_STATE_CACHE(glEnable           );
+            GE_GL_STATE_CACHE(glDisable          );
+            GE_GL_STATE_CACHE(glEnablei          );
+            GE_GL_STATE_CACHE(glDisablei         );
+            GE_GL_STATE_CACHE(glPolygonMode      );
+            invalidateStateCache();
+            return true;
+          }
+          static uint64_t m_key(GLuint a,GLenum b){
+            return (uint64_t(a)<<32) | uint64_t(b);
+          }
+          struct IndexedBuffer{
+            GLuint     buffer;
+            GLintptr   offset;
+            GLsizeiptr size  ;///<-1 means whole buffer (glBindBufferBase)
+          };
+
+          void m_glUseProgram_cache(GLuint program)const{
+            if(m_programKnown && m_program == program){
+              m_statistics.program.eliminated++;
+              return;
+            }
+            m_statistics.program.forwarded++;
+            m_programKnown = true;
+            m_program      = program;
+            (this->*m_next_glUseProgram)(program);
+          }
+
+          void m_glBindVertexArray_cache(GLuint array)const{
+            if(m_vertexArrayKnown && m_vertexArray == array){
+              m_statistics.vertexArray.eliminated++;
+              return;
+            }
+            m_statistics.vertexArray.forwarded++;
+            m_vertexArrayKnown = true;
+            m_vertexArray      = array;
+            //element array buffer binding is part of vertex array state
+            m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+            (this->*m_next_glBindVertexArray)(array);
+          }
+          void m_glDeleteVertexArrays_cache(GLsizei n,GLuint const*arrays)const{
+            for(GLsizei i=0;i<n;++i)
+              if(m_vertexArrayKnown && m_vertexArray == arrays[i]){
+                m_vertexArray = 0;
+                m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+              }
+            (this->*m_next_glDeleteVertexArrays)(n,arrays);
+          }
+
+          void m_glActiveTexture_cache(GLenum texture)const{
+            if(m_activeKnown && m_active == texture){
+              m_statistics.texture.eliminated++;
+              return;
+            }
+            m_statistics.texture.forwarded++;
+            m_activeKnown = true;
+            m_active      = texture;
+            (this->*m_next_glActiveTexture)(texture);
+          }
+          void m_glBindTexture_cache(GLenum target,GLuint texture)const{
+            if(m_activeKnown){
+              auto const unit = m_active - GL_TEXTURE0;
+              auto const it   = m_textures.find(m_key(unit,target));
+              if(it != m_textures.end() && it->second == texture){
+                m_statistics.texture.eliminated++;
+                return;
+              }
+              m_textures[m_key(unit,target)] = texture;
+              m_textureUnits.erase(unit);
+            }else{
+              m_textures    .clear();
+              m_textureUnits.clear();
+            }
+            m_statistics.texture.forwarded++;
+            (this->*m_next_glBindTexture)(target,texture);
+          }
+          void m_glBindTextureUnit_cache(GLuint unit,GLuint texture)const{
+            auto const it = m_textureUnits.find(unit);
+            if(it != m_textureUnits.end() && it->second == texture){
+              m_statistics.texture.eliminated++;
+              return;
+            }
+            m_statistics.texture.forwarded++;
+            m_textureUnits[unit] = texture;
+            //target of texture is unknown, all targets of unit are forgotten
+            m_forgetUnit(unit);
+            (this->*m_next_glBindTextureUnit)(unit,texture);
+          }
+          void m_glBindTextures_cache(GLuint first,GLsizei count,GLuint const*textures)const{
+            for(GLsizei i=0;i<count;++i){
+              m_textureUnits.erase(first+i);
+              m_forgetUnit(first+i);
+            }
+            m_statistics.texture.forwarded++;
+            (this->*m_next_glBindTextures)(first,count,textures);
+          }
+          void m_glDeleteTextures_cache(GLsizei n,GLuint const*textures)const{
+            for(GLsizei i=0;i<n;++i){
+              m_eraseValue(m_textures    ,textures[i]);
+              m_eraseValue(m_textureUnits,textures[i]);
+            }
+            (this->*m_next_glDeleteTextures)(n,textures);
+          }
+          void m_forgetUnit(GLuint unit)const{
+            for(auto it = m_textures.begin();it != m_textures.end();)
+              if(GLuint(it->first>>32) == unit)it = m_textures.erase(it);
+              else ++it;
+          }
+
+          void m_glBindBuffer_cache(GLenum target,GLuint buffer)const{
+            auto const it = m_buffers.find(target);
+            if(it != m_buffers.end() && it->second == buffer){
+              m_statistics.buffer.eliminated++;
+              return;
+            }
+            m_statistics.buffer.forwarded++;
+            m_buffers[target] = buffer;
+            (this->*m_next_glBindBuffer)(target,buffer);
+          }
+          void m_glBindBufferBase_cache(GLenum target,GLuint index,GLuint buffer)const{
+            if(!m_bindIndexed(target,index,buffer,0,-1))return;
+            (this->*m_next_glBindBufferBase)(target,index,buffer);
+          }
+          void m_glBindBufferRange_cache(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{
+            if(!m_bindIndexed(target,index,buffer,offset,size))return;
+            (this->*m_next_glBindBufferRange)(target,index,buffer,offset,size);
+          }
+          void m_glBindBuffersBase_cache(GLenum target,GLuint first,GLsizei count,GLuint const*buffers)const{
+            for(GLsizei i=0;i<count;++i)
+              m_indexedBuffers.erase(m_key(first+i,target));
+            m_buffers.erase(target);
+            m_statistics.buffer.forwarded++;
+            (this->*m_next_glBindBuffersBase)(target,first,count,buffers);
+          }
+          void m_glBindBuffersRange_cache(GLenum target,GLuint first,GLsizei count,GLuint const*buffers,GLintptr const*offsets,GLsizeiptr const*sizes)const{
+            for(GLsizei i=0;i<count;++i)
+              m_indexedBuffers.erase(m_key(first+i,target));
+            m_buffers.erase(target);
+            m_statistics.buffer.forwarded++;
+            (this->*m_next_glBindBuffersRange)(target,first,count,buffers,offsets,sizes);
+          }
+          void m_glDeleteBuffers_cache(GLsizei n,GLuint const*buffers)const{
+            for(GLsizei i=0;i<n;++i){
+              m_eraseValue(m_buffers,buffers[i]);
+              for(auto it = m_indexedBuffers.begin();it != m_indexedBuffers.end();)
+                if(it->second.buffer == buffers[i])it = m_indexedBuffers.erase(it);
+                else ++it;
+            }
+            (this->*m_next_glDeleteBuffers)(n,buffers);
+          }
+          bool m_bindIndexed(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{
+            auto const key = m_key(index,target);
+            auto const it  = m_indexedBuffers.find(key);
+            auto const general = m_buffers.find(target);
+            if(it      != m_indexedBuffers.end() &&
+               general != m_buffers       .end() &&
+               it->second.buffer == buffer       &&
+               it->second.offset == offset       &&
+               it->second.size   == size         &&
+               general->second   == buffer       ){
+              m_statistics.buffer.eliminated++;
+              return false;
+            }
+            m_statistics.buffer.forwarded++;
+            m_indexedBuffers[key] = IndexedBuffer{buffer,offset,size};
+            //indexed binding also binds generic binding point
+            m_buffers[target] = buffer;
+            return true;
+          }
+
+          void m_glEnable_cache(GLenum cap)const{
+            if(!m_setCapability(cap,true))return;
+            (this->*m_next_glEnable)(cap);
+          }
+          void m_glDisable_cache(GLenum cap)const{
+            if(!m_setCapability(cap,false))return;
+            (this->*m_next_glDisable)(cap);
+          }
+          void m_glEnablei_cache(GLenum target,GLuint index)const{
+            m_capabilities.erase(target);
+            m_statistics.capability.forwarded++;
+            (this->*m_next_glEnablei)(target,index);
+          }
+          void m_glDisablei_cache(GLenum target,GLuint index)const{
+            m_capabilities.erase(target);
+            m_statistics.capability.forwarded++;
+            (this->*m_next_glDisablei)(target,index);
+          }
+          bool m_setCapability(GLenum cap,bool enabled)const{
+            auto const it = m_capabilities.find(cap);
+            if(it != m_capabilities.end() && it->second == enabled){
+              m_statistics.capability.eliminated++;
+              return false;
+            }
+            m_statistics.capability.forwarded++;
+            m_capabilities[cap] = enabled;
+            return true;
+          }
+
+          void m_glPolygonMode_cache(GLenum face,GLenum mode)const{
+            bool const front = face == GL_FRONT || face == GL_FRONT_AND_BACK;
+            bool const back  = face == GL_BACK  || face == GL_FRONT_AND_BACK;
+            bool const same  =
+              (!front || (m_frontKnown && m_front == mode)) &&
+              (!back  || (m_backKnown  && m_back  == mode)) &&
+              (front  || back);
+            if(same){
+              m_statistics.polygonMode.eliminated++;
+              return;
+            }
+            m_statistics.polygonMode.forwarded++;
+            if(front){m_frontKnown = true;m_front = mode;}
+            if(back ){m_backKnown  = true;m_back  = mode;}
+            (this->*m_next_glPolygonMode)(face,mode);
+          }
+
+          template<typename MAP>
+            static void m_eraseValue(MAP&map,GLuint value){
+              for(auto it = map.begin();it != map.end();)
+                if(it->second == value)it = map.erase(it);
+                else ++it;
+            }
+
+          GE_GL_STATE_CACHE_NEXT(glUseProgram       );
+          GE_GL_STATE_CACHE_NEXT(glBindVertexArray  );
+          GE_GL_STATE_CACHE_NEXT(glDeleteVertexArrays);
+          GE_GL_STATE_CACHE_NEXT(glActiveTexture    );
+          GE_GL_STATE_CACHE_NEXT(glBindTexture      );
+          GE_GL_STATE_CACHE_NEXT(glBindTextureUnit  );
+          GE_GL_STATE_CACHE_NEXT(glBindTextures     );
+          GE_GL_STATE_CACHE_NEXT(glDeleteTextures   );
+          GE_GL_STATE_CACHE_NEXT(glBindBuffer       );
+          GE_GL_STATE_CACHE_NEXT(glBindBufferBase   );
+          GE_GL_STATE_CACHE_NEXT(glBindBufferRange  );
+          GE_GL_STATE_CACHE_NEXT(glBindBuffersBase  );
+          GE_GL_STATE_CACHE_NEXT(glBindBuffersRange );
+          GE_GL_STATE_CACHE_NEXT(glDeleteBuffers    );
+          GE_GL_STATE_CACHE_NEXT(glEnable           );
+          GE_GL_STATE_CACHE_NEXT(glDisable          );
+          GE_GL_STATE_CACHE_NEXT(glEnablei          );
+          GE_GL_STATE_CACHE_NEXT(glDisablei         );
+          GE_GL_STATE_CACHE_NEXT(glPolygonMode      );
+
+          mutable bool                                       m_programKnown     = false;
+          mutable GLuint                                     m_program          = 0    ;
+          mutable bool                                       m_vertexArrayKnown = false;
+          mutable GLuint                                     m_vertexArray      = 0    ;
+          mutable bool                                       m_activeKnown      = false;
+          mutable GLenum                                     m_active           = 0    ;
+          mutable std::unordered_map<uint64_t,GLuint       > m_textures                ;///<(unit,target) -> texture
+          mutable std::unordered_map<GLuint  ,GLuint       > m_textureUnits            ;///<unit -> texture bound by glBindTextureUnit
+          mutable std::unordered_map<GLenum  ,GLuint       > m_buffers                 ;///<target -> buffer
+          mutable std::unordered_map<uint64_t,IndexedBuffer> m_indexedBuffers          ;///<(index,target) -> buffer range
+          mutable std::unordered_map<GLenum  ,bool         > m_capabilities            ;
+          mutable bool                                       m_frontKnown       = false;
+          mutable GLenum                                     m_front            = 0    ;
+          mutable bool                                       m_backKnown        = false;
+          mutable GLenum                                     m_back             = 0    ;
+          mutable StateCacheStatistics                       m_statistics              ;
+      };
+  }
+}
+
+#undef GE_GL_STATE_CACHE
+#undef GE_GL_STATE_CACHE_NEXT
@@ -0,0 +1,244 @@
+#include<geGL/StreamBuffer.h>
+#include<geGL/Buffer.h>
+#include<geGL/OpenGLContext.h>
+#include<cassert>
+#include<deque>
+#include<stdexcept>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+
+namespace{
+  GLbitfield const flags   = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  GLuint64   const timeout = 1000000000;///<1s in nanoseconds
+}
+
+class ge::gl::StreamBufferImpl{
+  public:
+    /**
+     * @brief part of buffer that can be used by gpu
+     */
+    struct Region{
+      GLintptr begin   ;
+      GLintptr end     ;
+      GLsync   sync    ;
+      bool     ownsSync;///<last region of frame deletes sync
+    };
+    StreamBufferImpl(FunctionTablePointer const&table,GLsizeiptr size,GLsizeiptr alignment):
+      buffer(std::make_shared<Buffer>(table,size,nullptr,flags)),
+      size(size),
+      alignment(alignment)
+    {
+      pointer = static_cast<uint8_t*>(buffer->map(0,size,flags));
+    }
+    ~StreamBufferImpl(){
+      auto const&gl = buffer->getContext();
+      for(auto const&r:pending)
+        if(r.ownsSync)gl.glDeleteSync(r.sync);
+      buffer->unmap();
+    }
+    static bool overlaps(GLintptr aBegin,GLintptr aEnd,GLintptr bBegin,GLintptr bEnd){
+      return aBegin < bEnd && bBegin < aEnd;
+    }
+    bool overlapsOpen(GLintptr begin,GLintptr end)const{
+      for(auto const&r:open)
+        if(overlaps(r.begin,r.end,begin,end))return true;
+      return false;
+    }
+    bool overlapsPending(GLintptr begin,GLintptr end)const{
+      for(auto const&r:pending)
+        if(overlaps(r.begin,r.end,begin,end))return true;
+      return false;
+    }
+    bool isSignaled(GLsync sync)const{
+      auto const status = buffer->getContext().glClientWaitSync(sync,0,0);
+      return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+    }
+    void wait(GLsync sync){
+      if(isSignaled(sync))return;
+      nofWaits++;
+      auto const&gl = buffer->getContext();
+      GLenum status;
+      do status = gl.glClientWaitSync(sync,GL_SYNC_FLUSH_COMMANDS_BIT,timeout);
+      while(status == GL_TIMEOUT_EXPIRED);
+      if(status == GL_WAIT_FAILED)
+        throw std::runtime_error("glClientWaitSync failed");
+    }
+    void retireFront(){
+      if(pending.front().ownsSync)
+        buffer->getContext().glDeleteSync(pending.front().sync);
+      pending.pop_front();
+    }
+    void closeCurrent(){
+      if(head > currentBegin)
+        open.push_back({currentBegin,head,nullptr,false});
+      currentBegin = head;
+    }
+    std::shared_ptr<Buffer>buffer              ;
+    uint8_t*               pointer      = nullptr;
+    GLsizeiptr             size                ;
+    GLsizeiptr             alignment           ;
+    GLintptr               head         = 0    ;///<end of last allocation
+    GLintptr               currentBegin = 0    ;///<begin of not fenced part after head
+    std::vector<Region>    open                ;///<not fenced regions of current frame
+    std::deque <Region>    pending             ;///<fenced regions from oldest
+    size_t                 nofWaits     = 0    ;
+};
+
+/**
+ * @brief creates stream buffer
+ *
+ * @param size size of ring in bytes
+ * @param alignment default alignment of allocations (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT is at most 256)
+ */
+StreamBuffer::StreamBuffer(GLsizeiptr size,GLsizeiptr alignment):StreamBuffer(nullptr,size,alignment){}
+
+/**
+ * @brief creates stream buffer
+ *
+ * @param table opengl function table
+ * @param size size of ring in bytes
+ * @param alignment default alignment of allocations
+ */
+StreamBuffer::StreamBuffer(
+    FunctionTablePointer const&table    ,
+    GLsizeiptr                 size     ,
+    GLsizeiptr                 alignment){
+  assert(alignment > 0);
+  impl = new StreamBufferImpl(table,size,alignment);
+}
+
+/**
+ * @brief destructor, it unmaps buffer and deletes fences
+ */
+StreamBuffer::~StreamBuffer(){
+  delete impl;
+}
+
+/**
+ * @brief suballocates part of ring buffer.
+ * If the part is still used by gpu, this function waits for fence of that part.
+ *
+ * @param size size of allocation in bytes
+ * @param alignment alignment of offset, 0 means default alignment
+ *
+ * @return allocation with pointer into mapped memory
+ */
+StreamBuffer::Allocation StreamBuffer::allocate(GLsizeiptr size,GLsizeiptr alignment){
+  assert(this != nullptr);
+  if(size <= 0 || size > impl->size)
+    throw std::invalid_argument("stream buffer allocation size has to be in range (0,"+std::to_string(impl->size)+"]");
+  if(alignment == 0)alignment = impl->alignment;
+
+  GLintptr offset = (impl->head + alignment - 1) / alignment * alignment;
+  if(offset + size > impl->size){
+    impl->closeCurrent();
+    impl->head         = 0;
+    impl->currentBegin = 0;
+    offset             = 0;
+  }
+
+  if(impl->overlapsOpen(offset,offset+size))
+    fence();
+
+  while(impl->overlapsPending(offset,offset+size)){
+    impl->wait(impl->pending.front().sync);
+    impl->retireFront();
+  }
+
+  impl->head = offset + size;
+
+  Allocation result;
+  result.data   = impl->pointer + offset;
+  result.offset = offset;
+  result.size   = size;
+  return result;
+}
+
+/**
+ * @brief inserts fence that protects all allocations made since last fence.
+ * It should be called after draw calls that use the allocations, typically once per frame.
+ * Already signaled fences are released.
+ */
+void StreamBuffer::fence(){
+  assert(this != nullptr);
+  auto const&gl = impl->buffer->getContext();
+  impl->closeCurrent();
+  if(!impl->open.empty()){
+    auto const sync = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+    for(auto&r:impl->open){
+      r.sync = sync;
+      impl->pending.push_back(r);
+    }
+    impl->pending.back().ownsSync = true;
+    impl->open.clear();
+  }
+  while(!impl->pending.empty() && impl->isSignaled(impl->pending.front().sync))
+    impl->retireFront();
+}
+
+/**
+ * @brief binds allocation to indexed target
+ *
+ * @param target GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER, ...
+ * @param index binding point
+ * @param allocation allocation
+ */
+void StreamBuffer::bindRange(GLenum target,GLuint index,Allocation const&allocation)const{
+  impl->buffer->bindRange(target,index,allocation.offset,allocation.size);
+}
+
+/**
+ * @brief gets size of ring
+ *
+ * @return size in bytes
+ */
+GLsizeiptr StreamBuffer::getSize()const{
+  return impl->size;
+}
+
+/**
+ * @brief gets default alignment of allocations
+ *
+ * @return alignment in bytes
+ */
+GLsizeiptr StreamBuffer::getAlignment()const{
+  return impl->alignment;
+}
+
+/**
+ * @brief gets number of regions that wait for their fence
+ *
+ * @return number of regions
+ */
+size_t StreamBuffer::getNofPendingRegions()const{
+  return impl->pending.size();
+}
+
+/**
+ * @brief gets number of times allocate() had to block on fence
+ *
+ * @return number of waits
+ */
+size_t StreamBuffer::getNofWaits()const{
+  return impl->nofWaits;
+}
+
+/**
+ * @brief gets pointer to persistently mapped memory
+ *
+ * @return pointer to beginning of buffer
+ */
+void*StreamBuffer::getPointer()const{
+  return impl->pointer;
+}
+
+/**
+ * @brief gets underlying buffer
+ *
+ * @return buffer
+ */
+std::shared_ptr<Buffer>const&StreamBuffer::getBuffer()const{
+  return impl->buffer;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<memory>
+
+/**
+ * @brief Ring allocator for per-frame streaming data.
+ * It allocates immutable buffer with GL_MAP_PERSISTENT_BIT|GL_MAP_COHERENT_BIT storage
+ * that stays mapped for whole lifetime of StreamBuffer.
+ * Data are written directly into mapped memory (no setData copy).
+ * Every region allocated between two calls of fence() is protected by one glFenceSync.
+ * The region is reused only after its fence has signaled.
+ */
+class GEGL_EXPORT ge::gl::StreamBuffer{
+  public:
+    /**
+     * @brief suballocated part of stream buffer
+     */
+    struct Allocation{
+      void*      data   = nullptr;///<pointer into persistently mapped memory
+      GLintptr   offset = 0      ;///<offset into buffer in bytes
+      GLsizeiptr size   = 0      ;///<size of allocation in bytes
+    };
+    StreamBuffer(
+        GLsizeiptr size           ,
+        GLsizeiptr alignment = 256);
+    StreamBuffer(
+        FunctionTablePointer const&table          ,
+        GLsizeiptr                 size           ,
+        GLsizeiptr                 alignment = 256);
+    ~StreamBuffer();
+    Allocation allocate            (GLsizeiptr size,GLsizeiptr alignment = 0);
+    void       fence               ();
+    void       bindRange           (GLenum target,GLuint index,Allocation const&allocation)const;
+    GLsizeiptr getSize             ()const;
+    GLsizeiptr getAlignment        ()const;
+    size_t     getNofPendingRegions()const;
+    size_t     getNofWaits         ()const;
+    void*      getPointer          ()const;
+    std::shared_ptr<Buffer>const&getBuffer()const;
+    StreamBuffer(StreamBuffer const&) = delete;
+  private:
+    StreamBufferImpl*impl = nullptr;
+};
@@ -0,0 +1,224 @@
+#include<geGL/UniformBlock.h>
+#include<geGL/Buffer.h>
+#include<geGL/Program.h>
+#include<geGL/OpenGLContext.h>
+#include<algorithm>
+#include<cassert>
+#include<cstring>
+#include<limits>
+#include<stdexcept>
+#include<map>
+#include<vector>
+
+using namespace ge::gl;
+
+class ge::gl::UniformBlockImpl{
+  public:
+    UniformBlockImpl(FunctionTablePointer const&table,GLsizeiptr size,GLenum target):
+      shadow(static_cast<size_t>(size),0),
+      target(target){
+      //buffer starts with the same contents as the shadow copy,
+      //set() skips unchanged bytes, so zeros would never be uploaded otherwise
+      buffer = std::make_shared<Buffer>(table,size,shadow.data(),GL_DYNAMIC_DRAW);
+    }
+    void markDirty(GLintptr begin,GLintptr end){
+      dirtyBegin = std::min(dirtyBegin,begin);
+      dirtyEnd   = std::max(dirtyEnd  ,end  );
+    }
+    void clearDirty(){
+      dirtyBegin = std::numeric_limits<GLintptr>::max();
+      dirtyEnd   = 0;
+    }
+    std::shared_ptr<Buffer>        buffer                                     ;
+    std::vector<uint8_t>           shadow                                     ;
+    std::map<std::string,GLintptr> offsets                                    ;
+    GLenum                         target                                     ;
+    GLuint                         binding    = 0                             ;
+    GLintptr                       dirtyBegin = std::numeric_limits<GLintptr>::max();
+    GLintptr                       dirtyEnd   = 0                             ;
+};
+
+/**
+ * @brief creates block of given size
+ *
+ * @param size size of block in bytes
+ * @param target GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+ */
+UniformBlock::UniformBlock(GLsizeiptr size,GLenum target):UniformBlock(nullptr,size,target){}
+
+/**
+ * @brief creates block of given size
+ *
+ * @param table opengl function table
+ * @param size size of block in bytes
+ * @param target GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+ */
+UniformBlock::UniformBlock(
+    FunctionTablePointer const&table ,
+    GLsizeiptr                 size  ,
+    GLenum                     target){
+  impl = new UniformBlockImpl(table,size,target);
+}
+
+/**
+ * @brief creates block that mirrors layout of uniform block or shader storage block of program.
+ * Size, binding and offsets of members are obtained using program interface query.
+ *
+ * @param program linked program
+ * @param blockName name of block
+ */
+UniformBlock::UniformBlock(
+    Program     const&program  ,
+    std::string const&blockName){
+  auto const&info = program.getInfo();
+  GLenum blockInterface    = GL_UNIFORM_BLOCK;
+  GLenum variableInterface = GL_UNIFORM      ;
+  GLenum target            = GL_UNIFORM_BUFFER;
+  auto ii = info->uniformBlocks.find(blockName);
+  if(ii == info->uniformBlocks.end()){
+    ii = info->buffers.find(blockName);
+    if(ii == info->buffers.end())
+      throw std::invalid_argument("there is no such block: "+blockName);
+    blockInterface    = GL_SHADER_STORAGE_BLOCK  ;
+    variableInterface = GL_BUFFER_VARIABLE       ;
+    target            = GL_SHADER_STORAGE_BUFFER ;
+  }
+  auto const&table = program.getContext().getFunctionTable();
+  impl = new UniformBlockImpl(table,std::get<ProgramInfo::BUFFER_DATA_SIZE>(ii->second),target);
+  impl->binding = std::get<ProgramInfo::BUFFER_BINDING>(ii->second);
+
+  auto const&gl = program.getContext();
+  GLuint const blockIndex = gl.glGetProgramResourceIndex(program.getId(),blockInterface,blockName.c_str());
+  GLint  const nofVariables = std::get<ProgramInfo::BUFFER_NOF_ACTIVE_VARIABLES>(ii->second);
+  std::vector<GLint>variables(static_cast<size_t>(nofVariables));
+  GLenum const activeVariables = GL_ACTIVE_VARIABLES;
+  gl.glGetProgramResourceiv(program.getId(),blockInterface,blockIndex,1,&activeVariables,nofVariables,nullptr,variables.data());
+  for(auto const&variable:variables){
+    auto const name   = program.getResourceName (variableInterface,variable);
+    auto const offset = program.getResourceParam(variableInterface,GL_OFFSET,variable);
+    impl->offsets[name] = offset;
+    auto const pos = name.find("[0]");
+    if(pos != std::string::npos && pos+3 == name.size())
+      impl->offsets[name.substr(0,pos)] = offset;
+  }
+}
+
+/**
+ * @brief destructor
+ */
+UniformBlock::~UniformBlock(){
+  delete impl;
+}
+
+/**
+ * @brief writes data into shadow copy, unchanged bytes do not mark block as dirty
+ *
+ * @param offset offset into block in bytes
+ * @param data data
+ * @param size size of data in bytes
+ */
+void UniformBlock::set(GLintptr offset,void const*data,GLsizeiptr size){
+  assert(offset >= 0 && offset + size <= getSize());
+  auto dst = impl->shadow.data() + offset;
+  if(std::memcmp(dst,data,static_cast<size_t>(size)) == 0)return;
+  std::memcpy(dst,data,static_cast<size_t>(size));
+  impl->markDirty(offset,offset+size);
+}
+
+/**
+ * @brief writes data of block member into shadow copy
+ *
+ * @param member name of member of block
+ * @param data data
+ * @param size size of data in bytes
+ */
+void UniformBlock::set(std::string const&member,void const*data,GLsizeiptr size){
+  set(getOffset(member),data,size);
+}
+
+/**
+ * @brief gets offset of member of block
+ *
+ * @param member name of member
+ *
+ * @return offset in bytes
+ */
+GLintptr UniformBlock::getOffset(std::string const&member)const{
+  auto ii = impl->offsets.find(member);
+  if(ii == impl->offsets.end())
+    throw std::invalid_argument("there is no such block member: "+member);
+  return ii->second;
+}
+
+/**
+ * @brief uploads modified range of shadow copy into buffer using one call
+ */
+void UniformBlock::flush(){
+  if(!isDirty())return;
+  impl->buffer->setData(
+      impl->shadow.data() + impl->dirtyBegin,
+      impl->dirtyEnd      - impl->dirtyBegin,
+      impl->dirtyBegin                      );
+  impl->clearDirty();
+}
+
+/**
+ * @brief binds block to binding point obtained from program
+ */
+void UniformBlock::bind()const{
+  bind(impl->binding);
+}
+
+/**
+ * @brief binds block to indexed target
+ *
+ * @param index binding point
+ */
+void UniformBlock::bind(GLuint index)const{
+  impl->buffer->bindBase(impl->target,index);
+}
+
+/**
+ * @brief has shadow copy changes that were not uploaded
+ *
+ * @return true if flush() has to upload data
+ */
+bool UniformBlock::isDirty()const{
+  return impl->dirtyBegin < impl->dirtyEnd;
+}
+
+/**
+ * @brief gets size of block
+ *
+ * @return size in bytes
+ */
+GLsizeiptr UniformBlock::getSize()const{
+  return static_cast<GLsizeiptr>(impl->shadow.size());
+}
+
+/**
+ * @brief gets buffer target
+ *
+ * @return GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER
+ */
+GLenum UniformBlock::getTarget()const{
+  return impl->target;
+}
+
+/**
+ * @brief gets CPU shadow copy of block
+ *
+ * @return pointer to shadow copy
+ */
+void const*UniformBlock::getShadowData()const{
+  return impl->shadow.data();
+}
+
+/**
+ * @brief gets underlying buffer
+ *
+ * @return buffer
+ */
+std::shared_ptr<Buffer>const&UniformBlock::getBuffer()const{
+  return impl->buffer;
+}
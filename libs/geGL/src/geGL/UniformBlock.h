@@ -0,0 +1,53 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<memory>
+#include<string>
+
+/**
+ * @brief CPU shadow copy of std140/std430 block (uniform buffer or shader storage buffer).
+ * Values are written into the shadow copy and the modified range is uploaded
+ * using one Buffer::setData call in flush().
+ */
+class GEGL_EXPORT ge::gl::UniformBlock{
+  public:
+    UniformBlock(
+        GLsizeiptr size                      ,
+        GLenum     target = GL_UNIFORM_BUFFER);
+    UniformBlock(
+        FunctionTablePointer const&table                      ,
+        GLsizeiptr                 size                       ,
+        GLenum                     target  = GL_UNIFORM_BUFFER);
+    UniformBlock(
+        Program     const&program  ,
+        std::string const&blockName);
+    ~UniformBlock();
+    void       set      (GLintptr           offset,void const*data,GLsizeiptr size);
+    void       set      (std::string const&member,void const*data,GLsizeiptr size);
+    GLintptr   getOffset(std::string const&member)const;
+    void       flush    ();
+    void       bind     (                       )const;
+    void       bind     (GLuint index           )const;
+    bool       isDirty  ()const;
+    GLsizeiptr getSize  ()const;
+    GLenum     getTarget()const;
+    void const*getShadowData()const;
+    std::shared_ptr<Buffer>const&getBuffer()const;
+    template<typename T>
+      void set(GLintptr offset,T const&value);
+    template<typename T>
+      void set(std::string const&member,T const&value);
+    UniformBlock(UniformBlock const&) = delete;
+  private:
+    UniformBlockImpl*impl = nullptr;
+};
+
+template<typename T>
+void ge::gl::UniformBlock::set(GLintptr offset,T const&value){
+  set(offset,&value,sizeof(T));
+}
+
+template<typename T>
+void ge::gl::UniformBlock::set(std::string const&member,T const&value){
+  set(member,&value,sizeof(T));
+}
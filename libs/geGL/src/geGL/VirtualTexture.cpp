@@ -0,0 +1,560 @@
+#include<geGL/VirtualTexture.h>
+#include<geGL/Buffer.h>
+#include<geGL/Texture.h>
+#include<geGL/OpenGLContext.h>
+#include<cassert>
+#include<condition_variable>
+#include<cstring>
+#include<deque>
+#include<list>
+#include<mutex>
+#include<sstream>
+#include<stdexcept>
+#include<thread>
+#include<unordered_map>
+#include<unordered_set>
+
+using namespace ge::gl;
+
+class ge::gl::VirtualTextureImpl{
+  public:
+    using Page       = VirtualTexture::Page      ;
+    using Parameters = VirtualTexture::Parameters;
+    struct Result{
+      Page                page   ;
+      std::vector<uint8_t>data   ;
+      bool                loaded ;
+    };
+    struct Slot{
+      uint64_t                 key    = 0    ;
+      bool                     used   = false;
+      bool                     locked = false;///<coarsest page is never evicted
+      std::list<GLuint>::iterator lru        ;
+    };
+    VirtualTextureImpl(FunctionTablePointer const&table,Parameters const&p,VirtualTexture::PageLoader const&l):gl(table),parameters(p),loader(l){
+      if(p.width <= 0 || p.height <= 0 || p.pageSize <= 0)
+        throw std::invalid_argument("VirtualTexture - size of image and size of page have to be positive");
+      if(p.cacheWidth <= 0 || p.cacheHeight <= 0 || p.cacheWidth > 256 || p.cacheHeight > 256)
+        throw std::invalid_argument("VirtualTexture - size of cache has to be in range 1 - 256 pages");
+      if(!loader)
+        throw std::invalid_argument("VirtualTexture - page loader is empty");
+      if(p.nofFeedbacks < 2)
+        throw std::invalid_argument("VirtualTexture - at least two feedback buffers are required");
+
+      tableWidth  = 1;
+      tableHeight = 1;
+      while(tableWidth *GLuint(p.pageSize) < GLuint(p.width ))tableWidth  *= 2;
+      while(tableHeight*GLuint(p.pageSize) < GLuint(p.height))tableHeight *= 2;
+      nofLevels = 1;
+      while((tableWidth >> (nofLevels-1)) > 1 || (tableHeight >> (nofLevels-1)) > 1)nofLevels++;
+
+      size_t feedbackSize = 0;
+      for(GLuint level=0;level<nofLevels;++level){
+        levelOffsets.push_back(feedbackSize);
+        feedbackSize += size_t(getTableWidth(level))*getTableHeight(level);
+        pageTable.emplace_back(size_t(getTableWidth(level))*getTableHeight(level)*4,0);
+        dirtyLevels.push_back(false);
+      }
+      feedbackData.resize(feedbackSize);
+
+      cache     = std::make_shared<Texture>(table,GL_TEXTURE_2D,p.internalFormat,1,p.cacheWidth*p.pageSize,p.cacheHeight*p.pageSize);
+      cache->texParameteri(GL_TEXTURE_MIN_FILTER,GL_LINEAR);
+      cache->texParameteri(GL_TEXTURE_MAG_FILTER,GL_LINEAR);
+      pageTableTexture = std::make_shared<Texture>(table,GL_TEXTURE_2D,GL_RGBA8UI,GLsizei(nofLevels),GLsizei(tableWidth),GLsizei(tableHeight));
+      pageTableTexture->texParameteri(GL_TEXTURE_MIN_FILTER,GL_NEAREST_MIPMAP_NEAREST);
+      pageTableTexture->texParameteri(GL_TEXTURE_MAG_FILTER,GL_NEAREST);
+      for(size_t i=0;i<p.nofFeedbacks;++i){
+        feedbacks.push_back(std::make_shared<Buffer>(table,GLsizeiptr(feedbackSize*sizeof(uint32_t)),nullptr,GL_DYNAMIC_READ));
+        gl.glClearNamedBufferData(feedbacks.back()->getId(),GL_R32UI,GL_RED_INTEGER,GL_UNSIGNED_INT,nullptr);
+      }
+      fences.resize(p.nofFeedbacks,nullptr);
+      for(GLuint level=0;level<nofLevels;++level)dirtyLevels[level] = true;
+      uploadPageTable();
+
+      slots.resize(size_t(p.cacheWidth)*p.cacheHeight);
+      for(GLuint i=0;i<GLuint(slots.size());++i)freeSlots.push_back(GLuint(slots.size())-1-i);
+
+      for(size_t i=0;i<std::max<size_t>(p.nofThreads,1);++i)
+        workers.emplace_back(&VirtualTextureImpl::loadLoop,this);
+      request(Page{nofLevels-1,0,0});
+    }
+    ~VirtualTextureImpl(){
+      {
+        std::lock_guard<std::mutex>lock(mutex);
+        stop = true;
+      }
+      jobAdded.notify_all();
+      for(auto&worker:workers)worker.join();
+      for(auto const&fence:fences)
+        if(fence)gl.glDeleteSync(fence);
+    }
+    GLuint getTableWidth (GLuint level)const{return std::max(tableWidth  >> level,1u);}
+    GLuint getTableHeight(GLuint level)const{return std::max(tableHeight >> level,1u);}
+    GLuint getNofPagesX(GLuint level)const{
+      GLuint const size = GLuint(parameters.pageSize) << level;
+      return std::max((GLuint(parameters.width ) + size - 1) / size,1u);
+    }
+    GLuint getNofPagesY(GLuint level)const{
+      GLuint const size = GLuint(parameters.pageSize) << level;
+      return std::max((GLuint(parameters.height) + size - 1) / size,1u);
+    }
+    bool isValid(Page const&page)const{
+      return page.level < nofLevels && page.x < getNofPagesX(page.level) && page.y < getNofPagesY(page.level);
+    }
+    static uint64_t getKey(Page const&page){
+      return uint64_t(page.level) << 48 | uint64_t(page.y) << 24 | uint64_t(page.x);
+    }
+    static Page getPage(uint64_t key){
+      return Page{GLuint(key >> 48),GLuint(key & 0xffffff),GLuint(key >> 24 & 0xffffff)};
+    }
+    uint8_t*getEntry(Page const&page){
+      return pageTable[page.level].data() + (size_t(page.y)*getTableWidth(page.level) + page.x)*4;
+    }
+    void loadLoop(){
+      for(;;){
+        Page page;
+        {
+          std::unique_lock<std::mutex>lock(mutex);
+          jobAdded.wait(lock,[&]{return stop || !jobs.empty();});
+          if(stop)return;
+          page = jobs.front();
+          jobs.pop_front();
+        }
+        Result result{page,{},false};
+        result.loaded = loader(page,result.data) &&
+          result.data.size() == size_t(parameters.pageSize)*parameters.pageSize*parameters.pixelSize;
+        {
+          std::lock_guard<std::mutex>lock(mutex);
+          results.push_back(std::move(result));
+        }
+        resultAdded.notify_all();
+      }
+    }
+    void request(Page const&page){
+      if(!isValid(page))
+        throw std::invalid_argument("VirtualTexture::request - page is outside of virtual texture");
+      auto const key = getKey(page);
+      auto const resident = residentPages.find(key);
+      if(resident != residentPages.end()){
+        auto&slot = slots[resident->second];
+        lru.splice(lru.begin(),lru,slot.lru);
+        return;
+      }
+      if(pending.count(key))return;
+      if(pending.size() >= parameters.maxPending){
+        statistics.dropped++;
+        return;
+      }
+      pending.insert(key);
+      statistics.requested++;
+      {
+        std::lock_guard<std::mutex>lock(mutex);
+        jobs.push_back(page);
+      }
+      jobAdded.notify_one();
+    }
+    bool isSignaled(GLsync sync)const{
+      auto const status = gl.glClientWaitSync(sync,0,0);
+      return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+    }
+    /**
+     * @brief fences feedback written by current frame and switches to next buffer of ring.
+     * Next buffer is read only if gpu finished writing it, otherwise current buffer is used
+     * for one more frame (requests accumulate in it). Buffer without fence was not used yet.
+     */
+    void readFeedback(){
+      if(fences[current])gl.glDeleteSync(fences[current]);
+      fences[current] = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+      auto const next = (current + 1) % feedbacks.size();
+      auto const sync = fences[next];
+      if(sync && !isSignaled(sync))return;
+      current = next;
+      if(!sync)return;
+      gl.glDeleteSync(sync);
+      fences[current] = nullptr;
+      auto const&feedback = feedbacks[current];
+      gl.glGetNamedBufferSubData(feedback->getId(),0,GLsizeiptr(feedbackData.size()*sizeof(uint32_t)),feedbackData.data());
+      gl.glClearNamedBufferData(feedback->getId(),GL_R32UI,GL_RED_INTEGER,GL_UNSIGNED_INT,nullptr);
+      for(GLuint level=0;level<nofLevels;++level)
+        for(GLuint y=0;y<getNofPagesY(level);++y)
+          for(GLuint x=0;x<getNofPagesX(level);++x)
+            if(feedbackData[levelOffsets[level] + size_t(y)*getTableWidth(level) + x])
+              request(Page{level,x,y});
+    }
+    GLuint allocateSlot(){
+      if(!freeSlots.empty()){
+        auto const slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+      }
+      for(auto it = lru.rbegin();it != lru.rend();++it){
+        auto const index = *it;
+        auto&slot = slots[index];
+        if(slot.locked)continue;
+        auto const page = getPage(slot.key);
+        std::memset(getEntry(page),0,4);
+        dirtyLevels[page.level] = true;
+        residentPages.erase(slot.key);
+        lru.erase(slot.lru);
+        slot.used = false;
+        statistics.evicted++;
+        return index;
+      }
+      return GLuint(-1);
+    }
+    void upload(Result const&result){
+      auto const index = allocateSlot();
+      if(index == GLuint(-1))return;
+      auto const key = getKey(result.page);
+      auto&slot  = slots[index];
+      slot.key    = key;
+      slot.used   = true;
+      slot.locked = result.page.level == nofLevels-1;
+      lru.push_front(index);
+      slot.lru    = lru.begin();
+      residentPages[key] = index;
+      GLuint const sx = index % GLuint(parameters.cacheWidth);
+      GLuint const sy = index / GLuint(parameters.cacheWidth);
+      gl.glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+      gl.glTextureSubImage2D(cache->getId(),0,
+          GLint(sx*parameters.pageSize),GLint(sy*parameters.pageSize),
+          parameters.pageSize,parameters.pageSize,
+          parameters.format,parameters.type,result.data.data());
+      gl.glPixelStorei(GL_UNPACK_ALIGNMENT,4);
+      auto const entry = getEntry(result.page);
+      entry[0] = uint8_t(sx);
+      entry[1] = uint8_t(sy);
+      entry[2] = 0;
+      entry[3] = 255;
+      dirtyLevels[result.page.level] = true;
+      statistics.uploaded++;
+    }
+    void uploadPageTable(){
+      for(GLuint level=0;level<nofLevels;++level){
+        if(!dirtyLevels[level])continue;
+        gl.glTextureSubImage2D(pageTableTexture->getId(),GLint(level),0,0,
+            GLsizei(getTableWidth(level)),GLsizei(getTableHeight(level)),
+            GL_RGBA_INTEGER,GL_UNSIGNED_BYTE,pageTable[level].data());
+        dirtyLevels[level] = false;
+      }
+    }
+    void update(size_t maxUploads){
+      readFeedback();
+      std::deque<Result>ready;
+      {
+        std::lock_guard<std::mutex>lock(mutex);
+        while(!results.empty() && ready.size() < maxUploads){
+          ready.push_back(std::move(results.front()));
+          results.pop_front();
+        }
+      }
+      for(auto const&result:ready){
+        pending.erase(getKey(result.page));
+        if(!result.loaded){
+          statistics.failed++;
+          continue;
+        }
+        statistics.loaded++;
+        upload(result);
+      }
+      uploadPageTable();
+    }
+    void finish(){
+      std::unique_lock<std::mutex>lock(mutex);
+      resultAdded.wait(lock,[&]{return results.size() >= pending.size();});
+    }
+    Context                         gl              ;
+    Parameters                      parameters      ;
+    VirtualTexture::PageLoader      loader          ;
+    VirtualTexture::Statistics      statistics      ;
+    GLuint                          tableWidth  = 1 ;///<size of level 0 of page table (power of two)
+    GLuint                          tableHeight = 1 ;
+    GLuint                          nofLevels   = 1 ;
+    std::vector<size_t>             levelOffsets    ;///<offsets of levels in feedback buffer
+    std::vector<uint32_t>           feedbackData    ;
+    std::vector<std::vector<uint8_t>>pageTable      ;///<cpu copy of page table texture
+    std::vector<bool>               dirtyLevels     ;
+    std::shared_ptr<Texture>        cache           ;
+    std::shared_ptr<Texture>        pageTableTexture;
+    std::vector<std::shared_ptr<Buffer>>feedbacks   ;///<ring of feedback buffers
+    std::vector<GLsync>             fences          ;///<fences of feedback buffers, nullptr for unused buffer
+    size_t                          current     = 0 ;///<feedback buffer written by current frame
+    std::vector<Slot>               slots           ;
+    std::vector<GLuint>             freeSlots       ;
+    std::list<GLuint>               lru             ;///<used slots, most recently used first
+    std::unordered_map<uint64_t,GLuint>residentPages;
+    std::unordered_set<uint64_t>    pending         ;///<pages that are loaded or waiting for upload
+    std::vector<std::thread>        workers         ;
+    std::mutex                      mutex           ;
+    std::condition_variable         jobAdded        ;
+    std::condition_variable         resultAdded     ;
+    std::deque<Page>                jobs            ;
+    std::deque<Result>              results         ;
+    bool                            stop = false    ;
+};
+
+/**
+ * @brief creates virtual texture, the coarsest page is requested immediately
+ *
+ * @param parameters size of virtual image, pages, cache and loader settings
+ * @param loader function that loads pages, it is called by loader threads
+ */
+VirtualTexture::VirtualTexture(
+    Parameters const&parameters,
+    PageLoader const&loader    ):VirtualTexture(nullptr,parameters,loader){}
+
+/**
+ * @brief creates virtual texture, the coarsest page is requested immediately
+ *
+ * @param table opengl function table
+ * @param parameters size of virtual image, pages, cache and loader settings
+ * @param loader function that loads pages, it is called by loader threads
+ */
+VirtualTexture::VirtualTexture(
+    FunctionTablePointer const&table     ,
+    Parameters           const&parameters,
+    PageLoader           const&loader    ){
+  impl = new VirtualTextureImpl(table,parameters,loader);
+}
+
+/**
+ * @brief destructor, it waits for loader threads
+ */
+VirtualTexture::~VirtualTexture(){
+  delete impl;
+}
+
+/**
+ * @brief requests page, resident page is marked as recently used,
+ * missing page is scheduled for loading (unless maxPending pages are already loaded)
+ *
+ * @param page virtual page
+ */
+void VirtualTexture::request(Page const&page){
+  assert(this!=nullptr);
+  impl->request(page);
+}
+
+/**
+ * @brief fences feedback of current frame, reads and clears the oldest feedback buffer
+ * (if gpu finished it), requests pages recorded by shaders,
+ * uploads loaded pages into cache (evicting least recently used pages) and updates page table.
+ * It should be called once per frame, bind() has to be called after it, because it switches feedback buffer.
+ *
+ * @param maxUploads maximal number of pages uploaded by this call
+ */
+void VirtualTexture::update(size_t maxUploads){
+  assert(this!=nullptr);
+  impl->update(maxUploads);
+}
+
+/**
+ * @brief waits until all requested pages are loaded, following update() can upload them
+ */
+void VirtualTexture::finish(){
+  assert(this!=nullptr);
+  impl->finish();
+}
+
+/**
+ * @brief binds cache, page table and feedback buffer
+ *
+ * @param cacheUnit texture unit of cache texture
+ * @param pageTableUnit texture unit of page table texture
+ * @param feedbackBinding shader storage binding of feedback buffer
+ */
+void VirtualTexture::bind(GLuint cacheUnit,GLuint pageTableUnit,GLuint feedbackBinding)const{
+  assert(this!=nullptr);
+  impl->cache           ->bind(cacheUnit    );
+  impl->pageTableTexture->bind(pageTableUnit);
+  impl->feedbacks[impl->current]->bindBase(GL_SHADER_STORAGE_BUFFER,feedbackBinding);
+}
+
+/**
+ * @brief gets GLSL source with vtSample(uv) and vtFeedback(uv) functions for this texture.
+ * vtFeedback records page requested by fragment, it can be called in low resolution pass.
+ *
+ * @param cacheUnit texture unit of cache texture
+ * @param pageTableUnit texture unit of page table texture
+ * @param feedbackBinding shader storage binding of feedback buffer
+ *
+ * @return GLSL source (without #version)
+ */
+std::string VirtualTexture::getShaderSource(GLuint cacheUnit,GLuint pageTableUnit,GLuint feedbackBinding)const{
+  assert(this!=nullptr);
+  auto const&p = impl->parameters;
+  std::stringstream ss;
+  ss << "layout(binding=" << cacheUnit     << ")uniform sampler2D  vtCache;\n";
+  ss << "layout(binding=" << pageTableUnit << ")uniform usampler2D vtPageTable;\n";
+  ss << "layout(std430,binding=" << feedbackBinding << ")buffer VirtualTextureFeedback{uint vtRequests[];};\n";
+  ss << "const vec2  vtSize      = vec2(" << p.width << "," << p.height << ");\n";
+  ss << "const float vtPageSize  = " << p.pageSize << ".;\n";
+  ss << "const int   vtNofLevels = " << impl->nofLevels << ";\n";
+  ss << "const ivec2 vtTableSize = ivec2(" << impl->tableWidth << "," << impl->tableHeight << ");\n";
+  ss << "const vec2  vtCacheSize = vec2(" << p.cacheWidth << "," << p.cacheHeight << ");\n";
+  ss << R".(
+int vtLevel(vec2 uv){
+  vec2  texel = uv*vtSize;
+  vec2  dx    = dFdx(texel);
+  vec2  dy    = dFdy(texel);
+  float lod   = .5*log2(max(max(dot(dx,dx),dot(dy,dy)),1.));
+  return clamp(int(lod),0,vtNofLevels-1);
+}
+
+ivec2 vtPage(vec2 uv,int level){
+  ivec2 size = max(vtTableSize>>level,ivec2(1));
+  return clamp(ivec2(floor(uv*vtSize/(vtPageSize*exp2(float(level))))),ivec2(0),size-1);
+}
+
+void vtFeedback(vec2 uv){
+  int level  = vtLevel(uv);
+  int offset = 0;
+  for(int l=0;l<level;++l){
+    ivec2 size = max(vtTableSize>>l,ivec2(1));
+    offset += size.x*size.y;
+  }
+  ivec2 page = vtPage(uv,level);
+  vtRequests[offset + page.y*max(vtTableSize.x>>level,1) + page.x] = 1u;
+}
+
+vec4 vtSample(vec2 uv){
+  for(int level=vtLevel(uv);level<vtNofLevels;++level){
+    uvec4 entry = texelFetch(vtPageTable,vtPage(uv,level),level);
+    if(entry.a == 0u)continue;
+    vec2 inPage = fract(uv*vtSize/(vtPageSize*exp2(float(level))));
+    inPage = clamp(inPage,vec2(.5/vtPageSize),vec2(1.-.5/vtPageSize));
+    return textureLod(vtCache,(vec2(entry.xy)+inPage)/vtCacheSize,0.);
+  }
+  return vec4(0.);
+}
+).";
+  return ss.str();
+}
+
+/**
+ * @brief is page in cache
+ *
+ * @param page virtual page
+ *
+ * @return true if page is resident
+ */
+bool VirtualTexture::isResident(Page const&page)const{
+  assert(this!=nullptr);
+  return impl->residentPages.count(VirtualTextureImpl::getKey(page)) != 0;
+}
+
+/**
+ * @brief gets number of virtual levels, the coarsest level has one page
+ *
+ * @return number of levels
+ */
+GLuint VirtualTexture::getNofLevels()const{
+  assert(this!=nullptr);
+  return impl->nofLevels;
+}
+
+/**
+ * @brief gets number of pages in row of level
+ *
+ * @param level virtual level
+ *
+ * @return number of pages
+ */
+GLuint VirtualTexture::getNofPagesX(GLuint level)const{
+  assert(this!=nullptr);
+  return impl->getNofPagesX(level);
+}
+
+/**
+ * @brief gets number of pages in column of level
+ *
+ * @param level virtual level
+ *
+ * @return number of pages
+ */
+GLuint VirtualTexture::getNofPagesY(GLuint level)const{
+  assert(this!=nullptr);
+  return impl->getNofPagesY(level);
+}
+
+/**
+ * @brief gets number of pages in cache
+ *
+ * @return number of resident pages
+ */
+size_t VirtualTexture::getNofResidentPages()const{
+  assert(this!=nullptr);
+  return impl->residentPages.size();
+}
+
+/**
+ * @brief gets number of pages that are loaded or wait for upload
+ *
+ * @return number of pending pages
+ */
+size_t VirtualTexture::getNofPendingPages()const{
+  assert(this!=nullptr);
+  return impl->pending.size();
+}
+
+/**
+ * @brief gets index of page in feedback buffer (array of uints)
+ *
+ * @param page virtual page
+ *
+ * @return index into feedback buffer
+ */
+size_t VirtualTexture::getFeedbackIndex(Page const&page)const{
+  assert(this!=nullptr);
+  return impl->levelOffsets.at(page.level) + size_t(page.y)*impl->getTableWidth(page.level) + page.x;
+}
+
+/**
+ * @brief gets statistics of loading and caching
+ *
+ * @return statistics
+ */
+VirtualTexture::Statistics const&VirtualTexture::getStatistics()const{
+  assert(this!=nullptr);
+  return impl->statistics;
+}
+
+/**
+ * @brief gets parameters of virtual texture
+ *
+ * @return parameters
+ */
+VirtualTexture::Parameters const&VirtualTexture::getParameters()const{
+  assert(this!=nullptr);
+  return impl->parameters;
+}
+
+/**
+ * @brief gets cache texture (cacheWidth*pageSize x cacheHeight*pageSize)
+ *
+ * @return cache texture
+ */
+std::shared_ptr<Texture>const&VirtualTexture::getCacheTexture()const{
+  assert(this!=nullptr);
+  return impl->cache;
+}
+
+/**
+ * @brief gets page table texture
+ *
+ * @return page table texture
+ */
+std::shared_ptr<Texture>const&VirtualTexture::getPageTableTexture()const{
+  assert(this!=nullptr);
+  return impl->pageTableTexture;
+}
+
+/**
+ * @brief gets feedback buffer that is written by current frame, it changes in update()
+ *
+ * @return feedback buffer
+ */
+std::shared_ptr<Buffer>const&VirtualTexture::getFeedbackBuffer()const{
+  assert(this!=nullptr);
+  return impl->feedbacks[impl->current];
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<functional>
+#include<memory>
+#include<string>
+#include<vector>
+
+/**
+ * @brief Virtual (sparse) texture streamed by page loader.
+ * Virtual image of arbitrary size is split into square pages. Resident pages
+ * are stored in cache texture of fixed size, so memory stays bounded regardless of source size.
+ * Page table texture (GL_RGBA8UI, one mip level per virtual level) maps virtual page to
+ * cache page (r,g) and marks it resident (a). Shaders fall back to coarser levels
+ * for pages that are not resident, the coarsest page is always resident.
+ * Shaders record requested pages into feedback buffer, update() reads it,
+ * schedules missing pages to loader threads, uploads loaded pages and
+ * evicts least recently used pages.
+ * Feedback buffers form a ring guarded by fences, a buffer is read back
+ * only after gpu finished writing it, so update() never waits for gpu.
+ */
+class GEGL_EXPORT ge::gl::VirtualTexture{
+  public:
+    struct Parameters{
+      GLsizei width          = 0               ;///<width of virtual image in pixels
+      GLsizei height         = 0               ;///<height of virtual image in pixels
+      GLsizei pageSize       = 128             ;///<size of page in pixels
+      GLsizei cacheWidth     = 32              ;///<width of cache in pages
+      GLsizei cacheHeight    = 32              ;///<height of cache in pages
+      GLenum  internalFormat = GL_RGBA8        ;///<internal format of cache texture
+      GLenum  format         = GL_RGBA         ;///<format of loaded pages
+      GLenum  type           = GL_UNSIGNED_BYTE;///<type of loaded pages
+      size_t  pixelSize      = 4               ;///<size of pixel of loaded pages in bytes
+      size_t  nofThreads     = 2               ;///<number of loader threads
+      size_t  maxPending     = 64              ;///<maximal number of pages that are loaded at once
+      size_t  nofFeedbacks   = 3               ;///<number of feedback buffers, feedback is read nofFeedbacks-1 frames later
+    };
+    struct Page{
+      GLuint level = 0;
+      GLuint x     = 0;
+      GLuint y     = 0;
+    };
+    /**
+     * @brief loads page (pageSize x pageSize pixels, tightly packed rows), it is called by loader threads
+     *
+     * @return false if page cannot be loaded, it can be requested again
+     */
+    using PageLoader = std::function<bool(Page const&page,std::vector<uint8_t>&data)>;
+    struct Statistics{
+      size_t requested = 0;///<pages that were scheduled for loading
+      size_t dropped   = 0;///<requests dropped because of maxPending limit
+      size_t loaded    = 0;///<pages that were loaded by loader
+      size_t failed    = 0;///<pages that could not be loaded
+      size_t uploaded  = 0;///<pages that were uploaded into cache
+      size_t evicted   = 0;///<pages that were evicted from cache
+    };
+    VirtualTexture(
+        Parameters const&parameters,
+        PageLoader const&loader    );
+    VirtualTexture(
+        FunctionTablePointer const&table     ,
+        Parameters           const&parameters,
+        PageLoader           const&loader    );
+    ~VirtualTexture();
+    void        request            (Page const&page);
+    void        update             (size_t maxUploads = 16);
+    void        finish             ();
+    void        bind               (GLuint cacheUnit,GLuint pageTableUnit,GLuint feedbackBinding)const;
+    std::string getShaderSource    (GLuint cacheUnit,GLuint pageTableUnit,GLuint feedbackBinding)const;
+    bool        isResident         (Page const&page)const;
+    GLuint      getNofLevels       ()const;
+    GLuint      getNofPagesX       (GLuint level)const;
+    GLuint      getNofPagesY       (GLuint level)const;
+    size_t      getNofResidentPages()const;
+    size_t      getNofPendingPages ()const;
+    size_t      getFeedbackIndex   (Page const&page)const;
+    Statistics                    const&getStatistics      ()const;
+    Parameters                    const&getParameters      ()const;
+    std::shared_ptr<Texture>      const&getCacheTexture    ()const;
+    std::shared_ptr<Texture>      const&getPageTableTexture()const;
+    std::shared_ptr<Buffer >      const&getFeedbackBuffer  ()const;
+    VirtualTexture(VirtualTexture const&) = delete;
+  private:
+    VirtualTextureImpl*impl = nullptr;
+};
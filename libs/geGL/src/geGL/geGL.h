@@ -34,6 +34,14 @@
 #include<geGL/Texture.h>
 #include<geGL/Sampler.h>
 #include<geGL/Renderbuffer.h>
+#include<geGL/UniformBlock.h>
+#include<geGL/StreamBuffer.h>
+#include<geGL/ProgramCache.h>
+#include<geGL/ProgramBatch.h>
+#include<geGL/CommandList.h>
+#include<geGL/VirtualTexture.h>
+#include<geGL/DrawBatch.h>
+#include<geGL/ClusterCuller.h>
 #include<geGL/DebugMessage.h>
 #include<geGL/FunctionLoaderInterface.h>
 #include<geGL/DefaultLoader.h>
@@ -3,6 +3,8 @@
 #include<memory>
 #include<set>
 #include<map>
+#include<vector>
+#include<geGL/Program.h>
 #include<geGL/ProgramInfo.h>
 
 class ge::gl::ProgramImpl {
@@ -11,4 +13,8 @@ public:
   std::set<ShaderPointer>shaders;
   std::map<std::string, GLint>name2Uniform;
   std::shared_ptr<ProgramInfo>info;
+  //reflection is filled on first use, separately for every interface
+  bool uniformsPending = false;
+  bool attribsPending  = false;
+  bool buffersPending  = false;
 };
\ No newline at end of file
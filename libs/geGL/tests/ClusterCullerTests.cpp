@@ -0,0 +1,143 @@
+#include<catch.hpp>
+#include<SDLWin.h>
+#include<geGL/geGL.h>
+#include<geGL/StaticCalls.h>
+#include<algorithm>
+#include<cmath>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  /**
+   * @brief column major perspective projection, camera looks along -z
+   */
+  std::vector<float>perspective(float fovy,float near,float far){
+    std::vector<float>m(16,0.f);
+    float const f = 1.f/std::tan(fovy/2.f);
+    m[ 0] = f;
+    m[ 5] = f;
+    m[10] = (far+near)/(near-far);
+    m[11] = -1.f;
+    m[14] = 2.f*far*near/(near-far);
+    return m;
+  }
+  ClusterCuller::Cluster createCluster(float x,float y,float z,float coneZ,float coneCutoff,GLuint firstIndex){
+    ClusterCuller::Cluster cluster;
+    cluster.center[0]   = x;
+    cluster.center[1]   = y;
+    cluster.center[2]   = z;
+    cluster.radius      = .5f;
+    cluster.coneAxis[2] = coneZ;
+    cluster.coneCutoff  = coneCutoff;
+    cluster.firstIndex  = firstIndex;
+    cluster.nofIndices  = 3;
+    cluster.baseVertex  = 7;
+    return cluster;
+  }
+}
+
+TEST_CASE("ClusterCuller splits grid into clusters with bounds and normal cones"){
+  std::vector<float >positions;
+  std::vector<GLuint>indices;
+  for(int y=0;y<5;++y)
+    for(int x=0;x<5;++x){
+      positions.push_back(float(x));
+      positions.push_back(float(y));
+      positions.push_back(0.f);
+    }
+  for(GLuint y=0;y<4;++y)
+    for(GLuint x=0;x<4;++x){
+      GLuint const v = y*5+x;
+      indices.insert(indices.end(),{v,v+1,v+6,v,v+6,v+5});
+    }
+  auto const clusters = ClusterCuller::buildClusters(indices.data(),GLuint(indices.size()),positions.data(),3*sizeof(float),25,100,3,8,64);
+  REQUIRE(clusters.size() == 4);
+  for(size_t i=0;i<clusters.size();++i){
+    auto const&cluster = clusters[i];
+    REQUIRE(cluster.firstIndex == 100+i*24);
+    REQUIRE(cluster.nofIndices == 24);
+    REQUIRE(cluster.baseVertex == 3);
+    REQUIRE(cluster.coneAxis[2] == Approx(1.f));
+    REQUIRE(cluster.coneCutoff  == Approx(0.f).margin(1e-3));
+    for(GLuint k=0;k<cluster.nofIndices;++k){
+      float const*p = positions.data()+3*indices[cluster.firstIndex-100+k];
+      float d = 0.f;
+      for(int c=0;c<3;++c)d += (p[c]-cluster.center[c])*(p[c]-cluster.center[c]);
+      REQUIRE(std::sqrt(d) <= cluster.radius+1e-5f);
+    }
+  }
+
+  auto const small = ClusterCuller::buildClusters(indices.data(),GLuint(indices.size()),positions.data(),3*sizeof(float),25,0,0,64,6);
+  REQUIRE(small.size() == 8);
+
+  std::vector<float >folded = {0,0,0, 1,0,0, 0,1,0, 0,0,-1};
+  std::vector<GLuint>foldedIds = {0,1,2, 0,3,1};
+  auto const fold = ClusterCuller::buildClusters(foldedIds.data(),6,folded.data(),3*sizeof(float),4);
+  REQUIRE(fold.size() == 1);
+  REQUIRE(fold[0].coneCutoff == Approx(std::sqrt(.5f)));
+
+  std::vector<float >opposite = {0,0,0, 1,0,0, 0,1,0};
+  std::vector<GLuint>oppositeIds = {0,1,2, 0,2,1};
+  REQUIRE(ClusterCuller::buildClusters(oppositeIds.data(),6,opposite.data(),3*sizeof(float),3)[0].coneCutoff == 1.f);
+
+  REQUIRE_THROWS(ClusterCuller::buildClusters(indices.data(),5,positions.data(),3*sizeof(float),25));
+  REQUIRE_THROWS(ClusterCuller::buildClusters(indices.data(),GLuint(indices.size()),positions.data(),3*sizeof(float),20));
+}
+
+TEST_CASE("ClusterCuller writes compacted commands of visible clusters"){
+  SDLWin win;
+  win.beginFrame();
+  ge::gl::init();
+  {
+    ClusterCuller culler(16);
+    culler.setClusters({
+        createCluster( 0.f,0.f,-2.f, 1.f,.5f, 0),
+        createCluster( 0.f,0.f, 5.f, 1.f,.5f, 3),
+        createCluster( 0.f,1.f,-8.f,-1.f,.1f, 6),
+        createCluster( 1.f,0.f,-8.f,-1.f,1.f, 9),
+        createCluster(20.f,0.f,-8.f, 1.f,1.f,12),
+        });
+    auto const projection = perspective(1.5f,1.f,10.f);
+    float const camera[3] = {0.f,0.f,0.f};
+    culler.cull(projection.data(),camera);
+    auto statistics = culler.getStatistics();
+    REQUIRE(statistics.nofClusters       == 5);
+    REQUIRE(statistics.nofVisible        == 2);
+    REQUIRE(statistics.nofFrustumCulled  == 2);
+    REQUIRE(statistics.nofBackfaceCulled == 1);
+
+    std::vector<GLuint>commands(5*2);
+    culler.getCommandBuffer()->getData(commands.data(),commands.size()*sizeof(GLuint));
+    if(commands[4] > commands[9])
+      std::swap_ranges(commands.begin(),commands.begin()+5,commands.begin()+5);
+    REQUIRE(commands == std::vector<GLuint>({3,1,0,7,0, 3,1,9,7,3}));
+
+    culler.cull(projection.data(),camera,1,2);
+    statistics = culler.getStatistics();
+    REQUIRE(statistics.nofClusters == 2);
+    REQUIRE(statistics.nofVisible  == 0);
+    REQUIRE_THROWS(culler.cull(projection.data(),camera,4,2));
+
+    culler.setTests(ClusterCuller::FRUSTUM);
+    culler.cull(projection.data(),camera);
+    REQUIRE(culler.getStatistics().nofVisible == 3);
+
+    auto depth = std::make_shared<Texture>(GL_TEXTURE_2D,GL_DEPTH_COMPONENT32F,1,37,21);
+    float const farthest = .8f;
+    glClearTexImage(depth->getId(),0,GL_DEPTH_COMPONENT,GL_FLOAT,&farthest);
+    culler.buildHiZ(*depth);
+    REQUIRE(culler.getHiZ()->getWidth (5) == 1);
+    REQUIRE(culler.getHiZ()->getHeight(4) == 1);
+    float top = 0.f;
+    glGetTextureImage(culler.getHiZ()->getId(),5,GL_RED,GL_FLOAT,sizeof(top),&top);
+    REQUIRE(top == Approx(farthest));
+
+    culler.setTests(ClusterCuller::ALL);
+    culler.cull(projection.data(),camera);
+    statistics = culler.getStatistics();
+    REQUIRE(statistics.nofVisible         == 1);
+    REQUIRE(statistics.nofOcclusionCulled == 1);
+  }
+  win.endFrame();
+}
@@ -0,0 +1,100 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+#include<geGL/RecordTableDecorator.h>
+#include<thread>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("RecordTableDecorator records calls and CommandList replays them"){
+  auto recorder = createRecordTable();
+  Context gl(recorder);
+  gl.glEnable(GL_DEPTH_TEST);
+  gl.glBindVertexArray(3);
+  gl.glUseProgram(1);
+  float const value = 0.5f;
+  gl.glProgramUniform1f(1,7,value);
+  gl.glProgramUniformMatrix4fv(1,8,1,GL_FALSE,std::vector<float>(16,2.f).data());
+  REQUIRE(recorder->commandList.getNofCommands() == 5);
+  REQUIRE(recorder->commandList.getSize() > 0);
+
+  auto table = createMockTable();
+  REQUIRE(table->getNofCalls("glEnable") == 0);
+  recorder->commandList.replay(table);
+  REQUIRE(table->getNofCalls("glEnable"         ) == 1);
+  REQUIRE(table->getNofCalls("glBindVertexArray") == 1);
+  REQUIRE(table->getNofCalls("glUseProgram"     ) == 1);
+  REQUIRE(table->nofUniformCalls == 2);
+  REQUIRE(table->lastLocation    == 8);
+  REQUIRE(table->lastFloats[15]  == 2.f);
+
+  recorder->commandList.replay(table);
+  REQUIRE(table->getNofCalls("glEnable") == 2);
+
+  auto const capacity = recorder->commandList.getCapacity();
+  recorder->commandList.clear();
+  REQUIRE(recorder->commandList.getNofCommands() == 0);
+  REQUIRE(recorder->commandList.getSize       () == 0);
+  gl.glUseProgram(2);
+  recorder->commandList.replay(table);
+  REQUIRE(table->getNofCalls("glUseProgram") == 3);
+  REQUIRE(table->getNofCalls("glEnable"    ) == 2);
+  REQUIRE(recorder->commandList.getCapacity() == capacity);
+}
+
+TEST_CASE("RecordTableDecorator copies data passed by pointer"){
+  auto recorder = createRecordTable();
+  auto table    = createMockTable();
+  table->glNamedBufferData(5,4*sizeof(float),nullptr,GL_DYNAMIC_DRAW);
+  {
+    Context gl(recorder);
+    std::vector<float>matrix(16,3.f);
+    std::vector<float>data  {1.f,2.f,3.f,4.f};
+    gl.glNamedBufferSubData(5,0,data.size()*sizeof(float),data.data());
+    gl.glProgramUniformMatrix4fv(1,9,1,GL_FALSE,matrix.data());
+    matrix.assign(16,-1.f);
+    data  .assign( 4,-1.f);
+  }
+  recorder->commandList.replay(table);
+  REQUIRE(table->lastLocation   == 9  );
+  REQUIRE(table->lastFloats[0]  == 3.f);
+  REQUIRE(table->lastFloats[15] == 3.f);
+  std::vector<float>data(4);
+  table->glGetNamedBufferSubData(5,0,data.size()*sizeof(float),data.data());
+  REQUIRE(data == std::vector<float>({1.f,2.f,3.f,4.f}));
+}
+
+TEST_CASE("CommandList spans multiple chunks"){
+  auto recorder = createRecordTable();
+  auto table    = createMockTable();
+  for(GLint i=0;i<10000;++i)
+    recorder->glProgramUniform1f(1,i,static_cast<float>(i));
+  REQUIRE(recorder->commandList.getCapacity() > 64*1024);
+  recorder->commandList.replay(table);
+  REQUIRE(table->nofUniformCalls == 10000);
+  REQUIRE(table->lastLocation    == 9999 );
+  REQUIRE(table->lastFloats[0]   == 9999.f);
+}
+
+TEST_CASE("command lists are recorded by worker threads and replayed in order"){
+  size_t const nofWorkers = 4;
+  vector<shared_ptr<RecordTableDecorator<FunctionTable>>>recorders;
+  for(size_t i=0;i<nofWorkers;++i)
+    recorders.push_back(createRecordTable());
+
+  vector<thread>workers;
+  for(size_t i=0;i<nofWorkers;++i)
+    workers.emplace_back([&,i]{
+      Context gl(recorders[i]);
+      for(GLint j=0;j<1000;++j)
+        gl.glProgramUniform1f(1,static_cast<GLint>(i*1000)+j,0.f);
+    });
+  for(auto&worker:workers)worker.join();
+
+  auto table = createMockTable();
+  for(auto const&recorder:recorders)
+    recorder->commandList.replay(table);
+  REQUIRE(table->nofUniformCalls == nofWorkers*1000);
+  REQUIRE(table->lastLocation    == nofWorkers*1000-1);
+}
@@ -0,0 +1,102 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  /**
+   * @brief small arenas, vertices are 2 floats
+   */
+  DrawBatch::Parameters createParameters(){
+    DrawBatch::Parameters parameters;
+    parameters.vertexSize     = 2*sizeof(float);
+    parameters.maxVertices    = 16;
+    parameters.maxIndices     = 32;
+    parameters.maxCommands    = 4 ;
+    parameters.framesInFlight = 2 ;
+    return parameters;
+  }
+  std::vector<float >const quad     = {0,0, 1,0, 1,1, 0,1};
+  std::vector<GLuint>const quadIds  = {0,1,2, 0,2,3};
+  std::vector<float >const triangle = {0,0, 1,0, 0,1};
+  std::vector<GLuint>const triIds   = {0,1,2};
+}
+
+TEST_CASE("DrawBatch suballocates meshes from shared arenas"){
+  auto table = createMockTable();
+  DrawBatch batch(table,createParameters());
+  auto const a = batch.addMesh(quad    .data(),4,quadIds.data(),6);
+  auto const b = batch.addMesh(triangle.data(),3,triIds .data(),3);
+  REQUIRE(batch.getNofMeshes  () == 2);
+  REQUIRE(batch.getNofVertices() == 7);
+  REQUIRE(batch.getNofIndices () == 9);
+  REQUIRE(batch.getMesh(b).firstVertex == 4);
+  REQUIRE(batch.getMesh(b).firstIndex  == 6);
+  REQUIRE(batch.getMesh(a).nofIndices  == 6);
+
+  std::vector<GLuint>indices;
+  batch.getIndexBuffer()->getData(indices);
+  REQUIRE(indices.size() == 32);
+  REQUIRE(std::equal(triIds.begin(),triIds.end(),indices.begin()+6));
+  std::vector<float>vertices;
+  batch.getVertexBuffer()->getData(vertices);
+  REQUIRE(std::equal(triangle.begin(),triangle.end(),vertices.begin()+8));
+
+  REQUIRE_THROWS(batch.addMesh(triangle.data(),2,triIds.data(),3));
+  REQUIRE_THROWS(batch.getMesh(2));
+  std::vector<float>big(2*10,0.f);
+  REQUIRE_THROWS(batch.addMesh(big.data(),10,triIds.data(),3));
+  REQUIRE(batch.getNofMeshes() == 2);
+}
+
+TEST_CASE("DrawBatch emits one multi draw indirect per submit"){
+  auto table = createMockTable();
+  DrawBatch batch(table,createParameters());
+  auto const a = batch.addMesh(quad    .data(),4,quadIds.data(),6);
+  auto const b = batch.addMesh(triangle.data(),3,triIds .data(),3);
+
+  batch.submit();
+  REQUIRE(table->getNofCalls("glMultiDrawElementsIndirect") == 0);
+
+  batch.draw(a);
+  batch.draw(b,10,7);
+  batch.draw(a,1,17);
+  REQUIRE(batch.getNofCommands() == 3);
+  batch.submit();
+  REQUIRE(batch.getNofCommands() == 0);
+  REQUIRE(table->getNofCalls("glMultiDrawElementsIndirect") == 1);
+  REQUIRE(table->getNofCalls("glFenceSync"                ) == 1);
+
+  auto const&draw = table->indirectDraws.at(0);
+  REQUIRE(draw.mode   == GL_TRIANGLES);
+  REQUIRE(draw.type   == GL_UNSIGNED_INT);
+  REQUIRE(draw.buffer == batch.getCommandBuffer()->getId());
+  std::vector<GLuint>const expected = {
+    6, 1,0,0, 0,
+    3,10,6,4, 7,
+    6, 1,0,0,17,
+  };
+  REQUIRE(draw.commands == expected);
+
+  batch.draw(b);
+  batch.submit(GL_LINES);
+  REQUIRE(table->indirectDraws.size() == 2);
+  REQUIRE(table->indirectDraws[1].mode     == GL_LINES);
+  REQUIRE(table->indirectDraws[1].offset   >= GLintptr(3*sizeof(DrawBatch::Command)));
+  REQUIRE(table->indirectDraws[1].commands == std::vector<GLuint>({3,1,6,4,0}));
+}
+
+TEST_CASE("DrawBatch limits number of draws per submit"){
+  auto table = createMockTable();
+  DrawBatch batch(table,createParameters());
+  auto const a = batch.addMesh(triangle.data(),3,triIds.data(),3);
+  for(int i=0;i<4;++i)batch.draw(a);
+  REQUIRE_THROWS(batch.draw(a));
+  REQUIRE_THROWS(batch.draw(1));
+  batch.clear();
+  REQUIRE(batch.getNofCommands() == 0);
+  batch.submit();
+  REQUIRE(table->getNofCalls("glMultiDrawElementsIndirect") == 0);
+}
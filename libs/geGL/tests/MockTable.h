@@ -0,0 +1,490 @@
+#pragma once
+
+#include<algorithm>
+#include<cstring>
+#include<iostream>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/TrapTableDecorator.h>
+#include<map>
+#include<set>
+#include<string>
+#include<vector>
+
+/**
+ * @brief Function table that emulates small subset of OpenGL without context.
+ * It is used for testing of geGL objects on machines without GPU.
+ * Functions that are not emulated are trapped by TrapTableDecorator.
+ */
+class MockTable: public ge::gl::FunctionTable{
+  public:
+    struct Uniform{
+      std::string name    ;
+      GLenum      type    ;
+      GLint       size = 1;
+    };
+    struct Block{
+      std::string name    ;
+      GLenum      interf  ;///<GL_UNIFORM_BLOCK or GL_SHADER_STORAGE_BLOCK
+      GLint       binding ;
+      GLint       size    ;
+      std::vector<std::pair<std::string,GLint>>variables;///<name and offset
+    };
+    std::vector<Uniform>uniforms;///<active uniforms of every linked program
+    std::vector<Block  >blocks  ;///<active blocks of every linked program
+
+    mutable std::map<GLuint,std::vector<uint8_t>>buffers;
+    mutable GLuint nextBufferId = 1;
+
+    /**
+     * @brief texture storage, every texel has 4 bytes (RGBA8, RGBA8UI)
+     */
+    struct MockTexture{
+      GLenum internalFormat = 0;
+      std::vector<GLsizei>             widths ;
+      std::vector<GLsizei>             heights;
+      std::vector<std::vector<uint8_t>>levels ;
+      uint8_t const*texel(GLint level,GLint x,GLint y)const{
+        return levels.at((size_t)level).data() + ((size_t)y*(size_t)widths.at((size_t)level) + (size_t)x)*4;
+      }
+    };
+    mutable std::map<GLuint,MockTexture>textures;
+    mutable GLuint nextTextureId = 1;
+
+    /**
+     * @brief glMultiDrawElementsIndirect call, commands are copied from bound GL_DRAW_INDIRECT_BUFFER
+     */
+    struct IndirectDraw{
+      GLenum              mode     = 0;
+      GLenum              type     = 0;
+      GLuint              buffer   = 0;
+      GLintptr            offset   = 0;
+      std::vector<GLuint> commands    ;///<5 values per command
+    };
+    mutable std::vector<IndirectDraw>indirectDraws;
+    mutable GLuint drawIndirectBuffer = 0;
+
+    mutable uintptr_t       nofIssuedFences   = 0;///<fences are numbered from 1
+    mutable uintptr_t       nofSignaledFences = 0;///<fences up to this number are signaled
+    mutable std::set<GLsync>liveFences           ;
+    /**
+     * @brief simulates gpu that has finished all submitted commands
+     */
+    void signalFences()const{nofSignaledFences = nofIssuedFences;}
+
+    static GLenum const binaryFormat = 0x1234;///<format of program binaries
+    bool                rejectBinaries = false;///<simulates driver update
+    mutable GLint       linkStatus     = GL_TRUE;
+    mutable std::string shaderSources  ;///<sources of all shaders of last program
+    mutable std::string programBinary  ;///<binary of last linked program
+
+    std::vector<std::string>extensions;
+    mutable int completionPolls = 0;///<number of GL_COMPLETION_STATUS_KHR queries that return false
+
+    mutable size_t  nofUniformCalls  = 0 ;
+    mutable GLint   lastLocation     = -1;
+    mutable GLfloat lastFloats[16]       ;
+    mutable std::map<std::string,size_t>calls;
+
+    MockTable(std::vector<Uniform>const&u = {},std::vector<Block>const&b = {}):uniforms(u),blocks(b){}
+    size_t getNofCalls(std::string const&name)const{
+      auto ii = calls.find(name);
+      if(ii == calls.end())return 0;
+      return ii->second;
+    }
+    virtual ~MockTable(){}
+  protected:
+    virtual bool m_init()override{
+      auto memberFunctions = (MEMBER_FUNCTION_POINTER*)&this->FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
+      for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+        memberFunctions[i] = nullptr;
+#define GE_GL_MOCK(name)\
+      this->m_ptr_##name = (decltype(FunctionTable::m_ptr_##name))&MockTable::m_##name##_mock
+      GE_GL_MOCK(glCreateProgram          );
+      GE_GL_MOCK(glDeleteProgram          );
+      GE_GL_MOCK(glAttachShader           );
+      GE_GL_MOCK(glDetachShader           );
+      GE_GL_MOCK(glLinkProgram            );
+      GE_GL_MOCK(glProgramParameteri      );
+      GE_GL_MOCK(glGetProgramBinary       );
+      GE_GL_MOCK(glProgramBinary          );
+      GE_GL_MOCK(glGetString              );
+      GE_GL_MOCK(glGetStringi             );
+      GE_GL_MOCK(glGetIntegerv            );
+      GE_GL_MOCK(glMaxShaderCompilerThreadsKHR);
+      GE_GL_MOCK(glCreateShader           );
+      GE_GL_MOCK(glDeleteShader           );
+      GE_GL_MOCK(glShaderSource           );
+      GE_GL_MOCK(glCompileShader          );
+      GE_GL_MOCK(glGetShaderiv            );
+      GE_GL_MOCK(glUseProgram             );
+      GE_GL_MOCK(glGetProgramiv           );
+      GE_GL_MOCK(glGetActiveUniform       );
+      GE_GL_MOCK(glGetUniformLocation     );
+      GE_GL_MOCK(glGetActiveAttrib        );
+      GE_GL_MOCK(glGetAttribLocation      );
+      GE_GL_MOCK(glGetProgramInterfaceiv  );
+      GE_GL_MOCK(glGetProgramResourceName );
+      GE_GL_MOCK(glGetProgramResourceiv   );
+      GE_GL_MOCK(glGetProgramResourceIndex);
+      GE_GL_MOCK(glCreateBuffers          );
+      GE_GL_MOCK(glDeleteBuffers          );
+      GE_GL_MOCK(glNamedBufferData        );
+      GE_GL_MOCK(glNamedBufferStorage     );
+      GE_GL_MOCK(glNamedBufferSubData     );
+      GE_GL_MOCK(glGetNamedBufferSubData  );
+      GE_GL_MOCK(glGetNamedBufferParameteri64v);
+      GE_GL_MOCK(glGetNamedBufferParameteriv  );
+      GE_GL_MOCK(glBindBufferBase         );
+      GE_GL_MOCK(glBindBufferRange        );
+      GE_GL_MOCK(glMapNamedBufferRange    );
+      GE_GL_MOCK(glUnmapNamedBuffer       );
+      GE_GL_MOCK(glFenceSync              );
+      GE_GL_MOCK(glClientWaitSync         );
+      GE_GL_MOCK(glDeleteSync             );
+      GE_GL_MOCK(glProgramUniform1f       );
+      GE_GL_MOCK(glProgramUniformMatrix4fv);
+      GE_GL_MOCK(glBindVertexArray        );
+      GE_GL_MOCK(glDeleteVertexArrays     );
+      GE_GL_MOCK(glActiveTexture          );
+      GE_GL_MOCK(glBindTexture            );
+      GE_GL_MOCK(glBindTextureUnit        );
+      GE_GL_MOCK(glDeleteTextures         );
+      GE_GL_MOCK(glBindBuffer             );
+      GE_GL_MOCK(glEnable                 );
+      GE_GL_MOCK(glDisable                );
+      GE_GL_MOCK(glPolygonMode            );
+      GE_GL_MOCK(glCreateTextures         );
+      GE_GL_MOCK(glTextureStorage2D       );
+      GE_GL_MOCK(glTextureSubImage2D      );
+      GE_GL_MOCK(glTextureParameteri      );
+      GE_GL_MOCK(glPixelStorei            );
+      GE_GL_MOCK(glClearNamedBufferData   );
+      GE_GL_MOCK(glMultiDrawElementsIndirect);
+#undef GE_GL_MOCK
+      return true;
+    }
+    void count(char const*name)const{calls[name]++;}
+    GLuint m_glCreateProgram_mock()const{count("glCreateProgram");return 1;}
+    void m_glDeleteProgram_mock(GLuint)const{count("glDeleteProgram");}
+    void m_glAttachShader_mock(GLuint,GLuint)const{count("glAttachShader");}
+    void m_glDetachShader_mock(GLuint,GLuint)const{count("glDetachShader");}
+    void m_glLinkProgram_mock(GLuint)const{
+      count("glLinkProgram");
+      linkStatus    = GL_TRUE;
+      programBinary = "binary of " + shaderSources;
+      shaderSources = "";
+    }
+    void m_glProgramParameteri_mock(GLuint,GLenum,GLint)const{count("glProgramParameteri");}
+    void m_glGetProgramBinary_mock(GLuint,GLsizei bufSize,GLsizei*length,GLenum*format,void*binary)const{
+      count("glGetProgramBinary");
+      auto const size = std::min((GLsizei)programBinary.size(),bufSize);
+      std::memcpy(binary,programBinary.data(),(size_t)size);
+      if(length)*length = size;
+      *format = binaryFormat;
+    }
+    void m_glProgramBinary_mock(GLuint,GLenum format,void const*binary,GLsizei length)const{
+      count("glProgramBinary");
+      linkStatus = format == binaryFormat && !rejectBinaries;
+      if(linkStatus)programBinary = std::string((char const*)binary,(size_t)length);
+    }
+    GLubyte const*m_glGetString_mock(GLenum name)const{
+      count("glGetString");
+      if(name == GL_RENDERER)return (GLubyte const*)"MockTable";
+      return nullptr;
+    }
+    GLubyte const*m_glGetStringi_mock(GLenum,GLuint index)const{
+      count("glGetStringi");
+      return (GLubyte const*)extensions.at(index).c_str();
+    }
+    void m_glGetIntegerv_mock(GLenum pname,GLint*data)const{
+      count("glGetIntegerv");
+      *data = 0;
+      if(pname == GL_NUM_EXTENSIONS)*data = (GLint)extensions.size();
+    }
+    void m_glMaxShaderCompilerThreadsKHR_mock(GLuint)const{count("glMaxShaderCompilerThreadsKHR");}
+    GLuint m_glCreateShader_mock(GLenum)const{count("glCreateShader");return 1;}
+    void m_glDeleteShader_mock(GLuint)const{count("glDeleteShader");}
+    void m_glShaderSource_mock(GLuint,GLsizei n,GLchar const*const*strings,GLint const*)const{
+      count("glShaderSource");
+      for(GLsizei i=0;i<n;++i)shaderSources += strings[i];
+    }
+    void m_glCompileShader_mock(GLuint)const{count("glCompileShader");}
+    void m_glGetShaderiv_mock(GLuint,GLenum pname,GLint*params)const{
+      count("glGetShaderiv");
+      *params = 0;
+      if(pname == GL_COMPILE_STATUS)*params = GL_TRUE;
+    }
+    void m_glUseProgram_mock(GLuint)const{count("glUseProgram");}
+    void m_glGetProgramiv_mock(GLuint,GLenum pname,GLint*params)const{
+      count("glGetProgramiv");
+      *params = 0;
+      if(pname == GL_LINK_STATUS)*params = linkStatus;
+      if(pname == GL_PROGRAM_BINARY_LENGTH)*params = (GLint)programBinary.size();
+      if(pname == GL_COMPLETION_STATUS_KHR){
+        *params = completionPolls <= 0;
+        if(completionPolls > 0)completionPolls--;
+      }
+      if(pname == GL_ACTIVE_UNIFORMS)*params = (GLint)uniforms.size();
+      if(pname == GL_ACTIVE_UNIFORM_MAX_LENGTH)
+        for(auto const&u:uniforms)*params = std::max(*params,(GLint)u.name.size()+4);
+    }
+    void m_glGetActiveUniform_mock(GLuint,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name)const{
+      count("glGetActiveUniform");
+      auto const&u = uniforms.at(index);
+      std::string n = u.name;
+      if(u.size>1)n += "[0]";
+      std::strncpy(name,n.c_str(),bufSize);
+      if(length)*length = (GLsizei)n.size();
+      *size = u.size;
+      *type = u.type;
+    }
+    GLint m_glGetUniformLocation_mock(GLuint,GLchar const*name)const{
+      count("glGetUniformLocation");
+      std::string n = name;
+      std::string base = n.substr(0,n.find('['));
+      GLint element = 0;
+      if(base.size() != n.size())element = std::atoi(n.c_str()+base.size()+1);
+      GLint location = 0;
+      for(auto const&u:uniforms){
+        if(u.name == base)return location + element;
+        location += u.size;
+      }
+      return -1;
+    }
+    void m_glGetActiveAttrib_mock(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*)const{count("glGetActiveAttrib");}
+    GLint m_glGetAttribLocation_mock(GLuint,GLchar const*)const{count("glGetAttribLocation");return -1;}
+    void m_glGetProgramInterfaceiv_mock(GLuint,GLenum interf,GLenum pname,GLint*params)const{
+      count("glGetProgramInterfaceiv");
+      *params = 0;
+      if(pname == GL_MAX_NAME_LENGTH)*params = 64;
+      if(pname == GL_ACTIVE_RESOURCES){
+        if(interf == GL_UNIFORM_BLOCK || interf == GL_SHADER_STORAGE_BLOCK)
+          *params = (GLint)m_getBlocks(interf).size();
+        else
+          *params = (GLint)m_getVariables(interf).size();
+      }
+    }
+    static GLenum m_variableInterface2BlockInterface(GLenum interf){
+      if(interf == GL_UNIFORM)return GL_UNIFORM_BLOCK;
+      return GL_SHADER_STORAGE_BLOCK;
+    }
+    std::vector<Block const*>m_getBlocks(GLenum interf)const{
+      std::vector<Block const*>result;
+      for(auto const&b:blocks)
+        if(b.interf == interf)result.push_back(&b);
+      return result;
+    }
+    std::vector<std::pair<std::string,GLint>>m_getVariables(GLenum interf)const{
+      std::vector<std::pair<std::string,GLint>>result;
+      for(auto const&b:m_getBlocks(m_variableInterface2BlockInterface(interf)))
+        for(auto const&v:b->variables)result.push_back(v);
+      return result;
+    }
+    void m_glGetProgramResourceName_mock(GLuint,GLenum interf,GLuint index,GLsizei bufSize,GLsizei*length,GLchar*name)const{
+      count("glGetProgramResourceName");
+      std::string n;
+      if(interf == GL_UNIFORM_BLOCK || interf == GL_SHADER_STORAGE_BLOCK)
+        n = m_getBlocks(interf).at(index)->name;
+      else
+        n = m_getVariables(interf).at(index).first;
+      std::strncpy(name,n.c_str(),bufSize);
+      if(length)*length = (GLsizei)n.size();
+    }
+    GLuint m_glGetProgramResourceIndex_mock(GLuint,GLenum interf,GLchar const*name)const{
+      count("glGetProgramResourceIndex");
+      auto const b = m_getBlocks(interf);
+      for(size_t i=0;i<b.size();++i)
+        if(b[i]->name == name)return (GLuint)i;
+      return GL_INVALID_INDEX;
+    }
+    void m_glGetProgramResourceiv_mock(GLuint,GLenum interf,GLuint index,GLsizei propCount,GLenum const*props,GLsizei bufSize,GLsizei*length,GLint*params)const{
+      count("glGetProgramResourceiv");
+      GLsizei written = 0;
+      for(GLsizei p=0;p<propCount;++p){
+        if(interf == GL_UNIFORM_BLOCK || interf == GL_SHADER_STORAGE_BLOCK){
+          auto const&b = *m_getBlocks(interf).at(index);
+          if(props[p] == GL_ACTIVE_VARIABLES){
+            GLint first = 0;
+            for(auto const&o:m_getBlocks(interf)){
+              if(o == &b)break;
+              first += (GLint)o->variables.size();
+            }
+            for(size_t v=0;v<b.variables.size()&&written<bufSize;++v)
+              params[written++] = first + (GLint)v;
+            continue;
+          }
+          GLint value = 0;
+          if(props[p] == GL_BUFFER_BINDING      )value = b.binding;
+          if(props[p] == GL_BUFFER_DATA_SIZE    )value = b.size;
+          if(props[p] == GL_NUM_ACTIVE_VARIABLES)value = (GLint)b.variables.size();
+          if(written<bufSize)params[written++] = value;
+        }else{
+          GLint value = 0;
+          if(props[p] == GL_OFFSET)value = m_getVariables(interf).at(index).second;
+          if(written<bufSize)params[written++] = value;
+        }
+      }
+      if(length)*length = written;
+    }
+    void m_glCreateBuffers_mock(GLsizei n,GLuint*ids)const{
+      count("glCreateBuffers");
+      for(GLsizei i=0;i<n;++i){
+        ids[i] = nextBufferId++;
+        buffers[ids[i]];
+      }
+    }
+    void m_glDeleteBuffers_mock(GLsizei n,GLuint const*ids)const{
+      count("glDeleteBuffers");
+      for(GLsizei i=0;i<n;++i)buffers.erase(ids[i]);
+    }
+    void m_glNamedBufferData_mock(GLuint id,GLsizeiptr size,void const*data,GLenum)const{
+      count("glNamedBufferData");
+      auto&b = buffers[id];
+      //uninitialized storage is poisoned so tests catch reads of undefined contents
+      b.assign((size_t)size,0xcd);
+      if(data)std::memcpy(b.data(),data,(size_t)size);
+    }
+    void m_glNamedBufferStorage_mock(GLuint id,GLsizeiptr size,void const*data,GLbitfield flags)const{
+      count("glNamedBufferStorage");
+      m_glNamedBufferData_mock(id,size,data,flags);
+    }
+    void m_glNamedBufferSubData_mock(GLuint id,GLintptr offset,GLsizeiptr size,void const*data)const{
+      count("glNamedBufferSubData");
+      std::memcpy(buffers.at(id).data()+offset,data,(size_t)size);
+    }
+    void m_glGetNamedBufferSubData_mock(GLuint id,GLintptr offset,GLsizeiptr size,void*data)const{
+      count("glGetNamedBufferSubData");
+      std::memcpy(data,buffers.at(id).data()+offset,(size_t)size);
+    }
+    void m_glGetNamedBufferParameteri64v_mock(GLuint id,GLenum pname,GLint64*params)const{
+      count("glGetNamedBufferParameteri64v");
+      *params = 0;
+      if(pname == GL_BUFFER_SIZE)*params = (GLint64)buffers.at(id).size();
+    }
+    void m_glGetNamedBufferParameteriv_mock(GLuint id,GLenum pname,GLint*params)const{
+      count("glGetNamedBufferParameteriv");
+      *params = 0;
+      if(pname == GL_BUFFER_SIZE)*params = (GLint)buffers.at(id).size();
+    }
+    void m_glBindBufferBase_mock(GLenum,GLuint,GLuint)const{count("glBindBufferBase");}
+    void m_glBindBufferRange_mock(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr)const{count("glBindBufferRange");}
+    void*m_glMapNamedBufferRange_mock(GLuint id,GLintptr offset,GLsizeiptr,GLbitfield)const{
+      count("glMapNamedBufferRange");
+      return buffers.at(id).data()+offset;
+    }
+    GLboolean m_glUnmapNamedBuffer_mock(GLuint)const{
+      count("glUnmapNamedBuffer");
+      return GL_TRUE;
+    }
+    GLsync m_glFenceSync_mock(GLenum,GLbitfield)const{
+      count("glFenceSync");
+      auto const sync = reinterpret_cast<GLsync>(++nofIssuedFences);
+      liveFences.insert(sync);
+      return sync;
+    }
+    /**
+     * @brief non zero timeout simulates gpu that finishes commands up to the fence
+     */
+    GLenum m_glClientWaitSync_mock(GLsync sync,GLbitfield,GLuint64 timeout)const{
+      count("glClientWaitSync");
+      if(!liveFences.count(sync))return GL_WAIT_FAILED;
+      auto const id = reinterpret_cast<uintptr_t>(sync);
+      if(id <= nofSignaledFences)return GL_ALREADY_SIGNALED;
+      if(timeout == 0)return GL_TIMEOUT_EXPIRED;
+      nofSignaledFences = id;
+      return GL_CONDITION_SATISFIED;
+    }
+    void m_glDeleteSync_mock(GLsync sync)const{
+      count("glDeleteSync");
+      liveFences.erase(sync);
+    }
+    void m_glProgramUniform1f_mock(GLuint,GLint location,GLfloat v0)const{
+      nofUniformCalls++;
+      lastLocation  = location;
+      lastFloats[0] = v0;
+    }
+    void m_glProgramUniformMatrix4fv_mock(GLuint,GLint location,GLsizei,GLboolean,GLfloat const*v)const{
+      nofUniformCalls++;
+      lastLocation = location;
+      std::memcpy(lastFloats,v,sizeof(lastFloats));
+    }
+    void m_glBindVertexArray_mock(GLuint)const{count("glBindVertexArray");}
+    void m_glDeleteVertexArrays_mock(GLsizei,GLuint const*)const{count("glDeleteVertexArrays");}
+    void m_glActiveTexture_mock(GLenum)const{count("glActiveTexture");}
+    void m_glBindTexture_mock(GLenum,GLuint)const{count("glBindTexture");}
+    void m_glBindTextureUnit_mock(GLuint,GLuint)const{count("glBindTextureUnit");}
+    void m_glDeleteTextures_mock(GLsizei n,GLuint const*ids)const{
+      count("glDeleteTextures");
+      for(GLsizei i=0;i<n;++i)textures.erase(ids[i]);
+    }
+    void m_glBindBuffer_mock(GLenum target,GLuint id)const{
+      count("glBindBuffer");
+      if(target == GL_DRAW_INDIRECT_BUFFER)drawIndirectBuffer = id;
+    }
+    void m_glEnable_mock(GLenum)const{count("glEnable");}
+    void m_glDisable_mock(GLenum)const{count("glDisable");}
+    void m_glPolygonMode_mock(GLenum,GLenum)const{count("glPolygonMode");}
+    void m_glCreateTextures_mock(GLenum,GLsizei n,GLuint*ids)const{
+      count("glCreateTextures");
+      for(GLsizei i=0;i<n;++i){
+        ids[i] = nextTextureId++;
+        textures[ids[i]];
+      }
+    }
+    void m_glTextureStorage2D_mock(GLuint id,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height)const{
+      count("glTextureStorage2D");
+      auto&t = textures.at(id);
+      t.internalFormat = internalFormat;
+      for(GLsizei l=0;l<levels;++l){
+        t.widths .push_back(std::max(width >>l,1));
+        t.heights.push_back(std::max(height>>l,1));
+        t.levels .emplace_back((size_t)t.widths.back()*(size_t)t.heights.back()*4,0);
+      }
+    }
+    void m_glTextureSubImage2D_mock(GLuint id,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum,GLenum,void const*pixels)const{
+      count("glTextureSubImage2D");
+      auto&t = textures.at(id);
+      for(GLsizei y=0;y<height;++y)
+        std::memcpy(
+            t.levels.at((size_t)level).data() + ((size_t)(yoffset+y)*(size_t)t.widths.at((size_t)level) + (size_t)xoffset)*4,
+            (uint8_t const*)pixels + (size_t)y*(size_t)width*4,
+            (size_t)width*4);
+    }
+    void m_glTextureParameteri_mock(GLuint,GLenum,GLint)const{count("glTextureParameteri");}
+    void m_glPixelStorei_mock(GLenum,GLint)const{count("glPixelStorei");}
+    void m_glClearNamedBufferData_mock(GLuint id,GLenum,GLenum,GLenum,void const*)const{
+      count("glClearNamedBufferData");
+      auto&b = buffers.at(id);
+      std::fill(b.begin(),b.end(),(uint8_t)0);
+    }
+    void m_glMultiDrawElementsIndirect_mock(GLenum mode,GLenum type,void const*indirect,GLsizei drawcount,GLsizei stride)const{
+      count("glMultiDrawElementsIndirect");
+      IndirectDraw draw;
+      draw.mode   = mode;
+      draw.type   = type;
+      draw.buffer = drawIndirectBuffer;
+      draw.offset = reinterpret_cast<GLintptr>(indirect);
+      if(stride == 0)stride = 5*sizeof(GLuint);
+      auto const&b = buffers.at(drawIndirectBuffer);
+      for(GLsizei d=0;d<drawcount;++d){
+        GLuint command[5];
+        std::memcpy(command,b.data() + draw.offset + d*stride,sizeof(command));
+        draw.commands.insert(draw.commands.end(),command,command+5);
+      }
+      indirectDraws.push_back(draw);
+    }
+};
+
+/**
+ * @brief creates trapped mock function table
+ *
+ * @param args arguments of MockTable constructor
+ *
+ * @return mock function table
+ */
+template<typename...ARGS>
+std::shared_ptr<ge::gl::TrapTableDecorator<MockTable>>createMockTable(ARGS&&...args){
+  auto table = std::make_shared<ge::gl::TrapTableDecorator<MockTable>>(args...);
+  table->construct();
+  return table;
+}
@@ -0,0 +1,84 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+#include<geGL/ProfileTableDecorator.h>
+#include<sstream>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  template<typename T>
+  shared_ptr<ProfileTableDecorator<T>>createProfileMockTable(){
+    auto table = make_shared<ProfileTableDecorator<T>>();
+    table->construct();
+    return table;
+  }
+}
+
+TEST_CASE("ProfileTableDecorator counts calls per entry point and frame"){
+  auto table = createProfileMockTable<TrapTableDecorator<MockTable>>();
+  REQUIRE(getProfiler(table) != nullptr);
+  REQUIRE(getProfiler(createMockTable()) == nullptr);
+
+  REQUIRE(table->glCreateProgram() == 1);
+  for(int i=0;i<3;++i)table->glUseProgram(1);
+  table->glEnable(GL_DEPTH_TEST);
+  REQUIRE(table->getNofCalls("glUseProgram") == 3);
+  REQUIRE(table->getFrameStatistics().empty());
+
+  table->endFrame();
+  REQUIRE(table->getNofFrames() == 1);
+  auto const frame = table->getFrameStatistics();
+  REQUIRE(frame.size() == 3);
+  size_t useProgramCalls = 0;
+  for(auto const&e:frame)
+    if(string(e.name) == "glUseProgram")useProgramCalls = e.calls;
+  REQUIRE(useProgramCalls == 3);
+
+  table->glUseProgram(1);
+  table->endFrame();
+  REQUIRE(table->getFrameStatistics().size() == 1);
+  REQUIRE(table->getFrameStatistics()[0].calls == 1);
+  auto const total = table->getTotalStatistics();
+  REQUIRE(total.size() == 3);
+  for(auto const&e:total)
+    if(string(e.name) == "glUseProgram")REQUIRE(e.calls == 4);
+
+  stringstream json;
+  table->writeFrameJSON(json);
+  REQUIRE(json.str().find("\"frame\":2") != string::npos);
+  REQUIRE(json.str().find("\"name\":\"glUseProgram\",\"calls\":1") != string::npos);
+
+  table->resetProfiler();
+  REQUIRE(table->getNofFrames() == 0);
+  REQUIRE(table->getTotalStatistics().empty());
+}
+
+TEST_CASE("ProfileTableDecorator keeps last calls in ring buffer"){
+  auto table = createProfileMockTable<TrapTableDecorator<MockTable>>();
+  REQUIRE(table->getTrace().empty());
+  table->setTraceCapacity(4);
+  table->glEnable(GL_DEPTH_TEST);
+  for(int i=0;i<3;++i)table->glUseProgram(1);
+  table->endFrame();
+  table->glBindVertexArray(2);
+
+  auto const trace = table->getTrace();
+  REQUIRE(trace.size() == 4);
+  REQUIRE(string(Profiler::getFunctionName(trace[0].function)) == "glUseProgram");
+  REQUIRE(trace[2].function == Profiler::frameMarker);
+  REQUIRE(string(Profiler::getFunctionName(trace[3].function)) == "glBindVertexArray");
+  REQUIRE(trace[0].begin <= trace[1].begin);
+
+  stringstream chrome;
+  table->writeChromeTrace(chrome);
+  REQUIRE(chrome.str().find("{\"traceEvents\":[{\"name\":\"glUseProgram\",\"ph\":\"X\"") == 0);
+  REQUIRE(chrome.str().find("\"name\":\"frame\",\"ph\":\"i\"") != string::npos);
+}
+
+TEST_CASE("ProfileTableDecorator does not wrap missing functions"){
+  auto table = createProfileMockTable<MockTable>();
+  REQUIRE(table->m_ptr_glUseProgram != nullptr);
+  REQUIRE(table->m_ptr_glBindSampler == nullptr);
+}
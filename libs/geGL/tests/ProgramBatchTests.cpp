@@ -0,0 +1,48 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("ProgramBatch defers compile status and reflection"){
+  auto table = createMockTable(std::vector<MockTable::Uniform>{{"color",GL_FLOAT_VEC4}});
+  table->extensions = {"GL_ARB_debug_output","GL_KHR_parallel_shader_compile"};
+
+  ProgramBatch batch(table,4);
+  REQUIRE(batch.isParallel());
+  REQUIRE(table->getNofCalls("glMaxShaderCompilerThreadsKHR") == 1);
+
+  auto program = batch.add({
+      {GL_VERTEX_SHADER  ,{"#version 460\n","void main(){}"}},
+      {GL_FRAGMENT_SHADER,{"#version 460\n","void main(){}"}},
+      });
+  REQUIRE(batch.getNofPrograms() == 1);
+  REQUIRE(table->getNofCalls("glCompileShader"   ) == 2);
+  REQUIRE(table->getNofCalls("glLinkProgram"     ) == 1);
+  REQUIRE(table->getNofCalls("glGetShaderiv"     ) == 0);
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 0);
+
+  table->completionPolls = 2;
+  REQUIRE(!batch.isReady());
+  REQUIRE(!batch.isReady());
+  REQUIRE( batch.isReady());
+  REQUIRE( batch.getNofReady() == 1);
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 0);
+
+  REQUIRE(batch.wait());
+  REQUIRE(program->getInfo()->uniforms.count("color") == 1);
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 1);
+  program->getUniformHandle("color");
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 1);
+}
+
+TEST_CASE("ProgramBatch without parallel compile extension"){
+  auto table = createMockTable();
+  ProgramBatch batch(table);
+  REQUIRE(!batch.isParallel());
+  REQUIRE(table->getNofCalls("glMaxShaderCompilerThreadsKHR") == 0);
+  batch.add({{GL_COMPUTE_SHADER,{"#version 460\n","void main(){}"}}});
+  REQUIRE(batch.isReady());
+  REQUIRE(table->getNofCalls("glGetProgramiv") == 0);
+}
@@ -0,0 +1,59 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+#include<cstdio>
+#include<fstream>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("ProgramCache stores and loads program binaries"){
+  auto table = createMockTable();
+  ProgramCache::Stages const stages = {
+    {GL_VERTEX_SHADER  ,{"#version 460\n","void main(){gl_Position = vec4(0);}"}},
+    {GL_FRAGMENT_SHADER,{"#version 460\n","void main(){}"                       }},
+  };
+  ProgramCache cache(table,".");
+  auto const fileName = cache.getFileName(cache.getKey(stages));
+  std::remove(fileName.c_str());
+
+  SECTION("key depends on sources and shader types"){
+    auto other = stages;
+    other[1].sources[1] = "void main(){discard;}";
+    REQUIRE(cache.getKey(stages) == cache.getKey(stages));
+    REQUIRE(cache.getKey(stages) != cache.getKey(other ));
+    other = stages;
+    other[1].type = GL_GEOMETRY_SHADER;
+    REQUIRE(cache.getKey(stages) != cache.getKey(other ));
+  }
+
+  SECTION("miss compiles and stores, hit loads binary"){
+    auto program = cache.get(stages);
+    REQUIRE(program->getLinkStatus());
+    REQUIRE(cache.getStatistics().misses == 1);
+    REQUIRE(cache.getStatistics().hits   == 0);
+    REQUIRE(table->getNofCalls("glCompileShader"   ) == 2);
+    REQUIRE(table->getNofCalls("glGetProgramBinary") == 1);
+    REQUIRE(std::ifstream(fileName).good());
+
+    ProgramCache second(table,".");
+    auto loaded = second.get(stages);
+    REQUIRE(loaded->getLinkStatus());
+    REQUIRE(second.getStatistics().hits   == 1);
+    REQUIRE(second.getStatistics().misses == 0);
+    REQUIRE(table->getNofCalls("glCompileShader") == 2);
+    REQUIRE(table->getNofCalls("glProgramBinary") == 1);
+  }
+
+  SECTION("rejected binary falls back to compilation"){
+    cache.get(stages);
+    table->rejectBinaries = true;
+    auto program = cache.get(stages);
+    REQUIRE(program->getLinkStatus());
+    REQUIRE(cache.getStatistics().rejected == 1);
+    REQUIRE(cache.getStatistics().misses   == 2);
+    REQUIRE(table->getNofCalls("glCompileShader") == 4);
+  }
+
+  std::remove(fileName.c_str());
+}
@@ -0,0 +1,94 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("Program reflection is filled lazily per interface"){
+  auto table = createMockTable(
+      std::vector<MockTable::Uniform>{
+        {"color",GL_FLOAT_VEC4    },
+        {"bones",GL_FLOAT_MAT4,256},
+      },
+      std::vector<MockTable::Block>{
+        {"Matrices",GL_UNIFORM_BLOCK,0,64,{{"modelMatrix",0}}},
+      });
+  auto prg = make_shared<Program>(FunctionTablePointer(table));
+  prg->link();
+  REQUIRE(table->getNofCalls("glGetActiveUniform"     ) == 0);
+  REQUIRE(table->getNofCalls("glGetUniformLocation"   ) == 0);
+  REQUIRE(table->getNofCalls("glGetProgramInterfaceiv") == 0);
+
+  auto const bone = prg->getUniformHandle("bones[200]");
+  REQUIRE(bone.location == 1+200);
+  REQUIRE(bone.size     == 1);
+  //one location query per active uniform, array elements are computed
+  REQUIRE(table->getNofCalls("glGetActiveUniform"     ) == 2);
+  REQUIRE(table->getNofCalls("glGetUniformLocation"   ) == 2);
+  REQUIRE(table->getNofCalls("glGetProgramInterfaceiv") == 0);
+  REQUIRE(table->getNofCalls("glGetActiveAttrib"      ) == 0);
+
+  //color, color[0], bones, bones[0..255]
+  auto const&info = prg->getInfo();
+  REQUIRE(info->uniforms.size() == 2+1+256);
+  REQUIRE(std::get<ProgramInfo::LOCATION>(info->uniforms.at("bones[255]")) == 256);
+  REQUIRE(info->uniformBlocks.count("Matrices") == 1);
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 2);
+
+  //relink invalidates reflection
+  prg->link();
+  REQUIRE(prg->getInfo()->uniforms.size() == 2+1+256);
+  REQUIRE(table->getNofCalls("glGetActiveUniform") == 4);
+}
+
+TEST_CASE("ProgramInfoTable keeps map query surface"){
+  ProgramInfo::Table table;
+  table["b"] = ProgramInfo::Properties(1,GL_FLOAT,"b",1);
+  table["a"] = ProgramInfo::Properties(0,GL_FLOAT,"a",1);
+  table["b"] = ProgramInfo::Properties(2,GL_FLOAT,"b",1);
+  REQUIRE(table.size() == 2);
+  REQUIRE(table.count("a") == 1);
+  REQUIRE(table.count("c") == 0);
+  REQUIRE(table.find("c") == table.end());
+  REQUIRE(std::get<ProgramInfo::LOCATION>(table.at("b")) == 2);
+  REQUIRE_THROWS(table.at("c"));
+  REQUIRE(table.findHash(hashUniformName("a"))->first == "a");
+  REQUIRE(ProgramInfo::Table::hash("bones[3]") == hashUniformName("bones[3]"));
+  size_t n = 0;
+  for(auto const&x:table)n += x.first.size();
+  REQUIRE(n == 2);
+  table.clear();
+  REQUIRE(table.empty());
+}
+
+TEST_CASE("ProgramInfoTable lookup benchmark","[.][benchmark]"){
+  size_t const nofLookups = 1000000;
+  for(size_t const nofUniforms:{10,100,1000}){
+    std::vector<std::string>names;
+    std::vector<uint64_t   >hashes;
+    std::map<std::string,ProgramInfo::Properties>map;
+    ProgramInfo::Table table;
+    for(size_t i=0;i<nofUniforms;++i){
+      names.push_back("uniformVariable"+std::to_string(i));
+      hashes.push_back(hashUniformName(names.back().c_str()));
+      auto const p = ProgramInfo::Properties((GLint)i,GL_FLOAT,names.back(),1);
+      map  [names.back()] = p;
+      table[names.back()] = p;
+    }
+    GLint sum = 0;
+    BENCHMARK("std::map lookup, uniforms: "+std::to_string(nofUniforms)){
+      for(size_t i=0;i<nofLookups;++i)
+        sum += std::get<ProgramInfo::LOCATION>(map.find(names[i%nofUniforms])->second);
+    }
+    BENCHMARK("ProgramInfoTable lookup, uniforms: "+std::to_string(nofUniforms)){
+      for(size_t i=0;i<nofLookups;++i)
+        sum += std::get<ProgramInfo::LOCATION>(table.find(names[i%nofUniforms])->second);
+    }
+    BENCHMARK("ProgramInfoTable precomputed hash lookup, uniforms: "+std::to_string(nofUniforms)){
+      for(size_t i=0;i<nofLookups;++i)
+        sum += std::get<ProgramInfo::LOCATION>(table.findHash(hashes[i%nofUniforms])->second);
+    }
+    REQUIRE(sum > 0);
+  }
+}
@@ -0,0 +1,133 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+#include<geGL/StateCacheTableDecorator.h>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  shared_ptr<StateCacheTableDecorator<TrapTableDecorator<MockTable>>>createStateCacheMockTable(){
+    auto table = make_shared<StateCacheTableDecorator<TrapTableDecorator<MockTable>>>();
+    table->construct();
+    return table;
+  }
+}
+
+TEST_CASE("StateCacheTableDecorator eliminates redundant per frame state"){
+  auto table = createStateCacheMockTable();
+  REQUIRE(getStateCache(table) != nullptr);
+  REQUIRE(getStateCache(createMockTable()) == nullptr);
+
+  for(int frame=0;frame<10;++frame){
+    table->glEnable(GL_DEPTH_TEST);
+    table->glBindVertexArray(3);
+    table->glPolygonMode(GL_FRONT_AND_BACK,GL_FILL);
+    table->glUseProgram(1);
+    table->glBindBufferBase(GL_UNIFORM_BUFFER,0,7);
+    table->glBindTextureUnit(0,5);
+  }
+  REQUIRE(table->getNofCalls("glEnable"         ) == 1);
+  REQUIRE(table->getNofCalls("glBindVertexArray") == 1);
+  REQUIRE(table->getNofCalls("glPolygonMode"    ) == 1);
+  REQUIRE(table->getNofCalls("glUseProgram"     ) == 1);
+  REQUIRE(table->getNofCalls("glBindBufferBase" ) == 1);
+  REQUIRE(table->getNofCalls("glBindTextureUnit") == 1);
+
+  auto const&statistics = table->getStateCacheStatistics();
+  REQUIRE(statistics.capability .eliminated == 9);
+  REQUIRE(statistics.program    .forwarded  == 1);
+  REQUIRE(statistics.getNofEliminated() == 6*9);
+  REQUIRE(statistics.getNofForwarded () == 6  );
+
+  table->invalidateStateCache();
+  table->glEnable(GL_DEPTH_TEST);
+  REQUIRE(table->getNofCalls("glEnable") == 2);
+
+  table->resetStateCacheStatistics();
+  REQUIRE(statistics.getNofEliminated() == 0);
+}
+
+TEST_CASE("StateCacheTableDecorator forwards real state changes"){
+  auto table = createStateCacheMockTable();
+
+  table->glEnable (GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  table->glEnable (GL_CULL_FACE );
+  REQUIRE(table->getNofCalls("glEnable" ) == 2);
+  REQUIRE(table->getNofCalls("glDisable") == 1);
+
+  table->glPolygonMode(GL_FRONT_AND_BACK,GL_LINE);
+  table->glPolygonMode(GL_FRONT         ,GL_LINE);
+  table->glPolygonMode(GL_BACK          ,GL_FILL);
+  table->glPolygonMode(GL_FRONT_AND_BACK,GL_FILL);
+  table->glPolygonMode(GL_FRONT_AND_BACK,GL_FILL);
+  REQUIRE(table->getNofCalls("glPolygonMode") == 3);
+
+  //vertex array owns element array buffer binding
+  table->glBindVertexArray(1);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,4);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,4);
+  table->glBindVertexArray(2);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,4);
+  REQUIRE(table->getNofCalls("glBindBuffer") == 2);
+
+  //deleted vertex array reverts binding to zero
+  GLuint const vao = 2;
+  table->glDeleteVertexArrays(1,&vao);
+  table->glBindVertexArray(0);
+  table->glBindVertexArray(2);
+  REQUIRE(table->getNofCalls("glBindVertexArray") == 3);
+
+  //indexed binding also binds generic binding point
+  table->glBindBufferBase(GL_UNIFORM_BUFFER,0,7);
+  table->glBindBuffer    (GL_UNIFORM_BUFFER,7);
+  table->glBindBufferRange(GL_UNIFORM_BUFFER,0,7,0,256);
+  table->glBindBufferRange(GL_UNIFORM_BUFFER,0,7,0,256);
+  table->glBindBufferRange(GL_UNIFORM_BUFFER,0,7,256,256);
+  REQUIRE(table->getNofCalls("glBindBuffer"     ) == 2);
+  REQUIRE(table->getNofCalls("glBindBufferBase" ) == 1);
+  REQUIRE(table->getNofCalls("glBindBufferRange") == 2);
+
+  GLuint const buffer = 7;
+  table->glDeleteBuffers(1,&buffer);
+  table->glBindBufferRange(GL_UNIFORM_BUFFER,0,7,256,256);
+  REQUIRE(table->getNofCalls("glBindBufferRange") == 3);
+}
+
+TEST_CASE("StateCacheTableDecorator tracks texture units"){
+  auto table = createStateCacheMockTable();
+
+  table->glActiveTexture(GL_TEXTURE0);
+  table->glBindTexture(GL_TEXTURE_2D,5);
+  table->glActiveTexture(GL_TEXTURE1);
+  table->glBindTexture(GL_TEXTURE_2D,5);
+  table->glBindTexture(GL_TEXTURE_2D,5);
+  table->glActiveTexture(GL_TEXTURE0);
+  table->glBindTexture(GL_TEXTURE_2D,5);
+  REQUIRE(table->getNofCalls("glActiveTexture") == 3);
+  REQUIRE(table->getNofCalls("glBindTexture"  ) == 2);
+
+  //glBindTextureUnit does not tell target, unit has to be rebound by glBindTexture
+  table->glBindTextureUnit(0,6);
+  table->glBindTextureUnit(0,6);
+  table->glBindTexture(GL_TEXTURE_2D,5);
+  table->glBindTextureUnit(0,6);
+  REQUIRE(table->getNofCalls("glBindTextureUnit") == 2);
+  REQUIRE(table->getNofCalls("glBindTexture"    ) == 3);
+
+  GLuint const texture = 6;
+  table->glDeleteTextures(1,&texture);
+  table->glBindTextureUnit(0,6);
+  REQUIRE(table->getNofCalls("glBindTextureUnit") == 3);
+}
+
+TEST_CASE("StateCacheTableDecorator works under geGL objects"){
+  auto table = createStateCacheMockTable();
+  auto program = make_shared<Program>(FunctionTablePointer(table));
+  for(int frame=0;frame<4;++frame)
+    program->use();
+  REQUIRE(table->getNofCalls("glUseProgram") == 1);
+  REQUIRE(table->getStateCacheStatistics().program.eliminated == 3);
+}
@@ -0,0 +1,75 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("StreamBuffer suballocation"){
+  auto table = createMockTable();
+  {
+    StreamBuffer stream(table,1024,256);
+    REQUIRE(table->getNofCalls("glNamedBufferStorage" ) == 1);
+    REQUIRE(table->getNofCalls("glMapNamedBufferRange") == 1);
+
+    auto a = stream.allocate(100);
+    auto b = stream.allocate(100);
+    auto c = stream.allocate(16,16);
+    REQUIRE(a.offset == 0  );
+    REQUIRE(b.offset == 256);
+    REQUIRE(c.offset == 368);
+    REQUIRE(static_cast<uint8_t*>(b.data) == static_cast<uint8_t*>(stream.getPointer()) + 256);
+
+    uint32_t const value = 1337;
+    std::memcpy(b.data,&value,sizeof(value));
+    std::vector<uint32_t>data;
+    stream.getBuffer()->getData(data);
+    REQUIRE(data.at(256/4) == value);
+    REQUIRE(table->getNofCalls("glNamedBufferSubData") == 0);
+
+    REQUIRE_THROWS(stream.allocate(0   ));
+    REQUIRE_THROWS(stream.allocate(2048));
+  }
+  REQUIRE(table->getNofCalls("glUnmapNamedBuffer") == 1);
+}
+
+TEST_CASE("StreamBuffer recycles regions after fences"){
+  auto table = createMockTable();
+  StreamBuffer stream(table,1024,256);
+
+  //4 frames fill whole ring, gpu is still busy
+  for(int frame=0;frame<4;++frame){
+    REQUIRE(stream.allocate(200).offset == frame*256);
+    stream.fence();
+  }
+  REQUIRE(table->getNofCalls("glFenceSync") == 4);
+  REQUIRE(stream.getNofPendingRegions()     == 4);
+  REQUIRE(stream.getNofWaits()              == 0);
+
+  //wrap around into region of first frame has to wait for its fence
+  REQUIRE(stream.allocate(200).offset == 0);
+  REQUIRE(stream.getNofWaits()          == 1);
+  REQUIRE(stream.getNofPendingRegions() == 3);
+  stream.fence();
+
+  //gpu finished everything, fences are released without waiting
+  table->signalFences();
+  stream.fence();
+  REQUIRE(stream.getNofPendingRegions() == 0);
+  REQUIRE(table->liveFences.empty());
+  REQUIRE(stream.allocate(200).offset == 256);
+  REQUIRE(stream.getNofWaits() == 1);
+}
+
+TEST_CASE("StreamBuffer frame larger than ring"){
+  auto table = createMockTable();
+  StreamBuffer stream(table,1024,256);
+  for(int i=0;i<4;++i)
+    stream.allocate(256);
+  //the frame has used whole ring, allocation fences it and waits
+  REQUIRE(stream.allocate(256).offset == 0);
+  REQUIRE(table->getNofCalls("glFenceSync") == 1);
+  REQUIRE(stream.getNofWaits() == 1);
+  stream.fence();
+  REQUIRE(table->getNofCalls("glFenceSync") == 2);
+}
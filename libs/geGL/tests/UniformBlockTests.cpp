@@ -0,0 +1,67 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("UniformBlock from program"){
+  auto table = createMockTable(
+      std::vector<MockTable::Uniform>{},
+      std::vector<MockTable::Block>{
+        {"Matrices",GL_UNIFORM_BLOCK,2,3*64,{{"modelMatrix",0},{"viewMatrix",64},{"projectionMatrix",128}}},
+      });
+  auto prg = make_shared<Program>(FunctionTablePointer(table));
+  prg->link();
+  REQUIRE(prg->getInfo()->uniformBlocks.count("Matrices") == 1);
+
+  UniformBlock block(*prg,"Matrices");
+  REQUIRE(block.getSize()   == 3*64);
+  REQUIRE(block.getTarget() == GL_UNIFORM_BUFFER);
+  REQUIRE(block.getOffset("viewMatrix"      ) == 64 );
+  REQUIRE(block.getOffset("projectionMatrix") == 128);
+  REQUIRE_THROWS(block.getOffset("nonExisting"));
+  REQUIRE(!block.isDirty());
+
+  float matrix[16];
+  for(int i=0;i<16;++i)matrix[i] = (float)i;
+  block.set("viewMatrix"      ,matrix);
+  block.set("projectionMatrix",matrix);
+  REQUIRE(block.isDirty());
+
+  auto const uploads = table->getNofCalls("glNamedBufferSubData");
+  block.flush();
+  REQUIRE(!block.isDirty());
+  REQUIRE(table->getNofCalls("glNamedBufferSubData") == uploads+1);
+
+  std::vector<float>data;
+  block.getBuffer()->getData(data);
+  REQUIRE(data.size()   == 3*16);
+  REQUIRE(data.at(16+3) == 3.f);
+  REQUIRE(data.at(32+15)== 15.f);
+
+  block.set("viewMatrix",matrix);
+  REQUIRE(!block.isDirty());
+  block.flush();
+  REQUIRE(table->getNofCalls("glNamedBufferSubData") == uploads+1);
+
+  block.bind();
+  REQUIRE(table->getNofCalls("glBindBufferBase") == 1);
+}
+
+TEST_CASE("UniformBlock with explicit size"){
+  auto table = createMockTable();
+  UniformBlock block(table,256);
+  uint32_t const value = 7;
+  block.set(128,value);
+  block.set(4  ,value);
+  block.flush();
+  std::vector<uint32_t>data;
+  block.getBuffer()->getData(data);
+  REQUIRE(data.at(0 ) == 0);
+  REQUIRE(data.at(1 ) == 7);
+  REQUIRE(data.at(2 ) == 0);
+  REQUIRE(data.at(32) == 7);
+  REQUIRE(data.at(63) == 0);
+  REQUIRE(table->getNofCalls("glNamedBufferSubData") == 1);
+}
@@ -0,0 +1,94 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  std::vector<MockTable::Uniform>const earthUniforms = {
+    {"modelMatrix"     ,GL_FLOAT_MAT4},
+    {"viewMatrix"      ,GL_FLOAT_MAT4},
+    {"projectionMatrix",GL_FLOAT_MAT4},
+    {"lightPosition"   ,GL_FLOAT_VEC3},
+    {"shininess"       ,GL_FLOAT     },
+    {"bones"           ,GL_FLOAT_MAT4,4},
+  };
+}
+
+TEST_CASE("Program uniform handles"){
+  auto table = createMockTable(earthUniforms);
+  auto prg = make_shared<Program>(FunctionTablePointer(table));
+  prg->link();
+
+  auto const model = prg->getUniformHandle("modelMatrix");
+  REQUIRE(model.isValid());
+  REQUIRE(model.location == 0);
+  REQUIRE(model.type     == GL_FLOAT_MAT4);
+
+  auto const shininess = prg->getUniformHandle(hashUniformName("shininess"));
+  REQUIRE(shininess.isValid());
+  REQUIRE(shininess.location == 4);
+
+  auto const bone2 = prg->getUniformHandle(hashUniformName("bones[2]"));
+  REQUIRE(bone2.location == 7);
+
+  float matrix[16];
+  for(int i=0;i<16;++i)matrix[i] = (float)i;
+  prg->setMatrix4fv(model,matrix);
+  REQUIRE(table->nofUniformCalls == 1);
+  REQUIRE(table->lastLocation    == 0);
+  REQUIRE(table->lastFloats[15]  == 15.f);
+
+  prg->set1f(shininess,200.f);
+  REQUIRE(table->nofUniformCalls == 2);
+  REQUIRE(table->lastLocation    == 4);
+  REQUIRE(table->lastFloats[0]   == 200.f);
+
+  REQUIRE_THROWS(prg->getUniformHandle("nonExisting"));
+  REQUIRE_THROWS(prg->getUniformHandle(hashUniformName("nonExisting")));
+
+  Program::setNonexistingUniformWarning(false);
+  auto const missing = prg->getUniformHandle("nonExisting");
+  REQUIRE(!missing.isValid());
+  prg->set1f(missing,1.f);
+  REQUIRE(table->nofUniformCalls == 2);
+  Program::setNonexistingUniformWarning(true);
+}
+
+TEST_CASE("Program uniform handles benchmark","[.][benchmark]"){
+  auto table = createMockTable(earthUniforms);
+  auto prg = make_shared<Program>(FunctionTablePointer(table));
+  prg->link();
+
+  size_t const iterations = 1000000;
+  float matrix[16] = {};
+
+  BENCHMARK("setMatrix4fv by name"){
+    for(size_t i=0;i<iterations;++i){
+      prg->setMatrix4fv("modelMatrix"     ,matrix);
+      prg->setMatrix4fv("viewMatrix"      ,matrix);
+      prg->setMatrix4fv("projectionMatrix",matrix);
+    }
+  }
+
+  auto const model      = prg->getUniformHandle("modelMatrix"     );
+  auto const view       = prg->getUniformHandle("viewMatrix"      );
+  auto const projection = prg->getUniformHandle("projectionMatrix");
+  BENCHMARK("setMatrix4fv by handle"){
+    for(size_t i=0;i<iterations;++i){
+      prg->setMatrix4fv(model     ,matrix);
+      prg->setMatrix4fv(view      ,matrix);
+      prg->setMatrix4fv(projection,matrix);
+    }
+  }
+
+  BENCHMARK("setMatrix4fv by hashed name"){
+    for(size_t i=0;i<iterations;++i){
+      prg->setMatrix4fv(prg->getUniformHandle(hashUniformName("modelMatrix"     )),matrix);
+      prg->setMatrix4fv(prg->getUniformHandle(hashUniformName("viewMatrix"      )),matrix);
+      prg->setMatrix4fv(prg->getUniformHandle(hashUniformName("projectionMatrix")),matrix);
+    }
+  }
+  REQUIRE(table->nofUniformCalls == iterations*9);
+}
@@ -0,0 +1,177 @@
+#include<catch.hpp>
+#include<MockTable.h>
+#include<geGL/geGL.h>
+#include<atomic>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  /**
+   * @brief parameters of 1024x512 virtual texture with 128x128 pages (8x4 pages, 4 levels)
+   */
+  VirtualTexture::Parameters createParameters(GLsizei cacheWidth,GLsizei cacheHeight){
+    VirtualTexture::Parameters parameters;
+    parameters.width       = 1024;
+    parameters.height      = 512 ;
+    parameters.pageSize    = 128 ;
+    parameters.cacheWidth  = cacheWidth ;
+    parameters.cacheHeight = cacheHeight;
+    parameters.nofThreads  = 2   ;
+    return parameters;
+  }
+
+  /**
+   * @brief fills page with its level and coordinates
+   */
+  bool loadPage(VirtualTexture::Page const&page,std::vector<uint8_t>&data){
+    data.resize(128*128*4);
+    for(size_t i=0;i<data.size();i+=4){
+      data[i+0] = (uint8_t)page.level;
+      data[i+1] = (uint8_t)page.x;
+      data[i+2] = (uint8_t)page.y;
+      data[i+3] = 255;
+    }
+    return true;
+  }
+}
+
+TEST_CASE("VirtualTexture levels and coarsest page"){
+  auto table = createMockTable();
+  VirtualTexture texture(table,createParameters(4,4),loadPage);
+  REQUIRE(texture.getNofLevels() == 4);
+  REQUIRE(texture.getNofPagesX(0) == 8);
+  REQUIRE(texture.getNofPagesY(0) == 4);
+  REQUIRE(texture.getNofPagesX(2) == 2);
+  REQUIRE(texture.getNofPagesY(2) == 1);
+  REQUIRE(texture.getNofPagesX(3) == 1);
+  REQUIRE(texture.getNofPendingPages() == 1);
+  REQUIRE_THROWS(texture.request(VirtualTexture::Page{0,8,0}));
+  REQUIRE_THROWS(texture.request(VirtualTexture::Page{4,0,0}));
+
+  texture.finish();
+  texture.update();
+  REQUIRE(texture.isResident(VirtualTexture::Page{3,0,0}));
+  REQUIRE(texture.getNofResidentPages() == 1);
+  REQUIRE(texture.getNofPendingPages () == 0);
+
+  auto const&pageTable = table->textures.at(texture.getPageTableTexture()->getId());
+  REQUIRE(pageTable.internalFormat == GL_RGBA8UI);
+  REQUIRE(pageTable.levels.size() == 4);
+  REQUIRE(pageTable.texel(3,0,0)[3] == 255);
+  REQUIRE(pageTable.texel(0,0,0)[3] == 0  );
+  REQUIRE(texture.getShaderSource(0,1,2).find("vtSample") != std::string::npos);
+}
+
+TEST_CASE("VirtualTexture uploads requested pages into cache"){
+  auto table = createMockTable();
+  VirtualTexture texture(table,createParameters(4,4),loadPage);
+  texture.request(VirtualTexture::Page{0,5,3});
+  texture.request(VirtualTexture::Page{0,5,3});
+  REQUIRE(texture.getNofPendingPages() == 2);
+  texture.finish();
+  texture.update();
+  REQUIRE(texture.isResident(VirtualTexture::Page{0,5,3}));
+  REQUIRE(texture.getStatistics().requested == 2);
+  REQUIRE(texture.getStatistics().uploaded  == 2);
+
+  auto const&pageTable = table->textures.at(texture.getPageTableTexture()->getId());
+  auto const entry = pageTable.texel(0,5,3);
+  REQUIRE(entry[3] == 255);
+  auto const&cache = table->textures.at(texture.getCacheTexture()->getId());
+  REQUIRE(cache.widths [0] == 4*128);
+  REQUIRE(cache.heights[0] == 4*128);
+  auto const texel = cache.texel(0,entry[0]*128+64,entry[1]*128+64);
+  REQUIRE(texel[0] == 0);
+  REQUIRE(texel[1] == 5);
+  REQUIRE(texel[2] == 3);
+}
+
+TEST_CASE("VirtualTexture requests pages from feedback"){
+  auto table = createMockTable();
+  VirtualTexture texture(table,createParameters(4,4),loadPage);
+  auto const feedbackId = texture.getFeedbackBuffer()->getId();
+  auto&feedback = table->buffers.at(feedbackId);
+  REQUIRE(feedback.size() == (8*4 + 4*2 + 2*1 + 1)*sizeof(uint32_t));
+
+  uint32_t const one = 1;
+  std::memcpy(feedback.data() + texture.getFeedbackIndex(VirtualTexture::Page{1,3,1})*sizeof(uint32_t),&one,sizeof(one));
+  std::memcpy(feedback.data() + texture.getFeedbackIndex(VirtualTexture::Page{0,7,0})*sizeof(uint32_t),&one,sizeof(one));
+  auto const nofFeedbacks = texture.getParameters().nofFeedbacks;
+  for(size_t i=0;i<nofFeedbacks;++i){
+    texture.update();
+    REQUIRE(texture.getFeedbackBuffer()->getId() != feedbackId);
+  }
+  REQUIRE(texture.getStatistics().requested == 1);
+  REQUIRE(table->getNofCalls("glGetNamedBufferSubData") == 0);
+
+  table->signalFences();
+  texture.update();
+  REQUIRE(texture.getFeedbackBuffer()->getId() == feedbackId);
+  REQUIRE(texture.getStatistics().requested == 3);
+  REQUIRE(table->getNofCalls("glGetNamedBufferSubData") == 1);
+  REQUIRE(std::all_of(feedback.begin(),feedback.end(),[](uint8_t v){return v == 0;}));
+
+  texture.finish();
+  texture.update();
+  REQUIRE(texture.isResident(VirtualTexture::Page{1,3,1}));
+  REQUIRE(texture.isResident(VirtualTexture::Page{0,7,0}));
+
+  auto parameters = createParameters(4,4);
+  parameters.nofFeedbacks = 1;
+  REQUIRE_THROWS(VirtualTexture(table,parameters,loadPage));
+}
+
+TEST_CASE("VirtualTexture evicts least recently used pages"){
+  auto table = createMockTable();
+  VirtualTexture texture(table,createParameters(3,1),loadPage);
+  texture.finish();
+  texture.update();
+
+  VirtualTexture::Page const a{0,0,0};
+  VirtualTexture::Page const b{0,1,0};
+  VirtualTexture::Page const c{0,2,0};
+  texture.request(a);
+  texture.finish();
+  texture.update();
+  texture.request(b);
+  texture.finish();
+  texture.update();
+  texture.request(a);
+  texture.request(c);
+  texture.finish();
+  texture.update();
+
+  REQUIRE(texture.getNofResidentPages() == 3);
+  REQUIRE( texture.isResident(a));
+  REQUIRE(!texture.isResident(b));
+  REQUIRE( texture.isResident(c));
+  REQUIRE( texture.isResident(VirtualTexture::Page{3,0,0}));
+  REQUIRE(texture.getStatistics().evicted == 1);
+  auto const&pageTable = table->textures.at(texture.getPageTableTexture()->getId());
+  REQUIRE(pageTable.texel(0,1,0)[3] == 0  );
+  REQUIRE(pageTable.texel(0,2,0)[3] == 255);
+}
+
+TEST_CASE("VirtualTexture bounds pending pages and retries failed pages"){
+  auto table = createMockTable();
+  std::atomic<int>failures{1};
+  auto parameters = createParameters(4,4);
+  parameters.maxPending = 2;
+  VirtualTexture texture(table,parameters,[&](VirtualTexture::Page const&page,std::vector<uint8_t>&data){
+    if(page.level == 0 && failures-- > 0)return false;
+    return loadPage(page,data);
+  });
+  texture.request(VirtualTexture::Page{0,0,0});
+  texture.request(VirtualTexture::Page{0,1,0});
+  REQUIRE(texture.getStatistics().dropped == 1);
+  texture.finish();
+  texture.update();
+  REQUIRE(texture.getStatistics().failed == 1);
+  REQUIRE(!texture.isResident(VirtualTexture::Page{0,0,0}));
+
+  texture.request(VirtualTexture::Page{0,0,0});
+  texture.finish();
+  texture.update(1);
+  REQUIRE(texture.isResident(VirtualTexture::Page{0,0,0}));
+}
@@ -5,7 +5,11 @@ in vec3 vNormal  ;
 in vec2 vCoord   ;
 in vec3 vPosition;
 
-uniform mat4 viewMatrix = mat4(1);
+layout(binding=0,std140)uniform Matrices{
+  mat4 modelMatrix     ;
+  mat4 viewMatrix      ;
+  mat4 projectionMatrix;
+};
 
 layout(binding=0)uniform sampler2D image;
 
@@ -0,0 +1,590 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <blockCompression.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLOCK_COMPRESSION_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace{
+  /**
+   * @brief 4x4 block of RGBA pixels, channel major (16 reds, 16 greens, ...)
+   */
+  struct Block{
+    alignas(16)float c[4][16];
+  };
+
+  using Endpoints = float[2][4];
+
+  float const bc1Weights[ 4] = {0.f,1.f/3.f,2.f/3.f,1.f};
+  float const bc7Weights[16] = {0,4/64.f,9/64.f,13/64.f,17/64.f,21/64.f,26/64.f,30/64.f,34/64.f,38/64.f,43/64.f,47/64.f,51/64.f,55/64.f,60/64.f,1.f};
+  int   const bc7IntegerWeights[16] = {0,4,9,13,17,21,26,30,34,38,43,47,51,55,60,64};
+
+  void loadBlock(Block&block,uint8_t const*pixels,int width,int height,int channels,int bx,int by){
+    for(int y=0;y<4;++y){
+      int const sy = std::min(by*4+y,height-1);
+      for(int x=0;x<4;++x){
+        int const sx = std::min(bx*4+x,width-1);
+        int const i  = y*4+x;
+        auto const p = pixels + (size_t(sy)*width + sx)*channels;
+        if(channels < 3){
+          block.c[0][i] = block.c[1][i] = block.c[2][i] = p[0];
+          block.c[3][i] = channels == 2 ? p[1] : 255.f;
+        }else{
+          for(int k=0;k<3;++k)block.c[k][i] = p[k];
+          block.c[3][i] = channels == 4 ? p[3] : 255.f;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief computes mean and principal axis of block by power iteration
+   */
+  void principalAxis(float axis[4],float mean[4],Block const&block,int channels){
+    for(int k=0;k<4;++k){
+      mean[k] = 0.f;
+      axis[k] = 0.f;
+    }
+    for(int k=0;k<channels;++k){
+      for(int i=0;i<16;++i)mean[k] += block.c[k][i];
+      mean[k] /= 16.f;
+    }
+    float covariance[4][4] = {};
+    for(int i=0;i<16;++i)
+      for(int k=0;k<channels;++k)
+        for(int l=k;l<channels;++l)
+          covariance[k][l] += (block.c[k][i]-mean[k])*(block.c[l][i]-mean[l]);
+    for(int k=0;k<channels;++k)
+      for(int l=0;l<k;++l)
+        covariance[k][l] = covariance[l][k];
+    int start = 0;
+    for(int k=1;k<channels;++k)
+      if(covariance[k][k] > covariance[start][start])start = k;
+    if(covariance[start][start] <= 0.f)return;
+    for(int k=0;k<channels;++k)axis[k] = covariance[start][k];
+    for(int iteration=0;iteration<8;++iteration){
+      float next[4] = {};
+      float maximum = 0.f;
+      for(int k=0;k<channels;++k){
+        for(int l=0;l<channels;++l)next[k] += covariance[k][l]*axis[l];
+        maximum = std::max(maximum,std::abs(next[k]));
+      }
+      if(maximum <= 0.f)return;
+      for(int k=0;k<channels;++k)axis[k] = next[k]/maximum;
+    }
+    float length = 0.f;
+    for(int k=0;k<channels;++k)length += axis[k]*axis[k];
+    length = std::sqrt(length);
+    for(int k=0;k<channels;++k)axis[k] /= length;
+  }
+
+  /**
+   * @brief endpoints are extreme projections of pixels onto principal axis
+   */
+  void endpointsFromAxis(Endpoints&e,Block const&block,int channels){
+    float mean[4],axis[4];
+    principalAxis(axis,mean,block,channels);
+    float tMin = 0.f;
+    float tMax = 0.f;
+    for(int i=0;i<16;++i){
+      float t = 0.f;
+      for(int k=0;k<channels;++k)t += (block.c[k][i]-mean[k])*axis[k];
+      tMin = std::min(tMin,t);
+      tMax = std::max(tMax,t);
+    }
+    for(int k=0;k<4;++k){
+      e[0][k] = std::min(std::max(mean[k] + tMin*axis[k],0.f),255.f);
+      e[1][k] = std::min(std::max(mean[k] + tMax*axis[k],0.f),255.f);
+    }
+  }
+
+  /**
+   * @brief assigns palette indices by projection of pixels onto segment between palette endpoints
+   *
+   * @param indices output linear palette indices (0 = first endpoint, levels-1 = second endpoint)
+   */
+  void assignIndices(uint8_t indices[16],Block const&block,float const e0[4],float const e1[4],int channels,int levels){
+    float d[4] = {};
+    float length = 0.f;
+    for(int k=0;k<channels;++k){
+      d[k]    = e1[k] - e0[k];
+      length += d[k]*d[k];
+    }
+    if(length < 1e-6f){
+      std::memset(indices,0,16);
+      return;
+    }
+    float const scale = (levels-1)/length;
+#ifdef BLOCK_COMPRESSION_SSE2
+    __m128 const zero    = _mm_setzero_ps();
+    __m128 const half    = _mm_set1_ps(.5f);
+    __m128 const maximum = _mm_set1_ps(float(levels-1));
+    __m128i result[4];
+    for(int j=0;j<4;++j){
+      __m128 t = zero;
+      for(int k=0;k<channels;++k)
+        t = _mm_add_ps(t,_mm_mul_ps(_mm_sub_ps(_mm_load_ps(block.c[k]+j*4),_mm_set1_ps(e0[k])),_mm_set1_ps(d[k]*scale)));
+      t = _mm_min_ps(_mm_max_ps(_mm_add_ps(t,half),zero),maximum);
+      result[j] = _mm_cvttps_epi32(t);
+    }
+    __m128i const packed = _mm_packus_epi16(_mm_packs_epi32(result[0],result[1]),_mm_packs_epi32(result[2],result[3]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(indices),packed);
+#else
+    for(int i=0;i<16;++i){
+      float t = 0.f;
+      for(int k=0;k<channels;++k)t += (block.c[k][i]-e0[k])*d[k];
+      indices[i] = static_cast<uint8_t>(std::min(std::max(t*scale + .5f,0.f),float(levels-1)));
+    }
+#endif
+  }
+
+  float pixelError(Block const&block,int i,float const color[4],int channels){
+    float error = 0.f;
+    for(int k=0;k<channels;++k){
+      float const d = block.c[k][i] - color[k];
+      error += d*d;
+    }
+    return error;
+  }
+
+  /**
+   * @brief improves indices by testing palette entries around projected index
+   *
+   * @param radius number of tested neighbours in both directions
+   */
+  float refineIndices(uint8_t indices[16],Block const&block,float const palette[][4],int levels,int channels,int radius){
+    float error = 0.f;
+    for(int i=0;i<16;++i){
+      int const begin = std::max(indices[i]-radius,0);
+      int const end   = std::min(indices[i]+radius,levels-1);
+      float best = std::numeric_limits<float>::max();
+      for(int l=begin;l<=end;++l){
+        float const e = pixelError(block,i,palette[l],channels);
+        if(e < best){
+          best       = e;
+          indices[i] = static_cast<uint8_t>(l);
+        }
+      }
+      error += best;
+    }
+    return error;
+  }
+
+  /**
+   * @brief least squares fit of endpoints for fixed indices
+   */
+  void leastSquares(Endpoints&e,Block const&block,uint8_t const indices[16],float const*weights,int channels){
+    float a = 0.f,b = 0.f,c = 0.f;
+    float x0[4] = {},x1[4] = {};
+    for(int i=0;i<16;++i){
+      float const w = weights[indices[i]];
+      float const u = 1.f - w;
+      a += u*u;
+      b += u*w;
+      c += w*w;
+      for(int k=0;k<channels;++k){
+        x0[k] += u*block.c[k][i];
+        x1[k] += w*block.c[k][i];
+      }
+    }
+    float const determinant = a*c - b*b;
+    if(std::abs(determinant) < 1e-6f)return;
+    for(int k=0;k<channels;++k){
+      e[0][k] = std::min(std::max((c*x0[k] - b*x1[k])/determinant,0.f),255.f);
+      e[1][k] = std::min(std::max((a*x1[k] - b*x0[k])/determinant,0.f),255.f);
+    }
+  }
+
+  int getNofIterations(BlockQuality quality){
+    return quality == BlockQuality::FAST ? 0 : quality == BlockQuality::NORMAL ? 1 : 4;
+  }
+
+  uint16_t to565(float const e[4]){
+    auto const quantize = [](float v,int maximum){
+      return std::min(std::max(static_cast<int>(v*maximum/255.f + .5f),0),maximum);
+    };
+    return static_cast<uint16_t>(quantize(e[0],31)<<11 | quantize(e[1],63)<<5 | quantize(e[2],31));
+  }
+
+  void from565(int color[3],uint16_t c){
+    int const r = c>>11 & 31,g = c>>5 & 63,b = c & 31;
+    color[0] = r<<3 | r>>2;
+    color[1] = g<<2 | g>>4;
+    color[2] = b<<3 | b>>2;
+  }
+
+  /**
+   * @brief four color BC1 palette in linear order (c0, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1, c1)
+   */
+  void bc1Palette(int palette[4][3],uint16_t c0,uint16_t c1){
+    from565(palette[0],c0);
+    from565(palette[3],c1);
+    for(int k=0;k<3;++k){
+      palette[1][k] = (2*palette[0][k] +   palette[3][k])/3;
+      palette[2][k] = (  palette[0][k] + 2*palette[3][k])/3;
+    }
+  }
+
+  void storeLittleEndian(uint8_t*data,uint64_t value,int bytes){
+    for(int i=0;i<bytes;++i)data[i] = static_cast<uint8_t>(value >> (8*i));
+  }
+
+  uint64_t loadLittleEndian(uint8_t const*data,int bytes){
+    uint64_t result = 0;
+    for(int i=0;i<bytes;++i)result |= uint64_t(data[i]) << (8*i);
+    return result;
+  }
+
+  void compressBC1Color(uint8_t*output,Block const&block,BlockQuality quality){
+    Endpoints e;
+    endpointsFromAxis(e,block,3);
+    uint16_t best[2]     = {};
+    uint8_t  bestIndices[16];
+    float    bestError   = std::numeric_limits<float>::max();
+    int const iterations = getNofIterations(quality);
+    for(int iteration=0;;++iteration){
+      uint16_t const c[2] = {to565(e[0]),to565(e[1])};
+      int   integerPalette[4][3];
+      float palette       [4][4] = {};
+      bc1Palette(integerPalette,c[0],c[1]);
+      for(int l=0;l<4;++l)
+        for(int k=0;k<3;++k)palette[l][k] = float(integerPalette[l][k]);
+      uint8_t indices[16];
+      assignIndices(indices,block,palette[0],palette[3],3,4);
+      float const error = refineIndices(indices,block,palette,4,3,quality == BlockQuality::FAST ? 0 : 3);
+      if(error < bestError){
+        bestError = error;
+        best[0]   = c[0];
+        best[1]   = c[1];
+        std::memcpy(bestIndices,indices,16);
+      }
+      if(iteration == iterations)break;
+      leastSquares(e,block,indices,bc1Weights,3);
+    }
+    if(best[0] < best[1]){
+      std::swap(best[0],best[1]);
+      for(auto&index:bestIndices)index = static_cast<uint8_t>(3-index);
+    }
+    if(best[0] == best[1])std::memset(bestIndices,0,16);
+    uint8_t const codes[4] = {0,2,3,1};
+    uint32_t bits = 0;
+    for(int i=0;i<16;++i)bits |= uint32_t(codes[bestIndices[i]]) << (2*i);
+    storeLittleEndian(output  ,best[0],2);
+    storeLittleEndian(output+2,best[1],2);
+    storeLittleEndian(output+4,bits   ,4);
+  }
+
+  void compressBC3Alpha(uint8_t*output,Block const&block,BlockQuality quality){
+    float const*alpha = block.c[3];
+    int const a0 = static_cast<int>(*std::max_element(alpha,alpha+16) + .5f);
+    int const a1 = static_cast<int>(*std::min_element(alpha,alpha+16) + .5f);
+    uint64_t bits = uint64_t(a0) | uint64_t(a1) << 8;
+    if(a0 != a1){
+      float palette[8];
+      for(int l=0;l<8;++l)palette[l] = float(((7-l)*a0 + l*a1)/7);
+      uint8_t const codes[8] = {0,2,3,4,5,6,7,1};
+      for(int i=0;i<16;++i){
+        int l = std::min(std::max(static_cast<int>((a0 - alpha[i])*7.f/(a0 - a1) + .5f),0),7);
+        if(quality != BlockQuality::FAST){
+          int const begin = std::max(l-1,0);
+          int const end   = std::min(l+1,7);
+          for(int j=begin;j<=end;++j)
+            if(std::abs(palette[j]-alpha[i]) < std::abs(palette[l]-alpha[i]))l = j;
+        }
+        bits |= uint64_t(codes[l]) << (16 + 3*i);
+      }
+    }
+    storeLittleEndian(output,bits,8);
+  }
+
+  /**
+   * @brief writes bits in BC7 order (least significant bit of first byte first)
+   */
+  struct BitWriter{
+    uint8_t*data;
+    int     position;
+    void write(uint32_t value,int bits){
+      for(int i=0;i<bits;++i,++position)
+        if(value >> i & 1)data[position >> 3] |= static_cast<uint8_t>(1 << (position & 7));
+    }
+  };
+
+  struct BitReader{
+    uint8_t const*data;
+    int           position;
+    uint32_t read(int bits){
+      uint32_t result = 0;
+      for(int i=0;i<bits;++i,++position)
+        result |= uint32_t(data[position >> 3] >> (position & 7) & 1) << i;
+      return result;
+    }
+  };
+
+  /**
+   * @brief BC7 mode 6 endpoint: 7 bits per channel and shared p-bit
+   */
+  struct BC7Endpoint{
+    int q[4];
+    int p   ;
+    int value(int k)const{return q[k]*2 + p;}
+  };
+
+  BC7Endpoint quantizeBC7(float const e[4],int p){
+    BC7Endpoint result;
+    result.p = p;
+    for(int k=0;k<4;++k)
+      result.q[k] = std::min(std::max(static_cast<int>((e[k] - p)/2.f + .5f),0),127);
+    return result;
+  }
+
+  float quantizationError(BC7Endpoint const&endpoint,float const e[4]){
+    float error = 0.f;
+    for(int k=0;k<4;++k){
+      float const d = endpoint.value(k) - e[k];
+      error += d*d;
+    }
+    return error;
+  }
+
+  void compressBC7(uint8_t*output,Block const&block,BlockQuality quality){
+    Endpoints e;
+    endpointsFromAxis(e,block,4);
+    BC7Endpoint best[2]    = {};
+    uint8_t     bestIndices[16] = {};
+    float       bestError  = std::numeric_limits<float>::max();
+    int const   iterations = getNofIterations(quality);
+    int const   radius     = quality == BlockQuality::FAST ? 0 : quality == BlockQuality::NORMAL ? 1 : 3;
+    int const   nofPbits   = quality == BlockQuality::HIGH ? 4 : 1;///<tested p-bit combinations
+    for(int iteration=0;;++iteration){
+      uint8_t iterationIndices[16];
+      float   iterationError = std::numeric_limits<float>::max();
+      for(int pbits=0;pbits<nofPbits;++pbits){
+        BC7Endpoint endpoints[2];
+        if(quality == BlockQuality::HIGH){
+          endpoints[0] = quantizeBC7(e[0],pbits & 1);
+          endpoints[1] = quantizeBC7(e[1],pbits >> 1);
+        }else{
+          for(int j=0;j<2;++j){
+            auto const p0 = quantizeBC7(e[j],0);
+            auto const p1 = quantizeBC7(e[j],1);
+            endpoints[j] = quantizationError(p0,e[j]) <= quantizationError(p1,e[j]) ? p0 : p1;
+          }
+        }
+        float palette[16][4];
+        for(int l=0;l<16;++l)
+          for(int k=0;k<4;++k)
+            palette[l][k] = float(((64-bc7IntegerWeights[l])*endpoints[0].value(k) + bc7IntegerWeights[l]*endpoints[1].value(k) + 32) >> 6);
+        uint8_t indices[16];
+        assignIndices(indices,block,palette[0],palette[15],4,16);
+        float const error = refineIndices(indices,block,palette,16,4,radius);
+        if(error < iterationError){
+          iterationError = error;
+          std::memcpy(iterationIndices,indices,16);
+        }
+        if(error < bestError){
+          bestError = error;
+          best[0]   = endpoints[0];
+          best[1]   = endpoints[1];
+          std::memcpy(bestIndices,indices,16);
+        }
+      }
+      if(iteration == iterations)break;
+      leastSquares(e,block,iterationIndices,bc7Weights,4);
+    }
+    if(bestIndices[0] >= 8){
+      std::swap(best[0],best[1]);
+      for(auto&index:bestIndices)index = static_cast<uint8_t>(15-index);
+    }
+    std::memset(output,0,16);
+    BitWriter writer{output,0};
+    writer.write(1 << 6,7);
+    for(int k=0;k<4;++k){
+      writer.write(static_cast<uint32_t>(best[0].q[k]),7);
+      writer.write(static_cast<uint32_t>(best[1].q[k]),7);
+    }
+    writer.write(static_cast<uint32_t>(best[0].p),1);
+    writer.write(static_cast<uint32_t>(best[1].p),1);
+    for(int i=0;i<16;++i)
+      writer.write(bestIndices[i],i == 0 ? 3 : 4);
+  }
+
+  void compressBlock(uint8_t*output,Block const&block,BlockFormat format,BlockQuality quality){
+    switch(format){
+      case BlockFormat::BC1:
+        compressBC1Color(output,block,quality);
+        break;
+      case BlockFormat::BC3:
+        compressBC3Alpha(output  ,block,quality);
+        compressBC1Color(output+8,block,quality);
+        break;
+      case BlockFormat::BC7:
+        compressBC7(output,block,quality);
+        break;
+    }
+  }
+
+  void decompressBC1Color(uint8_t pixels[16][4],uint8_t const*input,bool fourColors){
+    auto const c0 = static_cast<uint16_t>(loadLittleEndian(input  ,2));
+    auto const c1 = static_cast<uint16_t>(loadLittleEndian(input+2,2));
+    auto const bits = loadLittleEndian(input+4,4);
+    int palette[4][4];
+    from565(palette[0],c0);
+    from565(palette[1],c1);
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+    for(int k=0;k<3;++k){
+      if(fourColors || c0 > c1){
+        palette[2][k] = (2*palette[0][k] +   palette[1][k])/3;
+        palette[3][k] = (  palette[0][k] + 2*palette[1][k])/3;
+      }else{
+        palette[2][k] = (palette[0][k] + palette[1][k])/2;
+        palette[3][k] = 0;
+      }
+    }
+    if(!fourColors && c0 <= c1)palette[3][3] = 0;
+    for(int i=0;i<16;++i)
+      for(int k=0;k<4;++k)
+        pixels[i][k] = static_cast<uint8_t>(palette[bits >> (2*i) & 3][k]);
+  }
+
+  void decompressBC3Alpha(uint8_t pixels[16][4],uint8_t const*input){
+    auto const bits = loadLittleEndian(input,8);
+    int const a0 = input[0];
+    int const a1 = input[1];
+    int palette[8] = {a0,a1};
+    if(a0 > a1){
+      for(int l=1;l<7;++l)palette[l+1] = ((7-l)*a0 + l*a1)/7;
+    }else{
+      for(int l=1;l<5;++l)palette[l+1] = ((5-l)*a0 + l*a1)/5;
+      palette[6] = 0;
+      palette[7] = 255;
+    }
+    for(int i=0;i<16;++i)
+      pixels[i][3] = static_cast<uint8_t>(palette[bits >> (16 + 3*i) & 7]);
+  }
+
+  void decompressBC7(uint8_t pixels[16][4],uint8_t const*input){
+    if((input[0] & 0x7f) != 0x40)
+      throw std::invalid_argument("decompressBlocks - only BC7 mode 6 is supported");
+    BitReader reader{input,7};
+    int endpoints[2][4];
+    for(int k=0;k<4;++k){
+      endpoints[0][k] = static_cast<int>(reader.read(7)) << 1;
+      endpoints[1][k] = static_cast<int>(reader.read(7)) << 1;
+    }
+    int const p0 = static_cast<int>(reader.read(1));
+    int const p1 = static_cast<int>(reader.read(1));
+    for(int k=0;k<4;++k){
+      endpoints[0][k] |= p0;
+      endpoints[1][k] |= p1;
+    }
+    for(int i=0;i<16;++i){
+      int const w = bc7IntegerWeights[reader.read(i == 0 ? 3 : 4)];
+      for(int k=0;k<4;++k)
+        pixels[i][k] = static_cast<uint8_t>(((64-w)*endpoints[0][k] + w*endpoints[1][k] + 32) >> 6);
+    }
+  }
+}
+
+/**
+ * @brief gets size of one 4x4 block
+ *
+ * @param format block format
+ *
+ * @return size in bytes
+ */
+size_t getBlockSize(BlockFormat format){
+  return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+/**
+ * @brief gets size of compressed image, partial blocks are padded
+ *
+ * @param width width of image
+ * @param height height of image
+ * @param format block format
+ *
+ * @return size in bytes
+ */
+size_t getCompressedSize(int width,int height,BlockFormat format){
+  return size_t((width+3)/4) * size_t((height+3)/4) * getBlockSize(format);
+}
+
+std::vector<uint8_t>compressBlocks(
+    uint8_t const*pixels    ,
+    int           width     ,
+    int           height    ,
+    int           channels  ,
+    BlockFormat   format    ,
+    BlockQuality  quality   ,
+    size_t        nofThreads){
+  if(!pixels || width <= 0 || height <= 0)
+    throw std::invalid_argument("compressBlocks - empty image");
+  if(channels < 1 || channels > 4)
+    throw std::invalid_argument("compressBlocks - unsupported number of channels: "+std::to_string(channels));
+
+  int  const blocksX   = (width +3)/4;
+  int  const blocksY   = (height+3)/4;
+  auto const blockSize = getBlockSize(format);
+  std::vector<uint8_t>result(getCompressedSize(width,height,format));
+
+  auto const compressRows = [&](int begin,int end){
+    Block block;
+    for(int by=begin;by<end;++by)
+      for(int bx=0;bx<blocksX;++bx){
+        loadBlock(block,pixels,width,height,channels,bx,by);
+        compressBlock(result.data() + (size_t(by)*blocksX + bx)*blockSize,block,format,quality);
+      }
+  };
+
+  if(nofThreads == 0)nofThreads = std::max(1u,std::thread::hardware_concurrency());
+  nofThreads = std::min(nofThreads,size_t(blocksY));
+  if(nofThreads == 1){
+    compressRows(0,blocksY);
+    return result;
+  }
+  std::vector<std::thread>threads;
+  for(size_t t=0;t<nofThreads;++t)
+    threads.emplace_back(compressRows,int(t*blocksY/nofThreads),int((t+1)*blocksY/nofThreads));
+  for(auto&thread:threads)thread.join();
+  return result;
+}
+
+std::vector<uint8_t>decompressBlocks(
+    uint8_t const*blocks,
+    int           width ,
+    int           height,
+    BlockFormat   format){
+  int  const blocksX   = (width +3)/4;
+  int  const blocksY   = (height+3)/4;
+  auto const blockSize = getBlockSize(format);
+  std::vector<uint8_t>result(size_t(width)*height*4);
+  for(int by=0;by<blocksY;++by)
+    for(int bx=0;bx<blocksX;++bx){
+      auto const input = blocks + (size_t(by)*blocksX + bx)*blockSize;
+      uint8_t pixels[16][4];
+      switch(format){
+        case BlockFormat::BC1:
+          decompressBC1Color(pixels,input,false);
+          break;
+        case BlockFormat::BC3:
+          decompressBC1Color(pixels,input+8,true);
+          decompressBC3Alpha(pixels,input);
+          break;
+        case BlockFormat::BC7:
+          decompressBC7(pixels,input);
+          break;
+      }
+      for(int y=0;y<4 && by*4+y<height;++y)
+        for(int x=0;x<4 && bx*4+x<width;++x)
+          std::memcpy(result.data() + (size_t(by*4+y)*width + bx*4+x)*4,pixels[y*4+x],4);
+    }
+  return result;
+}
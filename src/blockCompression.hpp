@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class BlockFormat{
+  BC1,///<8 bytes per 4x4 block, RGB, alpha is ignored
+  BC3,///<16 bytes per 4x4 block, BC1 color + interpolated alpha
+  BC7,///<16 bytes per 4x4 block, RGBA (mode 6 only)
+};
+
+/**
+ * @brief quality/speed knob of block compressor
+ */
+enum class BlockQuality{
+  FAST  ,///<principal axis endpoints, projected indices
+  NORMAL,///<one least squares refinement of endpoints, local index search (BC7)
+  HIGH  ,///<several refinements, exhaustive index search and p-bit search (BC7)
+};
+
+size_t getBlockSize     (BlockFormat format);
+size_t getCompressedSize(int width,int height,BlockFormat format);
+
+/**
+ * @brief compresses 8 bit image into 4x4 blocks, rows of blocks are distributed to threads
+ *
+ * @param pixels image, tightly packed rows
+ * @param width width of image
+ * @param height height of image
+ * @param channels number of channels (1 - 4), 1 and 2 channel images are grey (+ alpha), missing alpha is 255
+ * @param format block format
+ * @param quality quality/speed knob
+ * @param nofThreads number of threads, 0 means number of hardware threads
+ *
+ * @return blocks in row major order, getCompressedSize(width,height,format) bytes
+ */
+std::vector<uint8_t>compressBlocks(
+    uint8_t const*pixels                          ,
+    int           width                           ,
+    int           height                          ,
+    int           channels                        ,
+    BlockFormat   format                          ,
+    BlockQuality  quality    = BlockQuality::NORMAL,
+    size_t        nofThreads = 0                  );
+
+/**
+ * @brief decompresses blocks produced by compressBlocks into RGBA8 image
+ *
+ * @param blocks compressed blocks
+ * @param width width of image
+ * @param height height of image
+ * @param format block format
+ *
+ * @return RGBA8 image, tightly packed rows
+ */
+std::vector<uint8_t>decompressBlocks(
+    uint8_t const*blocks,
+    int           width ,
+    int           height,
+    BlockFormat   format);
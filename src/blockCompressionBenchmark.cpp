@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <blockCompression.hpp>
+
+namespace{
+  char const*formatName(BlockFormat format){
+    switch(format){
+      case BlockFormat::BC1:return "BC1";
+      case BlockFormat::BC3:return "BC3";
+      default              :return "BC7";
+    }
+  }
+
+  char const*qualityName(BlockQuality quality){
+    switch(quality){
+      case BlockQuality::FAST  :return "fast  ";
+      case BlockQuality::NORMAL:return "normal";
+      default                  :return "high  ";
+    }
+  }
+
+  /**
+   * @brief PSNR of RGB channels (and alpha if image has alpha)
+   */
+  double psnr(uint8_t const*image,int channels,std::vector<uint8_t>const&decoded,size_t nofPixels,bool alpha){
+    double error = 0.;
+    int const nofChannels = alpha ? 4 : 3;
+    for(size_t i=0;i<nofPixels;++i)
+      for(int k=0;k<nofChannels;++k){
+        int const original = k < 3 ? image[i*channels + (channels < 3 ? 0 : k)] : image[i*channels + channels-1];
+        double const d = original - decoded[i*4+k];
+        error += d*d;
+      }
+    double const mse = error / double(nofPixels*nofChannels);
+    return mse == 0. ? std::numeric_limits<double>::infinity() : 10.*std::log10(255.*255./mse);
+  }
+}
+
+/**
+ * @brief benchmark of block compression: PSNR and throughput of formats and quality levels
+ *
+ * usage: blockCompressionBenchmark [image] [threads]
+ */
+int main(int argc,char*argv[]){
+  std::string const fileName = argc > 1 ? argv[1] : "../images/earth.png";
+  size_t const threads = argc > 2 ? size_t(std::atoi(argv[2])) : std::max(1u,std::thread::hardware_concurrency());
+
+  int width,height,channels;
+  auto const pixels = stbi_load(fileName.c_str(),&width,&height,&channels,0);
+  if(!pixels){
+    std::cerr << "cannot load " << fileName << std::endl;
+    return 1;
+  }
+  bool const alpha = channels == 2 || channels == 4;
+  auto const nofPixels = size_t(width)*height;
+  std::cout << fileName << " " << width << "x" << height << "x" << channels << ", " << threads << " threads" << std::endl;
+
+  for(auto format:{BlockFormat::BC1,BlockFormat::BC3,BlockFormat::BC7})
+    for(auto quality:{BlockQuality::FAST,BlockQuality::NORMAL,BlockQuality::HIGH}){
+      for(size_t t:{size_t(1),threads}){
+        auto const start  = std::chrono::high_resolution_clock::now();
+        auto const blocks = compressBlocks(pixels,width,height,channels,format,quality,t);
+        auto const time   = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        auto const decoded = decompressBlocks(blocks.data(),width,height,format);
+        std::cout << formatName(format) << " " << qualityName(quality) << " " << t << " threads: "
+                  << time*1000. << " ms, " << nofPixels/time/1e6 << " MPix/s, PSNR "
+                  << psnr(pixels,channels,decoded,nofPixels,alpha && format != BlockFormat::BC1) << " dB" << std::endl;
+        if(threads == 1)break;
+      }
+    }
+  stbi_image_free(pixels);
+  return 0;
+}
@@ -1,9 +1,15 @@
 #include <iostream>
+#include <fstream>
 #include <vector>
+#include <algorithm>
+#include <memory>
+#include <utility>
 
 #include<SDL.h>
 #include<geGL/StaticCalls.h>
 #include<geGL/geGL.h>
+#include<geGL/StateCacheTableDecorator.h>
+#include<geGL/Profiler.h>
 #include<glm/glm.hpp>
 #include<glm/mat3x3.hpp>
 #include<glm/gtx/transform.hpp>
@@ -12,56 +18,17 @@
 #include<stb_image.h>
 
 #include<loadTxtFile.hpp>
+#include<textureLoader.hpp>
+#include<parametricMesh.hpp>
+#include<meshOptimizer.hpp>
+#include<vertexCompression.hpp>
 
 using namespace ge::gl;
 
-GLuint createTexture(std::string const&fileName){
-  int texx;
-  int texy;
-  int channels;
-  std::cerr << "loading: " << fileName << std::endl;
-  auto pixels = stbi_load(fileName.c_str(),&texx,&texy,&channels,0);
-  std::cerr << "channels: " << channels << std::endl;
-  std::cerr << "texx: " << texx << std::endl;
-  std::cerr << "texy: " << texy << std::endl;
-
-  for(int y=0;y<texy/2;++y){
-    for(int x=0;x<texx;++x){
-      for(int c=0;c<channels;++c){
-        auto z = pixels[(y*texx+x)*channels + c];
-        pixels[(y*texx+x)*channels + c] = pixels[((texy-y-1)*texx+x)*channels + c];
-        pixels[((texy-y-1)*texx+x)*channels + c] = z;
-      }
-    }
-  }
-
-  GLuint tex;
-  glCreateTextures(GL_TEXTURE_2D,1,&tex);
-  glBindTexture(GL_TEXTURE_2D,tex);
-
-  glPixelStorei(GL_UNPACK_ROW_LENGTH,texx);
-  glPixelStorei(GL_UNPACK_ALIGNMENT ,1   );
-
-  if(channels == 3)
-    glTexImage2D(GL_TEXTURE_2D,0,GL_RGB8,texx,texy,0,GL_RGB,GL_UNSIGNED_BYTE,pixels);
-
-  if(channels == 4)
-    glTexImage2D(GL_TEXTURE_2D,0,GL_RGBA8,texx,texy,0,GL_RGBA,GL_UNSIGNED_BYTE,pixels);
-
-  stbi_image_free(pixels);
-
-  glGenerateTextureMipmap(tex);
-
-  glTextureParameteri(tex,GL_TEXTURE_MIN_FILTER,GL_LINEAR_MIPMAP_LINEAR);
-  glTextureParameteri(tex,GL_TEXTURE_MAG_FILTER,GL_LINEAR);
-  glTextureParameteri(tex,GL_TEXTURE_WRAP_S,GL_REPEAT);
-  glTextureParameteri(tex,GL_TEXTURE_WRAP_T,GL_REPEAT);
-
-  return tex;
-}
-
 int main(int argc,char*argv[]){
   //SDL2 glfw glaux QT ...
+  //merge consecutive mouse motion and key repeats in the event queue, repeat counts the merged repeats
+  SDL_SetHint(SDL_HINT_EVENT_COALESCING,"1");
   SDL_Init(SDL_INIT_EVERYTHING);
 
   //create window
@@ -76,97 +43,109 @@ int main(int argc,char*argv[]){
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS,SDL_GL_CONTEXT_DEBUG_FLAG);
   auto context  = SDL_GL_CreateContext(window);
 
-  ge::gl::init();
+  //state cache drops glEnable, glPolygonMode, glUseProgram, ... that are repeated every frame
+  //--profile measures all calls instead and writes chrome trace into profile.json
+  auto const hasOption = [&](std::string const&option){
+    return std::find(argv+1,argv+argc,option) != argv+argc;
+  };
+  bool const profile = hasOption("--profile");
+  auto const loader = std::make_shared<ge::gl::DefaultLoader>(ge::gl::getProcAddress);
+  auto table = profile ? ge::gl::createProfileTable(loader) : ge::gl::createStateCacheTable(loader);
+  if(profile)ge::gl::getProfiler(table)->setTraceCapacity(1<<16);
+  ge::gl::setDefaultFunctionTable(table);
+  ge::gl::setDefaultContext(ge::gl::createContext(table));
 
   ge::gl::setDefaultDebugMessage();
  
 
-  struct Vertex{
-    glm::vec3 position;
-    glm::vec3 normal  ;
-    glm::vec2 coord   ;
-  };
-
-  std::vector<Vertex>vertices;
-
-  uint32_t nx = 20;
-  uint32_t ny = 20;
-
-  for(uint32_t iy=0;iy<ny;++iy){
-    for(uint32_t ix=0;ix<nx;++ix){
-      Vertex vertex;
-
-      float yangleNorm = (float)iy / (float)(ny-1);
-      float xangleNorm = (float)ix / (float)(nx-1);
-
-      float xangle = xangleNorm * glm::pi<float>() * 2.f;
-      float yangle = yangleNorm * glm::pi<float>()      ;
-
-      float x = glm::cos(xangle)*glm::sin(yangle);
-      float y =                 -glm::cos(yangle);
-      float z = glm::sin(xangle)*glm::sin(yangle);
-
-      vertex.position = glm::vec3(x,y,z);
-      vertex.normal   = glm::normalize(vertex.position);
-      vertex.coord    = glm::vec2(1-xangleNorm,yangleNorm);
-
-      vertices.push_back(vertex);
-    }
+  //all levels of detail share one vertex and one index buffer,
+  //level is selected every frame from error projected onto screen
+  auto const shape = hasOption("--icosphere") ? ParametricShape::ICOSPHERE :
+                     hasOption("--cube"     ) ? ParametricShape::QUAD_CUBE :
+                                                ParametricShape::UV_SPHERE ;
+  auto sphere = generateSphereLods(shape);
+  //triangles are reordered for post transform cache and overdraw, vertices for fetch locality
+  optimizeMeshLods(sphere);
+  for(size_t i=0;i<sphere.lods.size();++i){
+    std::cerr << "sphere lod " << i << ": triangles: " << sphere.lods[i].nofIndices/3;
+    std::cerr << " vertices: " << sphere.lods[i].nofVertices << " error: " << sphere.lods[i].error << std::endl;
   }
 
-  auto vbo = std::make_shared<ge::gl::Buffer>(vertices);
-
-
-  struct Face{
-    uint32_t triangleA[3];
-    uint32_t triangleB[3];
-
-    void print(){
-      std::cerr << triangleA[0] << " " << triangleA[1] << " "<< triangleA[2];
-      std::cerr << " - ";
-      std::cerr << triangleB[0] << " " << triangleB[1] << " "<< triangleB[2];
-      std::cerr << std::endl;
-    }
-  };
-
-  std::vector<Face>faces;
-
-  for(uint32_t iy=0;iy<ny-1;++iy){
-    for(uint32_t ix=0;ix<nx-1;++ix){
-      Face face;
-
-      face.triangleA[0] = (iy  )*nx + (ix       );
-      face.triangleA[1] = (iy  )*nx + ((ix+1)%nx);
-      face.triangleA[2] = (iy+1)*nx + (ix       );
-
-      face.triangleB[0] = (iy+1)*nx + (ix       );
-      face.triangleB[1] = (iy  )*nx + ((ix+1)%nx);
-      face.triangleB[2] = (iy+1)*nx + ((ix+1)%nx);
-
-      faces.push_back(face);
+  //vertices are quantized to 16 bytes (unorm16 position, octahedral normal, half float coord)
+  auto const compressedSphere = compressVertices(sphere.vertices);
+  std::cerr << "sphere vertex buffer: " << sphere.vertices.size()*sizeof(MeshVertex) << " B -> ";
+  std::cerr << compressedSphere.vertices.size()*sizeof(CompressedVertex) << " B" << std::endl;
+
+  //every level is one mesh of draw batch, draws are submitted by one multi draw indirect
+  DrawBatch::Parameters batchParameters;
+  batchParameters.vertexSize  = sizeof(CompressedVertex);
+  batchParameters.maxVertices = (GLuint)sphere.vertices.size();
+  batchParameters.maxIndices  = (GLuint)sphere.indices .size();
+  batchParameters.maxCommands = 64;
+  DrawBatch batch(batchParameters);
+  std::vector<DrawBatch::MeshId>sphereMeshes;
+  for(auto const&lod:sphere.lods)
+    sphereMeshes.push_back(batch.addMesh(
+          compressedSphere.vertices.data()+lod.firstVertex,lod.nofVertices,
+          sphere.indices .data()+lod.firstIndex ,lod.nofIndices ));
+  //--cull splits every level into clusters, visible clusters are selected by compute shader
+  //(frustum and normal cone test) and drawn by multi draw indirect count
+  bool const cull = hasOption("--cull");
+  std::unique_ptr<ClusterCuller>culler;
+  std::vector<std::pair<GLuint,GLuint>>lodClusters;
+  if(cull){
+    std::vector<ClusterCuller::Cluster>clusters;
+    for(size_t i=0;i<sphere.lods.size();++i){
+      auto const&lod  = sphere.lods[i];
+      auto const&mesh = batch.getMesh(sphereMeshes[i]);
+      auto const lodClusterList = ClusterCuller::buildClusters(
+          sphere.indices.data()+lod.firstIndex,lod.nofIndices,
+          &sphere.vertices[lod.firstVertex].position.x,sizeof(MeshVertex),lod.nofVertices,
+          mesh.firstIndex,(GLint)mesh.firstVertex);
+      lodClusters.emplace_back((GLuint)clusters.size(),(GLuint)lodClusterList.size());
+      clusters.insert(clusters.end(),lodClusterList.begin(),lodClusterList.end());
     }
+    culler = std::make_unique<ClusterCuller>((GLuint)clusters.size());
+    culler->setClusters(clusters);
+    culler->setTests(ClusterCuller::FRUSTUM | ClusterCuller::BACKFACE);
+    std::cerr << "sphere clusters: " << clusters.size() << std::endl;
   }
 
-  auto ebo = std::make_shared<ge::gl::Buffer>(faces);
-
+  auto const&vbo = batch.getVertexBuffer();
+  auto const&ebo = batch.getIndexBuffer ();
 
   auto vao = std::make_shared<ge::gl::VertexArray>();
-  vao->addAttrib(vbo,0,3,GL_FLOAT,sizeof(Vertex),sizeof(float)*0);
-  vao->addAttrib(vbo,1,3,GL_FLOAT,sizeof(Vertex),sizeof(float)*3);
-  vao->addAttrib(vbo,2,2,GL_FLOAT,sizeof(Vertex),sizeof(float)*6);
+  addCompressedAttribs(*vao,vbo,compressedSphere.normalEncoding);
   vao->addElementBuffer(ebo);
 
-  auto prg = std::make_shared<Program>(
-      std::make_shared<Shader>(GL_VERTEX_SHADER  ,"#version 460\n",loadTxtFile("../shaders/earth.vp")),
-      std::make_shared<Shader>(GL_FRAGMENT_SHADER,"#version 460\n",loadTxtFile("../shaders/lightingFunctions.vp"), loadTxtFile("../shaders/earth.fp"))
-      );
+  //linked programs are stored into working directory, next start loads them from binary
+  ProgramCache programCache(".");
+  auto prg = programCache.get({
+      {GL_VERTEX_SHADER  ,{"#version 460\n",loadTxtFile("../shaders/vertexDecode.vp"),loadTxtFile("../shaders/earth.vp")}},
+      {GL_FRAGMENT_SHADER,{"#version 460\n",loadTxtFile("../shaders/lightingFunctions.vp"), loadTxtFile("../shaders/earth.fp")}},
+      });
+  auto const&cacheStats = programCache.getStatistics();
+  std::cerr << "program cache: hits: " << cacheStats.hits << " misses: " << cacheStats.misses;
+  std::cerr << " load: " << cacheStats.loadTime << "s compile: " << cacheStats.compileTime << "s" << std::endl;
   prg->setNonexistingUniformWarning(false);
+  auto const&bounds = compressedSphere.bounds;
+  prg->set3f("positionMin"   ,bounds.min   .x,bounds.min   .y,bounds.min   .z);
+  prg->set3f("positionExtent",bounds.extent.x,bounds.extent.y,bounds.extent.z);
+
+  //all matrices are uploaded using one call per frame
+  auto matrices = std::make_shared<UniformBlock>(*prg,"Matrices");
 
   //locations
+  auto const modelMatrixOffset      = matrices->getOffset("modelMatrix"     );
+  auto const viewMatrixOffset       = matrices->getOffset("viewMatrix"      );
+  auto const projectionMatrixOffset = matrices->getOffset("projectionMatrix");
+
+  matrices->set(modelMatrixOffset,glm::mat4(1.f));
 
   glm::vec3 position = glm::vec3(0.f);
   float scale[2]    = {1.f,1.f};
   float alpha       = 0.f;
+  glm::mat4 modelMatrix = glm::mat4(1.f);
 
   float camXAngle = 0.f;
   float camYAngle = 0.f;
@@ -176,9 +155,20 @@ int main(int argc,char*argv[]){
 
   bool running = true;
 
-  auto tex = createTexture("../images/earth.png");
-
-  glBindTextureUnit(0,tex);
+  //--compress encodes textures to BC7 while loading (baked containers are used as they are)
+  TextureLoader textureLoader;
+  if(hasOption("--compress"))textureLoader.setCompression(TextureCompression{true,BlockFormat::BC7,BlockQuality::FAST});
+  std::shared_ptr<ge::gl::Texture>texture;
+  texture = textureLoader.loadBaked("earth.getex","../images/earth.png");
+  auto const&loadTimes = textureLoader.getTimes();
+  std::cerr << "texture decode : " << loadTimes.decode  << " s" << std::endl;
+  std::cerr << "texture mipmaps: " << loadTimes.mipmaps << " s" << std::endl;
+  std::cerr << "texture compress:" << loadTimes.compression << " s" << std::endl;
+  std::cerr << "texture staging: " << loadTimes.staging << " s" << std::endl;
+  std::cerr << "texture upload : " << loadTimes.upload  << " s" << std::endl;
+  std::cerr << "texture total  : " << loadTimes.total   << " s" << std::endl;
+
+  texture->bind(0);
 
   while(running){//main loop
 
@@ -189,21 +179,22 @@ int main(int argc,char*argv[]){
       if(event.type == SDL_QUIT)
         running = false;
       if(event.type == SDL_KEYDOWN){
+        float const steps = event.key.repeat?event.key.repeat:1;
 
-        if(event.key.keysym.sym == SDLK_w)position[2] += 0.01;
-        if(event.key.keysym.sym == SDLK_s)position[2] -= 0.01;
-        if(event.key.keysym.sym == SDLK_a)position[0] -= 0.01;
-        if(event.key.keysym.sym == SDLK_d)position[0] += 0.01;
-        if(event.key.keysym.sym == SDLK_SPACE)position[1] -= 0.01;
-        if(event.key.keysym.sym == SDLK_LSHIFT)position[1] += 0.01;
+        if(event.key.keysym.sym == SDLK_w)position[2] += 0.01*steps;
+        if(event.key.keysym.sym == SDLK_s)position[2] -= 0.01*steps;
+        if(event.key.keysym.sym == SDLK_a)position[0] -= 0.01*steps;
+        if(event.key.keysym.sym == SDLK_d)position[0] += 0.01*steps;
+        if(event.key.keysym.sym == SDLK_SPACE)position[1] -= 0.01*steps;
+        if(event.key.keysym.sym == SDLK_LSHIFT)position[1] += 0.01*steps;
 
-        if(event.key.keysym.sym == SDLK_t)scale[1] += 0.01;
-        if(event.key.keysym.sym == SDLK_g)scale[1] -= 0.01;
-        if(event.key.keysym.sym == SDLK_f)scale[0] -= 0.01;
-        if(event.key.keysym.sym == SDLK_h)scale[0] += 0.01;
+        if(event.key.keysym.sym == SDLK_t)scale[1] += 0.01*steps;
+        if(event.key.keysym.sym == SDLK_g)scale[1] -= 0.01*steps;
+        if(event.key.keysym.sym == SDLK_f)scale[0] -= 0.01*steps;
+        if(event.key.keysym.sym == SDLK_h)scale[0] += 0.01*steps;
 
-        if(event.key.keysym.sym == SDLK_q)alpha += 0.003;
-        if(event.key.keysym.sym == SDLK_e)alpha -= 0.003;
+        if(event.key.keysym.sym == SDLK_q)alpha += 0.003*steps;
+        if(event.key.keysym.sym == SDLK_e)alpha -= 0.003*steps;
 
         if(event.key.keysym.sym == SDLK_m)wireframe = !wireframe;
 
@@ -211,9 +202,9 @@ int main(int argc,char*argv[]){
         auto S = glm::scale    (glm::mat4(1.f),glm::vec3(scale   [0],scale   [1],1.f));
         auto R = glm::rotate   (glm::mat4(1.f),alpha,glm::vec3(0.f,0.f,1.f));
 
-        auto modelMatrix = T*R*S;
+        modelMatrix = T*R*S;
 
-        prg->setMatrix4fv("modelMatrix",(float*)&modelMatrix);
+        matrices->set(modelMatrixOffset,modelMatrix);
        
       }
       if(event.type == SDL_MOUSEMOTION){
@@ -228,8 +219,9 @@ int main(int argc,char*argv[]){
       }
     }
 
-    auto projectionMatrix = glm::perspective(glm::half_pi<float>(),(float)windowWidth / (float)windowHeight,0.1f,1000.f);
-    prg->setMatrix4fv("projectionMatrix",(float*)&projectionMatrix);
+    float const fovY = glm::half_pi<float>();
+    auto projectionMatrix = glm::perspective(fovY,(float)windowWidth / (float)windowHeight,0.1f,1000.f);
+    matrices->set(projectionMatrixOffset,projectionMatrix);
 
 
     glm::vec3 camPosition;
@@ -238,7 +230,10 @@ int main(int argc,char*argv[]){
     camPosition.z = camDistance*glm::sin(camXAngle)*glm::cos(camYAngle);
 
     auto viewMatrix = glm::lookAt(camPosition,glm::vec3(0,0,0),glm::vec3(0,1,0));
-    prg->setMatrix4fv("viewMatrix",(float*)&viewMatrix);
+    matrices->set(viewMatrixOffset,viewMatrix);
+
+    matrices->flush();
+    matrices->bind();
 
 
     glEnable(GL_DEPTH_TEST);
@@ -253,12 +248,41 @@ int main(int argc,char*argv[]){
       glPolygonMode(GL_FRONT_AND_BACK,GL_FILL);
 
     prg->use();
-    glDrawElements(GL_TRIANGLES,nx*ny*2*3,GL_UNSIGNED_INT,nullptr);
+    float const sphereRadius = glm::max(glm::max(scale[0],scale[1]),1.f);
+    auto const lod = selectSphereLod(sphere,sphereRadius,glm::distance(camPosition,position),fovY,(float)windowHeight);
+    if(cull){
+      auto const modelViewProjection = projectionMatrix*viewMatrix*modelMatrix;
+      auto const objectCamera        = glm::vec3(glm::inverse(modelMatrix)*glm::vec4(camPosition,1.f));
+      culler->cull(&modelViewProjection[0][0],&objectCamera[0],lodClusters[lod].first,lodClusters[lod].second);
+      culler->draw();
+    }else{
+      batch.draw(sphereMeshes[lod]);
+      batch.submit();
+    }
 
     vao->unbind();
 
     SDL_GL_SwapWindow(window);
 
+    if(profile)ge::gl::getProfiler(table)->endFrame();
+  }
+
+  if(cull){
+    auto const cullStats = culler->getStatistics();
+    std::cerr << "clusters: " << cullStats.nofClusters << " visible: " << cullStats.nofVisible;
+    std::cerr << " frustum culled: " << cullStats.nofFrustumCulled << " backface culled: " << cullStats.nofBackfaceCulled << std::endl;
+  }
+
+  if(profile){
+    auto const profiler = ge::gl::getProfiler(table);
+    profiler->writeFrameJSON(std::cerr);
+    std::cerr << std::endl;
+    std::ofstream trace("profile.json");
+    profiler->writeChromeTrace(trace);
+  }else{
+    auto const&stateCache = ge::gl::getStateCache(table)->getStateCacheStatistics();
+    std::cerr << "state cache eliminated: " << stateCache.getNofEliminated() << std::endl;
+    std::cerr << "state cache forwarded : " << stateCache.getNofForwarded () << std::endl;
   }
   return 0;
 }
@@ -0,0 +1,333 @@
+#include <meshOptimizer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include<glm/glm.hpp>
+
+namespace{
+  /**
+   * @brief FIFO post transform cache, vertices are stamped with time of insertion
+   */
+  class FifoCache{
+    public:
+      FifoCache(size_t nofVertices,size_t size):stamps(nofVertices,0),size(size){}
+      bool access(uint32_t vertex){
+        if(vertex >= stamps.size())
+          throw std::invalid_argument("index "+std::to_string(vertex)+" is out of range of vertices");
+        if(stamps[vertex] != 0 && time - stamps[vertex] < size)return true;
+        stamps[vertex] = ++time;
+        return false;
+      }
+      void reset(){
+        time += size;
+      }
+    private:
+      std::vector<size_t>stamps  ;
+      size_t             size    ;
+      size_t             time = 0;
+  };
+
+  /**
+   * @brief vertex score of Forsyth's algorithm
+   */
+  class VertexScore{
+    public:
+      VertexScore(size_t cacheSize):cacheSize(cacheSize){
+        for(size_t p=0;p<cacheSize;++p){
+          if(p < 3)cacheScores.push_back(lastTriangleScore);
+          else cacheScores.push_back(std::pow(1.f - float(p-3)/float(cacheSize-3),cacheDecayPower));
+        }
+        for(size_t v=0;v<valenceScores.size();++v)
+          valenceScores[v] = v == 0 ? 0.f : valenceBoostScale * std::pow(float(v),-valenceBoostPower);
+      }
+      float operator()(int cachePosition,uint32_t remaining)const{
+        if(remaining == 0)return -1.f;
+        float score = 0.f;
+        if(cachePosition >= 0)score += cacheScores[(size_t)cachePosition];
+        if(remaining < valenceScores.size())score += valenceScores[remaining];
+        else score += valenceBoostScale * std::pow(float(remaining),-valenceBoostPower);
+        return score;
+      }
+    private:
+      static constexpr float cacheDecayPower   = 1.5f ;
+      static constexpr float lastTriangleScore = 0.75f;
+      static constexpr float valenceBoostScale = 2.f  ;
+      static constexpr float valenceBoostPower = 0.5f ;
+      size_t              cacheSize        ;
+      std::vector<float>  cacheScores      ;
+      std::array<float,32>valenceScores    ;
+  };
+
+  glm::vec3 getPosition(float const*positions,size_t stride,uint32_t vertex){
+    float const*p = reinterpret_cast<float const*>(reinterpret_cast<uint8_t const*>(positions) + stride*vertex);
+    return glm::vec3(p[0],p[1],p[2]);
+  }
+
+  /**
+   * @brief number of cache misses of triangles [begin,end) with cold cache
+   */
+  size_t countMisses(std::vector<uint32_t>const&indices,size_t begin,size_t end,size_t nofVertices,size_t cacheSize){
+    FifoCache cache(nofVertices,cacheSize);
+    size_t misses = 0;
+    for(size_t i=begin*3;i<end*3;++i)
+      misses += !cache.access(indices[i]);
+    return misses;
+  }
+}
+
+VertexCacheStatistics analyzeVertexCache(
+    std::vector<uint32_t>const&indices    ,
+    size_t                     nofVertices,
+    size_t                     cacheSize  ){
+  VertexCacheStatistics result;
+  result.nofTriangles = indices.size() / 3;
+  FifoCache cache(nofVertices,cacheSize);
+  std::vector<bool>used(nofVertices,false);
+  for(auto const index:indices){
+    result.nofTransformed += !cache.access(index);
+    if(!used[index])result.nofVertices++;
+    used[index] = true;
+  }
+  if(result.nofTriangles)result.acmr = float(result.nofTransformed) / float(result.nofTriangles);
+  if(result.nofVertices )result.atvr = float(result.nofTransformed) / float(result.nofVertices );
+  return result;
+}
+
+std::vector<uint32_t>optimizeVertexCache(
+    std::vector<uint32_t>const&indices    ,
+    size_t                     nofVertices,
+    size_t                     cacheSize  ){
+  if(indices.size() % 3 != 0)
+    throw std::invalid_argument("optimizeVertexCache - number of indices is not divisible by 3");
+  if(cacheSize < 4)
+    throw std::invalid_argument("optimizeVertexCache - cache has to have at least 4 entries");
+  for(auto const index:indices)
+    if(index >= nofVertices)
+      throw std::invalid_argument("optimizeVertexCache - index "+std::to_string(index)+" is out of range of vertices");
+
+  size_t const nofTriangles = indices.size() / 3;
+  VertexScore const computeScore(cacheSize);
+
+  //triangles adjacent to every vertex, emitted triangles are swapped behind remaining ones
+  std::vector<uint32_t>remaining(nofVertices,0);
+  for(auto const index:indices)remaining[index]++;
+  std::vector<uint32_t>offsets(nofVertices+1,0);
+  for(size_t v=0;v<nofVertices;++v)offsets[v+1] = offsets[v] + remaining[v];
+  std::vector<uint32_t>adjacency(indices.size());
+  {
+    auto fill = offsets;
+    for(size_t t=0;t<nofTriangles;++t)
+      for(size_t k=0;k<3;++k)
+        adjacency[fill[indices[t*3+k]]++] = uint32_t(t);
+  }
+
+  std::vector<float>vertexScores(nofVertices);
+  for(size_t v=0;v<nofVertices;++v)vertexScores[v] = computeScore(-1,remaining[v]);
+  std::vector<float>triangleScores(nofTriangles);
+  for(size_t t=0;t<nofTriangles;++t)
+    triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3+1]] + vertexScores[indices[t*3+2]];
+  std::vector<bool>emitted(nofTriangles,false);
+
+  std::vector<uint32_t>cache;
+  std::vector<uint32_t>newCache;
+  cache   .reserve(cacheSize+3);
+  newCache.reserve(cacheSize+3);
+
+  std::vector<uint32_t>result;
+  result.reserve(indices.size());
+
+  size_t cursor = 0;///<triangles before cursor are emitted
+  int64_t best = nofTriangles ? int64_t(std::max_element(triangleScores.begin(),triangleScores.end()) - triangleScores.begin()) : -1;
+  while(result.size() < indices.size()){
+    if(best < 0){
+      //cache does not touch any remaining triangle, continue with the first remaining one
+      while(emitted[cursor])cursor++;
+      best = int64_t(cursor);
+    }
+
+    auto const triangle = uint32_t(best);
+    emitted[triangle] = true;
+    for(size_t k=0;k<3;++k){
+      auto const v = indices[triangle*3+k];
+      result.push_back(v);
+      auto const begin = adjacency.begin() + offsets[v];
+      auto const end   = begin + remaining[v];
+      std::iter_swap(std::find(begin,end,triangle),end-1);
+      remaining[v]--;
+    }
+
+    //LRU: vertices of emitted triangle go to front, cache can overflow by 3 vertices
+    newCache.clear();
+    for(size_t k=0;k<3;++k)newCache.push_back(indices[triangle*3+k]);
+    for(auto const v:cache)
+      if(std::find(newCache.begin(),newCache.end(),v) == newCache.end())newCache.push_back(v);
+    if(newCache.size() > cacheSize){
+      //vertices that fell out of cache lose cache bonus
+      for(size_t i=cacheSize;i<newCache.size();++i){
+        auto const v = newCache[i];
+        vertexScores[v] = computeScore(-1,remaining[v]);
+        for(uint32_t a=offsets[v];a<offsets[v]+remaining[v];++a){
+          auto const t = adjacency[a];
+          triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3+1]] + vertexScores[indices[t*3+2]];
+        }
+      }
+      newCache.resize(cacheSize);
+    }
+    std::swap(cache,newCache);
+
+    for(size_t i=0;i<cache.size();++i){
+      auto const v = cache[i];
+      vertexScores[v] = computeScore(int(i),remaining[v]);
+    }
+
+    best = -1;
+    float bestScore = -1.f;
+    for(auto const v:cache){
+      for(uint32_t a=offsets[v];a<offsets[v]+remaining[v];++a){
+        auto const t = adjacency[a];
+        auto const score = vertexScores[indices[t*3]] + vertexScores[indices[t*3+1]] + vertexScores[indices[t*3+2]];
+        triangleScores[t] = score;
+        if(score > bestScore){
+          bestScore = score;
+          best      = t;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<uint32_t>optimizeOverdraw(
+    std::vector<uint32_t>const&indices    ,
+    float               const*positions  ,
+    size_t                     nofVertices,
+    size_t                     stride     ,
+    float                      threshold  ,
+    size_t                     cacheSize  ){
+  if(indices.size() % 3 != 0)
+    throw std::invalid_argument("optimizeOverdraw - number of indices is not divisible by 3");
+  size_t const nofTriangles = indices.size() / 3;
+  if(nofTriangles == 0)return indices;
+
+  //hard boundaries: triangles whose vertices all miss the cache
+  std::vector<size_t>hard;
+  {
+    FifoCache cache(nofVertices,cacheSize);
+    for(size_t t=0;t<nofTriangles;++t){
+      size_t misses = 0;
+      for(size_t k=0;k<3;++k)misses += !cache.access(indices[t*3+k]);
+      if(t == 0 || misses == 3)hard.push_back(t);
+    }
+    hard.push_back(nofTriangles);
+  }
+
+  //soft boundaries: split hard clusters where ACMR of prefix is within threshold of ACMR of whole cluster
+  std::vector<size_t>boundaries;
+  for(size_t h=0;h+1<hard.size();++h){
+    auto const begin = hard[h  ];
+    auto const end   = hard[h+1];
+    auto const clusterAcmr = float(countMisses(indices,begin,end,nofVertices,cacheSize)) / float(end-begin);
+    boundaries.push_back(begin);
+    FifoCache cache(nofVertices,cacheSize);
+    size_t start  = begin;
+    size_t misses = 0;
+    for(size_t t=begin;t<end;++t){
+      for(size_t k=0;k<3;++k)misses += !cache.access(indices[t*3+k]);
+      //very short clusters would only lose cache hits
+      auto const prefix = t+1-start;
+      if(t+1 < end && prefix >= 8 && float(misses) / float(prefix) <= clusterAcmr * threshold){
+        boundaries.push_back(t+1);
+        start  = t+1;
+        misses = 0;
+        cache.reset();
+      }
+    }
+  }
+  boundaries.push_back(nofTriangles);
+
+  //area weighted centroid and normal of clusters
+  glm::vec3 meshCentroid(0.f);
+  float     meshArea = 0.f;
+  struct Cluster{
+    size_t begin;
+    size_t end  ;
+    float  key  ;
+  };
+  std::vector<Cluster>clusters;
+  std::vector<glm::vec3>centroids;
+  std::vector<glm::vec3>normals  ;
+  for(size_t c=0;c+1<boundaries.size();++c){
+    glm::vec3 centroid(0.f);
+    glm::vec3 normal  (0.f);
+    float     area = 0.f;
+    for(size_t t=boundaries[c];t<boundaries[c+1];++t){
+      auto const a = getPosition(positions,stride,indices[t*3+0]);
+      auto const b = getPosition(positions,stride,indices[t*3+1]);
+      auto const d = getPosition(positions,stride,indices[t*3+2]);
+      auto const n = glm::cross(b-a,d-a);
+      auto const s = glm::length(n);
+      centroid += (a+b+d) / 3.f * s;
+      normal   += n;
+      area     += s;
+    }
+    meshCentroid += centroid;
+    meshArea     += area;
+    centroids.push_back(area > 0.f ? centroid / area : centroid);
+    normals  .push_back(normal);
+    clusters .push_back(Cluster{boundaries[c],boundaries[c+1],0.f});
+  }
+  if(meshArea > 0.f)meshCentroid /= meshArea;
+  for(size_t c=0;c<clusters.size();++c){
+    auto const length = glm::length(normals[c]);
+    if(length > 0.f)clusters[c].key = glm::dot(centroids[c] - meshCentroid,normals[c] / length);
+  }
+
+  //clusters that face away from center occlude the rest, they are drawn first
+  std::stable_sort(clusters.begin(),clusters.end(),[](Cluster const&a,Cluster const&b){return a.key > b.key;});
+
+  std::vector<uint32_t>result;
+  result.reserve(indices.size());
+  for(auto const&cluster:clusters)
+    result.insert(result.end(),indices.begin()+cluster.begin*3,indices.begin()+cluster.end*3);
+  return result;
+}
+
+std::vector<uint32_t>optimizeVertexFetchRemap(
+    std::vector<uint32_t>&indices    ,
+    size_t                nofVertices){
+  std::vector<uint32_t>remap(nofVertices,noVertexRemap);
+  uint32_t next = 0;
+  for(auto&index:indices){
+    if(index >= nofVertices)
+      throw std::invalid_argument("optimizeVertexFetchRemap - index "+std::to_string(index)+" is out of range of vertices");
+    if(remap[index] == noVertexRemap)remap[index] = next++;
+    index = remap[index];
+  }
+  return remap;
+}
+
+void optimizeMeshLods(MeshLodChain&chain){
+  MeshLodChain result;
+  for(auto lod:chain.lods){
+    std::vector<MeshVertex>vertices(chain.vertices.begin()+lod.firstVertex,chain.vertices.begin()+lod.firstVertex+lod.nofVertices);
+    std::vector<uint32_t  >indices (chain.indices .begin()+lod.firstIndex ,chain.indices .begin()+lod.firstIndex +lod.nofIndices );
+
+    indices  = optimizeVertexCache(indices,vertices.size());
+    indices  = optimizeOverdraw   (indices,&vertices.front().position.x,vertices.size(),sizeof(MeshVertex));
+    vertices = optimizeVertexFetch(indices,vertices);
+
+    lod.firstVertex = (uint32_t)result.vertices.size();
+    lod.nofVertices = (uint32_t)vertices.size();
+    lod.firstIndex  = (uint32_t)result.indices .size();
+    lod.nofIndices  = (uint32_t)indices .size();
+    result.vertices.insert(result.vertices.end(),vertices.begin(),vertices.end());
+    result.indices .insert(result.indices .end(),indices .begin(),indices .end());
+    result.lods.push_back(lod);
+  }
+  chain = std::move(result);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <parametricMesh.hpp>
+
+/**
+ * @brief post transform vertex cache efficiency of index buffer (FIFO cache simulation)
+ */
+struct VertexCacheStatistics{
+  size_t nofTriangles   = 0  ;
+  size_t nofVertices    = 0  ;///<number of referenced vertices
+  size_t nofTransformed = 0  ;///<number of cache misses (vertex shader invocations)
+  float  acmr           = 0.f;///<average cache miss ratio, transformed / triangles (0.5 is ideal for large grids)
+  float  atvr           = 0.f;///<average transformed vertex ratio, transformed / vertices (1 is ideal)
+};
+
+/**
+ * @brief simulates FIFO post transform cache
+ *
+ * @param indices triangle list
+ * @param nofVertices number of vertices
+ * @param cacheSize size of simulated cache
+ *
+ * @return statistics
+ */
+VertexCacheStatistics analyzeVertexCache(
+    std::vector<uint32_t>const&indices        ,
+    size_t                     nofVertices    ,
+    size_t                     cacheSize   = 16);
+
+/**
+ * @brief reorders triangles for post transform cache (Tom Forsyth, Linear-Speed Vertex Cache Optimisation)
+ *
+ * @param indices triangle list
+ * @param nofVertices number of vertices
+ * @param cacheSize size of modelled LRU cache
+ *
+ * @return reordered triangle list
+ */
+std::vector<uint32_t>optimizeVertexCache(
+    std::vector<uint32_t>const&indices        ,
+    size_t                     nofVertices    ,
+    size_t                     cacheSize   = 32);
+
+/**
+ * @brief reorders clusters of cache optimized triangle list to reduce overdraw
+ * (Sander, Nehab, Barczak, Fast Triangle Reordering for Vertex Locality and Reduced Overdraw).
+ * List is split where the cache is cold and where ACMR of cluster prefix stays within threshold,
+ * clusters are sorted so that clusters facing away from mesh center are drawn first.
+ *
+ * @param indices cache optimized triangle list
+ * @param positions x,y,z of the first vertex
+ * @param nofVertices number of vertices
+ * @param stride distance between positions in bytes
+ * @param threshold allowed ACMR degradation (1.05 = 5%)
+ * @param cacheSize size of simulated cache
+ *
+ * @return reordered triangle list
+ */
+std::vector<uint32_t>optimizeOverdraw(
+    std::vector<uint32_t>const&indices           ,
+    float               const*positions          ,
+    size_t                     nofVertices       ,
+    size_t                     stride            ,
+    float                      threshold  = 1.05f,
+    size_t                     cacheSize  = 16   );
+
+uint32_t const noVertexRemap = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief renumbers vertices in order of first use, indices are rewritten
+ *
+ * @param indices triangle list, it is rewritten
+ * @param nofVertices number of vertices
+ *
+ * @return new index of every old vertex, unused vertices have noVertexRemap
+ */
+std::vector<uint32_t>optimizeVertexFetchRemap(
+    std::vector<uint32_t>&indices    ,
+    size_t                nofVertices);
+
+/**
+ * @brief reorders vertices in order of first use, unused vertices are removed
+ *
+ * @param indices triangle list, it is rewritten
+ * @param vertices vertices
+ *
+ * @return reordered vertices
+ */
+template<typename VERTEX>
+std::vector<VERTEX>optimizeVertexFetch(std::vector<uint32_t>&indices,std::vector<VERTEX>const&vertices){
+  auto const remap = optimizeVertexFetchRemap(indices,vertices.size());
+  size_t nofUsed = 0;
+  for(auto const r:remap)
+    if(r != noVertexRemap)nofUsed++;
+  std::vector<VERTEX>result(nofUsed);
+  for(size_t i=0;i<remap.size();++i)
+    if(remap[i] != noVertexRemap)result[remap[i]] = vertices[i];
+  return result;
+}
+
+/**
+ * @brief runs vertex cache, overdraw and vertex fetch optimization on every level of detail
+ *
+ * @param chain levels of detail, draw ranges are updated
+ */
+void optimizeMeshLods(MeshLodChain&chain);
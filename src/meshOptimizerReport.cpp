@@ -0,0 +1,43 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <meshOptimizer.hpp>
+#include <parametricMesh.hpp>
+
+/**
+ * @brief prints ACMR and ATVR of generated spheres before and after optimization
+ */
+int main(){
+  char const*shapeNames[] = {"uv sphere","icosphere","quad cube"};
+  ParametricShape const shapes[] = {ParametricShape::UV_SPHERE,ParametricShape::ICOSPHERE,ParametricShape::QUAD_CUBE};
+  size_t const cacheSizes[] = {16,32};
+
+  std::cout << std::fixed << std::setprecision(3);
+  for(size_t s=0;s<3;++s){
+    auto const original  = generateSphereLods(shapes[s]);
+    auto       optimized = original;
+    auto const start = std::chrono::high_resolution_clock::now();
+    optimizeMeshLods(optimized);
+    auto const end   = std::chrono::high_resolution_clock::now();
+    std::cout << shapeNames[s] << " (optimization: " << std::chrono::duration<double>(end-start).count() << " s)" << std::endl;
+
+    for(size_t l=0;l<original.lods.size();++l){
+      auto const getIndices = [&](MeshLodChain const&chain){
+        auto const&lod = chain.lods[l];
+        return std::vector<uint32_t>(chain.indices.begin()+lod.firstIndex,chain.indices.begin()+lod.firstIndex+lod.nofIndices);
+      };
+      auto const before = getIndices(original );
+      auto const after  = getIndices(optimized);
+      std::cout << "  lod " << l << " triangles: " << std::setw(6) << before.size()/3;
+      for(auto const cacheSize:cacheSizes){
+        auto const a = analyzeVertexCache(before,original .lods[l].nofVertices,cacheSize);
+        auto const b = analyzeVertexCache(after ,optimized.lods[l].nofVertices,cacheSize);
+        std::cout << " | fifo " << cacheSize << " acmr " << a.acmr << " -> " << b.acmr;
+        std::cout << " atvr " << a.atvr << " -> " << b.atvr;
+      }
+      std::cout << std::endl;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <mipmaps.hpp>
+
+namespace{
+  char const*kernelName(MipmapKernel kernel){
+    switch(kernel){
+      case MipmapKernel::SCALAR:return "scalar";
+      case MipmapKernel::SSE2  :return "sse2  ";
+      case MipmapKernel::AVX2  :return "avx2  ";
+      default                  :return "auto  ";
+    }
+  }
+
+  int maxDifference(std::vector<MipmapLevel>const&a,std::vector<MipmapLevel>const&b){
+    int result = 0;
+    for(size_t l=0;l<a.size();++l)
+      for(size_t i=0;i<a[l].data.size();++i)
+        result = std::max(result,std::abs(int(a[l].data[i]) - int(b[l].data[i])));
+    return result;
+  }
+}
+
+/**
+ * @brief benchmark of mipmap generation on image tiled to 8K resolution
+ *
+ * usage: mipmapBenchmark [image] [width] [height]
+ */
+int main(int argc,char*argv[]){
+  std::string const fileName = argc > 1 ? argv[1] : "../images/earth.png";
+  int const width  = argc > 2 ? std::atoi(argv[2]) : 8192;
+  int const height = argc > 3 ? std::atoi(argv[3]) : 4096;
+
+  int w,h,channels;
+  auto const pixels = stbi_load(fileName.c_str(),&w,&h,&channels,0);
+  if(!pixels){
+    std::cerr << "cannot load " << fileName << std::endl;
+    return 1;
+  }
+
+  for(int c:{4,3}){
+    std::vector<uint8_t>image(size_t(width)*height*c);
+    for(int y=0;y<height;++y)
+      for(int x=0;x<width;++x)
+        for(int k=0;k<c;++k)
+          image[(size_t(y)*width+x)*c+k] = pixels[((y%h)*w+(x%w))*channels + std::min(k,channels-1)];
+
+    for(auto filter:{MipmapFilter::BOX,MipmapFilter::KAISER}){
+      std::vector<MipmapLevel>reference;
+      double referenceTime = 0.;
+      for(auto kernel:{MipmapKernel::SCALAR,MipmapKernel::SSE2,MipmapKernel::AVX2}){
+        if(!isMipmapKernelSupported(kernel))continue;
+        auto const start = std::chrono::high_resolution_clock::now();
+        auto const levels = generateMipmaps(image.data(),width,height,c,true,filter,kernel);
+        auto const time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        if(kernel == MipmapKernel::SCALAR){
+          reference     = levels;
+          referenceTime = time;
+        }
+        std::cout << (c == 4 ? "RGBA8 " : "RGB8  ")
+                  << (filter == MipmapFilter::BOX ? "box    " : "kaiser ")
+                  << kernelName(kernel) << " "
+                  << time*1000. << " ms, "
+                  << width*double(height)/time*1e-6 << " MPix/s, "
+                  << "speedup " << referenceTime/time << ", "
+                  << "max difference " << maxDifference(reference,levels) << std::endl;
+      }
+    }
+  }
+  stbi_image_free(pixels);
+  return 0;
+}
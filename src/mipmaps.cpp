@@ -0,0 +1,371 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <mipmaps.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MIPMAPS_X86
+#include <immintrin.h>
+#endif
+
+#if defined(MIPMAPS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MIPMAPS_AVX2
+#define MIPMAPS_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace{
+  constexpr int linearSize = 1<<14;///<resolution of linear to 8 bit table
+
+  /**
+   * @brief conversion tables, second half of every table is used for alpha
+   */
+  struct Tables{
+    float   toLinear  [2*256           ];
+    uint8_t fromLinear[2*linearSize + 4];///<padded for 4 byte gathers
+    Tables(bool srgb){
+      for(int i=0;i<256;++i){
+        float const v = i/255.f;
+        toLinear[i      ] = srgb ? (v <= 0.04045f ? v/12.92f : std::pow((v+0.055f)/1.055f,2.4f)) : v;
+        toLinear[i + 256] = v;
+      }
+      for(int i=0;i<linearSize;++i){
+        float const v = i/float(linearSize-1);
+        float const s = srgb ? (v <= 0.0031308f ? v*12.92f : 1.055f*std::pow(v,1.f/2.4f)-0.055f) : v;
+        fromLinear[i             ] = static_cast<uint8_t>(std::lround(s*255.f));
+        fromLinear[i + linearSize] = static_cast<uint8_t>(std::lround(v*255.f));
+      }
+      std::memset(fromLinear + 2*linearSize,0,4);
+    }
+  };
+
+  Tables const&getTables(bool srgb){
+    static Tables const srgbTables  (true );
+    static Tables const linearTables(false);
+    return srgb ? srgbTables : linearTables;
+  }
+
+  /**
+   * @brief separable filter, output pixel x uses source pixels 2x+first .. 2x+first+taps-1
+   */
+  struct Filter{
+    int               first  ;
+    std::vector<float>weights;
+  };
+
+  double besselI0(double x){
+    double sum  = 1.;
+    double term = 1.;
+    for(int k=1;k<32;++k){
+      term *= (x/(2.*k))*(x/(2.*k));
+      sum  += term;
+    }
+    return sum;
+  }
+
+  Filter createFilter(MipmapFilter filter){
+    if(filter == MipmapFilter::BOX)return Filter{0,{.5f,.5f}};
+    double const pi    = 3.14159265358979323846;
+    double const alpha = 4.;
+    Filter result{-3,{}};
+    double sum = 0.;
+    for(int j=0;j<8;++j){
+      double const d      = j - 3.5;///<distance from center of output pixel in source pixels
+      double const x      = pi*d/2.;
+      double const sinc   = std::sin(x)/x;
+      double const t      = d/4.;
+      double const window = besselI0(alpha*std::sqrt(1.-t*t))/besselI0(alpha);
+      result.weights.push_back(static_cast<float>(sinc*window));
+      sum += sinc*window;
+    }
+    for(auto&w:result.weights)w = static_cast<float>(w/sum);
+    return result;
+  }
+
+  bool hasAlpha(int channels){
+    return channels == 2 || channels == 4;
+  }
+
+  int alphaOffset(size_t i,int channels,int offset){
+    return hasAlpha(channels) && int(i % channels) == channels-1 ? offset : 0;
+  }
+
+  int alphaChannel(int channels){
+    return hasAlpha(channels) ? channels-1 : channels;
+  }
+
+  struct Kernels{
+    void(*toLinear  )(float  *dst,uint8_t const*src,size_t n,int channels,Tables const&tables);
+    void(*horizontal)(float  *dst,float const*src,int srcWidth,int dstWidth,int channels,Filter const&filter);
+    void(*vertical  )(float  *dst,float const*const*rows,float const*weights,int taps,size_t n);
+    void(*fromLinear)(uint8_t*dst,float const*src,size_t n,int channels,Tables const&tables);
+  };
+
+  void toLinearScalar(float*dst,uint8_t const*src,size_t n,int channels,Tables const&tables){
+    int const alpha = alphaChannel(channels);
+    int       k     = 0;
+    for(size_t i=0;i<n;++i){
+      dst[i] = tables.toLinear[src[i] + (k == alpha ? 256 : 0)];
+      if(++k == channels)k = 0;
+    }
+  }
+
+  void horizontalScalar(float*dst,float const*src,int srcWidth,int dstWidth,int channels,Filter const&filter){
+    int const taps = static_cast<int>(filter.weights.size());
+    for(int x=0;x<dstWidth;++x)
+      for(int k=0;k<channels;++k){
+        float sum = 0.f;
+        for(int j=0;j<taps;++j){
+          int const sx = std::min(std::max(2*x+filter.first+j,0),srcWidth-1);
+          sum += filter.weights[j]*src[sx*channels+k];
+        }
+        dst[x*channels+k] = sum;
+      }
+  }
+
+  void verticalScalar(float*dst,float const*const*rows,float const*weights,int taps,size_t n){
+    for(size_t i=0;i<n;++i){
+      float sum = 0.f;
+      for(int j=0;j<taps;++j)
+        sum += weights[j]*rows[j][i];
+      dst[i] = sum;
+    }
+  }
+
+  int linearIndex(float v){
+    v = std::min(std::max(v,0.f),1.f);
+    return static_cast<int>(v*(linearSize-1) + .5f);
+  }
+
+  /**
+   * @brief converts linear values to 8 bit, n does not have to be multiple of channels
+   * but src has to start at first channel (or the image has no alpha)
+   */
+  void fromLinearScalar(uint8_t*dst,float const*src,size_t n,int channels,Tables const&tables){
+    int const alpha = alphaChannel(channels);
+    int       k     = 0;
+    for(size_t i=0;i<n;++i){
+      dst[i] = tables.fromLinear[linearIndex(src[i]) + (k == alpha ? linearSize : 0)];
+      if(++k == channels)k = 0;
+    }
+  }
+
+#ifdef MIPMAPS_X86
+  void horizontalSSE2(float*dst,float const*src,int srcWidth,int dstWidth,int channels,Filter const&filter){
+    if(channels != 4){
+      horizontalScalar(dst,src,srcWidth,dstWidth,channels,filter);
+      return;
+    }
+    int const taps = static_cast<int>(filter.weights.size());
+    __m128 weights[8];
+    for(int j=0;j<taps;++j)weights[j] = _mm_set1_ps(filter.weights[j]);
+    for(int x=0;x<dstWidth;++x){
+      int const begin = 2*x+filter.first;
+      __m128 sum = _mm_setzero_ps();
+      if(begin >= 0 && begin+taps <= srcWidth){
+        for(int j=0;j<taps;++j)
+          sum = _mm_add_ps(sum,_mm_mul_ps(weights[j],_mm_loadu_ps(src + (begin+j)*4)));
+      }else{
+        for(int j=0;j<taps;++j){
+          int const sx = std::min(std::max(begin+j,0),srcWidth-1);
+          sum = _mm_add_ps(sum,_mm_mul_ps(weights[j],_mm_loadu_ps(src + sx*4)));
+        }
+      }
+      _mm_storeu_ps(dst + x*4,sum);
+    }
+  }
+
+  void verticalSSE2(float*dst,float const*const*rows,float const*weights,int taps,size_t n){
+    size_t i=0;
+    for(;i+4<=n;i+=4){
+      __m128 sum = _mm_setzero_ps();
+      for(int j=0;j<taps;++j)
+        sum = _mm_add_ps(sum,_mm_mul_ps(_mm_set1_ps(weights[j]),_mm_loadu_ps(rows[j]+i)));
+      _mm_storeu_ps(dst+i,sum);
+    }
+    for(;i<n;++i){
+      float sum = 0.f;
+      for(int j=0;j<taps;++j)sum += weights[j]*rows[j][i];
+      dst[i] = sum;
+    }
+  }
+
+  void fromLinearSSE2(uint8_t*dst,float const*src,size_t n,int channels,Tables const&tables){
+    __m128 const zero  = _mm_setzero_ps();
+    __m128 const one   = _mm_set1_ps(1.f);
+    __m128 const scale = _mm_set1_ps(float(linearSize-1));
+    __m128 const half  = _mm_set1_ps(.5f);
+    alignas(16)int32_t index[4];
+    size_t i=0;
+    if(4 % channels == 0 || !hasAlpha(channels)){
+      __m128i const offsets = _mm_set_epi32(alphaOffset(3,channels,linearSize),alphaOffset(2,channels,linearSize),alphaOffset(1,channels,linearSize),alphaOffset(0,channels,linearSize));
+      for(;i+4<=n;i+=4){
+        __m128 const v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src+i),zero),one);
+        _mm_store_si128(reinterpret_cast<__m128i*>(index),_mm_add_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v,scale),half)),offsets));
+        dst[i  ] = tables.fromLinear[index[0]];
+        dst[i+1] = tables.fromLinear[index[1]];
+        dst[i+2] = tables.fromLinear[index[2]];
+        dst[i+3] = tables.fromLinear[index[3]];
+      }
+    }
+    fromLinearScalar(dst+i,src+i,n-i,channels,tables);
+  }
+#endif
+
+#ifdef MIPMAPS_AVX2
+  MIPMAPS_AVX2_TARGET __m256i alphaOffsets(int channels,int offset){
+    alignas(32)int32_t offsets[8];
+    for(int l=0;l<8;++l)offsets[l] = alphaOffset(l,channels,offset);
+    return _mm256_load_si256(reinterpret_cast<__m256i const*>(offsets));
+  }
+
+  MIPMAPS_AVX2_TARGET void toLinearAVX2(float*dst,uint8_t const*src,size_t n,int channels,Tables const&tables){
+    size_t i=0;
+    if(8 % channels == 0 || !hasAlpha(channels)){
+      __m256i const offsets = alphaOffsets(channels,256);
+      for(;i+8<=n;i+=8){
+        __m256i const index = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(src+i))),offsets);
+        _mm256_storeu_ps(dst+i,_mm256_i32gather_ps(tables.toLinear,index,4));
+      }
+    }
+    toLinearScalar(dst+i,src+i,n-i,channels,tables);
+  }
+
+  MIPMAPS_AVX2_TARGET void verticalAVX2(float*dst,float const*const*rows,float const*weights,int taps,size_t n){
+    size_t i=0;
+    for(;i+8<=n;i+=8){
+      __m256 sum = _mm256_setzero_ps();
+      for(int j=0;j<taps;++j)
+        sum = _mm256_add_ps(sum,_mm256_mul_ps(_mm256_set1_ps(weights[j]),_mm256_loadu_ps(rows[j]+i)));
+      _mm256_storeu_ps(dst+i,sum);
+    }
+    for(;i<n;++i){
+      float sum = 0.f;
+      for(int j=0;j<taps;++j)sum += weights[j]*rows[j][i];
+      dst[i] = sum;
+    }
+  }
+
+  MIPMAPS_AVX2_TARGET void fromLinearAVX2(uint8_t*dst,float const*src,size_t n,int channels,Tables const&tables){
+    size_t i=0;
+    if(8 % channels == 0 || !hasAlpha(channels)){
+      __m256  const zero    = _mm256_setzero_ps();
+      __m256  const one     = _mm256_set1_ps(1.f);
+      __m256  const scale   = _mm256_set1_ps(float(linearSize-1));
+      __m256  const half    = _mm256_set1_ps(.5f);
+      __m256i const mask    = _mm256_set1_epi32(0xff);
+      __m256i const offsets = alphaOffsets(channels,linearSize);
+      auto    const table   = reinterpret_cast<int const*>(tables.fromLinear);
+      for(;i+8<=n;i+=8){
+        __m256  const v      = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src+i),zero),one);
+        __m256i const index  = _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(v,scale),half)),offsets);
+        __m256i const values = _mm256_and_si256(_mm256_i32gather_epi32(table,index,1),mask);
+        __m256i const packed = _mm256_packus_epi16(_mm256_packus_epi32(values,values),_mm256_setzero_si256());
+        int32_t const lo = _mm_cvtsi128_si32(_mm256_castsi256_si128   (packed  ));
+        int32_t const hi = _mm_cvtsi128_si32(_mm256_extracti128_si256(packed,1));
+        std::memcpy(dst+i  ,&lo,4);
+        std::memcpy(dst+i+4,&hi,4);
+      }
+    }
+    fromLinearScalar(dst+i,src+i,n-i,channels,tables);
+  }
+#endif
+
+  Kernels getKernels(MipmapKernel kernel){
+    if(kernel == MipmapKernel::AUTO){
+      if     (isMipmapKernelSupported(MipmapKernel::AVX2))kernel = MipmapKernel::AVX2;
+      else if(isMipmapKernelSupported(MipmapKernel::SSE2))kernel = MipmapKernel::SSE2;
+      else                                                 kernel = MipmapKernel::SCALAR;
+    }
+    if(!isMipmapKernelSupported(kernel))
+      throw std::invalid_argument("generateMipmaps - kernel is not supported by this CPU");
+    switch(kernel){
+#ifdef MIPMAPS_X86
+      case MipmapKernel::SSE2:return Kernels{toLinearScalar,horizontalSSE2,verticalSSE2,fromLinearSSE2};
+#endif
+#ifdef MIPMAPS_AVX2
+      case MipmapKernel::AVX2:return Kernels{toLinearAVX2  ,horizontalSSE2,verticalAVX2,fromLinearAVX2};
+#endif
+      default:                return Kernels{toLinearScalar,horizontalScalar,verticalScalar,fromLinearScalar};
+    }
+  }
+
+  MipmapLevel downsample(
+      uint8_t const*src     ,
+      int           width   ,
+      int           height  ,
+      int           channels,
+      Filter  const&filter  ,
+      Tables  const&tables  ,
+      Kernels const&kernels ){
+    MipmapLevel result;
+    result.width  = std::max(1,width /2);
+    result.height = std::max(1,height/2);
+    size_t const srcRow = static_cast<size_t>(width       )*channels;
+    size_t const dstRow = static_cast<size_t>(result.width)*channels;
+    result.data.resize(dstRow*result.height);
+
+    //horizontally filtered rows, consecutive source rows never share slot
+    int const taps = static_cast<int>(filter.weights.size());
+    std::vector<float>linear(srcRow);
+    std::vector<float>cache (dstRow*taps);
+    std::vector<int  >cached(taps,-1);
+    std::vector<float>filtered(dstRow);
+    std::vector<float const*>rows(taps);
+
+    for(int y=0;y<result.height;++y){
+      for(int j=0;j<taps;++j){
+        int const sy   = std::min(std::max(2*y+filter.first+j,0),height-1);
+        int const slot = sy % taps;
+        float*const row = cache.data() + slot*dstRow;
+        if(cached[slot] != sy){
+          kernels.toLinear  (linear.data(),src + sy*srcRow,srcRow,channels,tables);
+          kernels.horizontal(row,linear.data(),width,result.width,channels,filter);
+          cached[slot] = sy;
+        }
+        rows[j] = row;
+      }
+      kernels.vertical  (filtered.data(),rows.data(),filter.weights.data(),taps,dstRow);
+      kernels.fromLinear(result.data.data() + y*dstRow,filtered.data(),dstRow,channels,tables);
+    }
+    return result;
+  }
+}
+
+bool isMipmapKernelSupported(MipmapKernel kernel){
+  switch(kernel){
+    case MipmapKernel::AUTO  :
+    case MipmapKernel::SCALAR:return true;
+#ifdef MIPMAPS_X86
+    case MipmapKernel::SSE2  :return true;
+#endif
+#ifdef MIPMAPS_AVX2
+    case MipmapKernel::AVX2  :return __builtin_cpu_supports("avx2");
+#endif
+    default:return false;
+  }
+}
+
+std::vector<MipmapLevel>generateMipmaps(
+    uint8_t const*pixels  ,
+    int           width   ,
+    int           height  ,
+    int           channels,
+    bool          srgb    ,
+    MipmapFilter  filter  ,
+    MipmapKernel  kernel  ){
+  if(channels < 1 || channels > 4)
+    throw std::invalid_argument("generateMipmaps - number of channels has to be in range [1,4]");
+  auto const&tables  = getTables(srgb);
+  auto const kernels = getKernels(kernel);
+  auto const f       = createFilter(filter);
+  std::vector<MipmapLevel>result;
+  while(width > 1 || height > 1){
+    result.push_back(downsample(pixels,width,height,channels,f,tables,kernels));
+    pixels = result.back().data.data();
+    width  = result.back().width ;
+    height = result.back().height;
+  }
+  return result;
+}
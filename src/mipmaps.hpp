@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+enum class MipmapFilter{
+  BOX   ,///<2x2 average
+  KAISER,///<8 tap Kaiser windowed sinc, sharper than box
+};
+
+enum class MipmapKernel{
+  AUTO  ,///<best supported kernel
+  SCALAR,
+  SSE2  ,
+  AVX2  ,
+};
+
+/**
+ * @brief one level of mipmap chain, rows are tightly packed
+ */
+struct MipmapLevel{
+  int                 width  = 0;
+  int                 height = 0;
+  std::vector<uint8_t>data      ;
+};
+
+/**
+ * @brief generates mipmap chain of 8 bit image on CPU
+ *
+ * @param pixels level 0, tightly packed rows
+ * @param width width of level 0
+ * @param height height of level 0
+ * @param channels number of channels (1 - 4), last channel of 2 or 4 channel images is alpha
+ * @param srgb color channels are sRGB encoded, filtering is done in linear space
+ * @param filter downsampling filter
+ * @param kernel implementation of filter
+ *
+ * @return levels 1 .. n (level 0 is input image), the last level is 1x1
+ */
+std::vector<MipmapLevel>generateMipmaps(
+    uint8_t const*pixels                             ,
+    int           width                              ,
+    int           height                             ,
+    int           channels                           ,
+    bool          srgb     = true                    ,
+    MipmapFilter  filter   = MipmapFilter::BOX       ,
+    MipmapKernel  kernel   = MipmapKernel::AUTO      );
+
+bool isMipmapKernelSupported(MipmapKernel kernel);
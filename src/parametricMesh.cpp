@@ -0,0 +1,303 @@
+#include <parametricMesh.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+#include<glm/gtc/constants.hpp>
+
+namespace{
+  uint32_t const noVertex = std::numeric_limits<uint32_t>::max();
+
+  /**
+   * @brief one level of detail before it is appended into chain
+   */
+  struct Level{
+    std::vector<MeshVertex>vertices;
+    std::vector<uint32_t  >indices ;
+  };
+
+  /**
+   * @brief triangles of unit sphere without attributes
+   */
+  struct Triangles{
+    std::vector<glm::vec3>positions;
+    std::vector<uint32_t >indices  ;
+  };
+
+  glm::vec2 getSphericalCoord(glm::vec3 const&position){
+    float xangle = std::atan2(position.z,position.x);
+    if(xangle < 0.f)xangle += 2.f*glm::pi<float>();
+    float const yangle = std::acos(glm::clamp(-position.y,-1.f,1.f));
+    return glm::vec2(1.f - xangle / (2.f*glm::pi<float>()),yangle / glm::pi<float>());
+  }
+
+  bool isPole(glm::vec3 const&position){
+    return position.x*position.x + position.z*position.z < 1e-12f;
+  }
+
+  /**
+   * @brief computes normals and texture coordinates from positions
+   * Triangles that cross seam (u jumps from 1 to 0) get duplicated vertices with u+1.
+   * Pole vertices have undefined u, they are duplicated per triangle with u of the opposite edge.
+   */
+  Level mapSphericalCoords(Triangles const&triangles){
+    Level level;
+    for(auto const&position:triangles.positions)
+      level.vertices.push_back(MeshVertex{position,position,getSphericalCoord(position)});
+
+    std::vector<uint32_t>shifted(level.vertices.size(),noVertex);
+    for(size_t t=0;t<triangles.indices.size();t+=3){
+      uint32_t triangle[3] = {triangles.indices[t+0],triangles.indices[t+1],triangles.indices[t+2]};
+
+      float uMin = std::numeric_limits<float>::max();
+      float uMax = std::numeric_limits<float>::lowest();
+      for(auto const v:triangle){
+        if(isPole(level.vertices[v].position))continue;
+        uMin = std::min(uMin,level.vertices[v].coord.x);
+        uMax = std::max(uMax,level.vertices[v].coord.x);
+      }
+
+      if(uMax - uMin > .5f){
+        for(auto&v:triangle){
+          if(isPole(level.vertices[v].position) || level.vertices[v].coord.x >= .5f)continue;
+          if(shifted[v] == noVertex){
+            shifted[v] = (uint32_t)level.vertices.size();
+            auto vertex = level.vertices[v];
+            vertex.coord.x += 1.f;
+            level.vertices.push_back(vertex);
+          }
+          v = shifted[v];
+        }
+      }
+
+      for(uint32_t i=0;i<3;++i){
+        if(!isPole(level.vertices[triangle[i]].position))continue;
+        auto vertex = level.vertices[triangle[i]];
+        vertex.coord.x = (level.vertices[triangle[(i+1)%3]].coord.x + level.vertices[triangle[(i+2)%3]].coord.x) * .5f;
+        triangle[i] = (uint32_t)level.vertices.size();
+        level.vertices.push_back(vertex);
+      }
+
+      level.indices.insert(level.indices.end(),triangle,triangle+3);
+    }
+    return level;
+  }
+
+  /**
+   * @brief longitude/latitude grid, seam column is stored once more (u = 0 and u = 1),
+   * every pole is one triangle fan (pole vertex per segment carries its own u)
+   */
+  Level generateUVSphere(uint32_t nx,uint32_t ny){
+    auto const createVertex = [](float xangleNorm,float yangleNorm){
+      float const xangle = xangleNorm * glm::pi<float>() * 2.f;
+      float const yangle = yangleNorm * glm::pi<float>()      ;
+      MeshVertex vertex;
+      vertex.position = glm::vec3(
+          glm::cos(xangle)*glm::sin(yangle),
+                          -glm::cos(yangle),
+          glm::sin(xangle)*glm::sin(yangle));
+      if(yangleNorm == 0.f)vertex.position = glm::vec3(0.f,-1.f,0.f);
+      if(yangleNorm == 1.f)vertex.position = glm::vec3(0.f,+1.f,0.f);
+      vertex.normal   = vertex.position;
+      vertex.coord    = glm::vec2(1.f-xangleNorm,yangleNorm);
+      return vertex;
+    };
+
+    Level level;
+    auto&vertices = level.vertices;
+    auto&indices  = level.indices ;
+
+    uint32_t const south = 0;
+    uint32_t const rings = nx;
+    uint32_t const north = rings + (ny-1)*(nx+1);
+    auto const ring = [&](uint32_t iy,uint32_t ix){return rings + (iy-1)*(nx+1) + ix;};
+
+    for(uint32_t ix=0;ix<nx;++ix)
+      vertices.push_back(createVertex(((float)ix+.5f) / (float)nx,0.f));
+    for(uint32_t iy=1;iy<ny;++iy)
+      for(uint32_t ix=0;ix<=nx;++ix)
+        vertices.push_back(createVertex((float)ix / (float)nx,(float)iy / (float)ny));
+    for(uint32_t ix=0;ix<nx;++ix)
+      vertices.push_back(createVertex(((float)ix+.5f) / (float)nx,1.f));
+
+    for(uint32_t ix=0;ix<nx;++ix)
+      indices.insert(indices.end(),{south+ix,ring(1,ix),ring(1,ix+1)});
+
+    for(uint32_t iy=1;iy<ny-1;++iy){
+      for(uint32_t ix=0;ix<nx;++ix){
+        indices.insert(indices.end(),{ring(iy,ix  ),ring(iy+1,ix),ring(iy  ,ix+1)});
+        indices.insert(indices.end(),{ring(iy,ix+1),ring(iy+1,ix),ring(iy+1,ix+1)});
+      }
+    }
+
+    for(uint32_t ix=0;ix<nx;++ix)
+      indices.insert(indices.end(),{ring(ny-1,ix),north+ix,ring(ny-1,ix+1)});
+
+    return level;
+  }
+
+  Triangles createIcosahedron(){
+    float const t = (1.f + std::sqrt(5.f)) * .5f;
+    Triangles triangles;
+    triangles.positions = {
+      {-1, t, 0},{ 1, t, 0},{-1,-t, 0},{ 1,-t, 0},
+      { 0,-1, t},{ 0, 1, t},{ 0,-1,-t},{ 0, 1,-t},
+      { t, 0,-1},{ t, 0, 1},{-t, 0,-1},{-t, 0, 1},
+    };
+    for(auto&position:triangles.positions)position = glm::normalize(position);
+    triangles.indices = {
+      0,11, 5, 0, 5, 1, 0, 1, 7, 0, 7,10, 0,10,11,
+      1, 5, 9, 5,11, 4,11,10, 2,10, 7, 6, 7, 1, 8,
+      3, 9, 4, 3, 4, 2, 3, 2, 6, 3, 6, 8, 3, 8, 9,
+      4, 9, 5, 2, 4,11, 6, 2,10, 8, 6, 7, 9, 8, 1,
+    };
+    return triangles;
+  }
+
+  /**
+   * @brief splits every triangle into 4, midpoints are shared between neighbouring triangles
+   */
+  Triangles subdivide(Triangles const&triangles){
+    Triangles result;
+    result.positions = triangles.positions;
+    std::map<std::pair<uint32_t,uint32_t>,uint32_t>midpoints;
+    auto const getMidpoint = [&](uint32_t a,uint32_t b){
+      auto const key = std::make_pair(std::min(a,b),std::max(a,b));
+      auto const it = midpoints.find(key);
+      if(it != midpoints.end())return it->second;
+      auto const index = (uint32_t)result.positions.size();
+      result.positions.push_back(glm::normalize(result.positions[a] + result.positions[b]));
+      midpoints[key] = index;
+      return index;
+    };
+    for(size_t t=0;t<triangles.indices.size();t+=3){
+      auto const a  = triangles.indices[t+0];
+      auto const b  = triangles.indices[t+1];
+      auto const c  = triangles.indices[t+2];
+      auto const ab = getMidpoint(a,b);
+      auto const bc = getMidpoint(b,c);
+      auto const ca = getMidpoint(c,a);
+      result.indices.insert(result.indices.end(),{a,ab,ca,ab,b,bc,ca,bc,c,ab,bc,ca});
+    }
+    return result;
+  }
+
+  /**
+   * @brief cube with n x n quads per face projected onto sphere
+   * Grid is warped by tangent so quads have similar size after projection.
+   * Faces are generated separately, shared edges produce bit identical positions.
+   */
+  Triangles createQuadCube(uint32_t n){
+    struct Face{glm::vec3 n,u,v;};//u x v = n
+    Face const faces[] = {
+      {{+1, 0, 0},{ 0, 1, 0},{ 0, 0, 1}},
+      {{-1, 0, 0},{ 0, 0, 1},{ 0, 1, 0}},
+      {{ 0,+1, 0},{ 0, 0, 1},{ 1, 0, 0}},
+      {{ 0,-1, 0},{ 1, 0, 0},{ 0, 0, 1}},
+      {{ 0, 0,+1},{ 1, 0, 0},{ 0, 1, 0}},
+      {{ 0, 0,-1},{ 0, 1, 0},{ 1, 0, 0}},
+    };
+    auto const warp = [&](uint32_t i){
+      if(i == 0)return -1.f;
+      if(i == n)return +1.f;
+      return std::tan((-1.f + 2.f*(float)i/(float)n) * glm::quarter_pi<float>());
+    };
+
+    Triangles triangles;
+    for(auto const&face:faces){
+      auto const first = (uint32_t)triangles.positions.size();
+      for(uint32_t j=0;j<=n;++j)
+        for(uint32_t i=0;i<=n;++i)
+          triangles.positions.push_back(glm::normalize(face.n + warp(i)*face.u + warp(j)*face.v));
+      auto const index = [&](uint32_t i,uint32_t j){return first + j*(n+1) + i;};
+      for(uint32_t j=0;j<n;++j){
+        for(uint32_t i=0;i<n;++i){
+          triangles.indices.insert(triangles.indices.end(),{index(i,j  ),index(i+1,j),index(i+1,j+1)});
+          triangles.indices.insert(triangles.indices.end(),{index(i,j  ),index(i+1,j+1),index(i,j+1)});
+        }
+      }
+    }
+    return triangles;
+  }
+
+  /**
+   * @brief maximal distance between flat triangles and unit sphere (sagitta)
+   */
+  float computeError(Level const&level){
+    float error = 0.f;
+    for(size_t t=0;t<level.indices.size();t+=3){
+      auto const&a = level.vertices[level.indices[t+0]].position;
+      auto const&b = level.vertices[level.indices[t+1]].position;
+      auto const&c = level.vertices[level.indices[t+2]].position;
+      auto const normal = glm::cross(b-a,c-a);
+      auto const length = glm::length(normal);
+      if(length == 0.f)continue;
+      error = std::max(error,1.f - std::abs(glm::dot(normal,a)) / length);
+    }
+    return error;
+  }
+
+  void appendLevel(MeshLodChain&chain,Level const&level){
+    MeshLod lod;
+    lod.firstIndex  = (uint32_t)chain.indices .size();
+    lod.nofIndices  = (uint32_t)level.indices .size();
+    lod.firstVertex = (uint32_t)chain.vertices.size();
+    lod.nofVertices = (uint32_t)level.vertices.size();
+    lod.error       = computeError(level);
+    chain.vertices.insert(chain.vertices.end(),level.vertices.begin(),level.vertices.end());
+    chain.indices .insert(chain.indices .end(),level.indices .begin(),level.indices .end());
+    chain.lods.push_back(lod);
+  }
+}
+
+MeshLodChain generateSphereLods(ParametricShape shape,uint32_t nofLods){
+  if(nofLods == 0 || nofLods > 8)
+    throw std::invalid_argument("generateSphereLods - number of levels has to be in range 1 - 8");
+
+  //levels are generated from the coarsest one
+  std::vector<Level>levels;
+  if(shape == ParametricShape::UV_SPHERE){
+    for(uint32_t i=0;i<nofLods;++i)
+      levels.push_back(generateUVSphere(8u<<i,4u<<i));
+  }
+  if(shape == ParametricShape::ICOSPHERE){
+    auto triangles = createIcosahedron();
+    for(uint32_t i=0;i<nofLods;++i){
+      if(i > 0)triangles = subdivide(triangles);
+      levels.push_back(mapSphericalCoords(triangles));
+    }
+  }
+  if(shape == ParametricShape::QUAD_CUBE){
+    for(uint32_t i=0;i<nofLods;++i)
+      levels.push_back(mapSphericalCoords(createQuadCube(2u<<i)));
+  }
+
+  MeshLodChain chain;
+  for(auto level=levels.rbegin();level!=levels.rend();++level)
+    appendLevel(chain,*level);
+  return chain;
+}
+
+uint32_t selectSphereLod(
+    MeshLodChain const&chain         ,
+    float              radius        ,
+    float              distance      ,
+    float              fovY          ,
+    float              viewportHeight,
+    float              maxPixelError ){
+  if(chain.lods.empty())
+    throw std::invalid_argument("selectSphereLod - chain does not contain any level");
+
+  //the nearest point of sphere is the most magnified one, camera inside sphere needs the finest level
+  float const surfaceDistance = distance - radius;
+  if(surfaceDistance <= 0.f)return 0;
+  float const pixelsPerUnit = viewportHeight / (2.f * std::tan(fovY * .5f) * surfaceDistance);
+
+  for(auto lod=(uint32_t)chain.lods.size()-1;lod>0;--lod)
+    if(chain.lods[lod].error * radius * pixelsPerUnit <= maxPixelError)return lod;
+  return 0;
+}
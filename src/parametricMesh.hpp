@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include<glm/glm.hpp>
+
+enum class ParametricShape{
+  UV_SPHERE,///<longitude/latitude grid, one seam column, triangle fans at poles
+  ICOSPHERE,///<subdivided icosahedron, nearly uniform triangles
+  QUAD_CUBE,///<cube with subdivided faces projected onto sphere (tangent warped)
+};
+
+struct MeshVertex{
+  glm::vec3 position;
+  glm::vec3 normal  ;
+  glm::vec2 coord   ;
+};
+
+/**
+ * @brief draw range of one level of detail inside shared vertex/index buffer
+ */
+struct MeshLod{
+  uint32_t firstIndex  = 0  ;///<offset into index buffer (in indices)
+  uint32_t nofIndices  = 0  ;
+  uint32_t firstVertex = 0  ;///<indices are relative to this vertex (base vertex of draw)
+  uint32_t nofVertices = 0  ;
+  float    error       = 0.f;///<maximal distance between triangles and unit sphere
+};
+
+/**
+ * @brief chain of levels of detail, level 0 is the finest one
+ * All levels share one vertex and one index buffer.
+ */
+struct MeshLodChain{
+  std::vector<MeshVertex>vertices;
+  std::vector<uint32_t  >indices ;
+  std::vector<MeshLod   >lods    ;
+};
+
+/**
+ * @brief generates levels of detail of unit sphere
+ * Every coarser level has roughly a quarter of triangles of previous level.
+ * The coarsest levels have 8x4 segments (UV_SPHERE), 20 triangles (ICOSPHERE) or 2x2 quads per face (QUAD_CUBE).
+ * Texture coordinates follow equirectangular mapping (u goes from 1 to 0 around y axis, v from 0 at -y to 1 at +y),
+ * vertices on seam are duplicated with u > 1, so wrap mode has to be GL_REPEAT.
+ *
+ * @param shape tessellation of sphere
+ * @param nofLods number of levels (1 - 8)
+ *
+ * @return levels of detail, triangles are counter clockwise when viewed from outside
+ */
+MeshLodChain generateSphereLods(ParametricShape shape,uint32_t nofLods = 6);
+
+/**
+ * @brief selects the coarsest level whose error projected onto screen is below threshold
+ *
+ * @param chain levels of detail
+ * @param radius radius of sphere in world space
+ * @param distance distance of camera from center of sphere
+ * @param fovY vertical field of view in radians
+ * @param viewportHeight height of viewport in pixels
+ * @param maxPixelError allowed error in pixels
+ *
+ * @return index of level of detail
+ */
+uint32_t selectSphereLod(
+    MeshLodChain const&chain                ,
+    float              radius               ,
+    float              distance             ,
+    float              fovY                 ,
+    float              viewportHeight       ,
+    float              maxPixelError  = 0.5f);
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include <geGL/OpenGL.h>
+
+#include <mipmaps.hpp>
+#include <textureContainer.hpp>
+
+/**
+ * @brief bakes image into texture container: rows are flipped, mipmaps are generated
+ *
+ * usage: textureBaker input output [--kaiser] [--linear] [--bc1|--bc3|--bc7] [--quality fast|normal|high]
+ */
+int main(int argc,char*argv[]){
+  if(argc < 3){
+    std::cerr << "usage: " << argv[0] << " input output [--kaiser] [--linear] [--bc1|--bc3|--bc7] [--quality fast|normal|high]" << std::endl;
+    return 1;
+  }
+  std::string const input  = argv[1];
+  std::string const output = argv[2];
+  auto filter = MipmapFilter::BOX;
+  bool srgb   = true;
+  bool compress = false;
+  auto format   = BlockFormat::BC7;
+  auto quality  = BlockQuality::NORMAL;
+  for(int i=3;i<argc;++i){
+    if     (std::strcmp(argv[i],"--kaiser") == 0)filter = MipmapFilter::KAISER;
+    else if(std::strcmp(argv[i],"--linear") == 0)srgb   = false;
+    else if(std::strcmp(argv[i],"--bc1"   ) == 0){compress = true;format = BlockFormat::BC1;}
+    else if(std::strcmp(argv[i],"--bc3"   ) == 0){compress = true;format = BlockFormat::BC3;}
+    else if(std::strcmp(argv[i],"--bc7"   ) == 0){compress = true;format = BlockFormat::BC7;}
+    else if(std::strcmp(argv[i],"--quality") == 0 && i+1 < argc){
+      std::string const value = argv[++i];
+      if     (value == "fast"  )quality = BlockQuality::FAST  ;
+      else if(value == "normal")quality = BlockQuality::NORMAL;
+      else if(value == "high"  )quality = BlockQuality::HIGH  ;
+      else{
+        std::cerr << "unknown quality " << value << std::endl;
+        return 1;
+      }
+    }else{
+      std::cerr << "unknown option " << argv[i] << std::endl;
+      return 1;
+    }
+  }
+
+  auto const start = std::chrono::high_resolution_clock::now();
+  int width,height,channels;
+  stbi_set_flip_vertically_on_load(1);
+  auto const pixels = stbi_load(input.c_str(),&width,&height,&channels,0);
+  if(!pixels){
+    std::cerr << "cannot load " << input << std::endl;
+    return 1;
+  }
+  auto const mipmaps = generateMipmaps(pixels,width,height,channels,srgb,filter);
+
+  GLenum const formats        [] = {GL_RED,GL_RG ,GL_RGB ,GL_RGBA };
+  GLenum const internalFormats[] = {GL_R8 ,GL_RG8,GL_RGB8,GL_RGBA8};
+  TextureContainerHeader header;
+  header.target         = GL_TEXTURE_2D;
+  header.internalFormat = internalFormats[channels-1];
+  header.format         = formats        [channels-1];
+  header.type           = GL_UNSIGNED_BYTE;
+  header.width          = static_cast<uint32_t>(width );
+  header.height         = static_cast<uint32_t>(height);
+
+  std::vector<TextureContainerLevelData>levels;
+  levels.push_back(TextureContainerLevelData{header.width,header.height,pixels,size_t(width)*height*channels});
+  for(auto const&mipmap:mipmaps)
+    levels.push_back(TextureContainerLevelData{uint32_t(mipmap.width),uint32_t(mipmap.height),mipmap.data.data(),mipmap.data.size()});
+
+  std::vector<std::vector<uint8_t>>blocks;
+  if(compress){
+    blocks.reserve(levels.size());
+    header.internalFormat = getBlockInternalFormat(format);
+    header.format         = 0;
+    header.type           = 0;
+    for(auto&level:levels){
+      blocks.push_back(compressBlocks(static_cast<uint8_t const*>(level.data),int(level.width),int(level.height),channels,format,quality));
+      level.data = blocks.back().data();
+      level.size = blocks.back().size();
+    }
+  }
+
+  try{
+    writeTextureContainer(output,header,levels);
+  }catch(std::exception const&e){
+    std::cerr << e.what() << std::endl;
+    stbi_image_free(pixels);
+    return 1;
+  }
+  stbi_image_free(pixels);
+  auto const time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  std::cerr << "baked " << input << " -> " << output << " (" << width << "x" << height << "x" << channels << ", " << levels.size() << " levels) in " << time << " s" << std::endl;
+  return 0;
+}
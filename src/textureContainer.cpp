@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <geGL/OpenGL.h>
+#include <geGL/OpenGLUtil.h>
+
+#include <textureContainer.hpp>
+
+namespace{
+  char     const magic    [8] = {'G','E','T','E','X','\r','\n','\x1a'};
+  uint32_t const version      = 1 ;
+  uint64_t const alignment    = 16;
+
+  uint64_t alignOffset(uint64_t offset){
+    return (offset + alignment - 1) & ~(alignment - 1);
+  }
+
+  uint64_t getNofComponents(uint32_t format){
+    switch(format){
+      case GL_RED :case GL_RED_INTEGER :return 1;
+      case GL_RG  :case GL_RG_INTEGER  :return 2;
+      case GL_RGB :case GL_RGB_INTEGER :case GL_BGR :return 3;
+      case GL_RGBA:case GL_RGBA_INTEGER:case GL_BGRA:return 4;
+    }
+    return 0;
+  }
+
+  /**
+   * @brief computes size of level payload
+   *
+   * @param header texture parameters
+   * @param width width of level
+   * @param height height of level
+   *
+   * @return size in bytes, 0 for unsupported format
+   */
+  uint64_t getLevelSize(TextureContainerHeader const&header,uint32_t width,uint32_t height){
+    if(header.format == 0){
+      for(auto const format:{BlockFormat::BC1,BlockFormat::BC3,BlockFormat::BC7})
+        if(getBlockInternalFormat(format) == header.internalFormat)
+          return ((uint64_t(width)+3)/4)*((uint64_t(height)+3)/4)*getBlockSize(format);
+      return 0;
+    }
+    return uint64_t(width)*height*getNofComponents(header.format)*ge::gl::getTypeSize(header.type);
+  }
+
+  uint32_t getNofMipmaps(uint32_t width,uint32_t height){
+    uint32_t nofLevels = 1;
+    for(auto size = std::max(width,height);size > 1;size >>= 1)++nofLevels;
+    return nofLevels;
+  }
+}
+
+/**
+ * @brief gets OpenGL internal format of block compressed texture
+ *
+ * @param format block format
+ *
+ * @return internal format (S3TC or BPTC)
+ */
+uint32_t getBlockInternalFormat(BlockFormat format){
+  switch(format){
+    case BlockFormat::BC1:return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BlockFormat::BC3:return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BlockFormat::BC7:return GL_COMPRESSED_RGBA_BPTC_UNORM;
+  }
+  return 0;
+}
+
+/**
+ * @brief writes texture container
+ *
+ * @param fileName name of output file
+ * @param header texture parameters, magic, version and nofLevels are filled by this function
+ * @param levels payload of levels, they are written in order
+ */
+void writeTextureContainer(
+    std::string                           const&fileName,
+    TextureContainerHeader                const&header  ,
+    std::vector<TextureContainerLevelData>const&levels  ){
+  TextureContainerHeader h = header;
+  std::memcpy(h.magic,magic,sizeof(magic));
+  h.version   = version;
+  h.nofLevels = static_cast<uint32_t>(levels.size());
+
+  std::vector<TextureContainerLevel>table(levels.size());
+  uint64_t offset = sizeof(TextureContainerHeader) + sizeof(TextureContainerLevel)*levels.size();
+  for(size_t i=0;i<levels.size();++i){
+    offset          = alignOffset(offset);
+    table[i].offset = offset;
+    table[i].size   = levels[i].size;
+    table[i].width  = levels[i].width;
+    table[i].height = levels[i].height;
+    offset         += levels[i].size;
+  }
+
+  std::ofstream file(fileName,std::ios::binary);
+  if(!file.is_open())throw std::runtime_error("writeTextureContainer - cannot open "+fileName);
+  file.write(reinterpret_cast<char const*>(&h),sizeof(h));
+  file.write(reinterpret_cast<char const*>(table.data()),sizeof(TextureContainerLevel)*table.size());
+  char const padding[alignment] = {};
+  for(size_t i=0;i<levels.size();++i){
+    file.write(padding,static_cast<std::streamsize>(table[i].offset - static_cast<uint64_t>(file.tellp())));
+    file.write(static_cast<char const*>(levels[i].data),static_cast<std::streamsize>(levels[i].size));
+  }
+  if(!file)throw std::runtime_error("writeTextureContainer - cannot write "+fileName);
+}
+
+/**
+ * @brief maps texture container into memory
+ *
+ * @param fileName name of container file
+ */
+MappedTextureContainer::MappedTextureContainer(std::string const&fileName){
+#if defined(_WIN32)
+  auto const file = CreateFileA(fileName.c_str(),GENERIC_READ,FILE_SHARE_READ,nullptr,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,nullptr);
+  if(file == INVALID_HANDLE_VALUE)throw std::runtime_error("MappedTextureContainer - cannot open "+fileName);
+  LARGE_INTEGER fileSize;
+  GetFileSizeEx(file,&fileSize);
+  size   = static_cast<size_t>(fileSize.QuadPart);
+  handle = CreateFileMappingA(file,nullptr,PAGE_READONLY,0,0,nullptr);
+  CloseHandle(file);
+  if(handle)data = static_cast<uint8_t const*>(MapViewOfFile(handle,FILE_MAP_READ,0,0,0));
+  if(!data){
+    if(handle)CloseHandle(handle);
+    throw std::runtime_error("MappedTextureContainer - cannot map "+fileName);
+  }
+#else
+  auto const file = open(fileName.c_str(),O_RDONLY);
+  if(file < 0)throw std::runtime_error("MappedTextureContainer - cannot open "+fileName);
+  struct stat fileStat;
+  if(fstat(file,&fileStat) != 0 || fileStat.st_size == 0){
+    close(file);
+    throw std::runtime_error("MappedTextureContainer - cannot map "+fileName);
+  }
+  size = static_cast<size_t>(fileStat.st_size);
+  auto const mapped = mmap(nullptr,size,PROT_READ,MAP_PRIVATE,file,0);
+  close(file);
+  if(mapped == MAP_FAILED)throw std::runtime_error("MappedTextureContainer - cannot map "+fileName);
+  data = static_cast<uint8_t const*>(mapped);
+#endif
+
+  std::string error;
+  auto const&header = getHeader();
+  if(size < sizeof(TextureContainerHeader) || std::memcmp(header.magic,magic,sizeof(magic)) != 0)
+    error = "MappedTextureContainer - "+fileName+" is not texture container";
+  else if(header.version != version)
+    error = "MappedTextureContainer - "+fileName+" has unsupported version "+std::to_string(header.version);
+  else if(header.width == 0 || header.height == 0 || getLevelSize(header,1,1) == 0)
+    error = "MappedTextureContainer - "+fileName+" has unsupported texture format";
+  else if(header.nofLevels == 0 || header.nofLevels > getNofMipmaps(header.width,header.height) ||
+      size < sizeof(TextureContainerHeader) + sizeof(TextureContainerLevel)*header.nofLevels)
+    error = "MappedTextureContainer - "+fileName+" has corrupted level table";
+  else{
+    for(uint32_t i=0;i<header.nofLevels;++i){
+      auto const&level = getLevel(i);
+      if(level.offset > size || level.size > size - level.offset){
+        error = "MappedTextureContainer - "+fileName+" is truncated";
+        break;
+      }
+      if(level.width  != std::max(1u,header.width >>i) ||
+         level.height != std::max(1u,header.height>>i) ||
+         level.size   != getLevelSize(header,level.width,level.height)){
+        error = "MappedTextureContainer - "+fileName+" has corrupted level "+std::to_string(i);
+        break;
+      }
+    }
+  }
+  if(!error.empty()){
+    unmap();
+    throw std::runtime_error(error);
+  }
+}
+
+/**
+ * @brief unmaps container
+ */
+MappedTextureContainer::~MappedTextureContainer(){
+  unmap();
+}
+
+void MappedTextureContainer::unmap(){
+  if(!data)return;
+#if defined(_WIN32)
+  UnmapViewOfFile(data);
+  CloseHandle(handle);
+#else
+  munmap(const_cast<uint8_t*>(data),size);
+#endif
+  data = nullptr;
+}
+
+/**
+ * @brief gets header of container
+ *
+ * @return header
+ */
+TextureContainerHeader const&MappedTextureContainer::getHeader()const{
+  return *reinterpret_cast<TextureContainerHeader const*>(data);
+}
+
+/**
+ * @brief gets description of mipmap level
+ *
+ * @param level mipmap level
+ *
+ * @return description of level
+ */
+TextureContainerLevel const&MappedTextureContainer::getLevel(uint32_t level)const{
+  if(level >= getHeader().nofLevels)
+    throw std::invalid_argument("MappedTextureContainer::getLevel - level "+std::to_string(level)+" is out of range");
+  return reinterpret_cast<TextureContainerLevel const*>(data + sizeof(TextureContainerHeader))[level];
+}
+
+/**
+ * @brief gets payload of mipmap level, it points directly into mapped file
+ *
+ * @param level mipmap level
+ *
+ * @return pointer to payload
+ */
+void const*MappedTextureContainer::getLevelData(uint32_t level)const{
+  return data + getLevel(level).offset;
+}
+
+/**
+ * @brief gets size of mapped file
+ *
+ * @return size in bytes
+ */
+size_t MappedTextureContainer::getSize()const{
+  return size;
+}
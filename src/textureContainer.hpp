@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <blockCompression.hpp>
+
+/**
+ * @brief Baked texture container (.getex).
+ * File starts with TextureContainerHeader followed by nofLevels TextureContainerLevel records.
+ * Payload of every level is aligned to 16 bytes, rows are tightly
+ * packed and stored bottom row first, so they can be passed to OpenGL without any conversion.
+ * Payloads of compressed internal formats (format == 0) are uploaded by glCompressedTextureSubImage2D.
+ * All values are little endian.
+ */
+struct TextureContainerHeader{
+  char     magic[8]       = {};///<filled by writeTextureContainer
+  uint32_t version        = 0;///<filled by writeTextureContainer
+  uint32_t target         = 0;///<GL_TEXTURE_2D
+  uint32_t internalFormat = 0;///<sized internal format of texture storage
+  uint32_t format         = 0;///<pixel format of payload, 0 for compressed formats
+  uint32_t type           = 0;///<pixel type of payload, 0 for compressed formats
+  uint32_t width          = 0;
+  uint32_t height         = 0;
+  uint32_t nofLevels      = 0;
+};
+
+/**
+ * @brief description of one mipmap level in container
+ */
+struct TextureContainerLevel{
+  uint64_t offset = 0;///<offset of payload from the beginning of file
+  uint64_t size   = 0;///<size of payload in bytes
+  uint32_t width  = 0;
+  uint32_t height = 0;
+};
+
+/**
+ * @brief level that is written into container
+ */
+struct TextureContainerLevelData{
+  uint32_t      width  = 0      ;
+  uint32_t      height = 0      ;
+  void const*   data   = nullptr;
+  size_t        size   = 0      ;
+};
+
+uint32_t getBlockInternalFormat(BlockFormat format);
+
+void writeTextureContainer(
+    std::string                           const&fileName,
+    TextureContainerHeader                const&header  ,
+    std::vector<TextureContainerLevelData>const&levels  );
+
+/**
+ * @brief read only memory mapped texture container, it validates header and level table
+ */
+class MappedTextureContainer{
+  public:
+    MappedTextureContainer(std::string const&fileName);
+    ~MappedTextureContainer();
+    TextureContainerHeader const&getHeader()const;
+    TextureContainerLevel  const&getLevel    (uint32_t level)const;
+    void                   const*getLevelData(uint32_t level)const;
+    size_t                       getSize     (             )const;
+    MappedTextureContainer(MappedTextureContainer const&) = delete;
+    MappedTextureContainer&operator=(MappedTextureContainer const&) = delete;
+  private:
+    void          unmap();
+    uint8_t const*data   = nullptr;
+    size_t        size   = 0      ;
+    void*         handle = nullptr;///<file mapping handle on windows
+};
@@ -0,0 +1,332 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <stb_image.h>
+#include <geGL/StaticCalls.h>
+#include <geGL/OpenGLUtil.h>
+
+#include <textureContainer.hpp>
+#include <textureLoader.hpp>
+
+namespace{
+  double elapsed(std::chrono::high_resolution_clock::time_point const&start){
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  }
+
+  GLenum getFormat(int channels){
+    GLenum const formats[] = {GL_RED,GL_RG,GL_RGB,GL_RGBA};
+    return formats[channels-1];
+  }
+
+  GLenum getInternalFormat(int channels){
+    GLenum const formats[] = {GL_R8,GL_RG8,GL_RGB8,GL_RGBA8};
+    return formats[channels-1];
+  }
+
+  GLintptr alignOffset(GLintptr offset){
+    return (offset + 3) & ~GLintptr(3);
+  }
+
+  void setSamplerParameters(ge::gl::Texture&texture){
+    texture.texParameteri(GL_TEXTURE_MIN_FILTER,GL_LINEAR_MIPMAP_LINEAR);
+    texture.texParameteri(GL_TEXTURE_MAG_FILTER,GL_LINEAR);
+    texture.texParameteri(GL_TEXTURE_WRAP_S    ,GL_REPEAT);
+    texture.texParameteri(GL_TEXTURE_WRAP_T    ,GL_REPEAT);
+  }
+}
+
+/**
+ * @brief copies rows in reverse order (OpenGL expects bottom row first)
+ *
+ * @param dst destination
+ * @param src source
+ * @param rowSize size of row in bytes
+ * @param nofRows number of rows
+ */
+void copyRowsFlipped(uint8_t*dst,uint8_t const*src,size_t rowSize,size_t nofRows){
+  for(size_t y=0;y<nofRows;++y)
+    std::memcpy(dst + y*rowSize,src + (nofRows-1-y)*rowSize,rowSize);
+}
+
+/**
+ * @brief creates loader, it has to be created by thread with OpenGL context
+ *
+ * @param nofThreads number of decoding threads, 0 means number of hardware threads
+ * @param stagingSize size of pixel unpack ring buffer, larger images use temporary buffer
+ * @param filter mipmap downsampling filter
+ */
+TextureLoader::TextureLoader(size_t nofThreads,GLsizeiptr stagingSize,MipmapFilter filter):filter(filter){
+  if(nofThreads == 0)nofThreads = std::max(1u,std::thread::hardware_concurrency());
+  staging = std::make_unique<ge::gl::StreamBuffer>(stagingSize,4);
+  for(size_t i=0;i<nofThreads;++i)
+    workers.emplace_back(&TextureLoader::decodeLoop,this);
+}
+
+TextureLoader::~TextureLoader(){
+  {
+    std::lock_guard<std::mutex>lock(mutex);
+    stop = true;
+  }
+  jobAdded.notify_all();
+  for(auto&worker:workers)worker.join();
+}
+
+void TextureLoader::decodeLoop(){
+  for(;;){
+    Image              image;
+    TextureCompression imageCompression;
+    {
+      std::unique_lock<std::mutex>lock(mutex);
+      jobAdded.wait(lock,[&]{return stop || !jobs.empty();});
+      if(stop)return;
+      image = jobs.front();
+      jobs.pop_front();
+      imageCompression = compression;
+    }
+    auto const start = std::chrono::high_resolution_clock::now();
+    //blocks cannot be flipped by row copies during staging
+    stbi_set_flip_vertically_on_load_thread(imageCompression.enabled);
+    auto const pixels = stbi_load(image.fileName.c_str(),&image.width,&image.height,&image.channels,0);
+    if(pixels)image.pixels = std::shared_ptr<uint8_t>(pixels,stbi_image_free);
+    auto const decodeTime = elapsed(start);
+    auto const mipmapStart = std::chrono::high_resolution_clock::now();
+    if(image.pixels)
+      image.mipmaps = generateMipmaps(image.pixels.get(),image.width,image.height,image.channels,true,filter);
+    auto const mipmapTime = elapsed(mipmapStart);
+    auto const compressionStart = std::chrono::high_resolution_clock::now();
+    if(image.pixels && imageCompression.enabled){
+      auto const compress = [&](uint8_t const*pixels,int width,int height){
+        image.blocks.push_back(compressBlocks(pixels,width,height,image.channels,imageCompression.format,imageCompression.quality,1));
+      };
+      image.blockFormat = imageCompression.format;
+      compress(image.pixels.get(),image.width,image.height);
+      for(auto const&mipmap:image.mipmaps)
+        compress(mipmap.data.data(),mipmap.width,mipmap.height);
+    }
+    auto const compressionTime = elapsed(compressionStart);
+    {
+      std::lock_guard<std::mutex>lock(mutex);
+      times.decode      += decodeTime;
+      times.mipmaps     += mipmapTime;
+      times.compression += compressionTime;
+      decoded.push_back(std::move(image));
+    }
+    imageDecoded.notify_one();
+  }
+}
+
+std::shared_ptr<ge::gl::Texture>TextureLoader::upload(Image const&image){
+  struct Level{
+    int           width ;
+    int           height;
+    uint8_t const*data  ;
+    GLsizeiptr    size  ;
+    GLintptr      offset;
+  };
+  bool const compressed = !image.blocks.empty();
+  std::vector<Level>levels;
+  auto const addLevel = [&](int width,int height,uint8_t const*pixels,size_t index){
+    if(compressed)levels.push_back(Level{width,height,image.blocks[index].data(),static_cast<GLsizeiptr>(image.blocks[index].size()),0});
+    else          levels.push_back(Level{width,height,pixels,static_cast<GLsizeiptr>(width) * height * image.channels,0});
+  };
+  addLevel(image.width,image.height,image.pixels.get(),0);
+  for(size_t i=0;i<image.mipmaps.size();++i)
+    addLevel(image.mipmaps[i].width,image.mipmaps[i].height,image.mipmaps[i].data.data(),i+1);
+  GLsizeiptr size = 0;
+  for(auto&level:levels){
+    level.offset = alignOffset(size);
+    size = level.offset + level.size;
+  }
+
+  auto start = std::chrono::high_resolution_clock::now();
+  std::shared_ptr<ge::gl::Buffer>buffer;
+  uint8_t*data  = nullptr;
+  GLintptr base = 0;
+  if(size <= staging->getSize()){
+    auto const allocation = staging->allocate(size);
+    data = static_cast<uint8_t*>(allocation.data);
+    base = allocation.offset;
+  }else{
+    buffer = std::make_shared<ge::gl::Buffer>(size,nullptr,GL_MAP_WRITE_BIT);
+    data = static_cast<uint8_t*>(buffer->map(GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_BUFFER_BIT));
+  }
+  for(auto const&level:levels)
+    if(compressed)std::memcpy(data + level.offset,level.data,static_cast<size_t>(level.size));
+    else          copyRowsFlipped(data + level.offset,level.data,static_cast<size_t>(level.width) * image.channels,level.height);
+  if(buffer)buffer->unmap();
+  times.staging += elapsed(start);
+
+  start = std::chrono::high_resolution_clock::now();
+  auto texture = std::make_shared<ge::gl::Texture>(
+      GL_TEXTURE_2D,
+      compressed ? getBlockInternalFormat(image.blockFormat) : getInternalFormat(image.channels),
+      static_cast<GLsizei>(levels.size()),
+      image.width,
+      image.height);
+  ge::gl::glBindBuffer(GL_PIXEL_UNPACK_BUFFER,buffer ? buffer->getId() : staging->getBuffer()->getId());
+  ge::gl::glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+  for(size_t i=0;i<levels.size();++i){
+    auto const pointer = reinterpret_cast<GLvoid const*>(base + levels[i].offset);
+    if(compressed)
+      ge::gl::glCompressedTextureSubImage2D(
+          texture->getId(),
+          static_cast<GLint>(i),
+          0,0,
+          levels[i].width,
+          levels[i].height,
+          getBlockInternalFormat(image.blockFormat),
+          static_cast<GLsizei>(levels[i].size),
+          pointer);
+    else
+      texture->setData2D(
+          pointer,
+          getFormat(image.channels),
+          GL_UNSIGNED_BYTE,
+          static_cast<GLint>(i),
+          0,0,0,
+          levels[i].width,
+          levels[i].height);
+  }
+  ge::gl::glPixelStorei(GL_UNPACK_ALIGNMENT,4);
+  ge::gl::glBindBuffer(GL_PIXEL_UNPACK_BUFFER,0);
+  staging->fence();
+  setSamplerParameters(*texture);
+  times.upload += elapsed(start);
+  return texture;
+}
+
+/**
+ * @brief loads textures, images are decoded in parallel and uploaded in order they are decoded
+ *
+ * @param fileNames names of image files
+ *
+ * @return textures in order of fileNames
+ */
+std::vector<std::shared_ptr<ge::gl::Texture>>TextureLoader::load(std::vector<std::string>const&fileNames){
+  auto const start = std::chrono::high_resolution_clock::now();
+  {
+    std::lock_guard<std::mutex>lock(mutex);
+    for(size_t i=0;i<fileNames.size();++i){
+      Image image;
+      image.index    = i;
+      image.fileName = fileNames[i];
+      jobs.push_back(image);
+    }
+  }
+  jobAdded.notify_all();
+
+  std::vector<std::shared_ptr<ge::gl::Texture>>result(fileNames.size());
+  std::string error;
+  for(size_t i=0;i<fileNames.size();++i){
+    Image image;
+    {
+      std::unique_lock<std::mutex>lock(mutex);
+      imageDecoded.wait(lock,[&]{return !decoded.empty();});
+      image = std::move(decoded.front());
+      decoded.pop_front();
+    }
+    if(!image.pixels){
+      if(error.empty())error = "TextureLoader - cannot load "+image.fileName;
+      continue;
+    }
+    result[image.index] = upload(image);
+  }
+  times.total += elapsed(start);
+  if(!error.empty())throw std::runtime_error(error);
+  return result;
+}
+
+/**
+ * @brief loads one texture
+ *
+ * @param fileName name of image file
+ *
+ * @return texture
+ */
+std::shared_ptr<ge::gl::Texture>TextureLoader::load(std::string const&fileName){
+  return load(std::vector<std::string>{fileName})[0];
+}
+
+/**
+ * @brief loads texture container baked by textureBaker.
+ * File is memory mapped and levels are uploaded directly from mapping,
+ * there is no decoding, flipping or mipmap generation.
+ * Missing or invalid container is replaced by fallback image if it is specified.
+ *
+ * @param fileName name of container file
+ * @param fallback name of image that is loaded by load() if container cannot be used
+ *
+ * @return texture
+ */
+std::shared_ptr<ge::gl::Texture>TextureLoader::loadBaked(std::string const&fileName,std::string const&fallback){
+  auto const start = std::chrono::high_resolution_clock::now();
+  std::unique_ptr<MappedTextureContainer>mapped;
+  try{
+    mapped = std::make_unique<MappedTextureContainer>(fileName);
+    if(mapped->getHeader().target != GL_TEXTURE_2D)
+      throw std::runtime_error("TextureLoader - "+fileName+" does not contain 2D texture");
+  }catch(std::exception const&e){
+    if(fallback.empty())throw;
+    std::cerr << e.what() << ", loading " << fallback << " instead" << std::endl;
+    return load(fallback);
+  }
+  auto const&container = *mapped;
+  auto const&header    = container.getHeader();
+  auto texture = std::make_shared<ge::gl::Texture>(
+      header.target,
+      header.internalFormat,
+      static_cast<GLsizei>(header.nofLevels),
+      static_cast<GLsizei>(header.width),
+      static_cast<GLsizei>(header.height));
+  ge::gl::glPixelStorei(GL_UNPACK_ALIGNMENT,1);
+  for(uint32_t i=0;i<header.nofLevels;++i){
+    auto const&level = container.getLevel(i);
+    if(ge::gl::isInternalFormatCompressed(header.internalFormat))
+      ge::gl::glCompressedTextureSubImage2D(
+          texture->getId(),
+          static_cast<GLint>(i),
+          0,0,
+          static_cast<GLsizei>(level.width),
+          static_cast<GLsizei>(level.height),
+          header.internalFormat,
+          static_cast<GLsizei>(level.size),
+          container.getLevelData(i));
+    else
+      texture->setData2D(
+          container.getLevelData(i),
+          header.format,
+          header.type,
+          static_cast<GLint>(i),
+          0,0,0,
+          static_cast<GLsizei>(level.width),
+          static_cast<GLsizei>(level.height));
+  }
+  ge::gl::glPixelStorei(GL_UNPACK_ALIGNMENT,4);
+  setSamplerParameters(*texture);
+  auto const time = elapsed(start);
+  times.upload += time;
+  times.total  += time;
+  return texture;
+}
+
+/**
+ * @brief gets time spent in stages of loading
+ *
+ * @return times in seconds
+ */
+TextureLoadTimes const&TextureLoader::getTimes()const{
+  return times;
+}
+
+/**
+ * @brief sets block compression of textures loaded by following load calls
+ *
+ * @param compression compression settings
+ */
+void TextureLoader::setCompression(TextureCompression const&compression){
+  std::lock_guard<std::mutex>lock(mutex);
+  this->compression = compression;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geGL/geGL.h>
+
+#include <blockCompression.hpp>
+#include <mipmaps.hpp>
+
+/**
+ * @brief time spent in stages of texture loading in seconds
+ */
+struct TextureLoadTimes{
+  double decode      = 0.;///<image decoding, summed over worker threads
+  double mipmaps     = 0.;///<mipmap generation, summed over worker threads
+  double compression = 0.;///<block compression of all levels, summed over worker threads
+  double staging     = 0.;///<flipped copy of rows of all levels into pixel unpack buffer
+  double upload      = 0.;///<texture storage allocation and upload of all levels from buffer
+  double total       = 0.;///<wall time of load calls
+};
+
+/**
+ * @brief block compression of loaded textures
+ */
+struct TextureCompression{
+  bool         enabled = false               ;
+  BlockFormat  format  = BlockFormat::BC7    ;
+  BlockQuality quality = BlockQuality::NORMAL;
+};
+
+/**
+ * @brief Texture loader that decodes images on worker threads.
+ * Mipmaps are generated (sRGB aware, SIMD) and optionally block compressed on worker threads as well.
+ * Decoded images are copied (and vertically flipped) row by row into persistently
+ * mapped pixel unpack buffer and they are uploaded by the thread that owns OpenGL context.
+ * Uploads overlap with decoding of remaining images.
+ * Containers baked by textureBaker are memory mapped and uploaded without decoding.
+ */
+class TextureLoader{
+  public:
+    TextureLoader(
+        size_t       nofThreads  = 0                ,
+        GLsizeiptr   stagingSize = 128*1024*1024    ,
+        MipmapFilter filter      = MipmapFilter::BOX);
+    ~TextureLoader();
+    std::vector<std::shared_ptr<ge::gl::Texture>>load(std::vector<std::string>const&fileNames);
+    std::shared_ptr<ge::gl::Texture>             load(std::string const&fileName);
+    std::shared_ptr<ge::gl::Texture>             loadBaked(std::string const&fileName,std::string const&fallback = "");
+    TextureLoadTimes const&getTimes()const;
+    void setCompression(TextureCompression const&compression);
+    TextureLoader(TextureLoader const&) = delete;
+  private:
+    struct Image{
+      size_t                  index    = 0      ;
+      std::string             fileName          ;
+      int                     width    = 0      ;
+      int                     height   = 0      ;
+      int                     channels = 0      ;
+      std::shared_ptr<uint8_t>pixels            ;
+      std::vector<MipmapLevel>mipmaps           ;
+      std::vector<std::vector<uint8_t>>blocks   ;///<compressed levels, they are already flipped
+      BlockFormat             blockFormat = BlockFormat::BC7;
+    };
+    void                            decodeLoop();
+    std::shared_ptr<ge::gl::Texture>upload    (Image const&image);
+    std::vector<std::thread>        workers        ;
+    std::mutex                      mutex          ;
+    std::condition_variable         jobAdded       ;
+    std::condition_variable         imageDecoded   ;
+    std::deque<Image>               jobs           ;
+    std::deque<Image>               decoded        ;
+    bool                            stop = false   ;
+    MipmapFilter                    filter         ;
+    TextureCompression              compression    ;
+    std::unique_ptr<ge::gl::StreamBuffer>staging   ;
+    TextureLoadTimes                times          ;
+};
+
+void copyRowsFlipped(uint8_t*dst,uint8_t const*src,size_t rowSize,size_t nofRows);
@@ -0,0 +1,122 @@
+#include <vertexCompression.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include<glm/gtc/packing.hpp>
+
+namespace{
+  float getNormalScale(NormalEncoding normalEncoding){
+    if(normalEncoding == NormalEncoding::OCTAHEDRAL_INT_2_10_10_10)return 511.f;
+    return 32767.f;
+  }
+
+  uint32_t packNormal(glm::vec2 const&encoded,NormalEncoding normalEncoding){
+    if(normalEncoding == NormalEncoding::OCTAHEDRAL_INT_2_10_10_10)
+      return glm::packSnorm3x10_1x2(glm::vec4(encoded,0.f,0.f));
+    return glm::packSnorm2x16(encoded);
+  }
+
+  glm::vec2 unpackNormal(uint32_t packed,NormalEncoding normalEncoding){
+    if(normalEncoding == NormalEncoding::OCTAHEDRAL_INT_2_10_10_10)
+      return glm::vec2(glm::unpackSnorm3x10_1x2(packed));
+    return glm::unpackSnorm2x16(packed);
+  }
+
+  /**
+   * @brief quantizes octahedral coordinates, tries floor and ceil of both coordinates
+   */
+  uint32_t compressNormal(glm::vec3 const&normal,NormalEncoding normalEncoding){
+    auto const scale   = getNormalScale(normalEncoding);
+    auto const encoded = encodeOctahedral(normal) * scale;
+    auto const base    = glm::floor(encoded);
+    uint32_t best      = 0;
+    float    bestDot   = -std::numeric_limits<float>::max();
+    for(int y=0;y<2;++y)
+      for(int x=0;x<2;++x){
+        auto const candidate = glm::clamp((base + glm::vec2(x,y)) / scale,-1.f,1.f);
+        auto const dot       = glm::dot(decodeOctahedral(candidate),normal);
+        if(dot <= bestDot)continue;
+        bestDot = dot;
+        best    = packNormal(candidate,normalEncoding);
+      }
+    return best;
+  }
+
+  uint16_t quantizeUnorm16(float value,float min,float extent){
+    if(extent <= 0.f)return 0;
+    return (uint16_t)std::lround(glm::clamp((value - min) / extent,0.f,1.f) * 65535.f);
+  }
+}
+
+glm::vec2 encodeOctahedral(glm::vec3 const&normal){
+  auto const n = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+  glm::vec2 result(n.x,n.y);
+  if(n.z < 0.f){
+    result = glm::vec2(
+        (1.f - std::abs(n.y)) * (n.x >= 0.f ? 1.f : -1.f),
+        (1.f - std::abs(n.x)) * (n.y >= 0.f ? 1.f : -1.f));
+  }
+  return result;
+}
+
+glm::vec3 decodeOctahedral(glm::vec2 const&encoded){
+  glm::vec3 n(encoded.x,encoded.y,1.f - std::abs(encoded.x) - std::abs(encoded.y));
+  float const t = std::max(-n.z,0.f);
+  n.x += n.x >= 0.f ? -t : t;
+  n.y += n.y >= 0.f ? -t : t;
+  return glm::normalize(n);
+}
+
+CompressedMesh compressVertices(std::vector<MeshVertex>const&vertices,NormalEncoding normalEncoding){
+  CompressedMesh mesh;
+  mesh.normalEncoding = normalEncoding;
+  if(vertices.empty())return mesh;
+
+  auto boundsMin = vertices.front().position;
+  auto boundsMax = vertices.front().position;
+  for(auto const&vertex:vertices){
+    boundsMin = glm::min(boundsMin,vertex.position);
+    boundsMax = glm::max(boundsMax,vertex.position);
+  }
+  mesh.bounds.min    = boundsMin;
+  mesh.bounds.extent = boundsMax - boundsMin;
+
+  mesh.vertices.resize(vertices.size());
+  for(size_t i=0;i<vertices.size();++i){
+    auto const&vertex = vertices[i];
+    auto      &result = mesh.vertices[i];
+    for(int c=0;c<3;++c)
+      result.position[c] = quantizeUnorm16(vertex.position[c],mesh.bounds.min[c],mesh.bounds.extent[c]);
+    result.normal = compressNormal(vertex.normal,normalEncoding);
+    result.coord  = glm::packHalf2x16(vertex.coord);
+  }
+  return mesh;
+}
+
+MeshVertex decompressVertex(CompressedVertex const&vertex,VertexBounds const&bounds,NormalEncoding normalEncoding){
+  MeshVertex result;
+  glm::vec3 const quantized(vertex.position[0],vertex.position[1],vertex.position[2]);
+  result.position = bounds.min + quantized / 65535.f * bounds.extent;
+  result.normal   = decodeOctahedral(unpackNormal(vertex.normal,normalEncoding));
+  result.coord    = glm::unpackHalf2x16(vertex.coord);
+  return result;
+}
+
+void addCompressedAttribs(
+    ge::gl::VertexArray                  &vao           ,
+    std::shared_ptr<ge::gl::Buffer>const&buffer        ,
+    NormalEncoding                        normalEncoding,
+    GLuint                                positionIndex ,
+    GLuint                                normalIndex   ,
+    GLuint                                coordIndex    ){
+  GLsizei const stride = sizeof(CompressedVertex);
+  vao.addAttrib(buffer,positionIndex,3,GL_UNSIGNED_SHORT,stride,offsetof(CompressedVertex,position),GL_TRUE);
+  if(normalEncoding == NormalEncoding::OCTAHEDRAL_INT_2_10_10_10)
+    vao.addAttrib(buffer,normalIndex,4,GL_INT_2_10_10_10_REV,stride,offsetof(CompressedVertex,normal),GL_TRUE);
+  else
+    vao.addAttrib(buffer,normalIndex,2,GL_SHORT,stride,offsetof(CompressedVertex,normal),GL_TRUE);
+  vao.addAttrib(buffer,coordIndex,2,GL_HALF_FLOAT,stride,offsetof(CompressedVertex,coord),GL_FALSE);
+}
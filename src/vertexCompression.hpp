@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include<geGL/geGL.h>
+#include<glm/glm.hpp>
+
+#include <parametricMesh.hpp>
+
+/**
+ * @brief encoding of octahedral normal, both use 4 bytes
+ */
+enum class NormalEncoding{
+  OCTAHEDRAL_SNORM16       ,///<2 x GL_SHORT normalized
+  OCTAHEDRAL_INT_2_10_10_10,///<GL_INT_2_10_10_10_REV normalized, octahedral coordinates in x and y
+};
+
+/**
+ * @brief 16 byte vertex (MeshVertex has 32 bytes)
+ * Position is unorm16 relative to bounds of mesh, normal is octahedral
+ * and texture coordinate is half float.
+ */
+struct CompressedVertex{
+  uint16_t position[4] = {};///<x,y,z unorm16 relative to VertexBounds, w is padding
+  uint32_t normal      = 0 ;///<octahedral normal, see NormalEncoding
+  uint32_t coord       = 0 ;///<2 x half float
+};
+
+/**
+ * @brief axis aligned box that positions are quantized into
+ */
+struct VertexBounds{
+  glm::vec3 min    = glm::vec3(0.f);
+  glm::vec3 extent = glm::vec3(0.f);///<max - min
+};
+
+struct CompressedMesh{
+  std::vector<CompressedVertex>vertices                                       ;
+  VertexBounds                 bounds                                         ;
+  NormalEncoding               normalEncoding = NormalEncoding::OCTAHEDRAL_SNORM16;
+};
+
+/**
+ * @brief maps unit vector onto [-1,1]^2 (octahedron unfolded into square)
+ */
+glm::vec2 encodeOctahedral(glm::vec3 const&normal);
+glm::vec3 decodeOctahedral(glm::vec2 const&encoded);
+
+/**
+ * @brief compresses vertices, bounds are computed from all vertices
+ * Quantized octahedral coordinates are chosen from 4 nearest candidates
+ * so that the decoded normal has the smallest angular error.
+ *
+ * @param vertices vertices, normals have to be normalized
+ * @param normalEncoding encoding of normals
+ *
+ * @return compressed vertices in the same order
+ */
+CompressedMesh compressVertices(
+    std::vector<MeshVertex>const&vertices                                           ,
+    NormalEncoding               normalEncoding = NormalEncoding::OCTAHEDRAL_SNORM16);
+
+/**
+ * @brief decodes vertex on CPU exactly like vertexDecode.vp does on GPU
+ */
+MeshVertex decompressVertex(CompressedVertex const&vertex,VertexBounds const&bounds,NormalEncoding normalEncoding);
+
+/**
+ * @brief adds attributes of CompressedVertex into vertex array
+ * Attributes are normalized: position is vec3 in [0,1] (decodePosition),
+ * normal is vec2 in [-1,1] (decodeOctahedral), coord is vec2.
+ *
+ * @param vao vertex array
+ * @param buffer buffer with CompressedVertex array
+ * @param normalEncoding encoding of normals
+ * @param positionIndex attribute location of position
+ * @param normalIndex attribute location of normal
+ * @param coordIndex attribute location of texture coordinate
+ */
+void addCompressedAttribs(
+    ge::gl::VertexArray                  &vao               ,
+    std::shared_ptr<ge::gl::Buffer>const&buffer             ,
+    NormalEncoding                        normalEncoding    ,
+    GLuint                                positionIndex = 0 ,
+    GLuint                                normalIndex   = 1 ,
+    GLuint                                coordIndex    = 2 );